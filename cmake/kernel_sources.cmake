@@ -0,0 +1,83 @@
+
+# ==================================================================================================
+# This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+# project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+# width of 100 characters per line.
+#
+# Author(s):
+#   Cedric Nugteren <www.cedricnugteren.nl>
+#
+# This file generates the table of embedded kernel sources (see 'src/kernel_sources.hpp'): the
+# contents of the raw string literal of each '.opencl' file are stored once as a byte array, which
+# is gzip-compressed if requested and supported by this version of CMake (3.18 or higher).
+#
+# ==================================================================================================
+
+# Converts a string of hexadecimal digits into the contents of a C++ byte array
+function(kernel_sources_hex_to_bytes HEX RESULT)
+  set(HEX32 "[0-9a-f][0-9a-f][0-9a-f][0-9a-f][0-9a-f][0-9a-f][0-9a-f][0-9a-f]")
+  set(HEX32 "${HEX32}${HEX32}${HEX32}${HEX32}")
+  string(REGEX REPLACE "(${HEX32}${HEX32})" "\\1\n" BYTES "${HEX}")
+  string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," BYTES "${BYTES}")
+  set(${RESULT} "${BYTES}" PARENT_SCOPE)
+endfunction()
+
+# Generates the table with all '.opencl' files in the sub-directories of the given kernel directory
+# (i.e. all but the common source, which is part of every program) as a C++ header
+function(generate_kernel_sources KERNEL_DIR OUTPUT COMPRESS)
+  if(COMPRESS AND CMAKE_VERSION VERSION_LESS 3.18)
+    message("-- Storing the kernel sources uncompressed, compression requires CMake 3.18")
+    set(COMPRESS OFF)
+  endif()
+  set(TEMP_DIR ${CMAKE_CURRENT_BINARY_DIR}/kernel_sources)
+  file(MAKE_DIRECTORY ${TEMP_DIR})
+
+  file(GLOB KERNEL_FILES RELATIVE ${KERNEL_DIR} ${KERNEL_DIR}/*/*.opencl)
+  list(SORT KERNEL_FILES)
+  set(ARRAYS "")
+  set(ENTRIES "")
+  set(INDEX 0)
+  foreach(KERNEL_FILE ${KERNEL_FILES})
+
+    # Extracts the contents of the raw string literal, the way the C++ pre-processor would
+    file(READ ${KERNEL_DIR}/${KERNEL_FILE} CONTENTS)
+    string(FIND "${CONTENTS}" "R\"(" BEGIN)
+    string(FIND "${CONTENTS}" ")\"" END REVERSE)
+    if(BEGIN EQUAL -1 OR END EQUAL -1)
+      message(FATAL_ERROR "No raw string literal found in kernel source '${KERNEL_FILE}'")
+    endif()
+    math(EXPR BEGIN "${BEGIN} + 3")
+    math(EXPR LENGTH "${END} - ${BEGIN}")
+
+    # Stores the source as is or compressed as a gzip stream
+    if(COMPRESS)
+      string(SUBSTRING "${CONTENTS}" ${BEGIN} ${LENGTH} SOURCE)
+      file(WRITE ${TEMP_DIR}/source${INDEX} "${SOURCE}")
+      file(ARCHIVE_CREATE OUTPUT ${TEMP_DIR}/source${INDEX}.gz PATHS ${TEMP_DIR}/source${INDEX}
+           FORMAT raw COMPRESSION GZip)
+      file(READ ${TEMP_DIR}/source${INDEX}.gz HEX HEX)
+      set(IS_COMPRESSED "true")
+    else()
+      file(READ ${KERNEL_DIR}/${KERNEL_FILE} HEX OFFSET ${BEGIN} LIMIT ${LENGTH} HEX)
+      set(IS_COMPRESSED "false")
+    endif()
+    kernel_sources_hex_to_bytes("${HEX}" BYTES)
+    set(ARRAYS "${ARRAYS}const unsigned char kKernelSource${INDEX}[] = {\n${BYTES}\n};\n")
+    set(ENTRIES "${ENTRIES}  {\"${KERNEL_FILE}\", kKernelSource${INDEX}, ")
+    set(ENTRIES "${ENTRIES}sizeof(kKernelSource${INDEX}), ${LENGTH}, ${IS_COMPRESSED}},\n")
+    math(EXPR INDEX "${INDEX} + 1")
+  endforeach()
+
+  # Writes the table, only touching the file if it changed to avoid needless recompilation
+  set(TABLE "// Generated by 'cmake/kernel_sources.cmake' from the '.opencl' files, do not edit\n\n")
+  set(TABLE "${TABLE}${ARRAYS}\nconst KernelSourceEntry kKernelSourceTable[] = {\n${ENTRIES}};\n")
+  file(WRITE ${TEMP_DIR}/table.hpp "${TABLE}")
+  configure_file(${TEMP_DIR}/table.hpp ${OUTPUT} COPYONLY)
+
+  # Re-runs this generation when any of the kernel files changes
+  foreach(KERNEL_FILE ${KERNEL_FILES})
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${KERNEL_DIR}/${KERNEL_FILE})
+  endforeach()
+endfunction()
+
+# ==================================================================================================
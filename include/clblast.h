@@ -18,6 +18,8 @@
 
 #include <cstdlib> // For size_t
 #include <string> // For OverrideParameters function
+#include <vector> // For FillCache function
+#include <cstdint> // For ImportExternalMemory function
 #include <unordered_map> // For OverrideParameters function
 
 // Includes the normal OpenCL C header
@@ -118,9 +120,24 @@ enum class Triangle { kUpper = 121, kLower = 122 };
 enum class Diagonal { kNonUnit = 131, kUnit = 132 };
 enum class Side { kLeft = 141, kRight = 142 };
 
-// Precision scoped enum (values in bits)
+// Precision scoped enum (values in bits). The mixed half/single precision is only used for tuning
+// and database purposes: half-precision data with single-precision accumulation in GEMM.
+// BFloat16 is the 16-bit "brain" floating-point format, only supported by GEMM and AXPY.
+// Int8 is 8-bit signed integer data with 32-bit integer accumulation, only supported by GEMM.
+// HalfStorage is half-precision data computed in single precision on devices without FP16
+// support, only used internally by GEMM, GEMV and some level-1 routines (see the docs).
 enum class Precision { kHalf = 16, kSingle = 32, kDouble = 64,
-                       kComplexSingle = 3232, kComplexDouble = 6464, kAny = -1 };
+                       kComplexSingle = 3232, kComplexDouble = 6464,
+                       kHalfSingle = 1632, kBFloat16 = 1616, kInt8 = 832,
+                       kHalfStorage = 1600, kAny = -1 };
+
+// Opaque handle bundling per-user state, see 'HandleCreate' at the bottom of this file. Each routine
+// has an overload taking a handle instead of a queue and an event, which runs on the handle's queue.
+class Handle;
+
+// Returns the queue of a handle and makes the next routine called on it from this host thread use
+// the handle's state, as done by the routine overloads taking a handle
+cl_command_queue* PUBLIC_API HandleQueue(Handle* handle);
 
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
@@ -133,6 +150,18 @@ StatusCode Rotg(cl_mem sa_buffer, const size_t sa_offset,
                 cl_mem sc_buffer, const size_t sc_offset,
                 cl_mem ss_buffer, const size_t ss_offset,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Rotg(Handle* handle,
+                       cl_mem sa_buffer, const size_t sa_offset,
+                       cl_mem sb_buffer, const size_t sb_offset,
+                       cl_mem sc_buffer, const size_t sc_offset,
+                       cl_mem ss_buffer, const size_t ss_offset) {
+  return Rotg<T>(sa_buffer, sa_offset,
+                 sb_buffer, sb_offset,
+                 sc_buffer, sc_offset,
+                 ss_buffer, ss_offset,
+                 HandleQueue(handle));
+}
 
 // Generate modified givens plane rotation: SROTMG/DROTMG
 template <typename T>
@@ -142,6 +171,20 @@ StatusCode Rotmg(cl_mem sd1_buffer, const size_t sd1_offset,
                  const cl_mem sy1_buffer, const size_t sy1_offset,
                  cl_mem sparam_buffer, const size_t sparam_offset,
                  cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Rotmg(Handle* handle,
+                        cl_mem sd1_buffer, const size_t sd1_offset,
+                        cl_mem sd2_buffer, const size_t sd2_offset,
+                        cl_mem sx1_buffer, const size_t sx1_offset,
+                        const cl_mem sy1_buffer, const size_t sy1_offset,
+                        cl_mem sparam_buffer, const size_t sparam_offset) {
+  return Rotmg<T>(sd1_buffer, sd1_offset,
+                  sd2_buffer, sd2_offset,
+                  sx1_buffer, sx1_offset,
+                  sy1_buffer, sy1_offset,
+                  sparam_buffer, sparam_offset,
+                  HandleQueue(handle));
+}
 
 // Apply givens plane rotation: SROT/DROT
 template <typename T>
@@ -151,6 +194,20 @@ StatusCode Rot(const size_t n,
                const T cos,
                const T sin,
                cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Rot(Handle* handle,
+                      const size_t n,
+                      cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      const T cos,
+                      const T sin) {
+  return Rot<T>(n,
+                x_buffer, x_offset, x_inc,
+                y_buffer, y_offset, y_inc,
+                cos,
+                sin,
+                HandleQueue(handle));
+}
 
 // Apply modified givens plane rotation: SROTM/DROTM
 template <typename T>
@@ -159,6 +216,18 @@ StatusCode Rotm(const size_t n,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_mem sparam_buffer, const size_t sparam_offset,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Rotm(Handle* handle,
+                       const size_t n,
+                       cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       cl_mem sparam_buffer, const size_t sparam_offset) {
+  return Rotm<T>(n,
+                 x_buffer, x_offset, x_inc,
+                 y_buffer, y_offset, y_inc,
+                 sparam_buffer, sparam_offset,
+                 HandleQueue(handle));
+}
 
 // Swap two vectors: SSWAP/DSWAP/CSWAP/ZSWAP/HSWAP
 template <typename T>
@@ -166,6 +235,16 @@ StatusCode Swap(const size_t n,
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Swap(Handle* handle,
+                       const size_t n,
+                       cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Swap<T>(n,
+                 x_buffer, x_offset, x_inc,
+                 y_buffer, y_offset, y_inc,
+                 HandleQueue(handle));
+}
 
 // Vector scaling: SSCAL/DSCAL/CSCAL/ZSCAL/HSCAL
 template <typename T>
@@ -173,6 +252,16 @@ StatusCode Scal(const size_t n,
                 const T alpha,
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Scal(Handle* handle,
+                       const size_t n,
+                       const T alpha,
+                       cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Scal<T>(n,
+                 alpha,
+                 x_buffer, x_offset, x_inc,
+                 HandleQueue(handle));
+}
 
 // Vector copy: SCOPY/DCOPY/CCOPY/ZCOPY/HCOPY
 template <typename T>
@@ -180,6 +269,16 @@ StatusCode Copy(const size_t n,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Copy(Handle* handle,
+                       const size_t n,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Copy<T>(n,
+                 x_buffer, x_offset, x_inc,
+                 y_buffer, y_offset, y_inc,
+                 HandleQueue(handle));
+}
 
 // Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
 template <typename T>
@@ -188,6 +287,18 @@ StatusCode Axpy(const size_t n,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Axpy(Handle* handle,
+                       const size_t n,
+                       const T alpha,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Axpy<T>(n,
+                 alpha,
+                 x_buffer, x_offset, x_inc,
+                 y_buffer, y_offset, y_inc,
+                 HandleQueue(handle));
+}
 
 // Dot product of two vectors: SDOT/DDOT/HDOT
 template <typename T>
@@ -196,6 +307,18 @@ StatusCode Dot(const size_t n,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Dot(Handle* handle,
+                      const size_t n,
+                      cl_mem dot_buffer, const size_t dot_offset,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      const cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Dot<T>(n,
+                dot_buffer, dot_offset,
+                x_buffer, x_offset, x_inc,
+                y_buffer, y_offset, y_inc,
+                HandleQueue(handle));
+}
 
 // Dot product of two complex vectors: CDOTU/ZDOTU
 template <typename T>
@@ -204,6 +327,18 @@ StatusCode Dotu(const size_t n,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Dotu(Handle* handle,
+                       const size_t n,
+                       cl_mem dot_buffer, const size_t dot_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Dotu<T>(n,
+                 dot_buffer, dot_offset,
+                 x_buffer, x_offset, x_inc,
+                 y_buffer, y_offset, y_inc,
+                 HandleQueue(handle));
+}
 
 // Dot product of two complex vectors, one conjugated: CDOTC/ZDOTC
 template <typename T>
@@ -212,6 +347,18 @@ StatusCode Dotc(const size_t n,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Dotc(Handle* handle,
+                       const size_t n,
+                       cl_mem dot_buffer, const size_t dot_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Dotc<T>(n,
+                 dot_buffer, dot_offset,
+                 x_buffer, x_offset, x_inc,
+                 y_buffer, y_offset, y_inc,
+                 HandleQueue(handle));
+}
 
 // Euclidian norm of a vector: SNRM2/DNRM2/ScNRM2/DzNRM2/HNRM2
 template <typename T>
@@ -219,6 +366,16 @@ StatusCode Nrm2(const size_t n,
                 cl_mem nrm2_buffer, const size_t nrm2_offset,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Nrm2(Handle* handle,
+                       const size_t n,
+                       cl_mem nrm2_buffer, const size_t nrm2_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Nrm2<T>(n,
+                 nrm2_buffer, nrm2_offset,
+                 x_buffer, x_offset, x_inc,
+                 HandleQueue(handle));
+}
 
 // Absolute sum of values in a vector: SASUM/DASUM/ScASUM/DzASUM/HASUM
 template <typename T>
@@ -226,6 +383,16 @@ StatusCode Asum(const size_t n,
                 cl_mem asum_buffer, const size_t asum_offset,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Asum(Handle* handle,
+                       const size_t n,
+                       cl_mem asum_buffer, const size_t asum_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Asum<T>(n,
+                 asum_buffer, asum_offset,
+                 x_buffer, x_offset, x_inc,
+                 HandleQueue(handle));
+}
 
 // Sum of values in a vector (non-BLAS function): SSUM/DSUM/ScSUM/DzSUM/HSUM
 template <typename T>
@@ -233,6 +400,16 @@ StatusCode Sum(const size_t n,
                cl_mem sum_buffer, const size_t sum_offset,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Sum(Handle* handle,
+                      const size_t n,
+                      cl_mem sum_buffer, const size_t sum_offset,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Sum<T>(n,
+                sum_buffer, sum_offset,
+                x_buffer, x_offset, x_inc,
+                HandleQueue(handle));
+}
 
 // Index of absolute maximum value in a vector: iSAMAX/iDAMAX/iCAMAX/iZAMAX/iHAMAX
 template <typename T>
@@ -240,6 +417,16 @@ StatusCode Amax(const size_t n,
                 cl_mem imax_buffer, const size_t imax_offset,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Amax(Handle* handle,
+                       const size_t n,
+                       cl_mem imax_buffer, const size_t imax_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Amax<T>(n,
+                 imax_buffer, imax_offset,
+                 x_buffer, x_offset, x_inc,
+                 HandleQueue(handle));
+}
 
 // Index of absolute minimum value in a vector (non-BLAS function): iSAMIN/iDAMIN/iCAMIN/iZAMIN/iHAMIN
 template <typename T>
@@ -247,6 +434,16 @@ StatusCode Amin(const size_t n,
                 cl_mem imin_buffer, const size_t imin_offset,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Amin(Handle* handle,
+                       const size_t n,
+                       cl_mem imin_buffer, const size_t imin_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Amin<T>(n,
+                 imin_buffer, imin_offset,
+                 x_buffer, x_offset, x_inc,
+                 HandleQueue(handle));
+}
 
 // Index of maximum value in a vector (non-BLAS function): iSMAX/iDMAX/iCMAX/iZMAX/iHMAX
 template <typename T>
@@ -254,6 +451,16 @@ StatusCode Max(const size_t n,
                cl_mem imax_buffer, const size_t imax_offset,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Max(Handle* handle,
+                      const size_t n,
+                      cl_mem imax_buffer, const size_t imax_offset,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Max<T>(n,
+                imax_buffer, imax_offset,
+                x_buffer, x_offset, x_inc,
+                HandleQueue(handle));
+}
 
 // Index of minimum value in a vector (non-BLAS function): iSMIN/iDMIN/iCMIN/iZMIN/iHMIN
 template <typename T>
@@ -261,6 +468,16 @@ StatusCode Min(const size_t n,
                cl_mem imin_buffer, const size_t imin_offset,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Min(Handle* handle,
+                      const size_t n,
+                      cl_mem imin_buffer, const size_t imin_offset,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Min<T>(n,
+                imin_buffer, imin_offset,
+                x_buffer, x_offset, x_inc,
+                HandleQueue(handle));
+}
 
 // =================================================================================================
 // BLAS level-2 (matrix-vector) routines
@@ -276,6 +493,24 @@ StatusCode Gemv(const Layout layout, const Transpose a_transpose,
                 const T beta,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Gemv(Handle* handle,
+                       const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n,
+                       const T alpha,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const T beta,
+                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Gemv<T>(layout, a_transpose,
+                 m, n,
+                 alpha,
+                 a_buffer, a_offset, a_ld,
+                 x_buffer, x_offset, x_inc,
+                 beta,
+                 y_buffer, y_offset, y_inc,
+                 HandleQueue(handle));
+}
 
 // General banded matrix-vector multiplication: SGBMV/DGBMV/CGBMV/ZGBMV/HGBMV
 template <typename T>
@@ -287,6 +522,24 @@ StatusCode Gbmv(const Layout layout, const Transpose a_transpose,
                 const T beta,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Gbmv(Handle* handle,
+                       const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n, const size_t kl, const size_t ku,
+                       const T alpha,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const T beta,
+                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Gbmv<T>(layout, a_transpose,
+                 m, n, kl, ku,
+                 alpha,
+                 a_buffer, a_offset, a_ld,
+                 x_buffer, x_offset, x_inc,
+                 beta,
+                 y_buffer, y_offset, y_inc,
+                 HandleQueue(handle));
+}
 
 // Hermitian matrix-vector multiplication: CHEMV/ZHEMV
 template <typename T>
@@ -298,6 +551,24 @@ StatusCode Hemv(const Layout layout, const Triangle triangle,
                 const T beta,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Hemv(Handle* handle,
+                       const Layout layout, const Triangle triangle,
+                       const size_t n,
+                       const T alpha,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const T beta,
+                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Hemv<T>(layout, triangle,
+                 n,
+                 alpha,
+                 a_buffer, a_offset, a_ld,
+                 x_buffer, x_offset, x_inc,
+                 beta,
+                 y_buffer, y_offset, y_inc,
+                 HandleQueue(handle));
+}
 
 // Hermitian banded matrix-vector multiplication: CHBMV/ZHBMV
 template <typename T>
@@ -309,6 +580,24 @@ StatusCode Hbmv(const Layout layout, const Triangle triangle,
                 const T beta,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Hbmv(Handle* handle,
+                       const Layout layout, const Triangle triangle,
+                       const size_t n, const size_t k,
+                       const T alpha,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const T beta,
+                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Hbmv<T>(layout, triangle,
+                 n, k,
+                 alpha,
+                 a_buffer, a_offset, a_ld,
+                 x_buffer, x_offset, x_inc,
+                 beta,
+                 y_buffer, y_offset, y_inc,
+                 HandleQueue(handle));
+}
 
 // Hermitian packed matrix-vector multiplication: CHPMV/ZHPMV
 template <typename T>
@@ -320,6 +609,24 @@ StatusCode Hpmv(const Layout layout, const Triangle triangle,
                 const T beta,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Hpmv(Handle* handle,
+                       const Layout layout, const Triangle triangle,
+                       const size_t n,
+                       const T alpha,
+                       const cl_mem ap_buffer, const size_t ap_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const T beta,
+                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Hpmv<T>(layout, triangle,
+                 n,
+                 alpha,
+                 ap_buffer, ap_offset,
+                 x_buffer, x_offset, x_inc,
+                 beta,
+                 y_buffer, y_offset, y_inc,
+                 HandleQueue(handle));
+}
 
 // Symmetric matrix-vector multiplication: SSYMV/DSYMV/HSYMV
 template <typename T>
@@ -331,6 +638,24 @@ StatusCode Symv(const Layout layout, const Triangle triangle,
                 const T beta,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Symv(Handle* handle,
+                       const Layout layout, const Triangle triangle,
+                       const size_t n,
+                       const T alpha,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const T beta,
+                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Symv<T>(layout, triangle,
+                 n,
+                 alpha,
+                 a_buffer, a_offset, a_ld,
+                 x_buffer, x_offset, x_inc,
+                 beta,
+                 y_buffer, y_offset, y_inc,
+                 HandleQueue(handle));
+}
 
 // Symmetric banded matrix-vector multiplication: SSBMV/DSBMV/HSBMV
 template <typename T>
@@ -342,6 +667,24 @@ StatusCode Sbmv(const Layout layout, const Triangle triangle,
                 const T beta,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Sbmv(Handle* handle,
+                       const Layout layout, const Triangle triangle,
+                       const size_t n, const size_t k,
+                       const T alpha,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const T beta,
+                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Sbmv<T>(layout, triangle,
+                 n, k,
+                 alpha,
+                 a_buffer, a_offset, a_ld,
+                 x_buffer, x_offset, x_inc,
+                 beta,
+                 y_buffer, y_offset, y_inc,
+                 HandleQueue(handle));
+}
 
 // Symmetric packed matrix-vector multiplication: SSPMV/DSPMV/HSPMV
 template <typename T>
@@ -353,6 +696,24 @@ StatusCode Spmv(const Layout layout, const Triangle triangle,
                 const T beta,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Spmv(Handle* handle,
+                       const Layout layout, const Triangle triangle,
+                       const size_t n,
+                       const T alpha,
+                       const cl_mem ap_buffer, const size_t ap_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const T beta,
+                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Spmv<T>(layout, triangle,
+                 n,
+                 alpha,
+                 ap_buffer, ap_offset,
+                 x_buffer, x_offset, x_inc,
+                 beta,
+                 y_buffer, y_offset, y_inc,
+                 HandleQueue(handle));
+}
 
 // Triangular matrix-vector multiplication: STRMV/DTRMV/CTRMV/ZTRMV/HTRMV
 template <typename T>
@@ -361,6 +722,18 @@ StatusCode Trmv(const Layout layout, const Triangle triangle, const Transpose a_
                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Trmv(Handle* handle,
+                       const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t n,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Trmv<T>(layout, triangle, a_transpose, diagonal,
+                 n,
+                 a_buffer, a_offset, a_ld,
+                 x_buffer, x_offset, x_inc,
+                 HandleQueue(handle));
+}
 
 // Triangular banded matrix-vector multiplication: STBMV/DTBMV/CTBMV/ZTBMV/HTBMV
 template <typename T>
@@ -369,6 +742,18 @@ StatusCode Tbmv(const Layout layout, const Triangle triangle, const Transpose a_
                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Tbmv(Handle* handle,
+                       const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t n, const size_t k,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Tbmv<T>(layout, triangle, a_transpose, diagonal,
+                 n, k,
+                 a_buffer, a_offset, a_ld,
+                 x_buffer, x_offset, x_inc,
+                 HandleQueue(handle));
+}
 
 // Triangular packed matrix-vector multiplication: STPMV/DTPMV/CTPMV/ZTPMV/HTPMV
 template <typename T>
@@ -377,6 +762,18 @@ StatusCode Tpmv(const Layout layout, const Triangle triangle, const Transpose a_
                 const cl_mem ap_buffer, const size_t ap_offset,
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Tpmv(Handle* handle,
+                       const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t n,
+                       const cl_mem ap_buffer, const size_t ap_offset,
+                       cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Tpmv<T>(layout, triangle, a_transpose, diagonal,
+                 n,
+                 ap_buffer, ap_offset,
+                 x_buffer, x_offset, x_inc,
+                 HandleQueue(handle));
+}
 
 // Solves a triangular system of equations: STRSV/DTRSV/CTRSV/ZTRSV
 template <typename T>
@@ -385,6 +782,18 @@ StatusCode Trsv(const Layout layout, const Triangle triangle, const Transpose a_
                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Trsv(Handle* handle,
+                       const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t n,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Trsv<T>(layout, triangle, a_transpose, diagonal,
+                 n,
+                 a_buffer, a_offset, a_ld,
+                 x_buffer, x_offset, x_inc,
+                 HandleQueue(handle));
+}
 
 // Solves a banded triangular system of equations: STBSV/DTBSV/CTBSV/ZTBSV
 template <typename T>
@@ -393,6 +802,18 @@ StatusCode Tbsv(const Layout layout, const Triangle triangle, const Transpose a_
                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Tbsv(Handle* handle,
+                       const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t n, const size_t k,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Tbsv<T>(layout, triangle, a_transpose, diagonal,
+                 n, k,
+                 a_buffer, a_offset, a_ld,
+                 x_buffer, x_offset, x_inc,
+                 HandleQueue(handle));
+}
 
 // Solves a packed triangular system of equations: STPSV/DTPSV/CTPSV/ZTPSV
 template <typename T>
@@ -401,6 +822,18 @@ StatusCode Tpsv(const Layout layout, const Triangle triangle, const Transpose a_
                 const cl_mem ap_buffer, const size_t ap_offset,
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Tpsv(Handle* handle,
+                       const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t n,
+                       const cl_mem ap_buffer, const size_t ap_offset,
+                       cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Tpsv<T>(layout, triangle, a_transpose, diagonal,
+                 n,
+                 ap_buffer, ap_offset,
+                 x_buffer, x_offset, x_inc,
+                 HandleQueue(handle));
+}
 
 // General rank-1 matrix update: SGER/DGER/HGER
 template <typename T>
@@ -411,6 +844,22 @@ StatusCode Ger(const Layout layout,
                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Ger(Handle* handle,
+                      const Layout layout,
+                      const size_t m, const size_t n,
+                      const T alpha,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_mem a_buffer, const size_t a_offset, const size_t a_ld) {
+  return Ger<T>(layout,
+                m, n,
+                alpha,
+                x_buffer, x_offset, x_inc,
+                y_buffer, y_offset, y_inc,
+                a_buffer, a_offset, a_ld,
+                HandleQueue(handle));
+}
 
 // General rank-1 complex matrix update: CGERU/ZGERU
 template <typename T>
@@ -421,6 +870,22 @@ StatusCode Geru(const Layout layout,
                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Geru(Handle* handle,
+                       const Layout layout,
+                       const size_t m, const size_t n,
+                       const T alpha,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       cl_mem a_buffer, const size_t a_offset, const size_t a_ld) {
+  return Geru<T>(layout,
+                 m, n,
+                 alpha,
+                 x_buffer, x_offset, x_inc,
+                 y_buffer, y_offset, y_inc,
+                 a_buffer, a_offset, a_ld,
+                 HandleQueue(handle));
+}
 
 // General rank-1 complex conjugated matrix update: CGERC/ZGERC
 template <typename T>
@@ -431,6 +896,22 @@ StatusCode Gerc(const Layout layout,
                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Gerc(Handle* handle,
+                       const Layout layout,
+                       const size_t m, const size_t n,
+                       const T alpha,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       cl_mem a_buffer, const size_t a_offset, const size_t a_ld) {
+  return Gerc<T>(layout,
+                 m, n,
+                 alpha,
+                 x_buffer, x_offset, x_inc,
+                 y_buffer, y_offset, y_inc,
+                 a_buffer, a_offset, a_ld,
+                 HandleQueue(handle));
+}
 
 // Hermitian rank-1 matrix update: CHER/ZHER
 template <typename T>
@@ -440,6 +921,20 @@ StatusCode Her(const Layout layout, const Triangle triangle,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Her(Handle* handle,
+                      const Layout layout, const Triangle triangle,
+                      const size_t n,
+                      const T alpha,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_mem a_buffer, const size_t a_offset, const size_t a_ld) {
+  return Her<T>(layout, triangle,
+                n,
+                alpha,
+                x_buffer, x_offset, x_inc,
+                a_buffer, a_offset, a_ld,
+                HandleQueue(handle));
+}
 
 // Hermitian packed rank-1 matrix update: CHPR/ZHPR
 template <typename T>
@@ -449,6 +944,20 @@ StatusCode Hpr(const Layout layout, const Triangle triangle,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                cl_mem ap_buffer, const size_t ap_offset,
                cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Hpr(Handle* handle,
+                      const Layout layout, const Triangle triangle,
+                      const size_t n,
+                      const T alpha,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_mem ap_buffer, const size_t ap_offset) {
+  return Hpr<T>(layout, triangle,
+                n,
+                alpha,
+                x_buffer, x_offset, x_inc,
+                ap_buffer, ap_offset,
+                HandleQueue(handle));
+}
 
 // Hermitian rank-2 matrix update: CHER2/ZHER2
 template <typename T>
@@ -459,6 +968,22 @@ StatusCode Her2(const Layout layout, const Triangle triangle,
                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Her2(Handle* handle,
+                       const Layout layout, const Triangle triangle,
+                       const size_t n,
+                       const T alpha,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       cl_mem a_buffer, const size_t a_offset, const size_t a_ld) {
+  return Her2<T>(layout, triangle,
+                 n,
+                 alpha,
+                 x_buffer, x_offset, x_inc,
+                 y_buffer, y_offset, y_inc,
+                 a_buffer, a_offset, a_ld,
+                 HandleQueue(handle));
+}
 
 // Hermitian packed rank-2 matrix update: CHPR2/ZHPR2
 template <typename T>
@@ -469,6 +994,22 @@ StatusCode Hpr2(const Layout layout, const Triangle triangle,
                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_mem ap_buffer, const size_t ap_offset,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Hpr2(Handle* handle,
+                       const Layout layout, const Triangle triangle,
+                       const size_t n,
+                       const T alpha,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       cl_mem ap_buffer, const size_t ap_offset) {
+  return Hpr2<T>(layout, triangle,
+                 n,
+                 alpha,
+                 x_buffer, x_offset, x_inc,
+                 y_buffer, y_offset, y_inc,
+                 ap_buffer, ap_offset,
+                 HandleQueue(handle));
+}
 
 // Symmetric rank-1 matrix update: SSYR/DSYR/HSYR
 template <typename T>
@@ -478,6 +1019,20 @@ StatusCode Syr(const Layout layout, const Triangle triangle,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Syr(Handle* handle,
+                      const Layout layout, const Triangle triangle,
+                      const size_t n,
+                      const T alpha,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_mem a_buffer, const size_t a_offset, const size_t a_ld) {
+  return Syr<T>(layout, triangle,
+                n,
+                alpha,
+                x_buffer, x_offset, x_inc,
+                a_buffer, a_offset, a_ld,
+                HandleQueue(handle));
+}
 
 // Symmetric packed rank-1 matrix update: SSPR/DSPR/HSPR
 template <typename T>
@@ -487,6 +1042,20 @@ StatusCode Spr(const Layout layout, const Triangle triangle,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                cl_mem ap_buffer, const size_t ap_offset,
                cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Spr(Handle* handle,
+                      const Layout layout, const Triangle triangle,
+                      const size_t n,
+                      const T alpha,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_mem ap_buffer, const size_t ap_offset) {
+  return Spr<T>(layout, triangle,
+                n,
+                alpha,
+                x_buffer, x_offset, x_inc,
+                ap_buffer, ap_offset,
+                HandleQueue(handle));
+}
 
 // Symmetric rank-2 matrix update: SSYR2/DSYR2/HSYR2
 template <typename T>
@@ -497,6 +1066,22 @@ StatusCode Syr2(const Layout layout, const Triangle triangle,
                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Syr2(Handle* handle,
+                       const Layout layout, const Triangle triangle,
+                       const size_t n,
+                       const T alpha,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       cl_mem a_buffer, const size_t a_offset, const size_t a_ld) {
+  return Syr2<T>(layout, triangle,
+                 n,
+                 alpha,
+                 x_buffer, x_offset, x_inc,
+                 y_buffer, y_offset, y_inc,
+                 a_buffer, a_offset, a_ld,
+                 HandleQueue(handle));
+}
 
 // Symmetric packed rank-2 matrix update: SSPR2/DSPR2/HSPR2
 template <typename T>
@@ -507,6 +1092,22 @@ StatusCode Spr2(const Layout layout, const Triangle triangle,
                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_mem ap_buffer, const size_t ap_offset,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Spr2(Handle* handle,
+                       const Layout layout, const Triangle triangle,
+                       const size_t n,
+                       const T alpha,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       cl_mem ap_buffer, const size_t ap_offset) {
+  return Spr2<T>(layout, triangle,
+                 n,
+                 alpha,
+                 x_buffer, x_offset, x_inc,
+                 y_buffer, y_offset, y_inc,
+                 ap_buffer, ap_offset,
+                 HandleQueue(handle));
+}
 
 // =================================================================================================
 // BLAS level-3 (matrix-matrix) routines
@@ -523,6 +1124,24 @@ StatusCode Gemm(const Layout layout, const Transpose a_transpose, const Transpos
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event = nullptr,
                 cl_mem temp_buffer = nullptr);
+template <typename T>
+inline StatusCode Gemm(Handle* handle,
+                       const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t m, const size_t n, const size_t k,
+                       const T alpha,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                       const T beta,
+                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld) {
+  return Gemm<T>(layout, a_transpose, b_transpose,
+                 m, n, k,
+                 alpha,
+                 a_buffer, a_offset, a_ld,
+                 b_buffer, b_offset, b_ld,
+                 beta,
+                 c_buffer, c_offset, c_ld,
+                 HandleQueue(handle));
+}
 
 // Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM/HSYMM
 template <typename T>
@@ -534,6 +1153,24 @@ StatusCode Symm(const Layout layout, const Side side, const Triangle triangle,
                 const T beta,
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Symm(Handle* handle,
+                       const Layout layout, const Side side, const Triangle triangle,
+                       const size_t m, const size_t n,
+                       const T alpha,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                       const T beta,
+                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld) {
+  return Symm<T>(layout, side, triangle,
+                 m, n,
+                 alpha,
+                 a_buffer, a_offset, a_ld,
+                 b_buffer, b_offset, b_ld,
+                 beta,
+                 c_buffer, c_offset, c_ld,
+                 HandleQueue(handle));
+}
 
 // Hermitian matrix-matrix multiplication: CHEMM/ZHEMM
 template <typename T>
@@ -545,6 +1182,24 @@ StatusCode Hemm(const Layout layout, const Side side, const Triangle triangle,
                 const T beta,
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Hemm(Handle* handle,
+                       const Layout layout, const Side side, const Triangle triangle,
+                       const size_t m, const size_t n,
+                       const T alpha,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                       const T beta,
+                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld) {
+  return Hemm<T>(layout, side, triangle,
+                 m, n,
+                 alpha,
+                 a_buffer, a_offset, a_ld,
+                 b_buffer, b_offset, b_ld,
+                 beta,
+                 c_buffer, c_offset, c_ld,
+                 HandleQueue(handle));
+}
 
 // Rank-K update of a symmetric matrix: SSYRK/DSYRK/CSYRK/ZSYRK/HSYRK
 template <typename T>
@@ -555,6 +1210,22 @@ StatusCode Syrk(const Layout layout, const Triangle triangle, const Transpose a_
                 const T beta,
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Syrk(Handle* handle,
+                       const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                       const size_t n, const size_t k,
+                       const T alpha,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       const T beta,
+                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld) {
+  return Syrk<T>(layout, triangle, a_transpose,
+                 n, k,
+                 alpha,
+                 a_buffer, a_offset, a_ld,
+                 beta,
+                 c_buffer, c_offset, c_ld,
+                 HandleQueue(handle));
+}
 
 // Rank-K update of a hermitian matrix: CHERK/ZHERK
 template <typename T>
@@ -565,6 +1236,22 @@ StatusCode Herk(const Layout layout, const Triangle triangle, const Transpose a_
                 const T beta,
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Herk(Handle* handle,
+                       const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                       const size_t n, const size_t k,
+                       const T alpha,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       const T beta,
+                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld) {
+  return Herk<T>(layout, triangle, a_transpose,
+                 n, k,
+                 alpha,
+                 a_buffer, a_offset, a_ld,
+                 beta,
+                 c_buffer, c_offset, c_ld,
+                 HandleQueue(handle));
+}
 
 // Rank-2K update of a symmetric matrix: SSYR2K/DSYR2K/CSYR2K/ZSYR2K/HSYR2K
 template <typename T>
@@ -576,6 +1263,24 @@ StatusCode Syr2k(const Layout layout, const Triangle triangle, const Transpose a
                  const T beta,
                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                  cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Syr2k(Handle* handle,
+                        const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                        const size_t n, const size_t k,
+                        const T alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                        const T beta,
+                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld) {
+  return Syr2k<T>(layout, triangle, ab_transpose,
+                  n, k,
+                  alpha,
+                  a_buffer, a_offset, a_ld,
+                  b_buffer, b_offset, b_ld,
+                  beta,
+                  c_buffer, c_offset, c_ld,
+                  HandleQueue(handle));
+}
 
 // Rank-2K update of a hermitian matrix: CHER2K/ZHER2K
 template <typename T, typename U>
@@ -587,6 +1292,24 @@ StatusCode Her2k(const Layout layout, const Triangle triangle, const Transpose a
                  const U beta,
                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                  cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T, typename U>
+inline StatusCode Her2k(Handle* handle,
+                        const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                        const size_t n, const size_t k,
+                        const T alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                        const U beta,
+                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld) {
+  return Her2k<T, U>(layout, triangle, ab_transpose,
+                     n, k,
+                     alpha,
+                     a_buffer, a_offset, a_ld,
+                     b_buffer, b_offset, b_ld,
+                     beta,
+                     c_buffer, c_offset, c_ld,
+                     HandleQueue(handle));
+}
 
 // Triangular matrix-matrix multiplication: STRMM/DTRMM/CTRMM/ZTRMM/HTRMM
 template <typename T>
@@ -596,6 +1319,20 @@ StatusCode Trmm(const Layout layout, const Side side, const Triangle triangle, c
                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Trmm(Handle* handle,
+                       const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t m, const size_t n,
+                       const T alpha,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       cl_mem b_buffer, const size_t b_offset, const size_t b_ld) {
+  return Trmm<T>(layout, side, triangle, a_transpose, diagonal,
+                 m, n,
+                 alpha,
+                 a_buffer, a_offset, a_ld,
+                 b_buffer, b_offset, b_ld,
+                 HandleQueue(handle));
+}
 
 // Solves a triangular system of equations: STRSM/DTRSM/CTRSM/ZTRSM
 template <typename T>
@@ -605,6 +1342,20 @@ StatusCode Trsm(const Layout layout, const Side side, const Triangle triangle, c
                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Trsm(Handle* handle,
+                       const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t m, const size_t n,
+                       const T alpha,
+                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       cl_mem b_buffer, const size_t b_offset, const size_t b_ld) {
+  return Trsm<T>(layout, side, triangle, a_transpose, diagonal,
+                 m, n,
+                 alpha,
+                 a_buffer, a_offset, a_ld,
+                 b_buffer, b_offset, b_ld,
+                 HandleQueue(handle));
+}
 
 // =================================================================================================
 // Extra non-BLAS routines (level-X)
@@ -619,6 +1370,62 @@ StatusCode Had(const size_t n,
                const T beta,
                cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
                cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Had(Handle* handle,
+                      const size_t n,
+                      const T alpha,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      const T beta,
+                      cl_mem z_buffer, const size_t z_offset, const size_t z_inc) {
+  return Had<T>(n,
+                alpha,
+                x_buffer, x_offset, x_inc,
+                y_buffer, y_offset, y_inc,
+                beta,
+                z_buffer, z_offset, z_inc,
+                HandleQueue(handle));
+}
+
+// Scaling and addition of two vectors (non-BLAS function): SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+template <typename T>
+StatusCode Axpby(const size_t n,
+                 const T alpha,
+                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta,
+                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Axpby(Handle* handle,
+                        const size_t n,
+                        const T alpha,
+                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                        const T beta,
+                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Axpby<T>(n,
+                  alpha,
+                  x_buffer, x_offset, x_inc,
+                  beta,
+                  y_buffer, y_offset, y_inc,
+                  HandleQueue(handle));
+}
+
+// Sets all elements of a vector to a scalar value (non-BLAS function): SSET/DSET/CSET/ZSET/HSET
+template <typename T>
+StatusCode Set(const size_t n,
+               const T alpha,
+               cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Set(Handle* handle,
+                      const size_t n,
+                      const T alpha,
+                      cl_mem x_buffer, const size_t x_offset, const size_t x_inc) {
+  return Set<T>(n,
+                alpha,
+                x_buffer, x_offset, x_inc,
+                HandleQueue(handle));
+}
 
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 template <typename T>
@@ -628,6 +1435,20 @@ StatusCode Omatcopy(const Layout layout, const Transpose a_transpose,
                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
                     cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Omatcopy(Handle* handle,
+                           const Layout layout, const Transpose a_transpose,
+                           const size_t m, const size_t n,
+                           const T alpha,
+                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld) {
+  return Omatcopy<T>(layout, a_transpose,
+                     m, n,
+                     alpha,
+                     a_buffer, a_offset, a_ld,
+                     b_buffer, b_offset, b_ld,
+                     HandleQueue(handle));
+}
 
 // Im2col function (non-BLAS function): SIM2COL/DIM2COL/CIM2COL/ZIM2COL/HIM2COL
 template <typename T>
@@ -635,6 +1456,90 @@ StatusCode Im2col(const size_t channels, const size_t height, const size_t width
                   const cl_mem im_buffer, const size_t im_offset,
                   cl_mem col_buffer, const size_t col_offset,
                   cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Im2col(Handle* handle,
+                         const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                         const cl_mem im_buffer, const size_t im_offset,
+                         cl_mem col_buffer, const size_t col_offset) {
+  return Im2col<T>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                   im_buffer, im_offset,
+                   col_buffer, col_offset,
+                   HandleQueue(handle));
+}
+
+// Col2im function (non-BLAS function): SCOL2IM/DCOL2IM/CCOL2IM/ZCOL2IM/HCOL2IM
+template <typename T>
+StatusCode Col2im(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                  const cl_mem col_buffer, const size_t col_offset,
+                  cl_mem im_buffer, const size_t im_offset,
+                  cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Col2im(Handle* handle,
+                         const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                         const cl_mem col_buffer, const size_t col_offset,
+                         cl_mem im_buffer, const size_t im_offset) {
+  return Col2im<T>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                   col_buffer, col_offset,
+                   im_buffer, im_offset,
+                   HandleQueue(handle));
+}
+
+// Fused dot product, Euclidian norm and absolute sum (non-BLAS function): SDOTNRM2ASUM/DDOTNRM2ASUM/HDOTNRM2ASUM
+template <typename T>
+StatusCode Dotnrm2asum(const size_t n,
+                       cl_mem results_buffer, const size_t results_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Dotnrm2asum(Handle* handle,
+                              const size_t n,
+                              cl_mem results_buffer, const size_t results_offset,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              const cl_mem y_buffer, const size_t y_offset, const size_t y_inc) {
+  return Dotnrm2asum<T>(n,
+                        results_buffer, results_offset,
+                        x_buffer, x_offset, x_inc,
+                        y_buffer, y_offset, y_inc,
+                        HandleQueue(handle));
+}
+
+// Batched convolution as GEMM (non-BLAS function): SCONVGEMM/DCONVGEMM/HCONVGEMM
+template <typename T>
+StatusCode Convgemm(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const size_t num_kernels, const size_t batch_count,
+                    const cl_mem im_buffer, const size_t im_offset,
+                    const cl_mem kernel_buffer, const size_t kernel_offset,
+                    cl_mem result_buffer, const size_t result_offset,
+                    cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Convgemm(Handle* handle,
+                           const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const size_t num_kernels, const size_t batch_count,
+                           const cl_mem im_buffer, const size_t im_offset,
+                           const cl_mem kernel_buffer, const size_t kernel_offset,
+                           cl_mem result_buffer, const size_t result_offset) {
+  return Convgemm<T>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count,
+                     im_buffer, im_offset,
+                     kernel_buffer, kernel_offset,
+                     result_buffer, result_offset,
+                     HandleQueue(handle));
+}
+
+// Cholesky factorisation (non-BLAS function): SPOTRF/DPOTRF
+template <typename T>
+StatusCode Potrf(const Layout layout, const Triangle triangle,
+                 const size_t n,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Potrf(Handle* handle,
+                        const Layout layout, const Triangle triangle,
+                        const size_t n,
+                        cl_mem a_buffer, const size_t a_offset, const size_t a_ld) {
+  return Potrf<T>(layout, triangle,
+                  n,
+                  a_buffer, a_offset, a_ld,
+                  HandleQueue(handle));
+}
 
 // Batched version of AXPY: SAXPYBATCHED/DAXPYBATCHED/CAXPYBATCHED/ZAXPYBATCHED/HAXPYBATCHED
 template <typename T>
@@ -644,6 +1549,78 @@ StatusCode AxpyBatched(const size_t n,
                        cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
                        const size_t batch_count,
                        cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode AxpyBatched(Handle* handle,
+                              const size_t n,
+                              const T *alphas,
+                              const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                              cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                              const size_t batch_count) {
+  return AxpyBatched<T>(n,
+                        alphas,
+                        x_buffer, x_offsets, x_inc,
+                        y_buffer, y_offsets, y_inc,
+                        batch_count,
+                        HandleQueue(handle));
+}
+
+// Batched version of ROT: SROTBATCHED/DROTBATCHED
+template <typename T>
+StatusCode RotBatched(const size_t n,
+                      cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                      const T *coss,
+                      const T *sins,
+                      const size_t batch_count,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode RotBatched(Handle* handle,
+                             const size_t n,
+                             cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                             cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                             const T *coss,
+                             const T *sins,
+                             const size_t batch_count) {
+  return RotBatched<T>(n,
+                       x_buffer, x_offsets, x_inc,
+                       y_buffer, y_offsets, y_inc,
+                       coss,
+                       sins,
+                       batch_count,
+                       HandleQueue(handle));
+}
+
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+template <typename T>
+StatusCode GemvBatched(const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const T *betas,
+                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode GemvBatched(Handle* handle,
+                              const Layout layout, const Transpose a_transpose,
+                              const size_t m, const size_t n,
+                              const T *alphas,
+                              const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                              const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                              const T *betas,
+                              cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                              const size_t batch_count) {
+  return GemvBatched<T>(layout, a_transpose,
+                        m, n,
+                        alphas,
+                        a_buffer, a_offsets, a_ld,
+                        x_buffer, x_offsets, x_inc,
+                        betas,
+                        y_buffer, y_offsets, y_inc,
+                        batch_count,
+                        HandleQueue(handle));
+}
 
 // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
 template <typename T>
@@ -656,6 +1633,26 @@ StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const T
                        cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld,
                        const size_t batch_count,
                        cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode GemmBatched(Handle* handle,
+                              const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t m, const size_t n, const size_t k,
+                              const T *alphas,
+                              const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                              const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                              const T *betas,
+                              cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld,
+                              const size_t batch_count) {
+  return GemmBatched<T>(layout, a_transpose, b_transpose,
+                        m, n, k,
+                        alphas,
+                        a_buffer, a_offsets, a_ld,
+                        b_buffer, b_offsets, b_ld,
+                        betas,
+                        c_buffer, c_offsets, c_ld,
+                        batch_count,
+                        HandleQueue(handle));
+}
 
 // StridedBatched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/CGEMMSTRIDEDBATCHED/ZGEMMSTRIDEDBATCHED/HGEMMSTRIDEDBATCHED
 template <typename T>
@@ -668,6 +1665,481 @@ StatusCode GemmStridedBatched(const Layout layout, const Transpose a_transpose,
                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
                               const size_t batch_count,
                               cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode GemmStridedBatched(Handle* handle,
+                                     const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const T alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                     const T beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                     const size_t batch_count) {
+  return GemmStridedBatched<T>(layout, a_transpose, b_transpose,
+                               m, n, k,
+                               alpha,
+                               a_buffer, a_offset, a_ld, a_stride,
+                               b_buffer, b_offset, b_ld, b_stride,
+                               beta,
+                               c_buffer, c_offset, c_ld, c_stride,
+                               batch_count,
+                               HandleQueue(handle));
+}
+
+// Batched version of TRSM: STRSMBATCHED/DTRSMBATCHED/CTRSMBATCHED/ZTRSMBATCHED
+template <typename T>
+StatusCode TrsmBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode TrsmBatched(Handle* handle,
+                              const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t m, const size_t n,
+                              const T *alphas,
+                              const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                              cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                              const size_t batch_count) {
+  return TrsmBatched<T>(layout, side, triangle, a_transpose, diagonal,
+                        m, n,
+                        alphas,
+                        a_buffer, a_offsets, a_ld,
+                        b_buffer, b_offsets, b_ld,
+                        batch_count,
+                        HandleQueue(handle));
+}
+
+// StridedBatched version of TRSM: STRSMSTRIDEDBATCHED/DTRSMSTRIDEDBATCHED/CTRSMSTRIDEDBATCHED/ZTRSMSTRIDEDBATCHED
+template <typename T>
+StatusCode TrsmStridedBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode TrsmStridedBatched(Handle* handle,
+                                     const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                     const size_t m, const size_t n,
+                                     const T alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                     const size_t batch_count) {
+  return TrsmStridedBatched<T>(layout, side, triangle, a_transpose, diagonal,
+                               m, n,
+                               alpha,
+                               a_buffer, a_offset, a_ld, a_stride,
+                               b_buffer, b_offset, b_ld, b_stride,
+                               batch_count,
+                               HandleQueue(handle));
+}
+
+// StridedBatched version of SYMM: SSYMMSTRIDEDBATCHED/DSYMMSTRIDEDBATCHED/CSYMMSTRIDEDBATCHED/ZSYMMSTRIDEDBATCHED/HSYMMSTRIDEDBATCHED
+template <typename T>
+StatusCode SymmStridedBatched(const Layout layout, const Side side, const Triangle triangle,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const T beta,
+                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode SymmStridedBatched(Handle* handle,
+                                     const Layout layout, const Side side, const Triangle triangle,
+                                     const size_t m, const size_t n,
+                                     const T alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                     const T beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                     const size_t batch_count) {
+  return SymmStridedBatched<T>(layout, side, triangle,
+                               m, n,
+                               alpha,
+                               a_buffer, a_offset, a_ld, a_stride,
+                               b_buffer, b_offset, b_ld, b_stride,
+                               beta,
+                               c_buffer, c_offset, c_ld, c_stride,
+                               batch_count,
+                               HandleQueue(handle));
+}
+
+// StridedBatched version of SYRK: SSYRKSTRIDEDBATCHED/DSYRKSTRIDEDBATCHED/CSYRKSTRIDEDBATCHED/ZSYRKSTRIDEDBATCHED/HSYRKSTRIDEDBATCHED
+template <typename T>
+StatusCode SyrkStridedBatched(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                              const size_t n, const size_t k,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const T beta,
+                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode SyrkStridedBatched(Handle* handle,
+                                     const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                     const size_t n, const size_t k,
+                                     const T alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                     const T beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                     const size_t batch_count) {
+  return SyrkStridedBatched<T>(layout, triangle, a_transpose,
+                               n, k,
+                               alpha,
+                               a_buffer, a_offset, a_ld, a_stride,
+                               beta,
+                               c_buffer, c_offset, c_ld, c_stride,
+                               batch_count,
+                               HandleQueue(handle));
+}
+
+// StridedBatched version of TRMM: STRMMSTRIDEDBATCHED/DTRMMSTRIDEDBATCHED/CTRMMSTRIDEDBATCHED/ZTRMMSTRIDEDBATCHED/HTRMMSTRIDEDBATCHED
+template <typename T>
+StatusCode TrmmStridedBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode TrmmStridedBatched(Handle* handle,
+                                     const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                     const size_t m, const size_t n,
+                                     const T alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                     const size_t batch_count) {
+  return TrmmStridedBatched<T>(layout, side, triangle, a_transpose, diagonal,
+                               m, n,
+                               alpha,
+                               a_buffer, a_offset, a_ld, a_stride,
+                               b_buffer, b_offset, b_ld, b_stride,
+                               batch_count,
+                               HandleQueue(handle));
+}
+
+// Batched inversion of triangular matrices: SINVERTBATCHED/DINVERTBATCHED/CINVERTBATCHED/ZINVERTBATCHED
+template <typename T>
+StatusCode InvertBatched(const Layout layout, const Triangle triangle, const Diagonal diagonal,
+                         const size_t n,
+                         const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                         cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                         const size_t batch_count,
+                         cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode InvertBatched(Handle* handle,
+                                const Layout layout, const Triangle triangle, const Diagonal diagonal,
+                                const size_t n,
+                                const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                const size_t batch_count) {
+  return InvertBatched<T>(layout, triangle, diagonal,
+                          n,
+                          a_buffer, a_offsets, a_ld,
+                          b_buffer, b_offsets, b_ld,
+                          batch_count,
+                          HandleQueue(handle));
+}
+
+// StridedBatched version of POTRF: SPOTRFSTRIDEDBATCHED/DPOTRFSTRIDEDBATCHED
+template <typename T>
+StatusCode PotrfStridedBatched(const Layout layout, const Triangle triangle,
+                               const size_t n,
+                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                               const size_t batch_count,
+                               cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode PotrfStridedBatched(Handle* handle,
+                                      const Layout layout, const Triangle triangle,
+                                      const size_t n,
+                                      cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                      const size_t batch_count) {
+  return PotrfStridedBatched<T>(layout, triangle,
+                                n,
+                                a_buffer, a_offset, a_ld, a_stride,
+                                batch_count,
+                                HandleQueue(handle));
+}
+
+// StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+template <typename T>
+StatusCode GemvStridedBatched(const Layout layout, const Transpose a_transpose,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const T beta,
+                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode GemvStridedBatched(Handle* handle,
+                                     const Layout layout, const Transpose a_transpose,
+                                     const size_t m, const size_t n,
+                                     const T alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                     const T beta,
+                                     cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                     const size_t batch_count) {
+  return GemvStridedBatched<T>(layout, a_transpose,
+                               m, n,
+                               alpha,
+                               a_buffer, a_offset, a_ld, a_stride,
+                               x_buffer, x_offset, x_inc, x_stride,
+                               beta,
+                               y_buffer, y_offset, y_inc, y_stride,
+                               batch_count,
+                               HandleQueue(handle));
+}
+
+// StridedBatched version of TRSV: STRSVSTRIDEDBATCHED/DTRSVSTRIDEDBATCHED/CTRSVSTRIDEDBATCHED/ZTRSVSTRIDEDBATCHED
+template <typename T>
+StatusCode TrsvStridedBatched(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t n,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode TrsvStridedBatched(Handle* handle,
+                                     const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                     const size_t n,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                     cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                     const size_t batch_count) {
+  return TrsvStridedBatched<T>(layout, triangle, a_transpose, diagonal,
+                               n,
+                               a_buffer, a_offset, a_ld, a_stride,
+                               x_buffer, x_offset, x_inc, x_stride,
+                               batch_count,
+                               HandleQueue(handle));
+}
+
+// StridedBatched version of OMATCOPY: SOMATCOPYSTRIDEDBATCHED/DOMATCOPYSTRIDEDBATCHED/COMATCOPYSTRIDEDBATCHED/ZOMATCOPYSTRIDEDBATCHED/HOMATCOPYSTRIDEDBATCHED
+template <typename T>
+StatusCode OmatcopyStridedBatched(const Layout layout, const Transpose a_transpose,
+                                  const size_t m, const size_t n,
+                                  const T alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                  cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                  const size_t batch_count,
+                                  cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode OmatcopyStridedBatched(Handle* handle,
+                                         const Layout layout, const Transpose a_transpose,
+                                         const size_t m, const size_t n,
+                                         const T alpha,
+                                         const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                         cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                         const size_t batch_count) {
+  return OmatcopyStridedBatched<T>(layout, a_transpose,
+                                   m, n,
+                                   alpha,
+                                   a_buffer, a_offset, a_ld, a_stride,
+                                   b_buffer, b_offset, b_ld, b_stride,
+                                   batch_count,
+                                   HandleQueue(handle));
+}
+
+// StridedBatched version of IM2COL: SIM2COLSTRIDEDBATCHED/DIM2COLSTRIDEDBATCHED/CIM2COLSTRIDEDBATCHED/ZIM2COLSTRIDEDBATCHED/HIM2COLSTRIDEDBATCHED
+template <typename T>
+StatusCode Im2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                const size_t batch_count,
+                                cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Im2colStridedBatched(Handle* handle,
+                                       const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                       const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                       cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                       const size_t batch_count) {
+  return Im2colStridedBatched<T>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                 im_buffer, im_offset, im_stride,
+                                 col_buffer, col_offset, col_stride,
+                                 batch_count,
+                                 HandleQueue(handle));
+}
+
+// StridedBatched version of COL2IM: SCOL2IMSTRIDEDBATCHED/DCOL2IMSTRIDEDBATCHED/CCOL2IMSTRIDEDBATCHED/ZCOL2IMSTRIDEDBATCHED/HCOL2IMSTRIDEDBATCHED
+template <typename T>
+StatusCode Col2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                const cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                const size_t batch_count,
+                                cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Col2imStridedBatched(Handle* handle,
+                                       const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                       const cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                       cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                       const size_t batch_count) {
+  return Col2imStridedBatched<T>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                 col_buffer, col_offset, col_stride,
+                                 im_buffer, im_offset, im_stride,
+                                 batch_count,
+                                 HandleQueue(handle));
+}
+
+// StridedBatched version of AXPY: SAXPYSTRIDEDBATCHED/DAXPYSTRIDEDBATCHED/CAXPYSTRIDEDBATCHED/ZAXPYSTRIDEDBATCHED/HAXPYSTRIDEDBATCHED
+template <typename T>
+StatusCode AxpyStridedBatched(const size_t n,
+                              const T alpha,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode AxpyStridedBatched(Handle* handle,
+                                     const size_t n,
+                                     const T alpha,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                     cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                     const size_t batch_count) {
+  return AxpyStridedBatched<T>(n,
+                               alpha,
+                               x_buffer, x_offset, x_inc, x_stride,
+                               y_buffer, y_offset, y_inc, y_stride,
+                               batch_count,
+                               HandleQueue(handle));
+}
+
+// StridedBatched version of AXPBY: SAXPBYSTRIDEDBATCHED/DAXPBYSTRIDEDBATCHED/CAXPBYSTRIDEDBATCHED/ZAXPBYSTRIDEDBATCHED/HAXPBYSTRIDEDBATCHED
+template <typename T>
+StatusCode AxpbyStridedBatched(const size_t n,
+                               const T alpha,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                               const T beta,
+                               cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                               const size_t batch_count,
+                               cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode AxpbyStridedBatched(Handle* handle,
+                                      const size_t n,
+                                      const T alpha,
+                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                      const T beta,
+                                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                      const size_t batch_count) {
+  return AxpbyStridedBatched<T>(n,
+                                alpha,
+                                x_buffer, x_offset, x_inc, x_stride,
+                                beta,
+                                y_buffer, y_offset, y_inc, y_stride,
+                                batch_count,
+                                HandleQueue(handle));
+}
+
+// StridedBatched version of SET: SSETSTRIDEDBATCHED/DSETSTRIDEDBATCHED/CSETSTRIDEDBATCHED/ZSETSTRIDEDBATCHED/HSETSTRIDEDBATCHED
+template <typename T>
+StatusCode SetStridedBatched(const size_t n,
+                             const T alpha,
+                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                             const size_t batch_count,
+                             cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode SetStridedBatched(Handle* handle,
+                                    const size_t n,
+                                    const T alpha,
+                                    cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                    const size_t batch_count) {
+  return SetStridedBatched<T>(n,
+                              alpha,
+                              x_buffer, x_offset, x_inc, x_stride,
+                              batch_count,
+                              HandleQueue(handle));
+}
+
+// StridedBatched version of SCAL: SSCALSTRIDEDBATCHED/DSCALSTRIDEDBATCHED/CSCALSTRIDEDBATCHED/ZSCALSTRIDEDBATCHED/HSCALSTRIDEDBATCHED
+template <typename T>
+StatusCode ScalStridedBatched(const size_t n,
+                              const T alpha,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode ScalStridedBatched(Handle* handle,
+                                     const size_t n,
+                                     const T alpha,
+                                     cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                     const size_t batch_count) {
+  return ScalStridedBatched<T>(n,
+                               alpha,
+                               x_buffer, x_offset, x_inc, x_stride,
+                               batch_count,
+                               HandleQueue(handle));
+}
+
+// StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+template <typename T>
+StatusCode DotStridedBatched(const size_t n,
+                             cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                             const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                             const size_t batch_count,
+                             cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode DotStridedBatched(Handle* handle,
+                                    const size_t n,
+                                    cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                                    const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                    const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                    const size_t batch_count) {
+  return DotStridedBatched<T>(n,
+                              dot_buffer, dot_offset, dot_stride,
+                              x_buffer, x_offset, x_inc, x_stride,
+                              y_buffer, y_offset, y_inc, y_stride,
+                              batch_count,
+                              HandleQueue(handle));
+}
+
+// StridedBatched version of NRM2: SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+template <typename T>
+StatusCode Nrm2StridedBatched(const size_t n,
+                              cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode Nrm2StridedBatched(Handle* handle,
+                                     const size_t n,
+                                     cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                     const size_t batch_count) {
+  return Nrm2StridedBatched<T>(n,
+                               nrm2_buffer, nrm2_offset, nrm2_stride,
+                               x_buffer, x_offset, x_inc, x_stride,
+                               batch_count,
+                               HandleQueue(handle));
+}
+
+// StridedBatched version of ASUM: SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+template <typename T>
+StatusCode AsumStridedBatched(const size_t n,
+                              cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+inline StatusCode AsumStridedBatched(Handle* handle,
+                                     const size_t n,
+                                     cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                     const size_t batch_count) {
+  return AsumStridedBatched<T>(n,
+                               asum_buffer, asum_offset, asum_stride,
+                               x_buffer, x_offset, x_inc, x_stride,
+                               batch_count,
+                               HandleQueue(handle));
+}
 
 // =================================================================================================
 
@@ -680,16 +2152,1064 @@ StatusCode GemmTempBufferSize(const Layout layout, const Transpose a_transpose,
                               const size_t c_offset, const size_t c_ld,
                               cl_command_queue* queue, size_t& temp_buffer_size);
 
+// Where the parameters of a kernel were found: set through 'OverrideParameters', a database file
+// (see 'LoadDatabase'), the built-in database for this device or the most similar device, the
+// default for the architecture or the vendor, the CPU fallback, or the generic default
+enum class ParameterSource { kOverride = 0, kDatabaseFile = 1, kDevice = 2, kSimilarDevice = 3,
+                             kArchitecture = 4, kVendor = 5, kCPUFallback = 6, kDefault = 7 };
+struct KernelParameters {
+  std::string kernel_name; // e.g. "Xgemm" or "GemmRoutine"
+  ParameterSource source;
+  std::unordered_map<std::string, size_t> parameters;
+};
+struct KernelLaunch {
+  std::string kernel_name; // e.g. "Xgemm" or "CopyMatrixFast"
+  size_t num_dimensions;
+  size_t global[3]; // unused dimensions are set to 1
+  size_t local[3]; // all zero in case the local size is chosen by the OpenCL driver
+};
+struct GemmExplanation {
+  std::string path; // "direct", "indirect", "skinny", "split-k", "3m", "strassen" or "image"
+  size_t gemmk; // the GEMMK kernel variant of the indirect kernel, zero otherwise
+  std::vector<KernelParameters> parameters; // for the problem size of the call
+  std::vector<size_t> temp_buffer_sizes; // in bytes, excluding re-used user buffers
+  std::vector<KernelLaunch> launches; // pre- and post-processing kernels included, in order
+};
+
+// Explains a GEMM call with the given arguments without executing it: which version of GEMM would
+// be run with which parameters, which temporary buffers would be allocated, and which kernels would
+// be launched. The kernels are compiled (or taken from the cache) as in a regular call.
+template <typename T>
+StatusCode ExplainGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t m, const size_t n, const size_t k,
+                       const size_t a_offset, const size_t a_ld,
+                       const size_t b_offset, const size_t b_ld,
+                       const size_t c_offset, const size_t c_ld,
+                       cl_command_queue* queue, GemmExplanation &explanation);
+
+// =================================================================================================
+
+// Opaque handle to a pre-planned GEMM, see 'GemmPlanCreate' below
+template <typename T> class GemmPlan;
+
+// Creates a plan for repeated GEMM calls with a fixed layout, transposes, sizes, offsets and leading
+// dimensions on the device of the given queue. All set-up work (e.g. the kernel selection and the
+// temporary buffer allocation) is done once here, such that executing the plan has lower overhead
+// than calling 'Gemm'. A plan should not be executed concurrently from multiple host threads.
+template <typename T>
+StatusCode GemmPlanCreate(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                          const size_t m, const size_t n, const size_t k,
+                          const size_t a_offset, const size_t a_ld,
+                          const size_t b_offset, const size_t b_ld,
+                          const size_t c_offset, const size_t c_ld,
+                          cl_command_queue* queue, GemmPlan<T>** plan);
+
+// Executes a GEMM plan: C = alpha * A * B + beta * C. The queue has to be of the same context and
+// device as the queue the plan was created with.
+template <typename T>
+StatusCode GemmPlanExecute(GemmPlan<T>* plan, const T alpha,
+                           const cl_mem a_buffer, const cl_mem b_buffer,
+                           const T beta, cl_mem c_buffer,
+                           cl_command_queue* queue, cl_event* event = nullptr,
+                           cl_mem temp_buffer = nullptr);
+
+// Releases a GEMM plan and its resources
+template <typename T>
+StatusCode GemmPlanDestroy(GemmPlan<T>* plan);
+
+// =================================================================================================
+
+// Opaque handle to a prepared triangular matrix of TRSM, see 'TrsmFactorCreate' below
+template <typename T> class TrsmFactor;
+
+// Prepares the 'k' by 'k' triangular matrix A for repeated TRSM calls with the same A and new
+// right-hand sides: the diagonal blocks of A are inverted once here, such that solving with the
+// factor only performs the GEMM-based updates of B. The factor refers to matrix A, which should not
+// be modified or released before the factor is destroyed. A factor should not be used concurrently
+// from multiple host threads.
+template <typename T>
+StatusCode TrsmFactorCreate(const Layout layout, const Side side, const Triangle triangle,
+                            const Transpose a_transpose, const Diagonal diagonal,
+                            const size_t k,
+                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                            cl_command_queue* queue, TrsmFactor<T>** factor);
+
+// Solves a TRSM with a factor: as 'Trsm' with the arguments the factor was created with, in which
+// 'm' (left side) or 'n' (right side) has to equal 'k'. The queue has to be of the same context and
+// device as the queue the factor was created with.
+template <typename T>
+StatusCode TrsmFactorSolve(TrsmFactor<T>* factor, const size_t m, const size_t n, const T alpha,
+                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                           cl_command_queue* queue, cl_event* event = nullptr);
+
+// Releases a TRSM factor and its resources
+template <typename T>
+StatusCode TrsmFactorDestroy(TrsmFactor<T>* factor);
+
+// =================================================================================================
+
+// Grouped version of GEMM: a batch of GEMMs in which each entry has its own sizes, offsets, and
+// leading dimensions. All entries are computed by a single kernel launch.
+template <typename T>
+StatusCode GemmGrouped(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t *ms, const size_t *ns, const size_t *ks,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                       const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                       const T *betas,
+                       cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// Grouped version of AXPY: a batch of AXPYs in which each entry has its own size 'ns[i]' next to its
+// own scalar and offsets. All entries are computed by a single kernel launch.
+template <typename T>
+StatusCode AxpyGrouped(const size_t *ns,
+                       const T *alphas,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// As 'GemmBatched', but with the scalars and the offsets already resident on the device: 'alphas'
+// and 'betas' hold 'batch_count' values each (32-bit floats for half precision) and the offsets
+// buffers 'batch_count' integers (cl_int). This avoids all host-device transfers, such that repeated
+// calls have low overhead. This always uses the direct GEMM kernel.
+template <typename T>
+StatusCode GemmBatchedDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k,
+                             const cl_mem alphas,
+                             const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                             const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                             const cl_mem betas,
+                             cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                             const size_t batch_count,
+                             cl_command_queue* queue, cl_event* event = nullptr);
+
+// As above, but with a single alpha and beta for all batches
+template <typename T>
+StatusCode GemmBatchedDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k,
+                             const T alpha,
+                             const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                             const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                             const T beta,
+                             cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                             const size_t batch_count,
+                             cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Versions of AXPY, SCAL, GEMV, and GEMM of which the scalars are read by the kernel from device
+// buffers at the given offsets, instead of being passed by value from the host. The scalars are of
+// the same type as the data, such that e.g. the result of 'Dot' can be used directly. This avoids
+// reading back a device-computed scalar before the next call. For batched GEMM see above.
+template <typename T>
+StatusCode AxpyDevice(const size_t n,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+StatusCode ScalDevice(const size_t n,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+StatusCode GemvDevice(const Layout layout, const Transpose a_transpose,
+                      const size_t m, const size_t n,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      const cl_mem beta_buffer, const size_t beta_offset,
+                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+StatusCode GemmDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                      const cl_mem beta_buffer, const size_t beta_offset,
+                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+// Fused pair of GEMVs with the same matrix: computes y = alpha*A*x + beta*y and z = alpha*A^T*w +
+// beta*z, in which A is an m by n matrix, while reading matrix A from memory only once
+template <typename T>
+StatusCode GemvPair(const Layout layout,
+                    const size_t m, const size_t n,
+                    const T alpha,
+                    const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                    const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                    const cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                    const T beta,
+                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                    cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                    cl_command_queue* queue, cl_event* event = nullptr);
+
+// In-place version of 'Omatcopy': computes A = alpha*op(A), in which A is an m by n matrix with
+// leading dimension 'a_ld' before and leading dimension 'b_ld' after the operation. A square
+// transpose with an unchanged leading dimension needs no extra device memory.
+template <typename T>
+StatusCode Imatcopy(const Layout layout, const Transpose a_transpose,
+                    const size_t m, const size_t n,
+                    const T alpha,
+                    cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t b_ld,
+                    cl_command_queue* queue, cl_event* event = nullptr);
+
+// The operations of an elementwise expression, applied in order to a value which starts as the
+// element of x. The binary operations take the element of y as their second operand, the clamp
+// operation limits the value to [low, high].
+enum class ElementwiseOp { kMultiply = 0, kDivide = 1, kAdd = 2, kSubtract = 3, kMax = 4, kMin = 5,
+                           kExp = 6, kLog = 7, kAbs = 8, kClamp = 9 };
+
+// Generalised version of 'Had': computes z = alpha*f(x,y) + beta*z, in which f is the elementwise
+// expression given by the list of (at most 16) operations. A kernel is compiled once for each
+// expression and is cached. Vector y is not accessed if there are no binary operations. Only the
+// multiply, add and subtract operations are supported for complex data-types.
+template <typename T>
+StatusCode Elementwise(const std::vector<ElementwiseOp> &operations, const size_t n,
+                       const T alpha,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       const T beta,
+                       cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                       const T low, const T high,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// The reductions of the row-wise and column-wise matrix reductions: the sum, the sum of absolute
+// values, the maximum, the maximum absolute value, and the L2 norm. Absolute values of complex
+// numbers are the sums of the absolute values of their parts, as for 'Asum' and 'Amax'.
+enum class ReduceOp { kSum = 0, kAbsSum = 1, kMax = 2, kAbsMax = 3, kNrm2 = 4 };
+
+// Matrix reductions: computes the reduction of each of the m rows (into m values of y) or of each
+// of the n columns (into n values of y) of the m by n matrix A with a single routine call. The
+// maximum is not supported for complex data-types.
+template <typename T>
+StatusCode ReduceRows(const ReduceOp operation, const Layout layout,
+                      const size_t m, const size_t n,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+StatusCode ReduceCols(const ReduceOp operation, const Layout layout,
+                      const size_t m, const size_t n,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+// Strided-batched versions of the above
+template <typename T>
+StatusCode ReduceRowsStridedBatched(const ReduceOp operation, const Layout layout,
+                                    const size_t m, const size_t n,
+                                    const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                    const size_t batch_count,
+                                    cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+StatusCode ReduceColsStridedBatched(const ReduceOp operation, const Layout layout,
+                                    const size_t m, const size_t n,
+                                    const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                    const size_t batch_count,
+                                    cl_command_queue* queue, cl_event* event = nullptr);
+
+// Im2col for a strided batch of images in channels-last (HWC) layout: the col matrix of each image
+// holds a row per patch of kernel_h * kernel_w * channels values, with the channels as the
+// fastest-changing dimension. All images of the batch are processed by a single kernel launch.
+template <typename T>
+StatusCode Im2colChannelsLast(const size_t channels, const size_t height, const size_t width,
+                              const size_t kernel_h, const size_t kernel_w,
+                              const size_t pad_h, const size_t pad_w,
+                              const size_t stride_h, const size_t stride_w,
+                              const size_t dilation_h, const size_t dilation_w,
+                              const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                              cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched LU factorisation with partial pivoting of small square matrices: computes A = P * L * U
+// in place for each of the n by n matrices A, with n at most 64. The row interchanges are stored as
+// 0-based indices in the unsigned integer buffer 'ipiv': row j was interchanged with row ipiv[j].
+// There is no check for singular matrices. Each matrix is factorised by a single work-group.
+template <typename T>
+StatusCode GetrfStridedBatched(const Layout layout, const size_t n,
+                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                               cl_mem ipiv_buffer, const size_t ipiv_offset, const size_t ipiv_stride,
+                               const size_t batch_count,
+                               cl_command_queue* queue, cl_event* event = nullptr);
+
+// Solves A * X = B for each of the batches using the factorisation computed by
+// 'GetrfStridedBatched', in which B holds nrhs right-hand sides and is overwritten by X
+template <typename T>
+StatusCode GetrsStridedBatched(const Layout layout, const size_t n, const size_t nrhs,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                               const cl_mem ipiv_buffer, const size_t ipiv_offset, const size_t ipiv_stride,
+                               cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                               const size_t batch_count,
+                               cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Out-of-place version of 'Gemm': computes D = alpha * A * B + beta * C, in which D is a separate
+// m by n matrix in the same layout as C, with its own offset and leading dimension. Matrix C is only
+// read, such that it doesn't have to be copied first if it is needed afterwards (e.g. for residual
+// connections). Matrices C and D should not overlap, unless they are the same matrix.
+template <typename T>
+StatusCode GemmOutOfPlace(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                          const size_t m, const size_t n, const size_t k,
+                          const T alpha,
+                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                          const T beta,
+                          const cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                          cl_mem d_buffer, const size_t d_offset, const size_t d_ld,
+                          cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Accumulation of k general rank-1 updates of the same matrix: A = alpha * sum_i (x_i * y_i^T) + A,
+// in which the i-th pairs of vectors start at x_offset + i*x_stride and y_offset + i*y_stride. If the
+// vectors form two matrices (an increment or a stride of 1), the updates are applied as a single
+// rank-k GEMM update, such that A is read and written once instead of k times. Otherwise, this falls
+// back to k calls to 'Ger'.
+template <typename T>
+StatusCode Gerk(const Layout layout,
+                const size_t m, const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Conversions of the 'triangle' of an n by n matrix between packed storage (as used by e.g. 'Spmv'
+// and 'Tpmv') and full storage, as LAPACK's TPTTR and TRTTP. 'Tpttr' leaves the other triangle of
+// the full matrix A untouched.
+template <typename T>
+StatusCode Tpttr(const Layout layout, const Triangle triangle,
+                 const size_t n,
+                 const cl_mem ap_buffer, const size_t ap_offset,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+StatusCode Trttp(const Layout layout, const Triangle triangle,
+                 const size_t n,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_mem ap_buffer, const size_t ap_offset,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// As 'Syrk', but with the symmetric matrix C in packed storage, and as 'Trsm', but with the
+// triangular matrix A in packed storage. Both run the regular routine on a temporary full copy of
+// the matrix: this halves the memory to keep the matrix in, at the cost of one conversion per call.
+template <typename T>
+StatusCode SyrkPacked(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                      const size_t n, const size_t k,
+                      const T alpha,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                      const T beta,
+                      cl_mem cp_buffer, const size_t cp_offset,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+StatusCode TrsmPacked(const Layout layout, const Side side, const Triangle triangle,
+                      const Transpose a_transpose, const Diagonal diagonal,
+                      const size_t m, const size_t n,
+                      const T alpha,
+                      const cl_mem ap_buffer, const size_t ap_offset,
+                      cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// The optional bias addition of a GEMM epilogue: one value per row of C (M values) or one value per
+// column of C (N values). The activation is applied after the bias addition.
+enum class EpilogueBias { kNone = 0, kPerRow = 1, kPerColumn = 2 };
+enum class EpilogueActivation { kNone = 0, kReLU = 1, kGELU = 2, kSigmoid = 3, kClamp = 4 };
+
+// As 'Gemm', but with a fused epilogue applied to each result before it is stored: a bias addition
+// followed by an activation function. The GELU activation uses the tanh approximation and the clamp
+// activation limits the results to [low, high]. Activation functions are not supported for complex
+// data-types. This avoids additional passes over matrix C in device memory.
+template <typename T>
+StatusCode GemmWithEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                            const size_t m, const size_t n, const size_t k,
+                            const T alpha,
+                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                            const T beta,
+                            cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                            const EpilogueBias bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                            const EpilogueActivation activation, const T low, const T high,
+                            cl_command_queue* queue, cl_event* event = nullptr);
+
+// As above, but for the strided-batched version of GEMM: the same bias is used for all batches
+template <typename T>
+StatusCode GemmStridedBatchedWithEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const T alpha,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                          const T beta,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                          const size_t batch_count,
+                                          const EpilogueBias bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                                          const EpilogueActivation activation, const T low, const T high,
+                                          cl_command_queue* queue, cl_event* event = nullptr);
+
+// Back-to-back GEMMs of an MLP block: D = act(alpha*A*B + bias)*E + beta*D, in which A is M by K,
+// B is K by N, E is N by P and D is M by P. The bias and the activation are as for
+// 'GemmWithEpilogue', with the bias per row (M values) or per column (N values) of the intermediate
+// result. For an N of at most 256 (single precision, less for larger data-types) the intermediate
+// result is kept on-chip by a single fused kernel, otherwise it goes through a temporary buffer.
+template <typename T>
+StatusCode GemmMlp(const Layout layout,
+                   const size_t m, const size_t n, const size_t k, const size_t p,
+                   const T alpha,
+                   const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                   const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                   const EpilogueBias bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                   const EpilogueActivation activation, const T low, const T high,
+                   const cl_mem e_buffer, const size_t e_offset, const size_t e_ld,
+                   const T beta,
+                   cl_mem d_buffer, const size_t d_offset, const size_t d_ld,
+                   cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched scaled dot-product attention: O = softmax(scale*Q*K^T)*V for each batch, in which Q and O
+// are seq_q by head_dim and K and V are seq_k by head_dim matrices. With the causal mask, query i
+// only attends to the keys up to i + seq_k - seq_q. For a head_dim of at most 128 (64 in double
+// precision) a single fused kernel computes the result without storing the scores in device memory.
+// Only available for real data-types.
+template <typename T>
+StatusCode AttentionStridedBatched(const Layout layout,
+                                   const size_t seq_q, const size_t seq_k, const size_t head_dim,
+                                   const T scale, const bool causal,
+                                   const cl_mem q_buffer, const size_t q_offset, const size_t q_ld, const size_t q_stride,
+                                   const cl_mem k_buffer, const size_t k_offset, const size_t k_ld, const size_t k_stride,
+                                   const cl_mem v_buffer, const size_t v_offset, const size_t v_ld, const size_t v_stride,
+                                   cl_mem o_buffer, const size_t o_offset, const size_t o_ld, const size_t o_stride,
+                                   const size_t batch_count,
+                                   cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// The operands of GEMM which can be packed, see 'GemmPackOperand' below
+enum class GemmOperand { kA = 0, kB = 1 };
+
+// Retrieves the size (in bytes) of the buffer required to hold a packed operand A (of size 'm' by
+// 'k') or B (of size 'k' by 'n') of a GEMM on the device of the given queue
+template <typename T>
+StatusCode GemmPackedOperandSize(const GemmOperand operand, const size_t m, const size_t n, const size_t k,
+                                 cl_command_queue* queue, size_t& packed_size);
+
+// Packs operand A or B of a GEMM once into the internal layout of the GEMM kernel: padded to the
+// tile sizes, and transposed and conjugated as needed. This serves operands which are used for
+// many GEMMs, e.g. constant weight matrices. A packed operand is only valid for the device,
+// precision, and tuning parameters it was packed with.
+template <typename T>
+StatusCode GemmPackOperand(const Layout layout, const GemmOperand operand, const Transpose transpose,
+                           const size_t m, const size_t n, const size_t k,
+                           const cl_mem buffer, const size_t offset, const size_t ld,
+                           cl_mem packed_buffer,
+                           cl_command_queue* queue, cl_event* event = nullptr);
+
+// As 'Gemm', but with operand A and/or B packed by 'GemmPackOperand' (as indicated by 'a_packed'
+// and 'b_packed'), such that their pre-processing is skipped. For a packed operand the transpose,
+// offset, and leading dimension are not used. This always uses the indirect GEMM kernel.
+template <typename T>
+StatusCode GemmWithPackedOperands(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const T alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const bool a_packed,
+                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const bool b_packed,
+                                  const T beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_command_queue* queue, cl_event* event = nullptr);
+
+// Packs operand A or B of a GEMM into a newly created 2D image for the image version of GEMM,
+// which reads its operands through the texture caches of mobile GPUs (e.g. Qualcomm Adreno and ARM
+// Mali). The image only depends on the sizes and on the operand after applying the transpose. It
+// is owned by the caller, who has to release it with 'clReleaseMemObject'. Only available for
+// single and half precision on devices with image support.
+template <typename T>
+StatusCode GemmPackImage(const Layout layout, const GemmOperand operand, const Transpose transpose,
+                         const size_t m, const size_t n, const size_t k,
+                         const cl_mem buffer, const size_t offset, const size_t ld,
+                         cl_mem* image,
+                         cl_command_queue* queue, cl_event* event = nullptr);
+
+// As 'Gemm', but always with the image version of GEMM, and with operand A and/or B packed by
+// 'GemmPackImage' (as indicated by 'a_image' and 'b_image'), such that their packing is skipped.
+// For an image operand the transpose, offset, and leading dimension are not used.
+template <typename T>
+StatusCode GemmWithImageOperands(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                 const size_t m, const size_t n, const size_t k,
+                                 const T alpha,
+                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const bool a_image,
+                                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const bool b_image,
+                                 const T beta,
+                                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Sparse matrix-vector multiplication: y = alpha * A * x + beta * y, with A an 'm' by 'n' sparse
+// matrix with 'nnz' non-zeros in CSR (compressed sparse row) format. The 'row_ptr_buffer' holds
+// m+1 integers (cl_int), of which entry i is the start of row i in the 'col_idx_buffer' (nnz cl_int
+// values) and the 'values_buffer' (nnz values), starting at 0 and ending at nnz.
+template <typename T>
+StatusCode Csrmv(const size_t m, const size_t n, const size_t nnz,
+                 const T alpha,
+                 const cl_mem row_ptr_buffer, const cl_mem col_idx_buffer, const cl_mem values_buffer,
+                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta,
+                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// Sparse-dense matrix multiplication: C = alpha * A * B + beta * C, with A an 'm' by 'k' sparse
+// matrix in CSR format as for 'Csrmv', and B ('k' by 'n') and C ('m' by 'n') dense matrices
+template <typename T>
+StatusCode Csrmm(const Layout layout, const size_t m, const size_t n, const size_t k, const size_t nnz,
+                 const T alpha,
+                 const cl_mem row_ptr_buffer, const cl_mem col_idx_buffer, const cl_mem values_buffer,
+                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                 const T beta,
+                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Converts 'n' consecutive single-precision values into bfloat16 values, rounding to nearest-even,
+// or the other way around (exact). Together with the bfloat16 versions of 'Gemm' and 'Axpy' (for
+// the 'clblast_bfloat16' type of clblast_half.h, computing in single precision) this allows to keep
+// data on the device in bfloat16.
+StatusCode PUBLIC_API ConvertToBFloat16(const size_t n,
+                                        const cl_mem src_buffer, const size_t src_offset,
+                                        cl_mem dest_buffer, const size_t dest_offset,
+                                        cl_command_queue* queue, cl_event* event = nullptr);
+StatusCode PUBLIC_API ConvertFromBFloat16(const size_t n,
+                                          const cl_mem src_buffer, const size_t src_offset,
+                                          cl_mem dest_buffer, const size_t dest_offset,
+                                          cl_command_queue* queue, cl_event* event = nullptr);
+
+// As above, but converting between single-precision and half-precision (cl_half) values on the
+// device, rounding to nearest-even. This does not require half-precision support of the device.
+StatusCode PUBLIC_API ConvertToHalf(const size_t n,
+                                    const cl_mem src_buffer, const size_t src_offset,
+                                    cl_mem dest_buffer, const size_t dest_offset,
+                                    cl_command_queue* queue, cl_event* event = nullptr);
+StatusCode PUBLIC_API ConvertFromHalf(const size_t n,
+                                      const cl_mem src_buffer, const size_t src_offset,
+                                      cl_mem dest_buffer, const size_t dest_offset,
+                                      cl_command_queue* queue, cl_event* event = nullptr);
+
+// As 'Omatcopy', but with a single-precision matrix A and a half-precision (cl_half) matrix B or the
+// other way around: the conversion is fused with the scaling and the transposition, such that the
+// matrices are read and written only once. The scaling is performed in the precision of matrix A.
+// This does not require half-precision support of the device.
+StatusCode PUBLIC_API OmatcopyToHalf(const Layout layout, const Transpose a_transpose,
+                                     const size_t m, const size_t n,
+                                     const float alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     cl_command_queue* queue, cl_event* event = nullptr);
+StatusCode PUBLIC_API OmatcopyFromHalf(const Layout layout, const Transpose a_transpose,
+                                       const size_t m, const size_t n,
+                                       const cl_half alpha,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// Converts 'n' consecutive single-precision values in host memory into half-precision values,
+// rounding to nearest-even, or the other way around (exact). Contrary to the scalar FloatToHalf
+// of clblast_half.h (which truncates), these use the F16C, AVX-512 or NEON conversion instructions
+// when available on the host CPU, selected at run-time.
+void PUBLIC_API FloatToHalfArray(const float* src, cl_half* dest, const size_t n);
+void PUBLIC_API HalfToFloatArray(const cl_half* src, float* dest, const size_t n);
+
+// =================================================================================================
+
+// Integer matrix-multiplication for quantised data: C = alpha * A * B + beta * C, with A and B
+// holding 8-bit signed integers (cl_char) and C 32-bit signed integers (cl_int). The products are
+// accumulated in 32-bit integers, which saturate on overflow.
+StatusCode PUBLIC_API GemmInt8(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                               const size_t m, const size_t n, const size_t k,
+                               const int alpha,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                               const int beta,
+                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue, cl_event* event = nullptr);
+
+// As above, but requantises the results to 8-bit signed integers (cl_char) in C: each accumulated
+// result in column 'j' of C is multiplied by the per-channel single-precision value 'scales[j]'
+// (out of 'n' values), rounded to nearest-even and saturated.
+StatusCode PUBLIC_API GemmInt8Requantized(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          const cl_mem scales_buffer, const size_t scales_offset,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Matrix-vector and small matrix-matrix multiplication with quantised weights, e.g. for the token
+// generation of large language models. The m by k weights W are 8-bit or 4-bit signed integers,
+// stored row by row and packed in 32-bit words (cl_uint, the first value in the least-significant
+// bits), with a scale of type T per group of 'group_size' consecutive weights of a row (m rows of
+// 'k / group_size' scales). The group size has to be a multiple of the number of values per word
+// (4 or 8) and 'k' a multiple of the group size. Offsets of the packed weights are in words.
+enum class QuantizedFormat { kInt8 = 8, kInt4 = 4 };
+
+// Quantises the m by k row-major weights W (with leading dimension 'w_ld') into the above format:
+// the scale of a group is its largest absolute value divided by 127 (8-bit) or 7 (4-bit), and the
+// weights divided by their scale are rounded to nearest-even.
+template <typename T>
+StatusCode QuantizeWeights(const QuantizedFormat format,
+                           const size_t m, const size_t k, const size_t group_size,
+                           const cl_mem w_buffer, const size_t w_offset, const size_t w_ld,
+                           cl_mem q_buffer, const size_t q_offset,
+                           cl_mem scales_buffer, const size_t scales_offset,
+                           cl_command_queue* queue, cl_event* event = nullptr);
+
+// Computes y = alpha * W * x + beta * y with the quantised weights W, dequantised on the fly. Half
+// precision is accumulated in single precision.
+template <typename T>
+StatusCode GemvQuantized(const QuantizedFormat format,
+                         const size_t m, const size_t k, const size_t group_size,
+                         const T alpha,
+                         const cl_mem q_buffer, const size_t q_offset,
+                         const cl_mem scales_buffer, const size_t scales_offset,
+                         const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                         const T beta,
+                         cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                         cl_command_queue* queue, cl_event* event = nullptr);
+
+// As above, but for a small number 'n' of vectors: C = alpha * W * B + beta * C, with B a k by n
+// and C an m by n column-major matrix
+template <typename T>
+StatusCode GemmQuantized(const QuantizedFormat format,
+                         const size_t m, const size_t n, const size_t k, const size_t group_size,
+                         const T alpha,
+                         const cl_mem q_buffer, const size_t q_offset,
+                         const cl_mem scales_buffer, const size_t scales_offset,
+                         const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                         const T beta,
+                         cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                         cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Multi-device GEMM on matrices in host memory: C = alpha * A * B + beta * C. Matrix C is split
+// into panels which are computed in parallel by the devices of the given queues (one per device,
+// possibly in different contexts), each using its own tuned kernels. Matrix A is copied to all
+// devices, matrix B and C only as far as needed for each panel. The sizes of the panels are
+// proportional to the 'weights' of the devices (e.g. their measured GFLOPS), by default estimated
+// from their compute units and clock frequencies. This returns when C is updated in host memory.
+template <typename T>
+StatusCode GemmMultiDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                           const size_t m, const size_t n, const size_t k,
+                           const T alpha,
+                           const T* a, const size_t a_ld,
+                           const T* b, const size_t b_ld,
+                           const T beta,
+                           T* c, const size_t c_ld,
+                           const std::vector<cl_command_queue> &queues,
+                           const std::vector<double> &weights = std::vector<double>());
+
+// Multi-device strided-batched GEMM on matrices in host memory, as 'GemmStridedBatched'. The batch
+// entries are split over the devices of the given queues proportional to their 'weights' (as for
+// 'GemmMultiDevice'), each device computing its range of entries with a single strided-batched
+// GEMM on buffers holding only the matrices of these entries. A stride of zero shares a matrix over
+// all entries. This returns when C is updated in host memory.
+template <typename T>
+StatusCode GemmStridedBatchedMultiDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                         const size_t m, const size_t n, const size_t k,
+                                         const T alpha,
+                                         const T* a, const size_t a_ld, const size_t a_stride,
+                                         const T* b, const size_t b_ld, const size_t b_stride,
+                                         const T beta,
+                                         T* c, const size_t c_ld, const size_t c_stride,
+                                         const size_t batch_count,
+                                         const std::vector<cl_command_queue> &queues,
+                                         const std::vector<double> &weights = std::vector<double>());
+
+// Partitions a device (e.g. a multi-socket CPU) with 'clCreateSubDevices' by affinity domain,
+// preferably one sub-device per NUMA node, and creates an in-order queue on each. Every sub-device
+// gets its own context, such that the buffers of 'GemmMultiDevice' on these queues are allocated in
+// the sub-device's local memory. A device which can't be partitioned gives a single queue on the
+// device itself. The queues have to be released with 'clReleaseCommandQueue'.
+StatusCode PUBLIC_API CreateSubDeviceQueues(const cl_device_id device,
+                                            std::vector<cl_command_queue> &queues);
+
+// Streaming GEMM on matrices in host memory which do not have to fit in device memory: C = alpha *
+// A * B + beta * C. The problem is computed in tiles of at most 'tile_size' by 'tile_size' (zero
+// selects a size based on the device memory), uploading the next panels of A and B on a second queue
+// while computing on the given queue. This returns when C is updated in host memory.
+template <typename T>
+StatusCode GemmStreaming(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                         const size_t m, const size_t n, const size_t k,
+                         const T alpha,
+                         const T* a, const size_t a_ld,
+                         const T* b, const size_t b_ld,
+                         const T beta,
+                         T* c, const size_t c_ld,
+                         cl_command_queue* queue, const size_t tile_size = 0);
+
+// =================================================================================================
+
+// Variants of the main routines on shared virtual memory (SVM) pointers instead of buffers, e.g. as
+// allocated by 'clSVMAlloc'. Offsets are applied to the pointers themselves. The pointers are used
+// in-place and without copies (through buffers created with CL_MEM_USE_HOST_PTR, which for SVM
+// pointers use the SVM memory itself). For coarse-grained SVM the usual map/unmap rules apply.
+template <typename T>
+StatusCode GemmSVM(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                   const size_t m, const size_t n, const size_t k,
+                   const T alpha,
+                   const T* a, const size_t a_ld,
+                   const T* b, const size_t b_ld,
+                   const T beta,
+                   T* c, const size_t c_ld,
+                   cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+StatusCode GemmStridedBatchedSVM(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                 const size_t m, const size_t n, const size_t k,
+                                 const T alpha,
+                                 const T* a, const size_t a_ld, const size_t a_stride,
+                                 const T* b, const size_t b_ld, const size_t b_stride,
+                                 const T beta,
+                                 T* c, const size_t c_ld, const size_t c_stride,
+                                 const size_t batch_count,
+                                 cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+StatusCode AxpySVM(const size_t n,
+                   const T alpha,
+                   const T* x, const size_t x_inc,
+                   T* y, const size_t y_inc,
+                   cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+StatusCode DotSVM(const size_t n,
+                  T* dot,
+                  const T* x, const size_t x_inc,
+                  const T* y, const size_t y_inc,
+                  cl_command_queue* queue, cl_event* event = nullptr);
+template <typename T>
+StatusCode GemvSVM(const Layout layout, const Transpose a_transpose,
+                   const size_t m, const size_t n,
+                   const T alpha,
+                   const T* a, const size_t a_ld,
+                   const T* x, const size_t x_inc,
+                   const T beta,
+                   T* y, const size_t y_inc,
+                   cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Opaque handle to a recorded sequence of routine calls, see 'GraphBeginCapture' below
+class CommandGraph;
+
+// Starts capturing the routines called on the given queue into a command graph: all host-side work
+// is done as usual, but instead of being executed, their kernels are recorded together with their
+// arguments (including the scalars). Returned events are already completed. Routines which operate
+// on host data or read results back to the host cannot be captured.
+StatusCode PUBLIC_API GraphBeginCapture(cl_command_queue* queue);
+
+// Ends the capture on the queue and returns the resulting command graph
+StatusCode PUBLIC_API GraphEndCapture(cl_command_queue* queue, CommandGraph** graph);
+
+// Replays a command graph on a queue of the same context and device as the capture queue. On the
+// capture queue itself, this is a single submission if 'cl_khr_command_buffer' is supported. The
+// buffers used during the capture have to be kept alive for as long as the graph is replayed.
+StatusCode PUBLIC_API GraphLaunch(CommandGraph* graph, cl_command_queue* queue,
+                                  cl_event* event = nullptr);
+
+// Releases a command graph and its resources
+StatusCode PUBLIC_API GraphDestroy(CommandGraph* graph);
+
+// =================================================================================================
+
+// Sets the events which the next routine called on the given queue from this host thread waits for.
+// On an out-of-order queue (CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE), these are the only dependencies
+// of the routine, otherwise it waits for all previously enqueued commands. Within a routine on such
+// a queue, independent kernels (e.g. the pre-processing of A and B in GEMM) can run concurrently.
+StatusCode PUBLIC_API SetEventWaitList(cl_command_queue* queue, const size_t num_events,
+                                       const cl_event* events);
+
+// Starts a region of independent routine calls on the given queue from this host thread: each call
+// runs on the next of 'num_queues' in-order queues of the same context and device, owned by CLBlast,
+// such that e.g. many small GEMMs execute concurrently on the device. The calls in the region must
+// not depend on each other, but they do wait for the commands enqueued to the queue before. Returned
+// events belong to the internal queues. The pool queues are kept until 'ClearContextCache'.
+StatusCode PUBLIC_API BeginConcurrentRegion(cl_command_queue* queue, const size_t num_queues = 4);
+
+// Ends the region on the queue: later commands on the queue wait for all calls made in the region,
+// the optional event completes once these are done
+StatusCode PUBLIC_API EndConcurrentRegion(cl_command_queue* queue, cl_event* event = nullptr);
+
+// Attaches a workspace of 'bytes' bytes to a queue: the temporary buffers of all routines called on
+// this in-order queue are then carved out of 'buffer' instead of being allocated. With a 'buffer'
+// of nullptr, only the workspace size is recorded. See also the functions below.
+StatusCode PUBLIC_API SetWorkspace(cl_command_queue* queue, const cl_mem buffer, const size_t bytes);
+
+// Detaches the workspace from a queue, after which temporary buffers come from the pool again
+StatusCode PUBLIC_API RemoveWorkspace(cl_command_queue* queue);
+
+// Retrieves the workspace size (in bytes) required by the routines called on the queue since the
+// workspace was attached: the peak of the temporary buffers of a single routine call
+StatusCode PUBLIC_API GetWorkspaceSize(cl_command_queue* queue, size_t &bytes);
+
+// =================================================================================================
+
+// Statistics of a handle: the number of routine calls made through it, and the number of lookups
+// of a compiled program found in (hits) or missing from (misses) the handle's own program cache
+struct HandleStatistics {
+  size_t num_calls;
+  size_t program_cache_hits;
+  size_t program_cache_misses;
+};
+
+// Creates a handle bundling the queue with a workspace (see 'HandleSetWorkspace') and a program
+// cache of its own. The routine overloads taking a handle run on its queue. A handle is meant to
+// be used from one host thread at a time and has to be destroyed with 'HandleDestroy'.
+StatusCode PUBLIC_API HandleCreate(cl_command_queue* queue, Handle** handle);
+
+// Destroys a handle, detaching its workspace (if any) and releasing its queue
+StatusCode PUBLIC_API HandleDestroy(Handle* handle);
+
+// Attaches a workspace to the queue of a handle, as 'SetWorkspace'
+StatusCode PUBLIC_API HandleSetWorkspace(Handle* handle, const cl_mem buffer, const size_t bytes);
+
+// Retrieves the statistics of a handle
+StatusCode PUBLIC_API HandleGetStatistics(Handle* handle, HandleStatistics &statistics);
+
+// =================================================================================================
+
+// The floating-point mode of the kernels. The fast mode compiles them with '-cl-fast-relaxed-math',
+// '-cl-mad-enable', and '-cl-denorms-are-zero', trading accuracy for speed: results differ in the
+// last bits, denormals are flushed to zero, and infinities and NaNs are not handled correctly. The
+// precise mode never does so. The default mode does so only for kernels of which the tuned
+// parameters select it ('FAST_MATH', see 'doc/tuning.md').
+enum class MathMode { kDefault = 0, kPrecise = 1, kFast = 2 };
+
+// Sets the math mode of all routines not called through a handle with a mode of its own. The
+// default is taken from the 'CLBLAST_MATH_MODE' environmental variable ('fast' or 'precise').
+StatusCode PUBLIC_API SetMathMode(const MathMode mode);
+
+// Sets the math mode of the routines called through a handle, 'MathMode::kDefault' follows the
+// global mode. The mode is part of the keys of the compiled programs in all caches.
+StatusCode PUBLIC_API HandleSetMathMode(Handle* handle, const MathMode mode);
+
+// =================================================================================================
+
+// Scheduling hints of a queue, see 'CreatePriorityQueue' below
+enum class QueuePriority { kDefault = 0, kLow = 1, kMedium = 2, kHigh = 3 };
+enum class QueueThrottle { kDefault = 0, kLow = 1, kMedium = 2, kHigh = 3 };
+
+// Creates an in-order queue (with profiling enabled) with a priority hint ('cl_khr_priority_hints')
+// and a throttle hint ('cl_khr_throttle_hints'), e.g. a high priority queue for latency-critical
+// routines next to a low priority one for background work. A hint is ignored if the device doesn't
+// support its extension. The queue is passed to the routines as usual and has to be released with
+// 'clReleaseCommandQueue'. See also 'SetGemmChunkLimit'.
+StatusCode PUBLIC_API CreatePriorityQueue(const cl_context context, const cl_device_id device,
+                                          const QueuePriority priority, const QueueThrottle throttle,
+                                          cl_command_queue* queue);
+
+// =================================================================================================
+
+// Handle types of memory and semaphores exported by other APIs (e.g. Vulkan), as for the
+// 'cl_khr_external_memory' and 'cl_khr_external_semaphore' extensions
+enum class ExternalMemoryHandle { kOpaqueFd = 0, kOpaqueWin32 = 1, kOpaqueWin32Kmt = 2, kDmaBuf = 3 };
+enum class ExternalSemaphoreHandle { kOpaqueFd = 0, kOpaqueWin32 = 1, kOpaqueWin32Kmt = 2, kSyncFd = 3 };
+using ExternalSemaphore = void*; // a 'cl_semaphore_khr'
+
+// Imports memory exported by another API (e.g. a Vulkan buffer) as an OpenCL buffer of 'size'
+// bytes for the device, without copying. The handle is a file descriptor or a Win32 handle. The
+// buffer can be passed to the routines, but only between 'AcquireExternalMemory' and
+// 'ReleaseExternalMemory' below. It has to be released with 'clReleaseMemObject'.
+StatusCode PUBLIC_API ImportExternalMemory(const cl_context context, const cl_device_id device,
+                                           const ExternalMemoryHandle handle_type,
+                                           const intptr_t handle, const size_t size,
+                                           cl_mem* buffer);
+
+// Imports a binary semaphore exported by another API, to synchronise with its work on the memory
+StatusCode PUBLIC_API ImportExternalSemaphore(const cl_context context, const cl_device_id device,
+                                              const ExternalSemaphoreHandle handle_type,
+                                              const intptr_t handle, ExternalSemaphore* semaphore);
+StatusCode PUBLIC_API ReleaseExternalSemaphore(const cl_device_id device,
+                                               const ExternalSemaphore semaphore);
+
+// Enqueues a wait for the semaphores (signalled by the other API) followed by the acquisition of
+// the imported buffers, such that the routines enqueued afterwards can use them. The release
+// enqueues the opposite: the release of the buffers followed by a signal of the semaphores for the
+// other API. The event is that of the last command enqueued.
+StatusCode PUBLIC_API AcquireExternalMemory(const std::vector<cl_mem> &buffers,
+                                            const std::vector<ExternalSemaphore> &wait_semaphores,
+                                            cl_command_queue* queue, cl_event* event = nullptr);
+StatusCode PUBLIC_API ReleaseExternalMemory(const std::vector<cl_mem> &buffers,
+                                            const std::vector<ExternalSemaphore> &signal_semaphores,
+                                            cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Timing information of a single kernel launch, passed to the profiling callback below. The names
+// are only valid during the callback. The times are in nanoseconds (CL_PROFILING_COMMAND_START/END).
+struct KernelProfile {
+  const char* routine_name;
+  const char* kernel_name;
+  size_t num_dimensions;
+  size_t global[3];
+  size_t local[3]; // zero in case the local size is chosen by the OpenCL implementation
+  unsigned long long start_time;
+  unsigned long long end_time;
+};
+using ProfilingCallback = void (*)(const KernelProfile &profile, void* user_data);
+
+// Sets a callback which receives the timing of each kernel launched by CLBlast, or removes it in
+// case of a nullptr. The timing is read asynchronously once the kernel has completed, so the
+// callback is called from a thread of the OpenCL implementation and should return quickly. The
+// queues have to be created with CL_QUEUE_PROFILING_ENABLE.
+StatusCode PUBLIC_API SetProfilingCallback(ProfilingCallback callback, void* user_data = nullptr);
+
+// A routine call which took longer than the threshold of the slow-call log, passed to the callback
+// below. The strings are only valid during the callback. The shape holds the arguments of the call
+// (e.g. "precision=32 m=1024 n=1024 k=1024 ...") with the enums as integers, and is empty for calls
+// made other than through the routines of this API (e.g. the execution of a GEMM plan). The
+// kernels are those launched by the call (which show the path taken, e.g. the direct or the
+// in-direct GEMM kernel), in order and separated by spaces. The device time is the sum of the times
+// of the kernels, or negative if they couldn't be profiled. The counts include the programs
+// compiled from source or created from a cached binary and the newly allocated temporary buffers.
+struct SlowCall {
+  const char* routine_name;
+  const char* shape;
+  const char* kernels;
+  double host_time_ms;
+  double device_time_ms;
+  size_t num_compilations;
+  size_t num_binary_loads;
+  size_t num_buffer_allocations;
+};
+using SlowCallCallback = void (*)(const SlowCall &call, void* user_data);
+
+// Enables the slow-call log: routine calls of which the host time (from the start of the call until
+// it returns) or the device time exceeds the threshold in milliseconds are passed to the callback,
+// once all their kernels have completed. This can be called from a thread of the OpenCL
+// implementation, so the callback should return quickly. Without a callback, the calls are printed
+// to stderr. A threshold of zero disables the log. The default threshold is taken from the
+// 'CLBLAST_SLOW_CALL_MS' environmental variable (if set). The device times require queues created
+// with CL_QUEUE_PROFILING_ENABLE, nested calls (e.g. GEMM within TRSM) count for the outer call.
+StatusCode PUBLIC_API SetSlowCallThreshold(const double threshold_ms,
+                                           SlowCallCallback callback = nullptr,
+                                           void* user_data = nullptr);
+
+// =================================================================================================
+
+// Counters of CLBlast's internal activity since the start or since 'ResetStatistics', e.g. to check
+// the efficiency of the caches in production. The counters are cheap and always enabled.
+struct RoutineStatistics {
+  size_t num_calls;
+  size_t num_kernels; // launched by the routine itself, i.e. excluding nested routine calls
+  double host_time_ms; // the time spent on the host in the calls, including nested routine calls
+  double setup_time_ms; // of which: constructing the routine, i.e. database and program lookups
+  double kernel_time_ms; // of which: retrieving (or creating) the kernel objects
+  double launch_time_ms; // of which: checking and enqueueing the kernels
+};
+struct Statistics {
+  size_t program_cache_hits; // lookups of compiled programs per context
+  size_t program_cache_misses;
+  size_t binary_cache_hits; // lookups of compiled binaries per device
+  size_t binary_cache_misses;
+  size_t database_cache_hits; // lookups of kernel parameters per device
+  size_t database_cache_misses;
+  size_t kernel_cache_hits; // lookups of kernel objects per program and host thread
+  size_t kernel_cache_misses;
+  size_t num_compilations; // compilations from source, including the time they took
+  double compilation_time_ms;
+  double source_time_ms; // of which: assembling the kernel source
+  double preprocessing_time_ms; // of which: the built-in pre-processor (on some devices only)
+  double build_time_ms; // of which: the compiler of the OpenCL or CUDA driver
+  size_t num_binary_loads; // programs created from a cached binary (in memory or on disk) instead
+  double binary_load_time_ms;
+  double database_time_ms; // searching the parameters of a kernel for a device (cache misses)
+  size_t num_buffer_allocations; // newly allocated temporary buffers and their total size
+  size_t buffer_bytes_allocated;
+  size_t num_buffer_reuses; // temporary buffers re-used from the memory pool
+  std::unordered_map<std::string, RoutineStatistics> routines; // per routine name, e.g. "GEMM"
+};
+
+// Retrieves or resets the above statistics
+StatusCode PUBLIC_API GetStatistics(Statistics &statistics);
+StatusCode PUBLIC_API ResetStatistics();
+
 // =================================================================================================
 
 // CLBlast stores binaries of compiled kernels into a cache in case the same kernel is used later on
 // for the same device. This cache can be cleared to free up system memory or in case of debugging.
 StatusCode PUBLIC_API ClearCache();
 
+// Removes the compiled programs, unused temporary buffers, on-device queues and pool queues of a
+// single context from the caches, such that no references to the context are kept. Call this before
+// releasing a context if the application creates and releases many contexts, since otherwise it is
+// kept alive.
+StatusCode PUBLIC_API ClearContextCache(const cl_context context);
+
+// Limits the number of compiled programs in the cache (zero for no limit, the default): beyond it,
+// the least-recently used programs are removed. The default is taken from the
+// 'CLBLAST_PROGRAM_CACHE_LIMIT' environmental variable (if set).
+StatusCode PUBLIC_API SetProgramCacheLimit(const size_t num_programs);
+
 // The cache can also be pre-initialized for a specific device with all possible CLBLast kernels.
-// Further CLBlast routine calls will then run at maximum speed.
+// Further CLBlast routine calls will then run at maximum speed. The kernels are compiled on multiple
+// threads, 'CLBLAST_NUM_COMPILE_THREADS' (if set) overrides the default of one per hardware thread.
 StatusCode PUBLIC_API FillCache(const cl_device_id device);
 
+// As above, but only for a selection of routines (e.g. "GEMM" or "GEMMSTRIDEDBATCHED") and
+// precisions. Contrary to the above, this also supports half precision.
+StatusCode PUBLIC_API FillCache(const cl_device_id device, const std::vector<std::string> &routines,
+                                const std::vector<Precision> &precisions);
+
+// As above, but returns immediately: the cache is filled in the background. Routine calls that need
+// a kernel which is being compiled at that moment wait for it rather than compiling it again.
+StatusCode PUBLIC_API FillCacheAsync(const cl_device_id device);
+
+// Compiled binaries can additionally be stored in an on-disk cache, such that they survive the end
+// of the process and can be shared between multiple processes. This sets the directory to use (it
+// must exist already), an empty string disables the on-disk cache. The default is taken from the
+// 'CLBLAST_CACHE_DIR' environmental variable (if set). Note that 'ClearCache' leaves these files.
+StatusCode PUBLIC_API SetCacheDirectory(const std::string &directory);
+
+// Compiled binaries can also be packaged into a single cache file, e.g. to ship them with an
+// application such that no kernels have to be compiled at run-time (see the 'clblast_precompile'
+// tool). This saves all binaries compiled (or loaded) so far for the given devices into a file.
+StatusCode PUBLIC_API SaveCacheFile(const std::vector<cl_device_id> &devices, const std::string &file_name);
+
+// Loads a cache file created by 'SaveCacheFile', whose binaries are then used instead of compiling
+// the kernels, as long as the platform, device, driver version and build options match. An empty
+// string removes the binaries again. The default is taken from the 'CLBLAST_CACHE_FILE' variable.
+StatusCode PUBLIC_API LoadCacheFile(const std::string &file_name);
+
+// Temporary buffers of the routines are taken from a pool of device memory, such that they are
+// re-used by later calls rather than allocated each time. This sets the maximum amount of unused
+// memory (in bytes) kept in the pool, zero disables pooling. The default is 256MB, or the value of
+// the 'CLBLAST_MEMORY_POOL_LIMIT' environmental variable (if set).
+StatusCode PUBLIC_API SetMemoryPoolLimit(const size_t bytes);
+
+// Releases all unused memory in the pool of temporary buffers
+StatusCode PUBLIC_API TrimMemoryPool();
+
+// The temporary buffers of a single GEMM call are bounded by a workspace limit (in bytes): larger
+// problems are computed in blocks of matrix C, each with smaller temporary buffers. Zero derives
+// the limit from the device: its maximum allocation size, up to a quarter of its memory. The
+// default is zero, or the value of the 'CLBLAST_GEMM_WORKSPACE_LIMIT' environmental variable.
+StatusCode PUBLIC_API SetGemmWorkspaceLimit(const size_t bytes);
+
+// Large GEMMs can also be computed in blocks of matrix C to bound the amount of work of a single
+// kernel (in multiply-adds), such that the device can run commands of other (e.g. high priority)
+// queues in between the blocks rather than after a long kernel. Zero disables this. The default is
+// zero, or the value of the 'CLBLAST_GEMM_CHUNK_LIMIT' environmental variable.
+StatusCode PUBLIC_API SetGemmChunkLimit(const size_t multiply_adds);
+
 // =================================================================================================
 
 // Retrieves current tuning parameters for a specific device-precision-kernel combination
@@ -703,62 +3223,129 @@ StatusCode PUBLIC_API OverrideParameters(const cl_device_id device, const std::s
                                          const Precision precision,
                                          const std::unordered_map<std::string,size_t> &parameters);
 
+// As 'OverrideParameters', but the parameters are only used for problems of at most 'max_size'
+// (and larger than the 'max_size' of any other size-specific override). For GEMM, the problem size
+// is the geometric mean of m, n, and k, for the banded matrix-vector kernel the number of stored
+// diagonals. Calling 'OverrideParameters' removes these overrides.
+StatusCode PUBLIC_API OverrideParametersForSize(const cl_device_id device, const std::string &kernel_name,
+                                                const Precision precision, const size_t max_size,
+                                                const std::unordered_map<std::string,size_t> &parameters);
+
+// Loads additional database entries from a JSON file (see 'doc/tuning.md' for the format), which
+// are searched before the built-in database. This makes it possible to use tuning results for new
+// devices without rebuilding the library. Parameters looked up earlier are dropped (including those
+// set through 'OverrideParameters'), an empty string removes the loaded entries again. The default
+// file is taken from the 'CLBLAST_DATABASE_FILE' environmental variable (if set).
+StatusCode PUBLIC_API LoadDatabaseFile(const std::string &file_name);
+
+// Registers a GEMM shape used frequently by the application, e.g. one of the fixed shapes of a
+// neural network. GEMM calls with exactly this shape which use the indirect kernel then run it from
+// a program compiled for these sizes, such that they are compile-time constants rather than kernel
+// arguments. The program is compiled on first use and kept in the cache as any other program.
+StatusCode PUBLIC_API RegisterGemmShape(const cl_device_id device, const Precision precision,
+                                        const Layout layout, const Transpose a_transpose,
+                                        const Transpose b_transpose,
+                                        const size_t m, const size_t n, const size_t k);
+
+// Removes all registered GEMM shapes, their programs stay in the cache until 'ClearCache'
+StatusCode PUBLIC_API ClearGemmShapes();
+
+// Enables online tuning of the GEMM kernel for the problem sizes used by the application: the first
+// GEMM call in each bucket of sizes (powers of two of the geometric mean of m, n, and k) is tuned in
+// a background thread once no routine has been called for a while. The results are installed with
+// 'OverrideParametersForSize' and stored in a file per device and driver version in the given
+// directory (which must exist already), from which they are read back in later processes. An empty
+// string disables online tuning. The default is taken from the 'CLBLAST_ONLINE_TUNING_DIR'
+// environmental variable (if set).
+StatusCode PUBLIC_API SetOnlineTuningDirectory(const std::string &directory);
+
+// Enables tiered compilation: a routine of which the tuned kernels are not yet compiled (or in one
+// of the binary caches) runs with kernels for generic parameters instead, while the tuned kernels
+// are compiled in a background thread and used by later calls. The default is taken from the
+// 'CLBLAST_TIERED_COMPILATION' environmental variable (if set to anything but '0').
+StatusCode PUBLIC_API SetTieredCompilation(const bool enabled);
+
+// Enables the profile-guided warm-up: every kernel program which the routines build (compiled or
+// created from a cached binary) is recorded in a manifest per device and driver version in the
+// given directory (which must exist already). When a later process sets the same directory, the
+// recorded programs are built again in a background thread right away, such that the first
+// routine calls find them in the binary cache. Combine this with 'SetCacheDirectory' to load them
+// from disk rather than compiling them. An empty string disables the recording. The default is
+// taken from the 'CLBLAST_WARM_UP_DIR' environmental variable (if set), in which case the warm-up
+// starts at the first kernel build of the process rather than at this call.
+StatusCode PUBLIC_API SetWarmUpDirectory(const std::string &directory);
+
 // =================================================================================================
 
+// The tuners below return the best parameters found, which can be passed to 'OverrideParameters'.
+// With a positive time budget (in milliseconds), the configurations closest to the current
+// parameters of the kernel in the database are tried first, and tuning stops once it is spent.
+
 // Tunes the "Xaxpy" kernel, used for many level-1 routines such as XAXPY, XCOPY, and XSWAP
 template <typename T>
 StatusCode TuneXaxpy(cl_command_queue* queue, const size_t n,
-                     const double fraction, std::unordered_map<std::string,size_t> &parameters);
+                     const double fraction, std::unordered_map<std::string,size_t> &parameters,
+                     const double time_budget_ms = 0.0);
 
 // Tunes the "Xdot" kernel, used for level-1 reduction routines such as XDOT, XMAX, and XSUM
 template <typename T>
 StatusCode TuneXdot(cl_command_queue* queue, const size_t n,
-                    const double fraction, std::unordered_map<std::string,size_t> &parameters);
+                    const double fraction, std::unordered_map<std::string,size_t> &parameters,
+                    const double time_budget_ms = 0.0);
 
 // Tunes the "Xgemv" kernel, used for matrix-vector level-2 routines such as XGEMV, XGBMV, and XHEMV
 template <typename T>
 StatusCode TuneXgemv(cl_command_queue* queue, const size_t m, const size_t n,
-                     const double fraction, std::unordered_map<std::string,size_t> &parameters);
+                     const double fraction, std::unordered_map<std::string,size_t> &parameters,
+                     const double time_budget_ms = 0.0);
 
 // Tunes the "Xger" kernel, used for matrix update level-2 routines such as XGER, XHER, and XSYR2
 template <typename T>
 StatusCode TuneXger(cl_command_queue* queue, const size_t m, const size_t n,
-                    const double fraction, std::unordered_map<std::string,size_t> &parameters);
+                    const double fraction, std::unordered_map<std::string,size_t> &parameters,
+                    const double time_budget_ms = 0.0);
 
 // Tunes the "Xgemm" kernel, used for most level-3 routines such as XGEMM, XSYMM, and XHER2K
 template <typename T>
 StatusCode TuneXgemm(cl_command_queue* queue, const size_t m, const size_t n, const size_t k,
-                    const double fraction, std::unordered_map<std::string,size_t> &parameters);
+                    const double fraction, std::unordered_map<std::string,size_t> &parameters,
+                    const double time_budget_ms = 0.0);
 
 // Tunes the "XgemmDiret" kernel, used for most level-3 routines such as XGEMM, XSYMM, and XHER2K
 template <typename T>
 StatusCode TuneXgemmDirect(cl_command_queue* queue, const size_t m, const size_t n, const size_t k,
-                           const double fraction, std::unordered_map<std::string,size_t> &parameters);
+                           const double fraction, std::unordered_map<std::string,size_t> &parameters,
+                           const double time_budget_ms = 0.0);
 
 // Tunes the "Copy" kernel, used for most level-3 routines such as XGEMM, XSYMM, and XHER2K
 template <typename T>
 StatusCode TuneCopy(cl_command_queue* queue, const size_t m, const size_t n,
-                    const double fraction, std::unordered_map<std::string,size_t> &parameters);
+                    const double fraction, std::unordered_map<std::string,size_t> &parameters,
+                    const double time_budget_ms = 0.0);
 
 // Tunes the "Pad" kernel, used for most level-3 routines such as XGEMM, XSYMM, and XHER2K
 template <typename T>
 StatusCode TunePad(cl_command_queue* queue, const size_t m, const size_t n,
-                   const double fraction, std::unordered_map<std::string,size_t> &parameters);
+                   const double fraction, std::unordered_map<std::string,size_t> &parameters,
+                   const double time_budget_ms = 0.0);
 
 // Tunes the "Transpose" kernel, used for most level-3 routines such as XGEMM, XSYMM, and XHER2K
 template <typename T>
 StatusCode TuneTranspose(cl_command_queue* queue, const size_t m, const size_t n,
-                         const double fraction, std::unordered_map<std::string,size_t> &parameters);
+                         const double fraction, std::unordered_map<std::string,size_t> &parameters,
+                         const double time_budget_ms = 0.0);
 
 // Tunes the "Padtranspose" kernel, used for most level-3 routines such as XGEMM, XSYMM, and XHER2K
 template <typename T>
 StatusCode TunePadtranspose(cl_command_queue* queue, const size_t m, const size_t n,
-                            const double fraction, std::unordered_map<std::string,size_t> &parameters);
+                            const double fraction, std::unordered_map<std::string,size_t> &parameters,
+                            const double time_budget_ms = 0.0);
 
 // Tunes the "Xgemm" kernel, used for the level-3 routine XTRSM
 template <typename T>
 StatusCode TuneInvert(cl_command_queue* queue, const size_t m, const size_t n, const size_t k,
-                      const double fraction, std::unordered_map<std::string,size_t> &parameters);
+                      const double fraction, std::unordered_map<std::string,size_t> &parameters,
+                      const double time_budget_ms = 0.0);
 
 // =================================================================================================
 
@@ -124,7 +124,10 @@ typedef enum CLBlastSide_ { CLBlastSideLeft = 141, CLBlastSideRight = 142 } CLBl
 // Precision enum (values in bits)
 typedef enum CLBlastPrecision_ { CLBlastPrecisionHalf = 16, CLBlastPrecisionSingle = 32,
                                  CLBlastPrecisionDouble = 64, CLBlastPrecisionComplexSingle = 3232,
-                                 CLBlastPrecisionComplexDouble = 6464 } CLBlastPrecision;
+                                 CLBlastPrecisionComplexDouble = 6464,
+                                 CLBlastPrecisionHalfSingle = 1632,
+                                 CLBlastPrecisionBFloat16 = 1616,
+                                 CLBlastPrecisionInt8 = 832 } CLBlastPrecision;
 
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
@@ -1356,6 +1359,60 @@ CLBlastStatusCode PUBLIC_API CLBlastHhad(const size_t n,
                                          cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
                                          cl_command_queue* queue, cl_event* event);
 
+// Scaling and addition of two vectors (non-BLAS function): SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+CLBlastStatusCode PUBLIC_API CLBlastSaxpby(const size_t n,
+                                           const float alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const float beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpby(const size_t n,
+                                           const double alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const double beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCaxpby(const size_t n,
+                                           const cl_float2 alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const cl_float2 beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpby(const size_t n,
+                                           const cl_double2 alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const cl_double2 beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpby(const size_t n,
+                                           const cl_half alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const cl_half beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+
+// Sets all elements of a vector to a scalar value (non-BLAS function): SSET/DSET/CSET/ZSET/HSET
+CLBlastStatusCode PUBLIC_API CLBlastSset(const size_t n,
+                                         const float alpha,
+                                         cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDset(const size_t n,
+                                         const double alpha,
+                                         cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCset(const size_t n,
+                                         const cl_float2 alpha,
+                                         cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZset(const size_t n,
+                                         const cl_double2 alpha,
+                                         cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHset(const size_t n,
+                                         const cl_half alpha,
+                                         cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                         cl_command_queue* queue, cl_event* event);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 CLBlastStatusCode PUBLIC_API CLBlastSomatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                                               const size_t m, const size_t n,
@@ -1410,6 +1467,72 @@ CLBlastStatusCode PUBLIC_API CLBlastHim2col(const size_t channels, const size_t
                                             cl_mem col_buffer, const size_t col_offset,
                                             cl_command_queue* queue, cl_event* event);
 
+// Col2im function (non-BLAS function): SCOL2IM/DCOL2IM/CCOL2IM/ZCOL2IM/HCOL2IM
+CLBlastStatusCode PUBLIC_API CLBlastScol2im(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                            const cl_mem col_buffer, const size_t col_offset,
+                                            cl_mem im_buffer, const size_t im_offset,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDcol2im(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                            const cl_mem col_buffer, const size_t col_offset,
+                                            cl_mem im_buffer, const size_t im_offset,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCcol2im(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                            const cl_mem col_buffer, const size_t col_offset,
+                                            cl_mem im_buffer, const size_t im_offset,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZcol2im(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                            const cl_mem col_buffer, const size_t col_offset,
+                                            cl_mem im_buffer, const size_t im_offset,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHcol2im(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                            const cl_mem col_buffer, const size_t col_offset,
+                                            cl_mem im_buffer, const size_t im_offset,
+                                            cl_command_queue* queue, cl_event* event);
+
+// Fused dot product, Euclidian norm and absolute sum (non-BLAS function): SDOTNRM2ASUM/DDOTNRM2ASUM/HDOTNRM2ASUM
+CLBlastStatusCode PUBLIC_API CLBlastSdotnrm2asum(const size_t n,
+                                                 cl_mem results_buffer, const size_t results_offset,
+                                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDdotnrm2asum(const size_t n,
+                                                 cl_mem results_buffer, const size_t results_offset,
+                                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHdotnrm2asum(const size_t n,
+                                                 cl_mem results_buffer, const size_t results_offset,
+                                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// Batched convolution as GEMM (non-BLAS function): SCONVGEMM/DCONVGEMM/HCONVGEMM
+CLBlastStatusCode PUBLIC_API CLBlastSconvgemm(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const size_t num_kernels, const size_t batch_count,
+                                              const cl_mem im_buffer, const size_t im_offset,
+                                              const cl_mem kernel_buffer, const size_t kernel_offset,
+                                              cl_mem result_buffer, const size_t result_offset,
+                                              cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDconvgemm(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const size_t num_kernels, const size_t batch_count,
+                                              const cl_mem im_buffer, const size_t im_offset,
+                                              const cl_mem kernel_buffer, const size_t kernel_offset,
+                                              cl_mem result_buffer, const size_t result_offset,
+                                              cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHconvgemm(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const size_t num_kernels, const size_t batch_count,
+                                              const cl_mem im_buffer, const size_t im_offset,
+                                              const cl_mem kernel_buffer, const size_t kernel_offset,
+                                              cl_mem result_buffer, const size_t result_offset,
+                                              cl_command_queue* queue, cl_event* event);
+
+// Cholesky factorisation (non-BLAS function): SPOTRF/DPOTRF
+CLBlastStatusCode PUBLIC_API CLBlastSpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_command_queue* queue, cl_event* event);
+
 // Batched version of AXPY: SAXPYBATCHED/DAXPYBATCHED/CAXPYBATCHED/ZAXPYBATCHED/HAXPYBATCHED
 CLBlastStatusCode PUBLIC_API CLBlastSaxpyBatched(const size_t n,
                                                  const float *alphas,
@@ -1442,6 +1565,69 @@ CLBlastStatusCode PUBLIC_API CLBlastHaxpyBatched(const size_t n,
                                                  const size_t batch_count,
                                                  cl_command_queue* queue, cl_event* event);
 
+// Batched version of ROT: SROTBATCHED/DROTBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSrotBatched(const size_t n,
+                                                cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                const float *coss,
+                                                const float *sins,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDrotBatched(const size_t n,
+                                                cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                const double *coss,
+                                                const double *sins,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event);
+
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const float *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const float *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const double *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const double *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_float2 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const cl_float2 *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_double2 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const cl_double2 *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_half *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const cl_half *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+
 // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
 CLBlastStatusCode PUBLIC_API CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
                                                  const size_t m, const size_t n, const size_t k,
@@ -1536,6 +1722,591 @@ CLBlastStatusCode PUBLIC_API CLBlastHgemmStridedBatched(const CLBlastLayout layo
                                                         const size_t batch_count,
                                                         cl_command_queue* queue, cl_event* event);
 
+// Batched version of TRSM: STRSMBATCHED/DTRSMBATCHED/CTRSMBATCHED/ZTRSMBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastStrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                 const size_t m, const size_t n,
+                                                 const float *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                 const size_t m, const size_t n,
+                                                 const double *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                 const size_t m, const size_t n,
+                                                 const cl_float2 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                 const size_t m, const size_t n,
+                                                 const cl_double2 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of TRSM: STRSMSTRIDEDBATCHED/DTRSMSTRIDEDBATCHED/CTRSMSTRIDEDBATCHED/ZTRSMSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastStrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const cl_float2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const cl_double2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of SYMM: SSYMMSTRIDEDBATCHED/DSYMMSTRIDEDBATCHED/CSYMMSTRIDEDBATCHED/ZSYMMSTRIDEDBATCHED/HSYMMSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSsymmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                                        const size_t m, const size_t n,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const float beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDsymmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                                        const size_t m, const size_t n,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const double beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCsymmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                                        const size_t m, const size_t n,
+                                                        const cl_float2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const cl_float2 beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZsymmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                                        const size_t m, const size_t n,
+                                                        const cl_double2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const cl_double2 beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHsymmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                                        const size_t m, const size_t n,
+                                                        const cl_half alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const cl_half beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of SYRK: SSYRKSTRIDEDBATCHED/DSYRKSTRIDEDBATCHED/CSYRKSTRIDEDBATCHED/ZSYRKSTRIDEDBATCHED/HSYRKSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                                                        const size_t n, const size_t k,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const float beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                                                        const size_t n, const size_t k,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const double beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                                                        const size_t n, const size_t k,
+                                                        const cl_float2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_float2 beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                                                        const size_t n, const size_t k,
+                                                        const cl_double2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_double2 beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                                                        const size_t n, const size_t k,
+                                                        const cl_half alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_half beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of TRMM: STRMMSTRIDEDBATCHED/DTRMMSTRIDEDBATCHED/CTRMMSTRIDEDBATCHED/ZTRMMSTRIDEDBATCHED/HTRMMSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastStrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDtrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCtrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const cl_float2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZtrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const cl_double2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHtrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const cl_half alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// Batched inversion of triangular matrices: SINVERTBATCHED/DINVERTBATCHED/CINVERTBATCHED/ZINVERTBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSinvertBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diagonal,
+                                                   const size_t n,
+                                                   const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                   cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                   const size_t batch_count,
+                                                   cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDinvertBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diagonal,
+                                                   const size_t n,
+                                                   const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                   cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                   const size_t batch_count,
+                                                   cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCinvertBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diagonal,
+                                                   const size_t n,
+                                                   const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                   cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                   const size_t batch_count,
+                                                   cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZinvertBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diagonal,
+                                                   const size_t n,
+                                                   const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                   cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                   const size_t batch_count,
+                                                   cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of POTRF: SPOTRFSTRIDEDBATCHED/DPOTRFSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSpotrfStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                                         const size_t n,
+                                                         cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                         const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDpotrfStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                                         const size_t n,
+                                                         cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                         const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const float beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const double beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const cl_float2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const cl_float2 beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const cl_double2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const cl_double2 beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const cl_half alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const cl_half beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of TRSV: STRSVSTRIDEDBATCHED/DTRSVSTRIDEDBATCHED/CTRSVSTRIDEDBATCHED/ZTRSVSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastStrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t n,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t n,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t n,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t n,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of OMATCOPY: SOMATCOPYSTRIDEDBATCHED/DOMATCOPYSTRIDEDBATCHED/COMATCOPYSTRIDEDBATCHED/ZOMATCOPYSTRIDEDBATCHED/HOMATCOPYSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                            const size_t m, const size_t n,
+                                                            const float alpha,
+                                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                            cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                            const size_t batch_count,
+                                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                            const size_t m, const size_t n,
+                                                            const double alpha,
+                                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                            cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                            const size_t batch_count,
+                                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastComatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                            const size_t m, const size_t n,
+                                                            const cl_float2 alpha,
+                                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                            cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                            const size_t batch_count,
+                                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                            const size_t m, const size_t n,
+                                                            const cl_double2 alpha,
+                                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                            cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                            const size_t batch_count,
+                                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                            const size_t m, const size_t n,
+                                                            const cl_half alpha,
+                                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                            cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                            const size_t batch_count,
+                                                            cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of IM2COL: SIM2COLSTRIDEDBATCHED/DIM2COLSTRIDEDBATCHED/CIM2COLSTRIDEDBATCHED/ZIM2COLSTRIDEDBATCHED/HIM2COLSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSim2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                                          const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                                          cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                                          const size_t batch_count,
+                                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDim2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                                          const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                                          cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                                          const size_t batch_count,
+                                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCim2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                                          const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                                          cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                                          const size_t batch_count,
+                                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZim2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                                          const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                                          cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                                          const size_t batch_count,
+                                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHim2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                                          const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                                          cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                                          const size_t batch_count,
+                                                          cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of COL2IM: SCOL2IMSTRIDEDBATCHED/DCOL2IMSTRIDEDBATCHED/CCOL2IMSTRIDEDBATCHED/ZCOL2IMSTRIDEDBATCHED/HCOL2IMSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastScol2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                                          const cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                                          cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                                          const size_t batch_count,
+                                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDcol2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                                          const cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                                          cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                                          const size_t batch_count,
+                                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCcol2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                                          const cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                                          cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                                          const size_t batch_count,
+                                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZcol2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                                          const cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                                          cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                                          const size_t batch_count,
+                                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHcol2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                                          const cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                                          cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                                          const size_t batch_count,
+                                                          cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of AXPY: SAXPYSTRIDEDBATCHED/DAXPYSTRIDEDBATCHED/CAXPYSTRIDEDBATCHED/ZAXPYSTRIDEDBATCHED/HAXPYSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSaxpyStridedBatched(const size_t n,
+                                                        const float alpha,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpyStridedBatched(const size_t n,
+                                                        const double alpha,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCaxpyStridedBatched(const size_t n,
+                                                        const cl_float2 alpha,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpyStridedBatched(const size_t n,
+                                                        const cl_double2 alpha,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpyStridedBatched(const size_t n,
+                                                        const cl_half alpha,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of AXPBY: SAXPBYSTRIDEDBATCHED/DAXPBYSTRIDEDBATCHED/CAXPBYSTRIDEDBATCHED/ZAXPBYSTRIDEDBATCHED/HAXPBYSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSaxpbyStridedBatched(const size_t n,
+                                                         const float alpha,
+                                                         const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                         const float beta,
+                                                         cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                         const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpbyStridedBatched(const size_t n,
+                                                         const double alpha,
+                                                         const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                         const double beta,
+                                                         cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                         const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCaxpbyStridedBatched(const size_t n,
+                                                         const cl_float2 alpha,
+                                                         const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                         const cl_float2 beta,
+                                                         cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                         const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpbyStridedBatched(const size_t n,
+                                                         const cl_double2 alpha,
+                                                         const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                         const cl_double2 beta,
+                                                         cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                         const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpbyStridedBatched(const size_t n,
+                                                         const cl_half alpha,
+                                                         const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                         const cl_half beta,
+                                                         cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                         const size_t batch_count,
+                                                         cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of SET: SSETSTRIDEDBATCHED/DSETSTRIDEDBATCHED/CSETSTRIDEDBATCHED/ZSETSTRIDEDBATCHED/HSETSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSsetStridedBatched(const size_t n,
+                                                       const float alpha,
+                                                       cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDsetStridedBatched(const size_t n,
+                                                       const double alpha,
+                                                       cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCsetStridedBatched(const size_t n,
+                                                       const cl_float2 alpha,
+                                                       cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZsetStridedBatched(const size_t n,
+                                                       const cl_double2 alpha,
+                                                       cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHsetStridedBatched(const size_t n,
+                                                       const cl_half alpha,
+                                                       cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of SCAL: SSCALSTRIDEDBATCHED/DSCALSTRIDEDBATCHED/CSCALSTRIDEDBATCHED/ZSCALSTRIDEDBATCHED/HSCALSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSscalStridedBatched(const size_t n,
+                                                        const float alpha,
+                                                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDscalStridedBatched(const size_t n,
+                                                        const double alpha,
+                                                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCscalStridedBatched(const size_t n,
+                                                        const cl_float2 alpha,
+                                                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZscalStridedBatched(const size_t n,
+                                                        const cl_double2 alpha,
+                                                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHscalStridedBatched(const size_t n,
+                                                        const cl_half alpha,
+                                                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSdotStridedBatched(const size_t n,
+                                                       cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                                                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDdotStridedBatched(const size_t n,
+                                                       cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                                                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHdotStridedBatched(const size_t n,
+                                                       cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                                                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of NRM2: SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSnrm2StridedBatched(const size_t n,
+                                                        cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDnrm2StridedBatched(const size_t n,
+                                                        cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastScnrm2StridedBatched(const size_t n,
+                                                        cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDznrm2StridedBatched(const size_t n,
+                                                        cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHnrm2StridedBatched(const size_t n,
+                                                        cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of ASUM: SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSasumStridedBatched(const size_t n,
+                                                        cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDasumStridedBatched(const size_t n,
+                                                        cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastScasumStridedBatched(const size_t n,
+                                                        cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDzasumStridedBatched(const size_t n,
+                                                        cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHasumStridedBatched(const size_t n,
+                                                        cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
 // =================================================================================================
 // General matrix-matrix multiplication with temporary buffer from user (optional, for advanced users): SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
 CLBlastStatusCode PUBLIC_API CLBlastSgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
@@ -1623,14 +2394,493 @@ CLBlastStatusCode PUBLIC_API CLBlastHGemmTempBufferSize(const CLBlastLayout layo
 
 // =================================================================================================
 
+// Opaque handle to a pre-planned GEMM, see 'CLBlastSGemmPlanCreate' below
+typedef struct _CLBlastGemmPlan* CLBlastGemmPlan;
+
+// Creates, executes, and destroys a plan for repeated GEMM calls with a fixed layout, transposes,
+// sizes, offsets and leading dimensions: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM (see 'GemmPlanCreate' in the
+// C++ API). A plan has to be executed and destroyed by the functions of the precision it was
+// created with, and should not be executed concurrently from multiple host threads.
+CLBlastStatusCode PUBLIC_API CLBlastSGemmPlanCreate(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                    const size_t m, const size_t n, const size_t k,
+                                                    const size_t a_offset, const size_t a_ld,
+                                                    const size_t b_offset, const size_t b_ld,
+                                                    const size_t c_offset, const size_t c_ld,
+                                                    cl_command_queue* queue, CLBlastGemmPlan* plan);
+CLBlastStatusCode PUBLIC_API CLBlastSGemmPlanExecute(CLBlastGemmPlan plan, const float alpha,
+                                                     const cl_mem a_buffer, const cl_mem b_buffer,
+                                                     const float beta, cl_mem c_buffer,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastSGemmPlanDestroy(CLBlastGemmPlan plan);
+CLBlastStatusCode PUBLIC_API CLBlastDGemmPlanCreate(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                    const size_t m, const size_t n, const size_t k,
+                                                    const size_t a_offset, const size_t a_ld,
+                                                    const size_t b_offset, const size_t b_ld,
+                                                    const size_t c_offset, const size_t c_ld,
+                                                    cl_command_queue* queue, CLBlastGemmPlan* plan);
+CLBlastStatusCode PUBLIC_API CLBlastDGemmPlanExecute(CLBlastGemmPlan plan, const double alpha,
+                                                     const cl_mem a_buffer, const cl_mem b_buffer,
+                                                     const double beta, cl_mem c_buffer,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDGemmPlanDestroy(CLBlastGemmPlan plan);
+CLBlastStatusCode PUBLIC_API CLBlastCGemmPlanCreate(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                    const size_t m, const size_t n, const size_t k,
+                                                    const size_t a_offset, const size_t a_ld,
+                                                    const size_t b_offset, const size_t b_ld,
+                                                    const size_t c_offset, const size_t c_ld,
+                                                    cl_command_queue* queue, CLBlastGemmPlan* plan);
+CLBlastStatusCode PUBLIC_API CLBlastCGemmPlanExecute(CLBlastGemmPlan plan, const cl_float2 alpha,
+                                                     const cl_mem a_buffer, const cl_mem b_buffer,
+                                                     const cl_float2 beta, cl_mem c_buffer,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCGemmPlanDestroy(CLBlastGemmPlan plan);
+CLBlastStatusCode PUBLIC_API CLBlastZGemmPlanCreate(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                    const size_t m, const size_t n, const size_t k,
+                                                    const size_t a_offset, const size_t a_ld,
+                                                    const size_t b_offset, const size_t b_ld,
+                                                    const size_t c_offset, const size_t c_ld,
+                                                    cl_command_queue* queue, CLBlastGemmPlan* plan);
+CLBlastStatusCode PUBLIC_API CLBlastZGemmPlanExecute(CLBlastGemmPlan plan, const cl_double2 alpha,
+                                                     const cl_mem a_buffer, const cl_mem b_buffer,
+                                                     const cl_double2 beta, cl_mem c_buffer,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZGemmPlanDestroy(CLBlastGemmPlan plan);
+CLBlastStatusCode PUBLIC_API CLBlastHGemmPlanCreate(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                    const size_t m, const size_t n, const size_t k,
+                                                    const size_t a_offset, const size_t a_ld,
+                                                    const size_t b_offset, const size_t b_ld,
+                                                    const size_t c_offset, const size_t c_ld,
+                                                    cl_command_queue* queue, CLBlastGemmPlan* plan);
+CLBlastStatusCode PUBLIC_API CLBlastHGemmPlanExecute(CLBlastGemmPlan plan, const cl_half alpha,
+                                                     const cl_mem a_buffer, const cl_mem b_buffer,
+                                                     const cl_half beta, cl_mem c_buffer,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHGemmPlanDestroy(CLBlastGemmPlan plan);
+
+// =================================================================================================
+
+// Opaque handle to a prepared triangular matrix of TRSM, see 'CLBlastSTrsmFactorCreate' below
+typedef struct _CLBlastTrsmFactor* CLBlastTrsmFactor;
+
+// Creates, solves with, and destroys a factor for repeated TRSM calls with the same triangular
+// matrix A: STRSM/DTRSM/CTRSM/ZTRSM/HTRSM (see 'TrsmFactorCreate' in the C++ API). A factor has to be
+// used and destroyed by the functions of the precision it was created with, and should not be used
+// concurrently from multiple host threads.
+CLBlastStatusCode PUBLIC_API CLBlastSTrsmFactorCreate(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                      const size_t k,
+                                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                      cl_command_queue* queue, CLBlastTrsmFactor* factor);
+CLBlastStatusCode PUBLIC_API CLBlastSTrsmFactorSolve(CLBlastTrsmFactor factor, const size_t m, const size_t n, const float alpha,
+                                                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastSTrsmFactorDestroy(CLBlastTrsmFactor factor);
+CLBlastStatusCode PUBLIC_API CLBlastDTrsmFactorCreate(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                      const size_t k,
+                                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                      cl_command_queue* queue, CLBlastTrsmFactor* factor);
+CLBlastStatusCode PUBLIC_API CLBlastDTrsmFactorSolve(CLBlastTrsmFactor factor, const size_t m, const size_t n, const double alpha,
+                                                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDTrsmFactorDestroy(CLBlastTrsmFactor factor);
+CLBlastStatusCode PUBLIC_API CLBlastCTrsmFactorCreate(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                      const size_t k,
+                                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                      cl_command_queue* queue, CLBlastTrsmFactor* factor);
+CLBlastStatusCode PUBLIC_API CLBlastCTrsmFactorSolve(CLBlastTrsmFactor factor, const size_t m, const size_t n, const cl_float2 alpha,
+                                                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCTrsmFactorDestroy(CLBlastTrsmFactor factor);
+CLBlastStatusCode PUBLIC_API CLBlastZTrsmFactorCreate(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                      const size_t k,
+                                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                      cl_command_queue* queue, CLBlastTrsmFactor* factor);
+CLBlastStatusCode PUBLIC_API CLBlastZTrsmFactorSolve(CLBlastTrsmFactor factor, const size_t m, const size_t n, const cl_double2 alpha,
+                                                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZTrsmFactorDestroy(CLBlastTrsmFactor factor);
+CLBlastStatusCode PUBLIC_API CLBlastHTrsmFactorCreate(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                      const size_t k,
+                                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                      cl_command_queue* queue, CLBlastTrsmFactor* factor);
+CLBlastStatusCode PUBLIC_API CLBlastHTrsmFactorSolve(CLBlastTrsmFactor factor, const size_t m, const size_t n, const cl_half alpha,
+                                                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHTrsmFactorDestroy(CLBlastTrsmFactor factor);
+
+// =================================================================================================
+
+// Converts 'n' consecutive single-precision values into bfloat16 values, rounding to nearest-even,
+// or the other way around (exact)
+CLBlastStatusCode PUBLIC_API CLBlastConvertToBFloat16(const size_t n,
+                                                      const cl_mem src_buffer, const size_t src_offset,
+                                                      cl_mem dest_buffer, const size_t dest_offset,
+                                                      cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastConvertFromBFloat16(const size_t n,
+                                                        const cl_mem src_buffer, const size_t src_offset,
+                                                        cl_mem dest_buffer, const size_t dest_offset,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// As above, but converting between single-precision and half-precision values on the device
+CLBlastStatusCode PUBLIC_API CLBlastConvertToHalf(const size_t n,
+                                                  const cl_mem src_buffer, const size_t src_offset,
+                                                  cl_mem dest_buffer, const size_t dest_offset,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastConvertFromHalf(const size_t n,
+                                                    const cl_mem src_buffer, const size_t src_offset,
+                                                    cl_mem dest_buffer, const size_t dest_offset,
+                                                    cl_command_queue* queue, cl_event* event);
+
+// Converts 'n' consecutive single-precision values in host memory into half-precision values,
+// rounding to nearest-even, or the other way around (exact), using SIMD instructions if available
+void PUBLIC_API CLBlastFloatToHalfArray(const float* src, cl_half* dest, const size_t n);
+void PUBLIC_API CLBlastHalfToFloatArray(const cl_half* src, float* dest, const size_t n);
+
+// =================================================================================================
+
+// Integer matrix-multiplication for quantised data with 8-bit inputs and 32-bit accumulation,
+// storing either 32-bit results or results requantised to 8 bits with a scale per column of C
+CLBlastStatusCode PUBLIC_API CLBlastGemmInt8(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const int alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const int beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastGemmInt8Requantized(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t m, const size_t n, const size_t k,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                        const cl_mem scales_buffer, const size_t scales_offset,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// Multi-device GEMM on matrices in host memory, splitting C in panels over the devices of the
+// 'num_queues' queues. The 'weights' are the relative throughputs of the devices or NULL for the
+// default estimates. This returns when C is updated in host memory.
+CLBlastStatusCode PUBLIC_API CLBlastSgemmMultiDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                     const size_t m, const size_t n, const size_t k,
+                                                     const float alpha,
+                                                     const float* a, const size_t a_ld,
+                                                     const float* b, const size_t b_ld,
+                                                     const float beta,
+                                                     float* c, const size_t c_ld,
+                                                     cl_command_queue* queues, const size_t num_queues, const double* weights);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmMultiDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                     const size_t m, const size_t n, const size_t k,
+                                                     const double alpha,
+                                                     const double* a, const size_t a_ld,
+                                                     const double* b, const size_t b_ld,
+                                                     const double beta,
+                                                     double* c, const size_t c_ld,
+                                                     cl_command_queue* queues, const size_t num_queues, const double* weights);
+CLBlastStatusCode PUBLIC_API CLBlastCgemmMultiDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                     const size_t m, const size_t n, const size_t k,
+                                                     const cl_float2 alpha,
+                                                     const cl_float2* a, const size_t a_ld,
+                                                     const cl_float2* b, const size_t b_ld,
+                                                     const cl_float2 beta,
+                                                     cl_float2* c, const size_t c_ld,
+                                                     cl_command_queue* queues, const size_t num_queues, const double* weights);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmMultiDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                     const size_t m, const size_t n, const size_t k,
+                                                     const cl_double2 alpha,
+                                                     const cl_double2* a, const size_t a_ld,
+                                                     const cl_double2* b, const size_t b_ld,
+                                                     const cl_double2 beta,
+                                                     cl_double2* c, const size_t c_ld,
+                                                     cl_command_queue* queues, const size_t num_queues, const double* weights);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmMultiDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                     const size_t m, const size_t n, const size_t k,
+                                                     const cl_half alpha,
+                                                     const cl_half* a, const size_t a_ld,
+                                                     const cl_half* b, const size_t b_ld,
+                                                     const cl_half beta,
+                                                     cl_half* c, const size_t c_ld,
+                                                     cl_command_queue* queues, const size_t num_queues, const double* weights);
+
+// Streaming GEMM on matrices in host memory which do not have to fit in device memory, computed in
+// tiles of at most 'tile_size' by 'tile_size' (zero for a default based on the device memory).
+// This returns when C is updated in host memory.
+CLBlastStatusCode PUBLIC_API CLBlastSgemmStreaming(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                   const size_t m, const size_t n, const size_t k,
+                                                   const float alpha,
+                                                   const float* a, const size_t a_ld,
+                                                   const float* b, const size_t b_ld,
+                                                   const float beta,
+                                                   float* c, const size_t c_ld,
+                                                   cl_command_queue* queue, const size_t tile_size);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmStreaming(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                   const size_t m, const size_t n, const size_t k,
+                                                   const double alpha,
+                                                   const double* a, const size_t a_ld,
+                                                   const double* b, const size_t b_ld,
+                                                   const double beta,
+                                                   double* c, const size_t c_ld,
+                                                   cl_command_queue* queue, const size_t tile_size);
+CLBlastStatusCode PUBLIC_API CLBlastCgemmStreaming(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                   const size_t m, const size_t n, const size_t k,
+                                                   const cl_float2 alpha,
+                                                   const cl_float2* a, const size_t a_ld,
+                                                   const cl_float2* b, const size_t b_ld,
+                                                   const cl_float2 beta,
+                                                   cl_float2* c, const size_t c_ld,
+                                                   cl_command_queue* queue, const size_t tile_size);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmStreaming(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                   const size_t m, const size_t n, const size_t k,
+                                                   const cl_double2 alpha,
+                                                   const cl_double2* a, const size_t a_ld,
+                                                   const cl_double2* b, const size_t b_ld,
+                                                   const cl_double2 beta,
+                                                   cl_double2* c, const size_t c_ld,
+                                                   cl_command_queue* queue, const size_t tile_size);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmStreaming(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                   const size_t m, const size_t n, const size_t k,
+                                                   const cl_half alpha,
+                                                   const cl_half* a, const size_t a_ld,
+                                                   const cl_half* b, const size_t b_ld,
+                                                   const cl_half beta,
+                                                   cl_half* c, const size_t c_ld,
+                                                   cl_command_queue* queue, const size_t tile_size);
+
+// Variants of the main routines on shared virtual memory (SVM) pointers instead of buffers. The
+// pointers are used in-place, offsets are applied to the pointers themselves.
+CLBlastStatusCode PUBLIC_API CLBlastSgemmSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const float alpha,
+                                             const float* a, const size_t a_ld,
+                                             const float* b, const size_t b_ld,
+                                             const float beta,
+                                             float* c, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const double alpha,
+                                             const double* a, const size_t a_ld,
+                                             const double* b, const size_t b_ld,
+                                             const double beta,
+                                             double* c, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemmSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const cl_float2 alpha,
+                                             const cl_float2* a, const size_t a_ld,
+                                             const cl_float2* b, const size_t b_ld,
+                                             const cl_float2 beta,
+                                             cl_float2* c, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const cl_double2 alpha,
+                                             const cl_double2* a, const size_t a_ld,
+                                             const cl_double2* b, const size_t b_ld,
+                                             const cl_double2 beta,
+                                             cl_double2* c, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const cl_half alpha,
+                                             const cl_half* a, const size_t a_ld,
+                                             const cl_half* b, const size_t b_ld,
+                                             const cl_half beta,
+                                             cl_half* c, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastSgemmStridedBatchedSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                           const size_t m, const size_t n, const size_t k,
+                                                           const float alpha,
+                                                           const float* a, const size_t a_ld, const size_t a_stride,
+                                                           const float* b, const size_t b_ld, const size_t b_stride,
+                                                           const float beta,
+                                                           float* c, const size_t c_ld, const size_t c_stride,
+                                                           const size_t batch_count,
+                                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmStridedBatchedSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                           const size_t m, const size_t n, const size_t k,
+                                                           const double alpha,
+                                                           const double* a, const size_t a_ld, const size_t a_stride,
+                                                           const double* b, const size_t b_ld, const size_t b_stride,
+                                                           const double beta,
+                                                           double* c, const size_t c_ld, const size_t c_stride,
+                                                           const size_t batch_count,
+                                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemmStridedBatchedSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                           const size_t m, const size_t n, const size_t k,
+                                                           const cl_float2 alpha,
+                                                           const cl_float2* a, const size_t a_ld, const size_t a_stride,
+                                                           const cl_float2* b, const size_t b_ld, const size_t b_stride,
+                                                           const cl_float2 beta,
+                                                           cl_float2* c, const size_t c_ld, const size_t c_stride,
+                                                           const size_t batch_count,
+                                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmStridedBatchedSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                           const size_t m, const size_t n, const size_t k,
+                                                           const cl_double2 alpha,
+                                                           const cl_double2* a, const size_t a_ld, const size_t a_stride,
+                                                           const cl_double2* b, const size_t b_ld, const size_t b_stride,
+                                                           const cl_double2 beta,
+                                                           cl_double2* c, const size_t c_ld, const size_t c_stride,
+                                                           const size_t batch_count,
+                                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmStridedBatchedSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                           const size_t m, const size_t n, const size_t k,
+                                                           const cl_half alpha,
+                                                           const cl_half* a, const size_t a_ld, const size_t a_stride,
+                                                           const cl_half* b, const size_t b_ld, const size_t b_stride,
+                                                           const cl_half beta,
+                                                           cl_half* c, const size_t c_ld, const size_t c_stride,
+                                                           const size_t batch_count,
+                                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastSaxpySVM(const size_t n,
+                                             const float alpha,
+                                             const float* x, const size_t x_inc,
+                                             float* y, const size_t y_inc,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpySVM(const size_t n,
+                                             const double alpha,
+                                             const double* x, const size_t x_inc,
+                                             double* y, const size_t y_inc,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCaxpySVM(const size_t n,
+                                             const cl_float2 alpha,
+                                             const cl_float2* x, const size_t x_inc,
+                                             cl_float2* y, const size_t y_inc,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpySVM(const size_t n,
+                                             const cl_double2 alpha,
+                                             const cl_double2* x, const size_t x_inc,
+                                             cl_double2* y, const size_t y_inc,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpySVM(const size_t n,
+                                             const cl_half alpha,
+                                             const cl_half* x, const size_t x_inc,
+                                             cl_half* y, const size_t y_inc,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastSdotSVM(const size_t n,
+                                            float* dot,
+                                            const float* x, const size_t x_inc,
+                                            const float* y, const size_t y_inc,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDdotSVM(const size_t n,
+                                            double* dot,
+                                            const double* x, const size_t x_inc,
+                                            const double* y, const size_t y_inc,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHdotSVM(const size_t n,
+                                            cl_half* dot,
+                                            const cl_half* x, const size_t x_inc,
+                                            const cl_half* y, const size_t y_inc,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastSgemvSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const float alpha,
+                                             const float* a, const size_t a_ld,
+                                             const float* x, const size_t x_inc,
+                                             const float beta,
+                                             float* y, const size_t y_inc,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemvSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const double alpha,
+                                             const double* a, const size_t a_ld,
+                                             const double* x, const size_t x_inc,
+                                             const double beta,
+                                             double* y, const size_t y_inc,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemvSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const cl_float2 alpha,
+                                             const cl_float2* a, const size_t a_ld,
+                                             const cl_float2* x, const size_t x_inc,
+                                             const cl_float2 beta,
+                                             cl_float2* y, const size_t y_inc,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemvSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const cl_double2 alpha,
+                                             const cl_double2* a, const size_t a_ld,
+                                             const cl_double2* x, const size_t x_inc,
+                                             const cl_double2 beta,
+                                             cl_double2* y, const size_t y_inc,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemvSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const cl_half alpha,
+                                             const cl_half* a, const size_t a_ld,
+                                             const cl_half* x, const size_t x_inc,
+                                             const cl_half beta,
+                                             cl_half* y, const size_t y_inc,
+                                             cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
 // CLBlast stores binaries of compiled kernels into a cache in case the same kernel is used later on
 // for the same device. This cache can be cleared to free up system memory or in case of debugging.
 CLBlastStatusCode PUBLIC_API CLBlastClearCache();
 
+// Removes the compiled programs, unused temporary buffers and on-device queues of a single context
+// from the caches, such that no references to the context are kept. Call this before releasing a
+// context if the application creates and releases many contexts, since otherwise it is kept alive.
+CLBlastStatusCode PUBLIC_API CLBlastClearContextCache(const cl_context context);
+
+// Limits the number of compiled programs in the cache (zero for no limit, the default): beyond it,
+// the least-recently used programs are removed. The default is taken from the
+// 'CLBLAST_PROGRAM_CACHE_LIMIT' environmental variable (if set).
+CLBlastStatusCode PUBLIC_API CLBlastSetProgramCacheLimit(const size_t num_programs);
+
 // The cache can also be pre-initialized for a specific device with all possible CLBLast kernels.
-// Further CLBlast routine calls will then run at maximum speed.
+// Further CLBlast routine calls will then run at maximum speed. The kernels are compiled on multiple
+// threads, 'CLBLAST_NUM_COMPILE_THREADS' (if set) overrides the default of one per hardware thread.
 CLBlastStatusCode PUBLIC_API CLBlastFillCache(const cl_device_id device);
 
+// As above, but only for a selection of routines (e.g. "GEMM" or "GEMMSTRIDEDBATCHED") and
+// precisions. Contrary to the above, this also supports half precision.
+CLBlastStatusCode PUBLIC_API CLBlastFillCacheForRoutines(const cl_device_id device,
+                                                         const char** routines, const size_t num_routines,
+                                                         const CLBlastPrecision* precisions,
+                                                         const size_t num_precisions);
+
+// As above, but returns immediately: the cache is filled in the background. Routine calls that need
+// a kernel which is being compiled at that moment wait for it rather than compiling it again.
+CLBlastStatusCode PUBLIC_API CLBlastFillCacheAsync(const cl_device_id device);
+
+// Compiled binaries can additionally be stored in an on-disk cache, such that they survive the end
+// of the process and can be shared between multiple processes. This sets the directory to use (it
+// must exist already), an empty string disables the on-disk cache. The default is taken from the
+// 'CLBLAST_CACHE_DIR' environmental variable (if set). Note that 'ClearCache' leaves these files.
+CLBlastStatusCode PUBLIC_API CLBlastSetCacheDirectory(const char* directory);
+
+// Compiled binaries can also be packaged into a single cache file, e.g. to ship them with an
+// application such that no kernels have to be compiled at run-time (see the 'clblast_precompile'
+// tool). This saves all binaries compiled (or loaded) so far for the given devices into a file.
+CLBlastStatusCode PUBLIC_API CLBlastSaveCacheFile(const cl_device_id* devices, const size_t num_devices,
+                                                  const char* file_name);
+
+// Loads a cache file created by 'CLBlastSaveCacheFile', whose binaries are then used instead of
+// compiling the kernels, as long as the platform, device, driver version and build options match.
+// An empty string or NULL removes the binaries again. The default is taken from 'CLBLAST_CACHE_FILE'.
+CLBlastStatusCode PUBLIC_API CLBlastLoadCacheFile(const char* file_name);
+
+// Temporary buffers of the routines are taken from a pool of device memory, such that they are
+// re-used by later calls rather than allocated each time. This sets the maximum amount of unused
+// memory (in bytes) kept in the pool, zero disables pooling. The default is 256MB, or the value of
+// the 'CLBLAST_MEMORY_POOL_LIMIT' environmental variable (if set).
+CLBlastStatusCode PUBLIC_API CLBlastSetMemoryPoolLimit(const size_t bytes);
+
+// Releases all unused memory in the pool of temporary buffers
+CLBlastStatusCode PUBLIC_API CLBlastTrimMemoryPool();
+
+// The temporary buffers of a single GEMM call are bounded by a workspace limit (in bytes): larger
+// problems are computed in blocks of matrix C, each with smaller temporary buffers. Zero derives
+// the limit from the device: its maximum allocation size, up to a quarter of its memory. The
+// default is zero, or the value of the 'CLBLAST_GEMM_WORKSPACE_LIMIT' environmental variable.
+CLBlastStatusCode PUBLIC_API CLBlastSetGemmWorkspaceLimit(const size_t bytes);
+
+// Large GEMMs can also be computed in blocks of matrix C to bound the amount of work of a single
+// kernel (in multiply-adds), such that the device can run commands of other (e.g. high priority)
+// queues in between the blocks rather than after a long kernel. Zero disables this. The default is
+// zero, or the value of the 'CLBLAST_GEMM_CHUNK_LIMIT' environmental variable.
+CLBlastStatusCode PUBLIC_API CLBlastSetGemmChunkLimit(const size_t multiply_adds);
+
 // =================================================================================================
 
 // Overrides tuning parameters for a specific device-precision-kernel combination. The next time
@@ -1639,6 +2889,26 @@ CLBlastStatusCode PUBLIC_API CLBlastOverrideParameters(const cl_device_id device
                                                        const CLBlastPrecision precision, const size_t num_parameters,
                                                        const char** parameters_names, const size_t* parameters_values);
 
+// As 'CLBlastOverrideParameters', but the parameters are only used for problems of at most
+// 'max_size'. For GEMM, the problem size is the geometric mean of m, n, and k.
+CLBlastStatusCode PUBLIC_API CLBlastOverrideParametersForSize(const cl_device_id device, const char* kernel_name,
+                                                              const CLBlastPrecision precision, const size_t max_size,
+                                                              const size_t num_parameters,
+                                                              const char** parameters_names, const size_t* parameters_values);
+
+// Loads additional database entries from a JSON file, which are searched before the built-in
+// database. Parameters looked up earlier are dropped, an empty string or NULL removes the entries.
+// The default file is taken from the 'CLBLAST_DATABASE_FILE' environmental variable (if set).
+CLBlastStatusCode PUBLIC_API CLBlastLoadDatabaseFile(const char* file_name);
+
+// Registers a GEMM shape, such that GEMM calls of exactly this shape which use the indirect kernel
+// run it from a program compiled for these sizes. 'CLBlastClearGemmShapes' removes all shapes.
+CLBlastStatusCode PUBLIC_API CLBlastRegisterGemmShape(const cl_device_id device, const CLBlastPrecision precision,
+                                                      const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                      const CLBlastTranspose b_transpose,
+                                                      const size_t m, const size_t n, const size_t k);
+CLBlastStatusCode PUBLIC_API CLBlastClearGemmShapes();
+
 // =================================================================================================
 
 #ifdef __cplusplus
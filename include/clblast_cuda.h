@@ -18,6 +18,7 @@
 
 #include <cstdlib> // For size_t
 #include <string> // For OverrideParameters function
+#include <vector> // For FillCache function
 #include <unordered_map> // For OverrideParameters function
 
 // CUDA
@@ -90,9 +91,16 @@ enum class Triangle { kUpper = 121, kLower = 122 };
 enum class Diagonal { kNonUnit = 131, kUnit = 132 };
 enum class Side { kLeft = 141, kRight = 142 };
 
-// Precision scoped enum (values in bits)
+// Precision scoped enum (values in bits). The mixed half/single precision is only used for tuning
+// and database purposes: half-precision data with single-precision accumulation in GEMM.
+// BFloat16 is the 16-bit "brain" floating-point format, only supported by GEMM and AXPY.
+// Int8 is 8-bit signed integer data with 32-bit integer accumulation, only supported by GEMM.
+// HalfStorage is half-precision data computed in single precision on devices without FP16
+// support, only used internally by GEMM, GEMV and some level-1 routines (see the docs).
 enum class Precision { kHalf = 16, kSingle = 32, kDouble = 64,
-                       kComplexSingle = 3232, kComplexDouble = 6464, kAny = -1 };
+                       kComplexSingle = 3232, kComplexDouble = 6464,
+                       kHalfSingle = 1632, kBFloat16 = 1616, kInt8 = 832,
+                       kHalfStorage = 1600, kAny = -1 };
 
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
@@ -592,6 +600,22 @@ StatusCode Had(const size_t n,
                CUdeviceptr z_buffer, const size_t z_offset, const size_t z_inc,
                const CUcontext context, const CUdevice device);
 
+// Scaling and addition of two vectors (non-BLAS function): SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+template <typename T>
+StatusCode Axpby(const size_t n,
+                 const T alpha,
+                 const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta,
+                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                 const CUcontext context, const CUdevice device);
+
+// Sets all elements of a vector to a scalar value (non-BLAS function): SSET/DSET/CSET/ZSET/HSET
+template <typename T>
+StatusCode Set(const size_t n,
+               const T alpha,
+               CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+               const CUcontext context, const CUdevice device);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 template <typename T>
 StatusCode Omatcopy(const Layout layout, const Transpose a_transpose,
@@ -608,6 +632,36 @@ StatusCode Im2col(const size_t channels, const size_t height, const size_t width
                   CUdeviceptr col_buffer, const size_t col_offset,
                   const CUcontext context, const CUdevice device);
 
+// Col2im function (non-BLAS function): SCOL2IM/DCOL2IM/CCOL2IM/ZCOL2IM/HCOL2IM
+template <typename T>
+StatusCode Col2im(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                  const CUdeviceptr col_buffer, const size_t col_offset,
+                  CUdeviceptr im_buffer, const size_t im_offset,
+                  const CUcontext context, const CUdevice device);
+
+// Fused dot product, Euclidian norm and absolute sum (non-BLAS function): SDOTNRM2ASUM/DDOTNRM2ASUM/HDOTNRM2ASUM
+template <typename T>
+StatusCode Dotnrm2asum(const size_t n,
+                       CUdeviceptr results_buffer, const size_t results_offset,
+                       const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                       const CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                       const CUcontext context, const CUdevice device);
+
+// Batched convolution as GEMM (non-BLAS function): SCONVGEMM/DCONVGEMM/HCONVGEMM
+template <typename T>
+StatusCode Convgemm(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const size_t num_kernels, const size_t batch_count,
+                    const CUdeviceptr im_buffer, const size_t im_offset,
+                    const CUdeviceptr kernel_buffer, const size_t kernel_offset,
+                    CUdeviceptr result_buffer, const size_t result_offset,
+                    const CUcontext context, const CUdevice device);
+
+// Cholesky factorisation (non-BLAS function): SPOTRF/DPOTRF
+template <typename T>
+StatusCode Potrf(const Layout layout, const Triangle triangle,
+                 const size_t n,
+                 CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld,
+                 const CUcontext context, const CUdevice device);
+
 // Batched version of AXPY: SAXPYBATCHED/DAXPYBATCHED/CAXPYBATCHED/ZAXPYBATCHED/HAXPYBATCHED
 template <typename T>
 StatusCode AxpyBatched(const size_t n,
@@ -617,6 +671,28 @@ StatusCode AxpyBatched(const size_t n,
                        const size_t batch_count,
                        const CUcontext context, const CUdevice device);
 
+// Batched version of ROT: SROTBATCHED/DROTBATCHED
+template <typename T>
+StatusCode RotBatched(const size_t n,
+                      CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                      CUdeviceptr y_buffer, const size_t *y_offsets, const size_t y_inc,
+                      const T *coss,
+                      const T *sins,
+                      const size_t batch_count,
+                      const CUcontext context, const CUdevice device);
+
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+template <typename T>
+StatusCode GemvBatched(const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const CUdeviceptr a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const T *betas,
+                       CUdeviceptr y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       const CUcontext context, const CUdevice device);
+
 // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
 template <typename T>
 StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
@@ -641,6 +717,183 @@ StatusCode GemmStridedBatched(const Layout layout, const Transpose a_transpose,
                               const size_t batch_count,
                               const CUcontext context, const CUdevice device);
 
+// Batched version of TRSM: STRSMBATCHED/DTRSMBATCHED/CTRSMBATCHED/ZTRSMBATCHED
+template <typename T>
+StatusCode TrsmBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const CUdeviceptr a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       CUdeviceptr b_buffer, const size_t *b_offsets, const size_t b_ld,
+                       const size_t batch_count,
+                       const CUcontext context, const CUdevice device);
+
+// StridedBatched version of TRSM: STRSMSTRIDEDBATCHED/DTRSMSTRIDEDBATCHED/CTRSMSTRIDEDBATCHED/ZTRSMSTRIDEDBATCHED
+template <typename T>
+StatusCode TrsmStridedBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              CUdeviceptr b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// StridedBatched version of SYMM: SSYMMSTRIDEDBATCHED/DSYMMSTRIDEDBATCHED/CSYMMSTRIDEDBATCHED/ZSYMMSTRIDEDBATCHED/HSYMMSTRIDEDBATCHED
+template <typename T>
+StatusCode SymmStridedBatched(const Layout layout, const Side side, const Triangle triangle,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const CUdeviceptr b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const T beta,
+                              CUdeviceptr c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// StridedBatched version of SYRK: SSYRKSTRIDEDBATCHED/DSYRKSTRIDEDBATCHED/CSYRKSTRIDEDBATCHED/ZSYRKSTRIDEDBATCHED/HSYRKSTRIDEDBATCHED
+template <typename T>
+StatusCode SyrkStridedBatched(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                              const size_t n, const size_t k,
+                              const T alpha,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const T beta,
+                              CUdeviceptr c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// StridedBatched version of TRMM: STRMMSTRIDEDBATCHED/DTRMMSTRIDEDBATCHED/CTRMMSTRIDEDBATCHED/ZTRMMSTRIDEDBATCHED/HTRMMSTRIDEDBATCHED
+template <typename T>
+StatusCode TrmmStridedBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              CUdeviceptr b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// Batched inversion of triangular matrices: SINVERTBATCHED/DINVERTBATCHED/CINVERTBATCHED/ZINVERTBATCHED
+template <typename T>
+StatusCode InvertBatched(const Layout layout, const Triangle triangle, const Diagonal diagonal,
+                         const size_t n,
+                         const CUdeviceptr a_buffer, const size_t *a_offsets, const size_t a_ld,
+                         CUdeviceptr b_buffer, const size_t *b_offsets, const size_t b_ld,
+                         const size_t batch_count,
+                         const CUcontext context, const CUdevice device);
+
+// StridedBatched version of POTRF: SPOTRFSTRIDEDBATCHED/DPOTRFSTRIDEDBATCHED
+template <typename T>
+StatusCode PotrfStridedBatched(const Layout layout, const Triangle triangle,
+                               const size_t n,
+                               CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                               const size_t batch_count,
+                               const CUcontext context, const CUdevice device);
+
+// StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+template <typename T>
+StatusCode GemvStridedBatched(const Layout layout, const Transpose a_transpose,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const T beta,
+                              CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// StridedBatched version of TRSV: STRSVSTRIDEDBATCHED/DTRSVSTRIDEDBATCHED/CTRSVSTRIDEDBATCHED/ZTRSVSTRIDEDBATCHED
+template <typename T>
+StatusCode TrsvStridedBatched(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t n,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// StridedBatched version of OMATCOPY: SOMATCOPYSTRIDEDBATCHED/DOMATCOPYSTRIDEDBATCHED/COMATCOPYSTRIDEDBATCHED/ZOMATCOPYSTRIDEDBATCHED/HOMATCOPYSTRIDEDBATCHED
+template <typename T>
+StatusCode OmatcopyStridedBatched(const Layout layout, const Transpose a_transpose,
+                                  const size_t m, const size_t n,
+                                  const T alpha,
+                                  const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                  CUdeviceptr b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                  const size_t batch_count,
+                                  const CUcontext context, const CUdevice device);
+
+// StridedBatched version of IM2COL: SIM2COLSTRIDEDBATCHED/DIM2COLSTRIDEDBATCHED/CIM2COLSTRIDEDBATCHED/ZIM2COLSTRIDEDBATCHED/HIM2COLSTRIDEDBATCHED
+template <typename T>
+StatusCode Im2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                const CUdeviceptr im_buffer, const size_t im_offset, const size_t im_stride,
+                                CUdeviceptr col_buffer, const size_t col_offset, const size_t col_stride,
+                                const size_t batch_count,
+                                const CUcontext context, const CUdevice device);
+
+// StridedBatched version of COL2IM: SCOL2IMSTRIDEDBATCHED/DCOL2IMSTRIDEDBATCHED/CCOL2IMSTRIDEDBATCHED/ZCOL2IMSTRIDEDBATCHED/HCOL2IMSTRIDEDBATCHED
+template <typename T>
+StatusCode Col2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                const CUdeviceptr col_buffer, const size_t col_offset, const size_t col_stride,
+                                CUdeviceptr im_buffer, const size_t im_offset, const size_t im_stride,
+                                const size_t batch_count,
+                                const CUcontext context, const CUdevice device);
+
+// StridedBatched version of AXPY: SAXPYSTRIDEDBATCHED/DAXPYSTRIDEDBATCHED/CAXPYSTRIDEDBATCHED/ZAXPYSTRIDEDBATCHED/HAXPYSTRIDEDBATCHED
+template <typename T>
+StatusCode AxpyStridedBatched(const size_t n,
+                              const T alpha,
+                              const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// StridedBatched version of AXPBY: SAXPBYSTRIDEDBATCHED/DAXPBYSTRIDEDBATCHED/CAXPBYSTRIDEDBATCHED/ZAXPBYSTRIDEDBATCHED/HAXPBYSTRIDEDBATCHED
+template <typename T>
+StatusCode AxpbyStridedBatched(const size_t n,
+                               const T alpha,
+                               const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                               const T beta,
+                               CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                               const size_t batch_count,
+                               const CUcontext context, const CUdevice device);
+
+// StridedBatched version of SET: SSETSTRIDEDBATCHED/DSETSTRIDEDBATCHED/CSETSTRIDEDBATCHED/ZSETSTRIDEDBATCHED/HSETSTRIDEDBATCHED
+template <typename T>
+StatusCode SetStridedBatched(const size_t n,
+                             const T alpha,
+                             CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                             const size_t batch_count,
+                             const CUcontext context, const CUdevice device);
+
+// StridedBatched version of SCAL: SSCALSTRIDEDBATCHED/DSCALSTRIDEDBATCHED/CSCALSTRIDEDBATCHED/ZSCALSTRIDEDBATCHED/HSCALSTRIDEDBATCHED
+template <typename T>
+StatusCode ScalStridedBatched(const size_t n,
+                              const T alpha,
+                              CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+template <typename T>
+StatusCode DotStridedBatched(const size_t n,
+                             CUdeviceptr dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                             const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                             const CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                             const size_t batch_count,
+                             const CUcontext context, const CUdevice device);
+
+// StridedBatched version of NRM2: SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+template <typename T>
+StatusCode Nrm2StridedBatched(const size_t n,
+                              CUdeviceptr nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                              const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// StridedBatched version of ASUM: SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+template <typename T>
+StatusCode AsumStridedBatched(const size_t n,
+                              CUdeviceptr asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                              const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
 // =================================================================================================
 
 // Retrieves the required size of the temporary buffer for the GEMM kernel (optional)
@@ -654,14 +907,140 @@ StatusCode GemmTempBufferSize(const Layout layout, const Transpose a_transpose,
 
 // =================================================================================================
 
+// Opaque handle to a recorded sequence of routine calls, see 'GraphBeginCapture' below
+class CommandGraph;
+
+// Starts capturing the routines called from this host thread on the given context into a command
+// graph (a CUDA graph): instead of being executed, their kernels are recorded together with their
+// arguments (including the scalars). Routines which operate on host data or read results back to
+// the host cannot be captured.
+StatusCode PUBLIC_API GraphBeginCapture(const CUcontext context, const CUdevice device);
+
+// Ends the capture on this host thread and context and returns the resulting command graph
+StatusCode PUBLIC_API GraphEndCapture(const CUcontext context, const CUdevice device,
+                                      CommandGraph** graph);
+
+// Replays a command graph as a single CUDA graph launch. The buffers used during the capture have
+// to be kept alive for as long as the graph is replayed.
+StatusCode PUBLIC_API GraphLaunch(CommandGraph* graph, const CUcontext context, const CUdevice device);
+
+// Releases a command graph and its resources
+StatusCode PUBLIC_API GraphDestroy(CommandGraph* graph);
+
+// =================================================================================================
+
+// Sets the priority of the CUDA streams on which the routines called from this host thread run, e.g.
+// a high priority for latency-critical routines next to background work on other threads. Lower
+// numbers are higher priorities, see 'cuCtxGetStreamPriorityRange'. The default is zero. See also
+// 'SetGemmChunkLimit'.
+StatusCode PUBLIC_API SetStreamPriority(const int priority);
+
+// =================================================================================================
+
+// Counters of CLBlast's internal activity since the start or since 'ResetStatistics', e.g. to check
+// the efficiency of the caches in production. The counters are cheap and always enabled.
+struct RoutineStatistics {
+  size_t num_calls;
+  size_t num_kernels; // launched by the routine itself, i.e. excluding nested routine calls
+  double host_time_ms; // the time spent on the host in the calls, including nested routine calls
+  double setup_time_ms; // of which: constructing the routine, i.e. database and program lookups
+  double kernel_time_ms; // of which: retrieving (or creating) the kernel objects
+  double launch_time_ms; // of which: checking and enqueueing the kernels
+};
+struct Statistics {
+  size_t program_cache_hits; // lookups of compiled programs per context
+  size_t program_cache_misses;
+  size_t binary_cache_hits; // lookups of compiled binaries per device
+  size_t binary_cache_misses;
+  size_t database_cache_hits; // lookups of kernel parameters per device
+  size_t database_cache_misses;
+  size_t kernel_cache_hits; // lookups of kernel objects per program and host thread
+  size_t kernel_cache_misses;
+  size_t num_compilations; // compilations from source, including the time they took
+  double compilation_time_ms;
+  double source_time_ms; // of which: assembling the kernel source
+  double preprocessing_time_ms; // of which: the built-in pre-processor (on some devices only)
+  double build_time_ms; // of which: the compiler of the OpenCL or CUDA driver
+  size_t num_binary_loads; // programs created from a cached binary (in memory or on disk) instead
+  double binary_load_time_ms;
+  double database_time_ms; // searching the parameters of a kernel for a device (cache misses)
+  size_t num_buffer_allocations; // newly allocated temporary buffers and their total size
+  size_t buffer_bytes_allocated;
+  size_t num_buffer_reuses; // temporary buffers re-used from the memory pool
+  std::unordered_map<std::string, RoutineStatistics> routines; // per routine name, e.g. "GEMM"
+};
+
+// Retrieves or resets the above statistics
+StatusCode PUBLIC_API GetStatistics(Statistics &statistics);
+StatusCode PUBLIC_API ResetStatistics();
+
+// =================================================================================================
+
 // CLBlast stores binaries of compiled kernels into a cache in case the same kernel is used later on
 // for the same device. This cache can be cleared to free up system memory or in case of debugging.
 StatusCode PUBLIC_API ClearCache();
 
+// Removes the compiled programs and the unused temporary buffers of a single context from the
+// caches, such that no references to the context are kept. Call this before releasing a context
+// if the application creates and releases many contexts, since otherwise the context is kept alive.
+StatusCode PUBLIC_API ClearContextCache(const CUcontext context);
+
+// Limits the number of compiled programs in the cache (zero for no limit, the default): beyond it,
+// the least-recently used programs are removed. The default is taken from the
+// 'CLBLAST_PROGRAM_CACHE_LIMIT' environmental variable (if set).
+StatusCode PUBLIC_API SetProgramCacheLimit(const size_t num_programs);
+
 // The cache can also be pre-initialized for a specific device with all possible CLBLast kernels.
-// Further CLBlast routine calls will then run at maximum speed.
+// Further CLBlast routine calls will then run at maximum speed. The kernels are compiled on multiple
+// threads, 'CLBLAST_NUM_COMPILE_THREADS' (if set) overrides the default of one per hardware thread.
 StatusCode PUBLIC_API FillCache(const CUdevice device);
 
+// As above, but only for a selection of routines (e.g. "GEMM" or "GEMMSTRIDEDBATCHED") and
+// precisions. Contrary to the above, this also supports half precision.
+StatusCode PUBLIC_API FillCache(const CUdevice device, const std::vector<std::string> &routines,
+                                const std::vector<Precision> &precisions);
+
+// As above, but returns immediately: the cache is filled in the background. Routine calls that need
+// a kernel which is being compiled at that moment wait for it rather than compiling it again.
+StatusCode PUBLIC_API FillCacheAsync(const CUdevice device);
+
+// Compiled binaries can additionally be stored in an on-disk cache, such that they survive the end
+// of the process and can be shared between multiple processes. This sets the directory to use (it
+// must exist already), an empty string disables the on-disk cache. The default is taken from the
+// 'CLBLAST_CACHE_DIR' environmental variable (if set). Note that 'ClearCache' leaves these files.
+StatusCode PUBLIC_API SetCacheDirectory(const std::string &directory);
+
+// Compiled binaries can also be packaged into a single cache file, e.g. to ship them with an
+// application such that no kernels have to be compiled at run-time (see the 'clblast_precompile'
+// tool). This saves all binaries compiled (or loaded) so far for the given devices into a file.
+StatusCode PUBLIC_API SaveCacheFile(const std::vector<CUdevice> &devices, const std::string &file_name);
+
+// Loads a cache file created by 'SaveCacheFile', whose binaries are then used instead of compiling
+// the kernels, as long as the platform, device, driver version and build options match. An empty
+// string removes the binaries again. The default is taken from the 'CLBLAST_CACHE_FILE' variable.
+StatusCode PUBLIC_API LoadCacheFile(const std::string &file_name);
+
+// Temporary buffers of the routines are taken from a pool of device memory, such that they are
+// re-used by later calls rather than allocated each time. This sets the maximum amount of unused
+// memory (in bytes) kept in the pool, zero disables pooling. The default is 256MB, or the value of
+// the 'CLBLAST_MEMORY_POOL_LIMIT' environmental variable (if set).
+StatusCode PUBLIC_API SetMemoryPoolLimit(const size_t bytes);
+
+// Releases all unused memory in the pool of temporary buffers
+StatusCode PUBLIC_API TrimMemoryPool();
+
+// The temporary buffers of a single GEMM call are bounded by a workspace limit (in bytes): larger
+// problems are computed in blocks of matrix C, each with smaller temporary buffers. Zero derives
+// the limit from the device: its maximum allocation size, up to a quarter of its memory. The
+// default is zero, or the value of the 'CLBLAST_GEMM_WORKSPACE_LIMIT' environmental variable.
+StatusCode PUBLIC_API SetGemmWorkspaceLimit(const size_t bytes);
+
+// Large GEMMs can also be computed in blocks of matrix C to bound the amount of work of a single
+// kernel (in multiply-adds), such that the device can run commands of other (e.g. high priority)
+// queues in between the blocks rather than after a long kernel. Zero disables this. The default is
+// zero, or the value of the 'CLBLAST_GEMM_CHUNK_LIMIT' environmental variable.
+StatusCode PUBLIC_API SetGemmChunkLimit(const size_t multiply_adds);
+
 // =================================================================================================
 
 // Retrieves current tuning parameters for a specific device-precision-kernel combination
@@ -675,6 +1054,32 @@ StatusCode PUBLIC_API OverrideParameters(const CUdevice device, const std::strin
                                          const Precision precision,
                                          const std::unordered_map<std::string,size_t> &parameters);
 
+// As 'OverrideParameters', but the parameters are only used for problems of at most 'max_size'
+// (and larger than the 'max_size' of any other size-specific override). For GEMM, the problem size
+// is the geometric mean of m, n, and k. Calling 'OverrideParameters' removes these overrides.
+StatusCode PUBLIC_API OverrideParametersForSize(const CUdevice device, const std::string &kernel_name,
+                                                const Precision precision, const size_t max_size,
+                                                const std::unordered_map<std::string,size_t> &parameters);
+
+// Loads additional database entries from a JSON file (see 'doc/tuning.md' for the format), which
+// are searched before the built-in database. This makes it possible to use tuning results for new
+// devices without rebuilding the library. Parameters looked up earlier are dropped (including those
+// set through 'OverrideParameters'), an empty string removes the loaded entries again. The default
+// file is taken from the 'CLBLAST_DATABASE_FILE' environmental variable (if set).
+StatusCode PUBLIC_API LoadDatabaseFile(const std::string &file_name);
+
+// Registers a GEMM shape used frequently by the application, e.g. one of the fixed shapes of a
+// neural network. GEMM calls with exactly this shape which use the indirect kernel then run it from
+// a program compiled for these sizes, such that they are compile-time constants rather than kernel
+// arguments. The program is compiled on first use and kept in the cache as any other program.
+StatusCode PUBLIC_API RegisterGemmShape(const CUdevice device, const Precision precision,
+                                        const Layout layout, const Transpose a_transpose,
+                                        const Transpose b_transpose,
+                                        const size_t m, const size_t n, const size_t k);
+
+// Removes all registered GEMM shapes, their programs stay in the cache until 'ClearCache'
+StatusCode PUBLIC_API ClearGemmShapes();
+
 // =================================================================================================
 
 } // namespace clblast
@@ -0,0 +1,60 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the interface to the optional distributed routines of CLBlast, built as the
+// separate 'clblast_distributed' library on top of MPI (CMake option -DDISTRIBUTED=ON). These use
+// the regular CLBlast routines as the local engine on each process.
+//
+// The matrices are distributed over a 2D grid of 'grid_rows' by 'grid_cols' processes in a 2D
+// block-cyclic way with square blocks of 'block_size', as in ScaLAPACK: the process of rank 'r' in
+// the communicator is at grid position (r / grid_cols, r % grid_cols), and it stores its local part
+// of each matrix in column-major order in a device buffer.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_CLBLAST_DISTRIBUTED_H_
+#define CLBLAST_CLBLAST_DISTRIBUTED_H_
+
+#include <mpi.h>
+
+#include "clblast.h"
+
+namespace clblast {
+// =================================================================================================
+
+// Computes the number of rows (or columns) of the local part of a block-cyclically distributed
+// dimension of 'size' on the process at grid coordinate 'proc' out of 'num_procs' (as ScaLAPACK's
+// NUMROC). This is the minimum leading dimension of the local column-major matrices.
+size_t NumLocal(const size_t size, const size_t block_size, const size_t proc,
+                const size_t num_procs);
+
+// Distributed GEMM with the SUMMA algorithm: C = alpha * A * B + beta * C, in which A is m by k, B
+// is k by n, and C is m by n, all column-major and distributed as described at the top of this
+// file. For each block column of A and block row of B, the owning processes broadcast their panels
+// along the process rows and columns, after which every process updates its local part of C with
+// the regular 'Gemm' routine on the given queue. The broadcasts of the next panels are pipelined
+// with the local computation on the current ones. This has to be called collectively by all
+// processes in the communicator and returns when the local part of C is updated. All processes
+// return the same status: an error on one of them (e.g. a leading dimension which is too small for
+// its local part) is returned by all.
+template <typename T>
+StatusCode GemmSumma(const size_t m, const size_t n, const size_t k,
+                     const T alpha,
+                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                     const T beta,
+                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                     const size_t block_size, const size_t grid_rows, const size_t grid_cols,
+                     MPI_Comm communicator, cl_command_queue* queue);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_CLBLAST_DISTRIBUTED_H_
+#endif
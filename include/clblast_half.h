@@ -7,9 +7,10 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file provides simple conversion operations between fp16 (half) and fp32 (float). These
-// conversion functions are based on ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf and
-// are also part of the C++ half-precision header (http://half.sourceforge.net/).
+// This file provides simple conversion operations between fp16 (half) and fp32 (float), as well as
+// between bfloat16 and fp32. The fp16 conversion functions are based on
+// ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf and are also part of the C++
+// half-precision header (http://half.sourceforge.net/).
 //
 // This file is pure C99.
 //
@@ -250,5 +251,37 @@ inline float HalfToFloat(const half value) {
 
 // =================================================================================================
 
+// The host data-type for bfloat16 ('brain' floating-point, 16-bit): the upper half of the bits of a
+// single-precision value (sign, 8 exponent bits and the 7 most significant mantissa bits). It is
+// wrapped in a struct to make it a distinct type from 'half'. The name is prefixed, since other
+// libraries (e.g. OpenBLAS) define a global 'bfloat16' type as well.
+typedef struct clblast_bfloat16_ {
+  unsigned short bits;
+} clblast_bfloat16;
+
+// Converts a IEEE-compliant single-precision value to bfloat16, using round-to-nearest-even as
+// rounding mode. NaN values are kept a (quiet) NaN.
+inline clblast_bfloat16 FloatToBFloat16(const float value) {
+  ConversionBits bits;
+  clblast_bfloat16 result;
+  bits.f32 = value;
+  if ((bits.i32 & 0x7FFFFFFF) > 0x7F800000) {
+    result.bits = (unsigned short)((bits.i32 >> 16) | 0x0040);
+  }
+  else {
+    result.bits = (unsigned short)((bits.i32 + 0x7FFF + ((bits.i32 >> 16) & 1)) >> 16);
+  }
+  return result;
+}
+
+// Converts a bfloat16 value to a IEEE-compliant single-precision value, which is exact
+inline float BFloat16ToFloat(const clblast_bfloat16 value) {
+  ConversionBits bits;
+  bits.i32 = ((unsigned int)value.bits) << 16;
+  return bits.f32;
+}
+
+// =================================================================================================
+
 // CLBLAST_HALF_H_
 #endif
@@ -16,6 +16,8 @@
 #ifndef CLBLAST_CLBLAST_NETLIB_C_H_
 #define CLBLAST_CLBLAST_NETLIB_C_H_
 
+#include <stddef.h> // for size_t
+
 // Exports library functions under Windows when building a DLL. See also:
 // https://msdn.microsoft.com/en-us/library/a90k134d.aspx
 #if defined(_WIN32) && defined(CLBLAST_DLL)
@@ -64,6 +66,24 @@ typedef CLBlastSide CBLAS_SIDE;
 #define CblasLeft CLBlastSideLeft
 #define CblasRight CLBlastSideRight
 
+// Retrieves the number of calls executed on the OpenCL device and on the host (by the CPU BLAS
+// library set through the 'CLBLAST_NETLIB_HOST_LIBRARY' environmental variable) respectively
+void PUBLIC_API clblast_netlib_get_call_counts(size_t* device_calls, size_t* host_calls);
+void PUBLIC_API clblast_netlib_reset_call_counts(void);
+
+// Enables (non-zero) or disables (zero) the asynchronous mode. In this mode the routines return as
+// soon as the work is enqueued: the host arrays should not be touched until 'clblast_netlib_sync'
+// has been called. Routines returning a scalar value always complete before returning.
+void PUBLIC_API clblast_netlib_set_async(const int enabled);
+void PUBLIC_API clblast_netlib_sync(void);
+
+// Enables (non-zero) or disables (zero) the residency cache, which keeps the device copies of host
+// arrays alive between calls. After modifying an array on the host, the application has to call
+// 'clblast_netlib_invalidate' (or '_all') before passing it to a routine again.
+void PUBLIC_API clblast_netlib_set_residency(const int enabled);
+void PUBLIC_API clblast_netlib_invalidate(const void* host, const size_t bytes);
+void PUBLIC_API clblast_netlib_invalidate_all(void);
+
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
 // =================================================================================================
@@ -924,6 +944,42 @@ void PUBLIC_API cblas_zhad(const int n,
                            const void* beta,
                            void* z, const int z_inc);
 
+// Scaling and addition of two vectors (non-BLAS function): SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+void PUBLIC_API cblas_saxpby(const int n,
+                             const float alpha,
+                             const float* x, const int x_inc,
+                             const float beta,
+                             float* y, const int y_inc);
+void PUBLIC_API cblas_daxpby(const int n,
+                             const double alpha,
+                             const double* x, const int x_inc,
+                             const double beta,
+                             double* y, const int y_inc);
+void PUBLIC_API cblas_caxpby(const int n,
+                             const void* alpha,
+                             const void* x, const int x_inc,
+                             const void* beta,
+                             void* y, const int y_inc);
+void PUBLIC_API cblas_zaxpby(const int n,
+                             const void* alpha,
+                             const void* x, const int x_inc,
+                             const void* beta,
+                             void* y, const int y_inc);
+
+// Sets all elements of a vector to a scalar value (non-BLAS function): SSET/DSET/CSET/ZSET/HSET
+void PUBLIC_API cblas_sset(const int n,
+                           const float alpha,
+                           float* x, const int x_inc);
+void PUBLIC_API cblas_dset(const int n,
+                           const double alpha,
+                           double* x, const int x_inc);
+void PUBLIC_API cblas_cset(const int n,
+                           const void* alpha,
+                           void* x, const int x_inc);
+void PUBLIC_API cblas_zset(const int n,
+                           const void* alpha,
+                           void* x, const int x_inc);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 void PUBLIC_API cblas_somatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                                 const int m, const int n,
@@ -960,6 +1016,48 @@ void PUBLIC_API cblas_zim2col(const int channels, const int height, const int wi
                               const void* im,
                               void* col);
 
+// Col2im function (non-BLAS function): SCOL2IM/DCOL2IM/CCOL2IM/ZCOL2IM/HCOL2IM
+void PUBLIC_API cblas_scol2im(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w,
+                              const float* col,
+                              float* im);
+void PUBLIC_API cblas_dcol2im(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w,
+                              const double* col,
+                              double* im);
+void PUBLIC_API cblas_ccol2im(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w,
+                              const void* col,
+                              void* im);
+void PUBLIC_API cblas_zcol2im(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w,
+                              const void* col,
+                              void* im);
+
+// Fused dot product, Euclidian norm and absolute sum (non-BLAS function): SDOTNRM2ASUM/DDOTNRM2ASUM/HDOTNRM2ASUM
+void PUBLIC_API cblas_sdotnrm2asum(const int n,
+                                   const float* x, const int x_inc,
+                                   const float* y, const int y_inc,
+                                   float* results);
+void PUBLIC_API cblas_ddotnrm2asum(const int n,
+                                   const double* x, const int x_inc,
+                                   const double* y, const int y_inc,
+                                   double* results);
+
+// Batched convolution as GEMM (non-BLAS function): SCONVGEMM/DCONVGEMM/HCONVGEMM
+void PUBLIC_API cblas_sconvgemm(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w, const int num_kernels, const int batch_count,
+                                const float* im,
+                                const float* kernel,
+                                float* result);
+void PUBLIC_API cblas_dconvgemm(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w, const int num_kernels, const int batch_count,
+                                const double* im,
+                                const double* kernel,
+                                double* result);
+
+// Cholesky factorisation (non-BLAS function): SPOTRF/DPOTRF
+void PUBLIC_API cblas_spotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                             const int n,
+                             float* a, const int a_ld);
+void PUBLIC_API cblas_dpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                             const int n,
+                             double* a, const int a_ld);
+
 // =================================================================================================
 
 #ifdef __cplusplus
@@ -22,6 +22,7 @@ EXPERIMENTS = {
     "gemm": settings.GEMM,
     "gemm_small": settings.GEMM_SMALL,
     "gemmbatched": settings.GEMMBATCHED,
+    "gemmbatched_sweep": settings.GEMMBATCHED_SWEEP,
     "gemmstridedbatched": settings.GEMMSTRIDEDBATCHED,
     "symm": settings.SYMM,
     "syrk": settings.SYRK,
@@ -33,7 +34,7 @@ COMPARISON_ARGS = ["-clblas", "-cblas", "-cublas"]
 COMPARISON_IDS = [2, 3, 4]
 
 
-def run_benchmark(name, arguments_list, precision, num_runs, platform, device, comparisons):
+def run_benchmark(name, arguments_list, precision, num_runs, platform, device, comparisons, peak_arguments):
     binary = "./clblast_client_x" + name
 
     # Loops over sub-benchmarks per benchmark
@@ -50,7 +51,7 @@ def run_benchmark(name, arguments_list, precision, num_runs, platform, device, c
                 comparison_arguments.append(arg + " 1")
             else:
                 comparison_arguments.append(arg + " 0")
-        all_arguments = opencl_arguments + common_arguments + constant_arguments + comparison_arguments
+        all_arguments = opencl_arguments + common_arguments + constant_arguments + comparison_arguments + peak_arguments
         for name, value in arguments.items():
             all_arguments.append("-" + name + " " + str(value))
 
@@ -75,6 +76,28 @@ def run_benchmark(name, arguments_list, precision, num_runs, platform, device, c
     return results
 
 
+def run_series(series, arguments_list, precision, num_runs, platform, device, peak_arguments):
+    """Runs the same arguments on the client of each series and merges the results per point, with the keys of the
+    i-th series suffixed by i+1 (as for the libraries). A 'loop' series runs the non-batched client on one matrix and
+    stands for a loop of 'batch_num' such calls, each with its own launch and synchronisation. Per point, the arguments
+    are kept for the x-axis and the latency per matrix in microseconds is added."""
+    results = [dict(arguments) for arguments in arguments_list]
+    for series_id, serie in enumerate(series, start=1):
+        loop = serie.get("loop", False)
+        arguments_serie = [{name: value for name, value in arguments.items() if not (loop and name == "batch_num")}
+                           for arguments in arguments_list]
+        result = run_benchmark(serie["name"], arguments_serie, precision, num_runs, platform, device, [],
+                               peak_arguments)
+        for index in range(min(len(result), len(results))):
+            batch_num = arguments_list[index].get("batch_num", 1)
+            time_ms = result[index]["ms_1"] * batch_num if loop else result[index]["ms_1"]
+            results[index]["ms_%d" % series_id] = time_ms
+            results[index]["GFLOPS_%d" % series_id] = result[index]["GFLOPS_1"]
+            results[index]["GBs_%d" % series_id] = result[index]["GBs_1"]
+            results[index]["us_per_matrix_%d" % series_id] = 1000.0 * time_ms / batch_num
+    return results
+
+
 def parse_arguments(argv):
     parser = argparse.ArgumentParser(description="Runs a full benchmark for a specific routine on a specific device")
     parser.add_argument("-b", "--benchmark", required=True, help="The benchmark to perform (choose from %s)" % sorted(EXPERIMENTS.keys()))
@@ -88,12 +111,27 @@ def parse_arguments(argv):
     parser.add_argument("-z", "--tight_plot", action="store_true", help="Enables tight plot layout for in paper or presentation")
     parser.add_argument("-o", "--output_folder", default=os.getcwd(), help="Sets the folder for output plots (defaults to current folder)")
     parser.add_argument("-v", "--verbose", action="store_true", help="Increase verbosity of the script")
+    parser.add_argument("-r", "--roofline", action="store_true", help="Also plots the results in a roofline plot")
+    parser.add_argument("--peak_gflops", type=float, default=0, help="The peak GFLOPS of the device (default: estimated)")
+    parser.add_argument("--peak_gbs", type=float, default=0, help="The peak GB/s of the device (default: estimated)")
     cl_args = parser.parse_args(argv)
     return vars(cl_args)
 
 
+def get_peak(results, library_ids, metric_key, percentage_key):
+    """Retrieves a device peak from the results as reported by the clients: the metric over its percentage"""
+    for result in results:
+        for r in result:
+            for library_id in library_ids:
+                metric = r.get("%s_%d" % (metric_key, library_id), 0)
+                percentage = r.get("%s_%d" % (percentage_key, library_id), 0)
+                if metric > 0 and percentage > 0:
+                    return 100.0 * metric / percentage
+    return 0
+
+
 def benchmark_single(benchmark, comparisons, platform, device, num_runs, precision, load_from_disk,
-                     plot_title, tight_plot, output_folder, verbose):
+                     plot_title, tight_plot, output_folder, verbose, roofline=False, peak_gflops=0, peak_gbs=0):
 
     # Sanity check
     if not os.path.isdir(output_folder):
@@ -120,6 +158,17 @@ def benchmark_single(benchmark, comparisons, platform, device, num_runs, precisi
     experiment = EXPERIMENTS[benchmark]
     benchmarks = experiment["benchmarks"]
 
+    # Experiments with series compare CLBlast clients against each other rather than against other libraries
+    series = experiment.get("series", None)
+    if series is not None:
+        if len(comparisons) > 0:
+            print("[benchmark] Ignoring the comparison libraries for benchmark '%s'" % benchmark)
+        comparisons = []
+        library_ids = list(range(1, len(series) + 1))
+        if precision == 16:
+            print("[benchmark] Half-precision is not supported for benchmark '%s'" % benchmark)
+            return
+
     # Either run the benchmarks for this experiment or load old results from disk
     json_file_name = os.path.join(output_folder, benchmark_name.lower() + "_benchmarks.json")
     if load_from_disk and os.path.isfile(json_file_name):
@@ -131,13 +180,27 @@ def benchmark_single(benchmark, comparisons, platform, device, num_runs, precisi
         # Runs all the individual benchmarks
         print("[benchmark] Running on platform %d, device %d" % (platform, device))
         print("[benchmark] Running %d benchmarks for settings '%s'" % (len(benchmarks), benchmark))
-        results = {"label_names": ["CLBlast"] + comparisons, "num_rows": experiment["num_rows"],
+        label_names = ["CLBlast"] + comparisons if series is None else [serie["label"] for serie in series]
+        results = {"label_names": label_names, "num_rows": experiment["num_rows"],
                    "num_cols": experiment["num_cols"], "benchmarks": []}
+        peak_arguments = []
+        if peak_gflops > 0:
+            peak_arguments.append("-peak_gflops %f" % peak_gflops)
+        if peak_gbs > 0:
+            peak_arguments.append("-peak_gbs %f" % peak_gbs)
+        series_results = {}  # the same series are often plotted more than once, e.g. for another metric
         for bench in benchmarks:
             num_runs_benchmark = bench["num_runs"] if num_runs is None else num_runs
             print("[benchmark] Running benchmark '%s:%s'" % (bench["name"], bench["title"]))
-            result = run_benchmark(bench["name"], bench["arguments"], precision, num_runs_benchmark,
-                                   platform, device, comparisons)
+            if series is None:
+                result = run_benchmark(bench["name"], bench["arguments"], precision, num_runs_benchmark,
+                                       platform, device, comparisons, peak_arguments)
+            else:
+                series_key = json.dumps([bench["arguments"], num_runs_benchmark], sort_keys=True)
+                if series_key not in series_results:
+                    series_results[series_key] = run_series(series, bench["arguments"], precision,
+                                                            num_runs_benchmark, platform, device, peak_arguments)
+                result = series_results[series_key]
             results["benchmarks"].append(result)
 
         # Stores the results to disk
@@ -175,6 +238,20 @@ def benchmark_single(benchmark, comparisons, platform, device, num_runs, precisi
                      x_keys, y_keys, titles, x_labels, y_labels,
                      label_names, plot_title, tight_plot, verbose)
 
+    # Optionally plots the results against the roofline of the device, with the peaks as given or as reported by the
+    # clients (a percentage of the peak for CLBlast and each comparison library)
+    if roofline:
+        if peak_gflops == 0:
+            peak_gflops = get_peak(results["benchmarks"], library_ids, "GFLOPS", "%peak")
+        if peak_gbs == 0:
+            peak_gbs = get_peak(results["benchmarks"], library_ids, "GBs", "%bw")
+        if peak_gflops == 0 or peak_gbs == 0:
+            print("[benchmark] Unknown device peaks, specify '--peak_gflops' and '--peak_gbs' for a roofline plot")
+        else:
+            roofline_file_name = os.path.join(output_folder, benchmark_name.lower() + "_roofline.pdf")
+            plot.plot_roofline(results["benchmarks"], roofline_file_name, peak_gflops, peak_gbs, library_ids,
+                               results["label_names"], titles, plot_title)
+
     print("[benchmark] All done")
 
 
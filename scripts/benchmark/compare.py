@@ -0,0 +1,236 @@
+#!/usr/bin/env python
+
+# This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This file follows the
+# PEP8 Python style guide and uses a max-width of 120 characters per line.
+#
+# Author(s):
+#   Cedric Nugteren <www.cedricnugteren.nl>
+#
+# Compares the performance of two configurations 'A' and 'B' of CLBlast on the same device: two builds of the library
+# (a folder with 'libclblast' each) and/or two database files (see 'CLBLAST_DATABASE_FILE'). It runs the clients of
+# the benchmarks in 'settings.py' and/or replays a record of calls with 'clblast_bench_replay'. The runs of A and B
+# are interleaved in a random order per round, such that drift of the device (e.g. its temperature) affects both. Each
+# round gives a sample per routine and shape, which are compared with a Mann-Whitney U test: a change is reported
+# as a speed-up or a regression only if it is both significant and larger than a threshold.
+
+import argparse
+import csv
+import json
+import math
+import os
+import random
+import sys
+
+import utils
+from benchmark import EXPERIMENTS
+
+METRIC_PREFIXES = ["ms_", "GFLOPS_", "GBs_", "%peak_", "%bw_"]
+
+
+def get_environment(library_folder, database_file):
+    """Returns the environment of a configuration: the folder with the library is searched first"""
+    env = dict(os.environ)
+    if library_folder:
+        for variable in ["LD_LIBRARY_PATH", "DYLD_LIBRARY_PATH", "PATH"]:
+            paths = [os.path.abspath(library_folder)] + ([env[variable]] if env.get(variable) else [])
+            env[variable] = os.pathsep.join(paths)
+    if database_file:
+        env["CLBLAST_DATABASE_FILE"] = os.path.abspath(database_file)
+    return env
+
+
+def get_client_invocations(benchmarks, precision, num_runs, platform, device):
+    """Returns the unique client calls of the benchmarks as (routine, binary, arguments)"""
+    invocations = []
+    for benchmark in benchmarks:
+        experiment = EXPERIMENTS[benchmark]
+        if "series" in experiment:
+            print("[compare] Skipping benchmark '%s': its series aren't supported" % benchmark)
+            continue
+        for bench in experiment["benchmarks"]:
+            for arguments in bench["arguments"]:
+                all_arguments = ["-platform %d" % platform, "-device %d" % device, "-precision %d" % precision,
+                                 "-runs %d" % num_runs, "-warm_up", "-q", "-no_abbrv",
+                                 "-clblas 0", "-cblas 0", "-cublas 0"]
+                all_arguments += ["-%s %s" % (name, value) for name, value in sorted(arguments.items())]
+                invocation = (bench["name"], "./clblast_client_x" + bench["name"], all_arguments)
+                if invocation not in invocations:
+                    invocations.append(invocation)
+    return invocations
+
+
+def parse_client_results(routine, output):
+    """Returns the time in ms per shape from the output of a client, keyed by routine and the other columns"""
+    samples = {}
+    for result in utils.parse_results(output):
+        if "ms_1" not in result:
+            continue
+        shape = " ".join("%s=%s" % (name, value) for name, value in sorted(result.items())
+                         if not any(name.startswith(prefix) for prefix in METRIC_PREFIXES))
+        samples[routine + " " + shape] = result["ms_1"]
+    return samples
+
+
+def parse_replay_results(output):
+    """Returns the mean time in ms per shape from the breakdown of the replay benchmark"""
+    lines = output.split("\n")
+    header = [index for index, line in enumerate(lines) if line.strip().startswith("routine;")]
+    if len(header) == 0:
+        return {}
+    samples = {}
+    for result in csv.DictReader(lines[header[0]:], delimiter=";", skipinitialspace=True):
+        if result.get("mean_ms") is None or result.get("shape") is None:
+            continue
+        key = "%s %s %s" % (result["routine"], utils.precision_to_letter(int(result["precision"])), result["shape"])
+        samples[key] = float(result["mean_ms"])
+    return samples
+
+
+def mann_whitney_u(samples_a, samples_b):
+    """Two-sided Mann-Whitney U test with the normal approximation and a correction for ties, returns the p-value"""
+    n_a = len(samples_a)
+    n_b = len(samples_b)
+    if n_a == 0 or n_b == 0:
+        return 1.0
+    values = sorted([(v, 0) for v in samples_a] + [(v, 1) for v in samples_b])
+    ranks = [0.0] * len(values)
+    tie_correction = 0.0
+    start = 0
+    while start < len(values):
+        end = start
+        while end + 1 < len(values) and values[end + 1][0] == values[start][0]:
+            end += 1
+        for index in range(start, end + 1):
+            ranks[index] = (start + end) / 2.0 + 1.0
+        num_ties = end - start + 1
+        tie_correction += num_ties ** 3 - num_ties
+        start = end + 1
+    rank_sum_a = sum(rank for rank, value in zip(ranks, values) if value[1] == 0)
+    u_a = rank_sum_a - n_a * (n_a + 1) / 2.0
+    n = n_a + n_b
+    variance = n_a * n_b / 12.0 * ((n + 1) - tie_correction / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0
+    z = (abs(u_a - n_a * n_b / 2.0) - 0.5) / math.sqrt(variance)  # with continuity correction
+    return min(1.0, math.erfc(max(z, 0.0) / math.sqrt(2.0)))
+
+
+def median(values):
+    values = sorted(values)
+    middle = len(values) // 2
+    return values[middle] if len(values) % 2 else (values[middle - 1] + values[middle]) / 2.0
+
+
+def compare(samples, alpha, threshold):
+    """Returns per shape the medians, the speed-up of B over A, the p-value and the verdict"""
+    comparisons = []
+    for key in sorted(samples.keys()):
+        samples_a = samples[key]["A"]
+        samples_b = samples[key]["B"]
+        if len(samples_a) == 0 or len(samples_b) == 0:
+            continue
+        median_a = median(samples_a)
+        median_b = median(samples_b)
+        speed_up = median_a / median_b if median_b > 0 else 0.0
+        p_value = mann_whitney_u(samples_a, samples_b)
+        verdict = "same"
+        if p_value < alpha and speed_up > 1.0 + threshold:
+            verdict = "faster"
+        elif p_value < alpha and speed_up > 0 and speed_up < 1.0 / (1.0 + threshold):
+            verdict = "slower"
+        comparisons.append({"shape": key, "median_ms_a": median_a, "median_ms_b": median_b, "speed_up": speed_up,
+                            "p_value": p_value, "verdict": verdict,
+                            "num_samples_a": len(samples_a), "num_samples_b": len(samples_b)})
+    return comparisons
+
+
+def parse_arguments(argv):
+    parser = argparse.ArgumentParser(description="Compares the performance of two configurations of CLBlast, two "
+                                                 "library builds and/or two database files, on a single device")
+    parser.add_argument("-b", "--benchmarks", default=[], nargs='+', help="The client benchmarks to run (choose from %s)" % sorted(EXPERIMENTS.keys()))
+    parser.add_argument("--record", default="", help="A record of calls to replay with 'clblast_bench_replay'")
+    parser.add_argument("-p", "--platform", required=True, type=int, help="The ID of the OpenCL platform to test on")
+    parser.add_argument("-d", "--device", required=True, type=int, help="The ID of the OpenCL device to test on")
+    parser.add_argument("--library_a", default="", help="The folder with the library of configuration A")
+    parser.add_argument("--library_b", default="", help="The folder with the library of configuration B")
+    parser.add_argument("--database_a", default="", help="The database file of configuration A")
+    parser.add_argument("--database_b", default="", help="The database file of configuration B")
+    parser.add_argument("-r", "--num_rounds", type=int, default=10, help="The number of interleaved rounds, i.e. samples per shape")
+    parser.add_argument("-n", "--num_runs", type=int, default=5, help="The number of repeats per client call or replay")
+    parser.add_argument("-x", "--precision", type=int, default=32, help="The precision of the clients (choose from 16, 32, 64, 3232, 6464")
+    parser.add_argument("--alpha", type=float, default=0.01, help="The significance level of the test per shape")
+    parser.add_argument("--threshold", type=float, default=0.02, help="The minimum relative change to be reported")
+    parser.add_argument("--seed", type=int, default=42, help="The seed of the random order of A and B per round")
+    parser.add_argument("-o", "--output_file", default="", help="Optionally stores the comparison as JSON")
+    parser.add_argument("--fail_on_regression", action="store_true", help="Exits with an error code on a regression")
+    cl_args = parser.parse_args(argv)
+    return vars(cl_args)
+
+
+def compare_configurations(benchmarks, record, platform, device, library_a, library_b, database_a, database_b,
+                           num_rounds, num_runs, precision, alpha, threshold, seed, output_file, fail_on_regression):
+
+    # Sanity checks
+    for benchmark in benchmarks:
+        if benchmark not in EXPERIMENTS.keys():
+            print("[compare] Invalid benchmark '%s', choose from %s" % (benchmark, sorted(EXPERIMENTS.keys())))
+            return 1
+    if len(benchmarks) == 0 and record == "":
+        print("[compare] Nothing to compare, specify '--benchmarks' and/or '--record'")
+        return 1
+    if library_a == library_b and database_a == database_b:
+        print("[compare] Warning: configurations A and B are the same")
+
+    # The calls to perform per configuration: the clients and/or the replay
+    environments = {"A": get_environment(library_a, database_a), "B": get_environment(library_b, database_b)}
+    invocations = get_client_invocations(benchmarks, precision, num_runs, platform, device)
+    if record != "":
+        replay_arguments = ["-platform %d" % platform, "-device %d" % device, "-runs %d" % num_runs,
+                            "-warm_up", "-record %s" % os.path.abspath(record)]
+        invocations.append(("replay", "./clblast_bench_replay", replay_arguments))
+
+    # Runs all calls for a number of rounds, A and B directly after each other in a random order
+    random.seed(seed)
+    samples = {}
+    for round_id in range(num_rounds):
+        print("[compare] Round %d of %d" % (round_id + 1, num_rounds))
+        for routine, binary, arguments in invocations:
+            configurations = ["A", "B"]
+            random.shuffle(configurations)
+            for configuration in configurations:
+                output = utils.run_binary(binary, arguments, environments[configuration])
+                if not output:
+                    continue
+                if routine == "replay":
+                    result = parse_replay_results(output)
+                else:
+                    result = parse_client_results(routine, output)
+                for key, time_ms in result.items():
+                    samples.setdefault(key, {"A": [], "B": []})[configuration].append(time_ms)
+
+    # Reports the speed-ups and regressions per routine and shape
+    comparisons = compare(samples, alpha, threshold)
+    print("")
+    print("%8s;%12s;%12s;%9s;%9s; %s" % ("verdict", "median_ms_A", "median_ms_B", "speed-up", "p-value", "shape"))
+    for c in comparisons:
+        print("%8s;%12.4f;%12.4f;%9.3f;%9.4f; %s" % (c["verdict"], c["median_ms_a"], c["median_ms_b"],
+                                                     c["speed_up"], c["p_value"], c["shape"]))
+    num_faster = len([c for c in comparisons if c["verdict"] == "faster"])
+    num_slower = len([c for c in comparisons if c["verdict"] == "slower"])
+    print("")
+    print("[compare] B is faster than A for %d shape(s) and slower for %d shape(s) out of %d" %
+          (num_faster, num_slower, len(comparisons)))
+
+    # Optionally stores the results to disk
+    if output_file != "":
+        print("[compare] Saving the comparison to '" + output_file + "'")
+        with open(output_file, "w") as f:
+            json.dump({"library_a": library_a, "library_b": library_b, "database_a": database_a,
+                       "database_b": database_b, "alpha": alpha, "threshold": threshold,
+                       "comparisons": comparisons}, f, sort_keys=True, indent=4)
+    return 1 if fail_on_regression and num_slower > 0 else 0
+
+
+if __name__ == '__main__':
+    parsed_arguments = parse_arguments(sys.argv[1:])
+    sys.exit(compare_configurations(**parsed_arguments))
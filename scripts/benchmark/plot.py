@@ -132,3 +132,47 @@ def plot_graphs(results, file_name, num_rows, num_cols,
     # Saves the plot to disk
     print("[benchmark] Saving plot to '" + file_name + "'")
     fig.savefig(file_name, bbox_inches=bounding_box)
+
+
+def plot_roofline(results, file_name, peak_gflops, peak_gbs, library_ids, label_names, titles, title):
+    assert len(titles) == len(results)
+    assert len(label_names) >= len(library_ids)
+
+    # Initializes the plot: a single log-log graph of performance versus arithmetic intensity
+    rcParams.update({'font.size': 15})
+    fig, ax = plt.subplots(figsize=(10, 8), facecolor='w', edgecolor='k')
+    ax.set_xscale("log")
+    ax.set_yscale("log")
+    ax.set_title(title)
+    ax.set_xlabel("arithmetic intensity (FLOPs per byte)")
+    ax.set_ylabel("GFLOPS (higher is better)")
+
+    # Plots the measurements: a colour per sub-benchmark and a marker per library
+    intensities = []
+    markers = ["o", "x", ".", "+"]
+    for index, result in enumerate(results):
+        color = plt.cm.tab10(index % 10)
+        for library_index, library_id in enumerate(library_ids):
+            gflops_key = "GFLOPS_%d" % library_id
+            gbs_key = "GBs_%d" % library_id
+            points = [(r[gflops_key] / r[gbs_key], r[gflops_key]) for r in result
+                      if gflops_key in r.keys() and gbs_key in r.keys() and r[gbs_key] > 0 and r[gflops_key] > 0]
+            if len(points) == 0:
+                continue
+            intensities.extend([p[0] for p in points])
+            label = titles[index] + " (" + label_names[library_index] + ")"
+            ax.plot([p[0] for p in points], [p[1] for p in points], markers[library_index % len(markers)],
+                    label=label, color=color)
+
+    # Plots the roofline itself: the bandwidth slope up to the ridge point, then the compute peak
+    ridge_point = peak_gflops / peak_gbs
+    x_min = min(intensities + [ridge_point]) / 2
+    x_max = max(intensities + [ridge_point]) * 2
+    ax.plot([x_min, ridge_point, x_max], [x_min * peak_gbs, peak_gflops, peak_gflops], "-",
+            color="black", label="roofline (%.0f GFLOPS, %.0f GB/s)" % (peak_gflops, peak_gbs))
+
+    # Sets the legend and saves the plot to disk
+    leg = ax.legend(loc="lower right", fontsize=9)
+    leg.draw_frame(False)
+    print("[benchmark] Saving roofline plot to '" + file_name + "'")
+    fig.savefig(file_name)
@@ -277,6 +277,70 @@ GEMMSTRIDEDBATCHED = {
     ]
 }
 
+# Compares the pointer-offset and the strided batched APIs against a loop of non-batched calls, each as a series
+# (see 'run_series' in benchmark.py), on throughput (top row) and on latency per matrix (bottom row)
+GEMMBATCHED_SWEEP_SERIES = [
+    {"name": "gemmbatched", "label": "GemmBatched"},
+    {"name": "gemmstridedbatched", "label": "GemmStridedBatched"},
+    {"name": "gemm", "label": "loop of Gemm", "loop": True},
+]
+GEMMBATCHED_SWEEP_ARGUMENTS = [
+    [{"batch_num": b, "m": 16, "n": 16, "k": 16, "layout": 102,
+      "transA": 111, "transB": 111} for b in utils.powers_of_2(1, utils.k(128))],
+    [{"batch_num": b, "m": 64, "n": 64, "k": 64, "layout": 102,
+      "transA": 111, "transB": 111} for b in utils.powers_of_2(1, utils.k(8))],
+    [{"batch_num": 256, "m": s, "n": s, "k": s, "layout": 102,
+      "transA": 111, "transB": 111} for s in utils.powers_of_2(4, 256)],
+]
+GEMMBATCHED_SWEEP = {
+    "num_rows": 2, "num_cols": 3,
+    "series": GEMMBATCHED_SWEEP_SERIES,
+    "benchmarks": [
+        {
+            "name": "gemmbatched", "num_runs": 10,
+            "title": "m=n=k=16",
+            "x_label": "num GEMMs", "x_keys": ["batch_num"],
+            "y_label": "GFLOPS (higher is better)", "y_key": "GFLOPS",
+            "arguments": GEMMBATCHED_SWEEP_ARGUMENTS[0],
+        },
+        {
+            "name": "gemmbatched", "num_runs": 10,
+            "title": "m=n=k=64",
+            "x_label": "num GEMMs", "x_keys": ["batch_num"],
+            "y_label": "GFLOPS (higher is better)", "y_key": "GFLOPS",
+            "arguments": GEMMBATCHED_SWEEP_ARGUMENTS[1],
+        },
+        {
+            "name": "gemmbatched", "num_runs": 10,
+            "title": "num GEMMs = 256",
+            "x_label": "sizes (m=n=k)", "x_keys": ["m"],
+            "y_label": "GFLOPS (higher is better)", "y_key": "GFLOPS",
+            "arguments": GEMMBATCHED_SWEEP_ARGUMENTS[2],
+        },
+        {
+            "name": "gemmbatched", "num_runs": 10,
+            "title": "m=n=k=16",
+            "x_label": "num GEMMs", "x_keys": ["batch_num"],
+            "y_label": "us per matrix (lower is better)", "y_key": "us_per_matrix",
+            "arguments": GEMMBATCHED_SWEEP_ARGUMENTS[0],
+        },
+        {
+            "name": "gemmbatched", "num_runs": 10,
+            "title": "m=n=k=64",
+            "x_label": "num GEMMs", "x_keys": ["batch_num"],
+            "y_label": "us per matrix (lower is better)", "y_key": "us_per_matrix",
+            "arguments": GEMMBATCHED_SWEEP_ARGUMENTS[1],
+        },
+        {
+            "name": "gemmbatched", "num_runs": 10,
+            "title": "num GEMMs = 256",
+            "x_label": "sizes (m=n=k)", "x_keys": ["m"],
+            "y_label": "us per matrix (lower is better)", "y_key": "us_per_matrix",
+            "arguments": GEMMBATCHED_SWEEP_ARGUMENTS[2],
+        }
+    ]
+}
+
 SYMM = {
     "num_rows": 2, "num_cols": 3,
     "benchmarks": [
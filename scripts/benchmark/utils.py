@@ -46,11 +46,12 @@ def precision_to_letter(precision):
         return "X"
 
 
-def run_binary(command, arguments):
+def run_binary(command, arguments, env=None):
     full_command = command + " " + " ".join(arguments)
     print("[benchmark] Calling binary: %s" % str(full_command))
     try:
-        return subprocess.Popen(full_command, shell=True, stdout=subprocess.PIPE).stdout.read()
+        return subprocess.Popen(full_command, shell=True, stdout=subprocess.PIPE, env=env,
+                                universal_newlines=True).stdout.read()
     except OSError as e:
         print("[benchmark] Error while running the binary, got exception: %s" + str(e))
         return False
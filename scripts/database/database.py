@@ -95,11 +95,16 @@ def main(argv):
     parser.add_argument("--add_tuning_parameter", type=str, default=None, help="Adds this parameter to existing entries")
     parser.add_argument("--add_tuning_parameter_for_kernel", type=str, default=None, help="Adds the above parameter for this kernel")
     parser.add_argument("--add_tuning_parameter_value", type=int, default=0, help="Set this value as the default for the above parameter")
+    parser.add_argument("--json_output", type=str, default=None, help="Also stores the database in this JSON file, which can be loaded at run-time")
+    parser.add_argument("--objective", type=str, default="time", choices=["time", "energy"],
+                        help="Processes the tuning results of this objective, those for 'energy' only to the JSON file")
     parser.add_argument("-v", "--verbose", action="store_true", help="Increase verbosity of the script")
     cl_args = parser.parse_args(argv)
 
-    # Parses the path arguments
-    database_filename = os.path.join(cl_args.clblast_root, "scripts", "database", "database.json")
+    # Parses the path arguments. Results tuned for energy are kept in a separate database, which is
+    # not built into the library but only stored as a JSON file to load at run-time.
+    database_name = "database.json" if cl_args.objective == "time" else "database_energy.json"
+    database_filename = os.path.join(cl_args.clblast_root, "scripts", "database", database_name)
     database_best_filename = os.path.join(cl_args.clblast_root, "scripts", "database", "database_best.json")
     json_files = os.path.join(cl_args.source_folder, "*.json")
     cpp_database_path = os.path.join(cl_args.clblast_root, "src", "database", "kernels")
@@ -111,8 +116,12 @@ def main(argv):
                            "' does not point to the root of the CLBlast library")
     if len(glob.glob(json_files)) < 1:
         print("[database] The path '" + cl_args.source_folder + "' does not contain any JSON files")
+    if cl_args.objective != "time" and cl_args.json_output is None:
+        raise RuntimeError("The '" + cl_args.objective + "' objective requires the '--json_output' argument")
 
-    # Downloads the database if a local copy is not present
+    # Downloads the database if a local copy is not present, the energy database starts empty
+    if cl_args.objective != "time" and not os.path.isfile(database_filename):
+        io.save_database({"sections": []}, database_filename)
     if not os.path.isfile(database_filename):
         io.download_database(database_filename, DATABASE_SERVER_URL)
 
@@ -127,6 +136,16 @@ def main(argv):
             # Loads the newly imported data
             imported_data = io.load_tuning_results(file_json)
 
+            # Size-specific tuning results are not part of the database, see 'OverrideParametersForSize'
+            if "size_bucket" in imported_data:
+                print("--- tuned for a specific problem size, skipping")
+                continue
+
+            # Results tuned for another objective belong to another database
+            if imported_data.pop("objective", "time") != cl_args.objective:
+                print("--- tuned for another objective, skipping")
+                continue
+
             # Adds the new data to the database
             old_size = db.length(database)
             database = db.add_section(database, imported_data)
@@ -174,9 +193,20 @@ def main(argv):
     if cl_args.verbose:
         io.save_database(database_best_results, database_best_filename)
 
-    # Outputs the database as a C++ database
-    print("[database] Producing a C++ database in '" + cpp_database_path + "'...")
-    clblast.print_cpp_database(database_best_results, cpp_database_path)
+    # Outputs the database as a C++ database, unless it is only loaded at run-time
+    if cl_args.objective == "time":
+        print("[database] Producing a C++ database in '" + cpp_database_path + "'...")
+        compact_entries = clblast.print_cpp_database(database_best_results, cpp_database_path)
+
+        # Outputs the same database in compact form, which is the one built into the library
+        compact_database_file = os.path.join(cpp_database_path, "database_compact.cpp")
+        print("[database] Producing a compact C++ database in '" + compact_database_file + "'...")
+        clblast.print_compact_database(compact_entries, compact_database_file)
+
+    # Optionally outputs the database as a JSON file to load at run-time (see 'LoadDatabaseFile')
+    if cl_args.json_output is not None:
+        print("[database] Producing a JSON database in '" + cl_args.json_output + "'...")
+        clblast.print_json_database(database_best_results, cl_args.json_output)
 
     print("[database] All done")
 
@@ -6,10 +6,11 @@
 #   Cedric Nugteren <www.cedricnugteren.nl>
 
 import os
+import json
 
 # Type settings (also change in database_structure.hpp)
 STRING_LENGTH = 50
-PARAMETERS_LENGTH = 16
+PARAMETERS_LENGTH = 19
 
 # Constants from the C++ code
 VENDOR_DEFAULT = "default"
@@ -43,6 +44,12 @@ def precision_to_string(precision):
         return "ComplexSingle"
     elif precision == "6464":
         return "ComplexDouble"
+    elif precision == "1632":
+        return "HalfSingle"
+    elif precision == "1616":
+        return "BFloat16"
+    elif precision == "832":
+        return "Int8"
     else:
         raise("Unknown precision: " + precision)
 
@@ -88,31 +95,6 @@ def get_cpp_device_vendor(vendor, device_type):
     return "    { // %s %ss\n      kDeviceType%s, \"%s\", {\n" % (vendor, device_type, device_type_caps, vendor)
 
 
-def get_cpp_family_includes(family, precisions):
-    result = "\n"
-    result += "#include \"database/kernels/%s/%s.hpp\"\n" % (family, family)
-    for precision in precisions:
-        result += "#include \"database/kernels/%s/%s_%s.hpp\"\n" % (family, family, precision)
-    return result
-
-
-def get_hpp_family_includes(family, precisions):
-    result = "\n"
-    result += "#include \"database/database_structure.hpp\"\n"
-    result += "\n"
-    result += "namespace clblast {\n"
-    result += "namespace database {\n"
-    result += "\n"
-    camelcase_name = family.title().replace("_", "")
-    for precision in precisions:
-        precision_string = precision_to_string(precision)
-        result += "extern const DatabaseEntry %s%s;\n" % (camelcase_name, precision_string)
-    result += "\n"
-    result += "} // namespace database\n"
-    result += "} // namespace clblast\n"
-    return result
-
-
 def print_as_name(name):
     return "Name{\"%-50s\"}" % name.strip()[:STRING_LENGTH]
 
@@ -148,7 +130,8 @@ def get_kernel_database_results(kernel_database):
 
 
 def print_cpp_database(database, output_dir):
-    """Outputs the database as C++ code"""
+    """Outputs the database as C++ code, returns the entries for the compact database (see below)"""
+    compact_entries = []
 
     # Iterates over the kernel families
     kernel_families = sorted(set([s["kernel_family"] for s in database["sections"]]))
@@ -160,6 +143,14 @@ def print_cpp_database(database, output_dir):
 
         # Loops over the different precision (e.g. 16, 32, 3232, 64, 6464)
         precisions = sorted(set([s["precision"] for s in database["sections"]]))  # Based on full database
+
+        # The mixed-precision mode (1632) and the integer mode (832) only exist for the GEMM kernels
+        # and bfloat16 (1616) only for the GEMM and AXPY kernels, others fall back to 16
+        precisions = [p for p in precisions if p not in ["1632", "1616", "832"]]
+        if family_name == "xgemm":
+            precisions = sorted(precisions + ["1632", "1616", "832"])
+        if family_name == "xaxpy":
+            precisions = sorted(precisions + ["1616"])
         for precision in precisions:
             precision_database = [s for s in family_database if s["precision"] == precision]
 
@@ -188,6 +179,9 @@ def print_cpp_database(database, output_dir):
                 parameter_names = sorted(list(set(parameter_names)))
                 parameter_names_as_string = ", ".join(['"%s"' % p for p in parameter_names])
                 f.write(", {" + parameter_names_as_string + "}, {\n")
+                compact_vendors = []
+                compact_entries.append((family_name.title().replace("_", ""), int(precision),
+                                        parameter_names, compact_vendors))
 
                 # Loops over device vendors (e.g. AMD)
                 device_vendors = sorted(set([s["clblast_device_vendor"] for s in precision_database]))
@@ -199,6 +193,8 @@ def print_cpp_database(database, output_dir):
                     for device_type in device_types:
                         type_database = [s for s in vendor_database if s["clblast_device_type"] == device_type]
                         f.write(get_cpp_device_vendor(vendor, device_type))
+                        compact_architectures = []
+                        compact_vendors.append((get_json_device_type(device_type), vendor, compact_architectures))
 
                         # Loops over every architecture of this vendor-type combination
                         architectures = sorted(set([s["clblast_device_architecture"] for s in type_database]))
@@ -208,6 +204,8 @@ def print_cpp_database(database, output_dir):
                             architecture_database = [s for s in type_database if s["clblast_device_architecture"] == architecture]
                             architecture_string = DEVICE_ARCHITECTURE_DEFAULT if architecture == "" else architecture
                             f.write("        { \"%s\", {\n" % architecture_string)
+                            compact_devices = []
+                            compact_architectures.append((architecture_string, compact_devices))
 
                             # Loops over every device of this vendor-type combination
                             devices = sorted(set([s["clblast_device_name"] for s in architecture_database]))
@@ -233,6 +231,10 @@ def print_cpp_database(database, output_dir):
                                         parameters.append(str(parameter_value))
                                         parameter_index += 1
 
+                                compact_name = DEVICE_NAME_DEFAULT if device_name == DEVICE_NAME_DEFAULT else\
+                                    device_name.strip()[:STRING_LENGTH].rstrip()
+                                compact_devices.append((compact_name, [int(p) for p in parameters]))
+
                                 # Appends zero's to complete the list
                                 assert parameter_index <= PARAMETERS_LENGTH
                                 for append_index in range(parameter_index, PARAMETERS_LENGTH):
@@ -254,14 +256,140 @@ def print_cpp_database(database, output_dir):
                 # Prints the file footer
                 f.write(get_cpp_footer())
 
-            # Creates the combined family sources
-            full_path = os.path.join(family_path, family_name + ".cpp")
-            with open(full_path, 'w+') as f:
-                f.write(get_cpp_header(family_name, ""))
-                f.write(get_cpp_family_includes(family_name, precisions))
-
-            # Creates the combined family includes header
-            full_path = os.path.join(family_path, family_name + ".hpp")
-            with open(full_path, 'w+') as f:
-                f.write(get_cpp_header(family_name, ""))
-                f.write(get_hpp_family_includes(family_name, precisions))
+    return compact_entries
+
+
+def get_json_device_type(device_type):
+    """Converts a device type to the C++ name (see database_structure.hpp)"""
+    if device_type == DEVICE_TYPE_DEFAULT:
+        return "default"
+    if device_type.lower() == "accelerator":
+        return "accelerator"
+    return device_type
+
+
+def print_json_database(database, output_file):
+    """Outputs the database as a JSON file which can be loaded at run-time (see 'LoadDatabaseFile')"""
+    entries = []
+    for section in database["sections"]:
+        vendor = section["clblast_device_vendor"]
+        architecture = section["clblast_device_architecture"]
+        if vendor in VENDORS_WITH_ARCHITECTURE and architecture == "":
+            continue
+        assert len(section["results"]) == 1
+        entries.append({
+            "kernel": section["kernel_family"].title().replace("_", ""),
+            "precision": int(section["precision"]),
+            "device_type": get_json_device_type(section["clblast_device_type"]),
+            "device_vendor": vendor,
+            "device_architecture": DEVICE_ARCHITECTURE_DEFAULT if architecture == "" else architecture,
+            "device_name": section["clblast_device_name"].strip()[:STRING_LENGTH],
+            "parameters": section["results"][0]["parameters"]
+        })
+    with open(output_file, "w") as f:
+        f.write("{\"version\": 1, \"entries\": [\n")
+        f.write(",\n".join(["  " + json.dumps(entry, sort_keys=True) for entry in entries]))
+        f.write("\n]}\n")
+
+
+# Settings of the compact database (also change in database_compact.hpp)
+COMPACT_MAGIC = 0x44424C43  # "CLBD" in little-endian byte order
+COMPACT_VERSION = 1
+COMPACT_HEADER_WORDS = 8
+COMPACT_ENTRY_WORDS = 6
+COMPACT_VENDOR_WORDS = 4
+COMPACT_ARCHITECTURE_WORDS = 3
+COMPACT_DEVICE_WORDS = 2
+
+
+def encode_compact_database(entries):
+    """Encodes the entries returned by 'print_cpp_database' into the compact binary form. All values are 32-bit
+    little-endian words and all references are offsets from the start, such that the result can be used in place
+    (e.g. memory-mapped). Each table is sorted, such that it can be searched with a binary search:
+      header: magic, version, number of entries, and the byte offsets of the entry, vendor, architecture, and
+              device tables and of the parameter-values
+      entry: kernel name, precision, number of parameters, parameter names, first and last+1 vendor index
+      vendor: device type, vendor name, first and last+1 architecture index
+      architecture: name, first and last+1 device index
+      device: name, parameter values
+    Strings are stored once, zero-terminated, after the tables. Names and values are referenced by byte offset."""
+    def sort_key(name):
+        return name.encode("utf-8")
+
+    entries = sorted(entries, key=lambda e: (sort_key(e[0]), e[1] & 0xFFFFFFFF))
+    strings = {}
+    string_data = bytearray()
+    values = []
+
+    def add_string(name):
+        if name not in strings:
+            strings[name] = len(string_data)
+            string_data.extend(name.encode("utf-8") + b"\0")
+        return strings[name]
+
+    # Lays out the tables, with references as (section, index) pairs until the section offsets are known
+    entry_table, vendor_table, architecture_table, device_table = [], [], [], []
+    for kernel, precision, parameter_names, vendors in entries:
+        names_index = len(values)
+        values.extend([("string", add_string(name)) for name in parameter_names])
+        vendor_begin = len(vendor_table) // COMPACT_VENDOR_WORDS
+        for device_type, vendor, architectures in sorted(vendors, key=lambda v: (sort_key(v[1]), sort_key(v[0]))):
+            architecture_begin = len(architecture_table) // COMPACT_ARCHITECTURE_WORDS
+            for architecture, devices in sorted(architectures, key=lambda a: sort_key(a[0])):
+                device_begin = len(device_table) // COMPACT_DEVICE_WORDS
+                for device, parameters in sorted(devices, key=lambda d: sort_key(d[0])):
+                    assert len(parameters) == len(parameter_names)
+                    device_table.extend([("string", add_string(device)), ("value", len(values))])
+                    values.extend(parameters)
+                device_end = len(device_table) // COMPACT_DEVICE_WORDS
+                architecture_table.extend([("string", add_string(architecture)), device_begin, device_end])
+            architecture_end = len(architecture_table) // COMPACT_ARCHITECTURE_WORDS
+            vendor_table.extend([("string", add_string(device_type)), ("string", add_string(vendor)),
+                                 architecture_begin, architecture_end])
+        vendor_end = len(vendor_table) // COMPACT_VENDOR_WORDS
+        entry_table.extend([("string", add_string(kernel)), precision & 0xFFFFFFFF, len(parameter_names),
+                            ("value", names_index), vendor_begin, vendor_end])
+
+    # Resolves the offsets now that the sizes of all sections are known
+    entry_offset = COMPACT_HEADER_WORDS * 4
+    vendor_offset = entry_offset + len(entry_table) * 4
+    architecture_offset = vendor_offset + len(vendor_table) * 4
+    device_offset = architecture_offset + len(architecture_table) * 4
+    value_offset = device_offset + len(device_table) * 4
+    string_offset = value_offset + len(values) * 4
+
+    def resolve(word):
+        if isinstance(word, tuple):
+            return string_offset + word[1] if word[0] == "string" else value_offset + word[1] * 4
+        return word
+
+    header = [COMPACT_MAGIC, COMPACT_VERSION, len(entry_table) // COMPACT_ENTRY_WORDS,
+              entry_offset, vendor_offset, architecture_offset, device_offset, value_offset]
+    tables = entry_table + vendor_table + architecture_table + device_table + values
+    words = header + [resolve(word) for word in tables]
+    result = bytearray()
+    for word in words:
+        assert 0 <= word <= 0xFFFFFFFF
+        result.extend(bytearray([(word >> shift) & 0xFF for shift in (0, 8, 16, 24)]))
+    return result + string_data
+
+
+def print_compact_database(entries, output_file):
+    """Outputs the database in compact binary form (see above) as a C++ array"""
+    data = encode_compact_database(entries)
+    with open(output_file, "w+") as f:
+        f.write("\n" + get_cpp_separator() + """
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file holds the built-in database in compact binary form (see 'database_compact.hpp').
+//
+""" + get_cpp_separator() + "\n")
+        f.write("\n#include \"database/database_compact.hpp\"\n")
+        f.write(get_cpp_header_namespace())
+        f.write("\nconst unsigned char kCompactDatabase[] = {\n")
+        for index in range(0, len(data), 16):
+            f.write("  " + " ".join(["0x%02x," % byte for byte in data[index:index + 16]]) + "\n")
+        f.write("};\n")
+        f.write("const size_t kCompactDatabaseSize = sizeof(kCompactDatabase);\n")
+        f.write(get_cpp_footer())
@@ -0,0 +1,171 @@
+#!/usr/bin/env python
+
+# This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This file follows the
+# PEP8 Python style guide and uses a max-width of 120 characters per line.
+#
+# Author(s):
+#   Cedric Nugteren <www.cedricnugteren.nl>
+
+import sys
+import os
+import glob
+import argparse
+import subprocess
+import threading
+import multiprocessing
+
+import database.io as io
+import database.db as db
+import database.clblast as clblast
+import database.bests as bests
+
+# The precisions tuned for all kernels and the extra (mixed) precisions of some, as in the 'alltuners' target
+PRECISIONS = ["32", "64", "3232", "6464", "16"]
+EXTRA_PRECISIONS = {"xgemm": ["1632", "1616", "832"], "xaxpy": ["1616"]}
+
+# The prefix of the kernel tuner binaries, the routine tuners are not run
+TUNER_PREFIX = "clblast_tuner_"
+ROUTINE_TUNER_PREFIX = "clblast_tuner_routine_"
+
+
+def find_kernel_tuners(build_folder):
+    """Returns the names of all kernel tuners found in the build folder, e.g. 'xgemm'"""
+    kernels = []
+    for binary in glob.glob(os.path.join(build_folder, TUNER_PREFIX + "*")):
+        name = os.path.splitext(os.path.basename(binary))[0]
+        if name.startswith(ROUTINE_TUNER_PREFIX) or not os.access(binary, os.X_OK):
+            continue
+        kernels.append(name[len(TUNER_PREFIX):])
+    return sorted(kernels)
+
+
+def tune_device(build_folder, output_folder, platform, device, kernels, precisions, tuner_arguments):
+    """Runs all kernel tuners for all precisions one after the other for a single device. The tuners write their
+    results to the current directory, so each device gets its own folder. Failures (e.g. an unsupported precision)
+    are logged and skipped."""
+    if not os.path.isdir(output_folder):
+        os.makedirs(output_folder)
+    num_failures = 0
+    with open(os.path.join(output_folder, "tuners.log"), "a") as log:
+        for kernel in kernels:
+            for precision in precisions + EXTRA_PRECISIONS.get(kernel, []):
+                command = [os.path.join(os.path.abspath(build_folder), TUNER_PREFIX + kernel),
+                           "-platform", str(platform), "-device", str(device), "-precision", precision]
+                command.extend(tuner_arguments)
+                print("[tune_node] Device %d: running %s with precision %s" % (device, kernel, precision))
+                log.write("\n[tune_node] " + " ".join(command) + "\n")
+                log.flush()
+                if subprocess.call(command, cwd=output_folder, stdout=log, stderr=subprocess.STDOUT) != 0:
+                    print("[tune_node] Device %d: WARNING: %s with precision %s failed, see '%s'" %
+                          (device, kernel, precision, log.name))
+                    num_failures += 1
+    print("[tune_node] Device %d: all done with %d failure(s)" % (device, num_failures))
+
+
+def merge_results(json_files, objective):
+    """Merges the tuning results of all devices into a single database. Results for the same device, kernel,
+    precision and arguments (e.g. from two identical devices) end up in the same section, in which duplicate
+    parameter configurations are reduced to the fastest one (see 'db.add_section')."""
+    database = {"sections": []}
+    for file_json in json_files:
+        try:
+            imported_data = io.load_tuning_results(file_json)
+        except (ValueError, AssertionError, KeyError):
+            print("[tune_node] WARNING: invalid file '%s', skipping" % file_json)
+            continue
+
+        # Size-specific results and results tuned for another objective don't belong to this database
+        if "size_bucket" in imported_data or imported_data.pop("objective", "time") != objective:
+            continue
+        database = db.add_section(database, imported_data)
+    return database
+
+
+def remove_duplicate_devices(database):
+    """Keeps a single best result per entry of the run-time database: identical devices with e.g. a different clock
+    frequency end up in separate sections, of which only the fastest is kept"""
+    entry_attributes = ["clblast_device_vendor", "clblast_device_type", "clblast_device_architecture",
+                        "clblast_device_name", "precision", "kernel_family", "kernel"]
+    sections_best = {}
+    for section in database["sections"]:
+        key = tuple(section[attribute].strip() for attribute in entry_attributes)
+        if key not in sections_best or section["results"][0]["time"] < sections_best[key]["results"][0]["time"]:
+            sections_best[key] = section
+    return {"sections": [sections_best[key] for key in sorted(sections_best.keys())]}
+
+
+def main(argv):
+
+    # Parses the command-line arguments
+    parser = argparse.ArgumentParser(description="Runs all kernel tuners concurrently on multiple devices of a "
+                                                 "node and merges the results into a database file to be loaded at "
+                                                 "run-time (see 'CLBLAST_DATABASE_FILE')")
+    parser.add_argument("build_folder", help="The CLBlast build folder with the tuner binaries")
+    parser.add_argument("output_folder", help="The folder to store the tuning results in, one sub-folder per device")
+    parser.add_argument("-p", "--platform", type=int, default=0, help="The ID of the OpenCL platform to tune on")
+    parser.add_argument("-d", "--devices", type=int, nargs="+", required=True,
+                        help="The IDs of the devices to tune on, each by a separate process")
+    parser.add_argument("-x", "--precisions", nargs="+", default=PRECISIONS, help="The precisions to tune for")
+    parser.add_argument("-k", "--kernels", nargs="+", default=None,
+                        help="The kernels to tune, defaults to all kernel tuners found in the build folder")
+    parser.add_argument("-j", "--compile_threads", type=int, default=multiprocessing.cpu_count(),
+                        help="The total number of host threads to compile kernels with, shared by all devices")
+    parser.add_argument("--objective", type=str, default="time", choices=["time", "energy"],
+                        help="The objective to tune for")
+    parser.add_argument("--runs", type=int, default=None, help="The number of runs per configuration")
+    parser.add_argument("--json_output", type=str, default="clblast_database.json",
+                        help="The database file to produce, which can be loaded at run-time")
+    parser.add_argument("--skip_tuning", action="store_true", help="Only merges the results already on disk")
+    cl_args = parser.parse_args(argv)
+
+    # Checks whether the command-line arguments are valid
+    kernels = cl_args.kernels if cl_args.kernels is not None else find_kernel_tuners(cl_args.build_folder)
+    if not cl_args.skip_tuning and len(kernels) == 0:
+        raise RuntimeError("The path '" + cl_args.build_folder + "' does not contain any tuners, "
+                           "configure CLBlast with '-DTUNERS=ON'")
+    if len(set(cl_args.devices)) != len(cl_args.devices):
+        raise RuntimeError("Each device can only be tuned by a single process")
+
+    # The compilation threads of the host are divided over the devices, such that the concurrent tuners don't
+    # over-subscribe the host's CPUs (see the '-compile_threads' argument of the tuners)
+    compile_threads = max(1, cl_args.compile_threads // len(cl_args.devices))
+    tuner_arguments = ["-compile_threads", str(compile_threads)]
+    if cl_args.objective != "time":
+        tuner_arguments.extend(["-objective", cl_args.objective])
+    if cl_args.runs is not None:
+        tuner_arguments.extend(["-runs", str(cl_args.runs)])
+
+    # Runs the tuners: one thread per device, each waiting for the tuner processes of its device
+    device_folders = [os.path.join(cl_args.output_folder, "device_%d" % device) for device in cl_args.devices]
+    if not cl_args.skip_tuning:
+        print("[tune_node] Tuning %d kernel(s) on %d device(s) with %d compile thread(s) each" %
+              (len(kernels), len(cl_args.devices), compile_threads))
+        threads = []
+        for device, device_folder in zip(cl_args.devices, device_folders):
+            thread = threading.Thread(target=tune_device, args=(cl_args.build_folder, device_folder, cl_args.platform,
+                                                                device, kernels, cl_args.precisions,
+                                                                tuner_arguments))
+            thread.start()
+            threads.append(thread)
+        for thread in threads:
+            thread.join()
+
+    # Merges and de-duplicates the results of all devices
+    json_files = []
+    for device_folder in device_folders:
+        json_files.extend(sorted(glob.glob(os.path.join(device_folder, "*.json"))))
+    print("[tune_node] Merging %d JSON file(s)" % len(json_files))
+    database = merge_results(json_files, cl_args.objective)
+    if len(database["sections"]) == 0:
+        raise RuntimeError("No tuning results found in '" + cl_args.output_folder + "'")
+
+    # Outputs the best results as a JSON file to load at run-time (see 'LoadDatabaseFile')
+    database_best_results = remove_duplicate_devices(bests.get_best_results(database))
+    print("[tune_node] Producing a JSON database with %d entries in '%s'..." %
+          (len(database_best_results["sections"]), cl_args.json_output))
+    clblast.print_json_database(database_best_results, cl_args.json_output)
+    print("[tune_node] All done")
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -49,10 +49,10 @@ FILES = [
     "/src/clblast_cuda.cpp",
     "/src/pyclblast/src/pyclblast.pyx"
 ]
-HEADER_LINES = [123, 21, 127, 24, 29, 41, 29, 65, 32, 95, 21, 290]
-FOOTER_LINES = [98, 56, 112, 275, 6, 6, 6, 9, 2, 41, 55, 37]
+HEADER_LINES = [140, 30, 130, 24, 29, 41, 29, 85, 412, 103, 22, 393]
+FOOTER_LINES = [1213, 3070, 611, 1593, 6, 6, 6, 9, 2, 193, 110, 187]
 HEADER_LINES_DOC = 0
-FOOTER_LINES_DOC = 232
+FOOTER_LINES_DOC = 1437
 
 # Different possibilities for requirements
 ald_m = "The value of `a_ld` must be at least `m`."
@@ -88,6 +88,7 @@ yn = "n * y_inc"
 ym = "m * y_inc"
 zn = "n * z_inc"
 an = "n * a_ld"
+bn = "n * b_ld"
 apn = "((n*(n+1)) / 2)"
 cn = "n * c_ld"
 xmn = size_helper("a_transpose != CLBlastTransposeNo", "m", "n", "x_inc")
@@ -106,17 +107,22 @@ ammn = size_helper("layout == CLBlastLayoutRowMajor", "m", "((side == CLBlastSid
 bmnn = size_helper("layout == CLBlastLayoutRowMajor", "((side == CLBlastSideLeft) ? m : n)", "n", "b_ld")
 im = "height * width * channels"
 col = "height * width * channels"
+col2im_col = "((height + 2 * pad_h - dilation_h * (kernel_h - 1) - 1) / stride_h + 1) * ((width + 2 * pad_w - dilation_w * (kernel_w - 1) - 1) / stride_w + 1) * kernel_h * kernel_w * channels"
+convgemm_im = "height * width * channels * batch_count"
+convgemm_kernel = "kernel_h * kernel_w * channels * num_kernels"
+convgemm_result = "((height + 2 * pad_h - dilation_h * (kernel_h - 1) - 1) / stride_h + 1) * ((width + 2 * pad_w - dilation_w * (kernel_w - 1) - 1) / stride_w + 1) * num_kernels * batch_count"
 
 # ==================================================================================================
 
 # Populates a list of routines
 im2col_constants = ["channels", "height", "width", "kernel_h", "kernel_w", "pad_h", "pad_w", "stride_h", "stride_w", "dilation_h", "dilation_w"]
+convgemm_constants = im2col_constants + ["num_kernels", "batch_count"]
 ROUTINES = [
 [  # Level 1: vector-vector
-  Routine(False, True,  0, False, "1", "rotg",  T, [S,D],            [],                  [],                                                     [],         ["sa","sb","sc","ss"],        ["1","1","1","1"], [],       "",    "Generate givens plane rotation", "", []),
-  Routine(False, True,  0, False, "1", "rotmg", T, [S,D],            [],                  [],                                                     ["sy1"],    ["sd1","sd2","sx1","sparam"], ["1","1","1","1","1"], [],   "",    "Generate modified givens plane rotation", "", []),
-  Routine(False, True,  0, False, "1", "rot",   T, [S,D],            ["n"],               [],                                                     [],         ["x","y"],                    [xn,yn],       ["cos","sin"],"",    "Apply givens plane rotation", "", []),
-  Routine(False, True,  0, False, "1", "rotm",  T, [S,D],            ["n"],               [],                                                     [],         ["x","y","sparam"],           [xn,yn,"1"],   [],           "",    "Apply modified givens plane rotation", "", []),
+  Routine(True,  True,  0, False, "1", "rotg",  T, [S,D],            [],                  [],                                                     [],         ["sa","sb","sc","ss"],        ["1","1","1","1"], [],       "",    "Generate givens plane rotation", "", []),
+  Routine(True,  True,  0, False, "1", "rotmg", T, [S,D],            [],                  [],                                                     ["sy1"],    ["sd1","sd2","sx1","sparam"], ["1","1","1","1","1"], [],   "",    "Generate modified givens plane rotation", "", []),
+  Routine(True,  True,  0, False, "1", "rot",   T, [S,D],            ["n"],               [],                                                     [],         ["x","y"],                    [xn,yn],       ["cos","sin"],"",    "Apply givens plane rotation", "", []),
+  Routine(True,  True,  0, False, "1", "rotm",  T, [S,D],            ["n"],               [],                                                     [],         ["x","y","sparam"],           [xn,yn,"1"],   [],           "",    "Apply modified givens plane rotation", "", []),
   Routine(True,  True,  0, False, "1", "swap",  T, [S,D,C,Z,H],      ["n"],               [],                                                     [],         ["x","y"],                    [xn,yn],       [],           "",    "Swap two vectors", "Interchanges _n_ elements of vectors _x_ and _y_.", []),
   Routine(True,  True,  0, False, "1", "scal",  T, [S,D,C,Z,H],      ["n"],               [],                                                     [],         ["x"],                        [xn],          ["alpha"],    "",    "Vector scaling", "Multiplies _n_ elements of vector _x_ by a scalar constant _alpha_.", []),
   Routine(True,  True,  0, False, "1", "copy",  T, [S,D,C,Z,H],      ["n"],               [],                                                     ["x"],      ["y"],                        [xn,yn],       [],           "",    "Vector copy", "Copies the contents of vector _x_ into vector _y_.", []),
@@ -145,8 +151,8 @@ ROUTINES = [
   Routine(True,  True,  0, False, "2a", "tbmv",  T,  [S,D,C,Z,H],    ["n","k"],           ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "n",   "Triangular banded matrix-vector multiplication", "Same operation as xGEMV, but matrix _A_ is triangular and banded instead.", [ald_k_one]),
   Routine(True,  True,  0, False, "2a", "tpmv",  T,  [S,D,C,Z,H],    ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["ap"],     ["x"],                        [apn,xn],      [],               "n",   "Triangular packed matrix-vector multiplication", "Same operation as xGEMV, but matrix _A_ is a triangular packed matrix instead and repreented as _AP_.", []),
   Routine(True,  True,  0, False, "2a", "trsv",  T,  [S,D,C,Z],      ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "",    "Solves a triangular system of equations", "", []),
-  Routine(False, True,  0, False, "2a", "tbsv",  T,  [S,D,C,Z],      ["n","k"],           ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "",    "Solves a banded triangular system of equations", "", [ald_k_one]),
-  Routine(False, True,  0, False, "2a", "tpsv",  T,  [S,D,C,Z],      ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["ap"],     ["x"],                        [apn,xn],      [],               "",    "Solves a packed triangular system of equations", "", []),
+  Routine(True,  True,  0, False, "2a", "tbsv",  T,  [S,D,C,Z],      ["n","k"],           ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "",    "Solves a banded triangular system of equations", "", [ald_k_one]),
+  Routine(True,  True,  0, False, "2a", "tpsv",  T,  [S,D,C,Z],      ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["ap"],     ["x"],                        [apn,xn],      [],               "",    "Solves a packed triangular system of equations", "", []),
   # Level 2: matrix update
   Routine(True,  True,  0, False, "2b", "ger",   T,  [S,D,H],        ["m","n"],           ["layout"],                                             ["x","y"],  ["a"],                        [xm,yn,amn],   ["alpha"],        "",    "General rank-1 matrix update", "Performs the operation _A = alpha * x * y^T + A_, in which _x_ is an input vector, _y^T_ is the transpose of the input vector _y_, _A_ is the matrix to be updated, and _alpha_ is a scalar value.", [ald_m]),
   Routine(True,  True,  0, False, "2b", "geru",  T,  [C,Z],          ["m","n"],           ["layout"],                                             ["x","y"],  ["a"],                        [xm,yn,amn],   ["alpha"],        "",    "General rank-1 complex matrix update", "Same operation as xGER, but with complex data-types.", [ald_m]),
@@ -174,12 +180,39 @@ ROUTINES = [
 [  # Level X: extra routines (not part of BLAS)
   # Special routines:
   Routine(True,  True,  0, False, "x", "had",      T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x","y"],  ["z"],                        [xn,yn,zn],      ["alpha","beta"], "",    "Element-wise vector product (Hadamard)", "Performs the Hadamard element-wise product _z = alpha * x * y + beta * z_, in which _x_, _y_, and _z_ are vectors and _alpha_ and _beta_ are scalar constants.", []),
+  Routine(True,  True,  0, False, "x", "axpby",    T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x"],      ["y"],                        [xn,yn],         ["alpha","beta"], "",    "Scaling and addition of two vectors (non-BLAS function)", "Performs the operation _y = alpha * x + beta * y_, in which _x_ and _y_ are vectors and _alpha_ and _beta_ are scalar constants. This is a single pass over the data, replacing the combination of xSCAL and xAXPY. If _beta_ is zero, _y_ is not read, such that NaN and Inf values in _y_ do not propagate into the result.", []),
+  Routine(True,  True,  0, False, "x", "set",      T, [S,D,C,Z,H],   ["n"],                [],                                                    [],         ["x"],                        [xn],            ["alpha"],        "",    "Sets all elements of a vector to a scalar value (non-BLAS function)", "Sets _n_ elements of the vector _x_ to the scalar constant _alpha_. The vector _x_ is only written to, such that, unlike xSCAL with _alpha_ equal to zero, NaN and Inf values in _x_ do not propagate into the result.", []),
   Routine(True,  True,  0, False, "x", "omatcopy", T, [S,D,C,Z,H],   ["m","n"],            ["layout","a_transpose"],                              ["a"],      ["b"],                        [amn,bnma],      ["alpha"],        "",    "Scaling and out-place transpose/copy (non-BLAS function)", "Performs scaling and out-of-place transposition/copying of matrices according to _B = alpha*op(A)_, in which _A_ is an input matrix (_m_ rows by _n_ columns), _B_ an output matrix, and _alpha_ a scalar value. The operation _op_ can be a normal matrix copy, a transposition or a conjugate transposition.", [ald_m, bld_n]),
   Routine(True,  True,  0, False, "x", "im2col",   T, [S,D,C,Z,H],   im2col_constants,     [],                                                    ["im"],     ["col"],                      [im,col],        [""],             "",    "Im2col function (non-BLAS function)", "Performs the im2col algorithm, in which _im_ is the input matrix and _col_ is the output matrix.", []),
+  Routine(True,  True,  0, False, "x", "col2im",   T, [S,D,C,Z,H],   im2col_constants,     [],                                                    ["col"],    ["im"],                       [col2im_col,im], [""],             "",    "Col2im function (non-BLAS function)", "Performs the col2im algorithm, in which _col_ is the input matrix and _im_ is the output matrix. This is the reverse of im2col: all values of _col_ are accumulated (added) into _im_, for example to compute the gradient of a convolution. Each value of _im_ gathers its own contributions, such that no atomic operations are needed.", []),
+  Routine(True,  True,  0, False, "x", "dotnrm2asum", T, [S,D,H], ["n"],                [],                                                    ["x","y"],  ["results"],                  [xn,yn,"3"],     [],               "",    "Fused dot product, Euclidian norm and absolute sum (non-BLAS function)", "Computes the dot product of the vectors _x_ and _y_, the L2 norm of _x_, and the absolute sum of _x_ in a single pass over the data. The three results are stored in this order in consecutive elements of the _results_ buffer. This is faster than separate calls to xDOT, xNRM2, and xASUM, since the vectors are loaded only once and fewer kernels are launched.", []),
+  Routine(True,  True,  0, False, "x", "convgemm", T, [S,D,H],       convgemm_constants,   [],                                                    ["im","kernel"], ["result"],           [convgemm_im,convgemm_kernel,convgemm_result], [""], "", "Batched convolution as GEMM (non-BLAS function)", "Integrates im2col and GEMM for batched 3D convolution, in which _im_ is the 4D input tensor (NCHW - batch-channelin-height-width), _kernel_ is the 4D kernel weights tensor (KCHW - kernel-channelin-height-width), and _result_ is the 4D output tensor (NCHW - batch-kernel-height-width). The im2col matrix is never stored in memory: its values are computed from the input image on-the-fly in the GEMM kernel.", []),
+  Routine(True,  True,  0, False, "x", "potrf",    T, [S,D],         ["n"],                ["layout","triangle"],                                 [],         ["a"],                        [an],            [],               "",    "Cholesky factorisation (non-BLAS function)", "Computes the Cholesky factorisation _A = L * L^T_ (lower triangle) or _A = U^T * U_ (upper triangle) of the _n_ by _n_ symmetric positive-definite matrix _A_ in-place. Only the given triangle of _A_ is read and overwritten by the factor, the other triangle is not referenced. The matrix is split in halves recursively, such that most of the work is done by TRSM and SYRK, while the diagonal blocks of up to 32 by 32 elements are factorised in local memory. The input is not checked for positive-definiteness: in that case the results contain NaN values.", [ald_n]),
   # Batched routines:
   Routine(True,  True,  1, False, "x", "axpy",     T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x"],      ["y"],                        [xn,yn],         ["alpha"],        "",    "Batched version of AXPY", "As AXPY, but multiple operations are batched together for better performance.", []),
+  Routine(True,  True,  1, False, "x", "rot",      T, [S,D],         ["n"],                [],                                                    [],         ["x","y"],                    [xn,yn],         ["cos","sin"],    "",    "Batched version of ROT", "As ROT, but multiple operations are batched together for better performance. Each pair of vectors _x_ and _y_ is rotated by its own _cos_ and _sin_ values.", []),
+  Routine(True,  True,  1, False, "x", "gemv",     T, [S,D,C,Z,H],   ["m","n"],            ["layout","a_transpose"],                              ["a","x"],  ["y"],                        [amn,xmn,ynm],   ["alpha","beta"], "",    "Batched version of GEMV", "As GEMV, but multiple operations are batched together for better performance.", [ald_m]),
   Routine(True,  True,  1, False, "x", "gemm",     T, [S,D,C,Z,H],   ["m","n","k"],        ["layout","a_transpose","b_transpose"],                ["a","b"],  ["c"],                        [amk,bkn,cmn],   ["alpha","beta"], "",    "Batched version of GEMM", "As GEMM, but multiple operations are batched together for better performance.", [ald_transa_m_k, bld_transb_k_n, cld_m]),
   Routine(True,  True,  2, False, "x", "gemm",     T, [S,D,C,Z,H],   ["m","n","k"],        ["layout","a_transpose","b_transpose"],                ["a","b"],  ["c"],                        [amk,bkn,cmn],   ["alpha","beta"], "",    "StridedBatched version of GEMM", "As GEMM, but multiple strided operations are batched together for better performance.", [ald_transa_m_k, bld_transb_k_n, cld_m]),
+  Routine(True,  True,  1, False, "x", "trsm",     T, [S,D,C,Z],     ["m","n"],            ["layout","side","triangle","a_transpose","diagonal"], ["a"],      ["b"],                        [amns,bmn],      ["alpha"],        "",    "Batched version of TRSM", "As TRSM, but multiple operations are batched together for better performance. The diagonal blocks of all triangular matrices are inverted at once.", []),
+  Routine(True,  True,  2, False, "x", "trsm",     T, [S,D,C,Z],     ["m","n"],            ["layout","side","triangle","a_transpose","diagonal"], ["a"],      ["b"],                        [amns,bmn],      ["alpha"],        "",    "StridedBatched version of TRSM", "As TRSM, but multiple strided operations are batched together for better performance. The matrices of the batches are _a_stride_ and _b_stride_ elements apart.", []),
+  Routine(True,  True,  2, False, "x", "symm",     T, [S,D,C,Z,H],   ["m","n"],            ["layout","side","triangle"],                          ["a","b"],  ["c"],                        [ammn,bmnn,cmn], ["alpha","beta"], "",    "StridedBatched version of SYMM", "As SYMM, but multiple strided operations are batched together for better performance. The matrices of the batches are _a_stride_, _b_stride_, and _c_stride_ elements apart. All batches run in a single launch of the direct GEMM kernel, which applies the symmetric structure of _A_ while loading it.", [ald_side_m_n, bld_m, cld_m]),
+  Routine(True,  True,  2, False, "x", "syrk",     T, [S,D,C,Z,H],   ["n","k"],            ["layout","triangle","a_transpose"],                   ["a"],      ["c"],                        [ank,cn],        ["alpha","beta"], "",    "StridedBatched version of SYRK", "As SYRK, but multiple strided operations are batched together for better performance. The matrices of the batches are _a_stride_ and _c_stride_ elements apart. All batches run in a single launch of the direct GEMM kernel, which computes and stores only the requested triangle of each _C_.", [ald_trans_n_k, cld_m]),
+  Routine(True,  True,  2, False, "x", "trmm",     T, [S,D,C,Z,H],   ["m","n"],            ["layout","side","triangle","a_transpose","diagonal"], ["a"],      ["b"],                        [amns,bmn],      ["alpha"],        "",    "StridedBatched version of TRMM", "As TRMM, but multiple strided operations are batched together for better performance. The matrices of the batches are _a_stride_ and _b_stride_ elements apart. All batches run in a single launch of the direct GEMM kernel, which applies the triangular structure of _A_ while loading it.", [ald_side_m_n, bld_m]),
+  Routine(True,  True,  1, False, "x", "invert",   T, [S,D,C,Z],     ["n"],                ["layout","triangle","diagonal"],                      ["a"],      ["b"],                        [an,bn],         [],               "",    "Batched inversion of triangular matrices", "Computes the inverses _B = A^-1_ of a batch of _n_ by _n_ unit or non-unit triangular matrices _A_. The other triangle of each _B_ is set to zero. This routine supports sizes _n_ up to and including 128.", [ald_n, bld_n]),
+  Routine(True,  True,  2, False, "x", "potrf",    T, [S,D],         ["n"],                ["layout","triangle"],                                 [],         ["a"],                        [an],            [],               "",    "StridedBatched version of POTRF", "As POTRF, but multiple strided operations are batched together for better performance. The matrices of the batches are _a_stride_ elements apart. Matrices of up to 32 by 32 elements are factorised entirely in local memory, all of them in a single kernel launch.", [ald_n]),
+  Routine(True,  True,  2, False, "x", "gemv",     T, [S,D,C,Z,H],   ["m","n"],            ["layout","a_transpose"],                              ["a","x"],  ["y"],                        [amn,xmn,ynm],   ["alpha","beta"], "",    "StridedBatched version of GEMV", "As GEMV, but multiple strided operations are batched together for better performance. The matrices and vectors of the batches are _a_stride_, _x_stride_, and _y_stride_ elements apart.", [ald_m]),
+  Routine(True,  True,  2, False, "x", "trsv",     T, [S,D,C,Z],     ["n"],                ["layout","triangle","a_transpose","diagonal"],        ["a"],      ["x"],                        [an,xn],         [],               "",    "StridedBatched version of TRSV", "As TRSV, but multiple strided operations are batched together for better performance. The matrices and vectors of the batches are _a_stride_ and _x_stride_ elements apart. Each system is solved by a single work-group, which makes this routine suited for many small systems.", [ald_n]),
+  Routine(True,  True,  2, False, "x", "omatcopy", T, [S,D,C,Z,H],   ["m","n"],            ["layout","a_transpose"],                              ["a"],      ["b"],                        [amn,bnma],      ["alpha"],        "",    "StridedBatched version of OMATCOPY", "As OMATCOPY, but multiple strided operations are batched together for better performance. The matrices of the batches are _a_stride_ and _b_stride_ elements apart.", [ald_m, bld_n]),
+  Routine(True,  True,  2, False, "x", "im2col",   T, [S,D,C,Z,H],   im2col_constants,     [],                                                    ["im"],     ["col"],                      [im,col2im_col], [""],             "",    "StridedBatched version of IM2COL", "As IM2COL, but multiple strided operations are batched together for better performance: all images of the batch are processed by a single kernel launch. The images and the col matrices of the batches are _im_stride_ and _col_stride_ elements apart.", []),
+  Routine(True,  True,  2, False, "x", "col2im",   T, [S,D,C,Z,H],   im2col_constants,     [],                                                    ["col"],    ["im"],                       [col2im_col,im], [""],             "",    "StridedBatched version of COL2IM", "As COL2IM, but multiple strided operations are batched together for better performance. The col matrices and the images of the batches are _col_stride_ and _im_stride_ elements apart.", []),
+  Routine(True,  True,  2, False, "x", "axpy",     T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x"],      ["y"],                        [xn,yn],         ["alpha"],        "",    "StridedBatched version of AXPY", "As AXPY, but multiple strided operations are batched together for better performance. The vectors of the batches are _x_stride_ and _y_stride_ elements apart. In contrast to AXPYBATCHED, nothing is transferred to the device: all batches run in a single kernel launch.", []),
+  Routine(True,  True,  2, False, "x", "axpby",    T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x"],      ["y"],                        [xn,yn],         ["alpha","beta"], "",    "StridedBatched version of AXPBY", "As AXPBY, but multiple strided operations are batched together for better performance. The vectors of the batches are _x_stride_ and _y_stride_ elements apart.", []),
+  Routine(True,  True,  2, False, "x", "set",      T, [S,D,C,Z,H],   ["n"],                [],                                                    [],         ["x"],                        [xn],            ["alpha"],        "",    "StridedBatched version of SET", "As SET, but multiple strided operations are batched together for better performance. The vectors of the batches are _x_stride_ elements apart.", []),
+  Routine(True,  True,  2, False, "x", "scal",     T, [S,D,C,Z,H],   ["n"],                [],                                                    [],         ["x"],                        [xn],            ["alpha"],        "",    "StridedBatched version of SCAL", "As SCAL, but multiple strided operations are batched together for better performance. The vectors of the batches are _x_stride_ elements apart.", []),
+  Routine(True,  True,  2, False, "x", "dot",      T, [S,D,H],       ["n"],                [],                                                    ["x","y"],  ["dot"],                      [xn,yn,"1"],     [],               "n",   "StridedBatched version of DOT", "As DOT, but multiple strided operations are batched together for better performance. The vectors of the batches are _x_stride_ and _y_stride_ elements apart, the results of the batches are stored _dot_stride_ elements apart in the _dot_ buffer.", []),
+  Routine(True,  True,  2, False, "x", "nrm2",     T, [S,D,Sc,Dz,H], ["n"],                [],                                                    ["x"],      ["nrm2"],                     [xn,"1"],        [],               "2*n", "StridedBatched version of NRM2", "As NRM2, but multiple strided operations are batched together for better performance. The vectors of the batches are _x_stride_ elements apart, the results of the batches are stored _nrm2_stride_ elements apart in the _nrm2_ buffer.", []),
+  Routine(True,  True,  2, False, "x", "asum",     T, [S,D,Sc,Dz,H], ["n"],                [],                                                    ["x"],      ["asum"],                     [xn,"1"],        [],               "n",   "StridedBatched version of ASUM", "As ASUM, but multiple strided operations are batched together for better performance. The vectors of the batches are _x_stride_ elements apart, the results of the batches are stored _asum_stride_ elements apart in the _asum_ buffer.", []),
 ]]
 
 
@@ -40,6 +40,24 @@ def clblast_h(routine, cuda=False):
     """The C++ API header (.h)"""
     result = NL + "// " + routine.description + ": " + routine.short_names() + NL
     result += routine.routine_header_cpp(12, " = nullptr", cuda) + ";" + NL
+    if not cuda:
+        result += clblast_h_handle(routine)
+    return result
+
+
+def clblast_h_handle(routine):
+    """The C++ API overload taking a handle instead of a queue and an event (.h)"""
+    indent = " " * (19 + routine.length())
+    arguments = routine.arguments_def(routine.template)
+    names = [", ".join([definition.split(" ")[-1].lstrip("*") for definition in argument.split(", ")])
+             for argument in arguments]
+    result = "template <" + routine.template.name + ">" + NL
+    result += "inline StatusCode " + routine.capitalized_name() + "(Handle* handle," + NL + indent
+    result += ("," + NL + indent).join(arguments) + ") {" + NL
+    template_arguments = ", ".join([parameter.split(" ")[-1] for parameter in routine.template.name.split(", ")])
+    call = "  return " + routine.capitalized_name() + "<" + template_arguments + ">("
+    result += call + ("," + NL + " " * len(call)).join(names + ["HandleQueue(handle)"]) + ");" + NL
+    result += "}" + NL
     return result
 
 
@@ -50,6 +68,18 @@ def clblast_cc(routine, cuda=False):
     if routine.implemented:
         result += routine.routine_header_cpp(12, "", cuda, implementation=True) + " {" + NL
         result += "  try {" + NL
+        recorded = ", ".join(["{\"" + name + "\", " + value + "}" for name, value in routine.recorded_arguments()])
+        precision = "static_cast<int>(PrecisionValue<" + routine.template.buffer_type + ">())"
+        if cuda:
+            result += "    if (CallRecorder::IsEnabled()) {" + NL
+            result += "      CallRecorder::Instance().Record(\"" + routine.upper_name() + "\", "
+            result += precision + "," + NL
+            result += "                                      {" + recorded + "});" + NL
+        else:
+            result += "    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {" + NL
+            result += "      RecordCall(\"" + routine.upper_name() + "\", " + precision + "," + NL
+            result += "                 {" + recorded + "});" + NL
+        result += "    }" + NL
         if cuda:
             result += "    const auto context_cpp = Context(context);" + NL
             result += "    const auto device_cpp = Device(device);" + NL
@@ -140,26 +170,43 @@ def clblast_netlib_c_cc(routine):
         # There is a version available in CBLAS
         if flavour.precision_name in ["S", "D", "C", "Z"]:
             template = "<" + flavour.template + ">" if routine.no_scalars() else ""
-            name_postfix = "_sub" if routine.name in routine.routines_scalar_no_return() else ""
+            name_postfix = "_sub" if routine.name in routine.routines_scalar_sub() else ""
             indent = " " * (21 + routine.length() + len(template))
             result += routine.routine_header_netlib(flavour, 9, "") + " {" + NL
 
+            # Computes the buffer sizes
+            for i, name in enumerate(routine.inputs + routine.outputs):
+                result += "  " + routine.set_size(name, routine.buffer_sizes[i]) + NL
+
+            # Runs small problems on the host (if a CPU BLAS library is available)
+            if routine.has_host_fallback_netlib():
+                name_netlib = routine.name_netlib(flavour)
+                sizes_bytes = [name + "_size * sizeof(" + routine.get_buffer_type(name, flavour) + ")"
+                               for name in routine.inputs + routine.outputs]
+                result += "  static const auto host_routine = get_host_routine<decltype(&" + name_netlib + ")>(\"" + name_netlib + "\");" + NL
+                result += "  if (run_on_host(host_routine != nullptr, " + " + ".join(sizes_bytes) + ")) {" + NL
+                for name in routine.outputs:
+                    if name not in routine.scalar_buffers_first() or routine.name in routine.routines_scalar_no_return():
+                        buffer_type = routine.get_buffer_type(name, flavour)
+                        result += "    invalidate_resident_copies(" + name + ", " + name + "_size * sizeof(" + buffer_type + "));" + NL
+                result += "    return host_routine(" + ", ".join(routine.arguments_names_netlib(flavour)) + ");" + NL
+                result += "  }" + NL
+            else:
+                result += "  record_device_call();" + NL
+
             # Initialize OpenCL
-            result += "  auto device = get_device();" + NL
-            result += "  auto context = clblast::Context(device);" + NL
-            result += "  auto queue = clblast::Queue(context, device);" + NL
+            result += "  auto queue = get_queue();" + NL
+            result += "  auto context = queue.GetContext();" + NL
 
             # Set alpha and beta
             result += "".join("  " + s + NL for s in routine.scalar_create_cpp(flavour))
 
             # Copy data structures to the device
-            for i, name in enumerate(routine.inputs + routine.outputs):
-                result += "  " + routine.set_size(name, routine.buffer_sizes[i]) + NL
             for i, name in enumerate(routine.inputs + routine.outputs):
                 buffer_type = routine.get_buffer_type(name, flavour)
-                result += "  " + routine.create_buffer(name, buffer_type) + NL
                 if name in routine.scalar_buffers_second_non_pointer():
                     result += "  " + buffer_type + " " + name + "_vec[1]; " + name + "_vec[0] = " + name + ";" + NL
+                result += "  " + routine.create_buffer(name, buffer_type) + NL
             for name in routine.inputs + routine.outputs:
                 if name not in routine.scalar_buffers_first():
                     prefix = "" if name in routine.outputs else "const "
@@ -184,7 +231,7 @@ def clblast_netlib_c_cc(routine):
                     result += "  " + buffer_type + " " + name + "[" + name + "_size];" + NL
             for name in routine.outputs:
                 buffer_type = routine.get_buffer_type(name, flavour)
-                result += "  " + routine.read_buffer(name, buffer_type) + NL
+                result += "  " + routine.read_buffer(name, buffer_type, routine.may_be_async_netlib()) + NL
             for name in routine.outputs:
                 if name in routine.scalar_buffers_first() and routine.name not in routine.routines_scalar_no_return():
                     result += "  return " + name + "[0]"
@@ -21,43 +21,60 @@ def to_np_dtype(flavour):
     }[flavour.precision_name]
 
 
-def scalar_cython_conversion(scalar, flavour):
+def scalar_cython_type(scalar, flavour):
     scalar_type = flavour.alpha_cl if scalar == "alpha" else flavour.beta_cl
+    if scalar not in ["alpha", "beta"]:
+        scalar_type = flavour.buffer_type
     if scalar_type == "float":
-        return "<cl_float>" + scalar
+        return "cl_float"
     if scalar_type == "double":
-        return "<cl_double>" + scalar
+        return "cl_double"
     if scalar_type in ["cl_float2", "float2"]:
-        return "<cl_float2>cl_float2(x=" + scalar + ".real,y=" + scalar + ".imag)"
+        return "cl_float2"
     if scalar_type in ["cl_double2", "double2"]:
-        return "<cl_double2>cl_double2(x=" + scalar + ".real,y=" + scalar + ".imag)"
+        return "cl_double2"
     raise RuntimeError("Could not convert flavour '%s:%s'" % (flavour.precision_name, scalar_type))
 
 
+def scalar_cython_conversion(value, cython_type):
+    if cython_type in ["cl_float2", "cl_double2"]:
+        return cython_type + "(x=" + value + ".real, y=" + value + ".imag)"
+    return value
+
+
+def python_name(routine):
+    postfix = "_strided" if routine.batched == 2 else ""
+    postfix += "_batched" if routine.batched != 0 else ""
+    return routine.name + postfix
+
+
 def generate_pyx(routine):
     result = ""
-    if routine.implemented and routine.plain_name() and routine.level in ["1", "2a", "2b", "3"]:
+    if routine.implemented and routine.plain_name() and (routine.level in ["1", "2a", "2b", "3"] or routine.batched != 0):
         indent = "    "
+        scalars = [s for s in routine.scalars if s]
 
         result += SEPARATOR + NL
         result += "# " + routine.description + ": " + routine.short_names() + NL
         result += SEPARATOR + NL
         result += NL
 
-        # Reference C definition
-        result += "cdef extern from \"clblast_c.h\":" + NL
+        # Reference C definition, callable without the GIL
+        result += "cdef extern from \"clblast_c.h\" nogil:" + NL
         np_dtypes = []
+        flavours = []
         for flavour in routine.flavours:
             if flavour.precision_name in ["S", "D", "C", "Z"]:
                 result += indent + "CLBlastStatusCode CLBlast" + flavour.name + routine.plain_name() + "("
                 result += ", ".join(routine.arguments_def_c(flavour)) + ","
                 result += "cl_command_queue* queue, cl_event* event)" + NL
                 np_dtypes.append(to_np_dtype(flavour))
+                flavours.append(flavour)
         result += "" + NL
 
         # Function definition
         buffers = routine.inputs[:] + routine.outputs[:]
-        result += "def " + routine.plain_name() + "(queue, "
+        result += "def " + python_name(routine) + "(queue, "
         result += ", ".join(routine.arguments_python()) + "):" + NL
 
         # Documentation
@@ -66,20 +83,26 @@ def generate_pyx(routine):
         result += indent + "\"\"\"" + NL
         result += NL
 
-        # Data types and checks
-        result += indent + "dtype = check_dtype([" + ", ".join(buffers) + "], "
-        result += "[" + ", ".join(['"%s"' % d for d in np_dtypes]) + "])" + NL
+        # Data types and checks, DLPack tensors are wrapped first
         for buf in buffers:
             if buf in routine.buffers_vector():
-                result += indent + "check_vector("
+                result += indent + buf + " = check_vector("
             else:
-                result += indent + "check_matrix("
+                result += indent + buf + " = check_matrix("
             result += buf + ", \"" + buf + "\")" + NL
+        result += indent + "dtype = check_dtype([" + ", ".join(buffers) + "], "
+        result += "[" + ", ".join(['"%s"' % d for d in np_dtypes]) + "])" + NL
+        if routine.batched == 1:
+            result += indent + "cdef size_t batch_count = len(" + buffers[0] + "_offsets)" + NL
+            for name in [s + "s" for s in scalars] + [buf + "_offsets" for buf in buffers]:
+                result += indent + "check_batch(" + name + ", batch_count, \"" + name + "\")" + NL
         result += NL
 
         # Buffer transformation
         for buf in buffers:
             result += indent + "cdef cl_mem " + buf + "_buffer = <cl_mem><size_t>" + buf + ".base_data.int_ptr" + NL
+        for buf in buffers:
+            result += indent + "cdef size_t " + buf + "_element_offset = element_offset(" + buf + ")" + NL
         result += NL
 
         result += indent + "cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr" + NL
@@ -87,36 +110,84 @@ def generate_pyx(routine):
 
         for option in routine.options:
             if option == "a_transpose":
-                result += indent + "a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo" + NL
+                result += indent + "cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo" + NL
             if option == "b_transpose":
-                result += indent + "b_transpose = CLBlastTransposeYes if b_transp else CLBlastTransposeNo" + NL
+                result += indent + "cdef CLBlastTranspose b_transpose = CLBlastTransposeYes if b_transp else CLBlastTransposeNo" + NL
             if option == "ab_transpose":
-                result += indent + "ab_transpose = CLBlastTransposeYes if ab_transp else CLBlastTransposeNo" + NL
+                result += indent + "cdef CLBlastTranspose ab_transpose = CLBlastTransposeYes if ab_transp else CLBlastTransposeNo" + NL
             if option == "side":
-                result += indent + "side = CLBlastSideRight if right_side else CLBlastSideLeft" + NL
+                result += indent + "cdef CLBlastSide side = CLBlastSideRight if right_side else CLBlastSideLeft" + NL
             if option == "triangle":
-                result += indent + "triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper" + NL
+                result += indent + "cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper" + NL
             if option == "diagonal":
-                result += indent + "diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit" + NL
+                result += indent + "cdef CLBlastDiagonal diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit" + NL
+
+        # Scalars and offsets as C values, such that the GIL can be released during the call
+        if routine.batched == 1:
+            result += NL
+            result += indent + "cdef size_t i" + NL
+            for scalar in scalars:
+                result += indent + "cdef void* " + scalar + "s_data = PyMem_Malloc(batch_count * sizeof(cl_double2))" + NL
+            for buf in buffers:
+                result += indent + "cdef size_t* " + buf + "_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))" + NL
+        else:
+            for flavour in flavours:
+                for scalar in scalars:
+                    result += indent + "cdef " + scalar_cython_type(scalar, flavour) + " " + scalar + "_"
+                    result += flavour.name.lower() + NL
 
         result += "" + NL
         result += indent + "cdef CLBlastStatusCode err" + NL
+        body_indent = indent
+        if routine.batched == 1:
+            data_names = [s + "s_data" for s in scalars] + [buf + "_offsets_data" for buf in buffers]
+            result += indent + "try:" + NL
+            body_indent = indent + indent
+            result += body_indent + "if not (" + " and ".join(data_names) + "):" + NL
+            result += body_indent + indent + "raise MemoryError()" + NL
+            result += body_indent + "for i in range(batch_count):" + NL
+            for buf in buffers:
+                result += body_indent + indent + buf + "_offsets_data[i] = " + buf + "_offsets[i] + " + buf + "_element_offset" + NL
+
+        # Dependencies on other events are handled by a barrier, as the C API has no wait-list
+        result += body_indent + "if wait_for:" + NL
+        result += body_indent + indent + "cl.enqueue_barrier(queue, wait_for=wait_for)" + NL
         if_prefix = ""
-        for flavour in routine.flavours:
-            if flavour.precision_name in ["S", "D", "C", "Z"]:
-                np_dtype = to_np_dtype(flavour)
-                argument_names = [x.
-                                  replace("layout", "CLBlastLayoutRowMajor").
-                                  replace("alpha", scalar_cython_conversion("alpha", flavour)).
-                                  replace("beta", scalar_cython_conversion("beta", flavour))
-                                  for x in routine.arguments()]
-                result += indent + if_prefix + "if dtype == np.dtype(\"" + np_dtype + "\"):" + NL
-                result += indent + indent + "err = CLBlast" + flavour.name + routine.plain_name()
-                result += "(" + ", ".join(argument_names) + ", &command_queue, &event)" + NL
-                if_prefix = "el"
-
-        result += indent + "else:" + NL
-        result += indent + indent + "raise ValueError(\"PyCLBlast: Unrecognized data-type '%s'\" % dtype)" + NL
+        for flavour in flavours:
+            np_dtype = to_np_dtype(flavour)
+            replacements = {"layout": "CLBlastLayoutRowMajor"}
+            for scalar in scalars:
+                cython_type = scalar_cython_type(scalar, flavour)
+                replacements[scalar] = scalar + "_" + flavour.name.lower()
+                replacements[scalar + "s_cpp"] = "<" + cython_type + "*>" + scalar + "s_data"
+            for buf in buffers:
+                replacements[buf + "_offsets"] = buf + "_offsets_data"
+                replacements[buf + "_offset"] = buf + "_offset + " + buf + "_element_offset"
+            argument_names = [replacements.get(name, name)
+                              for argument in routine.arguments() for name in argument.split(", ")]
+            argument_names += routine.batch_count_list()
+            result += body_indent + if_prefix + "if dtype == np.dtype(\"" + np_dtype + "\"):" + NL
+            if routine.batched == 1 and scalars:
+                result += body_indent + indent + "for i in range(batch_count):" + NL
+            for scalar in scalars:
+                cython_type = scalar_cython_type(scalar, flavour)
+                if routine.batched == 1:
+                    result += body_indent + indent + indent + "(<" + cython_type + "*>" + scalar + "s_data)[i] = "
+                    result += scalar_cython_conversion(scalar + "s[i]", cython_type) + NL
+                else:
+                    result += body_indent + indent + scalar + "_" + flavour.name.lower() + " = "
+                    result += scalar_cython_conversion(scalar, cython_type) + NL
+            result += body_indent + indent + "with nogil:" + NL
+            result += body_indent + indent + indent + "err = CLBlast" + flavour.name + routine.plain_name()
+            result += "(" + ", ".join(argument_names) + ", &command_queue, &event)" + NL
+            if_prefix = "el"
+
+        result += body_indent + "else:" + NL
+        result += body_indent + indent + "raise ValueError(\"PyCLBlast: Unrecognized data-type '%s'\" % dtype)" + NL
+        if routine.batched == 1:
+            result += indent + "finally:" + NL
+            for name in data_names:
+                result += indent + indent + "PyMem_Free(" + name + ")" + NL
         result += indent + "if err != CLBlastSuccess:" + NL
         result += indent + indent + "raise RuntimeError(\"PyCLBlast: 'CLBlastX" + routine.plain_name() + "' failed: %s\" % get_status_message(err))" + NL
         result += indent + "return cl.Event.from_int_ptr(<size_t>event)" + NL
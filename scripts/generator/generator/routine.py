@@ -92,7 +92,7 @@ class Routine:
             result.append("auto " + scalar + "s_cpp = std::vector<" + flavour.buffer_type + ">();")
         result.append("for (auto batch = size_t{0}; batch < batch_count; ++batch) {")
         for scalar in self.scalars:
-            content = scalar
+            content = scalar + "s[batch]"
             if scalar == "alpha":
                 content = flavour.use_alpha(postfix="s[batch]")
             elif scalar == "beta":
@@ -104,7 +104,7 @@ class Routine:
     @staticmethod
     def scalar_buffers_first():
         """List of scalar buffers"""
-        return ["dot", "nrm2", "asum", "sum", "imax", "imin"]
+        return ["dot", "nrm2", "asum", "sum", "imax", "imin", "results"]
 
     @staticmethod
     def scalar_buffers_second():
@@ -143,6 +143,11 @@ class Routine:
 
     @staticmethod
     def routines_scalar_no_return():
+        return ["dotu", "dotc", "dotnrm2asum"]
+
+    @staticmethod
+    def routines_scalar_sub():
+        """As above, but only those with a '_sub' postfix in the Netlib CBLAS API"""
         return ["dotu", "dotc"]
 
     @staticmethod
@@ -150,10 +155,15 @@ class Routine:
         """Sets the size of a buffer"""
         return "const auto " + name + "_size = " + size + ";"
 
-    @staticmethod
-    def create_buffer(name, template):
-        """Creates a new CLCudaAPI buffer"""
-        return "auto " + name + "_buffer = clblast::Buffer<" + template + ">(context, " + name + "_size);"
+    def create_buffer(self, name, template):
+        """Creates a new CLCudaAPI buffer, backed by the host array if there is one"""
+        if name in self.scalar_buffers_first() and self.name not in self.routines_scalar_no_return():
+            return "auto " + name + "_buffer = create_buffer<" + template + ">(context, queue, " + name + "_size);"
+        postfix = ""
+        if name in self.scalar_buffers_second_non_pointer():
+            postfix = "_vec"
+        data_structure = "reinterpret_cast<const " + template + "*>(" + name + postfix + ")"
+        return "auto " + name + "_buffer = create_buffer<" + template + ">(context, queue, " + data_structure + ", " + name + "_size);"
 
     def write_buffer(self, name, template):
         """Writes to a CLCudaAPI buffer"""
@@ -161,13 +171,14 @@ class Routine:
         if name in self.scalar_buffers_second_non_pointer():
             postfix = "_vec"
         data_structure = "reinterpret_cast<" + template + "*>(" + name + postfix + ")"
-        return name + "_buffer.Write(queue, " + name + "_size, " + data_structure + ");"
+        return "write_buffer(queue, " + name + "_buffer, " + name + "_size, " + data_structure + ");"
 
     @staticmethod
-    def read_buffer(name, template):
+    def read_buffer(name, template, may_be_async=True):
         """Reads from a CLCudaAPI buffer"""
         data_structure = "reinterpret_cast<" + template + "*>(" + name + ")"
-        return name + "_buffer.Read(queue, " + name + "_size, " + data_structure + ");"
+        postfix = "" if may_be_async else ", false"
+        return "read_buffer(queue, " + name + "_buffer, " + name + "_size, " + data_structure + postfix + ");"
 
     def non_index_inputs(self):
         """Lists of input/output buffers not index (integer)"""
@@ -187,7 +198,7 @@ class Routine:
 
     def buffers_without_ld_inc(self):
         """List of buffers without 'inc' or 'ld'"""
-        return self.scalar_buffers_first() + self.scalar_buffers_second() + ["ap", "im", "col"]
+        return self.scalar_buffers_first() + self.scalar_buffers_second() + ["ap", "im", "col", "kernel", "result"]
 
     def get_buffer_type(self, name, flavour):
         if name in self.index_buffers():
@@ -200,7 +211,7 @@ class Routine:
 
     def no_scalars(self):
         """Determines whether or not this routine has scalar arguments (alpha/beta)"""
-        return self.scalars == [] or self.name == "im2col"
+        return self.scalars == [] or self.name in ["im2col", "col2im", "convgemm"]
 
     def has_layout(self):
         """Determines whether the layout is an argument"""
@@ -221,12 +232,16 @@ class Routine:
         """Determines which buffers go first (between alpha and beta) and which ones go after"""
         if self.level == "2b" or self.name == "had":
             return ["x", "y"]
-        return ["ap", "a", "b", "x", "im"]
+        if self.name == "col2im":
+            return ["col"]
+        return ["ap", "a", "b", "x", "im", "kernel"]
 
     def buffers_second(self):
         if self.level == "2b" or self.name == "had":
             return ["z", "ap", "a", "b", "c"]
-        return ["y", "c", "col"]
+        if self.name == "col2im":
+            return ["im"]
+        return ["y", "c", "col", "result"]
 
     def buffer(self, name):
         """Retrieves a variable name for a specific input/output vector/matrix (e.g. 'x')"""
@@ -239,6 +254,23 @@ class Routine:
             return [", ".join(a + b + c)]
         return []
 
+    def recorded_arguments(self):
+        """Retrieves the integer arguments as recorded by the call recorder: (name, value) pairs of the sizes, options,
+        offsets, leading dimensions, increments, strides and batch count"""
+        arguments = [(s, s) for s in self.sizes]
+        arguments += [(o, "static_cast<size_t>(" + o + ")") for o in self.options]
+        names = self.inputs + [o for o in self.outputs if o not in self.inputs]
+        for name in names:
+            if self.batched != 1:
+                arguments.append((name + "_offset", name + "_offset"))
+            if name not in self.buffers_without_ld_inc():
+                arguments.append((name + "_" + self.postfix(name), name + "_" + self.postfix(name)))
+            if self.batched == 2:
+                arguments.append((name + "_stride", name + "_stride"))
+        if self.batched != 0:
+            arguments.append(("batch_count", "batch_count"))
+        return arguments
+
     def buffer_bis(self, name):
         """As above but with a '_bis' suffix for the buffer name"""
         if name in self.inputs or name in self.outputs:
@@ -441,6 +473,8 @@ class Routine:
                 if self.batched == 1:
                     return ["betas_cpp.data()"]
                 return [flavour.use_beta()]
+            if self.batched == 1:
+                return [name + "s_cpp.data()"]
             return [name]
         return []
 
@@ -745,6 +779,11 @@ class Routine:
         result += self.batch_count_def()
         return result
 
+    def arguments_names_netlib(self, flavour):
+        """As above, but only the names of the arguments"""
+        definitions = ", ".join(self.arguments_def_netlib(flavour)).split(", ")
+        return [d.split(" ")[-1].replace("*", "") for d in definitions]
+
     def arguments_def_c(self, flavour):
         """As above, but for the C API"""
         return (self.options_def_c() + self.sizes_def() +
@@ -815,35 +854,45 @@ class Routine:
                 self.batch_count_doc())
 
     def arguments_python(self):
-        """Arguments for the Python wrapper pyclblast"""
+        """Arguments for the Python wrapper pyclblast, typed such that they can be passed without the GIL"""
         result = list()
-        result.extend(self.sizes)
+        result.extend(["size_t " + s for s in self.sizes])
         buffers = self.inputs + self.outputs
         result.extend(buffers[:])
+        if self.batched == 1:
+            result.extend([s + "s" for s in self.scalars if s])
         for buf in buffers:
             if buf in self.buffers_matrix():
-                result.append(buf + "_ld")
+                result.append("size_t " + buf + "_ld")
+        if self.batched == 1:
+            result.extend([buf + "_offsets" for buf in buffers])
+        if self.batched == 2:
+            result.extend(["size_t " + buf + "_stride" for buf in buffers])
+            result.append("size_t batch_count")
         for buf in buffers:
             if buf in self.buffers_vector():
-                result.append(buf + "_inc = 1")
-        for scalar in self.scalars:
-            default = "1.0" if scalar == "alpha" else "0.0"
-            result.append(scalar + " = " + default)
+                result.append("size_t " + buf + "_inc = 1")
+        if self.batched != 1:
+            for scalar in [s for s in self.scalars if s]:
+                default = "1.0" if scalar == "alpha" else "0.0"
+                result.append(scalar + " = " + default)
         for option in self.options:
             if option == "a_transpose":
-                result.append("a_transp = False")
+                result.append("bint a_transp = False")
             if option == "b_transpose":
-                result.append("b_transp = False")
+                result.append("bint b_transp = False")
             if option == "ab_transpose":
-                result.append("ab_transp = False")
+                result.append("bint ab_transp = False")
             if option == "side":
-                result.append("right_side = False")
+                result.append("bint right_side = False")
             if option == "triangle":
-                result.append("lower_triangle = False")
+                result.append("bint lower_triangle = False")
             if option == "diagonal":
-                result.append("unit_diagonal = False")
-        for buf in buffers:
-            result.append(buf + "_offset = 0")
+                result.append("bint unit_diagonal = False")
+        if self.batched != 1:
+            for buf in buffers:
+                result.append("size_t " + buf + "_offset = 0")
+        result.append("wait_for = None")
         return result
 
     def requirements_doc(self):
@@ -898,6 +947,27 @@ class Routine:
         result += ",\n" + indent + "cl_command_queue* queue, cl_event* event)"
         return result
 
+    def name_netlib(self, flavour):
+        """Retrieves the name of the routine in the Netlib CBLAS API"""
+        routine_name = self.name
+        if self.name in self.routines_scalar_sub():
+            routine_name += "_sub"
+        if self.batched != 0:
+            routine_name += "batched"
+        return "cblas_" + flavour.name.lower() + routine_name
+
+    def has_host_fallback_netlib(self):
+        """Whether the Netlib CBLAS routine can be forwarded to a regular CPU CBLAS library"""
+        returns_index = any(o in self.index_buffers() for o in self.outputs)
+        return self.level != "x" and self.has_tests and not returns_index
+
+    def may_be_async_netlib(self):
+        """Whether the Netlib CBLAS routine can return before completion: not if it returns a scalar or
+        if it copies from local variables"""
+        returns_scalar = any(o in self.scalar_buffers_first() for o in self.outputs) and self.name not in self.routines_scalar_no_return()
+        uses_local_copies = any(i in self.scalar_buffers_second_non_pointer() for i in self.inputs)
+        return not returns_scalar and not uses_local_copies
+
     def routine_header_netlib(self, flavour, spaces, extra_qualifier):
         """As above, but now for the original Netlib CBLAS API"""
         return_type = "void"
@@ -909,13 +979,9 @@ class Routine:
                 return_type = flavour.buffer_type.replace("2", "")
                 break
         indent = " " * (spaces + len(return_type) + self.length())
-        routine_name = self.name
-        if self.name in self.routines_scalar_no_return():
-            routine_name += "_sub"
+        if self.name in self.routines_scalar_sub():
             indent += "    "
-        if self.batched != 0:
-            routine_name += "batched"
-        result = return_type + extra_qualifier + " cblas_" + flavour.name.lower() + routine_name + "("
+        result = return_type + extra_qualifier + " " + self.name_netlib(flavour) + "("
         result += (",\n" + indent).join([a for a in self.arguments_def_netlib(flavour)]) + ")"
         return result
 
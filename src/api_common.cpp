@@ -11,10 +11,23 @@
 // =================================================================================================
 
 #include <string>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <future>
+#include <exception>
+#include <set>
+#include <cctype>
 
 #include "utilities/utilities.hpp"
 #include "cache.hpp"
+#include "memory_pool.hpp"
+#include "gemm_shapes.hpp"
 #include "routines/routines.hpp"
+#include "warm_up.hpp"
 
 namespace clblast {
 // =================================================================================================
@@ -22,79 +35,316 @@ namespace clblast {
 // Clears the cache of stored binaries
 StatusCode ClearCache() {
   try {
+    KernelCache::Instance().Invalidate();
     ProgramCache::Instance().Invalidate();
     BinaryCache::Instance().Invalidate();
   } catch (...) { return DispatchException(); }
   return StatusCode::kSuccess;
 }
 
-template <typename Real, typename Complex>
-void FillCacheForPrecision(Queue &queue) {
-  try {
-
-    // Runs all the level 1 set-up functions
-    Xswap<Real>(queue, nullptr); Xswap<Complex>(queue, nullptr);
-    Xswap<Real>(queue, nullptr); Xswap<Complex>(queue, nullptr);
-    Xscal<Real>(queue, nullptr); Xscal<Complex>(queue, nullptr);
-    Xcopy<Real>(queue, nullptr); Xcopy<Complex>(queue, nullptr);
-    Xaxpy<Real>(queue, nullptr); Xaxpy<Complex>(queue, nullptr);
-    Xdot<Real>(queue, nullptr);
-    Xdotu<Complex>(queue, nullptr);
-    Xdotc<Complex>(queue, nullptr);
-    Xnrm2<Real>(queue, nullptr); Xnrm2<Complex>(queue, nullptr);
-    Xasum<Real>(queue, nullptr); Xasum<Complex>(queue, nullptr);
-    Xsum<Real>(queue, nullptr); Xsum<Complex>(queue, nullptr);
-    Xamax<Real>(queue, nullptr); Xamax<Complex>(queue, nullptr);
-    Xmax<Real>(queue, nullptr); Xmax<Complex>(queue, nullptr);
-    Xmin<Real>(queue, nullptr); Xmin<Complex>(queue, nullptr);
-
-    // Runs all the level 2 set-up functions
-    Xgemv<Real>(queue, nullptr); Xgemv<Complex>(queue, nullptr);
-    Xgbmv<Real>(queue, nullptr); Xgbmv<Complex>(queue, nullptr);
-    Xhemv<Complex>(queue, nullptr);
-    Xhbmv<Complex>(queue, nullptr);
-    Xhpmv<Complex>(queue, nullptr);
-    Xsymv<Real>(queue, nullptr);
-    Xsbmv<Real>(queue, nullptr);
-    Xspmv<Real>(queue, nullptr);
-    Xtrmv<Real>(queue, nullptr); Xtrmv<Complex>(queue, nullptr);
-    Xtbmv<Real>(queue, nullptr); Xtbmv<Complex>(queue, nullptr);
-    Xtpmv<Real>(queue, nullptr); Xtpmv<Complex>(queue, nullptr);
-    Xger<Real>(queue, nullptr);
-    Xgeru<Complex>(queue, nullptr);
-    Xgerc<Complex>(queue, nullptr);
-    Xher<Complex,Real>(queue, nullptr);
-    Xhpr<Complex,Real>(queue, nullptr);
-    Xher2<Complex>(queue, nullptr);
-    Xhpr2<Complex>(queue, nullptr);
-    Xsyr<Real>(queue, nullptr);
-    Xspr<Real>(queue, nullptr);
-    Xsyr2<Real>(queue, nullptr);
-    Xspr2<Real>(queue, nullptr);
-
-    // Runs all the level 3 set-up functions
-    Xgemm<Real>(queue, nullptr); Xgemm<Complex>(queue, nullptr);
-    Xsymm<Real>(queue, nullptr); Xsymm<Complex>(queue, nullptr);
-    Xhemm<Complex>(queue, nullptr);
-    Xsyrk<Real>(queue, nullptr); Xsyrk<Complex>(queue, nullptr);
-    Xherk<Complex,Real>(queue, nullptr);
-    Xsyr2k<Real>(queue, nullptr); Xsyr2k<Complex>(queue, nullptr);
-    Xher2k<Complex,Real>(queue, nullptr);
-    Xtrmm<Real>(queue, nullptr); Xtrmm<Complex>(queue, nullptr);
-
-    // Runs all the non-BLAS set-up functions
-    Xomatcopy<Real>(queue, nullptr); Xomatcopy<Complex>(queue, nullptr);
-
-  } catch(const RuntimeErrorCode &e) {
-    if (e.status() != StatusCode::kNoDoublePrecision &&
-        e.status() != StatusCode::kNoHalfPrecision) {
-      throw;
+// Removes the programs, kernels, and pooled buffers of a single context
+StatusCode ClearContextCache(const RawContext context) {
+  try {
+    RemoveContextPrograms(context);
+    MemoryPool::Instance().Trim(context);
+    ReleaseDeviceQueues(context);
+    ReleasePoolQueues(context);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// Limits the number of programs in the cache
+StatusCode SetProgramCacheLimit(const size_t num_programs) {
+  try {
+    LimitProgramCache(num_programs);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// A set-up function of a routine for a specific precision, i.e. building its program(s): all its
+// regular programs, or only the given ones (see 'BuildWarmUpPrograms')
+struct FillCacheTask {
+  std::string routine;
+  Precision precision;
+  std::function<void(Queue&, const std::vector<WarmUpProgram>*)> run;
+};
+
+// Builds the regular programs of a routine or the given ones
+void CompileRoutinePrograms(Routine &routine, const std::vector<WarmUpProgram> *programs) {
+  if (programs == nullptr) { routine.CompilePrograms(); return; }
+  for (const auto &program : *programs) {
+    routine.CompileProgram(program.index, program.extra_defines, program.identifier,
+                           program.build_options);
+  }
+}
+
+// Retrieves the precision of a routine from its (first) template argument
+template <typename RoutineType> struct RoutinePrecision;
+template <template <typename...> class RoutineType, typename T, typename... Ts>
+struct RoutinePrecision<RoutineType<T, Ts...>> {
+  static Precision Get() { return PrecisionValue<T>(); }
+};
+
+template <typename RoutineType>
+void AddFillCacheTask(std::vector<FillCacheTask> &tasks, const std::string &routine) {
+  tasks.push_back(FillCacheTask{routine, RoutinePrecision<RoutineType>::Get(),
+                                [](Queue &queue, const std::vector<WarmUpProgram> *programs) {
+                                  RoutineType routine_object(queue, nullptr);
+                                  CompileRoutinePrograms(routine_object, programs);
+                                }});
+}
+
+// As above, but for a routine class which is compiled under another routine name (e.g. the GEMM
+// routines with an epilogue)
+template <typename RoutineType>
+void AddNamedFillCacheTask(std::vector<FillCacheTask> &tasks, const std::string &routine) {
+  tasks.push_back(FillCacheTask{routine, RoutinePrecision<RoutineType>::Get(),
+                                [routine](Queue &queue,
+                                          const std::vector<WarmUpProgram> *programs) {
+                                  RoutineType routine_object(queue, nullptr, routine);
+                                  CompileRoutinePrograms(routine_object, programs);
+                                }});
+}
+
+// All the set-up functions for a real precision (including half precision)
+template <typename T>
+void AddFillCacheTasksReal(std::vector<FillCacheTask> &tasks) {
+
+  // Adds all the level 1 set-up functions
+  AddFillCacheTask<Xrotg<T>>(tasks, "ROTG");
+  AddFillCacheTask<Xrotmg<T>>(tasks, "ROTMG");
+  AddFillCacheTask<Xrot<T>>(tasks, "ROT");
+  AddFillCacheTask<Xrotm<T>>(tasks, "ROTM");
+  AddFillCacheTask<Xswap<T>>(tasks, "SWAP");
+  AddFillCacheTask<Xscal<T>>(tasks, "SCAL");
+  AddFillCacheTask<Xcopy<T>>(tasks, "COPY");
+  AddFillCacheTask<Xaxpy<T>>(tasks, "AXPY");
+  AddFillCacheTask<Xdot<T>>(tasks, "DOT");
+  AddFillCacheTask<Xnrm2<T>>(tasks, "NRM2");
+  AddFillCacheTask<Xasum<T>>(tasks, "ASUM");
+  AddFillCacheTask<Xsum<T>>(tasks, "SUM");
+  AddFillCacheTask<Xamax<T>>(tasks, "AMAX");
+  AddFillCacheTask<Xamin<T>>(tasks, "AMIN");
+  AddFillCacheTask<Xmax<T>>(tasks, "MAX");
+  AddFillCacheTask<Xmin<T>>(tasks, "MIN");
+
+  // Adds all the level 2 set-up functions
+  AddFillCacheTask<Xgemv<T>>(tasks, "GEMV");
+  AddFillCacheTask<Xgbmv<T>>(tasks, "GBMV");
+  AddFillCacheTask<Xsymv<T>>(tasks, "SYMV");
+  AddFillCacheTask<Xsbmv<T>>(tasks, "SBMV");
+  AddFillCacheTask<Xspmv<T>>(tasks, "SPMV");
+  AddFillCacheTask<Xtrmv<T>>(tasks, "TRMV");
+  AddFillCacheTask<Xtbmv<T>>(tasks, "TBMV");
+  AddFillCacheTask<Xtpmv<T>>(tasks, "TPMV");
+  AddFillCacheTask<Xtrsv<T>>(tasks, "TRSV");
+  AddFillCacheTask<Xtbsv<T>>(tasks, "TBSV");
+  AddFillCacheTask<Xtpsv<T>>(tasks, "TPSV");
+  AddFillCacheTask<Xger<T>>(tasks, "GER");
+  AddFillCacheTask<Xsyr<T>>(tasks, "SYR");
+  AddFillCacheTask<Xspr<T>>(tasks, "SPR");
+  AddFillCacheTask<Xsyr2<T>>(tasks, "SYR2");
+  AddFillCacheTask<Xspr2<T>>(tasks, "SPR2");
+
+  // Adds all the level 3 set-up functions
+  AddFillCacheTask<Xgemm<T>>(tasks, "GEMM");
+  AddFillCacheTask<Xsymm<T>>(tasks, "SYMM");
+  AddFillCacheTask<Xsyrk<T>>(tasks, "SYRK");
+  AddFillCacheTask<Xsyr2k<T>>(tasks, "SYR2K");
+  AddFillCacheTask<Xtrmm<T>>(tasks, "TRMM");
+  AddFillCacheTask<Xtrsm<T>>(tasks, "TRSM");
+
+  // Adds all the non-BLAS set-up functions
+  AddFillCacheTask<Xhad<T>>(tasks, "HAD");
+  AddFillCacheTask<Xaxpby<T>>(tasks, "AXPBY");
+  AddFillCacheTask<Xset<T>>(tasks, "SET");
+  AddFillCacheTask<Xomatcopy<T>>(tasks, "OMATCOPY");
+  AddFillCacheTask<XomatcopyStridedBatched<T>>(tasks, "OMATCOPYSTRIDEDBATCHED");
+  AddFillCacheTask<Ximatcopy<T>>(tasks, "IMATCOPY");
+  AddFillCacheTask<Xim2col<T>>(tasks, "IM2COL");
+  AddFillCacheTask<Xim2colStridedBatched<T>>(tasks, "IM2COLSTRIDEDBATCHED");
+  AddFillCacheTask<Xcol2im<T>>(tasks, "COL2IM");
+  AddFillCacheTask<Xcol2imStridedBatched<T>>(tasks, "COL2IMSTRIDEDBATCHED");
+  AddFillCacheTask<Xdotnrm2asum<T>>(tasks, "DOTNRM2ASUM");
+  AddFillCacheTask<Xconvgemm<T>>(tasks, "CONVGEMM");
+  AddFillCacheTask<XaxpyBatched<T>>(tasks, "AXPYBATCHED");
+  AddFillCacheTask<XaxpyGrouped<T>>(tasks, "AXPYGROUPED");
+  AddFillCacheTask<XaxpyStridedBatched<T>>(tasks, "AXPYSTRIDEDBATCHED");
+  AddFillCacheTask<XaxpbyStridedBatched<T>>(tasks, "AXPBYSTRIDEDBATCHED");
+  AddFillCacheTask<XsetStridedBatched<T>>(tasks, "SETSTRIDEDBATCHED");
+  AddFillCacheTask<XscalStridedBatched<T>>(tasks, "SCALSTRIDEDBATCHED");
+  AddFillCacheTask<XdotStridedBatched<T>>(tasks, "DOTSTRIDEDBATCHED");
+  AddFillCacheTask<Xnrm2StridedBatched<T>>(tasks, "NRM2STRIDEDBATCHED");
+  AddFillCacheTask<XasumStridedBatched<T>>(tasks, "ASUMSTRIDEDBATCHED");
+  AddFillCacheTask<XrotBatched<T>>(tasks, "ROTBATCHED");
+  AddFillCacheTask<XgemvBatched<T>>(tasks, "GEMVBATCHED");
+  AddFillCacheTask<XgemvStridedBatched<T>>(tasks, "GEMVSTRIDEDBATCHED");
+  AddFillCacheTask<XtrsvStridedBatched<T>>(tasks, "TRSVSTRIDEDBATCHED");
+  AddFillCacheTask<XgemvPair<T>>(tasks, "GEMVPAIR");
+  AddFillCacheTask<XgemmBatched<T>>(tasks, "GEMMBATCHED");
+  AddFillCacheTask<XgemmGrouped<T>>(tasks, "GEMMGROUPED");
+  AddFillCacheTask<XgemmStridedBatched<T>>(tasks, "GEMMSTRIDEDBATCHED");
+  AddFillCacheTask<XtrsmBatched<T>>(tasks, "TRSMBATCHED");
+  AddFillCacheTask<XtrsmStridedBatched<T>>(tasks, "TRSMSTRIDEDBATCHED");
+  AddFillCacheTask<XsymmStridedBatched<T>>(tasks, "SYMMSTRIDEDBATCHED");
+  AddFillCacheTask<XsyrkStridedBatched<T>>(tasks, "SYRKSTRIDEDBATCHED");
+  AddFillCacheTask<XtrmmStridedBatched<T>>(tasks, "TRMMSTRIDEDBATCHED");
+  AddFillCacheTask<XinvertBatched<T>>(tasks, "INVERTBATCHED");
+  AddFillCacheTask<Xcsr<T>>(tasks, "CSR");
+  AddFillCacheTask<XgemmMlp<T>>(tasks, "GEMMMLP");
+  AddFillCacheTask<Xpacked<T>>(tasks, "PACKED");
+  AddFillCacheTask<XattentionStridedBatched<T>>(tasks, "ATTENTIONSTRIDEDBATCHED");
+  AddNamedFillCacheTask<Xgemm<T>>(tasks, "GEMMEPILOGUE");
+  AddNamedFillCacheTask<XgemmStridedBatched<T>>(tasks, "GEMMSTRIDEDBATCHEDEPILOGUE");
+  AddNamedFillCacheTask<Xaxpy<T>>(tasks, "AXPYDEVICE");
+  AddNamedFillCacheTask<Xscal<T>>(tasks, "SCALDEVICE");
+  AddNamedFillCacheTask<Xgemv<T>>(tasks, "GEMVDEVICE");
+  AddNamedFillCacheTask<Xgemm<T>>(tasks, "GEMMDEVICE");
+  AddNamedFillCacheTask<Xgemm<T>>(tasks, "GEMMOUTOFPLACE");
+  AddNamedFillCacheTask<Xgemm<T>>(tasks, "GERK");
+}
+
+// All the set-up functions for a complex precision
+template <typename T, typename Real>
+void AddFillCacheTasksComplex(std::vector<FillCacheTask> &tasks) {
+
+  // Adds all the level 1 set-up functions
+  AddFillCacheTask<Xswap<T>>(tasks, "SWAP");
+  AddFillCacheTask<Xscal<T>>(tasks, "SCAL");
+  AddFillCacheTask<Xcopy<T>>(tasks, "COPY");
+  AddFillCacheTask<Xaxpy<T>>(tasks, "AXPY");
+  AddFillCacheTask<Xdotu<T>>(tasks, "DOTU");
+  AddFillCacheTask<Xdotc<T>>(tasks, "DOTC");
+  AddFillCacheTask<Xnrm2<T>>(tasks, "NRM2");
+  AddFillCacheTask<Xasum<T>>(tasks, "ASUM");
+  AddFillCacheTask<Xsum<T>>(tasks, "SUM");
+  AddFillCacheTask<Xamax<T>>(tasks, "AMAX");
+  AddFillCacheTask<Xamin<T>>(tasks, "AMIN");
+  AddFillCacheTask<Xmax<T>>(tasks, "MAX");
+  AddFillCacheTask<Xmin<T>>(tasks, "MIN");
+
+  // Adds all the level 2 set-up functions
+  AddFillCacheTask<Xgemv<T>>(tasks, "GEMV");
+  AddFillCacheTask<Xgbmv<T>>(tasks, "GBMV");
+  AddFillCacheTask<Xhemv<T>>(tasks, "HEMV");
+  AddFillCacheTask<Xhbmv<T>>(tasks, "HBMV");
+  AddFillCacheTask<Xhpmv<T>>(tasks, "HPMV");
+  AddFillCacheTask<Xtrmv<T>>(tasks, "TRMV");
+  AddFillCacheTask<Xtbmv<T>>(tasks, "TBMV");
+  AddFillCacheTask<Xtpmv<T>>(tasks, "TPMV");
+  AddFillCacheTask<Xtrsv<T>>(tasks, "TRSV");
+  AddFillCacheTask<Xtbsv<T>>(tasks, "TBSV");
+  AddFillCacheTask<Xtpsv<T>>(tasks, "TPSV");
+  AddFillCacheTask<Xgeru<T>>(tasks, "GERU");
+  AddFillCacheTask<Xgerc<T>>(tasks, "GERC");
+  AddFillCacheTask<Xher<T,Real>>(tasks, "HER");
+  AddFillCacheTask<Xhpr<T,Real>>(tasks, "HPR");
+  AddFillCacheTask<Xher2<T>>(tasks, "HER2");
+  AddFillCacheTask<Xhpr2<T>>(tasks, "HPR2");
+
+  // Adds all the level 3 set-up functions
+  AddFillCacheTask<Xgemm<T>>(tasks, "GEMM");
+  AddFillCacheTask<Xsymm<T>>(tasks, "SYMM");
+  AddFillCacheTask<Xhemm<T>>(tasks, "HEMM");
+  AddFillCacheTask<Xsyrk<T>>(tasks, "SYRK");
+  AddFillCacheTask<Xherk<T,Real>>(tasks, "HERK");
+  AddFillCacheTask<Xsyr2k<T>>(tasks, "SYR2K");
+  AddFillCacheTask<Xher2k<T,Real>>(tasks, "HER2K");
+  AddFillCacheTask<Xtrmm<T>>(tasks, "TRMM");
+  AddFillCacheTask<Xtrsm<T>>(tasks, "TRSM");
+
+  // Adds all the non-BLAS set-up functions
+  AddFillCacheTask<Xhad<T>>(tasks, "HAD");
+  AddFillCacheTask<Xaxpby<T>>(tasks, "AXPBY");
+  AddFillCacheTask<Xset<T>>(tasks, "SET");
+  AddFillCacheTask<Xomatcopy<T>>(tasks, "OMATCOPY");
+  AddFillCacheTask<XomatcopyStridedBatched<T>>(tasks, "OMATCOPYSTRIDEDBATCHED");
+  AddFillCacheTask<Ximatcopy<T>>(tasks, "IMATCOPY");
+  AddFillCacheTask<Xim2col<T>>(tasks, "IM2COL");
+  AddFillCacheTask<Xim2colStridedBatched<T>>(tasks, "IM2COLSTRIDEDBATCHED");
+  AddFillCacheTask<Xcol2im<T>>(tasks, "COL2IM");
+  AddFillCacheTask<Xcol2imStridedBatched<T>>(tasks, "COL2IMSTRIDEDBATCHED");
+  AddFillCacheTask<XaxpyBatched<T>>(tasks, "AXPYBATCHED");
+  AddFillCacheTask<XaxpyGrouped<T>>(tasks, "AXPYGROUPED");
+  AddFillCacheTask<XaxpyStridedBatched<T>>(tasks, "AXPYSTRIDEDBATCHED");
+  AddFillCacheTask<XaxpbyStridedBatched<T>>(tasks, "AXPBYSTRIDEDBATCHED");
+  AddFillCacheTask<XsetStridedBatched<T>>(tasks, "SETSTRIDEDBATCHED");
+  AddFillCacheTask<XscalStridedBatched<T>>(tasks, "SCALSTRIDEDBATCHED");
+  AddFillCacheTask<Xnrm2StridedBatched<T>>(tasks, "NRM2STRIDEDBATCHED");
+  AddFillCacheTask<XasumStridedBatched<T>>(tasks, "ASUMSTRIDEDBATCHED");
+  AddFillCacheTask<XgemvBatched<T>>(tasks, "GEMVBATCHED");
+  AddFillCacheTask<XgemvStridedBatched<T>>(tasks, "GEMVSTRIDEDBATCHED");
+  AddFillCacheTask<XtrsvStridedBatched<T>>(tasks, "TRSVSTRIDEDBATCHED");
+  AddFillCacheTask<XgemvPair<T>>(tasks, "GEMVPAIR");
+  AddFillCacheTask<XgemmBatched<T>>(tasks, "GEMMBATCHED");
+  AddFillCacheTask<XgemmGrouped<T>>(tasks, "GEMMGROUPED");
+  AddFillCacheTask<XgemmStridedBatched<T>>(tasks, "GEMMSTRIDEDBATCHED");
+  AddFillCacheTask<XtrsmBatched<T>>(tasks, "TRSMBATCHED");
+  AddFillCacheTask<XtrsmStridedBatched<T>>(tasks, "TRSMSTRIDEDBATCHED");
+  AddFillCacheTask<XsymmStridedBatched<T>>(tasks, "SYMMSTRIDEDBATCHED");
+  AddFillCacheTask<XsyrkStridedBatched<T>>(tasks, "SYRKSTRIDEDBATCHED");
+  AddFillCacheTask<XtrmmStridedBatched<T>>(tasks, "TRMMSTRIDEDBATCHED");
+  AddFillCacheTask<XinvertBatched<T>>(tasks, "INVERTBATCHED");
+  AddFillCacheTask<Xcsr<T>>(tasks, "CSR");
+  AddFillCacheTask<XgemmMlp<T>>(tasks, "GEMMMLP");
+  AddFillCacheTask<Xpacked<T>>(tasks, "PACKED");
+  AddNamedFillCacheTask<Xgemm<T>>(tasks, "GEMMEPILOGUE");
+  AddNamedFillCacheTask<XgemmStridedBatched<T>>(tasks, "GEMMSTRIDEDBATCHEDEPILOGUE");
+  AddNamedFillCacheTask<Xaxpy<T>>(tasks, "AXPYDEVICE");
+  AddNamedFillCacheTask<Xscal<T>>(tasks, "SCALDEVICE");
+  AddNamedFillCacheTask<Xgemv<T>>(tasks, "GEMVDEVICE");
+  AddNamedFillCacheTask<Xgemm<T>>(tasks, "GEMMDEVICE");
+  AddNamedFillCacheTask<Xgemm<T>>(tasks, "GEMMOUTOFPLACE");
+}
+
+// Retrieves the set-up functions for the given precisions
+std::vector<FillCacheTask> GetFillCacheTasks(const std::vector<Precision> &precisions) {
+  auto tasks = std::vector<FillCacheTask>();
+  for (const auto precision : precisions) {
+    switch (precision) {
+      case Precision::kHalf: AddFillCacheTasksReal<half>(tasks); break;
+      case Precision::kSingle: AddFillCacheTasksReal<float>(tasks); break;
+      case Precision::kDouble: AddFillCacheTasksReal<double>(tasks); break;
+      case Precision::kComplexSingle: AddFillCacheTasksComplex<float2, float>(tasks); break;
+      case Precision::kComplexDouble: AddFillCacheTasksComplex<double2, double>(tasks); break;
+      default: throw BLASError(StatusCode::kInvalidValue, "FillCache: unsupported precision");
     }
   }
+  return tasks;
 }
 
-// Fills the cache with all binaries for a specific device
-// TODO: Add half-precision FP16 set-up calls
+// Runs the set-up functions on a number of threads. Errors because of unsupported precisions are
+// ignored, other errors are re-thrown after all threads have finished.
+void RunFillCacheTasks(Queue &queue, const std::vector<FillCacheTask> &tasks) {
+  const auto default_num_threads = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  const auto num_threads = std::min(tasks.size(), ConvertArgument(std::getenv("CLBLAST_NUM_COMPILE_THREADS"), default_num_threads));
+  std::atomic<size_t> next_task{0};
+  auto first_error = std::exception_ptr{nullptr};
+  std::mutex error_mutex;
+  const auto worker = [&]() {
+    for (auto i = next_task++; i < tasks.size(); i = next_task++) {
+      try {
+        tasks[i].run(queue, nullptr);
+      } catch (const RuntimeErrorCode &e) {
+        if (e.status() != StatusCode::kNoDoublePrecision &&
+            e.status() != StatusCode::kNoHalfPrecision) {
+          std::lock_guard<std::mutex> lock(error_mutex);
+          if (!first_error) { first_error = std::current_exception(); }
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!first_error) { first_error = std::current_exception(); }
+      }
+    }
+  };
+  auto threads = std::vector<std::thread>();
+  for (auto i = size_t{1}; i < num_threads; ++i) { threads.emplace_back(worker); }
+  worker(); // the calling thread does its share of the work as well
+  for (auto &thread : threads) { thread.join(); }
+  if (first_error) { std::rethrow_exception(first_error); }
+}
+
+// Fills the cache with all binaries for a specific device (half precision is left out, see below)
 StatusCode FillCache(const RawDeviceID device) {
   try {
 
@@ -103,15 +353,146 @@ StatusCode FillCache(const RawDeviceID device) {
     auto context = Context(device_cpp);
     auto queue = Queue(context, device_cpp);
 
-    FillCacheForPrecision<float, float2>(queue);
-    FillCacheForPrecision<double, double2>(queue);
+    const auto tasks = GetFillCacheTasks({Precision::kSingle, Precision::kComplexSingle,
+                                          Precision::kDouble, Precision::kComplexDouble});
+    RunFillCacheTasks(queue, tasks);
+
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// As above, but only for the given routines (e.g. "GEMM" or "axpy") and precisions
+StatusCode FillCache(const RawDeviceID device, const std::vector<std::string> &routines,
+                     const std::vector<Precision> &precisions) {
+  try {
+
+    // Verifies the routine names against the list of all available routines
+    const auto all_tasks = GetFillCacheTasks({Precision::kHalf, Precision::kSingle, Precision::kDouble,
+                                              Precision::kComplexSingle, Precision::kComplexDouble});
+    auto routine_names = std::set<std::string>();
+    for (const auto &routine : routines) {
+      auto routine_name = routine;
+      std::transform(routine_name.begin(), routine_name.end(), routine_name.begin(), ::toupper);
+      const auto is_known = std::any_of(all_tasks.begin(), all_tasks.end(),
+                                        [&](const FillCacheTask &task) { return task.routine == routine_name; });
+      if (!is_known) { throw BLASError(StatusCode::kInvalidValue, "FillCache: unknown routine " + routine); }
+      routine_names.insert(routine_name);
+    }
+
+    // Selects the set-up functions to run
+    auto tasks = std::vector<FillCacheTask>();
+    for (const auto &task : GetFillCacheTasks(precisions)) {
+      if (routine_names.find(task.routine) != routine_names.end()) { tasks.push_back(task); }
+    }
+
+    // Creates a sample context and queue to match the normal routine calling conventions
+    auto device_cpp = Device(device);
+    auto context = Context(device_cpp);
+    auto queue = Queue(context, device_cpp);
+    RunFillCacheTasks(queue, tasks);
+
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// As above, but returns immediately. Unfinished warm-ups are waited for at the end of the process,
+// therefore the caches are created first: they are then destroyed only after the warm-ups are done.
+StatusCode FillCacheAsync(const RawDeviceID device) {
+  try {
+    BinaryCache::Instance(); ProgramCache::Instance(); KernelCache::Instance();
+    DatabaseCache::Instance(); BinaryDiskCache::Instance(); MemoryPool::Instance();
+    static auto warm_ups = std::vector<std::future<StatusCode>>();
+    static std::mutex warm_ups_mutex;
+    std::lock_guard<std::mutex> lock(warm_ups_mutex);
+    warm_ups.push_back(std::async(std::launch::async, [device]() { return FillCache(device); }));
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// Builds the programs of a routine recorded for the profile-guided warm-up. Errors because of
+// unsupported precisions are ignored, as in 'RunFillCacheTasks'.
+void BuildWarmUpPrograms(Queue &queue, const std::string &routine_name, const Precision precision,
+                         const std::vector<WarmUpProgram> &programs) {
+  for (const auto &task : GetFillCacheTasks({precision})) {
+    if (task.routine != routine_name) { continue; }
+    try {
+      task.run(queue, &programs);
+    } catch (const RuntimeErrorCode &e) {
+      if (e.status() != StatusCode::kNoDoublePrecision &&
+          e.status() != StatusCode::kNoHalfPrecision) { throw; }
+    }
+    return;
+  }
+}
 
+// Sets the directory of the on-disk cache of binaries
+StatusCode SetCacheDirectory(const std::string &directory) {
+  try {
+    BinaryDiskCache::Instance().SetDirectory(directory);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// Saves the compiled binaries of the given devices into a single file, or loads such a file
+StatusCode SaveCacheFile(const std::vector<RawDeviceID> &devices, const std::string &file_name) {
+  try {
+    auto devices_cpp = std::vector<Device>();
+    for (const auto &device : devices) { devices_cpp.push_back(Device(device)); }
+    BinaryDiskCache::Instance().SaveFile(devices_cpp, file_name);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+StatusCode LoadCacheFile(const std::string &file_name) {
+  try {
+    BinaryDiskCache::Instance().LoadFile(file_name);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// Configures and trims the pool of temporary buffers
+StatusCode SetMemoryPoolLimit(const size_t bytes) {
+  try {
+    MemoryPool::Instance().SetLimit(bytes);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+StatusCode TrimMemoryPool() {
+  try {
+    MemoryPool::Instance().Trim();
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// Sets the workspace limit of GEMM
+StatusCode SetGemmWorkspaceLimit(const size_t bytes) {
+  try {
+    GemmWorkspace::SetLimit(bytes);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// Sets the chunk limit of GEMM
+StatusCode SetGemmChunkLimit(const size_t multiply_adds) {
+  try {
+    GemmWorkspace::SetChunkLimit(multiply_adds);
   } catch (...) { return DispatchException(); }
   return StatusCode::kSuccess;
 }
 
 // =================================================================================================
 
+// Stores new parameters of a kernel in the cache. The combined database of the regular and the
+// alternative GEMM kernels (see 'Routine::InitAlternativeGemmDatabase') is removed if affected.
+void StoreDatabase(const RawPlatformID platform_id, const RawDeviceID device,
+                   const Precision precision, const std::string &kernel_name, const Database &database) {
+  DatabaseCache::Instance().Remove(DatabaseKey{platform_id, device, precision, kernel_name});
+  DatabaseCache::Instance().Store(DatabaseKey{platform_id, device, precision, kernel_name}, Database(database));
+  if (kernel_name == "Xgemm" || kernel_name == "XgemmAlt" || kernel_name == "GemmRoutine") {
+    DatabaseCache::Instance().Remove(DatabaseKey{platform_id, device, precision,
+                                                 Routine::kXgemmWithAltKernel});
+  }
+}
+
 // Retrieves the current tuning parameters for this device-precision-kernel combination
 StatusCode RetrieveParameters(const RawDeviceID device, const std::string &kernel_name,
                               const Precision precision,
@@ -159,9 +540,12 @@ StatusCode OverrideParameters(const RawDeviceID device, const std::string &kerne
       current_database = Database(device_cpp, kernel_name, precision, {});
     }
 
-    // Verifies the parameters size
+    // Verifies the parameters size, after adding the optional parameters which are not given
+    auto all_parameters = parameters;
+    const auto optional_parameters = Database::GetOptionalParameters(kernel_name);
+    all_parameters.insert(optional_parameters.begin(), optional_parameters.end());
     const auto current_parameter_names = current_database.GetParameterNames();
-    if (current_parameter_names.size() != parameters.size()) {
+    if (current_parameter_names.size() != all_parameters.size()) {
       return StatusCode::kMissingOverrideParameter;
     }
 
@@ -169,10 +553,10 @@ StatusCode OverrideParameters(const RawDeviceID device, const std::string &kerne
     auto parameter_values = database::Params{0};
     auto i = size_t{0};
     for (const auto &current_param : current_parameter_names) {
-      if (parameters.find(current_param) == parameters.end()) {
+      if (all_parameters.find(current_param) == all_parameters.end()) {
         return StatusCode::kMissingOverrideParameter;
       }
-      const auto parameter_value = parameters.at(current_param);
+      const auto parameter_value = all_parameters.at(current_param);
       parameter_values[i] = parameter_value;
       ++i;
     }
@@ -186,9 +570,69 @@ StatusCode OverrideParameters(const RawDeviceID device, const std::string &kerne
     const auto database = Database(device_cpp, kernel_name, precision, database_entries);
 
     // Removes the old database entry and stores the new one in the cache
-    DatabaseCache::Instance().Remove(DatabaseKey{platform_id, device, precision, kernel_name});
-    DatabaseCache::Instance().Store(DatabaseKey{platform_id, device, precision, kernel_name}, Database(database));
+    StoreDatabase(platform_id, device, precision, kernel_name, database);
+
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// As above, but only for problems of at most 'max_size', other problem sizes are not affected
+StatusCode OverrideParametersForSize(const RawDeviceID device, const std::string &kernel_name,
+                                     const Precision precision, const size_t max_size,
+                                     const std::unordered_map<std::string,size_t> &parameters) {
+  try {
+    if (max_size == 0) { return StatusCode::kInvalidValue; }
+
+    // Retrieves the current database values, including earlier (size-specific) overrides
+    const auto device_cpp = Device(device);
+    const auto platform_id = device_cpp.PlatformID();
+    auto in_cache = false;
+    auto current_database = DatabaseCache::Instance().Get(DatabaseKeyRef{platform_id, device, precision, kernel_name}, &in_cache);
+    if (!in_cache) {
+      log_debug("Searching database for kernel '" + kernel_name + "'");
+      current_database = Database(device_cpp, kernel_name, precision, {});
+    }
+
+    // Verifies the parameters size (after adding the optional parameters which are not given), the
+    // names are verified when adding them to the database
+    auto size_parameters = database::Parameters(parameters.begin(), parameters.end());
+    const auto optional_parameters = Database::GetOptionalParameters(kernel_name);
+    size_parameters.insert(optional_parameters.begin(), optional_parameters.end());
+    if (current_database.GetParameterNames().size() != size_parameters.size()) {
+      return StatusCode::kMissingOverrideParameter;
+    }
+    const auto database = current_database.WithSizeVariant(max_size, size_parameters);
+
+    // Removes the old database entry and stores the new one in the cache
+    StoreDatabase(platform_id, device, precision, kernel_name, database);
+
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// Loads additional database entries from a file, the cached parameters are looked up again
+StatusCode LoadDatabaseFile(const std::string &file_name) {
+  try {
+    Database::LoadExternal(file_name);
+    DatabaseCache::Instance().Invalidate();
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
 
+// Registers a GEMM shape for a specialised program, or removes all shapes
+StatusCode RegisterGemmShape(const RawDeviceID device, const Precision precision,
+                             const Layout layout, const Transpose a_transpose,
+                             const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k) {
+  try {
+    if ((m == 0) || (n == 0) || (k == 0)) { return StatusCode::kInvalidDimension; }
+    AddGemmShape(device, precision, layout, a_transpose, b_transpose, m, n, k);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+StatusCode ClearGemmShapes() {
+  try {
+    RemoveGemmShapes();
   } catch (...) { return DispatchException(); }
   return StatusCode::kSuccess;
 }
@@ -13,93 +13,241 @@
 
 #include <string>
 #include <vector>
+#include <array>
+#include <algorithm>
 #include <mutex>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <memory>
+#include <atomic>
+#include <map>
+#include <tuple>
+#include <set>
+#include <functional>
 
 #include "database/database.hpp"
 #include "cache.hpp"
+#include "utilities/compile.hpp"
 
 namespace clblast {
 // =================================================================================================
 
+template <typename Key, typename Value>
+std::shared_ptr<const typename Cache<Key, Value>::Container> Cache<Key, Value>::Snapshot() const {
+  return std::atomic_load(&cache_);
+}
+
+template <typename Key, typename Value>
+std::shared_ptr<typename Cache<Key, Value>::Container> Cache<Key, Value>::CopyOfSnapshot() const {
+  return std::make_shared<Container>(*Snapshot());
+}
+
+template <typename Key, typename Value>
+void Cache<Key, Value>::Publish(std::shared_ptr<Container> &&cache) {
+  std::atomic_store(&cache_, std::shared_ptr<const Container>(std::move(cache)));
+}
+
+// =================================================================================================
+
 template <typename Key, typename Value>
 template <typename U>
 Value Cache<Key, Value>::Get(const U &key, bool *in_cache) const {
-  std::lock_guard<std::mutex> lock(cache_mutex_);
+  const auto cache = Snapshot();
 
 #if __cplusplus >= 201402L
   // generalized std::map::find() of C++14
-  auto it = cache_.find(key);
+  auto it = cache->find(key);
 #else
   // O(n) lookup in a vector
-  auto it = std::find_if(cache_.begin(), cache_.end(), [&] (const std::pair<Key, Value> &pair) {
+  auto it = std::find_if(cache->begin(), cache->end(),
+                         [&] (const typename Container::value_type &pair) {
     return pair.first == key;
   });
 #endif
-  if (it == cache_.end()) {
+  if (it == cache->end()) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
     if (in_cache) {
       *in_cache = false;
     }
     return Value();
   }
 
+  hits_.fetch_add(1, std::memory_order_relaxed);
+  if (limit_.load(std::memory_order_relaxed) != 0) {
+    const auto now = clock_.fetch_add(1, std::memory_order_relaxed) + 1;
+    it->second.last_use->store(now, std::memory_order_relaxed);
+  }
   if (in_cache) {
     *in_cache = true;
   }
-  return it->second;
+  return it->second.value;
+}
+
+// New entries count as used at the time they are stored
+template <typename Key, typename Value>
+typename Cache<Key, Value>::Entry Cache<Key, Value>::NewEntry(Value &&value) const {
+  const auto now = clock_.fetch_add(1, std::memory_order_relaxed) + 1;
+  return Entry{std::move(value), std::make_shared<std::atomic<uint64_t>>(now)};
 }
 
 template <typename Key, typename Value>
 void Cache<Key, Value>::Store(Key &&key, Value &&value) {
   std::lock_guard<std::mutex> lock(cache_mutex_);
+  auto cache = CopyOfSnapshot();
 
 #if __cplusplus >= 201402L
   // emplace() into a map
-  auto r = cache_.emplace(std::move(key), std::move(value));
+  auto r = cache->emplace(std::move(key), NewEntry(std::move(value)));
   if (!r.second) {
     throw LogicError("Cache::Store: object already in cache");
   }
 #else
   // emplace_back() into a vector
-  cache_.emplace_back(std::move(key), std::move(value));
+  cache->emplace_back(std::move(key), NewEntry(std::move(value)));
 #endif
+  Publish(std::move(cache));
+}
+
+template <typename Key, typename Value>
+bool Cache<Key, Value>::StoreIfAbsent(Key &&key, Value &&value) {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  auto cache = CopyOfSnapshot();
+
+#if __cplusplus >= 201402L
+  // emplace() into a map
+  if (!cache->emplace(std::move(key), NewEntry(std::move(value))).second) { return false; }
+#else
+  // emplace_back() into a vector, after an O(n) search
+  auto it = std::find_if(cache->begin(), cache->end(),
+                         [&] (const typename Container::value_type &pair) {
+    return pair.first == key;
+  });
+  if (it != cache->end()) { return false; }
+  cache->emplace_back(std::move(key), NewEntry(std::move(value)));
+#endif
+  Publish(std::move(cache));
+  return true;
+}
+
+template <typename Key, typename Value>
+size_t Cache<Key, Value>::Size() const {
+  return Snapshot()->size();
+}
+
+template <typename Key, typename Value>
+std::vector<std::pair<Key, Value>> Cache<Key, Value>::GetAll() const {
+  const auto cache = Snapshot();
+  auto entries = std::vector<std::pair<Key, Value>>();
+  for (const auto &entry : *cache) {
+    entries.emplace_back(entry.first, entry.second.value);
+  }
+  return entries;
 }
 
 template <typename Key, typename Value>
 void Cache<Key, Value>::Remove(const Key &key) {
   std::lock_guard<std::mutex> lock(cache_mutex_);
+  auto cache = CopyOfSnapshot();
 #if __cplusplus >= 201402L
-  cache_.erase(key);
+  cache->erase(key);
 #else
-  auto it = cache_.begin();
-  while (it != cache_.end()) {
+  auto it = cache->begin();
+  while (it != cache->end()) {
     if ((*it).first == key) {
-      it = cache_.erase(it);
+      it = cache->erase(it);
     }
     else ++it;
   }
 #endif
+  Publish(std::move(cache));
+}
+
+template <typename Key, typename Value>
+template <int I>
+void Cache<Key, Value>::RemoveBySubset(const Key &key) {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  auto cache = CopyOfSnapshot();
+  auto it = cache->begin();
+  while (it != cache->end()) {
+    if (std::get<I>(key) == std::get<I>((*it).first)) {
+      it = cache->erase(it);
+    }
+    else ++it;
+  }
+  Publish(std::move(cache));
 }
 
 template <typename Key, typename Value>
 template <int I1, int I2>
 void Cache<Key, Value>::RemoveBySubset(const Key &key) {
   std::lock_guard<std::mutex> lock(cache_mutex_);
-  auto it = cache_.begin();
-  while (it != cache_.end()) {
+  auto cache = CopyOfSnapshot();
+  auto it = cache->begin();
+  while (it != cache->end()) {
     const auto current_key = (*it).first;
     if ((std::get<I1>(key) == std::get<I1>(current_key)) &&
         (std::get<I2>(key) == std::get<I2>(current_key))) {
-      it = cache_.erase(it);
+      it = cache->erase(it);
+    }
+    else ++it;
+  }
+  Publish(std::move(cache));
+}
+
+template <typename Key, typename Value>
+std::vector<std::pair<Key, Value>> Cache<Key, Value>::RemoveIf(const std::function<bool(const Key &)> &predicate) {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  auto cache = CopyOfSnapshot();
+  auto removed = std::vector<std::pair<Key, Value>>();
+  auto it = cache->begin();
+  while (it != cache->end()) {
+    if (predicate((*it).first)) {
+      removed.emplace_back((*it).first, (*it).second.value);
+      it = cache->erase(it);
+    }
+    else ++it;
+  }
+  if (!removed.empty()) { Publish(std::move(cache)); }
+  return removed;
+}
+
+// The entries used last before the (limit + 1)-th most recent use are removed. Uses concurrent to
+// the eviction might not be taken into account.
+template <typename Key, typename Value>
+std::vector<std::pair<Key, Value>> Cache<Key, Value>::Evict() {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  auto evicted = std::vector<std::pair<Key, Value>>();
+  const auto limit = limit_.load();
+  if (limit == 0 || Snapshot()->size() <= limit) { return evicted; }
+  auto cache = CopyOfSnapshot();
+  const auto num_evicted = cache->size() - limit;
+  auto last_uses = std::vector<uint64_t>();
+  for (const auto &entry : *cache) { last_uses.push_back(entry.second.last_use->load()); }
+  std::nth_element(last_uses.begin(), last_uses.begin() + (num_evicted - 1), last_uses.end());
+  const auto threshold = last_uses[num_evicted - 1];
+  auto it = cache->begin();
+  while (it != cache->end() && evicted.size() < num_evicted) {
+    if ((*it).second.last_use->load() <= threshold) {
+      evicted.emplace_back((*it).first, (*it).second.value);
+      it = cache->erase(it);
     }
     else ++it;
   }
+  Publish(std::move(cache));
+  return evicted;
 }
 
 template <typename Key, typename Value>
 void Cache<Key, Value>::Invalidate() {
   std::lock_guard<std::mutex> lock(cache_mutex_);
 
-  cache_.clear();
+  Publish(std::make_shared<Container>());
 }
 
 template <typename Key, typename Value>
@@ -117,14 +265,271 @@ template std::string BinaryCache::Get(const BinaryKeyRef &, bool *) const;
 
 // =================================================================================================
 
+// Header of a cache file with multiple binaries (see 'SaveFile'), followed by the number of binaries
+// and by each binary as a line with the sizes of its key and its binary, the key, and the binary
+const std::string kBinaryCacheFileHeader = "CLBlast binary cache file v1\n";
+
+namespace {
+
+// Reads a decimal number of a cache file followed by the given separator
+size_t ReadCacheFileSize(const std::string &contents, size_t &position, const char separator) {
+  const auto start = position;
+  auto value = size_t{0};
+  while (position < contents.size() && contents[position] >= '0' && contents[position] <= '9') {
+    value = value * 10 + static_cast<size_t>(contents[position] - '0');
+    ++position;
+  }
+  if (position == start || position >= contents.size() || contents[position] != separator) {
+    throw RuntimeErrorCode(StatusCode::kInvalidValue, "corrupt cache file");
+  }
+  ++position;
+  return value;
+}
+
+} // anonymous namespace
+
+// The directory and the cache file are initialized from the environmental variables (if set).
+// Errors cannot be returned at this point, so they are printed and the cache file is not used.
+BinaryDiskCache::BinaryDiskCache() {
+  const auto environment_variable = std::getenv("CLBLAST_CACHE_DIR");
+  if (environment_variable != nullptr) { directory_ = std::string(environment_variable); }
+  const auto file_variable = std::getenv("CLBLAST_CACHE_FILE");
+  if (file_variable != nullptr && !std::string{file_variable}.empty()) {
+    try {
+      LoadFile(std::string{file_variable});
+    } catch (const std::exception &e) {
+      fprintf(stderr, "CLBlast: could not load the cache file '%s': %s\n", file_variable, e.what());
+    }
+  }
+}
+
+BinaryDiskCache &BinaryDiskCache::Instance() {
+  static BinaryDiskCache instance;
+  return instance;
+}
+
+void BinaryDiskCache::SetDirectory(const std::string &directory) {
+  std::lock_guard<std::mutex> lock(directory_mutex_);
+  directory_ = directory;
+}
+
+std::string BinaryDiskCache::GetDirectory() const {
+  std::lock_guard<std::mutex> lock(directory_mutex_);
+  return directory_;
+}
+
+std::string BinaryDiskCache::GetKey(const Device &device, const Precision precision,
+                                    const std::string &routine_info) {
+  return GetBinaryFileKey(device, precision, routine_info);
+}
+
+bool BinaryDiskCache::Load(const std::string &key, std::string &binary) const {
+  {
+    std::lock_guard<std::mutex> lock(file_mutex_);
+    const auto file_binary = file_binaries_.find(key);
+    if (file_binary != file_binaries_.end()) {
+      binary = file_binary->second;
+      return true;
+    }
+  }
+  const auto directory = GetDirectory();
+  if (directory.empty()) { return false; }
+  return LoadBinaryFile(directory, key, binary);
+}
+
+bool BinaryDiskCache::Contains(const std::string &key) const {
+  {
+    std::lock_guard<std::mutex> lock(file_mutex_);
+    if (file_binaries_.find(key) != file_binaries_.end()) { return true; }
+  }
+  const auto directory = GetDirectory();
+  if (directory.empty()) { return false; }
+  return ContainsBinaryFile(directory, key);
+}
+
+void BinaryDiskCache::Store(const std::string &key, const std::string &binary) const {
+  const auto directory = GetDirectory();
+  if (directory.empty()) { return; }
+  StoreBinaryFile(directory, key, binary);
+}
+
+void BinaryDiskCache::LoadFile(const std::string &file_name) {
+  auto binaries = std::map<std::string, std::string>();
+  if (!file_name.empty()) {
+    std::ifstream file(file_name, std::ios::binary);
+    if (!file) {
+      throw RuntimeErrorCode(StatusCode::kInvalidValue, "cannot open cache file " + file_name);
+    }
+    const auto contents = std::string(std::istreambuf_iterator<char>(file),
+                                      std::istreambuf_iterator<char>());
+    if (contents.compare(0, kBinaryCacheFileHeader.size(), kBinaryCacheFileHeader) != 0) {
+      throw RuntimeErrorCode(StatusCode::kInvalidValue, "not a CLBlast cache file: " + file_name);
+    }
+
+    // Reads the binaries one by one, checking that each fits in the remainder of the file
+    auto position = kBinaryCacheFileHeader.size();
+    const auto num_binaries = ReadCacheFileSize(contents, position, '\n');
+    for (auto i = size_t{0}; i < num_binaries; ++i) {
+      const auto key_size = ReadCacheFileSize(contents, position, ' ');
+      const auto binary_size = ReadCacheFileSize(contents, position, '\n');
+      if (key_size + binary_size > contents.size() - position) {
+        throw RuntimeErrorCode(StatusCode::kInvalidValue, "corrupt cache file: " + file_name);
+      }
+      binaries[contents.substr(position, key_size)] = contents.substr(position + key_size, binary_size);
+      position += key_size + binary_size;
+    }
+  }
+  std::lock_guard<std::mutex> lock(file_mutex_);
+  file_binaries_ = std::move(binaries);
+}
+
+void BinaryDiskCache::SaveFile(const std::vector<Device> &devices,
+                               const std::string &file_name) const {
+
+  // Collects the binaries of the devices, sorted by key
+  auto binaries = std::map<std::string, std::string>();
+  const auto entries = BinaryCache::Instance().GetAll();
+  for (const auto &device : devices) {
+    const auto platform_id = device.PlatformID();
+    const auto device_name = GetDeviceName(device);
+    for (const auto &entry : entries) {
+      if (std::get<0>(entry.first) == platform_id && std::get<3>(entry.first) == device_name) {
+        const auto key = GetKey(device, std::get<1>(entry.first), std::get<2>(entry.first));
+        binaries[key] = entry.second;
+      }
+    }
+  }
+
+  // Writes the file
+  std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    throw RuntimeErrorCode(StatusCode::kInvalidValue, "cannot write cache file " + file_name);
+  }
+  file << kBinaryCacheFileHeader << binaries.size() << "\n";
+  for (const auto &binary : binaries) {
+    file << binary.first.size() << " " << binary.second.size() << "\n" << binary.first;
+    file.write(binary.second.data(), static_cast<std::streamsize>(binary.second.size()));
+  }
+  if (!file) {
+    throw RuntimeErrorCode(StatusCode::kInvalidValue, "cannot write cache file " + file_name);
+  }
+}
+
+// =================================================================================================
+
 template class Cache<ProgramKey, Program>;
 template Program ProgramCache::Get(const ProgramKeyRef &, bool *) const;
 template void ProgramCache::RemoveBySubset<1, 2>(const ProgramKey &); // precision and routine name
 
 // =================================================================================================
 
+template class Cache<KernelKey, Kernel>;
+template Kernel KernelCache::Get(const KernelKeyRef &, bool *) const;
+template void KernelCache::RemoveBySubset<1>(const KernelKey &);
+
+namespace {
+
+  // Removes the kernel objects of removed programs, such that the programs are released
+  void RemoveKernels(const std::vector<std::pair<ProgramKey, Program>> &programs) {
+    if (programs.empty()) { return; }
+    auto raw_programs = std::set<RawProgram>();
+    for (const auto &program : programs) { raw_programs.insert(program.second.GetRawProgram()); }
+    KernelCache::Instance().RemoveIf([&raw_programs](const KernelKey &key) {
+      return raw_programs.find(std::get<0>(key)) != raw_programs.end();
+    });
+  }
+
+  bool InitProgramCacheLimitFromEnvironment() {
+    const auto environment_variable = std::getenv("CLBLAST_PROGRAM_CACHE_LIMIT");
+    if (environment_variable == nullptr) { return false; }
+    ProgramCache::Instance().SetLimit(ConvertArgument(environment_variable, size_t{0}));
+    return true;
+  }
+  bool ProgramCacheLimitFromEnvironment() {
+    static const auto from_environment = InitProgramCacheLimitFromEnvironment();
+    return from_environment;
+  }
+} // anonymous namespace
+
+void StoreProgram(ProgramKey &&key, Program &&program) {
+  ProgramCacheLimitFromEnvironment();
+  ProgramCache::Instance().Store(std::move(key), std::move(program));
+  RemoveKernels(ProgramCache::Instance().Evict());
+}
+
+void LimitProgramCache(const size_t max_programs) {
+  ProgramCacheLimitFromEnvironment(); // first applies the environmental variable, overridden here
+  ProgramCache::Instance().SetLimit(max_programs);
+  RemoveKernels(ProgramCache::Instance().Evict());
+}
+
+void RemoveContextPrograms(const RawContext context) {
+  RemoveKernels(ProgramCache::Instance().RemoveIf([context](const ProgramKey &key) {
+    return std::get<0>(key) == context;
+  }));
+}
+
+// =================================================================================================
+
+template class Cache<RawDeviceID, DeviceLimits>;
+template DeviceLimits DeviceLimitsCache::Get(const RawDeviceID &, bool *) const;
+
+DeviceLimits GetDeviceLimits(const Device &device) {
+  bool in_cache;
+  auto limits = DeviceLimitsCache::Instance().Get(device(), &in_cache);
+  if (in_cache) { return limits; }
+  limits.max_work_item_dimensions = device.MaxWorkItemDimensions();
+  const auto max_work_item_sizes = device.MaxWorkItemSizes();
+  const auto num_sizes = std::min(limits.max_work_item_sizes.size(), max_work_item_sizes.size());
+  for (auto i = size_t{0}; i < num_sizes; ++i) {
+    limits.max_work_item_sizes[i] = max_work_item_sizes[i];
+  }
+  limits.max_work_group_size = device.MaxWorkGroupSize();
+  limits.local_mem_size = device.LocalMemSize();
+  limits.max_alloc_size = device.MaxAllocSize();
+  limits.memory_size = device.MemorySize();
+  DeviceLimitsCache::Instance().StoreIfAbsent(RawDeviceID{device()}, DeviceLimits{limits});
+  return limits;
+}
+
+// =================================================================================================
+
 template class Cache<DatabaseKey, Database>;
 template Database DatabaseCache::Get(const DatabaseKeyRef &, bool *) const;
 
+// =================================================================================================
+
+#ifdef OPENCL_API
+
+template class Cache<cl_mem, size_t>;
+template size_t BufferSizeCache::Get(const cl_mem &, bool *) const;
+
+namespace {
+
+  // Every new entry copies the snapshot of the cache, so buffers beyond this number of live ones
+  // are not cached but queried every time instead
+  constexpr auto kMaxCachedBufferSizes = size_t{4096};
+
+  // Called by OpenCL before a buffer is deleted, i.e. before its handle can be re-used
+  void CL_CALLBACK RemoveBufferSize(cl_mem buffer, void*) {
+    BufferSizeCache::Instance().Remove(buffer);
+  }
+} // anonymous namespace
+
+size_t GetCachedBufferSize(const cl_mem buffer) {
+  bool in_cache;
+  auto size = BufferSizeCache::Instance().Get(buffer, &in_cache);
+  if (in_cache) { return size; }
+  CheckError(clGetMemObjectInfo(buffer, CL_MEM_SIZE, sizeof(size_t), &size, nullptr));
+  if (BufferSizeCache::Instance().Size() < kMaxCachedBufferSizes &&
+      BufferSizeCache::Instance().StoreIfAbsent(cl_mem{buffer}, size_t{size})) {
+    CheckError(clSetMemObjectDestructorCallback(buffer, RemoveBufferSize, nullptr));
+  }
+  return size;
+}
+
+#endif
+
+
 // =================================================================================================
 } // namespace clblast
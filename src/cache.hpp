@@ -15,8 +15,14 @@
 #define CLBLAST_CACHE_H_
 
 #include <string>
+#include <vector>
+#include <array>
+#include <atomic>
 #include <mutex>
 #include <map>
+#include <memory>
+#include <thread>
+#include <functional>
 
 #include "utilities/utilities.hpp"
 
@@ -28,6 +34,11 @@ namespace clblast {
 // Hence, searching by non-Key is supported (if there is a corresponding operator<()), and
 // on Store() the Key instance is moved from the caller (because it will likely be constructed
 // as temporary at the time of Store()).
+// Lookups are much more frequent than modifications, therefore the entries are kept in an immutable
+// snapshot: Get() only atomically copies the pointer to the current snapshot and never takes the
+// lock, while modifications (serialised by the lock) replace the snapshot by a modified copy.
+// Optionally, the number of entries is limited: Get() then also records the time of last use of
+// each entry, and Evict() removes the least-recently used entries beyond the limit.
 template <typename Key, typename Value>
 class Cache {
 public:
@@ -40,26 +51,65 @@ public:
   // We do not return references to just stored object to avoid racing with Invalidate().
   // Caller is expected to store a temporary.
   void Store(Key &&key, Value &&value);
+  bool StoreIfAbsent(Key &&key, Value &&value); // as above, returns false if already in the cache
   void Invalidate();
 
+  // Retrieves the number of entries
+  size_t Size() const;
+
+  // Retrieves a copy of all entries
+  std::vector<std::pair<Key, Value>> GetAll() const;
+
   // Removes all entries with a given key
   void Remove(const Key &key);
-  template <int I1, int I2> void RemoveBySubset(const Key &key); // currently supports 2 indices
+  template <int I> void RemoveBySubset(const Key &key); // removes all entries matching index I
+  template <int I1, int I2> void RemoveBySubset(const Key &key); // as above, for 2 indices
+
+  // Removes all entries for which the predicate holds, returns the removed entries
+  std::vector<std::pair<Key, Value>> RemoveIf(const std::function<bool(const Key &)> &predicate);
+
+  // Sets the maximum number of entries (zero for no limit) and removes the least-recently used
+  // entries beyond it, returning the removed entries. Store() does not evict by itself.
+  void SetLimit(const size_t max_entries) { limit_ = max_entries; }
+  std::vector<std::pair<Key, Value>> Evict();
 
   static Cache<Key, Value> &Instance();
 
+  // The number of hits and misses of 'Get' (see 'GetStatistics')
+  size_t NumHits() const { return hits_.load(std::memory_order_relaxed); }
+  size_t NumMisses() const { return misses_.load(std::memory_order_relaxed); }
+  void ResetStatistics() { hits_ = 0; misses_ = 0; }
+
 private:
+  // An entry with the time of its last use (see 'SetLimit'), shared between the snapshots
+  struct Entry {
+    Value value;
+    std::shared_ptr<std::atomic<uint64_t>> last_use;
+  };
+  Entry NewEntry(Value &&value) const;
+
 #if __cplusplus >= 201402L
   // The std::less<void> allows to search in cache by an object comparable with Key, without
   // constructing a temporary Key
   // (see http://en.cppreference.com/w/cpp/utility/functional/less_void,
   //      http://www.open-std.org/JTC1/SC22/WG21/docs/papers/2013/n3657.htm,
   //      http://stackoverflow.com/questions/10536788/avoiding-key-construction-for-stdmapfind)
-  std::map<Key, Value, std::less<void>> cache_;
+  using Container = std::map<Key, Entry, std::less<void>>;
 #else
-  std::vector<std::pair<Key, Value>> cache_;
+  using Container = std::vector<std::pair<Key, Entry>>;
 #endif
-  mutable std::mutex cache_mutex_;
+
+  // Helpers for the snapshot: retrieves the current one or a modifiable copy of it, and replaces it
+  std::shared_ptr<const Container> Snapshot() const;
+  std::shared_ptr<Container> CopyOfSnapshot() const;
+  void Publish(std::shared_ptr<Container> &&cache);
+
+  std::shared_ptr<const Container> cache_ = std::make_shared<Container>();
+  mutable std::mutex cache_mutex_; // serialises the modifications
+  mutable std::atomic<size_t> hits_{0};
+  mutable std::atomic<size_t> misses_{0};
+  std::atomic<size_t> limit_{0};
+  mutable std::atomic<uint64_t> clock_{0}; // the time of last use is a count of uses
 
   static Cache<Key, Value> instance_;
 }; // class Cache
@@ -78,16 +128,128 @@ extern template std::string BinaryCache::Get(const BinaryKeyRef &, bool *) const
 
 // =================================================================================================
 
+// The optional persistent (on-disk) cache of compiled binaries. This sits behind the in-memory
+// BinaryCache: binaries are loaded from disk on a miss and written to disk after a successful
+// build, such that compilation costs are not paid again by every new process. The cache is
+// disabled unless a directory is set, either through 'SetCacheDirectory' or through the
+// 'CLBLAST_CACHE_DIR' environmental variable. Files are replaced atomically (written to a
+// temporary file first and then renamed), so multiple processes can safely share a directory.
+// Binaries can also be packaged into a single cache file (see 'SaveCacheFile'), e.g. to ship them
+// with an application. The binaries of a loaded cache file are used before those in the directory.
+class BinaryDiskCache {
+ public:
+
+  // Sets or retrieves the cache directory, an empty string disables the on-disk cache
+  void SetDirectory(const std::string &directory);
+  std::string GetDirectory() const;
+
+  // Constructs the key for a specific device and compiled routine (see 'GetBinaryFileKey')
+  static std::string GetKey(const Device &device, const Precision precision,
+                            const std::string &routine_info);
+
+  // Loads a binary from disk, returns false on a miss (or if the on-disk cache is disabled)
+  bool Load(const std::string &key, std::string &binary) const;
+
+  // Whether a binary is available, as 'Load' but without reading the binary itself
+  bool Contains(const std::string &key) const;
+
+  // Stores a binary on disk, failures are not considered errors and are silently ignored
+  void Store(const std::string &key, const std::string &binary) const;
+
+  // Loads the binaries of a cache file, replacing those of an earlier file. An empty file name
+  // removes them again. The default file is taken from the 'CLBLAST_CACHE_FILE' variable (if set).
+  void LoadFile(const std::string &file_name);
+
+  // Saves the binaries of the given devices in the in-memory cache (see 'BinaryCache') into a cache
+  // file, keyed in the same way as the files in the directory
+  void SaveFile(const std::vector<Device> &devices, const std::string &file_name) const;
+
+  static BinaryDiskCache &Instance();
+
+ private:
+  BinaryDiskCache();
+
+  std::string directory_;
+  mutable std::mutex directory_mutex_;
+  std::map<std::string, std::string> file_binaries_;
+  mutable std::mutex file_mutex_;
+}; // class BinaryDiskCache
+
+// =================================================================================================
+
 // The key struct for the cache of compiled OpenCL programs (context-dependent)
-// Order of fields: context, device_id, precision, routine_name (smaller fields first)
-typedef std::tuple<RawContext, RawDeviceID, Precision, std::string> ProgramKey;
-typedef std::tuple<const RawContext &, const RawDeviceID &, const Precision &, const std::string &> ProgramKeyRef;
+// Order of fields: context, device_id, precision, routine fingerprint (see Routine::InitProgram)
+typedef std::tuple<RawContext, RawDeviceID, Precision, uint64_t> ProgramKey;
+typedef std::tuple<const RawContext &, const RawDeviceID &, const Precision &, const uint64_t &> ProgramKeyRef;
 
 typedef Cache<ProgramKey, Program> ProgramCache;
 
 extern template class Cache<ProgramKey, Program>;
 extern template Program ProgramCache::Get(const ProgramKeyRef &, bool *) const;
 
+// Stores a program in the above cache. In case the number of programs exceeds the limit (see
+// 'SetProgramCacheLimit'), the least-recently used ones are removed together with their kernel
+// objects. The limit is initialized from the 'CLBLAST_PROGRAM_CACHE_LIMIT' variable (if set).
+void StoreProgram(ProgramKey &&key, Program &&program);
+void LimitProgramCache(const size_t max_programs);
+
+// Removes all programs of a context and their kernel objects from the caches, after which the
+// caches don't hold any references to the context anymore (see 'ClearContextCache')
+void RemoveContextPrograms(const RawContext context);
+
+// =================================================================================================
+
+// The key struct for the cache of kernel objects. The program already implies the context and the
+// device. Kernel arguments are mutable state, so each host thread gets its own kernel object. The
+// kernel objects of a thread are removed when it exits (see 'GetKernel').
+// Order of fields: program, thread_id, kernel_name (smaller fields first)
+typedef std::tuple<RawProgram, std::thread::id, std::string> KernelKey;
+typedef std::tuple<const RawProgram &, const std::thread::id &, const char* const &> KernelKeyRef;
+
+typedef Cache<KernelKey, Kernel> KernelCache;
+
+extern template class Cache<KernelKey, Kernel>;
+extern template Kernel KernelCache::Get(const KernelKeyRef &, bool *) const;
+
+// =================================================================================================
+
+#ifdef OPENCL_API
+
+// The cache of the sizes of the buffers passed to the routines, such that checking the arguments
+// doesn't query the size of every buffer from the OpenCL runtime on every call. The size of a
+// buffer never changes, its entry is removed by a destructor callback when the buffer is released.
+typedef Cache<cl_mem, size_t> BufferSizeCache;
+
+extern template class Cache<cl_mem, size_t>;
+extern template size_t BufferSizeCache::Get(const cl_mem &, bool *) const;
+
+// Retrieves the size in bytes of a buffer from the above cache, queries and caches it on a miss
+size_t GetCachedBufferSize(const cl_mem buffer);
+
+#endif
+
+// =================================================================================================
+
+// The limits of a device which are checked at every kernel launch (see 'RunKernel') or GEMM call
+// (see 'GemmWorkspace'), such that these don't query them from the runtime. CLBlast's kernels use
+// at most 3 dimensions.
+struct DeviceLimits {
+  size_t max_work_item_dimensions = 0;
+  std::array<size_t, 3> max_work_item_sizes = {{0, 0, 0}};
+  size_t max_work_group_size = 0;
+  unsigned long local_mem_size = 0;
+  unsigned long max_alloc_size = 0;
+  unsigned long memory_size = 0;
+};
+
+typedef Cache<RawDeviceID, DeviceLimits> DeviceLimitsCache;
+
+extern template class Cache<RawDeviceID, DeviceLimits>;
+extern template DeviceLimits DeviceLimitsCache::Get(const RawDeviceID &, bool *) const;
+
+// Retrieves the limits of a device from the above cache, queries and caches them on a miss
+DeviceLimits GetDeviceLimits(const Device &device);
+
 // =================================================================================================
 
 class Database;
@@ -14,8 +14,17 @@
 // =================================================================================================
 
 #include <string>
+#include <utility>
 
 #include "routines/routines.hpp"
+#include "profiling.hpp"
+#include "statistics.hpp"
+#include "online_tuning.hpp"
+#include "tiered_compilation.hpp"
+#include "warm_up.hpp"
+#include "external_memory.hpp"
+#include "explanation.hpp"
+#include "handle.hpp"
 #include "clblast.h"
 
 namespace clblast {
@@ -26,12 +35,24 @@ namespace clblast {
 
 // Generate givens plane rotation: SROTG/DROTG
 template <typename T>
-StatusCode Rotg(cl_mem, const size_t,
-                cl_mem, const size_t,
-                cl_mem, const size_t,
-                cl_mem, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotg(cl_mem sa_buffer, const size_t sa_offset,
+                cl_mem sb_buffer, const size_t sb_offset,
+                cl_mem sc_buffer, const size_t sc_offset,
+                cl_mem ss_buffer, const size_t ss_offset,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("ROTG", static_cast<int>(PrecisionValue<T>()),
+                 {{"sa_offset", sa_offset}, {"sb_offset", sb_offset}, {"sc_offset", sc_offset}, {"ss_offset", ss_offset}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrotg<T>(queue_cpp, event);
+    routine.DoRotg(Buffer<T>(sa_buffer), sa_offset,
+                   Buffer<T>(sb_buffer), sb_offset,
+                   Buffer<T>(sc_buffer), sc_offset,
+                   Buffer<T>(ss_buffer), ss_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotg<float>(cl_mem, const size_t,
                                            cl_mem, const size_t,
@@ -46,13 +67,26 @@ template StatusCode PUBLIC_API Rotg<double>(cl_mem, const size_t,
 
 // Generate modified givens plane rotation: SROTMG/DROTMG
 template <typename T>
-StatusCode Rotmg(cl_mem, const size_t,
-                 cl_mem, const size_t,
-                 cl_mem, const size_t,
-                 const cl_mem, const size_t,
-                 cl_mem, const size_t,
-                 cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotmg(cl_mem sd1_buffer, const size_t sd1_offset,
+                 cl_mem sd2_buffer, const size_t sd2_offset,
+                 cl_mem sx1_buffer, const size_t sx1_offset,
+                 const cl_mem sy1_buffer, const size_t sy1_offset,
+                 cl_mem sparam_buffer, const size_t sparam_offset,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("ROTMG", static_cast<int>(PrecisionValue<T>()),
+                 {{"sy1_offset", sy1_offset}, {"sd1_offset", sd1_offset}, {"sd2_offset", sd2_offset}, {"sx1_offset", sx1_offset}, {"sparam_offset", sparam_offset}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrotmg<T>(queue_cpp, event);
+    routine.DoRotmg(Buffer<T>(sd1_buffer), sd1_offset,
+                    Buffer<T>(sd2_buffer), sd2_offset,
+                    Buffer<T>(sx1_buffer), sx1_offset,
+                    Buffer<T>(sy1_buffer), sy1_offset,
+                    Buffer<T>(sparam_buffer), sparam_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotmg<float>(cl_mem, const size_t,
                                             cl_mem, const size_t,
@@ -69,13 +103,26 @@ template StatusCode PUBLIC_API Rotmg<double>(cl_mem, const size_t,
 
 // Apply givens plane rotation: SROT/DROT
 template <typename T>
-StatusCode Rot(const size_t,
-               cl_mem, const size_t, const size_t,
-               cl_mem, const size_t, const size_t,
-               const T,
-               const T,
-               cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rot(const size_t n,
+               cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+               const T cos,
+               const T sin,
+               cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("ROT", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrot<T>(queue_cpp, event);
+    routine.DoRot(n,
+                  Buffer<T>(x_buffer), x_offset, x_inc,
+                  Buffer<T>(y_buffer), y_offset, y_inc,
+                  cos,
+                  sin);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rot<float>(const size_t,
                                           cl_mem, const size_t, const size_t,
@@ -92,12 +139,24 @@ template StatusCode PUBLIC_API Rot<double>(const size_t,
 
 // Apply modified givens plane rotation: SROTM/DROTM
 template <typename T>
-StatusCode Rotm(const size_t,
-                cl_mem, const size_t, const size_t,
-                cl_mem, const size_t, const size_t,
-                cl_mem, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotm(const size_t n,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_mem sparam_buffer, const size_t sparam_offset,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("ROTM", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"sparam_offset", sparam_offset}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrotm<T>(queue_cpp, event);
+    routine.DoRotm(n,
+                   Buffer<T>(x_buffer), x_offset, x_inc,
+                   Buffer<T>(y_buffer), y_offset, y_inc,
+                   Buffer<T>(sparam_buffer), sparam_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotm<float>(const size_t,
                                            cl_mem, const size_t, const size_t,
@@ -117,6 +176,10 @@ StatusCode Swap(const size_t n,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SWAP", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xswap<T>(queue_cpp, event);
     routine.DoSwap(n,
@@ -153,6 +216,10 @@ StatusCode Scal(const size_t n,
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SCAL", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xscal<T>(queue_cpp, event);
     routine.DoScal(n,
@@ -189,6 +256,10 @@ StatusCode Copy(const size_t n,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("COPY", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xcopy<T>(queue_cpp, event);
     routine.DoCopy(n,
@@ -226,6 +297,10 @@ StatusCode Axpy(const size_t n,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("AXPY", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xaxpy<T>(queue_cpp, event);
     routine.DoAxpy(n,
@@ -269,6 +344,10 @@ StatusCode Dot(const size_t n,
                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("DOT", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"dot_offset", dot_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xdot<T>(queue_cpp, event);
     routine.DoDot(n,
@@ -302,6 +381,10 @@ StatusCode Dotu(const size_t n,
                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("DOTU", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"dot_offset", dot_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xdotu<T>(queue_cpp, event);
     routine.DoDotu(n,
@@ -330,6 +413,10 @@ StatusCode Dotc(const size_t n,
                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("DOTC", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"dot_offset", dot_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xdotc<T>(queue_cpp, event);
     routine.DoDotc(n,
@@ -357,6 +444,10 @@ StatusCode Nrm2(const size_t n,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("NRM2", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"nrm2_offset", nrm2_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xnrm2<T>(queue_cpp, event);
     routine.DoNrm2(n,
@@ -393,6 +484,10 @@ StatusCode Asum(const size_t n,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("ASUM", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"asum_offset", asum_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xasum<T>(queue_cpp, event);
     routine.DoAsum(n,
@@ -429,6 +524,10 @@ StatusCode Sum(const size_t n,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SUM", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"sum_offset", sum_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xsum<T>(queue_cpp, event);
     routine.DoSum(n,
@@ -465,6 +564,10 @@ StatusCode Amax(const size_t n,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("AMAX", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"imax_offset", imax_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xamax<T>(queue_cpp, event);
     routine.DoAmax(n,
@@ -501,6 +604,10 @@ StatusCode Amin(const size_t n,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("AMIN", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"imin_offset", imin_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xamin<T>(queue_cpp, event);
     routine.DoAmin(n,
@@ -537,6 +644,10 @@ StatusCode Max(const size_t n,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("MAX", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"imax_offset", imax_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xmax<T>(queue_cpp, event);
     routine.DoMax(n,
@@ -573,6 +684,10 @@ StatusCode Min(const size_t n,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("MIN", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"imin_offset", imin_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xmin<T>(queue_cpp, event);
     routine.DoMin(n,
@@ -617,6 +732,10 @@ StatusCode Gemv(const Layout layout, const Transpose a_transpose,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("GEMV", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xgemv<T>(queue_cpp, event);
     routine.DoGemv(layout, a_transpose,
@@ -681,6 +800,10 @@ StatusCode Gbmv(const Layout layout, const Transpose a_transpose,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("GBMV", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"kl", kl}, {"ku", ku}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xgbmv<T>(queue_cpp, event);
     routine.DoGbmv(layout, a_transpose,
@@ -745,6 +868,10 @@ StatusCode Hemv(const Layout layout, const Triangle triangle,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("HEMV", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xhemv<T>(queue_cpp, event);
     routine.DoHemv(layout, triangle,
@@ -785,6 +912,10 @@ StatusCode Hbmv(const Layout layout, const Triangle triangle,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("HBMV", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xhbmv<T>(queue_cpp, event);
     routine.DoHbmv(layout, triangle,
@@ -825,6 +956,10 @@ StatusCode Hpmv(const Layout layout, const Triangle triangle,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("HPMV", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"ap_offset", ap_offset}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xhpmv<T>(queue_cpp, event);
     routine.DoHpmv(layout, triangle,
@@ -865,6 +1000,10 @@ StatusCode Symv(const Layout layout, const Triangle triangle,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SYMV", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xsymv<T>(queue_cpp, event);
     routine.DoSymv(layout, triangle,
@@ -913,6 +1052,10 @@ StatusCode Sbmv(const Layout layout, const Triangle triangle,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SBMV", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xsbmv<T>(queue_cpp, event);
     routine.DoSbmv(layout, triangle,
@@ -961,6 +1104,10 @@ StatusCode Spmv(const Layout layout, const Triangle triangle,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SPMV", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"ap_offset", ap_offset}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xspmv<T>(queue_cpp, event);
     routine.DoSpmv(layout, triangle,
@@ -1006,6 +1153,10 @@ StatusCode Trmv(const Layout layout, const Triangle triangle, const Transpose a_
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("TRMV", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xtrmv<T>(queue_cpp, event);
     routine.DoTrmv(layout, triangle, a_transpose, diagonal,
@@ -1049,6 +1200,10 @@ StatusCode Tbmv(const Layout layout, const Triangle triangle, const Transpose a_
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("TBMV", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xtbmv<T>(queue_cpp, event);
     routine.DoTbmv(layout, triangle, a_transpose, diagonal,
@@ -1092,6 +1247,10 @@ StatusCode Tpmv(const Layout layout, const Triangle triangle, const Transpose a_
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("TPMV", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"ap_offset", ap_offset}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xtpmv<T>(queue_cpp, event);
     routine.DoTpmv(layout, triangle, a_transpose, diagonal,
@@ -1135,6 +1294,10 @@ StatusCode Trsv(const Layout layout, const Triangle triangle, const Transpose a_
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("TRSV", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xtrsv<T>(queue_cpp, event);
     routine.DoTrsv(layout, triangle, a_transpose, diagonal,
@@ -1167,12 +1330,24 @@ template StatusCode PUBLIC_API Trsv<double2>(const Layout, const Triangle, const
 
 // Solves a banded triangular system of equations: STBSV/DTBSV/CTBSV/ZTBSV
 template <typename T>
-StatusCode Tbsv(const Layout, const Triangle, const Transpose, const Diagonal,
-                const size_t, const size_t,
-                const cl_mem, const size_t, const size_t,
-                cl_mem, const size_t, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Tbsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n, const size_t k,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("TBSV", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xtbsv<T>(queue_cpp, event);
+    routine.DoTbsv(layout, triangle, a_transpose, diagonal,
+                   n, k,
+                   Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Tbsv<float>(const Layout, const Triangle, const Transpose, const Diagonal,
                                            const size_t, const size_t,
@@ -1197,12 +1372,24 @@ template StatusCode PUBLIC_API Tbsv<double2>(const Layout, const Triangle, const
 
 // Solves a packed triangular system of equations: STPSV/DTPSV/CTPSV/ZTPSV
 template <typename T>
-StatusCode Tpsv(const Layout, const Triangle, const Transpose, const Diagonal,
-                const size_t,
-                const cl_mem, const size_t,
-                cl_mem, const size_t, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Tpsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n,
+                const cl_mem ap_buffer, const size_t ap_offset,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("TPSV", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"ap_offset", ap_offset}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xtpsv<T>(queue_cpp, event);
+    routine.DoTpsv(layout, triangle, a_transpose, diagonal,
+                   n,
+                   Buffer<T>(ap_buffer), ap_offset,
+                   Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Tpsv<float>(const Layout, const Triangle, const Transpose, const Diagonal,
                                            const size_t,
@@ -1235,6 +1422,10 @@ StatusCode Ger(const Layout layout,
                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("GER", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xger<T>(queue_cpp, event);
     routine.DoGer(layout,
@@ -1278,6 +1469,10 @@ StatusCode Geru(const Layout layout,
                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("GERU", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xgeru<T>(queue_cpp, event);
     routine.DoGeru(layout,
@@ -1314,6 +1509,10 @@ StatusCode Gerc(const Layout layout,
                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("GERC", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xgerc<T>(queue_cpp, event);
     routine.DoGerc(layout,
@@ -1349,6 +1548,10 @@ StatusCode Her(const Layout layout, const Triangle triangle,
                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("HER", static_cast<int>(PrecisionValue<std::complex<T>>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xher<std::complex<T>,T>(queue_cpp, event);
     routine.DoHer(layout, triangle,
@@ -1381,6 +1584,10 @@ StatusCode Hpr(const Layout layout, const Triangle triangle,
                cl_mem ap_buffer, const size_t ap_offset,
                cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("HPR", static_cast<int>(PrecisionValue<std::complex<T>>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"ap_offset", ap_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xhpr<std::complex<T>,T>(queue_cpp, event);
     routine.DoHpr(layout, triangle,
@@ -1414,6 +1621,10 @@ StatusCode Her2(const Layout layout, const Triangle triangle,
                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("HER2", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xher2<T>(queue_cpp, event);
     routine.DoHer2(layout, triangle,
@@ -1450,6 +1661,10 @@ StatusCode Hpr2(const Layout layout, const Triangle triangle,
                 cl_mem ap_buffer, const size_t ap_offset,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("HPR2", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"ap_offset", ap_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xhpr2<T>(queue_cpp, event);
     routine.DoHpr2(layout, triangle,
@@ -1485,6 +1700,10 @@ StatusCode Syr(const Layout layout, const Triangle triangle,
                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SYR", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xsyr<T>(queue_cpp, event);
     routine.DoSyr(layout, triangle,
@@ -1523,6 +1742,10 @@ StatusCode Spr(const Layout layout, const Triangle triangle,
                cl_mem ap_buffer, const size_t ap_offset,
                cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SPR", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"ap_offset", ap_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xspr<T>(queue_cpp, event);
     routine.DoSpr(layout, triangle,
@@ -1562,6 +1785,10 @@ StatusCode Syr2(const Layout layout, const Triangle triangle,
                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SYR2", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xsyr2<T>(queue_cpp, event);
     routine.DoSyr2(layout, triangle,
@@ -1605,6 +1832,10 @@ StatusCode Spr2(const Layout layout, const Triangle triangle,
                 cl_mem ap_buffer, const size_t ap_offset,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SPR2", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"ap_offset", ap_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xspr2<T>(queue_cpp, event);
     routine.DoSpr2(layout, triangle,
@@ -1654,6 +1885,10 @@ StatusCode Gemm(const Layout layout, const Transpose a_transpose, const Transpos
                 cl_command_queue* queue, cl_event* event,
                 cl_mem temp_buffer) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("GEMM", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"b_transpose", static_cast<size_t>(b_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"c_offset", c_offset}, {"c_ld", c_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xgemm<T>(queue_cpp, event);
     const auto temp_buffer_provided = temp_buffer != nullptr;
@@ -1721,6 +1956,10 @@ StatusCode Symm(const Layout layout, const Side side, const Triangle triangle,
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SYMM", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"c_offset", c_offset}, {"c_ld", c_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xsymm<T>(queue_cpp, event);
     routine.DoSymm(layout, side, triangle,
@@ -1785,6 +2024,10 @@ StatusCode Hemm(const Layout layout, const Side side, const Triangle triangle,
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("HEMM", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"c_offset", c_offset}, {"c_ld", c_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xhemm<T>(queue_cpp, event);
     routine.DoHemm(layout, side, triangle,
@@ -1824,6 +2067,10 @@ StatusCode Syrk(const Layout layout, const Triangle triangle, const Transpose a_
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SYRK", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"c_offset", c_offset}, {"c_ld", c_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xsyrk<T>(queue_cpp, event);
     routine.DoSyrk(layout, triangle, a_transpose,
@@ -1881,6 +2128,10 @@ StatusCode Herk(const Layout layout, const Triangle triangle, const Transpose a_
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("HERK", static_cast<int>(PrecisionValue<std::complex<T>>()),
+                 {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"c_offset", c_offset}, {"c_ld", c_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xherk<std::complex<T>,T>(queue_cpp, event);
     routine.DoHerk(layout, triangle, a_transpose,
@@ -1918,6 +2169,10 @@ StatusCode Syr2k(const Layout layout, const Triangle triangle, const Transpose a
                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                  cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SYR2K", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"ab_transpose", static_cast<size_t>(ab_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"c_offset", c_offset}, {"c_ld", c_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xsyr2k<T>(queue_cpp, event);
     routine.DoSyr2k(layout, triangle, ab_transpose,
@@ -1982,6 +2237,10 @@ StatusCode Her2k(const Layout layout, const Triangle triangle, const Transpose a
                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                  cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("HER2K", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"ab_transpose", static_cast<size_t>(ab_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"c_offset", c_offset}, {"c_ld", c_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xher2k<T,U>(queue_cpp, event);
     routine.DoHer2k(layout, triangle, ab_transpose,
@@ -2020,6 +2279,10 @@ StatusCode Trmm(const Layout layout, const Side side, const Triangle triangle, c
                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("TRMM", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xtrmm<T>(queue_cpp, event);
     routine.DoTrmm(layout, side, triangle, a_transpose, diagonal,
@@ -2070,6 +2333,10 @@ StatusCode Trsm(const Layout layout, const Side side, const Triangle triangle, c
                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("TRSM", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xtrsm<T>(queue_cpp, event);
     routine.DoTrsm(layout, side, triangle, a_transpose, diagonal,
@@ -2119,6 +2386,10 @@ StatusCode Had(const size_t n,
                cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
                cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("HAD", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"z_offset", z_offset}, {"z_inc", z_inc}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xhad<T>(queue_cpp, event);
     routine.DoHad(n,
@@ -2166,6 +2437,100 @@ template StatusCode PUBLIC_API Had<half>(const size_t,
                                          cl_mem, const size_t, const size_t,
                                          cl_command_queue*, cl_event*);
 
+// Scaling and addition of two vectors (non-BLAS function): SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+template <typename T>
+StatusCode Axpby(const size_t n,
+                 const T alpha,
+                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta,
+                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("AXPBY", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xaxpby<T>(queue_cpp, event);
+    routine.DoAxpby(n,
+                    alpha,
+                    Buffer<T>(x_buffer), x_offset, x_inc,
+                    beta,
+                    Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Axpby<float>(const size_t,
+                                            const float,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpby<double>(const size_t,
+                                             const double,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpby<float2>(const size_t,
+                                             const float2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const float2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpby<double2>(const size_t,
+                                              const double2,
+                                              const cl_mem, const size_t, const size_t,
+                                              const double2,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpby<half>(const size_t,
+                                           const half,
+                                           const cl_mem, const size_t, const size_t,
+                                           const half,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+
+// Sets all elements of a vector to a scalar value (non-BLAS function): SSET/DSET/CSET/ZSET/HSET
+template <typename T>
+StatusCode Set(const size_t n,
+               const T alpha,
+               cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SET", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xset<T>(queue_cpp, event);
+    routine.DoSet(n,
+                  alpha,
+                  Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Set<float>(const size_t,
+                                          const float,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Set<double>(const size_t,
+                                           const double,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Set<float2>(const size_t,
+                                           const float2,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Set<double2>(const size_t,
+                                            const double2,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Set<half>(const size_t,
+                                         const half,
+                                         cl_mem, const size_t, const size_t,
+                                         cl_command_queue*, cl_event*);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 template <typename T>
 StatusCode Omatcopy(const Layout layout, const Transpose a_transpose,
@@ -2175,6 +2540,10 @@ StatusCode Omatcopy(const Layout layout, const Transpose a_transpose,
                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
                     cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("OMATCOPY", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xomatcopy<T>(queue_cpp, event);
     routine.DoOmatcopy(layout, a_transpose,
@@ -2223,6 +2592,10 @@ StatusCode Im2col(const size_t channels, const size_t height, const size_t width
                   cl_mem col_buffer, const size_t col_offset,
                   cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("IM2COL", static_cast<int>(PrecisionValue<T>()),
+                 {{"channels", channels}, {"height", height}, {"width", width}, {"kernel_h", kernel_h}, {"kernel_w", kernel_w}, {"pad_h", pad_h}, {"pad_w", pad_w}, {"stride_h", stride_h}, {"stride_w", stride_w}, {"dilation_h", dilation_h}, {"dilation_w", dilation_w}, {"im_offset", im_offset}, {"col_offset", col_offset}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = Xim2col<T>(queue_cpp, event);
     routine.DoIm2col(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
@@ -2252,6 +2625,148 @@ template StatusCode PUBLIC_API Im2col<half>(const size_t, const size_t, const si
                                             cl_mem, const size_t,
                                             cl_command_queue*, cl_event*);
 
+// Col2im function (non-BLAS function): SCOL2IM/DCOL2IM/CCOL2IM/ZCOL2IM/HCOL2IM
+template <typename T>
+StatusCode Col2im(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                  const cl_mem col_buffer, const size_t col_offset,
+                  cl_mem im_buffer, const size_t im_offset,
+                  cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("COL2IM", static_cast<int>(PrecisionValue<T>()),
+                 {{"channels", channels}, {"height", height}, {"width", width}, {"kernel_h", kernel_h}, {"kernel_w", kernel_w}, {"pad_h", pad_h}, {"pad_w", pad_w}, {"stride_h", stride_h}, {"stride_w", stride_w}, {"dilation_h", dilation_h}, {"dilation_w", dilation_w}, {"col_offset", col_offset}, {"im_offset", im_offset}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xcol2im<T>(queue_cpp, event);
+    routine.DoCol2im(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                     Buffer<T>(col_buffer), col_offset,
+                     Buffer<T>(im_buffer), im_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Col2im<float>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                             const cl_mem, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Col2im<double>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                              const cl_mem, const size_t,
+                                              cl_mem, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Col2im<float2>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                              const cl_mem, const size_t,
+                                              cl_mem, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Col2im<double2>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                               const cl_mem, const size_t,
+                                               cl_mem, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Col2im<half>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                            const cl_mem, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+
+// Fused dot product, Euclidian norm and absolute sum (non-BLAS function): SDOTNRM2ASUM/DDOTNRM2ASUM/HDOTNRM2ASUM
+template <typename T>
+StatusCode Dotnrm2asum(const size_t n,
+                       cl_mem results_buffer, const size_t results_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("DOTNRM2ASUM", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"results_offset", results_offset}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xdotnrm2asum<T>(queue_cpp, event);
+    routine.DoDotnrm2asum(n,
+                          Buffer<T>(results_buffer), results_offset,
+                          Buffer<T>(x_buffer), x_offset, x_inc,
+                          Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Dotnrm2asum<float>(const size_t,
+                                                  cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Dotnrm2asum<double>(const size_t,
+                                                   cl_mem, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Dotnrm2asum<half>(const size_t,
+                                                 cl_mem, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+
+// Batched convolution as GEMM (non-BLAS function): SCONVGEMM/DCONVGEMM/HCONVGEMM
+template <typename T>
+StatusCode Convgemm(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const size_t num_kernels, const size_t batch_count,
+                    const cl_mem im_buffer, const size_t im_offset,
+                    const cl_mem kernel_buffer, const size_t kernel_offset,
+                    cl_mem result_buffer, const size_t result_offset,
+                    cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("CONVGEMM", static_cast<int>(PrecisionValue<T>()),
+                 {{"channels", channels}, {"height", height}, {"width", width}, {"kernel_h", kernel_h}, {"kernel_w", kernel_w}, {"pad_h", pad_h}, {"pad_w", pad_w}, {"stride_h", stride_h}, {"stride_w", stride_w}, {"dilation_h", dilation_h}, {"dilation_w", dilation_w}, {"num_kernels", num_kernels}, {"batch_count", batch_count}, {"im_offset", im_offset}, {"kernel_offset", kernel_offset}, {"result_offset", result_offset}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xconvgemm<T>(queue_cpp, event);
+    routine.DoConvgemm(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count,
+                       Buffer<T>(im_buffer), im_offset,
+                       Buffer<T>(kernel_buffer), kernel_offset,
+                       Buffer<T>(result_buffer), result_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Convgemm<float>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                               const cl_mem, const size_t,
+                                               const cl_mem, const size_t,
+                                               cl_mem, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convgemm<double>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                const cl_mem, const size_t,
+                                                const cl_mem, const size_t,
+                                                cl_mem, const size_t,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convgemm<half>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                              const cl_mem, const size_t,
+                                              const cl_mem, const size_t,
+                                              cl_mem, const size_t,
+                                              cl_command_queue*, cl_event*);
+
+// Cholesky factorisation (non-BLAS function): SPOTRF/DPOTRF
+template <typename T>
+StatusCode Potrf(const Layout layout, const Triangle triangle,
+                 const size_t n,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("POTRF", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xpotrf<T>(queue_cpp, event);
+    routine.DoPotrf(layout, triangle,
+                    n,
+                    Buffer<T>(a_buffer), a_offset, a_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Potrf<float>(const Layout, const Triangle,
+                                            const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Potrf<double>(const Layout, const Triangle,
+                                             const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+
 // Batched version of AXPY: SAXPYBATCHED/DAXPYBATCHED/CAXPYBATCHED/ZAXPYBATCHED/HAXPYBATCHED
 template <typename T>
 StatusCode AxpyBatched(const size_t n,
@@ -2261,6 +2776,10 @@ StatusCode AxpyBatched(const size_t n,
                        const size_t batch_count,
                        cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("AXPYBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_inc", x_inc}, {"y_inc", y_inc}, {"batch_count", batch_count}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = XaxpyBatched<T>(queue_cpp, event);
     auto alphas_cpp = std::vector<T>();
@@ -2310,22 +2829,163 @@ template StatusCode PUBLIC_API AxpyBatched<half>(const size_t,
                                                  const size_t,
                                                  cl_command_queue*, cl_event*);
 
-// Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
+// Batched version of ROT: SROTBATCHED/DROTBATCHED
 template <typename T>
-StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
-                       const size_t m, const size_t n, const size_t k,
-                       const T *alphas,
-                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
-                       const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
-                       const T *betas,
-                       cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld,
-                       const size_t batch_count,
-                       cl_command_queue* queue, cl_event* event) {
+StatusCode RotBatched(const size_t n,
+                      cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                      const T *coss,
+                      const T *sins,
+                      const size_t batch_count,
+                      cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("ROTBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_inc", x_inc}, {"y_inc", y_inc}, {"batch_count", batch_count}});
+    }
     auto queue_cpp = Queue(*queue);
-    auto routine = XgemmBatched<T>(queue_cpp, event);
-    auto alphas_cpp = std::vector<T>();
-    auto betas_cpp = std::vector<T>();
+    auto routine = XrotBatched<T>(queue_cpp, event);
+    auto coss_cpp = std::vector<T>();
+    auto sins_cpp = std::vector<T>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      coss_cpp.push_back(coss[batch]);
+      sins_cpp.push_back(sins[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+    }
+    routine.DoRotBatched(n,
+                         Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                         Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                         coss_cpp,
+                         sins_cpp,
+                         batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API RotBatched<float>(const size_t,
+                                                 cl_mem, const size_t*, const size_t,
+                                                 cl_mem, const size_t*, const size_t,
+                                                 const float*,
+                                                 const float*,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API RotBatched<double>(const size_t,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  const double*,
+                                                  const double*,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+template <typename T>
+StatusCode GemvBatched(const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const T *betas,
+                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("GEMVBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_ld", a_ld}, {"x_inc", x_inc}, {"y_inc", y_inc}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemvBatched<T>(queue_cpp, event);
+    auto alphas_cpp = std::vector<T>();
+    auto betas_cpp = std::vector<T>();
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      betas_cpp.push_back(betas[batch]);
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+    }
+    routine.DoGemvBatched(layout, a_transpose,
+                          m, n,
+                          alphas_cpp,
+                          Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          betas_cpp,
+                          Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvBatched<float>(const Layout, const Transpose,
+                                                  const size_t, const size_t,
+                                                  const float*,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const float*,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<double>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const double*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const double*,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<float2>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const float2*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const float2*,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<double2>(const Layout, const Transpose,
+                                                    const size_t, const size_t,
+                                                    const double2*,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    const double2*,
+                                                    cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<half>(const Layout, const Transpose,
+                                                 const size_t, const size_t,
+                                                 const half*,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const half*,
+                                                 cl_mem, const size_t*, const size_t,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+
+// Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
+template <typename T>
+StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t m, const size_t n, const size_t k,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                       const T *betas,
+                       cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("GEMMBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"b_transpose", static_cast<size_t>(b_transpose)}, {"a_ld", a_ld}, {"b_ld", b_ld}, {"c_ld", c_ld}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmBatched<T>(queue_cpp, event);
+    auto alphas_cpp = std::vector<T>();
+    auto betas_cpp = std::vector<T>();
     auto a_offsets_cpp = std::vector<size_t>();
     auto b_offsets_cpp = std::vector<size_t>();
     auto c_offsets_cpp = std::vector<size_t>();
@@ -2405,6 +3065,10 @@ StatusCode GemmStridedBatched(const Layout layout, const Transpose a_transpose,
                               const size_t batch_count,
                               cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("GEMMSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"b_transpose", static_cast<size_t>(b_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"b_stride", b_stride}, {"c_offset", c_offset}, {"c_ld", c_ld}, {"c_stride", c_stride}, {"batch_count", batch_count}});
+    }
     auto queue_cpp = Queue(*queue);
     auto routine = XgemmStridedBatched<T>(queue_cpp, event);
     routine.DoGemmStridedBatched(layout, a_transpose, b_transpose,
@@ -2464,59 +3128,4101 @@ template StatusCode PUBLIC_API GemmStridedBatched<half>(const Layout, const Tran
                                                         const size_t,
                                                         cl_command_queue*, cl_event*);
 
-// =================================================================================================
-
-// Retrieves the required size of the temporary buffer for the GEMM kernel (optional)
+// Batched version of TRSM: STRSMBATCHED/DTRSMBATCHED/CTRSMBATCHED/ZTRSMBATCHED
 template <typename T>
-StatusCode GemmTempBufferSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
-                              const size_t m, const size_t n, const size_t k,
-                              const size_t a_offset, const size_t a_ld,
-                              const size_t b_offset, const size_t b_ld,
-                              const size_t c_offset, const size_t c_ld,
-                              cl_command_queue* queue, size_t& temp_buffer_size) {
+StatusCode TrsmBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
   try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("TRSMBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_ld", a_ld}, {"b_ld", b_ld}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XtrsmBatched<T>(queue_cpp, event);
+    auto alphas_cpp = std::vector<T>();
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto b_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      b_offsets_cpp.push_back(b_offsets[batch]);
+    }
+    routine.DoTrsmBatched(layout, side, triangle, a_transpose, diagonal,
+                          m, n,
+                          alphas_cpp,
+                          Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                          Buffer<T>(b_buffer), b_offsets_cpp, b_ld,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API TrsmBatched<float>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                  const size_t, const size_t,
+                                                  const float*,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmBatched<double>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                   const size_t, const size_t,
+                                                   const double*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmBatched<float2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                   const size_t, const size_t,
+                                                   const float2*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmBatched<double2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                    const size_t, const size_t,
+                                                    const double2*,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
 
-    // Retrieves the tuning database
-    const auto queue_cpp = Queue(*queue);
-    const auto device = queue_cpp.GetDevice();
-    const auto kernel_names = std::vector<std::string>{"Xgemm", "GemmRoutine"};
-    Databases db(kernel_names);
-    Routine::InitDatabase(device, kernel_names, PrecisionValue<T>(), {}, db);
-
-    // Computes the buffer size
-    if (Xgemm<T>::UseDirectKernel(m, n, k, db["XGEMM_MIN_INDIRECT_SIZE"])) {
-      temp_buffer_size = 0;
+// StridedBatched version of TRSM: STRSMSTRIDEDBATCHED/DTRSMSTRIDEDBATCHED/CTRSMSTRIDEDBATCHED/ZTRSMSTRIDEDBATCHED
+template <typename T>
+StatusCode TrsmStridedBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("TRSMSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"b_stride", b_stride}, {"batch_count", batch_count}});
     }
-    else {
-      temp_buffer_size = Xgemm<T>::GetTempSize(layout, a_transpose, b_transpose, m, n, k,
-                                               a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
-                                               db["MWG"], db["NWG"], db["KWG"] * db["KREG"],
-                                               db["GEMMK"]);
+    auto queue_cpp = Queue(*queue);
+    auto routine = XtrsmStridedBatched<T>(queue_cpp, event);
+    routine.DoTrsmStridedBatched(layout, side, triangle, a_transpose, diagonal,
+                                 m, n,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(b_buffer), b_offset, b_ld, b_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API TrsmStridedBatched<float>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                         const size_t, const size_t,
+                                                         const float,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmStridedBatched<double>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t, const size_t,
+                                                          const double,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmStridedBatched<float2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t, const size_t,
+                                                          const float2,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmStridedBatched<double2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                           const size_t, const size_t,
+                                                           const double2,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+
+// StridedBatched version of SYMM: SSYMMSTRIDEDBATCHED/DSYMMSTRIDEDBATCHED/CSYMMSTRIDEDBATCHED/ZSYMMSTRIDEDBATCHED/HSYMMSTRIDEDBATCHED
+template <typename T>
+StatusCode SymmStridedBatched(const Layout layout, const Side side, const Triangle triangle,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const T beta,
+                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SYMMSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"b_stride", b_stride}, {"c_offset", c_offset}, {"c_ld", c_ld}, {"c_stride", c_stride}, {"batch_count", batch_count}});
     }
-    temp_buffer_size *= sizeof(T); // translate from num-elements to bytes
+    auto queue_cpp = Queue(*queue);
+    auto routine = XsymmStridedBatched<T>(queue_cpp, event);
+    routine.DoSymmStridedBatched(layout, side, triangle,
+                                 m, n,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(b_buffer), b_offset, b_ld, b_stride,
+                                 beta,
+                                 Buffer<T>(c_buffer), c_offset, c_ld, c_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API SymmStridedBatched<float>(const Layout, const Side, const Triangle,
+                                                         const size_t, const size_t,
+                                                         const float,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const float,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SymmStridedBatched<double>(const Layout, const Side, const Triangle,
+                                                          const size_t, const size_t,
+                                                          const double,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const double,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SymmStridedBatched<float2>(const Layout, const Side, const Triangle,
+                                                          const size_t, const size_t,
+                                                          const float2,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const float2,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SymmStridedBatched<double2>(const Layout, const Side, const Triangle,
+                                                           const size_t, const size_t,
+                                                           const double2,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const double2,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SymmStridedBatched<half>(const Layout, const Side, const Triangle,
+                                                        const size_t, const size_t,
+                                                        const half,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const half,
+                                                        cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// StridedBatched version of SYRK: SSYRKSTRIDEDBATCHED/DSYRKSTRIDEDBATCHED/CSYRKSTRIDEDBATCHED/ZSYRKSTRIDEDBATCHED/HSYRKSTRIDEDBATCHED
+template <typename T>
+StatusCode SyrkStridedBatched(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                              const size_t n, const size_t k,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const T beta,
+                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SYRKSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"c_offset", c_offset}, {"c_ld", c_ld}, {"c_stride", c_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XsyrkStridedBatched<T>(queue_cpp, event);
+    routine.DoSyrkStridedBatched(layout, triangle, a_transpose,
+                                 n, k,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 beta,
+                                 Buffer<T>(c_buffer), c_offset, c_ld, c_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API SyrkStridedBatched<float>(const Layout, const Triangle, const Transpose,
+                                                         const size_t, const size_t,
+                                                         const float,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const float,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SyrkStridedBatched<double>(const Layout, const Triangle, const Transpose,
+                                                          const size_t, const size_t,
+                                                          const double,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const double,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SyrkStridedBatched<float2>(const Layout, const Triangle, const Transpose,
+                                                          const size_t, const size_t,
+                                                          const float2,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const float2,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SyrkStridedBatched<double2>(const Layout, const Triangle, const Transpose,
+                                                           const size_t, const size_t,
+                                                           const double2,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const double2,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SyrkStridedBatched<half>(const Layout, const Triangle, const Transpose,
+                                                        const size_t, const size_t,
+                                                        const half,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const half,
+                                                        cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// StridedBatched version of TRMM: STRMMSTRIDEDBATCHED/DTRMMSTRIDEDBATCHED/CTRMMSTRIDEDBATCHED/ZTRMMSTRIDEDBATCHED/HTRMMSTRIDEDBATCHED
+template <typename T>
+StatusCode TrmmStridedBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("TRMMSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"b_stride", b_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XtrmmStridedBatched<T>(queue_cpp, event);
+    routine.DoTrmmStridedBatched(layout, side, triangle, a_transpose, diagonal,
+                                 m, n,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(b_buffer), b_offset, b_ld, b_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API TrmmStridedBatched<float>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                         const size_t, const size_t,
+                                                         const float,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrmmStridedBatched<double>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t, const size_t,
+                                                          const double,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrmmStridedBatched<float2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t, const size_t,
+                                                          const float2,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrmmStridedBatched<double2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                           const size_t, const size_t,
+                                                           const double2,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrmmStridedBatched<half>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                        const size_t, const size_t,
+                                                        const half,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// Batched inversion of triangular matrices: SINVERTBATCHED/DINVERTBATCHED/CINVERTBATCHED/ZINVERTBATCHED
+template <typename T>
+StatusCode InvertBatched(const Layout layout, const Triangle triangle, const Diagonal diagonal,
+                         const size_t n,
+                         const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                         cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                         const size_t batch_count,
+                         cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("INVERTBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_ld", a_ld}, {"b_ld", b_ld}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XinvertBatched<T>(queue_cpp, event);
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto b_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      b_offsets_cpp.push_back(b_offsets[batch]);
+    }
+    routine.DoInvertBatched(layout, triangle, diagonal,
+                            n,
+                            Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                            Buffer<T>(b_buffer), b_offsets_cpp, b_ld,
+                            batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API InvertBatched<float>(const Layout, const Triangle, const Diagonal,
+                                                    const size_t,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API InvertBatched<double>(const Layout, const Triangle, const Diagonal,
+                                                     const size_t,
+                                                     const cl_mem, const size_t*, const size_t,
+                                                     cl_mem, const size_t*, const size_t,
+                                                     const size_t,
+                                                     cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API InvertBatched<float2>(const Layout, const Triangle, const Diagonal,
+                                                     const size_t,
+                                                     const cl_mem, const size_t*, const size_t,
+                                                     cl_mem, const size_t*, const size_t,
+                                                     const size_t,
+                                                     cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API InvertBatched<double2>(const Layout, const Triangle, const Diagonal,
+                                                      const size_t,
+                                                      const cl_mem, const size_t*, const size_t,
+                                                      cl_mem, const size_t*, const size_t,
+                                                      const size_t,
+                                                      cl_command_queue*, cl_event*);
+
+// StridedBatched version of POTRF: SPOTRFSTRIDEDBATCHED/DPOTRFSTRIDEDBATCHED
+template <typename T>
+StatusCode PotrfStridedBatched(const Layout layout, const Triangle triangle,
+                               const size_t n,
+                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                               const size_t batch_count,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("POTRFSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XpotrfStridedBatched<T>(queue_cpp, event);
+    routine.DoPotrfStridedBatched(layout, triangle,
+                                  n,
+                                  Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                  batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API PotrfStridedBatched<float>(const Layout, const Triangle,
+                                                          const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API PotrfStridedBatched<double>(const Layout, const Triangle,
+                                                           const size_t,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+
+// StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+template <typename T>
+StatusCode GemvStridedBatched(const Layout layout, const Transpose a_transpose,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const T beta,
+                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("GEMVSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"y_stride", y_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemvStridedBatched<T>(queue_cpp, event);
+    routine.DoGemvStridedBatched(layout, a_transpose,
+                                 m, n,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 beta,
+                                 Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvStridedBatched<float>(const Layout, const Transpose,
+                                                         const size_t, const size_t,
+                                                         const float,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const float,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<double>(const Layout, const Transpose,
+                                                          const size_t, const size_t,
+                                                          const double,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const double,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<float2>(const Layout, const Transpose,
+                                                          const size_t, const size_t,
+                                                          const float2,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const float2,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<double2>(const Layout, const Transpose,
+                                                           const size_t, const size_t,
+                                                           const double2,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const double2,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<half>(const Layout, const Transpose,
+                                                        const size_t, const size_t,
+                                                        const half,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const half,
+                                                        cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// StridedBatched version of TRSV: STRSVSTRIDEDBATCHED/DTRSVSTRIDEDBATCHED/CTRSVSTRIDEDBATCHED/ZTRSVSTRIDEDBATCHED
+template <typename T>
+StatusCode TrsvStridedBatched(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t n,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("TRSVSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XtrsvStridedBatched<T>(queue_cpp, event);
+    routine.DoTrsvStridedBatched(layout, triangle, a_transpose, diagonal,
+                                 n,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API TrsvStridedBatched<float>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                         const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsvStridedBatched<double>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsvStridedBatched<float2>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsvStridedBatched<double2>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                           const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+
+// StridedBatched version of OMATCOPY: SOMATCOPYSTRIDEDBATCHED/DOMATCOPYSTRIDEDBATCHED/COMATCOPYSTRIDEDBATCHED/ZOMATCOPYSTRIDEDBATCHED/HOMATCOPYSTRIDEDBATCHED
+template <typename T>
+StatusCode OmatcopyStridedBatched(const Layout layout, const Transpose a_transpose,
+                                  const size_t m, const size_t n,
+                                  const T alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                  cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                  const size_t batch_count,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("OMATCOPYSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"b_stride", b_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XomatcopyStridedBatched<T>(queue_cpp, event);
+    routine.DoOmatcopyStridedBatched(layout, a_transpose,
+                                     m, n,
+                                     alpha,
+                                     Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                     Buffer<T>(b_buffer), b_offset, b_ld, b_stride,
+                                     batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API OmatcopyStridedBatched<float>(const Layout, const Transpose,
+                                                             const size_t, const size_t,
+                                                             const float,
+                                                             const cl_mem, const size_t, const size_t, const size_t,
+                                                             cl_mem, const size_t, const size_t, const size_t,
+                                                             const size_t,
+                                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API OmatcopyStridedBatched<double>(const Layout, const Transpose,
+                                                              const size_t, const size_t,
+                                                              const double,
+                                                              const cl_mem, const size_t, const size_t, const size_t,
+                                                              cl_mem, const size_t, const size_t, const size_t,
+                                                              const size_t,
+                                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API OmatcopyStridedBatched<float2>(const Layout, const Transpose,
+                                                              const size_t, const size_t,
+                                                              const float2,
+                                                              const cl_mem, const size_t, const size_t, const size_t,
+                                                              cl_mem, const size_t, const size_t, const size_t,
+                                                              const size_t,
+                                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API OmatcopyStridedBatched<double2>(const Layout, const Transpose,
+                                                               const size_t, const size_t,
+                                                               const double2,
+                                                               const cl_mem, const size_t, const size_t, const size_t,
+                                                               cl_mem, const size_t, const size_t, const size_t,
+                                                               const size_t,
+                                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API OmatcopyStridedBatched<half>(const Layout, const Transpose,
+                                                            const size_t, const size_t,
+                                                            const half,
+                                                            const cl_mem, const size_t, const size_t, const size_t,
+                                                            cl_mem, const size_t, const size_t, const size_t,
+                                                            const size_t,
+                                                            cl_command_queue*, cl_event*);
+
+// StridedBatched version of IM2COL: SIM2COLSTRIDEDBATCHED/DIM2COLSTRIDEDBATCHED/CIM2COLSTRIDEDBATCHED/ZIM2COLSTRIDEDBATCHED/HIM2COLSTRIDEDBATCHED
+template <typename T>
+StatusCode Im2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                const size_t batch_count,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("IM2COLSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"channels", channels}, {"height", height}, {"width", width}, {"kernel_h", kernel_h}, {"kernel_w", kernel_w}, {"pad_h", pad_h}, {"pad_w", pad_w}, {"stride_h", stride_h}, {"stride_w", stride_w}, {"dilation_h", dilation_h}, {"dilation_w", dilation_w}, {"im_offset", im_offset}, {"im_stride", im_stride}, {"col_offset", col_offset}, {"col_stride", col_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xim2colStridedBatched<T>(queue_cpp, event);
+    routine.DoIm2colStridedBatched(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                   Buffer<T>(im_buffer), im_offset, im_stride,
+                                   Buffer<T>(col_buffer), col_offset, col_stride,
+                                   batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Im2colStridedBatched<float>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t,
+                                                           cl_mem, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Im2colStridedBatched<double>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                            const cl_mem, const size_t, const size_t,
+                                                            cl_mem, const size_t, const size_t,
+                                                            const size_t,
+                                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Im2colStridedBatched<float2>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                            const cl_mem, const size_t, const size_t,
+                                                            cl_mem, const size_t, const size_t,
+                                                            const size_t,
+                                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Im2colStridedBatched<double2>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                             const cl_mem, const size_t, const size_t,
+                                                             cl_mem, const size_t, const size_t,
+                                                             const size_t,
+                                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Im2colStridedBatched<half>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+
+// StridedBatched version of COL2IM: SCOL2IMSTRIDEDBATCHED/DCOL2IMSTRIDEDBATCHED/CCOL2IMSTRIDEDBATCHED/ZCOL2IMSTRIDEDBATCHED/HCOL2IMSTRIDEDBATCHED
+template <typename T>
+StatusCode Col2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                const cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                const size_t batch_count,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("COL2IMSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"channels", channels}, {"height", height}, {"width", width}, {"kernel_h", kernel_h}, {"kernel_w", kernel_w}, {"pad_h", pad_h}, {"pad_w", pad_w}, {"stride_h", stride_h}, {"stride_w", stride_w}, {"dilation_h", dilation_h}, {"dilation_w", dilation_w}, {"col_offset", col_offset}, {"col_stride", col_stride}, {"im_offset", im_offset}, {"im_stride", im_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xcol2imStridedBatched<T>(queue_cpp, event);
+    routine.DoCol2imStridedBatched(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                   Buffer<T>(col_buffer), col_offset, col_stride,
+                                   Buffer<T>(im_buffer), im_offset, im_stride,
+                                   batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Col2imStridedBatched<float>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t,
+                                                           cl_mem, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Col2imStridedBatched<double>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                            const cl_mem, const size_t, const size_t,
+                                                            cl_mem, const size_t, const size_t,
+                                                            const size_t,
+                                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Col2imStridedBatched<float2>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                            const cl_mem, const size_t, const size_t,
+                                                            cl_mem, const size_t, const size_t,
+                                                            const size_t,
+                                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Col2imStridedBatched<double2>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                             const cl_mem, const size_t, const size_t,
+                                                             cl_mem, const size_t, const size_t,
+                                                             const size_t,
+                                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Col2imStridedBatched<half>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+
+// StridedBatched version of AXPY: SAXPYSTRIDEDBATCHED/DAXPYSTRIDEDBATCHED/CAXPYSTRIDEDBATCHED/ZAXPYSTRIDEDBATCHED/HAXPYSTRIDEDBATCHED
+template <typename T>
+StatusCode AxpyStridedBatched(const size_t n,
+                              const T alpha,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("AXPYSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"y_stride", y_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XaxpyStridedBatched<T>(queue_cpp, event);
+    routine.DoAxpyStridedBatched(n,
+                                 alpha,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AxpyStridedBatched<float>(const size_t,
+                                                         const float,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyStridedBatched<double>(const size_t,
+                                                          const double,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyStridedBatched<float2>(const size_t,
+                                                          const float2,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyStridedBatched<double2>(const size_t,
+                                                           const double2,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyStridedBatched<half>(const size_t,
+                                                        const half,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// StridedBatched version of AXPBY: SAXPBYSTRIDEDBATCHED/DAXPBYSTRIDEDBATCHED/CAXPBYSTRIDEDBATCHED/ZAXPBYSTRIDEDBATCHED/HAXPBYSTRIDEDBATCHED
+template <typename T>
+StatusCode AxpbyStridedBatched(const size_t n,
+                               const T alpha,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                               const T beta,
+                               cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                               const size_t batch_count,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("AXPBYSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"y_stride", y_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XaxpbyStridedBatched<T>(queue_cpp, event);
+    routine.DoAxpbyStridedBatched(n,
+                                  alpha,
+                                  Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                  beta,
+                                  Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                                  batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AxpbyStridedBatched<float>(const size_t,
+                                                          const float,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const float,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpbyStridedBatched<double>(const size_t,
+                                                           const double,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const double,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpbyStridedBatched<float2>(const size_t,
+                                                           const float2,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const float2,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpbyStridedBatched<double2>(const size_t,
+                                                            const double2,
+                                                            const cl_mem, const size_t, const size_t, const size_t,
+                                                            const double2,
+                                                            cl_mem, const size_t, const size_t, const size_t,
+                                                            const size_t,
+                                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpbyStridedBatched<half>(const size_t,
+                                                         const half,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const half,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+
+// StridedBatched version of SET: SSETSTRIDEDBATCHED/DSETSTRIDEDBATCHED/CSETSTRIDEDBATCHED/ZSETSTRIDEDBATCHED/HSETSTRIDEDBATCHED
+template <typename T>
+StatusCode SetStridedBatched(const size_t n,
+                             const T alpha,
+                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                             const size_t batch_count,
+                             cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SETSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XsetStridedBatched<T>(queue_cpp, event);
+    routine.DoSetStridedBatched(n,
+                                alpha,
+                                Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API SetStridedBatched<float>(const size_t,
+                                                        const float,
+                                                        cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SetStridedBatched<double>(const size_t,
+                                                         const double,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SetStridedBatched<float2>(const size_t,
+                                                         const float2,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SetStridedBatched<double2>(const size_t,
+                                                          const double2,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SetStridedBatched<half>(const size_t,
+                                                       const half,
+                                                       cl_mem, const size_t, const size_t, const size_t,
+                                                       const size_t,
+                                                       cl_command_queue*, cl_event*);
+
+// StridedBatched version of SCAL: SSCALSTRIDEDBATCHED/DSCALSTRIDEDBATCHED/CSCALSTRIDEDBATCHED/ZSCALSTRIDEDBATCHED/HSCALSTRIDEDBATCHED
+template <typename T>
+StatusCode ScalStridedBatched(const size_t n,
+                              const T alpha,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("SCALSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XscalStridedBatched<T>(queue_cpp, event);
+    routine.DoScalStridedBatched(n,
+                                 alpha,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API ScalStridedBatched<float>(const size_t,
+                                                         const float,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalStridedBatched<double>(const size_t,
+                                                          const double,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalStridedBatched<float2>(const size_t,
+                                                          const float2,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalStridedBatched<double2>(const size_t,
+                                                           const double2,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalStridedBatched<half>(const size_t,
+                                                        const half,
+                                                        cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+template <typename T>
+StatusCode DotStridedBatched(const size_t n,
+                             cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                             const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                             const size_t batch_count,
+                             cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("DOTSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"y_stride", y_stride}, {"dot_offset", dot_offset}, {"dot_stride", dot_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XdotStridedBatched<T>(queue_cpp, event);
+    routine.DoDotStridedBatched(n,
+                                Buffer<T>(dot_buffer), dot_offset, dot_stride,
+                                Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                                batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API DotStridedBatched<float>(const size_t,
+                                                        cl_mem, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotStridedBatched<double>(const size_t,
+                                                         cl_mem, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotStridedBatched<half>(const size_t,
+                                                       cl_mem, const size_t, const size_t,
+                                                       const cl_mem, const size_t, const size_t, const size_t,
+                                                       const cl_mem, const size_t, const size_t, const size_t,
+                                                       const size_t,
+                                                       cl_command_queue*, cl_event*);
+
+// StridedBatched version of NRM2: SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+template <typename T>
+StatusCode Nrm2StridedBatched(const size_t n,
+                              cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("NRM2STRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"nrm2_offset", nrm2_offset}, {"nrm2_stride", nrm2_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xnrm2StridedBatched<T>(queue_cpp, event);
+    routine.DoNrm2StridedBatched(n,
+                                 Buffer<T>(nrm2_buffer), nrm2_offset, nrm2_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Nrm2StridedBatched<float>(const size_t,
+                                                         cl_mem, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2StridedBatched<double>(const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2StridedBatched<float2>(const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2StridedBatched<double2>(const size_t,
+                                                           cl_mem, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2StridedBatched<half>(const size_t,
+                                                        cl_mem, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// StridedBatched version of ASUM: SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+template <typename T>
+StatusCode AsumStridedBatched(const size_t n,
+                              cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    if (CallRecorder::IsEnabled() || IsSlowCallLogEnabled()) {
+      RecordCall("ASUMSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                 {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"asum_offset", asum_offset}, {"asum_stride", asum_stride}, {"batch_count", batch_count}});
+    }
+    auto queue_cpp = Queue(*queue);
+    auto routine = XasumStridedBatched<T>(queue_cpp, event);
+    routine.DoAsumStridedBatched(n,
+                                 Buffer<T>(asum_buffer), asum_offset, asum_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AsumStridedBatched<float>(const size_t,
+                                                         cl_mem, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumStridedBatched<double>(const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumStridedBatched<float2>(const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumStridedBatched<double2>(const size_t,
+                                                           cl_mem, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumStridedBatched<half>(const size_t,
+                                                        cl_mem, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Retrieves the required size of the temporary buffer for the GEMM kernel (optional)
+template <typename T>
+StatusCode GemmTempBufferSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t m, const size_t n, const size_t k,
+                              const size_t a_offset, const size_t a_ld,
+                              const size_t b_offset, const size_t b_ld,
+                              const size_t c_offset, const size_t c_ld,
+                              cl_command_queue* queue, size_t& temp_buffer_size) {
+  try {
+
+    // Retrieves the tuning database
+    const auto queue_cpp = Queue(*queue);
+    const auto device = queue_cpp.GetDevice();
+    const auto kernel_names = std::vector<std::string>{"Xgemm", "GemmRoutine"};
+    Databases db(kernel_names);
+    Routine::InitDatabase(device, kernel_names, PrecisionValue<T>(), {}, db);
+    db.SelectSize(Xgemm<T>::GetProblemSize(m, n, k));
+
+    // Computes the buffer size
+    if (Xgemm<T>::UseDirectKernel(layout, a_transpose, b_transpose, m, n, k,
+                                  a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
+                                  db.GetFlatParameters())) {
+      temp_buffer_size = 0;
+    }
+    else {
+      temp_buffer_size = Xgemm<T>::GetTempSize(layout, a_transpose, b_transpose, m, n, k,
+                                               a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
+                                               db["MWG"], db["NWG"], db["KWG"] * db["KREG"],
+                                               db["GEMMK"]);
+    }
+    temp_buffer_size *= sizeof(T); // translate from num-elements to bytes
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmTempBufferSize<float>(const Layout, const Transpose, const Transpose,
+                                                         const size_t, const size_t, const size_t,
+                                                         const size_t, const size_t, const size_t, const size_t,
+                                                         const size_t, const size_t, cl_command_queue*, size_t&);
+template StatusCode PUBLIC_API GemmTempBufferSize<double>(const Layout, const Transpose, const Transpose,
+                                                          const size_t, const size_t, const size_t,
+                                                          const size_t, const size_t, const size_t, const size_t,
+                                                          const size_t, const size_t, cl_command_queue*, size_t&);
+template StatusCode PUBLIC_API GemmTempBufferSize<float2>(const Layout, const Transpose, const Transpose,
+                                                          const size_t, const size_t, const size_t,
+                                                          const size_t, const size_t, const size_t, const size_t,
+                                                          const size_t, const size_t, cl_command_queue*, size_t&);
+template StatusCode PUBLIC_API GemmTempBufferSize<double2>(const Layout, const Transpose, const Transpose,
+                                                           const size_t, const size_t, const size_t,
+                                                           const size_t, const size_t, const size_t, const size_t,
+                                                           const size_t, const size_t, cl_command_queue*, size_t&);
+template StatusCode PUBLIC_API GemmTempBufferSize<half>(const Layout, const Transpose, const Transpose,
+                                                        const size_t, const size_t, const size_t,
+                                                        const size_t, const size_t, const size_t, const size_t,
+                                                        const size_t, const size_t, cl_command_queue*, size_t&);
+
+// Explains a GEMM call: runs the routine without buffers while the kernels and temporary buffers are
+// only recorded (see 'explanation.hpp'), and adds the parameters of all its kernels
+template <typename T>
+StatusCode ExplainGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t m, const size_t n, const size_t k,
+                       const size_t a_offset, const size_t a_ld,
+                       const size_t b_offset, const size_t b_ld,
+                       const size_t c_offset, const size_t c_ld,
+                       cl_command_queue* queue, GemmExplanation &explanation) {
+  try {
+    explanation = GemmExplanation();
+    auto queue_cpp = Queue(*queue);
+    ExplanationScope scope(explanation);
+    auto routine = Xgemm<T>(queue_cpp, nullptr);
+    routine.DoGemm(layout, a_transpose, b_transpose, m, n, k, ConstantOne<T>(),
+                   Buffer<T>(nullptr), a_offset, a_ld, Buffer<T>(nullptr), b_offset, b_ld,
+                   ConstantOne<T>(), Buffer<T>(nullptr), c_offset, c_ld);
+
+    // Retrieves the parameters for this problem size, the same as those of the routine above
+    const auto device = queue_cpp.GetDevice();
+    const auto kernel_names = std::vector<std::string>{"Copy", "Pad", "Transpose", "Padtranspose",
+                                                       "Xgemm", "XgemmDirect", "GemmRoutine",
+                                                       "XgemmSkinny"};
+    Databases db(kernel_names);
+    Routine::InitDatabase(device, kernel_names, PrecisionValue<T>(), {}, db);
+    db.SelectSize(Xgemm<T>::GetProblemSize(m, n, k));
+    for (const auto &kernel_name : kernel_names) {
+      ExplainParameters(kernel_name, db(kernel_name));
+    }
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API ExplainGemm<float>(const Layout, const Transpose, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const size_t, const size_t, const size_t, const size_t,
+                                                  const size_t, const size_t, cl_command_queue*, GemmExplanation&);
+template StatusCode PUBLIC_API ExplainGemm<double>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const size_t, const size_t, const size_t, const size_t,
+                                                   const size_t, const size_t, cl_command_queue*, GemmExplanation&);
+template StatusCode PUBLIC_API ExplainGemm<float2>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const size_t, const size_t, const size_t, const size_t,
+                                                   const size_t, const size_t, cl_command_queue*, GemmExplanation&);
+template StatusCode PUBLIC_API ExplainGemm<double2>(const Layout, const Transpose, const Transpose,
+                                                    const size_t, const size_t, const size_t,
+                                                    const size_t, const size_t, const size_t, const size_t,
+                                                    const size_t, const size_t, cl_command_queue*, GemmExplanation&);
+template StatusCode PUBLIC_API ExplainGemm<half>(const Layout, const Transpose, const Transpose,
+                                                 const size_t, const size_t, const size_t,
+                                                 const size_t, const size_t, const size_t, const size_t,
+                                                 const size_t, const size_t, cl_command_queue*, GemmExplanation&);
+
+// =================================================================================================
+
+// Creates, executes, and destroys a GEMM plan
+template <typename T>
+StatusCode GemmPlanCreate(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                          const size_t m, const size_t n, const size_t k,
+                          const size_t a_offset, const size_t a_ld,
+                          const size_t b_offset, const size_t b_ld,
+                          const size_t c_offset, const size_t c_ld,
+                          cl_command_queue* queue, GemmPlan<T>** plan) {
+  try {
+    if (plan == nullptr) { return StatusCode::kInvalidValue; }
+    auto queue_cpp = Queue(*queue);
+    *plan = new GemmPlan<T>(queue_cpp, layout, a_transpose, b_transpose, m, n, k,
+                            a_offset, a_ld, b_offset, b_ld, c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template <typename T>
+StatusCode GemmPlanExecute(GemmPlan<T>* plan, const T alpha,
+                           const cl_mem a_buffer, const cl_mem b_buffer,
+                           const T beta, cl_mem c_buffer,
+                           cl_command_queue* queue, cl_event* event,
+                           cl_mem temp_buffer) {
+  try {
+    if (plan == nullptr) { return StatusCode::kInvalidValue; }
+    auto queue_cpp = Queue(*queue);
+    const auto temp_buffer_provided = temp_buffer != nullptr;
+    auto temp_buffer_cpp = temp_buffer_provided ? Buffer<T>(temp_buffer) : Buffer<T>(nullptr);
+    plan->Execute(queue_cpp, event, alpha, Buffer<T>(a_buffer), Buffer<T>(b_buffer),
+                  beta, Buffer<T>(c_buffer), temp_buffer_cpp, temp_buffer_provided);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template <typename T>
+StatusCode GemmPlanDestroy(GemmPlan<T>* plan) {
+  try {
+    delete plan;
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmPlanCreate<float>(const Layout, const Transpose, const Transpose,
+                                                     const size_t, const size_t, const size_t,
+                                                     const size_t, const size_t, const size_t, const size_t,
+                                                     const size_t, const size_t, cl_command_queue*, GemmPlan<float>**);
+template StatusCode PUBLIC_API GemmPlanCreate<double>(const Layout, const Transpose, const Transpose,
+                                                      const size_t, const size_t, const size_t,
+                                                      const size_t, const size_t, const size_t, const size_t,
+                                                      const size_t, const size_t, cl_command_queue*, GemmPlan<double>**);
+template StatusCode PUBLIC_API GemmPlanCreate<float2>(const Layout, const Transpose, const Transpose,
+                                                      const size_t, const size_t, const size_t,
+                                                      const size_t, const size_t, const size_t, const size_t,
+                                                      const size_t, const size_t, cl_command_queue*, GemmPlan<float2>**);
+template StatusCode PUBLIC_API GemmPlanCreate<double2>(const Layout, const Transpose, const Transpose,
+                                                       const size_t, const size_t, const size_t,
+                                                       const size_t, const size_t, const size_t, const size_t,
+                                                       const size_t, const size_t, cl_command_queue*, GemmPlan<double2>**);
+template StatusCode PUBLIC_API GemmPlanCreate<half>(const Layout, const Transpose, const Transpose,
+                                                    const size_t, const size_t, const size_t,
+                                                    const size_t, const size_t, const size_t, const size_t,
+                                                    const size_t, const size_t, cl_command_queue*, GemmPlan<half>**);
+template StatusCode PUBLIC_API GemmPlanExecute<float>(GemmPlan<float>*, const float, const cl_mem, const cl_mem,
+                                                      const float, cl_mem, cl_command_queue*, cl_event*, cl_mem);
+template StatusCode PUBLIC_API GemmPlanExecute<double>(GemmPlan<double>*, const double, const cl_mem, const cl_mem,
+                                                       const double, cl_mem, cl_command_queue*, cl_event*, cl_mem);
+template StatusCode PUBLIC_API GemmPlanExecute<float2>(GemmPlan<float2>*, const float2, const cl_mem, const cl_mem,
+                                                       const float2, cl_mem, cl_command_queue*, cl_event*, cl_mem);
+template StatusCode PUBLIC_API GemmPlanExecute<double2>(GemmPlan<double2>*, const double2, const cl_mem, const cl_mem,
+                                                        const double2, cl_mem, cl_command_queue*, cl_event*, cl_mem);
+template StatusCode PUBLIC_API GemmPlanExecute<half>(GemmPlan<half>*, const half, const cl_mem, const cl_mem,
+                                                     const half, cl_mem, cl_command_queue*, cl_event*, cl_mem);
+template StatusCode PUBLIC_API GemmPlanDestroy<float>(GemmPlan<float>*);
+template StatusCode PUBLIC_API GemmPlanDestroy<double>(GemmPlan<double>*);
+template StatusCode PUBLIC_API GemmPlanDestroy<float2>(GemmPlan<float2>*);
+template StatusCode PUBLIC_API GemmPlanDestroy<double2>(GemmPlan<double2>*);
+template StatusCode PUBLIC_API GemmPlanDestroy<half>(GemmPlan<half>*);
+
+// =================================================================================================
+
+// Creates, solves with, and destroys a TRSM factor
+template <typename T>
+StatusCode TrsmFactorCreate(const Layout layout, const Side side, const Triangle triangle,
+                            const Transpose a_transpose, const Diagonal diagonal,
+                            const size_t k,
+                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                            cl_command_queue* queue, TrsmFactor<T>** factor) {
+  try {
+    if (factor == nullptr) { return StatusCode::kInvalidValue; }
+    auto queue_cpp = Queue(*queue);
+    *factor = new TrsmFactor<T>(queue_cpp, layout, side, triangle, a_transpose, diagonal, k,
+                                Buffer<T>(a_buffer), a_offset, a_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template <typename T>
+StatusCode TrsmFactorSolve(TrsmFactor<T>* factor, const size_t m, const size_t n, const T alpha,
+                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                           cl_command_queue* queue, cl_event* event) {
+  try {
+    if (factor == nullptr) { return StatusCode::kInvalidValue; }
+    auto queue_cpp = Queue(*queue);
+    factor->Solve(queue_cpp, event, m, n, alpha, Buffer<T>(b_buffer), b_offset, b_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template <typename T>
+StatusCode TrsmFactorDestroy(TrsmFactor<T>* factor) {
+  try {
+    delete factor;
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API TrsmFactorCreate<float>(const Layout, const Side, const Triangle, const Transpose,
+                                                       const Diagonal, const size_t, const cl_mem, const size_t, const size_t,
+                                                       cl_command_queue*, TrsmFactor<float>**);
+template StatusCode PUBLIC_API TrsmFactorCreate<double>(const Layout, const Side, const Triangle, const Transpose,
+                                                        const Diagonal, const size_t, const cl_mem, const size_t, const size_t,
+                                                        cl_command_queue*, TrsmFactor<double>**);
+template StatusCode PUBLIC_API TrsmFactorCreate<float2>(const Layout, const Side, const Triangle, const Transpose,
+                                                        const Diagonal, const size_t, const cl_mem, const size_t, const size_t,
+                                                        cl_command_queue*, TrsmFactor<float2>**);
+template StatusCode PUBLIC_API TrsmFactorCreate<double2>(const Layout, const Side, const Triangle, const Transpose,
+                                                         const Diagonal, const size_t, const cl_mem, const size_t, const size_t,
+                                                         cl_command_queue*, TrsmFactor<double2>**);
+template StatusCode PUBLIC_API TrsmFactorCreate<half>(const Layout, const Side, const Triangle, const Transpose,
+                                                      const Diagonal, const size_t, const cl_mem, const size_t, const size_t,
+                                                      cl_command_queue*, TrsmFactor<half>**);
+template StatusCode PUBLIC_API TrsmFactorSolve<float>(TrsmFactor<float>*, const size_t, const size_t, const float,
+                                                      cl_mem, const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmFactorSolve<double>(TrsmFactor<double>*, const size_t, const size_t, const double,
+                                                       cl_mem, const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmFactorSolve<float2>(TrsmFactor<float2>*, const size_t, const size_t, const float2,
+                                                       cl_mem, const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmFactorSolve<double2>(TrsmFactor<double2>*, const size_t, const size_t, const double2,
+                                                        cl_mem, const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmFactorSolve<half>(TrsmFactor<half>*, const size_t, const size_t, const half,
+                                                     cl_mem, const size_t, const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmFactorDestroy<float>(TrsmFactor<float>*);
+template StatusCode PUBLIC_API TrsmFactorDestroy<double>(TrsmFactor<double>*);
+template StatusCode PUBLIC_API TrsmFactorDestroy<float2>(TrsmFactor<float2>*);
+template StatusCode PUBLIC_API TrsmFactorDestroy<double2>(TrsmFactor<double2>*);
+template StatusCode PUBLIC_API TrsmFactorDestroy<half>(TrsmFactor<half>*);
+
+// =================================================================================================
+
+// Grouped version of GEMM
+template <typename T>
+StatusCode GemmGrouped(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t *ms, const size_t *ns, const size_t *ks,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                       const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                       const T *betas,
+                       cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmGrouped<T>(queue_cpp, event);
+    routine.DoGemmGrouped(layout, a_transpose, b_transpose,
+                          std::vector<size_t>(ms, ms + batch_count),
+                          std::vector<size_t>(ns, ns + batch_count),
+                          std::vector<size_t>(ks, ks + batch_count),
+                          std::vector<T>(alphas, alphas + batch_count),
+                          Buffer<T>(a_buffer), std::vector<size_t>(a_offsets, a_offsets + batch_count),
+                          std::vector<size_t>(a_lds, a_lds + batch_count),
+                          Buffer<T>(b_buffer), std::vector<size_t>(b_offsets, b_offsets + batch_count),
+                          std::vector<size_t>(b_lds, b_lds + batch_count),
+                          std::vector<T>(betas, betas + batch_count),
+                          Buffer<T>(c_buffer), std::vector<size_t>(c_offsets, c_offsets + batch_count),
+                          std::vector<size_t>(c_lds, c_lds + batch_count),
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmGrouped<float>(const Layout, const Transpose, const Transpose,
+                                                  const size_t*, const size_t*, const size_t*,
+                                                  const float*,
+                                                  const cl_mem, const size_t*, const size_t*,
+                                                  const cl_mem, const size_t*, const size_t*,
+                                                  const float*,
+                                                  cl_mem, const size_t*, const size_t*,
+                                                  const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGrouped<double>(const Layout, const Transpose, const Transpose,
+                                                   const size_t*, const size_t*, const size_t*,
+                                                   const double*,
+                                                   const cl_mem, const size_t*, const size_t*,
+                                                   const cl_mem, const size_t*, const size_t*,
+                                                   const double*,
+                                                   cl_mem, const size_t*, const size_t*,
+                                                   const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGrouped<float2>(const Layout, const Transpose, const Transpose,
+                                                   const size_t*, const size_t*, const size_t*,
+                                                   const float2*,
+                                                   const cl_mem, const size_t*, const size_t*,
+                                                   const cl_mem, const size_t*, const size_t*,
+                                                   const float2*,
+                                                   cl_mem, const size_t*, const size_t*,
+                                                   const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGrouped<double2>(const Layout, const Transpose, const Transpose,
+                                                    const size_t*, const size_t*, const size_t*,
+                                                    const double2*,
+                                                    const cl_mem, const size_t*, const size_t*,
+                                                    const cl_mem, const size_t*, const size_t*,
+                                                    const double2*,
+                                                    cl_mem, const size_t*, const size_t*,
+                                                    const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGrouped<half>(const Layout, const Transpose, const Transpose,
+                                                 const size_t*, const size_t*, const size_t*,
+                                                 const half*,
+                                                 const cl_mem, const size_t*, const size_t*,
+                                                 const cl_mem, const size_t*, const size_t*,
+                                                 const half*,
+                                                 cl_mem, const size_t*, const size_t*,
+                                                 const size_t, cl_command_queue*, cl_event*);
+
+// Grouped version of AXPY
+template <typename T>
+StatusCode AxpyGrouped(const size_t *ns,
+                       const T *alphas,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XaxpyGrouped<T>(queue_cpp, event);
+    routine.DoAxpyGrouped(std::vector<size_t>(ns, ns + batch_count),
+                          std::vector<T>(alphas, alphas + batch_count),
+                          Buffer<T>(x_buffer), std::vector<size_t>(x_offsets, x_offsets + batch_count), x_inc,
+                          Buffer<T>(y_buffer), std::vector<size_t>(y_offsets, y_offsets + batch_count), y_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AxpyGrouped<float>(const size_t*,
+                                                  const float*,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyGrouped<double>(const size_t*,
+                                                   const double*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyGrouped<float2>(const size_t*,
+                                                   const float2*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyGrouped<double2>(const size_t*,
+                                                    const double2*,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    cl_mem, const size_t*, const size_t,
+                                                    const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyGrouped<half>(const size_t*,
+                                                 const half*,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 cl_mem, const size_t*, const size_t,
+                                                 const size_t, cl_command_queue*, cl_event*);
+
+// Batched version of GEMM with device-resident scalars and offsets
+template <typename T>
+StatusCode GemmBatchedDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k,
+                             const cl_mem alphas,
+                             const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                             const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                             const cl_mem betas,
+                             cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                             const size_t batch_count,
+                             cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmBatched<T>(queue_cpp, event);
+    routine.DoGemmBatchedDevice(layout, a_transpose, b_transpose,
+                                m, n, k,
+                                Buffer<T>(alphas),
+                                Buffer<T>(a_buffer), Buffer<int>(a_offsets), a_ld,
+                                Buffer<T>(b_buffer), Buffer<int>(b_offsets), b_ld,
+                                Buffer<T>(betas),
+                                Buffer<T>(c_buffer), Buffer<int>(c_offsets), c_ld,
+                                batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template <typename T>
+StatusCode GemmBatchedDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k,
+                             const T alpha,
+                             const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                             const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                             const T beta,
+                             cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                             const size_t batch_count,
+                             cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmBatched<T>(queue_cpp, event);
+    routine.DoGemmBatchedDevice(layout, a_transpose, b_transpose,
+                                m, n, k,
+                                alpha,
+                                Buffer<T>(a_buffer), Buffer<int>(a_offsets), a_ld,
+                                Buffer<T>(b_buffer), Buffer<int>(b_offsets), b_ld,
+                                beta,
+                                Buffer<T>(c_buffer), Buffer<int>(c_offsets), c_ld,
+                                batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmBatchedDevice<float>(const Layout, const Transpose, const Transpose,
+                                                        const size_t, const size_t, const size_t, const cl_mem,
+                                                        const cl_mem, const cl_mem, const size_t,
+                                                        const cl_mem, const cl_mem, const size_t, const cl_mem,
+                                                        cl_mem, const cl_mem, const size_t,
+                                                        const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatchedDevice<double>(const Layout, const Transpose, const Transpose,
+                                                         const size_t, const size_t, const size_t, const cl_mem,
+                                                         const cl_mem, const cl_mem, const size_t,
+                                                         const cl_mem, const cl_mem, const size_t, const cl_mem,
+                                                         cl_mem, const cl_mem, const size_t,
+                                                         const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatchedDevice<float2>(const Layout, const Transpose, const Transpose,
+                                                         const size_t, const size_t, const size_t, const cl_mem,
+                                                         const cl_mem, const cl_mem, const size_t,
+                                                         const cl_mem, const cl_mem, const size_t, const cl_mem,
+                                                         cl_mem, const cl_mem, const size_t,
+                                                         const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatchedDevice<double2>(const Layout, const Transpose, const Transpose,
+                                                          const size_t, const size_t, const size_t, const cl_mem,
+                                                          const cl_mem, const cl_mem, const size_t,
+                                                          const cl_mem, const cl_mem, const size_t, const cl_mem,
+                                                          cl_mem, const cl_mem, const size_t,
+                                                          const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatchedDevice<half>(const Layout, const Transpose, const Transpose,
+                                                       const size_t, const size_t, const size_t, const cl_mem,
+                                                       const cl_mem, const cl_mem, const size_t,
+                                                       const cl_mem, const cl_mem, const size_t, const cl_mem,
+                                                       cl_mem, const cl_mem, const size_t,
+                                                       const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatchedDevice<float>(const Layout, const Transpose, const Transpose,
+                                                        const size_t, const size_t, const size_t, const float,
+                                                        const cl_mem, const cl_mem, const size_t,
+                                                        const cl_mem, const cl_mem, const size_t, const float,
+                                                        cl_mem, const cl_mem, const size_t,
+                                                        const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatchedDevice<double>(const Layout, const Transpose, const Transpose,
+                                                         const size_t, const size_t, const size_t, const double,
+                                                         const cl_mem, const cl_mem, const size_t,
+                                                         const cl_mem, const cl_mem, const size_t, const double,
+                                                         cl_mem, const cl_mem, const size_t,
+                                                         const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatchedDevice<float2>(const Layout, const Transpose, const Transpose,
+                                                         const size_t, const size_t, const size_t, const float2,
+                                                         const cl_mem, const cl_mem, const size_t,
+                                                         const cl_mem, const cl_mem, const size_t, const float2,
+                                                         cl_mem, const cl_mem, const size_t,
+                                                         const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatchedDevice<double2>(const Layout, const Transpose, const Transpose,
+                                                          const size_t, const size_t, const size_t, const double2,
+                                                          const cl_mem, const cl_mem, const size_t,
+                                                          const cl_mem, const cl_mem, const size_t, const double2,
+                                                          cl_mem, const cl_mem, const size_t,
+                                                          const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatchedDevice<half>(const Layout, const Transpose, const Transpose,
+                                                       const size_t, const size_t, const size_t, const half,
+                                                       const cl_mem, const cl_mem, const size_t,
+                                                       const cl_mem, const cl_mem, const size_t, const half,
+                                                       cl_mem, const cl_mem, const size_t,
+                                                       const size_t, cl_command_queue*, cl_event*);
+
+// Versions of AXPY, SCAL, GEMV, and GEMM with device-resident scalars
+template <typename T>
+StatusCode AxpyDevice(const size_t n,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xaxpy<T>(queue_cpp, event, "AXPYDEVICE");
+    routine.DoAxpyDevice(n,
+                         Buffer<T>(alpha_buffer), alpha_offset,
+                         Buffer<T>(x_buffer), x_offset, x_inc,
+                         Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AxpyDevice<float>(const size_t,
+                                                 const cl_mem, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyDevice<double>(const size_t,
+                                                  const cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyDevice<float2>(const size_t,
+                                                  const cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyDevice<double2>(const size_t,
+                                                   const cl_mem, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyDevice<half>(const size_t,
+                                                const cl_mem, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+template <typename T>
+StatusCode ScalDevice(const size_t n,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xscal<T>(queue_cpp, event, "SCALDEVICE");
+    routine.DoScalDevice(n,
+                         Buffer<T>(alpha_buffer), alpha_offset,
+                         Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API ScalDevice<float>(const size_t,
+                                                 const cl_mem, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalDevice<double>(const size_t,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalDevice<float2>(const size_t,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalDevice<double2>(const size_t,
+                                                   const cl_mem, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalDevice<half>(const size_t,
+                                                const cl_mem, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+template <typename T>
+StatusCode GemvDevice(const Layout layout, const Transpose a_transpose,
+                      const size_t m, const size_t n,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      const cl_mem beta_buffer, const size_t beta_offset,
+                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemv<T>(queue_cpp, event, "GEMVDEVICE");
+    routine.DoGemvDevice(layout, a_transpose,
+                         m, n,
+                         Buffer<T>(alpha_buffer), alpha_offset,
+                         Buffer<T>(a_buffer), a_offset, a_ld,
+                         Buffer<T>(x_buffer), x_offset, x_inc,
+                         Buffer<T>(beta_buffer), beta_offset,
+                         Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvDevice<float>(const Layout, const Transpose,
+                                                 const size_t, const size_t,
+                                                 const cl_mem, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const cl_mem, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvDevice<double>(const Layout, const Transpose,
+                                                  const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvDevice<float2>(const Layout, const Transpose,
+                                                  const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvDevice<double2>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const cl_mem, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvDevice<half>(const Layout, const Transpose,
+                                                const size_t, const size_t,
+                                                const cl_mem, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                const cl_mem, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+template <typename T>
+StatusCode GemmDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                      const cl_mem beta_buffer, const size_t beta_offset,
+                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemm<T>(queue_cpp, event, "GEMMDEVICE");
+    routine.SetDeviceScalars(DeviceScalars<T>{Buffer<T>(alpha_buffer), alpha_offset,
+                                              Buffer<T>(beta_buffer), beta_offset});
+    routine.DoGemm(layout, a_transpose, b_transpose,
+                   m, n, k,
+                   ConstantOne<T>(),
+                   Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(b_buffer), b_offset, b_ld,
+                   ConstantOne<T>(),
+                   Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmDevice<float>(const Layout, const Transpose, const Transpose,
+                                                 const size_t, const size_t, const size_t,
+                                                 const cl_mem, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const cl_mem, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmDevice<double>(const Layout, const Transpose, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmDevice<float2>(const Layout, const Transpose, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmDevice<double2>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const cl_mem, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmDevice<half>(const Layout, const Transpose, const Transpose,
+                                                const size_t, const size_t, const size_t,
+                                                const cl_mem, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                const cl_mem, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+
+// Fused pair of GEMVs with the same matrix
+template <typename T>
+StatusCode GemvPair(const Layout layout,
+                    const size_t m, const size_t n,
+                    const T alpha,
+                    const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                    const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                    const cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                    const T beta,
+                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                    cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                    cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemvPair<T>(queue_cpp, event);
+    routine.DoGemvPair(layout,
+                       m, n,
+                       alpha,
+                       Buffer<T>(a_buffer), a_offset, a_ld,
+                       Buffer<T>(x_buffer), x_offset, x_inc,
+                       Buffer<T>(w_buffer), w_offset, w_inc,
+                       beta,
+                       Buffer<T>(y_buffer), y_offset, y_inc,
+                       Buffer<T>(z_buffer), z_offset, z_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvPair<float>(const Layout,
+                                               const size_t, const size_t,
+                                               const float,
+                                               const cl_mem, const size_t, const size_t,
+                                               const cl_mem, const size_t, const size_t,
+                                               const cl_mem, const size_t, const size_t,
+                                               const float,
+                                               cl_mem, const size_t, const size_t,
+                                               cl_mem, const size_t, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvPair<double>(const Layout,
+                                                const size_t, const size_t,
+                                                const double,
+                                                const cl_mem, const size_t, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                const double,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvPair<float2>(const Layout,
+                                                const size_t, const size_t,
+                                                const float2,
+                                                const cl_mem, const size_t, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                const float2,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvPair<double2>(const Layout,
+                                                 const size_t, const size_t,
+                                                 const double2,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const double2,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvPair<half>(const Layout,
+                                              const size_t, const size_t,
+                                              const half,
+                                              const cl_mem, const size_t, const size_t,
+                                              const cl_mem, const size_t, const size_t,
+                                              const cl_mem, const size_t, const size_t,
+                                              const half,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+
+// In-place scaling and transpose/copy of a matrix
+template <typename T>
+StatusCode Imatcopy(const Layout layout, const Transpose a_transpose,
+                    const size_t m, const size_t n,
+                    const T alpha,
+                    cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t b_ld,
+                    cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Ximatcopy<T>(queue_cpp, event);
+    routine.DoImatcopy(layout, a_transpose,
+                       m, n,
+                       alpha,
+                       Buffer<T>(a_buffer), a_offset, a_ld, b_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Imatcopy<float>(const Layout, const Transpose,
+                                               const size_t, const size_t,
+                                               const float,
+                                               cl_mem, const size_t, const size_t, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Imatcopy<double>(const Layout, const Transpose,
+                                                const size_t, const size_t,
+                                                const double,
+                                                cl_mem, const size_t, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Imatcopy<float2>(const Layout, const Transpose,
+                                                const size_t, const size_t,
+                                                const float2,
+                                                cl_mem, const size_t, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Imatcopy<double2>(const Layout, const Transpose,
+                                                 const size_t, const size_t,
+                                                 const double2,
+                                                 cl_mem, const size_t, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Imatcopy<half>(const Layout, const Transpose,
+                                              const size_t, const size_t,
+                                              const half,
+                                              cl_mem, const size_t, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+
+// Generalised elementwise operations
+template <typename T>
+StatusCode Elementwise(const std::vector<ElementwiseOp> &operations, const size_t n,
+                       const T alpha,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       const T beta,
+                       cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                       const T low, const T high,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xelementwise<T>(queue_cpp, event);
+    routine.DoElementwise(operations, n,
+                          alpha,
+                          Buffer<T>(x_buffer), x_offset, x_inc,
+                          Buffer<T>(y_buffer), y_offset, y_inc,
+                          beta,
+                          Buffer<T>(z_buffer), z_offset, z_inc,
+                          low, high);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Elementwise<float>(const std::vector<ElementwiseOp>&, const size_t,
+                                                  const float,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const float,
+                                                  cl_mem, const size_t, const size_t,
+                                                  const float, const float,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Elementwise<double>(const std::vector<ElementwiseOp>&, const size_t,
+                                                   const double,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const double,
+                                                   cl_mem, const size_t, const size_t,
+                                                   const double, const double,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Elementwise<float2>(const std::vector<ElementwiseOp>&, const size_t,
+                                                   const float2,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const float2,
+                                                   cl_mem, const size_t, const size_t,
+                                                   const float2, const float2,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Elementwise<double2>(const std::vector<ElementwiseOp>&, const size_t,
+                                                    const double2,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const double2,
+                                                    cl_mem, const size_t, const size_t,
+                                                    const double2, const double2,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Elementwise<half>(const std::vector<ElementwiseOp>&, const size_t,
+                                                 const half,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const half,
+                                                 cl_mem, const size_t, const size_t,
+                                                 const half, const half,
+                                                 cl_command_queue*, cl_event*);
+
+// Reductions of the rows of a matrix
+template <typename T>
+StatusCode ReduceRows(const ReduceOp operation, const Layout layout,
+                      const size_t m, const size_t n,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xreduce<T>(queue_cpp, event);
+    routine.DoReduce(operation, layout, true,
+                     m, n,
+                     Buffer<T>(a_buffer), a_offset, a_ld, 0,
+                     Buffer<T>(y_buffer), y_offset, y_inc, 0,
+                     1);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API ReduceRows<float>(const ReduceOp, const Layout,
+                                                 const size_t, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceRows<double>(const ReduceOp, const Layout,
+                                                  const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceRows<float2>(const ReduceOp, const Layout,
+                                                  const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceRows<double2>(const ReduceOp, const Layout,
+                                                   const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceRows<half>(const ReduceOp, const Layout,
+                                                const size_t, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+
+// Strided-batched reductions of the rows of a matrix
+template <typename T>
+StatusCode ReduceRowsStridedBatched(const ReduceOp operation, const Layout layout,
+                                    const size_t m, const size_t n,
+                                    const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                    const size_t batch_count,
+                                    cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xreduce<T>(queue_cpp, event, "REDUCESTRIDEDBATCHED");
+    routine.DoReduce(operation, layout, true,
+                     m, n,
+                     Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                     Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                     batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API ReduceRowsStridedBatched<float>(const ReduceOp, const Layout,
+                                                               const size_t, const size_t,
+                                                               const cl_mem, const size_t, const size_t, const size_t,
+                                                               cl_mem, const size_t, const size_t, const size_t,
+                                                               const size_t,
+                                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceRowsStridedBatched<double>(const ReduceOp, const Layout,
+                                                                const size_t, const size_t,
+                                                                const cl_mem, const size_t, const size_t, const size_t,
+                                                                cl_mem, const size_t, const size_t, const size_t,
+                                                                const size_t,
+                                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceRowsStridedBatched<float2>(const ReduceOp, const Layout,
+                                                                const size_t, const size_t,
+                                                                const cl_mem, const size_t, const size_t, const size_t,
+                                                                cl_mem, const size_t, const size_t, const size_t,
+                                                                const size_t,
+                                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceRowsStridedBatched<double2>(const ReduceOp, const Layout,
+                                                                 const size_t, const size_t,
+                                                                 const cl_mem, const size_t, const size_t, const size_t,
+                                                                 cl_mem, const size_t, const size_t, const size_t,
+                                                                 const size_t,
+                                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceRowsStridedBatched<half>(const ReduceOp, const Layout,
+                                                              const size_t, const size_t,
+                                                              const cl_mem, const size_t, const size_t, const size_t,
+                                                              cl_mem, const size_t, const size_t, const size_t,
+                                                              const size_t,
+                                                              cl_command_queue*, cl_event*);
+
+// Reductions of the columns of a matrix
+template <typename T>
+StatusCode ReduceCols(const ReduceOp operation, const Layout layout,
+                      const size_t m, const size_t n,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xreduce<T>(queue_cpp, event);
+    routine.DoReduce(operation, layout, false,
+                     m, n,
+                     Buffer<T>(a_buffer), a_offset, a_ld, 0,
+                     Buffer<T>(y_buffer), y_offset, y_inc, 0,
+                     1);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API ReduceCols<float>(const ReduceOp, const Layout,
+                                                 const size_t, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceCols<double>(const ReduceOp, const Layout,
+                                                  const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceCols<float2>(const ReduceOp, const Layout,
+                                                  const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceCols<double2>(const ReduceOp, const Layout,
+                                                   const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceCols<half>(const ReduceOp, const Layout,
+                                                const size_t, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+
+// Strided-batched reductions of the columns of a matrix
+template <typename T>
+StatusCode ReduceColsStridedBatched(const ReduceOp operation, const Layout layout,
+                                    const size_t m, const size_t n,
+                                    const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                    const size_t batch_count,
+                                    cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xreduce<T>(queue_cpp, event, "REDUCESTRIDEDBATCHED");
+    routine.DoReduce(operation, layout, false,
+                     m, n,
+                     Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                     Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                     batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API ReduceColsStridedBatched<float>(const ReduceOp, const Layout,
+                                                               const size_t, const size_t,
+                                                               const cl_mem, const size_t, const size_t, const size_t,
+                                                               cl_mem, const size_t, const size_t, const size_t,
+                                                               const size_t,
+                                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceColsStridedBatched<double>(const ReduceOp, const Layout,
+                                                                const size_t, const size_t,
+                                                                const cl_mem, const size_t, const size_t, const size_t,
+                                                                cl_mem, const size_t, const size_t, const size_t,
+                                                                const size_t,
+                                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceColsStridedBatched<float2>(const ReduceOp, const Layout,
+                                                                const size_t, const size_t,
+                                                                const cl_mem, const size_t, const size_t, const size_t,
+                                                                cl_mem, const size_t, const size_t, const size_t,
+                                                                const size_t,
+                                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceColsStridedBatched<double2>(const ReduceOp, const Layout,
+                                                                 const size_t, const size_t,
+                                                                 const cl_mem, const size_t, const size_t, const size_t,
+                                                                 cl_mem, const size_t, const size_t, const size_t,
+                                                                 const size_t,
+                                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceColsStridedBatched<half>(const ReduceOp, const Layout,
+                                                              const size_t, const size_t,
+                                                              const cl_mem, const size_t, const size_t, const size_t,
+                                                              cl_mem, const size_t, const size_t, const size_t,
+                                                              const size_t,
+                                                              cl_command_queue*, cl_event*);
+
+// Im2col for a strided batch of images in channels-last layout
+template <typename T>
+StatusCode Im2colChannelsLast(const size_t channels, const size_t height, const size_t width,
+                              const size_t kernel_h, const size_t kernel_w,
+                              const size_t pad_h, const size_t pad_w,
+                              const size_t stride_h, const size_t stride_w,
+                              const size_t dilation_h, const size_t dilation_w,
+                              const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                              cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xim2col<T>(queue_cpp, event, "IM2COLSTRIDEDBATCHED");
+    routine.DoIm2colChannelsLast(channels, height, width, kernel_h, kernel_w, pad_h, pad_w,
+                                 stride_h, stride_w, dilation_h, dilation_w,
+                                 Buffer<T>(im_buffer), im_offset, im_stride,
+                                 Buffer<T>(col_buffer), col_offset, col_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Im2colChannelsLast<float>(const size_t, const size_t, const size_t,
+                                                         const size_t, const size_t, const size_t, const size_t,
+                                                         const size_t, const size_t, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t,
+                                                         cl_mem, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Im2colChannelsLast<double>(const size_t, const size_t, const size_t,
+                                                          const size_t, const size_t, const size_t, const size_t,
+                                                          const size_t, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Im2colChannelsLast<float2>(const size_t, const size_t, const size_t,
+                                                          const size_t, const size_t, const size_t, const size_t,
+                                                          const size_t, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Im2colChannelsLast<double2>(const size_t, const size_t, const size_t,
+                                                           const size_t, const size_t, const size_t, const size_t,
+                                                           const size_t, const size_t, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t,
+                                                           cl_mem, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Im2colChannelsLast<half>(const size_t, const size_t, const size_t,
+                                                        const size_t, const size_t, const size_t, const size_t,
+                                                        const size_t, const size_t, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t,
+                                                        cl_mem, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// Batched LU factorisation with partial pivoting of small matrices
+template <typename T>
+StatusCode GetrfStridedBatched(const Layout layout, const size_t n,
+                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                               cl_mem ipiv_buffer, const size_t ipiv_offset, const size_t ipiv_stride,
+                               const size_t batch_count,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgetrf<T>(queue_cpp, event);
+    routine.DoGetrfStridedBatched(layout, n,
+                                  Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                  Buffer<unsigned int>(ipiv_buffer), ipiv_offset, ipiv_stride,
+                                  batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GetrfStridedBatched<float>(const Layout, const size_t,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         cl_mem, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GetrfStridedBatched<double>(const Layout, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GetrfStridedBatched<float2>(const Layout, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GetrfStridedBatched<double2>(const Layout, const size_t,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           cl_mem, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+
+// Solve using the batched LU factorisation
+template <typename T>
+StatusCode GetrsStridedBatched(const Layout layout, const size_t n, const size_t nrhs,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                               const cl_mem ipiv_buffer, const size_t ipiv_offset, const size_t ipiv_stride,
+                               cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                               const size_t batch_count,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgetrf<T>(queue_cpp, event, "GETRSSTRIDEDBATCHED");
+    routine.DoGetrsStridedBatched(layout, n, nrhs,
+                                  Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                  Buffer<unsigned int>(ipiv_buffer), ipiv_offset, ipiv_stride,
+                                  Buffer<T>(b_buffer), b_offset, b_ld, b_stride,
+                                  batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GetrsStridedBatched<float>(const Layout, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GetrsStridedBatched<double>(const Layout, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GetrsStridedBatched<float2>(const Layout, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GetrsStridedBatched<double2>(const Layout, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+
+// Out-of-place GEMM with a separate output matrix D
+template <typename T>
+StatusCode GemmOutOfPlace(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                          const size_t m, const size_t n, const size_t k,
+                          const T alpha,
+                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                          const T beta,
+                          const cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                          cl_mem d_buffer, const size_t d_offset, const size_t d_ld,
+                          cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemm<T>(queue_cpp, event, "GEMMOUTOFPLACE");
+    routine.SetOutput(GemmOutput<T>{Buffer<T>(d_buffer), d_offset, d_ld});
+    routine.DoGemm(layout, a_transpose, b_transpose,
+                   m, n, k,
+                   alpha,
+                   Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(b_buffer), b_offset, b_ld,
+                   beta,
+                   Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmOutOfPlace<float>(const Layout, const Transpose, const Transpose,
+                                                     const size_t, const size_t, const size_t,
+                                                     const float,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     const float,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     cl_mem, const size_t, const size_t,
+                                                     cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmOutOfPlace<double>(const Layout, const Transpose, const Transpose,
+                                                      const size_t, const size_t, const size_t,
+                                                      const double,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      const double,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      cl_mem, const size_t, const size_t,
+                                                      cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmOutOfPlace<float2>(const Layout, const Transpose, const Transpose,
+                                                      const size_t, const size_t, const size_t,
+                                                      const float2,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      const float2,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      cl_mem, const size_t, const size_t,
+                                                      cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmOutOfPlace<double2>(const Layout, const Transpose, const Transpose,
+                                                       const size_t, const size_t, const size_t,
+                                                       const double2,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       const double2,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       cl_mem, const size_t, const size_t,
+                                                       cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmOutOfPlace<half>(const Layout, const Transpose, const Transpose,
+                                                    const size_t, const size_t, const size_t,
+                                                    const half,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const half,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    cl_mem, const size_t, const size_t,
+                                                    cl_command_queue*, cl_event*);
+
+// Accumulation of k general rank-1 updates
+template <typename T>
+StatusCode Gerk(const Layout layout,
+                const size_t m, const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgerk<T>(queue_cpp, event);
+    routine.DoGerk(layout,
+                   m, n, k,
+                   alpha,
+                   Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                   Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                   Buffer<T>(a_buffer), a_offset, a_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Gerk<float>(const Layout,
+                                           const size_t, const size_t, const size_t,
+                                           const float,
+                                           const cl_mem, const size_t, const size_t, const size_t,
+                                           const cl_mem, const size_t, const size_t, const size_t,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gerk<double>(const Layout,
+                                            const size_t, const size_t, const size_t,
+                                            const double,
+                                            const cl_mem, const size_t, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gerk<half>(const Layout,
+                                          const size_t, const size_t, const size_t,
+                                          const half,
+                                          const cl_mem, const size_t, const size_t, const size_t,
+                                          const cl_mem, const size_t, const size_t, const size_t,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_command_queue*, cl_event*);
+
+// Conversions between packed and full storage
+template <typename T>
+StatusCode Tpttr(const Layout layout, const Triangle triangle,
+                 const size_t n,
+                 const cl_mem ap_buffer, const size_t ap_offset,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xpacked<T>(queue_cpp, event);
+    routine.DoTpttr(layout, triangle,
+                    n,
+                    Buffer<T>(ap_buffer), ap_offset,
+                    Buffer<T>(a_buffer), a_offset, a_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Tpttr<float>(const Layout, const Triangle,
+                                            const size_t,
+                                            const cl_mem, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Tpttr<double>(const Layout, const Triangle,
+                                             const size_t,
+                                             const cl_mem, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Tpttr<float2>(const Layout, const Triangle,
+                                             const size_t,
+                                             const cl_mem, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Tpttr<double2>(const Layout, const Triangle,
+                                              const size_t,
+                                              const cl_mem, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Tpttr<half>(const Layout, const Triangle,
+                                           const size_t,
+                                           const cl_mem, const size_t,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+template <typename T>
+StatusCode Trttp(const Layout layout, const Triangle triangle,
+                 const size_t n,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_mem ap_buffer, const size_t ap_offset,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xpacked<T>(queue_cpp, event);
+    routine.DoTrttp(layout, triangle,
+                    n,
+                    Buffer<T>(a_buffer), a_offset, a_ld,
+                    Buffer<T>(ap_buffer), ap_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Trttp<float>(const Layout, const Triangle,
+                                            const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Trttp<double>(const Layout, const Triangle,
+                                             const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Trttp<float2>(const Layout, const Triangle,
+                                             const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Trttp<double2>(const Layout, const Triangle,
+                                              const size_t,
+                                              const cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Trttp<half>(const Layout, const Triangle,
+                                           const size_t,
+                                           const cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t,
+                                           cl_command_queue*, cl_event*);
+
+// SYRK with matrix C in packed storage
+template <typename T>
+StatusCode SyrkPacked(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                      const size_t n, const size_t k,
+                      const T alpha,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                      const T beta,
+                      cl_mem cp_buffer, const size_t cp_offset,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xpacked<T>(queue_cpp, event);
+    routine.DoSyrkPacked(layout, triangle, a_transpose,
+                         n, k,
+                         alpha,
+                         Buffer<T>(a_buffer), a_offset, a_ld,
+                         beta,
+                         Buffer<T>(cp_buffer), cp_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API SyrkPacked<float>(const Layout, const Triangle, const Transpose,
+                                                 const size_t, const size_t,
+                                                 const float,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const float,
+                                                 cl_mem, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SyrkPacked<double>(const Layout, const Triangle, const Transpose,
+                                                  const size_t, const size_t,
+                                                  const double,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const double,
+                                                  cl_mem, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SyrkPacked<float2>(const Layout, const Triangle, const Transpose,
+                                                  const size_t, const size_t,
+                                                  const float2,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const float2,
+                                                  cl_mem, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SyrkPacked<double2>(const Layout, const Triangle, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const double2,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const double2,
+                                                   cl_mem, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SyrkPacked<half>(const Layout, const Triangle, const Transpose,
+                                                const size_t, const size_t,
+                                                const half,
+                                                const cl_mem, const size_t, const size_t,
+                                                const half,
+                                                cl_mem, const size_t,
+                                                cl_command_queue*, cl_event*);
+
+// TRSM with matrix A in packed storage
+template <typename T>
+StatusCode TrsmPacked(const Layout layout, const Side side, const Triangle triangle,
+                      const Transpose a_transpose, const Diagonal diagonal,
+                      const size_t m, const size_t n,
+                      const T alpha,
+                      const cl_mem ap_buffer, const size_t ap_offset,
+                      cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xpacked<T>(queue_cpp, event);
+    routine.DoTrsmPacked(layout, side, triangle,
+                         a_transpose, diagonal,
+                         m, n,
+                         alpha,
+                         Buffer<T>(ap_buffer), ap_offset,
+                         Buffer<T>(b_buffer), b_offset, b_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API TrsmPacked<float>(const Layout, const Side, const Triangle,
+                                                 const Transpose, const Diagonal,
+                                                 const size_t, const size_t,
+                                                 const float,
+                                                 const cl_mem, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmPacked<double>(const Layout, const Side, const Triangle,
+                                                  const Transpose, const Diagonal,
+                                                  const size_t, const size_t,
+                                                  const double,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmPacked<float2>(const Layout, const Side, const Triangle,
+                                                  const Transpose, const Diagonal,
+                                                  const size_t, const size_t,
+                                                  const float2,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmPacked<double2>(const Layout, const Side, const Triangle,
+                                                   const Transpose, const Diagonal,
+                                                   const size_t, const size_t,
+                                                   const double2,
+                                                   const cl_mem, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+
+// GEMM with a fused bias and activation epilogue
+template <typename T>
+StatusCode GemmWithEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                            const size_t m, const size_t n, const size_t k,
+                            const T alpha,
+                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                            const T beta,
+                            cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                            const EpilogueBias bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                            const EpilogueActivation activation, const T low, const T high,
+                            cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemm<T>(queue_cpp, event, "GEMMEPILOGUE");
+    routine.SetEpilogue(GemmEpilogue<T>{bias_mode, Buffer<T>(bias_buffer), bias_offset,
+                                        activation, low, high});
+    routine.DoGemm(layout, a_transpose, b_transpose,
+                   m, n, k,
+                   alpha,
+                   Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(b_buffer), b_offset, b_ld,
+                   beta,
+                   Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmWithEpilogue<float>(const Layout, const Transpose, const Transpose,
+                                                       const size_t, const size_t, const size_t,
+                                                       const float,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       const float,
+                                                       cl_mem, const size_t, const size_t,
+                                                       const EpilogueBias, const cl_mem, const size_t,
+                                                       const EpilogueActivation, const float, const float,
+                                                       cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmWithEpilogue<double>(const Layout, const Transpose, const Transpose,
+                                                        const size_t, const size_t, const size_t,
+                                                        const double,
+                                                        const cl_mem, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t,
+                                                        const double,
+                                                        cl_mem, const size_t, const size_t,
+                                                        const EpilogueBias, const cl_mem, const size_t,
+                                                        const EpilogueActivation, const double, const double,
+                                                        cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmWithEpilogue<float2>(const Layout, const Transpose, const Transpose,
+                                                        const size_t, const size_t, const size_t,
+                                                        const float2,
+                                                        const cl_mem, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t,
+                                                        const float2,
+                                                        cl_mem, const size_t, const size_t,
+                                                        const EpilogueBias, const cl_mem, const size_t,
+                                                        const EpilogueActivation, const float2, const float2,
+                                                        cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmWithEpilogue<double2>(const Layout, const Transpose, const Transpose,
+                                                         const size_t, const size_t, const size_t,
+                                                         const double2,
+                                                         const cl_mem, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t,
+                                                         const double2,
+                                                         cl_mem, const size_t, const size_t,
+                                                         const EpilogueBias, const cl_mem, const size_t,
+                                                         const EpilogueActivation, const double2, const double2,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmWithEpilogue<half>(const Layout, const Transpose, const Transpose,
+                                                      const size_t, const size_t, const size_t,
+                                                      const half,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      const half,
+                                                      cl_mem, const size_t, const size_t,
+                                                      const EpilogueBias, const cl_mem, const size_t,
+                                                      const EpilogueActivation, const half, const half,
+                                                      cl_command_queue*, cl_event*);
+
+// Strided-batched GEMM with a fused bias and activation epilogue
+template <typename T>
+StatusCode GemmStridedBatchedWithEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const T alpha,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                          const T beta,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                          const size_t batch_count,
+                                          const EpilogueBias bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                                          const EpilogueActivation activation, const T low, const T high,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmStridedBatched<T>(queue_cpp, event, "GEMMSTRIDEDBATCHEDEPILOGUE");
+    routine.SetEpilogue(GemmEpilogue<T>{bias_mode, Buffer<T>(bias_buffer), bias_offset,
+                                        activation, low, high});
+    routine.DoGemmStridedBatched(layout, a_transpose, b_transpose,
+                                 m, n, k,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(b_buffer), b_offset, b_ld, b_stride,
+                                 beta,
+                                 Buffer<T>(c_buffer), c_offset, c_ld, c_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmStridedBatchedWithEpilogue<float>(const Layout, const Transpose, const Transpose,
+                                                                     const size_t, const size_t, const size_t,
+                                                                     const float,
+                                                                     const cl_mem, const size_t, const size_t, const size_t,
+                                                                     const cl_mem, const size_t, const size_t, const size_t,
+                                                                     const float,
+                                                                     cl_mem, const size_t, const size_t, const size_t,
+                                                                     const size_t,
+                                                                     const EpilogueBias, const cl_mem, const size_t,
+                                                                     const EpilogueActivation, const float, const float,
+                                                                     cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatchedWithEpilogue<double>(const Layout, const Transpose, const Transpose,
+                                                                      const size_t, const size_t, const size_t,
+                                                                      const double,
+                                                                      const cl_mem, const size_t, const size_t, const size_t,
+                                                                      const cl_mem, const size_t, const size_t, const size_t,
+                                                                      const double,
+                                                                      cl_mem, const size_t, const size_t, const size_t,
+                                                                      const size_t,
+                                                                      const EpilogueBias, const cl_mem, const size_t,
+                                                                      const EpilogueActivation, const double, const double,
+                                                                      cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatchedWithEpilogue<float2>(const Layout, const Transpose, const Transpose,
+                                                                      const size_t, const size_t, const size_t,
+                                                                      const float2,
+                                                                      const cl_mem, const size_t, const size_t, const size_t,
+                                                                      const cl_mem, const size_t, const size_t, const size_t,
+                                                                      const float2,
+                                                                      cl_mem, const size_t, const size_t, const size_t,
+                                                                      const size_t,
+                                                                      const EpilogueBias, const cl_mem, const size_t,
+                                                                      const EpilogueActivation, const float2, const float2,
+                                                                      cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatchedWithEpilogue<double2>(const Layout, const Transpose, const Transpose,
+                                                                       const size_t, const size_t, const size_t,
+                                                                       const double2,
+                                                                       const cl_mem, const size_t, const size_t, const size_t,
+                                                                       const cl_mem, const size_t, const size_t, const size_t,
+                                                                       const double2,
+                                                                       cl_mem, const size_t, const size_t, const size_t,
+                                                                       const size_t,
+                                                                       const EpilogueBias, const cl_mem, const size_t,
+                                                                       const EpilogueActivation, const double2, const double2,
+                                                                       cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatchedWithEpilogue<half>(const Layout, const Transpose, const Transpose,
+                                                                    const size_t, const size_t, const size_t,
+                                                                    const half,
+                                                                    const cl_mem, const size_t, const size_t, const size_t,
+                                                                    const cl_mem, const size_t, const size_t, const size_t,
+                                                                    const half,
+                                                                    cl_mem, const size_t, const size_t, const size_t,
+                                                                    const size_t,
+                                                                    const EpilogueBias, const cl_mem, const size_t,
+                                                                    const EpilogueActivation, const half, const half,
+                                                                    cl_command_queue*, cl_event*);
+
+// Back-to-back GEMMs of an MLP block
+template <typename T>
+StatusCode GemmMlp(const Layout layout,
+                   const size_t m, const size_t n, const size_t k, const size_t p,
+                   const T alpha,
+                   const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                   const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                   const EpilogueBias bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                   const EpilogueActivation activation, const T low, const T high,
+                   const cl_mem e_buffer, const size_t e_offset, const size_t e_ld,
+                   const T beta,
+                   cl_mem d_buffer, const size_t d_offset, const size_t d_ld,
+                   cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmMlp<T>(queue_cpp, event);
+    routine.DoGemmMlp(layout, m, n, k, p,
+                      alpha,
+                      Buffer<T>(a_buffer), a_offset, a_ld,
+                      Buffer<T>(b_buffer), b_offset, b_ld,
+                      GemmEpilogue<T>{bias_mode, Buffer<T>(bias_buffer), bias_offset,
+                                      activation, low, high},
+                      Buffer<T>(e_buffer), e_offset, e_ld,
+                      beta,
+                      Buffer<T>(d_buffer), d_offset, d_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmMlp<float>(const Layout,
+                                              const size_t, const size_t, const size_t, const size_t,
+                                              const float,
+                                              const cl_mem, const size_t, const size_t,
+                                              const cl_mem, const size_t, const size_t,
+                                              const EpilogueBias, const cl_mem, const size_t,
+                                              const EpilogueActivation, const float, const float,
+                                              const cl_mem, const size_t, const size_t,
+                                              const float,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmMlp<double>(const Layout,
+                                               const size_t, const size_t, const size_t, const size_t,
+                                               const double,
+                                               const cl_mem, const size_t, const size_t,
+                                               const cl_mem, const size_t, const size_t,
+                                               const EpilogueBias, const cl_mem, const size_t,
+                                               const EpilogueActivation, const double, const double,
+                                               const cl_mem, const size_t, const size_t,
+                                               const double,
+                                               cl_mem, const size_t, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmMlp<float2>(const Layout,
+                                               const size_t, const size_t, const size_t, const size_t,
+                                               const float2,
+                                               const cl_mem, const size_t, const size_t,
+                                               const cl_mem, const size_t, const size_t,
+                                               const EpilogueBias, const cl_mem, const size_t,
+                                               const EpilogueActivation, const float2, const float2,
+                                               const cl_mem, const size_t, const size_t,
+                                               const float2,
+                                               cl_mem, const size_t, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmMlp<double2>(const Layout,
+                                                const size_t, const size_t, const size_t, const size_t,
+                                                const double2,
+                                                const cl_mem, const size_t, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                const EpilogueBias, const cl_mem, const size_t,
+                                                const EpilogueActivation, const double2, const double2,
+                                                const cl_mem, const size_t, const size_t,
+                                                const double2,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmMlp<half>(const Layout,
+                                             const size_t, const size_t, const size_t, const size_t,
+                                             const half,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const EpilogueBias, const cl_mem, const size_t,
+                                             const EpilogueActivation, const half, const half,
+                                             const cl_mem, const size_t, const size_t,
+                                             const half,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+
+// Batched scaled dot-product attention
+template <typename T>
+StatusCode AttentionStridedBatched(const Layout layout,
+                                   const size_t seq_q, const size_t seq_k, const size_t head_dim,
+                                   const T scale, const bool causal,
+                                   const cl_mem q_buffer, const size_t q_offset, const size_t q_ld, const size_t q_stride,
+                                   const cl_mem k_buffer, const size_t k_offset, const size_t k_ld, const size_t k_stride,
+                                   const cl_mem v_buffer, const size_t v_offset, const size_t v_ld, const size_t v_stride,
+                                   cl_mem o_buffer, const size_t o_offset, const size_t o_ld, const size_t o_stride,
+                                   const size_t batch_count,
+                                   cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XattentionStridedBatched<T>(queue_cpp, event);
+    routine.DoAttentionStridedBatched(layout, seq_q, seq_k, head_dim,
+                                      scale, causal,
+                                      Buffer<T>(q_buffer), q_offset, q_ld, q_stride,
+                                      Buffer<T>(k_buffer), k_offset, k_ld, k_stride,
+                                      Buffer<T>(v_buffer), v_offset, v_ld, v_stride,
+                                      Buffer<T>(o_buffer), o_offset, o_ld, o_stride,
+                                      batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AttentionStridedBatched<float>(const Layout,
+                                                              const size_t, const size_t, const size_t,
+                                                              const float, const bool,
+                                                              const cl_mem, const size_t, const size_t, const size_t,
+                                                              const cl_mem, const size_t, const size_t, const size_t,
+                                                              const cl_mem, const size_t, const size_t, const size_t,
+                                                              cl_mem, const size_t, const size_t, const size_t,
+                                                              const size_t,
+                                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AttentionStridedBatched<double>(const Layout,
+                                                               const size_t, const size_t, const size_t,
+                                                               const double, const bool,
+                                                               const cl_mem, const size_t, const size_t, const size_t,
+                                                               const cl_mem, const size_t, const size_t, const size_t,
+                                                               const cl_mem, const size_t, const size_t, const size_t,
+                                                               cl_mem, const size_t, const size_t, const size_t,
+                                                               const size_t,
+                                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AttentionStridedBatched<half>(const Layout,
+                                                             const size_t, const size_t, const size_t,
+                                                             const half, const bool,
+                                                             const cl_mem, const size_t, const size_t, const size_t,
+                                                             const cl_mem, const size_t, const size_t, const size_t,
+                                                             const cl_mem, const size_t, const size_t, const size_t,
+                                                             cl_mem, const size_t, const size_t, const size_t,
+                                                             const size_t,
+                                                             cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Packed operands for GEMM: the size query, the packing itself, and GEMM with packed operands
+template <typename T>
+StatusCode GemmPackedOperandSize(const GemmOperand operand, const size_t m, const size_t n, const size_t k,
+                                 cl_command_queue* queue, size_t& packed_size) {
+  try {
+    if ((m == 0) || (n == 0) || (k == 0)) { return StatusCode::kInvalidDimension; }
+
+    // Retrieves the tuning database
+    const auto queue_cpp = Queue(*queue);
+    const auto device = queue_cpp.GetDevice();
+    const auto kernel_names = std::vector<std::string>{"Xgemm"};
+    Databases db(kernel_names);
+    Routine::InitDatabase(device, kernel_names, PrecisionValue<T>(), {}, db);
+    db.SelectSize(Xgemm<T>::GetProblemSize(m, n, k));
+
+    // Computes the buffer size
+    packed_size = Xgemm<T>::GetPackedSize(operand, m, n, k,
+                                          db["MWG"], db["NWG"], db["KWG"] * db["KREG"], db["GEMMK"]);
+    packed_size *= sizeof(T); // translate from num-elements to bytes
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template <typename T>
+StatusCode GemmPackOperand(const Layout layout, const GemmOperand operand, const Transpose transpose,
+                           const size_t m, const size_t n, const size_t k,
+                           const cl_mem buffer, const size_t offset, const size_t ld,
+                           cl_mem packed_buffer,
+                           cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemm<T>(queue_cpp, event);
+    routine.DoPackOperand(layout, operand, transpose, m, n, k,
+                          Buffer<T>(buffer), offset, ld, Buffer<T>(packed_buffer));
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template <typename T>
+StatusCode GemmWithPackedOperands(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const T alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const bool a_packed,
+                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const bool b_packed,
+                                  const T beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemm<T>(queue_cpp, event);
+    routine.DoGemmPacked(layout, a_transpose, b_transpose,
+                         m, n, k,
+                         alpha,
+                         Buffer<T>(a_buffer), a_offset, a_ld, a_packed,
+                         Buffer<T>(b_buffer), b_offset, b_ld, b_packed,
+                         beta,
+                         Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmPackedOperandSize<float>(const GemmOperand, const size_t, const size_t, const size_t,
+                                                            cl_command_queue*, size_t&);
+template StatusCode PUBLIC_API GemmPackedOperandSize<double>(const GemmOperand, const size_t, const size_t, const size_t,
+                                                             cl_command_queue*, size_t&);
+template StatusCode PUBLIC_API GemmPackedOperandSize<float2>(const GemmOperand, const size_t, const size_t, const size_t,
+                                                             cl_command_queue*, size_t&);
+template StatusCode PUBLIC_API GemmPackedOperandSize<double2>(const GemmOperand, const size_t, const size_t, const size_t,
+                                                              cl_command_queue*, size_t&);
+template StatusCode PUBLIC_API GemmPackedOperandSize<half>(const GemmOperand, const size_t, const size_t, const size_t,
+                                                           cl_command_queue*, size_t&);
+template StatusCode PUBLIC_API GemmPackOperand<float>(const Layout, const GemmOperand, const Transpose,
+                                                      const size_t, const size_t, const size_t,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      cl_mem,
+                                                      cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmPackOperand<double>(const Layout, const GemmOperand, const Transpose,
+                                                       const size_t, const size_t, const size_t,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       cl_mem,
+                                                       cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmPackOperand<float2>(const Layout, const GemmOperand, const Transpose,
+                                                       const size_t, const size_t, const size_t,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       cl_mem,
+                                                       cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmPackOperand<double2>(const Layout, const GemmOperand, const Transpose,
+                                                        const size_t, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t,
+                                                        cl_mem,
+                                                        cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmPackOperand<half>(const Layout, const GemmOperand, const Transpose,
+                                                     const size_t, const size_t, const size_t,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     cl_mem,
+                                                     cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmWithPackedOperands<float>(const Layout, const Transpose, const Transpose,
+                                                             const size_t, const size_t, const size_t,
+                                                             const float,
+                                                             const cl_mem, const size_t, const size_t, const bool,
+                                                             const cl_mem, const size_t, const size_t, const bool,
+                                                             const float,
+                                                             cl_mem, const size_t, const size_t,
+                                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmWithPackedOperands<double>(const Layout, const Transpose, const Transpose,
+                                                              const size_t, const size_t, const size_t,
+                                                              const double,
+                                                              const cl_mem, const size_t, const size_t, const bool,
+                                                              const cl_mem, const size_t, const size_t, const bool,
+                                                              const double,
+                                                              cl_mem, const size_t, const size_t,
+                                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmWithPackedOperands<float2>(const Layout, const Transpose, const Transpose,
+                                                              const size_t, const size_t, const size_t,
+                                                              const float2,
+                                                              const cl_mem, const size_t, const size_t, const bool,
+                                                              const cl_mem, const size_t, const size_t, const bool,
+                                                              const float2,
+                                                              cl_mem, const size_t, const size_t,
+                                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmWithPackedOperands<double2>(const Layout, const Transpose, const Transpose,
+                                                               const size_t, const size_t, const size_t,
+                                                               const double2,
+                                                               const cl_mem, const size_t, const size_t, const bool,
+                                                               const cl_mem, const size_t, const size_t, const bool,
+                                                               const double2,
+                                                               cl_mem, const size_t, const size_t,
+                                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmWithPackedOperands<half>(const Layout, const Transpose, const Transpose,
+                                                            const size_t, const size_t, const size_t,
+                                                            const half,
+                                                            const cl_mem, const size_t, const size_t, const bool,
+                                                            const cl_mem, const size_t, const size_t, const bool,
+                                                            const half,
+                                                            cl_mem, const size_t, const size_t,
+                                                            cl_command_queue*, cl_event*);
+
+// Image operands for GEMM: the packing into an image, and GEMM with image operands
+template <typename T>
+StatusCode GemmPackImage(const Layout layout, const GemmOperand operand, const Transpose transpose,
+                         const size_t m, const size_t n, const size_t k,
+                         const cl_mem buffer, const size_t offset, const size_t ld,
+                         cl_mem* image,
+                         cl_command_queue* queue, cl_event* event) {
+  try {
+    if (image == nullptr) { return StatusCode::kInvalidValue; }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemm<T>(queue_cpp, event);
+    const auto image_cpp = routine.DoPackImage(layout, operand, transpose, m, n, k,
+                                               Buffer<T>(buffer), offset, ld);
+    CheckError(clRetainMemObject(image_cpp())); // ownership passes to the caller
+    *image = image_cpp();
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template <typename T>
+StatusCode GemmWithImageOperands(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                 const size_t m, const size_t n, const size_t k,
+                                 const T alpha,
+                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const bool a_image,
+                                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const bool b_image,
+                                 const T beta,
+                                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemm<T>(queue_cpp, event);
+    routine.DoGemmImages(layout, a_transpose, b_transpose,
+                         m, n, k,
+                         alpha,
+                         Buffer<T>(a_buffer), a_offset, a_ld, a_image,
+                         Buffer<T>(b_buffer), b_offset, b_ld, b_image,
+                         beta,
+                         Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmPackImage<float>(const Layout, const GemmOperand, const Transpose,
+                                                    const size_t, const size_t, const size_t,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    cl_mem*,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmPackImage<half>(const Layout, const GemmOperand, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   cl_mem*,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmWithImageOperands<float>(const Layout, const Transpose, const Transpose,
+                                                            const size_t, const size_t, const size_t,
+                                                            const float,
+                                                            const cl_mem, const size_t, const size_t, const bool,
+                                                            const cl_mem, const size_t, const size_t, const bool,
+                                                            const float,
+                                                            cl_mem, const size_t, const size_t,
+                                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmWithImageOperands<half>(const Layout, const Transpose, const Transpose,
+                                                           const size_t, const size_t, const size_t,
+                                                           const half,
+                                                           const cl_mem, const size_t, const size_t, const bool,
+                                                           const cl_mem, const size_t, const size_t, const bool,
+                                                           const half,
+                                                           cl_mem, const size_t, const size_t,
+                                                           cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Sparse matrix-vector and sparse-dense matrix multiplication with a CSR matrix
+template <typename T>
+StatusCode Csrmv(const size_t m, const size_t n, const size_t nnz,
+                 const T alpha,
+                 const cl_mem row_ptr_buffer, const cl_mem col_idx_buffer, const cl_mem values_buffer,
+                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta,
+                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xcsr<T>(queue_cpp, event);
+    routine.DoCsrmv(m, n, nnz,
+                    alpha,
+                    Buffer<int>(row_ptr_buffer), Buffer<int>(col_idx_buffer), Buffer<T>(values_buffer),
+                    Buffer<T>(x_buffer), x_offset, x_inc,
+                    beta,
+                    Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template <typename T>
+StatusCode Csrmm(const Layout layout, const size_t m, const size_t n, const size_t k, const size_t nnz,
+                 const T alpha,
+                 const cl_mem row_ptr_buffer, const cl_mem col_idx_buffer, const cl_mem values_buffer,
+                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                 const T beta,
+                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xcsr<T>(queue_cpp, event);
+    routine.DoCsrmm(layout, m, n, k, nnz,
+                    alpha,
+                    Buffer<int>(row_ptr_buffer), Buffer<int>(col_idx_buffer), Buffer<T>(values_buffer),
+                    Buffer<T>(b_buffer), b_offset, b_ld,
+                    beta,
+                    Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Csrmv<float>(const size_t, const size_t, const size_t,
+                                            const float,
+                                            const cl_mem, const cl_mem, const cl_mem,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Csrmv<double>(const size_t, const size_t, const size_t,
+                                             const double,
+                                             const cl_mem, const cl_mem, const cl_mem,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Csrmv<float2>(const size_t, const size_t, const size_t,
+                                             const float2,
+                                             const cl_mem, const cl_mem, const cl_mem,
+                                             const cl_mem, const size_t, const size_t,
+                                             const float2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Csrmv<double2>(const size_t, const size_t, const size_t,
+                                              const double2,
+                                              const cl_mem, const cl_mem, const cl_mem,
+                                              const cl_mem, const size_t, const size_t,
+                                              const double2,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Csrmv<half>(const size_t, const size_t, const size_t,
+                                           const half,
+                                           const cl_mem, const cl_mem, const cl_mem,
+                                           const cl_mem, const size_t, const size_t,
+                                           const half,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Csrmm<float>(const Layout, const size_t, const size_t, const size_t, const size_t,
+                                            const float,
+                                            const cl_mem, const cl_mem, const cl_mem,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Csrmm<double>(const Layout, const size_t, const size_t, const size_t, const size_t,
+                                             const double,
+                                             const cl_mem, const cl_mem, const cl_mem,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Csrmm<float2>(const Layout, const size_t, const size_t, const size_t, const size_t,
+                                             const float2,
+                                             const cl_mem, const cl_mem, const cl_mem,
+                                             const cl_mem, const size_t, const size_t,
+                                             const float2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Csrmm<double2>(const Layout, const size_t, const size_t, const size_t, const size_t,
+                                              const double2,
+                                              const cl_mem, const cl_mem, const cl_mem,
+                                              const cl_mem, const size_t, const size_t,
+                                              const double2,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Csrmm<half>(const Layout, const size_t, const size_t, const size_t, const size_t,
+                                           const half,
+                                           const cl_mem, const cl_mem, const cl_mem,
+                                           const cl_mem, const size_t, const size_t,
+                                           const half,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Conversions between single-precision and bfloat16 data
+StatusCode ConvertToBFloat16(const size_t n,
+                             const cl_mem src_buffer, const size_t src_offset,
+                             cl_mem dest_buffer, const size_t dest_offset,
+                             cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xconvert(queue_cpp, event);
+    routine.DoConvertToBFloat16(n,
+                                Buffer<float>(src_buffer), src_offset,
+                                Buffer<bfloat16>(dest_buffer), dest_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode ConvertFromBFloat16(const size_t n,
+                               const cl_mem src_buffer, const size_t src_offset,
+                               cl_mem dest_buffer, const size_t dest_offset,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xconvert(queue_cpp, event);
+    routine.DoConvertFromBFloat16(n,
+                                  Buffer<bfloat16>(src_buffer), src_offset,
+                                  Buffer<float>(dest_buffer), dest_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// Conversions between single-precision and half-precision data
+StatusCode ConvertToHalf(const size_t n,
+                         const cl_mem src_buffer, const size_t src_offset,
+                         cl_mem dest_buffer, const size_t dest_offset,
+                         cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xconvert(queue_cpp, event);
+    routine.DoConvertToHalf(n,
+                            Buffer<float>(src_buffer), src_offset,
+                            Buffer<half>(dest_buffer), dest_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode ConvertFromHalf(const size_t n,
+                           const cl_mem src_buffer, const size_t src_offset,
+                           cl_mem dest_buffer, const size_t dest_offset,
+                           cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xconvert(queue_cpp, event);
+    routine.DoConvertFromHalf(n,
+                              Buffer<half>(src_buffer), src_offset,
+                              Buffer<float>(dest_buffer), dest_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// Type-converting scaling and out-place transpose/copy
+StatusCode OmatcopyToHalf(const Layout layout, const Transpose a_transpose,
+                          const size_t m, const size_t n,
+                          const float alpha,
+                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                          cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                          cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xomatcopy<float>(queue_cpp, event, "OMATCOPYTOHALF");
+    routine.DoOmatcopyConvert(layout, a_transpose,
+                              m, n,
+                              alpha,
+                              Buffer<float>(a_buffer), a_offset, a_ld,
+                              Buffer<half>(b_buffer), b_offset, b_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode OmatcopyFromHalf(const Layout layout, const Transpose a_transpose,
+                            const size_t m, const size_t n,
+                            const half alpha,
+                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                            cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                            cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xomatcopy<half>(queue_cpp, event, "OMATCOPYFROMHALF");
+    routine.DoOmatcopyConvert(layout, a_transpose,
+                              m, n,
+                              alpha,
+                              Buffer<half>(a_buffer), a_offset, a_ld,
+                              Buffer<float>(b_buffer), b_offset, b_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// The routines which support bfloat16 data: the computations are performed in single precision
+template StatusCode PUBLIC_API Axpy<bfloat16>(const size_t,
+                                              const bfloat16,
+                                              const cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gemm<bfloat16>(const Layout, const Transpose, const Transpose,
+                                              const size_t, const size_t, const size_t,
+                                              const bfloat16,
+                                              const cl_mem, const size_t, const size_t,
+                                              const cl_mem, const size_t, const size_t,
+                                              const bfloat16,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*, cl_mem);
+
+// =================================================================================================
+
+// Integer matrix-multiplication for quantised data
+StatusCode GemmInt8(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                    const size_t m, const size_t n, const size_t k,
+                    const int alpha,
+                    const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                    const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                    const int beta,
+                    cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                    cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmInt8(queue_cpp, event);
+    routine.DoGemmInt8(layout, a_transpose, b_transpose,
+                       m, n, k,
+                       alpha,
+                       Buffer<int8>(a_buffer), a_offset, a_ld,
+                       Buffer<int8>(b_buffer), b_offset, b_ld,
+                       beta,
+                       Buffer<int>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode GemmInt8Requantized(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                               const size_t m, const size_t n, const size_t k,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                               const cl_mem scales_buffer, const size_t scales_offset,
+                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmInt8(queue_cpp, event);
+    routine.DoGemmInt8Requantized(layout, a_transpose, b_transpose,
+                                  m, n, k,
+                                  Buffer<int8>(a_buffer), a_offset, a_ld,
+                                  Buffer<int8>(b_buffer), b_offset, b_ld,
+                                  Buffer<float>(scales_buffer), scales_offset,
+                                  Buffer<int8>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// =================================================================================================
+
+// Matrix-vector and small matrix-matrix multiplication with quantised weights
+template <typename T>
+StatusCode QuantizeWeights(const QuantizedFormat format,
+                           const size_t m, const size_t k, const size_t group_size,
+                           const cl_mem w_buffer, const size_t w_offset, const size_t w_ld,
+                           cl_mem q_buffer, const size_t q_offset,
+                           cl_mem scales_buffer, const size_t scales_offset,
+                           cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemvQuantized<T>(queue_cpp, event);
+    routine.DoQuantizeWeights(format, m, k, group_size,
+                              Buffer<T>(w_buffer), w_offset, w_ld,
+                              Buffer<unsigned int>(q_buffer), q_offset,
+                              Buffer<T>(scales_buffer), scales_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API QuantizeWeights<float>(const QuantizedFormat,
+                                                      const size_t, const size_t, const size_t,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      cl_mem, const size_t,
+                                                      cl_mem, const size_t,
+                                                      cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API QuantizeWeights<half>(const QuantizedFormat,
+                                                     const size_t, const size_t, const size_t,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     cl_mem, const size_t,
+                                                     cl_mem, const size_t,
+                                                     cl_command_queue*, cl_event*);
+
+template <typename T>
+StatusCode GemvQuantized(const QuantizedFormat format,
+                         const size_t m, const size_t k, const size_t group_size,
+                         const T alpha,
+                         const cl_mem q_buffer, const size_t q_offset,
+                         const cl_mem scales_buffer, const size_t scales_offset,
+                         const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                         const T beta,
+                         cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                         cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemvQuantized<T>(queue_cpp, event);
+    routine.DoGemvQuantized(format, m, k, group_size,
+                            alpha,
+                            Buffer<unsigned int>(q_buffer), q_offset,
+                            Buffer<T>(scales_buffer), scales_offset,
+                            Buffer<T>(x_buffer), x_offset, x_inc,
+                            beta,
+                            Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvQuantized<float>(const QuantizedFormat,
+                                                    const size_t, const size_t, const size_t,
+                                                    const float,
+                                                    const cl_mem, const size_t,
+                                                    const cl_mem, const size_t,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const float,
+                                                    cl_mem, const size_t, const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvQuantized<half>(const QuantizedFormat,
+                                                   const size_t, const size_t, const size_t,
+                                                   const half,
+                                                   const cl_mem, const size_t,
+                                                   const cl_mem, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const half,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+
+template <typename T>
+StatusCode GemmQuantized(const QuantizedFormat format,
+                         const size_t m, const size_t n, const size_t k, const size_t group_size,
+                         const T alpha,
+                         const cl_mem q_buffer, const size_t q_offset,
+                         const cl_mem scales_buffer, const size_t scales_offset,
+                         const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                         const T beta,
+                         cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                         cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemvQuantized<T>(queue_cpp, event);
+    routine.DoGemmQuantized(format, m, n, k, group_size,
+                            alpha,
+                            Buffer<unsigned int>(q_buffer), q_offset,
+                            Buffer<T>(scales_buffer), scales_offset,
+                            Buffer<T>(b_buffer), b_offset, b_ld,
+                            beta,
+                            Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmQuantized<float>(const QuantizedFormat,
+                                                    const size_t, const size_t, const size_t, const size_t,
+                                                    const float,
+                                                    const cl_mem, const size_t,
+                                                    const cl_mem, const size_t,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const float,
+                                                    cl_mem, const size_t, const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmQuantized<half>(const QuantizedFormat,
+                                                   const size_t, const size_t, const size_t, const size_t,
+                                                   const half,
+                                                   const cl_mem, const size_t,
+                                                   const cl_mem, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const half,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Multi-device GEMM on matrices in host memory
+template <typename T>
+StatusCode GemmMultiDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                           const size_t m, const size_t n, const size_t k,
+                           const T alpha,
+                           const T* a, const size_t a_ld,
+                           const T* b, const size_t b_ld,
+                           const T beta,
+                           T* c, const size_t c_ld,
+                           const std::vector<cl_command_queue> &queues,
+                           const std::vector<double> &weights) {
+  try {
+    auto queues_cpp = std::vector<Queue>();
+    for (const auto &queue : queues) { queues_cpp.push_back(Queue(queue)); }
+    auto routine = XgemmMultiDevice<T>(queues_cpp, weights);
+    routine.DoGemmMultiDevice(layout, a_transpose, b_transpose, m, n, k, alpha,
+                              a, a_ld, b, b_ld, beta, c, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmMultiDevice<float>(const Layout, const Transpose, const Transpose,
+                                                      const size_t, const size_t, const size_t,
+                                                      const float, const float*, const size_t,
+                                                      const float*, const size_t,
+                                                      const float, float*, const size_t,
+                                                      const std::vector<cl_command_queue>&,
+                                                      const std::vector<double>&);
+template StatusCode PUBLIC_API GemmMultiDevice<double>(const Layout, const Transpose, const Transpose,
+                                                       const size_t, const size_t, const size_t,
+                                                       const double, const double*, const size_t,
+                                                       const double*, const size_t,
+                                                       const double, double*, const size_t,
+                                                       const std::vector<cl_command_queue>&,
+                                                       const std::vector<double>&);
+template StatusCode PUBLIC_API GemmMultiDevice<float2>(const Layout, const Transpose, const Transpose,
+                                                       const size_t, const size_t, const size_t,
+                                                       const float2, const float2*, const size_t,
+                                                       const float2*, const size_t,
+                                                       const float2, float2*, const size_t,
+                                                       const std::vector<cl_command_queue>&,
+                                                       const std::vector<double>&);
+template StatusCode PUBLIC_API GemmMultiDevice<double2>(const Layout, const Transpose, const Transpose,
+                                                        const size_t, const size_t, const size_t,
+                                                        const double2, const double2*, const size_t,
+                                                        const double2*, const size_t,
+                                                        const double2, double2*, const size_t,
+                                                        const std::vector<cl_command_queue>&,
+                                                        const std::vector<double>&);
+template StatusCode PUBLIC_API GemmMultiDevice<half>(const Layout, const Transpose, const Transpose,
+                                                     const size_t, const size_t, const size_t,
+                                                     const half, const half*, const size_t,
+                                                     const half*, const size_t,
+                                                     const half, half*, const size_t,
+                                                     const std::vector<cl_command_queue>&,
+                                                     const std::vector<double>&);
+
+// Multi-device strided-batched GEMM on matrices in host memory
+template <typename T>
+StatusCode GemmStridedBatchedMultiDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                         const size_t m, const size_t n, const size_t k,
+                                         const T alpha,
+                                         const T* a, const size_t a_ld, const size_t a_stride,
+                                         const T* b, const size_t b_ld, const size_t b_stride,
+                                         const T beta,
+                                         T* c, const size_t c_ld, const size_t c_stride,
+                                         const size_t batch_count,
+                                         const std::vector<cl_command_queue> &queues,
+                                         const std::vector<double> &weights) {
+  try {
+    auto queues_cpp = std::vector<Queue>();
+    for (const auto &queue : queues) { queues_cpp.push_back(Queue(queue)); }
+    auto routine = XgemmMultiDevice<T>(queues_cpp, weights);
+    routine.DoGemmStridedBatchedMultiDevice(layout, a_transpose, b_transpose, m, n, k, alpha,
+                                            a, a_ld, a_stride, b, b_ld, b_stride, beta,
+                                            c, c_ld, c_stride, batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmStridedBatchedMultiDevice<float>(const Layout, const Transpose, const Transpose,
+                                                                    const size_t, const size_t, const size_t,
+                                                                    const float, const float*, const size_t, const size_t,
+                                                                    const float*, const size_t, const size_t,
+                                                                    const float, float*, const size_t, const size_t,
+                                                                    const size_t,
+                                                                    const std::vector<cl_command_queue>&,
+                                                                    const std::vector<double>&);
+template StatusCode PUBLIC_API GemmStridedBatchedMultiDevice<double>(const Layout, const Transpose, const Transpose,
+                                                                     const size_t, const size_t, const size_t,
+                                                                     const double, const double*, const size_t, const size_t,
+                                                                     const double*, const size_t, const size_t,
+                                                                     const double, double*, const size_t, const size_t,
+                                                                     const size_t,
+                                                                     const std::vector<cl_command_queue>&,
+                                                                     const std::vector<double>&);
+template StatusCode PUBLIC_API GemmStridedBatchedMultiDevice<float2>(const Layout, const Transpose, const Transpose,
+                                                                     const size_t, const size_t, const size_t,
+                                                                     const float2, const float2*, const size_t, const size_t,
+                                                                     const float2*, const size_t, const size_t,
+                                                                     const float2, float2*, const size_t, const size_t,
+                                                                     const size_t,
+                                                                     const std::vector<cl_command_queue>&,
+                                                                     const std::vector<double>&);
+template StatusCode PUBLIC_API GemmStridedBatchedMultiDevice<double2>(const Layout, const Transpose, const Transpose,
+                                                                      const size_t, const size_t, const size_t,
+                                                                      const double2, const double2*, const size_t, const size_t,
+                                                                      const double2*, const size_t, const size_t,
+                                                                      const double2, double2*, const size_t, const size_t,
+                                                                      const size_t,
+                                                                      const std::vector<cl_command_queue>&,
+                                                                      const std::vector<double>&);
+template StatusCode PUBLIC_API GemmStridedBatchedMultiDevice<half>(const Layout, const Transpose, const Transpose,
+                                                                   const size_t, const size_t, const size_t,
+                                                                   const half, const half*, const size_t, const size_t,
+                                                                   const half*, const size_t, const size_t,
+                                                                   const half, half*, const size_t, const size_t,
+                                                                   const size_t,
+                                                                   const std::vector<cl_command_queue>&,
+                                                                   const std::vector<double>&);
+
+// Queues on the sub-devices of a device
+StatusCode CreateSubDeviceQueues(const cl_device_id device, std::vector<cl_command_queue> &queues) {
+  try {
+    queues.clear();
+    for (const auto &queue : CreateSubDeviceQueues(Device(device))) {
+      CheckError(clRetainCommandQueue(queue()));
+      queues.push_back(queue());
+    }
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// Streaming GEMM on matrices in host memory
+template <typename T>
+StatusCode GemmStreaming(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                         const size_t m, const size_t n, const size_t k,
+                         const T alpha,
+                         const T* a, const size_t a_ld,
+                         const T* b, const size_t b_ld,
+                         const T beta,
+                         T* c, const size_t c_ld,
+                         cl_command_queue* queue, const size_t tile_size) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmStreaming<T>(queue_cpp, tile_size);
+    routine.DoGemmStreaming(layout, a_transpose, b_transpose, m, n, k, alpha,
+                            a, a_ld, b, b_ld, beta, c, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmStreaming<float>(const Layout, const Transpose, const Transpose,
+                                                    const size_t, const size_t, const size_t,
+                                                    const float, const float*, const size_t,
+                                                    const float*, const size_t,
+                                                    const float, float*, const size_t,
+                                                    cl_command_queue*, const size_t);
+template StatusCode PUBLIC_API GemmStreaming<double>(const Layout, const Transpose, const Transpose,
+                                                     const size_t, const size_t, const size_t,
+                                                     const double, const double*, const size_t,
+                                                     const double*, const size_t,
+                                                     const double, double*, const size_t,
+                                                     cl_command_queue*, const size_t);
+template StatusCode PUBLIC_API GemmStreaming<float2>(const Layout, const Transpose, const Transpose,
+                                                     const size_t, const size_t, const size_t,
+                                                     const float2, const float2*, const size_t,
+                                                     const float2*, const size_t,
+                                                     const float2, float2*, const size_t,
+                                                     cl_command_queue*, const size_t);
+template StatusCode PUBLIC_API GemmStreaming<double2>(const Layout, const Transpose, const Transpose,
+                                                      const size_t, const size_t, const size_t,
+                                                      const double2, const double2*, const size_t,
+                                                      const double2*, const size_t,
+                                                      const double2, double2*, const size_t,
+                                                      cl_command_queue*, const size_t);
+template StatusCode PUBLIC_API GemmStreaming<half>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const half, const half*, const size_t,
+                                                   const half*, const size_t,
+                                                   const half, half*, const size_t,
+                                                   cl_command_queue*, const size_t);
+
+// =================================================================================================
+
+// Helpers for the SVM variants: the sizes of the matrices and vectors in elements, and the
+// creation of a buffer which uses the memory of an SVM pointer itself
+namespace {
+size_t MatrixSizeSVM(const Layout layout, const bool transposed, const size_t rows, const size_t cols,
+                     const size_t ld) {
+  const auto rotated = (layout == Layout::kRowMajor) != transposed;
+  const auto one = (rotated) ? cols : rows;
+  const auto two = (rotated) ? rows : cols;
+  return (one == 0 || two == 0) ? 1 : ld * (two - 1) + one;
+}
+size_t VectorSizeSVM(const size_t n, const size_t inc) {
+  return (n == 0) ? 1 : inc * (n - 1) + 1;
+}
+template <typename T>
+Buffer<T> BufferFromSVM(const Queue &queue, const T* pointer, const size_t size) {
+  if (pointer == nullptr) { return Buffer<T>(nullptr); }
+  auto status = CL_SUCCESS;
+  auto buffer = clCreateBuffer(queue.GetContext()(), CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR,
+                               size * sizeof(T), const_cast<T*>(pointer), &status);
+  CLCudaAPIError::Check(status, "clCreateBuffer");
+  return Buffer<T>(std::shared_ptr<cl_mem>(new cl_mem{buffer}, [](cl_mem* m) {
+    CheckErrorDtor(clReleaseMemObject(*m));
+    delete m;
+  }));
+}
+} // anonymous namespace
+
+// GEMM on SVM pointers
+template <typename T>
+StatusCode GemmSVM(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                   const size_t m, const size_t n, const size_t k,
+                   const T alpha,
+                   const T* a, const size_t a_ld,
+                   const T* b, const size_t b_ld,
+                   const T beta,
+                   T* c, const size_t c_ld,
+                   cl_command_queue* queue, cl_event* event) {
+  try {
+    const auto queue_cpp = Queue(*queue);
+    const auto a_transposed = (a_transpose != Transpose::kNo);
+    const auto b_transposed = (b_transpose != Transpose::kNo);
+    const auto a_buffer = BufferFromSVM(queue_cpp, a, MatrixSizeSVM(layout, a_transposed, m, k, a_ld));
+    const auto b_buffer = BufferFromSVM(queue_cpp, b, MatrixSizeSVM(layout, b_transposed, k, n, b_ld));
+    const auto c_buffer = BufferFromSVM(queue_cpp, c, MatrixSizeSVM(layout, false, m, n, c_ld));
+    return Gemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                a_buffer(), 0, a_ld, b_buffer(), 0, b_ld, beta, c_buffer(), 0, c_ld,
+                queue, event);
+  } catch (...) { return DispatchException(); }
+}
+
+// Strided-batched GEMM on SVM pointers
+template <typename T>
+StatusCode GemmStridedBatchedSVM(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                 const size_t m, const size_t n, const size_t k,
+                                 const T alpha,
+                                 const T* a, const size_t a_ld, const size_t a_stride,
+                                 const T* b, const size_t b_ld, const size_t b_stride,
+                                 const T beta,
+                                 T* c, const size_t c_ld, const size_t c_stride,
+                                 const size_t batch_count,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    const auto queue_cpp = Queue(*queue);
+    const auto batches = (batch_count == 0) ? 0 : batch_count - 1;
+    const auto a_transposed = (a_transpose != Transpose::kNo);
+    const auto b_transposed = (b_transpose != Transpose::kNo);
+    const auto a_size = a_stride * batches + MatrixSizeSVM(layout, a_transposed, m, k, a_ld);
+    const auto b_size = b_stride * batches + MatrixSizeSVM(layout, b_transposed, k, n, b_ld);
+    const auto c_size = c_stride * batches + MatrixSizeSVM(layout, false, m, n, c_ld);
+    const auto a_buffer = BufferFromSVM(queue_cpp, a, a_size);
+    const auto b_buffer = BufferFromSVM(queue_cpp, b, b_size);
+    const auto c_buffer = BufferFromSVM(queue_cpp, c, c_size);
+    return GemmStridedBatched(layout, a_transpose, b_transpose, m, n, k, alpha,
+                              a_buffer(), 0, a_ld, a_stride, b_buffer(), 0, b_ld, b_stride, beta,
+                              c_buffer(), 0, c_ld, c_stride, batch_count, queue, event);
+  } catch (...) { return DispatchException(); }
+}
+
+// AXPY on SVM pointers
+template <typename T>
+StatusCode AxpySVM(const size_t n,
+                   const T alpha,
+                   const T* x, const size_t x_inc,
+                   T* y, const size_t y_inc,
+                   cl_command_queue* queue, cl_event* event) {
+  try {
+    const auto queue_cpp = Queue(*queue);
+    const auto x_buffer = BufferFromSVM(queue_cpp, x, VectorSizeSVM(n, x_inc));
+    const auto y_buffer = BufferFromSVM(queue_cpp, y, VectorSizeSVM(n, y_inc));
+    return Axpy(n, alpha, x_buffer(), 0, x_inc, y_buffer(), 0, y_inc, queue, event);
+  } catch (...) { return DispatchException(); }
+}
+
+// DOT on SVM pointers
+template <typename T>
+StatusCode DotSVM(const size_t n,
+                  T* dot,
+                  const T* x, const size_t x_inc,
+                  const T* y, const size_t y_inc,
+                  cl_command_queue* queue, cl_event* event) {
+  try {
+    const auto queue_cpp = Queue(*queue);
+    const auto dot_buffer = BufferFromSVM(queue_cpp, static_cast<const T*>(dot), size_t{1});
+    const auto x_buffer = BufferFromSVM(queue_cpp, x, VectorSizeSVM(n, x_inc));
+    const auto y_buffer = BufferFromSVM(queue_cpp, y, VectorSizeSVM(n, y_inc));
+    return Dot<T>(n, dot_buffer(), 0, x_buffer(), 0, x_inc, y_buffer(), 0, y_inc, queue, event);
+  } catch (...) { return DispatchException(); }
+}
+
+// GEMV on SVM pointers
+template <typename T>
+StatusCode GemvSVM(const Layout layout, const Transpose a_transpose,
+                   const size_t m, const size_t n,
+                   const T alpha,
+                   const T* a, const size_t a_ld,
+                   const T* x, const size_t x_inc,
+                   const T beta,
+                   T* y, const size_t y_inc,
+                   cl_command_queue* queue, cl_event* event) {
+  try {
+    const auto queue_cpp = Queue(*queue);
+    const auto a_transposed = (a_transpose != Transpose::kNo);
+    const auto x_size = VectorSizeSVM((a_transposed) ? m : n, x_inc);
+    const auto y_size = VectorSizeSVM((a_transposed) ? n : m, y_inc);
+    const auto a_buffer = BufferFromSVM(queue_cpp, a, MatrixSizeSVM(layout, false, m, n, a_ld));
+    const auto x_buffer = BufferFromSVM(queue_cpp, x, x_size);
+    const auto y_buffer = BufferFromSVM(queue_cpp, y, y_size);
+    return Gemv(layout, a_transpose, m, n, alpha, a_buffer(), 0, a_ld, x_buffer(), 0, x_inc,
+                beta, y_buffer(), 0, y_inc, queue, event);
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmSVM<float>(const Layout, const Transpose, const Transpose,
+                                              const size_t, const size_t, const size_t,
+                                              const float, const float*, const size_t,
+                                              const float*, const size_t,
+                                              const float, float*, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmSVM<double>(const Layout, const Transpose, const Transpose,
+                                               const size_t, const size_t, const size_t,
+                                               const double, const double*, const size_t,
+                                               const double*, const size_t,
+                                               const double, double*, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmSVM<float2>(const Layout, const Transpose, const Transpose,
+                                               const size_t, const size_t, const size_t,
+                                               const float2, const float2*, const size_t,
+                                               const float2*, const size_t,
+                                               const float2, float2*, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmSVM<double2>(const Layout, const Transpose, const Transpose,
+                                                const size_t, const size_t, const size_t,
+                                                const double2, const double2*, const size_t,
+                                                const double2*, const size_t,
+                                                const double2, double2*, const size_t,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmSVM<half>(const Layout, const Transpose, const Transpose,
+                                             const size_t, const size_t, const size_t,
+                                             const half, const half*, const size_t,
+                                             const half*, const size_t,
+                                             const half, half*, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatchedSVM<float>(const Layout, const Transpose, const Transpose,
+                                                            const size_t, const size_t, const size_t,
+                                                            const float, const float*, const size_t, const size_t,
+                                                            const float*, const size_t, const size_t,
+                                                            const float, float*, const size_t, const size_t,
+                                                            const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatchedSVM<double>(const Layout, const Transpose, const Transpose,
+                                                             const size_t, const size_t, const size_t,
+                                                             const double, const double*, const size_t, const size_t,
+                                                             const double*, const size_t, const size_t,
+                                                             const double, double*, const size_t, const size_t,
+                                                             const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatchedSVM<float2>(const Layout, const Transpose, const Transpose,
+                                                             const size_t, const size_t, const size_t,
+                                                             const float2, const float2*, const size_t, const size_t,
+                                                             const float2*, const size_t, const size_t,
+                                                             const float2, float2*, const size_t, const size_t,
+                                                             const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatchedSVM<double2>(const Layout, const Transpose, const Transpose,
+                                                              const size_t, const size_t, const size_t,
+                                                              const double2, const double2*, const size_t, const size_t,
+                                                              const double2*, const size_t, const size_t,
+                                                              const double2, double2*, const size_t, const size_t,
+                                                              const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatchedSVM<half>(const Layout, const Transpose, const Transpose,
+                                                           const size_t, const size_t, const size_t,
+                                                           const half, const half*, const size_t, const size_t,
+                                                           const half*, const size_t, const size_t,
+                                                           const half, half*, const size_t, const size_t,
+                                                           const size_t, cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpySVM<float>(const size_t, const float,
+                                              const float*, const size_t, float*, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpySVM<double>(const size_t, const double,
+                                               const double*, const size_t, double*, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpySVM<float2>(const size_t, const float2,
+                                               const float2*, const size_t, float2*, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpySVM<double2>(const size_t, const double2,
+                                                const double2*, const size_t, double2*, const size_t,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpySVM<half>(const size_t, const half,
+                                             const half*, const size_t, half*, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotSVM<float>(const size_t, float*,
+                                             const float*, const size_t, const float*, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotSVM<double>(const size_t, double*,
+                                              const double*, const size_t, const double*, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotSVM<half>(const size_t, half*,
+                                            const half*, const size_t, const half*, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvSVM<float>(const Layout, const Transpose, const size_t, const size_t,
+                                              const float, const float*, const size_t,
+                                              const float*, const size_t,
+                                              const float, float*, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvSVM<double>(const Layout, const Transpose, const size_t, const size_t,
+                                               const double, const double*, const size_t,
+                                               const double*, const size_t,
+                                               const double, double*, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvSVM<float2>(const Layout, const Transpose, const size_t, const size_t,
+                                               const float2, const float2*, const size_t,
+                                               const float2*, const size_t,
+                                               const float2, float2*, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvSVM<double2>(const Layout, const Transpose, const size_t, const size_t,
+                                                const double2, const double2*, const size_t,
+                                                const double2*, const size_t,
+                                                const double2, double2*, const size_t,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvSVM<half>(const Layout, const Transpose, const size_t, const size_t,
+                                             const half, const half*, const size_t,
+                                             const half*, const size_t,
+                                             const half, half*, const size_t,
+                                             cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Capture and replay of command graphs
+StatusCode GraphBeginCapture(cl_command_queue* queue) {
+  try {
+    CommandGraph::BeginCapture(Queue(*queue));
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode GraphEndCapture(cl_command_queue* queue, CommandGraph** graph) {
+  try {
+    *graph = CommandGraph::EndCapture(Queue(*queue));
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode GraphLaunch(CommandGraph* graph, cl_command_queue* queue, cl_event* event) {
+  try {
+    graph->Launch(Queue(*queue), event);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode GraphDestroy(CommandGraph* graph) {
+  try {
+    delete graph;
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// =================================================================================================
+
+// Input dependencies of the next routine on a queue
+StatusCode SetEventWaitList(cl_command_queue* queue, const size_t num_events,
+                            const cl_event* events) {
+  try {
+    auto inputs = std::vector<Event>(num_events);
+    for (auto i = size_t{0}; i < num_events; ++i) {
+      CheckError(clRetainEvent(events[i]));
+      inputs[i]() = events[i];
+    }
+    SetInputEvents(Queue(*queue), std::move(inputs));
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// Regions of independent routine calls spread over a pool of queues
+StatusCode BeginConcurrentRegion(cl_command_queue* queue, const size_t num_queues) {
+  try {
+    BeginQueuePool(Queue(*queue), num_queues);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode EndConcurrentRegion(cl_command_queue* queue, cl_event* event) {
+  try {
+    EndQueuePool(Queue(*queue), event);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// User-provided workspaces for the temporary buffers
+StatusCode SetWorkspace(cl_command_queue* queue, const cl_mem buffer, const size_t bytes) {
+  try {
+    Workspaces::Instance().Attach(Queue(*queue), buffer, bytes);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode RemoveWorkspace(cl_command_queue* queue) {
+  try {
+    Workspaces::Instance().Detach(Queue(*queue));
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode GetWorkspaceSize(cl_command_queue* queue, size_t &bytes) {
+  try {
+    bytes = Workspaces::Instance().PeakSize(Queue(*queue));
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// =================================================================================================
+
+// The handle functions: the routine overloads taking a handle call 'HandleQueue' directly
+cl_command_queue* HandleQueue(Handle* handle) {
+  return handle->Activate();
+}
+StatusCode HandleCreate(cl_command_queue* queue, Handle** handle) {
+  try {
+    *handle = new Handle(*queue);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode HandleDestroy(Handle* handle) {
+  try {
+    delete handle;
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode HandleSetWorkspace(Handle* handle, const cl_mem buffer, const size_t bytes) {
+  try {
+    handle->AttachWorkspace(buffer, bytes);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode HandleGetStatistics(Handle* handle, HandleStatistics &statistics) {
+  try {
+    statistics = handle->GetStatistics();
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// The math mode, globally or of the routines called through a handle
+StatusCode SetMathMode(const MathMode mode) {
+  try {
+    Handle::SetGlobalMathMode(mode);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode HandleSetMathMode(Handle* handle, const MathMode mode) {
+  try {
+    handle->SetMathMode(mode);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// The properties of the 'cl_khr_priority_hints' and 'cl_khr_throttle_hints' extensions. These are
+// declared locally, since they are not declared in older OpenCL headers. The values of the high,
+// medium and low hints are the same for both.
+namespace {
+constexpr cl_queue_properties kQueuePriorityKHR = 0x1096;
+constexpr cl_queue_properties kQueueThrottleKHR = 0x1097;
+constexpr cl_queue_properties QueueHintValue(const int level) { // 1: low, 2: medium, 3: high
+  return (level == 3) ? (1 << 0) : (level == 2) ? (1 << 1) : (1 << 2);
+}
+} // anonymous namespace
+
+// Queues with scheduling hints
+StatusCode CreatePriorityQueue(const cl_context context, const cl_device_id device,
+                               const QueuePriority priority, const QueueThrottle throttle,
+                               cl_command_queue* queue) {
+  try {
+    const auto device_cpp = Device(device);
+    auto properties = std::vector<cl_queue_properties>{CL_QUEUE_PROPERTIES,
+                                                       CL_QUEUE_PROFILING_ENABLE};
+    if (priority != QueuePriority::kDefault && device_cpp.HasExtension("cl_khr_priority_hints")) {
+      properties.push_back(kQueuePriorityKHR);
+      properties.push_back(QueueHintValue(static_cast<int>(priority)));
+    }
+    if (throttle != QueueThrottle::kDefault && device_cpp.HasExtension("cl_khr_throttle_hints")) {
+      properties.push_back(kQueueThrottleKHR);
+      properties.push_back(QueueHintValue(static_cast<int>(throttle)));
+    }
+    properties.push_back(0);
+    auto status = CL_SUCCESS;
+    *queue = clCreateCommandQueueWithProperties(context, device, properties.data(), &status);
+    CLCudaAPIError::Check(status, "clCreateCommandQueueWithProperties");
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// Memory and semaphores of other APIs
+StatusCode ImportExternalMemory(const cl_context context, const cl_device_id device,
+                                const ExternalMemoryHandle handle_type, const intptr_t handle,
+                                const size_t size, cl_mem* buffer) {
+  try {
+    *buffer = ImportMemory(Context(context), Device(device), handle_type, handle, size);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode ImportExternalSemaphore(const cl_context context, const cl_device_id device,
+                                   const ExternalSemaphoreHandle handle_type, const intptr_t handle,
+                                   ExternalSemaphore* semaphore) {
+  try {
+    *semaphore = ImportSemaphore(Context(context), Device(device), handle_type, handle);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode ReleaseExternalSemaphore(const cl_device_id device, const ExternalSemaphore semaphore) {
+  try {
+    ReleaseSemaphore(Device(device), semaphore);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode AcquireExternalMemory(const std::vector<cl_mem> &buffers,
+                                 const std::vector<ExternalSemaphore> &wait_semaphores,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    AcquireMemory(Queue(*queue), buffers, wait_semaphores, event);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode ReleaseExternalMemory(const std::vector<cl_mem> &buffers,
+                                 const std::vector<ExternalSemaphore> &signal_semaphores,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    ReleaseMemory(Queue(*queue), buffers, signal_semaphores, event);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// Runtime profiling hooks
+StatusCode SetProfilingCallback(ProfilingCallback callback, void* user_data) {
+  try {
+    SetProfiling(callback, user_data);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// The slow-call log
+StatusCode SetSlowCallThreshold(const double threshold_ms, SlowCallCallback callback,
+                                void* user_data) {
+  try {
+    if (threshold_ms < 0.0) { return StatusCode::kInvalidValue; }
+    SetSlowCallLog(threshold_ms, callback, user_data);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// Statistics of the internal activity
+StatusCode GetStatistics(Statistics &statistics) {
+  try {
+    CollectStatistics(statistics);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode ResetStatistics() {
+  try {
+    ResetAllStatistics();
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// Online tuning of the GEMM kernel
+StatusCode SetOnlineTuningDirectory(const std::string &directory) {
+  try {
+    SetOnlineTuning(directory);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// Tiered compilation of the routines' kernels
+StatusCode SetTieredCompilation(const bool enabled) {
+  try {
+    EnableTieredCompilation(enabled);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// Profile-guided warm-up of the kernel programs
+StatusCode SetWarmUpDirectory(const std::string &directory) {
+  try {
+    SetWarmUp(directory);
     return StatusCode::kSuccess;
   } catch (...) { return DispatchException(); }
 }
-template StatusCode PUBLIC_API GemmTempBufferSize<float>(const Layout, const Transpose, const Transpose,
-                                                         const size_t, const size_t, const size_t,
-                                                         const size_t, const size_t, const size_t, const size_t,
-                                                         const size_t, const size_t, cl_command_queue*, size_t&);
-template StatusCode PUBLIC_API GemmTempBufferSize<double>(const Layout, const Transpose, const Transpose,
-                                                          const size_t, const size_t, const size_t,
-                                                          const size_t, const size_t, const size_t, const size_t,
-                                                          const size_t, const size_t, cl_command_queue*, size_t&);
-template StatusCode PUBLIC_API GemmTempBufferSize<float2>(const Layout, const Transpose, const Transpose,
-                                                          const size_t, const size_t, const size_t,
-                                                          const size_t, const size_t, const size_t, const size_t,
-                                                          const size_t, const size_t, cl_command_queue*, size_t&);
-template StatusCode PUBLIC_API GemmTempBufferSize<double2>(const Layout, const Transpose, const Transpose,
-                                                           const size_t, const size_t, const size_t,
-                                                           const size_t, const size_t, const size_t, const size_t,
-                                                           const size_t, const size_t, cl_command_queue*, size_t&);
-template StatusCode PUBLIC_API GemmTempBufferSize<half>(const Layout, const Transpose, const Transpose,
-                                                        const size_t, const size_t, const size_t,
-                                                        const size_t, const size_t, const size_t, const size_t,
-                                                        const size_t, const size_t, cl_command_queue*, size_t&);
 
 // =================================================================================================
 } // namespace clblast
@@ -3520,6 +3520,160 @@ CLBlastStatusCode CLBlastHhad(const size_t n,
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
+// AXPBY
+CLBlastStatusCode CLBlastSaxpby(const size_t n,
+                                const float alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const float beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     alpha,
+                     x_buffer, x_offset, x_inc,
+                     beta,
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDaxpby(const size_t n,
+                                const double alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const double beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     alpha,
+                     x_buffer, x_offset, x_inc,
+                     beta,
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCaxpby(const size_t n,
+                                const cl_float2 alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const cl_float2 beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     float2{alpha.s[0], alpha.s[1]},
+                     x_buffer, x_offset, x_inc,
+                     float2{beta.s[0], beta.s[1]},
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZaxpby(const size_t n,
+                                const cl_double2 alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const cl_double2 beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     double2{alpha.s[0], alpha.s[1]},
+                     x_buffer, x_offset, x_inc,
+                     double2{beta.s[0], beta.s[1]},
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpby(const size_t n,
+                                const cl_half alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const cl_half beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     alpha,
+                     x_buffer, x_offset, x_inc,
+                     beta,
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// SET
+CLBlastStatusCode CLBlastSset(const size_t n,
+                              const float alpha,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Set(n,
+                   alpha,
+                   x_buffer, x_offset, x_inc,
+                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDset(const size_t n,
+                              const double alpha,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Set(n,
+                   alpha,
+                   x_buffer, x_offset, x_inc,
+                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCset(const size_t n,
+                              const cl_float2 alpha,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Set(n,
+                   float2{alpha.s[0], alpha.s[1]},
+                   x_buffer, x_offset, x_inc,
+                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZset(const size_t n,
+                              const cl_double2 alpha,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Set(n,
+                   double2{alpha.s[0], alpha.s[1]},
+                   x_buffer, x_offset, x_inc,
+                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHset(const size_t n,
+                              const cl_half alpha,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Set(n,
+                   alpha,
+                   x_buffer, x_offset, x_inc,
+                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
 // OMATCOPY
 CLBlastStatusCode CLBlastSomatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                                    const size_t m, const size_t n,
@@ -3679,6 +3833,197 @@ CLBlastStatusCode CLBlastHim2col(const size_t channels, const size_t height, con
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
+// COL2IM
+CLBlastStatusCode CLBlastScol2im(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                 const cl_mem col_buffer, const size_t col_offset,
+                                 cl_mem im_buffer, const size_t im_offset,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Col2im<float>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                             col_buffer, col_offset,
+                             im_buffer, im_offset,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDcol2im(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                 const cl_mem col_buffer, const size_t col_offset,
+                                 cl_mem im_buffer, const size_t im_offset,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Col2im<double>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                              col_buffer, col_offset,
+                              im_buffer, im_offset,
+                              queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCcol2im(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                 const cl_mem col_buffer, const size_t col_offset,
+                                 cl_mem im_buffer, const size_t im_offset,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Col2im<float2>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                              col_buffer, col_offset,
+                              im_buffer, im_offset,
+                              queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZcol2im(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                 const cl_mem col_buffer, const size_t col_offset,
+                                 cl_mem im_buffer, const size_t im_offset,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Col2im<double2>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                               col_buffer, col_offset,
+                               im_buffer, im_offset,
+                               queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHcol2im(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                 const cl_mem col_buffer, const size_t col_offset,
+                                 cl_mem im_buffer, const size_t im_offset,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Col2im<half>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                            col_buffer, col_offset,
+                            im_buffer, im_offset,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// DOTNRM2ASUM
+CLBlastStatusCode CLBlastSdotnrm2asum(const size_t n,
+                                      cl_mem results_buffer, const size_t results_offset,
+                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                      const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Dotnrm2asum<float>(n,
+                                  results_buffer, results_offset,
+                                  x_buffer, x_offset, x_inc,
+                                  y_buffer, y_offset, y_inc,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDdotnrm2asum(const size_t n,
+                                      cl_mem results_buffer, const size_t results_offset,
+                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                      const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Dotnrm2asum<double>(n,
+                                   results_buffer, results_offset,
+                                   x_buffer, x_offset, x_inc,
+                                   y_buffer, y_offset, y_inc,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHdotnrm2asum(const size_t n,
+                                      cl_mem results_buffer, const size_t results_offset,
+                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                      const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Dotnrm2asum<half>(n,
+                                 results_buffer, results_offset,
+                                 x_buffer, x_offset, x_inc,
+                                 y_buffer, y_offset, y_inc,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// CONVGEMM
+CLBlastStatusCode CLBlastSconvgemm(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const size_t num_kernels, const size_t batch_count,
+                                   const cl_mem im_buffer, const size_t im_offset,
+                                   const cl_mem kernel_buffer, const size_t kernel_offset,
+                                   cl_mem result_buffer, const size_t result_offset,
+                                   cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Convgemm<float>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count,
+                               im_buffer, im_offset,
+                               kernel_buffer, kernel_offset,
+                               result_buffer, result_offset,
+                               queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDconvgemm(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const size_t num_kernels, const size_t batch_count,
+                                   const cl_mem im_buffer, const size_t im_offset,
+                                   const cl_mem kernel_buffer, const size_t kernel_offset,
+                                   cl_mem result_buffer, const size_t result_offset,
+                                   cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Convgemm<double>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count,
+                                im_buffer, im_offset,
+                                kernel_buffer, kernel_offset,
+                                result_buffer, result_offset,
+                                queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHconvgemm(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const size_t num_kernels, const size_t batch_count,
+                                   const cl_mem im_buffer, const size_t im_offset,
+                                   const cl_mem kernel_buffer, const size_t kernel_offset,
+                                   cl_mem result_buffer, const size_t result_offset,
+                                   cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Convgemm<half>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count,
+                              im_buffer, im_offset,
+                              kernel_buffer, kernel_offset,
+                              result_buffer, result_offset,
+                              queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// POTRF
+CLBlastStatusCode CLBlastSpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Potrf<float>(static_cast<clblast::Layout>(layout),
+                            static_cast<clblast::Triangle>(triangle),
+                            n,
+                            a_buffer, a_offset, a_ld,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Potrf<double>(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Triangle>(triangle),
+                             n,
+                             a_buffer, a_offset, a_ld,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
 // AXPY
 CLBlastStatusCode CLBlastSaxpyBatched(const size_t n,
                                       const float *alphas,
@@ -3786,14 +4131,66 @@ CLBlastStatusCode CLBlastHaxpyBatched(const size_t n,
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
-// GEMM
-CLBlastStatusCode CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                                      const size_t m, const size_t n, const size_t k,
+// ROT
+CLBlastStatusCode CLBlastSrotBatched(const size_t n,
+                                     cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                     cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                     const float *coss,
+                                     const float *sins,
+                                     const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto coss_cpp = std::vector<float>();
+  auto sins_cpp = std::vector<float>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    coss_cpp.push_back(coss[batch]);
+    sins_cpp.push_back(sins[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::RotBatched(n,
+                          x_buffer, x_offsets, x_inc,
+                          y_buffer, y_offsets, y_inc,
+                          coss_cpp.data(),
+                          sins_cpp.data(),
+                          batch_count,
+                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDrotBatched(const size_t n,
+                                     cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                     cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                     const double *coss,
+                                     const double *sins,
+                                     const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto coss_cpp = std::vector<double>();
+  auto sins_cpp = std::vector<double>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    coss_cpp.push_back(coss[batch]);
+    sins_cpp.push_back(sins[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::RotBatched(n,
+                          x_buffer, x_offsets, x_inc,
+                          y_buffer, y_offsets, y_inc,
+                          coss_cpp.data(),
+                          sins_cpp.data(),
+                          batch_count,
+                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// GEMV
+CLBlastStatusCode CLBlastSgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
                                       const float *alphas,
                                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
-                                      const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
                                       const float *betas,
-                                      cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
                                       const size_t batch_count,
                                       cl_command_queue* queue, cl_event* event) {
   auto alphas_cpp = std::vector<float>();
@@ -3804,21 +4201,173 @@ CLBlastStatusCode CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastT
   }
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::GemmBatched(static_cast<clblast::Layout>(layout),
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
                            static_cast<clblast::Transpose>(a_transpose),
-                           static_cast<clblast::Transpose>(b_transpose),
-                           m, n, k,
+                           m, n,
                            alphas_cpp.data(),
                            a_buffer, a_offsets, a_ld,
-                           b_buffer, b_offsets, b_ld,
+                           x_buffer, x_offsets, x_inc,
                            betas_cpp.data(),
-                           c_buffer, c_offsets, c_ld,
+                           y_buffer, y_offsets, y_inc,
                            batch_count,
                            queue, event)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
-CLBlastStatusCode CLBlastDgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+CLBlastStatusCode CLBlastDgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const double *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const double *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double>();
+  auto betas_cpp = std::vector<double>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const cl_float2 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const cl_float2 *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float2>();
+  auto betas_cpp = std::vector<float2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(float2{alphas[batch].s[0], alphas[batch].s[1]});
+    betas_cpp.push_back(float2{betas[batch].s[0], betas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const cl_double2 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const cl_double2 *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double2>();
+  auto betas_cpp = std::vector<double2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(double2{alphas[batch].s[0], alphas[batch].s[1]});
+    betas_cpp.push_back(double2{betas[batch].s[0], betas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const cl_half *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const cl_half *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<half>();
+  auto betas_cpp = std::vector<half>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// GEMM
+CLBlastStatusCode CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                      const size_t m, const size_t n, const size_t k,
+                                      const float *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                      const float *betas,
+                                      cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float>();
+  auto betas_cpp = std::vector<float>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Transpose>(b_transpose),
+                           m, n, k,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           b_buffer, b_offsets, b_ld,
+                           betas_cpp.data(),
+                           c_buffer, c_offsets, c_ld,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
                                       const size_t m, const size_t n, const size_t k,
                                       const double *alphas,
                                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
@@ -4070,239 +4619,3118 @@ CLBlastStatusCode CLBlastHgemmStridedBatched(const CLBlastLayout layout, const C
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
-// =================================================================================================
-
-// GEMM with temporary buffer (optional, for advanced users)
-CLBlastStatusCode CLBlastSgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                                             const size_t m, const size_t n, const size_t k,
-                                             const float alpha,
-                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
-                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
-                                             const float beta,
-                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
-                                             cl_command_queue* queue, cl_event* event,
-                                             cl_mem temp_buffer) {
+// TRSM
+CLBlastStatusCode CLBlastStrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                      const size_t m, const size_t n,
+                                      const float *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+  }
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::Gemm(static_cast<clblast::Layout>(layout),
-                    static_cast<clblast::Transpose>(a_transpose),
-                    static_cast<clblast::Transpose>(b_transpose),
-                    m, n, k,
-                    alpha,
-                    a_buffer, a_offset, a_ld,
-                    b_buffer, b_offset, b_ld,
-                    beta,
-                    c_buffer, c_offset, c_ld,
-                    queue, event, temp_buffer)
+      clblast::TrsmBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Side>(side),
+                           static_cast<clblast::Triangle>(triangle),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Diagonal>(diagonal),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           b_buffer, b_offsets, b_ld,
+                           batch_count,
+                           queue, event)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
-CLBlastStatusCode CLBlastDgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                                             const size_t m, const size_t n, const size_t k,
-                                             const double alpha,
-                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
-                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
-                                             const double beta,
-                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
-                                             cl_command_queue* queue, cl_event* event,
-                                             cl_mem temp_buffer) {
+CLBlastStatusCode CLBlastDtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                      const size_t m, const size_t n,
+                                      const double *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+  }
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::Gemm(static_cast<clblast::Layout>(layout),
-                    static_cast<clblast::Transpose>(a_transpose),
-                    static_cast<clblast::Transpose>(b_transpose),
-                    m, n, k,
-                    alpha,
-                    a_buffer, a_offset, a_ld,
-                    b_buffer, b_offset, b_ld,
-                    beta,
-                    c_buffer, c_offset, c_ld,
-                    queue, event, temp_buffer)
+      clblast::TrsmBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Side>(side),
+                           static_cast<clblast::Triangle>(triangle),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Diagonal>(diagonal),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           b_buffer, b_offsets, b_ld,
+                           batch_count,
+                           queue, event)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
-CLBlastStatusCode CLBlastCgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                                             const size_t m, const size_t n, const size_t k,
-                                             const cl_float2 alpha,
-                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
-                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
-                                             const cl_float2 beta,
-                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
-                                             cl_command_queue* queue, cl_event* event,
-                                             cl_mem temp_buffer) {
+CLBlastStatusCode CLBlastCtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                      const size_t m, const size_t n,
+                                      const cl_float2 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(float2{alphas[batch].s[0], alphas[batch].s[1]});
+  }
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::Gemm(static_cast<clblast::Layout>(layout),
-                    static_cast<clblast::Transpose>(a_transpose),
-                    static_cast<clblast::Transpose>(b_transpose),
-                    m, n, k,
-                    float2{alpha.s[0], alpha.s[1]},
-                    a_buffer, a_offset, a_ld,
-                    b_buffer, b_offset, b_ld,
-                    float2{beta.s[0], beta.s[1]},
-                    c_buffer, c_offset, c_ld,
-                    queue, event, temp_buffer)
+      clblast::TrsmBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Side>(side),
+                           static_cast<clblast::Triangle>(triangle),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Diagonal>(diagonal),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           b_buffer, b_offsets, b_ld,
+                           batch_count,
+                           queue, event)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
-CLBlastStatusCode CLBlastZgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                                             const size_t m, const size_t n, const size_t k,
-                                             const cl_double2 alpha,
-                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
-                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
-                                             const cl_double2 beta,
-                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
-                                             cl_command_queue* queue, cl_event* event,
-                                             cl_mem temp_buffer) {
+CLBlastStatusCode CLBlastZtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                      const size_t m, const size_t n,
+                                      const cl_double2 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(double2{alphas[batch].s[0], alphas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Side>(side),
+                           static_cast<clblast::Triangle>(triangle),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Diagonal>(diagonal),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           b_buffer, b_offsets, b_ld,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// TRSM
+CLBlastStatusCode CLBlastStrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Diagonal>(diagonal),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Diagonal>(diagonal),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Diagonal>(diagonal),
+                                  m, n,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Diagonal>(diagonal),
+                                  m, n,
+                                  double2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// SYMM
+CLBlastStatusCode CLBlastSsymmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                             const size_t m, const size_t n,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const float beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SymmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  beta,
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDsymmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                             const size_t m, const size_t n,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const double beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SymmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  beta,
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCsymmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                             const size_t m, const size_t n,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const cl_float2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SymmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  m, n,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  float2{beta.s[0], beta.s[1]},
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZsymmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                             const size_t m, const size_t n,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const cl_double2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SymmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  m, n,
+                                  double2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  double2{beta.s[0], beta.s[1]},
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHsymmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
+                                             const size_t m, const size_t n,
+                                             const cl_half alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const cl_half beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SymmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  beta,
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// SYRK
+CLBlastStatusCode CLBlastSsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                                             const size_t n, const size_t k,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const float beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SyrkStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  n, k,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  beta,
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                                             const size_t n, const size_t k,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const double beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SyrkStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  n, k,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  beta,
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                                             const size_t n, const size_t k,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_float2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SyrkStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  n, k,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  float2{beta.s[0], beta.s[1]},
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                                             const size_t n, const size_t k,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_double2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SyrkStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  n, k,
+                                  double2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  double2{beta.s[0], beta.s[1]},
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
+                                             const size_t n, const size_t k,
+                                             const cl_half alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_half beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SyrkStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  n, k,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  beta,
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// TRMM
+CLBlastStatusCode CLBlastStrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrmmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Diagonal>(diagonal),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDtrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrmmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Diagonal>(diagonal),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCtrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrmmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Diagonal>(diagonal),
+                                  m, n,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZtrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrmmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Diagonal>(diagonal),
+                                  m, n,
+                                  double2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHtrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const cl_half alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrmmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Diagonal>(diagonal),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// INVERT
+CLBlastStatusCode CLBlastSinvertBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diagonal,
+                                        const size_t n,
+                                        const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                        cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                        const size_t batch_count,
+                                        cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::InvertBatched<float>(static_cast<clblast::Layout>(layout),
+                                    static_cast<clblast::Triangle>(triangle),
+                                    static_cast<clblast::Diagonal>(diagonal),
+                                    n,
+                                    a_buffer, a_offsets, a_ld,
+                                    b_buffer, b_offsets, b_ld,
+                                    batch_count,
+                                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDinvertBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diagonal,
+                                        const size_t n,
+                                        const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                        cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                        const size_t batch_count,
+                                        cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::InvertBatched<double>(static_cast<clblast::Layout>(layout),
+                                     static_cast<clblast::Triangle>(triangle),
+                                     static_cast<clblast::Diagonal>(diagonal),
+                                     n,
+                                     a_buffer, a_offsets, a_ld,
+                                     b_buffer, b_offsets, b_ld,
+                                     batch_count,
+                                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCinvertBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diagonal,
+                                        const size_t n,
+                                        const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                        cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                        const size_t batch_count,
+                                        cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::InvertBatched<float2>(static_cast<clblast::Layout>(layout),
+                                     static_cast<clblast::Triangle>(triangle),
+                                     static_cast<clblast::Diagonal>(diagonal),
+                                     n,
+                                     a_buffer, a_offsets, a_ld,
+                                     b_buffer, b_offsets, b_ld,
+                                     batch_count,
+                                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZinvertBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diagonal,
+                                        const size_t n,
+                                        const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                        cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                        const size_t batch_count,
+                                        cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::InvertBatched<double2>(static_cast<clblast::Layout>(layout),
+                                      static_cast<clblast::Triangle>(triangle),
+                                      static_cast<clblast::Diagonal>(diagonal),
+                                      n,
+                                      a_buffer, a_offsets, a_ld,
+                                      b_buffer, b_offsets, b_ld,
+                                      batch_count,
+                                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// POTRF
+CLBlastStatusCode CLBlastSpotrfStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                              const size_t n,
+                                              cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                              const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::PotrfStridedBatched<float>(static_cast<clblast::Layout>(layout),
+                                          static_cast<clblast::Triangle>(triangle),
+                                          n,
+                                          a_buffer, a_offset, a_ld, a_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDpotrfStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                              const size_t n,
+                                              cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                              const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::PotrfStridedBatched<double>(static_cast<clblast::Layout>(layout),
+                                           static_cast<clblast::Triangle>(triangle),
+                                           n,
+                                           a_buffer, a_offset, a_ld, a_stride,
+                                           batch_count,
+                                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// GEMV
+CLBlastStatusCode CLBlastSgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const float beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  beta,
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const double beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  beta,
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const cl_float2 beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  float2{beta.s[0], beta.s[1]},
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const cl_double2 beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  double2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  double2{beta.s[0], beta.s[1]},
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const cl_half alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const cl_half beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  beta,
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// TRSV
+CLBlastStatusCode CLBlastStrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t n,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsvStridedBatched<float>(static_cast<clblast::Layout>(layout),
+                                         static_cast<clblast::Triangle>(triangle),
+                                         static_cast<clblast::Transpose>(a_transpose),
+                                         static_cast<clblast::Diagonal>(diagonal),
+                                         n,
+                                         a_buffer, a_offset, a_ld, a_stride,
+                                         x_buffer, x_offset, x_inc, x_stride,
+                                         batch_count,
+                                         queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t n,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsvStridedBatched<double>(static_cast<clblast::Layout>(layout),
+                                          static_cast<clblast::Triangle>(triangle),
+                                          static_cast<clblast::Transpose>(a_transpose),
+                                          static_cast<clblast::Diagonal>(diagonal),
+                                          n,
+                                          a_buffer, a_offset, a_ld, a_stride,
+                                          x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t n,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsvStridedBatched<float2>(static_cast<clblast::Layout>(layout),
+                                          static_cast<clblast::Triangle>(triangle),
+                                          static_cast<clblast::Transpose>(a_transpose),
+                                          static_cast<clblast::Diagonal>(diagonal),
+                                          n,
+                                          a_buffer, a_offset, a_ld, a_stride,
+                                          x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t n,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsvStridedBatched<double2>(static_cast<clblast::Layout>(layout),
+                                           static_cast<clblast::Triangle>(triangle),
+                                           static_cast<clblast::Transpose>(a_transpose),
+                                           static_cast<clblast::Diagonal>(diagonal),
+                                           n,
+                                           a_buffer, a_offset, a_ld, a_stride,
+                                           x_buffer, x_offset, x_inc, x_stride,
+                                           batch_count,
+                                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// OMATCOPY
+CLBlastStatusCode CLBlastSomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const float alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::OmatcopyStridedBatched(static_cast<clblast::Layout>(layout),
+                                      static_cast<clblast::Transpose>(a_transpose),
+                                      m, n,
+                                      alpha,
+                                      a_buffer, a_offset, a_ld, a_stride,
+                                      b_buffer, b_offset, b_ld, b_stride,
+                                      batch_count,
+                                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const double alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::OmatcopyStridedBatched(static_cast<clblast::Layout>(layout),
+                                      static_cast<clblast::Transpose>(a_transpose),
+                                      m, n,
+                                      alpha,
+                                      a_buffer, a_offset, a_ld, a_stride,
+                                      b_buffer, b_offset, b_ld, b_stride,
+                                      batch_count,
+                                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastComatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_float2 alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::OmatcopyStridedBatched(static_cast<clblast::Layout>(layout),
+                                      static_cast<clblast::Transpose>(a_transpose),
+                                      m, n,
+                                      float2{alpha.s[0], alpha.s[1]},
+                                      a_buffer, a_offset, a_ld, a_stride,
+                                      b_buffer, b_offset, b_ld, b_stride,
+                                      batch_count,
+                                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_double2 alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::OmatcopyStridedBatched(static_cast<clblast::Layout>(layout),
+                                      static_cast<clblast::Transpose>(a_transpose),
+                                      m, n,
+                                      double2{alpha.s[0], alpha.s[1]},
+                                      a_buffer, a_offset, a_ld, a_stride,
+                                      b_buffer, b_offset, b_ld, b_stride,
+                                      batch_count,
+                                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_half alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::OmatcopyStridedBatched(static_cast<clblast::Layout>(layout),
+                                      static_cast<clblast::Transpose>(a_transpose),
+                                      m, n,
+                                      alpha,
+                                      a_buffer, a_offset, a_ld, a_stride,
+                                      b_buffer, b_offset, b_ld, b_stride,
+                                      batch_count,
+                                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// IM2COL
+CLBlastStatusCode CLBlastSim2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                               const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                               cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                               const size_t batch_count,
+                                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Im2colStridedBatched<float>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                           im_buffer, im_offset, im_stride,
+                                           col_buffer, col_offset, col_stride,
+                                           batch_count,
+                                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDim2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                               const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                               cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                               const size_t batch_count,
+                                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Im2colStridedBatched<double>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                            im_buffer, im_offset, im_stride,
+                                            col_buffer, col_offset, col_stride,
+                                            batch_count,
+                                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCim2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                               const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                               cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                               const size_t batch_count,
+                                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Im2colStridedBatched<float2>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                            im_buffer, im_offset, im_stride,
+                                            col_buffer, col_offset, col_stride,
+                                            batch_count,
+                                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZim2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                               const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                               cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                               const size_t batch_count,
+                                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Im2colStridedBatched<double2>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                             im_buffer, im_offset, im_stride,
+                                             col_buffer, col_offset, col_stride,
+                                             batch_count,
+                                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHim2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                               const cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                               cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                               const size_t batch_count,
+                                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Im2colStridedBatched<half>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                          im_buffer, im_offset, im_stride,
+                                          col_buffer, col_offset, col_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// COL2IM
+CLBlastStatusCode CLBlastScol2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                               const cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                               cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                               const size_t batch_count,
+                                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Col2imStridedBatched<float>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                           col_buffer, col_offset, col_stride,
+                                           im_buffer, im_offset, im_stride,
+                                           batch_count,
+                                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDcol2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                               const cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                               cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                               const size_t batch_count,
+                                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Col2imStridedBatched<double>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                            col_buffer, col_offset, col_stride,
+                                            im_buffer, im_offset, im_stride,
+                                            batch_count,
+                                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCcol2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                               const cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                               cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                               const size_t batch_count,
+                                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Col2imStridedBatched<float2>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                            col_buffer, col_offset, col_stride,
+                                            im_buffer, im_offset, im_stride,
+                                            batch_count,
+                                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZcol2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                               const cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                               cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                               const size_t batch_count,
+                                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Col2imStridedBatched<double2>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                             col_buffer, col_offset, col_stride,
+                                             im_buffer, im_offset, im_stride,
+                                             batch_count,
+                                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHcol2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                               const cl_mem col_buffer, const size_t col_offset, const size_t col_stride,
+                                               cl_mem im_buffer, const size_t im_offset, const size_t im_stride,
+                                               const size_t batch_count,
+                                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Col2imStridedBatched<half>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                          col_buffer, col_offset, col_stride,
+                                          im_buffer, im_offset, im_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// AXPY
+CLBlastStatusCode CLBlastSaxpyStridedBatched(const size_t n,
+                                             const float alpha,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyStridedBatched(n,
+                                  alpha,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDaxpyStridedBatched(const size_t n,
+                                             const double alpha,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyStridedBatched(n,
+                                  alpha,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCaxpyStridedBatched(const size_t n,
+                                             const cl_float2 alpha,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyStridedBatched(n,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZaxpyStridedBatched(const size_t n,
+                                             const cl_double2 alpha,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyStridedBatched(n,
+                                  double2{alpha.s[0], alpha.s[1]},
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpyStridedBatched(const size_t n,
+                                             const cl_half alpha,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyStridedBatched(n,
+                                  alpha,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// AXPBY
+CLBlastStatusCode CLBlastSaxpbyStridedBatched(const size_t n,
+                                              const float alpha,
+                                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                              const float beta,
+                                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                              const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpbyStridedBatched(n,
+                                   alpha,
+                                   x_buffer, x_offset, x_inc, x_stride,
+                                   beta,
+                                   y_buffer, y_offset, y_inc, y_stride,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDaxpbyStridedBatched(const size_t n,
+                                              const double alpha,
+                                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                              const double beta,
+                                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                              const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpbyStridedBatched(n,
+                                   alpha,
+                                   x_buffer, x_offset, x_inc, x_stride,
+                                   beta,
+                                   y_buffer, y_offset, y_inc, y_stride,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCaxpbyStridedBatched(const size_t n,
+                                              const cl_float2 alpha,
+                                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                              const cl_float2 beta,
+                                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                              const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpbyStridedBatched(n,
+                                   float2{alpha.s[0], alpha.s[1]},
+                                   x_buffer, x_offset, x_inc, x_stride,
+                                   float2{beta.s[0], beta.s[1]},
+                                   y_buffer, y_offset, y_inc, y_stride,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZaxpbyStridedBatched(const size_t n,
+                                              const cl_double2 alpha,
+                                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                              const cl_double2 beta,
+                                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                              const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpbyStridedBatched(n,
+                                   double2{alpha.s[0], alpha.s[1]},
+                                   x_buffer, x_offset, x_inc, x_stride,
+                                   double2{beta.s[0], beta.s[1]},
+                                   y_buffer, y_offset, y_inc, y_stride,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpbyStridedBatched(const size_t n,
+                                              const cl_half alpha,
+                                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                              const cl_half beta,
+                                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                              const size_t batch_count,
+                                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpbyStridedBatched(n,
+                                   alpha,
+                                   x_buffer, x_offset, x_inc, x_stride,
+                                   beta,
+                                   y_buffer, y_offset, y_inc, y_stride,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// SET
+CLBlastStatusCode CLBlastSsetStridedBatched(const size_t n,
+                                            const float alpha,
+                                            cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SetStridedBatched(n,
+                                 alpha,
+                                 x_buffer, x_offset, x_inc, x_stride,
+                                 batch_count,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDsetStridedBatched(const size_t n,
+                                            const double alpha,
+                                            cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SetStridedBatched(n,
+                                 alpha,
+                                 x_buffer, x_offset, x_inc, x_stride,
+                                 batch_count,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCsetStridedBatched(const size_t n,
+                                            const cl_float2 alpha,
+                                            cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SetStridedBatched(n,
+                                 float2{alpha.s[0], alpha.s[1]},
+                                 x_buffer, x_offset, x_inc, x_stride,
+                                 batch_count,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZsetStridedBatched(const size_t n,
+                                            const cl_double2 alpha,
+                                            cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SetStridedBatched(n,
+                                 double2{alpha.s[0], alpha.s[1]},
+                                 x_buffer, x_offset, x_inc, x_stride,
+                                 batch_count,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHsetStridedBatched(const size_t n,
+                                            const cl_half alpha,
+                                            cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SetStridedBatched(n,
+                                 alpha,
+                                 x_buffer, x_offset, x_inc, x_stride,
+                                 batch_count,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// SCAL
+CLBlastStatusCode CLBlastSscalStridedBatched(const size_t n,
+                                             const float alpha,
+                                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ScalStridedBatched(n,
+                                  alpha,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDscalStridedBatched(const size_t n,
+                                             const double alpha,
+                                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ScalStridedBatched(n,
+                                  alpha,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCscalStridedBatched(const size_t n,
+                                             const cl_float2 alpha,
+                                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ScalStridedBatched(n,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZscalStridedBatched(const size_t n,
+                                             const cl_double2 alpha,
+                                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ScalStridedBatched(n,
+                                  double2{alpha.s[0], alpha.s[1]},
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHscalStridedBatched(const size_t n,
+                                             const cl_half alpha,
+                                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ScalStridedBatched(n,
+                                  alpha,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// DOT
+CLBlastStatusCode CLBlastSdotStridedBatched(const size_t n,
+                                            cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotStridedBatched<float>(n,
+                                        dot_buffer, dot_offset, dot_stride,
+                                        x_buffer, x_offset, x_inc, x_stride,
+                                        y_buffer, y_offset, y_inc, y_stride,
+                                        batch_count,
+                                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDdotStridedBatched(const size_t n,
+                                            cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotStridedBatched<double>(n,
+                                         dot_buffer, dot_offset, dot_stride,
+                                         x_buffer, x_offset, x_inc, x_stride,
+                                         y_buffer, y_offset, y_inc, y_stride,
+                                         batch_count,
+                                         queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHdotStridedBatched(const size_t n,
+                                            cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotStridedBatched<half>(n,
+                                       dot_buffer, dot_offset, dot_stride,
+                                       x_buffer, x_offset, x_inc, x_stride,
+                                       y_buffer, y_offset, y_inc, y_stride,
+                                       batch_count,
+                                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// NRM2
+CLBlastStatusCode CLBlastSnrm2StridedBatched(const size_t n,
+                                             cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2StridedBatched<float>(n,
+                                         nrm2_buffer, nrm2_offset, nrm2_stride,
+                                         x_buffer, x_offset, x_inc, x_stride,
+                                         batch_count,
+                                         queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDnrm2StridedBatched(const size_t n,
+                                             cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2StridedBatched<double>(n,
+                                          nrm2_buffer, nrm2_offset, nrm2_stride,
+                                          x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastScnrm2StridedBatched(const size_t n,
+                                             cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2StridedBatched<float2>(n,
+                                          nrm2_buffer, nrm2_offset, nrm2_stride,
+                                          x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDznrm2StridedBatched(const size_t n,
+                                             cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2StridedBatched<double2>(n,
+                                           nrm2_buffer, nrm2_offset, nrm2_stride,
+                                           x_buffer, x_offset, x_inc, x_stride,
+                                           batch_count,
+                                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHnrm2StridedBatched(const size_t n,
+                                             cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2StridedBatched<half>(n,
+                                        nrm2_buffer, nrm2_offset, nrm2_stride,
+                                        x_buffer, x_offset, x_inc, x_stride,
+                                        batch_count,
+                                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// ASUM
+CLBlastStatusCode CLBlastSasumStridedBatched(const size_t n,
+                                             cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumStridedBatched<float>(n,
+                                         asum_buffer, asum_offset, asum_stride,
+                                         x_buffer, x_offset, x_inc, x_stride,
+                                         batch_count,
+                                         queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDasumStridedBatched(const size_t n,
+                                             cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumStridedBatched<double>(n,
+                                          asum_buffer, asum_offset, asum_stride,
+                                          x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastScasumStridedBatched(const size_t n,
+                                             cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumStridedBatched<float2>(n,
+                                          asum_buffer, asum_offset, asum_stride,
+                                          x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDzasumStridedBatched(const size_t n,
+                                             cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumStridedBatched<double2>(n,
+                                           asum_buffer, asum_offset, asum_stride,
+                                           x_buffer, x_offset, x_inc, x_stride,
+                                           batch_count,
+                                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHasumStridedBatched(const size_t n,
+                                             cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumStridedBatched<half>(n,
+                                        asum_buffer, asum_offset, asum_stride,
+                                        x_buffer, x_offset, x_inc, x_stride,
+                                        batch_count,
+                                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// GEMM with temporary buffer (optional, for advanced users)
+CLBlastStatusCode CLBlastSgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const float beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event,
+                                             cl_mem temp_buffer) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gemm(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n, k,
+                    alpha,
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    beta,
+                    c_buffer, c_offset, c_ld,
+                    queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const double beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event,
+                                             cl_mem temp_buffer) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gemm(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n, k,
+                    alpha,
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    beta,
+                    c_buffer, c_offset, c_ld,
+                    queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const cl_float2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event,
+                                             cl_mem temp_buffer) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gemm(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n, k,
+                    float2{alpha.s[0], alpha.s[1]},
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    float2{beta.s[0], beta.s[1]},
+                    c_buffer, c_offset, c_ld,
+                    queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const cl_double2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event,
+                                             cl_mem temp_buffer) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gemm(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n, k,
+                    double2{alpha.s[0], alpha.s[1]},
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    double2{beta.s[0], beta.s[1]},
+                    c_buffer, c_offset, c_ld,
+                    queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const cl_half alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const cl_half beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event,
+                                             cl_mem temp_buffer) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gemm(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n, k,
+                    alpha,
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    beta,
+                    c_buffer, c_offset, c_ld,
+                    queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// GEMM get temporary buffer size
+CLBlastStatusCode CLBlastSGemmTempBufferSize(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                               const size_t m, const size_t n, const size_t k,
+                               const size_t a_offset, const size_t a_ld,
+                               const size_t b_offset, const size_t b_ld,
+                               const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue,
+							   size_t* temp_buffer_size){
+
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmTempBufferSize<float>(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Transpose>(b_transpose),
+                           m, n, k,
+                           a_offset, a_ld,
+                           b_offset, b_ld,
+                           c_offset, c_ld,
+                           queue, *temp_buffer_size)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+CLBlastStatusCode CLBlastDGemmTempBufferSize(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                               const size_t m, const size_t n, const size_t k,
+                               const size_t a_offset, const size_t a_ld,
+                               const size_t b_offset, const size_t b_ld,
+                               const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue,
+							   size_t* temp_buffer_size){
+
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmTempBufferSize<double>(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Transpose>(b_transpose),
+                           m, n, k,
+                           a_offset, a_ld,
+                           b_offset, b_ld,
+                           c_offset, c_ld,
+                           queue, *temp_buffer_size)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+CLBlastStatusCode CLBlastCGemmTempBufferSize(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                               const size_t m, const size_t n, const size_t k,
+                               const size_t a_offset, const size_t a_ld,
+                               const size_t b_offset, const size_t b_ld,
+                               const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue,
+							   size_t* temp_buffer_size){
+
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::Gemm(static_cast<clblast::Layout>(layout),
-                    static_cast<clblast::Transpose>(a_transpose),
-                    static_cast<clblast::Transpose>(b_transpose),
-                    m, n, k,
-                    double2{alpha.s[0], alpha.s[1]},
-                    a_buffer, a_offset, a_ld,
-                    b_buffer, b_offset, b_ld,
-                    double2{beta.s[0], beta.s[1]},
-                    c_buffer, c_offset, c_ld,
-                    queue, event, temp_buffer)
+      clblast::GemmTempBufferSize<float2>(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Transpose>(b_transpose),
+                           m, n, k,
+                           a_offset, a_ld,
+                           b_offset, b_ld,
+                           c_offset, c_ld,
+                           queue, *temp_buffer_size)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+CLBlastStatusCode CLBlastZGemmTempBufferSize(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                               const size_t m, const size_t n, const size_t k,
+                               const size_t a_offset, const size_t a_ld,
+                               const size_t b_offset, const size_t b_ld,
+                               const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue,
+							   size_t* temp_buffer_size){
+
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmTempBufferSize<double2>(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Transpose>(b_transpose),
+                           m, n, k,
+                           a_offset, a_ld,
+                           b_offset, b_ld,
+                           c_offset, c_ld,
+                           queue, *temp_buffer_size)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+CLBlastStatusCode CLBlastHGemmTempBufferSize(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                               const size_t m, const size_t n, const size_t k,
+                               const size_t a_offset, const size_t a_ld,
+                               const size_t b_offset, const size_t b_ld,
+                               const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue,
+							   size_t* temp_buffer_size){
+
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmTempBufferSize<half>(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Transpose>(b_transpose),
+                           m, n, k,
+                           a_offset, a_ld,
+                           b_offset, b_ld,
+                           c_offset, c_ld,
+                           queue, *temp_buffer_size)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// GEMM plans: the C handle is the C++ plan of the precision of the functions
+CLBlastStatusCode CLBlastSGemmPlanCreate(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                         const size_t m, const size_t n, const size_t k,
+                                         const size_t a_offset, const size_t a_ld,
+                                         const size_t b_offset, const size_t b_ld,
+                                         const size_t c_offset, const size_t c_ld,
+                                         cl_command_queue* queue, CLBlastGemmPlan* plan) {
+  try {
+    if (plan == nullptr) { return CLBlastInvalidValue; }
+    auto plan_cpp = static_cast<clblast::GemmPlan<float>*>(nullptr);
+    const auto status = clblast::GemmPlanCreate<float>(static_cast<clblast::Layout>(layout),
+                                                       static_cast<clblast::Transpose>(a_transpose),
+                                                       static_cast<clblast::Transpose>(b_transpose),
+                                                       m, n, k, a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
+                                                       queue, &plan_cpp);
+    *plan = reinterpret_cast<CLBlastGemmPlan>(plan_cpp);
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastSGemmPlanExecute(CLBlastGemmPlan plan, const float alpha,
+                                          const cl_mem a_buffer, const cl_mem b_buffer,
+                                          const float beta, cl_mem c_buffer,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPlanExecute<float>(reinterpret_cast<clblast::GemmPlan<float>*>(plan),
+                                      alpha, a_buffer, b_buffer,
+                                      beta, c_buffer, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastSGemmPlanDestroy(CLBlastGemmPlan plan) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPlanDestroy<float>(reinterpret_cast<clblast::GemmPlan<float>*>(plan))
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDGemmPlanCreate(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                         const size_t m, const size_t n, const size_t k,
+                                         const size_t a_offset, const size_t a_ld,
+                                         const size_t b_offset, const size_t b_ld,
+                                         const size_t c_offset, const size_t c_ld,
+                                         cl_command_queue* queue, CLBlastGemmPlan* plan) {
+  try {
+    if (plan == nullptr) { return CLBlastInvalidValue; }
+    auto plan_cpp = static_cast<clblast::GemmPlan<double>*>(nullptr);
+    const auto status = clblast::GemmPlanCreate<double>(static_cast<clblast::Layout>(layout),
+                                                        static_cast<clblast::Transpose>(a_transpose),
+                                                        static_cast<clblast::Transpose>(b_transpose),
+                                                        m, n, k, a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
+                                                        queue, &plan_cpp);
+    *plan = reinterpret_cast<CLBlastGemmPlan>(plan_cpp);
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDGemmPlanExecute(CLBlastGemmPlan plan, const double alpha,
+                                          const cl_mem a_buffer, const cl_mem b_buffer,
+                                          const double beta, cl_mem c_buffer,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPlanExecute<double>(reinterpret_cast<clblast::GemmPlan<double>*>(plan),
+                                       alpha, a_buffer, b_buffer,
+                                       beta, c_buffer, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDGemmPlanDestroy(CLBlastGemmPlan plan) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPlanDestroy<double>(reinterpret_cast<clblast::GemmPlan<double>*>(plan))
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCGemmPlanCreate(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                         const size_t m, const size_t n, const size_t k,
+                                         const size_t a_offset, const size_t a_ld,
+                                         const size_t b_offset, const size_t b_ld,
+                                         const size_t c_offset, const size_t c_ld,
+                                         cl_command_queue* queue, CLBlastGemmPlan* plan) {
+  try {
+    if (plan == nullptr) { return CLBlastInvalidValue; }
+    auto plan_cpp = static_cast<clblast::GemmPlan<float2>*>(nullptr);
+    const auto status = clblast::GemmPlanCreate<float2>(static_cast<clblast::Layout>(layout),
+                                                        static_cast<clblast::Transpose>(a_transpose),
+                                                        static_cast<clblast::Transpose>(b_transpose),
+                                                        m, n, k, a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
+                                                        queue, &plan_cpp);
+    *plan = reinterpret_cast<CLBlastGemmPlan>(plan_cpp);
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCGemmPlanExecute(CLBlastGemmPlan plan, const cl_float2 alpha,
+                                          const cl_mem a_buffer, const cl_mem b_buffer,
+                                          const cl_float2 beta, cl_mem c_buffer,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPlanExecute<float2>(reinterpret_cast<clblast::GemmPlan<float2>*>(plan),
+                                       float2{alpha.s[0], alpha.s[1]}, a_buffer, b_buffer,
+                                       float2{beta.s[0], beta.s[1]}, c_buffer, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCGemmPlanDestroy(CLBlastGemmPlan plan) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPlanDestroy<float2>(reinterpret_cast<clblast::GemmPlan<float2>*>(plan))
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZGemmPlanCreate(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                         const size_t m, const size_t n, const size_t k,
+                                         const size_t a_offset, const size_t a_ld,
+                                         const size_t b_offset, const size_t b_ld,
+                                         const size_t c_offset, const size_t c_ld,
+                                         cl_command_queue* queue, CLBlastGemmPlan* plan) {
+  try {
+    if (plan == nullptr) { return CLBlastInvalidValue; }
+    auto plan_cpp = static_cast<clblast::GemmPlan<double2>*>(nullptr);
+    const auto status = clblast::GemmPlanCreate<double2>(static_cast<clblast::Layout>(layout),
+                                                         static_cast<clblast::Transpose>(a_transpose),
+                                                         static_cast<clblast::Transpose>(b_transpose),
+                                                         m, n, k, a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
+                                                         queue, &plan_cpp);
+    *plan = reinterpret_cast<CLBlastGemmPlan>(plan_cpp);
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZGemmPlanExecute(CLBlastGemmPlan plan, const cl_double2 alpha,
+                                          const cl_mem a_buffer, const cl_mem b_buffer,
+                                          const cl_double2 beta, cl_mem c_buffer,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPlanExecute<double2>(reinterpret_cast<clblast::GemmPlan<double2>*>(plan),
+                                        double2{alpha.s[0], alpha.s[1]}, a_buffer, b_buffer,
+                                        double2{beta.s[0], beta.s[1]}, c_buffer, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZGemmPlanDestroy(CLBlastGemmPlan plan) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPlanDestroy<double2>(reinterpret_cast<clblast::GemmPlan<double2>*>(plan))
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHGemmPlanCreate(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                         const size_t m, const size_t n, const size_t k,
+                                         const size_t a_offset, const size_t a_ld,
+                                         const size_t b_offset, const size_t b_ld,
+                                         const size_t c_offset, const size_t c_ld,
+                                         cl_command_queue* queue, CLBlastGemmPlan* plan) {
+  try {
+    if (plan == nullptr) { return CLBlastInvalidValue; }
+    auto plan_cpp = static_cast<clblast::GemmPlan<half>*>(nullptr);
+    const auto status = clblast::GemmPlanCreate<half>(static_cast<clblast::Layout>(layout),
+                                                      static_cast<clblast::Transpose>(a_transpose),
+                                                      static_cast<clblast::Transpose>(b_transpose),
+                                                      m, n, k, a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
+                                                      queue, &plan_cpp);
+    *plan = reinterpret_cast<CLBlastGemmPlan>(plan_cpp);
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHGemmPlanExecute(CLBlastGemmPlan plan, const cl_half alpha,
+                                          const cl_mem a_buffer, const cl_mem b_buffer,
+                                          const cl_half beta, cl_mem c_buffer,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPlanExecute<half>(reinterpret_cast<clblast::GemmPlan<half>*>(plan),
+                                     alpha, a_buffer, b_buffer,
+                                     beta, c_buffer, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHGemmPlanDestroy(CLBlastGemmPlan plan) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPlanDestroy<half>(reinterpret_cast<clblast::GemmPlan<half>*>(plan))
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// TRSM factors: the C handle is the C++ factor of the precision of the functions
+CLBlastStatusCode CLBlastSTrsmFactorCreate(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                           const size_t k,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_command_queue* queue, CLBlastTrsmFactor* factor) {
+  try {
+    if (factor == nullptr) { return CLBlastInvalidValue; }
+    auto factor_cpp = static_cast<clblast::TrsmFactor<float>*>(nullptr);
+    const auto status = clblast::TrsmFactorCreate<float>(static_cast<clblast::Layout>(layout),
+                                                         static_cast<clblast::Side>(side),
+                                                         static_cast<clblast::Triangle>(triangle),
+                                                         static_cast<clblast::Transpose>(a_transpose),
+                                                         static_cast<clblast::Diagonal>(diagonal),
+                                                         k, a_buffer, a_offset, a_ld, queue, &factor_cpp);
+    *factor = reinterpret_cast<CLBlastTrsmFactor>(factor_cpp);
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastSTrsmFactorSolve(CLBlastTrsmFactor factor, const size_t m, const size_t n, const float alpha,
+                                          cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmFactorSolve<float>(reinterpret_cast<clblast::TrsmFactor<float>*>(factor),
+                                      m, n, alpha,
+                                      b_buffer, b_offset, b_ld, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastSTrsmFactorDestroy(CLBlastTrsmFactor factor) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmFactorDestroy<float>(reinterpret_cast<clblast::TrsmFactor<float>*>(factor))
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDTrsmFactorCreate(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                           const size_t k,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_command_queue* queue, CLBlastTrsmFactor* factor) {
+  try {
+    if (factor == nullptr) { return CLBlastInvalidValue; }
+    auto factor_cpp = static_cast<clblast::TrsmFactor<double>*>(nullptr);
+    const auto status = clblast::TrsmFactorCreate<double>(static_cast<clblast::Layout>(layout),
+                                                          static_cast<clblast::Side>(side),
+                                                          static_cast<clblast::Triangle>(triangle),
+                                                          static_cast<clblast::Transpose>(a_transpose),
+                                                          static_cast<clblast::Diagonal>(diagonal),
+                                                          k, a_buffer, a_offset, a_ld, queue, &factor_cpp);
+    *factor = reinterpret_cast<CLBlastTrsmFactor>(factor_cpp);
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDTrsmFactorSolve(CLBlastTrsmFactor factor, const size_t m, const size_t n, const double alpha,
+                                          cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmFactorSolve<double>(reinterpret_cast<clblast::TrsmFactor<double>*>(factor),
+                                       m, n, alpha,
+                                       b_buffer, b_offset, b_ld, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDTrsmFactorDestroy(CLBlastTrsmFactor factor) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmFactorDestroy<double>(reinterpret_cast<clblast::TrsmFactor<double>*>(factor))
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCTrsmFactorCreate(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                           const size_t k,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_command_queue* queue, CLBlastTrsmFactor* factor) {
+  try {
+    if (factor == nullptr) { return CLBlastInvalidValue; }
+    auto factor_cpp = static_cast<clblast::TrsmFactor<float2>*>(nullptr);
+    const auto status = clblast::TrsmFactorCreate<float2>(static_cast<clblast::Layout>(layout),
+                                                          static_cast<clblast::Side>(side),
+                                                          static_cast<clblast::Triangle>(triangle),
+                                                          static_cast<clblast::Transpose>(a_transpose),
+                                                          static_cast<clblast::Diagonal>(diagonal),
+                                                          k, a_buffer, a_offset, a_ld, queue, &factor_cpp);
+    *factor = reinterpret_cast<CLBlastTrsmFactor>(factor_cpp);
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCTrsmFactorSolve(CLBlastTrsmFactor factor, const size_t m, const size_t n, const cl_float2 alpha,
+                                          cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmFactorSolve<float2>(reinterpret_cast<clblast::TrsmFactor<float2>*>(factor),
+                                       m, n, float2{alpha.s[0], alpha.s[1]},
+                                       b_buffer, b_offset, b_ld, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCTrsmFactorDestroy(CLBlastTrsmFactor factor) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmFactorDestroy<float2>(reinterpret_cast<clblast::TrsmFactor<float2>*>(factor))
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZTrsmFactorCreate(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                           const size_t k,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_command_queue* queue, CLBlastTrsmFactor* factor) {
+  try {
+    if (factor == nullptr) { return CLBlastInvalidValue; }
+    auto factor_cpp = static_cast<clblast::TrsmFactor<double2>*>(nullptr);
+    const auto status = clblast::TrsmFactorCreate<double2>(static_cast<clblast::Layout>(layout),
+                                                           static_cast<clblast::Side>(side),
+                                                           static_cast<clblast::Triangle>(triangle),
+                                                           static_cast<clblast::Transpose>(a_transpose),
+                                                           static_cast<clblast::Diagonal>(diagonal),
+                                                           k, a_buffer, a_offset, a_ld, queue, &factor_cpp);
+    *factor = reinterpret_cast<CLBlastTrsmFactor>(factor_cpp);
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZTrsmFactorSolve(CLBlastTrsmFactor factor, const size_t m, const size_t n, const cl_double2 alpha,
+                                          cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmFactorSolve<double2>(reinterpret_cast<clblast::TrsmFactor<double2>*>(factor),
+                                        m, n, double2{alpha.s[0], alpha.s[1]},
+                                        b_buffer, b_offset, b_ld, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZTrsmFactorDestroy(CLBlastTrsmFactor factor) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmFactorDestroy<double2>(reinterpret_cast<clblast::TrsmFactor<double2>*>(factor))
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHTrsmFactorCreate(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                           const size_t k,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_command_queue* queue, CLBlastTrsmFactor* factor) {
+  try {
+    if (factor == nullptr) { return CLBlastInvalidValue; }
+    auto factor_cpp = static_cast<clblast::TrsmFactor<half>*>(nullptr);
+    const auto status = clblast::TrsmFactorCreate<half>(static_cast<clblast::Layout>(layout),
+                                                        static_cast<clblast::Side>(side),
+                                                        static_cast<clblast::Triangle>(triangle),
+                                                        static_cast<clblast::Transpose>(a_transpose),
+                                                        static_cast<clblast::Diagonal>(diagonal),
+                                                        k, a_buffer, a_offset, a_ld, queue, &factor_cpp);
+    *factor = reinterpret_cast<CLBlastTrsmFactor>(factor_cpp);
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHTrsmFactorSolve(CLBlastTrsmFactor factor, const size_t m, const size_t n, const cl_half alpha,
+                                          cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmFactorSolve<half>(reinterpret_cast<clblast::TrsmFactor<half>*>(factor),
+                                     m, n, alpha,
+                                     b_buffer, b_offset, b_ld, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHTrsmFactorDestroy(CLBlastTrsmFactor factor) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmFactorDestroy<half>(reinterpret_cast<clblast::TrsmFactor<half>*>(factor))
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Conversions between single-precision and bfloat16 data
+CLBlastStatusCode CLBlastConvertToBFloat16(const size_t n,
+                                           const cl_mem src_buffer, const size_t src_offset,
+                                           cl_mem dest_buffer, const size_t dest_offset,
+                                           cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ConvertToBFloat16(n, src_buffer, src_offset, dest_buffer, dest_offset, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastConvertFromBFloat16(const size_t n,
+                                             const cl_mem src_buffer, const size_t src_offset,
+                                             cl_mem dest_buffer, const size_t dest_offset,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ConvertFromBFloat16(n, src_buffer, src_offset, dest_buffer, dest_offset, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Conversions between single-precision and half-precision data
+CLBlastStatusCode CLBlastConvertToHalf(const size_t n,
+                                       const cl_mem src_buffer, const size_t src_offset,
+                                       cl_mem dest_buffer, const size_t dest_offset,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ConvertToHalf(n, src_buffer, src_offset, dest_buffer, dest_offset, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastConvertFromHalf(const size_t n,
+                                         const cl_mem src_buffer, const size_t src_offset,
+                                         cl_mem dest_buffer, const size_t dest_offset,
+                                         cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ConvertFromHalf(n, src_buffer, src_offset, dest_buffer, dest_offset, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+void CLBlastFloatToHalfArray(const float* src, cl_half* dest, const size_t n) {
+  clblast::FloatToHalfArray(src, dest, n);
+}
+void CLBlastHalfToFloatArray(const cl_half* src, float* dest, const size_t n) {
+  clblast::HalfToFloatArray(src, dest, n);
+}
+
+// =================================================================================================
+
+// Integer matrix-multiplication for quantised data
+CLBlastStatusCode CLBlastGemmInt8(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const int alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  const int beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmInt8(static_cast<clblast::Layout>(layout),
+                        static_cast<clblast::Transpose>(a_transpose),
+                        static_cast<clblast::Transpose>(b_transpose),
+                        m, n, k,
+                        alpha,
+                        a_buffer, a_offset, a_ld,
+                        b_buffer, b_offset, b_ld,
+                        beta,
+                        c_buffer, c_offset, c_ld,
+                        queue, event)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
-CLBlastStatusCode CLBlastHgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+CLBlastStatusCode CLBlastGemmInt8Requantized(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
                                              const size_t m, const size_t n, const size_t k,
-                                             const cl_half alpha,
                                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                                              const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
-                                             const cl_half beta,
+                                             const cl_mem scales_buffer, const size_t scales_offset,
                                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
-                                             cl_command_queue* queue, cl_event* event,
-                                             cl_mem temp_buffer) {
+                                             cl_command_queue* queue, cl_event* event) {
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::Gemm(static_cast<clblast::Layout>(layout),
-                    static_cast<clblast::Transpose>(a_transpose),
-                    static_cast<clblast::Transpose>(b_transpose),
-                    m, n, k,
-                    alpha,
-                    a_buffer, a_offset, a_ld,
-                    b_buffer, b_offset, b_ld,
-                    beta,
-                    c_buffer, c_offset, c_ld,
-                    queue, event, temp_buffer)
+      clblast::GemmInt8Requantized(static_cast<clblast::Layout>(layout),
+                                   static_cast<clblast::Transpose>(a_transpose),
+                                   static_cast<clblast::Transpose>(b_transpose),
+                                   m, n, k,
+                                   a_buffer, a_offset, a_ld,
+                                   b_buffer, b_offset, b_ld,
+                                   scales_buffer, scales_offset,
+                                   c_buffer, c_offset, c_ld,
+                                   queue, event)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
-// =================================================================================================
-
-// GEMM get temporary buffer size
-CLBlastStatusCode CLBlastSGemmTempBufferSize(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                               const size_t m, const size_t n, const size_t k,
-                               const size_t a_offset, const size_t a_ld,
-                               const size_t b_offset, const size_t b_ld,
-                               const size_t c_offset, const size_t c_ld,
-                               cl_command_queue* queue,
-							   size_t* temp_buffer_size){
+// Multi-device GEMM on matrices in host memory
+CLBlastStatusCode CLBlastSgemmMultiDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const float alpha,
+                                          const float* a, const size_t a_ld,
+                                          const float* b, const size_t b_ld,
+                                          const float beta,
+                                          float* c, const size_t c_ld,
+                                          cl_command_queue* queues, const size_t num_queues, const double* weights) {
+  try {
+    const auto queues_cpp = std::vector<cl_command_queue>(queues, queues + num_queues);
+    const auto weights_cpp = (weights == nullptr) ? std::vector<double>() :
+                             std::vector<double>(weights, weights + num_queues);
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmMultiDevice(static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Transpose>(a_transpose),
+                               static_cast<clblast::Transpose>(b_transpose),
+                               m, n, k,
+                               alpha,
+                               a, a_ld,
+                               b, b_ld,
+                               beta,
+                               c, c_ld,
+                               queues_cpp, weights_cpp)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmMultiDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const double alpha,
+                                          const double* a, const size_t a_ld,
+                                          const double* b, const size_t b_ld,
+                                          const double beta,
+                                          double* c, const size_t c_ld,
+                                          cl_command_queue* queues, const size_t num_queues, const double* weights) {
+  try {
+    const auto queues_cpp = std::vector<cl_command_queue>(queues, queues + num_queues);
+    const auto weights_cpp = (weights == nullptr) ? std::vector<double>() :
+                             std::vector<double>(weights, weights + num_queues);
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmMultiDevice(static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Transpose>(a_transpose),
+                               static_cast<clblast::Transpose>(b_transpose),
+                               m, n, k,
+                               alpha,
+                               a, a_ld,
+                               b, b_ld,
+                               beta,
+                               c, c_ld,
+                               queues_cpp, weights_cpp)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemmMultiDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const cl_float2 alpha,
+                                          const cl_float2* a, const size_t a_ld,
+                                          const cl_float2* b, const size_t b_ld,
+                                          const cl_float2 beta,
+                                          cl_float2* c, const size_t c_ld,
+                                          cl_command_queue* queues, const size_t num_queues, const double* weights) {
+  try {
+    const auto queues_cpp = std::vector<cl_command_queue>(queues, queues + num_queues);
+    const auto weights_cpp = (weights == nullptr) ? std::vector<double>() :
+                             std::vector<double>(weights, weights + num_queues);
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmMultiDevice(static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Transpose>(a_transpose),
+                               static_cast<clblast::Transpose>(b_transpose),
+                               m, n, k,
+                               float2{alpha.s[0], alpha.s[1]},
+                               reinterpret_cast<const float2*>(a), a_ld,
+                               reinterpret_cast<const float2*>(b), b_ld,
+                               float2{beta.s[0], beta.s[1]},
+                               reinterpret_cast<float2*>(c), c_ld,
+                               queues_cpp, weights_cpp)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemmMultiDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const cl_double2 alpha,
+                                          const cl_double2* a, const size_t a_ld,
+                                          const cl_double2* b, const size_t b_ld,
+                                          const cl_double2 beta,
+                                          cl_double2* c, const size_t c_ld,
+                                          cl_command_queue* queues, const size_t num_queues, const double* weights) {
+  try {
+    const auto queues_cpp = std::vector<cl_command_queue>(queues, queues + num_queues);
+    const auto weights_cpp = (weights == nullptr) ? std::vector<double>() :
+                             std::vector<double>(weights, weights + num_queues);
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmMultiDevice(static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Transpose>(a_transpose),
+                               static_cast<clblast::Transpose>(b_transpose),
+                               m, n, k,
+                               double2{alpha.s[0], alpha.s[1]},
+                               reinterpret_cast<const double2*>(a), a_ld,
+                               reinterpret_cast<const double2*>(b), b_ld,
+                               double2{beta.s[0], beta.s[1]},
+                               reinterpret_cast<double2*>(c), c_ld,
+                               queues_cpp, weights_cpp)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemmMultiDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const cl_half alpha,
+                                          const cl_half* a, const size_t a_ld,
+                                          const cl_half* b, const size_t b_ld,
+                                          const cl_half beta,
+                                          cl_half* c, const size_t c_ld,
+                                          cl_command_queue* queues, const size_t num_queues, const double* weights) {
+  try {
+    const auto queues_cpp = std::vector<cl_command_queue>(queues, queues + num_queues);
+    const auto weights_cpp = (weights == nullptr) ? std::vector<double>() :
+                             std::vector<double>(weights, weights + num_queues);
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmMultiDevice(static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Transpose>(a_transpose),
+                               static_cast<clblast::Transpose>(b_transpose),
+                               m, n, k,
+                               alpha,
+                               a, a_ld,
+                               b, b_ld,
+                               beta,
+                               c, c_ld,
+                               queues_cpp, weights_cpp)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
 
+// Streaming GEMM on matrices in host memory
+CLBlastStatusCode CLBlastSgemmStreaming(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                        const size_t m, const size_t n, const size_t k,
+                                        const float alpha,
+                                        const float* a, const size_t a_ld,
+                                        const float* b, const size_t b_ld,
+                                        const float beta,
+                                        float* c, const size_t c_ld,
+                                        cl_command_queue* queue, const size_t tile_size) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStreaming(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Transpose>(a_transpose),
+                             static_cast<clblast::Transpose>(b_transpose),
+                             m, n, k,
+                             alpha,
+                             a, a_ld,
+                             b, b_ld,
+                             beta,
+                             c, c_ld,
+                             queue, tile_size)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmStreaming(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                        const size_t m, const size_t n, const size_t k,
+                                        const double alpha,
+                                        const double* a, const size_t a_ld,
+                                        const double* b, const size_t b_ld,
+                                        const double beta,
+                                        double* c, const size_t c_ld,
+                                        cl_command_queue* queue, const size_t tile_size) {
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::GemmTempBufferSize<float>(static_cast<clblast::Layout>(layout),
-                           static_cast<clblast::Transpose>(a_transpose),
-                           static_cast<clblast::Transpose>(b_transpose),
-                           m, n, k,
-                           a_offset, a_ld,
-                           b_offset, b_ld,
-                           c_offset, c_ld,
-                           queue, *temp_buffer_size)
+      clblast::GemmStreaming(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Transpose>(a_transpose),
+                             static_cast<clblast::Transpose>(b_transpose),
+                             m, n, k,
+                             alpha,
+                             a, a_ld,
+                             b, b_ld,
+                             beta,
+                             c, c_ld,
+                             queue, tile_size)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
-
-CLBlastStatusCode CLBlastDGemmTempBufferSize(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                               const size_t m, const size_t n, const size_t k,
-                               const size_t a_offset, const size_t a_ld,
-                               const size_t b_offset, const size_t b_ld,
-                               const size_t c_offset, const size_t c_ld,
-                               cl_command_queue* queue,
-							   size_t* temp_buffer_size){
-
+CLBlastStatusCode CLBlastCgemmStreaming(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                        const size_t m, const size_t n, const size_t k,
+                                        const cl_float2 alpha,
+                                        const cl_float2* a, const size_t a_ld,
+                                        const cl_float2* b, const size_t b_ld,
+                                        const cl_float2 beta,
+                                        cl_float2* c, const size_t c_ld,
+                                        cl_command_queue* queue, const size_t tile_size) {
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::GemmTempBufferSize<double>(static_cast<clblast::Layout>(layout),
-                           static_cast<clblast::Transpose>(a_transpose),
-                           static_cast<clblast::Transpose>(b_transpose),
-                           m, n, k,
-                           a_offset, a_ld,
-                           b_offset, b_ld,
-                           c_offset, c_ld,
-                           queue, *temp_buffer_size)
+      clblast::GemmStreaming(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Transpose>(a_transpose),
+                             static_cast<clblast::Transpose>(b_transpose),
+                             m, n, k,
+                             float2{alpha.s[0], alpha.s[1]},
+                             reinterpret_cast<const float2*>(a), a_ld,
+                             reinterpret_cast<const float2*>(b), b_ld,
+                             float2{beta.s[0], beta.s[1]},
+                             reinterpret_cast<float2*>(c), c_ld,
+                             queue, tile_size)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
-
-CLBlastStatusCode CLBlastCGemmTempBufferSize(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                               const size_t m, const size_t n, const size_t k,
-                               const size_t a_offset, const size_t a_ld,
-                               const size_t b_offset, const size_t b_ld,
-                               const size_t c_offset, const size_t c_ld,
-                               cl_command_queue* queue,
-							   size_t* temp_buffer_size){
-
+CLBlastStatusCode CLBlastZgemmStreaming(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                        const size_t m, const size_t n, const size_t k,
+                                        const cl_double2 alpha,
+                                        const cl_double2* a, const size_t a_ld,
+                                        const cl_double2* b, const size_t b_ld,
+                                        const cl_double2 beta,
+                                        cl_double2* c, const size_t c_ld,
+                                        cl_command_queue* queue, const size_t tile_size) {
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::GemmTempBufferSize<float2>(static_cast<clblast::Layout>(layout),
-                           static_cast<clblast::Transpose>(a_transpose),
-                           static_cast<clblast::Transpose>(b_transpose),
-                           m, n, k,
-                           a_offset, a_ld,
-                           b_offset, b_ld,
-                           c_offset, c_ld,
-                           queue, *temp_buffer_size)
+      clblast::GemmStreaming(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Transpose>(a_transpose),
+                             static_cast<clblast::Transpose>(b_transpose),
+                             m, n, k,
+                             double2{alpha.s[0], alpha.s[1]},
+                             reinterpret_cast<const double2*>(a), a_ld,
+                             reinterpret_cast<const double2*>(b), b_ld,
+                             double2{beta.s[0], beta.s[1]},
+                             reinterpret_cast<double2*>(c), c_ld,
+                             queue, tile_size)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
-
-CLBlastStatusCode CLBlastZGemmTempBufferSize(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                               const size_t m, const size_t n, const size_t k,
-                               const size_t a_offset, const size_t a_ld,
-                               const size_t b_offset, const size_t b_ld,
-                               const size_t c_offset, const size_t c_ld,
-                               cl_command_queue* queue,
-							   size_t* temp_buffer_size){
-
+CLBlastStatusCode CLBlastHgemmStreaming(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                        const size_t m, const size_t n, const size_t k,
+                                        const cl_half alpha,
+                                        const cl_half* a, const size_t a_ld,
+                                        const cl_half* b, const size_t b_ld,
+                                        const cl_half beta,
+                                        cl_half* c, const size_t c_ld,
+                                        cl_command_queue* queue, const size_t tile_size) {
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::GemmTempBufferSize<double2>(static_cast<clblast::Layout>(layout),
-                           static_cast<clblast::Transpose>(a_transpose),
-                           static_cast<clblast::Transpose>(b_transpose),
-                           m, n, k,
-                           a_offset, a_ld,
-                           b_offset, b_ld,
-                           c_offset, c_ld,
-                           queue, *temp_buffer_size)
+      clblast::GemmStreaming(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Transpose>(a_transpose),
+                             static_cast<clblast::Transpose>(b_transpose),
+                             m, n, k,
+                             alpha,
+                             a, a_ld,
+                             b, b_ld,
+                             beta,
+                             c, c_ld,
+                             queue, tile_size)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
-CLBlastStatusCode CLBlastHGemmTempBufferSize(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                               const size_t m, const size_t n, const size_t k,
-                               const size_t a_offset, const size_t a_ld,
-                               const size_t b_offset, const size_t b_ld,
-                               const size_t c_offset, const size_t c_ld,
-                               cl_command_queue* queue,
-							   size_t* temp_buffer_size){
-
+// Variants of the main routines on SVM pointers
+CLBlastStatusCode CLBlastSgemmSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const float alpha,
+                                  const float* a, const size_t a_ld,
+                                  const float* b, const size_t b_ld,
+                                  const float beta,
+                                  float* c, const size_t c_ld,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmSVM(static_cast<clblast::Layout>(layout),
+                       static_cast<clblast::Transpose>(a_transpose),
+                       static_cast<clblast::Transpose>(b_transpose),
+                       m, n, k,
+                       alpha,
+                       a, a_ld,
+                       b, b_ld,
+                       beta,
+                       c, c_ld,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const double alpha,
+                                  const double* a, const size_t a_ld,
+                                  const double* b, const size_t b_ld,
+                                  const double beta,
+                                  double* c, const size_t c_ld,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmSVM(static_cast<clblast::Layout>(layout),
+                       static_cast<clblast::Transpose>(a_transpose),
+                       static_cast<clblast::Transpose>(b_transpose),
+                       m, n, k,
+                       alpha,
+                       a, a_ld,
+                       b, b_ld,
+                       beta,
+                       c, c_ld,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemmSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const cl_float2 alpha,
+                                  const cl_float2* a, const size_t a_ld,
+                                  const cl_float2* b, const size_t b_ld,
+                                  const cl_float2 beta,
+                                  cl_float2* c, const size_t c_ld,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmSVM(static_cast<clblast::Layout>(layout),
+                       static_cast<clblast::Transpose>(a_transpose),
+                       static_cast<clblast::Transpose>(b_transpose),
+                       m, n, k,
+                       float2{alpha.s[0], alpha.s[1]},
+                       reinterpret_cast<const float2*>(a), a_ld,
+                       reinterpret_cast<const float2*>(b), b_ld,
+                       float2{beta.s[0], beta.s[1]},
+                       reinterpret_cast<float2*>(c), c_ld,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemmSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const cl_double2 alpha,
+                                  const cl_double2* a, const size_t a_ld,
+                                  const cl_double2* b, const size_t b_ld,
+                                  const cl_double2 beta,
+                                  cl_double2* c, const size_t c_ld,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmSVM(static_cast<clblast::Layout>(layout),
+                       static_cast<clblast::Transpose>(a_transpose),
+                       static_cast<clblast::Transpose>(b_transpose),
+                       m, n, k,
+                       double2{alpha.s[0], alpha.s[1]},
+                       reinterpret_cast<const double2*>(a), a_ld,
+                       reinterpret_cast<const double2*>(b), b_ld,
+                       double2{beta.s[0], beta.s[1]},
+                       reinterpret_cast<double2*>(c), c_ld,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemmSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const cl_half alpha,
+                                  const cl_half* a, const size_t a_ld,
+                                  const cl_half* b, const size_t b_ld,
+                                  const cl_half beta,
+                                  cl_half* c, const size_t c_ld,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmSVM(static_cast<clblast::Layout>(layout),
+                       static_cast<clblast::Transpose>(a_transpose),
+                       static_cast<clblast::Transpose>(b_transpose),
+                       m, n, k,
+                       alpha,
+                       a, a_ld,
+                       b, b_ld,
+                       beta,
+                       c, c_ld,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastSgemmStridedBatchedSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const float alpha,
+                                                const float* a, const size_t a_ld, const size_t a_stride,
+                                                const float* b, const size_t b_ld, const size_t b_stride,
+                                                const float beta,
+                                                float* c, const size_t c_ld, const size_t c_stride,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStridedBatchedSVM(static_cast<clblast::Layout>(layout),
+                                     static_cast<clblast::Transpose>(a_transpose),
+                                     static_cast<clblast::Transpose>(b_transpose),
+                                     m, n, k,
+                                     alpha,
+                                     a, a_ld, a_stride,
+                                     b, b_ld, b_stride,
+                                     beta,
+                                     c, c_ld, c_stride,
+                                     batch_count,
+                                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmStridedBatchedSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const double alpha,
+                                                const double* a, const size_t a_ld, const size_t a_stride,
+                                                const double* b, const size_t b_ld, const size_t b_stride,
+                                                const double beta,
+                                                double* c, const size_t c_ld, const size_t c_stride,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStridedBatchedSVM(static_cast<clblast::Layout>(layout),
+                                     static_cast<clblast::Transpose>(a_transpose),
+                                     static_cast<clblast::Transpose>(b_transpose),
+                                     m, n, k,
+                                     alpha,
+                                     a, a_ld, a_stride,
+                                     b, b_ld, b_stride,
+                                     beta,
+                                     c, c_ld, c_stride,
+                                     batch_count,
+                                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemmStridedBatchedSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_float2 alpha,
+                                                const cl_float2* a, const size_t a_ld, const size_t a_stride,
+                                                const cl_float2* b, const size_t b_ld, const size_t b_stride,
+                                                const cl_float2 beta,
+                                                cl_float2* c, const size_t c_ld, const size_t c_stride,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStridedBatchedSVM(static_cast<clblast::Layout>(layout),
+                                     static_cast<clblast::Transpose>(a_transpose),
+                                     static_cast<clblast::Transpose>(b_transpose),
+                                     m, n, k,
+                                     float2{alpha.s[0], alpha.s[1]},
+                                     reinterpret_cast<const float2*>(a), a_ld, a_stride,
+                                     reinterpret_cast<const float2*>(b), b_ld, b_stride,
+                                     float2{beta.s[0], beta.s[1]},
+                                     reinterpret_cast<float2*>(c), c_ld, c_stride,
+                                     batch_count,
+                                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemmStridedBatchedSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_double2 alpha,
+                                                const cl_double2* a, const size_t a_ld, const size_t a_stride,
+                                                const cl_double2* b, const size_t b_ld, const size_t b_stride,
+                                                const cl_double2 beta,
+                                                cl_double2* c, const size_t c_ld, const size_t c_stride,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event) {
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::GemmTempBufferSize<half>(static_cast<clblast::Layout>(layout),
-                           static_cast<clblast::Transpose>(a_transpose),
-                           static_cast<clblast::Transpose>(b_transpose),
-                           m, n, k,
-                           a_offset, a_ld,
-                           b_offset, b_ld,
-                           c_offset, c_ld,
-                           queue, *temp_buffer_size)
+      clblast::GemmStridedBatchedSVM(static_cast<clblast::Layout>(layout),
+                                     static_cast<clblast::Transpose>(a_transpose),
+                                     static_cast<clblast::Transpose>(b_transpose),
+                                     m, n, k,
+                                     double2{alpha.s[0], alpha.s[1]},
+                                     reinterpret_cast<const double2*>(a), a_ld, a_stride,
+                                     reinterpret_cast<const double2*>(b), b_ld, b_stride,
+                                     double2{beta.s[0], beta.s[1]},
+                                     reinterpret_cast<double2*>(c), c_ld, c_stride,
+                                     batch_count,
+                                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemmStridedBatchedSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_half alpha,
+                                                const cl_half* a, const size_t a_ld, const size_t a_stride,
+                                                const cl_half* b, const size_t b_ld, const size_t b_stride,
+                                                const cl_half beta,
+                                                cl_half* c, const size_t c_ld, const size_t c_stride,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStridedBatchedSVM(static_cast<clblast::Layout>(layout),
+                                     static_cast<clblast::Transpose>(a_transpose),
+                                     static_cast<clblast::Transpose>(b_transpose),
+                                     m, n, k,
+                                     alpha,
+                                     a, a_ld, a_stride,
+                                     b, b_ld, b_stride,
+                                     beta,
+                                     c, c_ld, c_stride,
+                                     batch_count,
+                                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastSaxpySVM(const size_t n,
+                                  const float alpha,
+                                  const float* x, const size_t x_inc,
+                                  float* y, const size_t y_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpySVM(n,
+                       alpha,
+                       x, x_inc,
+                       y, y_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDaxpySVM(const size_t n,
+                                  const double alpha,
+                                  const double* x, const size_t x_inc,
+                                  double* y, const size_t y_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpySVM(n,
+                       alpha,
+                       x, x_inc,
+                       y, y_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCaxpySVM(const size_t n,
+                                  const cl_float2 alpha,
+                                  const cl_float2* x, const size_t x_inc,
+                                  cl_float2* y, const size_t y_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpySVM(n,
+                       float2{alpha.s[0], alpha.s[1]},
+                       reinterpret_cast<const float2*>(x), x_inc,
+                       reinterpret_cast<float2*>(y), y_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZaxpySVM(const size_t n,
+                                  const cl_double2 alpha,
+                                  const cl_double2* x, const size_t x_inc,
+                                  cl_double2* y, const size_t y_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpySVM(n,
+                       double2{alpha.s[0], alpha.s[1]},
+                       reinterpret_cast<const double2*>(x), x_inc,
+                       reinterpret_cast<double2*>(y), y_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpySVM(const size_t n,
+                                  const cl_half alpha,
+                                  const cl_half* x, const size_t x_inc,
+                                  cl_half* y, const size_t y_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpySVM(n,
+                       alpha,
+                       x, x_inc,
+                       y, y_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastSdotSVM(const size_t n,
+                                 float* dot,
+                                 const float* x, const size_t x_inc,
+                                 const float* y, const size_t y_inc,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotSVM(n,
+                      dot,
+                      x, x_inc,
+                      y, y_inc,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDdotSVM(const size_t n,
+                                 double* dot,
+                                 const double* x, const size_t x_inc,
+                                 const double* y, const size_t y_inc,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotSVM(n,
+                      dot,
+                      x, x_inc,
+                      y, y_inc,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHdotSVM(const size_t n,
+                                 cl_half* dot,
+                                 const cl_half* x, const size_t x_inc,
+                                 const cl_half* y, const size_t y_inc,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotSVM(n,
+                      dot,
+                      x, x_inc,
+                      y, y_inc,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastSgemvSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                  const size_t m, const size_t n,
+                                  const float alpha,
+                                  const float* a, const size_t a_ld,
+                                  const float* x, const size_t x_inc,
+                                  const float beta,
+                                  float* y, const size_t y_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvSVM(static_cast<clblast::Layout>(layout),
+                       static_cast<clblast::Transpose>(a_transpose),
+                       m, n,
+                       alpha,
+                       a, a_ld,
+                       x, x_inc,
+                       beta,
+                       y, y_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemvSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                  const size_t m, const size_t n,
+                                  const double alpha,
+                                  const double* a, const size_t a_ld,
+                                  const double* x, const size_t x_inc,
+                                  const double beta,
+                                  double* y, const size_t y_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvSVM(static_cast<clblast::Layout>(layout),
+                       static_cast<clblast::Transpose>(a_transpose),
+                       m, n,
+                       alpha,
+                       a, a_ld,
+                       x, x_inc,
+                       beta,
+                       y, y_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemvSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                  const size_t m, const size_t n,
+                                  const cl_float2 alpha,
+                                  const cl_float2* a, const size_t a_ld,
+                                  const cl_float2* x, const size_t x_inc,
+                                  const cl_float2 beta,
+                                  cl_float2* y, const size_t y_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvSVM(static_cast<clblast::Layout>(layout),
+                       static_cast<clblast::Transpose>(a_transpose),
+                       m, n,
+                       float2{alpha.s[0], alpha.s[1]},
+                       reinterpret_cast<const float2*>(a), a_ld,
+                       reinterpret_cast<const float2*>(x), x_inc,
+                       float2{beta.s[0], beta.s[1]},
+                       reinterpret_cast<float2*>(y), y_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemvSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                  const size_t m, const size_t n,
+                                  const cl_double2 alpha,
+                                  const cl_double2* a, const size_t a_ld,
+                                  const cl_double2* x, const size_t x_inc,
+                                  const cl_double2 beta,
+                                  cl_double2* y, const size_t y_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvSVM(static_cast<clblast::Layout>(layout),
+                       static_cast<clblast::Transpose>(a_transpose),
+                       m, n,
+                       double2{alpha.s[0], alpha.s[1]},
+                       reinterpret_cast<const double2*>(a), a_ld,
+                       reinterpret_cast<const double2*>(x), x_inc,
+                       double2{beta.s[0], beta.s[1]},
+                       reinterpret_cast<double2*>(y), y_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemvSVM(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                  const size_t m, const size_t n,
+                                  const cl_half alpha,
+                                  const cl_half* a, const size_t a_ld,
+                                  const cl_half* x, const size_t x_inc,
+                                  const cl_half beta,
+                                  cl_half* y, const size_t y_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvSVM(static_cast<clblast::Layout>(layout),
+                       static_cast<clblast::Transpose>(a_transpose),
+                       m, n,
+                       alpha,
+                       a, a_ld,
+                       x, x_inc,
+                       beta,
+                       y, y_inc,
+                       queue, event)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
@@ -4316,12 +7744,95 @@ CLBlastStatusCode CLBlastClearCache() {
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
+// Removes everything cached for a single context
+CLBlastStatusCode CLBlastClearContextCache(const cl_context context) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::ClearContextCache(context));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Limits the number of programs in the cache
+CLBlastStatusCode CLBlastSetProgramCacheLimit(const size_t num_programs) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::SetProgramCacheLimit(num_programs));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
 // Fills the cache with binaries for a specific device
 CLBlastStatusCode CLBlastFillCache(const cl_device_id device) {
   try {
     return static_cast<CLBlastStatusCode>(clblast::FillCache(device));
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
+CLBlastStatusCode CLBlastFillCacheForRoutines(const cl_device_id device,
+                                              const char** routines, const size_t num_routines,
+                                              const CLBlastPrecision* precisions,
+                                              const size_t num_precisions) {
+  try {
+    auto routines_cpp = std::vector<std::string>();
+    for (auto i = size_t{0}; i < num_routines; ++i) { routines_cpp.push_back(routines[i]); }
+    auto precisions_cpp = std::vector<clblast::Precision>();
+    for (auto i = size_t{0}; i < num_precisions; ++i) {
+      precisions_cpp.push_back(static_cast<clblast::Precision>(precisions[i]));
+    }
+    return static_cast<CLBlastStatusCode>(clblast::FillCache(device, routines_cpp, precisions_cpp));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastFillCacheAsync(const cl_device_id device) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::FillCacheAsync(device));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Sets the directory of the on-disk cache of binaries
+CLBlastStatusCode CLBlastSetCacheDirectory(const char* directory) {
+  try {
+    const auto directory_cpp = (directory != nullptr) ? std::string(directory) : std::string{};
+    return static_cast<CLBlastStatusCode>(clblast::SetCacheDirectory(directory_cpp));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Saves the compiled binaries of the given devices into a single file, or loads such a file
+CLBlastStatusCode CLBlastSaveCacheFile(const cl_device_id* devices, const size_t num_devices,
+                                       const char* file_name) {
+  try {
+    const auto devices_cpp = std::vector<cl_device_id>(devices, devices + num_devices);
+    const auto file_name_cpp = (file_name != nullptr) ? std::string(file_name) : std::string{};
+    return static_cast<CLBlastStatusCode>(clblast::SaveCacheFile(devices_cpp, file_name_cpp));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastLoadCacheFile(const char* file_name) {
+  try {
+    const auto file_name_cpp = (file_name != nullptr) ? std::string(file_name) : std::string{};
+    return static_cast<CLBlastStatusCode>(clblast::LoadCacheFile(file_name_cpp));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Configures and trims the pool of temporary buffers
+CLBlastStatusCode CLBlastSetMemoryPoolLimit(const size_t bytes) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::SetMemoryPoolLimit(bytes));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastTrimMemoryPool() {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::TrimMemoryPool());
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Sets the workspace limit of GEMM
+CLBlastStatusCode CLBlastSetGemmWorkspaceLimit(const size_t bytes) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::SetGemmWorkspaceLimit(bytes));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Sets the chunk limit of GEMM
+CLBlastStatusCode CLBlastSetGemmChunkLimit(const size_t multiply_adds) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::SetGemmChunkLimit(multiply_adds));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
 
 // =================================================================================================
 
@@ -4343,4 +7854,50 @@ CLBlastStatusCode PUBLIC_API CLBlastOverrideParameters(const cl_device_id device
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
+// As above, but only for problems of at most 'max_size'
+CLBlastStatusCode PUBLIC_API CLBlastOverrideParametersForSize(const cl_device_id device, const char* kernel_name,
+                                                              const CLBlastPrecision precision, const size_t max_size,
+                                                              const size_t num_parameters,
+                                                              const char** parameters_names, const size_t* parameters_values) {
+  try {
+    const auto kernel_name_cpp = std::string(kernel_name);
+    const auto precision_cpp = static_cast<clblast::Precision>(precision);
+    auto parameters = std::unordered_map<std::string, size_t>();
+    for (auto i = size_t{0}; i < num_parameters; ++i) {
+      parameters[std::string(parameters_names[i])] = parameters_values[i];
+    }
+    const auto status = clblast::OverrideParametersForSize(device, kernel_name_cpp, precision_cpp,
+                                                           max_size, parameters);
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Loads additional database entries from a file
+CLBlastStatusCode CLBlastLoadDatabaseFile(const char* file_name) {
+  try {
+    const auto file_name_cpp = (file_name != nullptr) ? std::string(file_name) : std::string{};
+    return static_cast<CLBlastStatusCode>(clblast::LoadDatabaseFile(file_name_cpp));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Registers a GEMM shape for a specialised program, or removes all shapes
+CLBlastStatusCode CLBlastRegisterGemmShape(const cl_device_id device, const CLBlastPrecision precision,
+                                           const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                           const CLBlastTranspose b_transpose,
+                                           const size_t m, const size_t n, const size_t k) {
+  try {
+    const auto status = clblast::RegisterGemmShape(device, static_cast<clblast::Precision>(precision),
+                                                   static_cast<clblast::Layout>(layout),
+                                                   static_cast<clblast::Transpose>(a_transpose),
+                                                   static_cast<clblast::Transpose>(b_transpose),
+                                                   m, n, k);
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastClearGemmShapes() {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::ClearGemmShapes());
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
 // =================================================================================================
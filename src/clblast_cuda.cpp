@@ -16,6 +16,7 @@
 #include <string>
 
 #include "routines/routines.hpp"
+#include "statistics.hpp"
 #include "clblast_cuda.h"
 
 namespace clblast {
@@ -26,12 +27,26 @@ namespace clblast {
 
 // Generate givens plane rotation: SROTG/DROTG
 template <typename T>
-StatusCode Rotg(CUdeviceptr, const size_t,
-                CUdeviceptr, const size_t,
-                CUdeviceptr, const size_t,
-                CUdeviceptr, const size_t,
-                const CUcontext, const CUdevice) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotg(CUdeviceptr sa_buffer, const size_t sa_offset,
+                CUdeviceptr sb_buffer, const size_t sb_offset,
+                CUdeviceptr sc_buffer, const size_t sc_offset,
+                CUdeviceptr ss_buffer, const size_t ss_offset,
+                const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("ROTG", static_cast<int>(PrecisionValue<T>()),
+                                      {{"sa_offset", sa_offset}, {"sb_offset", sb_offset}, {"sc_offset", sc_offset}, {"ss_offset", ss_offset}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xrotg<T>(queue_cpp, nullptr);
+    routine.DoRotg(Buffer<T>(sa_buffer), sa_offset,
+                   Buffer<T>(sb_buffer), sb_offset,
+                   Buffer<T>(sc_buffer), sc_offset,
+                   Buffer<T>(ss_buffer), ss_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotg<float>(CUdeviceptr, const size_t,
                                            CUdeviceptr, const size_t,
@@ -46,13 +61,28 @@ template StatusCode PUBLIC_API Rotg<double>(CUdeviceptr, const size_t,
 
 // Generate modified givens plane rotation: SROTMG/DROTMG
 template <typename T>
-StatusCode Rotmg(CUdeviceptr, const size_t,
-                 CUdeviceptr, const size_t,
-                 CUdeviceptr, const size_t,
-                 const CUdeviceptr, const size_t,
-                 CUdeviceptr, const size_t,
-                 const CUcontext, const CUdevice) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotmg(CUdeviceptr sd1_buffer, const size_t sd1_offset,
+                 CUdeviceptr sd2_buffer, const size_t sd2_offset,
+                 CUdeviceptr sx1_buffer, const size_t sx1_offset,
+                 const CUdeviceptr sy1_buffer, const size_t sy1_offset,
+                 CUdeviceptr sparam_buffer, const size_t sparam_offset,
+                 const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("ROTMG", static_cast<int>(PrecisionValue<T>()),
+                                      {{"sy1_offset", sy1_offset}, {"sd1_offset", sd1_offset}, {"sd2_offset", sd2_offset}, {"sx1_offset", sx1_offset}, {"sparam_offset", sparam_offset}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xrotmg<T>(queue_cpp, nullptr);
+    routine.DoRotmg(Buffer<T>(sd1_buffer), sd1_offset,
+                    Buffer<T>(sd2_buffer), sd2_offset,
+                    Buffer<T>(sx1_buffer), sx1_offset,
+                    Buffer<T>(sy1_buffer), sy1_offset,
+                    Buffer<T>(sparam_buffer), sparam_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotmg<float>(CUdeviceptr, const size_t,
                                             CUdeviceptr, const size_t,
@@ -69,13 +99,28 @@ template StatusCode PUBLIC_API Rotmg<double>(CUdeviceptr, const size_t,
 
 // Apply givens plane rotation: SROT/DROT
 template <typename T>
-StatusCode Rot(const size_t,
-               CUdeviceptr, const size_t, const size_t,
-               CUdeviceptr, const size_t, const size_t,
-               const T,
-               const T,
-               const CUcontext, const CUdevice) {
-  return StatusCode::kNotImplemented;
+StatusCode Rot(const size_t n,
+               CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+               CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+               const T cos,
+               const T sin,
+               const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("ROT", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xrot<T>(queue_cpp, nullptr);
+    routine.DoRot(n,
+                  Buffer<T>(x_buffer), x_offset, x_inc,
+                  Buffer<T>(y_buffer), y_offset, y_inc,
+                  cos,
+                  sin);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rot<float>(const size_t,
                                           CUdeviceptr, const size_t, const size_t,
@@ -92,12 +137,26 @@ template StatusCode PUBLIC_API Rot<double>(const size_t,
 
 // Apply modified givens plane rotation: SROTM/DROTM
 template <typename T>
-StatusCode Rotm(const size_t,
-                CUdeviceptr, const size_t, const size_t,
-                CUdeviceptr, const size_t, const size_t,
-                CUdeviceptr, const size_t,
-                const CUcontext, const CUdevice) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotm(const size_t n,
+                CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                CUdeviceptr sparam_buffer, const size_t sparam_offset,
+                const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("ROTM", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"sparam_offset", sparam_offset}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xrotm<T>(queue_cpp, nullptr);
+    routine.DoRotm(n,
+                   Buffer<T>(x_buffer), x_offset, x_inc,
+                   Buffer<T>(y_buffer), y_offset, y_inc,
+                   Buffer<T>(sparam_buffer), sparam_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotm<float>(const size_t,
                                            CUdeviceptr, const size_t, const size_t,
@@ -117,6 +176,10 @@ StatusCode Swap(const size_t n,
                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SWAP", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -155,6 +218,10 @@ StatusCode Scal(const size_t n,
                 CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SCAL", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -193,6 +260,10 @@ StatusCode Copy(const size_t n,
                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("COPY", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -232,6 +303,10 @@ StatusCode Axpy(const size_t n,
                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("AXPY", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -277,6 +352,10 @@ StatusCode Dot(const size_t n,
                const CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
                const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("DOT", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"dot_offset", dot_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -312,6 +391,10 @@ StatusCode Dotu(const size_t n,
                 const CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("DOTU", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"dot_offset", dot_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -342,6 +425,10 @@ StatusCode Dotc(const size_t n,
                 const CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("DOTC", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"dot_offset", dot_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -371,6 +458,10 @@ StatusCode Nrm2(const size_t n,
                 const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("NRM2", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"nrm2_offset", nrm2_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -409,6 +500,10 @@ StatusCode Asum(const size_t n,
                 const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("ASUM", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"asum_offset", asum_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -447,6 +542,10 @@ StatusCode Sum(const size_t n,
                const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
                const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SUM", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"sum_offset", sum_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -485,6 +584,10 @@ StatusCode Amax(const size_t n,
                 const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("AMAX", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"imax_offset", imax_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -523,6 +626,10 @@ StatusCode Amin(const size_t n,
                 const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("AMIN", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"imin_offset", imin_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -561,6 +668,10 @@ StatusCode Max(const size_t n,
                const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
                const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("MAX", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"imax_offset", imax_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -599,6 +710,10 @@ StatusCode Min(const size_t n,
                const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
                const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("MIN", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"imin_offset", imin_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -645,6 +760,10 @@ StatusCode Gemv(const Layout layout, const Transpose a_transpose,
                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("GEMV", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -711,6 +830,10 @@ StatusCode Gbmv(const Layout layout, const Transpose a_transpose,
                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("GBMV", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"kl", kl}, {"ku", ku}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -777,6 +900,10 @@ StatusCode Hemv(const Layout layout, const Triangle triangle,
                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("HEMV", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -819,6 +946,10 @@ StatusCode Hbmv(const Layout layout, const Triangle triangle,
                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("HBMV", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -861,6 +992,10 @@ StatusCode Hpmv(const Layout layout, const Triangle triangle,
                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("HPMV", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"ap_offset", ap_offset}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -903,6 +1038,10 @@ StatusCode Symv(const Layout layout, const Triangle triangle,
                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SYMV", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -953,6 +1092,10 @@ StatusCode Sbmv(const Layout layout, const Triangle triangle,
                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SBMV", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1003,6 +1146,10 @@ StatusCode Spmv(const Layout layout, const Triangle triangle,
                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SPMV", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"ap_offset", ap_offset}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1050,6 +1197,10 @@ StatusCode Trmv(const Layout layout, const Triangle triangle, const Transpose a_
                 CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("TRMV", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1095,6 +1246,10 @@ StatusCode Tbmv(const Layout layout, const Triangle triangle, const Transpose a_
                 CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("TBMV", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1140,6 +1295,10 @@ StatusCode Tpmv(const Layout layout, const Triangle triangle, const Transpose a_
                 CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("TPMV", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"ap_offset", ap_offset}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1185,6 +1344,10 @@ StatusCode Trsv(const Layout layout, const Triangle triangle, const Transpose a_
                 CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("TRSV", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1219,12 +1382,26 @@ template StatusCode PUBLIC_API Trsv<double2>(const Layout, const Triangle, const
 
 // Solves a banded triangular system of equations: STBSV/DTBSV/CTBSV/ZTBSV
 template <typename T>
-StatusCode Tbsv(const Layout, const Triangle, const Transpose, const Diagonal,
-                const size_t, const size_t,
-                const CUdeviceptr, const size_t, const size_t,
-                CUdeviceptr, const size_t, const size_t,
-                const CUcontext, const CUdevice) {
-  return StatusCode::kNotImplemented;
+StatusCode Tbsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n, const size_t k,
+                const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld,
+                CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("TBSV", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xtbsv<T>(queue_cpp, nullptr);
+    routine.DoTbsv(layout, triangle, a_transpose, diagonal,
+                   n, k,
+                   Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Tbsv<float>(const Layout, const Triangle, const Transpose, const Diagonal,
                                            const size_t, const size_t,
@@ -1249,12 +1426,26 @@ template StatusCode PUBLIC_API Tbsv<double2>(const Layout, const Triangle, const
 
 // Solves a packed triangular system of equations: STPSV/DTPSV/CTPSV/ZTPSV
 template <typename T>
-StatusCode Tpsv(const Layout, const Triangle, const Transpose, const Diagonal,
-                const size_t,
-                const CUdeviceptr, const size_t,
-                CUdeviceptr, const size_t, const size_t,
-                const CUcontext, const CUdevice) {
-  return StatusCode::kNotImplemented;
+StatusCode Tpsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n,
+                const CUdeviceptr ap_buffer, const size_t ap_offset,
+                CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("TPSV", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"ap_offset", ap_offset}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xtpsv<T>(queue_cpp, nullptr);
+    routine.DoTpsv(layout, triangle, a_transpose, diagonal,
+                   n,
+                   Buffer<T>(ap_buffer), ap_offset,
+                   Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Tpsv<float>(const Layout, const Triangle, const Transpose, const Diagonal,
                                            const size_t,
@@ -1287,6 +1478,10 @@ StatusCode Ger(const Layout layout,
                CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld,
                const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("GER", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1332,6 +1527,10 @@ StatusCode Geru(const Layout layout,
                 CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("GERU", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1370,6 +1569,10 @@ StatusCode Gerc(const Layout layout,
                 CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("GERC", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1407,6 +1610,10 @@ StatusCode Her(const Layout layout, const Triangle triangle,
                CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld,
                const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("HER", static_cast<int>(PrecisionValue<std::complex<T>>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1441,6 +1648,10 @@ StatusCode Hpr(const Layout layout, const Triangle triangle,
                CUdeviceptr ap_buffer, const size_t ap_offset,
                const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("HPR", static_cast<int>(PrecisionValue<std::complex<T>>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"ap_offset", ap_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1476,6 +1687,10 @@ StatusCode Her2(const Layout layout, const Triangle triangle,
                 CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("HER2", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1514,6 +1729,10 @@ StatusCode Hpr2(const Layout layout, const Triangle triangle,
                 CUdeviceptr ap_buffer, const size_t ap_offset,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("HPR2", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"ap_offset", ap_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1551,6 +1770,10 @@ StatusCode Syr(const Layout layout, const Triangle triangle,
                CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld,
                const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SYR", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1591,6 +1814,10 @@ StatusCode Spr(const Layout layout, const Triangle triangle,
                CUdeviceptr ap_buffer, const size_t ap_offset,
                const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SPR", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"ap_offset", ap_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1632,6 +1859,10 @@ StatusCode Syr2(const Layout layout, const Triangle triangle,
                 CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SYR2", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1677,6 +1908,10 @@ StatusCode Spr2(const Layout layout, const Triangle triangle,
                 CUdeviceptr ap_buffer, const size_t ap_offset,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SPR2", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"ap_offset", ap_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1728,6 +1963,10 @@ StatusCode Gemm(const Layout layout, const Transpose a_transpose, const Transpos
                 const CUcontext context, const CUdevice device,
                 CUdeviceptr temp_buffer) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("GEMM", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"b_transpose", static_cast<size_t>(b_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"c_offset", c_offset}, {"c_ld", c_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1797,6 +2036,10 @@ StatusCode Symm(const Layout layout, const Side side, const Triangle triangle,
                 CUdeviceptr c_buffer, const size_t c_offset, const size_t c_ld,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SYMM", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"c_offset", c_offset}, {"c_ld", c_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1863,6 +2106,10 @@ StatusCode Hemm(const Layout layout, const Side side, const Triangle triangle,
                 CUdeviceptr c_buffer, const size_t c_offset, const size_t c_ld,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("HEMM", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"c_offset", c_offset}, {"c_ld", c_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1904,6 +2151,10 @@ StatusCode Syrk(const Layout layout, const Triangle triangle, const Transpose a_
                 CUdeviceptr c_buffer, const size_t c_offset, const size_t c_ld,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SYRK", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"c_offset", c_offset}, {"c_ld", c_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -1963,6 +2214,10 @@ StatusCode Herk(const Layout layout, const Triangle triangle, const Transpose a_
                 CUdeviceptr c_buffer, const size_t c_offset, const size_t c_ld,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("HERK", static_cast<int>(PrecisionValue<std::complex<T>>()),
+                                      {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"c_offset", c_offset}, {"c_ld", c_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -2002,6 +2257,10 @@ StatusCode Syr2k(const Layout layout, const Triangle triangle, const Transpose a
                  CUdeviceptr c_buffer, const size_t c_offset, const size_t c_ld,
                  const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SYR2K", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"ab_transpose", static_cast<size_t>(ab_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"c_offset", c_offset}, {"c_ld", c_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -2068,6 +2327,10 @@ StatusCode Her2k(const Layout layout, const Triangle triangle, const Transpose a
                  CUdeviceptr c_buffer, const size_t c_offset, const size_t c_ld,
                  const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("HER2K", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"ab_transpose", static_cast<size_t>(ab_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"c_offset", c_offset}, {"c_ld", c_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -2108,6 +2371,10 @@ StatusCode Trmm(const Layout layout, const Side side, const Triangle triangle, c
                 CUdeviceptr b_buffer, const size_t b_offset, const size_t b_ld,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("TRMM", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -2160,6 +2427,10 @@ StatusCode Trsm(const Layout layout, const Side side, const Triangle triangle, c
                 CUdeviceptr b_buffer, const size_t b_offset, const size_t b_ld,
                 const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("TRSM", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -2211,6 +2482,10 @@ StatusCode Had(const size_t n,
                CUdeviceptr z_buffer, const size_t z_offset, const size_t z_inc,
                const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("HAD", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"z_offset", z_offset}, {"z_inc", z_inc}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -2260,6 +2535,104 @@ template StatusCode PUBLIC_API Had<half>(const size_t,
                                          CUdeviceptr, const size_t, const size_t,
                                          const CUcontext, const CUdevice);
 
+// Scaling and addition of two vectors (non-BLAS function): SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+template <typename T>
+StatusCode Axpby(const size_t n,
+                 const T alpha,
+                 const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta,
+                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                 const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("AXPBY", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xaxpby<T>(queue_cpp, nullptr);
+    routine.DoAxpby(n,
+                    alpha,
+                    Buffer<T>(x_buffer), x_offset, x_inc,
+                    beta,
+                    Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Axpby<float>(const size_t,
+                                            const float,
+                                            const CUdeviceptr, const size_t, const size_t,
+                                            const float,
+                                            CUdeviceptr, const size_t, const size_t,
+                                            const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpby<double>(const size_t,
+                                             const double,
+                                             const CUdeviceptr, const size_t, const size_t,
+                                             const double,
+                                             CUdeviceptr, const size_t, const size_t,
+                                             const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpby<float2>(const size_t,
+                                             const float2,
+                                             const CUdeviceptr, const size_t, const size_t,
+                                             const float2,
+                                             CUdeviceptr, const size_t, const size_t,
+                                             const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpby<double2>(const size_t,
+                                              const double2,
+                                              const CUdeviceptr, const size_t, const size_t,
+                                              const double2,
+                                              CUdeviceptr, const size_t, const size_t,
+                                              const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpby<half>(const size_t,
+                                           const half,
+                                           const CUdeviceptr, const size_t, const size_t,
+                                           const half,
+                                           CUdeviceptr, const size_t, const size_t,
+                                           const CUcontext, const CUdevice);
+
+// Sets all elements of a vector to a scalar value (non-BLAS function): SSET/DSET/CSET/ZSET/HSET
+template <typename T>
+StatusCode Set(const size_t n,
+               const T alpha,
+               CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+               const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SET", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xset<T>(queue_cpp, nullptr);
+    routine.DoSet(n,
+                  alpha,
+                  Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Set<float>(const size_t,
+                                          const float,
+                                          CUdeviceptr, const size_t, const size_t,
+                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Set<double>(const size_t,
+                                           const double,
+                                           CUdeviceptr, const size_t, const size_t,
+                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Set<float2>(const size_t,
+                                           const float2,
+                                           CUdeviceptr, const size_t, const size_t,
+                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Set<double2>(const size_t,
+                                            const double2,
+                                            CUdeviceptr, const size_t, const size_t,
+                                            const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Set<half>(const size_t,
+                                         const half,
+                                         CUdeviceptr, const size_t, const size_t,
+                                         const CUcontext, const CUdevice);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 template <typename T>
 StatusCode Omatcopy(const Layout layout, const Transpose a_transpose,
@@ -2269,6 +2642,10 @@ StatusCode Omatcopy(const Layout layout, const Transpose a_transpose,
                     CUdeviceptr b_buffer, const size_t b_offset, const size_t b_ld,
                     const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("OMATCOPY", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"b_offset", b_offset}, {"b_ld", b_ld}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -2319,6 +2696,10 @@ StatusCode Im2col(const size_t channels, const size_t height, const size_t width
                   CUdeviceptr col_buffer, const size_t col_offset,
                   const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("IM2COL", static_cast<int>(PrecisionValue<T>()),
+                                      {{"channels", channels}, {"height", height}, {"width", width}, {"kernel_h", kernel_h}, {"kernel_w", kernel_w}, {"pad_h", pad_h}, {"pad_w", pad_w}, {"stride_h", stride_h}, {"stride_w", stride_w}, {"dilation_h", dilation_h}, {"dilation_w", dilation_w}, {"im_offset", im_offset}, {"col_offset", col_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -2350,62 +2731,357 @@ template StatusCode PUBLIC_API Im2col<half>(const size_t, const size_t, const si
                                             CUdeviceptr, const size_t,
                                             const CUcontext, const CUdevice);
 
-// Batched version of AXPY: SAXPYBATCHED/DAXPYBATCHED/CAXPYBATCHED/ZAXPYBATCHED/HAXPYBATCHED
+// Col2im function (non-BLAS function): SCOL2IM/DCOL2IM/CCOL2IM/ZCOL2IM/HCOL2IM
 template <typename T>
-StatusCode AxpyBatched(const size_t n,
-                       const T *alphas,
-                       const CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
-                       CUdeviceptr y_buffer, const size_t *y_offsets, const size_t y_inc,
-                       const size_t batch_count,
-                       const CUcontext context, const CUdevice device) {
+StatusCode Col2im(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                  const CUdeviceptr col_buffer, const size_t col_offset,
+                  CUdeviceptr im_buffer, const size_t im_offset,
+                  const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("COL2IM", static_cast<int>(PrecisionValue<T>()),
+                                      {{"channels", channels}, {"height", height}, {"width", width}, {"kernel_h", kernel_h}, {"kernel_w", kernel_w}, {"pad_h", pad_h}, {"pad_w", pad_w}, {"stride_h", stride_h}, {"stride_w", stride_w}, {"dilation_h", dilation_h}, {"dilation_w", dilation_w}, {"col_offset", col_offset}, {"im_offset", im_offset}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
-    auto routine = XaxpyBatched<T>(queue_cpp, nullptr);
-    auto alphas_cpp = std::vector<T>();
-    auto x_offsets_cpp = std::vector<size_t>();
-    auto y_offsets_cpp = std::vector<size_t>();
-    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
-      alphas_cpp.push_back(alphas[batch]);
-      x_offsets_cpp.push_back(x_offsets[batch]);
-      y_offsets_cpp.push_back(y_offsets[batch]);
+    auto routine = Xcol2im<T>(queue_cpp, nullptr);
+    routine.DoCol2im(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                     Buffer<T>(col_buffer), col_offset,
+                     Buffer<T>(im_buffer), im_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Col2im<float>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                             const CUdeviceptr, const size_t,
+                                             CUdeviceptr, const size_t,
+                                             const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Col2im<double>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                              const CUdeviceptr, const size_t,
+                                              CUdeviceptr, const size_t,
+                                              const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Col2im<float2>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                              const CUdeviceptr, const size_t,
+                                              CUdeviceptr, const size_t,
+                                              const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Col2im<double2>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                               const CUdeviceptr, const size_t,
+                                               CUdeviceptr, const size_t,
+                                               const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Col2im<half>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                            const CUdeviceptr, const size_t,
+                                            CUdeviceptr, const size_t,
+                                            const CUcontext, const CUdevice);
+
+// Fused dot product, Euclidian norm and absolute sum (non-BLAS function): SDOTNRM2ASUM/DDOTNRM2ASUM/HDOTNRM2ASUM
+template <typename T>
+StatusCode Dotnrm2asum(const size_t n,
+                       CUdeviceptr results_buffer, const size_t results_offset,
+                       const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                       const CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                       const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("DOTNRM2ASUM", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"results_offset", results_offset}});
     }
-    routine.DoAxpyBatched(n,
-                          alphas_cpp,
-                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
-                          Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
-                          batch_count);
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xdotnrm2asum<T>(queue_cpp, nullptr);
+    routine.DoDotnrm2asum(n,
+                          Buffer<T>(results_buffer), results_offset,
+                          Buffer<T>(x_buffer), x_offset, x_inc,
+                          Buffer<T>(y_buffer), y_offset, y_inc);
     return StatusCode::kSuccess;
   } catch (...) { return DispatchException(); }
 }
-template StatusCode PUBLIC_API AxpyBatched<float>(const size_t,
-                                                  const float*,
-                                                  const CUdeviceptr, const size_t*, const size_t,
-                                                  CUdeviceptr, const size_t*, const size_t,
-                                                  const size_t,
+template StatusCode PUBLIC_API Dotnrm2asum<float>(const size_t,
+                                                  CUdeviceptr, const size_t,
+                                                  const CUdeviceptr, const size_t, const size_t,
+                                                  const CUdeviceptr, const size_t, const size_t,
                                                   const CUcontext, const CUdevice);
-template StatusCode PUBLIC_API AxpyBatched<double>(const size_t,
-                                                   const double*,
-                                                   const CUdeviceptr, const size_t*, const size_t,
-                                                   CUdeviceptr, const size_t*, const size_t,
-                                                   const size_t,
-                                                   const CUcontext, const CUdevice);
-template StatusCode PUBLIC_API AxpyBatched<float2>(const size_t,
-                                                   const float2*,
-                                                   const CUdeviceptr, const size_t*, const size_t,
-                                                   CUdeviceptr, const size_t*, const size_t,
-                                                   const size_t,
+template StatusCode PUBLIC_API Dotnrm2asum<double>(const size_t,
+                                                   CUdeviceptr, const size_t,
+                                                   const CUdeviceptr, const size_t, const size_t,
+                                                   const CUdeviceptr, const size_t, const size_t,
                                                    const CUcontext, const CUdevice);
-template StatusCode PUBLIC_API AxpyBatched<double2>(const size_t,
-                                                    const double2*,
-                                                    const CUdeviceptr, const size_t*, const size_t,
-                                                    CUdeviceptr, const size_t*, const size_t,
-                                                    const size_t,
-                                                    const CUcontext, const CUdevice);
-template StatusCode PUBLIC_API AxpyBatched<half>(const size_t,
+template StatusCode PUBLIC_API Dotnrm2asum<half>(const size_t,
+                                                 CUdeviceptr, const size_t,
+                                                 const CUdeviceptr, const size_t, const size_t,
+                                                 const CUdeviceptr, const size_t, const size_t,
+                                                 const CUcontext, const CUdevice);
+
+// Batched convolution as GEMM (non-BLAS function): SCONVGEMM/DCONVGEMM/HCONVGEMM
+template <typename T>
+StatusCode Convgemm(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const size_t num_kernels, const size_t batch_count,
+                    const CUdeviceptr im_buffer, const size_t im_offset,
+                    const CUdeviceptr kernel_buffer, const size_t kernel_offset,
+                    CUdeviceptr result_buffer, const size_t result_offset,
+                    const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("CONVGEMM", static_cast<int>(PrecisionValue<T>()),
+                                      {{"channels", channels}, {"height", height}, {"width", width}, {"kernel_h", kernel_h}, {"kernel_w", kernel_w}, {"pad_h", pad_h}, {"pad_w", pad_w}, {"stride_h", stride_h}, {"stride_w", stride_w}, {"dilation_h", dilation_h}, {"dilation_w", dilation_w}, {"num_kernels", num_kernels}, {"batch_count", batch_count}, {"im_offset", im_offset}, {"kernel_offset", kernel_offset}, {"result_offset", result_offset}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xconvgemm<T>(queue_cpp, nullptr);
+    routine.DoConvgemm(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count,
+                       Buffer<T>(im_buffer), im_offset,
+                       Buffer<T>(kernel_buffer), kernel_offset,
+                       Buffer<T>(result_buffer), result_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Convgemm<float>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                               const CUdeviceptr, const size_t,
+                                               const CUdeviceptr, const size_t,
+                                               CUdeviceptr, const size_t,
+                                               const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Convgemm<double>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                const CUdeviceptr, const size_t,
+                                                const CUdeviceptr, const size_t,
+                                                CUdeviceptr, const size_t,
+                                                const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Convgemm<half>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                              const CUdeviceptr, const size_t,
+                                              const CUdeviceptr, const size_t,
+                                              CUdeviceptr, const size_t,
+                                              const CUcontext, const CUdevice);
+
+// Cholesky factorisation (non-BLAS function): SPOTRF/DPOTRF
+template <typename T>
+StatusCode Potrf(const Layout layout, const Triangle triangle,
+                 const size_t n,
+                 CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld,
+                 const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("POTRF", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xpotrf<T>(queue_cpp, nullptr);
+    routine.DoPotrf(layout, triangle,
+                    n,
+                    Buffer<T>(a_buffer), a_offset, a_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Potrf<float>(const Layout, const Triangle,
+                                            const size_t,
+                                            CUdeviceptr, const size_t, const size_t,
+                                            const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Potrf<double>(const Layout, const Triangle,
+                                             const size_t,
+                                             CUdeviceptr, const size_t, const size_t,
+                                             const CUcontext, const CUdevice);
+
+// Batched version of AXPY: SAXPYBATCHED/DAXPYBATCHED/CAXPYBATCHED/ZAXPYBATCHED/HAXPYBATCHED
+template <typename T>
+StatusCode AxpyBatched(const size_t n,
+                       const T *alphas,
+                       const CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       CUdeviceptr y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("AXPYBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_inc", x_inc}, {"y_inc", y_inc}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XaxpyBatched<T>(queue_cpp, nullptr);
+    auto alphas_cpp = std::vector<T>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+    }
+    routine.DoAxpyBatched(n,
+                          alphas_cpp,
+                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AxpyBatched<float>(const size_t,
+                                                  const float*,
+                                                  const CUdeviceptr, const size_t*, const size_t,
+                                                  CUdeviceptr, const size_t*, const size_t,
+                                                  const size_t,
+                                                  const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpyBatched<double>(const size_t,
+                                                   const double*,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   CUdeviceptr, const size_t*, const size_t,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpyBatched<float2>(const size_t,
+                                                   const float2*,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   CUdeviceptr, const size_t*, const size_t,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpyBatched<double2>(const size_t,
+                                                    const double2*,
+                                                    const CUdeviceptr, const size_t*, const size_t,
+                                                    CUdeviceptr, const size_t*, const size_t,
+                                                    const size_t,
+                                                    const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpyBatched<half>(const size_t,
+                                                 const half*,
+                                                 const CUdeviceptr, const size_t*, const size_t,
+                                                 CUdeviceptr, const size_t*, const size_t,
+                                                 const size_t,
+                                                 const CUcontext, const CUdevice);
+
+// Batched version of ROT: SROTBATCHED/DROTBATCHED
+template <typename T>
+StatusCode RotBatched(const size_t n,
+                      CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                      CUdeviceptr y_buffer, const size_t *y_offsets, const size_t y_inc,
+                      const T *coss,
+                      const T *sins,
+                      const size_t batch_count,
+                      const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("ROTBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_inc", x_inc}, {"y_inc", y_inc}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XrotBatched<T>(queue_cpp, nullptr);
+    auto coss_cpp = std::vector<T>();
+    auto sins_cpp = std::vector<T>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      coss_cpp.push_back(coss[batch]);
+      sins_cpp.push_back(sins[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+    }
+    routine.DoRotBatched(n,
+                         Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                         Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                         coss_cpp,
+                         sins_cpp,
+                         batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API RotBatched<float>(const size_t,
+                                                 CUdeviceptr, const size_t*, const size_t,
+                                                 CUdeviceptr, const size_t*, const size_t,
+                                                 const float*,
+                                                 const float*,
+                                                 const size_t,
+                                                 const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API RotBatched<double>(const size_t,
+                                                  CUdeviceptr, const size_t*, const size_t,
+                                                  CUdeviceptr, const size_t*, const size_t,
+                                                  const double*,
+                                                  const double*,
+                                                  const size_t,
+                                                  const CUcontext, const CUdevice);
+
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+template <typename T>
+StatusCode GemvBatched(const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const CUdeviceptr a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const T *betas,
+                       CUdeviceptr y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("GEMVBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_ld", a_ld}, {"x_inc", x_inc}, {"y_inc", y_inc}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XgemvBatched<T>(queue_cpp, nullptr);
+    auto alphas_cpp = std::vector<T>();
+    auto betas_cpp = std::vector<T>();
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      betas_cpp.push_back(betas[batch]);
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+    }
+    routine.DoGemvBatched(layout, a_transpose,
+                          m, n,
+                          alphas_cpp,
+                          Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          betas_cpp,
+                          Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvBatched<float>(const Layout, const Transpose,
+                                                  const size_t, const size_t,
+                                                  const float*,
+                                                  const CUdeviceptr, const size_t*, const size_t,
+                                                  const CUdeviceptr, const size_t*, const size_t,
+                                                  const float*,
+                                                  CUdeviceptr, const size_t*, const size_t,
+                                                  const size_t,
+                                                  const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvBatched<double>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const double*,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   const double*,
+                                                   CUdeviceptr, const size_t*, const size_t,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvBatched<float2>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const float2*,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   const float2*,
+                                                   CUdeviceptr, const size_t*, const size_t,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvBatched<double2>(const Layout, const Transpose,
+                                                    const size_t, const size_t,
+                                                    const double2*,
+                                                    const CUdeviceptr, const size_t*, const size_t,
+                                                    const CUdeviceptr, const size_t*, const size_t,
+                                                    const double2*,
+                                                    CUdeviceptr, const size_t*, const size_t,
+                                                    const size_t,
+                                                    const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvBatched<half>(const Layout, const Transpose,
+                                                 const size_t, const size_t,
                                                  const half*,
                                                  const CUdeviceptr, const size_t*, const size_t,
+                                                 const CUdeviceptr, const size_t*, const size_t,
+                                                 const half*,
                                                  CUdeviceptr, const size_t*, const size_t,
                                                  const size_t,
                                                  const CUcontext, const CUdevice);
@@ -2422,6 +3098,10 @@ StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const T
                        const size_t batch_count,
                        const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("GEMMBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"b_transpose", static_cast<size_t>(b_transpose)}, {"a_ld", a_ld}, {"b_ld", b_ld}, {"c_ld", c_ld}, {"batch_count", batch_count}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -2507,6 +3187,10 @@ StatusCode GemmStridedBatched(const Layout layout, const Transpose a_transpose,
                               const size_t batch_count,
                               const CUcontext context, const CUdevice device) {
   try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("GEMMSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"b_transpose", static_cast<size_t>(b_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"b_stride", b_stride}, {"c_offset", c_offset}, {"c_ld", c_ld}, {"c_stride", c_stride}, {"batch_count", batch_count}});
+    }
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
@@ -2568,58 +3252,1179 @@ template StatusCode PUBLIC_API GemmStridedBatched<half>(const Layout, const Tran
                                                         const size_t,
                                                         const CUcontext, const CUdevice);
 
-// =================================================================================================
-
-// Retrieves the required size of the temporary buffer for the GEMM kernel (optional)
+// Batched version of TRSM: STRSMBATCHED/DTRSMBATCHED/CTRSMBATCHED/ZTRSMBATCHED
 template <typename T>
-StatusCode GemmTempBufferSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
-                              const size_t m, const size_t n, const size_t k,
-                              const size_t a_offset, const size_t a_ld,
-                              const size_t b_offset, const size_t b_ld,
-                              const size_t c_offset, const size_t c_ld,
-                              const CUdevice device, size_t& temp_buffer_size) {
+StatusCode TrsmBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const CUdeviceptr a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       CUdeviceptr b_buffer, const size_t *b_offsets, const size_t b_ld,
+                       const size_t batch_count,
+                       const CUcontext context, const CUdevice device) {
   try {
-
-    // Retrieves the tuning database
-    const auto device_cpp = Device(device);
-    const auto kernel_names = std::vector<std::string>{"Xgemm", "GemmRoutine"};
-    Databases db(kernel_names);
-    Routine::InitDatabase(device_cpp, kernel_names, PrecisionValue<T>(), {}, db);
-
-    // Computes the buffer size
-    if (Xgemm<T>::UseDirectKernel(m, n, k, db["XGEMM_MIN_INDIRECT_SIZE"])) {
-      temp_buffer_size = 0;
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("TRSMBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_ld", a_ld}, {"b_ld", b_ld}, {"batch_count", batch_count}});
     }
-    else {
-      temp_buffer_size = Xgemm<T>::GetTempSize(layout, a_transpose, b_transpose, m, n, k,
-                                               a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
-                                               db["MWG"], db["NWG"], db["KWG"] * db["KREG"],
-                                               db["GEMMK"]);
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XtrsmBatched<T>(queue_cpp, nullptr);
+    auto alphas_cpp = std::vector<T>();
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto b_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      b_offsets_cpp.push_back(b_offsets[batch]);
     }
-    temp_buffer_size *= sizeof(T); // translate from num-elements to bytes
+    routine.DoTrsmBatched(layout, side, triangle, a_transpose, diagonal,
+                          m, n,
+                          alphas_cpp,
+                          Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                          Buffer<T>(b_buffer), b_offsets_cpp, b_ld,
+                          batch_count);
     return StatusCode::kSuccess;
   } catch (...) { return DispatchException(); }
 }
-template StatusCode PUBLIC_API GemmTempBufferSize<float>(const Layout, const Transpose, const Transpose,
-                                                         const size_t, const size_t, const size_t,
-                                                         const size_t, const size_t, const size_t, const size_t,
-                                                         const size_t, const size_t, const CUdevice, size_t&);
-template StatusCode PUBLIC_API GemmTempBufferSize<double>(const Layout, const Transpose, const Transpose,
-                                                          const size_t, const size_t, const size_t,
-                                                          const size_t, const size_t, const size_t, const size_t,
-                                                          const size_t, const size_t, const CUdevice, size_t&);
-template StatusCode PUBLIC_API GemmTempBufferSize<float2>(const Layout, const Transpose, const Transpose,
-                                                          const size_t, const size_t, const size_t,
-                                                          const size_t, const size_t, const size_t, const size_t,
-                                                          const size_t, const size_t, const CUdevice, size_t&);
-template StatusCode PUBLIC_API GemmTempBufferSize<double2>(const Layout, const Transpose, const Transpose,
-                                                           const size_t, const size_t, const size_t,
-                                                           const size_t, const size_t, const size_t, const size_t,
-                                                           const size_t, const size_t, const CUdevice, size_t&);
-template StatusCode PUBLIC_API GemmTempBufferSize<half>(const Layout, const Transpose, const Transpose,
-                                                        const size_t, const size_t, const size_t,
-                                                        const size_t, const size_t, const size_t, const size_t,
+template StatusCode PUBLIC_API TrsmBatched<float>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                  const size_t, const size_t,
+                                                  const float*,
+                                                  const CUdeviceptr, const size_t*, const size_t,
+                                                  CUdeviceptr, const size_t*, const size_t,
+                                                  const size_t,
+                                                  const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API TrsmBatched<double>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                   const size_t, const size_t,
+                                                   const double*,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   CUdeviceptr, const size_t*, const size_t,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API TrsmBatched<float2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                   const size_t, const size_t,
+                                                   const float2*,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   CUdeviceptr, const size_t*, const size_t,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API TrsmBatched<double2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                    const size_t, const size_t,
+                                                    const double2*,
+                                                    const CUdeviceptr, const size_t*, const size_t,
+                                                    CUdeviceptr, const size_t*, const size_t,
+                                                    const size_t,
+                                                    const CUcontext, const CUdevice);
+
+// StridedBatched version of TRSM: STRSMSTRIDEDBATCHED/DTRSMSTRIDEDBATCHED/CTRSMSTRIDEDBATCHED/ZTRSMSTRIDEDBATCHED
+template <typename T>
+StatusCode TrsmStridedBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              CUdeviceptr b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("TRSMSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"b_stride", b_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XtrsmStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoTrsmStridedBatched(layout, side, triangle, a_transpose, diagonal,
+                                 m, n,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(b_buffer), b_offset, b_ld, b_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API TrsmStridedBatched<float>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                         const size_t, const size_t,
+                                                         const float,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API TrsmStridedBatched<double>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t, const size_t,
+                                                          const double,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API TrsmStridedBatched<float2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t, const size_t,
+                                                          const float2,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API TrsmStridedBatched<double2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                           const size_t, const size_t,
+                                                           const double2,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+
+// StridedBatched version of SYMM: SSYMMSTRIDEDBATCHED/DSYMMSTRIDEDBATCHED/CSYMMSTRIDEDBATCHED/ZSYMMSTRIDEDBATCHED/HSYMMSTRIDEDBATCHED
+template <typename T>
+StatusCode SymmStridedBatched(const Layout layout, const Side side, const Triangle triangle,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const CUdeviceptr b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const T beta,
+                              CUdeviceptr c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SYMMSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"b_stride", b_stride}, {"c_offset", c_offset}, {"c_ld", c_ld}, {"c_stride", c_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XsymmStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoSymmStridedBatched(layout, side, triangle,
+                                 m, n,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(b_buffer), b_offset, b_ld, b_stride,
+                                 beta,
+                                 Buffer<T>(c_buffer), c_offset, c_ld, c_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API SymmStridedBatched<float>(const Layout, const Side, const Triangle,
+                                                         const size_t, const size_t,
+                                                         const float,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const float,
+                                                         CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SymmStridedBatched<double>(const Layout, const Side, const Triangle,
+                                                          const size_t, const size_t,
+                                                          const double,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const double,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SymmStridedBatched<float2>(const Layout, const Side, const Triangle,
+                                                          const size_t, const size_t,
+                                                          const float2,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const float2,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SymmStridedBatched<double2>(const Layout, const Side, const Triangle,
+                                                           const size_t, const size_t,
+                                                           const double2,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const double2,
+                                                           CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SymmStridedBatched<half>(const Layout, const Side, const Triangle,
+                                                        const size_t, const size_t,
+                                                        const half,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const half,
+                                                        CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        const CUcontext, const CUdevice);
+
+// StridedBatched version of SYRK: SSYRKSTRIDEDBATCHED/DSYRKSTRIDEDBATCHED/CSYRKSTRIDEDBATCHED/ZSYRKSTRIDEDBATCHED/HSYRKSTRIDEDBATCHED
+template <typename T>
+StatusCode SyrkStridedBatched(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                              const size_t n, const size_t k,
+                              const T alpha,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const T beta,
+                              CUdeviceptr c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SYRKSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"k", k}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"c_offset", c_offset}, {"c_ld", c_ld}, {"c_stride", c_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XsyrkStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoSyrkStridedBatched(layout, triangle, a_transpose,
+                                 n, k,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 beta,
+                                 Buffer<T>(c_buffer), c_offset, c_ld, c_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API SyrkStridedBatched<float>(const Layout, const Triangle, const Transpose,
+                                                         const size_t, const size_t,
+                                                         const float,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const float,
+                                                         CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SyrkStridedBatched<double>(const Layout, const Triangle, const Transpose,
+                                                          const size_t, const size_t,
+                                                          const double,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const double,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SyrkStridedBatched<float2>(const Layout, const Triangle, const Transpose,
+                                                          const size_t, const size_t,
+                                                          const float2,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const float2,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SyrkStridedBatched<double2>(const Layout, const Triangle, const Transpose,
+                                                           const size_t, const size_t,
+                                                           const double2,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const double2,
+                                                           CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SyrkStridedBatched<half>(const Layout, const Triangle, const Transpose,
+                                                        const size_t, const size_t,
+                                                        const half,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const half,
+                                                        CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        const CUcontext, const CUdevice);
+
+// StridedBatched version of TRMM: STRMMSTRIDEDBATCHED/DTRMMSTRIDEDBATCHED/CTRMMSTRIDEDBATCHED/ZTRMMSTRIDEDBATCHED/HTRMMSTRIDEDBATCHED
+template <typename T>
+StatusCode TrmmStridedBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              CUdeviceptr b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("TRMMSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"side", static_cast<size_t>(side)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"b_stride", b_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XtrmmStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoTrmmStridedBatched(layout, side, triangle, a_transpose, diagonal,
+                                 m, n,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(b_buffer), b_offset, b_ld, b_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API TrmmStridedBatched<float>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                         const size_t, const size_t,
+                                                         const float,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API TrmmStridedBatched<double>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t, const size_t,
+                                                          const double,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API TrmmStridedBatched<float2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t, const size_t,
+                                                          const float2,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API TrmmStridedBatched<double2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                           const size_t, const size_t,
+                                                           const double2,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API TrmmStridedBatched<half>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                        const size_t, const size_t,
+                                                        const half,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        const CUcontext, const CUdevice);
+
+// Batched inversion of triangular matrices: SINVERTBATCHED/DINVERTBATCHED/CINVERTBATCHED/ZINVERTBATCHED
+template <typename T>
+StatusCode InvertBatched(const Layout layout, const Triangle triangle, const Diagonal diagonal,
+                         const size_t n,
+                         const CUdeviceptr a_buffer, const size_t *a_offsets, const size_t a_ld,
+                         CUdeviceptr b_buffer, const size_t *b_offsets, const size_t b_ld,
+                         const size_t batch_count,
+                         const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("INVERTBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_ld", a_ld}, {"b_ld", b_ld}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XinvertBatched<T>(queue_cpp, nullptr);
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto b_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      b_offsets_cpp.push_back(b_offsets[batch]);
+    }
+    routine.DoInvertBatched(layout, triangle, diagonal,
+                            n,
+                            Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                            Buffer<T>(b_buffer), b_offsets_cpp, b_ld,
+                            batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API InvertBatched<float>(const Layout, const Triangle, const Diagonal,
+                                                    const size_t,
+                                                    const CUdeviceptr, const size_t*, const size_t,
+                                                    CUdeviceptr, const size_t*, const size_t,
+                                                    const size_t,
+                                                    const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API InvertBatched<double>(const Layout, const Triangle, const Diagonal,
+                                                     const size_t,
+                                                     const CUdeviceptr, const size_t*, const size_t,
+                                                     CUdeviceptr, const size_t*, const size_t,
+                                                     const size_t,
+                                                     const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API InvertBatched<float2>(const Layout, const Triangle, const Diagonal,
+                                                     const size_t,
+                                                     const CUdeviceptr, const size_t*, const size_t,
+                                                     CUdeviceptr, const size_t*, const size_t,
+                                                     const size_t,
+                                                     const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API InvertBatched<double2>(const Layout, const Triangle, const Diagonal,
+                                                      const size_t,
+                                                      const CUdeviceptr, const size_t*, const size_t,
+                                                      CUdeviceptr, const size_t*, const size_t,
+                                                      const size_t,
+                                                      const CUcontext, const CUdevice);
+
+// StridedBatched version of POTRF: SPOTRFSTRIDEDBATCHED/DPOTRFSTRIDEDBATCHED
+template <typename T>
+StatusCode PotrfStridedBatched(const Layout layout, const Triangle triangle,
+                               const size_t n,
+                               CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                               const size_t batch_count,
+                               const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("POTRFSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XpotrfStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoPotrfStridedBatched(layout, triangle,
+                                  n,
+                                  Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                  batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API PotrfStridedBatched<float>(const Layout, const Triangle,
+                                                          const size_t,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API PotrfStridedBatched<double>(const Layout, const Triangle,
+                                                           const size_t,
+                                                           CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+
+// StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+template <typename T>
+StatusCode GemvStridedBatched(const Layout layout, const Transpose a_transpose,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const T beta,
+                              CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("GEMVSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"y_stride", y_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XgemvStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoGemvStridedBatched(layout, a_transpose,
+                                 m, n,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 beta,
+                                 Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvStridedBatched<float>(const Layout, const Transpose,
+                                                         const size_t, const size_t,
+                                                         const float,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const float,
+                                                         CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvStridedBatched<double>(const Layout, const Transpose,
+                                                          const size_t, const size_t,
+                                                          const double,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const double,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvStridedBatched<float2>(const Layout, const Transpose,
+                                                          const size_t, const size_t,
+                                                          const float2,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const float2,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvStridedBatched<double2>(const Layout, const Transpose,
+                                                           const size_t, const size_t,
+                                                           const double2,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const double2,
+                                                           CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvStridedBatched<half>(const Layout, const Transpose,
+                                                        const size_t, const size_t,
+                                                        const half,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const half,
+                                                        CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        const CUcontext, const CUdevice);
+
+// StridedBatched version of TRSV: STRSVSTRIDEDBATCHED/DTRSVSTRIDEDBATCHED/CTRSVSTRIDEDBATCHED/ZTRSVSTRIDEDBATCHED
+template <typename T>
+StatusCode TrsvStridedBatched(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t n,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("TRSVSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"layout", static_cast<size_t>(layout)}, {"triangle", static_cast<size_t>(triangle)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"diagonal", static_cast<size_t>(diagonal)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XtrsvStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoTrsvStridedBatched(layout, triangle, a_transpose, diagonal,
+                                 n,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API TrsvStridedBatched<float>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                         const size_t,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API TrsvStridedBatched<double>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API TrsvStridedBatched<float2>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API TrsvStridedBatched<double2>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                           const size_t,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+
+// StridedBatched version of OMATCOPY: SOMATCOPYSTRIDEDBATCHED/DOMATCOPYSTRIDEDBATCHED/COMATCOPYSTRIDEDBATCHED/ZOMATCOPYSTRIDEDBATCHED/HOMATCOPYSTRIDEDBATCHED
+template <typename T>
+StatusCode OmatcopyStridedBatched(const Layout layout, const Transpose a_transpose,
+                                  const size_t m, const size_t n,
+                                  const T alpha,
+                                  const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                  CUdeviceptr b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                  const size_t batch_count,
+                                  const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("OMATCOPYSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"m", m}, {"n", n}, {"layout", static_cast<size_t>(layout)}, {"a_transpose", static_cast<size_t>(a_transpose)}, {"a_offset", a_offset}, {"a_ld", a_ld}, {"a_stride", a_stride}, {"b_offset", b_offset}, {"b_ld", b_ld}, {"b_stride", b_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XomatcopyStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoOmatcopyStridedBatched(layout, a_transpose,
+                                     m, n,
+                                     alpha,
+                                     Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                     Buffer<T>(b_buffer), b_offset, b_ld, b_stride,
+                                     batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API OmatcopyStridedBatched<float>(const Layout, const Transpose,
+                                                             const size_t, const size_t,
+                                                             const float,
+                                                             const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                             CUdeviceptr, const size_t, const size_t, const size_t,
+                                                             const size_t,
+                                                             const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API OmatcopyStridedBatched<double>(const Layout, const Transpose,
+                                                              const size_t, const size_t,
+                                                              const double,
+                                                              const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                              CUdeviceptr, const size_t, const size_t, const size_t,
+                                                              const size_t,
+                                                              const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API OmatcopyStridedBatched<float2>(const Layout, const Transpose,
+                                                              const size_t, const size_t,
+                                                              const float2,
+                                                              const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                              CUdeviceptr, const size_t, const size_t, const size_t,
+                                                              const size_t,
+                                                              const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API OmatcopyStridedBatched<double2>(const Layout, const Transpose,
+                                                               const size_t, const size_t,
+                                                               const double2,
+                                                               const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                               CUdeviceptr, const size_t, const size_t, const size_t,
+                                                               const size_t,
+                                                               const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API OmatcopyStridedBatched<half>(const Layout, const Transpose,
+                                                            const size_t, const size_t,
+                                                            const half,
+                                                            const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                            CUdeviceptr, const size_t, const size_t, const size_t,
+                                                            const size_t,
+                                                            const CUcontext, const CUdevice);
+
+// StridedBatched version of IM2COL: SIM2COLSTRIDEDBATCHED/DIM2COLSTRIDEDBATCHED/CIM2COLSTRIDEDBATCHED/ZIM2COLSTRIDEDBATCHED/HIM2COLSTRIDEDBATCHED
+template <typename T>
+StatusCode Im2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                const CUdeviceptr im_buffer, const size_t im_offset, const size_t im_stride,
+                                CUdeviceptr col_buffer, const size_t col_offset, const size_t col_stride,
+                                const size_t batch_count,
+                                const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("IM2COLSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"channels", channels}, {"height", height}, {"width", width}, {"kernel_h", kernel_h}, {"kernel_w", kernel_w}, {"pad_h", pad_h}, {"pad_w", pad_w}, {"stride_h", stride_h}, {"stride_w", stride_w}, {"dilation_h", dilation_h}, {"dilation_w", dilation_w}, {"im_offset", im_offset}, {"im_stride", im_stride}, {"col_offset", col_offset}, {"col_stride", col_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xim2colStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoIm2colStridedBatched(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                   Buffer<T>(im_buffer), im_offset, im_stride,
+                                   Buffer<T>(col_buffer), col_offset, col_stride,
+                                   batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Im2colStridedBatched<float>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                           const CUdeviceptr, const size_t, const size_t,
+                                                           CUdeviceptr, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Im2colStridedBatched<double>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                            const CUdeviceptr, const size_t, const size_t,
+                                                            CUdeviceptr, const size_t, const size_t,
+                                                            const size_t,
+                                                            const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Im2colStridedBatched<float2>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                            const CUdeviceptr, const size_t, const size_t,
+                                                            CUdeviceptr, const size_t, const size_t,
+                                                            const size_t,
+                                                            const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Im2colStridedBatched<double2>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                             const CUdeviceptr, const size_t, const size_t,
+                                                             CUdeviceptr, const size_t, const size_t,
+                                                             const size_t,
+                                                             const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Im2colStridedBatched<half>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t,
+                                                          CUdeviceptr, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+
+// StridedBatched version of COL2IM: SCOL2IMSTRIDEDBATCHED/DCOL2IMSTRIDEDBATCHED/CCOL2IMSTRIDEDBATCHED/ZCOL2IMSTRIDEDBATCHED/HCOL2IMSTRIDEDBATCHED
+template <typename T>
+StatusCode Col2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w,
+                                const CUdeviceptr col_buffer, const size_t col_offset, const size_t col_stride,
+                                CUdeviceptr im_buffer, const size_t im_offset, const size_t im_stride,
+                                const size_t batch_count,
+                                const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("COL2IMSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"channels", channels}, {"height", height}, {"width", width}, {"kernel_h", kernel_h}, {"kernel_w", kernel_w}, {"pad_h", pad_h}, {"pad_w", pad_w}, {"stride_h", stride_h}, {"stride_w", stride_w}, {"dilation_h", dilation_h}, {"dilation_w", dilation_w}, {"col_offset", col_offset}, {"col_stride", col_stride}, {"im_offset", im_offset}, {"im_stride", im_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xcol2imStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoCol2imStridedBatched(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                   Buffer<T>(col_buffer), col_offset, col_stride,
+                                   Buffer<T>(im_buffer), im_offset, im_stride,
+                                   batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Col2imStridedBatched<float>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                           const CUdeviceptr, const size_t, const size_t,
+                                                           CUdeviceptr, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Col2imStridedBatched<double>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                            const CUdeviceptr, const size_t, const size_t,
+                                                            CUdeviceptr, const size_t, const size_t,
+                                                            const size_t,
+                                                            const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Col2imStridedBatched<float2>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                            const CUdeviceptr, const size_t, const size_t,
+                                                            CUdeviceptr, const size_t, const size_t,
+                                                            const size_t,
+                                                            const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Col2imStridedBatched<double2>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                             const CUdeviceptr, const size_t, const size_t,
+                                                             CUdeviceptr, const size_t, const size_t,
+                                                             const size_t,
+                                                             const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Col2imStridedBatched<half>(const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t,
+                                                          CUdeviceptr, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+
+// StridedBatched version of AXPY: SAXPYSTRIDEDBATCHED/DAXPYSTRIDEDBATCHED/CAXPYSTRIDEDBATCHED/ZAXPYSTRIDEDBATCHED/HAXPYSTRIDEDBATCHED
+template <typename T>
+StatusCode AxpyStridedBatched(const size_t n,
+                              const T alpha,
+                              const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("AXPYSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"y_stride", y_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XaxpyStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoAxpyStridedBatched(n,
+                                 alpha,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AxpyStridedBatched<float>(const size_t,
+                                                         const float,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpyStridedBatched<double>(const size_t,
+                                                          const double,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpyStridedBatched<float2>(const size_t,
+                                                          const float2,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpyStridedBatched<double2>(const size_t,
+                                                           const double2,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpyStridedBatched<half>(const size_t,
+                                                        const half,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        const CUcontext, const CUdevice);
+
+// StridedBatched version of AXPBY: SAXPBYSTRIDEDBATCHED/DAXPBYSTRIDEDBATCHED/CAXPBYSTRIDEDBATCHED/ZAXPBYSTRIDEDBATCHED/HAXPBYSTRIDEDBATCHED
+template <typename T>
+StatusCode AxpbyStridedBatched(const size_t n,
+                               const T alpha,
+                               const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                               const T beta,
+                               CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                               const size_t batch_count,
+                               const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("AXPBYSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"y_stride", y_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XaxpbyStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoAxpbyStridedBatched(n,
+                                  alpha,
+                                  Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                  beta,
+                                  Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                                  batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AxpbyStridedBatched<float>(const size_t,
+                                                          const float,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const float,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpbyStridedBatched<double>(const size_t,
+                                                           const double,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const double,
+                                                           CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpbyStridedBatched<float2>(const size_t,
+                                                           const float2,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const float2,
+                                                           CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpbyStridedBatched<double2>(const size_t,
+                                                            const double2,
+                                                            const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                            const double2,
+                                                            CUdeviceptr, const size_t, const size_t, const size_t,
+                                                            const size_t,
+                                                            const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpbyStridedBatched<half>(const size_t,
+                                                         const half,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const half,
+                                                         CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+
+// StridedBatched version of SET: SSETSTRIDEDBATCHED/DSETSTRIDEDBATCHED/CSETSTRIDEDBATCHED/ZSETSTRIDEDBATCHED/HSETSTRIDEDBATCHED
+template <typename T>
+StatusCode SetStridedBatched(const size_t n,
+                             const T alpha,
+                             CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                             const size_t batch_count,
+                             const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SETSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XsetStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoSetStridedBatched(n,
+                                alpha,
+                                Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API SetStridedBatched<float>(const size_t,
+                                                        const float,
+                                                        CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SetStridedBatched<double>(const size_t,
+                                                         const double,
+                                                         CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SetStridedBatched<float2>(const size_t,
+                                                         const float2,
+                                                         CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SetStridedBatched<double2>(const size_t,
+                                                          const double2,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SetStridedBatched<half>(const size_t,
+                                                       const half,
+                                                       CUdeviceptr, const size_t, const size_t, const size_t,
+                                                       const size_t,
+                                                       const CUcontext, const CUdevice);
+
+// StridedBatched version of SCAL: SSCALSTRIDEDBATCHED/DSCALSTRIDEDBATCHED/CSCALSTRIDEDBATCHED/ZSCALSTRIDEDBATCHED/HSCALSTRIDEDBATCHED
+template <typename T>
+StatusCode ScalStridedBatched(const size_t n,
+                              const T alpha,
+                              CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("SCALSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XscalStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoScalStridedBatched(n,
+                                 alpha,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API ScalStridedBatched<float>(const size_t,
+                                                         const float,
+                                                         CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API ScalStridedBatched<double>(const size_t,
+                                                          const double,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API ScalStridedBatched<float2>(const size_t,
+                                                          const float2,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API ScalStridedBatched<double2>(const size_t,
+                                                           const double2,
+                                                           CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API ScalStridedBatched<half>(const size_t,
+                                                        const half,
+                                                        CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        const CUcontext, const CUdevice);
+
+// StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+template <typename T>
+StatusCode DotStridedBatched(const size_t n,
+                             CUdeviceptr dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                             const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                             const CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                             const size_t batch_count,
+                             const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("DOTSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"y_offset", y_offset}, {"y_inc", y_inc}, {"y_stride", y_stride}, {"dot_offset", dot_offset}, {"dot_stride", dot_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XdotStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoDotStridedBatched(n,
+                                Buffer<T>(dot_buffer), dot_offset, dot_stride,
+                                Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                                batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API DotStridedBatched<float>(const size_t,
+                                                        CUdeviceptr, const size_t, const size_t,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API DotStridedBatched<double>(const size_t,
+                                                         CUdeviceptr, const size_t, const size_t,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API DotStridedBatched<half>(const size_t,
+                                                       CUdeviceptr, const size_t, const size_t,
+                                                       const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                       const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                       const size_t,
+                                                       const CUcontext, const CUdevice);
+
+// StridedBatched version of NRM2: SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+template <typename T>
+StatusCode Nrm2StridedBatched(const size_t n,
+                              CUdeviceptr nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                              const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("NRM2STRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"nrm2_offset", nrm2_offset}, {"nrm2_stride", nrm2_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xnrm2StridedBatched<T>(queue_cpp, nullptr);
+    routine.DoNrm2StridedBatched(n,
+                                 Buffer<T>(nrm2_buffer), nrm2_offset, nrm2_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Nrm2StridedBatched<float>(const size_t,
+                                                         CUdeviceptr, const size_t, const size_t,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Nrm2StridedBatched<double>(const size_t,
+                                                          CUdeviceptr, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Nrm2StridedBatched<float2>(const size_t,
+                                                          CUdeviceptr, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Nrm2StridedBatched<double2>(const size_t,
+                                                           CUdeviceptr, const size_t, const size_t,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Nrm2StridedBatched<half>(const size_t,
+                                                        CUdeviceptr, const size_t, const size_t,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        const CUcontext, const CUdevice);
+
+// StridedBatched version of ASUM: SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+template <typename T>
+StatusCode AsumStridedBatched(const size_t n,
+                              CUdeviceptr asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                              const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device) {
+  try {
+    if (CallRecorder::IsEnabled()) {
+      CallRecorder::Instance().Record("ASUMSTRIDEDBATCHED", static_cast<int>(PrecisionValue<T>()),
+                                      {{"n", n}, {"x_offset", x_offset}, {"x_inc", x_inc}, {"x_stride", x_stride}, {"asum_offset", asum_offset}, {"asum_stride", asum_stride}, {"batch_count", batch_count}});
+    }
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XasumStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoAsumStridedBatched(n,
+                                 Buffer<T>(asum_buffer), asum_offset, asum_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AsumStridedBatched<float>(const size_t,
+                                                         CUdeviceptr, const size_t, const size_t,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AsumStridedBatched<double>(const size_t,
+                                                          CUdeviceptr, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AsumStridedBatched<float2>(const size_t,
+                                                          CUdeviceptr, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AsumStridedBatched<double2>(const size_t,
+                                                           CUdeviceptr, const size_t, const size_t,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AsumStridedBatched<half>(const size_t,
+                                                        CUdeviceptr, const size_t, const size_t,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        const CUcontext, const CUdevice);
+
+// =================================================================================================
+
+// Retrieves the required size of the temporary buffer for the GEMM kernel (optional)
+template <typename T>
+StatusCode GemmTempBufferSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t m, const size_t n, const size_t k,
+                              const size_t a_offset, const size_t a_ld,
+                              const size_t b_offset, const size_t b_ld,
+                              const size_t c_offset, const size_t c_ld,
+                              const CUdevice device, size_t& temp_buffer_size) {
+  try {
+
+    // Retrieves the tuning database
+    const auto device_cpp = Device(device);
+    const auto kernel_names = std::vector<std::string>{"Xgemm", "GemmRoutine"};
+    Databases db(kernel_names);
+    Routine::InitDatabase(device_cpp, kernel_names, PrecisionValue<T>(), {}, db);
+    db.SelectSize(Xgemm<T>::GetProblemSize(m, n, k));
+
+    // Computes the buffer size
+    if (Xgemm<T>::UseDirectKernel(layout, a_transpose, b_transpose, m, n, k,
+                                  a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
+                                  db.GetFlatParameters())) {
+      temp_buffer_size = 0;
+    }
+    else {
+      temp_buffer_size = Xgemm<T>::GetTempSize(layout, a_transpose, b_transpose, m, n, k,
+                                               a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
+                                               db["MWG"], db["NWG"], db["KWG"] * db["KREG"],
+                                               db["GEMMK"]);
+    }
+    temp_buffer_size *= sizeof(T); // translate from num-elements to bytes
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmTempBufferSize<float>(const Layout, const Transpose, const Transpose,
+                                                         const size_t, const size_t, const size_t,
+                                                         const size_t, const size_t, const size_t, const size_t,
+                                                         const size_t, const size_t, const CUdevice, size_t&);
+template StatusCode PUBLIC_API GemmTempBufferSize<double>(const Layout, const Transpose, const Transpose,
+                                                          const size_t, const size_t, const size_t,
+                                                          const size_t, const size_t, const size_t, const size_t,
+                                                          const size_t, const size_t, const CUdevice, size_t&);
+template StatusCode PUBLIC_API GemmTempBufferSize<float2>(const Layout, const Transpose, const Transpose,
+                                                          const size_t, const size_t, const size_t,
+                                                          const size_t, const size_t, const size_t, const size_t,
+                                                          const size_t, const size_t, const CUdevice, size_t&);
+template StatusCode PUBLIC_API GemmTempBufferSize<double2>(const Layout, const Transpose, const Transpose,
+                                                           const size_t, const size_t, const size_t,
+                                                           const size_t, const size_t, const size_t, const size_t,
+                                                           const size_t, const size_t, const CUdevice, size_t&);
+template StatusCode PUBLIC_API GemmTempBufferSize<half>(const Layout, const Transpose, const Transpose,
+                                                        const size_t, const size_t, const size_t,
+                                                        const size_t, const size_t, const size_t, const size_t,
                                                         const size_t, const size_t, const CUdevice, size_t&);
 
+// =================================================================================================
+
+// Capture and replay of command graphs
+StatusCode GraphBeginCapture(const CUcontext context, const CUdevice device) {
+  try {
+    CommandGraph::BeginCapture(Queue(Context(context), Device(device)));
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode GraphEndCapture(const CUcontext context, const CUdevice device, CommandGraph** graph) {
+  try {
+    const auto queue_cpp = Queue(Context(context), Device(device)); // uses the capture stream
+    *graph = CommandGraph::EndCapture(queue_cpp);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode GraphLaunch(CommandGraph* graph, const CUcontext context, const CUdevice device) {
+  try {
+    graph->Launch(Queue(Context(context), Device(device)), nullptr);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode GraphDestroy(CommandGraph* graph) {
+  try {
+    delete graph;
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// Priorities of the streams
+StatusCode SetStreamPriority(const int priority) {
+  try {
+    Queue::SetPriority(priority);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// Statistics of the internal activity
+StatusCode GetStatistics(Statistics &statistics) {
+  try {
+    CollectStatistics(statistics);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+StatusCode ResetStatistics() {
+  try {
+    ResetAllStatistics();
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
 // =================================================================================================
 } // namespace clblast
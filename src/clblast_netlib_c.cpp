@@ -11,24 +11,404 @@
 // copies automatically and running on the default OpenCL platform and device. For full control over
 // performance, it is advised to use the regular clblast.h or clblast_c.h headers instead.
 //
+// The OpenCL context and queue are created once per platform/device pair and are kept alive for
+// the lifetime of the process. Device buffers are taken from the memory pool of the library. On
+// devices that share memory with the host (CL_DEVICE_HOST_UNIFIED_MEMORY, e.g. integrated GPUs and
+// CPUs), the user's host arrays are used directly as backing storage of the device buffers
+// (CL_MEM_USE_HOST_PTR) if they are suitably aligned, avoiding the copies: results are synchronised
+// by mapping and unmapping instead. The 'CLBLAST_NETLIB_USE_HOST_PTR' environmental variable
+// overrides this: 1 uses the host arrays on all devices, 0 never does.
+//
+// Small problems can be run on the host instead: if 'CLBLAST_NETLIB_HOST_LIBRARY' points to a regular
+// CPU CBLAS library (e.g. libopenblas.so), calls that touch at most 'CLBLAST_NETLIB_HOST_THRESHOLD'
+// bytes (default 64KB) are forwarded to the corresponding routine of that library.
+//
+// In asynchronous mode (see 'clblast_netlib_set_async') the routines return as soon as all work is
+// enqueued: the results are only guaranteed to be in the user's arrays after 'clblast_netlib_sync'.
+// Routines returning a scalar value (e.g. cblas_sdot) always complete before returning.
+//
+// With the residency cache enabled (see 'clblast_netlib_set_residency') the device copies of the
+// host arrays are kept alive between calls, such that repeatedly used arrays are uploaded only once.
+//
 // =================================================================================================
 
 #include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "clblast_netlib_c.h"
 #include "clblast.h"
 #include "utilities/utilities.hpp"
+#include "memory_pool.hpp"
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <dlfcn.h>
+#endif
 
 // Shortcuts to the clblast namespace
 using float2 = clblast::float2;
 using double2 = clblast::double2;
+using CLCudaAPIError = clblast::CLCudaAPIError;
+
+// The queues (and with it the contexts) per platform/device pair
+std::map<std::pair<size_t, size_t>, clblast::Queue> queues;
+std::mutex queues_mutex;
 
-// Helper function to get a default OpenCL platform and device
-clblast::Device get_device() {
+// Whether or not routines may return before their results are copied back to the host
+std::atomic<bool> async_mode{false};
+
+// Helper function to get the queue on the default OpenCL platform and device. The queue is created
+// on first use and re-used by all later calls.
+clblast::Queue get_queue() {
   auto platform_id = clblast::ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0});
   auto device_id = clblast::ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0});
-  auto platform = clblast::Platform(platform_id);
-  return clblast::Device(platform, device_id);
+  std::lock_guard<std::mutex> lock(queues_mutex);
+  const auto key = std::make_pair(platform_id, device_id);
+  auto it = queues.find(key);
+  if (it == queues.end()) {
+    auto platform = clblast::Platform(platform_id);
+    auto device = clblast::Device(platform, device_id);
+    auto context = clblast::Context(device);
+    it = queues.emplace(key, clblast::Queue(context, device)).first;
+  }
+  return it->second;
+}
+
+// Enables or disables the asynchronous mode, disabling implies a synchronisation
+void clblast_netlib_set_async(const int enabled) {
+  if (!enabled) { clblast_netlib_sync(); }
+  async_mode = (enabled != 0);
+}
+
+// Waits for all outstanding work of the asynchronous mode to complete
+void clblast_netlib_sync() {
+  std::lock_guard<std::mutex> lock(queues_mutex);
+  for (const auto &queue : queues) {
+    queue.second.Finish();
+  }
+}
+
+// Whether or not to use the host arrays as backing storage of the device buffers: never (0), always
+// (1), or automatically on devices with unified memory (default)
+size_t host_ptr_mode() {
+  static const auto mode = clblast::ConvertArgument(std::getenv("CLBLAST_NETLIB_USE_HOST_PTR"), size_t{2});
+  return mode;
+}
+
+// The required alignment of host arrays for zero-copy buffers per device, or 0 if the device does
+// not share its memory with the host. Queried on first use.
+std::map<cl_device_id, size_t> zero_copy_alignments;
+std::mutex zero_copy_alignments_mutex;
+
+size_t get_zero_copy_alignment(const clblast::Queue &queue) {
+  const auto device = queue.GetDevice();
+  std::lock_guard<std::mutex> lock(zero_copy_alignments_mutex);
+  auto it = zero_copy_alignments.find(device());
+  if (it == zero_copy_alignments.end()) {
+    const auto alignment = (device.HasUnifiedMemory()) ? std::max(device.MemoryBaseAlignment(), size_t{1}) : 0;
+    it = zero_copy_alignments.emplace(device(), alignment).first;
+  }
+  return it->second;
+}
+
+template <typename T>
+bool use_host_ptr(const clblast::Queue &queue, const T* host) {
+  if (host_ptr_mode() != 2) { return host_ptr_mode() == 1; }
+  const auto alignment = get_zero_copy_alignment(queue);
+  return alignment != 0 && reinterpret_cast<std::uintptr_t>(host) % alignment == 0;
+}
+
+// Copies of at least this many bytes are staged through pinned memory (0 disables staging)
+size_t staging_threshold() {
+  static const auto threshold = clblast::ConvertArgument(std::getenv("CLBLAST_NETLIB_STAGING_THRESHOLD"), size_t{1024*1024});
+  return threshold;
+}
+bool use_staging(const size_t bytes) {
+  return staging_threshold() != 0 && bytes >= staging_threshold();
+}
+
+// The pools of pinned staging memory per context, created on first use
+std::map<cl_context, clblast::StagingPool> staging_pools;
+std::mutex staging_pools_mutex;
+
+clblast::StagingPool get_staging_pool(const clblast::Queue &queue) {
+  const auto context = queue.GetContext();
+  std::lock_guard<std::mutex> lock(staging_pools_mutex);
+  auto it = staging_pools.find(context());
+  if (it == staging_pools.end()) {
+    it = staging_pools.emplace(context(), clblast::StagingPool(context, queue)).first;
+  }
+  return it->second;
+}
+
+// Wraps an OpenCL buffer created by this file, such that it is released when no longer used
+std::shared_ptr<cl_mem> wrap_buffer(const cl_mem buffer) {
+  return std::shared_ptr<cl_mem>(new cl_mem{buffer}, [](cl_mem* m) {
+    CheckErrorDtor(clReleaseMemObject(*m));
+    delete m;
+  });
+}
+
+// =================================================================================================
+
+// The residency cache: device copies of host arrays, keyed by the context, the host pointer, and
+// the size in bytes. A copy is valid as long as it is known to match the host array, i.e. after
+// uploading the array or after copying results back to it. The library can't see modifications of
+// the arrays by the application itself: the application invalidates the copies instead (see
+// 'clblast_netlib_invalidate'), which is why the cache is disabled by default. Arrays smaller than
+// a page are always copied, since they are cheap to transfer and might be local variables. The
+// least-recently used copies are released once the total exceeds 'CLBLAST_NETLIB_RESIDENCY_LIMIT'
+// bytes (default: a quarter of the device memory).
+struct ResidentCopy {
+  cl_context context;
+  const char* host;
+  size_t bytes;
+  std::shared_ptr<cl_mem> buffer;
+  bool valid;
+  size_t last_use;
+};
+std::vector<ResidentCopy> resident_copies;
+std::mutex resident_copies_mutex;
+size_t resident_copies_clock = 0;
+std::atomic<bool> residency_mode{clblast::ConvertArgument(std::getenv("CLBLAST_NETLIB_RESIDENCY"), size_t{0}) == 1};
+constexpr auto kMinResidentBytes = size_t{4096};
+
+size_t residency_limit(const clblast::Queue &queue) {
+  static const auto limit = clblast::ConvertArgument(std::getenv("CLBLAST_NETLIB_RESIDENCY_LIMIT"), size_t{0});
+  return (limit != 0) ? limit : static_cast<size_t>(queue.GetDevice().MemorySize()) / 4;
+}
+
+// Retrieves the device copy of a host array, creating it if needed. Returns a null-pointer if the
+// array doesn't qualify for the cache. The copy is shared, such that releasing it from the cache
+// doesn't affect calls still using it.
+std::shared_ptr<cl_mem> get_resident_copy(const clblast::Context &context,
+                                          const clblast::Queue &queue,
+                                          const void* host, const size_t bytes) {
+  const auto host_bytes = static_cast<const char*>(host);
+  if (!residency_mode || bytes < kMinResidentBytes || bytes > residency_limit(queue)) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(resident_copies_mutex);
+  resident_copies_clock++;
+  for (auto &copy : resident_copies) {
+    if (copy.context == context() && copy.host == host_bytes && copy.bytes == bytes) {
+      copy.last_use = resident_copies_clock;
+      return copy.buffer;
+    }
+  }
+
+  // Makes room by releasing the least-recently used copies
+  auto total_bytes = bytes;
+  for (const auto &copy : resident_copies) { total_bytes += copy.bytes; }
+  while (total_bytes > residency_limit(queue)) {
+    auto lru = std::min_element(resident_copies.begin(), resident_copies.end(),
+                                [](const ResidentCopy &a, const ResidentCopy &b) {
+                                  return a.last_use < b.last_use;
+                                });
+    total_bytes -= lru->bytes;
+    resident_copies.erase(lru);
+  }
+
+  // Creates the new (not yet valid) copy
+  auto status = CL_SUCCESS;
+  auto buffer = clCreateBuffer(context(), CL_MEM_READ_WRITE, bytes, nullptr, &status);
+  CLCudaAPIError::Check(status, "clCreateBuffer");
+  resident_copies.push_back({context(), host_bytes, bytes, wrap_buffer(buffer), false,
+                             resident_copies_clock});
+  return resident_copies.back().buffer;
+}
+
+// Whether the buffer is a device copy which matches its host array, i.e. need not be uploaded
+bool is_valid_resident_copy(const cl_mem buffer) {
+  if (!residency_mode) { return false; }
+  std::lock_guard<std::mutex> lock(resident_copies_mutex);
+  for (const auto &copy : resident_copies) {
+    if (*copy.buffer == buffer) { return copy.valid; }
+  }
+  return false;
+}
+
+// Marks the device copy as matching its host array (if the buffer is one)
+void validate_resident_copy(const cl_mem buffer) {
+  if (!residency_mode) { return; }
+  std::lock_guard<std::mutex> lock(resident_copies_mutex);
+  for (auto &copy : resident_copies) {
+    if (*copy.buffer == buffer) { copy.valid = true; }
+  }
+}
+
+// Marks all device copies overlapping a range of host memory as outdated, except for the given one
+void invalidate_resident_copies(const void* host, const size_t bytes,
+                                const cl_mem except = nullptr) {
+  if (!residency_mode) { return; }
+  const auto begin = static_cast<const char*>(host);
+  const auto end = begin + bytes;
+  std::lock_guard<std::mutex> lock(resident_copies_mutex);
+  for (auto &copy : resident_copies) {
+    const auto overlaps = copy.host < end && begin < copy.host + copy.bytes;
+    if (overlaps && *copy.buffer != except) { copy.valid = false; }
+  }
+}
+
+// Enables or disables the residency cache, disabling releases all device copies
+void clblast_netlib_set_residency(const int enabled) {
+  residency_mode = (enabled != 0);
+  if (!enabled) {
+    std::lock_guard<std::mutex> lock(resident_copies_mutex);
+    resident_copies.clear();
+  }
+}
+
+// Marks the device copies of (part of) a host array as outdated, e.g. after modifying the array
+void clblast_netlib_invalidate(const void* host, const size_t bytes) {
+  invalidate_resident_copies(host, bytes);
+}
+void clblast_netlib_invalidate_all() {
+  std::lock_guard<std::mutex> lock(resident_copies_mutex);
+  for (auto &copy : resident_copies) { copy.valid = false; }
+}
+
+// =================================================================================================
+
+// Creates a buffer from the memory pool, e.g. for scalar results without a host array
+template <typename T>
+clblast::Buffer<T> create_buffer(const clblast::Context &context, const clblast::Queue &queue,
+                                 const size_t size) {
+  return clblast::TemporaryBuffer<T>(context, queue, size);
+}
+
+// Creates a buffer for a host array: either one backed by the host array itself, its device copy of
+// the residency cache, or one from the pool
+template <typename T>
+clblast::Buffer<T> create_buffer(const clblast::Context &context, const clblast::Queue &queue,
+                                 const T* host, const size_t size) {
+  if (size == 0) { return create_buffer<T>(context, queue, size); }
+  if (!use_host_ptr(queue, host)) {
+    auto resident_copy = get_resident_copy(context, queue, host, size * sizeof(T));
+    if (resident_copy) { return clblast::Buffer<T>(resident_copy); }
+    return create_buffer<T>(context, queue, size);
+  }
+  auto status = CL_SUCCESS;
+  auto buffer = clCreateBuffer(context(), CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, size * sizeof(T),
+                               const_cast<T*>(host), &status);
+  CLCudaAPIError::Check(status, "clCreateBuffer");
+  return clblast::Buffer<T>(wrap_buffer(buffer));
+}
+
+// Returns whether the buffer is backed by the given host array (see above)
+template <typename T>
+bool is_host_backed(const clblast::Buffer<T> &buffer, const T* host) {
+  if (host_ptr_mode() == 0 || buffer() == nullptr) { return false; }
+  auto host_ptr = static_cast<void*>(nullptr);
+  CheckError(clGetMemObjectInfo(buffer(), CL_MEM_HOST_PTR, sizeof(void*), &host_ptr, nullptr));
+  return host_ptr == static_cast<const void*>(host);
+}
+
+// Copies a host array to the device, nothing has to be done for host-backed buffers and for valid
+// device copies of the residency cache. The copy is non-blocking: the queue is in-order and the host
+// array is kept alive until the final read. Large copies are staged through pinned memory to reach
+// the full transfer bandwidth.
+template <typename T>
+void write_buffer(clblast::Queue &queue, clblast::Buffer<T> &buffer, const size_t size, const T* host) {
+  if (is_host_backed(buffer, host)) { return; }
+  if (is_valid_resident_copy(buffer())) { return; }
+  if (use_staging(size * sizeof(T))) {
+    auto pool = get_staging_pool(queue);
+    buffer.WriteStagedAsync(queue, size, host, pool);
+  }
+  else {
+    buffer.WriteAsync(queue, size, host);
+  }
+  validate_resident_copy(buffer());
+}
+
+// Copies device data back to a host array. For host-backed buffers the data is synchronised by
+// mapping and unmapping the buffer. The copy is blocking unless the asynchronous mode is enabled
+// and the routine allows it (the host array is not a local variable). Large blocking copies are
+// staged through pinned memory. Other device copies of the (now modified) host array are outdated.
+template <typename T>
+void read_buffer(clblast::Queue &queue, const clblast::Buffer<T> &buffer, const size_t size, T* host,
+                 const bool may_be_async = true) {
+  const auto blocking = !(may_be_async && async_mode);
+  invalidate_resident_copies(host, size * sizeof(T), buffer());
+  if (!is_host_backed(buffer, static_cast<const T*>(host))) {
+    if (blocking && use_staging(size * sizeof(T))) {
+      auto pool = get_staging_pool(queue);
+      buffer.ReadStaged(queue, size, host, pool);
+    }
+    else {
+      buffer.ReadAsync(queue, size, host);
+    }
+  }
+  else {
+    auto status = CL_SUCCESS;
+    auto mapped = clEnqueueMapBuffer(queue(), buffer(), CL_FALSE, CL_MAP_READ, 0, size * sizeof(T),
+                                     0, nullptr, nullptr, &status);
+    CLCudaAPIError::Check(status, "clEnqueueMapBuffer");
+    CheckError(clEnqueueUnmapMemObject(queue(), buffer(), mapped, 0, nullptr, nullptr));
+  }
+  if (blocking) { queue.Finish(); }
+}
+
+// =================================================================================================
+
+// Statistics on where the calls were executed
+std::atomic<size_t> num_device_calls{0};
+std::atomic<size_t> num_host_calls{0};
+
+void record_device_call() { num_device_calls++; }
+
+// Retrieves a routine from the CPU BLAS library, or a null-pointer if there is no such library
+void* get_host_symbol(const char* name) {
+  static const auto library = []() -> void* {
+    const auto path = std::getenv("CLBLAST_NETLIB_HOST_LIBRARY");
+    if (path == nullptr) { return nullptr; }
+    #ifdef _WIN32
+      return reinterpret_cast<void*>(LoadLibraryA(path));
+    #else
+      return dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    #endif
+  }();
+  if (library == nullptr) { return nullptr; }
+  #ifdef _WIN32
+    return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(library), name));
+  #else
+    return dlsym(library, name);
+  #endif
+}
+template <typename F>
+F get_host_routine(const char* name) {
+  return reinterpret_cast<F>(get_host_symbol(name));
+}
+
+// Decides whether or not to run a call on the host, based on the amount of data it touches
+bool run_on_host(const bool host_routine_available, const size_t bytes) {
+  static const auto threshold = clblast::ConvertArgument(std::getenv("CLBLAST_NETLIB_HOST_THRESHOLD"), size_t{64*1024});
+  if (host_routine_available && bytes <= threshold) {
+    if (async_mode) { clblast_netlib_sync(); } // the host arrays might still be in use by the device
+    num_host_calls++;
+    return true;
+  }
+  record_device_call();
+  return false;
+}
+
+// Exposes the statistics
+void clblast_netlib_get_call_counts(size_t* device_calls, size_t* host_calls) {
+  if (device_calls != nullptr) { *device_calls = num_device_calls; }
+  if (host_calls != nullptr) { *host_calls = num_host_calls; }
+}
+void clblast_netlib_reset_call_counts() {
+  num_device_calls = 0;
+  num_host_calls = 0;
 }
 
 // =================================================================================================
@@ -40,21 +420,28 @@ void cblas_srotg(float* sa,
                  float* sb,
                  float* sc,
                  float* ss) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto sa_size = 1;
   const auto sb_size = 1;
   const auto sc_size = 1;
   const auto ss_size = 1;
-  auto sa_buffer = clblast::Buffer<float>(context, sa_size);
-  auto sb_buffer = clblast::Buffer<float>(context, sb_size);
-  auto sc_buffer = clblast::Buffer<float>(context, sc_size);
-  auto ss_buffer = clblast::Buffer<float>(context, ss_size);
-  sa_buffer.Write(queue, sa_size, reinterpret_cast<float*>(sa));
-  sb_buffer.Write(queue, sb_size, reinterpret_cast<float*>(sb));
-  sc_buffer.Write(queue, sc_size, reinterpret_cast<float*>(sc));
-  ss_buffer.Write(queue, ss_size, reinterpret_cast<float*>(ss));
+  static const auto host_routine = get_host_routine<decltype(&cblas_srotg)>("cblas_srotg");
+  if (run_on_host(host_routine != nullptr, sa_size * sizeof(float) + sb_size * sizeof(float) + sc_size * sizeof(float) + ss_size * sizeof(float))) {
+    invalidate_resident_copies(sa, sa_size * sizeof(float));
+    invalidate_resident_copies(sb, sb_size * sizeof(float));
+    invalidate_resident_copies(sc, sc_size * sizeof(float));
+    invalidate_resident_copies(ss, ss_size * sizeof(float));
+    return host_routine(sa, sb, sc, ss);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto sa_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(sa), sa_size);
+  auto sb_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(sb), sb_size);
+  auto sc_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(sc), sc_size);
+  auto ss_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(ss), ss_size);
+  write_buffer(queue, sa_buffer, sa_size, reinterpret_cast<float*>(sa));
+  write_buffer(queue, sb_buffer, sb_size, reinterpret_cast<float*>(sb));
+  write_buffer(queue, sc_buffer, sc_size, reinterpret_cast<float*>(sc));
+  write_buffer(queue, ss_buffer, ss_size, reinterpret_cast<float*>(ss));
   auto queue_cl = queue();
   auto s = clblast::Rotg<float>(sa_buffer(), 0,
                                 sb_buffer(), 0,
@@ -64,30 +451,37 @@ void cblas_srotg(float* sa,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  sa_buffer.Read(queue, sa_size, reinterpret_cast<float*>(sa));
-  sb_buffer.Read(queue, sb_size, reinterpret_cast<float*>(sb));
-  sc_buffer.Read(queue, sc_size, reinterpret_cast<float*>(sc));
-  ss_buffer.Read(queue, ss_size, reinterpret_cast<float*>(ss));
+  read_buffer(queue, sa_buffer, sa_size, reinterpret_cast<float*>(sa));
+  read_buffer(queue, sb_buffer, sb_size, reinterpret_cast<float*>(sb));
+  read_buffer(queue, sc_buffer, sc_size, reinterpret_cast<float*>(sc));
+  read_buffer(queue, ss_buffer, ss_size, reinterpret_cast<float*>(ss));
 }
 void cblas_drotg(double* sa,
                  double* sb,
                  double* sc,
                  double* ss) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto sa_size = 1;
   const auto sb_size = 1;
   const auto sc_size = 1;
   const auto ss_size = 1;
-  auto sa_buffer = clblast::Buffer<double>(context, sa_size);
-  auto sb_buffer = clblast::Buffer<double>(context, sb_size);
-  auto sc_buffer = clblast::Buffer<double>(context, sc_size);
-  auto ss_buffer = clblast::Buffer<double>(context, ss_size);
-  sa_buffer.Write(queue, sa_size, reinterpret_cast<double*>(sa));
-  sb_buffer.Write(queue, sb_size, reinterpret_cast<double*>(sb));
-  sc_buffer.Write(queue, sc_size, reinterpret_cast<double*>(sc));
-  ss_buffer.Write(queue, ss_size, reinterpret_cast<double*>(ss));
+  static const auto host_routine = get_host_routine<decltype(&cblas_drotg)>("cblas_drotg");
+  if (run_on_host(host_routine != nullptr, sa_size * sizeof(double) + sb_size * sizeof(double) + sc_size * sizeof(double) + ss_size * sizeof(double))) {
+    invalidate_resident_copies(sa, sa_size * sizeof(double));
+    invalidate_resident_copies(sb, sb_size * sizeof(double));
+    invalidate_resident_copies(sc, sc_size * sizeof(double));
+    invalidate_resident_copies(ss, ss_size * sizeof(double));
+    return host_routine(sa, sb, sc, ss);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto sa_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(sa), sa_size);
+  auto sb_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(sb), sb_size);
+  auto sc_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(sc), sc_size);
+  auto ss_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(ss), ss_size);
+  write_buffer(queue, sa_buffer, sa_size, reinterpret_cast<double*>(sa));
+  write_buffer(queue, sb_buffer, sb_size, reinterpret_cast<double*>(sb));
+  write_buffer(queue, sc_buffer, sc_size, reinterpret_cast<double*>(sc));
+  write_buffer(queue, ss_buffer, ss_size, reinterpret_cast<double*>(ss));
   auto queue_cl = queue();
   auto s = clblast::Rotg<double>(sa_buffer(), 0,
                                  sb_buffer(), 0,
@@ -97,10 +491,10 @@ void cblas_drotg(double* sa,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  sa_buffer.Read(queue, sa_size, reinterpret_cast<double*>(sa));
-  sb_buffer.Read(queue, sb_size, reinterpret_cast<double*>(sb));
-  sc_buffer.Read(queue, sc_size, reinterpret_cast<double*>(sc));
-  ss_buffer.Read(queue, ss_size, reinterpret_cast<double*>(ss));
+  read_buffer(queue, sa_buffer, sa_size, reinterpret_cast<double*>(sa));
+  read_buffer(queue, sb_buffer, sb_size, reinterpret_cast<double*>(sb));
+  read_buffer(queue, sc_buffer, sc_size, reinterpret_cast<double*>(sc));
+  read_buffer(queue, ss_buffer, ss_size, reinterpret_cast<double*>(ss));
 }
 
 // ROTMG
@@ -109,25 +503,32 @@ void cblas_srotmg(float* sd1,
                   float* sx1,
                   const float sy1,
                   float* sparam) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto sy1_size = 1;
   const auto sd1_size = 1;
   const auto sd2_size = 1;
   const auto sx1_size = 1;
   const auto sparam_size = 1;
-  auto sy1_buffer = clblast::Buffer<float>(context, sy1_size);
+  static const auto host_routine = get_host_routine<decltype(&cblas_srotmg)>("cblas_srotmg");
+  if (run_on_host(host_routine != nullptr, sy1_size * sizeof(float) + sd1_size * sizeof(float) + sd2_size * sizeof(float) + sx1_size * sizeof(float) + sparam_size * sizeof(float))) {
+    invalidate_resident_copies(sd1, sd1_size * sizeof(float));
+    invalidate_resident_copies(sd2, sd2_size * sizeof(float));
+    invalidate_resident_copies(sx1, sx1_size * sizeof(float));
+    invalidate_resident_copies(sparam, sparam_size * sizeof(float));
+    return host_routine(sd1, sd2, sx1, sy1, sparam);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
   float sy1_vec[1]; sy1_vec[0] = sy1;
-  auto sd1_buffer = clblast::Buffer<float>(context, sd1_size);
-  auto sd2_buffer = clblast::Buffer<float>(context, sd2_size);
-  auto sx1_buffer = clblast::Buffer<float>(context, sx1_size);
-  auto sparam_buffer = clblast::Buffer<float>(context, sparam_size);
-  sy1_buffer.Write(queue, sy1_size, reinterpret_cast<const float*>(sy1_vec));
-  sd1_buffer.Write(queue, sd1_size, reinterpret_cast<float*>(sd1));
-  sd2_buffer.Write(queue, sd2_size, reinterpret_cast<float*>(sd2));
-  sx1_buffer.Write(queue, sx1_size, reinterpret_cast<float*>(sx1));
-  sparam_buffer.Write(queue, sparam_size, reinterpret_cast<float*>(sparam));
+  auto sy1_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(sy1_vec), sy1_size);
+  auto sd1_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(sd1), sd1_size);
+  auto sd2_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(sd2), sd2_size);
+  auto sx1_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(sx1), sx1_size);
+  auto sparam_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(sparam), sparam_size);
+  write_buffer(queue, sy1_buffer, sy1_size, reinterpret_cast<const float*>(sy1_vec));
+  write_buffer(queue, sd1_buffer, sd1_size, reinterpret_cast<float*>(sd1));
+  write_buffer(queue, sd2_buffer, sd2_size, reinterpret_cast<float*>(sd2));
+  write_buffer(queue, sx1_buffer, sx1_size, reinterpret_cast<float*>(sx1));
+  write_buffer(queue, sparam_buffer, sparam_size, reinterpret_cast<float*>(sparam));
   auto queue_cl = queue();
   auto s = clblast::Rotmg<float>(sd1_buffer(), 0,
                                  sd2_buffer(), 0,
@@ -138,35 +539,42 @@ void cblas_srotmg(float* sd1,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  sd1_buffer.Read(queue, sd1_size, reinterpret_cast<float*>(sd1));
-  sd2_buffer.Read(queue, sd2_size, reinterpret_cast<float*>(sd2));
-  sx1_buffer.Read(queue, sx1_size, reinterpret_cast<float*>(sx1));
-  sparam_buffer.Read(queue, sparam_size, reinterpret_cast<float*>(sparam));
+  read_buffer(queue, sd1_buffer, sd1_size, reinterpret_cast<float*>(sd1), false);
+  read_buffer(queue, sd2_buffer, sd2_size, reinterpret_cast<float*>(sd2), false);
+  read_buffer(queue, sx1_buffer, sx1_size, reinterpret_cast<float*>(sx1), false);
+  read_buffer(queue, sparam_buffer, sparam_size, reinterpret_cast<float*>(sparam), false);
 }
 void cblas_drotmg(double* sd1,
                   double* sd2,
                   double* sx1,
                   const double sy1,
                   double* sparam) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto sy1_size = 1;
   const auto sd1_size = 1;
   const auto sd2_size = 1;
   const auto sx1_size = 1;
   const auto sparam_size = 1;
-  auto sy1_buffer = clblast::Buffer<double>(context, sy1_size);
+  static const auto host_routine = get_host_routine<decltype(&cblas_drotmg)>("cblas_drotmg");
+  if (run_on_host(host_routine != nullptr, sy1_size * sizeof(double) + sd1_size * sizeof(double) + sd2_size * sizeof(double) + sx1_size * sizeof(double) + sparam_size * sizeof(double))) {
+    invalidate_resident_copies(sd1, sd1_size * sizeof(double));
+    invalidate_resident_copies(sd2, sd2_size * sizeof(double));
+    invalidate_resident_copies(sx1, sx1_size * sizeof(double));
+    invalidate_resident_copies(sparam, sparam_size * sizeof(double));
+    return host_routine(sd1, sd2, sx1, sy1, sparam);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
   double sy1_vec[1]; sy1_vec[0] = sy1;
-  auto sd1_buffer = clblast::Buffer<double>(context, sd1_size);
-  auto sd2_buffer = clblast::Buffer<double>(context, sd2_size);
-  auto sx1_buffer = clblast::Buffer<double>(context, sx1_size);
-  auto sparam_buffer = clblast::Buffer<double>(context, sparam_size);
-  sy1_buffer.Write(queue, sy1_size, reinterpret_cast<const double*>(sy1_vec));
-  sd1_buffer.Write(queue, sd1_size, reinterpret_cast<double*>(sd1));
-  sd2_buffer.Write(queue, sd2_size, reinterpret_cast<double*>(sd2));
-  sx1_buffer.Write(queue, sx1_size, reinterpret_cast<double*>(sx1));
-  sparam_buffer.Write(queue, sparam_size, reinterpret_cast<double*>(sparam));
+  auto sy1_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(sy1_vec), sy1_size);
+  auto sd1_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(sd1), sd1_size);
+  auto sd2_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(sd2), sd2_size);
+  auto sx1_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(sx1), sx1_size);
+  auto sparam_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(sparam), sparam_size);
+  write_buffer(queue, sy1_buffer, sy1_size, reinterpret_cast<const double*>(sy1_vec));
+  write_buffer(queue, sd1_buffer, sd1_size, reinterpret_cast<double*>(sd1));
+  write_buffer(queue, sd2_buffer, sd2_size, reinterpret_cast<double*>(sd2));
+  write_buffer(queue, sx1_buffer, sx1_size, reinterpret_cast<double*>(sx1));
+  write_buffer(queue, sparam_buffer, sparam_size, reinterpret_cast<double*>(sparam));
   auto queue_cl = queue();
   auto s = clblast::Rotmg<double>(sd1_buffer(), 0,
                                   sd2_buffer(), 0,
@@ -177,10 +585,10 @@ void cblas_drotmg(double* sd1,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  sd1_buffer.Read(queue, sd1_size, reinterpret_cast<double*>(sd1));
-  sd2_buffer.Read(queue, sd2_size, reinterpret_cast<double*>(sd2));
-  sx1_buffer.Read(queue, sx1_size, reinterpret_cast<double*>(sx1));
-  sparam_buffer.Read(queue, sparam_size, reinterpret_cast<double*>(sparam));
+  read_buffer(queue, sd1_buffer, sd1_size, reinterpret_cast<double*>(sd1), false);
+  read_buffer(queue, sd2_buffer, sd2_size, reinterpret_cast<double*>(sd2), false);
+  read_buffer(queue, sx1_buffer, sx1_size, reinterpret_cast<double*>(sx1), false);
+  read_buffer(queue, sparam_buffer, sparam_size, reinterpret_cast<double*>(sparam), false);
 }
 
 // ROT
@@ -189,15 +597,20 @@ void cblas_srot(const int n,
                 float* y, const int y_inc,
                 const float cos,
                 const float sin) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_srot)>("cblas_srot");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float) + y_size * sizeof(float))) {
+    invalidate_resident_copies(x, x_size * sizeof(float));
+    invalidate_resident_copies(y, y_size * sizeof(float));
+    return host_routine(n, x, x_inc, y, y_inc, cos, sin);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
   auto queue_cl = queue();
   auto s = clblast::Rot(n,
                         x_buffer(), 0, x_inc,
@@ -208,23 +621,28 @@ void cblas_srot(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float*>(x));
-  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
 }
 void cblas_drot(const int n,
                 double* x, const int x_inc,
                 double* y, const int y_inc,
                 const double cos,
                 const double sin) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_drot)>("cblas_drot");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double) + y_size * sizeof(double))) {
+    invalidate_resident_copies(x, x_size * sizeof(double));
+    invalidate_resident_copies(y, y_size * sizeof(double));
+    return host_routine(n, x, x_inc, y, y_inc, cos, sin);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
   auto queue_cl = queue();
   auto s = clblast::Rot(n,
                         x_buffer(), 0, x_inc,
@@ -235,8 +653,8 @@ void cblas_drot(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double*>(x));
-  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
 }
 
 // ROTM
@@ -244,18 +662,24 @@ void cblas_srotm(const int n,
                  float* x, const int x_inc,
                  float* y, const int y_inc,
                  float* sparam) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto sparam_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  auto sparam_buffer = clblast::Buffer<float>(context, sparam_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
-  sparam_buffer.Write(queue, sparam_size, reinterpret_cast<float*>(sparam));
+  static const auto host_routine = get_host_routine<decltype(&cblas_srotm)>("cblas_srotm");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float) + y_size * sizeof(float) + sparam_size * sizeof(float))) {
+    invalidate_resident_copies(x, x_size * sizeof(float));
+    invalidate_resident_copies(y, y_size * sizeof(float));
+    invalidate_resident_copies(sparam, sparam_size * sizeof(float));
+    return host_routine(n, x, x_inc, y, y_inc, sparam);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  auto sparam_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(sparam), sparam_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
+  write_buffer(queue, sparam_buffer, sparam_size, reinterpret_cast<float*>(sparam));
   auto queue_cl = queue();
   auto s = clblast::Rotm<float>(n,
                                 x_buffer(), 0, x_inc,
@@ -265,26 +689,32 @@ void cblas_srotm(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float*>(x));
-  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
-  sparam_buffer.Read(queue, sparam_size, reinterpret_cast<float*>(sparam));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
+  read_buffer(queue, sparam_buffer, sparam_size, reinterpret_cast<float*>(sparam));
 }
 void cblas_drotm(const int n,
                  double* x, const int x_inc,
                  double* y, const int y_inc,
                  double* sparam) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto sparam_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  auto sparam_buffer = clblast::Buffer<double>(context, sparam_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
-  sparam_buffer.Write(queue, sparam_size, reinterpret_cast<double*>(sparam));
+  static const auto host_routine = get_host_routine<decltype(&cblas_drotm)>("cblas_drotm");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double) + y_size * sizeof(double) + sparam_size * sizeof(double))) {
+    invalidate_resident_copies(x, x_size * sizeof(double));
+    invalidate_resident_copies(y, y_size * sizeof(double));
+    invalidate_resident_copies(sparam, sparam_size * sizeof(double));
+    return host_routine(n, x, x_inc, y, y_inc, sparam);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  auto sparam_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(sparam), sparam_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
+  write_buffer(queue, sparam_buffer, sparam_size, reinterpret_cast<double*>(sparam));
   auto queue_cl = queue();
   auto s = clblast::Rotm<double>(n,
                                  x_buffer(), 0, x_inc,
@@ -294,24 +724,29 @@ void cblas_drotm(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double*>(x));
-  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
-  sparam_buffer.Read(queue, sparam_size, reinterpret_cast<double*>(sparam));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
+  read_buffer(queue, sparam_buffer, sparam_size, reinterpret_cast<double*>(sparam));
 }
 
 // SWAP
 void cblas_sswap(const int n,
                  float* x, const int x_inc,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_sswap)>("cblas_sswap");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float) + y_size * sizeof(float))) {
+    invalidate_resident_copies(x, x_size * sizeof(float));
+    invalidate_resident_copies(y, y_size * sizeof(float));
+    return host_routine(n, x, x_inc, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
   auto queue_cl = queue();
   auto s = clblast::Swap<float>(n,
                                 x_buffer(), 0, x_inc,
@@ -320,21 +755,26 @@ void cblas_sswap(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float*>(x));
-  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
 }
 void cblas_dswap(const int n,
                  double* x, const int x_inc,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dswap)>("cblas_dswap");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double) + y_size * sizeof(double))) {
+    invalidate_resident_copies(x, x_size * sizeof(double));
+    invalidate_resident_copies(y, y_size * sizeof(double));
+    return host_routine(n, x, x_inc, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
   auto queue_cl = queue();
   auto s = clblast::Swap<double>(n,
                                  x_buffer(), 0, x_inc,
@@ -343,21 +783,26 @@ void cblas_dswap(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double*>(x));
-  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
 }
 void cblas_cswap(const int n,
                  void* x, const int x_inc,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_cswap)>("cblas_cswap");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float2) + y_size * sizeof(float2))) {
+    invalidate_resident_copies(x, x_size * sizeof(float2));
+    invalidate_resident_copies(y, y_size * sizeof(float2));
+    return host_routine(n, x, x_inc, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Swap<float2>(n,
                                  x_buffer(), 0, x_inc,
@@ -366,21 +811,26 @@ void cblas_cswap(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float2*>(x));
-  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
 }
 void cblas_zswap(const int n,
                  void* x, const int x_inc,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zswap)>("cblas_zswap");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double2) + y_size * sizeof(double2))) {
+    invalidate_resident_copies(x, x_size * sizeof(double2));
+    invalidate_resident_copies(y, y_size * sizeof(double2));
+    return host_routine(n, x, x_inc, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Swap<double2>(n,
                                   x_buffer(), 0, x_inc,
@@ -389,21 +839,25 @@ void cblas_zswap(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double2*>(x));
-  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
 }
 
 // SCAL
 void cblas_sscal(const int n,
                  const float alpha,
                  float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_sscal)>("cblas_sscal");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float))) {
+    invalidate_resident_copies(x, x_size * sizeof(float));
+    return host_routine(n, alpha, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
   auto queue_cl = queue();
   auto s = clblast::Scal(n,
                          alpha_cpp,
@@ -412,18 +866,22 @@ void cblas_sscal(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
 }
 void cblas_dscal(const int n,
                  const double alpha,
                  double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dscal)>("cblas_dscal");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double))) {
+    invalidate_resident_copies(x, x_size * sizeof(double));
+    return host_routine(n, alpha, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
   auto queue_cl = queue();
   auto s = clblast::Scal(n,
                          alpha_cpp,
@@ -432,18 +890,22 @@ void cblas_dscal(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
 }
 void cblas_cscal(const int n,
                  const void* alpha,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto x_size = n * x_inc;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_cscal)>("cblas_cscal");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float2))) {
+    invalidate_resident_copies(x, x_size * sizeof(float2));
+    return host_routine(n, alpha, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Scal(n,
                          alpha_cpp,
@@ -452,18 +914,22 @@ void cblas_cscal(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float2*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
 }
 void cblas_zscal(const int n,
                  const void* alpha,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto x_size = n * x_inc;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zscal)>("cblas_zscal");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double2))) {
+    invalidate_resident_copies(x, x_size * sizeof(double2));
+    return host_routine(n, alpha, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Scal(n,
                          alpha_cpp,
@@ -472,22 +938,26 @@ void cblas_zscal(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double2*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
 }
 
 // COPY
 void cblas_scopy(const int n,
                  const float* x, const int x_inc,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_scopy)>("cblas_scopy");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float) + y_size * sizeof(float))) {
+    invalidate_resident_copies(y, y_size * sizeof(float));
+    return host_routine(n, x, x_inc, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
   auto queue_cl = queue();
   auto s = clblast::Copy<float>(n,
                                 x_buffer(), 0, x_inc,
@@ -496,20 +966,24 @@ void cblas_scopy(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
 }
 void cblas_dcopy(const int n,
                  const double* x, const int x_inc,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dcopy)>("cblas_dcopy");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double) + y_size * sizeof(double))) {
+    invalidate_resident_copies(y, y_size * sizeof(double));
+    return host_routine(n, x, x_inc, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
   auto queue_cl = queue();
   auto s = clblast::Copy<double>(n,
                                  x_buffer(), 0, x_inc,
@@ -518,20 +992,24 @@ void cblas_dcopy(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
 }
 void cblas_ccopy(const int n,
                  const void* x, const int x_inc,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ccopy)>("cblas_ccopy");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float2) + y_size * sizeof(float2))) {
+    invalidate_resident_copies(y, y_size * sizeof(float2));
+    return host_routine(n, x, x_inc, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Copy<float2>(n,
                                  x_buffer(), 0, x_inc,
@@ -540,20 +1018,24 @@ void cblas_ccopy(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
 }
 void cblas_zcopy(const int n,
                  const void* x, const int x_inc,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zcopy)>("cblas_zcopy");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double2) + y_size * sizeof(double2))) {
+    invalidate_resident_copies(y, y_size * sizeof(double2));
+    return host_routine(n, x, x_inc, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Copy<double2>(n,
                                   x_buffer(), 0, x_inc,
@@ -562,7 +1044,7 @@ void cblas_zcopy(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
 }
 
 // AXPY
@@ -570,16 +1052,20 @@ void cblas_saxpy(const int n,
                  const float alpha,
                  const float* x, const int x_inc,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_saxpy)>("cblas_saxpy");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float) + y_size * sizeof(float))) {
+    invalidate_resident_copies(y, y_size * sizeof(float));
+    return host_routine(n, alpha, x, x_inc, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
   auto queue_cl = queue();
   auto s = clblast::Axpy(n,
                          alpha_cpp,
@@ -589,22 +1075,26 @@ void cblas_saxpy(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
 }
 void cblas_daxpy(const int n,
                  const double alpha,
                  const double* x, const int x_inc,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_daxpy)>("cblas_daxpy");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double) + y_size * sizeof(double))) {
+    invalidate_resident_copies(y, y_size * sizeof(double));
+    return host_routine(n, alpha, x, x_inc, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
   auto queue_cl = queue();
   auto s = clblast::Axpy(n,
                          alpha_cpp,
@@ -614,22 +1104,26 @@ void cblas_daxpy(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
 }
 void cblas_caxpy(const int n,
                  const void* alpha,
                  const void* x, const int x_inc,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_caxpy)>("cblas_caxpy");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float2) + y_size * sizeof(float2))) {
+    invalidate_resident_copies(y, y_size * sizeof(float2));
+    return host_routine(n, alpha, x, x_inc, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Axpy(n,
                          alpha_cpp,
@@ -639,22 +1133,26 @@ void cblas_caxpy(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
 }
 void cblas_zaxpy(const int n,
                  const void* alpha,
                  const void* x, const int x_inc,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zaxpy)>("cblas_zaxpy");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double2) + y_size * sizeof(double2))) {
+    invalidate_resident_copies(y, y_size * sizeof(double2));
+    return host_routine(n, alpha, x, x_inc, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Axpy(n,
                          alpha_cpp,
@@ -664,24 +1162,27 @@ void cblas_zaxpy(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
 }
 
 // DOT
 float cblas_sdot(const int n,
                  const float* x, const int x_inc,
                  const float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto dot_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  auto dot_buffer = clblast::Buffer<float>(context, dot_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_sdot)>("cblas_sdot");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float) + y_size * sizeof(float) + dot_size * sizeof(float))) {
+    return host_routine(n, x, x_inc, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  auto dot_buffer = create_buffer<float>(context, queue, dot_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const float*>(y));
   auto queue_cl = queue();
   auto s = clblast::Dot<float>(n,
                                dot_buffer(), 0,
@@ -692,23 +1193,26 @@ float cblas_sdot(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   float dot[dot_size];
-  dot_buffer.Read(queue, dot_size, reinterpret_cast<float*>(dot));
+  read_buffer(queue, dot_buffer, dot_size, reinterpret_cast<float*>(dot), false);
   return dot[0];
 }
 double cblas_ddot(const int n,
                   const double* x, const int x_inc,
                   const double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto dot_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  auto dot_buffer = clblast::Buffer<double>(context, dot_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ddot)>("cblas_ddot");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double) + y_size * sizeof(double) + dot_size * sizeof(double))) {
+    return host_routine(n, x, x_inc, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  auto dot_buffer = create_buffer<double>(context, queue, dot_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const double*>(y));
   auto queue_cl = queue();
   auto s = clblast::Dot<double>(n,
                                 dot_buffer(), 0,
@@ -719,7 +1223,7 @@ double cblas_ddot(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   double dot[dot_size];
-  dot_buffer.Read(queue, dot_size, reinterpret_cast<double*>(dot));
+  read_buffer(queue, dot_buffer, dot_size, reinterpret_cast<double*>(dot), false);
   return dot[0];
 }
 
@@ -728,17 +1232,21 @@ void cblas_cdotu_sub(const int n,
                      const void* x, const int x_inc,
                      const void* y, const int y_inc,
                      void* dot) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto dot_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  auto dot_buffer = clblast::Buffer<float2>(context, dot_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_cdotu_sub)>("cblas_cdotu_sub");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float2) + y_size * sizeof(float2) + dot_size * sizeof(float2))) {
+    invalidate_resident_copies(dot, dot_size * sizeof(float2));
+    return host_routine(n, x, x_inc, y, y_inc, dot);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  auto dot_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(dot), dot_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const float2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Dotu<float2>(n,
                                  dot_buffer(), 0,
@@ -748,23 +1256,27 @@ void cblas_cdotu_sub(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  dot_buffer.Read(queue, dot_size, reinterpret_cast<float2*>(dot));
+  read_buffer(queue, dot_buffer, dot_size, reinterpret_cast<float2*>(dot));
 }
 void cblas_zdotu_sub(const int n,
                      const void* x, const int x_inc,
                      const void* y, const int y_inc,
                      void* dot) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto dot_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  auto dot_buffer = clblast::Buffer<double2>(context, dot_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zdotu_sub)>("cblas_zdotu_sub");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double2) + y_size * sizeof(double2) + dot_size * sizeof(double2))) {
+    invalidate_resident_copies(dot, dot_size * sizeof(double2));
+    return host_routine(n, x, x_inc, y, y_inc, dot);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  auto dot_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(dot), dot_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const double2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Dotu<double2>(n,
                                   dot_buffer(), 0,
@@ -774,7 +1286,7 @@ void cblas_zdotu_sub(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  dot_buffer.Read(queue, dot_size, reinterpret_cast<double2*>(dot));
+  read_buffer(queue, dot_buffer, dot_size, reinterpret_cast<double2*>(dot));
 }
 
 // DOTC
@@ -782,17 +1294,21 @@ void cblas_cdotc_sub(const int n,
                      const void* x, const int x_inc,
                      const void* y, const int y_inc,
                      void* dot) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto dot_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  auto dot_buffer = clblast::Buffer<float2>(context, dot_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_cdotc_sub)>("cblas_cdotc_sub");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float2) + y_size * sizeof(float2) + dot_size * sizeof(float2))) {
+    invalidate_resident_copies(dot, dot_size * sizeof(float2));
+    return host_routine(n, x, x_inc, y, y_inc, dot);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  auto dot_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(dot), dot_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const float2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Dotc<float2>(n,
                                  dot_buffer(), 0,
@@ -802,23 +1318,27 @@ void cblas_cdotc_sub(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  dot_buffer.Read(queue, dot_size, reinterpret_cast<float2*>(dot));
+  read_buffer(queue, dot_buffer, dot_size, reinterpret_cast<float2*>(dot));
 }
 void cblas_zdotc_sub(const int n,
                      const void* x, const int x_inc,
                      const void* y, const int y_inc,
                      void* dot) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto dot_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  auto dot_buffer = clblast::Buffer<double2>(context, dot_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zdotc_sub)>("cblas_zdotc_sub");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double2) + y_size * sizeof(double2) + dot_size * sizeof(double2))) {
+    invalidate_resident_copies(dot, dot_size * sizeof(double2));
+    return host_routine(n, x, x_inc, y, y_inc, dot);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  auto dot_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(dot), dot_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const double2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Dotc<double2>(n,
                                   dot_buffer(), 0,
@@ -828,20 +1348,23 @@ void cblas_zdotc_sub(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  dot_buffer.Read(queue, dot_size, reinterpret_cast<double2*>(dot));
+  read_buffer(queue, dot_buffer, dot_size, reinterpret_cast<double2*>(dot));
 }
 
 // NRM2
 float cblas_snrm2(const int n,
                   const float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto nrm2_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto nrm2_buffer = clblast::Buffer<float>(context, nrm2_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_snrm2)>("cblas_snrm2");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float) + nrm2_size * sizeof(float))) {
+    return host_routine(n, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto nrm2_buffer = create_buffer<float>(context, queue, nrm2_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
   auto queue_cl = queue();
   auto s = clblast::Nrm2<float>(n,
                                 nrm2_buffer(), 0,
@@ -851,19 +1374,22 @@ float cblas_snrm2(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   float nrm2[nrm2_size];
-  nrm2_buffer.Read(queue, nrm2_size, reinterpret_cast<float*>(nrm2));
+  read_buffer(queue, nrm2_buffer, nrm2_size, reinterpret_cast<float*>(nrm2), false);
   return nrm2[0];
 }
 double cblas_dnrm2(const int n,
                    const double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto nrm2_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto nrm2_buffer = clblast::Buffer<double>(context, nrm2_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dnrm2)>("cblas_dnrm2");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double) + nrm2_size * sizeof(double))) {
+    return host_routine(n, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto nrm2_buffer = create_buffer<double>(context, queue, nrm2_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
   auto queue_cl = queue();
   auto s = clblast::Nrm2<double>(n,
                                  nrm2_buffer(), 0,
@@ -873,19 +1399,22 @@ double cblas_dnrm2(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   double nrm2[nrm2_size];
-  nrm2_buffer.Read(queue, nrm2_size, reinterpret_cast<double*>(nrm2));
+  read_buffer(queue, nrm2_buffer, nrm2_size, reinterpret_cast<double*>(nrm2), false);
   return nrm2[0];
 }
 float cblas_scnrm2(const int n,
                   const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto nrm2_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto nrm2_buffer = clblast::Buffer<float2>(context, nrm2_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_scnrm2)>("cblas_scnrm2");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float2) + nrm2_size * sizeof(float2))) {
+    return host_routine(n, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto nrm2_buffer = create_buffer<float2>(context, queue, nrm2_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Nrm2<float2>(n,
                                  nrm2_buffer(), 0,
@@ -895,19 +1424,22 @@ float cblas_scnrm2(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   float2 nrm2[nrm2_size];
-  nrm2_buffer.Read(queue, nrm2_size, reinterpret_cast<float2*>(nrm2));
+  read_buffer(queue, nrm2_buffer, nrm2_size, reinterpret_cast<float2*>(nrm2), false);
   return nrm2[0].real();
 }
 double cblas_dznrm2(const int n,
                    const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto nrm2_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto nrm2_buffer = clblast::Buffer<double2>(context, nrm2_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dznrm2)>("cblas_dznrm2");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double2) + nrm2_size * sizeof(double2))) {
+    return host_routine(n, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto nrm2_buffer = create_buffer<double2>(context, queue, nrm2_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Nrm2<double2>(n,
                                   nrm2_buffer(), 0,
@@ -917,21 +1449,24 @@ double cblas_dznrm2(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   double2 nrm2[nrm2_size];
-  nrm2_buffer.Read(queue, nrm2_size, reinterpret_cast<double2*>(nrm2));
+  read_buffer(queue, nrm2_buffer, nrm2_size, reinterpret_cast<double2*>(nrm2), false);
   return nrm2[0].real();
 }
 
 // ASUM
 float cblas_sasum(const int n,
                   const float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto asum_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto asum_buffer = clblast::Buffer<float>(context, asum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_sasum)>("cblas_sasum");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float) + asum_size * sizeof(float))) {
+    return host_routine(n, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto asum_buffer = create_buffer<float>(context, queue, asum_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
   auto queue_cl = queue();
   auto s = clblast::Asum<float>(n,
                                 asum_buffer(), 0,
@@ -941,19 +1476,22 @@ float cblas_sasum(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   float asum[asum_size];
-  asum_buffer.Read(queue, asum_size, reinterpret_cast<float*>(asum));
+  read_buffer(queue, asum_buffer, asum_size, reinterpret_cast<float*>(asum), false);
   return asum[0];
 }
 double cblas_dasum(const int n,
                    const double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto asum_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto asum_buffer = clblast::Buffer<double>(context, asum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dasum)>("cblas_dasum");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double) + asum_size * sizeof(double))) {
+    return host_routine(n, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto asum_buffer = create_buffer<double>(context, queue, asum_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
   auto queue_cl = queue();
   auto s = clblast::Asum<double>(n,
                                  asum_buffer(), 0,
@@ -963,19 +1501,22 @@ double cblas_dasum(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   double asum[asum_size];
-  asum_buffer.Read(queue, asum_size, reinterpret_cast<double*>(asum));
+  read_buffer(queue, asum_buffer, asum_size, reinterpret_cast<double*>(asum), false);
   return asum[0];
 }
 float cblas_scasum(const int n,
                   const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto asum_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto asum_buffer = clblast::Buffer<float2>(context, asum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_scasum)>("cblas_scasum");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float2) + asum_size * sizeof(float2))) {
+    return host_routine(n, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto asum_buffer = create_buffer<float2>(context, queue, asum_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Asum<float2>(n,
                                  asum_buffer(), 0,
@@ -985,19 +1526,22 @@ float cblas_scasum(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   float2 asum[asum_size];
-  asum_buffer.Read(queue, asum_size, reinterpret_cast<float2*>(asum));
+  read_buffer(queue, asum_buffer, asum_size, reinterpret_cast<float2*>(asum), false);
   return asum[0].real();
 }
 double cblas_dzasum(const int n,
                    const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto asum_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto asum_buffer = clblast::Buffer<double2>(context, asum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dzasum)>("cblas_dzasum");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double2) + asum_size * sizeof(double2))) {
+    return host_routine(n, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto asum_buffer = create_buffer<double2>(context, queue, asum_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Asum<double2>(n,
                                   asum_buffer(), 0,
@@ -1007,21 +1551,21 @@ double cblas_dzasum(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   double2 asum[asum_size];
-  asum_buffer.Read(queue, asum_size, reinterpret_cast<double2*>(asum));
+  read_buffer(queue, asum_buffer, asum_size, reinterpret_cast<double2*>(asum), false);
   return asum[0].real();
 }
 
 // SUM
 float cblas_ssum(const int n,
                  const float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto sum_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto sum_buffer = clblast::Buffer<float>(context, sum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto sum_buffer = create_buffer<float>(context, queue, sum_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
   auto queue_cl = queue();
   auto s = clblast::Sum<float>(n,
                                sum_buffer(), 0,
@@ -1031,19 +1575,19 @@ float cblas_ssum(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   float sum[sum_size];
-  sum_buffer.Read(queue, sum_size, reinterpret_cast<float*>(sum));
+  read_buffer(queue, sum_buffer, sum_size, reinterpret_cast<float*>(sum), false);
   return sum[0];
 }
 double cblas_dsum(const int n,
                   const double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto sum_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto sum_buffer = clblast::Buffer<double>(context, sum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto sum_buffer = create_buffer<double>(context, queue, sum_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
   auto queue_cl = queue();
   auto s = clblast::Sum<double>(n,
                                 sum_buffer(), 0,
@@ -1053,19 +1597,19 @@ double cblas_dsum(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   double sum[sum_size];
-  sum_buffer.Read(queue, sum_size, reinterpret_cast<double*>(sum));
+  read_buffer(queue, sum_buffer, sum_size, reinterpret_cast<double*>(sum), false);
   return sum[0];
 }
 float cblas_scsum(const int n,
                  const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto sum_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto sum_buffer = clblast::Buffer<float2>(context, sum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto sum_buffer = create_buffer<float2>(context, queue, sum_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Sum<float2>(n,
                                 sum_buffer(), 0,
@@ -1075,19 +1619,19 @@ float cblas_scsum(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   float2 sum[sum_size];
-  sum_buffer.Read(queue, sum_size, reinterpret_cast<float2*>(sum));
+  read_buffer(queue, sum_buffer, sum_size, reinterpret_cast<float2*>(sum), false);
   return sum[0].real();
 }
 double cblas_dzsum(const int n,
                   const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto sum_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto sum_buffer = clblast::Buffer<double2>(context, sum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto sum_buffer = create_buffer<double2>(context, queue, sum_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Sum<double2>(n,
                                  sum_buffer(), 0,
@@ -1097,21 +1641,21 @@ double cblas_dzsum(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   double2 sum[sum_size];
-  sum_buffer.Read(queue, sum_size, reinterpret_cast<double2*>(sum));
+  read_buffer(queue, sum_buffer, sum_size, reinterpret_cast<double2*>(sum), false);
   return sum[0].real();
 }
 
 // AMAX
 int cblas_isamax(const int n,
                 const float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto imax_buffer = create_buffer<int>(context, queue, imax_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
   auto queue_cl = queue();
   auto s = clblast::Amax<float>(n,
                                 imax_buffer(), 0,
@@ -1121,19 +1665,19 @@ int cblas_isamax(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imax[imax_size];
-  imax_buffer.Read(queue, imax_size, reinterpret_cast<int*>(imax));
+  read_buffer(queue, imax_buffer, imax_size, reinterpret_cast<int*>(imax), false);
   return imax[0];
 }
 int cblas_idamax(const int n,
                 const double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto imax_buffer = create_buffer<int>(context, queue, imax_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
   auto queue_cl = queue();
   auto s = clblast::Amax<double>(n,
                                  imax_buffer(), 0,
@@ -1143,19 +1687,19 @@ int cblas_idamax(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imax[imax_size];
-  imax_buffer.Read(queue, imax_size, reinterpret_cast<int*>(imax));
+  read_buffer(queue, imax_buffer, imax_size, reinterpret_cast<int*>(imax), false);
   return imax[0];
 }
 int cblas_icamax(const int n,
                 const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto imax_buffer = create_buffer<int>(context, queue, imax_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Amax<float2>(n,
                                  imax_buffer(), 0,
@@ -1165,19 +1709,19 @@ int cblas_icamax(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imax[imax_size];
-  imax_buffer.Read(queue, imax_size, reinterpret_cast<int*>(imax));
+  read_buffer(queue, imax_buffer, imax_size, reinterpret_cast<int*>(imax), false);
   return imax[0];
 }
 int cblas_izamax(const int n,
                 const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto imax_buffer = create_buffer<int>(context, queue, imax_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Amax<double2>(n,
                                   imax_buffer(), 0,
@@ -1187,21 +1731,21 @@ int cblas_izamax(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imax[imax_size];
-  imax_buffer.Read(queue, imax_size, reinterpret_cast<int*>(imax));
+  read_buffer(queue, imax_buffer, imax_size, reinterpret_cast<int*>(imax), false);
   return imax[0];
 }
 
 // AMIN
 int cblas_isamin(const int n,
                 const float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto imin_buffer = create_buffer<int>(context, queue, imin_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
   auto queue_cl = queue();
   auto s = clblast::Amin<float>(n,
                                 imin_buffer(), 0,
@@ -1211,19 +1755,19 @@ int cblas_isamin(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imin[imin_size];
-  imin_buffer.Read(queue, imin_size, reinterpret_cast<int*>(imin));
+  read_buffer(queue, imin_buffer, imin_size, reinterpret_cast<int*>(imin), false);
   return imin[0];
 }
 int cblas_idamin(const int n,
                 const double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto imin_buffer = create_buffer<int>(context, queue, imin_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
   auto queue_cl = queue();
   auto s = clblast::Amin<double>(n,
                                  imin_buffer(), 0,
@@ -1233,19 +1777,19 @@ int cblas_idamin(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imin[imin_size];
-  imin_buffer.Read(queue, imin_size, reinterpret_cast<int*>(imin));
+  read_buffer(queue, imin_buffer, imin_size, reinterpret_cast<int*>(imin), false);
   return imin[0];
 }
 int cblas_icamin(const int n,
                 const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto imin_buffer = create_buffer<int>(context, queue, imin_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Amin<float2>(n,
                                  imin_buffer(), 0,
@@ -1255,19 +1799,19 @@ int cblas_icamin(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imin[imin_size];
-  imin_buffer.Read(queue, imin_size, reinterpret_cast<int*>(imin));
+  read_buffer(queue, imin_buffer, imin_size, reinterpret_cast<int*>(imin), false);
   return imin[0];
 }
 int cblas_izamin(const int n,
                 const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto imin_buffer = create_buffer<int>(context, queue, imin_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Amin<double2>(n,
                                   imin_buffer(), 0,
@@ -1277,21 +1821,21 @@ int cblas_izamin(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imin[imin_size];
-  imin_buffer.Read(queue, imin_size, reinterpret_cast<int*>(imin));
+  read_buffer(queue, imin_buffer, imin_size, reinterpret_cast<int*>(imin), false);
   return imin[0];
 }
 
 // MAX
 int cblas_ismax(const int n,
                const float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto imax_buffer = create_buffer<int>(context, queue, imax_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
   auto queue_cl = queue();
   auto s = clblast::Max<float>(n,
                                imax_buffer(), 0,
@@ -1301,19 +1845,19 @@ int cblas_ismax(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imax[imax_size];
-  imax_buffer.Read(queue, imax_size, reinterpret_cast<int*>(imax));
+  read_buffer(queue, imax_buffer, imax_size, reinterpret_cast<int*>(imax), false);
   return imax[0];
 }
 int cblas_idmax(const int n,
                const double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto imax_buffer = create_buffer<int>(context, queue, imax_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
   auto queue_cl = queue();
   auto s = clblast::Max<double>(n,
                                 imax_buffer(), 0,
@@ -1323,19 +1867,19 @@ int cblas_idmax(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imax[imax_size];
-  imax_buffer.Read(queue, imax_size, reinterpret_cast<int*>(imax));
+  read_buffer(queue, imax_buffer, imax_size, reinterpret_cast<int*>(imax), false);
   return imax[0];
 }
 int cblas_icmax(const int n,
                const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto imax_buffer = create_buffer<int>(context, queue, imax_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Max<float2>(n,
                                 imax_buffer(), 0,
@@ -1345,19 +1889,19 @@ int cblas_icmax(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imax[imax_size];
-  imax_buffer.Read(queue, imax_size, reinterpret_cast<int*>(imax));
+  read_buffer(queue, imax_buffer, imax_size, reinterpret_cast<int*>(imax), false);
   return imax[0];
 }
 int cblas_izmax(const int n,
                const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto imax_buffer = create_buffer<int>(context, queue, imax_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Max<double2>(n,
                                  imax_buffer(), 0,
@@ -1367,21 +1911,21 @@ int cblas_izmax(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imax[imax_size];
-  imax_buffer.Read(queue, imax_size, reinterpret_cast<int*>(imax));
+  read_buffer(queue, imax_buffer, imax_size, reinterpret_cast<int*>(imax), false);
   return imax[0];
 }
 
 // MIN
 int cblas_ismin(const int n,
                const float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto imin_buffer = create_buffer<int>(context, queue, imin_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
   auto queue_cl = queue();
   auto s = clblast::Min<float>(n,
                                imin_buffer(), 0,
@@ -1391,19 +1935,19 @@ int cblas_ismin(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imin[imin_size];
-  imin_buffer.Read(queue, imin_size, reinterpret_cast<int*>(imin));
+  read_buffer(queue, imin_buffer, imin_size, reinterpret_cast<int*>(imin), false);
   return imin[0];
 }
 int cblas_idmin(const int n,
                const double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto imin_buffer = create_buffer<int>(context, queue, imin_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
   auto queue_cl = queue();
   auto s = clblast::Min<double>(n,
                                 imin_buffer(), 0,
@@ -1413,19 +1957,19 @@ int cblas_idmin(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imin[imin_size];
-  imin_buffer.Read(queue, imin_size, reinterpret_cast<int*>(imin));
+  read_buffer(queue, imin_buffer, imin_size, reinterpret_cast<int*>(imin), false);
   return imin[0];
 }
 int cblas_icmin(const int n,
                const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto imin_buffer = create_buffer<int>(context, queue, imin_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Min<float2>(n,
                                 imin_buffer(), 0,
@@ -1435,19 +1979,19 @@ int cblas_icmin(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imin[imin_size];
-  imin_buffer.Read(queue, imin_size, reinterpret_cast<int*>(imin));
+  read_buffer(queue, imin_buffer, imin_size, reinterpret_cast<int*>(imin), false);
   return imin[0];
 }
 int cblas_izmin(const int n,
                const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto imin_buffer = create_buffer<int>(context, queue, imin_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Min<double2>(n,
                                  imin_buffer(), 0,
@@ -1457,7 +2001,7 @@ int cblas_izmin(const int n,
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
   int imin[imin_size];
-  imin_buffer.Read(queue, imin_size, reinterpret_cast<int*>(imin));
+  read_buffer(queue, imin_buffer, imin_size, reinterpret_cast<int*>(imin), false);
   return imin[0];
 }
 
@@ -1473,20 +2017,24 @@ void cblas_sgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const float* x, const int x_inc,
                  const float beta,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_sgemv)>("cblas_sgemv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float) + x_size * sizeof(float) + y_size * sizeof(float))) {
+    invalidate_resident_copies(y, y_size * sizeof(float));
+    return host_routine(layout, a_transpose, m, n, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
   auto queue_cl = queue();
   auto s = clblast::Gemv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1500,7 +2048,7 @@ void cblas_sgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
 }
 void cblas_dgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const int m, const int n,
@@ -1509,20 +2057,24 @@ void cblas_dgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const double* x, const int x_inc,
                  const double beta,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dgemv)>("cblas_dgemv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double) + x_size * sizeof(double) + y_size * sizeof(double))) {
+    invalidate_resident_copies(y, y_size * sizeof(double));
+    return host_routine(layout, a_transpose, m, n, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
   auto queue_cl = queue();
   auto s = clblast::Gemv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1536,7 +2088,7 @@ void cblas_dgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
 }
 void cblas_cgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const int m, const int n,
@@ -1545,20 +2097,24 @@ void cblas_cgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
-  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_cgemv)>("cblas_cgemv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + x_size * sizeof(float2) + y_size * sizeof(float2))) {
+    invalidate_resident_copies(y, y_size * sizeof(float2));
+    return host_routine(layout, a_transpose, m, n, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Gemv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1572,7 +2128,7 @@ void cblas_cgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
 }
 void cblas_zgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const int m, const int n,
@@ -1581,20 +2137,24 @@ void cblas_zgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
-  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zgemv)>("cblas_zgemv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + x_size * sizeof(double2) + y_size * sizeof(double2))) {
+    invalidate_resident_copies(y, y_size * sizeof(double2));
+    return host_routine(layout, a_transpose, m, n, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Gemv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1608,7 +2168,7 @@ void cblas_zgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
 }
 
 // GBMV
@@ -1619,20 +2179,24 @@ void cblas_sgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const float* x, const int x_inc,
                  const float beta,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_sgbmv)>("cblas_sgbmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float) + x_size * sizeof(float) + y_size * sizeof(float))) {
+    invalidate_resident_copies(y, y_size * sizeof(float));
+    return host_routine(layout, a_transpose, m, n, kl, ku, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
   auto queue_cl = queue();
   auto s = clblast::Gbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1646,7 +2210,7 @@ void cblas_sgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
 }
 void cblas_dgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const int m, const int n, const int kl, const int ku,
@@ -1655,20 +2219,24 @@ void cblas_dgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const double* x, const int x_inc,
                  const double beta,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dgbmv)>("cblas_dgbmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double) + x_size * sizeof(double) + y_size * sizeof(double))) {
+    invalidate_resident_copies(y, y_size * sizeof(double));
+    return host_routine(layout, a_transpose, m, n, kl, ku, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
   auto queue_cl = queue();
   auto s = clblast::Gbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1682,7 +2250,7 @@ void cblas_dgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
 }
 void cblas_cgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const int m, const int n, const int kl, const int ku,
@@ -1691,20 +2259,24 @@ void cblas_cgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
-  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_cgbmv)>("cblas_cgbmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + x_size * sizeof(float2) + y_size * sizeof(float2))) {
+    invalidate_resident_copies(y, y_size * sizeof(float2));
+    return host_routine(layout, a_transpose, m, n, kl, ku, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Gbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1718,7 +2290,7 @@ void cblas_cgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
 }
 void cblas_zgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const int m, const int n, const int kl, const int ku,
@@ -1727,20 +2299,24 @@ void cblas_zgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
-  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zgbmv)>("cblas_zgbmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + x_size * sizeof(double2) + y_size * sizeof(double2))) {
+    invalidate_resident_copies(y, y_size * sizeof(double2));
+    return host_routine(layout, a_transpose, m, n, kl, ku, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Gbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1754,7 +2330,7 @@ void cblas_zgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
 }
 
 // HEMV
@@ -1765,20 +2341,24 @@ void cblas_chemv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
-  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_chemv)>("cblas_chemv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + x_size * sizeof(float2) + y_size * sizeof(float2))) {
+    invalidate_resident_copies(y, y_size * sizeof(float2));
+    return host_routine(layout, triangle, n, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Hemv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -1792,7 +2372,7 @@ void cblas_chemv(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
 }
 void cblas_zhemv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const int n,
@@ -1801,20 +2381,24 @@ void cblas_zhemv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
-  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zhemv)>("cblas_zhemv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + x_size * sizeof(double2) + y_size * sizeof(double2))) {
+    invalidate_resident_copies(y, y_size * sizeof(double2));
+    return host_routine(layout, triangle, n, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Hemv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -1828,7 +2412,7 @@ void cblas_zhemv(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
 }
 
 // HBMV
@@ -1839,20 +2423,24 @@ void cblas_chbmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
-  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_chbmv)>("cblas_chbmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + x_size * sizeof(float2) + y_size * sizeof(float2))) {
+    invalidate_resident_copies(y, y_size * sizeof(float2));
+    return host_routine(layout, triangle, n, k, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Hbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -1866,7 +2454,7 @@ void cblas_chbmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
 }
 void cblas_zhbmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const int n, const int k,
@@ -1875,20 +2463,24 @@ void cblas_zhbmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
-  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zhbmv)>("cblas_zhbmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + x_size * sizeof(double2) + y_size * sizeof(double2))) {
+    invalidate_resident_copies(y, y_size * sizeof(double2));
+    return host_routine(layout, triangle, n, k, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Hbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -1902,7 +2494,7 @@ void cblas_zhbmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
 }
 
 // HPMV
@@ -1913,20 +2505,24 @@ void cblas_chpmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
-  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto ap_buffer = clblast::Buffer<float2>(context, ap_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const float2*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_chpmv)>("cblas_chpmv");
+  if (run_on_host(host_routine != nullptr, ap_size * sizeof(float2) + x_size * sizeof(float2) + y_size * sizeof(float2))) {
+    invalidate_resident_copies(y, y_size * sizeof(float2));
+    return host_routine(layout, triangle, n, alpha, ap, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  auto ap_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(ap), ap_size);
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<const float2*>(ap));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Hpmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -1940,7 +2536,7 @@ void cblas_chpmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
 }
 void cblas_zhpmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const int n,
@@ -1949,20 +2545,24 @@ void cblas_zhpmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
-  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto ap_buffer = clblast::Buffer<double2>(context, ap_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const double2*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zhpmv)>("cblas_zhpmv");
+  if (run_on_host(host_routine != nullptr, ap_size * sizeof(double2) + x_size * sizeof(double2) + y_size * sizeof(double2))) {
+    invalidate_resident_copies(y, y_size * sizeof(double2));
+    return host_routine(layout, triangle, n, alpha, ap, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  auto ap_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(ap), ap_size);
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<const double2*>(ap));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
   auto queue_cl = queue();
   auto s = clblast::Hpmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -1976,7 +2576,7 @@ void cblas_zhpmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
 }
 
 // SYMV
@@ -1987,20 +2587,24 @@ void cblas_ssymv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const float* x, const int x_inc,
                  const float beta,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ssymv)>("cblas_ssymv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float) + x_size * sizeof(float) + y_size * sizeof(float))) {
+    invalidate_resident_copies(y, y_size * sizeof(float));
+    return host_routine(layout, triangle, n, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
   auto queue_cl = queue();
   auto s = clblast::Symv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -2014,7 +2618,7 @@ void cblas_ssymv(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
 }
 void cblas_dsymv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const int n,
@@ -2023,20 +2627,24 @@ void cblas_dsymv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const double* x, const int x_inc,
                  const double beta,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dsymv)>("cblas_dsymv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double) + x_size * sizeof(double) + y_size * sizeof(double))) {
+    invalidate_resident_copies(y, y_size * sizeof(double));
+    return host_routine(layout, triangle, n, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
   auto queue_cl = queue();
   auto s = clblast::Symv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -2050,7 +2658,7 @@ void cblas_dsymv(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
 }
 
 // SBMV
@@ -2061,20 +2669,24 @@ void cblas_ssbmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const float* x, const int x_inc,
                  const float beta,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ssbmv)>("cblas_ssbmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float) + x_size * sizeof(float) + y_size * sizeof(float))) {
+    invalidate_resident_copies(y, y_size * sizeof(float));
+    return host_routine(layout, triangle, n, k, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
   auto queue_cl = queue();
   auto s = clblast::Sbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -2088,7 +2700,7 @@ void cblas_ssbmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
 }
 void cblas_dsbmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const int n, const int k,
@@ -2097,20 +2709,24 @@ void cblas_dsbmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const double* x, const int x_inc,
                  const double beta,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dsbmv)>("cblas_dsbmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double) + x_size * sizeof(double) + y_size * sizeof(double))) {
+    invalidate_resident_copies(y, y_size * sizeof(double));
+    return host_routine(layout, triangle, n, k, alpha, a, a_ld, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
   auto queue_cl = queue();
   auto s = clblast::Sbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -2124,7 +2740,7 @@ void cblas_dsbmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
 }
 
 // SPMV
@@ -2135,20 +2751,24 @@ void cblas_sspmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const float* x, const int x_inc,
                  const float beta,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto ap_buffer = clblast::Buffer<float>(context, ap_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const float*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_sspmv)>("cblas_sspmv");
+  if (run_on_host(host_routine != nullptr, ap_size * sizeof(float) + x_size * sizeof(float) + y_size * sizeof(float))) {
+    invalidate_resident_copies(y, y_size * sizeof(float));
+    return host_routine(layout, triangle, n, alpha, ap, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto ap_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(ap), ap_size);
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<const float*>(ap));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
   auto queue_cl = queue();
   auto s = clblast::Spmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -2162,7 +2782,7 @@ void cblas_sspmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
 }
 void cblas_dspmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const int n,
@@ -2171,20 +2791,24 @@ void cblas_dspmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const double* x, const int x_inc,
                  const double beta,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto ap_buffer = clblast::Buffer<double>(context, ap_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const double*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dspmv)>("cblas_dspmv");
+  if (run_on_host(host_routine != nullptr, ap_size * sizeof(double) + x_size * sizeof(double) + y_size * sizeof(double))) {
+    invalidate_resident_copies(y, y_size * sizeof(double));
+    return host_routine(layout, triangle, n, alpha, ap, x, x_inc, beta, y, y_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto ap_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(ap), ap_size);
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<const double*>(ap));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
   auto queue_cl = queue();
   auto s = clblast::Spmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -2198,7 +2822,7 @@ void cblas_dspmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
 }
 
 // TRMV
@@ -2206,15 +2830,19 @@ void cblas_strmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const float* a, const int a_ld,
                  float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_strmv)>("cblas_strmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float) + x_size * sizeof(float))) {
+    invalidate_resident_copies(x, x_size * sizeof(float));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
   auto queue_cl = queue();
   auto s = clblast::Trmv<float>(static_cast<clblast::Layout>(layout),
                                 static_cast<clblast::Triangle>(triangle),
@@ -2227,21 +2855,25 @@ void cblas_strmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
 }
 void cblas_dtrmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n,
                  const double* a, const int a_ld,
                  double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dtrmv)>("cblas_dtrmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double) + x_size * sizeof(double))) {
+    invalidate_resident_copies(x, x_size * sizeof(double));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
   auto queue_cl = queue();
   auto s = clblast::Trmv<double>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2254,21 +2886,25 @@ void cblas_dtrmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
 }
 void cblas_ctrmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ctrmv)>("cblas_ctrmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + x_size * sizeof(float2))) {
+    invalidate_resident_copies(x, x_size * sizeof(float2));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Trmv<float2>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2281,21 +2917,25 @@ void cblas_ctrmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float2*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
 }
 void cblas_ztrmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ztrmv)>("cblas_ztrmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + x_size * sizeof(double2))) {
+    invalidate_resident_copies(x, x_size * sizeof(double2));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Trmv<double2>(static_cast<clblast::Layout>(layout),
                                   static_cast<clblast::Triangle>(triangle),
@@ -2308,7 +2948,7 @@ void cblas_ztrmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double2*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
 }
 
 // TBMV
@@ -2316,15 +2956,19 @@ void cblas_stbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n, const int k,
                  const float* a, const int a_ld,
                  float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_stbmv)>("cblas_stbmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float) + x_size * sizeof(float))) {
+    invalidate_resident_copies(x, x_size * sizeof(float));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, k, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tbmv<float>(static_cast<clblast::Layout>(layout),
                                 static_cast<clblast::Triangle>(triangle),
@@ -2337,21 +2981,25 @@ void cblas_stbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
 }
 void cblas_dtbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n, const int k,
                  const double* a, const int a_ld,
                  double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dtbmv)>("cblas_dtbmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double) + x_size * sizeof(double))) {
+    invalidate_resident_copies(x, x_size * sizeof(double));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, k, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tbmv<double>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2364,21 +3012,25 @@ void cblas_dtbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
 }
 void cblas_ctbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n, const int k,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ctbmv)>("cblas_ctbmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + x_size * sizeof(float2))) {
+    invalidate_resident_copies(x, x_size * sizeof(float2));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, k, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tbmv<float2>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2391,21 +3043,25 @@ void cblas_ctbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float2*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
 }
 void cblas_ztbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n, const int k,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ztbmv)>("cblas_ztbmv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + x_size * sizeof(double2))) {
+    invalidate_resident_copies(x, x_size * sizeof(double2));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, k, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tbmv<double2>(static_cast<clblast::Layout>(layout),
                                   static_cast<clblast::Triangle>(triangle),
@@ -2418,7 +3074,7 @@ void cblas_ztbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double2*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
 }
 
 // TPMV
@@ -2426,15 +3082,19 @@ void cblas_stpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const float* ap,
                  float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<float>(context, ap_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const float*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_stpmv)>("cblas_stpmv");
+  if (run_on_host(host_routine != nullptr, ap_size * sizeof(float) + x_size * sizeof(float))) {
+    invalidate_resident_copies(x, x_size * sizeof(float));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, ap, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto ap_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(ap), ap_size);
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<const float*>(ap));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tpmv<float>(static_cast<clblast::Layout>(layout),
                                 static_cast<clblast::Triangle>(triangle),
@@ -2447,21 +3107,25 @@ void cblas_stpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
 }
 void cblas_dtpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n,
                  const double* ap,
                  double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<double>(context, ap_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const double*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dtpmv)>("cblas_dtpmv");
+  if (run_on_host(host_routine != nullptr, ap_size * sizeof(double) + x_size * sizeof(double))) {
+    invalidate_resident_copies(x, x_size * sizeof(double));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, ap, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto ap_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(ap), ap_size);
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<const double*>(ap));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tpmv<double>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2474,21 +3138,25 @@ void cblas_dtpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
 }
 void cblas_ctpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n,
                  const void* ap,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<float2>(context, ap_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const float2*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ctpmv)>("cblas_ctpmv");
+  if (run_on_host(host_routine != nullptr, ap_size * sizeof(float2) + x_size * sizeof(float2))) {
+    invalidate_resident_copies(x, x_size * sizeof(float2));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, ap, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto ap_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(ap), ap_size);
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<const float2*>(ap));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tpmv<float2>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2501,21 +3169,25 @@ void cblas_ctpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float2*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
 }
 void cblas_ztpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n,
                  const void* ap,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<double2>(context, ap_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const double2*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ztpmv)>("cblas_ztpmv");
+  if (run_on_host(host_routine != nullptr, ap_size * sizeof(double2) + x_size * sizeof(double2))) {
+    invalidate_resident_copies(x, x_size * sizeof(double2));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, ap, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto ap_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(ap), ap_size);
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<const double2*>(ap));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tpmv<double2>(static_cast<clblast::Layout>(layout),
                                   static_cast<clblast::Triangle>(triangle),
@@ -2528,7 +3200,7 @@ void cblas_ztpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double2*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
 }
 
 // TRSV
@@ -2536,15 +3208,19 @@ void cblas_strsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const float* a, const int a_ld,
                  float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_strsv)>("cblas_strsv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float) + x_size * sizeof(float))) {
+    invalidate_resident_copies(x, x_size * sizeof(float));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
   auto queue_cl = queue();
   auto s = clblast::Trsv<float>(static_cast<clblast::Layout>(layout),
                                 static_cast<clblast::Triangle>(triangle),
@@ -2557,21 +3233,25 @@ void cblas_strsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
 }
 void cblas_dtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n,
                  const double* a, const int a_ld,
                  double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dtrsv)>("cblas_dtrsv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double) + x_size * sizeof(double))) {
+    invalidate_resident_copies(x, x_size * sizeof(double));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
   auto queue_cl = queue();
   auto s = clblast::Trsv<double>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2584,21 +3264,25 @@ void cblas_dtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
 }
 void cblas_ctrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ctrsv)>("cblas_ctrsv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + x_size * sizeof(float2))) {
+    invalidate_resident_copies(x, x_size * sizeof(float2));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Trsv<float2>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2611,21 +3295,25 @@ void cblas_ctrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float2*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
 }
 void cblas_ztrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ztrsv)>("cblas_ztrsv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + x_size * sizeof(double2))) {
+    invalidate_resident_copies(x, x_size * sizeof(double2));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Trsv<double2>(static_cast<clblast::Layout>(layout),
                                   static_cast<clblast::Triangle>(triangle),
@@ -2638,7 +3326,7 @@ void cblas_ztrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double2*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
 }
 
 // TBSV
@@ -2646,15 +3334,19 @@ void cblas_stbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n, const int k,
                  const float* a, const int a_ld,
                  float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_stbsv)>("cblas_stbsv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float) + x_size * sizeof(float))) {
+    invalidate_resident_copies(x, x_size * sizeof(float));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, k, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tbsv<float>(static_cast<clblast::Layout>(layout),
                                 static_cast<clblast::Triangle>(triangle),
@@ -2667,21 +3359,25 @@ void cblas_stbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
 }
 void cblas_dtbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n, const int k,
                  const double* a, const int a_ld,
                  double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dtbsv)>("cblas_dtbsv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double) + x_size * sizeof(double))) {
+    invalidate_resident_copies(x, x_size * sizeof(double));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, k, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tbsv<double>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2694,21 +3390,25 @@ void cblas_dtbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
 }
 void cblas_ctbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n, const int k,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ctbsv)>("cblas_ctbsv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + x_size * sizeof(float2))) {
+    invalidate_resident_copies(x, x_size * sizeof(float2));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, k, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tbsv<float2>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2721,21 +3421,25 @@ void cblas_ctbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float2*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
 }
 void cblas_ztbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n, const int k,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ztbsv)>("cblas_ztbsv");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + x_size * sizeof(double2))) {
+    invalidate_resident_copies(x, x_size * sizeof(double2));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, k, a, a_ld, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tbsv<double2>(static_cast<clblast::Layout>(layout),
                                   static_cast<clblast::Triangle>(triangle),
@@ -2748,7 +3452,7 @@ void cblas_ztbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double2*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
 }
 
 // TPSV
@@ -2756,15 +3460,19 @@ void cblas_stpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const float* ap,
                  float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<float>(context, ap_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const float*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_stpsv)>("cblas_stpsv");
+  if (run_on_host(host_routine != nullptr, ap_size * sizeof(float) + x_size * sizeof(float))) {
+    invalidate_resident_copies(x, x_size * sizeof(float));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, ap, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto ap_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(ap), ap_size);
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<const float*>(ap));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tpsv<float>(static_cast<clblast::Layout>(layout),
                                 static_cast<clblast::Triangle>(triangle),
@@ -2777,21 +3485,25 @@ void cblas_stpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
 }
 void cblas_dtpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n,
                  const double* ap,
                  double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<double>(context, ap_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const double*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dtpsv)>("cblas_dtpsv");
+  if (run_on_host(host_routine != nullptr, ap_size * sizeof(double) + x_size * sizeof(double))) {
+    invalidate_resident_copies(x, x_size * sizeof(double));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, ap, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto ap_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(ap), ap_size);
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<const double*>(ap));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tpsv<double>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2804,21 +3516,25 @@ void cblas_dtpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
 }
 void cblas_ctpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n,
                  const void* ap,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<float2>(context, ap_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const float2*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ctpsv)>("cblas_ctpsv");
+  if (run_on_host(host_routine != nullptr, ap_size * sizeof(float2) + x_size * sizeof(float2))) {
+    invalidate_resident_copies(x, x_size * sizeof(float2));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, ap, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto ap_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(ap), ap_size);
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<const float2*>(ap));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tpsv<float2>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2831,21 +3547,25 @@ void cblas_ctpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<float2*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
 }
 void cblas_ztpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int n,
                  const void* ap,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<double2>(context, ap_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const double2*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ztpsv)>("cblas_ztpsv");
+  if (run_on_host(host_routine != nullptr, ap_size * sizeof(double2) + x_size * sizeof(double2))) {
+    invalidate_resident_copies(x, x_size * sizeof(double2));
+    return host_routine(layout, triangle, a_transpose, diagonal, n, ap, x, x_inc);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto ap_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(ap), ap_size);
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<const double2*>(ap));
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
   auto queue_cl = queue();
   auto s = clblast::Tpsv<double2>(static_cast<clblast::Layout>(layout),
                                   static_cast<clblast::Triangle>(triangle),
@@ -2858,7 +3578,7 @@ void cblas_ztpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  x_buffer.Read(queue, x_size, reinterpret_cast<double2*>(x));
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
 }
 
 // GER
@@ -2868,19 +3588,23 @@ void cblas_sger(const CLBlastLayout layout,
                 const float* x, const int x_inc,
                 const float* y, const int y_inc,
                 float* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = m * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<float*>(a));
+  static const auto host_routine = get_host_routine<decltype(&cblas_sger)>("cblas_sger");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float) + y_size * sizeof(float) + a_size * sizeof(float))) {
+    invalidate_resident_copies(a, a_size * sizeof(float));
+    return host_routine(layout, m, n, alpha, x, x_inc, y, y_inc, a, a_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const float*>(y));
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<float*>(a));
   auto queue_cl = queue();
   auto s = clblast::Ger(static_cast<clblast::Layout>(layout),
                         m, n,
@@ -2892,7 +3616,7 @@ void cblas_sger(const CLBlastLayout layout,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  a_buffer.Read(queue, a_size, reinterpret_cast<float*>(a));
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<float*>(a));
 }
 void cblas_dger(const CLBlastLayout layout,
                 const int m, const int n,
@@ -2900,19 +3624,23 @@ void cblas_dger(const CLBlastLayout layout,
                 const double* x, const int x_inc,
                 const double* y, const int y_inc,
                 double* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = m * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<double*>(a));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dger)>("cblas_dger");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double) + y_size * sizeof(double) + a_size * sizeof(double))) {
+    invalidate_resident_copies(a, a_size * sizeof(double));
+    return host_routine(layout, m, n, alpha, x, x_inc, y, y_inc, a, a_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const double*>(y));
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<double*>(a));
   auto queue_cl = queue();
   auto s = clblast::Ger(static_cast<clblast::Layout>(layout),
                         m, n,
@@ -2924,7 +3652,7 @@ void cblas_dger(const CLBlastLayout layout,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  a_buffer.Read(queue, a_size, reinterpret_cast<double*>(a));
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<double*>(a));
 }
 
 // GERU
@@ -2934,19 +3662,23 @@ void cblas_cgeru(const CLBlastLayout layout,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto x_size = m * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<float2*>(a));
+  static const auto host_routine = get_host_routine<decltype(&cblas_cgeru)>("cblas_cgeru");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float2) + y_size * sizeof(float2) + a_size * sizeof(float2))) {
+    invalidate_resident_copies(a, a_size * sizeof(float2));
+    return host_routine(layout, m, n, alpha, x, x_inc, y, y_inc, a, a_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const float2*>(y));
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<float2*>(a));
   auto queue_cl = queue();
   auto s = clblast::Geru(static_cast<clblast::Layout>(layout),
                          m, n,
@@ -2958,7 +3690,7 @@ void cblas_cgeru(const CLBlastLayout layout,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  a_buffer.Read(queue, a_size, reinterpret_cast<float2*>(a));
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<float2*>(a));
 }
 void cblas_zgeru(const CLBlastLayout layout,
                  const int m, const int n,
@@ -2966,19 +3698,23 @@ void cblas_zgeru(const CLBlastLayout layout,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto x_size = m * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<double2*>(a));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zgeru)>("cblas_zgeru");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double2) + y_size * sizeof(double2) + a_size * sizeof(double2))) {
+    invalidate_resident_copies(a, a_size * sizeof(double2));
+    return host_routine(layout, m, n, alpha, x, x_inc, y, y_inc, a, a_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const double2*>(y));
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<double2*>(a));
   auto queue_cl = queue();
   auto s = clblast::Geru(static_cast<clblast::Layout>(layout),
                          m, n,
@@ -2990,7 +3726,7 @@ void cblas_zgeru(const CLBlastLayout layout,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  a_buffer.Read(queue, a_size, reinterpret_cast<double2*>(a));
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<double2*>(a));
 }
 
 // GERC
@@ -3000,19 +3736,23 @@ void cblas_cgerc(const CLBlastLayout layout,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto x_size = m * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<float2*>(a));
+  static const auto host_routine = get_host_routine<decltype(&cblas_cgerc)>("cblas_cgerc");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float2) + y_size * sizeof(float2) + a_size * sizeof(float2))) {
+    invalidate_resident_copies(a, a_size * sizeof(float2));
+    return host_routine(layout, m, n, alpha, x, x_inc, y, y_inc, a, a_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const float2*>(y));
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<float2*>(a));
   auto queue_cl = queue();
   auto s = clblast::Gerc(static_cast<clblast::Layout>(layout),
                          m, n,
@@ -3024,7 +3764,7 @@ void cblas_cgerc(const CLBlastLayout layout,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  a_buffer.Read(queue, a_size, reinterpret_cast<float2*>(a));
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<float2*>(a));
 }
 void cblas_zgerc(const CLBlastLayout layout,
                  const int m, const int n,
@@ -3032,19 +3772,23 @@ void cblas_zgerc(const CLBlastLayout layout,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto x_size = m * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<double2*>(a));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zgerc)>("cblas_zgerc");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double2) + y_size * sizeof(double2) + a_size * sizeof(double2))) {
+    invalidate_resident_copies(a, a_size * sizeof(double2));
+    return host_routine(layout, m, n, alpha, x, x_inc, y, y_inc, a, a_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const double2*>(y));
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<double2*>(a));
   auto queue_cl = queue();
   auto s = clblast::Gerc(static_cast<clblast::Layout>(layout),
                          m, n,
@@ -3056,7 +3800,7 @@ void cblas_zgerc(const CLBlastLayout layout,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  a_buffer.Read(queue, a_size, reinterpret_cast<double2*>(a));
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<double2*>(a));
 }
 
 // HER
@@ -3065,16 +3809,20 @@ void cblas_cher(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const float alpha,
                 const void* x, const int x_inc,
                 void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  a_buffer.Write(queue, a_size, reinterpret_cast<float2*>(a));
+  static const auto host_routine = get_host_routine<decltype(&cblas_cher)>("cblas_cher");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float2) + a_size * sizeof(float2))) {
+    invalidate_resident_copies(a, a_size * sizeof(float2));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, a, a_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<float2*>(a));
   auto queue_cl = queue();
   auto s = clblast::Her(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3086,23 +3834,27 @@ void cblas_cher(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  a_buffer.Read(queue, a_size, reinterpret_cast<float2*>(a));
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<float2*>(a));
 }
 void cblas_zher(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const int n,
                 const double alpha,
                 const void* x, const int x_inc,
                 void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  a_buffer.Write(queue, a_size, reinterpret_cast<double2*>(a));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zher)>("cblas_zher");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double2) + a_size * sizeof(double2))) {
+    invalidate_resident_copies(a, a_size * sizeof(double2));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, a, a_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<double2*>(a));
   auto queue_cl = queue();
   auto s = clblast::Her(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3114,7 +3866,7 @@ void cblas_zher(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  a_buffer.Read(queue, a_size, reinterpret_cast<double2*>(a));
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<double2*>(a));
 }
 
 // HPR
@@ -3123,16 +3875,20 @@ void cblas_chpr(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const float alpha,
                 const void* x, const int x_inc,
                 void* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto ap_buffer = clblast::Buffer<float2>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<float2*>(ap));
+  static const auto host_routine = get_host_routine<decltype(&cblas_chpr)>("cblas_chpr");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float2) + ap_size * sizeof(float2))) {
+    invalidate_resident_copies(ap, ap_size * sizeof(float2));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, ap);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto ap_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(ap), ap_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<float2*>(ap));
   auto queue_cl = queue();
   auto s = clblast::Hpr(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3144,23 +3900,27 @@ void cblas_chpr(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  ap_buffer.Read(queue, ap_size, reinterpret_cast<float2*>(ap));
+  read_buffer(queue, ap_buffer, ap_size, reinterpret_cast<float2*>(ap));
 }
 void cblas_zhpr(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const int n,
                 const double alpha,
                 const void* x, const int x_inc,
                 void* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto ap_buffer = clblast::Buffer<double2>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<double2*>(ap));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zhpr)>("cblas_zhpr");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double2) + ap_size * sizeof(double2))) {
+    invalidate_resident_copies(ap, ap_size * sizeof(double2));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, ap);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto ap_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(ap), ap_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<double2*>(ap));
   auto queue_cl = queue();
   auto s = clblast::Hpr(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3172,7 +3932,7 @@ void cblas_zhpr(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  ap_buffer.Read(queue, ap_size, reinterpret_cast<double2*>(ap));
+  read_buffer(queue, ap_buffer, ap_size, reinterpret_cast<double2*>(ap));
 }
 
 // HER2
@@ -3182,19 +3942,23 @@ void cblas_cher2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<float2*>(a));
+  static const auto host_routine = get_host_routine<decltype(&cblas_cher2)>("cblas_cher2");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float2) + y_size * sizeof(float2) + a_size * sizeof(float2))) {
+    invalidate_resident_copies(a, a_size * sizeof(float2));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, y, y_inc, a, a_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const float2*>(y));
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<float2*>(a));
   auto queue_cl = queue();
   auto s = clblast::Her2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3207,7 +3971,7 @@ void cblas_cher2(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  a_buffer.Read(queue, a_size, reinterpret_cast<float2*>(a));
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<float2*>(a));
 }
 void cblas_zher2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const int n,
@@ -3215,19 +3979,23 @@ void cblas_zher2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<double2*>(a));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zher2)>("cblas_zher2");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double2) + y_size * sizeof(double2) + a_size * sizeof(double2))) {
+    invalidate_resident_copies(a, a_size * sizeof(double2));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, y, y_inc, a, a_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const double2*>(y));
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<double2*>(a));
   auto queue_cl = queue();
   auto s = clblast::Her2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3240,7 +4008,7 @@ void cblas_zher2(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  a_buffer.Read(queue, a_size, reinterpret_cast<double2*>(a));
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<double2*>(a));
 }
 
 // HPR2
@@ -3250,19 +4018,23 @@ void cblas_chpr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  auto ap_buffer = clblast::Buffer<float2>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<float2*>(ap));
+  static const auto host_routine = get_host_routine<decltype(&cblas_chpr2)>("cblas_chpr2");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float2) + y_size * sizeof(float2) + ap_size * sizeof(float2))) {
+    invalidate_resident_copies(ap, ap_size * sizeof(float2));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, y, y_inc, ap);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  auto ap_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(ap), ap_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const float2*>(y));
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<float2*>(ap));
   auto queue_cl = queue();
   auto s = clblast::Hpr2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3275,7 +4047,7 @@ void cblas_chpr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  ap_buffer.Read(queue, ap_size, reinterpret_cast<float2*>(ap));
+  read_buffer(queue, ap_buffer, ap_size, reinterpret_cast<float2*>(ap));
 }
 void cblas_zhpr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const int n,
@@ -3283,19 +4055,23 @@ void cblas_zhpr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  auto ap_buffer = clblast::Buffer<double2>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<double2*>(ap));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zhpr2)>("cblas_zhpr2");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double2) + y_size * sizeof(double2) + ap_size * sizeof(double2))) {
+    invalidate_resident_copies(ap, ap_size * sizeof(double2));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, y, y_inc, ap);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  auto ap_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(ap), ap_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const double2*>(y));
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<double2*>(ap));
   auto queue_cl = queue();
   auto s = clblast::Hpr2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3308,7 +4084,7 @@ void cblas_zhpr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  ap_buffer.Read(queue, ap_size, reinterpret_cast<double2*>(ap));
+  read_buffer(queue, ap_buffer, ap_size, reinterpret_cast<double2*>(ap));
 }
 
 // SYR
@@ -3317,17 +4093,21 @@ void cblas_ssyr(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const float alpha,
                 const float* x, const int x_inc,
                 float* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  a_buffer.Write(queue, a_size, reinterpret_cast<float*>(a));
-  auto queue_cl = queue();
+  static const auto host_routine = get_host_routine<decltype(&cblas_ssyr)>("cblas_ssyr");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float) + a_size * sizeof(float))) {
+    invalidate_resident_copies(a, a_size * sizeof(float));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, a, a_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<float*>(a));
+  auto queue_cl = queue();
   auto s = clblast::Syr(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
                         n,
@@ -3338,23 +4118,27 @@ void cblas_ssyr(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  a_buffer.Read(queue, a_size, reinterpret_cast<float*>(a));
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<float*>(a));
 }
 void cblas_dsyr(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const int n,
                 const double alpha,
                 const double* x, const int x_inc,
                 double* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  a_buffer.Write(queue, a_size, reinterpret_cast<double*>(a));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dsyr)>("cblas_dsyr");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double) + a_size * sizeof(double))) {
+    invalidate_resident_copies(a, a_size * sizeof(double));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, a, a_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<double*>(a));
   auto queue_cl = queue();
   auto s = clblast::Syr(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3366,7 +4150,7 @@ void cblas_dsyr(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  a_buffer.Read(queue, a_size, reinterpret_cast<double*>(a));
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<double*>(a));
 }
 
 // SPR
@@ -3375,16 +4159,20 @@ void cblas_sspr(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const float alpha,
                 const float* x, const int x_inc,
                 float* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto ap_buffer = clblast::Buffer<float>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<float*>(ap));
+  static const auto host_routine = get_host_routine<decltype(&cblas_sspr)>("cblas_sspr");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float) + ap_size * sizeof(float))) {
+    invalidate_resident_copies(ap, ap_size * sizeof(float));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, ap);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto ap_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(ap), ap_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<float*>(ap));
   auto queue_cl = queue();
   auto s = clblast::Spr(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3396,23 +4184,27 @@ void cblas_sspr(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  ap_buffer.Read(queue, ap_size, reinterpret_cast<float*>(ap));
+  read_buffer(queue, ap_buffer, ap_size, reinterpret_cast<float*>(ap));
 }
 void cblas_dspr(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const int n,
                 const double alpha,
                 const double* x, const int x_inc,
                 double* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto ap_buffer = clblast::Buffer<double>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<double*>(ap));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dspr)>("cblas_dspr");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double) + ap_size * sizeof(double))) {
+    invalidate_resident_copies(ap, ap_size * sizeof(double));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, ap);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto ap_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(ap), ap_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<double*>(ap));
   auto queue_cl = queue();
   auto s = clblast::Spr(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3424,7 +4216,7 @@ void cblas_dspr(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  ap_buffer.Read(queue, ap_size, reinterpret_cast<double*>(ap));
+  read_buffer(queue, ap_buffer, ap_size, reinterpret_cast<double*>(ap));
 }
 
 // SYR2
@@ -3434,19 +4226,23 @@ void cblas_ssyr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const float* x, const int x_inc,
                  const float* y, const int y_inc,
                  float* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<float*>(a));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ssyr2)>("cblas_ssyr2");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float) + y_size * sizeof(float) + a_size * sizeof(float))) {
+    invalidate_resident_copies(a, a_size * sizeof(float));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, y, y_inc, a, a_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const float*>(y));
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<float*>(a));
   auto queue_cl = queue();
   auto s = clblast::Syr2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3459,7 +4255,7 @@ void cblas_ssyr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  a_buffer.Read(queue, a_size, reinterpret_cast<float*>(a));
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<float*>(a));
 }
 void cblas_dsyr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const int n,
@@ -3467,19 +4263,23 @@ void cblas_dsyr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const double* x, const int x_inc,
                  const double* y, const int y_inc,
                  double* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<double*>(a));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dsyr2)>("cblas_dsyr2");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double) + y_size * sizeof(double) + a_size * sizeof(double))) {
+    invalidate_resident_copies(a, a_size * sizeof(double));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, y, y_inc, a, a_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const double*>(y));
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<double*>(a));
   auto queue_cl = queue();
   auto s = clblast::Syr2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3492,7 +4292,7 @@ void cblas_dsyr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  a_buffer.Read(queue, a_size, reinterpret_cast<double*>(a));
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<double*>(a));
 }
 
 // SPR2
@@ -3502,19 +4302,23 @@ void cblas_sspr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const float* x, const int x_inc,
                  const float* y, const int y_inc,
                  float* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  auto ap_buffer = clblast::Buffer<float>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float*>(y));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<float*>(ap));
+  static const auto host_routine = get_host_routine<decltype(&cblas_sspr2)>("cblas_sspr2");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(float) + y_size * sizeof(float) + ap_size * sizeof(float))) {
+    invalidate_resident_copies(ap, ap_size * sizeof(float));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, y, y_inc, ap);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  auto ap_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(ap), ap_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const float*>(y));
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<float*>(ap));
   auto queue_cl = queue();
   auto s = clblast::Spr2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3527,7 +4331,7 @@ void cblas_sspr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  ap_buffer.Read(queue, ap_size, reinterpret_cast<float*>(ap));
+  read_buffer(queue, ap_buffer, ap_size, reinterpret_cast<float*>(ap));
 }
 void cblas_dspr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const int n,
@@ -3535,19 +4339,23 @@ void cblas_dspr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const double* x, const int x_inc,
                  const double* y, const int y_inc,
                  double* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  auto ap_buffer = clblast::Buffer<double>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double*>(y));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<double*>(ap));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dspr2)>("cblas_dspr2");
+  if (run_on_host(host_routine != nullptr, x_size * sizeof(double) + y_size * sizeof(double) + ap_size * sizeof(double))) {
+    invalidate_resident_copies(ap, ap_size * sizeof(double));
+    return host_routine(layout, triangle, n, alpha, x, x_inc, y, y_inc, ap);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  auto ap_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(ap), ap_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const double*>(y));
+  write_buffer(queue, ap_buffer, ap_size, reinterpret_cast<double*>(ap));
   auto queue_cl = queue();
   auto s = clblast::Spr2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3560,7 +4368,7 @@ void cblas_dspr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  ap_buffer.Read(queue, ap_size, reinterpret_cast<double*>(ap));
+  read_buffer(queue, ap_buffer, ap_size, reinterpret_cast<double*>(ap));
 }
 
 // =================================================================================================
@@ -3575,20 +4383,24 @@ void cblas_sgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const float* b, const int b_ld,
                  const float beta,
                  float* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? m * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && b_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && b_transpose == CLBlastTransposeNo)) ? k * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto b_buffer = clblast::Buffer<float>(context, b_size);
-  auto c_buffer = clblast::Buffer<float>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_sgemm)>("cblas_sgemm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float) + b_size * sizeof(float) + c_size * sizeof(float))) {
+    invalidate_resident_copies(c, c_size * sizeof(float));
+    return host_routine(layout, a_transpose, b_transpose, m, n, k, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto b_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(b), b_size);
+  auto c_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const float*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<float*>(c));
   auto queue_cl = queue();
   auto s = clblast::Gemm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -3603,7 +4415,7 @@ void cblas_sgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<float*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<float*>(c));
 }
 void cblas_dgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
                  const int m, const int n, const int k,
@@ -3612,20 +4424,24 @@ void cblas_dgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const double* b, const int b_ld,
                  const double beta,
                  double* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? m * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && b_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && b_transpose == CLBlastTransposeNo)) ? k * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto b_buffer = clblast::Buffer<double>(context, b_size);
-  auto c_buffer = clblast::Buffer<double>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dgemm)>("cblas_dgemm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double) + b_size * sizeof(double) + c_size * sizeof(double))) {
+    invalidate_resident_copies(c, c_size * sizeof(double));
+    return host_routine(layout, a_transpose, b_transpose, m, n, k, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto b_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(b), b_size);
+  auto c_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const double*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<double*>(c));
   auto queue_cl = queue();
   auto s = clblast::Gemm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -3640,7 +4456,7 @@ void cblas_dgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<double*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<double*>(c));
 }
 void cblas_cgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
                  const int m, const int n, const int k,
@@ -3649,20 +4465,24 @@ void cblas_cgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const void* b, const int b_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
-  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? m * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && b_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && b_transpose == CLBlastTransposeNo)) ? k * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  auto c_buffer = clblast::Buffer<float2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_cgemm)>("cblas_cgemm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + b_size * sizeof(float2) + c_size * sizeof(float2))) {
+    invalidate_resident_copies(c, c_size * sizeof(float2));
+    return host_routine(layout, a_transpose, b_transpose, m, n, k, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(b), b_size);
+  auto c_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const float2*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<float2*>(c));
   auto queue_cl = queue();
   auto s = clblast::Gemm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -3677,7 +4497,7 @@ void cblas_cgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<float2*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<float2*>(c));
 }
 void cblas_zgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
                  const int m, const int n, const int k,
@@ -3686,20 +4506,24 @@ void cblas_zgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const void* b, const int b_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
-  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? m * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && b_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && b_transpose == CLBlastTransposeNo)) ? k * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  auto c_buffer = clblast::Buffer<double2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zgemm)>("cblas_zgemm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + b_size * sizeof(double2) + c_size * sizeof(double2))) {
+    invalidate_resident_copies(c, c_size * sizeof(double2));
+    return host_routine(layout, a_transpose, b_transpose, m, n, k, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(b), b_size);
+  auto c_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const double2*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<double2*>(c));
   auto queue_cl = queue();
   auto s = clblast::Gemm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -3714,7 +4538,7 @@ void cblas_zgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<double2*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<double2*>(c));
 }
 
 // SYMM
@@ -3725,20 +4549,24 @@ void cblas_ssymm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const float* b, const int b_ld,
                  const float beta,
                  float* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : ((side == CLBlastSideLeft) ? m : n) * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? ((side == CLBlastSideLeft) ? m : n) * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto b_buffer = clblast::Buffer<float>(context, b_size);
-  auto c_buffer = clblast::Buffer<float>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ssymm)>("cblas_ssymm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float) + b_size * sizeof(float) + c_size * sizeof(float))) {
+    invalidate_resident_copies(c, c_size * sizeof(float));
+    return host_routine(layout, side, triangle, m, n, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto b_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(b), b_size);
+  auto c_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const float*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<float*>(c));
   auto queue_cl = queue();
   auto s = clblast::Symm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -3753,7 +4581,7 @@ void cblas_ssymm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<float*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<float*>(c));
 }
 void cblas_dsymm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
                  const int m, const int n,
@@ -3762,20 +4590,24 @@ void cblas_dsymm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const double* b, const int b_ld,
                  const double beta,
                  double* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : ((side == CLBlastSideLeft) ? m : n) * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? ((side == CLBlastSideLeft) ? m : n) * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto b_buffer = clblast::Buffer<double>(context, b_size);
-  auto c_buffer = clblast::Buffer<double>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dsymm)>("cblas_dsymm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double) + b_size * sizeof(double) + c_size * sizeof(double))) {
+    invalidate_resident_copies(c, c_size * sizeof(double));
+    return host_routine(layout, side, triangle, m, n, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto b_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(b), b_size);
+  auto c_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const double*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<double*>(c));
   auto queue_cl = queue();
   auto s = clblast::Symm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -3790,7 +4622,7 @@ void cblas_dsymm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<double*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<double*>(c));
 }
 void cblas_csymm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
                  const int m, const int n,
@@ -3799,20 +4631,24 @@ void cblas_csymm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const void* b, const int b_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
-  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : ((side == CLBlastSideLeft) ? m : n) * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? ((side == CLBlastSideLeft) ? m : n) * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  auto c_buffer = clblast::Buffer<float2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_csymm)>("cblas_csymm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + b_size * sizeof(float2) + c_size * sizeof(float2))) {
+    invalidate_resident_copies(c, c_size * sizeof(float2));
+    return host_routine(layout, side, triangle, m, n, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(b), b_size);
+  auto c_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const float2*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<float2*>(c));
   auto queue_cl = queue();
   auto s = clblast::Symm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -3827,7 +4663,7 @@ void cblas_csymm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<float2*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<float2*>(c));
 }
 void cblas_zsymm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
                  const int m, const int n,
@@ -3836,20 +4672,24 @@ void cblas_zsymm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const void* b, const int b_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
-  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : ((side == CLBlastSideLeft) ? m : n) * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? ((side == CLBlastSideLeft) ? m : n) * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  auto c_buffer = clblast::Buffer<double2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zsymm)>("cblas_zsymm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + b_size * sizeof(double2) + c_size * sizeof(double2))) {
+    invalidate_resident_copies(c, c_size * sizeof(double2));
+    return host_routine(layout, side, triangle, m, n, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(b), b_size);
+  auto c_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const double2*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<double2*>(c));
   auto queue_cl = queue();
   auto s = clblast::Symm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -3864,7 +4704,7 @@ void cblas_zsymm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<double2*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<double2*>(c));
 }
 
 // HEMM
@@ -3875,20 +4715,24 @@ void cblas_chemm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const void* b, const int b_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
-  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : ((side == CLBlastSideLeft) ? m : n) * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? ((side == CLBlastSideLeft) ? m : n) * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  auto c_buffer = clblast::Buffer<float2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_chemm)>("cblas_chemm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + b_size * sizeof(float2) + c_size * sizeof(float2))) {
+    invalidate_resident_copies(c, c_size * sizeof(float2));
+    return host_routine(layout, side, triangle, m, n, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(b), b_size);
+  auto c_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const float2*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<float2*>(c));
   auto queue_cl = queue();
   auto s = clblast::Hemm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -3903,7 +4747,7 @@ void cblas_chemm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<float2*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<float2*>(c));
 }
 void cblas_zhemm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
                  const int m, const int n,
@@ -3912,20 +4756,24 @@ void cblas_zhemm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const void* b, const int b_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
-  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : ((side == CLBlastSideLeft) ? m : n) * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? ((side == CLBlastSideLeft) ? m : n) * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  auto c_buffer = clblast::Buffer<double2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zhemm)>("cblas_zhemm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + b_size * sizeof(double2) + c_size * sizeof(double2))) {
+    invalidate_resident_copies(c, c_size * sizeof(double2));
+    return host_routine(layout, side, triangle, m, n, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(b), b_size);
+  auto c_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const double2*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<double2*>(c));
   auto queue_cl = queue();
   auto s = clblast::Hemm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -3940,7 +4788,7 @@ void cblas_zhemm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<double2*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<double2*>(c));
 }
 
 // SYRK
@@ -3950,17 +4798,21 @@ void cblas_ssyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const float* a, const int a_ld,
                  const float beta,
                  float* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto c_buffer = clblast::Buffer<float>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ssyrk)>("cblas_ssyrk");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float) + c_size * sizeof(float))) {
+    invalidate_resident_copies(c, c_size * sizeof(float));
+    return host_routine(layout, triangle, a_transpose, n, k, alpha, a, a_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto c_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<float*>(c));
   auto queue_cl = queue();
   auto s = clblast::Syrk(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3974,7 +4826,7 @@ void cblas_ssyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<float*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<float*>(c));
 }
 void cblas_dsyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
                  const int n, const int k,
@@ -3982,17 +4834,21 @@ void cblas_dsyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const double* a, const int a_ld,
                  const double beta,
                  double* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto c_buffer = clblast::Buffer<double>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dsyrk)>("cblas_dsyrk");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double) + c_size * sizeof(double))) {
+    invalidate_resident_copies(c, c_size * sizeof(double));
+    return host_routine(layout, triangle, a_transpose, n, k, alpha, a, a_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto c_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<double*>(c));
   auto queue_cl = queue();
   auto s = clblast::Syrk(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -4006,7 +4862,7 @@ void cblas_dsyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<double*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<double*>(c));
 }
 void cblas_csyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
                  const int n, const int k,
@@ -4014,17 +4870,21 @@ void cblas_csyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const void* a, const int a_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
-  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto c_buffer = clblast::Buffer<float2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_csyrk)>("cblas_csyrk");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + c_size * sizeof(float2))) {
+    invalidate_resident_copies(c, c_size * sizeof(float2));
+    return host_routine(layout, triangle, a_transpose, n, k, alpha, a, a_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto c_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<float2*>(c));
   auto queue_cl = queue();
   auto s = clblast::Syrk(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -4038,7 +4898,7 @@ void cblas_csyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<float2*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<float2*>(c));
 }
 void cblas_zsyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
                  const int n, const int k,
@@ -4046,17 +4906,21 @@ void cblas_zsyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const void* a, const int a_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
-  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto c_buffer = clblast::Buffer<double2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zsyrk)>("cblas_zsyrk");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + c_size * sizeof(double2))) {
+    invalidate_resident_copies(c, c_size * sizeof(double2));
+    return host_routine(layout, triangle, a_transpose, n, k, alpha, a, a_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto c_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<double2*>(c));
   auto queue_cl = queue();
   auto s = clblast::Syrk(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -4070,7 +4934,7 @@ void cblas_zsyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<double2*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<double2*>(c));
 }
 
 // HERK
@@ -4080,17 +4944,21 @@ void cblas_cherk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const void* a, const int a_ld,
                  const float beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto c_buffer = clblast::Buffer<float2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_cherk)>("cblas_cherk");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + c_size * sizeof(float2))) {
+    invalidate_resident_copies(c, c_size * sizeof(float2));
+    return host_routine(layout, triangle, a_transpose, n, k, alpha, a, a_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto c_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<float2*>(c));
   auto queue_cl = queue();
   auto s = clblast::Herk(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -4104,7 +4972,7 @@ void cblas_cherk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<float2*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<float2*>(c));
 }
 void cblas_zherk(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose,
                  const int n, const int k,
@@ -4112,17 +4980,21 @@ void cblas_zherk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const void* a, const int a_ld,
                  const double beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto c_buffer = clblast::Buffer<double2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zherk)>("cblas_zherk");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + c_size * sizeof(double2))) {
+    invalidate_resident_copies(c, c_size * sizeof(double2));
+    return host_routine(layout, triangle, a_transpose, n, k, alpha, a, a_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto c_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<double2*>(c));
   auto queue_cl = queue();
   auto s = clblast::Herk(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -4136,7 +5008,7 @@ void cblas_zherk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<double2*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<double2*>(c));
 }
 
 // SYR2K
@@ -4147,20 +5019,24 @@ void cblas_ssyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
                   const float* b, const int b_ld,
                   const float beta,
                   float* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * b_ld : k * b_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto b_buffer = clblast::Buffer<float>(context, b_size);
-  auto c_buffer = clblast::Buffer<float>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ssyr2k)>("cblas_ssyr2k");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float) + b_size * sizeof(float) + c_size * sizeof(float))) {
+    invalidate_resident_copies(c, c_size * sizeof(float));
+    return host_routine(layout, triangle, ab_transpose, n, k, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto b_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(b), b_size);
+  auto c_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const float*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<float*>(c));
   auto queue_cl = queue();
   auto s = clblast::Syr2k(static_cast<clblast::Layout>(layout),
                           static_cast<clblast::Triangle>(triangle),
@@ -4175,7 +5051,7 @@ void cblas_ssyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<float*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<float*>(c));
 }
 void cblas_dsyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose ab_transpose,
                   const int n, const int k,
@@ -4184,20 +5060,24 @@ void cblas_dsyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
                   const double* b, const int b_ld,
                   const double beta,
                   double* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * b_ld : k * b_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto b_buffer = clblast::Buffer<double>(context, b_size);
-  auto c_buffer = clblast::Buffer<double>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dsyr2k)>("cblas_dsyr2k");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double) + b_size * sizeof(double) + c_size * sizeof(double))) {
+    invalidate_resident_copies(c, c_size * sizeof(double));
+    return host_routine(layout, triangle, ab_transpose, n, k, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto b_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(b), b_size);
+  auto c_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const double*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<double*>(c));
   auto queue_cl = queue();
   auto s = clblast::Syr2k(static_cast<clblast::Layout>(layout),
                           static_cast<clblast::Triangle>(triangle),
@@ -4212,7 +5092,7 @@ void cblas_dsyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<double*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<double*>(c));
 }
 void cblas_csyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose ab_transpose,
                   const int n, const int k,
@@ -4221,20 +5101,24 @@ void cblas_csyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
                   const void* b, const int b_ld,
                   const void* beta,
                   void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
-  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * b_ld : k * b_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  auto c_buffer = clblast::Buffer<float2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_csyr2k)>("cblas_csyr2k");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + b_size * sizeof(float2) + c_size * sizeof(float2))) {
+    invalidate_resident_copies(c, c_size * sizeof(float2));
+    return host_routine(layout, triangle, ab_transpose, n, k, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(b), b_size);
+  auto c_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const float2*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<float2*>(c));
   auto queue_cl = queue();
   auto s = clblast::Syr2k(static_cast<clblast::Layout>(layout),
                           static_cast<clblast::Triangle>(triangle),
@@ -4249,7 +5133,7 @@ void cblas_csyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<float2*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<float2*>(c));
 }
 void cblas_zsyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose ab_transpose,
                   const int n, const int k,
@@ -4258,20 +5142,24 @@ void cblas_zsyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
                   const void* b, const int b_ld,
                   const void* beta,
                   void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
-  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * b_ld : k * b_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  auto c_buffer = clblast::Buffer<double2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zsyr2k)>("cblas_zsyr2k");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + b_size * sizeof(double2) + c_size * sizeof(double2))) {
+    invalidate_resident_copies(c, c_size * sizeof(double2));
+    return host_routine(layout, triangle, ab_transpose, n, k, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(b), b_size);
+  auto c_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const double2*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<double2*>(c));
   auto queue_cl = queue();
   auto s = clblast::Syr2k(static_cast<clblast::Layout>(layout),
                           static_cast<clblast::Triangle>(triangle),
@@ -4286,7 +5174,7 @@ void cblas_zsyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<double2*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<double2*>(c));
 }
 
 // HER2K
@@ -4297,20 +5185,24 @@ void cblas_cher2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
                   const void* b, const int b_ld,
                   const float beta,
                   void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
-  const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * b_ld : k * b_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  auto c_buffer = clblast::Buffer<float2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_cher2k)>("cblas_cher2k");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + b_size * sizeof(float2) + c_size * sizeof(float2))) {
+    invalidate_resident_copies(c, c_size * sizeof(float2));
+    return host_routine(layout, triangle, ab_transpose, n, k, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(b), b_size);
+  auto c_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const float2*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<float2*>(c));
   auto queue_cl = queue();
   auto s = clblast::Her2k(static_cast<clblast::Layout>(layout),
                           static_cast<clblast::Triangle>(triangle),
@@ -4325,7 +5217,7 @@ void cblas_cher2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<float2*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<float2*>(c));
 }
 void cblas_zher2k(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose ab_transpose,
                   const int n, const int k,
@@ -4334,20 +5226,24 @@ void cblas_zher2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
                   const void* b, const int b_ld,
                   const double beta,
                   void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
-  const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * b_ld : k * b_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  auto c_buffer = clblast::Buffer<double2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  static const auto host_routine = get_host_routine<decltype(&cblas_zher2k)>("cblas_zher2k");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + b_size * sizeof(double2) + c_size * sizeof(double2))) {
+    invalidate_resident_copies(c, c_size * sizeof(double2));
+    return host_routine(layout, triangle, ab_transpose, n, k, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = beta;
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(b), b_size);
+  auto c_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(c), c_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<const double2*>(b));
+  write_buffer(queue, c_buffer, c_size, reinterpret_cast<double2*>(c));
   auto queue_cl = queue();
   auto s = clblast::Her2k(static_cast<clblast::Layout>(layout),
                           static_cast<clblast::Triangle>(triangle),
@@ -4362,7 +5258,7 @@ void cblas_zher2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  c_buffer.Read(queue, c_size, reinterpret_cast<double2*>(c));
+  read_buffer(queue, c_buffer, c_size, reinterpret_cast<double2*>(c));
 }
 
 // TRMM
@@ -4371,16 +5267,20 @@ void cblas_strmm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const float alpha,
                  const float* a, const int a_ld,
                  float* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto b_buffer = clblast::Buffer<float>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<float*>(b));
+  static const auto host_routine = get_host_routine<decltype(&cblas_strmm)>("cblas_strmm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float) + b_size * sizeof(float))) {
+    invalidate_resident_copies(b, b_size * sizeof(float));
+    return host_routine(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a, a_ld, b, b_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto b_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(b), b_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<float*>(b));
   auto queue_cl = queue();
   auto s = clblast::Trmm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4395,23 +5295,27 @@ void cblas_strmm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  b_buffer.Read(queue, b_size, reinterpret_cast<float*>(b));
+  read_buffer(queue, b_buffer, b_size, reinterpret_cast<float*>(b));
 }
 void cblas_dtrmm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int m, const int n,
                  const double alpha,
                  const double* a, const int a_ld,
                  double* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto b_buffer = clblast::Buffer<double>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<double*>(b));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dtrmm)>("cblas_dtrmm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double) + b_size * sizeof(double))) {
+    invalidate_resident_copies(b, b_size * sizeof(double));
+    return host_routine(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a, a_ld, b, b_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto b_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(b), b_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<double*>(b));
   auto queue_cl = queue();
   auto s = clblast::Trmm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4426,23 +5330,27 @@ void cblas_dtrmm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  b_buffer.Read(queue, b_size, reinterpret_cast<double*>(b));
+  read_buffer(queue, b_buffer, b_size, reinterpret_cast<double*>(b));
 }
 void cblas_ctrmm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int m, const int n,
                  const void* alpha,
                  const void* a, const int a_ld,
                  void* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<float2*>(b));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ctrmm)>("cblas_ctrmm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + b_size * sizeof(float2))) {
+    invalidate_resident_copies(b, b_size * sizeof(float2));
+    return host_routine(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a, a_ld, b, b_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(b), b_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<float2*>(b));
   auto queue_cl = queue();
   auto s = clblast::Trmm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4457,23 +5365,27 @@ void cblas_ctrmm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  b_buffer.Read(queue, b_size, reinterpret_cast<float2*>(b));
+  read_buffer(queue, b_buffer, b_size, reinterpret_cast<float2*>(b));
 }
 void cblas_ztrmm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int m, const int n,
                  const void* alpha,
                  const void* a, const int a_ld,
                  void* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<double2*>(b));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ztrmm)>("cblas_ztrmm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + b_size * sizeof(double2))) {
+    invalidate_resident_copies(b, b_size * sizeof(double2));
+    return host_routine(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a, a_ld, b, b_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(b), b_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<double2*>(b));
   auto queue_cl = queue();
   auto s = clblast::Trmm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4488,7 +5400,7 @@ void cblas_ztrmm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  b_buffer.Read(queue, b_size, reinterpret_cast<double2*>(b));
+  read_buffer(queue, b_buffer, b_size, reinterpret_cast<double2*>(b));
 }
 
 // TRSM
@@ -4497,16 +5409,20 @@ void cblas_strsm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const float alpha,
                  const float* a, const int a_ld,
                  float* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto b_buffer = clblast::Buffer<float>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<float*>(b));
+  static const auto host_routine = get_host_routine<decltype(&cblas_strsm)>("cblas_strsm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float) + b_size * sizeof(float))) {
+    invalidate_resident_copies(b, b_size * sizeof(float));
+    return host_routine(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a, a_ld, b, b_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto b_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(b), b_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<float*>(b));
   auto queue_cl = queue();
   auto s = clblast::Trsm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4521,23 +5437,27 @@ void cblas_strsm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  b_buffer.Read(queue, b_size, reinterpret_cast<float*>(b));
+  read_buffer(queue, b_buffer, b_size, reinterpret_cast<float*>(b));
 }
 void cblas_dtrsm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int m, const int n,
                  const double alpha,
                  const double* a, const int a_ld,
                  double* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto b_buffer = clblast::Buffer<double>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<double*>(b));
+  static const auto host_routine = get_host_routine<decltype(&cblas_dtrsm)>("cblas_dtrsm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double) + b_size * sizeof(double))) {
+    invalidate_resident_copies(b, b_size * sizeof(double));
+    return host_routine(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a, a_ld, b, b_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto b_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(b), b_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<double*>(b));
   auto queue_cl = queue();
   auto s = clblast::Trsm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4552,23 +5472,27 @@ void cblas_dtrsm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  b_buffer.Read(queue, b_size, reinterpret_cast<double*>(b));
+  read_buffer(queue, b_buffer, b_size, reinterpret_cast<double*>(b));
 }
 void cblas_ctrsm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int m, const int n,
                  const void* alpha,
                  const void* a, const int a_ld,
                  void* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<float2*>(b));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ctrsm)>("cblas_ctrsm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(float2) + b_size * sizeof(float2))) {
+    invalidate_resident_copies(b, b_size * sizeof(float2));
+    return host_routine(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a, a_ld, b, b_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(b), b_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<float2*>(b));
   auto queue_cl = queue();
   auto s = clblast::Trsm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4583,23 +5507,27 @@ void cblas_ctrsm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  b_buffer.Read(queue, b_size, reinterpret_cast<float2*>(b));
+  read_buffer(queue, b_buffer, b_size, reinterpret_cast<float2*>(b));
 }
 void cblas_ztrsm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
                  const int m, const int n,
                  const void* alpha,
                  const void* a, const int a_ld,
                  void* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<double2*>(b));
+  static const auto host_routine = get_host_routine<decltype(&cblas_ztrsm)>("cblas_ztrsm");
+  if (run_on_host(host_routine != nullptr, a_size * sizeof(double2) + b_size * sizeof(double2))) {
+    invalidate_resident_copies(b, b_size * sizeof(double2));
+    return host_routine(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a, a_ld, b, b_ld);
+  }
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(b), b_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<double2*>(b));
   auto queue_cl = queue();
   auto s = clblast::Trsm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4614,7 +5542,7 @@ void cblas_ztrsm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  b_buffer.Read(queue, b_size, reinterpret_cast<double2*>(b));
+  read_buffer(queue, b_buffer, b_size, reinterpret_cast<double2*>(b));
 }
 
 // =================================================================================================
@@ -4628,20 +5556,20 @@ void cblas_shad(const int n,
                 const float* y, const int y_inc,
                 const float beta,
                 float* z, const int z_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto z_size = n * z_inc;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  auto z_buffer = clblast::Buffer<float>(context, z_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float*>(y));
-  z_buffer.Write(queue, z_size, reinterpret_cast<float*>(z));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  auto z_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(z), z_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const float*>(y));
+  write_buffer(queue, z_buffer, z_size, reinterpret_cast<float*>(z));
   auto queue_cl = queue();
   auto s = clblast::Had(n,
                         alpha_cpp,
@@ -4653,7 +5581,7 @@ void cblas_shad(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  z_buffer.Read(queue, z_size, reinterpret_cast<float*>(z));
+  read_buffer(queue, z_buffer, z_size, reinterpret_cast<float*>(z));
 }
 void cblas_dhad(const int n,
                 const double alpha,
@@ -4661,20 +5589,20 @@ void cblas_dhad(const int n,
                 const double* y, const int y_inc,
                 const double beta,
                 double* z, const int z_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
-  const auto beta_cpp = beta;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto z_size = n * z_inc;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  auto z_buffer = clblast::Buffer<double>(context, z_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double*>(y));
-  z_buffer.Write(queue, z_size, reinterpret_cast<double*>(z));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  auto z_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(z), z_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const double*>(y));
+  write_buffer(queue, z_buffer, z_size, reinterpret_cast<double*>(z));
   auto queue_cl = queue();
   auto s = clblast::Had(n,
                         alpha_cpp,
@@ -4686,7 +5614,7 @@ void cblas_dhad(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  z_buffer.Read(queue, z_size, reinterpret_cast<double*>(z));
+  read_buffer(queue, z_buffer, z_size, reinterpret_cast<double*>(z));
 }
 void cblas_chad(const int n,
                 const void* alpha,
@@ -4694,20 +5622,20 @@ void cblas_chad(const int n,
                 const void* y, const int y_inc,
                 const void* beta,
                 void* z, const int z_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
-  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto z_size = n * z_inc;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  auto z_buffer = clblast::Buffer<float2>(context, z_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
-  z_buffer.Write(queue, z_size, reinterpret_cast<float2*>(z));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  auto z_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(z), z_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const float2*>(y));
+  write_buffer(queue, z_buffer, z_size, reinterpret_cast<float2*>(z));
   auto queue_cl = queue();
   auto s = clblast::Had(n,
                         alpha_cpp,
@@ -4719,7 +5647,7 @@ void cblas_chad(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  z_buffer.Read(queue, z_size, reinterpret_cast<float2*>(z));
+  read_buffer(queue, z_buffer, z_size, reinterpret_cast<float2*>(z));
 }
 void cblas_zhad(const int n,
                 const void* alpha,
@@ -4727,20 +5655,20 @@ void cblas_zhad(const int n,
                 const void* y, const int y_inc,
                 const void* beta,
                 void* z, const int z_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
-  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto z_size = n * z_inc;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  auto z_buffer = clblast::Buffer<double2>(context, z_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
-  z_buffer.Write(queue, z_size, reinterpret_cast<double2*>(z));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  auto z_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(z), z_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const double2*>(y));
+  write_buffer(queue, z_buffer, z_size, reinterpret_cast<double2*>(z));
   auto queue_cl = queue();
   auto s = clblast::Had(n,
                         alpha_cpp,
@@ -4752,7 +5680,203 @@ void cblas_zhad(const int n,
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  z_buffer.Read(queue, z_size, reinterpret_cast<double2*>(z));
+  read_buffer(queue, z_buffer, z_size, reinterpret_cast<double2*>(z));
+}
+
+// AXPBY
+void cblas_saxpby(const int n,
+                  const float alpha,
+                  const float* x, const int x_inc,
+                  const float beta,
+                  float* y, const int y_inc) {
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          beta_cpp,
+                          y_buffer(), 0, y_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float*>(y));
+}
+void cblas_daxpby(const int n,
+                  const double alpha,
+                  const double* x, const int x_inc,
+                  const double beta,
+                  double* y, const int y_inc) {
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          beta_cpp,
+                          y_buffer(), 0, y_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double*>(y));
+}
+void cblas_caxpby(const int n,
+                  const void* alpha,
+                  const void* x, const int x_inc,
+                  const void* beta,
+                  void* y, const int y_inc) {
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          beta_cpp,
+                          y_buffer(), 0, y_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<float2*>(y));
+}
+void cblas_zaxpby(const int n,
+                  const void* alpha,
+                  const void* x, const int x_inc,
+                  const void* beta,
+                  void* y, const int y_inc) {
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(y), y_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double2*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          beta_cpp,
+                          y_buffer(), 0, y_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, y_buffer, y_size, reinterpret_cast<double2*>(y));
+}
+
+// SET
+void cblas_sset(const int n,
+                const float alpha,
+                float* x, const int x_inc) {
+  const auto x_size = n * x_inc;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
+  auto queue_cl = queue();
+  auto s = clblast::Set(n,
+                        alpha_cpp,
+                        x_buffer(), 0, x_inc,
+                        &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float*>(x));
+}
+void cblas_dset(const int n,
+                const double alpha,
+                double* x, const int x_inc) {
+  const auto x_size = n * x_inc;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
+  auto queue_cl = queue();
+  auto s = clblast::Set(n,
+                        alpha_cpp,
+                        x_buffer(), 0, x_inc,
+                        &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double*>(x));
+}
+void cblas_cset(const int n,
+                const void* alpha,
+                void* x, const int x_inc) {
+  const auto x_size = n * x_inc;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  auto x_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(x), x_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
+  auto queue_cl = queue();
+  auto s = clblast::Set(n,
+                        alpha_cpp,
+                        x_buffer(), 0, x_inc,
+                        &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<float2*>(x));
+}
+void cblas_zset(const int n,
+                const void* alpha,
+                void* x, const int x_inc) {
+  const auto x_size = n * x_inc;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  auto x_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(x), x_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
+  auto queue_cl = queue();
+  auto s = clblast::Set(n,
+                        alpha_cpp,
+                        x_buffer(), 0, x_inc,
+                        &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, x_buffer, x_size, reinterpret_cast<double2*>(x));
 }
 
 // OMATCOPY
@@ -4761,16 +5885,16 @@ void cblas_somatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transp
                      const float alpha,
                      const float* a, const int a_ld,
                      float* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * b_ld : m * b_ld;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto b_buffer = clblast::Buffer<float>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<float*>(b));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  auto b_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(b), b_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<float*>(b));
   auto queue_cl = queue();
   auto s = clblast::Omatcopy(static_cast<clblast::Layout>(layout),
                              static_cast<clblast::Transpose>(a_transpose),
@@ -4782,23 +5906,23 @@ void cblas_somatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transp
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  b_buffer.Read(queue, b_size, reinterpret_cast<float*>(b));
+  read_buffer(queue, b_buffer, b_size, reinterpret_cast<float*>(b));
 }
 void cblas_domatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                      const int m, const int n,
                      const double alpha,
                      const double* a, const int a_ld,
                      double* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = alpha;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * b_ld : m * b_ld;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto b_buffer = clblast::Buffer<double>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<double*>(b));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = alpha;
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  auto b_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(b), b_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<double*>(b));
   auto queue_cl = queue();
   auto s = clblast::Omatcopy(static_cast<clblast::Layout>(layout),
                              static_cast<clblast::Transpose>(a_transpose),
@@ -4810,23 +5934,23 @@ void cblas_domatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transp
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  b_buffer.Read(queue, b_size, reinterpret_cast<double*>(b));
+  read_buffer(queue, b_buffer, b_size, reinterpret_cast<double*>(b));
 }
 void cblas_comatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                      const int m, const int n,
                      const void* alpha,
                      const void* a, const int a_ld,
                      void* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * b_ld : m * b_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<float2*>(b));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  auto a_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(b), b_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const float2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<float2*>(b));
   auto queue_cl = queue();
   auto s = clblast::Omatcopy(static_cast<clblast::Layout>(layout),
                              static_cast<clblast::Transpose>(a_transpose),
@@ -4838,23 +5962,23 @@ void cblas_comatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transp
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  b_buffer.Read(queue, b_size, reinterpret_cast<float2*>(b));
+  read_buffer(queue, b_buffer, b_size, reinterpret_cast<float2*>(b));
 }
 void cblas_zomatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                      const int m, const int n,
                      const void* alpha,
                      const void* a, const int a_ld,
                      void* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
-  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * b_ld : m * b_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<double2*>(b));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  auto a_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(b), b_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<const double2*>(a));
+  write_buffer(queue, b_buffer, b_size, reinterpret_cast<double2*>(b));
   auto queue_cl = queue();
   auto s = clblast::Omatcopy(static_cast<clblast::Layout>(layout),
                              static_cast<clblast::Transpose>(a_transpose),
@@ -4866,22 +5990,22 @@ void cblas_zomatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transp
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  b_buffer.Read(queue, b_size, reinterpret_cast<double2*>(b));
+  read_buffer(queue, b_buffer, b_size, reinterpret_cast<double2*>(b));
 }
 
 // IM2COL
 void cblas_sim2col(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w,
                    const float* im,
                    float* col) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto im_size = height * width * channels;
   const auto col_size = height * width * channels;
-  auto im_buffer = clblast::Buffer<float>(context, im_size);
-  auto col_buffer = clblast::Buffer<float>(context, col_size);
-  im_buffer.Write(queue, im_size, reinterpret_cast<const float*>(im));
-  col_buffer.Write(queue, col_size, reinterpret_cast<float*>(col));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto im_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(im), im_size);
+  auto col_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(col), col_size);
+  write_buffer(queue, im_buffer, im_size, reinterpret_cast<const float*>(im));
+  write_buffer(queue, col_buffer, col_size, reinterpret_cast<float*>(col));
   auto queue_cl = queue();
   auto s = clblast::Im2col<float>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
                                   im_buffer(), 0,
@@ -4890,20 +6014,20 @@ void cblas_sim2col(const int channels, const int height, const int width, const
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  col_buffer.Read(queue, col_size, reinterpret_cast<float*>(col));
+  read_buffer(queue, col_buffer, col_size, reinterpret_cast<float*>(col));
 }
 void cblas_dim2col(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w,
                    const double* im,
                    double* col) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto im_size = height * width * channels;
   const auto col_size = height * width * channels;
-  auto im_buffer = clblast::Buffer<double>(context, im_size);
-  auto col_buffer = clblast::Buffer<double>(context, col_size);
-  im_buffer.Write(queue, im_size, reinterpret_cast<const double*>(im));
-  col_buffer.Write(queue, col_size, reinterpret_cast<double*>(col));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto im_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(im), im_size);
+  auto col_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(col), col_size);
+  write_buffer(queue, im_buffer, im_size, reinterpret_cast<const double*>(im));
+  write_buffer(queue, col_buffer, col_size, reinterpret_cast<double*>(col));
   auto queue_cl = queue();
   auto s = clblast::Im2col<double>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
                                    im_buffer(), 0,
@@ -4912,20 +6036,20 @@ void cblas_dim2col(const int channels, const int height, const int width, const
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  col_buffer.Read(queue, col_size, reinterpret_cast<double*>(col));
+  read_buffer(queue, col_buffer, col_size, reinterpret_cast<double*>(col));
 }
 void cblas_cim2col(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w,
                    const void* im,
                    void* col) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto im_size = height * width * channels;
   const auto col_size = height * width * channels;
-  auto im_buffer = clblast::Buffer<float2>(context, im_size);
-  auto col_buffer = clblast::Buffer<float2>(context, col_size);
-  im_buffer.Write(queue, im_size, reinterpret_cast<const float2*>(im));
-  col_buffer.Write(queue, col_size, reinterpret_cast<float2*>(col));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto im_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(im), im_size);
+  auto col_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(col), col_size);
+  write_buffer(queue, im_buffer, im_size, reinterpret_cast<const float2*>(im));
+  write_buffer(queue, col_buffer, col_size, reinterpret_cast<float2*>(col));
   auto queue_cl = queue();
   auto s = clblast::Im2col<float2>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
                                    im_buffer(), 0,
@@ -4934,20 +6058,20 @@ void cblas_cim2col(const int channels, const int height, const int width, const
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  col_buffer.Read(queue, col_size, reinterpret_cast<float2*>(col));
+  read_buffer(queue, col_buffer, col_size, reinterpret_cast<float2*>(col));
 }
 void cblas_zim2col(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w,
                    const void* im,
                    void* col) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
   const auto im_size = height * width * channels;
   const auto col_size = height * width * channels;
-  auto im_buffer = clblast::Buffer<double2>(context, im_size);
-  auto col_buffer = clblast::Buffer<double2>(context, col_size);
-  im_buffer.Write(queue, im_size, reinterpret_cast<const double2*>(im));
-  col_buffer.Write(queue, col_size, reinterpret_cast<double2*>(col));
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto im_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(im), im_size);
+  auto col_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(col), col_size);
+  write_buffer(queue, im_buffer, im_size, reinterpret_cast<const double2*>(im));
+  write_buffer(queue, col_buffer, col_size, reinterpret_cast<double2*>(col));
   auto queue_cl = queue();
   auto s = clblast::Im2col<double2>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
                                     im_buffer(), 0,
@@ -4956,7 +6080,249 @@ void cblas_zim2col(const int channels, const int height, const int width, const
   if (s != clblast::StatusCode::kSuccess) {
     throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
   }
-  col_buffer.Read(queue, col_size, reinterpret_cast<double2*>(col));
+  read_buffer(queue, col_buffer, col_size, reinterpret_cast<double2*>(col));
+}
+
+// COL2IM
+void cblas_scol2im(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w,
+                   const float* col,
+                   float* im) {
+  const auto col_size = ((height + 2 * pad_h - dilation_h * (kernel_h - 1) - 1) / stride_h + 1) * ((width + 2 * pad_w - dilation_w * (kernel_w - 1) - 1) / stride_w + 1) * kernel_h * kernel_w * channels;
+  const auto im_size = height * width * channels;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto col_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(col), col_size);
+  auto im_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(im), im_size);
+  write_buffer(queue, col_buffer, col_size, reinterpret_cast<const float*>(col));
+  write_buffer(queue, im_buffer, im_size, reinterpret_cast<float*>(im));
+  auto queue_cl = queue();
+  auto s = clblast::Col2im<float>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                  col_buffer(), 0,
+                                  im_buffer(), 0,
+                                  &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, im_buffer, im_size, reinterpret_cast<float*>(im));
+}
+void cblas_dcol2im(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w,
+                   const double* col,
+                   double* im) {
+  const auto col_size = ((height + 2 * pad_h - dilation_h * (kernel_h - 1) - 1) / stride_h + 1) * ((width + 2 * pad_w - dilation_w * (kernel_w - 1) - 1) / stride_w + 1) * kernel_h * kernel_w * channels;
+  const auto im_size = height * width * channels;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto col_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(col), col_size);
+  auto im_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(im), im_size);
+  write_buffer(queue, col_buffer, col_size, reinterpret_cast<const double*>(col));
+  write_buffer(queue, im_buffer, im_size, reinterpret_cast<double*>(im));
+  auto queue_cl = queue();
+  auto s = clblast::Col2im<double>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                   col_buffer(), 0,
+                                   im_buffer(), 0,
+                                   &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, im_buffer, im_size, reinterpret_cast<double*>(im));
+}
+void cblas_ccol2im(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w,
+                   const void* col,
+                   void* im) {
+  const auto col_size = ((height + 2 * pad_h - dilation_h * (kernel_h - 1) - 1) / stride_h + 1) * ((width + 2 * pad_w - dilation_w * (kernel_w - 1) - 1) / stride_w + 1) * kernel_h * kernel_w * channels;
+  const auto im_size = height * width * channels;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto col_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(col), col_size);
+  auto im_buffer = create_buffer<float2>(context, queue, reinterpret_cast<const float2*>(im), im_size);
+  write_buffer(queue, col_buffer, col_size, reinterpret_cast<const float2*>(col));
+  write_buffer(queue, im_buffer, im_size, reinterpret_cast<float2*>(im));
+  auto queue_cl = queue();
+  auto s = clblast::Col2im<float2>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                   col_buffer(), 0,
+                                   im_buffer(), 0,
+                                   &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, im_buffer, im_size, reinterpret_cast<float2*>(im));
+}
+void cblas_zcol2im(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w,
+                   const void* col,
+                   void* im) {
+  const auto col_size = ((height + 2 * pad_h - dilation_h * (kernel_h - 1) - 1) / stride_h + 1) * ((width + 2 * pad_w - dilation_w * (kernel_w - 1) - 1) / stride_w + 1) * kernel_h * kernel_w * channels;
+  const auto im_size = height * width * channels;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto col_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(col), col_size);
+  auto im_buffer = create_buffer<double2>(context, queue, reinterpret_cast<const double2*>(im), im_size);
+  write_buffer(queue, col_buffer, col_size, reinterpret_cast<const double2*>(col));
+  write_buffer(queue, im_buffer, im_size, reinterpret_cast<double2*>(im));
+  auto queue_cl = queue();
+  auto s = clblast::Col2im<double2>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w,
+                                    col_buffer(), 0,
+                                    im_buffer(), 0,
+                                    &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, im_buffer, im_size, reinterpret_cast<double2*>(im));
+}
+
+// DOTNRM2ASUM
+void cblas_sdotnrm2asum(const int n,
+                        const float* x, const int x_inc,
+                        const float* y, const int y_inc,
+                        float* results) {
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto results_size = 3;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(y), y_size);
+  auto results_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(results), results_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const float*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const float*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Dotnrm2asum<float>(n,
+                                       results_buffer(), 0,
+                                       x_buffer(), 0, x_inc,
+                                       y_buffer(), 0, y_inc,
+                                       &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, results_buffer, results_size, reinterpret_cast<float*>(results));
+}
+void cblas_ddotnrm2asum(const int n,
+                        const double* x, const int x_inc,
+                        const double* y, const int y_inc,
+                        double* results) {
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto results_size = 3;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto x_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(y), y_size);
+  auto results_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(results), results_size);
+  write_buffer(queue, x_buffer, x_size, reinterpret_cast<const double*>(x));
+  write_buffer(queue, y_buffer, y_size, reinterpret_cast<const double*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Dotnrm2asum<double>(n,
+                                        results_buffer(), 0,
+                                        x_buffer(), 0, x_inc,
+                                        y_buffer(), 0, y_inc,
+                                        &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, results_buffer, results_size, reinterpret_cast<double*>(results));
+}
+
+// CONVGEMM
+void cblas_sconvgemm(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w, const int num_kernels, const int batch_count,
+                     const float* im,
+                     const float* kernel,
+                     float* result) {
+  const auto im_size = height * width * channels * batch_count;
+  const auto kernel_size = kernel_h * kernel_w * channels * num_kernels;
+  const auto result_size = ((height + 2 * pad_h - dilation_h * (kernel_h - 1) - 1) / stride_h + 1) * ((width + 2 * pad_w - dilation_w * (kernel_w - 1) - 1) / stride_w + 1) * num_kernels * batch_count;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto im_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(im), im_size);
+  auto kernel_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(kernel), kernel_size);
+  auto result_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(result), result_size);
+  write_buffer(queue, im_buffer, im_size, reinterpret_cast<const float*>(im));
+  write_buffer(queue, kernel_buffer, kernel_size, reinterpret_cast<const float*>(kernel));
+  write_buffer(queue, result_buffer, result_size, reinterpret_cast<float*>(result));
+  auto queue_cl = queue();
+  auto s = clblast::Convgemm<float>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count,
+                                    im_buffer(), 0,
+                                    kernel_buffer(), 0,
+                                    result_buffer(), 0,
+                                    &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, result_buffer, result_size, reinterpret_cast<float*>(result));
+}
+void cblas_dconvgemm(const int channels, const int height, const int width, const int kernel_h, const int kernel_w, const int pad_h, const int pad_w, const int stride_h, const int stride_w, const int dilation_h, const int dilation_w, const int num_kernels, const int batch_count,
+                     const double* im,
+                     const double* kernel,
+                     double* result) {
+  const auto im_size = height * width * channels * batch_count;
+  const auto kernel_size = kernel_h * kernel_w * channels * num_kernels;
+  const auto result_size = ((height + 2 * pad_h - dilation_h * (kernel_h - 1) - 1) / stride_h + 1) * ((width + 2 * pad_w - dilation_w * (kernel_w - 1) - 1) / stride_w + 1) * num_kernels * batch_count;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto im_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(im), im_size);
+  auto kernel_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(kernel), kernel_size);
+  auto result_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(result), result_size);
+  write_buffer(queue, im_buffer, im_size, reinterpret_cast<const double*>(im));
+  write_buffer(queue, kernel_buffer, kernel_size, reinterpret_cast<const double*>(kernel));
+  write_buffer(queue, result_buffer, result_size, reinterpret_cast<double*>(result));
+  auto queue_cl = queue();
+  auto s = clblast::Convgemm<double>(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count,
+                                     im_buffer(), 0,
+                                     kernel_buffer(), 0,
+                                     result_buffer(), 0,
+                                     &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, result_buffer, result_size, reinterpret_cast<double*>(result));
+}
+
+// POTRF
+void cblas_spotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                  const int n,
+                  float* a, const int a_ld) {
+  const auto a_size = n * a_ld;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<float>(context, queue, reinterpret_cast<const float*>(a), a_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<float*>(a));
+  auto queue_cl = queue();
+  auto s = clblast::Potrf<float>(static_cast<clblast::Layout>(layout),
+                                 static_cast<clblast::Triangle>(triangle),
+                                 n,
+                                 a_buffer(), 0, a_ld,
+                                 &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<float*>(a));
+}
+void cblas_dpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                  const int n,
+                  double* a, const int a_ld) {
+  const auto a_size = n * a_ld;
+  record_device_call();
+  auto queue = get_queue();
+  auto context = queue.GetContext();
+  auto a_buffer = create_buffer<double>(context, queue, reinterpret_cast<const double*>(a), a_size);
+  write_buffer(queue, a_buffer, a_size, reinterpret_cast<double*>(a));
+  auto queue_cl = queue();
+  auto s = clblast::Potrf<double>(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  n,
+                                  a_buffer(), 0, a_ld,
+                                  &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  read_buffer(queue, a_buffer, a_size, reinterpret_cast<double*>(a));
 }
 
 // =================================================================================================
@@ -0,0 +1,145 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the Fortran BLAS symbols (e.g. 'dgemm_') for the most important routines of
+// the Netlib API, such that Fortran code like reference LAPACK can be linked against CLBlast without
+// modifications. All arguments are passed by reference and the matrices are column-major. The
+// hidden string-length arguments of the character options are ignored, since only their first
+// character is used. The routines forward to their CBLAS counterparts in 'clblast_netlib_c.cpp'.
+//
+// =================================================================================================
+
+#include "clblast_netlib_c.h"
+
+// =================================================================================================
+
+// Converts the Fortran character options (case-insensitive) to the CBLAS enumerations
+CLBlastTranspose fortran_transpose(const char* option) {
+  switch (*option) {
+    case 'T': case 't': return CLBlastTransposeYes;
+    case 'C': case 'c': return CLBlastTransposeConjugate;
+    default: return CLBlastTransposeNo;
+  }
+}
+CLBlastTriangle fortran_triangle(const char* option) {
+  return (*option == 'L' || *option == 'l') ? CLBlastTriangleLower : CLBlastTriangleUpper;
+}
+CLBlastSide fortran_side(const char* option) {
+  return (*option == 'R' || *option == 'r') ? CLBlastSideRight : CLBlastSideLeft;
+}
+CLBlastDiagonal fortran_diagonal(const char* option) {
+  return (*option == 'U' || *option == 'u') ? CLBlastDiagonalUnit : CLBlastDiagonalNonUnit;
+}
+
+// =================================================================================================
+extern "C" {
+
+// GEMV
+void PUBLIC_API sgemv_(const char* trans, const int* m, const int* n, const float* alpha,
+                       const float* a, const int* lda, const float* x, const int* incx,
+                       const float* beta, float* y, const int* incy) {
+  cblas_sgemv(CLBlastLayoutColMajor, fortran_transpose(trans), *m, *n, *alpha, a, *lda, x, *incx,
+              *beta, y, *incy);
+}
+void PUBLIC_API dgemv_(const char* trans, const int* m, const int* n, const double* alpha,
+                       const double* a, const int* lda, const double* x, const int* incx,
+                       const double* beta, double* y, const int* incy) {
+  cblas_dgemv(CLBlastLayoutColMajor, fortran_transpose(trans), *m, *n, *alpha, a, *lda, x, *incx,
+              *beta, y, *incy);
+}
+
+// GEMM
+void PUBLIC_API sgemm_(const char* transa, const char* transb,
+                       const int* m, const int* n, const int* k, const float* alpha,
+                       const float* a, const int* lda, const float* b, const int* ldb,
+                       const float* beta, float* c, const int* ldc) {
+  cblas_sgemm(CLBlastLayoutColMajor, fortran_transpose(transa), fortran_transpose(transb),
+              *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+}
+void PUBLIC_API dgemm_(const char* transa, const char* transb,
+                       const int* m, const int* n, const int* k, const double* alpha,
+                       const double* a, const int* lda, const double* b, const int* ldb,
+                       const double* beta, double* c, const int* ldc) {
+  cblas_dgemm(CLBlastLayoutColMajor, fortran_transpose(transa), fortran_transpose(transb),
+              *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+}
+
+// SYMM
+void PUBLIC_API ssymm_(const char* side, const char* uplo, const int* m, const int* n,
+                       const float* alpha, const float* a, const int* lda,
+                       const float* b, const int* ldb, const float* beta, float* c, const int* ldc) {
+  cblas_ssymm(CLBlastLayoutColMajor, fortran_side(side), fortran_triangle(uplo),
+              *m, *n, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+}
+void PUBLIC_API dsymm_(const char* side, const char* uplo, const int* m, const int* n,
+                       const double* alpha, const double* a, const int* lda,
+                       const double* b, const int* ldb, const double* beta, double* c, const int* ldc) {
+  cblas_dsymm(CLBlastLayoutColMajor, fortran_side(side), fortran_triangle(uplo),
+              *m, *n, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+}
+
+// SYRK
+void PUBLIC_API ssyrk_(const char* uplo, const char* trans, const int* n, const int* k,
+                       const float* alpha, const float* a, const int* lda,
+                       const float* beta, float* c, const int* ldc) {
+  cblas_ssyrk(CLBlastLayoutColMajor, fortran_triangle(uplo), fortran_transpose(trans),
+              *n, *k, *alpha, a, *lda, *beta, c, *ldc);
+}
+void PUBLIC_API dsyrk_(const char* uplo, const char* trans, const int* n, const int* k,
+                       const double* alpha, const double* a, const int* lda,
+                       const double* beta, double* c, const int* ldc) {
+  cblas_dsyrk(CLBlastLayoutColMajor, fortran_triangle(uplo), fortran_transpose(trans),
+              *n, *k, *alpha, a, *lda, *beta, c, *ldc);
+}
+
+// SYR2K
+void PUBLIC_API ssyr2k_(const char* uplo, const char* trans, const int* n, const int* k,
+                        const float* alpha, const float* a, const int* lda,
+                        const float* b, const int* ldb, const float* beta, float* c, const int* ldc) {
+  cblas_ssyr2k(CLBlastLayoutColMajor, fortran_triangle(uplo), fortran_transpose(trans),
+               *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+}
+void PUBLIC_API dsyr2k_(const char* uplo, const char* trans, const int* n, const int* k,
+                        const double* alpha, const double* a, const int* lda,
+                        const double* b, const int* ldb, const double* beta, double* c, const int* ldc) {
+  cblas_dsyr2k(CLBlastLayoutColMajor, fortran_triangle(uplo), fortran_transpose(trans),
+               *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc);
+}
+
+// TRMM
+void PUBLIC_API strmm_(const char* side, const char* uplo, const char* transa, const char* diag,
+                       const int* m, const int* n, const float* alpha,
+                       const float* a, const int* lda, float* b, const int* ldb) {
+  cblas_strmm(CLBlastLayoutColMajor, fortran_side(side), fortran_triangle(uplo),
+              fortran_transpose(transa), fortran_diagonal(diag), *m, *n, *alpha, a, *lda, b, *ldb);
+}
+void PUBLIC_API dtrmm_(const char* side, const char* uplo, const char* transa, const char* diag,
+                       const int* m, const int* n, const double* alpha,
+                       const double* a, const int* lda, double* b, const int* ldb) {
+  cblas_dtrmm(CLBlastLayoutColMajor, fortran_side(side), fortran_triangle(uplo),
+              fortran_transpose(transa), fortran_diagonal(diag), *m, *n, *alpha, a, *lda, b, *ldb);
+}
+
+// TRSM
+void PUBLIC_API strsm_(const char* side, const char* uplo, const char* transa, const char* diag,
+                       const int* m, const int* n, const float* alpha,
+                       const float* a, const int* lda, float* b, const int* ldb) {
+  cblas_strsm(CLBlastLayoutColMajor, fortran_side(side), fortran_triangle(uplo),
+              fortran_transpose(transa), fortran_diagonal(diag), *m, *n, *alpha, a, *lda, b, *ldb);
+}
+void PUBLIC_API dtrsm_(const char* side, const char* uplo, const char* transa, const char* diag,
+                       const int* m, const int* n, const double* alpha,
+                       const double* a, const int* lda, double* b, const int* ldb) {
+  cblas_dtrsm(CLBlastLayoutColMajor, fortran_side(side), fortran_triangle(uplo),
+              fortran_transpose(transa), fortran_diagonal(diag), *m, *n, *alpha, a, *lda, b, *ldb);
+}
+
+} // extern "C"
+
+// =================================================================================================
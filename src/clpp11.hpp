@@ -37,13 +37,15 @@
 #define CLBLAST_CLPP11_H_
 
 // C++
-#include <algorithm> // std::copy
+#include <algorithm> // std::copy, std::any_of
 #include <string>    // std::string
 #include <vector>    // std::vector
 #include <memory>    // std::shared_ptr
 #include <numeric>   // std::accumulate
 #include <cstring>   // std::strlen
 #include <cstdio>    // fprintf, stderr
+#include <mutex>     // std::mutex
+#include <type_traits> // std::is_same
 
 // OpenCL
 #define CL_USE_DEPRECATED_OPENCL_1_1_APIS // to disable deprecation warnings
@@ -259,6 +261,7 @@ class Device {
   }
   std::string Vendor() const { return GetInfoString(CL_DEVICE_VENDOR); }
   std::string Name() const { return GetInfoString(CL_DEVICE_NAME); }
+  std::string DriverVersion() const { return GetInfoString(CL_DRIVER_VERSION); }
   std::string Type() const {
     auto type = GetInfo<cl_device_type>(CL_DEVICE_TYPE);
     switch(type) {
@@ -307,6 +310,21 @@ class Device {
   size_t MemoryClock() const { return 0; } // Not exposed in OpenCL
   size_t MemoryBusWidth() const { return 0; } // Not exposed in OpenCL
 
+  // Whether the device shares its physical memory with the host (e.g. integrated GPUs and CPUs),
+  // such that buffers over host pointers can be accessed without copies, and the minimum
+  // alignment in bytes of such host pointers
+  bool HasUnifiedMemory() const {
+    return IsCPU() || GetInfo<cl_bool>(CL_DEVICE_HOST_UNIFIED_MEMORY) == CL_TRUE;
+  }
+  size_t MemoryBaseAlignment() const {
+    return static_cast<size_t>(GetInfo<cl_uint>(CL_DEVICE_MEM_BASE_ADDR_ALIGN)) / 8; // in bits
+  }
+
+  // Whether the device supports images, and the maximum width and height of 2D images in texels
+  bool SupportsImages() const { return GetInfo<cl_bool>(CL_DEVICE_IMAGE_SUPPORT) == CL_TRUE; }
+  size_t MaxImage2DWidth() const { return GetInfo<size_t>(CL_DEVICE_IMAGE2D_MAX_WIDTH); }
+  size_t MaxImage2DHeight() const { return GetInfo<size_t>(CL_DEVICE_IMAGE2D_MAX_HEIGHT); }
+
   // Configuration-validity checks
   bool IsLocalMemoryValid(const cl_ulong local_mem_usage) const {
     return (local_mem_usage <= LocalMemSize());
@@ -322,6 +340,13 @@ class Device {
     return true;
   }
 
+  // Whether the device supports OpenCL C 2.0 device-side enqueue ('enqueue_kernel'): OpenCL 3.0
+  // devices without this optional feature report zero on-device queues
+  bool SupportsDeviceEnqueue() const {
+    if (VersionNumber() < 200) { return false; }
+    return GetInfo<cl_uint>(CL_DEVICE_MAX_ON_DEVICE_QUEUES) > 0;
+  }
+
   // Query for a specific type of device or brand
   bool IsCPU() const { return Type() == "CPU"; }
   bool IsGPU() const { return Type() == "GPU"; }
@@ -354,6 +379,25 @@ class Device {
     return std::string{"SM"} + std::to_string(GetInfo<cl_uint>(CL_DEVICE_COMPUTE_CAPABILITY_MAJOR_NV)) +
            std::string{"."} + std::to_string(GetInfo<cl_uint>(CL_DEVICE_COMPUTE_CAPABILITY_MINOR_NV));
   }
+  size_t AMDWavefrontWidth() const { // check for 'cl_amd_device_attribute_query' first
+    #ifndef CL_DEVICE_WAVEFRONT_WIDTH_AMD
+      #define CL_DEVICE_WAVEFRONT_WIDTH_AMD 0x4043
+    #endif
+    return static_cast<size_t>(GetInfo<cl_uint>(CL_DEVICE_WAVEFRONT_WIDTH_AMD));
+  }
+  size_t NVIDIAWarpSize() const { // check for 'cl_nv_device_attribute_query' first
+    #ifndef CL_DEVICE_WARP_SIZE_NV
+      #define CL_DEVICE_WARP_SIZE_NV 0x4003
+    #endif
+    return static_cast<size_t>(GetInfo<cl_uint>(CL_DEVICE_WARP_SIZE_NV));
+  }
+
+  // Retrieves the subgroup size through the above extensions (if present), zero if unknown
+  size_t SubgroupSize() const {
+    if (HasExtension("cl_amd_device_attribute_query")) { return AMDWavefrontWidth(); }
+    if (HasExtension("cl_nv_device_attribute_query")) { return NVIDIAWarpSize(); }
+    else { return 0; }
+  }
 
   // Retrieves the above extra information (if present)
   std::string GetExtraInfo() const {
@@ -362,6 +406,26 @@ class Device {
     else { return std::string{""}; }
   }
 
+  // Partitions the device by affinity domain: per NUMA node if supported, otherwise per next
+  // partitionable level (e.g. a cache level). Returns no sub-devices if the device can't be
+  // partitioned this way. The caller owns the sub-devices and has to release them.
+  std::vector<cl_device_id> CreateSubDevicesByAffinity() const {
+    const auto partitions = GetInfoVector<cl_device_partition_property>(CL_DEVICE_PARTITION_PROPERTIES);
+    if (std::find(partitions.begin(), partitions.end(),
+                  CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN) == partitions.end()) { return {}; }
+    const auto domains = GetInfo<cl_device_affinity_domain>(CL_DEVICE_PARTITION_AFFINITY_DOMAIN);
+    const auto domain = (domains & CL_DEVICE_AFFINITY_DOMAIN_NUMA) ?
+                        CL_DEVICE_AFFINITY_DOMAIN_NUMA : CL_DEVICE_AFFINITY_DOMAIN_NEXT_PARTITIONABLE;
+    const cl_device_partition_property properties[] = {
+      CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN, static_cast<cl_device_partition_property>(domain), 0
+    };
+    auto num_devices = cl_uint{0};
+    if (clCreateSubDevices(device_, properties, 0, nullptr, &num_devices) != CL_SUCCESS) { return {}; }
+    auto sub_devices = std::vector<cl_device_id>(num_devices);
+    CheckError(clCreateSubDevices(device_, properties, num_devices, sub_devices.data(), nullptr));
+    return sub_devices;
+  }
+
   // Accessor to the private data-member
   const RawDeviceID& operator()() const { return device_; }
  private:
@@ -434,6 +498,9 @@ using ContextPointer = cl_context*;
 
 // =================================================================================================
 
+// Raw program type
+using RawProgram = cl_program;
+
 // C++11 version of 'cl_program'.
 class Program {
  public:
@@ -472,9 +539,14 @@ class Program {
     CLCudaAPIError::Check(status2, "clCreateProgramWithBinary");
   }
 
-  // Compiles the device program and checks whether or not there are any warnings/errors
+  // Compiles the device program and checks whether or not there are any warnings/errors. The
+  // programs are compiled as OpenCL C 1.1, unless another standard is given in the options.
   void Build(const Device &device, std::vector<std::string> &options) {
-    options.push_back("-cl-std=CL1.1");
+    const auto has_standard = std::any_of(options.begin(), options.end(),
+                                          [](const std::string &option) {
+                                            return option.find("-cl-std=") != std::string::npos;
+                                          });
+    if (!has_standard) { options.push_back("-cl-std=CL1.1"); }
     auto options_string = std::accumulate(options.begin(), options.end(), std::string{" "});
     const cl_device_id dev = device();
     CheckError(clBuildProgram(*program_, 1, &dev, options_string.c_str(), nullptr, nullptr));
@@ -507,8 +579,9 @@ class Program {
     return result;
   }
 
-  // Accessor to the private data-member
-  const cl_program& operator()() const { return *program_; }
+  // Accessors to the private data-member
+  const RawProgram& operator()() const { return *program_; }
+  RawProgram GetRawProgram() const { return *program_; }
  private:
   std::shared_ptr<cl_program> program_;
 };
@@ -547,6 +620,25 @@ class Queue {
     CheckError(clFinish(*queue_));
   }
 
+  // Enqueues a marker: the event completes when all previously enqueued commands have completed
+  void EnqueueMarker(Event &event) const {
+    CheckError(clEnqueueMarker(*queue_, event.pointer()));
+  }
+
+  // Makes all commands enqueued after this call wait for the completion of the given event, which
+  // can originate from another queue in the same context
+  void EnqueueWaitForEvent(const Event &event) const {
+    CheckError(clEnqueueWaitForEvents(*queue_, 1, &event()));
+  }
+
+  // Whether or not the queue executes its commands out-of-order
+  bool IsOutOfOrder() const {
+    auto properties = cl_command_queue_properties{0};
+    CheckError(clGetCommandQueueInfo(*queue_, CL_QUEUE_PROPERTIES, sizeof(properties), &properties,
+                                     nullptr));
+    return (properties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) != 0;
+  }
+
   // Retrieves the corresponding context or device
   Context GetContext() const {
     auto bytes = size_t{0};
@@ -600,6 +692,81 @@ class BufferHost {
 
 // =================================================================================================
 
+// Pool of pinned host memory to stage transfers between pageable host memory and device buffers.
+// The memory is allocated by the OpenCL implementation (CL_MEM_ALLOC_HOST_PTR) and stays mapped,
+// which typically makes it page-locked such that it is transferred at full bandwidth. There are two
+// chunks: copying one chunk on the host overlaps with the transfer of the other one.
+class StagingPool {
+ public:
+
+  // Regular constructor with memory management, the queue is used to map and unmap the chunks
+  explicit StagingPool(const Context &context, const Queue &queue,
+                       const size_t chunk_bytes = 4*1024*1024):
+      state_(new State, [](State* s) {
+        for (auto &chunk : s->chunks) {
+          if (chunk.event) { CheckErrorDtor(clWaitForEvents(1, &chunk.event)); }
+          if (chunk.event) { CheckErrorDtor(clReleaseEvent(chunk.event)); }
+          if (chunk.host) {
+            CheckErrorDtor(clEnqueueUnmapMemObject(s->queue(), chunk.buffer, chunk.host, 0, nullptr, nullptr));
+            CheckErrorDtor(clFinish(s->queue()));
+          }
+          if (chunk.buffer) { CheckErrorDtor(clReleaseMemObject(chunk.buffer)); }
+        }
+        delete s;
+      }) {
+    if (chunk_bytes == 0) { throw LogicError("StagingPool: chunk size cannot be zero"); }
+    state_->queue = queue;
+    state_->chunk_bytes = chunk_bytes;
+    for (auto &chunk : state_->chunks) {
+      auto status = CL_SUCCESS;
+      chunk.buffer = clCreateBuffer(context(), CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR,
+                                    chunk_bytes, nullptr, &status);
+      CLCudaAPIError::Check(status, "clCreateBuffer");
+      chunk.host = clEnqueueMapBuffer(queue(), chunk.buffer, CL_TRUE, CL_MAP_READ | CL_MAP_WRITE,
+                                      0, chunk_bytes, 0, nullptr, nullptr, &status);
+      CLCudaAPIError::Check(status, "clEnqueueMapBuffer");
+    }
+  }
+
+  // Retrieves the size of a chunk in bytes
+  size_t ChunkBytes() const { return state_->chunk_bytes; }
+
+  // Waits until the previous transfer of a chunk has completed and returns its host memory
+  void* AcquireChunk(const size_t id) {
+    auto &chunk = state_->chunks[id % 2];
+    if (chunk.event) {
+      CheckError(clWaitForEvents(1, &chunk.event));
+      CheckError(clReleaseEvent(chunk.event));
+      chunk.event = nullptr;
+    }
+    return chunk.host;
+  }
+
+  // Records the event of a transfer from or to a chunk, the pool takes ownership of the event
+  void ReleaseChunk(const size_t id, const cl_event event) {
+    state_->chunks[id % 2].event = event;
+  }
+
+  // Staged transfers lock the pool, such that it can be shared among threads
+  std::mutex& Mutex() { return state_->mutex; }
+
+ private:
+  struct Chunk {
+    cl_mem buffer = nullptr;
+    void* host = nullptr;
+    cl_event event = nullptr;
+  };
+  struct State {
+    Queue queue{nullptr};
+    size_t chunk_bytes = 0;
+    Chunk chunks[2];
+    std::mutex mutex;
+  };
+  std::shared_ptr<State> state_;
+};
+
+// =================================================================================================
+
 // Enumeration of buffer access types
 enum class BufferAccess { kReadOnly, kWriteOnly, kReadWrite, kNotOwned };
 
@@ -615,6 +782,13 @@ class Buffer {
     *buffer_ = buffer;
   }
 
+  // Constructor based on a shared OpenCL buffer: memory management is handled by the deleter of the
+  // shared pointer (e.g. to return the buffer to a memory pool)
+  explicit Buffer(std::shared_ptr<cl_mem> buffer):
+      buffer_(std::move(buffer)),
+      access_(BufferAccess::kReadWrite) {
+  }
+
   // Regular constructor with memory management. If this class does not own the buffer object, then
   // the memory will not be freed automatically afterwards. If the size is set to 0, this will
   // become a stub containing a nullptr
@@ -671,6 +845,48 @@ class Buffer {
     ReadAsync(queue, size, host.data(), offset);
   }
 
+  // Copies a column-major 'one' by 'two' block from the device buffer (stored without padding) to
+  // host memory with leading dimension 'host_ld', a-synchronously
+  void ReadRectAsync(const Queue &queue, const size_t one, const size_t two, T* host,
+                     const size_t host_ld) const {
+    if (access_ == BufferAccess::kWriteOnly) {
+      throw LogicError("Buffer: reading from a write-only buffer");
+    }
+    const size_t origin[3] = {0, 0, 0};
+    const size_t region[3] = {one*sizeof(T), two, 1};
+    CheckError(clEnqueueReadBufferRect(queue(), *buffer_, CL_FALSE, origin, origin, region,
+                                       one*sizeof(T), 0, host_ld*sizeof(T), 0, host,
+                                       0, nullptr, nullptr));
+  }
+
+  // Copies from device to host through a pool of pinned memory in chunks, the transfer of the next
+  // chunk overlaps with the host copy of the current one. This returns when 'host' is filled.
+  void ReadStaged(const Queue &queue, const size_t size, T* host, StagingPool &pool,
+                  const size_t offset = 0) const {
+    if (access_ == BufferAccess::kWriteOnly) {
+      throw LogicError("Buffer: reading from a write-only buffer");
+    }
+    std::lock_guard<std::mutex> lock(pool.Mutex());
+    const auto bytes = size*sizeof(T);
+    const auto num_chunks = (bytes + pool.ChunkBytes() - 1) / pool.ChunkBytes();
+    const auto enqueue_read = [&](const size_t chunk_id) {
+      const auto chunk_offset = chunk_id * pool.ChunkBytes();
+      const auto chunk_bytes = std::min(pool.ChunkBytes(), bytes - chunk_offset);
+      auto chunk_event = cl_event{nullptr};
+      CheckError(clEnqueueReadBuffer(queue(), *buffer_, CL_FALSE, offset*sizeof(T) + chunk_offset,
+                                     chunk_bytes, pool.AcquireChunk(chunk_id), 0, nullptr, &chunk_event));
+      pool.ReleaseChunk(chunk_id, chunk_event);
+    };
+    if (num_chunks > 0) { enqueue_read(0); }
+    for (auto chunk_id = size_t{0}; chunk_id < num_chunks; ++chunk_id) {
+      if (chunk_id + 1 < num_chunks) { enqueue_read(chunk_id + 1); }
+      const auto chunk_offset = chunk_id * pool.ChunkBytes();
+      const auto chunk_bytes = std::min(pool.ChunkBytes(), bytes - chunk_offset);
+      const auto staging = pool.AcquireChunk(chunk_id);
+      std::memcpy(reinterpret_cast<char*>(host) + chunk_offset, staging, chunk_bytes);
+    }
+  }
+
   // Copies from device to host: reading the device buffer
   void Read(const Queue &queue, const size_t size, T* host, const size_t offset = 0) const {
     ReadAsync(queue, size, host, offset);
@@ -705,6 +921,51 @@ class Buffer {
     WriteAsync(queue, size, host.data(), offset);
   }
 
+  // Copies a column-major 'one' by 'two' block from host memory with leading dimension 'host_ld' to
+  // the device buffer (stored without padding), a-synchronously
+  void WriteRectAsync(const Queue &queue, const size_t one, const size_t two, const T* host,
+                      const size_t host_ld) {
+    if (access_ == BufferAccess::kReadOnly) {
+      throw LogicError("Buffer: writing to a read-only buffer");
+    }
+    if (GetSize() < one*two*sizeof(T)) {
+      throw LogicError("Buffer: target device buffer is too small");
+    }
+    const size_t origin[3] = {0, 0, 0};
+    const size_t region[3] = {one*sizeof(T), two, 1};
+    CheckError(clEnqueueWriteBufferRect(queue(), *buffer_, CL_FALSE, origin, origin, region,
+                                        one*sizeof(T), 0, host_ld*sizeof(T), 0, host,
+                                        0, nullptr, nullptr));
+  }
+
+  // Copies from host to device through a pool of pinned memory in chunks. The host array can be
+  // re-used right away, the transfer of the last chunk completes a-synchronously (see 'event').
+  void WriteStagedAsync(const Queue &queue, const size_t size, const T* host, StagingPool &pool,
+                        const size_t offset = 0, EventPointer event = nullptr) {
+    if (access_ == BufferAccess::kReadOnly) {
+      throw LogicError("Buffer: writing to a read-only buffer");
+    }
+    if (GetSize() < (offset+size)*sizeof(T)) {
+      throw LogicError("Buffer: target device buffer is too small");
+    }
+    std::lock_guard<std::mutex> lock(pool.Mutex());
+    const auto bytes = size*sizeof(T);
+    auto last_event = cl_event{nullptr};
+    for (auto chunk_id = size_t{0}; chunk_id * pool.ChunkBytes() < bytes; ++chunk_id) {
+      const auto chunk_offset = chunk_id * pool.ChunkBytes();
+      const auto chunk_bytes = std::min(pool.ChunkBytes(), bytes - chunk_offset);
+      auto staging = pool.AcquireChunk(chunk_id);
+      std::memcpy(staging, reinterpret_cast<const char*>(host) + chunk_offset, chunk_bytes);
+      CheckError(clEnqueueWriteBuffer(queue(), *buffer_, CL_FALSE, offset*sizeof(T) + chunk_offset,
+                                      chunk_bytes, staging, 0, nullptr, &last_event));
+      pool.ReleaseChunk(chunk_id, last_event);
+    }
+    if (event != nullptr) {
+      if (last_event) { CheckError(clRetainEvent(last_event)); }
+      *event = last_event;
+    }
+  }
+
   // Copies from host to device: writing the device buffer
   void Write(const Queue &queue, const size_t size, const T* host, const size_t offset = 0) {
     WriteAsync(queue, size, host, offset);
@@ -749,10 +1010,13 @@ class Buffer {
 // C++11 version of 'cl_kernel'
 class Kernel {
  public:
+  Kernel() = default;
 
   // Constructor based on the regular OpenCL data-type: memory management is handled elsewhere
   explicit Kernel(const cl_kernel kernel):
-      kernel_(new cl_kernel) {
+      kernel_(new cl_kernel),
+      local_mem_usage_(std::make_shared<LocalMemUsageInfo>()),
+      arguments_(std::make_shared<std::vector<Argument>>()) {
     *kernel_ = kernel;
   }
 
@@ -761,16 +1025,24 @@ class Kernel {
       kernel_(new cl_kernel, [](cl_kernel* k) {
         if (*k) { CheckErrorDtor(clReleaseKernel(*k)); }
         delete k;
-      }) {
+      }),
+      local_mem_usage_(std::make_shared<LocalMemUsageInfo>()),
+      arguments_(std::make_shared<std::vector<Argument>>()) {
     auto status = CL_SUCCESS;
     *kernel_ = clCreateKernel(program(), name.c_str(), &status);
     CLCudaAPIError::Check(status, "clCreateKernel");
   }
 
-  // Sets a kernel argument at the indicated position
+  // Sets a kernel argument at the indicated position. The value is also stored, such that the
+  // kernel can be recorded into a command graph with its current arguments.
   template <typename T>
   void SetArgument(const size_t index, const T &value) {
     CheckError(clSetKernelArg(*kernel_, static_cast<cl_uint>(index), sizeof(T), &value));
+    if (arguments_->size() <= index) { arguments_->resize(index + 1); }
+    auto &argument = (*arguments_)[index];
+    const auto bytes = reinterpret_cast<const char*>(&value);
+    argument.value.assign(bytes, bytes + sizeof(T));
+    argument.is_buffer = std::is_same<T, cl_mem>::value;
   }
   template <typename T>
   void SetArgument(const size_t index, Buffer<T> &value) {
@@ -784,13 +1056,17 @@ class Kernel {
     SetArgumentsRecursive(0, args...);
   }
 
-  // Retrieves the amount of local memory used per work-group for this kernel
+  // Retrieves the amount of local memory used per work-group for this kernel. The result is
+  // stored in the kernel object (shared among copies), such that it is only queried once.
   unsigned long LocalMemUsage(const Device &device) const {
+    if (local_mem_usage_->device == device()) { return local_mem_usage_->bytes; }
     const auto bytes = sizeof(cl_ulong);
     auto query = cl_kernel_work_group_info{CL_KERNEL_LOCAL_MEM_SIZE};
     auto result = cl_ulong{0};
     CheckError(clGetKernelWorkGroupInfo(*kernel_, device(), query, bytes, &result, nullptr));
-    return static_cast<unsigned long>(result);
+    local_mem_usage_->device = device();
+    local_mem_usage_->bytes = static_cast<unsigned long>(result);
+    return local_mem_usage_->bytes;
   }
 
   // Retrieves the name of the kernel
@@ -804,36 +1080,54 @@ class Kernel {
   }
 
   // Launches a kernel onto the specified queue
-  void Launch(const Queue &queue, const std::vector<size_t> &global,
-              const std::vector<size_t> &local, EventPointer event) {
+  void Launch(const Queue &queue, const ThreadRange &global,
+              const ThreadRange &local, EventPointer event) {
     CheckError(clEnqueueNDRangeKernel(queue(), *kernel_, static_cast<cl_uint>(global.size()),
-                                      nullptr, global.data(), local.data(),
+                                      nullptr, global.data(), !local.empty() ? local.data() : nullptr,
                                       0, nullptr, event));
   }
 
-  // As above, but with an event waiting list
-  void Launch(const Queue &queue, const std::vector<size_t> &global,
-              const std::vector<size_t> &local, EventPointer event,
+  // As above, but with an event waiting list. Short lists are converted on the stack, such that a
+  // launch doesn't allocate.
+  void Launch(const Queue &queue, const ThreadRange &global,
+              const ThreadRange &local, EventPointer event,
               const std::vector<Event> &waitForEvents) {
 
-    // Builds a plain version of the events waiting list
-    auto waitForEventsPlain = std::vector<cl_event>();
+    // Builds a plain version of the events waiting list, skipping the null-events
+    constexpr auto kMaxStackEvents = size_t{16};
+    cl_event stack_events[kMaxStackEvents];
+    auto heap_events = std::vector<cl_event>();
+    if (waitForEvents.size() > kMaxStackEvents) { heap_events.resize(waitForEvents.size()); }
+    const auto events = (heap_events.empty()) ? stack_events : heap_events.data();
+    auto num_events = cl_uint{0};
     for (auto &waitEvent : waitForEvents) {
-      if (waitEvent()) { waitForEventsPlain.push_back(waitEvent()); }
+      if (waitEvent()) { events[num_events++] = waitEvent(); }
     }
 
     // Launches the kernel while waiting for other events
     CheckError(clEnqueueNDRangeKernel(queue(), *kernel_, static_cast<cl_uint>(global.size()),
                                       nullptr, global.data(), !local.empty() ? local.data() : nullptr,
-                                      static_cast<cl_uint>(waitForEventsPlain.size()),
-                                      !waitForEventsPlain.empty() ? waitForEventsPlain.data() : nullptr,
+                                      num_events, (num_events != 0) ? events : nullptr,
                                       event));
   }
 
+  // The values of the arguments as last set, shared among copies of the kernel object
+  struct Argument {
+    std::vector<char> value;
+    bool is_buffer = false;
+  };
+  const std::vector<Argument>& GetArguments() const { return *arguments_; }
+
   // Accessor to the private data-member
   const cl_kernel& operator()() const { return *kernel_; }
  private:
+  struct LocalMemUsageInfo {
+    cl_device_id device = nullptr;
+    unsigned long bytes = 0;
+  };
   std::shared_ptr<cl_kernel> kernel_;
+  std::shared_ptr<LocalMemUsageInfo> local_mem_usage_;
+  std::shared_ptr<std::vector<Argument>> arguments_;
 
   // Internal implementation for the recursive SetArguments function.
   template <typename T>
@@ -0,0 +1,295 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the CommandGraph class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "command_graph.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The graphs being captured per queue
+namespace {
+std::map<RawCommandQueue, CommandGraph*> captures;
+std::mutex captures_mutex;
+} // anonymous namespace
+
+std::atomic<size_t> CommandGraph::num_captures_{0};
+
+CommandGraph* CommandGraph::FindCapture(const RawCommandQueue queue) {
+  std::lock_guard<std::mutex> lock(captures_mutex);
+  const auto it = captures.find(queue);
+  return (it == captures.end()) ? nullptr : it->second;
+}
+
+void CommandGraph::BeginCapture(const Queue &queue) {
+  std::lock_guard<std::mutex> lock(captures_mutex);
+  if (captures.find(queue()) != captures.end()) {
+    throw RuntimeErrorCode(StatusCode::kInvalidOperation, "a graph is already being captured on this queue");
+  }
+  auto graph = std::unique_ptr<CommandGraph>(new CommandGraph(queue));
+  #ifdef CUDA_API
+    CheckError(cuStreamBeginCapture(queue(), CU_STREAM_CAPTURE_MODE_RELAXED));
+    queue.SetCaptureStream(true);
+  #endif
+  captures[queue()] = graph.release();
+  num_captures_++;
+}
+
+CommandGraph* CommandGraph::EndCapture(const Queue &queue) {
+  auto graph = std::unique_ptr<CommandGraph>();
+  {
+    std::lock_guard<std::mutex> lock(captures_mutex);
+    const auto it = captures.find(queue());
+    if (it == captures.end()) {
+      throw RuntimeErrorCode(StatusCode::kInvalidOperation, "no graph is being captured on this queue");
+    }
+    graph.reset(it->second);
+    captures.erase(it);
+    num_captures_--;
+  }
+  graph->Finalize();
+  return graph.release();
+}
+
+void CommandGraph::KeepAlive(const Queue &queue, const std::shared_ptr<void> &buffer) {
+  std::lock_guard<std::mutex> lock(captures_mutex);
+  const auto it = captures.find(queue());
+  if (it != captures.end()) { it->second->temporary_buffers_.push_back(buffer); }
+}
+
+// =================================================================================================
+#ifdef OPENCL_API
+
+// The parts of the 'cl_khr_command_buffer' extension used here. These are declared locally, since
+// the extension is provisional and not (or differently) declared in older OpenCL headers.
+namespace {
+constexpr cl_device_info kDeviceCommandBufferCapabilitiesKHR = 0x12A9;
+constexpr cl_ulong kCommandBufferCapabilitySimultaneousUseKHR = cl_ulong{1} << 2;
+constexpr cl_ulong kCommandBufferFlagsKHR = 0x1293;
+constexpr cl_ulong kCommandBufferSimultaneousUseKHR = cl_ulong{1} << 0;
+
+using CreateCommandBufferKHR = void* (CL_API_CALL *)(cl_uint, const cl_command_queue*,
+                                                     const cl_ulong*, cl_int*);
+using CommandNDRangeKernelKHR = cl_int (CL_API_CALL *)(void*, cl_command_queue, const cl_ulong*,
+                                                       cl_kernel, cl_uint, const size_t*,
+                                                       const size_t*, const size_t*, cl_uint,
+                                                       const cl_uint*, cl_uint*, void**);
+using FinalizeCommandBufferKHR = cl_int (CL_API_CALL *)(void*);
+using ReleaseCommandBufferKHR = cl_int (CL_API_CALL *)(void*);
+using EnqueueCommandBufferKHR = cl_int (CL_API_CALL *)(cl_uint, cl_command_queue*, void*, cl_uint,
+                                                       const cl_event*, cl_event*);
+
+template <typename F>
+F GetExtensionFunction(const cl_platform_id platform, const char* name) {
+  return reinterpret_cast<F>(clGetExtensionFunctionAddressForPlatform(platform, name));
+}
+} // anonymous namespace
+
+CommandGraph::CommandGraph(const Queue &queue):
+    queue_(queue()),
+    platform_(queue.GetDevice().PlatformID()),
+    command_buffer_(nullptr),
+    command_buffer_simultaneous_use_(false),
+    last_launch_(nullptr) {
+  CheckError(clRetainCommandQueue(queue()));
+}
+
+CommandGraph::~CommandGraph() {
+  if (command_buffer_) {
+    const auto release = GetExtensionFunction<ReleaseCommandBufferKHR>(platform_, "clReleaseCommandBufferKHR");
+    if (release) { CheckErrorDtor(release(command_buffer_)); }
+  }
+  if (last_launch_) { CheckErrorDtor(clReleaseEvent(last_launch_)); }
+  for (const auto &command : commands_) {
+    if (command.kernel) { CheckErrorDtor(clReleaseKernel(command.kernel)); }
+  }
+  for (const auto &buffer : buffers_) { CheckErrorDtor(clReleaseMemObject(buffer)); }
+  CheckErrorDtor(clReleaseCommandQueue(queue_()));
+}
+
+// Creates a new kernel object from the same program, such that later changes of the arguments of
+// the (cached) original kernel do not affect the recorded one
+void CommandGraph::RecordKernel(const Queue &queue, const Kernel &kernel,
+                                const ThreadRange &global, const ThreadRange &local,
+                                EventPointer event) {
+  auto program = cl_program{nullptr};
+  CheckError(clGetKernelInfo(kernel(), CL_KERNEL_PROGRAM, sizeof(cl_program), &program, nullptr));
+  auto status = CL_SUCCESS;
+  auto copy = clCreateKernel(program, kernel.GetFunctionName().c_str(), &status);
+  CLCudaAPIError::Check(status, "clCreateKernel");
+  auto command = Command{copy, global, local, nullptr, nullptr, 0};
+  auto buffers = std::vector<cl_mem>();
+  try {
+    const auto &arguments = kernel.GetArguments();
+    for (auto i = size_t{0}; i < arguments.size(); ++i) {
+      const auto &argument = arguments[i];
+      CheckError(clSetKernelArg(copy, static_cast<cl_uint>(i), argument.value.size(), argument.value.data()));
+      if (argument.is_buffer) {
+        auto buffer = cl_mem{nullptr};
+        std::memcpy(&buffer, argument.value.data(), sizeof(cl_mem));
+        if (buffer) { buffers.push_back(buffer); }
+      }
+    }
+
+    // Sets the event to a completed user event, e.g. for routines which wait for their kernels
+    if (event) {
+      *event = clCreateUserEvent(queue.GetContext()(), &status);
+      CLCudaAPIError::Check(status, "clCreateUserEvent");
+      CheckError(clSetUserEventStatus(*event, CL_COMPLETE));
+    }
+  } catch (...) {
+    CheckErrorDtor(clReleaseKernel(copy));
+    throw;
+  }
+
+  std::lock_guard<std::mutex> lock(captures_mutex);
+  const auto it = captures.find(queue());
+  if (it == captures.end()) {
+    CheckErrorDtor(clReleaseKernel(copy));
+    throw RuntimeErrorCode(StatusCode::kInvalidOperation, "no graph is being captured on this queue");
+  }
+  for (const auto &buffer : buffers) {
+    CheckError(clRetainMemObject(buffer));
+    it->second->buffers_.push_back(buffer);
+  }
+  it->second->commands_.push_back(command);
+}
+
+void CommandGraph::RecordCopy(const Queue &queue, const cl_mem source, const cl_mem destination,
+                              const size_t bytes) {
+  std::lock_guard<std::mutex> lock(captures_mutex);
+  const auto it = captures.find(queue());
+  if (it == captures.end()) {
+    throw RuntimeErrorCode(StatusCode::kInvalidOperation, "no graph is being captured on this queue");
+  }
+  for (const auto &buffer : {source, destination}) {
+    CheckError(clRetainMemObject(buffer));
+    it->second->buffers_.push_back(buffer);
+  }
+  it->second->commands_.push_back(Command{nullptr, {}, {}, source, destination, bytes});
+}
+
+// Creates the command buffer if the device supports it, the graph consists of kernels only, and
+// the kernels can be recorded. Otherwise the graph is replayed by enqueueing the commands one by one.
+void CommandGraph::Finalize() {
+  const auto device = queue_.GetDevice();
+  if (commands_.empty() || !device.HasExtension("cl_khr_command_buffer")) { return; }
+  for (const auto &command : commands_) {
+    if (!command.kernel) { return; }
+  }
+  const auto platform = platform_;
+  const auto create = GetExtensionFunction<CreateCommandBufferKHR>(platform, "clCreateCommandBufferKHR");
+  const auto record = GetExtensionFunction<CommandNDRangeKernelKHR>(platform, "clCommandNDRangeKernelKHR");
+  const auto finalize = GetExtensionFunction<FinalizeCommandBufferKHR>(platform, "clFinalizeCommandBufferKHR");
+  const auto release = GetExtensionFunction<ReleaseCommandBufferKHR>(platform, "clReleaseCommandBufferKHR");
+  if (!create || !record || !finalize || !release) { return; }
+
+  // Requests simultaneous use if supported, such that replays do not have to wait for each other
+  auto capabilities = cl_ulong{0};
+  clGetDeviceInfo(device(), kDeviceCommandBufferCapabilitiesKHR, sizeof(cl_ulong), &capabilities, nullptr);
+  const auto simultaneous_use = (capabilities & kCommandBufferCapabilitySimultaneousUseKHR) != 0;
+  const cl_ulong properties[] = {kCommandBufferFlagsKHR, kCommandBufferSimultaneousUseKHR, 0};
+
+  // Any failure (e.g. a queue with properties unsupported by the extension) leaves the fall-back
+  auto status = CL_SUCCESS;
+  const auto queue = queue_();
+  auto command_buffer = create(1, &queue, (simultaneous_use) ? properties : nullptr, &status);
+  if (status != CL_SUCCESS || !command_buffer) { return; }
+  for (const auto &command : commands_) {
+    status = record(command_buffer, nullptr, nullptr, command.kernel,
+                    static_cast<cl_uint>(command.global.size()), nullptr, command.global.data(),
+                    !command.local.empty() ? command.local.data() : nullptr,
+                    0, nullptr, nullptr, nullptr);
+    if (status != CL_SUCCESS) { break; }
+  }
+  if (status == CL_SUCCESS) { status = finalize(command_buffer); }
+  if (status != CL_SUCCESS) {
+    release(command_buffer);
+    return;
+  }
+  command_buffer_ = command_buffer;
+  command_buffer_simultaneous_use_ = simultaneous_use;
+}
+
+void CommandGraph::Launch(const Queue &queue, EventPointer event) {
+
+  // A single submission of the command buffer, only possible on the capture queue
+  if (command_buffer_ && queue() == queue_()) {
+    const auto enqueue = GetExtensionFunction<EnqueueCommandBufferKHR>(platform_, "clEnqueueCommandBufferKHR");
+    if (last_launch_ && !command_buffer_simultaneous_use_) {
+      CheckError(clWaitForEvents(1, &last_launch_));
+    }
+    auto launch_event = cl_event{nullptr};
+    CheckError(enqueue(0, nullptr, command_buffer_, 0, nullptr, &launch_event));
+    if (last_launch_) { CheckError(clReleaseEvent(last_launch_)); }
+    last_launch_ = launch_event;
+    if (event) {
+      CheckError(clRetainEvent(launch_event));
+      *event = launch_event;
+    }
+    return;
+  }
+
+  // Otherwise the commands are enqueued one by one, the event belongs to the last one
+  for (auto i = size_t{0}; i < commands_.size(); ++i) {
+    const auto &command = commands_[i];
+    const auto command_event = (i == commands_.size() - 1) ? event : nullptr;
+    if (command.kernel) {
+      CheckError(clEnqueueNDRangeKernel(queue(), command.kernel, static_cast<cl_uint>(command.global.size()),
+                                        nullptr, command.global.data(),
+                                        !command.local.empty() ? command.local.data() : nullptr,
+                                        0, nullptr, command_event));
+    }
+    else {
+      CheckError(clEnqueueCopyBuffer(queue(), command.source, command.destination, 0, 0,
+                                     command.bytes, 0, nullptr, command_event));
+    }
+  }
+  if (commands_.empty() && event) { CheckError(clEnqueueMarker(queue(), event)); }
+}
+
+// =================================================================================================
+#elif CUDA_API
+
+CommandGraph::CommandGraph(const Queue &queue):
+    queue_(queue),
+    graph_(nullptr),
+    graph_exec_(nullptr) {
+}
+
+CommandGraph::~CommandGraph() {
+  if (graph_exec_) { CheckErrorDtor(cuGraphExecDestroy(graph_exec_)); }
+  if (graph_) { CheckErrorDtor(cuGraphDestroy(graph_)); }
+}
+
+void CommandGraph::Finalize() {
+  queue_.SetCaptureStream(false);
+  CheckError(cuStreamEndCapture(queue_(), &graph_));
+  CheckError(cuGraphInstantiateWithFlags(&graph_exec_, graph_, 0));
+}
+
+// The CUDA back-end is synchronous, hence this waits for the replay to complete
+void CommandGraph::Launch(const Queue &queue, EventPointer event) {
+  if (event) { CheckError(cuEventRecord(event->start(), queue())); }
+  CheckError(cuGraphLaunch(graph_exec_, queue()));
+  queue.Finish();
+  if (event) { CheckError(cuEventRecord(event->end(), queue())); }
+}
+
+#endif
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,115 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements command graphs: recorded sequences of CLBlast routine calls which can be
+// replayed with a low host overhead. While a graph is captured on a queue, the routines perform all
+// their host-side work (argument checks, kernel selection, temporary buffers) as usual, but instead
+// of launching their kernels these are recorded together with their arguments. Replaying the graph
+// then only enqueues the recorded kernels.
+//
+// For OpenCL, each recorded kernel is a separate kernel object with its arguments fixed. If the
+// device supports 'cl_khr_command_buffer', the graph is additionally finalised into a command
+// buffer, such that a replay on the capture queue is a single submission. For CUDA, the capture is
+// a CUDA stream capture into a CUDA graph.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_COMMAND_GRAPH_H_
+#define CLBLAST_COMMAND_GRAPH_H_
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class. Note that the graph refers to the
+// user's buffers, which thus have to be kept alive for as long as the graph is replayed.
+class CommandGraph {
+ public:
+
+  // Starts capturing the routines enqueued to the queue. For CUDA, the queue should be a new
+  // stream: routines called in the meantime from this host thread and on this context share it.
+  static void BeginCapture(const Queue &queue);
+
+  // Ends the capture on the queue and returns the resulting graph, to be deleted by the caller
+  static CommandGraph* EndCapture(const Queue &queue);
+
+  // Whether or not a graph is being captured on the queue, cheap in case nothing is captured
+  static bool IsCapturing(const Queue &queue) {
+    return num_captures_ != 0 && FindCapture(queue()) != nullptr;
+  }
+
+  #ifdef OPENCL_API
+    // Records a launch of the kernel with its current arguments into the graph captured on the
+    // queue. The event (if any) is set to a completed event, such that it can be waited for.
+    static void RecordKernel(const Queue &queue, const Kernel &kernel,
+                             const ThreadRange &global, const ThreadRange &local,
+                             EventPointer event);
+
+    // Records a copy of 'bytes' bytes between two buffers into the graph captured on the queue
+    static void RecordCopy(const Queue &queue, const cl_mem source, const cl_mem destination,
+                           const size_t bytes);
+  #endif
+
+  // Keeps a temporary buffer alive for as long as the graph captured on the queue exists
+  static void KeepAlive(const Queue &queue, const std::shared_ptr<void> &buffer);
+
+  // Replays the graph on a queue of the same context and device as the capture queue
+  void Launch(const Queue &queue, EventPointer event);
+
+  ~CommandGraph();
+  CommandGraph(const CommandGraph&) = delete;
+  CommandGraph& operator=(const CommandGraph&) = delete;
+
+ private:
+  explicit CommandGraph(const Queue &queue);
+  static CommandGraph* FindCapture(const RawCommandQueue queue);
+
+  // Turns the recorded commands into a form that can be launched
+  void Finalize();
+
+  // The number of ongoing captures over all queues
+  static std::atomic<size_t> num_captures_;
+
+  Queue queue_; // the capture queue
+  std::vector<std::shared_ptr<void>> temporary_buffers_;
+
+  #ifdef OPENCL_API
+    // A recorded command: either a kernel launch or (in case of no kernel) a buffer copy
+    struct Command {
+      cl_kernel kernel;
+      ThreadRange global;
+      ThreadRange local;
+      cl_mem source;
+      cl_mem destination;
+      size_t bytes;
+    };
+    std::vector<Command> commands_;
+    std::vector<cl_mem> buffers_; // retained user buffers used by the commands
+    cl_platform_id platform_;
+
+    // The optional 'cl_khr_command_buffer' version of the graph
+    void* command_buffer_;
+    bool command_buffer_simultaneous_use_;
+    cl_event last_launch_;
+  #elif CUDA_API
+    CUgraph graph_;
+    CUgraphExec graph_exec_;
+  #endif
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_COMMAND_GRAPH_H_
+#endif
@@ -42,6 +42,9 @@
 #include <vector>    // std::vector
 #include <memory>    // std::shared_ptr
 #include <cstring>   // std::strlen
+#include <utility>   // std::pair
+#include <array>     // std::array
+#include <cstdint>   // uint16_t
 
 // CUDA
 #define CUDA_NO_HALF // Incompatible with CLBlast's definition; TODO: resolve this
@@ -249,6 +252,7 @@ public:
     return static_cast<size_t>(result);
   }
   std::string Vendor() const { return "NVIDIA Corporation"; }
+  std::string DriverVersion() const { return Version(); }
   std::string Name() const {
     auto result = std::string{};
     result.resize(kStringLength);
@@ -273,10 +277,16 @@ public:
     const auto minor = GetInfo(CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MINOR);
     return "SM"+std::to_string(major)+"."+std::to_string(minor);
   }
+  // The architecture to compile for: a real one if NVRTC can produce cubins (CUDA 11.1 and up),
+  // such that no PTX has to be JIT-compiled by the driver when loading the program
   std::string ComputeArch() const {
     const auto major = GetInfo(CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MAJOR);
     const auto minor = GetInfo(CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MINOR);
-    return "compute_"+std::to_string(major)+std::to_string(minor);
+    #if CUDA_VERSION >= 11010
+      return "sm_"+std::to_string(major)+std::to_string(minor);
+    #else
+      return "compute_"+std::to_string(major)+std::to_string(minor);
+    #endif
   }
   bool HasExtension(const std::string &extension) const { return false; }
   bool SupportsFP64() const { return true; }
@@ -299,6 +309,15 @@ public:
   size_t MemoryClock() const { return 1e-3*GetInfo(CU_DEVICE_ATTRIBUTE_MEMORY_CLOCK_RATE); }
   size_t MemoryBusWidth() const { return GetInfo(CU_DEVICE_ATTRIBUTE_GLOBAL_MEMORY_BUS_WIDTH); }
 
+  // Whether the device shares its physical memory with the host and the alignment of host pointers
+  bool HasUnifiedMemory() const { return GetInfo(CU_DEVICE_ATTRIBUTE_INTEGRATED) != 0; }
+  size_t MemoryBaseAlignment() const { return 256; } // CUDA allocations are 256-byte aligned
+
+  // Images are not used with CUDA
+  bool SupportsImages() const { return false; }
+  size_t MaxImage2DWidth() const { return 0; }
+  size_t MaxImage2DHeight() const { return 0; }
+
   // Configuration-validity checks
   bool IsLocalMemoryValid(const size_t local_mem_usage) const {
     return (local_mem_usage <= LocalMemSize());
@@ -326,6 +345,7 @@ public:
   // Platform specific extensions
   std::string AMDBoardName() const { return ""; }
   std::string NVIDIAComputeCapability() const { return Capabilities(); }
+  size_t SubgroupSize() const { return GetInfo(CU_DEVICE_ATTRIBUTE_WARP_SIZE); }
 
   // Retrieves the above extra information
   std::string GetExtraInfo() const { return NVIDIAComputeCapability(); }
@@ -379,6 +399,9 @@ using ContextPointer = CUcontext*;
 
 // =================================================================================================
 
+// Raw program type (the loaded module is the object from which kernels are obtained)
+using RawProgram = CUmodule;
+
 // C++11 version of 'nvrtcProgram'. Additionally holds the program's source code.
 class Program {
 public:
@@ -398,7 +421,7 @@ public:
     CheckErrorNVRTC(nvrtcCreateProgram(program_.get(), source_ptr, nullptr, 0, nullptr, nullptr));
   }
 
-  // PTX-based constructor
+  // Binary-based constructor, taking a cubin or PTX (see 'GetIR')
   explicit Program(const Device &device, const Context &context, const std::string &binary):
       program_(nullptr), // not used
       source_(binary),
@@ -408,7 +431,10 @@ public:
   // Compiles the device program and checks whether or not there are any warnings/errors
   void Build(const Device &device, std::vector<std::string> &options) {
     options.push_back("-arch=" + device.ComputeArch());
-    if (from_binary_) { return; }
+    if (from_binary_) {
+      CheckError(cuModuleLoadDataEx(&module_, source_.data(), 0, nullptr, nullptr));
+      return;
+    }
     auto raw_options = std::vector<const char*>();
     for (const auto &option: options) {
       raw_options.push_back(option.c_str());
@@ -434,19 +460,26 @@ public:
     return result;
   }
 
-  // Retrieves an intermediate representation of the compiled program (i.e. PTX)
+  // Retrieves the compiled program: a cubin for the device's architecture, or PTX before CUDA 11.1
   std::string GetIR() const {
-    if (from_binary_) { return source_; } // holds the PTX
+    if (from_binary_) { return source_; } // holds the cubin or PTX
     auto bytes = size_t{0};
-    CheckErrorNVRTC(nvrtcGetPTXSize(*program_, &bytes));
     auto result = std::string{};
-    result.resize(bytes);
-    CheckErrorNVRTC(nvrtcGetPTX(*program_, &result[0]));
+    #if CUDA_VERSION >= 11010
+      CheckErrorNVRTC(nvrtcGetCUBINSize(*program_, &bytes));
+      result.resize(bytes);
+      CheckErrorNVRTC(nvrtcGetCUBIN(*program_, &result[0]));
+    #else
+      CheckErrorNVRTC(nvrtcGetPTXSize(*program_, &bytes));
+      result.resize(bytes);
+      CheckErrorNVRTC(nvrtcGetPTX(*program_, &result[0]));
+    #endif
     return result;
   }
 
   // Accessor to the private data-members
   const CUmodule GetModule() const { return module_; }
+  RawProgram GetRawProgram() const { return module_; }
   const nvrtcProgram& operator()() const { return *program_; }
 private:
   std::shared_ptr<nvrtcProgram> program_;
@@ -465,26 +498,53 @@ class Queue {
 public:
   // Note that there is no constructor based on the regular CUDA data-type because of extra state
 
-  // Regular constructor with memory management
+  // Regular constructor with memory management. While a command graph is captured on this host
+  // thread for the same context (see 'SetCaptureStream'), the stream of the capture is used. The
+  // stream gets the priority set for this host thread (see 'SetPriority').
   explicit Queue(const Context &context, const Device &device):
-      queue_(new CUstream, [](CUstream* s) {
-          if (*s) { CheckErrorDtor(cuStreamDestroy(*s)); }
-          delete s;
-      }),
+      queue_(CaptureState().first == context() ? CaptureState().second : nullptr),
       context_(context),
       device_(device) {
-    CheckError(cuStreamCreate(queue_.get(), CU_STREAM_NON_BLOCKING));
+    if (queue_) { return; }
+    queue_ = std::shared_ptr<CUstream>(new CUstream, [](CUstream* s) {
+        if (*s) { CheckErrorDtor(cuStreamDestroy(*s)); }
+        delete s;
+    });
+    CheckError(cuStreamCreateWithPriority(queue_.get(), CU_STREAM_NON_BLOCKING, Priority()));
   }
 
-  // Synchronizes the queue and optionally also an event
+  // Sets the priority of the streams created on this host thread: lower numbers are higher
+  // priorities, out-of-range values are clamped by CUDA (see 'cuCtxGetStreamPriorityRange')
+  static void SetPriority(const int priority) {
+    Priority() = priority;
+  }
+
+  // Synchronizes the queue and optionally also an event. This is skipped while capturing a command
+  // graph, since it would invalidate the capture.
   void Finish(Event &event) const {
+    if (IsCapturing()) { return; }
     CheckError(cuEventSynchronize(event.end()));
     Finish();
   }
   void Finish() const {
+    if (IsCapturing()) { return; }
     CheckError(cuStreamSynchronize(*queue_));
   }
 
+  // Whether or not the stream is being captured into a CUDA graph
+  bool IsCapturing() const {
+    auto status = CU_STREAM_CAPTURE_STATUS_NONE;
+    CheckError(cuStreamIsCapturing(*queue_, &status));
+    return status != CU_STREAM_CAPTURE_STATUS_NONE;
+  }
+
+  // Makes this the stream used by all queues created on this host thread for the same context, or
+  // resets this. Used to capture consecutive routines into a single command graph.
+  void SetCaptureStream(const bool enabled) const {
+    CaptureState() = (enabled) ? std::make_pair(context_(), queue_) :
+                                 std::make_pair(RawContext{nullptr}, std::shared_ptr<CUstream>());
+  }
+
   // Retrieves the corresponding context or device
   Context GetContext() const { return context_; }
   Device GetDevice() const { return device_; }
@@ -495,6 +555,15 @@ private:
   std::shared_ptr<CUstream> queue_;
   const Context context_;
   const Device device_;
+
+  static std::pair<RawContext, std::shared_ptr<CUstream>>& CaptureState() {
+    static thread_local std::pair<RawContext, std::shared_ptr<CUstream>> state;
+    return state;
+  }
+  static int& Priority() {
+    static thread_local int priority = 0;
+    return priority;
+  }
 };
 
 // =================================================================================================
@@ -562,6 +631,20 @@ public:
       Buffer<T>(context, BufferAccess::kReadWrite, size) {
   }
 
+  // Stream-ordered constructor (CUDA 11.2 and up): the memory is allocated from a memory pool as
+  // part of the queue and freed again as part of the same queue, such that neither synchronizes
+  #if CUDA_VERSION >= 11020
+    explicit Buffer(const Queue &queue, const CUmemoryPool pool, const size_t size):
+        access_(BufferAccess::kReadWrite) {
+      const auto stream = queue();
+      buffer_ = std::shared_ptr<CUdeviceptr>(new CUdeviceptr, [stream, size](CUdeviceptr* m) {
+          if (size > 0) { CheckErrorDtor(cuMemFreeAsync(*m, stream)); }
+          delete m;
+      });
+      if (size > 0) { CheckError(cuMemAllocFromPoolAsync(buffer_.get(), size*sizeof(T), pool, stream)); }
+    }
+  #endif
+
   // Constructs a new buffer based on an existing host-container
   template <typename Iterator>
   explicit Buffer(const Context &context, const Queue &queue, Iterator start, Iterator end):
@@ -670,27 +753,44 @@ private:
 // C++11 version of 'CUfunction'
 class Kernel {
 public:
+  Kernel() = default;
+
+  // The maximum number of arguments and their maximum combined size in bytes (see 'SetArgument')
+  static constexpr size_t kMaxArguments = 64;
+  static constexpr size_t kMaxArgumentBytes = 1024;
 
   // Constructor based on the regular CUDA data-type: memory management is handled elsewhere
   explicit Kernel(const CUfunction kernel):
-      name_("unknown"),
-      kernel_(kernel) {
+      function_(std::make_shared<Function>()) {
+    function_->name = "unknown";
+    function_->kernel = kernel;
+    QueryLocalMemUsage();
   }
 
   // Regular constructor with memory management
-  explicit Kernel(const Program &program, const std::string &name): name_(name) {
-    CheckError(cuModuleGetFunction(&kernel_, program.GetModule(), name.c_str()));
+  explicit Kernel(const Program &program, const std::string &name):
+      function_(std::make_shared<Function>()) {
+    function_->name = name;
+    CheckError(cuModuleGetFunction(&function_->kernel, program.GetModule(), name.c_str()));
+    QueryLocalMemUsage();
   }
 
   // Sets a kernel argument at the indicated position. This stores both the value of the argument
-  // (as raw bytes) and the index indicating where this value can be found.
+  // (as raw bytes, aligned in a fixed-size buffer) and the offset indicating where this value can be
+  // found. An argument that is set again with a value of the same size is overwritten in place.
   template <typename T>
   void SetArgument(const size_t index, const T &value) {
-    if (index >= arguments_indices_.size()) { arguments_indices_.resize(index+1); }
-    arguments_indices_[index] = arguments_data_.size();
-    for (auto j=size_t(0); j<sizeof(T); ++j) {
-      arguments_data_.push_back(reinterpret_cast<const char*>(&value)[j]);
+    if (index >= kMaxArguments) { throw LogicError("Kernel: too many arguments"); }
+    if (argument_sizes_[index] != sizeof(T)) {
+      const auto alignment = sizeof(T) < sizeof(double) ? sizeof(T) : sizeof(double);
+      const auto offset = ((arguments_size_ + alignment - 1) / alignment) * alignment;
+      if (offset + sizeof(T) > kMaxArgumentBytes) { throw LogicError("Kernel: arguments too large"); }
+      argument_offsets_[index] = static_cast<uint16_t>(offset);
+      argument_sizes_[index] = static_cast<uint16_t>(sizeof(T));
+      arguments_size_ = offset + sizeof(T);
+      if (index >= num_arguments_) { num_arguments_ = index + 1; }
     }
+    std::memcpy(&arguments_data_[argument_offsets_[index]], &value, sizeof(T));
   }
   template <typename T>
   void SetArgument(const size_t index, Buffer<T> &value) {
@@ -701,56 +801,58 @@ public:
   // arguments using 'SetArgument' or 'SetArguments'.
   template <typename... Args>
   void SetArguments(Args&... args) {
-    arguments_indices_.clear();
-    arguments_data_.clear();
+    argument_sizes_.fill(0);
+    arguments_size_ = 0;
+    num_arguments_ = 0;
     SetArgumentsRecursive(0, args...);
   }
 
   // Retrieves the amount of local memory used per work-group for this kernel. Note that this the
-  // shared memory in CUDA terminology.
+  // shared memory in CUDA terminology. It is queried once when the kernel object is created.
   unsigned long LocalMemUsage(const Device &) const {
-    auto result = 0;
-    CheckError(cuFuncGetAttribute(&result, CU_FUNC_ATTRIBUTE_SHARED_SIZE_BYTES, kernel_));
-    return static_cast<unsigned long>(result);
+    return function_->local_mem_usage;
   }
 
   // Retrieves the name of the kernel
   std::string GetFunctionName() const {
-    return name_;
+    return function_->name;
   }
 
-  // Launches a kernel onto the specified queue
-  void Launch(const Queue &queue, const std::vector<size_t> &global,
-              const std::vector<size_t> &local, EventPointer event) {
+  // Launches a kernel onto the specified queue. This doesn't allocate any memory on the host.
+  void Launch(const Queue &queue, const ThreadRange &global,
+              const ThreadRange &local, EventPointer event) {
     // TODO: Currently this CUDA launch is always synchronous due to a cuStreamSynchronize call
     if (local.size() == 0) {
       throw LogicError("Kernel: launching with a default workgroup size is not implemented for the CUDA back-end");
     }
 
     // Creates the grid (number of threadblocks) and sets the block sizes (threads per block)
-    auto grid = std::vector<size_t>{1, 1, 1};
-    auto block = std::vector<size_t>{1, 1, 1};
-    if (global.size() != local.size()) { throw LogicError("invalid thread/workgroup dimensions"); }
+    auto grid = std::array<size_t, 3>{{1, 1, 1}};
+    auto block = std::array<size_t, 3>{{1, 1, 1}};
+    if (global.size() != local.size() || local.size() > 3) {
+      throw LogicError("invalid thread/workgroup dimensions");
+    }
     for (auto i=size_t{0}; i<local.size(); ++i) { grid[i] = global[i]/local[i]; }
     for (auto i=size_t{0}; i<local.size(); ++i) { block[i] = local[i]; }
 
-    // Creates the array of pointers from the arrays of indices & data
-    std::vector<void*> pointers;
-    for (auto &index: arguments_indices_) {
-      pointers.push_back(&arguments_data_[index]);
+    // Creates the array of pointers from the offsets & data
+    auto pointers = std::array<void*, kMaxArguments>();
+    for (auto i=size_t{0}; i<num_arguments_; ++i) {
+      pointers[i] = &arguments_data_[argument_offsets_[i]];
     }
 
     // Launches the kernel, its execution time is recorded by events
     if (event) { CheckError(cuEventRecord(event->start(), queue())); }
-    CheckError(cuLaunchKernel(kernel_, grid[0], grid[1], grid[2], block[0], block[1], block[2],
+    CheckError(cuLaunchKernel(function_->kernel, grid[0], grid[1], grid[2],
+                              block[0], block[1], block[2],
                               0, queue(), pointers.data(), nullptr));
-    cuStreamSynchronize(queue());
+    if (!queue.IsCapturing()) { cuStreamSynchronize(queue()); }
     if (event) { CheckError(cuEventRecord(event->end(), queue())); }
   }
 
   // As above, but with an event waiting list
-  void Launch(const Queue &queue, const std::vector<size_t> &global,
-              const std::vector<size_t> &local, EventPointer event,
+  void Launch(const Queue &queue, const ThreadRange &global,
+              const ThreadRange &local, EventPointer event,
               const std::vector<Event>& waitForEvents) {
     for (auto &waitEvent : waitForEvents) {
       waitEvent.WaitForCompletion(); // note: doesn't do anything, every kernel call is synchronous
@@ -759,13 +861,32 @@ public:
   }
 
   // Accessors to the private data-members
-  const CUfunction& operator()() const { return kernel_; }
-  CUfunction operator()() { return kernel_; }
+  const CUfunction& operator()() const { return function_->kernel; }
+  CUfunction operator()() { return function_->kernel; }
 private:
-  const std::string name_;
-  CUfunction kernel_;
-  std::vector<size_t> arguments_indices_; // Indices of the arguments
-  std::vector<char> arguments_data_; // The arguments data as raw bytes
+
+  // The immutable properties of the CUDA function, shared by all copies of the kernel object such
+  // that copying (e.g. out of the kernel cache) doesn't allocate
+  struct Function {
+    std::string name;
+    CUfunction kernel;
+    unsigned long local_mem_usage = 0;
+  };
+  std::shared_ptr<Function> function_;
+
+  // The arguments data as raw bytes, with the offset and size of each argument
+  alignas(double) std::array<char, kMaxArgumentBytes> arguments_data_;
+  std::array<uint16_t, kMaxArguments> argument_offsets_ = {};
+  std::array<uint16_t, kMaxArguments> argument_sizes_ = {};
+  size_t arguments_size_ = 0;
+  size_t num_arguments_ = 0;
+
+  // Queries the amount of shared memory used by the kernel (see 'LocalMemUsage')
+  void QueryLocalMemUsage() {
+    auto result = 0;
+    CheckError(cuFuncGetAttribute(&result, CU_FUNC_ATTRIBUTE_SHARED_SIZE_BYTES, function_->kernel));
+    function_->local_mem_usage = static_cast<unsigned long>(result);
+  }
 
   // Internal implementation for the recursive SetArguments function.
   template <typename T>
@@ -7,8 +7,8 @@
 // Author(s):
 //   Ivan Shapovalov <intelfx@intelfx.name>
 //
-// This file contains exception classes corresponding to 'clpp11.hpp'. It is also part of the
-// CLCudaAPI project. See 'clpp11.hpp' for more details.
+// This file contains exception classes and other types shared by 'clpp11.hpp' and 'cupp11.hpp'. It
+// is also part of the CLCudaAPI project. See 'clpp11.hpp' for more details.
 //
 // =================================================================================================
 
@@ -18,6 +18,8 @@
 #include <cstring>   // strchr
 #include <string>    // std::string
 #include <stdexcept> // std::runtime_error
+#include <vector>    // std::vector
+#include <initializer_list> // std::initializer_list
 
 namespace clblast {
 // =================================================================================================
@@ -104,6 +106,41 @@ class ErrorCode : public Base {
 
 // =================================================================================================
 
+// The global or local thread sizes of a kernel launch. These have at most three dimensions, so they
+// are stored in a fixed-size array instead of on the heap, such that a launch doesn't allocate.
+// Converts implicitly from a std::vector for callers which compute the sizes dynamically.
+class ThreadRange {
+ public:
+  static constexpr size_t kMaxDimensions = 3;
+
+  ThreadRange(): sizes_{0, 0, 0}, num_dimensions_(0) { }
+  ThreadRange(std::initializer_list<size_t> sizes): ThreadRange() {
+    for (const auto size : sizes) { push_back(size); }
+  }
+  ThreadRange(const std::vector<size_t> &sizes): ThreadRange() {
+    for (const auto size : sizes) { push_back(size); }
+  }
+
+  void push_back(const size_t size) {
+    if (num_dimensions_ == kMaxDimensions) { throw LogicError("ThreadRange: too many dimensions"); }
+    sizes_[num_dimensions_++] = size;
+  }
+
+  // Accessors in the style of a std::vector
+  size_t size() const { return num_dimensions_; }
+  bool empty() const { return num_dimensions_ == 0; }
+  size_t& operator[](const size_t i) { return sizes_[i]; }
+  const size_t& operator[](const size_t i) const { return sizes_[i]; }
+  const size_t* data() const { return sizes_; }
+  const size_t* begin() const { return sizes_; }
+  const size_t* end() const { return sizes_ + num_dimensions_; }
+ private:
+  size_t sizes_[kMaxDimensions];
+  size_t num_dimensions_;
+};
+
+// =================================================================================================
+
 } // namespace clblast
 
 // CLBLAST_CXPP11_COMMON_H_
@@ -12,45 +12,111 @@
 // =================================================================================================
 
 #include <list>
+#include <limits>
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <mutex>
+#include <cstdio>
+#include <cstdlib>
+#include <cctype>
 
 #include "utilities/utilities.hpp"
 
 #include "database/database.hpp"
-
-#include "database/kernels/xaxpy/xaxpy.hpp"
-#include "database/kernels/xdot/xdot.hpp"
-#include "database/kernels/xgemv/xgemv.hpp"
-#include "database/kernels/xgemv_fast/xgemv_fast.hpp"
-#include "database/kernels/xgemv_fast_rot/xgemv_fast_rot.hpp"
-#include "database/kernels/xger/xger.hpp"
-#include "database/kernels/xgemm/xgemm.hpp"
-#include "database/kernels/xgemm_direct/xgemm_direct.hpp"
-#include "database/kernels/copy/copy.hpp"
-#include "database/kernels/pad/pad.hpp"
-#include "database/kernels/transpose/transpose.hpp"
-#include "database/kernels/padtranspose/padtranspose.hpp"
-#include "database/kernels/invert/invert.hpp"
-
-#include "database/kernels/gemm_routine/gemm_routine.hpp"
-#include "database/kernels/trsv_routine/trsv_routine.hpp"
+#include "database/database_file.hpp"
+#include "database/database_compact.hpp"
 
 #include "database/apple_cpu_fallback.hpp"
+#include "database/cpu_fallback.hpp"
 
 namespace clblast {
 // =================================================================================================
 
-std::vector<database::DatabaseEntry> Database::database = std::vector<database::DatabaseEntry>{};
 const std::vector<database::DatabaseEntry> Database::apple_cpu_fallback = std::vector<database::DatabaseEntry>{
   database::XaxpyApple, database::XdotApple,
   database::XgemvApple, database::XgemvFastApple, database::XgemvFastRotApple, database::XgerApple, database::XtrsvApple,
-  database::XgemmApple, database::XgemmDirectApple,
+  database::XgemmApple, database::XgemmDirectApple, database::XconvgemmApple,
   database::CopyApple, database::PadApple, database::TransposeApple, database::PadtransposeApple,
   database::InvertApple
 };
+const std::vector<database::DatabaseEntry> Database::cpu_fallback = std::vector<database::DatabaseEntry>{
+  database::XaxpyCPU, database::XdotCPU,
+  database::XgemvCPU, database::XgemvFastCPU, database::XgemvFastRotCPU, database::XgerCPU,
+  database::XgemmCPU, database::XgemmDirectCPU, database::GemmRoutineCPU,
+  database::CopyCPU, database::PadCPU, database::TransposeCPU, database::PadtransposeCPU
+};
 
 // The default values
 const std::string Database::kDeviceVendorAll = "default";
 
+namespace {
+  std::mutex external_mutex;
+  auto external_database = std::make_shared<const std::vector<database::DatabaseEntry>>();
+
+  // Loads the file of the environmental variable (if set). Errors cannot be returned at this point,
+  // so they are printed and the built-in database is used.
+  bool InitExternalFromEnvironment() {
+    const auto environment_variable = std::getenv("CLBLAST_DATABASE_FILE");
+    if (environment_variable == nullptr || std::string{environment_variable}.empty()) {
+      return false;
+    }
+    try {
+      auto entries = ReadDatabaseFile(std::string{environment_variable});
+      std::lock_guard<std::mutex> lock(external_mutex);
+      external_database = std::make_shared<const std::vector<database::DatabaseEntry>>(std::move(entries));
+    } catch (const std::exception &e) {
+      fprintf(stderr, "CLBlast: could not load the database file '%s': %s\n",
+              environment_variable, e.what());
+    }
+    return true;
+  }
+
+  // The numbers of a driver version, e.g. {3423, 0} for "3423.0 (PAL,LC)" or {535, 104, 5} for
+  // "535.104.05": from the first digit up to the first character that is not a digit or a dot
+  std::vector<size_t> ParseDriverVersion(const std::string &version) {
+    auto numbers = std::vector<size_t>();
+    auto position = version.find_first_of("0123456789");
+    while (position != std::string::npos && position < version.size() &&
+           std::isdigit(static_cast<unsigned char>(version[position]))) {
+      auto number = size_t{0};
+      while (position < version.size() && std::isdigit(static_cast<unsigned char>(version[position]))) {
+        number = number * 10 + static_cast<size_t>(version[position] - '0');
+        ++position;
+      }
+      numbers.push_back(number);
+      if (position < version.size() && version[position] == '.') { ++position; }
+      else { break; }
+    }
+    return numbers;
+  }
+
+  // Compares two driver versions like 'strcmp', missing numbers count as zero
+  int CompareDriverVersions(const std::vector<size_t> &lhs, const std::vector<size_t> &rhs) {
+    for (auto i = size_t{0}; i < std::max(lhs.size(), rhs.size()); ++i) {
+      const auto lhs_number = (i < lhs.size()) ? lhs[i] : size_t{0};
+      const auto rhs_number = (i < rhs.size()) ? rhs[i] : size_t{0};
+      if (lhs_number != rhs_number) { return (lhs_number < rhs_number) ? -1 : 1; }
+    }
+    return 0;
+  }
+} // anonymous namespace
+
+void Database::LoadExternal(const std::string &file_name) {
+  GetExternal(); // first applies the environmental variable, which is overridden here
+  auto entries = (file_name.empty()) ? std::vector<database::DatabaseEntry>()
+                                     : ReadDatabaseFile(file_name);
+  std::lock_guard<std::mutex> lock(external_mutex);
+  external_database = std::make_shared<const std::vector<database::DatabaseEntry>>(std::move(entries));
+}
+
+std::shared_ptr<const std::vector<database::DatabaseEntry>> Database::GetExternal() {
+  static const auto from_environment = InitExternalFromEnvironment();
+  static_cast<void>(from_environment);
+  std::lock_guard<std::mutex> lock(external_mutex);
+  return external_database;
+}
+
 // =================================================================================================
 
 // Constructor, computing device properties and populating the parameter-vector from the database.
@@ -59,39 +125,22 @@ Database::Database(const Device &device, const std::string &kernel_name,
                    const Precision precision, const std::vector<database::DatabaseEntry> &overlay):
   parameters_(std::make_shared<database::Parameters>()) {
 
-  // Initializes the static variable on first use. At this point we are sure all global variables are initialized
-  if (database.size() == 0) {
-    database = std::vector<database::DatabaseEntry>{
-        database::XaxpyHalf, database::XaxpySingle, database::XaxpyDouble, database::XaxpyComplexSingle, database::XaxpyComplexDouble,
-        database::XdotHalf, database::XdotSingle, database::XdotDouble, database::XdotComplexSingle, database::XdotComplexDouble,
-        database::XgemvHalf, database::XgemvSingle, database::XgemvDouble, database::XgemvComplexSingle, database::XgemvComplexDouble,
-        database::XgemvFastHalf, database::XgemvFastSingle, database::XgemvFastDouble, database::XgemvFastComplexSingle, database::XgemvFastComplexDouble,
-        database::XgemvFastRotHalf, database::XgemvFastRotSingle, database::XgemvFastRotDouble, database::XgemvFastRotComplexSingle, database::XgemvFastRotComplexDouble,
-        database::XgerHalf, database::XgerSingle, database::XgerDouble, database::XgerComplexSingle, database::XgerComplexDouble,
-        database::XgemmHalf, database::XgemmSingle, database::XgemmDouble, database::XgemmComplexSingle, database::XgemmComplexDouble,
-        database::XgemmDirectHalf, database::XgemmDirectSingle, database::XgemmDirectDouble, database::XgemmDirectComplexSingle, database::XgemmDirectComplexDouble,
-        database::CopyHalf, database::CopySingle, database::CopyDouble, database::CopyComplexSingle, database::CopyComplexDouble,
-        database::PadHalf, database::PadSingle, database::PadDouble, database::PadComplexSingle, database::PadComplexDouble,
-        database::TransposeHalf, database::TransposeSingle, database::TransposeDouble, database::TransposeComplexSingle, database::TransposeComplexDouble,
-        database::PadtransposeHalf, database::PadtransposeSingle, database::PadtransposeDouble, database::PadtransposeComplexSingle, database::PadtransposeComplexDouble,
-        database::InvertHalf, database::InvertSingle, database::InvertDouble, database::InvertComplexSingle, database::InvertComplexDouble,
-        database::GemmRoutineHalf, database::GemmRoutineSingle, database::GemmRoutineDouble, database::GemmRoutineComplexSingle, database::GemmRoutineComplexDouble,
-        database::TrsvRoutineHalf, database::TrsvRoutineSingle, database::TrsvRoutineDouble, database::TrsvRoutineComplexSingle, database::TrsvRoutineComplexDouble
-    };
-  }
-
   // Finds device information
   const auto device_type = GetDeviceType(device);
   const auto device_vendor = GetDeviceVendor(device);
   const auto device_architecture = GetDeviceArchitecture(device);
   const auto device_name = GetDeviceName(device);
+  const auto driver_version = device.DriverVersion();
 
   // Prints the obtained information in verbose mode
   log_debug("Device type '" + device_type + "'; vendor '" + device_vendor + "'");
   log_debug("Device name '" + device_name + "'; architecture '" + device_architecture + "'");
+  log_debug("Driver version '" + driver_version + "'");
 
-  // Sets the databases to search through
-  auto databases = std::list<std::vector<database::DatabaseEntry>>{overlay, database};
+  // Sets the databases to search through: the overlay and the entries loaded at run-time, followed
+  // by the built-in database in compact form (see below)
+  const auto external = GetExternal();
+  auto databases = std::list<const std::vector<database::DatabaseEntry>*>{&overlay, external.get()};
 
   // Special case: modifies the database if the device is a CPU with Apple OpenCL
   #if defined(__APPLE__) || defined(__MACOSX)
@@ -99,23 +148,279 @@ Database::Database(const Device &device, const std::string &kernel_name,
       const auto extensions = device.Capabilities();
       const auto is_apple = (extensions.find("cl_APPLE_SetMemObjectDestructor") == std::string::npos) ? false : true;
       if (is_apple) {
-        databases.push_front(apple_cpu_fallback);
+        databases.push_front(&apple_cpu_fallback);
       }
     }
   #endif
 
-  // Searches potentially multiple databases
+  // Searches potentially multiple databases. Kernels which are not tuned separately (yet) use the
+  // parameters of the kernel they are derived from, see 'GetFallbackKernel'.
   auto search_result = database::Parameters();
-  for (auto &db: databases) {
-    search_result = Search(kernel_name, device_vendor, device_type,
-                           device_name, device_architecture, precision, db);
-    if (search_result.size() != 0) {
-      parameters_->insert(search_result.begin(), search_result.end());
-      break;
+  auto source = database::Source::kDefault;
+  for (auto search_kernel = kernel_name; !search_kernel.empty() && search_result.size() == 0;
+       search_kernel = GetFallbackKernel(search_kernel)) {
+    for (const auto db: databases) {
+      search_result = Search(search_kernel, device_vendor, device_type, device_name,
+                             device_architecture, driver_version, precision, *db);
+
+      // The mixed-precision mode, bfloat16 and storage-only half-precision use the half-precision
+      // parameters for kernels not tuned for them, since they also store 16-bit values
+      if (search_result.size() == 0 &&
+          (precision == Precision::kHalfSingle || precision == Precision::kBFloat16 ||
+           precision == Precision::kHalfStorage)) {
+        search_result = Search(search_kernel, device_vendor, device_type, device_name,
+                               device_architecture, driver_version, Precision::kHalf, *db);
+      }
+      if (search_result.size() != 0) {
+        source = (db == &overlay) ? database::Source::kOverride :
+                 (db == external.get()) ? database::Source::kDatabaseFile :
+                 database::Source::kCPUFallback; // the Apple CPU fall-back
+        break;
+      }
+    }
+
+    // Searches the built-in database, with the same half-precision fall-back as above. For a CPU of
+    // a vendor without tuned parameters, the generic CPU parameters are used rather than the
+    // defaults, as these are mostly tuned for GPUs.
+    if (search_result.size() == 0) {
+      const auto &built_in = CompactDatabase::BuiltIn();
+      const auto search_built_in = [&](const bool with_default) {
+        auto result = built_in.Search(search_kernel, precision, device_vendor, device_type,
+                                      device_name, device_architecture, with_default, &source);
+        if (result.size() == 0 &&
+            (precision == Precision::kHalfSingle || precision == Precision::kBFloat16 ||
+             precision == Precision::kHalfStorage)) {
+          result = built_in.Search(search_kernel, Precision::kHalf, device_vendor, device_type,
+                                   device_name, device_architecture, with_default, &source);
+        }
+        return result;
+      };
+      if (device_type == database::kDeviceTypeCPU) {
+        search_result = search_built_in(false);
+        if (search_result.size() == 0) {
+          search_result = Search(search_kernel, device_vendor, device_type, device_name,
+                                 device_architecture, driver_version, precision, cpu_fallback);
+          source = database::Source::kCPUFallback;
+        }
+      }
+      if (search_result.size() == 0) { search_result = search_built_in(true); }
+    }
+    if (search_result.size() != 0 && search_kernel != kernel_name) {
+      log_debug("Using the parameters of kernel '" + search_kernel + "' for '" + kernel_name + "'");
     }
   }
 
   if (search_result.size() == 0) { throw RuntimeErrorCode(StatusCode::kDatabaseError); }
+  SetParameters(kernel_name, search_result, source);
+}
+
+// Searches only the default entries of the built-in database, with the same fall-backs as above
+Database::Database(const std::string &kernel_name, const Precision precision):
+  parameters_(std::make_shared<database::Parameters>()) {
+  const auto &built_in = CompactDatabase::BuiltIn();
+  auto search_result = database::Parameters();
+  for (auto search_kernel = kernel_name; !search_kernel.empty() && search_result.size() == 0;
+       search_kernel = GetFallbackKernel(search_kernel)) {
+    search_result = built_in.Search(search_kernel, precision, kDeviceVendorAll,
+                                    database::kDeviceTypeAll, "default", "default");
+    if (search_result.size() == 0 &&
+        (precision == Precision::kHalfSingle || precision == Precision::kBFloat16 ||
+         precision == Precision::kHalfStorage)) {
+      search_result = built_in.Search(search_kernel, Precision::kHalf, kDeviceVendorAll,
+                                      database::kDeviceTypeAll, "default", "default");
+    }
+  }
+  if (search_result.size() == 0) { throw RuntimeErrorCode(StatusCode::kDatabaseError); }
+  SetParameters(kernel_name, search_result, database::Source::kDefault);
+}
+
+void Database::SetParameters(const std::string &kernel_name, const database::Parameters &parameters,
+                             const database::Source source) {
+  parameters_->insert(parameters.begin(), parameters.end());
+  const auto optional_parameters = GetOptionalParameters(kernel_name);
+  parameters_->insert(optional_parameters.begin(), optional_parameters.end());
+  source_ = source;
+  kernel_hash_ = Hash(kernel_name);
+  fingerprint_ = ComputeFingerprint(kernel_hash_, *parameters_);
+  flat_kernel_ = GetFlatKernel(kernel_name);
+  flat_parameters_ = ComputeFlatParameters(flat_kernel_, *parameters_);
+}
+
+uint64_t Database::ComputeFingerprint(const uint64_t kernel_hash, const database::Parameters &parameters) {
+  auto fingerprint = kernel_hash;
+  for (const auto &parameter: parameters) {
+    fingerprint = Hash(parameter.first, fingerprint);
+    fingerprint = Hash(static_cast<uint64_t>(parameter.second), fingerprint);
+  }
+  return fingerprint;
+}
+
+// =================================================================================================
+
+std::string Database::GetFallbackKernel(const std::string &kernel_name) {
+  if (kernel_name == "XgemmBatched" || kernel_name == "XgemmAlt") { return "Xgemm"; }
+  if (kernel_name == "XgemmDirectBatched") { return "XgemmDirect"; }
+  if (kernel_name == "Xamax" || kernel_name == "Xasum" || kernel_name == "Xnrm2") { return "Xdot"; }
+  if (kernel_name == "Xim2col") { return "Copy"; }
+  if (kernel_name == "XgemmSkinny") { return "Xgemv"; }
+  if (kernel_name == "Xcsr") { return "Xaxpy"; }
+  return "";
+}
+
+database::Parameters Database::GetOptionalParameters(const std::string &kernel_name) {
+  if (kernel_name == "Xgemm" || kernel_name == "XgemmBatched" || kernel_name == "XgemmAlt") {
+    return {{"DBUF", 0}, {"SWZ", 0}, {"FAST_MATH", 0}};
+  }
+  if (kernel_name == "XgemmDirect" || kernel_name == "XgemmDirectBatched") {
+    return {{"SWZD", 0}, {"FAST_MATH", 0}};
+  }
+  if (kernel_name == "GemmRoutine") {
+    // The parameters added after 'XGEMM_MIN_INDIRECT_SIZE' default to zero, which disables what they
+    // select, such that overrides which only set the original parameter keep working as before
+    return {{"XGEMM_MIN_SPLITK_K", 0},
+            {"XGEMM_MIN_3M_SIZE", 0},
+            {"XGEMM_MAX_ALT_SIZE", 0},
+            {"XGEMM_INDIRECT_COPY_COST", 0},
+            {"XGEMM_MIN_STRASSEN_SIZE", 0},
+            {"XGEMM_MIN_IMAGE_SIZE", 0}};
+  }
+  if (kernel_name == "Xgemv") {
+    return {{"SPLITN_RATIO", 64}, {"SPLITN_CHUNK", 4096}, {"FAST_MATH", 0}};
+  }
+
+  // The routine entries (e.g. 'TrsvRoutine') hold parameters of the host code rather than a kernel
+  const auto routine_suffix = std::string{"Routine"};
+  if (kernel_name.size() >= routine_suffix.size() &&
+      kernel_name.compare(kernel_name.size() - routine_suffix.size(), routine_suffix.size(),
+                          routine_suffix) == 0) {
+    return {};
+  }
+  return {{"FAST_MATH", 0}};
+}
+
+Database::FlatKernel Database::GetFlatKernel(const std::string &kernel_name) {
+  if (kernel_name == "Xgemm" || kernel_name == "XgemmBatched" || kernel_name == "XgemmAlt") {
+    return FlatKernel::kXgemm;
+  }
+  if (kernel_name == "XgemmDirect" || kernel_name == "XgemmDirectBatched") {
+    return FlatKernel::kXgemmDirect;
+  }
+  if (kernel_name == "GemmRoutine") { return FlatKernel::kGemmRoutine; }
+  if (kernel_name == "Copy") { return FlatKernel::kCopy; }
+  return FlatKernel::kNone;
+}
+
+database::FlatParameters Database::ComputeFlatParameters(const FlatKernel flat_kernel,
+                                                         const database::Parameters &parameters) {
+  const auto get = [&parameters](const std::string &key) {
+    const auto parameter = parameters.find(key);
+    if (parameter == parameters.end()) { throw RuntimeErrorCode(StatusCode::kDatabaseError); }
+    return parameter->second;
+  };
+  auto flat = database::FlatParameters();
+  switch (flat_kernel) {
+    case FlatKernel::kXgemm:
+      flat.xgemm.gemmk = get("GEMMK");
+      flat.xgemm.kreg = get("KREG");
+      flat.xgemm.kwg = get("KWG");
+      flat.xgemm.mdimc = get("MDIMC");
+      flat.xgemm.mwg = get("MWG");
+      flat.xgemm.ndimc = get("NDIMC");
+      flat.xgemm.nwg = get("NWG");
+      flat.xgemm.vwm = get("VWM");
+      flat.xgemm.vwn = get("VWN");
+      break;
+    case FlatKernel::kXgemmDirect:
+      flat.xgemm_direct.mdimcd = get("MDIMCD");
+      flat.xgemm_direct.ndimcd = get("NDIMCD");
+      flat.xgemm_direct.vwmd = get("VWMD");
+      flat.xgemm_direct.vwnd = get("VWND");
+      flat.xgemm_direct.wgd = get("WGD");
+      break;
+    case FlatKernel::kGemmRoutine:
+      flat.gemm_routine.min_indirect_size = get("XGEMM_MIN_INDIRECT_SIZE");
+      flat.gemm_routine.min_splitk_k = get("XGEMM_MIN_SPLITK_K");
+      flat.gemm_routine.min_3m_size = get("XGEMM_MIN_3M_SIZE");
+      flat.gemm_routine.max_alt_size = get("XGEMM_MAX_ALT_SIZE");
+      flat.gemm_routine.indirect_copy_cost = get("XGEMM_INDIRECT_COPY_COST");
+      flat.gemm_routine.min_strassen_size = get("XGEMM_MIN_STRASSEN_SIZE");
+      flat.gemm_routine.min_image_size = get("XGEMM_MIN_IMAGE_SIZE");
+      break;
+    case FlatKernel::kCopy:
+      flat.copy.dimx = get("COPY_DIMX");
+      flat.copy.dimy = get("COPY_DIMY");
+      flat.copy.vw = get("COPY_VW");
+      flat.copy.wpt = get("COPY_WPT");
+      break;
+    case FlatKernel::kNone:
+      break;
+  }
+  return flat;
+}
+
+void Database::GetFlatParameters(database::FlatParameters &flat) const {
+  switch (flat_kernel_) {
+    case FlatKernel::kXgemm: flat.xgemm = flat_parameters_.xgemm; break;
+    case FlatKernel::kXgemmDirect: flat.xgemm_direct = flat_parameters_.xgemm_direct; break;
+    case FlatKernel::kGemmRoutine: flat.gemm_routine = flat_parameters_.gemm_routine; break;
+    case FlatKernel::kCopy: flat.copy = flat_parameters_.copy; break;
+    case FlatKernel::kNone: break;
+  }
+}
+
+// =================================================================================================
+
+// Adds a problem-size specific parameter set. The first variant also stores the regular set as the
+// last entry, such that it can be selected again for larger problems.
+Database Database::WithSizeVariant(const size_t max_size, const database::Parameters &parameters,
+                                   const database::Source source) const {
+  auto variants = std::vector<SizeVariant>();
+  if (size_variants_ != nullptr) { variants = *size_variants_; }
+  else {
+    variants.push_back(SizeVariant{std::numeric_limits<size_t>::max(), parameters_, fingerprint_,
+                                   flat_parameters_, source_});
+  }
+
+  // Takes the parameters which are not set from the regular set
+  const auto &regular_parameters = *variants.back().parameters;
+  auto variant_parameters = std::make_shared<database::Parameters>(regular_parameters);
+  for (const auto &parameter: parameters) {
+    if (regular_parameters.count(parameter.first) == 0) {
+      throw RuntimeErrorCode(StatusCode::kMissingOverrideParameter);
+    }
+    (*variant_parameters)[parameter.first] = parameter.second;
+  }
+  const auto variant = SizeVariant{max_size, variant_parameters,
+                                   ComputeFingerprint(kernel_hash_, *variant_parameters),
+                                   ComputeFlatParameters(flat_kernel_, *variant_parameters),
+                                   source};
+
+  // Replaces an existing variant for the same size or inserts it in sorted order
+  const auto comparison = [](const SizeVariant &lhs, const size_t rhs) { return lhs.max_size < rhs; };
+  const auto position = std::lower_bound(variants.begin(), variants.end() - 1, max_size, comparison);
+  if (position != variants.end() - 1 && position->max_size == max_size) { *position = variant; }
+  else { variants.insert(position, variant); }
+
+  auto result = ForSize(0);
+  result.size_variants_ = std::make_shared<std::vector<SizeVariant>>(variants);
+  return result;
+}
+
+// Selects the first variant which covers the given size, the last one (the regular set) covers all
+Database Database::ForSize(const size_t size) const {
+  auto result = *this;
+  if (size_variants_ == nullptr) { return result; }
+  const SizeVariant* selected = &size_variants_->back();
+  if (size != 0) {
+    for (const auto &variant: *size_variants_) {
+      if (size <= variant.max_size) { selected = &variant; break; }
+    }
+  }
+  result.parameters_ = selected->parameters;
+  result.fingerprint_ = selected->fingerprint;
+  result.flat_parameters_ = selected->flat_parameters;
+  result.source_ = selected->source;
+  return result;
 }
 
 // =================================================================================================
@@ -153,6 +458,7 @@ std::vector<std::string> Database::GetParameterNames() const {
 database::Parameters Database::Search(const std::string &this_kernel,
                                       const std::string &this_vendor, const std::string &this_type,
                                       const std::string &this_device, const std::string &this_architecture,
+                                      const std::string &this_driver_version,
                                       const Precision this_precision,
                                       const std::vector<database::DatabaseEntry> &this_database) const {
 
@@ -163,10 +469,10 @@ database::Parameters Database::Search(const std::string &this_kernel,
 
       // Searches for the right vendor and device type, or selects the default if unavailable
       const auto parameters = SearchVendorAndType(this_vendor, this_type, this_device, this_architecture,
-                                                  db.vendors, db.parameter_names);
+                                                  this_driver_version, db.vendors, db.parameter_names);
       if (parameters.size() != 0) { return parameters; }
       return SearchVendorAndType(kDeviceVendorAll, database::kDeviceTypeAll, this_device, this_architecture,
-                                 db.vendors, db.parameter_names);
+                                 this_driver_version, db.vendors, db.parameter_names);
     }
   }
 
@@ -176,6 +482,7 @@ database::Parameters Database::Search(const std::string &this_kernel,
 
 database::Parameters Database::SearchVendorAndType(const std::string &target_vendor, const std::string &target_type,
                                                    const std::string &this_device, const std::string &this_architecture,
+                                                   const std::string &this_driver_version,
                                                    const std::vector<database::DatabaseVendor> &vendors,
                                                    const std::vector<std::string> &parameter_names) const {
   for (auto &vendor: vendors) {
@@ -183,9 +490,11 @@ database::Parameters Database::SearchVendorAndType(const std::string &target_ven
       log_debug("Found architectures of vendor '" + target_vendor + "' and type '" + target_type + "'");
 
       // Searches the architecture; if unavailable returns the vendor's default parameters
-      auto parameters = SearchArchitecture(this_architecture, this_device, vendor.architectures, parameter_names);
+      auto parameters = SearchArchitecture(this_architecture, this_device, this_driver_version,
+                                           vendor.architectures, parameter_names);
       if (parameters.size() != 0) { return parameters; }
-      return SearchArchitecture("default", this_device, vendor.architectures, parameter_names);
+      return SearchArchitecture("default", this_device, this_driver_version,
+                                vendor.architectures, parameter_names);
     }
   }
   return database::Parameters();
@@ -193,6 +502,7 @@ database::Parameters Database::SearchVendorAndType(const std::string &target_ven
 
 database::Parameters Database::SearchArchitecture(const std::string &target_architecture,
                                                   const std::string &this_device,
+                                                  const std::string &this_driver_version,
                                                   const std::vector<database::DatabaseArchitecture> &architectures,
                                                   const std::vector<std::string> &parameter_names) const {
   for (auto &architecture: architectures) {
@@ -200,34 +510,60 @@ database::Parameters Database::SearchArchitecture(const std::string &target_arch
       log_debug("Found devices of architecture type '" + target_architecture + "'");
 
       // Searches the device; if unavailable returns the architecture's default parameters
-      auto parameters = SearchDevice(this_device, architecture.devices, parameter_names);
+      auto parameters = SearchDevice(this_device, this_driver_version, architecture.devices,
+                                     parameter_names);
       if (parameters.size() != 0) { return parameters; }
-      return SearchDevice("default", architecture.devices, parameter_names);
+      return SearchDevice("default", this_driver_version, architecture.devices, parameter_names);
     }
   }
   return database::Parameters();
 }
 
+// Searches the device by name. Among multiple entries for the device, those for a range of driver
+// versions which includes 'this_driver_version' are preferred, the one with the most recent lower
+// bound first. Otherwise the version-agnostic entry is used (if any).
 database::Parameters Database::SearchDevice(const std::string &target_device,
+                                            const std::string &this_driver_version,
                                             const std::vector<database::DatabaseDevice> &devices,
                                             const std::vector<std::string> &parameter_names) const {
+  // Cuts off 'target_device' string at 50 since the database cuts off as well
+  const auto target_device_cut_off = (target_device.length() > 50) ? target_device.substr(0, 50) : target_device;
+  const database::DatabaseDevice* found_device = nullptr;
+  auto found_version_min = std::vector<size_t>();
+  const auto driver_version = ParseDriverVersion(this_driver_version);
   for (auto &device: devices) {
     const auto device_name = CharArrayToString(device.name);
-    // Cuts off 'target_device' string at 50 since the database cuts off as well
-    const auto target_device_cut_off = (target_device.length() > 50) ? target_device.substr(0, 50) : target_device;
-    if (device_name == target_device_cut_off) {
-      log_debug("Found parameters for device type '" + target_device_cut_off + "'");
-
-      // Sets the parameters accordingly
-      auto parameters = database::Parameters();
-      if (parameter_names.size() > device.parameters.size()) { return database::Parameters(); } // ERROR
-      for (auto i = size_t{0}; i < parameter_names.size(); ++i) {
-        parameters[parameter_names[i]] = static_cast<size_t>(device.parameters[i]);
-      }
-      return parameters;
+    if (device_name != target_device_cut_off) { continue; }
+    if (device.IsVersionAgnostic()) {
+      if (found_device == nullptr) { found_device = &device; }
+      continue;
     }
+
+    // Skips the entry if the driver is out of its range, or if a closer range was found already
+    const auto version_min = ParseDriverVersion(device.driver_version_min);
+    const auto version_max = ParseDriverVersion(device.driver_version_max);
+    if (!device.driver_version_min.empty() &&
+        CompareDriverVersions(driver_version, version_min) < 0) { continue; }
+    if (!device.driver_version_max.empty() &&
+        CompareDriverVersions(driver_version, version_max) > 0) { continue; }
+    if (found_device != nullptr && !found_device->IsVersionAgnostic() &&
+        CompareDriverVersions(version_min, found_version_min) <= 0) { continue; }
+    found_device = &device;
+    found_version_min = version_min;
   }
-  return database::Parameters();
+  if (found_device == nullptr) { return database::Parameters(); }
+  log_debug("Found parameters for device type '" + target_device_cut_off + "'" +
+            ((found_device->IsVersionAgnostic()) ? std::string{""} :
+             " and driver versions '" + found_device->driver_version_min + "' to '" +
+             found_device->driver_version_max + "'"));
+
+  // Sets the parameters accordingly
+  auto parameters = database::Parameters();
+  if (parameter_names.size() > found_device->parameters.size()) { return database::Parameters(); } // ERROR
+  for (auto i = size_t{0}; i < parameter_names.size(); ++i) {
+    parameters[parameter_names[i]] = static_cast<size_t>(found_device->parameters[i]);
+  }
+  return parameters;
 }
 
 // Helper to convert from database format to proper types
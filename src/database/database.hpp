@@ -7,10 +7,10 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Database class, providing a static variable holding the actual database
-// information. The class also provides utility functions to search the database and to access a
-// found entry by parameter-key. The database itself is filled in the corresponding source-file and
-// partially also by the database/xxxxx.h files, in which kernel-specific parameters are found.
+// This file implements the Database class, which searches the databases for the parameters of a
+// kernel and provides access to a found entry by parameter-key. The built-in database is stored in
+// compact form (see 'database_compact.hpp'), other databases (the user-provided overlay, the
+// entries loaded at run-time, and the Apple CPU fall-back) as regular database entries.
 //
 // =================================================================================================
 
@@ -19,6 +19,7 @@
 
 #include <string>
 #include <vector>
+#include <memory>
 #include <unordered_map>
 
 #include "utilities/utilities.hpp"
@@ -34,18 +35,27 @@ class Database {
   // The OpenCL device vendors
   static const std::string kDeviceVendorAll;
 
-  // The database consists of separate database entries, stored together in a vector
-  static std::vector<database::DatabaseEntry> database;
-
   // Database for a special case: Apple CPUs support limited number of threads
   static const std::vector<database::DatabaseEntry> apple_cpu_fallback;
 
+  // Database for CPUs of vendors without tuned parameters, used instead of the (GPU) defaults
+  static const std::vector<database::DatabaseEntry> cpu_fallback;
+
+  // Additional entries read from a file at run-time (see 'LoadDatabaseFile'), which are searched
+  // before the built-in database. The default file is taken from the 'CLBLAST_DATABASE_FILE'
+  // environmental variable (if set), an empty file name removes the entries.
+  static void LoadExternal(const std::string &file_name);
+
   Database() = default;
 
   // The constructor with a user-provided database overlay (potentially an empty vector)
   explicit Database(const Device &device, const std::string &kernel_name,
                     const Precision precision, const std::vector<database::DatabaseEntry> &overlay);
 
+  // The constructor for the generic parameters: the device-independent defaults of the built-in
+  // database, used by tiered compilation (see 'SetTieredCompilation')
+  explicit Database(const std::string &kernel_name, const Precision precision);
+
   // Accessor of values by key
   size_t operator[](const std::string &key) const { return parameters_->find(key)->second; }
   bool exists(const std::string &key) const { return (parameters_->count(key) == 1); }
@@ -58,31 +68,104 @@ class Database {
   std::vector<std::string> GetParameterNames() const;
   const database::Parameters& GetParameters() const { return *parameters_; }
 
+  // Retrieves a hash of the kernel name and all the parameters, computed once upon construction
+  uint64_t GetFingerprint() const { return fingerprint_; }
+
+  // Retrieves where the (selected set of) parameters were found
+  database::Source GetSource() const { return source_; }
+
+  // Copies the parameters in flat form into the part of 'flat' which belongs to this kernel. This
+  // is a no-op for kernels without a flat form.
+  void GetFlatParameters(database::FlatParameters &flat) const;
+
+  // Problem-size specific parameters: a copy of this database with an extra set of parameters,
+  // which is used instead of the regular one for problems of at most 'max_size' (and larger than
+  // the 'max_size' of the next-smaller set). Parameters not in 'parameters' keep their value.
+  Database WithSizeVariant(const size_t max_size, const database::Parameters &parameters,
+                           const database::Source source = database::Source::kOverride) const;
+
+  // Selects the set of parameters for a problem of the given size (zero selects the regular set).
+  // This does not allocate, the parameter sets are shared between the copies.
+  Database ForSize(const size_t size) const;
+  bool HasSizeVariants() const { return size_variants_ != nullptr; }
+
+  // The parameters which are optional in database files and overrides, with the values which leave
+  // the kernel as before, e.g. the double buffering or the grouped workgroup order of the GEMM
+  // kernels ('DBUF', 'SWZ' and 'SWZD'), the threshold of the image version of GEMM
+  // ('XGEMM_MIN_IMAGE_SIZE'), or the fast math mode of any kernel ('FAST_MATH', see 'MathMode').
+  // The exceptions are the thresholds of the split version of GEMV ('SPLITN_RATIO' and
+  // 'SPLITN_CHUNK'), which have working defaults. These are added if not found.
+  static database::Parameters GetOptionalParameters(const std::string &kernel_name);
+
  private:
-  // Search method functions, returning a set of parameters (possibly empty)
+  // Search method functions, returning a set of parameters (possibly empty). The built-in database
+  // is searched by 'CompactDatabase::Search' instead.
   database::Parameters Search(const std::string &this_kernel,
                               const std::string &this_vendor, const std::string &this_type,
                               const std::string &this_device, const std::string &this_architecture,
+                              const std::string &this_driver_version,
                               const Precision this_precision,
                               const std::vector<database::DatabaseEntry> &db) const;
   database::Parameters SearchDevice(const std::string &target_device,
+                        const std::string &this_driver_version,
                         const std::vector<database::DatabaseDevice> &devices,
                         const std::vector<std::string> &parameter_names) const;
   database::Parameters SearchArchitecture(const std::string &target_architecture,
                                           const std::string &this_device,
+                                          const std::string &this_driver_version,
                                           const std::vector<database::DatabaseArchitecture> &architectures,
                                           const std::vector<std::string> &parameter_names) const;
   database::Parameters SearchVendorAndType(const std::string &target_vendor,
                                            const std::string &target_type,
                                            const std::string &this_device, const std::string &this_architecture,
+                                           const std::string &this_driver_version,
                                            const std::vector<database::DatabaseVendor> &vendors,
                                            const std::vector<std::string> &parameter_names) const;
 
+  // The entries loaded by 'LoadExternal', shared such that they can be replaced at any time
+  static std::shared_ptr<const std::vector<database::DatabaseEntry>> GetExternal();
+
   // Helper to convert from database format to proper types
   std::string CharArrayToString(const database::Name char_array) const;
 
+  // Sets the found parameters and computes their fingerprint and flat form
+  void SetParameters(const std::string &kernel_name, const database::Parameters &parameters,
+                     const database::Source source);
+
+  // Computes the fingerprint of a set of parameters, seeded with the hash of the kernel name
+  static uint64_t ComputeFingerprint(const uint64_t kernel_hash, const database::Parameters &parameters);
+
+  // The kernel whose parameters are used if a kernel is not found in any database, e.g. the regular
+  // GEMM kernels for the batched ones or the dot-product kernel for the other reductions. Returns an
+  // empty string if there is no such kernel.
+  static std::string GetFallbackKernel(const std::string &kernel_name);
+
+  // The kernels with parameters in flat form
+  enum class FlatKernel { kNone, kXgemm, kXgemmDirect, kGemmRoutine, kCopy };
+  static FlatKernel GetFlatKernel(const std::string &kernel_name);
+
+  // Converts a set of parameters into the flat form of 'flat_kernel'
+  static database::FlatParameters ComputeFlatParameters(const FlatKernel flat_kernel,
+                                                        const database::Parameters &parameters);
+
   // Found parameters suitable for this device/kernel
   std::shared_ptr<database::Parameters> parameters_;
+  uint64_t fingerprint_ = 0;
+  uint64_t kernel_hash_ = 0;
+  database::Source source_ = database::Source::kDefault;
+  FlatKernel flat_kernel_ = FlatKernel::kNone;
+  database::FlatParameters flat_parameters_;
+
+  // The optional problem-size specific parameter sets, sorted by 'max_size'. The last one is always
+  // the regular set, with the maximum possible 'max_size'.
+  struct SizeVariant {
+    size_t max_size;
+    std::shared_ptr<database::Parameters> parameters;
+    uint64_t fingerprint;
+    database::FlatParameters flat_parameters;
+    database::Source source;
+  };
+  std::shared_ptr<std::vector<SizeVariant>> size_variants_;
 };
 
 // =================================================================================================
@@ -105,9 +188,30 @@ class Databases {
     throw RuntimeErrorCode(StatusCode::kDatabaseError);
   }
 
+  // Retrieves the parameters of all kernels in flat form, for use in the hot paths
+  const database::FlatParameters& GetFlatParameters() const { return flat_parameters_; }
+
+  // Combines the flat parameters of all kernels, this has to be called after changing any of them
+  void ResolveFlatParameters() {
+    flat_parameters_ = database::FlatParameters();
+    for (const auto &kernel_name : kernel_names_) {
+      databases_[kernel_name].GetFlatParameters(flat_parameters_);
+    }
+  }
+
+  // Selects the problem-size specific parameters of all kernels (see 'Database::ForSize')
+  void SelectSize(const size_t size) {
+    for (const auto &kernel_name : kernel_names_) {
+      auto &kernel_db = databases_[kernel_name];
+      kernel_db = kernel_db.ForSize(size);
+    }
+    ResolveFlatParameters();
+  }
+
  private:
   const std::vector<std::string> kernel_names_;
   std::unordered_map<std::string, Database> databases_;
+  database::FlatParameters flat_parameters_;
 };
 
 // =================================================================================================
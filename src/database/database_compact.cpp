@@ -0,0 +1,308 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the CompactDatabase class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cctype>
+
+#include "utilities/utilities.hpp"
+#include "database/database_compact.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+constexpr uint32_t CompactDatabase::kMagic;
+constexpr uint32_t CompactDatabase::kVersion;
+constexpr size_t CompactDatabase::kHeaderWords;
+constexpr size_t CompactDatabase::kEntryWords;
+constexpr size_t CompactDatabase::kVendorWords;
+constexpr size_t CompactDatabase::kArchitectureWords;
+constexpr size_t CompactDatabase::kDeviceWords;
+constexpr double CompactDatabase::kMinDeviceSimilarity;
+constexpr size_t CompactDatabase::kNoDevice;
+
+// Reads the header. The tables themselves are only checked for fitting in the data, the encoded
+// data is assumed to come from 'database.py'.
+CompactDatabase::CompactDatabase(const unsigned char* data, const size_t size):
+    data_(data), size_(size), num_entries_(0), entries_(0), vendors_(0), architectures_(0),
+    devices_(0) {
+  if (size_ < kHeaderWords * 4 || Word(0) != kMagic || Word(4) != kVersion) {
+    throw RuntimeErrorCode(StatusCode::kDatabaseError, "invalid compact database header");
+  }
+  num_entries_ = Word(8);
+  entries_ = Word(12);
+  vendors_ = Word(16);
+  architectures_ = Word(20);
+  devices_ = Word(24);
+  if (entries_ + num_entries_ * kEntryWords * 4 > vendors_ || vendors_ > architectures_ ||
+      architectures_ > devices_ || devices_ > size_) {
+    throw RuntimeErrorCode(StatusCode::kDatabaseError, "invalid compact database tables");
+  }
+}
+
+const CompactDatabase& CompactDatabase::BuiltIn() {
+  static const auto built_in = CompactDatabase(database::kCompactDatabase,
+                                               database::kCompactDatabaseSize);
+  return built_in;
+}
+
+// =================================================================================================
+
+// Decodes explicitly, such that the data needs no alignment and is independent of the host
+uint32_t CompactDatabase::Word(const size_t offset) const {
+  return static_cast<uint32_t>(data_[offset]) |
+         (static_cast<uint32_t>(data_[offset + 1]) << 8) |
+         (static_cast<uint32_t>(data_[offset + 2]) << 16) |
+         (static_cast<uint32_t>(data_[offset + 3]) << 24);
+}
+
+uint32_t CompactDatabase::Field(const Range &range, const size_t index, const size_t field) const {
+  return Word(range.table_offset + (index * range.record_words + field) * 4);
+}
+
+const char* CompactDatabase::String(const size_t offset) const {
+  return reinterpret_cast<const char*>(data_ + offset);
+}
+
+template <typename F>
+size_t CompactDatabase::Find(const Range &range, F compare) const {
+  auto low = range.begin;
+  auto high = range.end;
+  while (low < high) {
+    const auto middle = low + (high - low) / 2;
+    if (compare(middle) < 0) { low = middle + 1; }
+    else { high = middle; }
+  }
+  return (low != range.end && compare(low) == 0) ? low : range.end;
+}
+
+// =================================================================================================
+
+// Searches for the right kernel and precision, or a precision-independent entry as a fall-back
+database::Parameters CompactDatabase::Search(const std::string &kernel, const Precision precision,
+                                             const std::string &vendor, const std::string &type,
+                                             const std::string &device,
+                                             const std::string &architecture,
+                                             const bool with_default,
+                                             database::Source* source) const {
+  auto found_source = database::Source::kDefault;
+  const auto entries = Range{0, num_entries_, entries_, kEntryWords};
+  for (const auto target_precision : {precision, Precision::kAny}) {
+    const auto precision_value = static_cast<uint32_t>(static_cast<int>(target_precision));
+    const auto entry = Find(entries, [&](const size_t index) {
+      const auto compare = std::strcmp(String(Field(entries, index, 0)), kernel.c_str());
+      if (compare != 0) { return compare; }
+      const auto entry_precision = Field(entries, index, 1);
+      return (entry_precision < precision_value) ? -1 : (entry_precision > precision_value) ? 1 : 0;
+    });
+    if (entry == entries.end) { continue; }
+
+    // Searches for the right vendor and device type, or selects the default if unavailable
+    const auto parameters = SearchVendorAndType(entry, vendor, type, device, architecture,
+                                                found_source);
+    if (source != nullptr) { *source = found_source; }
+    if (parameters.size() != 0 || !with_default) { return parameters; }
+    if (source != nullptr) { *source = database::Source::kDefault; }
+    return SearchVendorAndType(entry, "default", database::kDeviceTypeAll, device, architecture,
+                               found_source);
+  }
+  return database::Parameters();
+}
+
+database::Parameters CompactDatabase::SearchVendorAndType(const size_t entry,
+                                                          const std::string &vendor,
+                                                          const std::string &type,
+                                                          const std::string &device,
+                                                          const std::string &architecture,
+                                                          database::Source &source) const {
+  const auto entries = Range{0, num_entries_, entries_, kEntryWords};
+  const auto vendors = Range{Field(entries, entry, 4), Field(entries, entry, 5),
+                             vendors_, kVendorWords};
+  const auto found = Find(vendors, [&](const size_t index) {
+    const auto compare = std::strcmp(String(Field(vendors, index, 1)), vendor.c_str());
+    if (compare != 0) { return compare; }
+    return std::strcmp(String(Field(vendors, index, 0)), type.c_str());
+  });
+  if (found == vendors.end) { return database::Parameters(); }
+  log_debug("Found architectures of vendor '" + vendor + "' and type '" + type + "'");
+
+  // Searches the device itself, in its architecture or among the devices without architecture
+  const auto architectures = Range{Field(vendors, found, 2), Field(vendors, found, 3),
+                                   architectures_, kArchitectureWords};
+  for (const auto &target_architecture : {architecture, std::string{"default"}}) {
+    const auto found_architecture = Find(architectures, [&](const size_t index) {
+      return std::strcmp(String(Field(architectures, index, 0)), target_architecture.c_str());
+    });
+    if (found_architecture == architectures.end) { continue; }
+    const auto parameters = SearchDevice(entry, found_architecture, device);
+    source = database::Source::kDevice;
+    if (parameters.size() != 0) { return parameters; }
+  }
+
+  // Borrows the parameters of a similar device, which are likely better than the defaults
+  const auto nearest = FindNearestDevice(found, device, architecture);
+  if (nearest != kNoDevice) {
+    const auto devices = Range{0, 0, devices_, kDeviceWords};
+    const auto nearest_name = std::string{String(Field(devices, nearest, 0))};
+    log_debug("Borrowing the parameters of device '" + nearest_name + "' for '" + device + "'");
+    source = database::Source::kSimilarDevice;
+    return GetParameters(entry, nearest);
+  }
+
+  // Searches the architecture; if unavailable returns the vendor's default parameters
+  const auto parameters = SearchArchitecture(entry, found, architecture, device, source);
+  if (parameters.size() != 0) { return parameters; }
+  const auto vendor_parameters = SearchArchitecture(entry, found, "default", device, source);
+  source = database::Source::kVendor;
+  return vendor_parameters;
+}
+
+database::Parameters CompactDatabase::SearchArchitecture(const size_t entry, const size_t vendor,
+                                                         const std::string &architecture,
+                                                         const std::string &device,
+                                                         database::Source &source) const {
+  const auto vendors = Range{0, 0, vendors_, kVendorWords};
+  const auto architectures = Range{Field(vendors, vendor, 2), Field(vendors, vendor, 3),
+                                   architectures_, kArchitectureWords};
+  const auto found = Find(architectures, [&](const size_t index) {
+    return std::strcmp(String(Field(architectures, index, 0)), architecture.c_str());
+  });
+  if (found == architectures.end) { return database::Parameters(); }
+  log_debug("Found devices of architecture type '" + architecture + "'");
+
+  // Searches the device; if unavailable returns the architecture's default parameters
+  const auto parameters = SearchDevice(entry, found, device);
+  source = database::Source::kDevice;
+  if (parameters.size() != 0) { return parameters; }
+  source = database::Source::kArchitecture;
+  return SearchDevice(entry, found, "default");
+}
+
+database::Parameters CompactDatabase::SearchDevice(const size_t entry, const size_t architecture,
+                                                   const std::string &device) const {
+  const auto architectures = Range{0, 0, architectures_, kArchitectureWords};
+  const auto devices = Range{Field(architectures, architecture, 1),
+                             Field(architectures, architecture, 2), devices_, kDeviceWords};
+
+  // Cuts off 'device' string at 50 since the database cuts off as well
+  const auto device_cut_off = (device.length() > 50) ? device.substr(0, 50) : device;
+  const auto found = Find(devices, [&](const size_t index) {
+    return std::strcmp(String(Field(devices, index, 0)), device_cut_off.c_str());
+  });
+  if (found == devices.end) { return database::Parameters(); }
+  log_debug("Found parameters for device type '" + device_cut_off + "'");
+  return GetParameters(entry, found);
+}
+
+database::Parameters CompactDatabase::GetParameters(const size_t entry, const size_t device) const {
+  const auto entries = Range{0, num_entries_, entries_, kEntryWords};
+  const auto devices = Range{0, 0, devices_, kDeviceWords};
+  const auto num_parameters = Field(entries, entry, 2);
+  const auto names = Field(entries, entry, 3);
+  const auto values = Field(devices, device, 1);
+  auto parameters = database::Parameters();
+  for (auto i = size_t{0}; i < num_parameters; ++i) {
+    parameters[String(Word(names + i * 4))] = static_cast<size_t>(Word(values + i * 4));
+  }
+  return parameters;
+}
+
+// =================================================================================================
+
+// Considers all named devices of all architectures of the vendor, the first best one is selected
+size_t CompactDatabase::FindNearestDevice(const size_t vendor, const std::string &device,
+                                          const std::string &architecture) const {
+  const auto vendors = Range{0, 0, vendors_, kVendorWords};
+  const auto architectures = Range{Field(vendors, vendor, 2), Field(vendors, vendor, 3),
+                                   architectures_, kArchitectureWords};
+  auto nearest = kNoDevice;
+  auto best_similarity = kMinDeviceSimilarity;
+  for (auto a = architectures.begin; a < architectures.end; ++a) {
+    const auto known_architecture = std::string{String(Field(architectures, a, 0))};
+    const auto devices = Range{Field(architectures, a, 1), Field(architectures, a, 2),
+                               devices_, kDeviceWords};
+    for (auto d = devices.begin; d < devices.end; ++d) {
+      const auto known_device = String(Field(devices, d, 0));
+      if (std::strcmp(known_device, "default") == 0) { continue; }
+      const auto similarity = DeviceSimilarity(device, architecture, known_device,
+                                               known_architecture);
+      if (similarity > best_similarity ||
+          (nearest == kNoDevice && similarity == best_similarity)) {
+        nearest = d;
+        best_similarity = similarity;
+      }
+    }
+  }
+  return nearest;
+}
+
+double CompactDatabase::DeviceSimilarity(const std::string &device,
+                                         const std::string &architecture,
+                                         const std::string &known_device,
+                                         const std::string &known_architecture) {
+
+  // The architecture: equal, none, or with a long common prefix (e.g. 'gfx1030' and 'gfx1031')
+  if (known_architecture != architecture && known_architecture != "default") {
+    auto common = size_t{0};
+    while (common < architecture.size() && common < known_architecture.size() &&
+           architecture[common] == known_architecture[common]) { ++common; }
+    const auto longest = std::max(architecture.size(), known_architecture.size());
+    if (common * 4 < longest * 3) { return 0.0; }
+  }
+
+  // Splits the names into lower-case alpha-numerical tokens
+  const auto tokenize = [](const std::string &name) {
+    auto tokens = std::vector<std::string>();
+    auto token = std::string{};
+    for (const auto character : name + " ") {
+      if (std::isalnum(static_cast<unsigned char>(character))) {
+        token += static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+      }
+      else if (!token.empty()) { tokens.push_back(token); token.clear(); }
+    }
+    return tokens;
+  };
+  const auto is_number = [](const std::string &token) {
+    return std::all_of(token.begin(), token.end(), [](const char c) {
+      return std::isdigit(static_cast<unsigned char>(c)) != 0;
+    });
+  };
+  const auto tokens = tokenize(device);
+  const auto known_tokens = tokenize(known_device);
+  if (tokens.empty() || known_tokens.empty()) { return 0.0; }
+
+  // Matches each token to the best token of the other name: equal tokens count fully, numbers of
+  // the same length count half, scaled by how close they are (e.g. '3070' and '3080')
+  auto matches = 0.0;
+  for (const auto &token : tokens) {
+    auto best_match = 0.0;
+    for (const auto &known_token : known_tokens) {
+      if (token == known_token) { best_match = 1.0; break; }
+      if (is_number(token) && is_number(known_token) && token.size() == known_token.size()) {
+        const auto value = std::stod(token);
+        const auto known_value = std::stod(known_token);
+        const auto largest = std::max(value, known_value);
+        if (largest > 0.0) {
+          best_match = std::max(best_match, 0.5 * std::min(value, known_value) / largest);
+        }
+      }
+    }
+    matches += best_match;
+  }
+  return matches / static_cast<double>(std::max(tokens.size(), known_tokens.size()));
+}
+
+// =================================================================================================
+} // namespace clblast
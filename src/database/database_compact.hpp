@@ -0,0 +1,138 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the CompactDatabase class, which searches the built-in database in its
+// compact binary form. The encoding is produced by 'scripts/database/database.py' (see
+// 'encode_compact_database' for the layout): it consists of 32-bit little-endian words and
+// zero-terminated strings, all referenced by offset, with sorted tables of entries, vendors,
+// architectures and devices. Thus, a search is a sequence of binary searches directly on the
+// encoded data, which is read-only and never copied, and nothing is allocated until a result is
+// found. The same data is also available in readable form in the 'database/kernels/*/*_*.hpp'
+// files, which are generated from the same source.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_DATABASE_DATABASE_COMPACT_H_
+#define CLBLAST_DATABASE_DATABASE_COMPACT_H_
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+#include "database/database_structure.hpp"
+
+namespace clblast {
+namespace database {
+// =================================================================================================
+
+// The built-in database in compact binary form (see 'database/kernels/database_compact.cpp')
+extern const unsigned char kCompactDatabase[];
+extern const size_t kCompactDatabaseSize;
+
+// =================================================================================================
+} // namespace database
+
+// See comment at top of file for a description of the class
+class CompactDatabase {
+ public:
+
+  // Settings of the encoding (also change in 'scripts/database/database/clblast.py')
+  static constexpr uint32_t kMagic = 0x44424C43; // "CLBD"
+  static constexpr uint32_t kVersion = 1;
+
+  // Refers to encoded data, which has to outlive this object. Throws if the header is invalid.
+  CompactDatabase(const unsigned char* data, const size_t size);
+
+  // The built-in database
+  static const CompactDatabase& BuiltIn();
+
+  // Searches for the parameters in the same way as 'Database::Search': the device's vendor and
+  // type, architecture, and name, each falling back to "default" if not found. Returns an empty
+  // set of parameters if the kernel or precision is not found. One exception: if the vendor and
+  // type are found but the device is not, the parameters of the most similar device of that vendor
+  // and type are used (if any is similar enough) instead of the defaults. Without 'with_default',
+  // an empty set is returned instead of the defaults if the vendor and type are not found. The
+  // level at which the parameters were found is stored in 'source' (if given).
+  database::Parameters Search(const std::string &kernel, const Precision precision,
+                              const std::string &vendor, const std::string &type,
+                              const std::string &device, const std::string &architecture,
+                              const bool with_default = true,
+                              database::Source* source = nullptr) const;
+
+  // The similarity of two devices of the same vendor and type, from 0 (not similar at all) to 1.
+  // The architectures have to be equal or of the same family (e.g. 'SM8.0' and 'SM8.6'), or the
+  // known device has to be without architecture. The score is the fraction of matching tokens of
+  // the names, in which numbers of the same length (e.g. model numbers) match partially.
+  static double DeviceSimilarity(const std::string &device, const std::string &architecture,
+                                 const std::string &known_device,
+                                 const std::string &known_architecture);
+  static constexpr double kMinDeviceSimilarity = 0.6;
+
+ private:
+
+  // Sizes of the records in words
+  static constexpr size_t kHeaderWords = 8;
+  static constexpr size_t kEntryWords = 6;
+  static constexpr size_t kVendorWords = 4;
+  static constexpr size_t kArchitectureWords = 3;
+  static constexpr size_t kDeviceWords = 2;
+
+  // A range of records in a table: the offset of the record at 'begin' and the record size
+  struct Range {
+    size_t begin;
+    size_t end;
+    size_t table_offset;
+    size_t record_words;
+  };
+
+  // Reads the word at the given byte offset, or the given word of the record at 'index' in 'range'
+  uint32_t Word(const size_t offset) const;
+  uint32_t Field(const Range &range, const size_t index, const size_t field) const;
+  const char* String(const size_t offset) const;
+
+  // Binary search for the first record in 'range' for which 'compare' returns zero or more, with
+  // 'compare' returning <0, 0, or >0 like 'strcmp'. Returns 'range.end' if there is no exact match.
+  template <typename F>
+  size_t Find(const Range &range, F compare) const;
+
+  // Searches within a single entry, see 'Database::SearchVendorAndType' and further
+  database::Parameters SearchVendorAndType(const size_t entry, const std::string &vendor,
+                                           const std::string &type, const std::string &device,
+                                           const std::string &architecture,
+                                           database::Source &source) const;
+  database::Parameters SearchArchitecture(const size_t entry, const size_t vendor,
+                                          const std::string &architecture,
+                                          const std::string &device,
+                                          database::Source &source) const;
+  database::Parameters SearchDevice(const size_t entry, const size_t architecture,
+                                    const std::string &device) const;
+
+  // Finds the most similar device of a vendor (see 'DeviceSimilarity'), returns the index of the
+  // device or 'kNoDevice' if none is similar enough
+  static constexpr size_t kNoDevice = static_cast<size_t>(-1);
+  size_t FindNearestDevice(const size_t vendor, const std::string &device,
+                           const std::string &architecture) const;
+
+  // Retrieves the parameters of a device
+  database::Parameters GetParameters(const size_t entry, const size_t device) const;
+
+  const unsigned char* data_;
+  size_t size_;
+  size_t num_entries_;
+  size_t entries_;
+  size_t vendors_;
+  size_t architectures_;
+  size_t devices_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_DATABASE_DATABASE_COMPACT_H_
+#endif
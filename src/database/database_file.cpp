@@ -0,0 +1,287 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements reading database entries from a file (see the header for the format).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <array>
+#include <tuple>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cctype>
+
+#include "utilities/utilities.hpp"
+#include "database/database_file.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+  // The version of the file format, bump whenever it changes
+  constexpr auto kDatabaseFileVersion = size_t{1};
+
+  // A single record of the file
+  struct Record {
+    std::string kernel;
+    Precision precision;
+    std::string device_type;
+    std::string device_vendor;
+    std::string device_architecture;
+    std::string device_name;
+    std::string driver_version_min;
+    std::string driver_version_max;
+    database::Parameters parameters;
+  };
+
+  // A minimal reader for the subset of JSON used by the file: objects, arrays, strings without
+  // unicode escapes, and non-negative integers. Other values (e.g. floats) can only be skipped.
+  class JSONReader {
+   public:
+    explicit JSONReader(const std::string &text): text_(text), position_(0) { }
+
+    void Expect(const char character) {
+      if (!Consume(character)) { Fail(std::string{"expected '"} + character + "'"); }
+    }
+    bool Consume(const char character) {
+      SkipWhitespace();
+      if (position_ < text_.size() && text_[position_] == character) { ++position_; return true; }
+      return false;
+    }
+    char Peek() {
+      SkipWhitespace();
+      if (position_ >= text_.size()) { Fail("unexpected end of file"); }
+      return text_[position_];
+    }
+    bool AtEnd() {
+      SkipWhitespace();
+      return position_ >= text_.size();
+    }
+
+    std::string ReadString() {
+      Expect('"');
+      auto result = std::string{};
+      while (position_ < text_.size() && text_[position_] != '"') {
+        auto character = text_[position_++];
+        if (character == '\\') {
+          if (position_ >= text_.size()) { break; }
+          character = text_[position_++];
+          if (character == 'n') { character = '\n'; }
+          else if (character == 't') { character = '\t'; }
+          else if (character != '"' && character != '\\' && character != '/') {
+            Fail("unsupported escape sequence");
+          }
+        }
+        result += character;
+      }
+      Expect('"');
+      return result;
+    }
+
+    size_t ReadInteger() {
+      SkipWhitespace();
+      const auto start = position_;
+      while (position_ < text_.size() && IsDigit(text_[position_])) { ++position_; }
+      if (start == position_) { Fail("expected a non-negative integer"); }
+      return static_cast<size_t>(std::stoull(text_.substr(start, position_ - start)));
+    }
+
+    // Calls 'on_key' for each key of an object, which has to read the value
+    template <typename F>
+    void ReadObject(F on_key) {
+      Expect('{');
+      if (Consume('}')) { return; }
+      do {
+        const auto key = ReadString();
+        Expect(':');
+        on_key(key);
+      } while (Consume(','));
+      Expect('}');
+    }
+
+    // Calls 'on_element' for each element of an array, which has to read the value
+    template <typename F>
+    void ReadArray(F on_element) {
+      Expect('[');
+      if (Consume(']')) { return; }
+      do { on_element(); } while (Consume(','));
+      Expect(']');
+    }
+
+    void SkipValue() {
+      const auto character = Peek();
+      if (character == '{') { ReadObject([this](const std::string &) { SkipValue(); }); }
+      else if (character == '[') { ReadArray([this]() { SkipValue(); }); }
+      else if (character == '"') { ReadString(); }
+      else {
+        while (position_ < text_.size() && text_[position_] != ',' && text_[position_] != '}' &&
+               text_[position_] != ']' && !IsSpace(text_[position_])) {
+          ++position_;
+        }
+      }
+    }
+
+    void Fail(const std::string &reason) const {
+      throw RuntimeErrorCode(StatusCode::kDatabaseError, "database file: " + reason +
+                             " at position " + ToString(position_));
+    }
+
+   private:
+    static bool IsSpace(const char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; }
+    static bool IsDigit(const char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; }
+    void SkipWhitespace() {
+      while (position_ < text_.size() && IsSpace(text_[position_])) { ++position_; }
+    }
+
+    const std::string &text_;
+    size_t position_;
+  };
+
+  Record ReadRecord(JSONReader &reader) {
+    auto record = Record{"", Precision::kAny, database::kDeviceTypeAll, "default", "default",
+                         "default", "", "", database::Parameters()};
+    auto has_precision = false;
+    reader.ReadObject([&](const std::string &key) {
+      if (key == "kernel") { record.kernel = reader.ReadString(); }
+      else if (key == "precision") {
+        record.precision = static_cast<Precision>(reader.ReadInteger());
+        has_precision = true;
+      }
+      else if (key == "device_type") { record.device_type = reader.ReadString(); }
+      else if (key == "device_vendor") { record.device_vendor = reader.ReadString(); }
+      else if (key == "device_architecture") { record.device_architecture = reader.ReadString(); }
+      else if (key == "device_name") { record.device_name = reader.ReadString(); }
+      else if (key == "driver_version_min") { record.driver_version_min = reader.ReadString(); }
+      else if (key == "driver_version_max") { record.driver_version_max = reader.ReadString(); }
+      else if (key == "parameters") {
+        reader.ReadObject([&](const std::string &name) {
+          record.parameters[name] = reader.ReadInteger();
+        });
+      }
+      else { reader.SkipValue(); }
+    });
+    if (record.kernel.empty() || !has_precision || record.parameters.empty()) {
+      reader.Fail("a record needs a kernel, a precision, and parameters");
+    }
+    if (record.parameters.size() > std::tuple_size<database::Params>::value) {
+      reader.Fail("too many parameters for kernel '" + record.kernel + "'");
+    }
+    return record;
+  }
+
+  // Device names are stored with a fixed length, padded with spaces (see 'database.py')
+  database::Name ToName(const std::string &device_name) {
+    auto name = database::Name();
+    const auto length = name.size() - 1;
+    std::fill(name.begin(), name.end(), ' ');
+    std::copy_n(device_name.begin(), std::min(device_name.size(), length), name.begin());
+    name[length] = '\0';
+    return name;
+  }
+
+} // anonymous namespace
+
+// =================================================================================================
+
+std::vector<database::DatabaseEntry> ParseDatabaseFile(const std::string &contents) {
+
+  // Reads the records, the ones for the same kernel, precision and device are merged
+  auto records = std::vector<Record>();
+  JSONReader reader(contents);
+  auto version = size_t{0};
+  reader.ReadObject([&](const std::string &key) {
+    if (key == "version") { version = reader.ReadInteger(); }
+    else if (key == "entries") {
+      reader.ReadArray([&]() {
+        const auto record = ReadRecord(reader);
+        const auto same_device = [&record](const Record &other) {
+          return other.kernel == record.kernel && other.precision == record.precision &&
+                 other.device_type == record.device_type &&
+                 other.device_vendor == record.device_vendor &&
+                 other.device_architecture == record.device_architecture &&
+                 other.device_name == record.device_name &&
+                 other.driver_version_min == record.driver_version_min &&
+                 other.driver_version_max == record.driver_version_max;
+        };
+        const auto existing = std::find_if(records.begin(), records.end(), same_device);
+        if (existing == records.end()) { records.push_back(record); }
+        else { existing->parameters.insert(record.parameters.begin(), record.parameters.end()); }
+      });
+    }
+    else { reader.SkipValue(); }
+  });
+  if (!reader.AtEnd()) { reader.Fail("unexpected data after the end"); }
+  if (version != kDatabaseFileVersion) { reader.Fail("unsupported version " + ToString(version)); }
+
+  // Groups the records into database entries per kernel and precision
+  auto entries = std::vector<database::DatabaseEntry>();
+  for (const auto &record : records) {
+    auto parameter_names = std::vector<std::string>();
+    auto parameter_values = database::Params{0};
+    for (const auto &parameter : record.parameters) {
+      parameter_values[parameter_names.size()] = parameter.second;
+      parameter_names.push_back(parameter.first);
+    }
+
+    auto entry = std::find_if(entries.begin(), entries.end(),
+                              [&record](const database::DatabaseEntry &e) {
+      return e.kernel == record.kernel && e.precision == record.precision;
+    });
+    if (entry == entries.end()) {
+      entries.push_back(database::DatabaseEntry{record.kernel, record.precision,
+                                                parameter_names, {}});
+      entry = entries.end() - 1;
+    }
+    else if (entry->parameter_names != parameter_names) {
+      reader.Fail("different parameter names for kernel '" + record.kernel + "'");
+    }
+
+    auto vendor = std::find_if(entry->vendors.begin(), entry->vendors.end(),
+                               [&record](const database::DatabaseVendor &v) {
+      return v.type == record.device_type && v.name == record.device_vendor;
+    });
+    if (vendor == entry->vendors.end()) {
+      entry->vendors.push_back(database::DatabaseVendor{record.device_type,
+                                                        record.device_vendor, {}});
+      vendor = entry->vendors.end() - 1;
+    }
+
+    auto architecture = std::find_if(vendor->architectures.begin(), vendor->architectures.end(),
+                                     [&record](const database::DatabaseArchitecture &a) {
+      return a.name == record.device_architecture;
+    });
+    if (architecture == vendor->architectures.end()) {
+      vendor->architectures.push_back(database::DatabaseArchitecture{record.device_architecture,
+                                                                     {}});
+      architecture = vendor->architectures.end() - 1;
+    }
+    architecture->devices.push_back(database::DatabaseDevice{ToName(record.device_name),
+                                                             parameter_values,
+                                                             record.driver_version_min,
+                                                             record.driver_version_max});
+  }
+  return entries;
+}
+
+std::vector<database::DatabaseEntry> ReadDatabaseFile(const std::string &file_name) {
+  std::ifstream file(file_name);
+  if (!file) {
+    throw RuntimeErrorCode(StatusCode::kDatabaseError, "cannot open database file " + file_name);
+  }
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return ParseDatabaseFile(contents.str());
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,52 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements reading database entries from a JSON file at run-time (see
+// 'LoadDatabaseFile'), such that tuning results for new devices can be deployed without rebuilding
+// the library. The file holds a flat list of records, one per device and kernel:
+//
+//   {"version": 1, "entries": [
+//     {"kernel": "Xgemm", "precision": 32, "device_type": "GPU", "device_vendor": "NVIDIA",
+//      "device_architecture": "SM8.0", "device_name": "NVIDIA A100-PCIE-40GB",
+//      "parameters": {"GEMMK": 0, "KREG": 1, ...}},
+//     ...
+//   ]}
+//
+// The device fields default to "default", matching the built-in defaults of that level. A record
+// can be limited to a range of driver versions with the optional "driver_version_min" and
+// "driver_version_max" fields (e.g. "3423.0", both inclusive), which is then preferred over a
+// record without range for the same device. Records with the same kernel, precision, device and
+// driver versions are merged, and all records of a kernel and precision must have the same
+// parameter names. Such a file is produced by 'scripts/database/database.py' with the
+// '--json_output' argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_DATABASE_DATABASE_FILE_H_
+#define CLBLAST_DATABASE_DATABASE_FILE_H_
+
+#include <string>
+#include <vector>
+
+#include "database/database_structure.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Reads the database entries from the file, throws in case the file cannot be read or is invalid
+std::vector<database::DatabaseEntry> ReadDatabaseFile(const std::string &file_name);
+
+// As above, but from the contents of a file
+std::vector<database::DatabaseEntry> ParseDatabaseFile(const std::string &contents);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_DATABASE_DATABASE_FILE_H_
+#endif
@@ -34,7 +34,7 @@ namespace database {
 
 // Type alias for the database storage (arrays for fast compilation/efficiency)
 using Name = std::array<char, 51>; // name as stored in database (50 chars + string terminator)
-using Params = std::array<size_t, 16>; // parameters as stored in database
+using Params = std::array<size_t, 19>; // parameters as stored in database
 
 // Type alias after extracting from the database (sorted map for improved code readability)
 using Parameters = std::map<std::string, size_t>; // parameters after reading from DB
@@ -46,10 +46,27 @@ const std::string kDeviceTypeAccelerator = "accelerator";
 const std::string kDeviceTypeAll = "default";
 const Name kDeviceNameDefault = {"default                                           "};
 
+// Where a set of parameters was found (see 'Database'), with the same values as the public
+// 'ParameterSource' of 'ExplainGemm'
+enum class Source { kOverride = 0, kDatabaseFile = 1, kDevice = 2, kSimilarDevice = 3,
+                    kArchitecture = 4, kVendor = 5, kCPUFallback = 6, kDefault = 7 };
+
 struct DatabaseDevice {
   Name name;
   Params parameters; // parameter values
 
+  // Optional range of driver versions (see 'Database::SearchDevice'), both bounds inclusive and
+  // empty if unbounded. Parameters for a range are preferred over the version-agnostic ones (both
+  // bounds empty) for drivers within the range, and are not used for any other driver.
+  std::string driver_version_min;
+  std::string driver_version_max;
+
+  DatabaseDevice(const Name &device_name, const Params &device_parameters,
+                 const std::string &min_driver_version = "",
+                 const std::string &max_driver_version = ""):
+      name(device_name), parameters(device_parameters),
+      driver_version_min(min_driver_version), driver_version_max(max_driver_version) { }
+  bool IsVersionAgnostic() const { return driver_version_min.empty() && driver_version_max.empty(); }
 };
 struct DatabaseArchitecture {
   std::string name;
@@ -67,6 +84,29 @@ struct DatabaseEntry {
   std::vector<DatabaseVendor> vendors;
 };
 
+// The parameters of the GEMM kernels in flat form, such that the host code can read them in the hot
+// paths (e.g. to compute thread-grid sizes) as plain integers rather than through string look-ups.
+// These are resolved once when the database of a kernel is built (see 'Database::GetFlatParameters').
+struct XgemmParameters {
+  size_t gemmk = 0, kreg = 0, kwg = 0, mdimc = 0, mwg = 0, ndimc = 0, nwg = 0, vwm = 0, vwn = 0;
+};
+struct XgemmDirectParameters {
+  size_t mdimcd = 0, ndimcd = 0, vwmd = 0, vwnd = 0, wgd = 0;
+};
+struct GemmRoutineParameters {
+  size_t min_indirect_size = 0, min_splitk_k = 0, min_3m_size = 0, max_alt_size = 0;
+  size_t indirect_copy_cost = 0, min_strassen_size = 0, min_image_size = 0;
+};
+struct CopyParameters {
+  size_t dimx = 0, dimy = 0, vw = 0, wpt = 0;
+};
+struct FlatParameters {
+  XgemmParameters xgemm;
+  XgemmDirectParameters xgemm_direct;
+  GemmRoutineParameters gemm_routine;
+  CopyParameters copy;
+};
+
 // =================================================================================================
 } // namespace database
 } // namespace clblast
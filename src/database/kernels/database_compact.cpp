@@ -0,0 +1,6989 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file holds the built-in database in compact binary form (see 'database_compact.hpp').
+//
+// =================================================================================================
+
+#include "database/database_compact.hpp"
+
+namespace clblast {
+namespace database {
+
+const unsigned char kCompactDatabase[] = {
+  0x43, 0x4c, 0x42, 0x44, 0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x09, 0x00, 0x00, 0xe0, 0x24, 0x00, 0x00, 0x88, 0x58, 0x00, 0x00, 0xd8, 0xb8, 0x00, 0x00,
+  0xc9, 0xab, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd8, 0xb8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xc9, 0xab, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xb8, 0xb9, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0xc9, 0xab, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x78, 0xbe, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xc9, 0xab, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x48, 0xc2, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xc9, 0xab, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xb8, 0xc6, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xfe, 0xb0, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x88, 0xca, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0xfe, 0xb0, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x4c, 0xcb, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0xfe, 0xb0, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x28, 0xcd, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0xfe, 0xb0, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x40, 0xce, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xfe, 0xb0, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x90, 0xcf, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x37, 0xb1, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xa8, 0xd0, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x37, 0xb1, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xe8, 0xd0, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x37, 0xb1, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x78, 0xd1, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x37, 0xb1, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xe8, 0xd1, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x37, 0xb1, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x78, 0xd2, 0x00, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x62, 0xb1, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xe8, 0xd2, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x62, 0xb1, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc8, 0xd3, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x62, 0xb1, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x88, 0xd8, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x62, 0xb1, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x58, 0xdc, 0x00, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x62, 0xb1, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xe8, 0xe0, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0x88, 0xb1, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xb8, 0xe4, 0x00, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x88, 0xb1, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x60, 0xe5, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x88, 0xb1, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xe4, 0xe8, 0x00, 0x00,
+  0x73, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x88, 0xb1, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xc0, 0xeb, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x88, 0xb1, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2c, 0xef, 0x00, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0xb9, 0xb1, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0xf2, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0xb9, 0xb1, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe8, 0xf2, 0x00, 0x00,
+  0x8e, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0xb9, 0xb1, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xa8, 0xf7, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0xb9, 0xb1, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x78, 0xfb, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xb9, 0xb1, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0xea, 0xb1, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x03, 0x01, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xea, 0xb1, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa8, 0x03, 0x01, 0x00, 0xab, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+  0xea, 0xb1, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x03, 0x01, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xea, 0xb1, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xc8, 0x03, 0x01, 0x00, 0xad, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0xea, 0xb1, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd8, 0x03, 0x01, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x06, 0xb2, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe8, 0x03, 0x01, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00,
+  0x06, 0xb2, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x01, 0x00,
+  0xb0, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x06, 0xb2, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0xb2, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0x06, 0xb2, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x04, 0x01, 0x00,
+  0xb3, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x06, 0xb2, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x18, 0x04, 0x01, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0x1d, 0xb2, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x04, 0x01, 0x00,
+  0xb6, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x1d, 0xb2, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xc8, 0x04, 0x01, 0x00, 0xbb, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00,
+  0x1d, 0xb2, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x08, 0x01, 0x00,
+  0xc3, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0x1d, 0xb2, 0x01, 0x00, 0x50, 0x06, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x34, 0x0b, 0x01, 0x00, 0xca, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00,
+  0x1d, 0xb2, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4c, 0x0b, 0x01, 0x00,
+  0xcb, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x1d, 0xb2, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xb8, 0x0e, 0x01, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00,
+  0x5c, 0xb2, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x94, 0x11, 0x01, 0x00,
+  0xda, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x5c, 0xb2, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0xe4, 0x11, 0x01, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00,
+  0x5c, 0xb2, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x34, 0x12, 0x01, 0x00,
+  0xdc, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x5c, 0xb2, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x84, 0x12, 0x01, 0x00, 0xdd, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00,
+  0x5c, 0xb2, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xd4, 0x12, 0x01, 0x00,
+  0xde, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x81, 0xb2, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x24, 0x13, 0x01, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
+  0x81, 0xb2, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xcc, 0x13, 0x01, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x81, 0xb2, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xf0, 0x16, 0x01, 0x00, 0xeb, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00,
+  0x81, 0xb2, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x19, 0x01, 0x00,
+  0xf1, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x81, 0xb2, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x6c, 0x1c, 0x01, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0x01, 0xb3, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xe8, 0x1e, 0x01, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x01, 0xb3, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xe8, 0x23, 0x01, 0x00, 0x03, 0x01, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00,
+  0x01, 0xb3, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xe8, 0x36, 0x01, 0x00,
+  0x0b, 0x01, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x01, 0xb3, 0x01, 0x00, 0x40, 0x03, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x28, 0x46, 0x01, 0x00, 0x12, 0x01, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00,
+  0x01, 0xb3, 0x01, 0x00, 0x50, 0x06, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa8, 0x46, 0x01, 0x00,
+  0x13, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x01, 0xb3, 0x01, 0x00, 0x60, 0x06, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x28, 0x47, 0x01, 0x00, 0x14, 0x01, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00,
+  0x01, 0xb3, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa8, 0x47, 0x01, 0x00,
+  0x15, 0x01, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x01, 0xb3, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x68, 0x59, 0x01, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x23, 0x01, 0x00, 0x00,
+  0x07, 0xb3, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x68, 0x68, 0x01, 0x00,
+  0x23, 0x01, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x07, 0xb3, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x20, 0x6a, 0x01, 0x00, 0x27, 0x01, 0x00, 0x00, 0x2e, 0x01, 0x00, 0x00,
+  0x07, 0xb3, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xc8, 0x71, 0x01, 0x00,
+  0x2e, 0x01, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x07, 0xb3, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0xb8, 0x77, 0x01, 0x00, 0x34, 0x01, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x00,
+  0x07, 0xb3, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x48, 0x7e, 0x01, 0x00,
+  0x3a, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x18, 0xb3, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x38, 0x84, 0x01, 0x00, 0x40, 0x01, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00,
+  0x18, 0xb3, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x84, 0x01, 0x00,
+  0x43, 0x01, 0x00, 0x00, 0x4b, 0x01, 0x00, 0x00, 0x18, 0xb3, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xc8, 0x86, 0x01, 0x00, 0x4b, 0x01, 0x00, 0x00, 0x51, 0x01, 0x00, 0x00,
+  0x18, 0xb3, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x88, 0x01, 0x00,
+  0x51, 0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x18, 0xb3, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa0, 0x8a, 0x01, 0x00, 0x58, 0x01, 0x00, 0x00, 0x5e, 0x01, 0x00, 0x00,
+  0x28, 0xb3, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf8, 0x8b, 0x01, 0x00,
+  0x5e, 0x01, 0x00, 0x00, 0x5f, 0x01, 0x00, 0x00, 0x28, 0xb3, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x8c, 0x01, 0x00, 0x5f, 0x01, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00,
+  0x28, 0xb3, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x8c, 0x01, 0x00,
+  0x60, 0x01, 0x00, 0x00, 0x61, 0x01, 0x00, 0x00, 0x28, 0xb3, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x28, 0x8c, 0x01, 0x00, 0x61, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00,
+  0x28, 0xb3, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x38, 0x8c, 0x01, 0x00,
+  0x62, 0x01, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x3d, 0xb3, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x48, 0x8c, 0x01, 0x00, 0x63, 0x01, 0x00, 0x00, 0x66, 0x01, 0x00, 0x00,
+  0x3d, 0xb3, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xa8, 0x8c, 0x01, 0x00,
+  0x66, 0x01, 0x00, 0x00, 0x6e, 0x01, 0x00, 0x00, 0x3d, 0xb3, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x20, 0x90, 0x01, 0x00, 0x6e, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00,
+  0x3d, 0xb3, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xd8, 0x92, 0x01, 0x00,
+  0x74, 0x01, 0x00, 0x00, 0x7b, 0x01, 0x00, 0x00, 0x3d, 0xb3, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x60, 0x95, 0x01, 0x00, 0x7b, 0x01, 0x00, 0x00, 0x81, 0x01, 0x00, 0x00,
+  0x55, 0xb3, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4c, 0x97, 0x01, 0x00,
+  0x81, 0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x55, 0xb3, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xa0, 0x97, 0x01, 0x00, 0x84, 0x01, 0x00, 0x00, 0x8b, 0x01, 0x00, 0x00,
+  0x55, 0xb3, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x9a, 0x01, 0x00,
+  0x8b, 0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x55, 0xb3, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xc0, 0x9b, 0x01, 0x00, 0x90, 0x01, 0x00, 0x00, 0x96, 0x01, 0x00, 0x00,
+  0x55, 0xb3, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x70, 0x9d, 0x01, 0x00,
+  0x96, 0x01, 0x00, 0x00, 0x9b, 0x01, 0x00, 0x00, 0x75, 0xb3, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xb4, 0x9e, 0x01, 0x00, 0x9b, 0x01, 0x00, 0x00, 0x9c, 0x01, 0x00, 0x00,
+  0x75, 0xb3, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xcc, 0x9e, 0x01, 0x00,
+  0x9c, 0x01, 0x00, 0x00, 0x9d, 0x01, 0x00, 0x00, 0x84, 0xb3, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xe4, 0x9e, 0x01, 0x00, 0x9d, 0x01, 0x00, 0x00, 0xa2, 0x01, 0x00, 0x00,
+  0x84, 0xb3, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x9f, 0x01, 0x00,
+  0xa2, 0x01, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00, 0x84, 0xb3, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xb0, 0xa2, 0x01, 0x00, 0xa9, 0x01, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x00,
+  0x84, 0xb3, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x38, 0xa5, 0x01, 0x00,
+  0xaf, 0x01, 0x00, 0x00, 0xb6, 0x01, 0x00, 0x00, 0x84, 0xb3, 0x01, 0x00, 0x40, 0x19, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x44, 0xa8, 0x01, 0x00, 0xb6, 0x01, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x13, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x26, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x28, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x29, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x31, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x46, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x47, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x48, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x52, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x53, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x54, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x60, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x61, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x63, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x67, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x69, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x70, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x73, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x74, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x75, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x79, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x83, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x84, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x85, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x89, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x90, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x91, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x92, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x93, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xb2, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xbd, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xc9, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xca, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xcb, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xd5, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xdd, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xde, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xe1, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xe9, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xeb, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xec, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0xed, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xee, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xef, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xf9, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x05, 0x01, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x06, 0x01, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x10, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x11, 0x01, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x12, 0x01, 0x00, 0x00, 0x19, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x19, 0x01, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x24, 0x01, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x25, 0x01, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x26, 0x01, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x27, 0x01, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x28, 0x01, 0x00, 0x00, 0x2f, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x2f, 0x01, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x30, 0x01, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x31, 0x01, 0x00, 0x00, 0x39, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x39, 0x01, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x3a, 0x01, 0x00, 0x00, 0x3b, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x3b, 0x01, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x3d, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x3d, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x44, 0x01, 0x00, 0x00, 0x45, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x45, 0x01, 0x00, 0x00, 0x47, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x47, 0x01, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x48, 0x01, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x49, 0x01, 0x00, 0x00, 0x4a, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4a, 0x01, 0x00, 0x00, 0x4b, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x4b, 0x01, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x55, 0x01, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x56, 0x01, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x57, 0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x58, 0x01, 0x00, 0x00, 0x59, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x59, 0x01, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x60, 0x01, 0x00, 0x00, 0x61, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x61, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x62, 0x01, 0x00, 0x00, 0x6a, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x6a, 0x01, 0x00, 0x00, 0x6b, 0x01, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x6b, 0x01, 0x00, 0x00, 0x6c, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x6c, 0x01, 0x00, 0x00, 0x6d, 0x01, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x6d, 0x01, 0x00, 0x00, 0x6e, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x6e, 0x01, 0x00, 0x00, 0x75, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x75, 0x01, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x76, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x81, 0x01, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x81, 0x01, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x82, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x83, 0x01, 0x00, 0x00, 0x8a, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x00, 0x8b, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x94, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x95, 0x01, 0x00, 0x00, 0x96, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x96, 0x01, 0x00, 0x00, 0x97, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x97, 0x01, 0x00, 0x00, 0x9e, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x9e, 0x01, 0x00, 0x00, 0x9f, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x9f, 0x01, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa0, 0x01, 0x00, 0x00, 0xa1, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa1, 0x01, 0x00, 0x00, 0xa2, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa2, 0x01, 0x00, 0x00, 0xa3, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa3, 0x01, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa4, 0x01, 0x00, 0x00, 0xa5, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xa5, 0x01, 0x00, 0x00, 0xa6, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa6, 0x01, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa7, 0x01, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xa8, 0x01, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa9, 0x01, 0x00, 0x00, 0xaa, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xaa, 0x01, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xab, 0x01, 0x00, 0x00, 0xad, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xad, 0x01, 0x00, 0x00, 0xae, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xae, 0x01, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0xaf, 0x01, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb0, 0x01, 0x00, 0x00, 0xb1, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xb1, 0x01, 0x00, 0x00, 0xbb, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xbb, 0x01, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xbc, 0x01, 0x00, 0x00, 0xbd, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xbd, 0x01, 0x00, 0x00, 0xbe, 0x01, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xbe, 0x01, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xbf, 0x01, 0x00, 0x00, 0xc6, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0xc6, 0x01, 0x00, 0x00, 0xc7, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc7, 0x01, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xc8, 0x01, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xd0, 0x01, 0x00, 0x00, 0xd1, 0x01, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xd1, 0x01, 0x00, 0x00, 0xd2, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xd2, 0x01, 0x00, 0x00, 0xd3, 0x01, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xd3, 0x01, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xd4, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xdb, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xdc, 0x01, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xdd, 0x01, 0x00, 0x00, 0xe7, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xe7, 0x01, 0x00, 0x00, 0xe8, 0x01, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xe8, 0x01, 0x00, 0x00, 0xe9, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xe9, 0x01, 0x00, 0x00, 0xea, 0x01, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xea, 0x01, 0x00, 0x00, 0xeb, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xeb, 0x01, 0x00, 0x00, 0xf2, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0xf2, 0x01, 0x00, 0x00, 0xf3, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf3, 0x01, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xf4, 0x01, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xfc, 0x01, 0x00, 0x00, 0xfd, 0x01, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xfd, 0x01, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xfe, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x07, 0x02, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x08, 0x02, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x09, 0x02, 0x00, 0x00, 0x0a, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x0b, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x0f, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x10, 0x02, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x11, 0x02, 0x00, 0x00, 0x12, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x12, 0x02, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x13, 0x02, 0x00, 0x00, 0x1c, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x1d, 0x02, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x1d, 0x02, 0x00, 0x00, 0x1e, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x1e, 0x02, 0x00, 0x00, 0x1f, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x1f, 0x02, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x26, 0x02, 0x00, 0x00, 0x27, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x27, 0x02, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x28, 0x02, 0x00, 0x00, 0x2f, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x2f, 0x02, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x30, 0x02, 0x00, 0x00, 0x31, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x31, 0x02, 0x00, 0x00, 0x32, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x32, 0x02, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x39, 0x02, 0x00, 0x00, 0x3a, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x3a, 0x02, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x43, 0x02, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x44, 0x02, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x45, 0x02, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x46, 0x02, 0x00, 0x00, 0x4d, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x4d, 0x02, 0x00, 0x00, 0x4e, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4e, 0x02, 0x00, 0x00, 0x4f, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x4f, 0x02, 0x00, 0x00, 0x56, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x56, 0x02, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x57, 0x02, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x58, 0x02, 0x00, 0x00, 0x59, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x59, 0x02, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x60, 0x02, 0x00, 0x00, 0x61, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x61, 0x02, 0x00, 0x00, 0x63, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x63, 0x02, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x64, 0x02, 0x00, 0x00, 0x65, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x65, 0x02, 0x00, 0x00, 0x6e, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x6e, 0x02, 0x00, 0x00, 0x6f, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x6f, 0x02, 0x00, 0x00, 0x79, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x79, 0x02, 0x00, 0x00, 0x7a, 0x02, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x7a, 0x02, 0x00, 0x00, 0x7b, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x7b, 0x02, 0x00, 0x00, 0x7c, 0x02, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x7c, 0x02, 0x00, 0x00, 0x7d, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x7d, 0x02, 0x00, 0x00, 0x84, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x84, 0x02, 0x00, 0x00, 0x85, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x85, 0x02, 0x00, 0x00, 0x86, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x86, 0x02, 0x00, 0x00, 0x8e, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x8e, 0x02, 0x00, 0x00, 0x8f, 0x02, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x8f, 0x02, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x90, 0x02, 0x00, 0x00, 0x91, 0x02, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x91, 0x02, 0x00, 0x00, 0x92, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x92, 0x02, 0x00, 0x00, 0x99, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x99, 0x02, 0x00, 0x00, 0x9a, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x9a, 0x02, 0x00, 0x00, 0x9b, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x9b, 0x02, 0x00, 0x00, 0x9c, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x9c, 0x02, 0x00, 0x00, 0x9d, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x9d, 0x02, 0x00, 0x00, 0xa7, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xa7, 0x02, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xa9, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xa9, 0x02, 0x00, 0x00, 0xaa, 0x02, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xaa, 0x02, 0x00, 0x00, 0xab, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xab, 0x02, 0x00, 0x00, 0xb2, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb2, 0x02, 0x00, 0x00, 0xb3, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xb3, 0x02, 0x00, 0x00, 0xbb, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xbb, 0x02, 0x00, 0x00, 0xbc, 0x02, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xbc, 0x02, 0x00, 0x00, 0xbd, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xbd, 0x02, 0x00, 0x00, 0xbe, 0x02, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xbe, 0x02, 0x00, 0x00, 0xbf, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xbf, 0x02, 0x00, 0x00, 0xc6, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc6, 0x02, 0x00, 0x00, 0xc7, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xc7, 0x02, 0x00, 0x00, 0xc9, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xc9, 0x02, 0x00, 0x00, 0xca, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xca, 0x02, 0x00, 0x00, 0xcb, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xcb, 0x02, 0x00, 0x00, 0xcc, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xcc, 0x02, 0x00, 0x00, 0xd2, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xd2, 0x02, 0x00, 0x00, 0xd3, 0x02, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xd3, 0x02, 0x00, 0x00, 0xd4, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xd4, 0x02, 0x00, 0x00, 0xd5, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xd5, 0x02, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0xdc, 0x02, 0x00, 0x00, 0xdd, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xdd, 0x02, 0x00, 0x00, 0xde, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xde, 0x02, 0x00, 0x00, 0xe2, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xe2, 0x02, 0x00, 0x00, 0xe3, 0x02, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xe3, 0x02, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xe5, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xe5, 0x02, 0x00, 0x00, 0xec, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xec, 0x02, 0x00, 0x00, 0xed, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xed, 0x02, 0x00, 0x00, 0xf2, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xf2, 0x02, 0x00, 0x00, 0xf3, 0x02, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xf3, 0x02, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xf4, 0x02, 0x00, 0x00, 0xf5, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xf5, 0x02, 0x00, 0x00, 0xfc, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xfc, 0x02, 0x00, 0x00, 0xfd, 0x02, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xfd, 0x02, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x02, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x03, 0x03, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x04, 0x03, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x0e, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x0e, 0x03, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x0f, 0x03, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x10, 0x03, 0x00, 0x00, 0x1a, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x1a, 0x03, 0x00, 0x00, 0x1b, 0x03, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x1b, 0x03, 0x00, 0x00, 0x1c, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x1c, 0x03, 0x00, 0x00, 0x1d, 0x03, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x1d, 0x03, 0x00, 0x00, 0x1e, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x1e, 0x03, 0x00, 0x00, 0x25, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x25, 0x03, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x26, 0x03, 0x00, 0x00, 0x27, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x27, 0x03, 0x00, 0x00, 0x2f, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x2f, 0x03, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x30, 0x03, 0x00, 0x00, 0x31, 0x03, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x31, 0x03, 0x00, 0x00, 0x32, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x32, 0x03, 0x00, 0x00, 0x39, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x39, 0x03, 0x00, 0x00, 0x3a, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x3a, 0x03, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x44, 0x03, 0x00, 0x00, 0x45, 0x03, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x45, 0x03, 0x00, 0x00, 0x46, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x46, 0x03, 0x00, 0x00, 0x47, 0x03, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x47, 0x03, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4f, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4f, 0x03, 0x00, 0x00, 0x50, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x50, 0x03, 0x00, 0x00, 0x58, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x58, 0x03, 0x00, 0x00, 0x59, 0x03, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x59, 0x03, 0x00, 0x00, 0x5a, 0x03, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x5a, 0x03, 0x00, 0x00, 0x5b, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x5b, 0x03, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x60, 0x03, 0x00, 0x00, 0x61, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x61, 0x03, 0x00, 0x00, 0x62, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x62, 0x03, 0x00, 0x00, 0x63, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x63, 0x03, 0x00, 0x00, 0x64, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x64, 0x03, 0x00, 0x00, 0x65, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x65, 0x03, 0x00, 0x00, 0x66, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x66, 0x03, 0x00, 0x00, 0x68, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x68, 0x03, 0x00, 0x00, 0x69, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x69, 0x03, 0x00, 0x00, 0x6a, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x6a, 0x03, 0x00, 0x00, 0x74, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x74, 0x03, 0x00, 0x00, 0x75, 0x03, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x75, 0x03, 0x00, 0x00, 0x76, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x76, 0x03, 0x00, 0x00, 0x77, 0x03, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x77, 0x03, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x78, 0x03, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x7f, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x81, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x81, 0x03, 0x00, 0x00, 0x89, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x89, 0x03, 0x00, 0x00, 0x8a, 0x03, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x8a, 0x03, 0x00, 0x00, 0x8b, 0x03, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x8b, 0x03, 0x00, 0x00, 0x8c, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x8c, 0x03, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x93, 0x03, 0x00, 0x00, 0x94, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x94, 0x03, 0x00, 0x00, 0x9e, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x9e, 0x03, 0x00, 0x00, 0x9f, 0x03, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x9f, 0x03, 0x00, 0x00, 0xa0, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xa0, 0x03, 0x00, 0x00, 0xa1, 0x03, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xa1, 0x03, 0x00, 0x00, 0xa2, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xa2, 0x03, 0x00, 0x00, 0xa6, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa6, 0x03, 0x00, 0x00, 0xa7, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xa7, 0x03, 0x00, 0x00, 0xaf, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xaf, 0x03, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xb0, 0x03, 0x00, 0x00, 0xb1, 0x03, 0x00, 0x00,
+  0xd4, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xb1, 0x03, 0x00, 0x00, 0xb2, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xb2, 0x03, 0x00, 0x00, 0xb6, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb6, 0x03, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xb7, 0x03, 0x00, 0x00, 0xb9, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xb9, 0x03, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xba, 0x03, 0x00, 0x00, 0xbb, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xbb, 0x03, 0x00, 0x00, 0xc1, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xc1, 0x03, 0x00, 0x00, 0xc2, 0x03, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xc2, 0x03, 0x00, 0x00, 0xc3, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xc3, 0x03, 0x00, 0x00, 0xc4, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xc4, 0x03, 0x00, 0x00, 0xcb, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0xcb, 0x03, 0x00, 0x00, 0xcc, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xcc, 0x03, 0x00, 0x00, 0xcd, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xcd, 0x03, 0x00, 0x00, 0xd1, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xd1, 0x03, 0x00, 0x00, 0xd2, 0x03, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xd2, 0x03, 0x00, 0x00, 0xd3, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xd3, 0x03, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xda, 0x03, 0x00, 0x00, 0xdb, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xdb, 0x03, 0x00, 0x00, 0xe1, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xe1, 0x03, 0x00, 0x00, 0xe2, 0x03, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xe2, 0x03, 0x00, 0x00, 0xe3, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xe3, 0x03, 0x00, 0x00, 0xe4, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xe4, 0x03, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x03, 0x00, 0x00, 0xe9, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xe9, 0x03, 0x00, 0x00, 0xed, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xed, 0x03, 0x00, 0x00, 0xee, 0x03, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xee, 0x03, 0x00, 0x00, 0xef, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0xef, 0x03, 0x00, 0x00, 0xf3, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf3, 0x03, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf4, 0x03, 0x00, 0x00, 0xf5, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf5, 0x03, 0x00, 0x00, 0xf6, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xf6, 0x03, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0xf8, 0x03, 0x00, 0x00, 0xf9, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0xf9, 0x03, 0x00, 0x00, 0xfa, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0xfa, 0x03, 0x00, 0x00, 0xfb, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xfb, 0x03, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0xfc, 0x03, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x06, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x07, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x08, 0x04, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x09, 0x04, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x10, 0x04, 0x00, 0x00, 0x11, 0x04, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x11, 0x04, 0x00, 0x00, 0x12, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x12, 0x04, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x1b, 0x04, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x1b, 0x04, 0x00, 0x00, 0x1c, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x1c, 0x04, 0x00, 0x00, 0x1d, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x1d, 0x04, 0x00, 0x00, 0x24, 0x04, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x24, 0x04, 0x00, 0x00, 0x25, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x25, 0x04, 0x00, 0x00, 0x2f, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x2f, 0x04, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x30, 0x04, 0x00, 0x00, 0x31, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x31, 0x04, 0x00, 0x00, 0x32, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x32, 0x04, 0x00, 0x00, 0x39, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xc0, 0xab, 0x01, 0x00, 0x39, 0x04, 0x00, 0x00, 0x3a, 0x04, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x3a, 0x04, 0x00, 0x00, 0x3b, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x19, 0xab, 0x01, 0x00, 0x3b, 0x04, 0x00, 0x00, 0x43, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x31, 0xab, 0x01, 0x00, 0x43, 0x04, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00,
+  0x22, 0xae, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x44, 0x04, 0x00, 0x00, 0x45, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0xa6, 0xab, 0x01, 0x00, 0x45, 0x04, 0x00, 0x00, 0x46, 0x04, 0x00, 0x00,
+  0x15, 0xab, 0x01, 0x00, 0x61, 0xb0, 0x01, 0x00, 0x46, 0x04, 0x00, 0x00, 0x4d, 0x04, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4d, 0x04, 0x00, 0x00, 0x4e, 0x04, 0x00, 0x00,
+  0x0b, 0xab, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x1e, 0xac, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x73, 0xac, 0x01, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x22, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x37, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x00, 0xaf, 0x01, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x47, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x0e, 0xb0, 0x01, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x55, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0x65, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x67, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x74, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x76, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0x85, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x92, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x93, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0x99, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x8d, 0xac, 0x01, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xab, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xbc, 0x00, 0x00, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0x57, 0xaf, 0x01, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0xc9, 0x00, 0x00, 0x00,
+  0xcd, 0x00, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00,
+  0x5b, 0xb0, 0x01, 0x00, 0xd1, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xd6, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd7, 0x00, 0x00, 0x00,
+  0xd9, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00,
+  0x0b, 0xab, 0x01, 0x00, 0xda, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00,
+  0xdc, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0xdf, 0x00, 0x00, 0x00,
+  0xe1, 0x00, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0xe1, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00,
+  0x3e, 0xac, 0x01, 0x00, 0xe3, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00,
+  0xe5, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0xe7, 0x00, 0x00, 0x00,
+  0xe9, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe9, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xeb, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xed, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf6, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x00, 0xaf, 0x01, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00,
+  0xfd, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x02, 0x01, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x07, 0x01, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00,
+  0x0e, 0xb0, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00,
+  0x0f, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x14, 0x01, 0x00, 0x00,
+  0x15, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x15, 0x01, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x16, 0x01, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x1a, 0x01, 0x00, 0x00,
+  0x1b, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x1e, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x1e, 0x01, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x20, 0x01, 0x00, 0x00,
+  0x22, 0x01, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x22, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00,
+  0x0e, 0xb0, 0x01, 0x00, 0x24, 0x01, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00,
+  0x26, 0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x29, 0x01, 0x00, 0x00,
+  0x2a, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x2b, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x2b, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x2c, 0x01, 0x00, 0x00, 0x2e, 0x01, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x2e, 0x01, 0x00, 0x00,
+  0x30, 0x01, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x30, 0x01, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x33, 0x01, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x34, 0x01, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x35, 0x01, 0x00, 0x00,
+  0x37, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x37, 0x01, 0x00, 0x00, 0x39, 0x01, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0x39, 0x01, 0x00, 0x00, 0x3b, 0x01, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00,
+  0x3b, 0x01, 0x00, 0x00, 0x3e, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x3e, 0x01, 0x00, 0x00,
+  0x3f, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x40, 0x01, 0x00, 0x00, 0x42, 0x01, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00,
+  0x42, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x44, 0x01, 0x00, 0x00,
+  0x47, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x47, 0x01, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0x01, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x49, 0x01, 0x00, 0x00, 0x4b, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4b, 0x01, 0x00, 0x00,
+  0x4c, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4c, 0x01, 0x00, 0x00, 0x4e, 0x01, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0x4e, 0x01, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0x50, 0x01, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x52, 0x01, 0x00, 0x00,
+  0x53, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x53, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0x54, 0x01, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0x56, 0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0x01, 0x00, 0x00,
+  0x59, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x59, 0x01, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x5a, 0x01, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00,
+  0x5c, 0x01, 0x00, 0x00, 0x5e, 0x01, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0x5e, 0x01, 0x00, 0x00,
+  0x60, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x60, 0x01, 0x00, 0x00, 0x61, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x61, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00,
+  0x62, 0x01, 0x00, 0x00, 0x64, 0x01, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0x64, 0x01, 0x00, 0x00,
+  0x66, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x66, 0x01, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x67, 0x01, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0x68, 0x01, 0x00, 0x00, 0x6a, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x6a, 0x01, 0x00, 0x00,
+  0x6b, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x6b, 0x01, 0x00, 0x00, 0x6e, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x6e, 0x01, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x72, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x74, 0x01, 0x00, 0x00,
+  0x75, 0x01, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x75, 0x01, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00,
+  0x06, 0xac, 0x01, 0x00, 0x77, 0x01, 0x00, 0x00, 0x7a, 0x01, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00,
+  0x7a, 0x01, 0x00, 0x00, 0x7c, 0x01, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x7c, 0x01, 0x00, 0x00,
+  0x7e, 0x01, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0x7e, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+  0x5a, 0xac, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00,
+  0x82, 0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00, 0x84, 0x01, 0x00, 0x00,
+  0x86, 0x01, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00, 0x86, 0x01, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0x01, 0x00, 0x00, 0x8a, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x8a, 0x01, 0x00, 0x00, 0x8d, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x8d, 0x01, 0x00, 0x00,
+  0x96, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x96, 0x01, 0x00, 0x00, 0x9f, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x9f, 0x01, 0x00, 0x00, 0xa1, 0x01, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00,
+  0xa1, 0x01, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0xa4, 0x01, 0x00, 0x00,
+  0xaa, 0x01, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0xaa, 0x01, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0xaf, 0x01, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0xb3, 0x01, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0xbc, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xbc, 0x01, 0x00, 0x00, 0xbd, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xbd, 0x01, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xbf, 0x01, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0xc0, 0x01, 0x00, 0x00,
+  0xc2, 0x01, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0xc2, 0x01, 0x00, 0x00, 0xc5, 0x01, 0x00, 0x00,
+  0x1e, 0xac, 0x01, 0x00, 0xc5, 0x01, 0x00, 0x00, 0xc7, 0x01, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00,
+  0xc7, 0x01, 0x00, 0x00, 0xc9, 0x01, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0xc9, 0x01, 0x00, 0x00,
+  0xcb, 0x01, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0xcb, 0x01, 0x00, 0x00, 0xcd, 0x01, 0x00, 0x00,
+  0x73, 0xac, 0x01, 0x00, 0xcd, 0x01, 0x00, 0x00, 0xcf, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xcf, 0x01, 0x00, 0x00, 0xd1, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd1, 0x01, 0x00, 0x00,
+  0xd3, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd3, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xdc, 0x01, 0x00, 0x00, 0xde, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xde, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x00,
+  0xe3, 0x01, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0xe3, 0x01, 0x00, 0x00, 0xe8, 0x01, 0x00, 0x00,
+  0x9d, 0xaf, 0x01, 0x00, 0xe8, 0x01, 0x00, 0x00, 0xed, 0x01, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00,
+  0xed, 0x01, 0x00, 0x00, 0xf1, 0x01, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0xf1, 0x01, 0x00, 0x00,
+  0xf5, 0x01, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0xf5, 0x01, 0x00, 0x00, 0xfa, 0x01, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xfa, 0x01, 0x00, 0x00, 0xfb, 0x01, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xfb, 0x01, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0xfc, 0x01, 0x00, 0x00,
+  0xfe, 0x01, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+  0x1e, 0xac, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00,
+  0x03, 0x02, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0x07, 0x02, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00,
+  0x73, 0xac, 0x01, 0x00, 0x09, 0x02, 0x00, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00,
+  0x0b, 0x02, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00, 0x0d, 0x02, 0x00, 0x00,
+  0x0f, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x11, 0x02, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x13, 0x02, 0x00, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x1c, 0x02, 0x00, 0x00,
+  0x24, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x24, 0x02, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00,
+  0x00, 0xaf, 0x01, 0x00, 0x26, 0x02, 0x00, 0x00, 0x29, 0x02, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00,
+  0x29, 0x02, 0x00, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x2e, 0x02, 0x00, 0x00,
+  0x33, 0x02, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x33, 0x02, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00,
+  0x0e, 0xb0, 0x01, 0x00, 0x37, 0x02, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00,
+  0x3b, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x40, 0x02, 0x00, 0x00,
+  0x41, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x41, 0x02, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x43, 0x02, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0x44, 0x02, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x46, 0x02, 0x00, 0x00,
+  0x49, 0x02, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0x49, 0x02, 0x00, 0x00, 0x4b, 0x02, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x4b, 0x02, 0x00, 0x00, 0x4d, 0x02, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00,
+  0x4d, 0x02, 0x00, 0x00, 0x4f, 0x02, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0x4f, 0x02, 0x00, 0x00,
+  0x51, 0x02, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0x51, 0x02, 0x00, 0x00, 0x53, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x53, 0x02, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x55, 0x02, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x57, 0x02, 0x00, 0x00,
+  0x60, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x60, 0x02, 0x00, 0x00, 0x62, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x62, 0x02, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00,
+  0x64, 0x02, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x67, 0x02, 0x00, 0x00,
+  0x6c, 0x02, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x71, 0x02, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0x71, 0x02, 0x00, 0x00, 0x75, 0x02, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0x75, 0x02, 0x00, 0x00, 0x79, 0x02, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x79, 0x02, 0x00, 0x00,
+  0x7e, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x7e, 0x02, 0x00, 0x00, 0x7f, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x7f, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0x80, 0x02, 0x00, 0x00, 0x82, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x82, 0x02, 0x00, 0x00,
+  0x83, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x83, 0x02, 0x00, 0x00, 0x86, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x86, 0x02, 0x00, 0x00, 0x8a, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x8a, 0x02, 0x00, 0x00, 0x8c, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x8c, 0x02, 0x00, 0x00,
+  0x8d, 0x02, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x8d, 0x02, 0x00, 0x00, 0x8f, 0x02, 0x00, 0x00,
+  0x06, 0xac, 0x01, 0x00, 0x8f, 0x02, 0x00, 0x00, 0x92, 0x02, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00,
+  0x92, 0x02, 0x00, 0x00, 0x94, 0x02, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x94, 0x02, 0x00, 0x00,
+  0x96, 0x02, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0x96, 0x02, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00,
+  0x5a, 0xac, 0x01, 0x00, 0x98, 0x02, 0x00, 0x00, 0x9a, 0x02, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00,
+  0x9a, 0x02, 0x00, 0x00, 0x9c, 0x02, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00, 0x9c, 0x02, 0x00, 0x00,
+  0x9e, 0x02, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00, 0x9e, 0x02, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa0, 0x02, 0x00, 0x00, 0xa2, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xa2, 0x02, 0x00, 0x00, 0xa5, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa5, 0x02, 0x00, 0x00,
+  0xae, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xae, 0x02, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb7, 0x02, 0x00, 0x00, 0xb9, 0x02, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00,
+  0xb9, 0x02, 0x00, 0x00, 0xbc, 0x02, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0xbc, 0x02, 0x00, 0x00,
+  0xc1, 0x02, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0xc1, 0x02, 0x00, 0x00, 0xc6, 0x02, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0xc6, 0x02, 0x00, 0x00, 0xca, 0x02, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0xca, 0x02, 0x00, 0x00, 0xce, 0x02, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0xce, 0x02, 0x00, 0x00,
+  0xd3, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd3, 0x02, 0x00, 0x00, 0xd4, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd4, 0x02, 0x00, 0x00, 0xd6, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xd6, 0x02, 0x00, 0x00, 0xd7, 0x02, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0xd7, 0x02, 0x00, 0x00,
+  0xd9, 0x02, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0xd9, 0x02, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00,
+  0x1e, 0xac, 0x01, 0x00, 0xdc, 0x02, 0x00, 0x00, 0xde, 0x02, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00,
+  0xde, 0x02, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0xe0, 0x02, 0x00, 0x00,
+  0xe2, 0x02, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0xe2, 0x02, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00,
+  0x73, 0xac, 0x01, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xe6, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xe6, 0x02, 0x00, 0x00, 0xe8, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x02, 0x00, 0x00,
+  0xea, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xea, 0x02, 0x00, 0x00, 0xf3, 0x02, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf3, 0x02, 0x00, 0x00, 0xf5, 0x02, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xf5, 0x02, 0x00, 0x00, 0xf7, 0x02, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0xf7, 0x02, 0x00, 0x00,
+  0xfa, 0x02, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0xfa, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00,
+  0x9d, 0xaf, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00,
+  0x04, 0x03, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0x08, 0x03, 0x00, 0x00,
+  0x0c, 0x03, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x11, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x11, 0x03, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x12, 0x03, 0x00, 0x00, 0x13, 0x03, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x13, 0x03, 0x00, 0x00,
+  0x15, 0x03, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x15, 0x03, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00,
+  0x1e, 0xac, 0x01, 0x00, 0x18, 0x03, 0x00, 0x00, 0x1a, 0x03, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00,
+  0x1a, 0x03, 0x00, 0x00, 0x1c, 0x03, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0x1c, 0x03, 0x00, 0x00,
+  0x1e, 0x03, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0x1e, 0x03, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00,
+  0x73, 0xac, 0x01, 0x00, 0x20, 0x03, 0x00, 0x00, 0x22, 0x03, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00,
+  0x22, 0x03, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00, 0x24, 0x03, 0x00, 0x00,
+  0x26, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x26, 0x03, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x03, 0x00, 0x00, 0x2a, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x2a, 0x03, 0x00, 0x00, 0x33, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x33, 0x03, 0x00, 0x00,
+  0x3b, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x3b, 0x03, 0x00, 0x00, 0x3d, 0x03, 0x00, 0x00,
+  0x00, 0xaf, 0x01, 0x00, 0x3d, 0x03, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00,
+  0x40, 0x03, 0x00, 0x00, 0x45, 0x03, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x45, 0x03, 0x00, 0x00,
+  0x4a, 0x03, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x4a, 0x03, 0x00, 0x00, 0x4e, 0x03, 0x00, 0x00,
+  0x0e, 0xb0, 0x01, 0x00, 0x4e, 0x03, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00,
+  0x52, 0x03, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x57, 0x03, 0x00, 0x00,
+  0x58, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0x03, 0x00, 0x00, 0x5a, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x5a, 0x03, 0x00, 0x00, 0x5b, 0x03, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0x5b, 0x03, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x5d, 0x03, 0x00, 0x00,
+  0x60, 0x03, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0x60, 0x03, 0x00, 0x00, 0x62, 0x03, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x62, 0x03, 0x00, 0x00, 0x64, 0x03, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00,
+  0x64, 0x03, 0x00, 0x00, 0x66, 0x03, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0x66, 0x03, 0x00, 0x00,
+  0x68, 0x03, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0x68, 0x03, 0x00, 0x00, 0x6a, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x6a, 0x03, 0x00, 0x00, 0x6c, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x6c, 0x03, 0x00, 0x00, 0x6e, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x6e, 0x03, 0x00, 0x00,
+  0x77, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x77, 0x03, 0x00, 0x00, 0x79, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x79, 0x03, 0x00, 0x00, 0x7b, 0x03, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00,
+  0x7b, 0x03, 0x00, 0x00, 0x7e, 0x03, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x7e, 0x03, 0x00, 0x00,
+  0x83, 0x03, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x83, 0x03, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0x88, 0x03, 0x00, 0x00, 0x8c, 0x03, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0x8c, 0x03, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x90, 0x03, 0x00, 0x00,
+  0x95, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x95, 0x03, 0x00, 0x00, 0x96, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x96, 0x03, 0x00, 0x00, 0x97, 0x03, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0x97, 0x03, 0x00, 0x00, 0x99, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x99, 0x03, 0x00, 0x00,
+  0x9a, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x9a, 0x03, 0x00, 0x00, 0x9d, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x9d, 0x03, 0x00, 0x00, 0xa1, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xa1, 0x03, 0x00, 0x00, 0xa3, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa3, 0x03, 0x00, 0x00,
+  0xa4, 0x03, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0xa4, 0x03, 0x00, 0x00, 0xa6, 0x03, 0x00, 0x00,
+  0x06, 0xac, 0x01, 0x00, 0xa6, 0x03, 0x00, 0x00, 0xa9, 0x03, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00,
+  0xa9, 0x03, 0x00, 0x00, 0xab, 0x03, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0xab, 0x03, 0x00, 0x00,
+  0xad, 0x03, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0xad, 0x03, 0x00, 0x00, 0xaf, 0x03, 0x00, 0x00,
+  0x5a, 0xac, 0x01, 0x00, 0xaf, 0x03, 0x00, 0x00, 0xb1, 0x03, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00,
+  0xb1, 0x03, 0x00, 0x00, 0xb3, 0x03, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00, 0xb3, 0x03, 0x00, 0x00,
+  0xb5, 0x03, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00, 0xb5, 0x03, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb7, 0x03, 0x00, 0x00, 0xb9, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xb9, 0x03, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xbc, 0x03, 0x00, 0x00,
+  0xc5, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc5, 0x03, 0x00, 0x00, 0xce, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xce, 0x03, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00,
+  0xd0, 0x03, 0x00, 0x00, 0xd3, 0x03, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0xd3, 0x03, 0x00, 0x00,
+  0xd9, 0x03, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0xd9, 0x03, 0x00, 0x00, 0xde, 0x03, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0xde, 0x03, 0x00, 0x00, 0xe2, 0x03, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0xe2, 0x03, 0x00, 0x00, 0xe6, 0x03, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0xe6, 0x03, 0x00, 0x00,
+  0xeb, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xeb, 0x03, 0x00, 0x00, 0xec, 0x03, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xec, 0x03, 0x00, 0x00, 0xee, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xee, 0x03, 0x00, 0x00, 0xef, 0x03, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0xef, 0x03, 0x00, 0x00,
+  0xf1, 0x03, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0xf1, 0x03, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x00,
+  0x1e, 0xac, 0x01, 0x00, 0xf4, 0x03, 0x00, 0x00, 0xf6, 0x03, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00,
+  0xf6, 0x03, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0xf8, 0x03, 0x00, 0x00,
+  0xfa, 0x03, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0xfa, 0x03, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00,
+  0x73, 0xac, 0x01, 0x00, 0xfc, 0x03, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xfe, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x02, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x02, 0x04, 0x00, 0x00, 0x0b, 0x04, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x0b, 0x04, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x0d, 0x04, 0x00, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x0f, 0x04, 0x00, 0x00,
+  0x12, 0x04, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x12, 0x04, 0x00, 0x00, 0x17, 0x04, 0x00, 0x00,
+  0x9d, 0xaf, 0x01, 0x00, 0x17, 0x04, 0x00, 0x00, 0x1c, 0x04, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00,
+  0x1c, 0x04, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0x20, 0x04, 0x00, 0x00,
+  0x24, 0x04, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x24, 0x04, 0x00, 0x00, 0x29, 0x04, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x29, 0x04, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x2a, 0x04, 0x00, 0x00, 0x2b, 0x04, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x2b, 0x04, 0x00, 0x00,
+  0x2d, 0x04, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x2d, 0x04, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00,
+  0x1e, 0xac, 0x01, 0x00, 0x30, 0x04, 0x00, 0x00, 0x32, 0x04, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00,
+  0x32, 0x04, 0x00, 0x00, 0x34, 0x04, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0x34, 0x04, 0x00, 0x00,
+  0x36, 0x04, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0x36, 0x04, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00,
+  0x73, 0xac, 0x01, 0x00, 0x38, 0x04, 0x00, 0x00, 0x3a, 0x04, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00,
+  0x3a, 0x04, 0x00, 0x00, 0x3c, 0x04, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00, 0x3c, 0x04, 0x00, 0x00,
+  0x3e, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x3e, 0x04, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x40, 0x04, 0x00, 0x00, 0x42, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x42, 0x04, 0x00, 0x00, 0x4b, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4b, 0x04, 0x00, 0x00,
+  0x53, 0x04, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x53, 0x04, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00,
+  0x57, 0xaf, 0x01, 0x00, 0x56, 0x04, 0x00, 0x00, 0x5b, 0x04, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00,
+  0x5b, 0x04, 0x00, 0x00, 0x60, 0x04, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x60, 0x04, 0x00, 0x00,
+  0x64, 0x04, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0x64, 0x04, 0x00, 0x00, 0x68, 0x04, 0x00, 0x00,
+  0x5b, 0xb0, 0x01, 0x00, 0x68, 0x04, 0x00, 0x00, 0x6d, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x6d, 0x04, 0x00, 0x00, 0x6e, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x6e, 0x04, 0x00, 0x00,
+  0x70, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x70, 0x04, 0x00, 0x00, 0x71, 0x04, 0x00, 0x00,
+  0x0b, 0xab, 0x01, 0x00, 0x71, 0x04, 0x00, 0x00, 0x73, 0x04, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00,
+  0x73, 0x04, 0x00, 0x00, 0x76, 0x04, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0x76, 0x04, 0x00, 0x00,
+  0x78, 0x04, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x78, 0x04, 0x00, 0x00, 0x7a, 0x04, 0x00, 0x00,
+  0x3e, 0xac, 0x01, 0x00, 0x7a, 0x04, 0x00, 0x00, 0x7c, 0x04, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00,
+  0x7c, 0x04, 0x00, 0x00, 0x7e, 0x04, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0x7e, 0x04, 0x00, 0x00,
+  0x80, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x80, 0x04, 0x00, 0x00, 0x82, 0x04, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x82, 0x04, 0x00, 0x00, 0x84, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x84, 0x04, 0x00, 0x00, 0x8d, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x8d, 0x04, 0x00, 0x00,
+  0x8f, 0x04, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x8f, 0x04, 0x00, 0x00, 0x92, 0x04, 0x00, 0x00,
+  0x57, 0xaf, 0x01, 0x00, 0x92, 0x04, 0x00, 0x00, 0x97, 0x04, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00,
+  0x97, 0x04, 0x00, 0x00, 0x9c, 0x04, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x9c, 0x04, 0x00, 0x00,
+  0xa0, 0x04, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0xa0, 0x04, 0x00, 0x00, 0xa4, 0x04, 0x00, 0x00,
+  0x5b, 0xb0, 0x01, 0x00, 0xa4, 0x04, 0x00, 0x00, 0xa9, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xa9, 0x04, 0x00, 0x00, 0xaa, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xaa, 0x04, 0x00, 0x00,
+  0xab, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xab, 0x04, 0x00, 0x00, 0xac, 0x04, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xac, 0x04, 0x00, 0x00, 0xad, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xad, 0x04, 0x00, 0x00, 0xae, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xae, 0x04, 0x00, 0x00,
+  0xaf, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xaf, 0x04, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb0, 0x04, 0x00, 0x00, 0xb1, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xb1, 0x04, 0x00, 0x00, 0xb3, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb3, 0x04, 0x00, 0x00,
+  0xb4, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb4, 0x04, 0x00, 0x00, 0xb5, 0x04, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb5, 0x04, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xb7, 0x04, 0x00, 0x00, 0xb8, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0x04, 0x00, 0x00,
+  0xb9, 0x04, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0xb9, 0x04, 0x00, 0x00, 0xbb, 0x04, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xbb, 0x04, 0x00, 0x00, 0xbc, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xbc, 0x04, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xbf, 0x04, 0x00, 0x00,
+  0xc3, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc3, 0x04, 0x00, 0x00, 0xc5, 0x04, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc5, 0x04, 0x00, 0x00, 0xc6, 0x04, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0xc6, 0x04, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0xc8, 0x04, 0x00, 0x00,
+  0xcb, 0x04, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0xcb, 0x04, 0x00, 0x00, 0xcd, 0x04, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0xcd, 0x04, 0x00, 0x00, 0xcf, 0x04, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00,
+  0xcf, 0x04, 0x00, 0x00, 0xd1, 0x04, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0xd1, 0x04, 0x00, 0x00,
+  0xd3, 0x04, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0xd3, 0x04, 0x00, 0x00, 0xd5, 0x04, 0x00, 0x00,
+  0x8d, 0xac, 0x01, 0x00, 0xd5, 0x04, 0x00, 0x00, 0xd7, 0x04, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00,
+  0xd7, 0x04, 0x00, 0x00, 0xd9, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd9, 0x04, 0x00, 0x00,
+  0xdb, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xdb, 0x04, 0x00, 0x00, 0xde, 0x04, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xde, 0x04, 0x00, 0x00, 0xe7, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xe7, 0x04, 0x00, 0x00, 0xf0, 0x04, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf0, 0x04, 0x00, 0x00,
+  0xf2, 0x04, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0xf2, 0x04, 0x00, 0x00, 0xf5, 0x04, 0x00, 0x00,
+  0x57, 0xaf, 0x01, 0x00, 0xf5, 0x04, 0x00, 0x00, 0xfb, 0x04, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00,
+  0xfb, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0x04, 0x05, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0x04, 0x05, 0x00, 0x00, 0x08, 0x05, 0x00, 0x00,
+  0x5b, 0xb0, 0x01, 0x00, 0x08, 0x05, 0x00, 0x00, 0x0d, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x0d, 0x05, 0x00, 0x00, 0x0e, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x0e, 0x05, 0x00, 0x00,
+  0x10, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x10, 0x05, 0x00, 0x00, 0x11, 0x05, 0x00, 0x00,
+  0x0b, 0xab, 0x01, 0x00, 0x11, 0x05, 0x00, 0x00, 0x13, 0x05, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00,
+  0x13, 0x05, 0x00, 0x00, 0x16, 0x05, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0x16, 0x05, 0x00, 0x00,
+  0x18, 0x05, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x18, 0x05, 0x00, 0x00, 0x1a, 0x05, 0x00, 0x00,
+  0x3e, 0xac, 0x01, 0x00, 0x1a, 0x05, 0x00, 0x00, 0x1c, 0x05, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00,
+  0x1c, 0x05, 0x00, 0x00, 0x1e, 0x05, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0x1e, 0x05, 0x00, 0x00,
+  0x20, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x20, 0x05, 0x00, 0x00, 0x22, 0x05, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x22, 0x05, 0x00, 0x00, 0x24, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x24, 0x05, 0x00, 0x00, 0x2d, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x2d, 0x05, 0x00, 0x00,
+  0x2f, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x2f, 0x05, 0x00, 0x00, 0x31, 0x05, 0x00, 0x00,
+  0x00, 0xaf, 0x01, 0x00, 0x31, 0x05, 0x00, 0x00, 0x34, 0x05, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00,
+  0x34, 0x05, 0x00, 0x00, 0x39, 0x05, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x39, 0x05, 0x00, 0x00,
+  0x3e, 0x05, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x3e, 0x05, 0x00, 0x00, 0x42, 0x05, 0x00, 0x00,
+  0x0e, 0xb0, 0x01, 0x00, 0x42, 0x05, 0x00, 0x00, 0x46, 0x05, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00,
+  0x46, 0x05, 0x00, 0x00, 0x4b, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4b, 0x05, 0x00, 0x00,
+  0x4c, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4c, 0x05, 0x00, 0x00, 0x4d, 0x05, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x4d, 0x05, 0x00, 0x00, 0x4e, 0x05, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0x4e, 0x05, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x50, 0x05, 0x00, 0x00,
+  0x53, 0x05, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0x53, 0x05, 0x00, 0x00, 0x55, 0x05, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x55, 0x05, 0x00, 0x00, 0x57, 0x05, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00,
+  0x57, 0x05, 0x00, 0x00, 0x59, 0x05, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0x59, 0x05, 0x00, 0x00,
+  0x5b, 0x05, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0x5b, 0x05, 0x00, 0x00, 0x5d, 0x05, 0x00, 0x00,
+  0x8d, 0xac, 0x01, 0x00, 0x5d, 0x05, 0x00, 0x00, 0x5f, 0x05, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00,
+  0x5f, 0x05, 0x00, 0x00, 0x61, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x61, 0x05, 0x00, 0x00,
+  0x63, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x63, 0x05, 0x00, 0x00, 0x65, 0x05, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x65, 0x05, 0x00, 0x00, 0x6e, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x6e, 0x05, 0x00, 0x00, 0x76, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x76, 0x05, 0x00, 0x00,
+  0x78, 0x05, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x78, 0x05, 0x00, 0x00, 0x7b, 0x05, 0x00, 0x00,
+  0x57, 0xaf, 0x01, 0x00, 0x7b, 0x05, 0x00, 0x00, 0x80, 0x05, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00,
+  0x80, 0x05, 0x00, 0x00, 0x85, 0x05, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x85, 0x05, 0x00, 0x00,
+  0x89, 0x05, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0x89, 0x05, 0x00, 0x00, 0x8d, 0x05, 0x00, 0x00,
+  0x5b, 0xb0, 0x01, 0x00, 0x8d, 0x05, 0x00, 0x00, 0x92, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x92, 0x05, 0x00, 0x00, 0x93, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x93, 0x05, 0x00, 0x00,
+  0x95, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x95, 0x05, 0x00, 0x00, 0x96, 0x05, 0x00, 0x00,
+  0x0b, 0xab, 0x01, 0x00, 0x96, 0x05, 0x00, 0x00, 0x98, 0x05, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00,
+  0x98, 0x05, 0x00, 0x00, 0x9b, 0x05, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0x9b, 0x05, 0x00, 0x00,
+  0x9d, 0x05, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x9d, 0x05, 0x00, 0x00, 0x9f, 0x05, 0x00, 0x00,
+  0x3e, 0xac, 0x01, 0x00, 0x9f, 0x05, 0x00, 0x00, 0xa1, 0x05, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00,
+  0xa1, 0x05, 0x00, 0x00, 0xa3, 0x05, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0xa3, 0x05, 0x00, 0x00,
+  0xa5, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa5, 0x05, 0x00, 0x00, 0xa7, 0x05, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa7, 0x05, 0x00, 0x00, 0xa9, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xa9, 0x05, 0x00, 0x00, 0xb2, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb2, 0x05, 0x00, 0x00,
+  0xb4, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb4, 0x05, 0x00, 0x00, 0xb6, 0x05, 0x00, 0x00,
+  0x00, 0xaf, 0x01, 0x00, 0xb6, 0x05, 0x00, 0x00, 0xb9, 0x05, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00,
+  0xb9, 0x05, 0x00, 0x00, 0xbe, 0x05, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0xbe, 0x05, 0x00, 0x00,
+  0xc3, 0x05, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0xc3, 0x05, 0x00, 0x00, 0xc7, 0x05, 0x00, 0x00,
+  0x0e, 0xb0, 0x01, 0x00, 0xc7, 0x05, 0x00, 0x00, 0xcb, 0x05, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00,
+  0xcb, 0x05, 0x00, 0x00, 0xd0, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd0, 0x05, 0x00, 0x00,
+  0xd1, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd1, 0x05, 0x00, 0x00, 0xd2, 0x05, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd2, 0x05, 0x00, 0x00, 0xd3, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xd3, 0x05, 0x00, 0x00, 0xd4, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd4, 0x05, 0x00, 0x00,
+  0xd5, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd5, 0x05, 0x00, 0x00, 0xd6, 0x05, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd6, 0x05, 0x00, 0x00, 0xd7, 0x05, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0xd7, 0x05, 0x00, 0x00, 0xd9, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd9, 0x05, 0x00, 0x00,
+  0xda, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xda, 0x05, 0x00, 0x00, 0xdd, 0x05, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xdd, 0x05, 0x00, 0x00, 0xe1, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xe1, 0x05, 0x00, 0x00, 0xe3, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe3, 0x05, 0x00, 0x00,
+  0xe4, 0x05, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0xe4, 0x05, 0x00, 0x00, 0xe6, 0x05, 0x00, 0x00,
+  0x06, 0xac, 0x01, 0x00, 0xe6, 0x05, 0x00, 0x00, 0xe9, 0x05, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00,
+  0xe9, 0x05, 0x00, 0x00, 0xeb, 0x05, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0xeb, 0x05, 0x00, 0x00,
+  0xed, 0x05, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0xed, 0x05, 0x00, 0x00, 0xef, 0x05, 0x00, 0x00,
+  0x73, 0xac, 0x01, 0x00, 0xef, 0x05, 0x00, 0x00, 0xf1, 0x05, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00,
+  0xf1, 0x05, 0x00, 0x00, 0xf3, 0x05, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00, 0xf3, 0x05, 0x00, 0x00,
+  0xf5, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf5, 0x05, 0x00, 0x00, 0xf7, 0x05, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf7, 0x05, 0x00, 0x00, 0xfa, 0x05, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xfa, 0x05, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x01, 0x06, 0x00, 0x00,
+  0x09, 0x06, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x09, 0x06, 0x00, 0x00, 0x0c, 0x06, 0x00, 0x00,
+  0x57, 0xaf, 0x01, 0x00, 0x0c, 0x06, 0x00, 0x00, 0x12, 0x06, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00,
+  0x12, 0x06, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x15, 0x06, 0x00, 0x00,
+  0x19, 0x06, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0x19, 0x06, 0x00, 0x00, 0x1d, 0x06, 0x00, 0x00,
+  0x5b, 0xb0, 0x01, 0x00, 0x1d, 0x06, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x22, 0x06, 0x00, 0x00, 0x23, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x23, 0x06, 0x00, 0x00,
+  0x25, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x25, 0x06, 0x00, 0x00, 0x26, 0x06, 0x00, 0x00,
+  0x0b, 0xab, 0x01, 0x00, 0x26, 0x06, 0x00, 0x00, 0x28, 0x06, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00,
+  0x28, 0x06, 0x00, 0x00, 0x2b, 0x06, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x2b, 0x06, 0x00, 0x00,
+  0x2d, 0x06, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0x2d, 0x06, 0x00, 0x00, 0x2f, 0x06, 0x00, 0x00,
+  0x5a, 0xac, 0x01, 0x00, 0x2f, 0x06, 0x00, 0x00, 0x31, 0x06, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00,
+  0x31, 0x06, 0x00, 0x00, 0x33, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x33, 0x06, 0x00, 0x00,
+  0x35, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x35, 0x06, 0x00, 0x00, 0x37, 0x06, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x37, 0x06, 0x00, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x3e, 0x06, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x40, 0x06, 0x00, 0x00,
+  0x43, 0x06, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x43, 0x06, 0x00, 0x00, 0x48, 0x06, 0x00, 0x00,
+  0x9d, 0xaf, 0x01, 0x00, 0x48, 0x06, 0x00, 0x00, 0x4b, 0x06, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00,
+  0x4b, 0x06, 0x00, 0x00, 0x4f, 0x06, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0x4f, 0x06, 0x00, 0x00,
+  0x53, 0x06, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x53, 0x06, 0x00, 0x00, 0x58, 0x06, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x58, 0x06, 0x00, 0x00, 0x59, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x59, 0x06, 0x00, 0x00, 0x5a, 0x06, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x5a, 0x06, 0x00, 0x00,
+  0x5c, 0x06, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x5c, 0x06, 0x00, 0x00, 0x5f, 0x06, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x5f, 0x06, 0x00, 0x00, 0x61, 0x06, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00,
+  0x61, 0x06, 0x00, 0x00, 0x63, 0x06, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0x63, 0x06, 0x00, 0x00,
+  0x65, 0x06, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0x65, 0x06, 0x00, 0x00, 0x67, 0x06, 0x00, 0x00,
+  0x8d, 0xac, 0x01, 0x00, 0x67, 0x06, 0x00, 0x00, 0x69, 0x06, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00,
+  0x69, 0x06, 0x00, 0x00, 0x6b, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x6b, 0x06, 0x00, 0x00,
+  0x6d, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x6d, 0x06, 0x00, 0x00, 0x6f, 0x06, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x6f, 0x06, 0x00, 0x00, 0x76, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x76, 0x06, 0x00, 0x00, 0x7d, 0x06, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x7d, 0x06, 0x00, 0x00,
+  0x80, 0x06, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x80, 0x06, 0x00, 0x00, 0x85, 0x06, 0x00, 0x00,
+  0x9d, 0xaf, 0x01, 0x00, 0x85, 0x06, 0x00, 0x00, 0x88, 0x06, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00,
+  0x88, 0x06, 0x00, 0x00, 0x8c, 0x06, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0x8c, 0x06, 0x00, 0x00,
+  0x90, 0x06, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x90, 0x06, 0x00, 0x00, 0x95, 0x06, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x95, 0x06, 0x00, 0x00, 0x96, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x96, 0x06, 0x00, 0x00, 0x98, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0x06, 0x00, 0x00,
+  0x99, 0x06, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x99, 0x06, 0x00, 0x00, 0x9b, 0x06, 0x00, 0x00,
+  0x06, 0xac, 0x01, 0x00, 0x9b, 0x06, 0x00, 0x00, 0x9e, 0x06, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00,
+  0x9e, 0x06, 0x00, 0x00, 0xa0, 0x06, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0xa0, 0x06, 0x00, 0x00,
+  0xa2, 0x06, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0xa2, 0x06, 0x00, 0x00, 0xa4, 0x06, 0x00, 0x00,
+  0x73, 0xac, 0x01, 0x00, 0xa4, 0x06, 0x00, 0x00, 0xa6, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xa6, 0x06, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x06, 0x00, 0x00,
+  0xaa, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xaa, 0x06, 0x00, 0x00, 0xb1, 0x06, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb1, 0x06, 0x00, 0x00, 0xb3, 0x06, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00,
+  0xb3, 0x06, 0x00, 0x00, 0xb6, 0x06, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0xb6, 0x06, 0x00, 0x00,
+  0xbb, 0x06, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0xbb, 0x06, 0x00, 0x00, 0xbe, 0x06, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x00, 0xc2, 0x06, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0xc2, 0x06, 0x00, 0x00, 0xc6, 0x06, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0xc6, 0x06, 0x00, 0x00,
+  0xcb, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xcb, 0x06, 0x00, 0x00, 0xcc, 0x06, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xcc, 0x06, 0x00, 0x00, 0xcd, 0x06, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0xcd, 0x06, 0x00, 0x00, 0xcf, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xcf, 0x06, 0x00, 0x00,
+  0xd0, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd0, 0x06, 0x00, 0x00, 0xd3, 0x06, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd3, 0x06, 0x00, 0x00, 0xd6, 0x06, 0x00, 0x00, 0xd1, 0xb2, 0x01, 0x00,
+  0xd6, 0x06, 0x00, 0x00, 0xd7, 0x06, 0x00, 0x00, 0xd7, 0xb2, 0x01, 0x00, 0xd7, 0x06, 0x00, 0x00,
+  0xd8, 0x06, 0x00, 0x00, 0xdd, 0xb2, 0x01, 0x00, 0xd8, 0x06, 0x00, 0x00, 0xd9, 0x06, 0x00, 0x00,
+  0xe3, 0xb2, 0x01, 0x00, 0xd9, 0x06, 0x00, 0x00, 0xda, 0x06, 0x00, 0x00, 0xe9, 0xb2, 0x01, 0x00,
+  0xda, 0x06, 0x00, 0x00, 0xdb, 0x06, 0x00, 0x00, 0xef, 0xb2, 0x01, 0x00, 0xdb, 0x06, 0x00, 0x00,
+  0xdc, 0x06, 0x00, 0x00, 0xf5, 0xb2, 0x01, 0x00, 0xdc, 0x06, 0x00, 0x00, 0xdd, 0x06, 0x00, 0x00,
+  0xfb, 0xb2, 0x01, 0x00, 0xdd, 0x06, 0x00, 0x00, 0xde, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xde, 0x06, 0x00, 0x00, 0xdf, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xdf, 0x06, 0x00, 0x00,
+  0xe0, 0x06, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0xe0, 0x06, 0x00, 0x00, 0xe2, 0x06, 0x00, 0x00,
+  0x06, 0xac, 0x01, 0x00, 0xe2, 0x06, 0x00, 0x00, 0xe5, 0x06, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00,
+  0xe5, 0x06, 0x00, 0x00, 0xe7, 0x06, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0xe7, 0x06, 0x00, 0x00,
+  0xe9, 0x06, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0xe9, 0x06, 0x00, 0x00, 0xeb, 0x06, 0x00, 0x00,
+  0x5a, 0xac, 0x01, 0x00, 0xeb, 0x06, 0x00, 0x00, 0xed, 0x06, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00,
+  0xed, 0x06, 0x00, 0x00, 0xef, 0x06, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00, 0xef, 0x06, 0x00, 0x00,
+  0xf1, 0x06, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00, 0xf1, 0x06, 0x00, 0x00, 0xf3, 0x06, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf3, 0x06, 0x00, 0x00, 0xf5, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xf5, 0x06, 0x00, 0x00, 0xf8, 0x06, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf8, 0x06, 0x00, 0x00,
+  0x01, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x01, 0x07, 0x00, 0x00, 0x0a, 0x07, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x0a, 0x07, 0x00, 0x00, 0x0c, 0x07, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00,
+  0x0c, 0x07, 0x00, 0x00, 0x0f, 0x07, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x0f, 0x07, 0x00, 0x00,
+  0x15, 0x07, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x15, 0x07, 0x00, 0x00, 0x1a, 0x07, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0x1a, 0x07, 0x00, 0x00, 0x1e, 0x07, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0x1e, 0x07, 0x00, 0x00, 0x22, 0x07, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x22, 0x07, 0x00, 0x00,
+  0x27, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x27, 0x07, 0x00, 0x00, 0x28, 0x07, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x07, 0x00, 0x00, 0x2a, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x2a, 0x07, 0x00, 0x00, 0x2b, 0x07, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x2b, 0x07, 0x00, 0x00,
+  0x2d, 0x07, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x2d, 0x07, 0x00, 0x00, 0x30, 0x07, 0x00, 0x00,
+  0x1e, 0xac, 0x01, 0x00, 0x30, 0x07, 0x00, 0x00, 0x32, 0x07, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00,
+  0x32, 0x07, 0x00, 0x00, 0x34, 0x07, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0x34, 0x07, 0x00, 0x00,
+  0x36, 0x07, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0x36, 0x07, 0x00, 0x00, 0x38, 0x07, 0x00, 0x00,
+  0x73, 0xac, 0x01, 0x00, 0x38, 0x07, 0x00, 0x00, 0x3a, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x3a, 0x07, 0x00, 0x00, 0x3c, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x3c, 0x07, 0x00, 0x00,
+  0x3e, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x3e, 0x07, 0x00, 0x00, 0x47, 0x07, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x47, 0x07, 0x00, 0x00, 0x49, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x49, 0x07, 0x00, 0x00, 0x4b, 0x07, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x4b, 0x07, 0x00, 0x00,
+  0x4e, 0x07, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x4e, 0x07, 0x00, 0x00, 0x53, 0x07, 0x00, 0x00,
+  0x9d, 0xaf, 0x01, 0x00, 0x53, 0x07, 0x00, 0x00, 0x58, 0x07, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00,
+  0x58, 0x07, 0x00, 0x00, 0x5c, 0x07, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0x5c, 0x07, 0x00, 0x00,
+  0x60, 0x07, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x60, 0x07, 0x00, 0x00, 0x65, 0x07, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x65, 0x07, 0x00, 0x00, 0x66, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x66, 0x07, 0x00, 0x00, 0x67, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x67, 0x07, 0x00, 0x00,
+  0x68, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x07, 0x00, 0x00, 0x69, 0x07, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x69, 0x07, 0x00, 0x00, 0x6a, 0x07, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0x6a, 0x07, 0x00, 0x00, 0x6c, 0x07, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x6c, 0x07, 0x00, 0x00,
+  0x6f, 0x07, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0x6f, 0x07, 0x00, 0x00, 0x71, 0x07, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x71, 0x07, 0x00, 0x00, 0x73, 0x07, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00,
+  0x73, 0x07, 0x00, 0x00, 0x75, 0x07, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0x75, 0x07, 0x00, 0x00,
+  0x77, 0x07, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0x77, 0x07, 0x00, 0x00, 0x79, 0x07, 0x00, 0x00,
+  0x8d, 0xac, 0x01, 0x00, 0x79, 0x07, 0x00, 0x00, 0x7b, 0x07, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00,
+  0x7b, 0x07, 0x00, 0x00, 0x7d, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x7d, 0x07, 0x00, 0x00,
+  0x7f, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x7f, 0x07, 0x00, 0x00, 0x81, 0x07, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x81, 0x07, 0x00, 0x00, 0x8a, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x8a, 0x07, 0x00, 0x00, 0x92, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x92, 0x07, 0x00, 0x00,
+  0x94, 0x07, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x94, 0x07, 0x00, 0x00, 0x97, 0x07, 0x00, 0x00,
+  0x57, 0xaf, 0x01, 0x00, 0x97, 0x07, 0x00, 0x00, 0x9c, 0x07, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00,
+  0x9c, 0x07, 0x00, 0x00, 0xa1, 0x07, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0xa1, 0x07, 0x00, 0x00,
+  0xa5, 0x07, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0xa5, 0x07, 0x00, 0x00, 0xa9, 0x07, 0x00, 0x00,
+  0x5b, 0xb0, 0x01, 0x00, 0xa9, 0x07, 0x00, 0x00, 0xae, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xae, 0x07, 0x00, 0x00, 0xaf, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xaf, 0x07, 0x00, 0x00,
+  0xb0, 0x07, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0xb0, 0x07, 0x00, 0x00, 0xb2, 0x07, 0x00, 0x00,
+  0x06, 0xac, 0x01, 0x00, 0xb2, 0x07, 0x00, 0x00, 0xb5, 0x07, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00,
+  0xb5, 0x07, 0x00, 0x00, 0xb7, 0x07, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0xb7, 0x07, 0x00, 0x00,
+  0xb9, 0x07, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0xb9, 0x07, 0x00, 0x00, 0xbb, 0x07, 0x00, 0x00,
+  0x5a, 0xac, 0x01, 0x00, 0xbb, 0x07, 0x00, 0x00, 0xbd, 0x07, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00,
+  0xbd, 0x07, 0x00, 0x00, 0xbf, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xbf, 0x07, 0x00, 0x00,
+  0xc1, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc1, 0x07, 0x00, 0x00, 0xc3, 0x07, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc3, 0x07, 0x00, 0x00, 0xcc, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xcc, 0x07, 0x00, 0x00, 0xce, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xce, 0x07, 0x00, 0x00,
+  0xd0, 0x07, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0xd0, 0x07, 0x00, 0x00, 0xd3, 0x07, 0x00, 0x00,
+  0x57, 0xaf, 0x01, 0x00, 0xd3, 0x07, 0x00, 0x00, 0xd8, 0x07, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00,
+  0xd8, 0x07, 0x00, 0x00, 0xdc, 0x07, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0xdc, 0x07, 0x00, 0x00,
+  0xe0, 0x07, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0xe0, 0x07, 0x00, 0x00, 0xe4, 0x07, 0x00, 0x00,
+  0x5b, 0xb0, 0x01, 0x00, 0xe4, 0x07, 0x00, 0x00, 0xe9, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xe9, 0x07, 0x00, 0x00, 0xea, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xea, 0x07, 0x00, 0x00,
+  0xeb, 0x07, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0xeb, 0x07, 0x00, 0x00, 0xed, 0x07, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xed, 0x07, 0x00, 0x00, 0xee, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xee, 0x07, 0x00, 0x00, 0xf1, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf1, 0x07, 0x00, 0x00,
+  0xf4, 0x07, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf4, 0x07, 0x00, 0x00, 0xf5, 0x07, 0x00, 0x00,
+  0x0b, 0xab, 0x01, 0x00, 0xf5, 0x07, 0x00, 0x00, 0xf7, 0x07, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00,
+  0xf7, 0x07, 0x00, 0x00, 0xfa, 0x07, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0xfa, 0x07, 0x00, 0x00,
+  0xfc, 0x07, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x00,
+  0xa7, 0xac, 0x01, 0x00, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x00, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x02, 0x08, 0x00, 0x00,
+  0x05, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x05, 0x08, 0x00, 0x00, 0x0c, 0x08, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x0c, 0x08, 0x00, 0x00, 0x11, 0x08, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00,
+  0x11, 0x08, 0x00, 0x00, 0x13, 0x08, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x13, 0x08, 0x00, 0x00,
+  0x16, 0x08, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x16, 0x08, 0x00, 0x00, 0x18, 0x08, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0x18, 0x08, 0x00, 0x00, 0x1b, 0x08, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0x1b, 0x08, 0x00, 0x00, 0x1d, 0x08, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x1d, 0x08, 0x00, 0x00,
+  0x21, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x21, 0x08, 0x00, 0x00, 0x22, 0x08, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x22, 0x08, 0x00, 0x00, 0x24, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x24, 0x08, 0x00, 0x00, 0x25, 0x08, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x25, 0x08, 0x00, 0x00,
+  0x27, 0x08, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x27, 0x08, 0x00, 0x00, 0x2a, 0x08, 0x00, 0x00,
+  0x73, 0xac, 0x01, 0x00, 0x2a, 0x08, 0x00, 0x00, 0x2c, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x2c, 0x08, 0x00, 0x00, 0x2e, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x2e, 0x08, 0x00, 0x00,
+  0x30, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x30, 0x08, 0x00, 0x00, 0x37, 0x08, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x37, 0x08, 0x00, 0x00, 0x39, 0x08, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00,
+  0x39, 0x08, 0x00, 0x00, 0x3b, 0x08, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x3b, 0x08, 0x00, 0x00,
+  0x3d, 0x08, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x3d, 0x08, 0x00, 0x00, 0x3f, 0x08, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0x3f, 0x08, 0x00, 0x00, 0x42, 0x08, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0x42, 0x08, 0x00, 0x00, 0x44, 0x08, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x44, 0x08, 0x00, 0x00,
+  0x48, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0x08, 0x00, 0x00, 0x49, 0x08, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x49, 0x08, 0x00, 0x00, 0x4a, 0x08, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00,
+  0x4a, 0x08, 0x00, 0x00, 0x4d, 0x08, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0x4d, 0x08, 0x00, 0x00,
+  0x4f, 0x08, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00, 0x4f, 0x08, 0x00, 0x00, 0x51, 0x08, 0x00, 0x00,
+  0xa7, 0xac, 0x01, 0x00, 0x51, 0x08, 0x00, 0x00, 0x53, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x53, 0x08, 0x00, 0x00, 0x55, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x55, 0x08, 0x00, 0x00,
+  0x57, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x57, 0x08, 0x00, 0x00, 0x5e, 0x08, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x5e, 0x08, 0x00, 0x00, 0x62, 0x08, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00,
+  0x62, 0x08, 0x00, 0x00, 0x64, 0x08, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x64, 0x08, 0x00, 0x00,
+  0x66, 0x08, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x66, 0x08, 0x00, 0x00, 0x68, 0x08, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0x68, 0x08, 0x00, 0x00, 0x6b, 0x08, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0x6b, 0x08, 0x00, 0x00, 0x6d, 0x08, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x6d, 0x08, 0x00, 0x00,
+  0x71, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x71, 0x08, 0x00, 0x00, 0x72, 0x08, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x72, 0x08, 0x00, 0x00, 0x73, 0x08, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0x73, 0x08, 0x00, 0x00, 0x75, 0x08, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x75, 0x08, 0x00, 0x00,
+  0x78, 0x08, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0x78, 0x08, 0x00, 0x00, 0x7a, 0x08, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x7a, 0x08, 0x00, 0x00, 0x7c, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x7c, 0x08, 0x00, 0x00, 0x7e, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x7e, 0x08, 0x00, 0x00,
+  0x85, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x85, 0x08, 0x00, 0x00, 0x87, 0x08, 0x00, 0x00,
+  0x00, 0xaf, 0x01, 0x00, 0x87, 0x08, 0x00, 0x00, 0x89, 0x08, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00,
+  0x89, 0x08, 0x00, 0x00, 0x8b, 0x08, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x8b, 0x08, 0x00, 0x00,
+  0x8d, 0x08, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x8d, 0x08, 0x00, 0x00, 0x90, 0x08, 0x00, 0x00,
+  0x0e, 0xb0, 0x01, 0x00, 0x90, 0x08, 0x00, 0x00, 0x92, 0x08, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00,
+  0x92, 0x08, 0x00, 0x00, 0x96, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x96, 0x08, 0x00, 0x00,
+  0x97, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x97, 0x08, 0x00, 0x00, 0x98, 0x08, 0x00, 0x00,
+  0x0b, 0xab, 0x01, 0x00, 0x98, 0x08, 0x00, 0x00, 0x9a, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x9a, 0x08, 0x00, 0x00, 0x9b, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x9b, 0x08, 0x00, 0x00,
+  0x9e, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x9e, 0x08, 0x00, 0x00, 0x9f, 0x08, 0x00, 0x00,
+  0x0b, 0xab, 0x01, 0x00, 0x9f, 0x08, 0x00, 0x00, 0xa1, 0x08, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00,
+  0xa1, 0x08, 0x00, 0x00, 0xa4, 0x08, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0xa4, 0x08, 0x00, 0x00,
+  0xa6, 0x08, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0xa6, 0x08, 0x00, 0x00, 0xa8, 0x08, 0x00, 0x00,
+  0x3e, 0xac, 0x01, 0x00, 0xa8, 0x08, 0x00, 0x00, 0xaa, 0x08, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00,
+  0xaa, 0x08, 0x00, 0x00, 0xac, 0x08, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0xac, 0x08, 0x00, 0x00,
+  0xae, 0x08, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00, 0xae, 0x08, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00,
+  0xa7, 0xac, 0x01, 0x00, 0xb0, 0x08, 0x00, 0x00, 0xb2, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xb2, 0x08, 0x00, 0x00, 0xb4, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb4, 0x08, 0x00, 0x00,
+  0xb7, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb7, 0x08, 0x00, 0x00, 0xbf, 0x08, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xbf, 0x08, 0x00, 0x00, 0xc7, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xc7, 0x08, 0x00, 0x00, 0xc9, 0x08, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0xc9, 0x08, 0x00, 0x00,
+  0xcc, 0x08, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0xcc, 0x08, 0x00, 0x00, 0xd2, 0x08, 0x00, 0x00,
+  0x9d, 0xaf, 0x01, 0x00, 0xd2, 0x08, 0x00, 0x00, 0xd7, 0x08, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00,
+  0xd7, 0x08, 0x00, 0x00, 0xdb, 0x08, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0xdb, 0x08, 0x00, 0x00,
+  0xdf, 0x08, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0xdf, 0x08, 0x00, 0x00, 0xe4, 0x08, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe4, 0x08, 0x00, 0x00, 0xe5, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xe5, 0x08, 0x00, 0x00, 0xe7, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe7, 0x08, 0x00, 0x00,
+  0xe8, 0x08, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0xe8, 0x08, 0x00, 0x00, 0xea, 0x08, 0x00, 0x00,
+  0x06, 0xac, 0x01, 0x00, 0xea, 0x08, 0x00, 0x00, 0xed, 0x08, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00,
+  0xed, 0x08, 0x00, 0x00, 0xef, 0x08, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0xef, 0x08, 0x00, 0x00,
+  0xf1, 0x08, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0xf1, 0x08, 0x00, 0x00, 0xf3, 0x08, 0x00, 0x00,
+  0x5a, 0xac, 0x01, 0x00, 0xf3, 0x08, 0x00, 0x00, 0xf5, 0x08, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00,
+  0xf5, 0x08, 0x00, 0x00, 0xf7, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf7, 0x08, 0x00, 0x00,
+  0xf9, 0x08, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf9, 0x08, 0x00, 0x00, 0xfb, 0x08, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xfb, 0x08, 0x00, 0x00, 0x03, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x03, 0x09, 0x00, 0x00, 0x05, 0x09, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x05, 0x09, 0x00, 0x00,
+  0x08, 0x09, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x08, 0x09, 0x00, 0x00, 0x0d, 0x09, 0x00, 0x00,
+  0x9d, 0xaf, 0x01, 0x00, 0x0d, 0x09, 0x00, 0x00, 0x12, 0x09, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00,
+  0x12, 0x09, 0x00, 0x00, 0x16, 0x09, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0x16, 0x09, 0x00, 0x00,
+  0x1a, 0x09, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x1a, 0x09, 0x00, 0x00, 0x1f, 0x09, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x1f, 0x09, 0x00, 0x00, 0x20, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x20, 0x09, 0x00, 0x00, 0x21, 0x09, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x21, 0x09, 0x00, 0x00,
+  0x23, 0x09, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x23, 0x09, 0x00, 0x00, 0x26, 0x09, 0x00, 0x00,
+  0x1e, 0xac, 0x01, 0x00, 0x26, 0x09, 0x00, 0x00, 0x28, 0x09, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00,
+  0x28, 0x09, 0x00, 0x00, 0x2a, 0x09, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0x2a, 0x09, 0x00, 0x00,
+  0x2c, 0x09, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0x2c, 0x09, 0x00, 0x00, 0x2e, 0x09, 0x00, 0x00,
+  0x73, 0xac, 0x01, 0x00, 0x2e, 0x09, 0x00, 0x00, 0x30, 0x09, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00,
+  0x30, 0x09, 0x00, 0x00, 0x32, 0x09, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00, 0x32, 0x09, 0x00, 0x00,
+  0x34, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x34, 0x09, 0x00, 0x00, 0x36, 0x09, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x36, 0x09, 0x00, 0x00, 0x38, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x38, 0x09, 0x00, 0x00, 0x40, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x40, 0x09, 0x00, 0x00,
+  0x47, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x47, 0x09, 0x00, 0x00, 0x49, 0x09, 0x00, 0x00,
+  0x00, 0xaf, 0x01, 0x00, 0x49, 0x09, 0x00, 0x00, 0x4c, 0x09, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00,
+  0x4c, 0x09, 0x00, 0x00, 0x51, 0x09, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x51, 0x09, 0x00, 0x00,
+  0x54, 0x09, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x54, 0x09, 0x00, 0x00, 0x58, 0x09, 0x00, 0x00,
+  0x0e, 0xb0, 0x01, 0x00, 0x58, 0x09, 0x00, 0x00, 0x5a, 0x09, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00,
+  0x5a, 0x09, 0x00, 0x00, 0x5f, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x5f, 0x09, 0x00, 0x00,
+  0x60, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x60, 0x09, 0x00, 0x00, 0x61, 0x09, 0x00, 0x00,
+  0x0b, 0xab, 0x01, 0x00, 0x61, 0x09, 0x00, 0x00, 0x63, 0x09, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00,
+  0x63, 0x09, 0x00, 0x00, 0x66, 0x09, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0x66, 0x09, 0x00, 0x00,
+  0x68, 0x09, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x68, 0x09, 0x00, 0x00, 0x6a, 0x09, 0x00, 0x00,
+  0x3e, 0xac, 0x01, 0x00, 0x6a, 0x09, 0x00, 0x00, 0x6c, 0x09, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00,
+  0x6c, 0x09, 0x00, 0x00, 0x6e, 0x09, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0x6e, 0x09, 0x00, 0x00,
+  0x70, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x70, 0x09, 0x00, 0x00, 0x72, 0x09, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x72, 0x09, 0x00, 0x00, 0x74, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x74, 0x09, 0x00, 0x00, 0x7c, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x7c, 0x09, 0x00, 0x00,
+  0x7e, 0x09, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x7e, 0x09, 0x00, 0x00, 0x81, 0x09, 0x00, 0x00,
+  0x57, 0xaf, 0x01, 0x00, 0x81, 0x09, 0x00, 0x00, 0x85, 0x09, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0x85, 0x09, 0x00, 0x00, 0x87, 0x09, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x87, 0x09, 0x00, 0x00,
+  0x89, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x89, 0x09, 0x00, 0x00, 0x8a, 0x09, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x8a, 0x09, 0x00, 0x00, 0x8b, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x8b, 0x09, 0x00, 0x00, 0x8c, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x8c, 0x09, 0x00, 0x00,
+  0x8d, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x8d, 0x09, 0x00, 0x00, 0x8e, 0x09, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x8e, 0x09, 0x00, 0x00, 0x8f, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x8f, 0x09, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x90, 0x09, 0x00, 0x00,
+  0x92, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x92, 0x09, 0x00, 0x00, 0x93, 0x09, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x93, 0x09, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x96, 0x09, 0x00, 0x00, 0x97, 0x09, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x97, 0x09, 0x00, 0x00,
+  0x99, 0x09, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x99, 0x09, 0x00, 0x00, 0x9c, 0x09, 0x00, 0x00,
+  0x1e, 0xac, 0x01, 0x00, 0x9c, 0x09, 0x00, 0x00, 0x9e, 0x09, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00,
+  0x9e, 0x09, 0x00, 0x00, 0xa0, 0x09, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0xa0, 0x09, 0x00, 0x00,
+  0xa2, 0x09, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0xa2, 0x09, 0x00, 0x00, 0xa4, 0x09, 0x00, 0x00,
+  0x73, 0xac, 0x01, 0x00, 0xa4, 0x09, 0x00, 0x00, 0xa6, 0x09, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00,
+  0xa6, 0x09, 0x00, 0x00, 0xa8, 0x09, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00, 0xa8, 0x09, 0x00, 0x00,
+  0xaa, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xaa, 0x09, 0x00, 0x00, 0xac, 0x09, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xac, 0x09, 0x00, 0x00, 0xaf, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xaf, 0x09, 0x00, 0x00, 0xb7, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb7, 0x09, 0x00, 0x00,
+  0xbf, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xbf, 0x09, 0x00, 0x00, 0xc1, 0x09, 0x00, 0x00,
+  0x00, 0xaf, 0x01, 0x00, 0xc1, 0x09, 0x00, 0x00, 0xc4, 0x09, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00,
+  0xc4, 0x09, 0x00, 0x00, 0xca, 0x09, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0xca, 0x09, 0x00, 0x00,
+  0xcf, 0x09, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0xcf, 0x09, 0x00, 0x00, 0xd3, 0x09, 0x00, 0x00,
+  0x0e, 0xb0, 0x01, 0x00, 0xd3, 0x09, 0x00, 0x00, 0xd7, 0x09, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00,
+  0xd7, 0x09, 0x00, 0x00, 0xdc, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xdc, 0x09, 0x00, 0x00,
+  0xdd, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xdd, 0x09, 0x00, 0x00, 0xdf, 0x09, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xdf, 0x09, 0x00, 0x00, 0xe0, 0x09, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0xe0, 0x09, 0x00, 0x00, 0xe2, 0x09, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0xe2, 0x09, 0x00, 0x00,
+  0xe5, 0x09, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0xe5, 0x09, 0x00, 0x00, 0xe7, 0x09, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0xe7, 0x09, 0x00, 0x00, 0xe9, 0x09, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00,
+  0xe9, 0x09, 0x00, 0x00, 0xeb, 0x09, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0xeb, 0x09, 0x00, 0x00,
+  0xed, 0x09, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0xed, 0x09, 0x00, 0x00, 0xef, 0x09, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xef, 0x09, 0x00, 0x00, 0xf1, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xf1, 0x09, 0x00, 0x00, 0xf3, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf3, 0x09, 0x00, 0x00,
+  0xfb, 0x09, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xfb, 0x09, 0x00, 0x00, 0xfd, 0x09, 0x00, 0x00,
+  0x00, 0xaf, 0x01, 0x00, 0xfd, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00,
+  0x00, 0x0a, 0x00, 0x00, 0x05, 0x0a, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x05, 0x0a, 0x00, 0x00,
+  0x0a, 0x0a, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0e, 0x0a, 0x00, 0x00,
+  0x0e, 0xb0, 0x01, 0x00, 0x0e, 0x0a, 0x00, 0x00, 0x12, 0x0a, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00,
+  0x12, 0x0a, 0x00, 0x00, 0x17, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x17, 0x0a, 0x00, 0x00,
+  0x18, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0x0a, 0x00, 0x00, 0x19, 0x0a, 0x00, 0x00,
+  0x0b, 0xab, 0x01, 0x00, 0x19, 0x0a, 0x00, 0x00, 0x1b, 0x0a, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00,
+  0x1b, 0x0a, 0x00, 0x00, 0x1e, 0x0a, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0x1e, 0x0a, 0x00, 0x00,
+  0x20, 0x0a, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x20, 0x0a, 0x00, 0x00, 0x22, 0x0a, 0x00, 0x00,
+  0x3e, 0xac, 0x01, 0x00, 0x22, 0x0a, 0x00, 0x00, 0x24, 0x0a, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00,
+  0x24, 0x0a, 0x00, 0x00, 0x26, 0x0a, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0x26, 0x0a, 0x00, 0x00,
+  0x28, 0x0a, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00, 0x28, 0x0a, 0x00, 0x00, 0x2a, 0x0a, 0x00, 0x00,
+  0xa7, 0xac, 0x01, 0x00, 0x2a, 0x0a, 0x00, 0x00, 0x2c, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x2c, 0x0a, 0x00, 0x00, 0x2e, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x2e, 0x0a, 0x00, 0x00,
+  0x30, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x30, 0x0a, 0x00, 0x00, 0x38, 0x0a, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0x0a, 0x00, 0x00, 0x3f, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x3f, 0x0a, 0x00, 0x00, 0x41, 0x0a, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x41, 0x0a, 0x00, 0x00,
+  0x44, 0x0a, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x44, 0x0a, 0x00, 0x00, 0x49, 0x0a, 0x00, 0x00,
+  0x5b, 0xb0, 0x01, 0x00, 0x49, 0x0a, 0x00, 0x00, 0x4c, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x4c, 0x0a, 0x00, 0x00, 0x4d, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4d, 0x0a, 0x00, 0x00,
+  0x4e, 0x0a, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x4e, 0x0a, 0x00, 0x00, 0x50, 0x0a, 0x00, 0x00,
+  0x06, 0xac, 0x01, 0x00, 0x50, 0x0a, 0x00, 0x00, 0x53, 0x0a, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00,
+  0x53, 0x0a, 0x00, 0x00, 0x55, 0x0a, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x55, 0x0a, 0x00, 0x00,
+  0x57, 0x0a, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0x57, 0x0a, 0x00, 0x00, 0x59, 0x0a, 0x00, 0x00,
+  0x5a, 0xac, 0x01, 0x00, 0x59, 0x0a, 0x00, 0x00, 0x5b, 0x0a, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00,
+  0x5b, 0x0a, 0x00, 0x00, 0x5d, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x5d, 0x0a, 0x00, 0x00,
+  0x5f, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x5f, 0x0a, 0x00, 0x00, 0x61, 0x0a, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x61, 0x0a, 0x00, 0x00, 0x69, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x69, 0x0a, 0x00, 0x00, 0x6b, 0x0a, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x6b, 0x0a, 0x00, 0x00,
+  0x6e, 0x0a, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x6e, 0x0a, 0x00, 0x00, 0x72, 0x0a, 0x00, 0x00,
+  0x5b, 0xb0, 0x01, 0x00, 0x72, 0x0a, 0x00, 0x00, 0x74, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x74, 0x0a, 0x00, 0x00, 0x75, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x75, 0x0a, 0x00, 0x00,
+  0x76, 0x0a, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x76, 0x0a, 0x00, 0x00, 0x78, 0x0a, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0x0a, 0x00, 0x00, 0x79, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x79, 0x0a, 0x00, 0x00, 0x7b, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x7b, 0x0a, 0x00, 0x00,
+  0x7c, 0x0a, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x7c, 0x0a, 0x00, 0x00, 0x7e, 0x0a, 0x00, 0x00,
+  0x06, 0xac, 0x01, 0x00, 0x7e, 0x0a, 0x00, 0x00, 0x81, 0x0a, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00,
+  0x81, 0x0a, 0x00, 0x00, 0x83, 0x0a, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00, 0x83, 0x0a, 0x00, 0x00,
+  0x85, 0x0a, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00, 0x85, 0x0a, 0x00, 0x00, 0x87, 0x0a, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x87, 0x0a, 0x00, 0x00, 0x89, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x89, 0x0a, 0x00, 0x00, 0x8c, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x8c, 0x0a, 0x00, 0x00,
+  0x93, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x93, 0x0a, 0x00, 0x00, 0x99, 0x0a, 0x00, 0x00,
+  0x00, 0xaf, 0x01, 0x00, 0x99, 0x0a, 0x00, 0x00, 0x9b, 0x0a, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00,
+  0x9b, 0x0a, 0x00, 0x00, 0x9e, 0x0a, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x9e, 0x0a, 0x00, 0x00,
+  0xa1, 0x0a, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0xa1, 0x0a, 0x00, 0x00, 0xa4, 0x0a, 0x00, 0x00,
+  0x0e, 0xb0, 0x01, 0x00, 0xa4, 0x0a, 0x00, 0x00, 0xa6, 0x0a, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00,
+  0xa6, 0x0a, 0x00, 0x00, 0xaa, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xaa, 0x0a, 0x00, 0x00,
+  0xab, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xab, 0x0a, 0x00, 0x00, 0xad, 0x0a, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xad, 0x0a, 0x00, 0x00, 0xae, 0x0a, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0xae, 0x0a, 0x00, 0x00, 0xb0, 0x0a, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0xb0, 0x0a, 0x00, 0x00,
+  0xb3, 0x0a, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0xb3, 0x0a, 0x00, 0x00, 0xb5, 0x0a, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb5, 0x0a, 0x00, 0x00, 0xb7, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xb7, 0x0a, 0x00, 0x00, 0xb9, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb9, 0x0a, 0x00, 0x00,
+  0xc0, 0x0a, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0xc0, 0x0a, 0x00, 0x00, 0xc2, 0x0a, 0x00, 0x00,
+  0x57, 0xaf, 0x01, 0x00, 0xc2, 0x0a, 0x00, 0x00, 0xc4, 0x0a, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00,
+  0xc4, 0x0a, 0x00, 0x00, 0xc7, 0x0a, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00, 0xc7, 0x0a, 0x00, 0x00,
+  0xca, 0x0a, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0xca, 0x0a, 0x00, 0x00, 0xcc, 0x0a, 0x00, 0x00,
+  0x5b, 0xb0, 0x01, 0x00, 0xcc, 0x0a, 0x00, 0x00, 0xd0, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xd0, 0x0a, 0x00, 0x00, 0xd1, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd1, 0x0a, 0x00, 0x00,
+  0xd2, 0x0a, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0xd2, 0x0a, 0x00, 0x00, 0xd4, 0x0a, 0x00, 0x00,
+  0x06, 0xac, 0x01, 0x00, 0xd4, 0x0a, 0x00, 0x00, 0xd7, 0x0a, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00,
+  0xd7, 0x0a, 0x00, 0x00, 0xd9, 0x0a, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00, 0xd9, 0x0a, 0x00, 0x00,
+  0xdb, 0x0a, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00, 0xdb, 0x0a, 0x00, 0x00, 0xdd, 0x0a, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xdd, 0x0a, 0x00, 0x00, 0xdf, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xdf, 0x0a, 0x00, 0x00, 0xe1, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe1, 0x0a, 0x00, 0x00,
+  0xe8, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x0a, 0x00, 0x00, 0xed, 0x0a, 0x00, 0x00,
+  0x00, 0xaf, 0x01, 0x00, 0xed, 0x0a, 0x00, 0x00, 0xef, 0x0a, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00,
+  0xef, 0x0a, 0x00, 0x00, 0xf1, 0x0a, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0xf1, 0x0a, 0x00, 0x00,
+  0xf3, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf3, 0x0a, 0x00, 0x00, 0xf4, 0x0a, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf4, 0x0a, 0x00, 0x00, 0xf5, 0x0a, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0xf5, 0x0a, 0x00, 0x00, 0xf7, 0x0a, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0xf7, 0x0a, 0x00, 0x00,
+  0xfa, 0x0a, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0xfa, 0x0a, 0x00, 0x00, 0xfc, 0x0a, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xfc, 0x0a, 0x00, 0x00, 0xfe, 0x0a, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xfe, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00,
+  0x07, 0x0b, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x07, 0x0b, 0x00, 0x00, 0x09, 0x0b, 0x00, 0x00,
+  0x57, 0xaf, 0x01, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x0b, 0x0b, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00,
+  0x0b, 0x0b, 0x00, 0x00, 0x0d, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x0d, 0x0b, 0x00, 0x00,
+  0x0e, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x0e, 0x0b, 0x00, 0x00, 0x0f, 0x0b, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x0f, 0x0b, 0x00, 0x00, 0x10, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x10, 0x0b, 0x00, 0x00, 0x11, 0x0b, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x11, 0x0b, 0x00, 0x00,
+  0x13, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x13, 0x0b, 0x00, 0x00, 0x14, 0x0b, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x14, 0x0b, 0x00, 0x00, 0x16, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x16, 0x0b, 0x00, 0x00, 0x1a, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x1a, 0x0b, 0x00, 0x00,
+  0x1c, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x1c, 0x0b, 0x00, 0x00, 0x1d, 0x0b, 0x00, 0x00,
+  0x0b, 0xab, 0x01, 0x00, 0x1d, 0x0b, 0x00, 0x00, 0x1f, 0x0b, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00,
+  0x1f, 0x0b, 0x00, 0x00, 0x22, 0x0b, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0x22, 0x0b, 0x00, 0x00,
+  0x24, 0x0b, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x24, 0x0b, 0x00, 0x00, 0x26, 0x0b, 0x00, 0x00,
+  0x3e, 0xac, 0x01, 0x00, 0x26, 0x0b, 0x00, 0x00, 0x28, 0x0b, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00,
+  0x28, 0x0b, 0x00, 0x00, 0x2a, 0x0b, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0x2a, 0x0b, 0x00, 0x00,
+  0x2c, 0x0b, 0x00, 0x00, 0x8d, 0xac, 0x01, 0x00, 0x2c, 0x0b, 0x00, 0x00, 0x2e, 0x0b, 0x00, 0x00,
+  0xa7, 0xac, 0x01, 0x00, 0x2e, 0x0b, 0x00, 0x00, 0x30, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x30, 0x0b, 0x00, 0x00, 0x32, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x32, 0x0b, 0x00, 0x00,
+  0x35, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x35, 0x0b, 0x00, 0x00, 0x3d, 0x0b, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x3d, 0x0b, 0x00, 0x00, 0x45, 0x0b, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00,
+  0x45, 0x0b, 0x00, 0x00, 0x48, 0x0b, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x48, 0x0b, 0x00, 0x00,
+  0x4e, 0x0b, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x4e, 0x0b, 0x00, 0x00, 0x51, 0x0b, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0x51, 0x0b, 0x00, 0x00, 0x55, 0x0b, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0x55, 0x0b, 0x00, 0x00, 0x57, 0x0b, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x57, 0x0b, 0x00, 0x00,
+  0x5c, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x5c, 0x0b, 0x00, 0x00, 0x5d, 0x0b, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x5d, 0x0b, 0x00, 0x00, 0x5f, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x5f, 0x0b, 0x00, 0x00, 0x60, 0x0b, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0x60, 0x0b, 0x00, 0x00,
+  0x62, 0x0b, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x62, 0x0b, 0x00, 0x00, 0x65, 0x0b, 0x00, 0x00,
+  0x1e, 0xac, 0x01, 0x00, 0x65, 0x0b, 0x00, 0x00, 0x67, 0x0b, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00,
+  0x67, 0x0b, 0x00, 0x00, 0x69, 0x0b, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0x69, 0x0b, 0x00, 0x00,
+  0x6b, 0x0b, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0x6b, 0x0b, 0x00, 0x00, 0x6d, 0x0b, 0x00, 0x00,
+  0x73, 0xac, 0x01, 0x00, 0x6d, 0x0b, 0x00, 0x00, 0x6f, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x6f, 0x0b, 0x00, 0x00, 0x71, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x71, 0x0b, 0x00, 0x00,
+  0x73, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x73, 0x0b, 0x00, 0x00, 0x7b, 0x0b, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x7b, 0x0b, 0x00, 0x00, 0x7d, 0x0b, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00,
+  0x7d, 0x0b, 0x00, 0x00, 0x80, 0x0b, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0x80, 0x0b, 0x00, 0x00,
+  0x85, 0x0b, 0x00, 0x00, 0x9d, 0xaf, 0x01, 0x00, 0x85, 0x0b, 0x00, 0x00, 0x88, 0x0b, 0x00, 0x00,
+  0xd4, 0xaf, 0x01, 0x00, 0x88, 0x0b, 0x00, 0x00, 0x8c, 0x0b, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00,
+  0x8c, 0x0b, 0x00, 0x00, 0x8e, 0x0b, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x8e, 0x0b, 0x00, 0x00,
+  0x93, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x93, 0x0b, 0x00, 0x00, 0x94, 0x0b, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x94, 0x0b, 0x00, 0x00, 0x95, 0x0b, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0x95, 0x0b, 0x00, 0x00, 0x97, 0x0b, 0x00, 0x00, 0x06, 0xac, 0x01, 0x00, 0x97, 0x0b, 0x00, 0x00,
+  0x9a, 0x0b, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00, 0x9a, 0x0b, 0x00, 0x00, 0x9c, 0x0b, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x9c, 0x0b, 0x00, 0x00, 0x9e, 0x0b, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00,
+  0x9e, 0x0b, 0x00, 0x00, 0xa0, 0x0b, 0x00, 0x00, 0x5a, 0xac, 0x01, 0x00, 0xa0, 0x0b, 0x00, 0x00,
+  0xa2, 0x0b, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00, 0xa2, 0x0b, 0x00, 0x00, 0xa4, 0x0b, 0x00, 0x00,
+  0x8d, 0xac, 0x01, 0x00, 0xa4, 0x0b, 0x00, 0x00, 0xa6, 0x0b, 0x00, 0x00, 0xa7, 0xac, 0x01, 0x00,
+  0xa6, 0x0b, 0x00, 0x00, 0xa8, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x0b, 0x00, 0x00,
+  0xaa, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xaa, 0x0b, 0x00, 0x00, 0xac, 0x0b, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xac, 0x0b, 0x00, 0x00, 0xb4, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xb4, 0x0b, 0x00, 0x00, 0xbb, 0x0b, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0xbb, 0x0b, 0x00, 0x00,
+  0xbe, 0x0b, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0xbe, 0x0b, 0x00, 0x00, 0xc3, 0x0b, 0x00, 0x00,
+  0x9d, 0xaf, 0x01, 0x00, 0xc3, 0x0b, 0x00, 0x00, 0xc6, 0x0b, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00,
+  0xc6, 0x0b, 0x00, 0x00, 0xca, 0x0b, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0xca, 0x0b, 0x00, 0x00,
+  0xcc, 0x0b, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0xcc, 0x0b, 0x00, 0x00, 0xd1, 0x0b, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd1, 0x0b, 0x00, 0x00, 0xd2, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xd2, 0x0b, 0x00, 0x00, 0xd4, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd4, 0x0b, 0x00, 0x00,
+  0xd5, 0x0b, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00, 0xd5, 0x0b, 0x00, 0x00, 0xd7, 0x0b, 0x00, 0x00,
+  0x06, 0xac, 0x01, 0x00, 0xd7, 0x0b, 0x00, 0x00, 0xda, 0x0b, 0x00, 0x00, 0x1e, 0xac, 0x01, 0x00,
+  0xda, 0x0b, 0x00, 0x00, 0xdc, 0x0b, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0xdc, 0x0b, 0x00, 0x00,
+  0xde, 0x0b, 0x00, 0x00, 0x3e, 0xac, 0x01, 0x00, 0xde, 0x0b, 0x00, 0x00, 0xe0, 0x0b, 0x00, 0x00,
+  0x5a, 0xac, 0x01, 0x00, 0xe0, 0x0b, 0x00, 0x00, 0xe2, 0x0b, 0x00, 0x00, 0x73, 0xac, 0x01, 0x00,
+  0xe2, 0x0b, 0x00, 0x00, 0xe4, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe4, 0x0b, 0x00, 0x00,
+  0xe6, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe6, 0x0b, 0x00, 0x00, 0xe8, 0x0b, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0x0b, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0xf0, 0x0b, 0x00, 0x00, 0xf2, 0x0b, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0xf2, 0x0b, 0x00, 0x00,
+  0xf5, 0x0b, 0x00, 0x00, 0x57, 0xaf, 0x01, 0x00, 0xf5, 0x0b, 0x00, 0x00, 0xfa, 0x0b, 0x00, 0x00,
+  0x9d, 0xaf, 0x01, 0x00, 0xfa, 0x0b, 0x00, 0x00, 0xfd, 0x0b, 0x00, 0x00, 0xd4, 0xaf, 0x01, 0x00,
+  0xfd, 0x0b, 0x00, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0x01, 0x0c, 0x00, 0x00,
+  0x03, 0x0c, 0x00, 0x00, 0x5b, 0xb0, 0x01, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x08, 0x0c, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x09, 0x0c, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00,
+  0x09, 0x0c, 0x00, 0x00, 0x0a, 0x0c, 0x00, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xe8, 0xb8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf8, 0xb8, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x08, 0xb9, 0x00, 0x00,
+  0x1d, 0xab, 0x01, 0x00, 0x18, 0xb9, 0x00, 0x00, 0x27, 0xab, 0x01, 0x00, 0x28, 0xb9, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0xb9, 0x00, 0x00, 0x35, 0xab, 0x01, 0x00, 0x48, 0xb9, 0x00, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x58, 0xb9, 0x00, 0x00, 0x81, 0xab, 0x01, 0x00, 0x68, 0xb9, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0xb9, 0x00, 0x00, 0xac, 0xab, 0x01, 0x00, 0x88, 0xb9, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0xb9, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0xb9, 0x00, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0xc8, 0xb9, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0xb9, 0x00, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0xe8, 0xb9, 0x00, 0x00, 0xe3, 0xab, 0x01, 0x00, 0xf8, 0xb9, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0xba, 0x00, 0x00, 0x0b, 0xac, 0x01, 0x00, 0x18, 0xba, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0xba, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x38, 0xba, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0xba, 0x00, 0x00, 0x2b, 0xac, 0x01, 0x00, 0x58, 0xba, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0xba, 0x00, 0x00, 0x47, 0xac, 0x01, 0x00, 0x78, 0xba, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0xba, 0x00, 0x00, 0x61, 0xac, 0x01, 0x00, 0x98, 0xba, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0xba, 0x00, 0x00, 0x79, 0xac, 0x01, 0x00, 0xb8, 0xba, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0xba, 0x00, 0x00, 0x93, 0xac, 0x01, 0x00, 0xd8, 0xba, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0xba, 0x00, 0x00, 0xb1, 0xac, 0x01, 0x00, 0xf8, 0xba, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0xbb, 0x00, 0x00, 0x1d, 0xab, 0x01, 0x00, 0x18, 0xbb, 0x00, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x28, 0xbb, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0xbb, 0x00, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0x48, 0xbb, 0x00, 0x00, 0xfb, 0xac, 0x01, 0x00, 0x58, 0xbb, 0x00, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x68, 0xbb, 0x00, 0x00, 0x54, 0xad, 0x01, 0x00, 0x78, 0xbb, 0x00, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0x88, 0xbb, 0x00, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x98, 0xbb, 0x00, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0xa8, 0xbb, 0x00, 0x00, 0xf8, 0xad, 0x01, 0x00, 0xb8, 0xbb, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0xbb, 0x00, 0x00, 0x26, 0xae, 0x01, 0x00, 0xd8, 0xbb, 0x00, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0xe8, 0xbb, 0x00, 0x00, 0x68, 0xab, 0x01, 0x00, 0xf8, 0xbb, 0x00, 0x00,
+  0x3f, 0xae, 0x01, 0x00, 0x08, 0xbc, 0x00, 0x00, 0x71, 0xae, 0x01, 0x00, 0x18, 0xbc, 0x00, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0x28, 0xbc, 0x00, 0x00, 0x96, 0xae, 0x01, 0x00, 0x38, 0xbc, 0x00, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0x48, 0xbc, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0xbc, 0x00, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0x68, 0xbc, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0xbc, 0x00, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0x88, 0xbc, 0x00, 0x00, 0xf0, 0xae, 0x01, 0x00, 0x98, 0xbc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0xbc, 0x00, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xb8, 0xbc, 0x00, 0x00,
+  0x10, 0xaf, 0x01, 0x00, 0xc8, 0xbc, 0x00, 0x00, 0x20, 0xaf, 0x01, 0x00, 0xd8, 0xbc, 0x00, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0xe8, 0xbc, 0x00, 0x00, 0x40, 0xaf, 0x01, 0x00, 0xf8, 0xbc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0xbd, 0x00, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0x18, 0xbd, 0x00, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x28, 0xbd, 0x00, 0x00, 0x87, 0xaf, 0x01, 0x00, 0x38, 0xbd, 0x00, 0x00,
+  0x92, 0xaf, 0x01, 0x00, 0x48, 0xbd, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0xbd, 0x00, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0x68, 0xbd, 0x00, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0x78, 0xbd, 0x00, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0x88, 0xbd, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0xbd, 0x00, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0xa8, 0xbd, 0x00, 0x00, 0xea, 0xaf, 0x01, 0x00, 0xb8, 0xbd, 0x00, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0xc8, 0xbd, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0xbd, 0x00, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0xe8, 0xbd, 0x00, 0x00, 0x25, 0xb0, 0x01, 0x00, 0xf8, 0xbd, 0x00, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x08, 0xbe, 0x00, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x18, 0xbe, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0xbe, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0xbe, 0x00, 0x00,
+  0xac, 0xab, 0x01, 0x00, 0x48, 0xbe, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0xbe, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0xbe, 0x00, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0x88, 0xbe, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0xbe, 0x00, 0x00, 0xce, 0xab, 0x01, 0x00, 0xa8, 0xbe, 0x00, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0xb8, 0xbe, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0xbe, 0x00, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0xd8, 0xbe, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0xbe, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0xf8, 0xbe, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x08, 0xbf, 0x00, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0x18, 0xbf, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0xbf, 0x00, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0x38, 0xbf, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0xbf, 0x00, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x58, 0xbf, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0xbf, 0x00, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x78, 0xbf, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0xbf, 0x00, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x98, 0xbf, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0xbf, 0x00, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0xb8, 0xbf, 0x00, 0x00, 0xfb, 0xac, 0x01, 0x00, 0xc8, 0xbf, 0x00, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0xd8, 0xbf, 0x00, 0x00, 0x54, 0xad, 0x01, 0x00, 0xe8, 0xbf, 0x00, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0xf8, 0xbf, 0x00, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x08, 0xc0, 0x00, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0x18, 0xc0, 0x00, 0x00, 0xf8, 0xad, 0x01, 0x00, 0x28, 0xc0, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0xc0, 0x00, 0x00, 0x68, 0xab, 0x01, 0x00, 0x48, 0xc0, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x58, 0xc0, 0x00, 0x00, 0xa4, 0xae, 0x01, 0x00, 0x68, 0xc0, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0xc0, 0x00, 0x00, 0xe0, 0xae, 0x01, 0x00, 0x88, 0xc0, 0x00, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0x98, 0xc0, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0xc0, 0x00, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0xb8, 0xc0, 0x00, 0x00, 0x20, 0xaf, 0x01, 0x00, 0xc8, 0xc0, 0x00, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0xd8, 0xc0, 0x00, 0x00, 0x40, 0xaf, 0x01, 0x00, 0xe8, 0xc0, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf8, 0xc0, 0x00, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0x08, 0xc1, 0x00, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x18, 0xc1, 0x00, 0x00, 0x87, 0xaf, 0x01, 0x00, 0x28, 0xc1, 0x00, 0x00,
+  0x92, 0xaf, 0x01, 0x00, 0x38, 0xc1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0xc1, 0x00, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0x58, 0xc1, 0x00, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0x68, 0xc1, 0x00, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0x78, 0xc1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0xc1, 0x00, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0x98, 0xc1, 0x00, 0x00, 0xea, 0xaf, 0x01, 0x00, 0xa8, 0xc1, 0x00, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0xb8, 0xc1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0xc1, 0x00, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0xd8, 0xc1, 0x00, 0x00, 0x25, 0xb0, 0x01, 0x00, 0xe8, 0xc1, 0x00, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0xf8, 0xc1, 0x00, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x08, 0xc2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x18, 0xc2, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0xc2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0xc2, 0x00, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0x58, 0xc2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0xc2, 0x00, 0x00, 0xce, 0xab, 0x01, 0x00, 0x78, 0xc2, 0x00, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0x88, 0xc2, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0xc2, 0x00, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0xa8, 0xc2, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0xc2, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0xc8, 0xc2, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0xc2, 0x00, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0xe8, 0xc2, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf8, 0xc2, 0x00, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0x08, 0xc3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0xc3, 0x00, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x28, 0xc3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0xc3, 0x00, 0x00,
+  0x79, 0xac, 0x01, 0x00, 0x48, 0xc3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0xc3, 0x00, 0x00,
+  0x93, 0xac, 0x01, 0x00, 0x68, 0xc3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0xc3, 0x00, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x88, 0xc3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0xc3, 0x00, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0xa8, 0xc3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0xc3, 0x00, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0xc8, 0xc3, 0x00, 0x00, 0xfb, 0xac, 0x01, 0x00, 0xd8, 0xc3, 0x00, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0xe8, 0xc3, 0x00, 0x00, 0x54, 0xad, 0x01, 0x00, 0xf8, 0xc3, 0x00, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0x08, 0xc4, 0x00, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x18, 0xc4, 0x00, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0x28, 0xc4, 0x00, 0x00, 0xf8, 0xad, 0x01, 0x00, 0x38, 0xc4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0xc4, 0x00, 0x00, 0x26, 0xae, 0x01, 0x00, 0x58, 0xc4, 0x00, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0x68, 0xc4, 0x00, 0x00, 0x68, 0xab, 0x01, 0x00, 0x78, 0xc4, 0x00, 0x00,
+  0x3f, 0xae, 0x01, 0x00, 0x88, 0xc4, 0x00, 0x00, 0x81, 0xab, 0x01, 0x00, 0x98, 0xc4, 0x00, 0x00,
+  0x96, 0xae, 0x01, 0x00, 0xa8, 0xc4, 0x00, 0x00, 0x9b, 0xae, 0x01, 0x00, 0xb8, 0xc4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0xc4, 0x00, 0x00, 0xa4, 0xae, 0x01, 0x00, 0xd8, 0xc4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0xc4, 0x00, 0x00, 0xe0, 0xae, 0x01, 0x00, 0xf8, 0xc4, 0x00, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0x08, 0xc5, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0xc5, 0x00, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0x28, 0xc5, 0x00, 0x00, 0x20, 0xaf, 0x01, 0x00, 0x38, 0xc5, 0x00, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x48, 0xc5, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0xc5, 0x00, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x68, 0xc5, 0x00, 0x00, 0x87, 0xaf, 0x01, 0x00, 0x78, 0xc5, 0x00, 0x00,
+  0x92, 0xaf, 0x01, 0x00, 0x88, 0xc5, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0xc5, 0x00, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0xa8, 0xc5, 0x00, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0xb8, 0xc5, 0x00, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0xc8, 0xc5, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0xc5, 0x00, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0xe8, 0xc5, 0x00, 0x00, 0xea, 0xaf, 0x01, 0x00, 0xf8, 0xc5, 0x00, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0x08, 0xc6, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0xc6, 0x00, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0x28, 0xc6, 0x00, 0x00, 0x25, 0xb0, 0x01, 0x00, 0x38, 0xc6, 0x00, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x48, 0xc6, 0x00, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x58, 0xc6, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0xc6, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0xc6, 0x00, 0x00,
+  0xac, 0xab, 0x01, 0x00, 0x88, 0xc6, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0xc6, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0xc6, 0x00, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xc8, 0xc6, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0xc6, 0x00, 0x00, 0xce, 0xab, 0x01, 0x00, 0xe8, 0xc6, 0x00, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0xf8, 0xc6, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x08, 0xc7, 0x00, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0x18, 0xc7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0xc7, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x38, 0xc7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0xc7, 0x00, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0x58, 0xc7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0xc7, 0x00, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0x78, 0xc7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0xc7, 0x00, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x98, 0xc7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0xc7, 0x00, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0xb8, 0xc7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0xc7, 0x00, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0xd8, 0xc7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0xc7, 0x00, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0xf8, 0xc7, 0x00, 0x00, 0xfb, 0xac, 0x01, 0x00, 0x08, 0xc8, 0x00, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x18, 0xc8, 0x00, 0x00, 0x54, 0xad, 0x01, 0x00, 0x28, 0xc8, 0x00, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0x38, 0xc8, 0x00, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x48, 0xc8, 0x00, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0x58, 0xc8, 0x00, 0x00, 0xf8, 0xad, 0x01, 0x00, 0x68, 0xc8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0xc8, 0x00, 0x00, 0x68, 0xab, 0x01, 0x00, 0x88, 0xc8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0xc8, 0x00, 0x00, 0xa4, 0xae, 0x01, 0x00, 0xa8, 0xc8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb8, 0xc8, 0x00, 0x00, 0xe0, 0xae, 0x01, 0x00, 0xc8, 0xc8, 0x00, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0xd8, 0xc8, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0xc8, 0x00, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0xf8, 0xc8, 0x00, 0x00, 0x20, 0xaf, 0x01, 0x00, 0x08, 0xc9, 0x00, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0x18, 0xc9, 0x00, 0x00, 0x40, 0xaf, 0x01, 0x00, 0x28, 0xc9, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0xc9, 0x00, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0x48, 0xc9, 0x00, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x58, 0xc9, 0x00, 0x00, 0x87, 0xaf, 0x01, 0x00, 0x68, 0xc9, 0x00, 0x00,
+  0x92, 0xaf, 0x01, 0x00, 0x78, 0xc9, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0xc9, 0x00, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0x98, 0xc9, 0x00, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0xa8, 0xc9, 0x00, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0xb8, 0xc9, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0xc9, 0x00, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0xd8, 0xc9, 0x00, 0x00, 0xea, 0xaf, 0x01, 0x00, 0xe8, 0xc9, 0x00, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0xf8, 0xc9, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x08, 0xca, 0x00, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0x18, 0xca, 0x00, 0x00, 0x25, 0xb0, 0x01, 0x00, 0x28, 0xca, 0x00, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x38, 0xca, 0x00, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x48, 0xca, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x58, 0xca, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0xca, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0xca, 0x00, 0x00, 0x1d, 0xab, 0x01, 0x00, 0xa4, 0xca, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc0, 0xca, 0x00, 0x00, 0x81, 0xab, 0x01, 0x00, 0xdc, 0xca, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf8, 0xca, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x14, 0xcb, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x30, 0xcb, 0x00, 0x00, 0x1d, 0xab, 0x01, 0x00, 0x68, 0xcb, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x84, 0xcb, 0x00, 0x00, 0xfb, 0xac, 0x01, 0x00, 0xa0, 0xcb, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xbc, 0xcb, 0x00, 0x00, 0x81, 0xab, 0x01, 0x00, 0xd8, 0xcb, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf4, 0xcb, 0x00, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x10, 0xcc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x2c, 0xcc, 0x00, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x48, 0xcc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x64, 0xcc, 0x00, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x80, 0xcc, 0x00, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x9c, 0xcc, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0xcc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd4, 0xcc, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf0, 0xcc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x0c, 0xcd, 0x00, 0x00, 0xfb, 0xac, 0x01, 0x00, 0x44, 0xcd, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x60, 0xcd, 0x00, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x7c, 0xcd, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0xcd, 0x00, 0x00, 0x36, 0xb0, 0x01, 0x00, 0xb4, 0xcd, 0x00, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0xd0, 0xcd, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xec, 0xcd, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0xce, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x24, 0xce, 0x00, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x5c, 0xce, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0xce, 0x00, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0x94, 0xce, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb0, 0xce, 0x00, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0xcc, 0xce, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0xce, 0x00, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x04, 0xcf, 0x00, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x20, 0xcf, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x3c, 0xcf, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0xcf, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x74, 0xcf, 0x00, 0x00, 0xfb, 0xac, 0x01, 0x00, 0xac, 0xcf, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0xcf, 0x00, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0xe4, 0xcf, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x1c, 0xd0, 0x00, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x38, 0xd0, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x54, 0xd0, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x70, 0xd0, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x8c, 0xd0, 0x00, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0xb8, 0xd0, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0xd0, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0xd0, 0x00, 0x00, 0x81, 0xab, 0x01, 0x00, 0xf8, 0xd0, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0xd1, 0x00, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x18, 0xd1, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0xd1, 0x00, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x38, 0xd1, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0xd1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0xd1, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0xd1, 0x00, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x88, 0xd1, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0xd1, 0x00, 0x00, 0xda, 0xaf, 0x01, 0x00, 0xa8, 0xd1, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb8, 0xd1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0xd1, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0xd1, 0x00, 0x00, 0x81, 0xab, 0x01, 0x00, 0xf8, 0xd1, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0xd2, 0x00, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x18, 0xd2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0xd2, 0x00, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x38, 0xd2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0xd2, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0xd2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0xd2, 0x00, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x88, 0xd2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0xd2, 0x00, 0x00, 0xda, 0xaf, 0x01, 0x00, 0xa8, 0xd2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb8, 0xd2, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0xd2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0xd2, 0x00, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xf8, 0xd2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0xd3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0xd3, 0x00, 0x00,
+  0x1d, 0xab, 0x01, 0x00, 0x28, 0xd3, 0x00, 0x00, 0x27, 0xab, 0x01, 0x00, 0x38, 0xd3, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0xd3, 0x00, 0x00, 0x35, 0xab, 0x01, 0x00, 0x58, 0xd3, 0x00, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x68, 0xd3, 0x00, 0x00, 0x81, 0xab, 0x01, 0x00, 0x78, 0xd3, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0xd3, 0x00, 0x00, 0xac, 0xab, 0x01, 0x00, 0x98, 0xd3, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0xd3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0xd3, 0x00, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0xd8, 0xd3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0xd3, 0x00, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0xf8, 0xd3, 0x00, 0x00, 0xe3, 0xab, 0x01, 0x00, 0x08, 0xd4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x18, 0xd4, 0x00, 0x00, 0x0b, 0xac, 0x01, 0x00, 0x28, 0xd4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0xd4, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x48, 0xd4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x58, 0xd4, 0x00, 0x00, 0x2b, 0xac, 0x01, 0x00, 0x68, 0xd4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0xd4, 0x00, 0x00, 0x47, 0xac, 0x01, 0x00, 0x88, 0xd4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0xd4, 0x00, 0x00, 0x61, 0xac, 0x01, 0x00, 0xa8, 0xd4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb8, 0xd4, 0x00, 0x00, 0x79, 0xac, 0x01, 0x00, 0xc8, 0xd4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0xd4, 0x00, 0x00, 0x93, 0xac, 0x01, 0x00, 0xe8, 0xd4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf8, 0xd4, 0x00, 0x00, 0xb1, 0xac, 0x01, 0x00, 0x08, 0xd5, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x18, 0xd5, 0x00, 0x00, 0x1d, 0xab, 0x01, 0x00, 0x28, 0xd5, 0x00, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x38, 0xd5, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0xd5, 0x00, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0x58, 0xd5, 0x00, 0x00, 0xfb, 0xac, 0x01, 0x00, 0x68, 0xd5, 0x00, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x78, 0xd5, 0x00, 0x00, 0x54, 0xad, 0x01, 0x00, 0x88, 0xd5, 0x00, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0x98, 0xd5, 0x00, 0x00, 0xa6, 0xad, 0x01, 0x00, 0xa8, 0xd5, 0x00, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0xb8, 0xd5, 0x00, 0x00, 0xf8, 0xad, 0x01, 0x00, 0xc8, 0xd5, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0xd5, 0x00, 0x00, 0x26, 0xae, 0x01, 0x00, 0xe8, 0xd5, 0x00, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0xf8, 0xd5, 0x00, 0x00, 0x68, 0xab, 0x01, 0x00, 0x08, 0xd6, 0x00, 0x00,
+  0x3f, 0xae, 0x01, 0x00, 0x18, 0xd6, 0x00, 0x00, 0x71, 0xae, 0x01, 0x00, 0x28, 0xd6, 0x00, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0x38, 0xd6, 0x00, 0x00, 0x96, 0xae, 0x01, 0x00, 0x48, 0xd6, 0x00, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0x58, 0xd6, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0xd6, 0x00, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0x78, 0xd6, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0xd6, 0x00, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0x98, 0xd6, 0x00, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xa8, 0xd6, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb8, 0xd6, 0x00, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xc8, 0xd6, 0x00, 0x00,
+  0x10, 0xaf, 0x01, 0x00, 0xd8, 0xd6, 0x00, 0x00, 0x20, 0xaf, 0x01, 0x00, 0xe8, 0xd6, 0x00, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0xf8, 0xd6, 0x00, 0x00, 0x40, 0xaf, 0x01, 0x00, 0x08, 0xd7, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x18, 0xd7, 0x00, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0x28, 0xd7, 0x00, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x38, 0xd7, 0x00, 0x00, 0x87, 0xaf, 0x01, 0x00, 0x48, 0xd7, 0x00, 0x00,
+  0x92, 0xaf, 0x01, 0x00, 0x58, 0xd7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0xd7, 0x00, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0x78, 0xd7, 0x00, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0x88, 0xd7, 0x00, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0x98, 0xd7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0xd7, 0x00, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0xb8, 0xd7, 0x00, 0x00, 0xea, 0xaf, 0x01, 0x00, 0xc8, 0xd7, 0x00, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0xd8, 0xd7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0xd7, 0x00, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0xf8, 0xd7, 0x00, 0x00, 0x25, 0xb0, 0x01, 0x00, 0x08, 0xd8, 0x00, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x18, 0xd8, 0x00, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x28, 0xd8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0xd8, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0xd8, 0x00, 0x00,
+  0xac, 0xab, 0x01, 0x00, 0x58, 0xd8, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0xd8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0xd8, 0x00, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0x98, 0xd8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0xd8, 0x00, 0x00, 0xce, 0xab, 0x01, 0x00, 0xb8, 0xd8, 0x00, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0xc8, 0xd8, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0xd8, 0x00, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0xe8, 0xd8, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf8, 0xd8, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x08, 0xd9, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0xd9, 0x00, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0x28, 0xd9, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0xd9, 0x00, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0x48, 0xd9, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0xd9, 0x00, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x68, 0xd9, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0xd9, 0x00, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x88, 0xd9, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0xd9, 0x00, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0xa8, 0xd9, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0xd9, 0x00, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0xc8, 0xd9, 0x00, 0x00, 0xfb, 0xac, 0x01, 0x00, 0xd8, 0xd9, 0x00, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0xe8, 0xd9, 0x00, 0x00, 0x54, 0xad, 0x01, 0x00, 0xf8, 0xd9, 0x00, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0x08, 0xda, 0x00, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x18, 0xda, 0x00, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0x28, 0xda, 0x00, 0x00, 0xf8, 0xad, 0x01, 0x00, 0x38, 0xda, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0xda, 0x00, 0x00, 0x68, 0xab, 0x01, 0x00, 0x58, 0xda, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0xda, 0x00, 0x00, 0xa4, 0xae, 0x01, 0x00, 0x78, 0xda, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0xda, 0x00, 0x00, 0xe0, 0xae, 0x01, 0x00, 0x98, 0xda, 0x00, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0xa8, 0xda, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0xda, 0x00, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0xc8, 0xda, 0x00, 0x00, 0x20, 0xaf, 0x01, 0x00, 0xd8, 0xda, 0x00, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0xe8, 0xda, 0x00, 0x00, 0x40, 0xaf, 0x01, 0x00, 0xf8, 0xda, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0xdb, 0x00, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0x18, 0xdb, 0x00, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x28, 0xdb, 0x00, 0x00, 0x87, 0xaf, 0x01, 0x00, 0x38, 0xdb, 0x00, 0x00,
+  0x92, 0xaf, 0x01, 0x00, 0x48, 0xdb, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0xdb, 0x00, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0x68, 0xdb, 0x00, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0x78, 0xdb, 0x00, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0x88, 0xdb, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0xdb, 0x00, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0xa8, 0xdb, 0x00, 0x00, 0xea, 0xaf, 0x01, 0x00, 0xb8, 0xdb, 0x00, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0xc8, 0xdb, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0xdb, 0x00, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0xe8, 0xdb, 0x00, 0x00, 0x25, 0xb0, 0x01, 0x00, 0xf8, 0xdb, 0x00, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x08, 0xdc, 0x00, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x18, 0xdc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0xdc, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0xdc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0xdc, 0x00, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0x68, 0xdc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0xdc, 0x00, 0x00, 0xce, 0xab, 0x01, 0x00, 0x88, 0xdc, 0x00, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0x98, 0xdc, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0xdc, 0x00, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0xb8, 0xdc, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0xdc, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0xd8, 0xdc, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0xdc, 0x00, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0xf8, 0xdc, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x08, 0xdd, 0x00, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0x18, 0xdd, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0xdd, 0x00, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x38, 0xdd, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0xdd, 0x00, 0x00,
+  0x79, 0xac, 0x01, 0x00, 0x58, 0xdd, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0xdd, 0x00, 0x00,
+  0x93, 0xac, 0x01, 0x00, 0x78, 0xdd, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0xdd, 0x00, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x98, 0xdd, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0xdd, 0x00, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0xb8, 0xdd, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0xdd, 0x00, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0xd8, 0xdd, 0x00, 0x00, 0xfb, 0xac, 0x01, 0x00, 0xe8, 0xdd, 0x00, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0xf8, 0xdd, 0x00, 0x00, 0x54, 0xad, 0x01, 0x00, 0x08, 0xde, 0x00, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0x18, 0xde, 0x00, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x28, 0xde, 0x00, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0x38, 0xde, 0x00, 0x00, 0xf8, 0xad, 0x01, 0x00, 0x48, 0xde, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x58, 0xde, 0x00, 0x00, 0x26, 0xae, 0x01, 0x00, 0x68, 0xde, 0x00, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0x78, 0xde, 0x00, 0x00, 0x68, 0xab, 0x01, 0x00, 0x88, 0xde, 0x00, 0x00,
+  0x3f, 0xae, 0x01, 0x00, 0x98, 0xde, 0x00, 0x00, 0x81, 0xab, 0x01, 0x00, 0xa8, 0xde, 0x00, 0x00,
+  0x96, 0xae, 0x01, 0x00, 0xb8, 0xde, 0x00, 0x00, 0x9b, 0xae, 0x01, 0x00, 0xc8, 0xde, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0xde, 0x00, 0x00, 0xa4, 0xae, 0x01, 0x00, 0xe8, 0xde, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf8, 0xde, 0x00, 0x00, 0xe0, 0xae, 0x01, 0x00, 0x08, 0xdf, 0x00, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0x18, 0xdf, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0xdf, 0x00, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0x38, 0xdf, 0x00, 0x00, 0x20, 0xaf, 0x01, 0x00, 0x48, 0xdf, 0x00, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0x58, 0xdf, 0x00, 0x00, 0x40, 0xaf, 0x01, 0x00, 0x68, 0xdf, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0xdf, 0x00, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0x88, 0xdf, 0x00, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x98, 0xdf, 0x00, 0x00, 0x87, 0xaf, 0x01, 0x00, 0xa8, 0xdf, 0x00, 0x00,
+  0x92, 0xaf, 0x01, 0x00, 0xb8, 0xdf, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0xdf, 0x00, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0xd8, 0xdf, 0x00, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0xe8, 0xdf, 0x00, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0xf8, 0xdf, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x08, 0xe0, 0x00, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0x18, 0xe0, 0x00, 0x00, 0xea, 0xaf, 0x01, 0x00, 0x28, 0xe0, 0x00, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0x38, 0xe0, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0xe0, 0x00, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0x58, 0xe0, 0x00, 0x00, 0x25, 0xb0, 0x01, 0x00, 0x68, 0xe0, 0x00, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x78, 0xe0, 0x00, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x88, 0xe0, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0xe0, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0xe0, 0x00, 0x00,
+  0xac, 0xab, 0x01, 0x00, 0xb8, 0xe0, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0xe0, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0xe0, 0x00, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xf8, 0xe0, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0xe1, 0x00, 0x00, 0xce, 0xab, 0x01, 0x00, 0x18, 0xe1, 0x00, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0x28, 0xe1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0xe1, 0x00, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0x48, 0xe1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0xe1, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x68, 0xe1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0xe1, 0x00, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0x88, 0xe1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0xe1, 0x00, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0xa8, 0xe1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0xe1, 0x00, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0xc8, 0xe1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0xe1, 0x00, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0xe8, 0xe1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf8, 0xe1, 0x00, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x08, 0xe2, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0xe2, 0x00, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0x28, 0xe2, 0x00, 0x00, 0xfb, 0xac, 0x01, 0x00, 0x38, 0xe2, 0x00, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x48, 0xe2, 0x00, 0x00, 0x54, 0xad, 0x01, 0x00, 0x58, 0xe2, 0x00, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0x68, 0xe2, 0x00, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x78, 0xe2, 0x00, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0x88, 0xe2, 0x00, 0x00, 0xf8, 0xad, 0x01, 0x00, 0x98, 0xe2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0xe2, 0x00, 0x00, 0x68, 0xab, 0x01, 0x00, 0xb8, 0xe2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0xe2, 0x00, 0x00, 0xa4, 0xae, 0x01, 0x00, 0xd8, 0xe2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0xe2, 0x00, 0x00, 0xe0, 0xae, 0x01, 0x00, 0xf8, 0xe2, 0x00, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0x08, 0xe3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0xe3, 0x00, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0x28, 0xe3, 0x00, 0x00, 0x20, 0xaf, 0x01, 0x00, 0x38, 0xe3, 0x00, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0x48, 0xe3, 0x00, 0x00, 0x40, 0xaf, 0x01, 0x00, 0x58, 0xe3, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0xe3, 0x00, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0x78, 0xe3, 0x00, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x88, 0xe3, 0x00, 0x00, 0x87, 0xaf, 0x01, 0x00, 0x98, 0xe3, 0x00, 0x00,
+  0x92, 0xaf, 0x01, 0x00, 0xa8, 0xe3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0xe3, 0x00, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0xc8, 0xe3, 0x00, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0xd8, 0xe3, 0x00, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0xe8, 0xe3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf8, 0xe3, 0x00, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0x08, 0xe4, 0x00, 0x00, 0xea, 0xaf, 0x01, 0x00, 0x18, 0xe4, 0x00, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0x28, 0xe4, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0xe4, 0x00, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0x48, 0xe4, 0x00, 0x00, 0x25, 0xb0, 0x01, 0x00, 0x58, 0xe4, 0x00, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x68, 0xe4, 0x00, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x78, 0xe4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0xe4, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0xe4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0xe4, 0x00, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xc4, 0xe4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd0, 0xe4, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xdc, 0xe4, 0x00, 0x00,
+  0x1d, 0xab, 0x01, 0x00, 0xe8, 0xe4, 0x00, 0x00, 0x27, 0xab, 0x01, 0x00, 0xf4, 0xe4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x35, 0xab, 0x01, 0x00, 0x0c, 0xe5, 0x00, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x18, 0xe5, 0x00, 0x00, 0x81, 0xab, 0x01, 0x00, 0x24, 0xe5, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x30, 0xe5, 0x00, 0x00, 0xac, 0xab, 0x01, 0x00, 0x3c, 0xe5, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0xe5, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x54, 0xe5, 0x00, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x6c, 0xe5, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0xe5, 0x00, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0x84, 0xe5, 0x00, 0x00, 0xe3, 0xab, 0x01, 0x00, 0x90, 0xe5, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x9c, 0xe5, 0x00, 0x00, 0x0b, 0xac, 0x01, 0x00, 0xa8, 0xe5, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb4, 0xe5, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0xc0, 0xe5, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xcc, 0xe5, 0x00, 0x00, 0x2b, 0xac, 0x01, 0x00, 0xd8, 0xe5, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe4, 0xe5, 0x00, 0x00, 0x47, 0xac, 0x01, 0x00, 0xf0, 0xe5, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xfc, 0xe5, 0x00, 0x00, 0x61, 0xac, 0x01, 0x00, 0x08, 0xe6, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x14, 0xe6, 0x00, 0x00, 0x79, 0xac, 0x01, 0x00, 0x20, 0xe6, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x2c, 0xe6, 0x00, 0x00, 0x93, 0xac, 0x01, 0x00, 0x38, 0xe6, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x44, 0xe6, 0x00, 0x00, 0xb1, 0xac, 0x01, 0x00, 0x50, 0xe6, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x5c, 0xe6, 0x00, 0x00, 0x1d, 0xab, 0x01, 0x00, 0x68, 0xe6, 0x00, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x74, 0xe6, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x80, 0xe6, 0x00, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0x8c, 0xe6, 0x00, 0x00, 0xfb, 0xac, 0x01, 0x00, 0x98, 0xe6, 0x00, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0xa4, 0xe6, 0x00, 0x00, 0x54, 0xad, 0x01, 0x00, 0xb0, 0xe6, 0x00, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0xbc, 0xe6, 0x00, 0x00, 0xa6, 0xad, 0x01, 0x00, 0xc8, 0xe6, 0x00, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0xd4, 0xe6, 0x00, 0x00, 0xf8, 0xad, 0x01, 0x00, 0xe0, 0xe6, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xec, 0xe6, 0x00, 0x00, 0x26, 0xae, 0x01, 0x00, 0xf8, 0xe6, 0x00, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0x04, 0xe7, 0x00, 0x00, 0x68, 0xab, 0x01, 0x00, 0x10, 0xe7, 0x00, 0x00,
+  0x3f, 0xae, 0x01, 0x00, 0x1c, 0xe7, 0x00, 0x00, 0x71, 0xae, 0x01, 0x00, 0x28, 0xe7, 0x00, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0x34, 0xe7, 0x00, 0x00, 0x96, 0xae, 0x01, 0x00, 0x40, 0xe7, 0x00, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0x4c, 0xe7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0xe7, 0x00, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0x64, 0xe7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x70, 0xe7, 0x00, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0x7c, 0xe7, 0x00, 0x00, 0xf0, 0xae, 0x01, 0x00, 0x88, 0xe7, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x94, 0xe7, 0x00, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xa0, 0xe7, 0x00, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0xac, 0xe7, 0x00, 0x00, 0x30, 0xaf, 0x01, 0x00, 0xb8, 0xe7, 0x00, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0xc4, 0xe7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd0, 0xe7, 0x00, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0xdc, 0xe7, 0x00, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0xe8, 0xe7, 0x00, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0xf4, 0xe7, 0x00, 0x00, 0x92, 0xaf, 0x01, 0x00, 0x00, 0xe8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x0c, 0xe8, 0x00, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x18, 0xe8, 0x00, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0x24, 0xe8, 0x00, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x30, 0xe8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x3c, 0xe8, 0x00, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x48, 0xe8, 0x00, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0x54, 0xe8, 0x00, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0x60, 0xe8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x6c, 0xe8, 0x00, 0x00, 0x14, 0xb0, 0x01, 0x00, 0x78, 0xe8, 0x00, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0x84, 0xe8, 0x00, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x90, 0xe8, 0x00, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x9c, 0xe8, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0xe8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb4, 0xe8, 0x00, 0x00, 0xac, 0xab, 0x01, 0x00, 0xc0, 0xe8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xcc, 0xe8, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0xe8, 0x00, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0xf0, 0xe8, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xfc, 0xe8, 0x00, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0x08, 0xe9, 0x00, 0x00, 0xe3, 0xab, 0x01, 0x00, 0x14, 0xe9, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x20, 0xe9, 0x00, 0x00, 0x0b, 0xac, 0x01, 0x00, 0x2c, 0xe9, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0xe9, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x44, 0xe9, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x50, 0xe9, 0x00, 0x00, 0x2b, 0xac, 0x01, 0x00, 0x5c, 0xe9, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0xe9, 0x00, 0x00, 0x47, 0xac, 0x01, 0x00, 0x74, 0xe9, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x80, 0xe9, 0x00, 0x00, 0x61, 0xac, 0x01, 0x00, 0x8c, 0xe9, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0xe9, 0x00, 0x00, 0xb1, 0xac, 0x01, 0x00, 0xa4, 0xe9, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb0, 0xe9, 0x00, 0x00, 0x27, 0xab, 0x01, 0x00, 0xbc, 0xe9, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0xe9, 0x00, 0x00, 0xd3, 0xac, 0x01, 0x00, 0xd4, 0xe9, 0x00, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0xe0, 0xe9, 0x00, 0x00, 0x24, 0xad, 0x01, 0x00, 0xec, 0xe9, 0x00, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0xf8, 0xe9, 0x00, 0x00, 0x7e, 0xad, 0x01, 0x00, 0x04, 0xea, 0x00, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x10, 0xea, 0x00, 0x00, 0xcf, 0xad, 0x01, 0x00, 0x1c, 0xea, 0x00, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x28, 0xea, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x34, 0xea, 0x00, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x40, 0xea, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4c, 0xea, 0x00, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0x58, 0xea, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x64, 0xea, 0x00, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0x70, 0xea, 0x00, 0x00, 0xf0, 0xae, 0x01, 0x00, 0x7c, 0xea, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0xea, 0x00, 0x00, 0x06, 0xaf, 0x01, 0x00, 0x94, 0xea, 0x00, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0xa0, 0xea, 0x00, 0x00, 0x30, 0xaf, 0x01, 0x00, 0xac, 0xea, 0x00, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0xb8, 0xea, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc4, 0xea, 0x00, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0xd0, 0xea, 0x00, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0xdc, 0xea, 0x00, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0xe8, 0xea, 0x00, 0x00, 0x92, 0xaf, 0x01, 0x00, 0xf4, 0xea, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x0c, 0xeb, 0x00, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0x18, 0xeb, 0x00, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x24, 0xeb, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x30, 0xeb, 0x00, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x3c, 0xeb, 0x00, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0x48, 0xeb, 0x00, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0x54, 0xeb, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x60, 0xeb, 0x00, 0x00, 0x14, 0xb0, 0x01, 0x00, 0x6c, 0xeb, 0x00, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0x78, 0xeb, 0x00, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x84, 0xeb, 0x00, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x90, 0xeb, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x9c, 0xeb, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0xeb, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb4, 0xeb, 0x00, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0xcc, 0xeb, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0xeb, 0x00, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0xe4, 0xeb, 0x00, 0x00, 0xe3, 0xab, 0x01, 0x00, 0xf0, 0xeb, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xfc, 0xeb, 0x00, 0x00, 0x0b, 0xac, 0x01, 0x00, 0x08, 0xec, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x14, 0xec, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x20, 0xec, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x2c, 0xec, 0x00, 0x00, 0x2b, 0xac, 0x01, 0x00, 0x38, 0xec, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x44, 0xec, 0x00, 0x00, 0x47, 0xac, 0x01, 0x00, 0x50, 0xec, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x5c, 0xec, 0x00, 0x00, 0x61, 0xac, 0x01, 0x00, 0x68, 0xec, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x74, 0xec, 0x00, 0x00, 0x79, 0xac, 0x01, 0x00, 0x80, 0xec, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x8c, 0xec, 0x00, 0x00, 0x93, 0xac, 0x01, 0x00, 0x98, 0xec, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa4, 0xec, 0x00, 0x00, 0xb1, 0xac, 0x01, 0x00, 0xb0, 0xec, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xbc, 0xec, 0x00, 0x00, 0x27, 0xab, 0x01, 0x00, 0xc8, 0xec, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd4, 0xec, 0x00, 0x00, 0xd3, 0xac, 0x01, 0x00, 0xe0, 0xec, 0x00, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0xec, 0xec, 0x00, 0x00, 0x24, 0xad, 0x01, 0x00, 0xf8, 0xec, 0x00, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x04, 0xed, 0x00, 0x00, 0x7e, 0xad, 0x01, 0x00, 0x10, 0xed, 0x00, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x1c, 0xed, 0x00, 0x00, 0xcf, 0xad, 0x01, 0x00, 0x28, 0xed, 0x00, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x34, 0xed, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x40, 0xed, 0x00, 0x00,
+  0x26, 0xae, 0x01, 0x00, 0x4c, 0xed, 0x00, 0x00, 0x35, 0xab, 0x01, 0x00, 0x58, 0xed, 0x00, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x64, 0xed, 0x00, 0x00, 0x3f, 0xae, 0x01, 0x00, 0x70, 0xed, 0x00, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0x7c, 0xed, 0x00, 0x00, 0x96, 0xae, 0x01, 0x00, 0x88, 0xed, 0x00, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0x94, 0xed, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa0, 0xed, 0x00, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0xac, 0xed, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0xed, 0x00, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0xc4, 0xed, 0x00, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xd0, 0xed, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xdc, 0xed, 0x00, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xe8, 0xed, 0x00, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0xf4, 0xed, 0x00, 0x00, 0x30, 0xaf, 0x01, 0x00, 0x00, 0xee, 0x00, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x0c, 0xee, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0xee, 0x00, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0x24, 0xee, 0x00, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x30, 0xee, 0x00, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0x3c, 0xee, 0x00, 0x00, 0x92, 0xaf, 0x01, 0x00, 0x48, 0xee, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x54, 0xee, 0x00, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x60, 0xee, 0x00, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0x6c, 0xee, 0x00, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x78, 0xee, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x84, 0xee, 0x00, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x90, 0xee, 0x00, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0x9c, 0xee, 0x00, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0xa8, 0xee, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb4, 0xee, 0x00, 0x00, 0x14, 0xb0, 0x01, 0x00, 0xc0, 0xee, 0x00, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0xcc, 0xee, 0x00, 0x00, 0x36, 0xb0, 0x01, 0x00, 0xd8, 0xee, 0x00, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0xe4, 0xee, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf0, 0xee, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xfc, 0xee, 0x00, 0x00, 0xac, 0xab, 0x01, 0x00, 0x08, 0xef, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x14, 0xef, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x20, 0xef, 0x00, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x38, 0xef, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x44, 0xef, 0x00, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0x50, 0xef, 0x00, 0x00, 0xe3, 0xab, 0x01, 0x00, 0x5c, 0xef, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0xef, 0x00, 0x00, 0x0b, 0xac, 0x01, 0x00, 0x74, 0xef, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x80, 0xef, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x8c, 0xef, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0xef, 0x00, 0x00, 0x2b, 0xac, 0x01, 0x00, 0xa4, 0xef, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb0, 0xef, 0x00, 0x00, 0x47, 0xac, 0x01, 0x00, 0xbc, 0xef, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0xef, 0x00, 0x00, 0x61, 0xac, 0x01, 0x00, 0xd4, 0xef, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe0, 0xef, 0x00, 0x00, 0xb1, 0xac, 0x01, 0x00, 0xec, 0xef, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf8, 0xef, 0x00, 0x00, 0x27, 0xab, 0x01, 0x00, 0x04, 0xf0, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x10, 0xf0, 0x00, 0x00, 0xd3, 0xac, 0x01, 0x00, 0x1c, 0xf0, 0x00, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x28, 0xf0, 0x00, 0x00, 0x24, 0xad, 0x01, 0x00, 0x34, 0xf0, 0x00, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x40, 0xf0, 0x00, 0x00, 0x7e, 0xad, 0x01, 0x00, 0x4c, 0xf0, 0x00, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x58, 0xf0, 0x00, 0x00, 0xcf, 0xad, 0x01, 0x00, 0x64, 0xf0, 0x00, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x70, 0xf0, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x7c, 0xf0, 0x00, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x88, 0xf0, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x94, 0xf0, 0x00, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0xa0, 0xf0, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xac, 0xf0, 0x00, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0xb8, 0xf0, 0x00, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xc4, 0xf0, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd0, 0xf0, 0x00, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xdc, 0xf0, 0x00, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0xe8, 0xf0, 0x00, 0x00, 0x30, 0xaf, 0x01, 0x00, 0xf4, 0xf0, 0x00, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x0c, 0xf1, 0x00, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0x18, 0xf1, 0x00, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x24, 0xf1, 0x00, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0x30, 0xf1, 0x00, 0x00, 0x92, 0xaf, 0x01, 0x00, 0x3c, 0xf1, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0xf1, 0x00, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x54, 0xf1, 0x00, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0x60, 0xf1, 0x00, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x6c, 0xf1, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0xf1, 0x00, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x84, 0xf1, 0x00, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0x90, 0xf1, 0x00, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0x9c, 0xf1, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0xf1, 0x00, 0x00, 0x14, 0xb0, 0x01, 0x00, 0xb4, 0xf1, 0x00, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0xc0, 0xf1, 0x00, 0x00, 0x36, 0xb0, 0x01, 0x00, 0xcc, 0xf1, 0x00, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0xd8, 0xf1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe4, 0xf1, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf0, 0xf1, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xfc, 0xf1, 0x00, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x18, 0xf2, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0xf2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0xf2, 0x00, 0x00, 0x1d, 0xab, 0x01, 0x00, 0x48, 0xf2, 0x00, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x58, 0xf2, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0xf2, 0x00, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0x78, 0xf2, 0x00, 0x00, 0x68, 0xab, 0x01, 0x00, 0x88, 0xf2, 0x00, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0x98, 0xf2, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0xf2, 0x00, 0x00,
+  0xac, 0xab, 0x01, 0x00, 0xb8, 0xf2, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0xf2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0xf2, 0x00, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xf8, 0xf2, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0xf3, 0x00, 0x00, 0xce, 0xab, 0x01, 0x00, 0x18, 0xf3, 0x00, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0x28, 0xf3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0xf3, 0x00, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0x48, 0xf3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0xf3, 0x00, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x68, 0xf3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0xf3, 0x00, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0x88, 0xf3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0xf3, 0x00, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0xa8, 0xf3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0xf3, 0x00, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0xc8, 0xf3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0xf3, 0x00, 0x00,
+  0x79, 0xac, 0x01, 0x00, 0xe8, 0xf3, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf8, 0xf3, 0x00, 0x00,
+  0x93, 0xac, 0x01, 0x00, 0x08, 0xf4, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0xf4, 0x00, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x28, 0xf4, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0xf4, 0x00, 0x00,
+  0x1d, 0xab, 0x01, 0x00, 0x48, 0xf4, 0x00, 0x00, 0x27, 0xab, 0x01, 0x00, 0x58, 0xf4, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0xf4, 0x00, 0x00, 0xd3, 0xac, 0x01, 0x00, 0x78, 0xf4, 0x00, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x88, 0xf4, 0x00, 0x00, 0x24, 0xad, 0x01, 0x00, 0x98, 0xf4, 0x00, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0xa8, 0xf4, 0x00, 0x00, 0x7e, 0xad, 0x01, 0x00, 0xb8, 0xf4, 0x00, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0xc8, 0xf4, 0x00, 0x00, 0xcf, 0xad, 0x01, 0x00, 0xd8, 0xf4, 0x00, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0xe8, 0xf4, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf8, 0xf4, 0x00, 0x00,
+  0x26, 0xae, 0x01, 0x00, 0x08, 0xf5, 0x00, 0x00, 0x35, 0xab, 0x01, 0x00, 0x18, 0xf5, 0x00, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x28, 0xf5, 0x00, 0x00, 0x3f, 0xae, 0x01, 0x00, 0x38, 0xf5, 0x00, 0x00,
+  0x71, 0xae, 0x01, 0x00, 0x48, 0xf5, 0x00, 0x00, 0x81, 0xab, 0x01, 0x00, 0x58, 0xf5, 0x00, 0x00,
+  0x96, 0xae, 0x01, 0x00, 0x68, 0xf5, 0x00, 0x00, 0x9b, 0xae, 0x01, 0x00, 0x78, 0xf5, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0xf5, 0x00, 0x00, 0xa4, 0xae, 0x01, 0x00, 0x98, 0xf5, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0xf5, 0x00, 0x00, 0xe0, 0xae, 0x01, 0x00, 0xb8, 0xf5, 0x00, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0xc8, 0xf5, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0xf5, 0x00, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0xe8, 0xf5, 0x00, 0x00, 0x10, 0xaf, 0x01, 0x00, 0xf8, 0xf5, 0x00, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0x08, 0xf6, 0x00, 0x00, 0x30, 0xaf, 0x01, 0x00, 0x18, 0xf6, 0x00, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x28, 0xf6, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0xf6, 0x00, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0x48, 0xf6, 0x00, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x58, 0xf6, 0x00, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0x68, 0xf6, 0x00, 0x00, 0x92, 0xaf, 0x01, 0x00, 0x78, 0xf6, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0xf6, 0x00, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x98, 0xf6, 0x00, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0xa8, 0xf6, 0x00, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0xb8, 0xf6, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0xf6, 0x00, 0x00, 0xda, 0xaf, 0x01, 0x00, 0xd8, 0xf6, 0x00, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0xe8, 0xf6, 0x00, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0xf8, 0xf6, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0xf7, 0x00, 0x00, 0x14, 0xb0, 0x01, 0x00, 0x18, 0xf7, 0x00, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0x28, 0xf7, 0x00, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x38, 0xf7, 0x00, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x48, 0xf7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0xf7, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0xf7, 0x00, 0x00, 0xac, 0xab, 0x01, 0x00, 0x78, 0xf7, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0xf7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0xf7, 0x00, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0xb8, 0xf7, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0xf7, 0x00, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0xd8, 0xf7, 0x00, 0x00, 0xe3, 0xab, 0x01, 0x00, 0xe8, 0xf7, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf8, 0xf7, 0x00, 0x00, 0x0b, 0xac, 0x01, 0x00, 0x08, 0xf8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x18, 0xf8, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0x28, 0xf8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0xf8, 0x00, 0x00, 0x2b, 0xac, 0x01, 0x00, 0x48, 0xf8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x58, 0xf8, 0x00, 0x00, 0x47, 0xac, 0x01, 0x00, 0x68, 0xf8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0xf8, 0x00, 0x00, 0x61, 0xac, 0x01, 0x00, 0x88, 0xf8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0xf8, 0x00, 0x00, 0xb1, 0xac, 0x01, 0x00, 0xa8, 0xf8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb8, 0xf8, 0x00, 0x00, 0x27, 0xab, 0x01, 0x00, 0xc8, 0xf8, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0xf8, 0x00, 0x00, 0xd3, 0xac, 0x01, 0x00, 0xe8, 0xf8, 0x00, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0x24, 0xad, 0x01, 0x00, 0x08, 0xf9, 0x00, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x18, 0xf9, 0x00, 0x00, 0x7e, 0xad, 0x01, 0x00, 0x28, 0xf9, 0x00, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x38, 0xf9, 0x00, 0x00, 0xcf, 0xad, 0x01, 0x00, 0x48, 0xf9, 0x00, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x58, 0xf9, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0xf9, 0x00, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x78, 0xf9, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0xf9, 0x00, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0x98, 0xf9, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0xf9, 0x00, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0xb8, 0xf9, 0x00, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xc8, 0xf9, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0xf9, 0x00, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xe8, 0xf9, 0x00, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0xf8, 0xf9, 0x00, 0x00, 0x30, 0xaf, 0x01, 0x00, 0x08, 0xfa, 0x00, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0xfa, 0x00, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0x38, 0xfa, 0x00, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x48, 0xfa, 0x00, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0x58, 0xfa, 0x00, 0x00, 0x92, 0xaf, 0x01, 0x00, 0x68, 0xfa, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0xfa, 0x00, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x88, 0xfa, 0x00, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0x98, 0xfa, 0x00, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0xa8, 0xfa, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb8, 0xfa, 0x00, 0x00, 0xda, 0xaf, 0x01, 0x00, 0xc8, 0xfa, 0x00, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0xd8, 0xfa, 0x00, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0xe8, 0xfa, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf8, 0xfa, 0x00, 0x00, 0x14, 0xb0, 0x01, 0x00, 0x08, 0xfb, 0x00, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0x18, 0xfb, 0x00, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x28, 0xfb, 0x00, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x38, 0xfb, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0xfb, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x58, 0xfb, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0xfb, 0x00, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x88, 0xfb, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0xfb, 0x00, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0xa8, 0xfb, 0x00, 0x00, 0xe3, 0xab, 0x01, 0x00, 0xb8, 0xfb, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0xfb, 0x00, 0x00, 0x0b, 0xac, 0x01, 0x00, 0xd8, 0xfb, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0xfb, 0x00, 0x00, 0x25, 0xac, 0x01, 0x00, 0xf8, 0xfb, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0xfc, 0x00, 0x00, 0x2b, 0xac, 0x01, 0x00, 0x18, 0xfc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0xfc, 0x00, 0x00, 0x47, 0xac, 0x01, 0x00, 0x38, 0xfc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0xfc, 0x00, 0x00, 0x61, 0xac, 0x01, 0x00, 0x58, 0xfc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0xfc, 0x00, 0x00, 0x79, 0xac, 0x01, 0x00, 0x78, 0xfc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0xfc, 0x00, 0x00, 0x93, 0xac, 0x01, 0x00, 0x98, 0xfc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0xfc, 0x00, 0x00, 0xb1, 0xac, 0x01, 0x00, 0xb8, 0xfc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0xfc, 0x00, 0x00, 0x27, 0xab, 0x01, 0x00, 0xd8, 0xfc, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0xfc, 0x00, 0x00, 0xd3, 0xac, 0x01, 0x00, 0xf8, 0xfc, 0x00, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x08, 0xfd, 0x00, 0x00, 0x24, 0xad, 0x01, 0x00, 0x18, 0xfd, 0x00, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x28, 0xfd, 0x00, 0x00, 0x7e, 0xad, 0x01, 0x00, 0x38, 0xfd, 0x00, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x48, 0xfd, 0x00, 0x00, 0xcf, 0xad, 0x01, 0x00, 0x58, 0xfd, 0x00, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x68, 0xfd, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0xfd, 0x00, 0x00,
+  0x26, 0xae, 0x01, 0x00, 0x88, 0xfd, 0x00, 0x00, 0x35, 0xab, 0x01, 0x00, 0x98, 0xfd, 0x00, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0xa8, 0xfd, 0x00, 0x00, 0x3f, 0xae, 0x01, 0x00, 0xb8, 0xfd, 0x00, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0xc8, 0xfd, 0x00, 0x00, 0x96, 0xae, 0x01, 0x00, 0xd8, 0xfd, 0x00, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0xe8, 0xfd, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf8, 0xfd, 0x00, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0x08, 0xfe, 0x00, 0x00, 0xf0, 0xae, 0x01, 0x00, 0x18, 0xfe, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0xfe, 0x00, 0x00, 0x06, 0xaf, 0x01, 0x00, 0x38, 0xfe, 0x00, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0x48, 0xfe, 0x00, 0x00, 0x30, 0xaf, 0x01, 0x00, 0x58, 0xfe, 0x00, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x68, 0xfe, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0xfe, 0x00, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0x88, 0xfe, 0x00, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x98, 0xfe, 0x00, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0xa8, 0xfe, 0x00, 0x00, 0x92, 0xaf, 0x01, 0x00, 0xb8, 0xfe, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0xfe, 0x00, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0xd8, 0xfe, 0x00, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0xe8, 0xfe, 0x00, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0xf8, 0xfe, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0xff, 0x00, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x18, 0xff, 0x00, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0x28, 0xff, 0x00, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0x38, 0xff, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0xff, 0x00, 0x00, 0x14, 0xb0, 0x01, 0x00, 0x58, 0xff, 0x00, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0x68, 0xff, 0x00, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x78, 0xff, 0x00, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x88, 0xff, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0xff, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0xff, 0x00, 0x00, 0xac, 0xab, 0x01, 0x00, 0xb8, 0xff, 0x00, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0xff, 0x00, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0xf8, 0xff, 0x00, 0x00, 0x03, 0xab, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0x28, 0x00, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00, 0x0b, 0xac, 0x01, 0x00, 0x48, 0x00, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x58, 0x00, 0x01, 0x00, 0x25, 0xac, 0x01, 0x00, 0x68, 0x00, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x2b, 0xac, 0x01, 0x00, 0x88, 0x00, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0x00, 0x01, 0x00, 0x47, 0xac, 0x01, 0x00, 0xa8, 0x00, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb8, 0x00, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0xc8, 0x00, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0x00, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0xe8, 0x00, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf8, 0x00, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0x08, 0x01, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x18, 0x01, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0x28, 0x01, 0x01, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x38, 0x01, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0x48, 0x01, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x58, 0x01, 0x01, 0x00, 0x7e, 0xad, 0x01, 0x00, 0x68, 0x01, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x78, 0x01, 0x01, 0x00, 0xcf, 0xad, 0x01, 0x00, 0x88, 0x01, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x98, 0x01, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x01, 0x01, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0xb8, 0x01, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0x01, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0xd8, 0x01, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xe8, 0x01, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf8, 0x01, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0x08, 0x02, 0x01, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0x18, 0x02, 0x01, 0x00, 0x30, 0xaf, 0x01, 0x00, 0x28, 0x02, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x38, 0x02, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0x02, 0x01, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0x58, 0x02, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x68, 0x02, 0x01, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0x78, 0x02, 0x01, 0x00, 0x92, 0xaf, 0x01, 0x00, 0x88, 0x02, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0x02, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0xa8, 0x02, 0x01, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0xb8, 0x02, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0xc8, 0x02, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0x02, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0xe8, 0x02, 0x01, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0xf8, 0x02, 0x01, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0x08, 0x03, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x18, 0x03, 0x01, 0x00, 0x14, 0xb0, 0x01, 0x00, 0x28, 0x03, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0x38, 0x03, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x48, 0x03, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x58, 0x03, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x03, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0x03, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0x03, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa0, 0x03, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb0, 0x03, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc0, 0x03, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd0, 0x03, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe0, 0x03, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xec, 0x03, 0x01, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0xf4, 0x03, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf8, 0x03, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xfc, 0x03, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x04, 0x04, 0x01, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0x0c, 0x04, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x10, 0x04, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x14, 0x04, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x1c, 0x04, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x2c, 0x04, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0x04, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x44, 0x04, 0x01, 0x00, 0x1d, 0xab, 0x01, 0x00, 0x50, 0x04, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x5c, 0x04, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x04, 0x01, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0x74, 0x04, 0x01, 0x00, 0x68, 0xab, 0x01, 0x00, 0x80, 0x04, 0x01, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0x8c, 0x04, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0x04, 0x01, 0x00,
+  0xac, 0xab, 0x01, 0x00, 0xa4, 0x04, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb0, 0x04, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xbc, 0x04, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xd4, 0x04, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe0, 0x04, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0xec, 0x04, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0xf8, 0x04, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x04, 0x05, 0x01, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0x10, 0x05, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x1c, 0x05, 0x01, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x28, 0x05, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x34, 0x05, 0x01, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0x40, 0x05, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4c, 0x05, 0x01, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0x58, 0x05, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x64, 0x05, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x70, 0x05, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x7c, 0x05, 0x01, 0x00,
+  0x79, 0xac, 0x01, 0x00, 0x88, 0x05, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x94, 0x05, 0x01, 0x00,
+  0x93, 0xac, 0x01, 0x00, 0xa0, 0x05, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xac, 0x05, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0xb8, 0x05, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc4, 0x05, 0x01, 0x00,
+  0x1d, 0xab, 0x01, 0x00, 0xd0, 0x05, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0xdc, 0x05, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0x05, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0xf4, 0x05, 0x01, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x00, 0x06, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0x0c, 0x06, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x18, 0x06, 0x01, 0x00, 0x7e, 0xad, 0x01, 0x00, 0x24, 0x06, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x30, 0x06, 0x01, 0x00, 0xcf, 0xad, 0x01, 0x00, 0x3c, 0x06, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x48, 0x06, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x54, 0x06, 0x01, 0x00,
+  0x26, 0xae, 0x01, 0x00, 0x60, 0x06, 0x01, 0x00, 0x35, 0xab, 0x01, 0x00, 0x6c, 0x06, 0x01, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x78, 0x06, 0x01, 0x00, 0x3f, 0xae, 0x01, 0x00, 0x84, 0x06, 0x01, 0x00,
+  0x71, 0xae, 0x01, 0x00, 0x90, 0x06, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0x9c, 0x06, 0x01, 0x00,
+  0x96, 0xae, 0x01, 0x00, 0xa8, 0x06, 0x01, 0x00, 0x9b, 0xae, 0x01, 0x00, 0xb4, 0x06, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc0, 0x06, 0x01, 0x00, 0xa4, 0xae, 0x01, 0x00, 0xcc, 0x06, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0x06, 0x01, 0x00, 0xe0, 0xae, 0x01, 0x00, 0xe4, 0x06, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0xf0, 0x06, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xfc, 0x06, 0x01, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0x08, 0x07, 0x01, 0x00, 0x10, 0xaf, 0x01, 0x00, 0x14, 0x07, 0x01, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0x20, 0x07, 0x01, 0x00, 0x30, 0xaf, 0x01, 0x00, 0x2c, 0x07, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x38, 0x07, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x44, 0x07, 0x01, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0x50, 0x07, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x5c, 0x07, 0x01, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0x68, 0x07, 0x01, 0x00, 0x92, 0xaf, 0x01, 0x00, 0x74, 0x07, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x80, 0x07, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x8c, 0x07, 0x01, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0x98, 0x07, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0xa4, 0x07, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb0, 0x07, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0xbc, 0x07, 0x01, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0xc8, 0x07, 0x01, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0xd4, 0x07, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe0, 0x07, 0x01, 0x00, 0x14, 0xb0, 0x01, 0x00, 0xec, 0x07, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0xf8, 0x07, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x04, 0x08, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x10, 0x08, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x1c, 0x08, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x08, 0x01, 0x00, 0xac, 0xab, 0x01, 0x00, 0x34, 0x08, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x40, 0x08, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4c, 0x08, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x64, 0x08, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x70, 0x08, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0x7c, 0x08, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0x88, 0x08, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x94, 0x08, 0x01, 0x00, 0x0b, 0xac, 0x01, 0x00, 0xa0, 0x08, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xac, 0x08, 0x01, 0x00, 0x25, 0xac, 0x01, 0x00, 0xb8, 0x08, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc4, 0x08, 0x01, 0x00, 0x2b, 0xac, 0x01, 0x00, 0xd0, 0x08, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xdc, 0x08, 0x01, 0x00, 0x47, 0xac, 0x01, 0x00, 0xe8, 0x08, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf4, 0x08, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0x00, 0x09, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x0c, 0x09, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0x18, 0x09, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x24, 0x09, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0x30, 0x09, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x3c, 0x09, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0x48, 0x09, 0x01, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x54, 0x09, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0x60, 0x09, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x6c, 0x09, 0x01, 0x00, 0x7e, 0xad, 0x01, 0x00, 0x78, 0x09, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x84, 0x09, 0x01, 0x00, 0xcf, 0xad, 0x01, 0x00, 0x90, 0x09, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x9c, 0x09, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x09, 0x01, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0xb4, 0x09, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc0, 0x09, 0x01, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0xcc, 0x09, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0x09, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0xe4, 0x09, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xf0, 0x09, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xfc, 0x09, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0x08, 0x0a, 0x01, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0x14, 0x0a, 0x01, 0x00, 0x30, 0xaf, 0x01, 0x00, 0x20, 0x0a, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x2c, 0x0a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0x0a, 0x01, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0x44, 0x0a, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x50, 0x0a, 0x01, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0x5c, 0x0a, 0x01, 0x00, 0x92, 0xaf, 0x01, 0x00, 0x68, 0x0a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x74, 0x0a, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x80, 0x0a, 0x01, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0x8c, 0x0a, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x98, 0x0a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa4, 0x0a, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0xb0, 0x0a, 0x01, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0xbc, 0x0a, 0x01, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0xc8, 0x0a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd4, 0x0a, 0x01, 0x00, 0x14, 0xb0, 0x01, 0x00, 0xe0, 0x0a, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0xec, 0x0a, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0xf8, 0x0a, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x04, 0x0b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x10, 0x0b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x1c, 0x0b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x0b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x40, 0x0b, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0x58, 0x0b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x64, 0x0b, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0x70, 0x0b, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0x7c, 0x0b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0x0b, 0x01, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0x94, 0x0b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa0, 0x0b, 0x01, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0xac, 0x0b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0x0b, 0x01, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0xc4, 0x0b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd0, 0x0b, 0x01, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0xdc, 0x0b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x0b, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0xf4, 0x0b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x00, 0x0c, 0x01, 0x00,
+  0x79, 0xac, 0x01, 0x00, 0x0c, 0x0c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0x0c, 0x01, 0x00,
+  0x93, 0xac, 0x01, 0x00, 0x24, 0x0c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x30, 0x0c, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x3c, 0x0c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0x0c, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x54, 0x0c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x60, 0x0c, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0x6c, 0x0c, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0x78, 0x0c, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x84, 0x0c, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0x90, 0x0c, 0x01, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0x9c, 0x0c, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0xa8, 0x0c, 0x01, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0xb4, 0x0c, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0xc0, 0x0c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xcc, 0x0c, 0x01, 0x00, 0x26, 0xae, 0x01, 0x00, 0xd8, 0x0c, 0x01, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0xe4, 0x0c, 0x01, 0x00, 0x68, 0xab, 0x01, 0x00, 0xf0, 0x0c, 0x01, 0x00,
+  0x3f, 0xae, 0x01, 0x00, 0xfc, 0x0c, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0x08, 0x0d, 0x01, 0x00,
+  0x96, 0xae, 0x01, 0x00, 0x14, 0x0d, 0x01, 0x00, 0x9b, 0xae, 0x01, 0x00, 0x20, 0x0d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x2c, 0x0d, 0x01, 0x00, 0xa4, 0xae, 0x01, 0x00, 0x38, 0x0d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x44, 0x0d, 0x01, 0x00, 0xe0, 0xae, 0x01, 0x00, 0x50, 0x0d, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0x5c, 0x0d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x0d, 0x01, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0x74, 0x0d, 0x01, 0x00, 0x20, 0xaf, 0x01, 0x00, 0x80, 0x0d, 0x01, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0x8c, 0x0d, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0x98, 0x0d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa4, 0x0d, 0x01, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0xb0, 0x0d, 0x01, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0xbc, 0x0d, 0x01, 0x00, 0x87, 0xaf, 0x01, 0x00, 0xc8, 0x0d, 0x01, 0x00,
+  0x92, 0xaf, 0x01, 0x00, 0xd4, 0x0d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe0, 0x0d, 0x01, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0xec, 0x0d, 0x01, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0xf8, 0x0d, 0x01, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0x04, 0x0e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x10, 0x0e, 0x01, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0x1c, 0x0e, 0x01, 0x00, 0xea, 0xaf, 0x01, 0x00, 0x28, 0x0e, 0x01, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0x34, 0x0e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x40, 0x0e, 0x01, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0x4c, 0x0e, 0x01, 0x00, 0x25, 0xb0, 0x01, 0x00, 0x58, 0x0e, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x64, 0x0e, 0x01, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x70, 0x0e, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x7c, 0x0e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0x0e, 0x01, 0x00,
+  0xac, 0xab, 0x01, 0x00, 0x94, 0x0e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa0, 0x0e, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xac, 0x0e, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xc4, 0x0e, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd0, 0x0e, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0xdc, 0x0e, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0xe8, 0x0e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf4, 0x0e, 0x01, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x0c, 0x0f, 0x01, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x18, 0x0f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x24, 0x0f, 0x01, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0x30, 0x0f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x3c, 0x0f, 0x01, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0x48, 0x0f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x54, 0x0f, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x60, 0x0f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x6c, 0x0f, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x78, 0x0f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x84, 0x0f, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x90, 0x0f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x9c, 0x0f, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0xa8, 0x0f, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0xb4, 0x0f, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0xc0, 0x0f, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0xcc, 0x0f, 0x01, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0xd8, 0x0f, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0xe4, 0x0f, 0x01, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0xf0, 0x0f, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0xfc, 0x0f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0x10, 0x01, 0x00, 0x68, 0xab, 0x01, 0x00, 0x14, 0x10, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x20, 0x10, 0x01, 0x00, 0xa4, 0xae, 0x01, 0x00, 0x2c, 0x10, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0x10, 0x01, 0x00, 0xe0, 0xae, 0x01, 0x00, 0x44, 0x10, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0x50, 0x10, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x5c, 0x10, 0x01, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0x68, 0x10, 0x01, 0x00, 0x20, 0xaf, 0x01, 0x00, 0x74, 0x10, 0x01, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0x80, 0x10, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0x8c, 0x10, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0x10, 0x01, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0xa4, 0x10, 0x01, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0xb0, 0x10, 0x01, 0x00, 0x87, 0xaf, 0x01, 0x00, 0xbc, 0x10, 0x01, 0x00,
+  0x92, 0xaf, 0x01, 0x00, 0xc8, 0x10, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd4, 0x10, 0x01, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0xe0, 0x10, 0x01, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0xec, 0x10, 0x01, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0xf8, 0x10, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x04, 0x11, 0x01, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0x10, 0x11, 0x01, 0x00, 0xea, 0xaf, 0x01, 0x00, 0x1c, 0x11, 0x01, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0x28, 0x11, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x34, 0x11, 0x01, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0x40, 0x11, 0x01, 0x00, 0x25, 0xb0, 0x01, 0x00, 0x4c, 0x11, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x58, 0x11, 0x01, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x64, 0x11, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x70, 0x11, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x7c, 0x11, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0x11, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xbc, 0x11, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x0c, 0x12, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x5c, 0x12, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xac, 0x12, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xfc, 0x12, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x30, 0x13, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x3c, 0x13, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0x13, 0x01, 0x00, 0x1d, 0xab, 0x01, 0x00, 0x54, 0x13, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x60, 0x13, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x6c, 0x13, 0x01, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0x78, 0x13, 0x01, 0x00, 0x68, 0xab, 0x01, 0x00, 0x84, 0x13, 0x01, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0x90, 0x13, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x9c, 0x13, 0x01, 0x00,
+  0xac, 0xab, 0x01, 0x00, 0xa8, 0x13, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb4, 0x13, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc0, 0x13, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xd8, 0x13, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe4, 0x13, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0xf0, 0x13, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0xfc, 0x13, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x08, 0x14, 0x01, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x14, 0x14, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x20, 0x14, 0x01, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0x2c, 0x14, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0x14, 0x01, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0x44, 0x14, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x50, 0x14, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x5c, 0x14, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x14, 0x01, 0x00,
+  0x79, 0xac, 0x01, 0x00, 0x74, 0x14, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x80, 0x14, 0x01, 0x00,
+  0x93, 0xac, 0x01, 0x00, 0x8c, 0x14, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0x14, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0xa4, 0x14, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb0, 0x14, 0x01, 0x00,
+  0x1d, 0xab, 0x01, 0x00, 0xbc, 0x14, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0xc8, 0x14, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd4, 0x14, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0xe0, 0x14, 0x01, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0xec, 0x14, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0xf8, 0x14, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x04, 0x15, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x10, 0x15, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x1c, 0x15, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x15, 0x01, 0x00,
+  0x26, 0xae, 0x01, 0x00, 0x34, 0x15, 0x01, 0x00, 0x35, 0xab, 0x01, 0x00, 0x40, 0x15, 0x01, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x4c, 0x15, 0x01, 0x00, 0x3f, 0xae, 0x01, 0x00, 0x58, 0x15, 0x01, 0x00,
+  0x71, 0xae, 0x01, 0x00, 0x64, 0x15, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0x70, 0x15, 0x01, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0x7c, 0x15, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0x15, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0x94, 0x15, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xa0, 0x15, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xac, 0x15, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xb8, 0x15, 0x01, 0x00,
+  0x10, 0xaf, 0x01, 0x00, 0xc4, 0x15, 0x01, 0x00, 0x20, 0xaf, 0x01, 0x00, 0xd0, 0x15, 0x01, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0xdc, 0x15, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0xe8, 0x15, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf4, 0x15, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x00, 0x16, 0x01, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0x0c, 0x16, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0x16, 0x01, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0x24, 0x16, 0x01, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0x30, 0x16, 0x01, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0x3c, 0x16, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0x16, 0x01, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0x54, 0x16, 0x01, 0x00, 0xea, 0xaf, 0x01, 0x00, 0x60, 0x16, 0x01, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0x6c, 0x16, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0x16, 0x01, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0x84, 0x16, 0x01, 0x00, 0x25, 0xb0, 0x01, 0x00, 0x90, 0x16, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x9c, 0x16, 0x01, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0xa8, 0x16, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb4, 0x16, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc0, 0x16, 0x01, 0x00,
+  0xac, 0xab, 0x01, 0x00, 0xcc, 0x16, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0x16, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe4, 0x16, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xfc, 0x16, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0x17, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0x14, 0x17, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0x20, 0x17, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x2c, 0x17, 0x01, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x38, 0x17, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x44, 0x17, 0x01, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0x50, 0x17, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x5c, 0x17, 0x01, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0x68, 0x17, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x74, 0x17, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x80, 0x17, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x8c, 0x17, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x98, 0x17, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa4, 0x17, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0xb0, 0x17, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xbc, 0x17, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0xc8, 0x17, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0xd4, 0x17, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0xe0, 0x17, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0xec, 0x17, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0xf8, 0x17, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0x04, 0x18, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x10, 0x18, 0x01, 0x00, 0x68, 0xab, 0x01, 0x00, 0x1c, 0x18, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x18, 0x01, 0x00, 0xe0, 0xae, 0x01, 0x00, 0x34, 0x18, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0x40, 0x18, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4c, 0x18, 0x01, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0x58, 0x18, 0x01, 0x00, 0x20, 0xaf, 0x01, 0x00, 0x64, 0x18, 0x01, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0x70, 0x18, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0x7c, 0x18, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0x18, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x94, 0x18, 0x01, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0xa0, 0x18, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xac, 0x18, 0x01, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0xb8, 0x18, 0x01, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0xc4, 0x18, 0x01, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0xd0, 0x18, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xdc, 0x18, 0x01, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0xe8, 0x18, 0x01, 0x00, 0xea, 0xaf, 0x01, 0x00, 0xf4, 0x18, 0x01, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0x00, 0x19, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x0c, 0x19, 0x01, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0x18, 0x19, 0x01, 0x00, 0x25, 0xb0, 0x01, 0x00, 0x24, 0x19, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x30, 0x19, 0x01, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x3c, 0x19, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0x19, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x54, 0x19, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x60, 0x19, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0x78, 0x19, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x84, 0x19, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0x90, 0x19, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0x9c, 0x19, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x19, 0x01, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0xb4, 0x19, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc0, 0x19, 0x01, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0xcc, 0x19, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0x19, 0x01, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0xe4, 0x19, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf0, 0x19, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0xfc, 0x19, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x08, 0x1a, 0x01, 0x00,
+  0x79, 0xac, 0x01, 0x00, 0x14, 0x1a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x20, 0x1a, 0x01, 0x00,
+  0x93, 0xac, 0x01, 0x00, 0x2c, 0x1a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0x1a, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x44, 0x1a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x50, 0x1a, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x5c, 0x1a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x1a, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0x74, 0x1a, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0x80, 0x1a, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x8c, 0x1a, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0x98, 0x1a, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0xa4, 0x1a, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0xb0, 0x1a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xbc, 0x1a, 0x01, 0x00, 0x26, 0xae, 0x01, 0x00, 0xc8, 0x1a, 0x01, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0xd4, 0x1a, 0x01, 0x00, 0x68, 0xab, 0x01, 0x00, 0xe0, 0x1a, 0x01, 0x00,
+  0x3f, 0xae, 0x01, 0x00, 0xec, 0x1a, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0xf8, 0x1a, 0x01, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0x04, 0x1b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x10, 0x1b, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0x1c, 0x1b, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0x28, 0x1b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x34, 0x1b, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0x40, 0x1b, 0x01, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0x4c, 0x1b, 0x01, 0x00, 0x30, 0xaf, 0x01, 0x00, 0x58, 0x1b, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x64, 0x1b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x70, 0x1b, 0x01, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x7c, 0x1b, 0x01, 0x00, 0x87, 0xaf, 0x01, 0x00, 0x88, 0x1b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x94, 0x1b, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0xa0, 0x1b, 0x01, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0xac, 0x1b, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0xb8, 0x1b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc4, 0x1b, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0xd0, 0x1b, 0x01, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0xdc, 0x1b, 0x01, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0xe8, 0x1b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf4, 0x1b, 0x01, 0x00, 0x14, 0xb0, 0x01, 0x00, 0x00, 0x1c, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0x0c, 0x1c, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x18, 0x1c, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x24, 0x1c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x30, 0x1c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x3c, 0x1c, 0x01, 0x00, 0xac, 0xab, 0x01, 0x00, 0x48, 0x1c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x54, 0x1c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x60, 0x1c, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x78, 0x1c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x84, 0x1c, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0x90, 0x1c, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0x9c, 0x1c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0x1c, 0x01, 0x00, 0x25, 0xac, 0x01, 0x00, 0xb4, 0x1c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc0, 0x1c, 0x01, 0x00, 0x2b, 0xac, 0x01, 0x00, 0xcc, 0x1c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0x1c, 0x01, 0x00, 0x47, 0xac, 0x01, 0x00, 0xe4, 0x1c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf0, 0x1c, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0xfc, 0x1c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0x1d, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0x14, 0x1d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x20, 0x1d, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0x2c, 0x1d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0x1d, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0x44, 0x1d, 0x01, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x50, 0x1d, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0x5c, 0x1d, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x68, 0x1d, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x74, 0x1d, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x80, 0x1d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x8c, 0x1d, 0x01, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x98, 0x1d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa4, 0x1d, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0xb0, 0x1d, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xbc, 0x1d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0x1d, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xd4, 0x1d, 0x01, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0xe0, 0x1d, 0x01, 0x00, 0x30, 0xaf, 0x01, 0x00, 0xec, 0x1d, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0xf8, 0x1d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x04, 0x1e, 0x01, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x10, 0x1e, 0x01, 0x00, 0x87, 0xaf, 0x01, 0x00, 0x1c, 0x1e, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x1e, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x34, 0x1e, 0x01, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0x40, 0x1e, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x4c, 0x1e, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x58, 0x1e, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x64, 0x1e, 0x01, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0x70, 0x1e, 0x01, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0x7c, 0x1e, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0x1e, 0x01, 0x00, 0x14, 0xb0, 0x01, 0x00, 0x94, 0x1e, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0xa0, 0x1e, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0xac, 0x1e, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0xb8, 0x1e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc4, 0x1e, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd0, 0x1e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xdc, 0x1e, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x28, 0x1f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x1f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0x1f, 0x01, 0x00, 0x1d, 0xab, 0x01, 0x00, 0xe8, 0x1f, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x28, 0x20, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x20, 0x01, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0xa8, 0x20, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0xe8, 0x20, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x21, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x21, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0x21, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x21, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x22, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x22, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0x22, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x22, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x23, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x23, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0x23, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0x28, 0x24, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x24, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0xa8, 0x24, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0xe8, 0x24, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x25, 0x01, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0x68, 0x25, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x25, 0x01, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0xe8, 0x25, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x26, 0x01, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0x68, 0x26, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x26, 0x01, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0xe8, 0x26, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x27, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x68, 0x27, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x27, 0x01, 0x00,
+  0x79, 0xac, 0x01, 0x00, 0xe8, 0x27, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x28, 0x01, 0x00,
+  0x93, 0xac, 0x01, 0x00, 0x68, 0x28, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x28, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0xe8, 0x28, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x29, 0x01, 0x00,
+  0x1d, 0xab, 0x01, 0x00, 0x68, 0x29, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0xa8, 0x29, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0x29, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0x28, 0x2a, 0x01, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x68, 0x2a, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0xa8, 0x2a, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0xe8, 0x2a, 0x01, 0x00, 0x7e, 0xad, 0x01, 0x00, 0x28, 0x2b, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x68, 0x2b, 0x01, 0x00, 0xcf, 0xad, 0x01, 0x00, 0xa8, 0x2b, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0xe8, 0x2b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x2c, 0x01, 0x00,
+  0x26, 0xae, 0x01, 0x00, 0x68, 0x2c, 0x01, 0x00, 0x35, 0xab, 0x01, 0x00, 0xa8, 0x2c, 0x01, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0xe8, 0x2c, 0x01, 0x00, 0x3f, 0xae, 0x01, 0x00, 0x28, 0x2d, 0x01, 0x00,
+  0x71, 0xae, 0x01, 0x00, 0x68, 0x2d, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0xa8, 0x2d, 0x01, 0x00,
+  0x96, 0xae, 0x01, 0x00, 0xe8, 0x2d, 0x01, 0x00, 0x9b, 0xae, 0x01, 0x00, 0x28, 0x2e, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x2e, 0x01, 0x00, 0xa4, 0xae, 0x01, 0x00, 0xa8, 0x2e, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0x2e, 0x01, 0x00, 0xe0, 0xae, 0x01, 0x00, 0x28, 0x2f, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0x68, 0x2f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x2f, 0x01, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0xe8, 0x2f, 0x01, 0x00, 0x10, 0xaf, 0x01, 0x00, 0x28, 0x30, 0x01, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0x68, 0x30, 0x01, 0x00, 0x30, 0xaf, 0x01, 0x00, 0xa8, 0x30, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0xe8, 0x30, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x31, 0x01, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0x68, 0x31, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0xa8, 0x31, 0x01, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0xe8, 0x31, 0x01, 0x00, 0x92, 0xaf, 0x01, 0x00, 0x28, 0x32, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x32, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0xa8, 0x32, 0x01, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0xe8, 0x32, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x28, 0x33, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x33, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0xa8, 0x33, 0x01, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0xe8, 0x33, 0x01, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0x28, 0x34, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x34, 0x01, 0x00, 0x14, 0xb0, 0x01, 0x00, 0xa8, 0x34, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0xe8, 0x34, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x28, 0x35, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x68, 0x35, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x35, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0x35, 0x01, 0x00, 0xac, 0xab, 0x01, 0x00, 0x28, 0x36, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x36, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x36, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x28, 0x37, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x37, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0xa8, 0x37, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0xe8, 0x37, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x38, 0x01, 0x00, 0x0b, 0xac, 0x01, 0x00, 0x68, 0x38, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0x38, 0x01, 0x00, 0x25, 0xac, 0x01, 0x00, 0xe8, 0x38, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x39, 0x01, 0x00, 0x2b, 0xac, 0x01, 0x00, 0x68, 0x39, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0x39, 0x01, 0x00, 0x47, 0xac, 0x01, 0x00, 0xe8, 0x39, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x3a, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0x68, 0x3a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0x3a, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0xe8, 0x3a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x3b, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0x68, 0x3b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0x3b, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0xe8, 0x3b, 0x01, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x28, 0x3c, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0x68, 0x3c, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0xa8, 0x3c, 0x01, 0x00, 0x7e, 0xad, 0x01, 0x00, 0xe8, 0x3c, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x28, 0x3d, 0x01, 0x00, 0xcf, 0xad, 0x01, 0x00, 0x68, 0x3d, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0xa8, 0x3d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x3d, 0x01, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x28, 0x3e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x3e, 0x01, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0xa8, 0x3e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x3e, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0x28, 0x3f, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0x68, 0x3f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0x3f, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xe8, 0x3f, 0x01, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0x28, 0x40, 0x01, 0x00, 0x30, 0xaf, 0x01, 0x00, 0x68, 0x40, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0xa8, 0x40, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x40, 0x01, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0x28, 0x41, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x68, 0x41, 0x01, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0xa8, 0x41, 0x01, 0x00, 0x92, 0xaf, 0x01, 0x00, 0xe8, 0x41, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x42, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x68, 0x42, 0x01, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0xa8, 0x42, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0xe8, 0x42, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x43, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x68, 0x43, 0x01, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0xa8, 0x43, 0x01, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0xe8, 0x43, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x44, 0x01, 0x00, 0x14, 0xb0, 0x01, 0x00, 0x68, 0x44, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0xa8, 0x44, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0xe8, 0x44, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x28, 0x45, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x45, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0x45, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x45, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x46, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x46, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x47, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xe8, 0x47, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x48, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0x68, 0x48, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0xa8, 0x48, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x48, 0x01, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0x28, 0x49, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x49, 0x01, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0xa8, 0x49, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x49, 0x01, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0x28, 0x4a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x4a, 0x01, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0xa8, 0x4a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x4a, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x28, 0x4b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x4b, 0x01, 0x00,
+  0x79, 0xac, 0x01, 0x00, 0xa8, 0x4b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x4b, 0x01, 0x00,
+  0x93, 0xac, 0x01, 0x00, 0x28, 0x4c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x4c, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0xa8, 0x4c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x4c, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x28, 0x4d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x4d, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0xa8, 0x4d, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0xe8, 0x4d, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x28, 0x4e, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0x68, 0x4e, 0x01, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0xa8, 0x4e, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0xe8, 0x4e, 0x01, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0x28, 0x4f, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0x68, 0x4f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0x4f, 0x01, 0x00, 0x26, 0xae, 0x01, 0x00, 0xe8, 0x4f, 0x01, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0x28, 0x50, 0x01, 0x00, 0x68, 0xab, 0x01, 0x00, 0x68, 0x50, 0x01, 0x00,
+  0x3f, 0xae, 0x01, 0x00, 0xa8, 0x50, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0xe8, 0x50, 0x01, 0x00,
+  0x96, 0xae, 0x01, 0x00, 0x28, 0x51, 0x01, 0x00, 0x9b, 0xae, 0x01, 0x00, 0x68, 0x51, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0x51, 0x01, 0x00, 0xa4, 0xae, 0x01, 0x00, 0xe8, 0x51, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x52, 0x01, 0x00, 0xe0, 0xae, 0x01, 0x00, 0x68, 0x52, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0xa8, 0x52, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x52, 0x01, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0x28, 0x53, 0x01, 0x00, 0x20, 0xaf, 0x01, 0x00, 0x68, 0x53, 0x01, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0xa8, 0x53, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0xe8, 0x53, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x54, 0x01, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0x68, 0x54, 0x01, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0xa8, 0x54, 0x01, 0x00, 0x87, 0xaf, 0x01, 0x00, 0xe8, 0x54, 0x01, 0x00,
+  0x92, 0xaf, 0x01, 0x00, 0x28, 0x55, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x55, 0x01, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0xa8, 0x55, 0x01, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0xe8, 0x55, 0x01, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0x28, 0x56, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x56, 0x01, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0xa8, 0x56, 0x01, 0x00, 0xea, 0xaf, 0x01, 0x00, 0xe8, 0x56, 0x01, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0x28, 0x57, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x57, 0x01, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0xa8, 0x57, 0x01, 0x00, 0x25, 0xb0, 0x01, 0x00, 0xe8, 0x57, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x28, 0x58, 0x01, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x68, 0x58, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0x58, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x58, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x59, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xa8, 0x59, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0x59, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0x28, 0x5a, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0x68, 0x5a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x5a, 0x01, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0xe8, 0x5a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x5b, 0x01, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x68, 0x5b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x5b, 0x01, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0xe8, 0x5b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x5c, 0x01, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0x68, 0x5c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x5c, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0xe8, 0x5c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x5d, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x68, 0x5d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x5d, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0xe8, 0x5d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x5e, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0x68, 0x5e, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0xa8, 0x5e, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0xe8, 0x5e, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0x28, 0x5f, 0x01, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0x68, 0x5f, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0xa8, 0x5f, 0x01, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0xe8, 0x5f, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0x28, 0x60, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x60, 0x01, 0x00, 0x68, 0xab, 0x01, 0x00, 0xa8, 0x60, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0x60, 0x01, 0x00, 0xa4, 0xae, 0x01, 0x00, 0x28, 0x61, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x61, 0x01, 0x00, 0xe0, 0xae, 0x01, 0x00, 0xa8, 0x61, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0xe8, 0x61, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x62, 0x01, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0x68, 0x62, 0x01, 0x00, 0x20, 0xaf, 0x01, 0x00, 0xa8, 0x62, 0x01, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0xe8, 0x62, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0x28, 0x63, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x63, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0xa8, 0x63, 0x01, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0xe8, 0x63, 0x01, 0x00, 0x92, 0xaf, 0x01, 0x00, 0x28, 0x64, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x64, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0xa8, 0x64, 0x01, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0xe8, 0x64, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x28, 0x65, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x65, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0xa8, 0x65, 0x01, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0xe8, 0x65, 0x01, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0x28, 0x66, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x66, 0x01, 0x00, 0x14, 0xb0, 0x01, 0x00, 0xa8, 0x66, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0xe8, 0x66, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x28, 0x67, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x68, 0x67, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x67, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0x67, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x68, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x90, 0x68, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0x68, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe0, 0x68, 0x01, 0x00, 0x1d, 0xab, 0x01, 0x00, 0x08, 0x69, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x30, 0x69, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0x69, 0x01, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x80, 0x69, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0xa8, 0x69, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd0, 0x69, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf8, 0x69, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x48, 0x6a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x70, 0x6a, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0x98, 0x6a, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0xc0, 0x6a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0x6a, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0x10, 0x6b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0x6b, 0x01, 0x00, 0x79, 0xac, 0x01, 0x00, 0x60, 0x6b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0x6b, 0x01, 0x00, 0x93, 0xac, 0x01, 0x00, 0xb0, 0x6b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0x6b, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0x00, 0x6c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x6c, 0x01, 0x00, 0x1d, 0xab, 0x01, 0x00, 0x50, 0x6c, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x78, 0x6c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa0, 0x6c, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0xc8, 0x6c, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0xf0, 0x6c, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x18, 0x6d, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0x40, 0x6d, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x68, 0x6d, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0x90, 0x6d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb8, 0x6d, 0x01, 0x00, 0x68, 0xab, 0x01, 0x00, 0xe0, 0x6d, 0x01, 0x00,
+  0x71, 0xae, 0x01, 0x00, 0x08, 0x6e, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0x30, 0x6e, 0x01, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0x58, 0x6e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x80, 0x6e, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0xa8, 0x6e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd0, 0x6e, 0x01, 0x00,
+  0x10, 0xaf, 0x01, 0x00, 0xf8, 0x6e, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0x20, 0x6f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0x6f, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x70, 0x6f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0x6f, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0xc0, 0x6f, 0x01, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0xe8, 0x6f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x10, 0x70, 0x01, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0x38, 0x70, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x60, 0x70, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0x88, 0x70, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0xb0, 0x70, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0xd8, 0x70, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x00, 0x71, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x71, 0x01, 0x00, 0xac, 0xab, 0x01, 0x00, 0x50, 0x71, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0x71, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa0, 0x71, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0xf0, 0x71, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0x72, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0x40, 0x72, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0x68, 0x72, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x90, 0x72, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0xb8, 0x72, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe0, 0x72, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0x08, 0x73, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x30, 0x73, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0x58, 0x73, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x80, 0x73, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0xa8, 0x73, 0x01, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0xd0, 0x73, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0xf8, 0x73, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x20, 0x74, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x48, 0x74, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x70, 0x74, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0x74, 0x01, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0xc0, 0x74, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x74, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0x10, 0x75, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0x75, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x60, 0x75, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0x75, 0x01, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0xb0, 0x75, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0x75, 0x01, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0x00, 0x76, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x28, 0x76, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x50, 0x76, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x78, 0x76, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa0, 0x76, 0x01, 0x00, 0x25, 0xb0, 0x01, 0x00, 0xc8, 0x76, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0xf0, 0x76, 0x01, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x18, 0x77, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x40, 0x77, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x77, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x90, 0x77, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0xe0, 0x77, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0x08, 0x78, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x30, 0x78, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x58, 0x78, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x80, 0x78, 0x01, 0x00,
+  0x79, 0xac, 0x01, 0x00, 0xa8, 0x78, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd0, 0x78, 0x01, 0x00,
+  0x93, 0xac, 0x01, 0x00, 0xf8, 0x78, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x20, 0x79, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x48, 0x79, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x70, 0x79, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x98, 0x79, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc0, 0x79, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0xe8, 0x79, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0x10, 0x7a, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x38, 0x7a, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0x60, 0x7a, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x88, 0x7a, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0xb0, 0x7a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0x7a, 0x01, 0x00, 0x68, 0xab, 0x01, 0x00, 0x00, 0x7b, 0x01, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0x28, 0x7b, 0x01, 0x00, 0x9b, 0xae, 0x01, 0x00, 0x50, 0x7b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0x7b, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xa0, 0x7b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0x7b, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0xf0, 0x7b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x18, 0x7c, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x40, 0x7c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x7c, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x90, 0x7c, 0x01, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0xb8, 0x7c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe0, 0x7c, 0x01, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0x08, 0x7d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x30, 0x7d, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0x58, 0x7d, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x80, 0x7d, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0xa8, 0x7d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd0, 0x7d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf8, 0x7d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x20, 0x7e, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x70, 0x7e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0x7e, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0xc0, 0x7e, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0xe8, 0x7e, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x10, 0x7f, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0x38, 0x7f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x60, 0x7f, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0x88, 0x7f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb0, 0x7f, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0xd8, 0x7f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0x28, 0x80, 0x01, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x50, 0x80, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0x78, 0x80, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0xa0, 0x80, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0xc8, 0x80, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0xf0, 0x80, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0x81, 0x01, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x40, 0x81, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x68, 0x81, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0x90, 0x81, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0x81, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0xe0, 0x81, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x08, 0x82, 0x01, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x30, 0x82, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0x82, 0x01, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0x80, 0x82, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0xa8, 0x82, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd0, 0x82, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0xf8, 0x82, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x20, 0x83, 0x01, 0x00, 0x25, 0xb0, 0x01, 0x00, 0x48, 0x83, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x70, 0x83, 0x01, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x98, 0x83, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc0, 0x83, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe8, 0x83, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x10, 0x84, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0x40, 0x84, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0x84, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x50, 0x84, 0x01, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0x58, 0x84, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0x60, 0x84, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x84, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x70, 0x84, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x80, 0x84, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0x84, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0x90, 0x84, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0x98, 0x84, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa0, 0x84, 0x01, 0x00, 0x0b, 0xac, 0x01, 0x00, 0xa8, 0x84, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb0, 0x84, 0x01, 0x00, 0x25, 0xac, 0x01, 0x00, 0xb8, 0x84, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc0, 0x84, 0x01, 0x00, 0x2b, 0xac, 0x01, 0x00, 0xc8, 0x84, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd0, 0x84, 0x01, 0x00, 0x47, 0xac, 0x01, 0x00, 0xd8, 0x84, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe0, 0x84, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0xe8, 0x84, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf0, 0x84, 0x01, 0x00, 0x79, 0xac, 0x01, 0x00, 0xf8, 0x84, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x93, 0xac, 0x01, 0x00, 0x08, 0x85, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x10, 0x85, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0x18, 0x85, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x20, 0x85, 0x01, 0x00, 0x1d, 0xab, 0x01, 0x00, 0x28, 0x85, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x30, 0x85, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0x85, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0x40, 0x85, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0x48, 0x85, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x50, 0x85, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0x58, 0x85, 0x01, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0x60, 0x85, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x68, 0x85, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x70, 0x85, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0x85, 0x01, 0x00,
+  0x26, 0xae, 0x01, 0x00, 0x80, 0x85, 0x01, 0x00, 0x35, 0xab, 0x01, 0x00, 0x88, 0x85, 0x01, 0x00,
+  0x3f, 0xae, 0x01, 0x00, 0x90, 0x85, 0x01, 0x00, 0x71, 0xae, 0x01, 0x00, 0x98, 0x85, 0x01, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0xa0, 0x85, 0x01, 0x00, 0x96, 0xae, 0x01, 0x00, 0xa8, 0x85, 0x01, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0xb0, 0x85, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0x85, 0x01, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0xc0, 0x85, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0x85, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0xd0, 0x85, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xd8, 0x85, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe0, 0x85, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xe8, 0x85, 0x01, 0x00,
+  0x10, 0xaf, 0x01, 0x00, 0xf0, 0x85, 0x01, 0x00, 0x20, 0xaf, 0x01, 0x00, 0xf8, 0x85, 0x01, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0x00, 0x86, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0x08, 0x86, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x10, 0x86, 0x01, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0x18, 0x86, 0x01, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x20, 0x86, 0x01, 0x00, 0x87, 0xaf, 0x01, 0x00, 0x28, 0x86, 0x01, 0x00,
+  0x92, 0xaf, 0x01, 0x00, 0x30, 0x86, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0x86, 0x01, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0x40, 0x86, 0x01, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0x48, 0x86, 0x01, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0x50, 0x86, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0x86, 0x01, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0x60, 0x86, 0x01, 0x00, 0xea, 0xaf, 0x01, 0x00, 0x68, 0x86, 0x01, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0x70, 0x86, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0x86, 0x01, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0x80, 0x86, 0x01, 0x00, 0x25, 0xb0, 0x01, 0x00, 0x88, 0x86, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x90, 0x86, 0x01, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x98, 0x86, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa0, 0x86, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x86, 0x01, 0x00,
+  0xac, 0xab, 0x01, 0x00, 0xb0, 0x86, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0x86, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc0, 0x86, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xd0, 0x86, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0x86, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0xe0, 0x86, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0xe8, 0x86, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf0, 0x86, 0x01, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0xf8, 0x86, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x00, 0x87, 0x01, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x08, 0x87, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x10, 0x87, 0x01, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0x18, 0x87, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x20, 0x87, 0x01, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0x28, 0x87, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x30, 0x87, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x38, 0x87, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x40, 0x87, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x48, 0x87, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x50, 0x87, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x58, 0x87, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x60, 0x87, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0x68, 0x87, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0x70, 0x87, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x78, 0x87, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0x80, 0x87, 0x01, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0x88, 0x87, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x90, 0x87, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x98, 0x87, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa0, 0x87, 0x01, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0xa8, 0x87, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb0, 0x87, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0xb8, 0x87, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xc0, 0x87, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0x87, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xd0, 0x87, 0x01, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0xd8, 0x87, 0x01, 0x00, 0x30, 0xaf, 0x01, 0x00, 0xe0, 0x87, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0xe8, 0x87, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf0, 0x87, 0x01, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0xf8, 0x87, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x00, 0x88, 0x01, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0x08, 0x88, 0x01, 0x00, 0x92, 0xaf, 0x01, 0x00, 0x10, 0x88, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x18, 0x88, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x20, 0x88, 0x01, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0x28, 0x88, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x30, 0x88, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0x88, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x40, 0x88, 0x01, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0x48, 0x88, 0x01, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0x50, 0x88, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x58, 0x88, 0x01, 0x00, 0x14, 0xb0, 0x01, 0x00, 0x60, 0x88, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0x68, 0x88, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x70, 0x88, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x78, 0x88, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x80, 0x88, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0x88, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x90, 0x88, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0xa0, 0x88, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x88, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0xb0, 0x88, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0xb8, 0x88, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc0, 0x88, 0x01, 0x00, 0x0b, 0xac, 0x01, 0x00, 0xc8, 0x88, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd0, 0x88, 0x01, 0x00, 0x25, 0xac, 0x01, 0x00, 0xd8, 0x88, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe0, 0x88, 0x01, 0x00, 0x2b, 0xac, 0x01, 0x00, 0xe8, 0x88, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf0, 0x88, 0x01, 0x00, 0x47, 0xac, 0x01, 0x00, 0xf8, 0x88, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x00, 0x89, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0x08, 0x89, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x10, 0x89, 0x01, 0x00, 0x79, 0xac, 0x01, 0x00, 0x18, 0x89, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x20, 0x89, 0x01, 0x00, 0x93, 0xac, 0x01, 0x00, 0x28, 0x89, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x30, 0x89, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0x38, 0x89, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x40, 0x89, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0x48, 0x89, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x50, 0x89, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0x58, 0x89, 0x01, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x60, 0x89, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0x68, 0x89, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x70, 0x89, 0x01, 0x00, 0x7e, 0xad, 0x01, 0x00, 0x78, 0x89, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x80, 0x89, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0x88, 0x89, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x90, 0x89, 0x01, 0x00, 0x26, 0xae, 0x01, 0x00, 0x98, 0x89, 0x01, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0xa0, 0x89, 0x01, 0x00, 0x3f, 0xae, 0x01, 0x00, 0xa8, 0x89, 0x01, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0xb0, 0x89, 0x01, 0x00, 0x96, 0xae, 0x01, 0x00, 0xb8, 0x89, 0x01, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0xc0, 0x89, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0x89, 0x01, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0xd0, 0x89, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0x89, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0xe0, 0x89, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xe8, 0x89, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf0, 0x89, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xf8, 0x89, 0x01, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0x00, 0x8a, 0x01, 0x00, 0x30, 0xaf, 0x01, 0x00, 0x08, 0x8a, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x10, 0x8a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0x8a, 0x01, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0x20, 0x8a, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x28, 0x8a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x30, 0x8a, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x38, 0x8a, 0x01, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0x40, 0x8a, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x48, 0x8a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x50, 0x8a, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x58, 0x8a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x60, 0x8a, 0x01, 0x00, 0x14, 0xb0, 0x01, 0x00, 0x68, 0x8a, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0x70, 0x8a, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x78, 0x8a, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x80, 0x8a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0x8a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x90, 0x8a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0x8a, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0xa8, 0x8a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb0, 0x8a, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0xb8, 0x8a, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0xc0, 0x8a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0x8a, 0x01, 0x00, 0x0b, 0xac, 0x01, 0x00, 0xd0, 0x8a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0x8a, 0x01, 0x00, 0x25, 0xac, 0x01, 0x00, 0xe0, 0x8a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0x8a, 0x01, 0x00, 0x2b, 0xac, 0x01, 0x00, 0xf0, 0x8a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf8, 0x8a, 0x01, 0x00, 0x47, 0xac, 0x01, 0x00, 0x00, 0x8b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0x8b, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0x10, 0x8b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x18, 0x8b, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0x20, 0x8b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x8b, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0x30, 0x8b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0x8b, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0x40, 0x8b, 0x01, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x48, 0x8b, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0x50, 0x8b, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x58, 0x8b, 0x01, 0x00, 0x7e, 0xad, 0x01, 0x00, 0x60, 0x8b, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x68, 0x8b, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0x70, 0x8b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0x8b, 0x01, 0x00, 0xa4, 0xae, 0x01, 0x00, 0x80, 0x8b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0x8b, 0x01, 0x00, 0xe0, 0xae, 0x01, 0x00, 0x90, 0x8b, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0x98, 0x8b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa0, 0x8b, 0x01, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0xa8, 0x8b, 0x01, 0x00, 0x20, 0xaf, 0x01, 0x00, 0xb0, 0x8b, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0xb8, 0x8b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc0, 0x8b, 0x01, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0xc8, 0x8b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd0, 0x8b, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0xd8, 0x8b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe0, 0x8b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe8, 0x8b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf0, 0x8b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x10, 0x8c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x20, 0x8c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x30, 0x8c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x40, 0x8c, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0x54, 0x8c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x60, 0x8c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x6c, 0x8c, 0x01, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0x78, 0x8c, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0x84, 0x8c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x90, 0x8c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x9c, 0x8c, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0xb4, 0x8c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc0, 0x8c, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0xcc, 0x8c, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0xd8, 0x8c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe4, 0x8c, 0x01, 0x00, 0x0b, 0xac, 0x01, 0x00, 0xf0, 0x8c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xfc, 0x8c, 0x01, 0x00, 0x25, 0xac, 0x01, 0x00, 0x08, 0x8d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x14, 0x8d, 0x01, 0x00, 0x2b, 0xac, 0x01, 0x00, 0x20, 0x8d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x2c, 0x8d, 0x01, 0x00, 0x47, 0xac, 0x01, 0x00, 0x38, 0x8d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x44, 0x8d, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0x50, 0x8d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x5c, 0x8d, 0x01, 0x00, 0x79, 0xac, 0x01, 0x00, 0x68, 0x8d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x74, 0x8d, 0x01, 0x00, 0x93, 0xac, 0x01, 0x00, 0x80, 0x8d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x8c, 0x8d, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0x98, 0x8d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa4, 0x8d, 0x01, 0x00, 0x1d, 0xab, 0x01, 0x00, 0xb0, 0x8d, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0xbc, 0x8d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc8, 0x8d, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0xd4, 0x8d, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0xe0, 0x8d, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0xec, 0x8d, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0xf8, 0x8d, 0x01, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0x04, 0x8e, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x10, 0x8e, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x1c, 0x8e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x28, 0x8e, 0x01, 0x00,
+  0x26, 0xae, 0x01, 0x00, 0x34, 0x8e, 0x01, 0x00, 0x35, 0xab, 0x01, 0x00, 0x40, 0x8e, 0x01, 0x00,
+  0x3f, 0xae, 0x01, 0x00, 0x4c, 0x8e, 0x01, 0x00, 0x71, 0xae, 0x01, 0x00, 0x58, 0x8e, 0x01, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0x64, 0x8e, 0x01, 0x00, 0x96, 0xae, 0x01, 0x00, 0x70, 0x8e, 0x01, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0x7c, 0x8e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0x8e, 0x01, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0x94, 0x8e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa0, 0x8e, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0xac, 0x8e, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xb8, 0x8e, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc4, 0x8e, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xd0, 0x8e, 0x01, 0x00,
+  0x10, 0xaf, 0x01, 0x00, 0xdc, 0x8e, 0x01, 0x00, 0x20, 0xaf, 0x01, 0x00, 0xe8, 0x8e, 0x01, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0xf4, 0x8e, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0x00, 0x8f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x0c, 0x8f, 0x01, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0x18, 0x8f, 0x01, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x24, 0x8f, 0x01, 0x00, 0x87, 0xaf, 0x01, 0x00, 0x30, 0x8f, 0x01, 0x00,
+  0x92, 0xaf, 0x01, 0x00, 0x3c, 0x8f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0x8f, 0x01, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0x54, 0x8f, 0x01, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0x60, 0x8f, 0x01, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0x6c, 0x8f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0x8f, 0x01, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0x84, 0x8f, 0x01, 0x00, 0xea, 0xaf, 0x01, 0x00, 0x90, 0x8f, 0x01, 0x00,
+  0xfa, 0xaf, 0x01, 0x00, 0x9c, 0x8f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x8f, 0x01, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0xb4, 0x8f, 0x01, 0x00, 0x25, 0xb0, 0x01, 0x00, 0xc0, 0x8f, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0xcc, 0x8f, 0x01, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0xd8, 0x8f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe4, 0x8f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf0, 0x8f, 0x01, 0x00,
+  0xac, 0xab, 0x01, 0x00, 0xfc, 0x8f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x08, 0x90, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x14, 0x90, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0x2c, 0x90, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0x90, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0x44, 0x90, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0x50, 0x90, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x5c, 0x90, 0x01, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0x68, 0x90, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x74, 0x90, 0x01, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x80, 0x90, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x8c, 0x90, 0x01, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0x98, 0x90, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa4, 0x90, 0x01, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0xb0, 0x90, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xbc, 0x90, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0xc8, 0x90, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd4, 0x90, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0xe0, 0x90, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xec, 0x90, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0xf8, 0x90, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x04, 0x91, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0x10, 0x91, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0x1c, 0x91, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x28, 0x91, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0x34, 0x91, 0x01, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0x40, 0x91, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x4c, 0x91, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x58, 0x91, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x64, 0x91, 0x01, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0x70, 0x91, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x7c, 0x91, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0x88, 0x91, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0x94, 0x91, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa0, 0x91, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xac, 0x91, 0x01, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0xb8, 0x91, 0x01, 0x00, 0x30, 0xaf, 0x01, 0x00, 0xc4, 0x91, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0xd0, 0x91, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xdc, 0x91, 0x01, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0xe8, 0x91, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0xf4, 0x91, 0x01, 0x00,
+  0x87, 0xaf, 0x01, 0x00, 0x00, 0x92, 0x01, 0x00, 0x92, 0xaf, 0x01, 0x00, 0x0c, 0x92, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x18, 0x92, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x24, 0x92, 0x01, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0x30, 0x92, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x3c, 0x92, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x48, 0x92, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x54, 0x92, 0x01, 0x00,
+  0xea, 0xaf, 0x01, 0x00, 0x60, 0x92, 0x01, 0x00, 0xfa, 0xaf, 0x01, 0x00, 0x6c, 0x92, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0x92, 0x01, 0x00, 0x14, 0xb0, 0x01, 0x00, 0x84, 0x92, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0x90, 0x92, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x9c, 0x92, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0xa8, 0x92, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb4, 0x92, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc0, 0x92, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xcc, 0x92, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0xe4, 0x92, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf0, 0x92, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0xfc, 0x92, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0x08, 0x93, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x14, 0x93, 0x01, 0x00, 0x0b, 0xac, 0x01, 0x00, 0x20, 0x93, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x2c, 0x93, 0x01, 0x00, 0x25, 0xac, 0x01, 0x00, 0x38, 0x93, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x44, 0x93, 0x01, 0x00, 0x2b, 0xac, 0x01, 0x00, 0x50, 0x93, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x5c, 0x93, 0x01, 0x00, 0x47, 0xac, 0x01, 0x00, 0x68, 0x93, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x74, 0x93, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0x80, 0x93, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x8c, 0x93, 0x01, 0x00, 0x79, 0xac, 0x01, 0x00, 0x98, 0x93, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa4, 0x93, 0x01, 0x00, 0x93, 0xac, 0x01, 0x00, 0xb0, 0x93, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xbc, 0x93, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0xc8, 0x93, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd4, 0x93, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0xe0, 0x93, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xec, 0x93, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0xf8, 0x93, 0x01, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x04, 0x94, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0x10, 0x94, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x1c, 0x94, 0x01, 0x00, 0x7e, 0xad, 0x01, 0x00, 0x28, 0x94, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x34, 0x94, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0x40, 0x94, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x4c, 0x94, 0x01, 0x00, 0x26, 0xae, 0x01, 0x00, 0x58, 0x94, 0x01, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0x64, 0x94, 0x01, 0x00, 0x3f, 0xae, 0x01, 0x00, 0x70, 0x94, 0x01, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0x7c, 0x94, 0x01, 0x00, 0x96, 0xae, 0x01, 0x00, 0x88, 0x94, 0x01, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0x94, 0x94, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa0, 0x94, 0x01, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0xac, 0x94, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb8, 0x94, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0xc4, 0x94, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xd0, 0x94, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xdc, 0x94, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xe8, 0x94, 0x01, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0xf4, 0x94, 0x01, 0x00, 0x30, 0xaf, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x0c, 0x95, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x18, 0x95, 0x01, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0x24, 0x95, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x30, 0x95, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x3c, 0x95, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0x95, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x54, 0x95, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0x6c, 0x95, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x78, 0x95, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0x84, 0x95, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0x90, 0x95, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x9c, 0x95, 0x01, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0xa8, 0x95, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb4, 0x95, 0x01, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0xc0, 0x95, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xcc, 0x95, 0x01, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0xd8, 0x95, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xe4, 0x95, 0x01, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0xf0, 0x95, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xfc, 0x95, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x08, 0x96, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x14, 0x96, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x20, 0x96, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x2c, 0x96, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x38, 0x96, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x44, 0x96, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0x50, 0x96, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0x5c, 0x96, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x68, 0x96, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0x74, 0x96, 0x01, 0x00,
+  0x7e, 0xad, 0x01, 0x00, 0x80, 0x96, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x8c, 0x96, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x98, 0x96, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa4, 0x96, 0x01, 0x00,
+  0xa4, 0xae, 0x01, 0x00, 0xb0, 0x96, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xbc, 0x96, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0xc8, 0x96, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xd4, 0x96, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe0, 0x96, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0xec, 0x96, 0x01, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0xf8, 0x96, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0x04, 0x97, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x10, 0x97, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0x1c, 0x97, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0x97, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x34, 0x97, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x40, 0x97, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0x58, 0x97, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x64, 0x97, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x70, 0x97, 0x01, 0x00,
+  0x81, 0xab, 0x01, 0x00, 0x7c, 0x97, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0x97, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x94, 0x97, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xac, 0x97, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb8, 0x97, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0xc4, 0x97, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0xd0, 0x97, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xdc, 0x97, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0xe8, 0x97, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf4, 0x97, 0x01, 0x00,
+  0x79, 0xac, 0x01, 0x00, 0x00, 0x98, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x0c, 0x98, 0x01, 0x00,
+  0x93, 0xac, 0x01, 0x00, 0x18, 0x98, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x24, 0x98, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x30, 0x98, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x3c, 0x98, 0x01, 0x00,
+  0x1d, 0xab, 0x01, 0x00, 0x48, 0x98, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0x54, 0x98, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x60, 0x98, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0x6c, 0x98, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x78, 0x98, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0x84, 0x98, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x90, 0x98, 0x01, 0x00, 0xcf, 0xad, 0x01, 0x00, 0x9c, 0x98, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0xa8, 0x98, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb4, 0x98, 0x01, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0xc0, 0x98, 0x01, 0x00, 0x3f, 0xae, 0x01, 0x00, 0xcc, 0x98, 0x01, 0x00,
+  0x71, 0xae, 0x01, 0x00, 0xd8, 0x98, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0xe4, 0x98, 0x01, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0xf0, 0x98, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xfc, 0x98, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0x08, 0x99, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x14, 0x99, 0x01, 0x00,
+  0x10, 0xaf, 0x01, 0x00, 0x20, 0x99, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0x2c, 0x99, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x38, 0x99, 0x01, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0x44, 0x99, 0x01, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x50, 0x99, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x5c, 0x99, 0x01, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0x68, 0x99, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x74, 0x99, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x80, 0x99, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x8c, 0x99, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0x99, 0x01, 0x00, 0x25, 0xb0, 0x01, 0x00, 0xa4, 0x99, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0xb0, 0x99, 0x01, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0xbc, 0x99, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0x99, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd4, 0x99, 0x01, 0x00,
+  0xac, 0xab, 0x01, 0x00, 0xe0, 0x99, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xec, 0x99, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf8, 0x99, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0x10, 0x9a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x1c, 0x9a, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0x28, 0x9a, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0x34, 0x9a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x40, 0x9a, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x4c, 0x9a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x58, 0x9a, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x64, 0x9a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x70, 0x9a, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x7c, 0x9a, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0x9a, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0x94, 0x9a, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0xa0, 0x9a, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0xac, 0x9a, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0xb8, 0x9a, 0x01, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0xc4, 0x9a, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0xd0, 0x9a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xdc, 0x9a, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0xe8, 0x9a, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf4, 0x9a, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0x00, 0x9b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x0c, 0x9b, 0x01, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0x18, 0x9b, 0x01, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x24, 0x9b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x30, 0x9b, 0x01, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0x3c, 0x9b, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0x48, 0x9b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x54, 0x9b, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0x60, 0x9b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x6c, 0x9b, 0x01, 0x00, 0x25, 0xb0, 0x01, 0x00, 0x78, 0x9b, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x84, 0x9b, 0x01, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x90, 0x9b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x9c, 0x9b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x9b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb4, 0x9b, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xcc, 0x9b, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0x9b, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0xe4, 0x9b, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0xf0, 0x9b, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xfc, 0x9b, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x08, 0x9c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x14, 0x9c, 0x01, 0x00,
+  0x79, 0xac, 0x01, 0x00, 0x20, 0x9c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x2c, 0x9c, 0x01, 0x00,
+  0x93, 0xac, 0x01, 0x00, 0x38, 0x9c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x44, 0x9c, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x50, 0x9c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x5c, 0x9c, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x68, 0x9c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x74, 0x9c, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0x80, 0x9c, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0x8c, 0x9c, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x98, 0x9c, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0xa4, 0x9c, 0x01, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0xb0, 0x9c, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0xbc, 0x9c, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0x9c, 0x01, 0x00, 0x35, 0xab, 0x01, 0x00, 0xd4, 0x9c, 0x01, 0x00,
+  0x3f, 0xae, 0x01, 0x00, 0xe0, 0x9c, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0xec, 0x9c, 0x01, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0xf8, 0x9c, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x04, 0x9d, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0x10, 0x9d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x1c, 0x9d, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x28, 0x9d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x34, 0x9d, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x40, 0x9d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4c, 0x9d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x58, 0x9d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x64, 0x9d, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x7c, 0x9d, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x88, 0x9d, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0x94, 0x9d, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0xa0, 0x9d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xac, 0x9d, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0xb8, 0x9d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc4, 0x9d, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0xd0, 0x9d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xdc, 0x9d, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0xe8, 0x9d, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf4, 0x9d, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0x00, 0x9e, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0x0c, 0x9e, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0x18, 0x9e, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0x24, 0x9e, 0x01, 0x00, 0xcf, 0xad, 0x01, 0x00, 0x30, 0x9e, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0x3c, 0x9e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x48, 0x9e, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0x54, 0x9e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x60, 0x9e, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x6c, 0x9e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x78, 0x9e, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x84, 0x9e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x90, 0x9e, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x9c, 0x9e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa8, 0x9e, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc0, 0x9e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xd8, 0x9e, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0xf0, 0x9e, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xfc, 0x9e, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x08, 0x9f, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0x14, 0x9f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x20, 0x9f, 0x01, 0x00, 0x35, 0xab, 0x01, 0x00, 0x2c, 0x9f, 0x01, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x38, 0x9f, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0x44, 0x9f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x50, 0x9f, 0x01, 0x00, 0xac, 0xab, 0x01, 0x00, 0x5c, 0x9f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x68, 0x9f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x74, 0x9f, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x8c, 0x9f, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0x9f, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0xa4, 0x9f, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0xb0, 0x9f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xbc, 0x9f, 0x01, 0x00, 0x0b, 0xac, 0x01, 0x00, 0xc8, 0x9f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd4, 0x9f, 0x01, 0x00, 0x25, 0xac, 0x01, 0x00, 0xe0, 0x9f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xec, 0x9f, 0x01, 0x00, 0x2b, 0xac, 0x01, 0x00, 0xf8, 0x9f, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x04, 0xa0, 0x01, 0x00, 0x47, 0xac, 0x01, 0x00, 0x10, 0xa0, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x1c, 0xa0, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0x28, 0xa0, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x34, 0xa0, 0x01, 0x00, 0x79, 0xac, 0x01, 0x00, 0x40, 0xa0, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x4c, 0xa0, 0x01, 0x00, 0x93, 0xac, 0x01, 0x00, 0x58, 0xa0, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x64, 0xa0, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0x70, 0xa0, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x7c, 0xa0, 0x01, 0x00, 0x1d, 0xab, 0x01, 0x00, 0x88, 0xa0, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x94, 0xa0, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xa0, 0xa0, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0xac, 0xa0, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0xb8, 0xa0, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0xc4, 0xa0, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0xd0, 0xa0, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0xdc, 0xa0, 0x01, 0x00, 0xcf, 0xad, 0x01, 0x00, 0xe8, 0xa0, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0xf4, 0xa0, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x00, 0xa1, 0x01, 0x00,
+  0x26, 0xae, 0x01, 0x00, 0x0c, 0xa1, 0x01, 0x00, 0x35, 0xab, 0x01, 0x00, 0x18, 0xa1, 0x01, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x24, 0xa1, 0x01, 0x00, 0x3f, 0xae, 0x01, 0x00, 0x30, 0xa1, 0x01, 0x00,
+  0x71, 0xae, 0x01, 0x00, 0x3c, 0xa1, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0x48, 0xa1, 0x01, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0x54, 0xa1, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x60, 0xa1, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0x6c, 0xa1, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0x78, 0xa1, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x84, 0xa1, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0x90, 0xa1, 0x01, 0x00,
+  0x10, 0xaf, 0x01, 0x00, 0x9c, 0xa1, 0x01, 0x00, 0x20, 0xaf, 0x01, 0x00, 0xa8, 0xa1, 0x01, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0xb4, 0xa1, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0xc0, 0xa1, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xcc, 0xa1, 0x01, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0xd8, 0xa1, 0x01, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0xe4, 0xa1, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf0, 0xa1, 0x01, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0xfc, 0xa1, 0x01, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0x08, 0xa2, 0x01, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0x14, 0xa2, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x20, 0xa2, 0x01, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0x2c, 0xa2, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0xa2, 0x01, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0x44, 0xa2, 0x01, 0x00, 0x25, 0xb0, 0x01, 0x00, 0x50, 0xa2, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x5c, 0xa2, 0x01, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x68, 0xa2, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x74, 0xa2, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x80, 0xa2, 0x01, 0x00,
+  0xac, 0xab, 0x01, 0x00, 0x8c, 0xa2, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x98, 0xa2, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa4, 0xa2, 0x01, 0x00, 0xf1, 0xaa, 0x01, 0x00, 0xbc, 0xa2, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0xa2, 0x01, 0x00, 0xce, 0xab, 0x01, 0x00, 0xd4, 0xa2, 0x01, 0x00,
+  0xe3, 0xab, 0x01, 0x00, 0xe0, 0xa2, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xec, 0xa2, 0x01, 0x00,
+  0x0b, 0xac, 0x01, 0x00, 0xf8, 0xa2, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x04, 0xa3, 0x01, 0x00,
+  0x25, 0xac, 0x01, 0x00, 0x10, 0xa3, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x1c, 0xa3, 0x01, 0x00,
+  0x2b, 0xac, 0x01, 0x00, 0x28, 0xa3, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x34, 0xa3, 0x01, 0x00,
+  0x47, 0xac, 0x01, 0x00, 0x40, 0xa3, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x4c, 0xa3, 0x01, 0x00,
+  0x61, 0xac, 0x01, 0x00, 0x58, 0xa3, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x64, 0xa3, 0x01, 0x00,
+  0xb1, 0xac, 0x01, 0x00, 0x70, 0xa3, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x7c, 0xa3, 0x01, 0x00,
+  0x27, 0xab, 0x01, 0x00, 0x88, 0xa3, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x94, 0xa3, 0x01, 0x00,
+  0xd3, 0xac, 0x01, 0x00, 0xa0, 0xa3, 0x01, 0x00, 0xfb, 0xac, 0x01, 0x00, 0xac, 0xa3, 0x01, 0x00,
+  0x24, 0xad, 0x01, 0x00, 0xb8, 0xa3, 0x01, 0x00, 0x54, 0xad, 0x01, 0x00, 0xc4, 0xa3, 0x01, 0x00,
+  0xa6, 0xad, 0x01, 0x00, 0xd0, 0xa3, 0x01, 0x00, 0xcf, 0xad, 0x01, 0x00, 0xdc, 0xa3, 0x01, 0x00,
+  0xf8, 0xad, 0x01, 0x00, 0xe8, 0xa3, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xf4, 0xa3, 0x01, 0x00,
+  0x68, 0xab, 0x01, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x0c, 0xa4, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0x18, 0xa4, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0x24, 0xa4, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x30, 0xa4, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0x3c, 0xa4, 0x01, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0x48, 0xa4, 0x01, 0x00, 0x30, 0xaf, 0x01, 0x00, 0x54, 0xa4, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x60, 0xa4, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x6c, 0xa4, 0x01, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0x78, 0xa4, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x84, 0xa4, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x90, 0xa4, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x9c, 0xa4, 0x01, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0xa8, 0xa4, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0xb4, 0xa4, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc0, 0xa4, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0xcc, 0xa4, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd8, 0xa4, 0x01, 0x00, 0x14, 0xb0, 0x01, 0x00, 0xe4, 0xa4, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0xf0, 0xa4, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0xfc, 0xa4, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0x08, 0xa5, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x14, 0xa5, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x20, 0xa5, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x2c, 0xa5, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x44, 0xa5, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x50, 0xa5, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0x5c, 0xa5, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0x68, 0xa5, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x74, 0xa5, 0x01, 0x00, 0x0b, 0xac, 0x01, 0x00, 0x80, 0xa5, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x8c, 0xa5, 0x01, 0x00, 0x25, 0xac, 0x01, 0x00, 0x98, 0xa5, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa4, 0xa5, 0x01, 0x00, 0x2b, 0xac, 0x01, 0x00, 0xb0, 0xa5, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xbc, 0xa5, 0x01, 0x00, 0x47, 0xac, 0x01, 0x00, 0xc8, 0xa5, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xd4, 0xa5, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0xe0, 0xa5, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xec, 0xa5, 0x01, 0x00, 0x79, 0xac, 0x01, 0x00, 0xf8, 0xa5, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x04, 0xa6, 0x01, 0x00, 0x93, 0xac, 0x01, 0x00, 0x10, 0xa6, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x1c, 0xa6, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0x28, 0xa6, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x34, 0xa6, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0x40, 0xa6, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x4c, 0xa6, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0x58, 0xa6, 0x01, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x64, 0xa6, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0x70, 0xa6, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x7c, 0xa6, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x88, 0xa6, 0x01, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0x94, 0xa6, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0xa0, 0xa6, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xac, 0xa6, 0x01, 0x00, 0x26, 0xae, 0x01, 0x00, 0xb8, 0xa6, 0x01, 0x00,
+  0x35, 0xab, 0x01, 0x00, 0xc4, 0xa6, 0x01, 0x00, 0x68, 0xab, 0x01, 0x00, 0xd0, 0xa6, 0x01, 0x00,
+  0x3f, 0xae, 0x01, 0x00, 0xdc, 0xa6, 0x01, 0x00, 0x81, 0xab, 0x01, 0x00, 0xe8, 0xa6, 0x01, 0x00,
+  0x9b, 0xae, 0x01, 0x00, 0xf4, 0xa6, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x00, 0xa7, 0x01, 0x00,
+  0xe0, 0xae, 0x01, 0x00, 0x0c, 0xa7, 0x01, 0x00, 0xf0, 0xae, 0x01, 0x00, 0x18, 0xa7, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x24, 0xa7, 0x01, 0x00, 0x06, 0xaf, 0x01, 0x00, 0x30, 0xa7, 0x01, 0x00,
+  0x20, 0xaf, 0x01, 0x00, 0x3c, 0xa7, 0x01, 0x00, 0x30, 0xaf, 0x01, 0x00, 0x48, 0xa7, 0x01, 0x00,
+  0x40, 0xaf, 0x01, 0x00, 0x54, 0xa7, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x60, 0xa7, 0x01, 0x00,
+  0x5d, 0xaf, 0x01, 0x00, 0x6c, 0xa7, 0x01, 0x00, 0x6f, 0xaf, 0x01, 0x00, 0x78, 0xa7, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x84, 0xa7, 0x01, 0x00, 0xa3, 0xaf, 0x01, 0x00, 0x90, 0xa7, 0x01, 0x00,
+  0xb1, 0xaf, 0x01, 0x00, 0x9c, 0xa7, 0x01, 0x00, 0xc1, 0xaf, 0x01, 0x00, 0xa8, 0xa7, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb4, 0xa7, 0x01, 0x00, 0xda, 0xaf, 0x01, 0x00, 0xc0, 0xa7, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xcc, 0xa7, 0x01, 0x00, 0x14, 0xb0, 0x01, 0x00, 0xd8, 0xa7, 0x01, 0x00,
+  0x25, 0xb0, 0x01, 0x00, 0xe4, 0xa7, 0x01, 0x00, 0x36, 0xb0, 0x01, 0x00, 0xf0, 0xa7, 0x01, 0x00,
+  0x4a, 0xb0, 0x01, 0x00, 0xfc, 0xa7, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x08, 0xa8, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x14, 0xa8, 0x01, 0x00, 0xac, 0xab, 0x01, 0x00, 0x20, 0xa8, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x2c, 0xa8, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x38, 0xa8, 0x01, 0x00,
+  0xf1, 0xaa, 0x01, 0x00, 0x50, 0xa8, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x5c, 0xa8, 0x01, 0x00,
+  0xce, 0xab, 0x01, 0x00, 0x68, 0xa8, 0x01, 0x00, 0xe3, 0xab, 0x01, 0x00, 0x74, 0xa8, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x80, 0xa8, 0x01, 0x00, 0x0b, 0xac, 0x01, 0x00, 0x8c, 0xa8, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x98, 0xa8, 0x01, 0x00, 0x25, 0xac, 0x01, 0x00, 0xa4, 0xa8, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xb0, 0xa8, 0x01, 0x00, 0x2b, 0xac, 0x01, 0x00, 0xbc, 0xa8, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc8, 0xa8, 0x01, 0x00, 0x47, 0xac, 0x01, 0x00, 0xd4, 0xa8, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xe0, 0xa8, 0x01, 0x00, 0x61, 0xac, 0x01, 0x00, 0xec, 0xa8, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xf8, 0xa8, 0x01, 0x00, 0xb1, 0xac, 0x01, 0x00, 0x04, 0xa9, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x10, 0xa9, 0x01, 0x00, 0x27, 0xab, 0x01, 0x00, 0x1c, 0xa9, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x28, 0xa9, 0x01, 0x00, 0xd3, 0xac, 0x01, 0x00, 0x34, 0xa9, 0x01, 0x00,
+  0xfb, 0xac, 0x01, 0x00, 0x40, 0xa9, 0x01, 0x00, 0x24, 0xad, 0x01, 0x00, 0x4c, 0xa9, 0x01, 0x00,
+  0x54, 0xad, 0x01, 0x00, 0x58, 0xa9, 0x01, 0x00, 0xa6, 0xad, 0x01, 0x00, 0x64, 0xa9, 0x01, 0x00,
+  0xcf, 0xad, 0x01, 0x00, 0x70, 0xa9, 0x01, 0x00, 0xf8, 0xad, 0x01, 0x00, 0x7c, 0xa9, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x88, 0xa9, 0x01, 0x00, 0x68, 0xab, 0x01, 0x00, 0x94, 0xa9, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa0, 0xa9, 0x01, 0x00, 0xe0, 0xae, 0x01, 0x00, 0xac, 0xa9, 0x01, 0x00,
+  0xf0, 0xae, 0x01, 0x00, 0xb8, 0xa9, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xc4, 0xa9, 0x01, 0x00,
+  0x06, 0xaf, 0x01, 0x00, 0xd0, 0xa9, 0x01, 0x00, 0x20, 0xaf, 0x01, 0x00, 0xdc, 0xa9, 0x01, 0x00,
+  0x30, 0xaf, 0x01, 0x00, 0xe8, 0xa9, 0x01, 0x00, 0x40, 0xaf, 0x01, 0x00, 0xf4, 0xa9, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0x00, 0xaa, 0x01, 0x00, 0x5d, 0xaf, 0x01, 0x00, 0x0c, 0xaa, 0x01, 0x00,
+  0x6f, 0xaf, 0x01, 0x00, 0x18, 0xaa, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x24, 0xaa, 0x01, 0x00,
+  0xa3, 0xaf, 0x01, 0x00, 0x30, 0xaa, 0x01, 0x00, 0xb1, 0xaf, 0x01, 0x00, 0x3c, 0xaa, 0x01, 0x00,
+  0xc1, 0xaf, 0x01, 0x00, 0x48, 0xaa, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x54, 0xaa, 0x01, 0x00,
+  0xda, 0xaf, 0x01, 0x00, 0x60, 0xaa, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0x6c, 0xaa, 0x01, 0x00,
+  0x14, 0xb0, 0x01, 0x00, 0x78, 0xaa, 0x01, 0x00, 0x25, 0xb0, 0x01, 0x00, 0x84, 0xaa, 0x01, 0x00,
+  0x36, 0xb0, 0x01, 0x00, 0x90, 0xaa, 0x01, 0x00, 0x4a, 0xb0, 0x01, 0x00, 0x9c, 0xaa, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xa8, 0xaa, 0x01, 0x00, 0x03, 0xab, 0x01, 0x00, 0xb4, 0xaa, 0x01, 0x00,
+  0x03, 0xab, 0x01, 0x00, 0xc0, 0xaa, 0x01, 0x00, 0xcc, 0xaa, 0x01, 0x00, 0xd6, 0xaa, 0x01, 0x00,
+  0xe0, 0xaa, 0x01, 0x00, 0xe8, 0xaa, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xcc, 0xaa, 0x01, 0x00, 0xd6, 0xaa, 0x01, 0x00,
+  0xe0, 0xaa, 0x01, 0x00, 0xe8, 0xaa, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcc, 0xaa, 0x01, 0x00, 0xd6, 0xaa, 0x01, 0x00,
+  0xe0, 0xaa, 0x01, 0x00, 0xe8, 0xaa, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcc, 0xaa, 0x01, 0x00, 0xd6, 0xaa, 0x01, 0x00,
+  0xe0, 0xaa, 0x01, 0x00, 0xe8, 0xaa, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xcc, 0xaa, 0x01, 0x00, 0xd6, 0xaa, 0x01, 0x00,
+  0xe0, 0xaa, 0x01, 0x00, 0xe8, 0xaa, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x68, 0xb0, 0x01, 0x00, 0x80, 0xb0, 0x01, 0x00,
+  0x93, 0xb0, 0x01, 0x00, 0xa5, 0xb0, 0x01, 0x00, 0xb8, 0xb0, 0x01, 0x00, 0xd1, 0xb0, 0x01, 0x00,
+  0xe9, 0xb0, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xb0, 0x01, 0x00,
+  0x80, 0xb0, 0x01, 0x00, 0x93, 0xb0, 0x01, 0x00, 0xa5, 0xb0, 0x01, 0x00, 0xb8, 0xb0, 0x01, 0x00,
+  0xd1, 0xb0, 0x01, 0x00, 0xe9, 0xb0, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x80, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x06, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xb0, 0x01, 0x00, 0x80, 0xb0, 0x01, 0x00,
+  0x93, 0xb0, 0x01, 0x00, 0xa5, 0xb0, 0x01, 0x00, 0xb8, 0xb0, 0x01, 0x00, 0xd1, 0xb0, 0x01, 0x00,
+  0xe9, 0xb0, 0x01, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x68, 0xb0, 0x01, 0x00, 0x80, 0xb0, 0x01, 0x00, 0x93, 0xb0, 0x01, 0x00, 0xa5, 0xb0, 0x01, 0x00,
+  0xb8, 0xb0, 0x01, 0x00, 0xd1, 0xb0, 0x01, 0x00, 0xe9, 0xb0, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x05, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc0, 0x05, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x05, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x68, 0xb0, 0x01, 0x00, 0x80, 0xb0, 0x01, 0x00, 0x93, 0xb0, 0x01, 0x00, 0xa5, 0xb0, 0x01, 0x00,
+  0xb8, 0xb0, 0x01, 0x00, 0xd1, 0xb0, 0x01, 0x00, 0xe9, 0xb0, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xb1, 0x01, 0x00, 0x1e, 0xb1, 0x01, 0x00,
+  0x27, 0xb1, 0x01, 0x00, 0x2f, 0xb1, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0a, 0xb1, 0x01, 0x00, 0x1e, 0xb1, 0x01, 0x00,
+  0x27, 0xb1, 0x01, 0x00, 0x2f, 0xb1, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0a, 0xb1, 0x01, 0x00, 0x1e, 0xb1, 0x01, 0x00,
+  0x27, 0xb1, 0x01, 0x00, 0x2f, 0xb1, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0a, 0xb1, 0x01, 0x00, 0x1e, 0xb1, 0x01, 0x00,
+  0x27, 0xb1, 0x01, 0x00, 0x2f, 0xb1, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0a, 0xb1, 0x01, 0x00, 0x1e, 0xb1, 0x01, 0x00,
+  0x27, 0xb1, 0x01, 0x00, 0x2f, 0xb1, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0xb1, 0x01, 0x00, 0x47, 0xb1, 0x01, 0x00,
+  0x50, 0xb1, 0x01, 0x00, 0x59, 0xb1, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3e, 0xb1, 0x01, 0x00, 0x47, 0xb1, 0x01, 0x00,
+  0x50, 0xb1, 0x01, 0x00, 0x59, 0xb1, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3e, 0xb1, 0x01, 0x00, 0x47, 0xb1, 0x01, 0x00,
+  0x50, 0xb1, 0x01, 0x00, 0x59, 0xb1, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3e, 0xb1, 0x01, 0x00, 0x47, 0xb1, 0x01, 0x00,
+  0x50, 0xb1, 0x01, 0x00, 0x59, 0xb1, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3e, 0xb1, 0x01, 0x00, 0x47, 0xb1, 0x01, 0x00,
+  0x50, 0xb1, 0x01, 0x00, 0x59, 0xb1, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x66, 0xb1, 0x01, 0x00, 0x71, 0xb1, 0x01, 0x00,
+  0x7d, 0xb1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x66, 0xb1, 0x01, 0x00, 0x71, 0xb1, 0x01, 0x00, 0x7d, 0xb1, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x66, 0xb1, 0x01, 0x00, 0x71, 0xb1, 0x01, 0x00, 0x7d, 0xb1, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x66, 0xb1, 0x01, 0x00, 0x71, 0xb1, 0x01, 0x00, 0x7d, 0xb1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x66, 0xb1, 0x01, 0x00,
+  0x71, 0xb1, 0x01, 0x00, 0x7d, 0xb1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x95, 0xb1, 0x01, 0x00, 0x9d, 0xb1, 0x01, 0x00,
+  0xa5, 0xb1, 0x01, 0x00, 0xb1, 0xb1, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x95, 0xb1, 0x01, 0x00, 0x9d, 0xb1, 0x01, 0x00,
+  0xa5, 0xb1, 0x01, 0x00, 0xb1, 0xb1, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x95, 0xb1, 0x01, 0x00, 0x9d, 0xb1, 0x01, 0x00,
+  0xa5, 0xb1, 0x01, 0x00, 0xb1, 0xb1, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x95, 0xb1, 0x01, 0x00, 0x9d, 0xb1, 0x01, 0x00,
+  0xa5, 0xb1, 0x01, 0x00, 0xb1, 0xb1, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x95, 0xb1, 0x01, 0x00, 0x9d, 0xb1, 0x01, 0x00,
+  0xa5, 0xb1, 0x01, 0x00, 0xb1, 0xb1, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc3, 0xb1, 0x01, 0x00, 0xd3, 0xb1, 0x01, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xb1, 0x01, 0x00, 0xd3, 0xb1, 0x01, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xb1, 0x01, 0x00, 0xd3, 0xb1, 0x01, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xb1, 0x01, 0x00, 0xd3, 0xb1, 0x01, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xb1, 0x01, 0x00, 0xd3, 0xb1, 0x01, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xb1, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xf6, 0xb1, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xf6, 0xb1, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0xf6, 0xb1, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xf6, 0xb1, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x12, 0xb2, 0x01, 0x00, 0x15, 0xb2, 0x01, 0x00, 0x19, 0xb2, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0xb2, 0x01, 0x00, 0x15, 0xb2, 0x01, 0x00,
+  0x19, 0xb2, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0xb2, 0x01, 0x00, 0x15, 0xb2, 0x01, 0x00,
+  0x19, 0xb2, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x12, 0xb2, 0x01, 0x00, 0x15, 0xb2, 0x01, 0x00, 0x19, 0xb2, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x12, 0xb2, 0x01, 0x00,
+  0x15, 0xb2, 0x01, 0x00, 0x19, 0xb2, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0xb2, 0x01, 0x00, 0x15, 0xb2, 0x01, 0x00,
+  0x19, 0xb2, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x23, 0xb2, 0x01, 0x00, 0x28, 0xb2, 0x01, 0x00, 0x2f, 0xb2, 0x01, 0x00,
+  0x36, 0xb2, 0x01, 0x00, 0x3d, 0xb2, 0x01, 0x00, 0x44, 0xb2, 0x01, 0x00, 0x49, 0xb2, 0x01, 0x00,
+  0x4e, 0xb2, 0x01, 0x00, 0x53, 0xb2, 0x01, 0x00, 0x58, 0xb2, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x23, 0xb2, 0x01, 0x00, 0x28, 0xb2, 0x01, 0x00, 0x2f, 0xb2, 0x01, 0x00,
+  0x36, 0xb2, 0x01, 0x00, 0x3d, 0xb2, 0x01, 0x00, 0x44, 0xb2, 0x01, 0x00, 0x49, 0xb2, 0x01, 0x00,
+  0x4e, 0xb2, 0x01, 0x00, 0x53, 0xb2, 0x01, 0x00, 0x58, 0xb2, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x23, 0xb2, 0x01, 0x00, 0x28, 0xb2, 0x01, 0x00, 0x2f, 0xb2, 0x01, 0x00,
+  0x36, 0xb2, 0x01, 0x00, 0x3d, 0xb2, 0x01, 0x00, 0x44, 0xb2, 0x01, 0x00, 0x49, 0xb2, 0x01, 0x00,
+  0x4e, 0xb2, 0x01, 0x00, 0x53, 0xb2, 0x01, 0x00, 0x58, 0xb2, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x23, 0xb2, 0x01, 0x00, 0x28, 0xb2, 0x01, 0x00, 0x2f, 0xb2, 0x01, 0x00,
+  0x36, 0xb2, 0x01, 0x00, 0x3d, 0xb2, 0x01, 0x00, 0x44, 0xb2, 0x01, 0x00, 0x49, 0xb2, 0x01, 0x00,
+  0x4e, 0xb2, 0x01, 0x00, 0x53, 0xb2, 0x01, 0x00, 0x58, 0xb2, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x23, 0xb2, 0x01, 0x00, 0x28, 0xb2, 0x01, 0x00, 0x2f, 0xb2, 0x01, 0x00,
+  0x36, 0xb2, 0x01, 0x00, 0x3d, 0xb2, 0x01, 0x00, 0x44, 0xb2, 0x01, 0x00, 0x49, 0xb2, 0x01, 0x00,
+  0x4e, 0xb2, 0x01, 0x00, 0x53, 0xb2, 0x01, 0x00, 0x58, 0xb2, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x66, 0xb2, 0x01, 0x00, 0x6b, 0xb2, 0x01, 0x00, 0x70, 0xb2, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x66, 0xb2, 0x01, 0x00,
+  0x6b, 0xb2, 0x01, 0x00, 0x70, 0xb2, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x66, 0xb2, 0x01, 0x00, 0x6b, 0xb2, 0x01, 0x00, 0x70, 0xb2, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x66, 0xb2, 0x01, 0x00,
+  0x6b, 0xb2, 0x01, 0x00, 0x70, 0xb2, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x66, 0xb2, 0x01, 0x00,
+  0x6b, 0xb2, 0x01, 0x00, 0x70, 0xb2, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x86, 0xb2, 0x01, 0x00, 0x8c, 0xb2, 0x01, 0x00,
+  0x91, 0xb2, 0x01, 0x00, 0x95, 0xb2, 0x01, 0x00, 0x99, 0xb2, 0x01, 0x00, 0x9f, 0xb2, 0x01, 0x00,
+  0xa5, 0xb2, 0x01, 0x00, 0xa9, 0xb2, 0x01, 0x00, 0xaf, 0xb2, 0x01, 0x00, 0xb5, 0xb2, 0x01, 0x00,
+  0xb9, 0xb2, 0x01, 0x00, 0xbc, 0xb2, 0x01, 0x00, 0xbf, 0xb2, 0x01, 0x00, 0xc4, 0xb2, 0x01, 0x00,
+  0xc9, 0xb2, 0x01, 0x00, 0xcd, 0xb2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x86, 0xb2, 0x01, 0x00, 0x8c, 0xb2, 0x01, 0x00,
+  0x91, 0xb2, 0x01, 0x00, 0x95, 0xb2, 0x01, 0x00, 0x99, 0xb2, 0x01, 0x00, 0x9f, 0xb2, 0x01, 0x00,
+  0xa5, 0xb2, 0x01, 0x00, 0xa9, 0xb2, 0x01, 0x00, 0xaf, 0xb2, 0x01, 0x00, 0xb5, 0xb2, 0x01, 0x00,
+  0xb9, 0xb2, 0x01, 0x00, 0xbc, 0xb2, 0x01, 0x00, 0xbf, 0xb2, 0x01, 0x00, 0xc4, 0xb2, 0x01, 0x00,
+  0xc9, 0xb2, 0x01, 0x00, 0xcd, 0xb2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x86, 0xb2, 0x01, 0x00, 0x8c, 0xb2, 0x01, 0x00,
+  0x91, 0xb2, 0x01, 0x00, 0x95, 0xb2, 0x01, 0x00, 0x99, 0xb2, 0x01, 0x00, 0x9f, 0xb2, 0x01, 0x00,
+  0xa5, 0xb2, 0x01, 0x00, 0xa9, 0xb2, 0x01, 0x00, 0xaf, 0xb2, 0x01, 0x00, 0xb5, 0xb2, 0x01, 0x00,
+  0xb9, 0xb2, 0x01, 0x00, 0xbc, 0xb2, 0x01, 0x00, 0xbf, 0xb2, 0x01, 0x00, 0xc4, 0xb2, 0x01, 0x00,
+  0xc9, 0xb2, 0x01, 0x00, 0xcd, 0xb2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x86, 0xb2, 0x01, 0x00, 0x8c, 0xb2, 0x01, 0x00,
+  0x91, 0xb2, 0x01, 0x00, 0x95, 0xb2, 0x01, 0x00, 0x99, 0xb2, 0x01, 0x00, 0x9f, 0xb2, 0x01, 0x00,
+  0xa5, 0xb2, 0x01, 0x00, 0xa9, 0xb2, 0x01, 0x00, 0xaf, 0xb2, 0x01, 0x00, 0xb5, 0xb2, 0x01, 0x00,
+  0xb9, 0xb2, 0x01, 0x00, 0xbc, 0xb2, 0x01, 0x00, 0xbf, 0xb2, 0x01, 0x00, 0xc4, 0xb2, 0x01, 0x00,
+  0xc9, 0xb2, 0x01, 0x00, 0xcd, 0xb2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x86, 0xb2, 0x01, 0x00, 0x8c, 0xb2, 0x01, 0x00,
+  0x91, 0xb2, 0x01, 0x00, 0x95, 0xb2, 0x01, 0x00, 0x99, 0xb2, 0x01, 0x00, 0x9f, 0xb2, 0x01, 0x00,
+  0xa5, 0xb2, 0x01, 0x00, 0xa9, 0xb2, 0x01, 0x00, 0xaf, 0xb2, 0x01, 0x00, 0xb5, 0xb2, 0x01, 0x00,
+  0xb9, 0xb2, 0x01, 0x00, 0xbc, 0xb2, 0x01, 0x00, 0xbf, 0xb2, 0x01, 0x00, 0xc4, 0xb2, 0x01, 0x00,
+  0xc9, 0xb2, 0x01, 0x00, 0xcd, 0xb2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x86, 0xb2, 0x01, 0x00, 0x8c, 0xb2, 0x01, 0x00,
+  0x91, 0xb2, 0x01, 0x00, 0x95, 0xb2, 0x01, 0x00, 0x99, 0xb2, 0x01, 0x00, 0x9f, 0xb2, 0x01, 0x00,
+  0xa5, 0xb2, 0x01, 0x00, 0xa9, 0xb2, 0x01, 0x00, 0xaf, 0xb2, 0x01, 0x00, 0xb5, 0xb2, 0x01, 0x00,
+  0xb9, 0xb2, 0x01, 0x00, 0xbc, 0xb2, 0x01, 0x00, 0xbf, 0xb2, 0x01, 0x00, 0xc4, 0xb2, 0x01, 0x00,
+  0xc9, 0xb2, 0x01, 0x00, 0xcd, 0xb2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x86, 0xb2, 0x01, 0x00, 0x8c, 0xb2, 0x01, 0x00,
+  0x91, 0xb2, 0x01, 0x00, 0x95, 0xb2, 0x01, 0x00, 0x99, 0xb2, 0x01, 0x00, 0x9f, 0xb2, 0x01, 0x00,
+  0xa5, 0xb2, 0x01, 0x00, 0xa9, 0xb2, 0x01, 0x00, 0xaf, 0xb2, 0x01, 0x00, 0xb5, 0xb2, 0x01, 0x00,
+  0xb9, 0xb2, 0x01, 0x00, 0xbc, 0xb2, 0x01, 0x00, 0xbf, 0xb2, 0x01, 0x00, 0xc4, 0xb2, 0x01, 0x00,
+  0xc9, 0xb2, 0x01, 0x00, 0xcd, 0xb2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x86, 0xb2, 0x01, 0x00, 0x8c, 0xb2, 0x01, 0x00,
+  0x91, 0xb2, 0x01, 0x00, 0x95, 0xb2, 0x01, 0x00, 0x99, 0xb2, 0x01, 0x00, 0x9f, 0xb2, 0x01, 0x00,
+  0xa5, 0xb2, 0x01, 0x00, 0xa9, 0xb2, 0x01, 0x00, 0xaf, 0xb2, 0x01, 0x00, 0xb5, 0xb2, 0x01, 0x00,
+  0xb9, 0xb2, 0x01, 0x00, 0xbc, 0xb2, 0x01, 0x00, 0xbf, 0xb2, 0x01, 0x00, 0xc4, 0xb2, 0x01, 0x00,
+  0xc9, 0xb2, 0x01, 0x00, 0xcd, 0xb2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x23, 0xb2, 0x01, 0x00, 0x28, 0xb2, 0x01, 0x00,
+  0x2f, 0xb2, 0x01, 0x00, 0x36, 0xb2, 0x01, 0x00, 0x3d, 0xb2, 0x01, 0x00, 0x44, 0xb2, 0x01, 0x00,
+  0x49, 0xb2, 0x01, 0x00, 0x4e, 0xb2, 0x01, 0x00, 0x53, 0xb2, 0x01, 0x00, 0x58, 0xb2, 0x01, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x23, 0xb2, 0x01, 0x00, 0x28, 0xb2, 0x01, 0x00, 0x2f, 0xb2, 0x01, 0x00, 0x36, 0xb2, 0x01, 0x00,
+  0x3d, 0xb2, 0x01, 0x00, 0x44, 0xb2, 0x01, 0x00, 0x49, 0xb2, 0x01, 0x00, 0x4e, 0xb2, 0x01, 0x00,
+  0x53, 0xb2, 0x01, 0x00, 0x58, 0xb2, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x23, 0xb2, 0x01, 0x00, 0x28, 0xb2, 0x01, 0x00,
+  0x2f, 0xb2, 0x01, 0x00, 0x36, 0xb2, 0x01, 0x00, 0x3d, 0xb2, 0x01, 0x00, 0x44, 0xb2, 0x01, 0x00,
+  0x49, 0xb2, 0x01, 0x00, 0x4e, 0xb2, 0x01, 0x00, 0x53, 0xb2, 0x01, 0x00, 0x58, 0xb2, 0x01, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x23, 0xb2, 0x01, 0x00, 0x28, 0xb2, 0x01, 0x00,
+  0x2f, 0xb2, 0x01, 0x00, 0x36, 0xb2, 0x01, 0x00, 0x3d, 0xb2, 0x01, 0x00, 0x44, 0xb2, 0x01, 0x00,
+  0x49, 0xb2, 0x01, 0x00, 0x4e, 0xb2, 0x01, 0x00, 0x53, 0xb2, 0x01, 0x00, 0x58, 0xb2, 0x01, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x23, 0xb2, 0x01, 0x00, 0x28, 0xb2, 0x01, 0x00,
+  0x2f, 0xb2, 0x01, 0x00, 0x36, 0xb2, 0x01, 0x00, 0x3d, 0xb2, 0x01, 0x00, 0x44, 0xb2, 0x01, 0x00,
+  0x49, 0xb2, 0x01, 0x00, 0x4e, 0xb2, 0x01, 0x00, 0x53, 0xb2, 0x01, 0x00, 0x58, 0xb2, 0x01, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x66, 0xb2, 0x01, 0x00, 0x13, 0xb3, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x66, 0xb2, 0x01, 0x00, 0x13, 0xb3, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x66, 0xb2, 0x01, 0x00, 0x13, 0xb3, 0x01, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x66, 0xb2, 0x01, 0x00, 0x13, 0xb3, 0x01, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x66, 0xb2, 0x01, 0x00, 0x13, 0xb3, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1e, 0xb3, 0x01, 0x00, 0x23, 0xb3, 0x01, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1e, 0xb3, 0x01, 0x00, 0x23, 0xb3, 0x01, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1e, 0xb3, 0x01, 0x00, 0x23, 0xb3, 0x01, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1e, 0xb3, 0x01, 0x00, 0x23, 0xb3, 0x01, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1e, 0xb3, 0x01, 0x00, 0x23, 0xb3, 0x01, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0xb3, 0x01, 0x00, 0x6b, 0xb2, 0x01, 0x00,
+  0x38, 0xb3, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0xb3, 0x01, 0x00, 0x6b, 0xb2, 0x01, 0x00,
+  0x38, 0xb3, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x34, 0xb3, 0x01, 0x00, 0x6b, 0xb2, 0x01, 0x00, 0x38, 0xb3, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0xb3, 0x01, 0x00, 0x6b, 0xb2, 0x01, 0x00,
+  0x38, 0xb3, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x34, 0xb3, 0x01, 0x00, 0x6b, 0xb2, 0x01, 0x00, 0x38, 0xb3, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0xb3, 0x01, 0x00,
+  0x4b, 0xb3, 0x01, 0x00, 0x50, 0xb3, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x47, 0xb3, 0x01, 0x00, 0x4b, 0xb3, 0x01, 0x00, 0x50, 0xb3, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x47, 0xb3, 0x01, 0x00, 0x4b, 0xb3, 0x01, 0x00, 0x50, 0xb3, 0x01, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x47, 0xb3, 0x01, 0x00, 0x4b, 0xb3, 0x01, 0x00, 0x50, 0xb3, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x47, 0xb3, 0x01, 0x00, 0x4b, 0xb3, 0x01, 0x00, 0x50, 0xb3, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x62, 0xb3, 0x01, 0x00, 0x6b, 0xb3, 0x01, 0x00, 0x70, 0xb3, 0x01, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x62, 0xb3, 0x01, 0x00,
+  0x6b, 0xb3, 0x01, 0x00, 0x70, 0xb3, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x66, 0xb2, 0x01, 0x00, 0x6b, 0xb2, 0x01, 0x00, 0x19, 0xb2, 0x01, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x66, 0xb2, 0x01, 0x00, 0x6b, 0xb2, 0x01, 0x00, 0x19, 0xb2, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x66, 0xb2, 0x01, 0x00, 0x6b, 0xb2, 0x01, 0x00, 0x19, 0xb2, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x66, 0xb2, 0x01, 0x00, 0x6b, 0xb2, 0x01, 0x00,
+  0x19, 0xb2, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x66, 0xb2, 0x01, 0x00, 0x6b, 0xb2, 0x01, 0x00, 0x19, 0xb2, 0x01, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x50, 0x59,
+  0x5f, 0x44, 0x49, 0x4d, 0x58, 0x00, 0x43, 0x4f, 0x50, 0x59, 0x5f, 0x44, 0x49, 0x4d, 0x59, 0x00,
+  0x43, 0x4f, 0x50, 0x59, 0x5f, 0x56, 0x57, 0x00, 0x43, 0x4f, 0x50, 0x59, 0x5f, 0x57, 0x50, 0x54,
+  0x00, 0x41, 0x4d, 0x44, 0x20, 0x52, 0x61, 0x64, 0x65, 0x6f, 0x6e, 0x20, 0x52, 0x58, 0x20, 0x34,
+  0x38, 0x30, 0x00, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x45, 0x6c, 0x6c, 0x65, 0x73,
+  0x6d, 0x65, 0x72, 0x65, 0x00, 0x47, 0x50, 0x55, 0x00, 0x41, 0x4d, 0x44, 0x00, 0x4d, 0x61, 0x6c,
+  0x69, 0x2d, 0x54, 0x36, 0x32, 0x38, 0x00, 0x4d, 0x61, 0x6c, 0x69, 0x2d, 0x54, 0x37, 0x36, 0x30,
+  0x00, 0x41, 0x52, 0x4d, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x6c, 0x28, 0x52, 0x29, 0x20, 0x48, 0x44,
+  0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x73, 0x20, 0x35, 0x35, 0x30, 0x30, 0x20, 0x42,
+  0x72, 0x6f, 0x61, 0x64, 0x57, 0x65, 0x6c, 0x6c, 0x20, 0x55, 0x2d, 0x50, 0x72, 0x6f, 0x63, 0x65,
+  0x73, 0x73, 0x6f, 0x72, 0x20, 0x47, 0x54, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x6c, 0x28, 0x52, 0x29,
+  0x20, 0x48, 0x44, 0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x73, 0x20, 0x36, 0x32, 0x30,
+  0x00, 0x49, 0x6e, 0x74, 0x65, 0x6c, 0x28, 0x52, 0x29, 0x20, 0x48, 0x44, 0x20, 0x47, 0x72, 0x61,
+  0x70, 0x68, 0x69, 0x63, 0x73, 0x20, 0x53, 0x6b, 0x79, 0x6c, 0x61, 0x6b, 0x65, 0x20, 0x55, 0x4c,
+  0x54, 0x20, 0x47, 0x54, 0x32, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x6c, 0x00, 0x51, 0x55, 0x41, 0x4c,
+  0x43, 0x4f, 0x4d, 0x4d, 0x20, 0x41, 0x64, 0x72, 0x65, 0x6e, 0x6f, 0x28, 0x54, 0x4d, 0x29, 0x00,
+  0x51, 0x55, 0x41, 0x4c, 0x43, 0x4f, 0x4d, 0x4d, 0x00, 0x43, 0x6f, 0x70, 0x79, 0x00, 0x41, 0x4d,
+  0x44, 0x20, 0x52, 0x61, 0x64, 0x65, 0x6f, 0x6e, 0x20, 0x52, 0x39, 0x20, 0x46, 0x75, 0x72, 0x79,
+  0x20, 0x58, 0x00, 0x41, 0x4d, 0x44, 0x20, 0x52, 0x61, 0x64, 0x65, 0x6f, 0x6e, 0x20, 0x52, 0x39,
+  0x20, 0x4d, 0x33, 0x37, 0x30, 0x58, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x20, 0x45,
+  0x6e, 0x67, 0x69, 0x6e, 0x65, 0x00, 0x46, 0x69, 0x6a, 0x69, 0x00, 0x41, 0x4d, 0x44, 0x20, 0x52,
+  0x61, 0x64, 0x65, 0x6f, 0x6e, 0x20, 0x52, 0x39, 0x20, 0x32, 0x39, 0x30, 0x58, 0x00, 0x48, 0x61,
+  0x77, 0x61, 0x69, 0x69, 0x00, 0x4f, 0x6c, 0x61, 0x6e, 0x64, 0x00, 0x41, 0x4d, 0x44, 0x20, 0x52,
+  0x61, 0x64, 0x65, 0x6f, 0x6e, 0x20, 0x52, 0x39, 0x20, 0x32, 0x37, 0x30, 0x58, 0x00, 0x50, 0x69,
+  0x74, 0x63, 0x61, 0x69, 0x72, 0x6e, 0x00, 0x41, 0x4d, 0x44, 0x20, 0x52, 0x61, 0x64, 0x65, 0x6f,
+  0x6e, 0x20, 0x48, 0x44, 0x20, 0x37, 0x39, 0x37, 0x30, 0x00, 0x54, 0x61, 0x68, 0x69, 0x74, 0x69,
+  0x00, 0x41, 0x4d, 0x44, 0x20, 0x52, 0x61, 0x64, 0x65, 0x6f, 0x6e, 0x20, 0x52, 0x39, 0x20, 0x33,
+  0x38, 0x30, 0x00, 0x54, 0x6f, 0x6e, 0x67, 0x61, 0x00, 0x41, 0x4d, 0x44, 0x20, 0x52, 0x61, 0x64,
+  0x65, 0x6f, 0x6e, 0x20, 0x48, 0x44, 0x20, 0x36, 0x37, 0x37, 0x30, 0x4d, 0x00, 0x54, 0x75, 0x72,
+  0x6b, 0x73, 0x00, 0x41, 0x54, 0x49, 0x20, 0x52, 0x61, 0x64, 0x65, 0x6f, 0x6e, 0x20, 0x48, 0x44,
+  0x20, 0x36, 0x37, 0x35, 0x30, 0x4d, 0x00, 0x56, 0x61, 0x6e, 0x63, 0x6f, 0x75, 0x76, 0x65, 0x72,
+  0x00, 0x41, 0x4d, 0x44, 0x20, 0x52, 0x61, 0x64, 0x65, 0x6f, 0x6e, 0x20, 0x50, 0x72, 0x6f, 0x20,
+  0x35, 0x38, 0x30, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x20, 0x45, 0x6e, 0x67, 0x69,
+  0x6e, 0x65, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x6c, 0x28, 0x52, 0x29, 0x20, 0x43, 0x6f, 0x72, 0x65,
+  0x28, 0x54, 0x4d, 0x29, 0x20, 0x69, 0x35, 0x2d, 0x34, 0x35, 0x37, 0x30, 0x20, 0x43, 0x50, 0x55,
+  0x20, 0x40, 0x20, 0x33, 0x2e, 0x32, 0x30, 0x47, 0x48, 0x7a, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x6c,
+  0x28, 0x52, 0x29, 0x20, 0x43, 0x6f, 0x72, 0x65, 0x28, 0x54, 0x4d, 0x29, 0x20, 0x69, 0x35, 0x2d,
+  0x36, 0x32, 0x30, 0x30, 0x55, 0x20, 0x43, 0x50, 0x55, 0x20, 0x40, 0x20, 0x32, 0x2e, 0x33, 0x30,
+  0x47, 0x48, 0x7a, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x6c, 0x28, 0x52, 0x29, 0x20, 0x43, 0x6f, 0x72,
+  0x65, 0x28, 0x54, 0x4d, 0x29, 0x20, 0x69, 0x37, 0x20, 0x43, 0x50, 0x55, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x39, 0x32, 0x30, 0x20, 0x20, 0x40, 0x20, 0x32, 0x2e, 0x36, 0x37,
+  0x47, 0x48, 0x7a, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x6c, 0x28, 0x52, 0x29, 0x20, 0x43, 0x6f, 0x72,
+  0x65, 0x28, 0x54, 0x4d, 0x29, 0x20, 0x69, 0x37, 0x2d, 0x32, 0x36, 0x37, 0x30, 0x51, 0x4d, 0x20,
+  0x43, 0x50, 0x55, 0x20, 0x40, 0x20, 0x32, 0x2e, 0x32, 0x30, 0x47, 0x48, 0x7a, 0x00, 0x49, 0x6e,
+  0x74, 0x65, 0x6c, 0x28, 0x52, 0x29, 0x20, 0x43, 0x6f, 0x72, 0x65, 0x28, 0x54, 0x4d, 0x29, 0x20,
+  0x69, 0x37, 0x2d, 0x33, 0x37, 0x37, 0x30, 0x20, 0x43, 0x50, 0x55, 0x20, 0x40, 0x20, 0x33, 0x2e,
+  0x34, 0x30, 0x47, 0x48, 0x7a, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x6c, 0x28, 0x52, 0x29, 0x20, 0x43,
+  0x6f, 0x72, 0x65, 0x28, 0x54, 0x4d, 0x29, 0x20, 0x69, 0x37, 0x2d, 0x34, 0x37, 0x39, 0x30, 0x4b,
+  0x20, 0x43, 0x50, 0x55, 0x20, 0x40, 0x20, 0x34, 0x2e, 0x30, 0x30, 0x47, 0x48, 0x7a, 0x00, 0x49,
+  0x6e, 0x74, 0x65, 0x6c, 0x28, 0x52, 0x29, 0x20, 0x43, 0x6f, 0x72, 0x65, 0x28, 0x54, 0x4d, 0x29,
+  0x20, 0x69, 0x37, 0x2d, 0x35, 0x39, 0x33, 0x30, 0x4b, 0x20, 0x43, 0x50, 0x55, 0x20, 0x40, 0x20,
+  0x33, 0x2e, 0x35, 0x30, 0x47, 0x48, 0x7a, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x6c, 0x28, 0x52, 0x29,
+  0x20, 0x43, 0x6f, 0x72, 0x65, 0x28, 0x54, 0x4d, 0x29, 0x20, 0x69, 0x37, 0x2d, 0x36, 0x37, 0x37,
+  0x30, 0x48, 0x51, 0x20, 0x43, 0x50, 0x55, 0x20, 0x40, 0x20, 0x32, 0x2e, 0x36, 0x30, 0x47, 0x48,
+  0x7a, 0x00, 0x43, 0x50, 0x55, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x6c, 0x28, 0x52, 0x29, 0x20, 0x48,
+  0x44, 0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x73, 0x20, 0x35, 0x33, 0x30, 0x00, 0x49,
+  0x6e, 0x74, 0x65, 0x6c, 0x28, 0x52, 0x29, 0x20, 0x48, 0x44, 0x20, 0x47, 0x72, 0x61, 0x70, 0x68,
+  0x69, 0x63, 0x73, 0x20, 0x48, 0x61, 0x73, 0x77, 0x65, 0x6c, 0x6c, 0x20, 0x55, 0x6c, 0x74, 0x72,
+  0x61, 0x62, 0x6f, 0x6f, 0x6b, 0x20, 0x47, 0x54, 0x32, 0x20, 0x4d, 0x6f, 0x62, 0x69, 0x6c, 0x65,
+  0x00, 0x49, 0x6e, 0x74, 0x65, 0x6c, 0x28, 0x52, 0x29, 0x20, 0x48, 0x44, 0x20, 0x47, 0x72, 0x61,
+  0x70, 0x68, 0x69, 0x63, 0x73, 0x20, 0x49, 0x76, 0x79, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x20,
+  0x4d, 0x20, 0x47, 0x54, 0x32, 0x00, 0x49, 0x72, 0x69, 0x73, 0x00, 0x49, 0x72, 0x69, 0x73, 0x20,
+  0x50, 0x72, 0x6f, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x6c, 0x28, 0x52, 0x29, 0x20, 0x4d, 0x61, 0x6e,
+  0x79, 0x20, 0x49, 0x6e, 0x74, 0x65, 0x67, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x43, 0x6f, 0x72,
+  0x65, 0x20, 0x41, 0x63, 0x63, 0x65, 0x6c, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x43,
+  0x61, 0x72, 0x64, 0x00, 0x61, 0x63, 0x63, 0x65, 0x6c, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x00,
+  0x47, 0x65, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x47, 0x54, 0x58, 0x20, 0x34, 0x38, 0x30, 0x00,
+  0x47, 0x65, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x47, 0x54, 0x58, 0x20, 0x35, 0x38, 0x30, 0x00,
+  0x53, 0x4d, 0x32, 0x2e, 0x30, 0x00, 0x47, 0x52, 0x49, 0x44, 0x20, 0x4b, 0x35, 0x32, 0x30, 0x00,
+  0x47, 0x65, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x47, 0x54, 0x20, 0x36, 0x35, 0x30, 0x4d, 0x00,
+  0x47, 0x65, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x47, 0x54, 0x58, 0x20, 0x36, 0x37, 0x30, 0x00,
+  0x47, 0x65, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x47, 0x54, 0x58, 0x20, 0x36, 0x38, 0x30, 0x00,
+  0x47, 0x65, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x47, 0x54, 0x58, 0x20, 0x37, 0x36, 0x30, 0x20,
+  0x54, 0x69, 0x20, 0x4f, 0x45, 0x4d, 0x00, 0x53, 0x4d, 0x33, 0x2e, 0x30, 0x00, 0x47, 0x65, 0x46,
+  0x6f, 0x72, 0x63, 0x65, 0x20, 0x47, 0x54, 0x58, 0x20, 0x54, 0x49, 0x54, 0x41, 0x4e, 0x00, 0x47,
+  0x65, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x47, 0x54, 0x58, 0x20, 0x54, 0x49, 0x54, 0x41, 0x4e,
+  0x20, 0x42, 0x6c, 0x61, 0x63, 0x6b, 0x00, 0x54, 0x65, 0x73, 0x6c, 0x61, 0x20, 0x4b, 0x32, 0x30,
+  0x6d, 0x00, 0x54, 0x65, 0x73, 0x6c, 0x61, 0x20, 0x4b, 0x34, 0x30, 0x6d, 0x00, 0x53, 0x4d, 0x33,
+  0x2e, 0x35, 0x00, 0x47, 0x65, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x39, 0x32, 0x30, 0x4d, 0x58,
+  0x00, 0x47, 0x65, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x47, 0x54, 0x58, 0x20, 0x37, 0x35, 0x30,
+  0x00, 0x47, 0x65, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x47, 0x54, 0x58, 0x20, 0x37, 0x35, 0x30,
+  0x20, 0x54, 0x69, 0x00, 0x53, 0x4d, 0x35, 0x2e, 0x30, 0x00, 0x47, 0x65, 0x46, 0x6f, 0x72, 0x63,
+  0x65, 0x20, 0x47, 0x54, 0x58, 0x20, 0x39, 0x37, 0x30, 0x00, 0x47, 0x65, 0x46, 0x6f, 0x72, 0x63,
+  0x65, 0x20, 0x47, 0x54, 0x58, 0x20, 0x39, 0x38, 0x30, 0x00, 0x47, 0x65, 0x46, 0x6f, 0x72, 0x63,
+  0x65, 0x20, 0x47, 0x54, 0x58, 0x20, 0x54, 0x49, 0x54, 0x41, 0x4e, 0x20, 0x58, 0x00, 0x53, 0x4d,
+  0x35, 0x2e, 0x32, 0x00, 0x47, 0x65, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x47, 0x54, 0x58, 0x20,
+  0x31, 0x30, 0x37, 0x30, 0x00, 0x47, 0x65, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x47, 0x54, 0x58,
+  0x20, 0x31, 0x30, 0x38, 0x30, 0x00, 0x47, 0x65, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x47, 0x54,
+  0x58, 0x20, 0x31, 0x30, 0x38, 0x30, 0x20, 0x54, 0x69, 0x00, 0x54, 0x49, 0x54, 0x41, 0x4e, 0x20,
+  0x58, 0x20, 0x28, 0x50, 0x61, 0x73, 0x63, 0x61, 0x6c, 0x29, 0x00, 0x53, 0x4d, 0x36, 0x2e, 0x31,
+  0x00, 0x4e, 0x56, 0x49, 0x44, 0x49, 0x41, 0x00, 0x58, 0x47, 0x45, 0x4d, 0x4d, 0x5f, 0x4d, 0x49,
+  0x4e, 0x5f, 0x49, 0x4e, 0x44, 0x49, 0x52, 0x45, 0x43, 0x54, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x00,
+  0x58, 0x47, 0x45, 0x4d, 0x4d, 0x5f, 0x4d, 0x49, 0x4e, 0x5f, 0x53, 0x50, 0x4c, 0x49, 0x54, 0x4b,
+  0x5f, 0x4b, 0x00, 0x58, 0x47, 0x45, 0x4d, 0x4d, 0x5f, 0x4d, 0x49, 0x4e, 0x5f, 0x33, 0x4d, 0x5f,
+  0x53, 0x49, 0x5a, 0x45, 0x00, 0x58, 0x47, 0x45, 0x4d, 0x4d, 0x5f, 0x4d, 0x41, 0x58, 0x5f, 0x41,
+  0x4c, 0x54, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x00, 0x58, 0x47, 0x45, 0x4d, 0x4d, 0x5f, 0x49, 0x4e,
+  0x44, 0x49, 0x52, 0x45, 0x43, 0x54, 0x5f, 0x43, 0x4f, 0x50, 0x59, 0x5f, 0x43, 0x4f, 0x53, 0x54,
+  0x00, 0x58, 0x47, 0x45, 0x4d, 0x4d, 0x5f, 0x4d, 0x49, 0x4e, 0x5f, 0x53, 0x54, 0x52, 0x41, 0x53,
+  0x53, 0x45, 0x4e, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x00, 0x58, 0x47, 0x45, 0x4d, 0x4d, 0x5f, 0x4d,
+  0x49, 0x4e, 0x5f, 0x49, 0x4d, 0x41, 0x47, 0x45, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x00, 0x47, 0x65,
+  0x6d, 0x6d, 0x52, 0x6f, 0x75, 0x74, 0x69, 0x6e, 0x65, 0x00, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x4e,
+  0x41, 0x4c, 0x5f, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x00, 0x4c, 0x4f,
+  0x43, 0x41, 0x4c, 0x50, 0x41, 0x44, 0x00, 0x54, 0x4d, 0x4d, 0x57, 0x47, 0x53, 0x58, 0x00, 0x54,
+  0x4d, 0x4d, 0x57, 0x47, 0x53, 0x59, 0x00, 0x49, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x00, 0x50, 0x41,
+  0x44, 0x5f, 0x44, 0x49, 0x4d, 0x58, 0x00, 0x50, 0x41, 0x44, 0x5f, 0x44, 0x49, 0x4d, 0x59, 0x00,
+  0x50, 0x41, 0x44, 0x5f, 0x57, 0x50, 0x54, 0x58, 0x00, 0x50, 0x41, 0x44, 0x5f, 0x57, 0x50, 0x54,
+  0x59, 0x00, 0x50, 0x61, 0x64, 0x00, 0x50, 0x41, 0x44, 0x54, 0x52, 0x41, 0x5f, 0x50, 0x41, 0x44,
+  0x00, 0x50, 0x41, 0x44, 0x54, 0x52, 0x41, 0x5f, 0x54, 0x49, 0x4c, 0x45, 0x00, 0x50, 0x41, 0x44,
+  0x54, 0x52, 0x41, 0x5f, 0x57, 0x50, 0x54, 0x00, 0x50, 0x61, 0x64, 0x74, 0x72, 0x61, 0x6e, 0x73,
+  0x70, 0x6f, 0x73, 0x65, 0x00, 0x54, 0x52, 0x41, 0x5f, 0x44, 0x49, 0x4d, 0x00, 0x54, 0x52, 0x41,
+  0x5f, 0x50, 0x41, 0x44, 0x00, 0x54, 0x52, 0x41, 0x5f, 0x53, 0x48, 0x55, 0x46, 0x46, 0x4c, 0x45,
+  0x00, 0x54, 0x52, 0x41, 0x5f, 0x57, 0x50, 0x54, 0x00, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f,
+  0x73, 0x65, 0x00, 0x54, 0x52, 0x53, 0x4d, 0x5f, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 0x5f, 0x53, 0x49,
+  0x5a, 0x45, 0x00, 0x54, 0x52, 0x53, 0x4d, 0x5f, 0x4d, 0x49, 0x4e, 0x5f, 0x49, 0x4e, 0x56, 0x45,
+  0x52, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x52, 0x48, 0x53, 0x00, 0x54, 0x72, 0x73, 0x6d, 0x52, 0x6f,
+  0x75, 0x74, 0x69, 0x6e, 0x65, 0x00, 0x54, 0x52, 0x53, 0x56, 0x5f, 0x42, 0x4c, 0x4f, 0x43, 0x4b,
+  0x5f, 0x53, 0x49, 0x5a, 0x45, 0x00, 0x54, 0x72, 0x73, 0x76, 0x52, 0x6f, 0x75, 0x74, 0x69, 0x6e,
+  0x65, 0x00, 0x56, 0x57, 0x00, 0x57, 0x47, 0x53, 0x00, 0x57, 0x50, 0x54, 0x00, 0x58, 0x61, 0x78,
+  0x70, 0x79, 0x00, 0x4b, 0x57, 0x49, 0x44, 0x00, 0x4d, 0x44, 0x49, 0x4d, 0x41, 0x44, 0x00, 0x4d,
+  0x44, 0x49, 0x4d, 0x43, 0x44, 0x00, 0x4e, 0x44, 0x49, 0x4d, 0x42, 0x44, 0x00, 0x4e, 0x44, 0x49,
+  0x4d, 0x43, 0x44, 0x00, 0x50, 0x41, 0x44, 0x41, 0x00, 0x50, 0x41, 0x44, 0x42, 0x00, 0x56, 0x57,
+  0x4d, 0x44, 0x00, 0x56, 0x57, 0x4e, 0x44, 0x00, 0x57, 0x47, 0x44, 0x00, 0x58, 0x63, 0x6f, 0x6e,
+  0x76, 0x67, 0x65, 0x6d, 0x6d, 0x00, 0x57, 0x47, 0x53, 0x31, 0x00, 0x57, 0x47, 0x53, 0x32, 0x00,
+  0x58, 0x44, 0x4f, 0x54, 0x5f, 0x53, 0x49, 0x4e, 0x47, 0x4c, 0x45, 0x5f, 0x50, 0x41, 0x53, 0x53,
+  0x00, 0x58, 0x64, 0x6f, 0x74, 0x00, 0x47, 0x45, 0x4d, 0x4d, 0x4b, 0x00, 0x4b, 0x52, 0x45, 0x47,
+  0x00, 0x4b, 0x57, 0x47, 0x00, 0x4b, 0x57, 0x49, 0x00, 0x4d, 0x44, 0x49, 0x4d, 0x41, 0x00, 0x4d,
+  0x44, 0x49, 0x4d, 0x43, 0x00, 0x4d, 0x57, 0x47, 0x00, 0x4e, 0x44, 0x49, 0x4d, 0x42, 0x00, 0x4e,
+  0x44, 0x49, 0x4d, 0x43, 0x00, 0x4e, 0x57, 0x47, 0x00, 0x53, 0x41, 0x00, 0x53, 0x42, 0x00, 0x53,
+  0x54, 0x52, 0x4d, 0x00, 0x53, 0x54, 0x52, 0x4e, 0x00, 0x56, 0x57, 0x4d, 0x00, 0x56, 0x57, 0x4e,
+  0x00, 0x53, 0x4d, 0x37, 0x2e, 0x30, 0x00, 0x53, 0x4d, 0x37, 0x2e, 0x32, 0x00, 0x53, 0x4d, 0x37,
+  0x2e, 0x35, 0x00, 0x53, 0x4d, 0x38, 0x2e, 0x30, 0x00, 0x53, 0x4d, 0x38, 0x2e, 0x36, 0x00, 0x53,
+  0x4d, 0x38, 0x2e, 0x37, 0x00, 0x53, 0x4d, 0x38, 0x2e, 0x39, 0x00, 0x53, 0x4d, 0x39, 0x2e, 0x30,
+  0x00, 0x58, 0x67, 0x65, 0x6d, 0x6d, 0x00, 0x58, 0x67, 0x65, 0x6d, 0x6d, 0x44, 0x69, 0x72, 0x65,
+  0x63, 0x74, 0x00, 0x57, 0x50, 0x54, 0x31, 0x00, 0x58, 0x67, 0x65, 0x6d, 0x76, 0x00, 0x57, 0x47,
+  0x53, 0x42, 0x00, 0x57, 0x50, 0x54, 0x42, 0x00, 0x58, 0x67, 0x65, 0x6d, 0x76, 0x42, 0x61, 0x6e,
+  0x64, 0x65, 0x64, 0x00, 0x56, 0x57, 0x32, 0x00, 0x57, 0x50, 0x54, 0x32, 0x00, 0x58, 0x67, 0x65,
+  0x6d, 0x76, 0x46, 0x61, 0x73, 0x74, 0x00, 0x56, 0x57, 0x33, 0x00, 0x57, 0x47, 0x53, 0x33, 0x00,
+  0x57, 0x50, 0x54, 0x33, 0x00, 0x58, 0x67, 0x65, 0x6d, 0x76, 0x46, 0x61, 0x73, 0x74, 0x52, 0x6f,
+  0x74, 0x00, 0x51, 0x56, 0x45, 0x43, 0x54, 0x4f, 0x52, 0x53, 0x00, 0x57, 0x47, 0x53, 0x51, 0x00,
+  0x57, 0x50, 0x54, 0x51, 0x00, 0x58, 0x67, 0x65, 0x6d, 0x76, 0x51, 0x75, 0x61, 0x6e, 0x74, 0x69,
+  0x7a, 0x65, 0x64, 0x00, 0x58, 0x67, 0x65, 0x72, 0x00,
+};
+const size_t kCompactDatabaseSize = sizeof(kCompactDatabase);
+
+} // namespace database
+} // namespace clblast
@@ -1,22 +0,0 @@
-
-// =================================================================================================
-// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
-// is auto-generated by the 'scripts/database/database.py' Python script.
-//
-// This file populates the database with best-found tuning parameters for the 'Padtranspose' kernels.
-//
-// =================================================================================================
-
-#include "database/database_structure.hpp"
-
-namespace clblast {
-namespace database {
-
-extern const DatabaseEntry PadtransposeHalf;
-extern const DatabaseEntry PadtransposeSingle;
-extern const DatabaseEntry PadtransposeComplexSingle;
-extern const DatabaseEntry PadtransposeDouble;
-extern const DatabaseEntry PadtransposeComplexDouble;
-
-} // namespace database
-} // namespace clblast
@@ -1,15 +0,0 @@
-
-// =================================================================================================
-// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
-// is auto-generated by the 'scripts/database/database.py' Python script.
-//
-// This file populates the database with best-found tuning parameters for the 'Xaxpy' kernels.
-//
-// =================================================================================================
-
-#include "database/kernels/xaxpy/xaxpy.hpp"
-#include "database/kernels/xaxpy/xaxpy_16.hpp"
-#include "database/kernels/xaxpy/xaxpy_32.hpp"
-#include "database/kernels/xaxpy/xaxpy_3232.hpp"
-#include "database/kernels/xaxpy/xaxpy_64.hpp"
-#include "database/kernels/xaxpy/xaxpy_6464.hpp"
@@ -3,20 +3,24 @@
 // This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
 // is auto-generated by the 'scripts/database/database.py' Python script.
 //
-// This file populates the database with best-found tuning parameters for the 'Invert' kernels.
+// This file populates the database with best-found tuning parameters for the 'Xaxpy1616' kernels.
 //
 // =================================================================================================
 
-#include "database/database_structure.hpp"
-
 namespace clblast {
 namespace database {
 
-extern const DatabaseEntry InvertHalf;
-extern const DatabaseEntry InvertSingle;
-extern const DatabaseEntry InvertComplexSingle;
-extern const DatabaseEntry InvertDouble;
-extern const DatabaseEntry InvertComplexDouble;
+const DatabaseEntry XaxpyBFloat16 = {
+  "Xaxpy", Precision::kBFloat16, {"VW", "WGS", "WPT"}, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default", {
+          { kDeviceNameDefault                                        , Params{ 1, 64, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } },
+        } },
+      }
+    },
+  }
+};
 
 } // namespace database
 } // namespace clblast
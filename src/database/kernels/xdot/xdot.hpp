@@ -1,22 +0,0 @@
-
-// =================================================================================================
-// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
-// is auto-generated by the 'scripts/database/database.py' Python script.
-//
-// This file populates the database with best-found tuning parameters for the 'Xdot' kernels.
-//
-// =================================================================================================
-
-#include "database/database_structure.hpp"
-
-namespace clblast {
-namespace database {
-
-extern const DatabaseEntry XdotHalf;
-extern const DatabaseEntry XdotSingle;
-extern const DatabaseEntry XdotComplexSingle;
-extern const DatabaseEntry XdotDouble;
-extern const DatabaseEntry XdotComplexDouble;
-
-} // namespace database
-} // namespace clblast
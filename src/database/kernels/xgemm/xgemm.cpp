@@ -1,15 +0,0 @@
-
-// =================================================================================================
-// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
-// is auto-generated by the 'scripts/database/database.py' Python script.
-//
-// This file populates the database with best-found tuning parameters for the 'Xgemm' kernels.
-//
-// =================================================================================================
-
-#include "database/kernels/xgemm/xgemm.hpp"
-#include "database/kernels/xgemm/xgemm_16.hpp"
-#include "database/kernels/xgemm/xgemm_32.hpp"
-#include "database/kernels/xgemm/xgemm_3232.hpp"
-#include "database/kernels/xgemm/xgemm_64.hpp"
-#include "database/kernels/xgemm/xgemm_6464.hpp"
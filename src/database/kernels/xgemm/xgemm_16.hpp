@@ -41,6 +41,37 @@ const DatabaseEntry XgemmHalf = {
         } },
       }
     },
+    { // NVIDIA GPUs
+      kDeviceTypeGPU, "NVIDIA", {
+        { "SM7.0", {
+          { kDeviceNameDefault                                        , Params{ 2, 1, 32, 2, 16, 16, 64, 8, 8, 64, 0, 0, 0, 0, 2, 2 } },
+        } },
+        { "SM7.2", {
+          { kDeviceNameDefault                                        , Params{ 2, 1, 32, 2, 16, 16, 64, 8, 8, 64, 0, 0, 0, 0, 2, 2 } },
+        } },
+        { "SM7.5", {
+          { kDeviceNameDefault                                        , Params{ 2, 1, 32, 2, 16, 16, 64, 8, 8, 64, 0, 0, 0, 0, 2, 2 } },
+        } },
+        { "SM8.0", {
+          { kDeviceNameDefault                                        , Params{ 2, 1, 32, 2, 16, 16, 128, 16, 16, 128, 0, 0, 0, 0, 2, 2 } },
+        } },
+        { "SM8.6", {
+          { kDeviceNameDefault                                        , Params{ 2, 1, 32, 2, 16, 16, 128, 16, 16, 128, 0, 0, 0, 0, 2, 2 } },
+        } },
+        { "SM8.7", {
+          { kDeviceNameDefault                                        , Params{ 2, 1, 32, 2, 16, 16, 128, 16, 16, 128, 0, 0, 0, 0, 2, 2 } },
+        } },
+        { "SM8.9", {
+          { kDeviceNameDefault                                        , Params{ 2, 1, 32, 2, 16, 16, 128, 16, 16, 128, 0, 0, 0, 0, 2, 2 } },
+        } },
+        { "SM9.0", {
+          { kDeviceNameDefault                                        , Params{ 2, 1, 32, 2, 16, 16, 128, 16, 16, 128, 0, 0, 0, 0, 2, 2 } },
+        } },
+        { "default", {
+          { kDeviceNameDefault                                        , Params{ 0, 1, 32, 2, 16, 16, 64, 8, 8, 32, 1, 1, 0, 0, 4, 4 } },
+        } },
+      }
+    },
     { // Default
       kDeviceTypeAll, "default", {
         { "default", {
@@ -3,20 +3,24 @@
 // This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
 // is auto-generated by the 'scripts/database/database.py' Python script.
 //
-// This file populates the database with best-found tuning parameters for the 'Copy' kernels.
+// This file populates the database with best-found tuning parameters for the 'Xgemv_Banded16' kernels.
 //
 // =================================================================================================
 
-#include "database/database_structure.hpp"
-
 namespace clblast {
 namespace database {
 
-extern const DatabaseEntry CopyHalf;
-extern const DatabaseEntry CopySingle;
-extern const DatabaseEntry CopyComplexSingle;
-extern const DatabaseEntry CopyDouble;
-extern const DatabaseEntry CopyComplexDouble;
+const DatabaseEntry XgemvBandedHalf = {
+  "XgemvBanded", Precision::kHalf, {"WGSB", "WPTB"}, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default", {
+          { kDeviceNameDefault                                        , Params{ 64, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } },
+        } },
+      }
+    },
+  }
+};
 
 } // namespace database
 } // namespace clblast
@@ -3,20 +3,24 @@
 // This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
 // is auto-generated by the 'scripts/database/database.py' Python script.
 //
-// This file populates the database with best-found tuning parameters for the 'Gemm_Routine' kernels.
+// This file populates the database with best-found tuning parameters for the 'Xgemv_Banded64' kernels.
 //
 // =================================================================================================
 
-#include "database/database_structure.hpp"
-
 namespace clblast {
 namespace database {
 
-extern const DatabaseEntry GemmRoutineHalf;
-extern const DatabaseEntry GemmRoutineSingle;
-extern const DatabaseEntry GemmRoutineComplexSingle;
-extern const DatabaseEntry GemmRoutineDouble;
-extern const DatabaseEntry GemmRoutineComplexDouble;
+const DatabaseEntry XgemvBandedDouble = {
+  "XgemvBanded", Precision::kDouble, {"WGSB", "WPTB"}, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default", {
+          { kDeviceNameDefault                                        , Params{ 64, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } },
+        } },
+      }
+    },
+  }
+};
 
 } // namespace database
 } // namespace clblast
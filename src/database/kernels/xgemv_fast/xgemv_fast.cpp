@@ -1,15 +0,0 @@
-
-// =================================================================================================
-// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
-// is auto-generated by the 'scripts/database/database.py' Python script.
-//
-// This file populates the database with best-found tuning parameters for the 'Xgemv_Fast' kernels.
-//
-// =================================================================================================
-
-#include "database/kernels/xgemv_fast/xgemv_fast.hpp"
-#include "database/kernels/xgemv_fast/xgemv_fast_16.hpp"
-#include "database/kernels/xgemv_fast/xgemv_fast_32.hpp"
-#include "database/kernels/xgemv_fast/xgemv_fast_3232.hpp"
-#include "database/kernels/xgemv_fast/xgemv_fast_64.hpp"
-#include "database/kernels/xgemv_fast/xgemv_fast_6464.hpp"
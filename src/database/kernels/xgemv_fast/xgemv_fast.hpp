@@ -1,22 +0,0 @@
-
-// =================================================================================================
-// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
-// is auto-generated by the 'scripts/database/database.py' Python script.
-//
-// This file populates the database with best-found tuning parameters for the 'Xgemv_Fast' kernels.
-//
-// =================================================================================================
-
-#include "database/database_structure.hpp"
-
-namespace clblast {
-namespace database {
-
-extern const DatabaseEntry XgemvFastHalf;
-extern const DatabaseEntry XgemvFastSingle;
-extern const DatabaseEntry XgemvFastComplexSingle;
-extern const DatabaseEntry XgemvFastDouble;
-extern const DatabaseEntry XgemvFastComplexDouble;
-
-} // namespace database
-} // namespace clblast
@@ -1,15 +0,0 @@
-
-// =================================================================================================
-// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
-// is auto-generated by the 'scripts/database/database.py' Python script.
-//
-// This file populates the database with best-found tuning parameters for the 'Xgemv_Fast_Rot' kernels.
-//
-// =================================================================================================
-
-#include "database/kernels/xgemv_fast_rot/xgemv_fast_rot.hpp"
-#include "database/kernels/xgemv_fast_rot/xgemv_fast_rot_16.hpp"
-#include "database/kernels/xgemv_fast_rot/xgemv_fast_rot_32.hpp"
-#include "database/kernels/xgemv_fast_rot/xgemv_fast_rot_3232.hpp"
-#include "database/kernels/xgemv_fast_rot/xgemv_fast_rot_64.hpp"
-#include "database/kernels/xgemv_fast_rot/xgemv_fast_rot_6464.hpp"
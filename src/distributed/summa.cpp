@@ -0,0 +1,362 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the distributed GEMM with the SUMMA algorithm (see 'clblast_distributed.h').
+// For each block step over k, the panel of A is broadcast along the process rows and the panel of
+// B along the process columns, after which every process runs the regular GEMM on its local part
+// of C. The panels are double-buffered: the download and broadcast of the next panels overlap with
+// the local GEMM on the current ones, and the uploads run on a second (transfer) queue.
+//
+// OpenCL buffers can't be handed to MPI directly, so the panels are staged through host memory.
+//
+// =================================================================================================
+
+#include <algorithm>
+#include <climits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+#include "clblast_distributed.h"
+
+namespace clblast {
+namespace {
+// =================================================================================================
+
+// The constant one in all precisions, half-precision values are stored as their bit patterns
+template <typename T> T One() { return static_cast<T>(1.0); }
+template <> half One<half>() { return FloatToHalf(1.0f); }
+
+// Throws on MPI errors, which are returned as 'kUnknownError' by the routine
+void CheckMPI(const int status, const std::string &where) {
+  if (status != MPI_SUCCESS) { throw std::runtime_error("MPI error in " + where); }
+}
+
+// A sub-communicator of the processes with the same 'color', ordered by 'key', freed when done
+class SubCommunicator {
+ public:
+  SubCommunicator(MPI_Comm communicator, const size_t color, const size_t key) {
+    CheckMPI(MPI_Comm_split(communicator, static_cast<int>(color), static_cast<int>(key), &comm_),
+             "MPI_Comm_split");
+  }
+  ~SubCommunicator() { MPI_Comm_free(&comm_); }
+  SubCommunicator(const SubCommunicator &) = delete;
+  SubCommunicator& operator=(const SubCommunicator &) = delete;
+  MPI_Comm operator()() const { return comm_; }
+ private:
+  MPI_Comm comm_;
+};
+
+// Copies a column-major 'rows' by 'cols' block starting at element 'offset' of a device matrix with
+// leading dimension 'ld' into contiguous host memory, a-synchronously
+template <typename T>
+void ReadBlockAsync(const Queue &queue, const cl_mem buffer, const size_t offset, const size_t ld,
+                    const size_t rows, const size_t cols, T* host) {
+  const size_t buffer_origin[3] = {offset * sizeof(T), 0, 0};
+  const size_t host_origin[3] = {0, 0, 0};
+  const size_t region[3] = {rows * sizeof(T), cols, 1};
+  CheckError(clEnqueueReadBufferRect(queue(), buffer, CL_FALSE, buffer_origin, host_origin, region,
+                                     ld * sizeof(T), 0, rows * sizeof(T), 0, host,
+                                     0, nullptr, nullptr));
+}
+
+// Broadcasts a host panel as bytes, such that all precisions (including half) are supported. The
+// size in bytes is checked up-front to fit in an 'int' (see 'GemmSumma').
+template <typename T>
+void BroadcastAsync(std::vector<T> &panel, const size_t size, const size_t root,
+                    MPI_Comm communicator, MPI_Request &request) {
+  CheckMPI(MPI_Ibcast(panel.data(), static_cast<int>(size * sizeof(T)), MPI_BYTE,
+                      static_cast<int>(root), communicator, &request), "MPI_Ibcast");
+}
+
+// Agrees on the status over all processes (the most negative one, i.e. an error if there is any),
+// such that all of them return the same status together
+StatusCode AgreeOnStatus(const StatusCode status, MPI_Comm communicator) {
+  auto local_status = static_cast<int>(status);
+  auto global_status = 0;
+  CheckMPI(MPI_Allreduce(&local_status, &global_status, 1, MPI_INT, MPI_MIN, communicator),
+           "MPI_Allreduce");
+  return static_cast<StatusCode>(global_status);
+}
+
+// Runs a part of the routine which doesn't communicate, returning any error as a status such that
+// it can be agreed on with the other processes
+template <typename Function>
+StatusCode RunLocally(Function function) {
+  try {
+    return function();
+  } catch (const CLCudaAPIError &e) {
+    return static_cast<StatusCode>(e.status());
+  } catch (...) {
+    return StatusCode::kUnknownError;
+  }
+}
+
+// The double-buffered host and device panels and the queue for the transfers between them. Any
+// transfers from or to host memory are completed before it is freed.
+template <typename T>
+struct Panels {
+  Panels(const Queue &queue, const size_t a_size, const size_t b_size):
+      transfer_queue(queue.GetContext(), queue.GetDevice()),
+      a_host(2, std::vector<T>(a_size)),
+      b_host(2, std::vector<T>(b_size)),
+      a_device{Buffer<T>(queue.GetContext(), std::max(a_size, size_t{1})),
+               Buffer<T>(queue.GetContext(), std::max(a_size, size_t{1}))},
+      b_device{Buffer<T>(queue.GetContext(), std::max(b_size, size_t{1})),
+               Buffer<T>(queue.GetContext(), std::max(b_size, size_t{1}))},
+      uploaded{Event(), Event()},
+      computed{Event(), Event()} {
+  }
+  ~Panels() { clFinish(transfer_queue()); }
+  Panels(const Panels &) = delete;
+  Panels& operator=(const Panels &) = delete;
+
+  Queue transfer_queue;
+  std::vector<std::vector<T>> a_host;
+  std::vector<std::vector<T>> b_host;
+  std::vector<Buffer<T>> a_device;
+  std::vector<Buffer<T>> b_device;
+  std::vector<Event> uploaded;  // host panels of a slot are free again
+  std::vector<Event> computed;  // device panels of a slot are free again
+};
+
+// The broadcast requests of the panels of A and B for both slots. Requests which are still pending
+// when leaving the routine (e.g. on errors) are completed first, since they write to host panels.
+class BroadcastRequests {
+ public:
+  BroadcastRequests(): requests_(4, MPI_REQUEST_NULL) { }
+  ~BroadcastRequests() { MPI_Waitall(4, requests_.data(), MPI_STATUSES_IGNORE); }
+  BroadcastRequests(const BroadcastRequests &) = delete;
+  BroadcastRequests& operator=(const BroadcastRequests &) = delete;
+  MPI_Request& A(const size_t slot) { return requests_[2 * slot]; }
+  MPI_Request& B(const size_t slot) { return requests_[2 * slot + 1]; }
+  void Wait(const size_t slot) {
+    CheckMPI(MPI_Waitall(2, &requests_[2 * slot], MPI_STATUSES_IGNORE), "MPI_Waitall");
+  }
+ private:
+  std::vector<MPI_Request> requests_;
+};
+
+// =================================================================================================
+} // anonymous namespace
+
+// As ScaLAPACK's NUMROC with the first block on process zero
+size_t NumLocal(const size_t size, const size_t block_size, const size_t proc,
+                const size_t num_procs) {
+  const auto num_blocks = size / block_size;
+  const auto extra_blocks = num_blocks % num_procs;
+  auto local = (num_blocks / num_procs) * block_size;
+  if (proc < extra_blocks) { local += block_size; }
+  else if (proc == extra_blocks) { local += size % block_size; }
+  return local;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode GemmSumma(const size_t m, const size_t n, const size_t k,
+                     const T alpha,
+                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                     const T beta,
+                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                     const size_t block_size, const size_t grid_rows, const size_t grid_cols,
+                     MPI_Comm communicator, cl_command_queue* queue) {
+  try {
+
+    // Makes sure all dimensions are larger than zero and that the grid matches the communicator
+    if ((m == 0) || (n == 0) || (k == 0) || (block_size == 0)) {
+      return StatusCode::kInvalidDimension;
+    }
+    auto num_procs = 0;
+    auto rank = 0;
+    CheckMPI(MPI_Comm_size(communicator, &num_procs), "MPI_Comm_size");
+    CheckMPI(MPI_Comm_rank(communicator, &rank), "MPI_Comm_rank");
+    if ((grid_rows == 0) || (grid_cols == 0) ||
+        (grid_rows * grid_cols != static_cast<size_t>(num_procs))) {
+      return StatusCode::kInvalidValue;
+    }
+
+    // Computes the position in the grid and the sizes of the local matrices
+    const auto proc_row = static_cast<size_t>(rank) / grid_cols;
+    const auto proc_col = static_cast<size_t>(rank) % grid_cols;
+    const auto local_m = NumLocal(m, block_size, proc_row, grid_rows);
+    const auto local_n = NumLocal(n, block_size, proc_col, grid_cols);
+    const auto local_k_rows = NumLocal(k, block_size, proc_row, grid_rows); // of the local B
+    const auto a_panel_size = local_m * block_size;
+    const auto b_panel_size = block_size * local_n;
+
+    // The above checks only depend on arguments which are the same on all processes, but these
+    // depend on the local sizes. All processes therefore agree on the result before any collective
+    // call, such that they all return the same error instead of some waiting in the broadcasts.
+    auto status = StatusCode::kSuccess;
+    if (a_ld < std::max(local_m, size_t{1})) { status = StatusCode::kInvalidLeadDimA; }
+    else if (b_ld < std::max(local_k_rows, size_t{1})) { status = StatusCode::kInvalidLeadDimB; }
+    else if (c_ld < std::max(local_m, size_t{1})) { status = StatusCode::kInvalidLeadDimC; }
+    else if (std::max(a_panel_size, b_panel_size) > static_cast<size_t>(INT_MAX) / sizeof(T)) {
+      status = StatusCode::kInvalidDimension; // the panels are broadcast with an 'int' byte count
+    }
+    status = AgreeOnStatus(status, communicator);
+    if (status != StatusCode::kSuccess) { return status; }
+
+    // The processes of a grid row share the panels of A, those of a grid column the panels of B
+    const SubCommunicator row_comm(communicator, proc_row, proc_col);
+    const SubCommunicator col_comm(communicator, proc_col, proc_row);
+
+    // The panels are declared before the requests, such that pending broadcasts into them are
+    // completed before they are freed
+    auto queue_cpp = Queue(*queue);
+    auto queue_plain = queue_cpp();
+    auto panels = std::unique_ptr<Panels<T>>();
+    BroadcastRequests requests;
+
+    // The block steps over k: the panel width and the owners of the panels in the grid
+    const auto num_steps = (k + block_size - 1) / block_size;
+    const auto panel_k = [&](const size_t step) {
+      return std::min(block_size, k - step * block_size);
+    };
+
+    // The owners download their parts of the panels of a step into host memory
+    const auto download = [&](const size_t step) {
+      const auto slot = step % 2;
+      const auto kb = panel_k(step);
+      if (step >= 2) { panels->uploaded[slot].WaitForCompletion(); }
+      if ((proc_col == step % grid_cols) && (local_m > 0)) {
+        const auto a_col = (step / grid_cols) * block_size;
+        ReadBlockAsync(panels->transfer_queue, a_buffer, a_offset + a_col * a_ld, a_ld, local_m,
+                       kb, panels->a_host[slot].data());
+      }
+      if ((proc_row == step % grid_rows) && (local_n > 0)) {
+        const auto b_row = (step / grid_rows) * block_size;
+        ReadBlockAsync(panels->transfer_queue, b_buffer, b_offset + b_row, b_ld, kb, local_n,
+                       panels->b_host[slot].data());
+      }
+      panels->transfer_queue.Finish();
+    };
+
+    // The downloaded panels are broadcast along the grid rows (A) and columns (B) without blocking
+    const auto broadcast = [&](const size_t step) {
+      const auto slot = step % 2;
+      const auto kb = panel_k(step);
+      BroadcastAsync(panels->a_host[slot], local_m * kb, step % grid_cols, row_comm(),
+                     requests.A(slot));
+      BroadcastAsync(panels->b_host[slot], kb * local_n, step % grid_rows, col_comm(),
+                     requests.B(slot));
+    };
+
+    // Allocates the panels and downloads the first ones. Errors in the parts which don't
+    // communicate are agreed on before the next broadcasts, such that all processes return together
+    // and none waits for a broadcast of a process which already returned.
+    status = RunLocally([&]() -> StatusCode {
+      panels.reset(new Panels<T>(queue_cpp, a_panel_size, b_panel_size));
+      download(0);
+      return StatusCode::kSuccess;
+    });
+    status = AgreeOnStatus(status, communicator);
+    if (status != StatusCode::kSuccess) { return status; }
+    broadcast(0);
+
+    // Runs all steps, always broadcasting the next panels while computing on the current ones
+    for (auto step = size_t{0}; step < num_steps; ++step) {
+      const auto slot = step % 2;
+      const auto kb = panel_k(step);
+      status = RunLocally([&]() -> StatusCode {
+
+        // Completes the broadcasts and uploads the panels once the computation using the slot is
+        // done
+        requests.Wait(slot);
+        auto &transfer_queue = panels->transfer_queue;
+        if (step >= 2) { transfer_queue.EnqueueWaitForEvent(panels->computed[slot]); }
+        if (local_m > 0) {
+          panels->a_device[slot].WriteAsync(transfer_queue, local_m * kb,
+                                            panels->a_host[slot].data());
+        }
+        if (local_n > 0) {
+          panels->b_device[slot].WriteAsync(transfer_queue, kb * local_n,
+                                            panels->b_host[slot].data());
+        }
+        panels->uploaded[slot] = Event();
+        transfer_queue.EnqueueMarker(panels->uploaded[slot]);
+
+        // Accumulates the product of the panels into the local part of C
+        queue_cpp.EnqueueWaitForEvent(panels->uploaded[slot]);
+        if ((local_m > 0) && (local_n > 0)) {
+          const auto step_beta = (step == 0) ? beta : One<T>();
+          const auto gemm_status = Gemm<T>(Layout::kColMajor, Transpose::kNo, Transpose::kNo,
+                                           local_m, local_n, kb, alpha,
+                                           panels->a_device[slot](), 0, local_m,
+                                           panels->b_device[slot](), 0, kb, step_beta,
+                                           c_buffer, c_offset, c_ld, &queue_plain);
+          if (gemm_status != StatusCode::kSuccess) { return gemm_status; }
+        }
+        panels->computed[slot] = Event();
+        queue_cpp.EnqueueMarker(panels->computed[slot]);
+
+        // Downloads the next panels while the device computes
+        if (step + 1 < num_steps) { download(step + 1); }
+        return StatusCode::kSuccess;
+      });
+      status = AgreeOnStatus(status, communicator);
+      if (status != StatusCode::kSuccess) { return status; }
+      if (step + 1 < num_steps) { broadcast(step + 1); }
+    }
+
+    // Waits for the local computation to complete
+    status = RunLocally([&]() -> StatusCode {
+      queue_cpp.Finish();
+      panels->transfer_queue.Finish();
+      return StatusCode::kSuccess;
+    });
+    return AgreeOnStatus(status, communicator);
+  } catch (const CLCudaAPIError &e) {
+    return static_cast<StatusCode>(e.status());
+  } catch (...) {
+    return StatusCode::kUnknownError;
+  }
+}
+
+// =================================================================================================
+
+// Compiles the templated function
+template StatusCode GemmSumma<half>(const size_t, const size_t, const size_t, const half,
+                                    const cl_mem, const size_t, const size_t,
+                                    const cl_mem, const size_t, const size_t, const half,
+                                    cl_mem, const size_t, const size_t,
+                                    const size_t, const size_t, const size_t,
+                                    MPI_Comm, cl_command_queue*);
+template StatusCode GemmSumma<float>(const size_t, const size_t, const size_t, const float,
+                                     const cl_mem, const size_t, const size_t,
+                                     const cl_mem, const size_t, const size_t, const float,
+                                     cl_mem, const size_t, const size_t,
+                                     const size_t, const size_t, const size_t,
+                                     MPI_Comm, cl_command_queue*);
+template StatusCode GemmSumma<double>(const size_t, const size_t, const size_t, const double,
+                                      const cl_mem, const size_t, const size_t,
+                                      const cl_mem, const size_t, const size_t, const double,
+                                      cl_mem, const size_t, const size_t,
+                                      const size_t, const size_t, const size_t,
+                                      MPI_Comm, cl_command_queue*);
+template StatusCode GemmSumma<float2>(const size_t, const size_t, const size_t, const float2,
+                                      const cl_mem, const size_t, const size_t,
+                                      const cl_mem, const size_t, const size_t, const float2,
+                                      cl_mem, const size_t, const size_t,
+                                      const size_t, const size_t, const size_t,
+                                      MPI_Comm, cl_command_queue*);
+template StatusCode GemmSumma<double2>(const size_t, const size_t, const size_t, const double2,
+                                       const cl_mem, const size_t, const size_t,
+                                       const cl_mem, const size_t, const size_t, const double2,
+                                       cl_mem, const size_t, const size_t,
+                                       const size_t, const size_t, const size_t,
+                                       MPI_Comm, cl_command_queue*);
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,75 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the explanation of routine calls (see the header for more information).
+//
+// =================================================================================================
+
+#include <string>
+
+#include "explanation.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+std::atomic<size_t> ExplanationScope::num_scopes_{0};
+
+GemmExplanation*& ExplanationScope::CurrentOfThread() {
+  static thread_local GemmExplanation* explanation = nullptr;
+  return explanation;
+}
+
+ExplanationScope::ExplanationScope(GemmExplanation &explanation):
+    previous_(CurrentOfThread()) {
+  CurrentOfThread() = &explanation;
+  num_scopes_++;
+}
+
+ExplanationScope::~ExplanationScope() {
+  CurrentOfThread() = previous_;
+  num_scopes_--;
+}
+
+// =================================================================================================
+
+void ExplainKernel(const Kernel &kernel, const ThreadRange &global, const ThreadRange &local) {
+  const auto explanation = ExplanationScope::Current();
+  if (explanation == nullptr) { return; }
+  auto launch = KernelLaunch{kernel.GetFunctionName(), global.size(), {1, 1, 1}, {0, 0, 0}};
+  for (auto i = size_t{0}; i < global.size() && i < 3; ++i) { launch.global[i] = global[i]; }
+  for (auto i = size_t{0}; i < local.size() && i < 3; ++i) { launch.local[i] = local[i]; }
+  explanation->launches.push_back(launch);
+}
+
+void ExplainTemporaryBuffer(const size_t bytes) {
+  const auto explanation = ExplanationScope::Current();
+  if (explanation == nullptr) { return; }
+  explanation->temp_buffer_sizes.push_back(bytes);
+}
+
+void ExplainGemmPath(const std::string &path, const size_t gemmk) {
+  const auto explanation = ExplanationScope::Current();
+  if (explanation == nullptr || !explanation->path.empty()) { return; }
+  explanation->path = path;
+  explanation->gemmk = gemmk;
+}
+
+void ExplainParameters(const std::string &kernel_name, const Database &database) {
+  const auto explanation = ExplanationScope::Current();
+  if (explanation == nullptr) { return; }
+  auto kernel_parameters = KernelParameters{kernel_name,
+                                            static_cast<ParameterSource>(database.GetSource()), {}};
+  for (const auto &parameter : database.GetParameters()) {
+    kernel_parameters.parameters[parameter.first] = parameter.second;
+  }
+  explanation->parameters.push_back(kernel_parameters);
+}
+
+// =================================================================================================
+} // namespace clblast
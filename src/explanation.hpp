@@ -0,0 +1,65 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the explanation of routine calls (see 'ExplainGemm'). While a call is
+// explained on a host thread, the routines perform all their host-side work as usual (argument
+// checks, parameter and kernel selection, compilation), but their kernels are recorded into the
+// explanation instead of launched and their temporary buffers are only recorded instead of
+// allocated. No user buffers are needed: the checks of their sizes pass for null buffers. This is
+// only available for OpenCL.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_EXPLANATION_H_
+#define CLBLAST_EXPLANATION_H_
+
+#include <atomic>
+#include <string>
+
+#include "utilities/utilities.hpp"
+#include "database/database.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Explains the calls made from this host thread during the lifetime of the scope
+class ExplanationScope {
+ public:
+  explicit ExplanationScope(GemmExplanation &explanation);
+  ~ExplanationScope();
+  ExplanationScope(const ExplanationScope&) = delete;
+  ExplanationScope& operator=(const ExplanationScope&) = delete;
+
+  // The explanation of this host thread or a nullptr, cheap in case nothing is explained
+  static GemmExplanation* Current() {
+    return (num_scopes_ != 0) ? CurrentOfThread() : nullptr;
+  }
+
+ private:
+  static GemmExplanation*& CurrentOfThread();
+  static std::atomic<size_t> num_scopes_;
+  GemmExplanation* previous_;
+};
+
+// Records a kernel launch or a temporary buffer (in bytes) into the current explanation
+void ExplainKernel(const Kernel &kernel, const ThreadRange &global, const ThreadRange &local);
+void ExplainTemporaryBuffer(const size_t bytes);
+
+// Records the selected version of GEMM, unless one was recorded already: the outermost call is
+// explained, not the GEMMs nested within it (e.g. those of the 3M or Strassen-Winograd versions)
+void ExplainGemmPath(const std::string &path, const size_t gemmk);
+
+// Records the parameters of a kernel and where they were found
+void ExplainParameters(const std::string &kernel_name, const Database &database);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_EXPLANATION_H_
+#endif
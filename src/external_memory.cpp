@@ -0,0 +1,161 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the import of external memory and semaphores (see the header for more
+// information).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+
+#include "external_memory.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The parts of the 'cl_khr_external_memory' and 'cl_khr_external_semaphore' extensions used here.
+// These are declared locally, since they are not declared in older OpenCL headers.
+namespace {
+constexpr cl_ulong kMemDeviceHandleListKHR = 0x2051;
+constexpr cl_ulong kMemDeviceHandleListEndKHR = 0;
+constexpr cl_ulong kSemaphoreTypeKHR = 0x203D;
+constexpr cl_ulong kSemaphoreTypeBinaryKHR = 1;
+constexpr cl_ulong kSemaphoreDeviceHandleListKHR = 0x2053;
+constexpr cl_ulong kSemaphoreDeviceHandleListEndKHR = 0;
+
+cl_ulong MemoryHandleTypeKHR(const ExternalMemoryHandle handle_type) {
+  switch (handle_type) {
+    case ExternalMemoryHandle::kOpaqueFd: return 0x2060;
+    case ExternalMemoryHandle::kOpaqueWin32: return 0x2061;
+    case ExternalMemoryHandle::kOpaqueWin32Kmt: return 0x2062;
+    case ExternalMemoryHandle::kDmaBuf: return 0x2067;
+  }
+  throw RuntimeErrorCode(StatusCode::kInvalidValue, "unknown external memory handle type");
+}
+cl_ulong SemaphoreHandleTypeKHR(const ExternalSemaphoreHandle handle_type) {
+  switch (handle_type) {
+    case ExternalSemaphoreHandle::kOpaqueFd: return 0x2055;
+    case ExternalSemaphoreHandle::kOpaqueWin32: return 0x2056;
+    case ExternalSemaphoreHandle::kOpaqueWin32Kmt: return 0x2057;
+    case ExternalSemaphoreHandle::kSyncFd: return 0x2058;
+  }
+  throw RuntimeErrorCode(StatusCode::kInvalidValue, "unknown external semaphore handle type");
+}
+
+using CreateSemaphoreWithPropertiesKHR = void* (CL_API_CALL *)(cl_context, const cl_ulong*,
+                                                               cl_int*);
+using ReleaseSemaphoreKHR = cl_int (CL_API_CALL *)(void*);
+using EnqueueSemaphoresKHR = cl_int (CL_API_CALL *)(cl_command_queue, cl_uint, void* const*,
+                                                    const cl_ulong*, cl_uint, const cl_event*,
+                                                    cl_event*);
+using EnqueueExternalMemObjectsKHR = cl_int (CL_API_CALL *)(cl_command_queue, cl_uint,
+                                                            const cl_mem*, cl_uint,
+                                                            const cl_event*, cl_event*);
+
+template <typename F>
+F GetExtensionFunction(const Device &device, const std::string &extension, const char* name) {
+  if (!device.HasExtension(extension)) {
+    throw RuntimeErrorCode(StatusCode::kNotImplemented, "the device does not support " + extension);
+  }
+  const auto function = reinterpret_cast<F>(
+      clGetExtensionFunctionAddressForPlatform(device.PlatformID(), name));
+  if (!function) {
+    throw RuntimeErrorCode(StatusCode::kNotImplemented, std::string{"missing function "} + name);
+  }
+  return function;
+}
+} // anonymous namespace
+
+// =================================================================================================
+
+cl_mem ImportMemory(const Context &context, const Device &device,
+                    const ExternalMemoryHandle handle_type, const intptr_t handle,
+                    const size_t size) {
+  #ifdef CL_VERSION_3_0
+    if (!device.HasExtension("cl_khr_external_memory")) {
+      throw RuntimeErrorCode(StatusCode::kNotImplemented,
+                             "the device does not support cl_khr_external_memory");
+    }
+    const auto properties = std::vector<cl_mem_properties>{
+      MemoryHandleTypeKHR(handle_type), static_cast<cl_mem_properties>(handle),
+      kMemDeviceHandleListKHR, reinterpret_cast<cl_mem_properties>(device()),
+      kMemDeviceHandleListEndKHR, 0
+    };
+    auto status = CL_SUCCESS;
+    const auto buffer = clCreateBufferWithProperties(context(), properties.data(),
+                                                     CL_MEM_READ_WRITE, size, nullptr, &status);
+    CLCudaAPIError::Check(status, "clCreateBufferWithProperties");
+    return buffer;
+  #else
+    throw RuntimeErrorCode(StatusCode::kNotImplemented, "compiled with OpenCL headers before 3.0");
+  #endif
+}
+
+ExternalSemaphore ImportSemaphore(const Context &context, const Device &device,
+                                  const ExternalSemaphoreHandle handle_type,
+                                  const intptr_t handle) {
+  const auto create = GetExtensionFunction<CreateSemaphoreWithPropertiesKHR>(
+      device, "cl_khr_external_semaphore", "clCreateSemaphoreWithPropertiesKHR");
+  const auto properties = std::vector<cl_ulong>{
+    kSemaphoreTypeKHR, kSemaphoreTypeBinaryKHR,
+    SemaphoreHandleTypeKHR(handle_type), static_cast<cl_ulong>(handle),
+    kSemaphoreDeviceHandleListKHR, reinterpret_cast<cl_ulong>(device()),
+    kSemaphoreDeviceHandleListEndKHR, 0
+  };
+  auto status = CL_SUCCESS;
+  const auto semaphore = create(context(), properties.data(), &status);
+  CLCudaAPIError::Check(status, "clCreateSemaphoreWithPropertiesKHR");
+  return semaphore;
+}
+
+void ReleaseSemaphore(const Device &device, const ExternalSemaphore semaphore) {
+  const auto release = GetExtensionFunction<ReleaseSemaphoreKHR>(
+      device, "cl_khr_semaphore", "clReleaseSemaphoreKHR");
+  CheckError(release(semaphore));
+}
+
+// =================================================================================================
+
+void AcquireMemory(const Queue &queue, const std::vector<cl_mem> &buffers,
+                   const std::vector<ExternalSemaphore> &wait_semaphores, EventPointer event) {
+  const auto device = queue.GetDevice();
+  if (!wait_semaphores.empty()) {
+    const auto wait = GetExtensionFunction<EnqueueSemaphoresKHR>(
+        device, "cl_khr_semaphore", "clEnqueueWaitSemaphoresKHR");
+    CheckError(wait(queue(), static_cast<cl_uint>(wait_semaphores.size()), wait_semaphores.data(),
+                    nullptr, 0, nullptr, (buffers.empty()) ? event : nullptr));
+  }
+  if (!buffers.empty()) {
+    const auto acquire = GetExtensionFunction<EnqueueExternalMemObjectsKHR>(
+        device, "cl_khr_external_memory", "clEnqueueAcquireExternalMemObjectsKHR");
+    CheckError(acquire(queue(), static_cast<cl_uint>(buffers.size()), buffers.data(),
+                       0, nullptr, event));
+  }
+}
+
+void ReleaseMemory(const Queue &queue, const std::vector<cl_mem> &buffers,
+                   const std::vector<ExternalSemaphore> &signal_semaphores, EventPointer event) {
+  const auto device = queue.GetDevice();
+  if (!buffers.empty()) {
+    const auto release = GetExtensionFunction<EnqueueExternalMemObjectsKHR>(
+        device, "cl_khr_external_memory", "clEnqueueReleaseExternalMemObjectsKHR");
+    CheckError(release(queue(), static_cast<cl_uint>(buffers.size()), buffers.data(),
+                       0, nullptr, (signal_semaphores.empty()) ? event : nullptr));
+  }
+  if (!signal_semaphores.empty()) {
+    const auto signal = GetExtensionFunction<EnqueueSemaphoresKHR>(
+        device, "cl_khr_semaphore", "clEnqueueSignalSemaphoresKHR");
+    CheckError(signal(queue(), static_cast<cl_uint>(signal_semaphores.size()),
+                      signal_semaphores.data(), nullptr, 0, nullptr, event));
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,51 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the import of memory and semaphores exported by other APIs (e.g. Vulkan)
+// through the 'cl_khr_external_memory' and 'cl_khr_external_semaphore' extensions. An imported
+// buffer is a regular OpenCL buffer, which the routines can use directly. Before it is used, it has
+// to be acquired on the queue, optionally after waiting for semaphores signalled by the other API.
+// Afterwards it has to be released again, optionally signalling semaphores for the other API.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_EXTERNAL_MEMORY_H_
+#define CLBLAST_EXTERNAL_MEMORY_H_
+
+#include <vector>
+#include <cstdint>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Creates a buffer of 'size' bytes from memory exported by another API, usable on the device only
+cl_mem ImportMemory(const Context &context, const Device &device,
+                    const ExternalMemoryHandle handle_type, const intptr_t handle,
+                    const size_t size);
+
+// Creates a binary semaphore from a semaphore exported by another API, and releases it again
+ExternalSemaphore ImportSemaphore(const Context &context, const Device &device,
+                                  const ExternalSemaphoreHandle handle_type, const intptr_t handle);
+void ReleaseSemaphore(const Device &device, const ExternalSemaphore semaphore);
+
+// Enqueues a wait for the semaphores followed by the acquisition of the buffers, or the release of
+// the buffers followed by a signal of the semaphores. The event (if any) is that of the last
+// command, it is not set if both lists are empty.
+void AcquireMemory(const Queue &queue, const std::vector<cl_mem> &buffers,
+                   const std::vector<ExternalSemaphore> &wait_semaphores, EventPointer event);
+void ReleaseMemory(const Queue &queue, const std::vector<cl_mem> &buffers,
+                   const std::vector<ExternalSemaphore> &signal_semaphores, EventPointer event);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_EXTERNAL_MEMORY_H_
+#endif
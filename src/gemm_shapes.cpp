@@ -0,0 +1,67 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the registry of GEMM shapes (see the header for more information).
+//
+// =================================================================================================
+
+#include <set>
+#include <tuple>
+#include <memory>
+#include <atomic>
+#include <mutex>
+
+#include "gemm_shapes.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+  using GemmShape = std::tuple<RawDeviceID, Precision, Layout, Transpose, Transpose,
+                               size_t, size_t, size_t>;
+  using GemmShapes = std::set<GemmShape>;
+
+  // The registered shapes are kept in an immutable snapshot (as in 'Cache'), such that a lookup by
+  // a GEMM call never takes the lock: modifications (serialised by the lock) replace the snapshot
+  std::shared_ptr<const GemmShapes> gemm_shapes = std::make_shared<GemmShapes>();
+  std::mutex gemm_shapes_mutex;
+  std::atomic<bool> has_gemm_shapes{false};
+
+} // anonymous namespace
+
+// =================================================================================================
+
+void AddGemmShape(const RawDeviceID device, const Precision precision, const Layout layout,
+                  const Transpose a_transpose, const Transpose b_transpose,
+                  const size_t m, const size_t n, const size_t k) {
+  std::lock_guard<std::mutex> lock(gemm_shapes_mutex);
+  auto shapes = std::make_shared<GemmShapes>(*std::atomic_load(&gemm_shapes));
+  shapes->insert(GemmShape{device, precision, layout, a_transpose, b_transpose, m, n, k});
+  std::atomic_store(&gemm_shapes, std::shared_ptr<const GemmShapes>(std::move(shapes)));
+  has_gemm_shapes = true;
+}
+
+void RemoveGemmShapes() {
+  std::lock_guard<std::mutex> lock(gemm_shapes_mutex);
+  std::atomic_store(&gemm_shapes, std::shared_ptr<const GemmShapes>(std::make_shared<GemmShapes>()));
+  has_gemm_shapes = false;
+}
+
+bool IsGemmShapeRegistered(const RawDeviceID device, const Precision precision, const Layout layout,
+                           const Transpose a_transpose, const Transpose b_transpose,
+                           const size_t m, const size_t n, const size_t k) {
+  if (!has_gemm_shapes) { return false; }
+  const auto shapes = std::atomic_load(&gemm_shapes);
+  const auto shape = GemmShape{device, precision, layout, a_transpose, b_transpose, m, n, k};
+  return shapes->find(shape) != shapes->end();
+}
+
+// =================================================================================================
+} // namespace clblast
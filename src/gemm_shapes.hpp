@@ -0,0 +1,41 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the registry of GEMM shapes (see 'RegisterGemmShape'). GEMM calls of a
+// registered shape which use the indirect kernel run it from a program specialised for their
+// sizes: the sizes are compile-time constants instead of kernel arguments, such that the compiler
+// can fully unroll the loop over K and simplify the index computations. The specialised programs
+// are stored in the regular program and binary caches.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_GEMM_SHAPES_H_
+#define CLBLAST_GEMM_SHAPES_H_
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Adds a shape to the registry, or removes all shapes
+void AddGemmShape(const RawDeviceID device, const Precision precision, const Layout layout,
+                  const Transpose a_transpose, const Transpose b_transpose,
+                  const size_t m, const size_t n, const size_t k);
+void RemoveGemmShapes();
+
+// Whether or not the shape of a GEMM call is registered, cheap in case no shapes are registered
+bool IsGemmShapeRegistered(const RawDeviceID device, const Precision precision, const Layout layout,
+                           const Transpose a_transpose, const Transpose b_transpose,
+                           const size_t m, const size_t n, const size_t k);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_GEMM_SHAPES_H_
+#endif
@@ -0,0 +1,111 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Handle class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#include "handle.hpp"
+#include "memory_pool.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+  // The handle activated on this host thread for the next routine on its queue
+  Handle*& ActiveHandle() {
+    static thread_local Handle* handle = nullptr;
+    return handle;
+  }
+
+  // The global math mode, initialised from the 'CLBLAST_MATH_MODE' environmental variable
+  std::atomic<int>& GlobalMathMode() {
+    static std::atomic<int> mode([]() {
+      const auto environment_variable = std::getenv("CLBLAST_MATH_MODE");
+      if (environment_variable == nullptr) { return static_cast<int>(MathMode::kDefault); }
+      if (std::strcmp(environment_variable, "fast") == 0) { return static_cast<int>(MathMode::kFast); }
+      if (std::strcmp(environment_variable, "precise") == 0) { return static_cast<int>(MathMode::kPrecise); }
+      return static_cast<int>(MathMode::kDefault);
+    }());
+    return mode;
+  }
+} // anonymous namespace
+
+// =================================================================================================
+
+Handle::Handle(const RawCommandQueue queue):
+    queue_(queue),
+    programs_(),
+    has_workspace_(false),
+    statistics_(),
+    math_mode_(MathMode::kDefault) {
+  CheckError(clRetainCommandQueue(queue_));
+}
+
+// Also deactivates the handle on this host thread, such that no dangling pointer is left
+Handle::~Handle() {
+  if (ActiveHandle() == this) { ActiveHandle() = nullptr; }
+  if (has_workspace_) { Workspaces::Instance().Detach(Queue(queue_)); }
+  CheckErrorDtor(clReleaseCommandQueue(queue_));
+}
+
+RawCommandQueue* Handle::Activate() {
+  ActiveHandle() = this;
+  statistics_.num_calls++;
+  return &queue_;
+}
+
+Handle* Handle::TakeActive(const Queue &queue) {
+  const auto handle = ActiveHandle();
+  if (handle == nullptr || handle->queue_ != queue()) { return nullptr; }
+  ActiveHandle() = nullptr;
+  return handle;
+}
+
+// =================================================================================================
+
+bool Handle::GetProgram(const Precision precision, const uint64_t fingerprint, Program &program) {
+  const auto entry = programs_.find(std::make_pair(precision, fingerprint));
+  if (entry == programs_.end()) {
+    statistics_.program_cache_misses++;
+    return false;
+  }
+  statistics_.program_cache_hits++;
+  program = entry->second;
+  return true;
+}
+
+void Handle::StoreProgram(const Precision precision, const uint64_t fingerprint,
+                          const Program &program) {
+  programs_[std::make_pair(precision, fingerprint)] = program;
+}
+
+void Handle::AttachWorkspace(const cl_mem buffer, const size_t bytes) {
+  Workspaces::Instance().Attach(Queue(queue_), buffer, bytes);
+  has_workspace_ = true;
+}
+
+// =================================================================================================
+
+MathMode Handle::GetMathMode(const Handle* handle) {
+  if (handle != nullptr && handle->math_mode_ != MathMode::kDefault) { return handle->math_mode_; }
+  return static_cast<MathMode>(GlobalMathMode().load(std::memory_order_relaxed));
+}
+
+void Handle::SetGlobalMathMode(const MathMode mode) {
+  GlobalMathMode().store(static_cast<int>(mode), std::memory_order_relaxed);
+}
+
+// =================================================================================================
+} // namespace clblast
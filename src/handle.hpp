@@ -0,0 +1,79 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Handle class (see 'HandleCreate'): per-user state bundled with a queue,
+// similar to a cuBLAS handle. A routine overload taking a handle activates it for the next routine
+// on its queue from the calling host thread (see 'HandleQueue'). That routine then looks up its
+// compiled programs in the handle's own cache before the global program cache. As a handle is not
+// shared between host threads, this cache needs no lock. A handle can also select the math mode of
+// its routines (see 'MathMode'). This is only available for OpenCL.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_HANDLE_H_
+#define CLBLAST_HANDLE_H_
+
+#include <map>
+#include <utility>
+#include <cstdint>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+class Handle {
+ public:
+
+  // Retains the queue until destruction, detaches the workspace (if any) upon destruction
+  explicit Handle(const RawCommandQueue queue);
+  ~Handle();
+  Handle(const Handle&) = delete;
+  Handle& operator=(const Handle&) = delete;
+
+  // Returns the handle's queue in the form taken by the routines, and activates the handle for the
+  // next routine called on it from this host thread
+  RawCommandQueue* Activate();
+
+  // Returns and deactivates the handle activated on this host thread if it belongs to the queue,
+  // and otherwise returns a nullptr
+  static Handle* TakeActive(const Queue &queue);
+
+  // The handle's own program cache, keyed by precision and program fingerprint (its context and
+  // device are those of the queue)
+  bool GetProgram(const Precision precision, const uint64_t fingerprint, Program &program);
+  void StoreProgram(const Precision precision, const uint64_t fingerprint, const Program &program);
+
+  // Attaches a workspace to the queue, see 'SetWorkspace'
+  void AttachWorkspace(const cl_mem buffer, const size_t bytes);
+
+  const HandleStatistics& GetStatistics() const { return statistics_; }
+
+  // The math mode of the routines called through the handle (see 'HandleSetMathMode')
+  void SetMathMode(const MathMode mode) { math_mode_ = mode; }
+
+  // Returns the math mode of a routine called through the given handle: the handle's own mode or
+  // otherwise (also without a handle) the global mode set by 'SetMathMode'. This doesn't lock.
+  static MathMode GetMathMode(const Handle* handle);
+  static void SetGlobalMathMode(const MathMode mode);
+
+ private:
+  RawCommandQueue queue_;
+  std::map<std::pair<Precision, uint64_t>, Program> programs_;
+  bool has_workspace_;
+  HandleStatistics statistics_;
+  MathMode math_mode_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_HANDLE_H_
+#endif
@@ -13,7 +13,7 @@
 // - Use comments only single-line "//" style, not "/*" and "*/"
 // - Don't use strings with characters parsed (e.g. '//', '}', '#ifdef')
 // - Supports conditionals: #if #ifdef #ifndef #else #elif #endif
-// - ...with the operators: ==
+// - ...with the operators: == != < > <= >= && ||
 // - "#pragma unroll" requires next loop in the form "for (int w = 0; w < 4; w += 1) {"
 //   The above also requires the spaces in that exact form
 // - The loop variable should be a unique string within the code in the for-loop body (e.g. don't
@@ -27,24 +27,21 @@
 #include <sstream>
 #include <algorithm>
 #include <unordered_map>
-#include <map>
 #include <vector>
+#include <mutex>
+#include <functional>
 
 #include "kernel_preprocessor.hpp"
 
 namespace clblast {
 // =================================================================================================
 
-struct compare_longer_string {
-  bool operator() (const std::string &lhs, const std::string &rhs) const {
-    if (lhs.size() > rhs.size()) { return true; }
-    if (lhs.size() < rhs.size()) { return false; }
-    return lhs < rhs;
-  }
-};
+using DefinesIntMap = std::unordered_map<std::string, int>;
+using DefinesStringMap = std::unordered_map<std::string, std::string>;
 
-using DefinesIntMap = std::map<std::string, int, compare_longer_string>;
-using DefinesStringMap = std::map<std::string, std::string, std::greater<std::string>>;
+// A source line split into identifiers and the characters in between them, e.g. "apm[_mi] = 0;"
+// into {"apm", "[", "_mi", "] = ", "0", ";"}, such that identifiers can be substituted directly
+using Tokens = std::vector<std::string>;
 
 void RaiseError(const std::string& source_line, const std::string& exception_message) {
   printf("[OpenCL pre-processor] Error in source line: %s\n", source_line.c_str());
@@ -134,10 +131,49 @@ void FindReplace(std::string &subject, const std::string &search, const std::str
   }
 }
 
+bool IsIdentifierCharacter(const char character) {
+  return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') ||
+         (character >= '0' && character <= '9') || character == '_';
+}
+
+Tokens Tokenize(const std::string& line) {
+  auto tokens = Tokens();
+  auto start = size_t{0};
+  while (start < line.size()) {
+    const auto is_identifier = IsIdentifierCharacter(line[start]);
+    auto end = start + 1;
+    while (end < line.size() && IsIdentifierCharacter(line[end]) == is_identifier) { ++end; }
+    tokens.emplace_back(line.substr(start, end - start));
+    start = end;
+  }
+  return tokens;
+}
+
+// Joins the tokens into a line again, replacing each occurrence of the identifier 'name'
+std::string JoinTokens(const Tokens& tokens, const std::string& name, const std::string& value) {
+  auto line = std::string{};
+  for (const auto& token : tokens) {
+    line += (token == name) ? value : token;
+  }
+  return line;
+}
+
+// Replaces the defines in a string by their values. Only whole identifiers are replaced, such that
+// e.g. a define 'NWI' doesn't match a part of 'NWIB'.
 void SubstituteDefines(const DefinesIntMap& defines,
                        std::string& source_string) {
-  for (const auto &define : defines) {
-    FindReplace(source_string, define.first, std::to_string(define.second));
+  auto start = size_t{0};
+  while (start < source_string.size()) {
+    if (!IsIdentifierCharacter(source_string[start])) { ++start; continue; }
+    auto end = start + 1;
+    while (end < source_string.size() && IsIdentifierCharacter(source_string[end])) { ++end; }
+    const auto define = defines.find(source_string.substr(start, end - start));
+    if (define != defines.end()) {
+      const auto value = std::to_string(define->second);
+      source_string.replace(start, end - start, value);
+      end = start + value.size();
+    }
+    start = end;
   }
 }
 
@@ -175,12 +211,28 @@ bool EvaluateCondition(std::string condition,
     return (defines_string.find(defined_val) != defines_string.end());
   }
 
-  // Process the equality sign
-  const auto equal_pos = condition.find(" == ");
-  if (equal_pos != std::string::npos) {
-    const auto left = condition.substr(0, equal_pos);
-    const auto right = condition.substr(equal_pos + 4);
-    return (left == right);
+  // Process the (in)equality signs
+  for (const auto& comparison : {" == ", " != "}) {
+    const auto comparison_pos = condition.find(comparison);
+    if (comparison_pos != std::string::npos) {
+      const auto left = condition.substr(0, comparison_pos);
+      const auto right = condition.substr(comparison_pos + 4);
+      return (left == right) == (comparison[1] == '=');
+    }
+  }
+
+  // Process the ordering signs (the two-character ones first)
+  for (const auto& comparison : {" <= ", " >= ", " < ", " > "}) {
+    const auto comparison_pos = condition.find(comparison);
+    if (comparison_pos == std::string::npos) { continue; }
+    const auto comparison_string = std::string{comparison};
+    const auto left = ParseMath(condition.substr(0, comparison_pos));
+    const auto right = ParseMath(condition.substr(comparison_pos + comparison_string.size()));
+    if (left == -1 || right == -1) { break; }
+    if (comparison_string == " <= ") { return left <= right; }
+    if (comparison_string == " >= ") { return left >= right; }
+    if (comparison_string == " < ") { return left < right; }
+    return left > right;
   }
   printf("Warning unknown condition: %s\n", condition.c_str());
   return false; // unknown error
@@ -193,7 +245,8 @@ void ArrayToRegister(std::string &source_line, const DefinesIntMap& defines,
                      const std::unordered_map<std::string, size_t>& arrays_to_registers,
                      const size_t num_brackets) {
 
-  for (const auto array_name_map : arrays_to_registers) {  // only if marked to be promoted
+  for (const auto &array_name_map : arrays_to_registers) {  // only if marked to be promoted
+    if (source_line.find(array_name_map.first) == std::string::npos) { continue; }
 
     // Outside of a function
     if (num_brackets == 0) {
@@ -290,26 +343,31 @@ std::vector<std::string> PreprocessDefinesAndComments(const std::string& source,
   while (std::getline(source_stream, line)) {
     //printf("[@%zu] disabled=%d '%s'\n", depth, disabled[depth], line.c_str());
 
-    // Decide whether or not to remain in 'disabled' mode
-    // {0 => enabled, 1 => disabled, but could become enabled again later, 2 => disabled until #endif
-    if (line.find("#endif") != std::string::npos) {
-      disabled[depth] = 0;
-    }
-    if (line.find("#elif") != std::string::npos || line.find("#else") != std::string::npos) {
-      if (disabled[depth] == 0) { disabled[depth] = 2; } // was enabled, now disabled until #endif
-      if (disabled[depth] == 1) { disabled[depth] = 0; } // was disabled, now potentially enabled again
-    }
+    // Most lines don't contain any pre-processor directives and can skip the checks below
+    const auto has_directive = (line.find('#') != std::string::npos);
+    if (has_directive) {
 
-    // Measures the depth of pre-processor defines
-    if ((line.find("#ifndef ") != std::string::npos) ||
-        (line.find("#ifdef ") != std::string::npos) ||
-        (line.find("#if ") != std::string::npos)) {
-      depth++;
-      if (depth >= max_depth_defines) { throw Error<std::runtime_error>("too deep define nest"); }
-    }
-    if (line.find("#endif") != std::string::npos) {
-      if (depth == 0) { throw Error<std::runtime_error>("incorrect define nest"); }
-      depth--;
+      // Decide whether or not to remain in 'disabled' mode
+      // {0 => enabled, 1 => disabled, but could become enabled again later, 2 => disabled until #endif
+      if (line.find("#endif") != std::string::npos) {
+        disabled[depth] = 0;
+      }
+      if (line.find("#elif") != std::string::npos || line.find("#else") != std::string::npos) {
+        if (disabled[depth] == 0) { disabled[depth] = 2; } // was enabled, now disabled until #endif
+        if (disabled[depth] == 1) { disabled[depth] = 0; } // was disabled, now potentially enabled again
+      }
+
+      // Measures the depth of pre-processor defines
+      if ((line.find("#ifndef ") != std::string::npos) ||
+          (line.find("#ifdef ") != std::string::npos) ||
+          (line.find("#if ") != std::string::npos)) {
+        depth++;
+        if (depth >= max_depth_defines) { throw Error<std::runtime_error>("too deep define nest"); }
+      }
+      if (line.find("#endif") != std::string::npos) {
+        if (depth == 0) { throw Error<std::runtime_error>("incorrect define nest"); }
+        depth--;
+      }
     }
 
     // Verifies whether this level or any level below is disabled
@@ -330,6 +388,10 @@ std::vector<std::string> PreprocessDefinesAndComments(const std::string& source,
         if (comment_pos == 0) { continue; }
         line.erase(comment_pos);
       }
+      if (!has_directive) {
+        lines.push_back(std::move(line));
+        continue;
+      }
 
       // Detect #define macros
       const auto define_pos = line.find("#define ");
@@ -383,7 +445,7 @@ std::vector<std::string> PreprocessDefinesAndComments(const std::string& source,
         continue;
       }
 
-      lines.push_back(line);
+      lines.push_back(std::move(line));
     }
   }
   return lines;
@@ -437,7 +499,7 @@ std::vector<std::string> PreprocessUnrollLoops(const std::vector<std::string>& s
     }
 
     // Regular line
-    lines.emplace_back(line);
+    lines.emplace_back(std::move(line));
   }
   return lines;
 }
@@ -480,7 +542,6 @@ std::vector<std::string> PreprocessUnrollLoops(const std::vector<std::string>& s
       if (line_split.size() != 11) { RaiseError(line, "Mis-formatted for-loop #1"); }
 
       // Retrieves loop information (and checks for assumptions)
-      const auto variable_type = line_split[0];
       const auto variable_name = line_split[1];
       if (variable_name != line_split[4]) { RaiseError(line, "Mis-formatted for-loop #2"); }
       if (variable_name != line_split[7]) { RaiseError(line, "Mis-formatted for-loop #3"); }
@@ -501,34 +562,36 @@ std::vector<std::string> PreprocessUnrollLoops(const std::vector<std::string>& s
       auto indent = std::string{""};
       for (auto i = size_t{0}; i < for_pos; ++i) { indent += " "; }
 
-      // Start of the loop
-      line_id++;
+      // Body of the loop, split into tokens only once for all iterations. Lines without the loop
+      // variable are kept as they are.
+      auto body = std::vector<std::pair<std::string, Tokens>>();
       const auto loop_num_brackets = brackets;
-      const auto line_id_start = line_id;
+      while (brackets >= loop_num_brackets) {
+        line_id++;
+        if (line_id >= source_lines.size()) { RaiseError(line, "Mis-formatted for-loop #4"); }
+        const auto& loop_line = source_lines[line_id];
+        brackets += std::count(loop_line.begin(), loop_line.end(), '{');
+        brackets -= std::count(loop_line.begin(), loop_line.end(), '}');
+        const auto tokens = Tokenize(loop_line);
+        const auto has_variable = std::find(tokens.begin(), tokens.end(), variable_name) != tokens.end();
+        body.emplace_back(loop_line, (has_variable) ? tokens : Tokens());
+      }
+
+      // Emits the body for each iteration, substituting the loop variable
       for (auto loop_iter = loop_start; loop_iter < loop_end; loop_iter += loop_increment) {
-        line_id = line_id_start;
-        brackets = loop_num_brackets;
+        const auto loop_value = ToString(loop_iter);
         lines.emplace_back(indent + "{");
-
-        // Body of the loop
-        //lines.emplace_back(indent + "  " + variable_type + " " + variable_name + " = " + ToString(loop_iter) + ";");
-        while (brackets >= loop_num_brackets) {
-          auto loop_line = source_lines[line_id];
-          brackets += std::count(loop_line.begin(), loop_line.end(), '{');
-          brackets -= std::count(loop_line.begin(), loop_line.end(), '}');
-
-          // Regular variable substitution
-          FindReplace(loop_line, variable_name, ToString(loop_iter));
+        for (const auto& body_line : body) {
+          auto loop_line = (body_line.second.empty()) ? body_line.first :
+                           JoinTokens(body_line.second, variable_name, loop_value);
 
           // Array to register promotion
           if (array_to_register_promotion) {
             ArrayToRegister(loop_line, defines, arrays_to_registers, num_brackets_before);
           }
 
-          lines.emplace_back(loop_line);
-          line_id++;
+          lines.emplace_back(std::move(loop_line));
         }
-        line_id--;
       }
     }
     else {
@@ -538,7 +601,7 @@ std::vector<std::string> PreprocessUnrollLoops(const std::vector<std::string>& s
         ArrayToRegister(line, defines, arrays_to_registers, num_brackets_before);
       }
 
-      lines.emplace_back(line);
+      lines.emplace_back(std::move(line));
     }
   }
   return lines;
@@ -546,7 +609,19 @@ std::vector<std::string> PreprocessUnrollLoops(const std::vector<std::string>& s
 
 // =================================================================================================
 
+// Cache of pre-processed sources, keyed on a hash of the source including its defines. The number
+// of entries is limited, since e.g. the tuners compile many one-off variations of a kernel.
+const auto kMaxCachedSources = size_t{64};
+std::unordered_map<size_t, std::string> preprocessed_sources;
+std::mutex preprocessed_sources_mutex;
+
 std::string PreprocessKernelSource(const std::string& kernel_source) {
+  const auto source_hash = std::hash<std::string>{}(kernel_source);
+  {
+    std::lock_guard<std::mutex> lock(preprocessed_sources_mutex);
+    const auto cached = preprocessed_sources.find(source_hash);
+    if (cached != preprocessed_sources.end()) { return cached->second; }
+  }
 
   // Retrieves the defines and removes comments from the source lines
   auto defines = DefinesIntMap();
@@ -571,6 +646,11 @@ std::string PreprocessKernelSource(const std::string& kernel_source) {
       printf("[%zu] %s\n", i, lines[i].c_str());
     }
   }
+
+  // Stores the result for later compilations of the same source
+  std::lock_guard<std::mutex> lock(preprocessed_sources_mutex);
+  if (preprocessed_sources.size() >= kMaxCachedSources) { preprocessed_sources.clear(); }
+  preprocessed_sources[source_hash] = processed_kernel;
   return processed_kernel;
 }
 
@@ -0,0 +1,321 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the embedded kernel sources (see the header for more information). The
+// compressed sources are gzip streams, which are decompressed by a small stand-alone implementation
+// of the deflate format (RFC 1951) such that CLBlast doesn't depend on an external library.
+//
+// =================================================================================================
+
+#include <string>
+#include <array>
+#include <mutex>
+#include <cstdint>
+
+#include "utilities/utilities.hpp"
+#include "kernel_sources.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+// An entry of the table of embedded kernel sources: the name of the file relative to the kernel
+// directory, the stored data and its size, and the size of the source after decompression
+struct KernelSourceEntry {
+  const char *file_name;
+  const unsigned char *data;
+  size_t data_size;
+  size_t source_size;
+  bool compressed;
+};
+
+// The table itself, generated at configure time as 'kKernelSourceTable'
+#include "kernel_sources_table.hpp"
+
+// The file names corresponding to the 'KernelSource' values
+constexpr auto kNumKernelSources = static_cast<size_t>(KernelSource::kNumSources);
+const std::array<const char*, kNumKernelSources> kKernelSourceFiles = {{
+  "level1/level1.opencl", "level1/xamax.opencl", "level1/xasum.opencl", "level1/xaxpby.opencl",
+  "level1/xaxpy.opencl", "level1/xcopy.opencl", "level1/xdot.opencl",
+  "level1/xdotnrm2asum.opencl", "level1/xhad.opencl", "level1/xnrm2.opencl",
+  "level1/xreduce.opencl", "level1/xrot.opencl", "level1/xrotg.opencl", "level1/xscal.opencl",
+  "level1/xset.opencl", "level1/xswap.opencl",
+  "level2/level2.opencl", "level2/xgemv.opencl", "level2/xgemv_banded.opencl",
+  "level2/xgemv_fast.opencl", "level2/xgemv_pair.opencl", "level2/xgemv_quantized.opencl",
+  "level2/xger.opencl", "level2/xher.opencl", "level2/xher2.opencl", "level2/xsymv.opencl",
+  "level2/xtrsv.opencl",
+  "level3/convert_hermitian.opencl", "level3/convert_packed.opencl",
+  "level3/convert_symmetric.opencl",
+  "level3/convert_triangular.opencl", "level3/copy_fast.opencl", "level3/copy_pad.opencl",
+  "level3/invert_diagonal_blocks_enqueue.opencl", "level3/invert_diagonal_blocks_part1.opencl",
+  "level3/invert_diagonal_blocks_part2.opencl",
+  "level3/level3.opencl", "level3/transpose_fast.opencl", "level3/transpose_inplace.opencl",
+  "level3/transpose_pad.opencl", "level3/xgemm_3m.opencl", "level3/xgemm_batched.opencl",
+  "level3/xgemm_direct_batched.opencl", "level3/xgemm_direct_fast.opencl",
+  "level3/xgemm_direct_part1.opencl", "level3/xgemm_direct_part2.opencl",
+  "level3/xgemm_direct_part3.opencl", "level3/xgemm_epilogue.opencl",
+  "level3/xgemm_image.opencl", "level3/xgemm_int8.opencl", "level3/xgemm_part1.opencl",
+  "level3/xgemm_part2.opencl",
+  "level3/xgemm_part3.opencl", "level3/xgemm_part4.opencl", "level3/xgemm_skinny.opencl",
+  "level3/xgemm_splitk.opencl", "level3/xgemm_strassen.opencl", "level3/xgemm_tensor.opencl",
+  "level3/xgemm_tiny_batched.opencl",
+  "levelx/col2im.opencl", "levelx/im2col.opencl", "levelx/xattention.opencl",
+  "levelx/xconvert.opencl", "levelx/xconvgemm.opencl", "levelx/xcsr.opencl",
+  "levelx/xgemm_mlp.opencl", "levelx/xgetrf.opencl", "levelx/xpotrf.opencl"
+}};
+
+// =================================================================================================
+
+// A canonical Huffman code: the number of codes of each length and the symbols ordered by code
+struct HuffmanCode {
+  std::array<uint16_t, 16> count;
+  std::array<uint16_t, 288> symbol;
+};
+
+// Decompresses a raw deflate stream. This is a straightforward rather than a fast implementation,
+// since each kernel source is decompressed only once.
+class Inflater {
+ public:
+  Inflater(const unsigned char *data, const size_t size): data_(data), size_(size) { }
+
+  // Decompresses all blocks of the stream and appends the result to the output
+  void Inflate(std::string &output) {
+    auto last = 0u;
+    do {
+      last = Bits(1);
+      const auto type = Bits(2);
+      if (type == 0) { StoredBlock(output); }
+      else if (type == 1) { FixedBlock(output); }
+      else if (type == 2) { DynamicBlock(output); }
+      else { throw LogicError("Inflater: invalid block type"); }
+    } while (last == 0);
+  }
+
+ private:
+
+  // Reads the given number of bits (at most 16) from the stream, least-significant bit first
+  uint32_t Bits(const int count) {
+    auto value = bit_buffer_;
+    while (bit_count_ < count) {
+      if (position_ >= size_) { throw LogicError("Inflater: unexpected end of the stream"); }
+      value |= static_cast<uint32_t>(data_[position_++]) << bit_count_;
+      bit_count_ += 8;
+    }
+    bit_buffer_ = value >> count;
+    bit_count_ -= count;
+    return value & ((1u << count) - 1u);
+  }
+
+  // Builds a canonical Huffman code from the code lengths of the symbols
+  static void BuildCode(HuffmanCode &code, const uint16_t *lengths, const size_t num_symbols) {
+    code.count.fill(0);
+    for (auto symbol = size_t{0}; symbol < num_symbols; ++symbol) { code.count[lengths[symbol]]++; }
+    auto offsets = std::array<uint16_t, 16>();
+    offsets[1] = 0;
+    for (auto length = size_t{1}; length < 15; ++length) {
+      offsets[length + 1] = static_cast<uint16_t>(offsets[length] + code.count[length]);
+    }
+    for (auto symbol = size_t{0}; symbol < num_symbols; ++symbol) {
+      if (lengths[symbol] != 0) {
+        code.symbol[offsets[lengths[symbol]]++] = static_cast<uint16_t>(symbol);
+      }
+    }
+  }
+
+  // Decodes a single symbol, reading the code bit-by-bit
+  uint32_t Decode(const HuffmanCode &code) {
+    auto value = 0;  // the code read so far
+    auto first = 0;  // the first code of the current length
+    auto index = 0;  // the index of the first code of the current length in the symbol table
+    for (auto length = 1; length < 16; ++length) {
+      value |= static_cast<int>(Bits(1));
+      const auto count = static_cast<int>(code.count[length]);
+      if (value - count < first) { return code.symbol[index + (value - first)]; }
+      index += count;
+      first = (first + count) << 1;
+      value <<= 1;
+    }
+    throw LogicError("Inflater: invalid Huffman code");
+  }
+
+  // Copies an uncompressed block, which starts at a byte boundary
+  void StoredBlock(std::string &output) {
+    bit_buffer_ = 0;
+    bit_count_ = 0;
+    if (position_ + 4 > size_) { throw LogicError("Inflater: unexpected end of the stream"); }
+    const auto length = data_[position_] | (data_[position_ + 1] << 8);
+    const auto inverse = data_[position_ + 2] | (data_[position_ + 3] << 8);
+    position_ += 4;
+    if (length != (~inverse & 0xFFFF)) { throw LogicError("Inflater: invalid stored block"); }
+    if (position_ + length > size_) { throw LogicError("Inflater: unexpected end of the stream"); }
+    output.append(reinterpret_cast<const char*>(data_ + position_), length);
+    position_ += length;
+  }
+
+  // Decodes the literals and length/distance pairs of a compressed block
+  void DecodeBlock(std::string &output, const HuffmanCode &lengths, const HuffmanCode &distances) {
+    static const uint16_t kLengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                             35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227,
+                                             258};
+    static const uint16_t kLengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3,
+                                              3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    static const uint16_t kDistanceBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129,
+                                               193, 257, 385, 513, 769, 1025, 1537, 2049, 3073,
+                                               4097, 6145, 8193, 12289, 16385, 24577};
+    static const uint16_t kDistanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7,
+                                                7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+    while (true) {
+      auto symbol = Decode(lengths);
+      if (symbol < 256) { output.push_back(static_cast<char>(symbol)); continue; }
+      if (symbol == 256) { return; } // end of the block
+      symbol -= 257;
+      if (symbol >= 29) { throw LogicError("Inflater: invalid length symbol"); }
+      const auto length = kLengthBase[symbol] + Bits(kLengthExtra[symbol]);
+      const auto distance_symbol = Decode(distances);
+      if (distance_symbol >= 30) { throw LogicError("Inflater: invalid distance symbol"); }
+      const auto distance = kDistanceBase[distance_symbol] + Bits(kDistanceExtra[distance_symbol]);
+      if (distance > output.size()) { throw LogicError("Inflater: distance too far back"); }
+      for (auto i = size_t{0}; i < length; ++i) {  // byte-by-byte, since the copies may overlap
+        output.push_back(output[output.size() - distance]);
+      }
+    }
+  }
+
+  // Decodes a block compressed with the fixed Huffman codes
+  void FixedBlock(std::string &output) {
+    auto lengths = std::array<uint16_t, 288>();
+    for (auto symbol = size_t{0}; symbol < 288; ++symbol) {
+      lengths[symbol] = (symbol < 144) ? 8 : (symbol < 256) ? 9 : (symbol < 280) ? 7 : 8;
+    }
+    auto distance_lengths = std::array<uint16_t, 30>();
+    distance_lengths.fill(5);
+    auto length_code = HuffmanCode();
+    auto distance_code = HuffmanCode();
+    BuildCode(length_code, lengths.data(), lengths.size());
+    BuildCode(distance_code, distance_lengths.data(), distance_lengths.size());
+    DecodeBlock(output, length_code, distance_code);
+  }
+
+  // Decodes a block compressed with Huffman codes that are stored in the block itself
+  void DynamicBlock(std::string &output) {
+    static const uint8_t kOrder[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14,
+                                       1, 15};
+    const auto num_lengths = Bits(5) + 257;
+    const auto num_distances = Bits(5) + 1;
+    const auto num_code_lengths = Bits(4) + 4;
+    if (num_lengths > 286 || num_distances > 30) { throw LogicError("Inflater: invalid counts"); }
+
+    // Reads the code that encodes the code lengths
+    auto lengths = std::array<uint16_t, 320>();
+    lengths.fill(0);
+    for (auto index = size_t{0}; index < num_code_lengths; ++index) {
+      lengths[kOrder[index]] = static_cast<uint16_t>(Bits(3));
+    }
+    auto length_code = HuffmanCode();
+    BuildCode(length_code, lengths.data(), 19);
+
+    // Reads the code lengths of the literal/length and the distance codes
+    auto index = size_t{0};
+    while (index < num_lengths + num_distances) {
+      const auto symbol = Decode(length_code);
+      if (symbol < 16) { lengths[index++] = static_cast<uint16_t>(symbol); continue; }
+      auto value = uint16_t{0};
+      auto repeat = uint32_t{0};
+      if (symbol == 16) {
+        if (index == 0) { throw LogicError("Inflater: repeat without a previous length"); }
+        value = lengths[index - 1];
+        repeat = 3 + Bits(2);
+      }
+      else if (symbol == 17) { repeat = 3 + Bits(3); }
+      else { repeat = 11 + Bits(7); }
+      if (index + repeat > num_lengths + num_distances) {
+        throw LogicError("Inflater: too many code lengths");
+      }
+      for (auto i = uint32_t{0}; i < repeat; ++i) { lengths[index++] = value; }
+    }
+
+    // Builds the codes and decodes the block
+    auto distance_code = HuffmanCode();
+    BuildCode(length_code, lengths.data(), num_lengths);
+    BuildCode(distance_code, lengths.data() + num_lengths, num_distances);
+    DecodeBlock(output, length_code, distance_code);
+  }
+
+  const unsigned char *data_;
+  const size_t size_;
+  size_t position_ = 0;
+  uint32_t bit_buffer_ = 0;
+  int bit_count_ = 0;
+};
+
+// Computes the CRC-32 checksum as stored in the trailer of a gzip stream
+uint32_t Crc32(const std::string &data) {
+  auto crc = uint32_t{0xFFFFFFFF};
+  for (const auto character : data) {
+    crc ^= static_cast<unsigned char>(character);
+    for (auto bit = 0; bit < 8; ++bit) { crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u))); }
+  }
+  return ~crc;
+}
+
+// Decompresses a gzip stream (RFC 1952) and verifies the result against its trailer
+std::string Gunzip(const unsigned char *data, const size_t size, const size_t expected_size) {
+  const auto error = std::string{"Gunzip: invalid gzip stream"};
+  if (size < 18 || data[0] != 0x1f || data[1] != 0x8b || data[2] != 8) { throw LogicError(error); }
+
+  // Skips the optional fields of the header
+  const auto flags = data[3];
+  auto position = size_t{10};
+  if (flags & 0x04) { position += 2 + (data[position] | (data[position + 1] << 8)); }
+  if (flags & 0x08) { while (position < size && data[position++] != 0) { } }
+  if (flags & 0x10) { while (position < size && data[position++] != 0) { } }
+  if (flags & 0x02) { position += 2; }
+  if (position + 8 > size) { throw LogicError(error); }
+
+  // Decompresses the data and verifies the checksum and the size
+  auto result = std::string();
+  result.reserve(expected_size);
+  Inflater(data + position, size - 8 - position).Inflate(result);
+  const auto trailer = data + size - 8;
+  const auto crc = static_cast<uint32_t>(trailer[0]) | (static_cast<uint32_t>(trailer[1]) << 8) |
+                   (static_cast<uint32_t>(trailer[2]) << 16) |
+                   (static_cast<uint32_t>(trailer[3]) << 24);
+  if (result.size() != expected_size || Crc32(result) != crc) { throw LogicError(error); }
+  return result;
+}
+
+// Retrieves a source from the table by its file name
+std::string LoadKernelSource(const std::string &file_name) {
+  for (const auto &entry : kKernelSourceTable) {
+    if (file_name != entry.file_name) { continue; }
+    if (entry.compressed) { return Gunzip(entry.data, entry.data_size, entry.source_size); }
+    return std::string(reinterpret_cast<const char*>(entry.data), entry.data_size);
+  }
+  throw LogicError("GetKernelSource: kernel source '" + file_name + "' not found");
+}
+
+} // anonymous namespace
+
+// =================================================================================================
+
+// Decompresses each source at most once, the results are kept for later programs
+const std::string& GetKernelSource(const KernelSource source) {
+  static std::array<std::string, kNumKernelSources> sources;
+  static std::array<std::once_flag, kNumKernelSources> loaded;
+  const auto index = static_cast<size_t>(source);
+  if (index >= kNumKernelSources) { throw LogicError("GetKernelSource: invalid kernel source"); }
+  std::call_once(loaded[index], [index]() {
+    sources[index] = LoadKernelSource(kKernelSourceFiles[index]);
+  });
+  return sources[index];
+}
+
+// =================================================================================================
+} // namespace clblast
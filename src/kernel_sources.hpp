@@ -0,0 +1,49 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file provides the embedded kernel sources. Each '.opencl' file is stored only once in the
+// library, in a table generated at configure time by 'cmake/kernel_sources.cmake' and compressed
+// if possible. The routines refer to the files in the table by name: a source is decompressed on
+// its first use only, such that the sources of unused routines never take up memory.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_KERNEL_SOURCES_H_
+#define CLBLAST_KERNEL_SOURCES_H_
+
+#include <string>
+
+namespace clblast {
+// =================================================================================================
+
+// The kernel source files, in the order of 'kKernelSourceFiles'
+enum class KernelSource {
+  kLevel1, kXamax, kXasum, kXaxpby, kXaxpy, kXcopy, kXdot, kXdotnrm2asum, kXhad, kXnrm2, kXreduce,
+  kXrot, kXrotg, kXscal, kXset, kXswap,
+  kLevel2, kXgemv, kXgemvBanded, kXgemvFast, kXgemvPair, kXgemvQuantized, kXger, kXher, kXher2,
+  kXsymv, kXtrsv,
+  kConvertHermitian, kConvertPacked, kConvertSymmetric, kConvertTriangular, kCopyFast, kCopyPad,
+  kInvertDiagonalBlocksEnqueue, kInvertDiagonalBlocksPart1, kInvertDiagonalBlocksPart2, kLevel3,
+  kTransposeFast, kTransposeInplace, kTransposePad, kXgemm3m, kXgemmBatched, kXgemmDirectBatched,
+  kXgemmDirectFast, kXgemmDirectPart1, kXgemmDirectPart2, kXgemmDirectPart3, kXgemmEpilogue,
+  kXgemmImage, kXgemmInt8, kXgemmPart1, kXgemmPart2, kXgemmPart3, kXgemmPart4, kXgemmSkinny, kXgemmSplitk,
+  kXgemmStrassen, kXgemmTensor, kXgemmTinyBatched,
+  kCol2im, kIm2col, kXattention, kXconvert, kXconvgemm, kXcsr, kXgemmMlp, kXgetrf, kXpotrf,
+  kNumSources // not a source, the number of sources
+};
+
+// Retrieves the contents of a kernel source file, decompressing it on first use. The result stays
+// valid for the lifetime of the library. Thread-safe.
+const std::string& GetKernelSource(const KernelSource source);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_KERNEL_SOURCES_H_
+#endif
@@ -66,6 +66,20 @@ typedef struct { double s0; double s1; double s2; double s3;
                  double s8; double s9; double s10; double s11;
                  double s12; double s13; double s14; double s15; } double16;
 
+// Half-precision data-types from the CUDA headers (see 'CompileFromSource' for the include path)
+#if PRECISION == 16 || PRECISION == 1632
+  #include <cuda_fp16.h>
+  typedef __half half;
+  typedef __half2 half2;
+  typedef struct { half x; half y; half z; half w; } half4;
+  typedef struct { half s0; half s1; half s2; half s3;
+                   half s4; half s5; half s6; half s7; } half8;
+  typedef struct { half s0; half s1; half s2; half s3;
+                   half s4; half s5; half s6; half s7;
+                   half s8; half s9; half s10; half s11;
+                   half s12; half s13; half s14; half s15; } half16;
+#endif
+
 // Replaces the OpenCL keywords with CUDA equivalent
 #define __kernel __placeholder__
 #define __global
@@ -80,6 +94,12 @@ typedef struct { double s0; double s1; double s2; double s3;
 
 // Replaces OpenCL synchronisation with CUDA synchronisation
 #define barrier(x) __syncthreads()
+#define mem_fence(x) __threadfence()
+
+// Replaces OpenCL atomics with CUDA atomics
+#define atomic_inc(x) atomicAdd(x, 1)
+#define atomic_add(x, y) atomicAdd(x, y)
+#define atomic_xchg(x, y) atomicExch(x, y)
 
 // =================================================================================================
 
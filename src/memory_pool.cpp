@@ -0,0 +1,384 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the device memory pool (see the header for more information).
+//
+// =================================================================================================
+
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+
+#include "memory_pool.hpp"
+#include "statistics.hpp"
+#include "cache.hpp"
+
+namespace clblast {
+// =================================================================================================
+#ifdef OPENCL_API
+
+const size_t MemoryPool::kDefaultLimit = size_t{256} * 1024 * 1024;
+
+// The limit is initialized from the environmental variable (if set)
+MemoryPool::MemoryPool():
+    pooled_bytes_(0),
+    limit_(ConvertArgument(std::getenv("CLBLAST_MEMORY_POOL_LIMIT"), kDefaultLimit)) {
+}
+
+MemoryPool &MemoryPool::Instance() {
+  static MemoryPool instance;
+  return instance;
+}
+
+// Sizes are rounded up to powers of two, such that buffers can be re-used for similar sizes
+size_t MemoryPool::BucketSize(const size_t bytes) {
+  auto bucket_size = size_t{256};
+  while (bucket_size < bytes) { bucket_size *= 2; }
+  return bucket_size;
+}
+
+// =================================================================================================
+
+std::shared_ptr<cl_mem> MemoryPool::Allocate(const Context &context, const Queue &queue,
+                                             const size_t bytes) {
+  const auto bucket_size = BucketSize(bytes);
+  auto buffer = cl_mem{nullptr};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &context_pool = pool_[context()];
+    const auto range = context_pool.equal_range(bucket_size);
+    for (auto it = range.first; it != range.second; ++it) {
+      const auto &entry = it->second;
+
+      // Later commands on the same in-order queue are ordered after the last use of the buffer.
+      // Otherwise the buffer can only be re-used once all previous commands have completed.
+      auto available = (entry.queue_in_order && entry.queue == queue());
+      if (!available) {
+        auto status = cl_int{CL_COMPLETE};
+        CheckError(clGetEventInfo(entry.marker, CL_EVENT_COMMAND_EXECUTION_STATUS,
+                                  sizeof(cl_int), &status, nullptr));
+        available = (status == CL_COMPLETE);
+      }
+      if (available) {
+        buffer = entry.buffer;
+        CheckError(clReleaseCommandQueue(entry.queue));
+        CheckError(clReleaseEvent(entry.marker));
+        pooled_bytes_ -= entry.bytes;
+        context_pool.erase(it);
+        break;
+      }
+    }
+  }
+
+  // Allocates a new buffer in case of a miss. In case of an allocation failure, all unused memory
+  // is released and the allocation is tried once more.
+  if (buffer == nullptr) {
+    auto status = CL_SUCCESS;
+    buffer = clCreateBuffer(context(), CL_MEM_READ_WRITE, bucket_size, nullptr, &status);
+    if (status == CL_MEM_OBJECT_ALLOCATION_FAILURE || status == CL_OUT_OF_RESOURCES) {
+      Trim();
+      buffer = clCreateBuffer(context(), CL_MEM_READ_WRITE, bucket_size, nullptr, &status);
+    }
+    CLCudaAPIError::Check(status, "clCreateBuffer");
+    CountBufferAllocation(bucket_size);
+  }
+  else {
+    CountBufferReuse();
+  }
+
+  // The buffer is handed back to the pool upon destruction of the last copy
+  const auto raw_context = context();
+  const auto raw_queue = queue();
+  return std::shared_ptr<cl_mem>(new cl_mem{buffer}, [this, raw_context, raw_queue, bucket_size](cl_mem* m) {
+    Return(raw_context, raw_queue, *m, bucket_size);
+    delete m;
+  });
+}
+
+// Hands a buffer back to the pool. This is called from a destructor, so it must not throw.
+void MemoryPool::Return(const cl_context context, const cl_command_queue queue, const cl_mem buffer,
+                        const size_t bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto entry = Entry{buffer, bytes, queue, false, nullptr};
+  auto properties = cl_command_queue_properties{0};
+  const auto add_to_pool = (bytes <= limit_) &&
+      (clGetCommandQueueInfo(queue, CL_QUEUE_PROPERTIES, sizeof(properties), &properties, nullptr) == CL_SUCCESS) &&
+      (clEnqueueMarker(queue, &entry.marker) == CL_SUCCESS);
+  if (!add_to_pool) {
+    CheckErrorDtor(clReleaseMemObject(buffer)); // the release is deferred until the buffer is unused
+    return;
+  }
+  entry.queue_in_order = (properties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) == 0;
+  CheckErrorDtor(clRetainCommandQueue(queue));
+
+  // Makes room for the new entry in case the limit would be exceeded
+  EvictUnusedEntries(limit_ - bytes);
+  pool_[context].emplace(bytes, entry);
+  pooled_bytes_ += bytes;
+}
+
+// =================================================================================================
+
+void MemoryPool::SetLimit(const size_t bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  limit_ = bytes;
+  EvictUnusedEntries(limit_);
+}
+
+void MemoryPool::Trim() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  EvictUnusedEntries(0);
+}
+
+void MemoryPool::Trim(const cl_context context) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto context_it = pool_.find(context);
+  if (context_it == pool_.end()) { return; }
+  for (const auto &entry : context_it->second) {
+    ReleaseEntry(entry.second);
+    pooled_bytes_ -= entry.second.bytes;
+  }
+  pool_.erase(context_it);
+}
+
+// Releases entries until the total amount of pooled memory is at most the target, starting with
+// the largest buffers. Note that buffers that are still in use are only freed by OpenCL afterwards.
+void MemoryPool::EvictUnusedEntries(const size_t target_bytes) {
+  for (auto context_it = pool_.begin(); context_it != pool_.end() && pooled_bytes_ > target_bytes; ) {
+    auto &context_pool = context_it->second;
+    while (!context_pool.empty() && pooled_bytes_ > target_bytes) {
+      const auto it = std::prev(context_pool.end());
+      ReleaseEntry(it->second);
+      pooled_bytes_ -= it->second.bytes;
+      context_pool.erase(it);
+    }
+    if (context_pool.empty()) { context_it = pool_.erase(context_it); } else { ++context_it; }
+  }
+}
+
+void MemoryPool::ReleaseEntry(const Entry &entry) {
+  CheckErrorDtor(clReleaseEvent(entry.marker));
+  CheckErrorDtor(clReleaseCommandQueue(entry.queue));
+  CheckErrorDtor(clReleaseMemObject(entry.buffer));
+}
+
+// =================================================================================================
+
+Workspaces &Workspaces::Instance() {
+  static Workspaces instance;
+  return instance;
+}
+
+// The workspace is re-used from the start for each routine, which requires an in-order queue. The
+// sub-buffers are aligned to the device's base address alignment.
+void Workspaces::Attach(const Queue &queue, const cl_mem buffer, const size_t bytes) {
+  auto properties = cl_command_queue_properties{0};
+  CheckError(clGetCommandQueueInfo(queue(), CL_QUEUE_PROPERTIES, sizeof(properties), &properties, nullptr));
+  if ((properties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) != 0) {
+    throw BLASError(StatusCode::kInvalidValue);
+  }
+  auto alignment_bits = cl_uint{0};
+  CheckError(clGetDeviceInfo(queue.GetDevice()(), CL_DEVICE_MEM_BASE_ADDR_ALIGN, sizeof(cl_uint),
+                             &alignment_bits, nullptr));
+  const auto alignment = std::max(static_cast<size_t>(alignment_bits / 8), size_t{1});
+  if (buffer != nullptr) { CheckError(clRetainMemObject(buffer)); }
+  const auto entry = std::make_shared<Entry>(Entry{buffer, (buffer != nullptr) ? bytes : 0,
+                                                   alignment, 0, 0, 0});
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &workspace = workspaces_[queue()];
+  if (workspace == nullptr) { num_workspaces_++; }
+  else if (workspace->buffer != nullptr) { CheckError(clReleaseMemObject(workspace->buffer)); }
+  workspace = entry;
+}
+
+// Sub-buffers still in use keep the memory of the workspace alive
+void Workspaces::Detach(const Queue &queue) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto it = workspaces_.find(queue());
+  if (it == workspaces_.end()) { return; }
+  if (it->second->buffer != nullptr) { CheckError(clReleaseMemObject(it->second->buffer)); }
+  workspaces_.erase(it);
+  num_workspaces_--;
+}
+
+size_t Workspaces::PeakSize(const Queue &queue) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto it = workspaces_.find(queue());
+  return (it == workspaces_.end()) ? 0 : it->second->peak;
+}
+
+std::shared_ptr<cl_mem> Workspaces::Allocate(const Context &context, const Queue &queue,
+                                             const size_t bytes) {
+  if (num_workspaces_.load() == 0) { return MemoryPool::Instance().Allocate(context, queue, bytes); }
+
+  // Takes the next part of the workspace, also in case it doesn't fit such that the peak size is
+  // recorded
+  auto entry = std::shared_ptr<Entry>();
+  auto buffer = cl_mem{nullptr};
+  auto status = cl_int{CL_SUCCESS};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = workspaces_.find(queue());
+    if (it != workspaces_.end()) {
+      entry = it->second;
+      const auto origin = Ceil(entry->used, entry->alignment);
+      entry->used = origin + bytes;
+      entry->live += 1;
+      entry->peak = std::max(entry->peak, entry->used);
+      if (entry->used <= entry->bytes) {
+        auto region = cl_buffer_region{origin, bytes};
+        buffer = clCreateSubBuffer(entry->buffer, 0, CL_BUFFER_CREATE_TYPE_REGION, &region, &status);
+        if (status != CL_SUCCESS) {
+          entry->live -= 1;
+          entry->used = (entry->live == 0) ? 0 : origin;
+        }
+      }
+    }
+  }
+  CLCudaAPIError::Check(status, "clCreateSubBuffer");
+  if (entry == nullptr) { return MemoryPool::Instance().Allocate(context, queue, bytes); }
+
+  // The part of the workspace is handed back upon destruction of the last copy
+  if (buffer != nullptr) {
+    CountBufferReuse();
+    return std::shared_ptr<cl_mem>(new cl_mem{buffer}, [this, entry](cl_mem* m) {
+      CheckErrorDtor(clReleaseMemObject(*m));
+      Release(entry);
+      delete m;
+    });
+  }
+
+  // Otherwise the buffer is taken from the memory pool
+  const auto pooled = MemoryPool::Instance().Allocate(context, queue, bytes);
+  return std::shared_ptr<cl_mem>(new cl_mem{*pooled}, [this, entry, pooled](cl_mem* m) {
+    Release(entry);
+    delete m;
+  });
+}
+
+// This is called from a destructor, so it must not throw
+void Workspaces::Release(const std::shared_ptr<Entry> &entry) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entry->live -= 1;
+  if (entry->live == 0) { entry->used = 0; }
+}
+
+// =================================================================================================
+#elif CUDA_API
+
+const size_t MemoryPool::kDefaultLimit = size_t{256} * 1024 * 1024;
+
+// The limit is initialized from the environmental variable (if set)
+MemoryPool::MemoryPool():
+    limit_(ConvertArgument(std::getenv("CLBLAST_MEMORY_POOL_LIMIT"), kDefaultLimit)) {
+}
+
+MemoryPool &MemoryPool::Instance() {
+  static MemoryPool instance;
+  return instance;
+}
+
+// The pool is created on first use for a context. Its release threshold is the limit, such that
+// the unused memory up to the limit is kept when synchronizing rather than returned to the OS.
+#if CUDA_VERSION >= 11020
+  CUmemoryPool MemoryPool::Get(const Context &context, const Queue &queue) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (limit_ == 0) { return nullptr; }
+    const auto it = pools_.find(context());
+    if (it != pools_.end()) { return it->second; }
+    auto pool = CUmemoryPool{nullptr};
+    const auto device = queue.GetDevice();
+    auto supported = 0;
+    CheckError(cuDeviceGetAttribute(&supported, CU_DEVICE_ATTRIBUTE_MEMORY_POOLS_SUPPORTED, device()));
+    if (supported) {
+      auto properties = CUmemPoolProps{};
+      properties.allocType = CU_MEM_ALLOCATION_TYPE_PINNED;
+      properties.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+      properties.location.id = static_cast<int>(device());
+      CheckError(cuMemPoolCreate(&pool, &properties));
+      auto threshold = static_cast<cuuint64_t>(limit_);
+      CheckError(cuMemPoolSetAttribute(pool, CU_MEMPOOL_ATTR_RELEASE_THRESHOLD, &threshold));
+    }
+    pools_[context()] = pool;
+    return pool;
+  }
+#endif
+
+// =================================================================================================
+
+void MemoryPool::SetLimit(const size_t bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  limit_ = bytes;
+  #if CUDA_VERSION >= 11020
+    for (const auto &pool : pools_) {
+      if (pool.second == nullptr) { continue; }
+      auto threshold = static_cast<cuuint64_t>(limit_);
+      CheckError(cuMemPoolSetAttribute(pool.second, CU_MEMPOOL_ATTR_RELEASE_THRESHOLD, &threshold));
+      CheckError(cuMemPoolTrimTo(pool.second, limit_));
+    }
+  #endif
+}
+
+// Note that memory which is still in use, or freed but not yet synchronized, is not released
+void MemoryPool::Trim() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  #if CUDA_VERSION >= 11020
+    for (const auto &pool : pools_) {
+      if (pool.second != nullptr) { CheckError(cuMemPoolTrimTo(pool.second, 0)); }
+    }
+  #endif
+}
+
+void MemoryPool::Trim(const CUcontext context) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  #if CUDA_VERSION >= 11020
+    const auto it = pools_.find(context);
+    if (it != pools_.end() && it->second != nullptr) { CheckError(cuMemPoolTrimTo(it->second, 0)); }
+  #else
+    static_cast<void>(context);
+  #endif
+}
+
+#endif
+// =================================================================================================
+
+std::atomic<size_t> &GemmWorkspace::Limit() {
+  static std::atomic<size_t> limit(ConvertArgument(std::getenv("CLBLAST_GEMM_WORKSPACE_LIMIT"),
+                                                   size_t{0}));
+  return limit;
+}
+
+void GemmWorkspace::SetLimit(const size_t bytes) {
+  Limit().store(bytes);
+}
+
+size_t GemmWorkspace::GetLimit(const Device &device) {
+  const auto limit = Limit().load();
+  if (limit != 0) { return limit; }
+  const auto limits = GetDeviceLimits(device);
+  return std::min(static_cast<size_t>(limits.max_alloc_size),
+                  static_cast<size_t>(limits.memory_size / 4));
+}
+
+std::atomic<size_t> &GemmWorkspace::ChunkLimit() {
+  static std::atomic<size_t> limit(ConvertArgument(std::getenv("CLBLAST_GEMM_CHUNK_LIMIT"),
+                                                   size_t{0}));
+  return limit;
+}
+
+void GemmWorkspace::SetChunkLimit(const size_t multiply_adds) {
+  ChunkLimit().store(multiply_adds);
+}
+
+size_t GemmWorkspace::GetChunkLimit() {
+  return ChunkLimit().load();
+}
+
+// =================================================================================================
+} // namespace clblast
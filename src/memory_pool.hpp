@@ -0,0 +1,229 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a pool of device memory for the temporary buffers of the routines. Instead
+// of creating and releasing a buffer on each call, buffers are returned to a per-context pool and
+// re-used by later calls. A returned buffer might still be in use by kernels in flight, hence a
+// marker event is recorded upon return: the buffer is only handed out again once this event has
+// completed, or straight away to later calls on the same in-order queue.
+//
+// The CUDA back-end uses stream-ordered allocations from a per-context CUDA memory pool instead
+// (CUDA 11.2 and up): freed memory is kept by the pool and re-used by later allocations, which
+// are ordered after the free on the same stream, or after it has completed on other streams.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_MEMORY_POOL_H_
+#define CLBLAST_MEMORY_POOL_H_
+
+#include <memory>
+#include <mutex>
+#include <map>
+#include <atomic>
+
+#include "utilities/utilities.hpp"
+#include "command_graph.hpp"
+#include "tracing.hpp"
+#include "statistics.hpp"
+#ifdef OPENCL_API
+  #include "explanation.hpp"
+#endif
+
+namespace clblast {
+// =================================================================================================
+#ifdef OPENCL_API
+
+// See comment at top of file for a description of the class
+class MemoryPool {
+ public:
+
+  // The default maximum amount of unused memory (in bytes) kept in the pool per process
+  static const size_t kDefaultLimit;
+
+  // Retrieves a buffer of at least 'bytes' bytes to be used on the given queue. The buffer is
+  // returned to the pool when the last copy of the shared pointer is destroyed.
+  std::shared_ptr<cl_mem> Allocate(const Context &context, const Queue &queue, const size_t bytes);
+
+  // Sets the maximum amount of unused memory kept in the pool, zero disables the pool
+  void SetLimit(const size_t bytes);
+
+  // Releases all unused memory in the pool, or only that of the given context
+  void Trim();
+  void Trim(const cl_context context);
+
+  static MemoryPool &Instance();
+
+ private:
+
+  // An unused buffer in the pool, including the queue it was last used on and the marker event
+  // which completes when it is not in use anymore
+  struct Entry {
+    cl_mem buffer;
+    size_t bytes;
+    cl_command_queue queue;
+    bool queue_in_order;
+    cl_event marker;
+  };
+
+  MemoryPool();
+  void Return(const cl_context context, const cl_command_queue queue, const cl_mem buffer,
+              const size_t bytes);
+  static size_t BucketSize(const size_t bytes);
+  static void ReleaseEntry(const Entry &entry);
+  void EvictUnusedEntries(const size_t target_bytes); // requires the lock to be taken
+
+  std::map<cl_context, std::multimap<size_t, Entry>> pool_;
+  size_t pooled_bytes_;
+  size_t limit_;
+  std::mutex mutex_;
+}; // class MemoryPool
+
+// The user-provided workspaces attached to queues (see 'SetWorkspace'). The temporary buffers of
+// the routines on such a queue are sub-buffers of its workspace, allocated one after another, and
+// the workspace is re-used from the start once none of them is in use anymore. Subsequent commands
+// on the same in-order queue are ordered after the previous uses. Temporary buffers which don't fit
+// are taken from the memory pool instead. A workspace without a buffer only records the peak size.
+class Workspaces {
+ public:
+
+  // Attaches a workspace of 'bytes' bytes to a queue (replacing any previous one), or detaches it
+  void Attach(const Queue &queue, const cl_mem buffer, const size_t bytes);
+  void Detach(const Queue &queue);
+
+  // Retrieves the peak size (in bytes) of the temporary buffers of a single routine on the queue
+  size_t PeakSize(const Queue &queue);
+
+  // Retrieves a temporary buffer from the workspace attached to the queue, or from the memory pool
+  // in case there is no workspace or it is too small
+  std::shared_ptr<cl_mem> Allocate(const Context &context, const Queue &queue, const size_t bytes);
+
+  static Workspaces &Instance();
+
+ private:
+  struct Entry {
+    cl_mem buffer;
+    size_t bytes;
+    size_t alignment;
+    size_t used;
+    size_t live;
+    size_t peak;
+  };
+
+  Workspaces(): num_workspaces_(0) {}
+  void Release(const std::shared_ptr<Entry> &entry);
+
+  std::map<cl_command_queue, std::shared_ptr<Entry>> workspaces_;
+  std::atomic<size_t> num_workspaces_; // such that the look-up can be skipped without a lock
+  std::mutex mutex_;
+}; // class Workspaces
+
+#elif CUDA_API
+
+// See comment at top of file for a description of the class
+class MemoryPool {
+ public:
+
+  // The default maximum amount of unused memory (in bytes) kept in each CUDA memory pool
+  static const size_t kDefaultLimit;
+
+  // Retrieves the memory pool for the context and device of the given queue, or nullptr if stream-
+  // ordered allocations are not supported by the device or if the pool is disabled
+  #if CUDA_VERSION >= 11020
+    CUmemoryPool Get(const Context &context, const Queue &queue);
+  #endif
+
+  // Sets the maximum amount of unused memory kept in the pools, zero disables the pools
+  void SetLimit(const size_t bytes);
+
+  // Releases all unused memory in the pools, or only that of the given context
+  void Trim();
+  void Trim(const CUcontext context);
+
+  static MemoryPool &Instance();
+
+ private:
+  MemoryPool();
+
+  #if CUDA_VERSION >= 11020
+    std::map<CUcontext, CUmemoryPool> pools_;
+  #endif
+  size_t limit_;
+  std::mutex mutex_;
+}; // class MemoryPool
+
+#endif
+
+// =================================================================================================
+
+// The maximum amount of memory (in bytes) of the temporary buffers of a single GEMM call, beyond
+// which the indirect GEMM is computed in blocks (see 'Xgemm::GemmIndirectBlocked'). The limit is
+// initialized from the 'CLBLAST_GEMM_WORKSPACE_LIMIT' environmental variable (if set). A limit of
+// zero (the default) derives it from the device: its maximum allocation size, up to a quarter of
+// its memory. Similarly, the chunk limit bounds the work of a single block (in multiply-adds), such
+// that other queues get the device in between. It is initialized from 'CLBLAST_GEMM_CHUNK_LIMIT',
+// zero (the default) disables it.
+class GemmWorkspace {
+ public:
+  static void SetLimit(const size_t bytes);
+  static size_t GetLimit(const Device &device);
+  static void SetChunkLimit(const size_t multiply_adds);
+  static size_t GetChunkLimit();
+
+ private:
+  static std::atomic<size_t> &Limit();
+  static std::atomic<size_t> &ChunkLimit();
+};
+
+// =================================================================================================
+
+// Retrieves a temporary buffer of 'size' elements, which is returned to the memory pool afterwards.
+// While a command graph is captured on the queue, the buffer is a regular one which is kept alive
+// by the graph. While a call is explained, only its size is recorded and a null buffer returned.
+template <typename T>
+Buffer<T> TemporaryBuffer(const Context &context, const Queue &queue, const size_t size) {
+  const auto trace = TraceScope("TemporaryBuffer", "memory");
+  #ifdef OPENCL_API
+    if (ExplanationScope::Current() != nullptr) {
+      ExplainTemporaryBuffer(size * sizeof(T));
+      return Buffer<T>(0);
+    }
+  #endif
+  if (CommandGraph::IsCapturing(queue)) {
+    auto buffer = Buffer<T>(context, size);
+    CountBufferAllocation(size * sizeof(T));
+    CommandGraph::KeepAlive(queue, std::make_shared<Buffer<T>>(buffer));
+    return buffer;
+  }
+  #ifdef OPENCL_API
+    if (size == 0) { return Buffer<T>(context, 0); }
+    return Buffer<T>(Workspaces::Instance().Allocate(context, queue, size * sizeof(T)));
+  #else
+    #if CUDA_VERSION >= 11020
+      const auto pool = MemoryPool::Instance().Get(context, queue);
+      if (pool != nullptr && size > 0) {
+        auto reserved_before = cuuint64_t{0};
+        auto reserved_after = cuuint64_t{0};
+        CheckError(cuMemPoolGetAttribute(pool, CU_MEMPOOL_ATTR_RESERVED_MEM_CURRENT, &reserved_before));
+        auto buffer = Buffer<T>(queue, pool, size);
+        CheckError(cuMemPoolGetAttribute(pool, CU_MEMPOOL_ATTR_RESERVED_MEM_CURRENT, &reserved_after));
+        if (reserved_after > reserved_before) { CountBufferAllocation(size * sizeof(T)); }
+        else { CountBufferReuse(); }
+        return buffer;
+      }
+    #endif
+    CountBufferAllocation(size * sizeof(T));
+    return Buffer<T>(context, size);
+  #endif
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_MEMORY_POOL_H_
+#endif
@@ -0,0 +1,308 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the online tuner (see the header for more information).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <set>
+#include <tuple>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+#include "online_tuning.hpp"
+#include "cache.hpp"
+#include "memory_pool.hpp"
+#include "tuning/tuning.hpp"
+#include "tuning/kernels/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+  // Tuning starts once no routine has been called for this long, and the thread re-checks at least
+  // this often. A tuning run itself is not interrupted by new routine calls.
+  const auto kIdleTime = std::chrono::seconds(2);
+
+  // Header of each results file, bump the version whenever the file format changes
+  const std::string kOnlineTuningHeader = "CLBlast online tuning v1";
+
+  std::atomic<bool> online_tuning_enabled{false};
+  std::atomic<int64_t> last_activity_ms{0};
+
+  int64_t NowMs() {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+  }
+
+  // Problems are tuned per bucket of sizes, the bucket is denoted by its maximum size
+  size_t SizeBucket(const size_t size) {
+    auto bucket = size_t{1};
+    while (bucket < size) { bucket *= 2; }
+    return bucket;
+  }
+
+  // A recorded GEMM call
+  struct Shape {
+    RawDeviceID device;
+    Precision precision;
+    size_t bucket;
+    size_t m;
+    size_t n;
+    size_t k;
+  };
+
+  // Tunes both versions of the 'Xgemm' kernel (GEMMK=0 and GEMMK=1) on their own context and queue
+  // with the sampling fractions of the tuner binaries, and keeps the fastest of the two
+  template <typename T>
+  StatusCode TuneShape(const Shape &shape, const std::atomic<bool> &cancelled,
+                       std::unordered_map<std::string,size_t> &parameters) {
+    const auto device = Device(shape.device);
+    const auto context = Context(device);
+    auto queue = Queue(context, device);
+    auto args = Arguments<T>();
+    args.m = shape.m; args.n = shape.n; args.k = shape.k;
+    args.precision = PrecisionValue<T>();
+    auto best_time_ms = 0.0;
+    auto status = StatusCode::kUnexpectedError;
+    for (const auto V : {2, 12}) {
+      args.fraction = 1.0 / XgemmGetTunerSettings<T>(V, args).default_fraction;
+      auto version_parameters = std::unordered_map<std::string,size_t>();
+      auto time_ms = 0.0;
+      const auto version_status = TunerAPI<T>(queue, args, V, XgemmGetTunerDefaults,
+                                              XgemmGetTunerSettings<T>, XgemmTestValidArguments<T>,
+                                              XgemmSetConstraints, XgemmComputeLocalMemSize<T>,
+                                              XgemmSetArguments<T>, version_parameters, &time_ms,
+                                              &cancelled);
+      if (cancelled) { return StatusCode::kUnexpectedError; }
+      if (version_status != StatusCode::kSuccess) { continue; }
+      if (status != StatusCode::kSuccess || time_ms < best_time_ms) {
+        parameters = version_parameters;
+        best_time_ms = time_ms;
+        status = StatusCode::kSuccess;
+      }
+    }
+    return status;
+  }
+
+  // See the comment at the top of the header
+  class OnlineTuner {
+   public:
+    static OnlineTuner &Instance() {
+      static OnlineTuner instance;
+      return instance;
+    }
+
+    // The directory is initialized from the environmental variable (if set)
+    static bool InitFromEnvironment() {
+      const auto environment_variable = std::getenv("CLBLAST_ONLINE_TUNING_DIR");
+      if (environment_variable == nullptr || std::string{environment_variable}.empty()) {
+        return false;
+      }
+      Instance().SetDirectory(std::string{environment_variable});
+      return true;
+    }
+
+    void SetDirectory(const std::string &directory) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (directory != directory_) {
+        pending_.clear();
+        known_.clear();
+        loaded_devices_.clear();
+        cancelled_ = true;
+      }
+      directory_ = directory;
+      online_tuning_enabled = !directory_.empty();
+      condition_.notify_all();
+    }
+
+    void Record(const Device &device, const Precision precision, const size_t size,
+                const size_t m, const size_t n, const size_t k) {
+      const auto bucket = SizeBucket(size);
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (directory_.empty()) { return; }
+      if (loaded_devices_.find(device()) == loaded_devices_.end()) {
+        loaded_devices_.insert(device());
+        Load(device);
+      }
+      const auto key = std::make_tuple(device(), precision, bucket);
+      if (known_.find(key) != known_.end()) { return; }
+      known_.insert(key);
+      pending_.push_back(Shape{device(), precision, bucket, m, n, k});
+      if (!worker_.joinable()) { worker_ = std::thread([this]() { Run(); }); }
+      condition_.notify_all();
+    }
+
+    ~OnlineTuner() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        cancelled_ = true;
+      }
+      condition_.notify_all();
+      if (worker_.joinable()) { worker_.join(); }
+    }
+
+   private:
+    // The caches are created first, such that they are destroyed only after the tuning thread
+    OnlineTuner(): stop_(false), cancelled_(false) {
+      BinaryCache::Instance(); ProgramCache::Instance(); KernelCache::Instance();
+      DatabaseCache::Instance(); BinaryDiskCache::Instance(); MemoryPool::Instance();
+    }
+
+    // The results are stored per device and driver version, see also 'BinaryDiskCache'
+    static std::string GetKey(const Device &device) {
+      const auto platform = Platform(device.PlatformID());
+      return platform.Name() + ";" + GetDeviceName(device) + ";" + device.DriverVersion();
+    }
+    std::string GetFileName(const std::string &key) const {
+      std::ostringstream file_name;
+      file_name << directory_ << "/" << std::hex << std::setw(16) << std::setfill('0') << Hash(key)
+                << ".clbtune";
+      return file_name.str();
+    }
+
+    // Reads the earlier results of this device (if any) and installs them as overrides. Each line
+    // holds the kernel name, the precision, the bucket, the tuned shape, and the parameters.
+    void Load(const Device &device) {
+      const auto key = GetKey(device);
+      std::ifstream file(GetFileName(key));
+      auto line = std::string{};
+      if (!std::getline(file, line) || line != kOnlineTuningHeader) { return; }
+      if (!std::getline(file, line) || line != key) { return; }
+      while (std::getline(file, line)) {
+        std::istringstream entry(line);
+        auto kernel_name = std::string{};
+        auto precision = 0;
+        auto bucket = size_t{0}, m = size_t{0}, n = size_t{0}, k = size_t{0};
+        if (!(entry >> kernel_name >> precision >> bucket >> m >> n >> k)) { continue; }
+        auto parameters = std::unordered_map<std::string,size_t>();
+        auto parameter = std::string{};
+        while (entry >> parameter) {
+          const auto separator = parameter.find('=');
+          if (separator == std::string::npos) { continue; }
+          const auto value = parameter.substr(separator + 1);
+          parameters[parameter.substr(0, separator)] = ConvertArgument(value.c_str(), size_t{0});
+        }
+        const auto status = OverrideParametersForSize(device(), kernel_name,
+                                                      static_cast<Precision>(precision), bucket,
+                                                      parameters);
+        if (status == StatusCode::kSuccess) {
+          known_.insert(std::make_tuple(device(), static_cast<Precision>(precision), bucket));
+        }
+      }
+    }
+
+    // Appends a result to the file of the device, which is created first if needed
+    void Store(const Shape &shape, const std::unordered_map<std::string,size_t> &parameters) {
+      const auto device = Device(shape.device);
+      const auto key = GetKey(device);
+      const auto file_name = GetFileName(key);
+      const auto exists = std::ifstream(file_name).good();
+      auto file = fopen(file_name.c_str(), "a");
+      if (file == nullptr) { return; }
+      if (!exists) { fprintf(file, "%s\n%s\n", kOnlineTuningHeader.c_str(), key.c_str()); }
+      fprintf(file, "Xgemm %d %zu %zu %zu %zu", static_cast<int>(shape.precision), shape.bucket,
+              shape.m, shape.n, shape.k);
+      for (const auto &parameter : parameters) {
+        fprintf(file, " %s=%zu", parameter.first.c_str(), parameter.second);
+      }
+      fprintf(file, "\n");
+      fclose(file);
+    }
+
+    // Tunes the recorded shapes one by one whenever the routines have been idle long enough
+    void Run() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (!stop_) {
+        condition_.wait_for(lock, kIdleTime);
+        if (stop_) { break; }
+        const auto idle_ms = NowMs() - last_activity_ms.load(std::memory_order_relaxed);
+        if (pending_.empty() || idle_ms < std::chrono::milliseconds(kIdleTime).count()) {
+          continue;
+        }
+        const auto shape = pending_.front();
+        pending_.pop_front();
+        cancelled_ = false;
+        lock.unlock();
+        auto parameters = std::unordered_map<std::string,size_t>();
+        auto status = StatusCode::kUnexpectedError;
+        try {
+          switch (shape.precision) {
+            case Precision::kHalf:
+              status = TuneShape<half>(shape, cancelled_, parameters); break;
+            case Precision::kSingle:
+              status = TuneShape<float>(shape, cancelled_, parameters); break;
+            case Precision::kDouble:
+              status = TuneShape<double>(shape, cancelled_, parameters); break;
+            case Precision::kComplexSingle:
+              status = TuneShape<float2>(shape, cancelled_, parameters); break;
+            case Precision::kComplexDouble:
+              status = TuneShape<double2>(shape, cancelled_, parameters); break;
+            default: break;
+          }
+          if (status == StatusCode::kSuccess && !cancelled_) {
+            status = OverrideParametersForSize(shape.device, "Xgemm", shape.precision,
+                                               shape.bucket, parameters);
+          }
+        } catch (...) { status = StatusCode::kUnexpectedError; }
+        lock.lock();
+        if (status == StatusCode::kSuccess && !cancelled_) { Store(shape, parameters); }
+      }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::string directory_;
+    std::deque<Shape> pending_;
+    std::set<std::tuple<RawDeviceID, Precision, size_t>> known_; // tuned, pending, or loaded
+    std::set<RawDeviceID> loaded_devices_;
+    std::thread worker_;
+    bool stop_;
+    std::atomic<bool> cancelled_; // set when disabled or at exit, to stop a tuning run early
+  };
+} // anonymous namespace
+
+// =================================================================================================
+
+void SetOnlineTuning(const std::string &directory) {
+  IsOnlineTuningEnabled(); // first applies the environmental variable, which is overridden here
+  OnlineTuner::Instance().SetDirectory(directory);
+}
+
+bool IsOnlineTuningEnabled() {
+  static const auto from_environment = OnlineTuner::InitFromEnvironment();
+  static_cast<void>(from_environment);
+  return online_tuning_enabled.load(std::memory_order_relaxed);
+}
+
+void NotifyOnlineTuningActivity() {
+  last_activity_ms.store(NowMs(), std::memory_order_relaxed);
+}
+
+void RecordOnlineTuningShape(const Device &device, const Precision precision, const size_t size,
+                             const size_t m, const size_t n, const size_t k) {
+  OnlineTuner::Instance().Record(device, precision, size, m, n, k);
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,49 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the optional online tuner (see 'SetOnlineTuningDirectory'). GEMM calls which
+// use the indirect kernel record their shape per device and precision, bucketed by problem size
+// (the next power of two of the geometric mean of m, n, and k). A background thread tunes the
+// 'Xgemm' kernel for each new bucket through the regular tuner API, but only once no routine has
+// been called for a while. The best parameters are installed as a size-specific override and
+// appended to a file per device and driver version, which is read back before the first call on
+// that device in a later process. This is only available for OpenCL.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ONLINE_TUNING_H_
+#define CLBLAST_ONLINE_TUNING_H_
+
+#include <string>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Sets the directory with the tuning results and enables online tuning, or disables it in case of
+// an empty string
+void SetOnlineTuning(const std::string &directory);
+
+// Whether or not online tuning is enabled, cheap enough to be called for every routine call
+bool IsOnlineTuningEnabled();
+
+// Marks the host as busy, which postpones the tuning until the routines have been idle for a while
+void NotifyOnlineTuningActivity();
+
+// Records the shape of a GEMM call and its problem size (see 'Xgemm::GetProblemSize'), such that
+// its size bucket is tuned if not done before
+void RecordOnlineTuningShape(const Device &device, const Precision precision, const size_t size,
+                             const size_t m, const size_t n, const size_t k);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ONLINE_TUNING_H_
+#endif
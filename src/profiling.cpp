@@ -0,0 +1,317 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the runtime profiling hooks (see the header for more information).
+//
+// =================================================================================================
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+
+#include "profiling.hpp"
+#include "tracing.hpp"
+#include "statistics.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The record of a watched call (see 'SlowCallScope'). The kernel names are only appended by the
+// host thread during the call, the device time is added by the event callbacks of the kernels. The
+// last owner reports the call in case it was slow.
+struct SlowCallRecord {
+  std::string routine_name;
+  std::string shape;
+  std::string kernels;
+  double threshold_ms;
+  SlowCallCallback callback;
+  void* user_data;
+  std::chrono::steady_clock::time_point start_time;
+  ThreadActivity start_activity;
+  ThreadActivity activity; // during the call, set at its end
+  double host_time_ms;
+  std::atomic<uint64_t> device_time{0}; // in nanoseconds
+  std::atomic<bool> has_device_time{true}; // false if any of the kernels couldn't be profiled
+
+  ~SlowCallRecord() {
+    const auto device_time_ms = (has_device_time) ? static_cast<double>(device_time) * 1.0e-6 : -1.0;
+    if (host_time_ms <= threshold_ms && device_time_ms <= threshold_ms) { return; }
+    const auto call = SlowCall{routine_name.c_str(), shape.c_str(), kernels.c_str(),
+                               host_time_ms, device_time_ms, activity.num_compilations,
+                               activity.num_binary_loads, activity.num_buffer_allocations};
+    callback(call, user_data);
+  }
+};
+
+namespace {
+
+  // The currently registered callback, read at the launch of each kernel
+  std::mutex profiling_mutex;
+  ProfilingCallback profiling_callback = nullptr;
+  void* profiling_user_data = nullptr;
+  std::atomic<bool> profiling_enabled{false};
+
+  // The slow-call log, read at the start of each watched call
+  SlowCallCallback slow_call_callback = nullptr;
+  void* slow_call_user_data = nullptr;
+  double slow_call_threshold_ms = 0.0;
+  std::atomic<bool> slow_call_enabled{false};
+
+  // The shape of the next routine call of this host thread (see 'RecordCall') and the call which is
+  // currently watched on it
+  std::string& PendingShape() {
+    static thread_local std::string shape;
+    return shape;
+  }
+  std::shared_ptr<SlowCallRecord>& CurrentSlowCall() {
+    static thread_local std::shared_ptr<SlowCallRecord> record;
+    return record;
+  }
+
+  // The name of the routine which launches the kernels of this host thread
+  std::string& CurrentRoutine() {
+    static thread_local std::string routine_name;
+    return routine_name;
+  }
+
+  // The profile of a single kernel launch, kept alive until the event callback has been called.
+  // For tracing, the device times are aligned to the host time at which the kernel was enqueued.
+  struct PendingProfile {
+    std::string routine_name;
+    std::string kernel_name;
+    KernelProfile profile;
+    ProfilingCallback callback; // nullptr in case of tracing or the slow-call log only
+    void* user_data;
+    std::shared_ptr<SlowCallRecord> slow_call; // nullptr if the call isn't watched
+    bool trace;
+    double trace_enqueue_time;
+    cl_command_queue trace_queue;
+  };
+
+  // The callback used in case profiling is enabled through the environmental variable
+  void PrintProfile(const KernelProfile &profile, void*) {
+    fprintf(stderr, "[PROFILE] %s: kernel '%s' global {%zu, %zu, %zu} local {%zu, %zu, %zu}: "
+            "%.3lf ms\n", profile.routine_name, profile.kernel_name,
+            profile.global[0], profile.global[1], profile.global[2],
+            profile.local[0], profile.local[1], profile.local[2],
+            static_cast<double>(profile.end_time - profile.start_time) * 1.0e-6);
+  }
+
+  // The callback used in case the slow-call log is enabled through the environmental variable
+  void PrintSlowCall(const SlowCall &call, void*) {
+    fprintf(stderr, "[SLOW] %s (%s): %.3lf ms host, %.3lf ms device, kernels '%s', "
+            "%zu compilation(s), %zu binary load(s), %zu buffer allocation(s)\n",
+            call.routine_name, call.shape, call.host_time_ms, call.device_time_ms, call.kernels,
+            call.num_compilations, call.num_binary_loads, call.num_buffer_allocations);
+  }
+
+  // Enables the slow-call log in case the environmental variable is set to a positive threshold
+  bool InitSlowCallLogFromEnvironment() {
+    const auto environment_variable = std::getenv("CLBLAST_SLOW_CALL_MS");
+    if (environment_variable == nullptr) { return false; }
+    const auto threshold_ms = std::strtod(environment_variable, nullptr);
+    if (threshold_ms <= 0.0) { return false; }
+    std::lock_guard<std::mutex> lock(profiling_mutex);
+    if (!slow_call_enabled) {
+      slow_call_callback = PrintSlowCall;
+      slow_call_user_data = nullptr;
+      slow_call_threshold_ms = threshold_ms;
+      slow_call_enabled = true;
+    }
+    return true;
+  }
+
+  // Enables printing the profiles in case the environmental variable is set
+  bool InitProfilingFromEnvironment() {
+    const auto environment_variable = std::getenv("CLBLAST_PROFILING");
+    if (environment_variable == nullptr || std::string{environment_variable} == "0") {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(profiling_mutex);
+    if (profiling_callback == nullptr) {
+      profiling_callback = PrintProfile;
+      profiling_enabled = true;
+    }
+    return true;
+  }
+
+  // Called by the OpenCL runtime when the kernel has completed (or failed)
+  void CL_CALLBACK OnKernelComplete(cl_event event, cl_int status, void* user_data) {
+    auto pending = static_cast<PendingProfile*>(user_data);
+    if (status == CL_COMPLETE) {
+      auto queued_time = cl_ulong{0};
+      auto start_time = cl_ulong{0};
+      auto end_time = cl_ulong{0};
+      const auto bytes = sizeof(cl_ulong);
+      const auto status_queued = clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_QUEUED, bytes,
+                                                         &queued_time, nullptr);
+      const auto status_start = clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_START, bytes,
+                                                        &start_time, nullptr);
+      const auto status_end = clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_END, bytes,
+                                                      &end_time, nullptr);
+      if (status_queued == CL_SUCCESS && status_start == CL_SUCCESS && status_end == CL_SUCCESS) {
+        pending->profile.start_time = start_time;
+        pending->profile.end_time = end_time;
+        if (pending->slow_call) { pending->slow_call->device_time += end_time - start_time; }
+        if (pending->callback) { pending->callback(pending->profile, pending->user_data); }
+        if (pending->trace) {
+          const auto start = pending->trace_enqueue_time +
+                             static_cast<double>(start_time - queued_time) * 1.0e-3;
+          const auto duration = static_cast<double>(end_time - start_time) * 1.0e-3;
+          Tracer::Instance().AddDeviceSpan(pending->kernel_name, "kernel", start, duration,
+                                           pending->trace_queue);
+        }
+      }
+      else if (pending->slow_call) { pending->slow_call->has_device_time = false; }
+    }
+    else if (pending->slow_call) { pending->slow_call->has_device_time = false; }
+    clReleaseEvent(event);
+    delete pending;
+  }
+} // anonymous namespace
+
+// =================================================================================================
+
+void SetProfiling(ProfilingCallback callback, void* user_data) {
+  IsProfilingEnabled(); // first applies the environmental variable, which is overridden here
+  std::lock_guard<std::mutex> lock(profiling_mutex);
+  profiling_callback = callback;
+  profiling_user_data = user_data;
+  profiling_enabled = (callback != nullptr);
+}
+
+// Profiling is also enabled for the device timeline of the tracer (see 'CLBLAST_TRACE') and for the
+// device times of the slow-call log
+bool IsProfilingEnabled() {
+  static const auto from_environment = InitProfilingFromEnvironment();
+  static_cast<void>(from_environment);
+  return profiling_enabled.load(std::memory_order_relaxed) || Tracer::IsEnabled() ||
+         IsSlowCallLogEnabled();
+}
+
+void SetProfilingRoutine(const std::string &routine_name) {
+  CurrentRoutine() = routine_name;
+}
+
+// Registers an event callback. The event is retained until the callback has been called.
+void ProfileKernel(const Kernel &kernel, const ThreadRange &global,
+                   const ThreadRange &local, const cl_event event) {
+  auto pending = std::unique_ptr<PendingProfile>(new PendingProfile());
+  pending->trace = Tracer::IsEnabled();
+  pending->slow_call = CurrentSlowCall();
+  {
+    std::lock_guard<std::mutex> lock(profiling_mutex);
+    if (profiling_callback == nullptr && !pending->trace && !pending->slow_call) { return; }
+    pending->callback = profiling_callback;
+    pending->user_data = profiling_user_data;
+  }
+  if (pending->trace) {
+    pending->trace_enqueue_time = Tracer::Instance().Now();
+    CheckError(clGetEventInfo(event, CL_EVENT_COMMAND_QUEUE, sizeof(cl_command_queue),
+                              &pending->trace_queue, nullptr));
+  }
+  pending->routine_name = CurrentRoutine();
+  pending->kernel_name = kernel.GetFunctionName();
+  if (pending->slow_call) {
+    auto &kernels = pending->slow_call->kernels;
+    kernels += (kernels.empty()) ? pending->kernel_name : " " + pending->kernel_name;
+  }
+  pending->profile = KernelProfile{};
+  pending->profile.routine_name = pending->routine_name.c_str();
+  pending->profile.kernel_name = pending->kernel_name.c_str();
+  pending->profile.num_dimensions = global.size();
+  for (auto i = size_t{0}; i < 3; ++i) {
+    pending->profile.global[i] = (i < global.size()) ? global[i] : 1;
+    pending->profile.local[i] = (i < local.size()) ? local[i] : (local.empty() ? 0 : 1);
+  }
+  CheckError(clRetainEvent(event));
+  const auto status = clSetEventCallback(event, CL_COMPLETE, OnKernelComplete, pending.get());
+  if (status != CL_SUCCESS) {
+    clReleaseEvent(event);
+    CheckError(status);
+  }
+  pending.release(); // now owned by the event callback
+}
+
+// =================================================================================================
+
+void SetSlowCallLog(const double threshold_ms, SlowCallCallback callback, void* user_data) {
+  IsSlowCallLogEnabled(); // first applies the environmental variable, which is overridden here
+  std::lock_guard<std::mutex> lock(profiling_mutex);
+  slow_call_callback = (callback != nullptr) ? callback : PrintSlowCall;
+  slow_call_user_data = (callback != nullptr) ? user_data : nullptr;
+  slow_call_threshold_ms = threshold_ms;
+  slow_call_enabled = (threshold_ms > 0.0);
+}
+
+bool IsSlowCallLogEnabled() {
+  static const auto from_environment = InitSlowCallLogFromEnvironment();
+  static_cast<void>(from_environment);
+  return slow_call_enabled.load(std::memory_order_relaxed);
+}
+
+// The shape is kept in the format of the call recorder, with the enums as integers
+void RecordCall(const char *routine, const int precision,
+                std::initializer_list<std::pair<const char*, size_t>> arguments) {
+  if (CallRecorder::IsEnabled()) { CallRecorder::Instance().Record(routine, precision, arguments); }
+  if (IsSlowCallLogEnabled()) {
+    auto &shape = PendingShape();
+    shape = "precision=" + ToString(precision);
+    for (const auto &argument : arguments) {
+      shape += std::string{" "} + argument.first + "=" + ToString(argument.second);
+    }
+  }
+}
+
+// =================================================================================================
+
+SlowCallScope::SlowCallScope(const std::string &routine_name):
+    record_() {
+  if (!IsSlowCallLogEnabled() || CurrentSlowCall()) { return; }
+  auto record = std::make_shared<SlowCallRecord>();
+  {
+    std::lock_guard<std::mutex> lock(profiling_mutex);
+    if (!slow_call_enabled) { return; }
+    record->threshold_ms = slow_call_threshold_ms;
+    record->callback = slow_call_callback;
+    record->user_data = slow_call_user_data;
+  }
+  record->routine_name = routine_name;
+  record->shape.swap(PendingShape());
+  PendingShape().clear();
+  record->start_activity = GetThreadActivity();
+  record->activity = ThreadActivity{0, 0, 0};
+  record->host_time_ms = 0.0;
+  record->start_time = std::chrono::steady_clock::now();
+  CurrentSlowCall() = record;
+  record_ = std::move(record);
+}
+
+// Reports the call right away unless some of its kernels haven't completed yet
+void SlowCallScope::End() {
+  if (!record_) { return; }
+  const auto elapsed_time = std::chrono::steady_clock::now() - record_->start_time;
+  record_->host_time_ms = std::chrono::duration<double,std::milli>(elapsed_time).count();
+  const auto &activity = GetThreadActivity();
+  record_->activity.num_compilations = activity.num_compilations -
+                                       record_->start_activity.num_compilations;
+  record_->activity.num_binary_loads = activity.num_binary_loads -
+                                       record_->start_activity.num_binary_loads;
+  record_->activity.num_buffer_allocations = activity.num_buffer_allocations -
+                                             record_->start_activity.num_buffer_allocations;
+  if (CurrentSlowCall() == record_) { CurrentSlowCall().reset(); }
+  record_.reset();
+}
+
+// =================================================================================================
+} // namespace clblast
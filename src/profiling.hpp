@@ -0,0 +1,89 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the runtime profiling hooks (see 'SetProfilingCallback'). The timing of each
+// kernel is read from its event in an OpenCL event callback once the kernel has completed, such
+// that profiling does not synchronise the queue. Profiling can also be enabled by setting the
+// environmental variable CLBLAST_PROFILING, which prints a line per kernel to stderr.
+//
+// This file also implements the slow-call log (see 'SetSlowCallThreshold'). The outermost routine
+// call on a host thread is watched by a 'SlowCallScope', which shares a record with the event
+// callbacks of its kernels. Once the call has returned and all its kernels have completed, the last
+// owner of the record compares the host and device times with the threshold. This is only
+// available for OpenCL.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_PROFILING_H_
+#define CLBLAST_PROFILING_H_
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <initializer_list>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Sets or (in case of a nullptr) removes the user's profiling callback
+void SetProfiling(ProfilingCallback callback, void* user_data);
+
+// Whether or not profiling is enabled, cheap enough to be called for every kernel launch
+bool IsProfilingEnabled();
+
+// Sets the name of the routine which launches the next kernels from this host thread
+void SetProfilingRoutine(const std::string &routine_name);
+
+// Reports the timing of the kernel launched with the given event to the callback after completion
+void ProfileKernel(const Kernel &kernel, const ThreadRange &global,
+                   const ThreadRange &local, const cl_event event);
+
+// =================================================================================================
+
+// Sets or (with a zero threshold) disables the slow-call log
+void SetSlowCallLog(const double threshold_ms, SlowCallCallback callback, void* user_data);
+
+// Records the shape of a call of the API for the call recorder (see 'CallRecorder') and, in case
+// the slow-call log is enabled, for the next routine call of this host thread
+void RecordCall(const char *routine, const int precision,
+                std::initializer_list<std::pair<const char*, size_t>> arguments);
+
+// Whether or not the slow-call log is enabled, cheap enough to be called for every routine call
+bool IsSlowCallLogEnabled();
+
+// The record of a watched call, see the source file
+struct SlowCallRecord;
+
+// Watches a routine call from construction until destruction, unless the slow-call log is disabled
+// or the call is nested within another watched call on this host thread (e.g. GEMM within TRSM)
+class SlowCallScope {
+ public:
+  explicit SlowCallScope(const std::string &routine_name);
+  ~SlowCallScope() { End(); }
+
+  // Ends the call before destruction, e.g. for objects which outlive the call such as GEMM plans
+  void End();
+
+  // Only one object watches the call: a copy is inactive, a move transfers the call
+  SlowCallScope(const SlowCallScope&): record_() { }
+  SlowCallScope(SlowCallScope &&other): record_(std::move(other.record_)) { }
+  SlowCallScope& operator=(const SlowCallScope&) = delete;
+
+ private:
+  std::shared_ptr<SlowCallRecord> record_; // nullptr if inactive
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_PROFILING_H_
+#endif
@@ -17,6 +17,8 @@ from pyopencl.array import Array
 from libcpp cimport bool
 from cpython.mem cimport PyMem_Malloc, PyMem_Free
 from libc.string cimport strdup
+from libc.stdint cimport int32_t, int64_t, uint8_t, uint16_t, uint64_t
+from cpython.pycapsule cimport PyCapsule_IsValid, PyCapsule_GetPointer, PyCapsule_SetName
 
 ####################################################################################################
 # CLBlast and OpenCL data-types
@@ -274,54 +276,349 @@ def check_dtype(args, dtypes):
 
 
 def check_array(a, ndim, name):
-    if not isinstance(a, Array):
-        raise ValueError("PyCLBlast: '%s' must be a PyOpenCL Array" % name)
+    if not isinstance(a, (Array, DLPackArray)):
+        if not (hasattr(a, "__dlpack__") or PyCapsule_IsValid(a, "dltensor")):
+            raise ValueError("PyCLBlast: '%s' must be a PyOpenCL Array or an OpenCL DLPack tensor" % name)
+        a = from_dlpack(a)
     if not len(a.shape) == ndim:
         raise ValueError("PyCLBlast: '%s' must have %d dimensions (got %d)" % (name, ndim, len(a.shape)))
+    return a
 
 
 def check_matrix(a, name):
-    check_array(a, 2, name)
+    return check_array(a, 2, name)
 
 
 def check_vector(a, name):
-    check_array(a, 1, name)
+    return check_array(a, 1, name)
 
 
+def element_offset(a):
+    return a.element_offset if isinstance(a, DLPackArray) else 0
+
+
+def check_batch(values, batch_count, name):
+    if len(values) != batch_count:
+        raise ValueError("PyCLBlast: '%s' must have %d entries, one per batch (got %d)" % (name, batch_count, len(values)))
+
+####################################################################################################
+# DLPack interoperability
+####################################################################################################
+
+# The DLPack data-types (see https://github.com/dmlc/dlpack), of which only OpenCL memory is supported
+cdef struct DLDevice:
+    int device_type
+    int32_t device_id
+
+cdef struct DLDataType:
+    uint8_t code
+    uint8_t bits
+    uint16_t lanes
+
+cdef struct DLTensor:
+    void* data
+    DLDevice device
+    int32_t ndim
+    DLDataType dtype
+    int64_t* shape
+    int64_t* strides
+    uint64_t byte_offset
+
+cdef struct DLManagedTensor:
+    DLTensor dl_tensor
+    void* manager_ctx
+    void (*deleter)(DLManagedTensor*)
+
+cdef int kDLOpenCL = 4
+dlpack_dtypes = {(2, 32): np.dtype('float32'),
+                 (2, 64): np.dtype('float64'),
+                 (5, 64): np.dtype('complex64'),
+                 (5, 128): np.dtype('complex128')}
+
+
+class DLPackBuffer(object):
+    def __init__(self, int_ptr):
+        self.int_ptr = int_ptr
+
+
+cdef class DLPackArray:
+    """
+    OpenCL memory of another framework, wrapped from a DLPack capsule without copying. It can be
+    passed to all routines instead of a PyOpenCL Array, the byte offset of the tensor is added to
+    the offset given to the routine. The memory is owned by the DLPack tensor, which is released
+    when this object is.
+    """
+    cdef DLManagedTensor* managed
+    cdef readonly object dtype
+    cdef readonly tuple shape
+    cdef readonly object base_data
+    cdef readonly size_t element_offset
+
+    def __dealloc__(self):
+        if self.managed != NULL and self.managed.deleter != NULL:
+            self.managed.deleter(self.managed)
+
+
+def from_dlpack(tensor):
+    """
+    Wraps OpenCL memory of another framework without copying, from either an object with the
+    '__dlpack__' protocol or a DLPack capsule. A capsule can be consumed only once, so wrap it once
+    to pass it to multiple routines. The tensor has to be in the context of the queue.
+    """
+    if isinstance(tensor, DLPackArray):
+        return tensor
+    if hasattr(tensor, "__dlpack_device__") and tensor.__dlpack_device__()[0] != kDLOpenCL:
+        raise ValueError("PyCLBlast: DLPack tensors must be in OpenCL memory")
+    capsule = tensor.__dlpack__() if hasattr(tensor, "__dlpack__") else tensor
+    if not PyCapsule_IsValid(capsule, "dltensor"):
+        raise ValueError("PyCLBlast: Expected an unused DLPack capsule")
+    cdef DLPackArray array = DLPackArray.__new__(DLPackArray)
+    array.managed = <DLManagedTensor*>PyCapsule_GetPointer(capsule, "dltensor")
+    PyCapsule_SetName(capsule, "used_dltensor")  # the array is now responsible for the deleter
+
+    cdef DLTensor* dl_tensor = &array.managed.dl_tensor
+    if dl_tensor.device.device_type != kDLOpenCL:
+        raise ValueError("PyCLBlast: DLPack tensors must be in OpenCL memory")
+    dtype = dlpack_dtypes.get((dl_tensor.dtype.code, dl_tensor.dtype.bits))
+    if dtype is None or dl_tensor.dtype.lanes != 1:
+        raise ValueError("PyCLBlast: Unsupported DLPack data type")
+    if dl_tensor.byte_offset % dtype_size[dtype] != 0:
+        raise ValueError("PyCLBlast: The byte offset of a DLPack tensor must be a multiple of its data type")
+    array.dtype = dtype
+    array.shape = tuple([dl_tensor.shape[i] for i in range(dl_tensor.ndim)])
+    array.base_data = DLPackBuffer(<size_t>dl_tensor.data)
+    array.element_offset = dl_tensor.byte_offset // dtype_size[dtype]
+    return array
+
+
+####################################################################################################
+# Generate givens plane rotation: SROTG/DROTG
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSrotg(cl_mem sa_buffer, const size_t sa_offset, cl_mem sb_buffer, const size_t sb_offset, cl_mem sc_buffer, const size_t sc_offset, cl_mem ss_buffer, const size_t ss_offset,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDrotg(cl_mem sa_buffer, const size_t sa_offset, cl_mem sb_buffer, const size_t sb_offset, cl_mem sc_buffer, const size_t sc_offset, cl_mem ss_buffer, const size_t ss_offset,cl_command_queue* queue, cl_event* event)
+
+def rotg(queue, sa, sb, sc, ss, size_t sa_offset = 0, size_t sb_offset = 0, size_t sc_offset = 0, size_t ss_offset = 0, wait_for = None):
+    """
+    xROTG: Generate givens plane rotation
+    """
+
+    sa = check_matrix(sa, "sa")
+    sb = check_matrix(sb, "sb")
+    sc = check_matrix(sc, "sc")
+    ss = check_matrix(ss, "ss")
+    dtype = check_dtype([sa, sb, sc, ss], ["float32", "float64"])
+
+    cdef cl_mem sa_buffer = <cl_mem><size_t>sa.base_data.int_ptr
+    cdef cl_mem sb_buffer = <cl_mem><size_t>sb.base_data.int_ptr
+    cdef cl_mem sc_buffer = <cl_mem><size_t>sc.base_data.int_ptr
+    cdef cl_mem ss_buffer = <cl_mem><size_t>ss.base_data.int_ptr
+    cdef size_t sa_element_offset = element_offset(sa)
+    cdef size_t sb_element_offset = element_offset(sb)
+    cdef size_t sc_element_offset = element_offset(sc)
+    cdef size_t ss_element_offset = element_offset(ss)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        with nogil:
+            err = CLBlastSrotg(sa_buffer, sa_offset + sa_element_offset, sb_buffer, sb_offset + sb_element_offset, sc_buffer, sc_offset + sc_element_offset, ss_buffer, ss_offset + ss_element_offset, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        with nogil:
+            err = CLBlastDrotg(sa_buffer, sa_offset + sa_element_offset, sb_buffer, sb_offset + sb_element_offset, sc_buffer, sc_offset + sc_element_offset, ss_buffer, ss_offset + ss_element_offset, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXrotg' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Generate modified givens plane rotation: SROTMG/DROTMG
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSrotmg(cl_mem sd1_buffer, const size_t sd1_offset, cl_mem sd2_buffer, const size_t sd2_offset, cl_mem sx1_buffer, const size_t sx1_offset, const cl_mem sy1_buffer, const size_t sy1_offset, cl_mem sparam_buffer, const size_t sparam_offset,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDrotmg(cl_mem sd1_buffer, const size_t sd1_offset, cl_mem sd2_buffer, const size_t sd2_offset, cl_mem sx1_buffer, const size_t sx1_offset, const cl_mem sy1_buffer, const size_t sy1_offset, cl_mem sparam_buffer, const size_t sparam_offset,cl_command_queue* queue, cl_event* event)
+
+def rotmg(queue, sy1, sd1, sd2, sx1, sparam, size_t sy1_offset = 0, size_t sd1_offset = 0, size_t sd2_offset = 0, size_t sx1_offset = 0, size_t sparam_offset = 0, wait_for = None):
+    """
+    xROTMG: Generate modified givens plane rotation
+    """
+
+    sy1 = check_matrix(sy1, "sy1")
+    sd1 = check_matrix(sd1, "sd1")
+    sd2 = check_matrix(sd2, "sd2")
+    sx1 = check_matrix(sx1, "sx1")
+    sparam = check_matrix(sparam, "sparam")
+    dtype = check_dtype([sy1, sd1, sd2, sx1, sparam], ["float32", "float64"])
+
+    cdef cl_mem sy1_buffer = <cl_mem><size_t>sy1.base_data.int_ptr
+    cdef cl_mem sd1_buffer = <cl_mem><size_t>sd1.base_data.int_ptr
+    cdef cl_mem sd2_buffer = <cl_mem><size_t>sd2.base_data.int_ptr
+    cdef cl_mem sx1_buffer = <cl_mem><size_t>sx1.base_data.int_ptr
+    cdef cl_mem sparam_buffer = <cl_mem><size_t>sparam.base_data.int_ptr
+    cdef size_t sy1_element_offset = element_offset(sy1)
+    cdef size_t sd1_element_offset = element_offset(sd1)
+    cdef size_t sd2_element_offset = element_offset(sd2)
+    cdef size_t sx1_element_offset = element_offset(sx1)
+    cdef size_t sparam_element_offset = element_offset(sparam)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        with nogil:
+            err = CLBlastSrotmg(sd1_buffer, sd1_offset + sd1_element_offset, sd2_buffer, sd2_offset + sd2_element_offset, sx1_buffer, sx1_offset + sx1_element_offset, sy1_buffer, sy1_offset + sy1_element_offset, sparam_buffer, sparam_offset + sparam_element_offset, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        with nogil:
+            err = CLBlastDrotmg(sd1_buffer, sd1_offset + sd1_element_offset, sd2_buffer, sd2_offset + sd2_element_offset, sx1_buffer, sx1_offset + sx1_element_offset, sy1_buffer, sy1_offset + sy1_element_offset, sparam_buffer, sparam_offset + sparam_element_offset, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXrotmg' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Apply givens plane rotation: SROT/DROT
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSrot(const size_t n, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const float cos, const float sin,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDrot(const size_t n, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const double cos, const double sin,cl_command_queue* queue, cl_event* event)
+
+def rot(queue, size_t n, x, y, size_t x_inc = 1, size_t y_inc = 1, cos = 0.0, sin = 0.0, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
+    """
+    xROT: Apply givens plane rotation
+    """
+
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    dtype = check_dtype([x, y], ["float32", "float64"])
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef cl_float cos_s
+    cdef cl_float sin_s
+    cdef cl_double cos_d
+    cdef cl_double sin_d
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        cos_s = cos
+        sin_s = sin
+        with nogil:
+            err = CLBlastSrot(n, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, cos_s, sin_s, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        cos_d = cos
+        sin_d = sin
+        with nogil:
+            err = CLBlastDrot(n, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, cos_d, sin_d, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXrot' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Apply modified givens plane rotation: SROTM/DROTM
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSrotm(const size_t n, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem sparam_buffer, const size_t sparam_offset,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDrotm(const size_t n, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem sparam_buffer, const size_t sparam_offset,cl_command_queue* queue, cl_event* event)
+
+def rotm(queue, size_t n, x, y, sparam, size_t x_inc = 1, size_t y_inc = 1, size_t x_offset = 0, size_t y_offset = 0, size_t sparam_offset = 0, wait_for = None):
+    """
+    xROTM: Apply modified givens plane rotation
+    """
+
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    sparam = check_matrix(sparam, "sparam")
+    dtype = check_dtype([x, y, sparam], ["float32", "float64"])
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef cl_mem sparam_buffer = <cl_mem><size_t>sparam.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+    cdef size_t sparam_element_offset = element_offset(sparam)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        with nogil:
+            err = CLBlastSrotm(n, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, sparam_buffer, sparam_offset + sparam_element_offset, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        with nogil:
+            err = CLBlastDrotm(n, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, sparam_buffer, sparam_offset + sparam_element_offset, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXrotm' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
 ####################################################################################################
 # Swap two vectors: SSWAP/DSWAP/CSWAP/ZSWAP/HSWAP
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSswap(const size_t n, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDswap(const size_t n, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCswap(const size_t n, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZswap(const size_t n, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
 
-def swap(queue, n, x, y, x_inc = 1, y_inc = 1, x_offset = 0, y_offset = 0):
+def swap(queue, size_t n, x, y, size_t x_inc = 1, size_t y_inc = 1, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
     """
     xSWAP: Swap two vectors
     """
 
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
     dtype = check_dtype([x, y], ["float32", "float64", "complex64", "complex128"])
-    check_vector(x, "x")
-    check_vector(y, "y")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSswap(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastSswap(n, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDswap(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastDswap(n, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCswap(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastCswap(n, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZswap(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastZswap(n, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -332,34 +629,49 @@ def swap(queue, n, x, y, x_inc = 1, y_inc = 1, x_offset = 0, y_offset = 0):
 # Vector scaling: SSCAL/DSCAL/CSCAL/ZSCAL/HSCAL
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSscal(const size_t n, const float alpha, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDscal(const size_t n, const double alpha, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCscal(const size_t n, const cl_float2 alpha, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZscal(const size_t n, const cl_double2 alpha, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
 
-def scal(queue, n, x, x_inc = 1, alpha = 1.0, x_offset = 0):
+def scal(queue, size_t n, x, size_t x_inc = 1, alpha = 1.0, size_t x_offset = 0, wait_for = None):
     """
     xSCAL: Vector scaling
     """
 
+    x = check_vector(x, "x")
     dtype = check_dtype([x], ["float32", "float64", "complex64", "complex128"])
-    check_vector(x, "x")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
+    cdef cl_float2 alpha_c
+    cdef cl_double2 alpha_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSscal(n, <cl_float>alpha, x_buffer, x_offset, x_inc, &command_queue, &event)
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastSscal(n, alpha_s, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDscal(n, <cl_double>alpha, x_buffer, x_offset, x_inc, &command_queue, &event)
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDscal(n, alpha_d, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCscal(n, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), x_buffer, x_offset, x_inc, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastCscal(n, alpha_c, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZscal(n, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), x_buffer, x_offset, x_inc, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastZscal(n, alpha_z, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -370,36 +682,44 @@ def scal(queue, n, x, x_inc = 1, alpha = 1.0, x_offset = 0):
 # Vector copy: SCOPY/DCOPY/CCOPY/ZCOPY/HCOPY
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastScopy(const size_t n, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDcopy(const size_t n, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCcopy(const size_t n, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZcopy(const size_t n, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
 
-def copy(queue, n, x, y, x_inc = 1, y_inc = 1, x_offset = 0, y_offset = 0):
+def copy(queue, size_t n, x, y, size_t x_inc = 1, size_t y_inc = 1, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
     """
     xCOPY: Vector copy
     """
 
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
     dtype = check_dtype([x, y], ["float32", "float64", "complex64", "complex128"])
-    check_vector(x, "x")
-    check_vector(y, "y")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastScopy(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastScopy(n, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDcopy(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastDcopy(n, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCcopy(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastCcopy(n, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZcopy(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastZcopy(n, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -410,36 +730,52 @@ def copy(queue, n, x, y, x_inc = 1, y_inc = 1, x_offset = 0, y_offset = 0):
 # Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSaxpy(const size_t n, const float alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDaxpy(const size_t n, const double alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCaxpy(const size_t n, const cl_float2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZaxpy(const size_t n, const cl_double2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
 
-def axpy(queue, n, x, y, x_inc = 1, y_inc = 1, alpha = 1.0, x_offset = 0, y_offset = 0):
+def axpy(queue, size_t n, x, y, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
     """
     xAXPY: Vector-times-constant plus vector
     """
 
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
     dtype = check_dtype([x, y], ["float32", "float64", "complex64", "complex128"])
-    check_vector(x, "x")
-    check_vector(y, "y")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
+    cdef cl_float2 alpha_c
+    cdef cl_double2 alpha_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSaxpy(n, <cl_float>alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastSaxpy(n, alpha_s, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDaxpy(n, <cl_double>alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDaxpy(n, alpha_d, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCaxpy(n, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastCaxpy(n, alpha_c, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZaxpy(n, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastZaxpy(n, alpha_z, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -450,32 +786,39 @@ def axpy(queue, n, x, y, x_inc = 1, y_inc = 1, alpha = 1.0, x_offset = 0, y_offs
 # Dot product of two vectors: SDOT/DDOT/HDOT
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSdot(const size_t n, cl_mem dot_buffer, const size_t dot_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDdot(const size_t n, cl_mem dot_buffer, const size_t dot_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
 
-def dot(queue, n, x, y, dot, x_inc = 1, y_inc = 1, x_offset = 0, y_offset = 0, dot_offset = 0):
+def dot(queue, size_t n, x, y, dot, size_t x_inc = 1, size_t y_inc = 1, size_t x_offset = 0, size_t y_offset = 0, size_t dot_offset = 0, wait_for = None):
     """
     xDOT: Dot product of two vectors
     """
 
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    dot = check_matrix(dot, "dot")
     dtype = check_dtype([x, y, dot], ["float32", "float64"])
-    check_vector(x, "x")
-    check_vector(y, "y")
-    check_matrix(dot, "dot")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
     cdef cl_mem dot_buffer = <cl_mem><size_t>dot.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+    cdef size_t dot_element_offset = element_offset(dot)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSdot(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastSdot(n, dot_buffer, dot_offset + dot_element_offset, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDdot(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastDdot(n, dot_buffer, dot_offset + dot_element_offset, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -486,32 +829,39 @@ def dot(queue, n, x, y, dot, x_inc = 1, y_inc = 1, x_offset = 0, y_offset = 0, d
 # Dot product of two complex vectors: CDOTU/ZDOTU
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastCdotu(const size_t n, cl_mem dot_buffer, const size_t dot_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZdotu(const size_t n, cl_mem dot_buffer, const size_t dot_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
 
-def dotu(queue, n, x, y, dot, x_inc = 1, y_inc = 1, x_offset = 0, y_offset = 0, dot_offset = 0):
+def dotu(queue, size_t n, x, y, dot, size_t x_inc = 1, size_t y_inc = 1, size_t x_offset = 0, size_t y_offset = 0, size_t dot_offset = 0, wait_for = None):
     """
     xDOTU: Dot product of two complex vectors
     """
 
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    dot = check_matrix(dot, "dot")
     dtype = check_dtype([x, y, dot], ["complex64", "complex128"])
-    check_vector(x, "x")
-    check_vector(y, "y")
-    check_matrix(dot, "dot")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
     cdef cl_mem dot_buffer = <cl_mem><size_t>dot.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+    cdef size_t dot_element_offset = element_offset(dot)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("complex64"):
-        err = CLBlastCdotu(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastCdotu(n, dot_buffer, dot_offset + dot_element_offset, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZdotu(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastZdotu(n, dot_buffer, dot_offset + dot_element_offset, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -522,32 +872,39 @@ def dotu(queue, n, x, y, dot, x_inc = 1, y_inc = 1, x_offset = 0, y_offset = 0,
 # Dot product of two complex vectors, one conjugated: CDOTC/ZDOTC
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastCdotc(const size_t n, cl_mem dot_buffer, const size_t dot_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZdotc(const size_t n, cl_mem dot_buffer, const size_t dot_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
 
-def dotc(queue, n, x, y, dot, x_inc = 1, y_inc = 1, x_offset = 0, y_offset = 0, dot_offset = 0):
+def dotc(queue, size_t n, x, y, dot, size_t x_inc = 1, size_t y_inc = 1, size_t x_offset = 0, size_t y_offset = 0, size_t dot_offset = 0, wait_for = None):
     """
     xDOTC: Dot product of two complex vectors, one conjugated
     """
 
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    dot = check_matrix(dot, "dot")
     dtype = check_dtype([x, y, dot], ["complex64", "complex128"])
-    check_vector(x, "x")
-    check_vector(y, "y")
-    check_matrix(dot, "dot")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
     cdef cl_mem dot_buffer = <cl_mem><size_t>dot.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+    cdef size_t dot_element_offset = element_offset(dot)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("complex64"):
-        err = CLBlastCdotc(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastCdotc(n, dot_buffer, dot_offset + dot_element_offset, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZdotc(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastZdotc(n, dot_buffer, dot_offset + dot_element_offset, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -558,36 +915,44 @@ def dotc(queue, n, x, y, dot, x_inc = 1, y_inc = 1, x_offset = 0, y_offset = 0,
 # Euclidian norm of a vector: SNRM2/DNRM2/ScNRM2/DzNRM2/HNRM2
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSnrm2(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDnrm2(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastScnrm2(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDznrm2(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
 
-def nrm2(queue, n, x, nrm2, x_inc = 1, x_offset = 0, nrm2_offset = 0):
+def nrm2(queue, size_t n, x, nrm2, size_t x_inc = 1, size_t x_offset = 0, size_t nrm2_offset = 0, wait_for = None):
     """
     xNRM2: Euclidian norm of a vector
     """
 
+    x = check_vector(x, "x")
+    nrm2 = check_matrix(nrm2, "nrm2")
     dtype = check_dtype([x, nrm2], ["float32", "float64", "complex64", "complex128"])
-    check_vector(x, "x")
-    check_matrix(nrm2, "nrm2")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem nrm2_buffer = <cl_mem><size_t>nrm2.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t nrm2_element_offset = element_offset(nrm2)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSnrm2(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastSnrm2(n, nrm2_buffer, nrm2_offset + nrm2_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDnrm2(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastDnrm2(n, nrm2_buffer, nrm2_offset + nrm2_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastScnrm2(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastScnrm2(n, nrm2_buffer, nrm2_offset + nrm2_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastDznrm2(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastDznrm2(n, nrm2_buffer, nrm2_offset + nrm2_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -598,36 +963,44 @@ def nrm2(queue, n, x, nrm2, x_inc = 1, x_offset = 0, nrm2_offset = 0):
 # Absolute sum of values in a vector: SASUM/DASUM/ScASUM/DzASUM/HASUM
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSasum(const size_t n, cl_mem asum_buffer, const size_t asum_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDasum(const size_t n, cl_mem asum_buffer, const size_t asum_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastScasum(const size_t n, cl_mem asum_buffer, const size_t asum_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDzasum(const size_t n, cl_mem asum_buffer, const size_t asum_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
 
-def asum(queue, n, x, asum, x_inc = 1, x_offset = 0, asum_offset = 0):
+def asum(queue, size_t n, x, asum, size_t x_inc = 1, size_t x_offset = 0, size_t asum_offset = 0, wait_for = None):
     """
     xASUM: Absolute sum of values in a vector
     """
 
+    x = check_vector(x, "x")
+    asum = check_matrix(asum, "asum")
     dtype = check_dtype([x, asum], ["float32", "float64", "complex64", "complex128"])
-    check_vector(x, "x")
-    check_matrix(asum, "asum")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem asum_buffer = <cl_mem><size_t>asum.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t asum_element_offset = element_offset(asum)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSasum(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastSasum(n, asum_buffer, asum_offset + asum_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDasum(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastDasum(n, asum_buffer, asum_offset + asum_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastScasum(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastScasum(n, asum_buffer, asum_offset + asum_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastDzasum(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastDzasum(n, asum_buffer, asum_offset + asum_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -638,36 +1011,44 @@ def asum(queue, n, x, asum, x_inc = 1, x_offset = 0, asum_offset = 0):
 # Sum of values in a vector (non-BLAS function): SSUM/DSUM/ScSUM/DzSUM/HSUM
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSsum(const size_t n, cl_mem sum_buffer, const size_t sum_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDsum(const size_t n, cl_mem sum_buffer, const size_t sum_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastScsum(const size_t n, cl_mem sum_buffer, const size_t sum_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDzsum(const size_t n, cl_mem sum_buffer, const size_t sum_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
 
-def sum(queue, n, x, sum, x_inc = 1, x_offset = 0, sum_offset = 0):
+def sum(queue, size_t n, x, sum, size_t x_inc = 1, size_t x_offset = 0, size_t sum_offset = 0, wait_for = None):
     """
     xSUM: Sum of values in a vector (non-BLAS function)
     """
 
+    x = check_vector(x, "x")
+    sum = check_matrix(sum, "sum")
     dtype = check_dtype([x, sum], ["float32", "float64", "complex64", "complex128"])
-    check_vector(x, "x")
-    check_matrix(sum, "sum")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem sum_buffer = <cl_mem><size_t>sum.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t sum_element_offset = element_offset(sum)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSsum(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastSsum(n, sum_buffer, sum_offset + sum_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDsum(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastDsum(n, sum_buffer, sum_offset + sum_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastScsum(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastScsum(n, sum_buffer, sum_offset + sum_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastDzsum(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastDzsum(n, sum_buffer, sum_offset + sum_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -678,36 +1059,44 @@ def sum(queue, n, x, sum, x_inc = 1, x_offset = 0, sum_offset = 0):
 # Index of absolute maximum value in a vector: iSAMAX/iDAMAX/iCAMAX/iZAMAX/iHAMAX
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastiSamax(const size_t n, cl_mem imax_buffer, const size_t imax_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastiDamax(const size_t n, cl_mem imax_buffer, const size_t imax_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastiCamax(const size_t n, cl_mem imax_buffer, const size_t imax_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastiZamax(const size_t n, cl_mem imax_buffer, const size_t imax_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
 
-def amax(queue, n, x, imax, x_inc = 1, x_offset = 0, imax_offset = 0):
+def amax(queue, size_t n, x, imax, size_t x_inc = 1, size_t x_offset = 0, size_t imax_offset = 0, wait_for = None):
     """
     xAMAX: Index of absolute maximum value in a vector
     """
 
+    x = check_vector(x, "x")
+    imax = check_matrix(imax, "imax")
     dtype = check_dtype([x, imax], ["float32", "float64", "complex64", "complex128"])
-    check_vector(x, "x")
-    check_matrix(imax, "imax")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem imax_buffer = <cl_mem><size_t>imax.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t imax_element_offset = element_offset(imax)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastiSamax(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiSamax(n, imax_buffer, imax_offset + imax_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastiDamax(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiDamax(n, imax_buffer, imax_offset + imax_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastiCamax(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiCamax(n, imax_buffer, imax_offset + imax_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastiZamax(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiZamax(n, imax_buffer, imax_offset + imax_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -718,36 +1107,44 @@ def amax(queue, n, x, imax, x_inc = 1, x_offset = 0, imax_offset = 0):
 # Index of absolute minimum value in a vector (non-BLAS function): iSAMIN/iDAMIN/iCAMIN/iZAMIN/iHAMIN
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastiSamin(const size_t n, cl_mem imin_buffer, const size_t imin_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastiDamin(const size_t n, cl_mem imin_buffer, const size_t imin_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastiCamin(const size_t n, cl_mem imin_buffer, const size_t imin_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastiZamin(const size_t n, cl_mem imin_buffer, const size_t imin_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
 
-def amin(queue, n, x, imin, x_inc = 1, x_offset = 0, imin_offset = 0):
+def amin(queue, size_t n, x, imin, size_t x_inc = 1, size_t x_offset = 0, size_t imin_offset = 0, wait_for = None):
     """
     xAMIN: Index of absolute minimum value in a vector (non-BLAS function)
     """
 
+    x = check_vector(x, "x")
+    imin = check_matrix(imin, "imin")
     dtype = check_dtype([x, imin], ["float32", "float64", "complex64", "complex128"])
-    check_vector(x, "x")
-    check_matrix(imin, "imin")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem imin_buffer = <cl_mem><size_t>imin.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t imin_element_offset = element_offset(imin)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastiSamin(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiSamin(n, imin_buffer, imin_offset + imin_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastiDamin(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiDamin(n, imin_buffer, imin_offset + imin_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastiCamin(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiCamin(n, imin_buffer, imin_offset + imin_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastiZamin(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiZamin(n, imin_buffer, imin_offset + imin_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -758,36 +1155,44 @@ def amin(queue, n, x, imin, x_inc = 1, x_offset = 0, imin_offset = 0):
 # Index of maximum value in a vector (non-BLAS function): iSMAX/iDMAX/iCMAX/iZMAX/iHMAX
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastiSmax(const size_t n, cl_mem imax_buffer, const size_t imax_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastiDmax(const size_t n, cl_mem imax_buffer, const size_t imax_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastiCmax(const size_t n, cl_mem imax_buffer, const size_t imax_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastiZmax(const size_t n, cl_mem imax_buffer, const size_t imax_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
 
-def max(queue, n, x, imax, x_inc = 1, x_offset = 0, imax_offset = 0):
+def max(queue, size_t n, x, imax, size_t x_inc = 1, size_t x_offset = 0, size_t imax_offset = 0, wait_for = None):
     """
     xMAX: Index of maximum value in a vector (non-BLAS function)
     """
 
+    x = check_vector(x, "x")
+    imax = check_matrix(imax, "imax")
     dtype = check_dtype([x, imax], ["float32", "float64", "complex64", "complex128"])
-    check_vector(x, "x")
-    check_matrix(imax, "imax")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem imax_buffer = <cl_mem><size_t>imax.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t imax_element_offset = element_offset(imax)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastiSmax(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiSmax(n, imax_buffer, imax_offset + imax_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastiDmax(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiDmax(n, imax_buffer, imax_offset + imax_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastiCmax(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiCmax(n, imax_buffer, imax_offset + imax_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastiZmax(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiZmax(n, imax_buffer, imax_offset + imax_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -798,36 +1203,44 @@ def max(queue, n, x, imax, x_inc = 1, x_offset = 0, imax_offset = 0):
 # Index of minimum value in a vector (non-BLAS function): iSMIN/iDMIN/iCMIN/iZMIN/iHMIN
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastiSmin(const size_t n, cl_mem imin_buffer, const size_t imin_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastiDmin(const size_t n, cl_mem imin_buffer, const size_t imin_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastiCmin(const size_t n, cl_mem imin_buffer, const size_t imin_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastiZmin(const size_t n, cl_mem imin_buffer, const size_t imin_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
 
-def min(queue, n, x, imin, x_inc = 1, x_offset = 0, imin_offset = 0):
+def min(queue, size_t n, x, imin, size_t x_inc = 1, size_t x_offset = 0, size_t imin_offset = 0, wait_for = None):
     """
     xMIN: Index of minimum value in a vector (non-BLAS function)
     """
 
+    x = check_vector(x, "x")
+    imin = check_matrix(imin, "imin")
     dtype = check_dtype([x, imin], ["float32", "float64", "complex64", "complex128"])
-    check_vector(x, "x")
-    check_matrix(imin, "imin")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem imin_buffer = <cl_mem><size_t>imin.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t imin_element_offset = element_offset(imin)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastiSmin(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiSmin(n, imin_buffer, imin_offset + imin_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastiDmin(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiDmin(n, imin_buffer, imin_offset + imin_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastiCmin(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiCmin(n, imin_buffer, imin_offset + imin_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastiZmin(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastiZmin(n, imin_buffer, imin_offset + imin_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -838,39 +1251,64 @@ def min(queue, n, x, imin, x_inc = 1, x_offset = 0, imin_offset = 0):
 # General matrix-vector multiplication: SGEMV/DGEMV/CGEMV/ZGEMV/HGEMV
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const float beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const double beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_float2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_double2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
 
-def gemv(queue, m, n, a, x, y, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0.0, a_transp = False, a_offset = 0, x_offset = 0, y_offset = 0):
+def gemv(queue, size_t m, size_t n, a, x, y, size_t a_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, beta = 0.0, bint a_transp = False, size_t a_offset = 0, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
     """
     xGEMV: General matrix-vector multiplication
     """
 
+    a = check_matrix(a, "a")
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
     dtype = check_dtype([a, x, y], ["float32", "float64", "complex64", "complex128"])
-    check_matrix(a, "a")
-    check_vector(x, "x")
-    check_vector(y, "y")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef cl_float alpha_s
+    cdef cl_float beta_s
+    cdef cl_double alpha_d
+    cdef cl_double beta_d
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSgemv(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_float>alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_float>beta, y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_s = alpha
+        beta_s = beta
+        with nogil:
+            err = CLBlastSgemv(CLBlastLayoutRowMajor, a_transpose, m, n, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_s, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDgemv(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_double>alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_double>beta, y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_d = alpha
+        beta_d = beta
+        with nogil:
+            err = CLBlastDgemv(CLBlastLayoutRowMajor, a_transpose, m, n, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_d, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCgemv(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_float2>cl_float2(x=beta.real,y=beta.imag), y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastCgemv(CLBlastLayoutRowMajor, a_transpose, m, n, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_c, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZgemv(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_double2>cl_double2(x=beta.real,y=beta.imag), y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZgemv(CLBlastLayoutRowMajor, a_transpose, m, n, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_z, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -881,39 +1319,64 @@ def gemv(queue, m, n, a, x, y, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0
 # General banded matrix-vector multiplication: SGBMV/DGBMV/CGBMV/ZGBMV/HGBMV
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const size_t kl, const size_t ku, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const float beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const size_t kl, const size_t ku, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const double beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const size_t kl, const size_t ku, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_float2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const size_t kl, const size_t ku, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_double2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
 
-def gbmv(queue, m, n, kl, ku, a, x, y, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0.0, a_transp = False, a_offset = 0, x_offset = 0, y_offset = 0):
+def gbmv(queue, size_t m, size_t n, size_t kl, size_t ku, a, x, y, size_t a_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, beta = 0.0, bint a_transp = False, size_t a_offset = 0, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
     """
     xGBMV: General banded matrix-vector multiplication
     """
 
+    a = check_matrix(a, "a")
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
     dtype = check_dtype([a, x, y], ["float32", "float64", "complex64", "complex128"])
-    check_matrix(a, "a")
-    check_vector(x, "x")
-    check_vector(y, "y")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef cl_float alpha_s
+    cdef cl_float beta_s
+    cdef cl_double alpha_d
+    cdef cl_double beta_d
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSgbmv(CLBlastLayoutRowMajor, a_transpose, m, n, kl, ku, <cl_float>alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_float>beta, y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_s = alpha
+        beta_s = beta
+        with nogil:
+            err = CLBlastSgbmv(CLBlastLayoutRowMajor, a_transpose, m, n, kl, ku, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_s, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDgbmv(CLBlastLayoutRowMajor, a_transpose, m, n, kl, ku, <cl_double>alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_double>beta, y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_d = alpha
+        beta_d = beta
+        with nogil:
+            err = CLBlastDgbmv(CLBlastLayoutRowMajor, a_transpose, m, n, kl, ku, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_d, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCgbmv(CLBlastLayoutRowMajor, a_transpose, m, n, kl, ku, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_float2>cl_float2(x=beta.real,y=beta.imag), y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastCgbmv(CLBlastLayoutRowMajor, a_transpose, m, n, kl, ku, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_c, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZgbmv(CLBlastLayoutRowMajor, a_transpose, m, n, kl, ku, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_double2>cl_double2(x=beta.real,y=beta.imag), y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZgbmv(CLBlastLayoutRowMajor, a_transpose, m, n, kl, ku, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_z, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -924,33 +1387,48 @@ def gbmv(queue, m, n, kl, ku, a, x, y, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0,
 # Hermitian matrix-vector multiplication: CHEMV/ZHEMV
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastChemv(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_float2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZhemv(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_double2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
 
-def hemv(queue, n, a, x, y, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0.0, lower_triangle = False, a_offset = 0, x_offset = 0, y_offset = 0):
+def hemv(queue, size_t n, a, x, y, size_t a_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, beta = 0.0, bint lower_triangle = False, size_t a_offset = 0, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
     """
     xHEMV: Hermitian matrix-vector multiplication
     """
 
+    a = check_matrix(a, "a")
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
     dtype = check_dtype([a, x, y], ["complex64", "complex128"])
-    check_matrix(a, "a")
-    check_vector(x, "x")
-    check_vector(y, "y")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("complex64"):
-        err = CLBlastChemv(CLBlastLayoutRowMajor, triangle, n, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_float2>cl_float2(x=beta.real,y=beta.imag), y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastChemv(CLBlastLayoutRowMajor, triangle, n, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_c, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZhemv(CLBlastLayoutRowMajor, triangle, n, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_double2>cl_double2(x=beta.real,y=beta.imag), y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZhemv(CLBlastLayoutRowMajor, triangle, n, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_z, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -961,33 +1439,48 @@ def hemv(queue, n, a, x, y, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0.0,
 # Hermitian banded matrix-vector multiplication: CHBMV/ZHBMV
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastChbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const size_t k, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_float2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZhbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const size_t k, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_double2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
 
-def hbmv(queue, n, k, a, x, y, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0.0, lower_triangle = False, a_offset = 0, x_offset = 0, y_offset = 0):
+def hbmv(queue, size_t n, size_t k, a, x, y, size_t a_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, beta = 0.0, bint lower_triangle = False, size_t a_offset = 0, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
     """
     xHBMV: Hermitian banded matrix-vector multiplication
     """
 
+    a = check_matrix(a, "a")
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
     dtype = check_dtype([a, x, y], ["complex64", "complex128"])
-    check_matrix(a, "a")
-    check_vector(x, "x")
-    check_vector(y, "y")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("complex64"):
-        err = CLBlastChbmv(CLBlastLayoutRowMajor, triangle, n, k, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_float2>cl_float2(x=beta.real,y=beta.imag), y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastChbmv(CLBlastLayoutRowMajor, triangle, n, k, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_c, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZhbmv(CLBlastLayoutRowMajor, triangle, n, k, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_double2>cl_double2(x=beta.real,y=beta.imag), y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZhbmv(CLBlastLayoutRowMajor, triangle, n, k, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_z, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -998,33 +1491,48 @@ def hbmv(queue, n, k, a, x, y, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0
 # Hermitian packed matrix-vector multiplication: CHPMV/ZHPMV
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastChpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const cl_float2 alpha, const cl_mem ap_buffer, const size_t ap_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_float2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZhpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const cl_double2 alpha, const cl_mem ap_buffer, const size_t ap_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_double2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
 
-def hpmv(queue, n, ap, x, y, ap_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0.0, lower_triangle = False, ap_offset = 0, x_offset = 0, y_offset = 0):
+def hpmv(queue, size_t n, ap, x, y, size_t ap_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, beta = 0.0, bint lower_triangle = False, size_t ap_offset = 0, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
     """
     xHPMV: Hermitian packed matrix-vector multiplication
     """
 
+    ap = check_matrix(ap, "ap")
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
     dtype = check_dtype([ap, x, y], ["complex64", "complex128"])
-    check_matrix(ap, "ap")
-    check_vector(x, "x")
-    check_vector(y, "y")
 
     cdef cl_mem ap_buffer = <cl_mem><size_t>ap.base_data.int_ptr
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t ap_element_offset = element_offset(ap)
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("complex64"):
-        err = CLBlastChpmv(CLBlastLayoutRowMajor, triangle, n, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), ap_buffer, ap_offset, x_buffer, x_offset, x_inc, <cl_float2>cl_float2(x=beta.real,y=beta.imag), y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastChpmv(CLBlastLayoutRowMajor, triangle, n, alpha_c, ap_buffer, ap_offset + ap_element_offset, x_buffer, x_offset + x_element_offset, x_inc, beta_c, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZhpmv(CLBlastLayoutRowMajor, triangle, n, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), ap_buffer, ap_offset, x_buffer, x_offset, x_inc, <cl_double2>cl_double2(x=beta.real,y=beta.imag), y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZhpmv(CLBlastLayoutRowMajor, triangle, n, alpha_z, ap_buffer, ap_offset + ap_element_offset, x_buffer, x_offset + x_element_offset, x_inc, beta_z, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1035,33 +1543,48 @@ def hpmv(queue, n, ap, x, y, ap_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0.
 # Symmetric matrix-vector multiplication: SSYMV/DSYMV/HSYMV
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSsymv(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const float beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDsymv(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const double beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
 
-def symv(queue, n, a, x, y, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0.0, lower_triangle = False, a_offset = 0, x_offset = 0, y_offset = 0):
+def symv(queue, size_t n, a, x, y, size_t a_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, beta = 0.0, bint lower_triangle = False, size_t a_offset = 0, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
     """
     xSYMV: Symmetric matrix-vector multiplication
     """
 
+    a = check_matrix(a, "a")
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
     dtype = check_dtype([a, x, y], ["float32", "float64"])
-    check_matrix(a, "a")
-    check_vector(x, "x")
-    check_vector(y, "y")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float alpha_s
+    cdef cl_float beta_s
+    cdef cl_double alpha_d
+    cdef cl_double beta_d
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSsymv(CLBlastLayoutRowMajor, triangle, n, <cl_float>alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_float>beta, y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_s = alpha
+        beta_s = beta
+        with nogil:
+            err = CLBlastSsymv(CLBlastLayoutRowMajor, triangle, n, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_s, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDsymv(CLBlastLayoutRowMajor, triangle, n, <cl_double>alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_double>beta, y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_d = alpha
+        beta_d = beta
+        with nogil:
+            err = CLBlastDsymv(CLBlastLayoutRowMajor, triangle, n, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_d, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1072,33 +1595,48 @@ def symv(queue, n, a, x, y, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0.0,
 # Symmetric banded matrix-vector multiplication: SSBMV/DSBMV/HSBMV
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSsbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const size_t k, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const float beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDsbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const size_t k, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const double beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
 
-def sbmv(queue, n, k, a, x, y, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0.0, lower_triangle = False, a_offset = 0, x_offset = 0, y_offset = 0):
+def sbmv(queue, size_t n, size_t k, a, x, y, size_t a_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, beta = 0.0, bint lower_triangle = False, size_t a_offset = 0, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
     """
     xSBMV: Symmetric banded matrix-vector multiplication
     """
 
+    a = check_matrix(a, "a")
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
     dtype = check_dtype([a, x, y], ["float32", "float64"])
-    check_matrix(a, "a")
-    check_vector(x, "x")
-    check_vector(y, "y")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float alpha_s
+    cdef cl_float beta_s
+    cdef cl_double alpha_d
+    cdef cl_double beta_d
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSsbmv(CLBlastLayoutRowMajor, triangle, n, k, <cl_float>alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_float>beta, y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_s = alpha
+        beta_s = beta
+        with nogil:
+            err = CLBlastSsbmv(CLBlastLayoutRowMajor, triangle, n, k, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_s, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDsbmv(CLBlastLayoutRowMajor, triangle, n, k, <cl_double>alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, <cl_double>beta, y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_d = alpha
+        beta_d = beta
+        with nogil:
+            err = CLBlastDsbmv(CLBlastLayoutRowMajor, triangle, n, k, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, beta_d, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1109,33 +1647,48 @@ def sbmv(queue, n, k, a, x, y, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0
 # Symmetric packed matrix-vector multiplication: SSPMV/DSPMV/HSPMV
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSspmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const float alpha, const cl_mem ap_buffer, const size_t ap_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const float beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDspmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const double alpha, const cl_mem ap_buffer, const size_t ap_offset, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const double beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc,cl_command_queue* queue, cl_event* event)
 
-def spmv(queue, n, ap, x, y, ap_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0.0, lower_triangle = False, ap_offset = 0, x_offset = 0, y_offset = 0):
+def spmv(queue, size_t n, ap, x, y, size_t ap_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, beta = 0.0, bint lower_triangle = False, size_t ap_offset = 0, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
     """
     xSPMV: Symmetric packed matrix-vector multiplication
     """
 
+    ap = check_matrix(ap, "ap")
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
     dtype = check_dtype([ap, x, y], ["float32", "float64"])
-    check_matrix(ap, "ap")
-    check_vector(x, "x")
-    check_vector(y, "y")
 
     cdef cl_mem ap_buffer = <cl_mem><size_t>ap.base_data.int_ptr
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t ap_element_offset = element_offset(ap)
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float alpha_s
+    cdef cl_float beta_s
+    cdef cl_double alpha_d
+    cdef cl_double beta_d
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSspmv(CLBlastLayoutRowMajor, triangle, n, <cl_float>alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, <cl_float>beta, y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_s = alpha
+        beta_s = beta
+        with nogil:
+            err = CLBlastSspmv(CLBlastLayoutRowMajor, triangle, n, alpha_s, ap_buffer, ap_offset + ap_element_offset, x_buffer, x_offset + x_element_offset, x_inc, beta_s, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDspmv(CLBlastLayoutRowMajor, triangle, n, <cl_double>alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, <cl_double>beta, y_buffer, y_offset, y_inc, &command_queue, &event)
+        alpha_d = alpha
+        beta_d = beta
+        with nogil:
+            err = CLBlastDspmv(CLBlastLayoutRowMajor, triangle, n, alpha_d, ap_buffer, ap_offset + ap_element_offset, x_buffer, x_offset + x_element_offset, x_inc, beta_d, y_buffer, y_offset + y_element_offset, y_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1146,39 +1699,47 @@ def spmv(queue, n, ap, x, y, ap_ld, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0.
 # Triangular matrix-vector multiplication: STRMV/DTRMV/CTRMV/ZTRMV/HTRMV
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastStrmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDtrmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCtrmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZtrmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
 
-def trmv(queue, n, a, x, a_ld, x_inc = 1, lower_triangle = False, a_transp = False, unit_diagonal = False, a_offset = 0, x_offset = 0):
+def trmv(queue, size_t n, a, x, size_t a_ld, size_t x_inc = 1, bint lower_triangle = False, bint a_transp = False, bint unit_diagonal = False, size_t a_offset = 0, size_t x_offset = 0, wait_for = None):
     """
     xTRMV: Triangular matrix-vector multiplication
     """
 
+    a = check_matrix(a, "a")
+    x = check_vector(x, "x")
     dtype = check_dtype([a, x], ["float32", "float64", "complex64", "complex128"])
-    check_matrix(a, "a")
-    check_vector(x, "x")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t x_element_offset = element_offset(x)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
-    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
-    diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastDiagonal diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastStrmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastStrmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDtrmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastDtrmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCtrmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastCtrmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZtrmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastZtrmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1189,39 +1750,47 @@ def trmv(queue, n, a, x, a_ld, x_inc = 1, lower_triangle = False, a_transp = Fal
 # Triangular banded matrix-vector multiplication: STBMV/DTBMV/CTBMV/ZTBMV/HTBMV
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastStbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const size_t k, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDtbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const size_t k, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCtbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const size_t k, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZtbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const size_t k, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
 
-def tbmv(queue, n, k, a, x, a_ld, x_inc = 1, lower_triangle = False, a_transp = False, unit_diagonal = False, a_offset = 0, x_offset = 0):
+def tbmv(queue, size_t n, size_t k, a, x, size_t a_ld, size_t x_inc = 1, bint lower_triangle = False, bint a_transp = False, bint unit_diagonal = False, size_t a_offset = 0, size_t x_offset = 0, wait_for = None):
     """
     xTBMV: Triangular banded matrix-vector multiplication
     """
 
+    a = check_matrix(a, "a")
+    x = check_vector(x, "x")
     dtype = check_dtype([a, x], ["float32", "float64", "complex64", "complex128"])
-    check_matrix(a, "a")
-    check_vector(x, "x")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t x_element_offset = element_offset(x)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
-    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
-    diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastDiagonal diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastStbmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastStbmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDtbmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastDtbmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCtbmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastCtbmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZtbmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastZtbmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1232,39 +1801,47 @@ def tbmv(queue, n, k, a, x, a_ld, x_inc = 1, lower_triangle = False, a_transp =
 # Triangular packed matrix-vector multiplication: STPMV/DTPMV/CTPMV/ZTPMV/HTPMV
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastStpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem ap_buffer, const size_t ap_offset, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDtpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem ap_buffer, const size_t ap_offset, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCtpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem ap_buffer, const size_t ap_offset, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZtpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem ap_buffer, const size_t ap_offset, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
 
-def tpmv(queue, n, ap, x, ap_ld, x_inc = 1, lower_triangle = False, a_transp = False, unit_diagonal = False, ap_offset = 0, x_offset = 0):
+def tpmv(queue, size_t n, ap, x, size_t ap_ld, size_t x_inc = 1, bint lower_triangle = False, bint a_transp = False, bint unit_diagonal = False, size_t ap_offset = 0, size_t x_offset = 0, wait_for = None):
     """
     xTPMV: Triangular packed matrix-vector multiplication
     """
 
+    ap = check_matrix(ap, "ap")
+    x = check_vector(x, "x")
     dtype = check_dtype([ap, x], ["float32", "float64", "complex64", "complex128"])
-    check_matrix(ap, "ap")
-    check_vector(x, "x")
 
     cdef cl_mem ap_buffer = <cl_mem><size_t>ap.base_data.int_ptr
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef size_t ap_element_offset = element_offset(ap)
+    cdef size_t x_element_offset = element_offset(x)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
-    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
-    diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastDiagonal diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastStpmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastStpmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset + ap_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDtpmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastDtpmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset + ap_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCtpmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastCtpmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset + ap_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZtpmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastZtpmv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset + ap_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1275,75 +1852,196 @@ def tpmv(queue, n, ap, x, ap_ld, x_inc = 1, lower_triangle = False, a_transp = F
 # Solves a triangular system of equations: STRSV/DTRSV/CTRSV/ZTRSV
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastStrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
 
-def trsv(queue, n, a, x, a_ld, x_inc = 1, lower_triangle = False, a_transp = False, unit_diagonal = False, a_offset = 0, x_offset = 0):
+def trsv(queue, size_t n, a, x, size_t a_ld, size_t x_inc = 1, bint lower_triangle = False, bint a_transp = False, bint unit_diagonal = False, size_t a_offset = 0, size_t x_offset = 0, wait_for = None):
     """
     xTRSV: Solves a triangular system of equations
     """
 
+    a = check_matrix(a, "a")
+    x = check_vector(x, "x")
     dtype = check_dtype([a, x], ["float32", "float64", "complex64", "complex128"])
-    check_matrix(a, "a")
-    check_vector(x, "x")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t x_element_offset = element_offset(x)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
-    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
-    diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastDiagonal diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastStrsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastStrsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDtrsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastDtrsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCtrsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastCtrsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZtrsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+        with nogil:
+            err = CLBlastZtrsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
         raise RuntimeError("PyCLBlast: 'CLBlastXtrsv' failed: %s" % get_status_message(err))
     return cl.Event.from_int_ptr(<size_t>event)
 
+####################################################################################################
+# Solves a banded triangular system of equations: STBSV/DTBSV/CTBSV/ZTBSV
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastStbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const size_t k, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDtbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const size_t k, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCtbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const size_t k, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZtbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const size_t k, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+
+def tbsv(queue, size_t n, size_t k, a, x, size_t a_ld, size_t x_inc = 1, bint lower_triangle = False, bint a_transp = False, bint unit_diagonal = False, size_t a_offset = 0, size_t x_offset = 0, wait_for = None):
+    """
+    xTBSV: Solves a banded triangular system of equations
+    """
+
+    a = check_matrix(a, "a")
+    x = check_vector(x, "x")
+    dtype = check_dtype([a, x], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t x_element_offset = element_offset(x)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastDiagonal diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        with nogil:
+            err = CLBlastStbsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        with nogil:
+            err = CLBlastDtbsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        with nogil:
+            err = CLBlastCtbsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        with nogil:
+            err = CLBlastZtbsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset + a_element_offset, a_ld, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXtbsv' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Solves a packed triangular system of equations: STPSV/DTPSV/CTPSV/ZTPSV
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastStpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem ap_buffer, const size_t ap_offset, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDtpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem ap_buffer, const size_t ap_offset, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCtpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem ap_buffer, const size_t ap_offset, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZtpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem ap_buffer, const size_t ap_offset, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+
+def tpsv(queue, size_t n, ap, x, size_t ap_ld, size_t x_inc = 1, bint lower_triangle = False, bint a_transp = False, bint unit_diagonal = False, size_t ap_offset = 0, size_t x_offset = 0, wait_for = None):
+    """
+    xTPSV: Solves a packed triangular system of equations
+    """
+
+    ap = check_matrix(ap, "ap")
+    x = check_vector(x, "x")
+    dtype = check_dtype([ap, x], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem ap_buffer = <cl_mem><size_t>ap.base_data.int_ptr
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef size_t ap_element_offset = element_offset(ap)
+    cdef size_t x_element_offset = element_offset(x)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastDiagonal diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        with nogil:
+            err = CLBlastStpsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset + ap_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        with nogil:
+            err = CLBlastDtpsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset + ap_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        with nogil:
+            err = CLBlastCtpsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset + ap_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        with nogil:
+            err = CLBlastZtpsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset + ap_element_offset, x_buffer, x_offset + x_element_offset, x_inc, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXtpsv' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
 ####################################################################################################
 # General rank-1 matrix update: SGER/DGER/HGER
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSger(const CLBlastLayout layout, const size_t m, const size_t n, const float alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDger(const CLBlastLayout layout, const size_t m, const size_t n, const double alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,cl_command_queue* queue, cl_event* event)
 
-def ger(queue, m, n, x, y, a, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, x_offset = 0, y_offset = 0, a_offset = 0):
+def ger(queue, size_t m, size_t n, x, y, a, size_t a_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, size_t x_offset = 0, size_t y_offset = 0, size_t a_offset = 0, wait_for = None):
     """
     xGER: General rank-1 matrix update
     """
 
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    a = check_matrix(a, "a")
     dtype = check_dtype([x, y, a], ["float32", "float64"])
-    check_vector(x, "x")
-    check_vector(y, "y")
-    check_matrix(a, "a")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+    cdef size_t a_element_offset = element_offset(a)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSger(CLBlastLayoutRowMajor, m, n, <cl_float>alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, &command_queue, &event)
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastSger(CLBlastLayoutRowMajor, m, n, alpha_s, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, a_buffer, a_offset + a_element_offset, a_ld, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDger(CLBlastLayoutRowMajor, m, n, <cl_double>alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, &command_queue, &event)
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDger(CLBlastLayoutRowMajor, m, n, alpha_d, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, a_buffer, a_offset + a_element_offset, a_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1354,32 +2052,43 @@ def ger(queue, m, n, x, y, a, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, x_offset
 # General rank-1 complex matrix update: CGERU/ZGERU
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastCgeru(const CLBlastLayout layout, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZgeru(const CLBlastLayout layout, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,cl_command_queue* queue, cl_event* event)
 
-def geru(queue, m, n, x, y, a, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, x_offset = 0, y_offset = 0, a_offset = 0):
+def geru(queue, size_t m, size_t n, x, y, a, size_t a_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, size_t x_offset = 0, size_t y_offset = 0, size_t a_offset = 0, wait_for = None):
     """
     xGERU: General rank-1 complex matrix update
     """
 
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    a = check_matrix(a, "a")
     dtype = check_dtype([x, y, a], ["complex64", "complex128"])
-    check_vector(x, "x")
-    check_vector(y, "y")
-    check_matrix(a, "a")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+    cdef size_t a_element_offset = element_offset(a)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
+    cdef cl_float2 alpha_c
+    cdef cl_double2 alpha_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("complex64"):
-        err = CLBlastCgeru(CLBlastLayoutRowMajor, m, n, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastCgeru(CLBlastLayoutRowMajor, m, n, alpha_c, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, a_buffer, a_offset + a_element_offset, a_ld, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZgeru(CLBlastLayoutRowMajor, m, n, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastZgeru(CLBlastLayoutRowMajor, m, n, alpha_z, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, a_buffer, a_offset + a_element_offset, a_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1390,32 +2099,43 @@ def geru(queue, m, n, x, y, a, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, x_offset
 # General rank-1 complex conjugated matrix update: CGERC/ZGERC
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastCgerc(const CLBlastLayout layout, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZgerc(const CLBlastLayout layout, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,cl_command_queue* queue, cl_event* event)
 
-def gerc(queue, m, n, x, y, a, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, x_offset = 0, y_offset = 0, a_offset = 0):
+def gerc(queue, size_t m, size_t n, x, y, a, size_t a_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, size_t x_offset = 0, size_t y_offset = 0, size_t a_offset = 0, wait_for = None):
     """
     xGERC: General rank-1 complex conjugated matrix update
     """
 
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    a = check_matrix(a, "a")
     dtype = check_dtype([x, y, a], ["complex64", "complex128"])
-    check_vector(x, "x")
-    check_vector(y, "y")
-    check_matrix(a, "a")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+    cdef size_t a_element_offset = element_offset(a)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
+    cdef cl_float2 alpha_c
+    cdef cl_double2 alpha_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("complex64"):
-        err = CLBlastCgerc(CLBlastLayoutRowMajor, m, n, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastCgerc(CLBlastLayoutRowMajor, m, n, alpha_c, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, a_buffer, a_offset + a_element_offset, a_ld, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZgerc(CLBlastLayoutRowMajor, m, n, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastZgerc(CLBlastLayoutRowMajor, m, n, alpha_z, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, a_buffer, a_offset + a_element_offset, a_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1426,31 +2146,41 @@ def gerc(queue, m, n, x, y, a, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, x_offset
 # Hermitian rank-1 matrix update: CHER/ZHER
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastCher(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const float alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZher(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const double alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,cl_command_queue* queue, cl_event* event)
 
-def her(queue, n, x, a, a_ld, x_inc = 1, alpha = 1.0, lower_triangle = False, x_offset = 0, a_offset = 0):
+def her(queue, size_t n, x, a, size_t a_ld, size_t x_inc = 1, alpha = 1.0, bint lower_triangle = False, size_t x_offset = 0, size_t a_offset = 0, wait_for = None):
     """
     xHER: Hermitian rank-1 matrix update
     """
 
+    x = check_vector(x, "x")
+    a = check_matrix(a, "a")
     dtype = check_dtype([x, a], ["complex64", "complex128"])
-    check_vector(x, "x")
-    check_matrix(a, "a")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t a_element_offset = element_offset(a)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float alpha_c
+    cdef cl_double alpha_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("complex64"):
-        err = CLBlastCher(CLBlastLayoutRowMajor, triangle, n, <cl_float>alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, &command_queue, &event)
+        alpha_c = alpha
+        with nogil:
+            err = CLBlastCher(CLBlastLayoutRowMajor, triangle, n, alpha_c, x_buffer, x_offset + x_element_offset, x_inc, a_buffer, a_offset + a_element_offset, a_ld, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZher(CLBlastLayoutRowMajor, triangle, n, <cl_double>alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, &command_queue, &event)
+        alpha_z = alpha
+        with nogil:
+            err = CLBlastZher(CLBlastLayoutRowMajor, triangle, n, alpha_z, x_buffer, x_offset + x_element_offset, x_inc, a_buffer, a_offset + a_element_offset, a_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1461,31 +2191,41 @@ def her(queue, n, x, a, a_ld, x_inc = 1, alpha = 1.0, lower_triangle = False, x_
 # Hermitian packed rank-1 matrix update: CHPR/ZHPR
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastChpr(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const float alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem ap_buffer, const size_t ap_offset,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZhpr(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const double alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem ap_buffer, const size_t ap_offset,cl_command_queue* queue, cl_event* event)
 
-def hpr(queue, n, x, ap, ap_ld, x_inc = 1, alpha = 1.0, lower_triangle = False, x_offset = 0, ap_offset = 0):
+def hpr(queue, size_t n, x, ap, size_t ap_ld, size_t x_inc = 1, alpha = 1.0, bint lower_triangle = False, size_t x_offset = 0, size_t ap_offset = 0, wait_for = None):
     """
     xHPR: Hermitian packed rank-1 matrix update
     """
 
+    x = check_vector(x, "x")
+    ap = check_matrix(ap, "ap")
     dtype = check_dtype([x, ap], ["complex64", "complex128"])
-    check_vector(x, "x")
-    check_matrix(ap, "ap")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem ap_buffer = <cl_mem><size_t>ap.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t ap_element_offset = element_offset(ap)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float alpha_c
+    cdef cl_double alpha_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("complex64"):
-        err = CLBlastChpr(CLBlastLayoutRowMajor, triangle, n, <cl_float>alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, &command_queue, &event)
+        alpha_c = alpha
+        with nogil:
+            err = CLBlastChpr(CLBlastLayoutRowMajor, triangle, n, alpha_c, x_buffer, x_offset + x_element_offset, x_inc, ap_buffer, ap_offset + ap_element_offset, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZhpr(CLBlastLayoutRowMajor, triangle, n, <cl_double>alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, &command_queue, &event)
+        alpha_z = alpha
+        with nogil:
+            err = CLBlastZhpr(CLBlastLayoutRowMajor, triangle, n, alpha_z, x_buffer, x_offset + x_element_offset, x_inc, ap_buffer, ap_offset + ap_element_offset, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1496,33 +2236,44 @@ def hpr(queue, n, x, ap, ap_ld, x_inc = 1, alpha = 1.0, lower_triangle = False,
 # Hermitian rank-2 matrix update: CHER2/ZHER2
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastCher2(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const cl_float2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZher2(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const cl_double2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,cl_command_queue* queue, cl_event* event)
 
-def her2(queue, n, x, y, a, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, lower_triangle = False, x_offset = 0, y_offset = 0, a_offset = 0):
+def her2(queue, size_t n, x, y, a, size_t a_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, bint lower_triangle = False, size_t x_offset = 0, size_t y_offset = 0, size_t a_offset = 0, wait_for = None):
     """
     xHER2: Hermitian rank-2 matrix update
     """
 
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    a = check_matrix(a, "a")
     dtype = check_dtype([x, y, a], ["complex64", "complex128"])
-    check_vector(x, "x")
-    check_vector(y, "y")
-    check_matrix(a, "a")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+    cdef size_t a_element_offset = element_offset(a)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float2 alpha_c
+    cdef cl_double2 alpha_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("complex64"):
-        err = CLBlastCher2(CLBlastLayoutRowMajor, triangle, n, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastCher2(CLBlastLayoutRowMajor, triangle, n, alpha_c, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, a_buffer, a_offset + a_element_offset, a_ld, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZher2(CLBlastLayoutRowMajor, triangle, n, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastZher2(CLBlastLayoutRowMajor, triangle, n, alpha_z, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, a_buffer, a_offset + a_element_offset, a_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1533,33 +2284,44 @@ def her2(queue, n, x, y, a, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, lower_trian
 # Hermitian packed rank-2 matrix update: CHPR2/ZHPR2
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastChpr2(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const cl_float2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem ap_buffer, const size_t ap_offset,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZhpr2(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const cl_double2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem ap_buffer, const size_t ap_offset,cl_command_queue* queue, cl_event* event)
 
-def hpr2(queue, n, x, y, ap, ap_ld, x_inc = 1, y_inc = 1, alpha = 1.0, lower_triangle = False, x_offset = 0, y_offset = 0, ap_offset = 0):
+def hpr2(queue, size_t n, x, y, ap, size_t ap_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, bint lower_triangle = False, size_t x_offset = 0, size_t y_offset = 0, size_t ap_offset = 0, wait_for = None):
     """
     xHPR2: Hermitian packed rank-2 matrix update
     """
 
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    ap = check_matrix(ap, "ap")
     dtype = check_dtype([x, y, ap], ["complex64", "complex128"])
-    check_vector(x, "x")
-    check_vector(y, "y")
-    check_matrix(ap, "ap")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
     cdef cl_mem ap_buffer = <cl_mem><size_t>ap.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+    cdef size_t ap_element_offset = element_offset(ap)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float2 alpha_c
+    cdef cl_double2 alpha_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("complex64"):
-        err = CLBlastChpr2(CLBlastLayoutRowMajor, triangle, n, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastChpr2(CLBlastLayoutRowMajor, triangle, n, alpha_c, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, ap_buffer, ap_offset + ap_element_offset, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZhpr2(CLBlastLayoutRowMajor, triangle, n, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastZhpr2(CLBlastLayoutRowMajor, triangle, n, alpha_z, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, ap_buffer, ap_offset + ap_element_offset, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1570,31 +2332,41 @@ def hpr2(queue, n, x, y, ap, ap_ld, x_inc = 1, y_inc = 1, alpha = 1.0, lower_tri
 # Symmetric rank-1 matrix update: SSYR/DSYR/HSYR
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSsyr(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const float alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDsyr(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const double alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,cl_command_queue* queue, cl_event* event)
 
-def syr(queue, n, x, a, a_ld, x_inc = 1, alpha = 1.0, lower_triangle = False, x_offset = 0, a_offset = 0):
+def syr(queue, size_t n, x, a, size_t a_ld, size_t x_inc = 1, alpha = 1.0, bint lower_triangle = False, size_t x_offset = 0, size_t a_offset = 0, wait_for = None):
     """
     xSYR: Symmetric rank-1 matrix update
     """
 
+    x = check_vector(x, "x")
+    a = check_matrix(a, "a")
     dtype = check_dtype([x, a], ["float32", "float64"])
-    check_vector(x, "x")
-    check_matrix(a, "a")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t a_element_offset = element_offset(a)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSsyr(CLBlastLayoutRowMajor, triangle, n, <cl_float>alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, &command_queue, &event)
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastSsyr(CLBlastLayoutRowMajor, triangle, n, alpha_s, x_buffer, x_offset + x_element_offset, x_inc, a_buffer, a_offset + a_element_offset, a_ld, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDsyr(CLBlastLayoutRowMajor, triangle, n, <cl_double>alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, &command_queue, &event)
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDsyr(CLBlastLayoutRowMajor, triangle, n, alpha_d, x_buffer, x_offset + x_element_offset, x_inc, a_buffer, a_offset + a_element_offset, a_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1605,31 +2377,41 @@ def syr(queue, n, x, a, a_ld, x_inc = 1, alpha = 1.0, lower_triangle = False, x_
 # Symmetric packed rank-1 matrix update: SSPR/DSPR/HSPR
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSspr(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const float alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem ap_buffer, const size_t ap_offset,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDspr(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const double alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem ap_buffer, const size_t ap_offset,cl_command_queue* queue, cl_event* event)
 
-def spr(queue, n, x, ap, ap_ld, x_inc = 1, alpha = 1.0, lower_triangle = False, x_offset = 0, ap_offset = 0):
+def spr(queue, size_t n, x, ap, size_t ap_ld, size_t x_inc = 1, alpha = 1.0, bint lower_triangle = False, size_t x_offset = 0, size_t ap_offset = 0, wait_for = None):
     """
     xSPR: Symmetric packed rank-1 matrix update
     """
 
+    x = check_vector(x, "x")
+    ap = check_matrix(ap, "ap")
     dtype = check_dtype([x, ap], ["float32", "float64"])
-    check_vector(x, "x")
-    check_matrix(ap, "ap")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem ap_buffer = <cl_mem><size_t>ap.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t ap_element_offset = element_offset(ap)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSspr(CLBlastLayoutRowMajor, triangle, n, <cl_float>alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, &command_queue, &event)
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastSspr(CLBlastLayoutRowMajor, triangle, n, alpha_s, x_buffer, x_offset + x_element_offset, x_inc, ap_buffer, ap_offset + ap_element_offset, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDspr(CLBlastLayoutRowMajor, triangle, n, <cl_double>alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, &command_queue, &event)
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDspr(CLBlastLayoutRowMajor, triangle, n, alpha_d, x_buffer, x_offset + x_element_offset, x_inc, ap_buffer, ap_offset + ap_element_offset, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1640,33 +2422,44 @@ def spr(queue, n, x, ap, ap_ld, x_inc = 1, alpha = 1.0, lower_triangle = False,
 # Symmetric rank-2 matrix update: SSYR2/DSYR2/HSYR2
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSsyr2(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const float alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDsyr2(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const double alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem a_buffer, const size_t a_offset, const size_t a_ld,cl_command_queue* queue, cl_event* event)
 
-def syr2(queue, n, x, y, a, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, lower_triangle = False, x_offset = 0, y_offset = 0, a_offset = 0):
+def syr2(queue, size_t n, x, y, a, size_t a_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, bint lower_triangle = False, size_t x_offset = 0, size_t y_offset = 0, size_t a_offset = 0, wait_for = None):
     """
     xSYR2: Symmetric rank-2 matrix update
     """
 
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    a = check_matrix(a, "a")
     dtype = check_dtype([x, y, a], ["float32", "float64"])
-    check_vector(x, "x")
-    check_vector(y, "y")
-    check_matrix(a, "a")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+    cdef size_t a_element_offset = element_offset(a)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSsyr2(CLBlastLayoutRowMajor, triangle, n, <cl_float>alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, &command_queue, &event)
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastSsyr2(CLBlastLayoutRowMajor, triangle, n, alpha_s, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, a_buffer, a_offset + a_element_offset, a_ld, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDsyr2(CLBlastLayoutRowMajor, triangle, n, <cl_double>alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, &command_queue, &event)
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDsyr2(CLBlastLayoutRowMajor, triangle, n, alpha_d, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, a_buffer, a_offset + a_element_offset, a_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1677,33 +2470,44 @@ def syr2(queue, n, x, y, a, a_ld, x_inc = 1, y_inc = 1, alpha = 1.0, lower_trian
 # Symmetric packed rank-2 matrix update: SSPR2/DSPR2/HSPR2
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSspr2(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const float alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem ap_buffer, const size_t ap_offset,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDspr2(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const double alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem ap_buffer, const size_t ap_offset,cl_command_queue* queue, cl_event* event)
 
-def spr2(queue, n, x, y, ap, ap_ld, x_inc = 1, y_inc = 1, alpha = 1.0, lower_triangle = False, x_offset = 0, y_offset = 0, ap_offset = 0):
+def spr2(queue, size_t n, x, y, ap, size_t ap_ld, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, bint lower_triangle = False, size_t x_offset = 0, size_t y_offset = 0, size_t ap_offset = 0, wait_for = None):
     """
     xSPR2: Symmetric packed rank-2 matrix update
     """
 
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    ap = check_matrix(ap, "ap")
     dtype = check_dtype([x, y, ap], ["float32", "float64"])
-    check_vector(x, "x")
-    check_vector(y, "y")
-    check_matrix(ap, "ap")
 
     cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
     cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
     cdef cl_mem ap_buffer = <cl_mem><size_t>ap.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+    cdef size_t ap_element_offset = element_offset(ap)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSspr2(CLBlastLayoutRowMajor, triangle, n, <cl_float>alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, &command_queue, &event)
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastSspr2(CLBlastLayoutRowMajor, triangle, n, alpha_s, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, ap_buffer, ap_offset + ap_element_offset, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDspr2(CLBlastLayoutRowMajor, triangle, n, <cl_double>alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, &command_queue, &event)
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDspr2(CLBlastLayoutRowMajor, triangle, n, alpha_d, x_buffer, x_offset + x_element_offset, x_inc, y_buffer, y_offset + y_element_offset, y_inc, ap_buffer, ap_offset + ap_element_offset, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1714,40 +2518,65 @@ def spr2(queue, n, x, y, ap, ap_ld, x_inc = 1, y_inc = 1, alpha = 1.0, lower_tri
 # General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const float beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const double beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const cl_float2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const cl_double2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
 
-def gemm(queue, m, n, k, a, b, c, a_ld, b_ld, c_ld, alpha = 1.0, beta = 0.0, a_transp = False, b_transp = False, a_offset = 0, b_offset = 0, c_offset = 0):
+def gemm(queue, size_t m, size_t n, size_t k, a, b, c, size_t a_ld, size_t b_ld, size_t c_ld, alpha = 1.0, beta = 0.0, bint a_transp = False, bint b_transp = False, size_t a_offset = 0, size_t b_offset = 0, size_t c_offset = 0, wait_for = None):
     """
     xGEMM: General matrix-matrix multiplication
     """
 
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
+    c = check_matrix(c, "c")
     dtype = check_dtype([a, b, c], ["float32", "float64", "complex64", "complex128"])
-    check_matrix(a, "a")
-    check_matrix(b, "b")
-    check_matrix(c, "c")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
     cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
+    cdef size_t c_element_offset = element_offset(c)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
-    b_transpose = CLBlastTransposeYes if b_transp else CLBlastTransposeNo
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastTranspose b_transpose = CLBlastTransposeYes if b_transp else CLBlastTransposeNo
+    cdef cl_float alpha_s
+    cdef cl_float beta_s
+    cdef cl_double alpha_d
+    cdef cl_double beta_d
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSgemm(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_float>alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_float>beta, c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_s = alpha
+        beta_s = beta
+        with nogil:
+            err = CLBlastSgemm(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_s, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDgemm(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_double>alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_double>beta, c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_d = alpha
+        beta_d = beta
+        with nogil:
+            err = CLBlastDgemm(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_d, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCgemm(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_float2>cl_float2(x=beta.real,y=beta.imag), c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastCgemm(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_c, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZgemm(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_double2>cl_double2(x=beta.real,y=beta.imag), c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZgemm(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_z, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1758,40 +2587,65 @@ def gemm(queue, m, n, k, a, b, c, a_ld, b_ld, c_ld, alpha = 1.0, beta = 0.0, a_t
 # Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM/HSYMM
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSsymm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const size_t m, const size_t n, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const float beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDsymm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const size_t m, const size_t n, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const double beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCsymm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const cl_float2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZsymm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const cl_double2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
 
-def symm(queue, m, n, a, b, c, a_ld, b_ld, c_ld, alpha = 1.0, beta = 0.0, right_side = False, lower_triangle = False, a_offset = 0, b_offset = 0, c_offset = 0):
+def symm(queue, size_t m, size_t n, a, b, c, size_t a_ld, size_t b_ld, size_t c_ld, alpha = 1.0, beta = 0.0, bint right_side = False, bint lower_triangle = False, size_t a_offset = 0, size_t b_offset = 0, size_t c_offset = 0, wait_for = None):
     """
     xSYMM: Symmetric matrix-matrix multiplication
     """
 
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
+    c = check_matrix(c, "c")
     dtype = check_dtype([a, b, c], ["float32", "float64", "complex64", "complex128"])
-    check_matrix(a, "a")
-    check_matrix(b, "b")
-    check_matrix(c, "c")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
     cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
+    cdef size_t c_element_offset = element_offset(c)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    side = CLBlastSideRight if right_side else CLBlastSideLeft
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastSide side = CLBlastSideRight if right_side else CLBlastSideLeft
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float alpha_s
+    cdef cl_float beta_s
+    cdef cl_double alpha_d
+    cdef cl_double beta_d
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSsymm(CLBlastLayoutRowMajor, side, triangle, m, n, <cl_float>alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_float>beta, c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_s = alpha
+        beta_s = beta
+        with nogil:
+            err = CLBlastSsymm(CLBlastLayoutRowMajor, side, triangle, m, n, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_s, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDsymm(CLBlastLayoutRowMajor, side, triangle, m, n, <cl_double>alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_double>beta, c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_d = alpha
+        beta_d = beta
+        with nogil:
+            err = CLBlastDsymm(CLBlastLayoutRowMajor, side, triangle, m, n, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_d, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCsymm(CLBlastLayoutRowMajor, side, triangle, m, n, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_float2>cl_float2(x=beta.real,y=beta.imag), c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastCsymm(CLBlastLayoutRowMajor, side, triangle, m, n, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_c, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZsymm(CLBlastLayoutRowMajor, side, triangle, m, n, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_double2>cl_double2(x=beta.real,y=beta.imag), c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZsymm(CLBlastLayoutRowMajor, side, triangle, m, n, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_z, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1802,34 +2656,49 @@ def symm(queue, m, n, a, b, c, a_ld, b_ld, c_ld, alpha = 1.0, beta = 0.0, right_
 # Hermitian matrix-matrix multiplication: CHEMM/ZHEMM
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastChemm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const cl_float2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZhemm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const cl_double2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
 
-def hemm(queue, m, n, a, b, c, a_ld, b_ld, c_ld, alpha = 1.0, beta = 0.0, right_side = False, lower_triangle = False, a_offset = 0, b_offset = 0, c_offset = 0):
+def hemm(queue, size_t m, size_t n, a, b, c, size_t a_ld, size_t b_ld, size_t c_ld, alpha = 1.0, beta = 0.0, bint right_side = False, bint lower_triangle = False, size_t a_offset = 0, size_t b_offset = 0, size_t c_offset = 0, wait_for = None):
     """
     xHEMM: Hermitian matrix-matrix multiplication
     """
 
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
+    c = check_matrix(c, "c")
     dtype = check_dtype([a, b, c], ["complex64", "complex128"])
-    check_matrix(a, "a")
-    check_matrix(b, "b")
-    check_matrix(c, "c")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
     cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
+    cdef size_t c_element_offset = element_offset(c)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    side = CLBlastSideRight if right_side else CLBlastSideLeft
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastSide side = CLBlastSideRight if right_side else CLBlastSideLeft
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("complex64"):
-        err = CLBlastChemm(CLBlastLayoutRowMajor, side, triangle, m, n, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_float2>cl_float2(x=beta.real,y=beta.imag), c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastChemm(CLBlastLayoutRowMajor, side, triangle, m, n, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_c, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZhemm(CLBlastLayoutRowMajor, side, triangle, m, n, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_double2>cl_double2(x=beta.real,y=beta.imag), c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZhemm(CLBlastLayoutRowMajor, side, triangle, m, n, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_z, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1840,38 +2709,62 @@ def hemm(queue, m, n, a, b, c, a_ld, b_ld, c_ld, alpha = 1.0, beta = 0.0, right_
 # Rank-K update of a symmetric matrix: SSYRK/DSYRK/CSYRK/ZSYRK/HSYRK
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSsyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const size_t n, const size_t k, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const float beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDsyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const size_t n, const size_t k, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const double beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCsyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const size_t n, const size_t k, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_float2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZsyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const size_t n, const size_t k, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_double2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
 
-def syrk(queue, n, k, a, c, a_ld, c_ld, alpha = 1.0, beta = 0.0, lower_triangle = False, a_transp = False, a_offset = 0, c_offset = 0):
+def syrk(queue, size_t n, size_t k, a, c, size_t a_ld, size_t c_ld, alpha = 1.0, beta = 0.0, bint lower_triangle = False, bint a_transp = False, size_t a_offset = 0, size_t c_offset = 0, wait_for = None):
     """
     xSYRK: Rank-K update of a symmetric matrix
     """
 
+    a = check_matrix(a, "a")
+    c = check_matrix(c, "c")
     dtype = check_dtype([a, c], ["float32", "float64", "complex64", "complex128"])
-    check_matrix(a, "a")
-    check_matrix(c, "c")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t c_element_offset = element_offset(c)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
-    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef cl_float alpha_s
+    cdef cl_float beta_s
+    cdef cl_double alpha_d
+    cdef cl_double beta_d
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSsyrk(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, <cl_float>alpha, a_buffer, a_offset, a_ld, <cl_float>beta, c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_s = alpha
+        beta_s = beta
+        with nogil:
+            err = CLBlastSsyrk(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, beta_s, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDsyrk(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, <cl_double>alpha, a_buffer, a_offset, a_ld, <cl_double>beta, c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_d = alpha
+        beta_d = beta
+        with nogil:
+            err = CLBlastDsyrk(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, beta_d, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCsyrk(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, <cl_float2>cl_float2(x=beta.real,y=beta.imag), c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastCsyrk(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, beta_c, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZsyrk(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, <cl_double2>cl_double2(x=beta.real,y=beta.imag), c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZsyrk(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, beta_z, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1882,32 +2775,46 @@ def syrk(queue, n, k, a, c, a_ld, c_ld, alpha = 1.0, beta = 0.0, lower_triangle
 # Rank-K update of a hermitian matrix: CHERK/ZHERK
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastCherk(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const size_t n, const size_t k, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const float beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZherk(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const size_t n, const size_t k, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const double beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
 
-def herk(queue, n, k, a, c, a_ld, c_ld, alpha = 1.0, beta = 0.0, lower_triangle = False, a_transp = False, a_offset = 0, c_offset = 0):
+def herk(queue, size_t n, size_t k, a, c, size_t a_ld, size_t c_ld, alpha = 1.0, beta = 0.0, bint lower_triangle = False, bint a_transp = False, size_t a_offset = 0, size_t c_offset = 0, wait_for = None):
     """
     xHERK: Rank-K update of a hermitian matrix
     """
 
+    a = check_matrix(a, "a")
+    c = check_matrix(c, "c")
     dtype = check_dtype([a, c], ["complex64", "complex128"])
-    check_matrix(a, "a")
-    check_matrix(c, "c")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t c_element_offset = element_offset(c)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
-    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef cl_float alpha_c
+    cdef cl_float beta_c
+    cdef cl_double alpha_z
+    cdef cl_double beta_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("complex64"):
-        err = CLBlastCherk(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, <cl_float>alpha, a_buffer, a_offset, a_ld, <cl_float>beta, c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_c = alpha
+        beta_c = beta
+        with nogil:
+            err = CLBlastCherk(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, beta_c, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZherk(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, <cl_double>alpha, a_buffer, a_offset, a_ld, <cl_double>beta, c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_z = alpha
+        beta_z = beta
+        with nogil:
+            err = CLBlastZherk(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, beta_z, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1918,40 +2825,65 @@ def herk(queue, n, k, a, c, a_ld, c_ld, alpha = 1.0, beta = 0.0, lower_triangle
 # Rank-2K update of a symmetric matrix: SSYR2K/DSYR2K/CSYR2K/ZSYR2K/HSYR2K
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastSsyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose ab_transpose, const size_t n, const size_t k, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const float beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDsyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose ab_transpose, const size_t n, const size_t k, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const double beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCsyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose ab_transpose, const size_t n, const size_t k, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const cl_float2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZsyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose ab_transpose, const size_t n, const size_t k, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const cl_double2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
 
-def syr2k(queue, n, k, a, b, c, a_ld, b_ld, c_ld, alpha = 1.0, beta = 0.0, lower_triangle = False, ab_transp = False, a_offset = 0, b_offset = 0, c_offset = 0):
+def syr2k(queue, size_t n, size_t k, a, b, c, size_t a_ld, size_t b_ld, size_t c_ld, alpha = 1.0, beta = 0.0, bint lower_triangle = False, bint ab_transp = False, size_t a_offset = 0, size_t b_offset = 0, size_t c_offset = 0, wait_for = None):
     """
     xSYR2K: Rank-2K update of a symmetric matrix
     """
 
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
+    c = check_matrix(c, "c")
     dtype = check_dtype([a, b, c], ["float32", "float64", "complex64", "complex128"])
-    check_matrix(a, "a")
-    check_matrix(b, "b")
-    check_matrix(c, "c")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
     cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
+    cdef size_t c_element_offset = element_offset(c)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
-    ab_transpose = CLBlastTransposeYes if ab_transp else CLBlastTransposeNo
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose ab_transpose = CLBlastTransposeYes if ab_transp else CLBlastTransposeNo
+    cdef cl_float alpha_s
+    cdef cl_float beta_s
+    cdef cl_double alpha_d
+    cdef cl_double beta_d
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastSsyr2k(CLBlastLayoutRowMajor, triangle, ab_transpose, n, k, <cl_float>alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_float>beta, c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_s = alpha
+        beta_s = beta
+        with nogil:
+            err = CLBlastSsyr2k(CLBlastLayoutRowMajor, triangle, ab_transpose, n, k, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_s, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDsyr2k(CLBlastLayoutRowMajor, triangle, ab_transpose, n, k, <cl_double>alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_double>beta, c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_d = alpha
+        beta_d = beta
+        with nogil:
+            err = CLBlastDsyr2k(CLBlastLayoutRowMajor, triangle, ab_transpose, n, k, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_d, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCsyr2k(CLBlastLayoutRowMajor, triangle, ab_transpose, n, k, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_float2>cl_float2(x=beta.real,y=beta.imag), c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastCsyr2k(CLBlastLayoutRowMajor, triangle, ab_transpose, n, k, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_c, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZsyr2k(CLBlastLayoutRowMajor, triangle, ab_transpose, n, k, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_double2>cl_double2(x=beta.real,y=beta.imag), c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZsyr2k(CLBlastLayoutRowMajor, triangle, ab_transpose, n, k, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_z, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -1962,34 +2894,49 @@ def syr2k(queue, n, k, a, b, c, a_ld, b_ld, c_ld, alpha = 1.0, beta = 0.0, lower
 # Rank-2K update of a hermitian matrix: CHER2K/ZHER2K
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastCher2k(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose ab_transpose, const size_t n, const size_t k, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const float beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZher2k(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose ab_transpose, const size_t n, const size_t k, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const double beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,cl_command_queue* queue, cl_event* event)
 
-def her2k(queue, n, k, a, b, c, a_ld, b_ld, c_ld, alpha = 1.0, beta = 0.0, lower_triangle = False, ab_transp = False, a_offset = 0, b_offset = 0, c_offset = 0):
+def her2k(queue, size_t n, size_t k, a, b, c, size_t a_ld, size_t b_ld, size_t c_ld, alpha = 1.0, beta = 0.0, bint lower_triangle = False, bint ab_transp = False, size_t a_offset = 0, size_t b_offset = 0, size_t c_offset = 0, wait_for = None):
     """
     xHER2K: Rank-2K update of a hermitian matrix
     """
 
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
+    c = check_matrix(c, "c")
     dtype = check_dtype([a, b, c], ["complex64", "complex128"])
-    check_matrix(a, "a")
-    check_matrix(b, "b")
-    check_matrix(c, "c")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
     cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
+    cdef size_t c_element_offset = element_offset(c)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
-    ab_transpose = CLBlastTransposeYes if ab_transp else CLBlastTransposeNo
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose ab_transpose = CLBlastTransposeYes if ab_transp else CLBlastTransposeNo
+    cdef cl_float2 alpha_c
+    cdef cl_float beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double beta_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("complex64"):
-        err = CLBlastCher2k(CLBlastLayoutRowMajor, triangle, ab_transpose, n, k, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_float>beta, c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = beta
+        with nogil:
+            err = CLBlastCher2k(CLBlastLayoutRowMajor, triangle, ab_transpose, n, k, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_c, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZher2k(CLBlastLayoutRowMajor, triangle, ab_transpose, n, k, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, <cl_double>beta, c_buffer, c_offset, c_ld, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = beta
+        with nogil:
+            err = CLBlastZher2k(CLBlastLayoutRowMajor, triangle, ab_transpose, n, k, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, beta_z, c_buffer, c_offset + c_element_offset, c_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -2000,40 +2947,56 @@ def her2k(queue, n, k, a, b, c, a_ld, b_ld, c_ld, alpha = 1.0, beta = 0.0, lower
 # Triangular matrix-matrix multiplication: STRMM/DTRMM/CTRMM/ZTRMM/HTRMM
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastStrmm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem b_buffer, const size_t b_offset, const size_t b_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDtrmm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem b_buffer, const size_t b_offset, const size_t b_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCtrmm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem b_buffer, const size_t b_offset, const size_t b_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZtrmm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem b_buffer, const size_t b_offset, const size_t b_ld,cl_command_queue* queue, cl_event* event)
 
-def trmm(queue, m, n, a, b, a_ld, b_ld, alpha = 1.0, right_side = False, lower_triangle = False, a_transp = False, unit_diagonal = False, a_offset = 0, b_offset = 0):
+def trmm(queue, size_t m, size_t n, a, b, size_t a_ld, size_t b_ld, alpha = 1.0, bint right_side = False, bint lower_triangle = False, bint a_transp = False, bint unit_diagonal = False, size_t a_offset = 0, size_t b_offset = 0, wait_for = None):
     """
     xTRMM: Triangular matrix-matrix multiplication
     """
 
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
     dtype = check_dtype([a, b], ["float32", "float64", "complex64", "complex128"])
-    check_matrix(a, "a")
-    check_matrix(b, "b")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    side = CLBlastSideRight if right_side else CLBlastSideLeft
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
-    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
-    diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+    cdef CLBlastSide side = CLBlastSideRight if right_side else CLBlastSideLeft
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastDiagonal diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
+    cdef cl_float2 alpha_c
+    cdef cl_double2 alpha_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastStrmm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, <cl_float>alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, &command_queue, &event)
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastStrmm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDtrmm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, <cl_double>alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, &command_queue, &event)
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDtrmm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCtrmm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastCtrmm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZtrmm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastZtrmm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -2044,40 +3007,56 @@ def trmm(queue, m, n, a, b, a_ld, b_ld, alpha = 1.0, right_side = False, lower_t
 # Solves a triangular system of equations: STRSM/DTRSM/CTRSM/ZTRSM
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
+cdef extern from "clblast_c.h" nogil:
     CLBlastStatusCode CLBlastStrsm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem b_buffer, const size_t b_offset, const size_t b_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastDtrsm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem b_buffer, const size_t b_offset, const size_t b_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastCtrsm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem b_buffer, const size_t b_offset, const size_t b_ld,cl_command_queue* queue, cl_event* event)
     CLBlastStatusCode CLBlastZtrsm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem b_buffer, const size_t b_offset, const size_t b_ld,cl_command_queue* queue, cl_event* event)
 
-def trsm(queue, m, n, a, b, a_ld, b_ld, alpha = 1.0, right_side = False, lower_triangle = False, a_transp = False, unit_diagonal = False, a_offset = 0, b_offset = 0):
+def trsm(queue, size_t m, size_t n, a, b, size_t a_ld, size_t b_ld, alpha = 1.0, bint right_side = False, bint lower_triangle = False, bint a_transp = False, bint unit_diagonal = False, size_t a_offset = 0, size_t b_offset = 0, wait_for = None):
     """
     xTRSM: Solves a triangular system of equations
     """
 
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
     dtype = check_dtype([a, b], ["float32", "float64", "complex64", "complex128"])
-    check_matrix(a, "a")
-    check_matrix(b, "b")
 
     cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
     cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    side = CLBlastSideRight if right_side else CLBlastSideLeft
-    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
-    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
-    diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+    cdef CLBlastSide side = CLBlastSideRight if right_side else CLBlastSideLeft
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastDiagonal diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
+    cdef cl_float2 alpha_c
+    cdef cl_double2 alpha_z
 
     cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
     if dtype == np.dtype("float32"):
-        err = CLBlastStrsm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, <cl_float>alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, &command_queue, &event)
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastStrsm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDtrsm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, <cl_double>alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, &command_queue, &event)
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDtrsm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCtrsm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, &command_queue, &event)
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastCtrsm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZtrsm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, &command_queue, &event)
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastZtrsm(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, b_buffer, b_offset + b_element_offset, b_ld, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
     if err != CLBlastSuccess:
@@ -2085,39 +3064,1657 @@ def trsm(queue, m, n, a, b, a_ld, b_ld, alpha = 1.0, right_side = False, lower_t
     return cl.Event.from_int_ptr(<size_t>event)
 
 ####################################################################################################
-# Overrides the parameters
+# Batched version of AXPY: SAXPYBATCHED/DAXPYBATCHED/CAXPYBATCHED/ZAXPYBATCHED/HAXPYBATCHED
 ####################################################################################################
 
-cdef extern from "clblast_c.h":
-    ctypedef struct _cl_device_id:
-        pass
-    ctypedef _cl_device_id* cl_device_id
-    CLBlastStatusCode CLBlastOverrideParameters(const cl_device_id device, const char* kernel_name, const CLBlastPrecision precision, const size_t num_parameters, const char** parameters_names, const size_t* parameters_values)
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSaxpyBatched(const size_t n, const float *alphas, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDaxpyBatched(const size_t n, const double *alphas, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCaxpyBatched(const size_t n, const cl_float2 *alphas, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZaxpyBatched(const size_t n, const cl_double2 *alphas, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
 
-def override_parameters(device, kernel_name, precision, parameters):
+def axpy_batched(queue, size_t n, x, y, alphas, x_offsets, y_offsets, size_t x_inc = 1, size_t y_inc = 1, wait_for = None):
     """
-    Override the current parameters for the given kernel, on this device, with this precision.
+    xAXPYBATCHED: Batched version of AXPY
     """
- 
-    cdef cl_device_id device_id = <cl_device_id><size_t>device.int_ptr
 
-    # read the parameters dictionary into names/values arrays, for use in CLBlastOverrideParameters
-    cdef size_t n = len(parameters)
-    cdef const char **parameter_names = <const char**> PyMem_Malloc(n * sizeof(char*))
-    cdef size_t *parameter_values = <size_t*> PyMem_Malloc(n * sizeof(size_t))
-    if not (parameter_names or parameter_values):
-        raise MemoryError()
-    for i, (k, v) in enumerate(parameters.items()):
-        parameter_names[i] = strdup(k.encode('ascii'))
-        parameter_values[i] = v
-    
-    # call the underlying API
-    err = CLBlastOverrideParameters(device_id, kernel_name.encode('ascii'), precision, n, parameter_names, parameter_values)
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    dtype = check_dtype([x, y], ["float32", "float64", "complex64", "complex128"])
+    cdef size_t batch_count = len(x_offsets)
+    check_batch(alphas, batch_count, "alphas")
+    check_batch(x_offsets, batch_count, "x_offsets")
+    check_batch(y_offsets, batch_count, "y_offsets")
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef size_t i
+    cdef void* alphas_data = PyMem_Malloc(batch_count * sizeof(cl_double2))
+    cdef size_t* x_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))
+    cdef size_t* y_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))
+
+    cdef CLBlastStatusCode err
+    try:
+        if not (alphas_data and x_offsets_data and y_offsets_data):
+            raise MemoryError()
+        for i in range(batch_count):
+            x_offsets_data[i] = x_offsets[i] + x_element_offset
+            y_offsets_data[i] = y_offsets[i] + y_element_offset
+        if wait_for:
+            cl.enqueue_barrier(queue, wait_for=wait_for)
+        if dtype == np.dtype("float32"):
+            for i in range(batch_count):
+                (<cl_float*>alphas_data)[i] = alphas[i]
+            with nogil:
+                err = CLBlastSaxpyBatched(n, <cl_float*>alphas_data, x_buffer, x_offsets_data, x_inc, y_buffer, y_offsets_data, y_inc, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("float64"):
+            for i in range(batch_count):
+                (<cl_double*>alphas_data)[i] = alphas[i]
+            with nogil:
+                err = CLBlastDaxpyBatched(n, <cl_double*>alphas_data, x_buffer, x_offsets_data, x_inc, y_buffer, y_offsets_data, y_inc, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("complex64"):
+            for i in range(batch_count):
+                (<cl_float2*>alphas_data)[i] = cl_float2(x=alphas[i].real, y=alphas[i].imag)
+            with nogil:
+                err = CLBlastCaxpyBatched(n, <cl_float2*>alphas_data, x_buffer, x_offsets_data, x_inc, y_buffer, y_offsets_data, y_inc, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("complex128"):
+            for i in range(batch_count):
+                (<cl_double2*>alphas_data)[i] = cl_double2(x=alphas[i].real, y=alphas[i].imag)
+            with nogil:
+                err = CLBlastZaxpyBatched(n, <cl_double2*>alphas_data, x_buffer, x_offsets_data, x_inc, y_buffer, y_offsets_data, y_inc, batch_count, &command_queue, &event)
+        else:
+            raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    finally:
+        PyMem_Free(alphas_data)
+        PyMem_Free(x_offsets_data)
+        PyMem_Free(y_offsets_data)
     if err != CLBlastSuccess:
-        raise RuntimeError("PyCLBlast: 'OverrideParameters' failed: %s" % get_status_message(err))
+        raise RuntimeError("PyCLBlast: 'CLBlastXaxpyBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
 
-    # tidy up:
-    PyMem_Free(parameter_names)
-    PyMem_Free(parameter_values)
+####################################################################################################
+# Batched version of ROT: SROTBATCHED/DROTBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSrotBatched(const size_t n, cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const float *coss, const float *sins, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDrotBatched(const size_t n, cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const double *coss, const double *sins, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def rot_batched(queue, size_t n, x, y, coss, sins, x_offsets, y_offsets, size_t x_inc = 1, size_t y_inc = 1, wait_for = None):
+    """
+    xROTBATCHED: Batched version of ROT
+    """
+
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    dtype = check_dtype([x, y], ["float32", "float64"])
+    cdef size_t batch_count = len(x_offsets)
+    check_batch(coss, batch_count, "coss")
+    check_batch(sins, batch_count, "sins")
+    check_batch(x_offsets, batch_count, "x_offsets")
+    check_batch(y_offsets, batch_count, "y_offsets")
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef size_t i
+    cdef void* coss_data = PyMem_Malloc(batch_count * sizeof(cl_double2))
+    cdef void* sins_data = PyMem_Malloc(batch_count * sizeof(cl_double2))
+    cdef size_t* x_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))
+    cdef size_t* y_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))
+
+    cdef CLBlastStatusCode err
+    try:
+        if not (coss_data and sins_data and x_offsets_data and y_offsets_data):
+            raise MemoryError()
+        for i in range(batch_count):
+            x_offsets_data[i] = x_offsets[i] + x_element_offset
+            y_offsets_data[i] = y_offsets[i] + y_element_offset
+        if wait_for:
+            cl.enqueue_barrier(queue, wait_for=wait_for)
+        if dtype == np.dtype("float32"):
+            for i in range(batch_count):
+                (<cl_float*>coss_data)[i] = coss[i]
+                (<cl_float*>sins_data)[i] = sins[i]
+            with nogil:
+                err = CLBlastSrotBatched(n, x_buffer, x_offsets_data, x_inc, y_buffer, y_offsets_data, y_inc, <cl_float*>coss_data, <cl_float*>sins_data, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("float64"):
+            for i in range(batch_count):
+                (<cl_double*>coss_data)[i] = coss[i]
+                (<cl_double*>sins_data)[i] = sins[i]
+            with nogil:
+                err = CLBlastDrotBatched(n, x_buffer, x_offsets_data, x_inc, y_buffer, y_offsets_data, y_inc, <cl_double*>coss_data, <cl_double*>sins_data, batch_count, &command_queue, &event)
+        else:
+            raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    finally:
+        PyMem_Free(coss_data)
+        PyMem_Free(sins_data)
+        PyMem_Free(x_offsets_data)
+        PyMem_Free(y_offsets_data)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXrotBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const float *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const float *betas, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const double *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const double *betas, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_float2 *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const cl_float2 *betas, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_double2 *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const cl_double2 *betas, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def gemv_batched(queue, size_t m, size_t n, a, x, y, alphas, betas, size_t a_ld, a_offsets, x_offsets, y_offsets, size_t x_inc = 1, size_t y_inc = 1, bint a_transp = False, wait_for = None):
+    """
+    xGEMVBATCHED: Batched version of GEMV
+    """
+
+    a = check_matrix(a, "a")
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    dtype = check_dtype([a, x, y], ["float32", "float64", "complex64", "complex128"])
+    cdef size_t batch_count = len(a_offsets)
+    check_batch(alphas, batch_count, "alphas")
+    check_batch(betas, batch_count, "betas")
+    check_batch(a_offsets, batch_count, "a_offsets")
+    check_batch(x_offsets, batch_count, "x_offsets")
+    check_batch(y_offsets, batch_count, "y_offsets")
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+
+    cdef size_t i
+    cdef void* alphas_data = PyMem_Malloc(batch_count * sizeof(cl_double2))
+    cdef void* betas_data = PyMem_Malloc(batch_count * sizeof(cl_double2))
+    cdef size_t* a_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))
+    cdef size_t* x_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))
+    cdef size_t* y_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))
+
+    cdef CLBlastStatusCode err
+    try:
+        if not (alphas_data and betas_data and a_offsets_data and x_offsets_data and y_offsets_data):
+            raise MemoryError()
+        for i in range(batch_count):
+            a_offsets_data[i] = a_offsets[i] + a_element_offset
+            x_offsets_data[i] = x_offsets[i] + x_element_offset
+            y_offsets_data[i] = y_offsets[i] + y_element_offset
+        if wait_for:
+            cl.enqueue_barrier(queue, wait_for=wait_for)
+        if dtype == np.dtype("float32"):
+            for i in range(batch_count):
+                (<cl_float*>alphas_data)[i] = alphas[i]
+                (<cl_float*>betas_data)[i] = betas[i]
+            with nogil:
+                err = CLBlastSgemvBatched(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_float*>alphas_data, a_buffer, a_offsets_data, a_ld, x_buffer, x_offsets_data, x_inc, <cl_float*>betas_data, y_buffer, y_offsets_data, y_inc, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("float64"):
+            for i in range(batch_count):
+                (<cl_double*>alphas_data)[i] = alphas[i]
+                (<cl_double*>betas_data)[i] = betas[i]
+            with nogil:
+                err = CLBlastDgemvBatched(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_double*>alphas_data, a_buffer, a_offsets_data, a_ld, x_buffer, x_offsets_data, x_inc, <cl_double*>betas_data, y_buffer, y_offsets_data, y_inc, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("complex64"):
+            for i in range(batch_count):
+                (<cl_float2*>alphas_data)[i] = cl_float2(x=alphas[i].real, y=alphas[i].imag)
+                (<cl_float2*>betas_data)[i] = cl_float2(x=betas[i].real, y=betas[i].imag)
+            with nogil:
+                err = CLBlastCgemvBatched(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_float2*>alphas_data, a_buffer, a_offsets_data, a_ld, x_buffer, x_offsets_data, x_inc, <cl_float2*>betas_data, y_buffer, y_offsets_data, y_inc, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("complex128"):
+            for i in range(batch_count):
+                (<cl_double2*>alphas_data)[i] = cl_double2(x=alphas[i].real, y=alphas[i].imag)
+                (<cl_double2*>betas_data)[i] = cl_double2(x=betas[i].real, y=betas[i].imag)
+            with nogil:
+                err = CLBlastZgemvBatched(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_double2*>alphas_data, a_buffer, a_offsets_data, a_ld, x_buffer, x_offsets_data, x_inc, <cl_double2*>betas_data, y_buffer, y_offsets_data, y_inc, batch_count, &command_queue, &event)
+        else:
+            raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    finally:
+        PyMem_Free(alphas_data)
+        PyMem_Free(betas_data)
+        PyMem_Free(a_offsets_data)
+        PyMem_Free(x_offsets_data)
+        PyMem_Free(y_offsets_data)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXgemvBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const float *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const float *betas, cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const double *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const double *betas, cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_float2 *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const cl_float2 *betas, cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_double2 *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const cl_double2 *betas, cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def gemm_batched(queue, size_t m, size_t n, size_t k, a, b, c, alphas, betas, size_t a_ld, size_t b_ld, size_t c_ld, a_offsets, b_offsets, c_offsets, bint a_transp = False, bint b_transp = False, wait_for = None):
+    """
+    xGEMMBATCHED: Batched version of GEMM
+    """
+
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
+    c = check_matrix(c, "c")
+    dtype = check_dtype([a, b, c], ["float32", "float64", "complex64", "complex128"])
+    cdef size_t batch_count = len(a_offsets)
+    check_batch(alphas, batch_count, "alphas")
+    check_batch(betas, batch_count, "betas")
+    check_batch(a_offsets, batch_count, "a_offsets")
+    check_batch(b_offsets, batch_count, "b_offsets")
+    check_batch(c_offsets, batch_count, "c_offsets")
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
+    cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
+    cdef size_t c_element_offset = element_offset(c)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastTranspose b_transpose = CLBlastTransposeYes if b_transp else CLBlastTransposeNo
+
+    cdef size_t i
+    cdef void* alphas_data = PyMem_Malloc(batch_count * sizeof(cl_double2))
+    cdef void* betas_data = PyMem_Malloc(batch_count * sizeof(cl_double2))
+    cdef size_t* a_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))
+    cdef size_t* b_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))
+    cdef size_t* c_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))
+
+    cdef CLBlastStatusCode err
+    try:
+        if not (alphas_data and betas_data and a_offsets_data and b_offsets_data and c_offsets_data):
+            raise MemoryError()
+        for i in range(batch_count):
+            a_offsets_data[i] = a_offsets[i] + a_element_offset
+            b_offsets_data[i] = b_offsets[i] + b_element_offset
+            c_offsets_data[i] = c_offsets[i] + c_element_offset
+        if wait_for:
+            cl.enqueue_barrier(queue, wait_for=wait_for)
+        if dtype == np.dtype("float32"):
+            for i in range(batch_count):
+                (<cl_float*>alphas_data)[i] = alphas[i]
+                (<cl_float*>betas_data)[i] = betas[i]
+            with nogil:
+                err = CLBlastSgemmBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_float*>alphas_data, a_buffer, a_offsets_data, a_ld, b_buffer, b_offsets_data, b_ld, <cl_float*>betas_data, c_buffer, c_offsets_data, c_ld, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("float64"):
+            for i in range(batch_count):
+                (<cl_double*>alphas_data)[i] = alphas[i]
+                (<cl_double*>betas_data)[i] = betas[i]
+            with nogil:
+                err = CLBlastDgemmBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_double*>alphas_data, a_buffer, a_offsets_data, a_ld, b_buffer, b_offsets_data, b_ld, <cl_double*>betas_data, c_buffer, c_offsets_data, c_ld, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("complex64"):
+            for i in range(batch_count):
+                (<cl_float2*>alphas_data)[i] = cl_float2(x=alphas[i].real, y=alphas[i].imag)
+                (<cl_float2*>betas_data)[i] = cl_float2(x=betas[i].real, y=betas[i].imag)
+            with nogil:
+                err = CLBlastCgemmBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_float2*>alphas_data, a_buffer, a_offsets_data, a_ld, b_buffer, b_offsets_data, b_ld, <cl_float2*>betas_data, c_buffer, c_offsets_data, c_ld, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("complex128"):
+            for i in range(batch_count):
+                (<cl_double2*>alphas_data)[i] = cl_double2(x=alphas[i].real, y=alphas[i].imag)
+                (<cl_double2*>betas_data)[i] = cl_double2(x=betas[i].real, y=betas[i].imag)
+            with nogil:
+                err = CLBlastZgemmBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_double2*>alphas_data, a_buffer, a_offsets_data, a_ld, b_buffer, b_offsets_data, b_ld, <cl_double2*>betas_data, c_buffer, c_offsets_data, c_ld, batch_count, &command_queue, &event)
+        else:
+            raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    finally:
+        PyMem_Free(alphas_data)
+        PyMem_Free(betas_data)
+        PyMem_Free(a_offsets_data)
+        PyMem_Free(b_offsets_data)
+        PyMem_Free(c_offsets_data)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXgemmBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/CGEMMSTRIDEDBATCHED/ZGEMMSTRIDEDBATCHED/HGEMMSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const float beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const double beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const cl_float2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const cl_double2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def gemm_strided_batched(queue, size_t m, size_t n, size_t k, a, b, c, size_t a_ld, size_t b_ld, size_t c_ld, size_t a_stride, size_t b_stride, size_t c_stride, size_t batch_count, alpha = 1.0, beta = 0.0, bint a_transp = False, bint b_transp = False, size_t a_offset = 0, size_t b_offset = 0, size_t c_offset = 0, wait_for = None):
+    """
+    xGEMMSTRIDEDBATCHED: StridedBatched version of GEMM
+    """
+
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
+    c = check_matrix(c, "c")
+    dtype = check_dtype([a, b, c], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
+    cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
+    cdef size_t c_element_offset = element_offset(c)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastTranspose b_transpose = CLBlastTransposeYes if b_transp else CLBlastTransposeNo
+    cdef cl_float alpha_s
+    cdef cl_float beta_s
+    cdef cl_double alpha_d
+    cdef cl_double beta_d
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        alpha_s = alpha
+        beta_s = beta
+        with nogil:
+            err = CLBlastSgemmStridedBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, beta_s, c_buffer, c_offset + c_element_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        alpha_d = alpha
+        beta_d = beta
+        with nogil:
+            err = CLBlastDgemmStridedBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, beta_d, c_buffer, c_offset + c_element_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastCgemmStridedBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, beta_c, c_buffer, c_offset + c_element_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZgemmStridedBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, beta_z, c_buffer, c_offset + c_element_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXgemmStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Batched version of TRSM: STRSMBATCHED/DTRSMBATCHED/CTRSMBATCHED/ZTRSMBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastStrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const float *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const double *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const cl_float2 *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const cl_double2 *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def trsm_batched(queue, size_t m, size_t n, a, b, alphas, size_t a_ld, size_t b_ld, a_offsets, b_offsets, bint right_side = False, bint lower_triangle = False, bint a_transp = False, bint unit_diagonal = False, wait_for = None):
+    """
+    xTRSMBATCHED: Batched version of TRSM
+    """
+
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
+    dtype = check_dtype([a, b], ["float32", "float64", "complex64", "complex128"])
+    cdef size_t batch_count = len(a_offsets)
+    check_batch(alphas, batch_count, "alphas")
+    check_batch(a_offsets, batch_count, "a_offsets")
+    check_batch(b_offsets, batch_count, "b_offsets")
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastSide side = CLBlastSideRight if right_side else CLBlastSideLeft
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastDiagonal diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+
+    cdef size_t i
+    cdef void* alphas_data = PyMem_Malloc(batch_count * sizeof(cl_double2))
+    cdef size_t* a_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))
+    cdef size_t* b_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))
+
+    cdef CLBlastStatusCode err
+    try:
+        if not (alphas_data and a_offsets_data and b_offsets_data):
+            raise MemoryError()
+        for i in range(batch_count):
+            a_offsets_data[i] = a_offsets[i] + a_element_offset
+            b_offsets_data[i] = b_offsets[i] + b_element_offset
+        if wait_for:
+            cl.enqueue_barrier(queue, wait_for=wait_for)
+        if dtype == np.dtype("float32"):
+            for i in range(batch_count):
+                (<cl_float*>alphas_data)[i] = alphas[i]
+            with nogil:
+                err = CLBlastStrsmBatched(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, <cl_float*>alphas_data, a_buffer, a_offsets_data, a_ld, b_buffer, b_offsets_data, b_ld, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("float64"):
+            for i in range(batch_count):
+                (<cl_double*>alphas_data)[i] = alphas[i]
+            with nogil:
+                err = CLBlastDtrsmBatched(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, <cl_double*>alphas_data, a_buffer, a_offsets_data, a_ld, b_buffer, b_offsets_data, b_ld, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("complex64"):
+            for i in range(batch_count):
+                (<cl_float2*>alphas_data)[i] = cl_float2(x=alphas[i].real, y=alphas[i].imag)
+            with nogil:
+                err = CLBlastCtrsmBatched(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, <cl_float2*>alphas_data, a_buffer, a_offsets_data, a_ld, b_buffer, b_offsets_data, b_ld, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("complex128"):
+            for i in range(batch_count):
+                (<cl_double2*>alphas_data)[i] = cl_double2(x=alphas[i].real, y=alphas[i].imag)
+            with nogil:
+                err = CLBlastZtrsmBatched(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, <cl_double2*>alphas_data, a_buffer, a_offsets_data, a_ld, b_buffer, b_offsets_data, b_ld, batch_count, &command_queue, &event)
+        else:
+            raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    finally:
+        PyMem_Free(alphas_data)
+        PyMem_Free(a_offsets_data)
+        PyMem_Free(b_offsets_data)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXtrsmBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of TRSM: STRSMSTRIDEDBATCHED/DTRSMSTRIDEDBATCHED/CTRSMSTRIDEDBATCHED/ZTRSMSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastStrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def trsm_strided_batched(queue, size_t m, size_t n, a, b, size_t a_ld, size_t b_ld, size_t a_stride, size_t b_stride, size_t batch_count, alpha = 1.0, bint right_side = False, bint lower_triangle = False, bint a_transp = False, bint unit_diagonal = False, size_t a_offset = 0, size_t b_offset = 0, wait_for = None):
+    """
+    xTRSMSTRIDEDBATCHED: StridedBatched version of TRSM
+    """
+
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
+    dtype = check_dtype([a, b], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastSide side = CLBlastSideRight if right_side else CLBlastSideLeft
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastDiagonal diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
+    cdef cl_float2 alpha_c
+    cdef cl_double2 alpha_z
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastStrsmStridedBatched(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDtrsmStridedBatched(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastCtrsmStridedBatched(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastZtrsmStridedBatched(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXtrsmStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of SYMM: SSYMMSTRIDEDBATCHED/DSYMMSTRIDEDBATCHED/CSYMMSTRIDEDBATCHED/ZSYMMSTRIDEDBATCHED/HSYMMSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSsymmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const size_t m, const size_t n, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const float beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDsymmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const size_t m, const size_t n, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const double beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCsymmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const cl_float2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZsymmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const cl_double2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def symm_strided_batched(queue, size_t m, size_t n, a, b, c, size_t a_ld, size_t b_ld, size_t c_ld, size_t a_stride, size_t b_stride, size_t c_stride, size_t batch_count, alpha = 1.0, beta = 0.0, bint right_side = False, bint lower_triangle = False, size_t a_offset = 0, size_t b_offset = 0, size_t c_offset = 0, wait_for = None):
+    """
+    xSYMMSTRIDEDBATCHED: StridedBatched version of SYMM
+    """
+
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
+    c = check_matrix(c, "c")
+    dtype = check_dtype([a, b, c], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
+    cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
+    cdef size_t c_element_offset = element_offset(c)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastSide side = CLBlastSideRight if right_side else CLBlastSideLeft
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef cl_float alpha_s
+    cdef cl_float beta_s
+    cdef cl_double alpha_d
+    cdef cl_double beta_d
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        alpha_s = alpha
+        beta_s = beta
+        with nogil:
+            err = CLBlastSsymmStridedBatched(CLBlastLayoutRowMajor, side, triangle, m, n, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, beta_s, c_buffer, c_offset + c_element_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        alpha_d = alpha
+        beta_d = beta
+        with nogil:
+            err = CLBlastDsymmStridedBatched(CLBlastLayoutRowMajor, side, triangle, m, n, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, beta_d, c_buffer, c_offset + c_element_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastCsymmStridedBatched(CLBlastLayoutRowMajor, side, triangle, m, n, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, beta_c, c_buffer, c_offset + c_element_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZsymmStridedBatched(CLBlastLayoutRowMajor, side, triangle, m, n, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, beta_z, c_buffer, c_offset + c_element_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXsymmStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of SYRK: SSYRKSTRIDEDBATCHED/DSYRKSTRIDEDBATCHED/CSYRKSTRIDEDBATCHED/ZSYRKSTRIDEDBATCHED/HSYRKSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const size_t n, const size_t k, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const float beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const size_t n, const size_t k, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const double beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const size_t n, const size_t k, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_float2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZsyrkStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const size_t n, const size_t k, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_double2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def syrk_strided_batched(queue, size_t n, size_t k, a, c, size_t a_ld, size_t c_ld, size_t a_stride, size_t c_stride, size_t batch_count, alpha = 1.0, beta = 0.0, bint lower_triangle = False, bint a_transp = False, size_t a_offset = 0, size_t c_offset = 0, wait_for = None):
+    """
+    xSYRKSTRIDEDBATCHED: StridedBatched version of SYRK
+    """
+
+    a = check_matrix(a, "a")
+    c = check_matrix(c, "c")
+    dtype = check_dtype([a, c], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t c_element_offset = element_offset(c)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef cl_float alpha_s
+    cdef cl_float beta_s
+    cdef cl_double alpha_d
+    cdef cl_double beta_d
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        alpha_s = alpha
+        beta_s = beta
+        with nogil:
+            err = CLBlastSsyrkStridedBatched(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, a_stride, beta_s, c_buffer, c_offset + c_element_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        alpha_d = alpha
+        beta_d = beta
+        with nogil:
+            err = CLBlastDsyrkStridedBatched(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, a_stride, beta_d, c_buffer, c_offset + c_element_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastCsyrkStridedBatched(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, a_stride, beta_c, c_buffer, c_offset + c_element_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZsyrkStridedBatched(CLBlastLayoutRowMajor, triangle, a_transpose, n, k, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, a_stride, beta_z, c_buffer, c_offset + c_element_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXsyrkStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of TRMM: STRMMSTRIDEDBATCHED/DTRMMSTRIDEDBATCHED/CTRMMSTRIDEDBATCHED/ZTRMMSTRIDEDBATCHED/HTRMMSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastStrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDtrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCtrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZtrmmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def trmm_strided_batched(queue, size_t m, size_t n, a, b, size_t a_ld, size_t b_ld, size_t a_stride, size_t b_stride, size_t batch_count, alpha = 1.0, bint right_side = False, bint lower_triangle = False, bint a_transp = False, bint unit_diagonal = False, size_t a_offset = 0, size_t b_offset = 0, wait_for = None):
+    """
+    xTRMMSTRIDEDBATCHED: StridedBatched version of TRMM
+    """
+
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
+    dtype = check_dtype([a, b], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastSide side = CLBlastSideRight if right_side else CLBlastSideLeft
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastDiagonal diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
+    cdef cl_float2 alpha_c
+    cdef cl_double2 alpha_z
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastStrmmStridedBatched(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDtrmmStridedBatched(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastCtrmmStridedBatched(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastZtrmmStridedBatched(CLBlastLayoutRowMajor, side, triangle, a_transpose, diagonal, m, n, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXtrmmStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Batched inversion of triangular matrices: SINVERTBATCHED/DINVERTBATCHED/CINVERTBATCHED/ZINVERTBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSinvertBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDinvertBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCinvertBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZinvertBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def invert_batched(queue, size_t n, a, b, size_t a_ld, size_t b_ld, a_offsets, b_offsets, bint lower_triangle = False, bint unit_diagonal = False, wait_for = None):
+    """
+    xINVERTBATCHED: Batched inversion of triangular matrices
+    """
+
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
+    dtype = check_dtype([a, b], ["float32", "float64", "complex64", "complex128"])
+    cdef size_t batch_count = len(a_offsets)
+    check_batch(a_offsets, batch_count, "a_offsets")
+    check_batch(b_offsets, batch_count, "b_offsets")
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastDiagonal diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+
+    cdef size_t i
+    cdef size_t* a_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))
+    cdef size_t* b_offsets_data = <size_t*> PyMem_Malloc(batch_count * sizeof(size_t))
+
+    cdef CLBlastStatusCode err
+    try:
+        if not (a_offsets_data and b_offsets_data):
+            raise MemoryError()
+        for i in range(batch_count):
+            a_offsets_data[i] = a_offsets[i] + a_element_offset
+            b_offsets_data[i] = b_offsets[i] + b_element_offset
+        if wait_for:
+            cl.enqueue_barrier(queue, wait_for=wait_for)
+        if dtype == np.dtype("float32"):
+            with nogil:
+                err = CLBlastSinvertBatched(CLBlastLayoutRowMajor, triangle, diagonal, n, a_buffer, a_offsets_data, a_ld, b_buffer, b_offsets_data, b_ld, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("float64"):
+            with nogil:
+                err = CLBlastDinvertBatched(CLBlastLayoutRowMajor, triangle, diagonal, n, a_buffer, a_offsets_data, a_ld, b_buffer, b_offsets_data, b_ld, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("complex64"):
+            with nogil:
+                err = CLBlastCinvertBatched(CLBlastLayoutRowMajor, triangle, diagonal, n, a_buffer, a_offsets_data, a_ld, b_buffer, b_offsets_data, b_ld, batch_count, &command_queue, &event)
+        elif dtype == np.dtype("complex128"):
+            with nogil:
+                err = CLBlastZinvertBatched(CLBlastLayoutRowMajor, triangle, diagonal, n, a_buffer, a_offsets_data, a_ld, b_buffer, b_offsets_data, b_ld, batch_count, &command_queue, &event)
+        else:
+            raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    finally:
+        PyMem_Free(a_offsets_data)
+        PyMem_Free(b_offsets_data)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXinvertBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of POTRF: SPOTRFSTRIDEDBATCHED/DPOTRFSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSpotrfStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDpotrfStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def potrf_strided_batched(queue, size_t n, a, size_t a_ld, size_t a_stride, size_t batch_count, bint lower_triangle = False, size_t a_offset = 0, wait_for = None):
+    """
+    xPOTRFSTRIDEDBATCHED: StridedBatched version of POTRF
+    """
+
+    a = check_matrix(a, "a")
+    dtype = check_dtype([a], ["float32", "float64"])
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        with nogil:
+            err = CLBlastSpotrfStridedBatched(CLBlastLayoutRowMajor, triangle, n, a_buffer, a_offset + a_element_offset, a_ld, a_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        with nogil:
+            err = CLBlastDpotrfStridedBatched(CLBlastLayoutRowMajor, triangle, n, a_buffer, a_offset + a_element_offset, a_ld, a_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXpotrfStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const float beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const double beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_float2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_double2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def gemv_strided_batched(queue, size_t m, size_t n, a, x, y, size_t a_ld, size_t a_stride, size_t x_stride, size_t y_stride, size_t batch_count, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, beta = 0.0, bint a_transp = False, size_t a_offset = 0, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
+    """
+    xGEMVSTRIDEDBATCHED: StridedBatched version of GEMV
+    """
+
+    a = check_matrix(a, "a")
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    dtype = check_dtype([a, x, y], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef cl_float alpha_s
+    cdef cl_float beta_s
+    cdef cl_double alpha_d
+    cdef cl_double beta_d
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        alpha_s = alpha
+        beta_s = beta
+        with nogil:
+            err = CLBlastSgemvStridedBatched(CLBlastLayoutRowMajor, a_transpose, m, n, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, a_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, beta_s, y_buffer, y_offset + y_element_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        alpha_d = alpha
+        beta_d = beta
+        with nogil:
+            err = CLBlastDgemvStridedBatched(CLBlastLayoutRowMajor, a_transpose, m, n, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, a_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, beta_d, y_buffer, y_offset + y_element_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastCgemvStridedBatched(CLBlastLayoutRowMajor, a_transpose, m, n, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, a_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, beta_c, y_buffer, y_offset + y_element_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZgemvStridedBatched(CLBlastLayoutRowMajor, a_transpose, m, n, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, a_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, beta_z, y_buffer, y_offset + y_element_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXgemvStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of TRSV: STRSVSTRIDEDBATCHED/DTRSVSTRIDEDBATCHED/CTRSVSTRIDEDBATCHED/ZTRSVSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastStrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def trsv_strided_batched(queue, size_t n, a, x, size_t a_ld, size_t a_stride, size_t x_stride, size_t batch_count, size_t x_inc = 1, bint lower_triangle = False, bint a_transp = False, bint unit_diagonal = False, size_t a_offset = 0, size_t x_offset = 0, wait_for = None):
+    """
+    xTRSVSTRIDEDBATCHED: StridedBatched version of TRSV
+    """
+
+    a = check_matrix(a, "a")
+    x = check_vector(x, "x")
+    dtype = check_dtype([a, x], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t x_element_offset = element_offset(x)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastTriangle triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef CLBlastDiagonal diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        with nogil:
+            err = CLBlastStrsvStridedBatched(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset + a_element_offset, a_ld, a_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        with nogil:
+            err = CLBlastDtrsvStridedBatched(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset + a_element_offset, a_ld, a_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        with nogil:
+            err = CLBlastCtrsvStridedBatched(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset + a_element_offset, a_ld, a_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        with nogil:
+            err = CLBlastZtrsvStridedBatched(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, a_buffer, a_offset + a_element_offset, a_ld, a_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXtrsvStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of OMATCOPY: SOMATCOPYSTRIDEDBATCHED/DOMATCOPYSTRIDEDBATCHED/COMATCOPYSTRIDEDBATCHED/ZOMATCOPYSTRIDEDBATCHED/HOMATCOPYSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastComatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZomatcopyStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def omatcopy_strided_batched(queue, size_t m, size_t n, a, b, size_t a_ld, size_t b_ld, size_t a_stride, size_t b_stride, size_t batch_count, alpha = 1.0, bint a_transp = False, size_t a_offset = 0, size_t b_offset = 0, wait_for = None):
+    """
+    xOMATCOPYSTRIDEDBATCHED: StridedBatched version of OMATCOPY
+    """
+
+    a = check_matrix(a, "a")
+    b = check_matrix(b, "b")
+    dtype = check_dtype([a, b], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
+    cdef size_t a_element_offset = element_offset(a)
+    cdef size_t b_element_offset = element_offset(b)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
+    cdef cl_float2 alpha_c
+    cdef cl_double2 alpha_z
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastSomatcopyStridedBatched(CLBlastLayoutRowMajor, a_transpose, m, n, alpha_s, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDomatcopyStridedBatched(CLBlastLayoutRowMajor, a_transpose, m, n, alpha_d, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastComatcopyStridedBatched(CLBlastLayoutRowMajor, a_transpose, m, n, alpha_c, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastZomatcopyStridedBatched(CLBlastLayoutRowMajor, a_transpose, m, n, alpha_z, a_buffer, a_offset + a_element_offset, a_ld, a_stride, b_buffer, b_offset + b_element_offset, b_ld, b_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXomatcopyStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of IM2COL: SIM2COLSTRIDEDBATCHED/DIM2COLSTRIDEDBATCHED/CIM2COLSTRIDEDBATCHED/ZIM2COLSTRIDEDBATCHED/HIM2COLSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSim2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const cl_mem im_buffer, const size_t im_offset, const size_t im_stride, cl_mem col_buffer, const size_t col_offset, const size_t col_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDim2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const cl_mem im_buffer, const size_t im_offset, const size_t im_stride, cl_mem col_buffer, const size_t col_offset, const size_t col_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCim2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const cl_mem im_buffer, const size_t im_offset, const size_t im_stride, cl_mem col_buffer, const size_t col_offset, const size_t col_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZim2colStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const cl_mem im_buffer, const size_t im_offset, const size_t im_stride, cl_mem col_buffer, const size_t col_offset, const size_t col_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def im2col_strided_batched(queue, size_t channels, size_t height, size_t width, size_t kernel_h, size_t kernel_w, size_t pad_h, size_t pad_w, size_t stride_h, size_t stride_w, size_t dilation_h, size_t dilation_w, im, col, size_t im_stride, size_t col_stride, size_t batch_count, size_t im_offset = 0, size_t col_offset = 0, wait_for = None):
+    """
+    xIM2COLSTRIDEDBATCHED: StridedBatched version of IM2COL
+    """
+
+    im = check_matrix(im, "im")
+    col = check_matrix(col, "col")
+    dtype = check_dtype([im, col], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem im_buffer = <cl_mem><size_t>im.base_data.int_ptr
+    cdef cl_mem col_buffer = <cl_mem><size_t>col.base_data.int_ptr
+    cdef size_t im_element_offset = element_offset(im)
+    cdef size_t col_element_offset = element_offset(col)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        with nogil:
+            err = CLBlastSim2colStridedBatched(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset + im_element_offset, im_stride, col_buffer, col_offset + col_element_offset, col_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        with nogil:
+            err = CLBlastDim2colStridedBatched(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset + im_element_offset, im_stride, col_buffer, col_offset + col_element_offset, col_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        with nogil:
+            err = CLBlastCim2colStridedBatched(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset + im_element_offset, im_stride, col_buffer, col_offset + col_element_offset, col_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        with nogil:
+            err = CLBlastZim2colStridedBatched(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset + im_element_offset, im_stride, col_buffer, col_offset + col_element_offset, col_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXim2colStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of COL2IM: SCOL2IMSTRIDEDBATCHED/DCOL2IMSTRIDEDBATCHED/CCOL2IMSTRIDEDBATCHED/ZCOL2IMSTRIDEDBATCHED/HCOL2IMSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastScol2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const cl_mem col_buffer, const size_t col_offset, const size_t col_stride, cl_mem im_buffer, const size_t im_offset, const size_t im_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDcol2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const cl_mem col_buffer, const size_t col_offset, const size_t col_stride, cl_mem im_buffer, const size_t im_offset, const size_t im_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCcol2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const cl_mem col_buffer, const size_t col_offset, const size_t col_stride, cl_mem im_buffer, const size_t im_offset, const size_t im_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZcol2imStridedBatched(const size_t channels, const size_t height, const size_t width, const size_t kernel_h, const size_t kernel_w, const size_t pad_h, const size_t pad_w, const size_t stride_h, const size_t stride_w, const size_t dilation_h, const size_t dilation_w, const cl_mem col_buffer, const size_t col_offset, const size_t col_stride, cl_mem im_buffer, const size_t im_offset, const size_t im_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def col2im_strided_batched(queue, size_t channels, size_t height, size_t width, size_t kernel_h, size_t kernel_w, size_t pad_h, size_t pad_w, size_t stride_h, size_t stride_w, size_t dilation_h, size_t dilation_w, col, im, size_t col_stride, size_t im_stride, size_t batch_count, size_t col_offset = 0, size_t im_offset = 0, wait_for = None):
+    """
+    xCOL2IMSTRIDEDBATCHED: StridedBatched version of COL2IM
+    """
+
+    col = check_matrix(col, "col")
+    im = check_matrix(im, "im")
+    dtype = check_dtype([col, im], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem col_buffer = <cl_mem><size_t>col.base_data.int_ptr
+    cdef cl_mem im_buffer = <cl_mem><size_t>im.base_data.int_ptr
+    cdef size_t col_element_offset = element_offset(col)
+    cdef size_t im_element_offset = element_offset(im)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        with nogil:
+            err = CLBlastScol2imStridedBatched(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset + col_element_offset, col_stride, im_buffer, im_offset + im_element_offset, im_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        with nogil:
+            err = CLBlastDcol2imStridedBatched(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset + col_element_offset, col_stride, im_buffer, im_offset + im_element_offset, im_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        with nogil:
+            err = CLBlastCcol2imStridedBatched(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset + col_element_offset, col_stride, im_buffer, im_offset + im_element_offset, im_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        with nogil:
+            err = CLBlastZcol2imStridedBatched(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset + col_element_offset, col_stride, im_buffer, im_offset + im_element_offset, im_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXcol2imStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of AXPY: SAXPYSTRIDEDBATCHED/DAXPYSTRIDEDBATCHED/CAXPYSTRIDEDBATCHED/ZAXPYSTRIDEDBATCHED/HAXPYSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSaxpyStridedBatched(const size_t n, const float alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDaxpyStridedBatched(const size_t n, const double alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCaxpyStridedBatched(const size_t n, const cl_float2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZaxpyStridedBatched(const size_t n, const cl_double2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def axpy_strided_batched(queue, size_t n, x, y, size_t x_stride, size_t y_stride, size_t batch_count, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
+    """
+    xAXPYSTRIDEDBATCHED: StridedBatched version of AXPY
+    """
+
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    dtype = check_dtype([x, y], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
+    cdef cl_float2 alpha_c
+    cdef cl_double2 alpha_z
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastSaxpyStridedBatched(n, alpha_s, x_buffer, x_offset + x_element_offset, x_inc, x_stride, y_buffer, y_offset + y_element_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDaxpyStridedBatched(n, alpha_d, x_buffer, x_offset + x_element_offset, x_inc, x_stride, y_buffer, y_offset + y_element_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastCaxpyStridedBatched(n, alpha_c, x_buffer, x_offset + x_element_offset, x_inc, x_stride, y_buffer, y_offset + y_element_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastZaxpyStridedBatched(n, alpha_z, x_buffer, x_offset + x_element_offset, x_inc, x_stride, y_buffer, y_offset + y_element_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXaxpyStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of AXPBY: SAXPBYSTRIDEDBATCHED/DAXPBYSTRIDEDBATCHED/CAXPBYSTRIDEDBATCHED/ZAXPBYSTRIDEDBATCHED/HAXPBYSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSaxpbyStridedBatched(const size_t n, const float alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const float beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDaxpbyStridedBatched(const size_t n, const double alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const double beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCaxpbyStridedBatched(const size_t n, const cl_float2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_float2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZaxpbyStridedBatched(const size_t n, const cl_double2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_double2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def axpby_strided_batched(queue, size_t n, x, y, size_t x_stride, size_t y_stride, size_t batch_count, size_t x_inc = 1, size_t y_inc = 1, alpha = 1.0, beta = 0.0, size_t x_offset = 0, size_t y_offset = 0, wait_for = None):
+    """
+    xAXPBYSTRIDEDBATCHED: StridedBatched version of AXPBY
+    """
+
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    dtype = check_dtype([x, y], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef cl_float alpha_s
+    cdef cl_float beta_s
+    cdef cl_double alpha_d
+    cdef cl_double beta_d
+    cdef cl_float2 alpha_c
+    cdef cl_float2 beta_c
+    cdef cl_double2 alpha_z
+    cdef cl_double2 beta_z
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        alpha_s = alpha
+        beta_s = beta
+        with nogil:
+            err = CLBlastSaxpbyStridedBatched(n, alpha_s, x_buffer, x_offset + x_element_offset, x_inc, x_stride, beta_s, y_buffer, y_offset + y_element_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        alpha_d = alpha
+        beta_d = beta
+        with nogil:
+            err = CLBlastDaxpbyStridedBatched(n, alpha_d, x_buffer, x_offset + x_element_offset, x_inc, x_stride, beta_d, y_buffer, y_offset + y_element_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        beta_c = cl_float2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastCaxpbyStridedBatched(n, alpha_c, x_buffer, x_offset + x_element_offset, x_inc, x_stride, beta_c, y_buffer, y_offset + y_element_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        beta_z = cl_double2(x=beta.real, y=beta.imag)
+        with nogil:
+            err = CLBlastZaxpbyStridedBatched(n, alpha_z, x_buffer, x_offset + x_element_offset, x_inc, x_stride, beta_z, y_buffer, y_offset + y_element_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXaxpbyStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of SET: SSETSTRIDEDBATCHED/DSETSTRIDEDBATCHED/CSETSTRIDEDBATCHED/ZSETSTRIDEDBATCHED/HSETSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSsetStridedBatched(const size_t n, const float alpha, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDsetStridedBatched(const size_t n, const double alpha, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCsetStridedBatched(const size_t n, const cl_float2 alpha, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZsetStridedBatched(const size_t n, const cl_double2 alpha, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def set_strided_batched(queue, size_t n, x, size_t x_stride, size_t batch_count, size_t x_inc = 1, alpha = 1.0, size_t x_offset = 0, wait_for = None):
+    """
+    xSETSTRIDEDBATCHED: StridedBatched version of SET
+    """
+
+    x = check_vector(x, "x")
+    dtype = check_dtype([x], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
+    cdef cl_float2 alpha_c
+    cdef cl_double2 alpha_z
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastSsetStridedBatched(n, alpha_s, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDsetStridedBatched(n, alpha_d, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastCsetStridedBatched(n, alpha_c, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastZsetStridedBatched(n, alpha_z, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXsetStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of SCAL: SSCALSTRIDEDBATCHED/DSCALSTRIDEDBATCHED/CSCALSTRIDEDBATCHED/ZSCALSTRIDEDBATCHED/HSCALSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSscalStridedBatched(const size_t n, const float alpha, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDscalStridedBatched(const size_t n, const double alpha, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCscalStridedBatched(const size_t n, const cl_float2 alpha, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZscalStridedBatched(const size_t n, const cl_double2 alpha, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def scal_strided_batched(queue, size_t n, x, size_t x_stride, size_t batch_count, size_t x_inc = 1, alpha = 1.0, size_t x_offset = 0, wait_for = None):
+    """
+    xSCALSTRIDEDBATCHED: StridedBatched version of SCAL
+    """
+
+    x = check_vector(x, "x")
+    dtype = check_dtype([x], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    cdef cl_float alpha_s
+    cdef cl_double alpha_d
+    cdef cl_float2 alpha_c
+    cdef cl_double2 alpha_z
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        alpha_s = alpha
+        with nogil:
+            err = CLBlastSscalStridedBatched(n, alpha_s, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        alpha_d = alpha
+        with nogil:
+            err = CLBlastDscalStridedBatched(n, alpha_d, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastCscalStridedBatched(n, alpha_c, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+        with nogil:
+            err = CLBlastZscalStridedBatched(n, alpha_z, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXscalStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSdotStridedBatched(const size_t n, cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDdotStridedBatched(const size_t n, cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def dot_strided_batched(queue, size_t n, x, y, dot, size_t x_stride, size_t y_stride, size_t dot_stride, size_t batch_count, size_t x_inc = 1, size_t y_inc = 1, size_t x_offset = 0, size_t y_offset = 0, size_t dot_offset = 0, wait_for = None):
+    """
+    xDOTSTRIDEDBATCHED: StridedBatched version of DOT
+    """
+
+    x = check_vector(x, "x")
+    y = check_vector(y, "y")
+    dot = check_matrix(dot, "dot")
+    dtype = check_dtype([x, y, dot], ["float32", "float64"])
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef cl_mem dot_buffer = <cl_mem><size_t>dot.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t y_element_offset = element_offset(y)
+    cdef size_t dot_element_offset = element_offset(dot)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        with nogil:
+            err = CLBlastSdotStridedBatched(n, dot_buffer, dot_offset + dot_element_offset, dot_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, y_buffer, y_offset + y_element_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        with nogil:
+            err = CLBlastDdotStridedBatched(n, dot_buffer, dot_offset + dot_element_offset, dot_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, y_buffer, y_offset + y_element_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXdotStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of NRM2: SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastScnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDznrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def nrm2_strided_batched(queue, size_t n, x, nrm2, size_t x_stride, size_t nrm2_stride, size_t batch_count, size_t x_inc = 1, size_t x_offset = 0, size_t nrm2_offset = 0, wait_for = None):
+    """
+    xNRM2STRIDEDBATCHED: StridedBatched version of NRM2
+    """
+
+    x = check_vector(x, "x")
+    nrm2 = check_matrix(nrm2, "nrm2")
+    dtype = check_dtype([x, nrm2], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem nrm2_buffer = <cl_mem><size_t>nrm2.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t nrm2_element_offset = element_offset(nrm2)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        with nogil:
+            err = CLBlastSnrm2StridedBatched(n, nrm2_buffer, nrm2_offset + nrm2_element_offset, nrm2_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        with nogil:
+            err = CLBlastDnrm2StridedBatched(n, nrm2_buffer, nrm2_offset + nrm2_element_offset, nrm2_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        with nogil:
+            err = CLBlastScnrm2StridedBatched(n, nrm2_buffer, nrm2_offset + nrm2_element_offset, nrm2_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        with nogil:
+            err = CLBlastDznrm2StridedBatched(n, nrm2_buffer, nrm2_offset + nrm2_element_offset, nrm2_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXnrm2StridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of ASUM: SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastSasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastScasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDzasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def asum_strided_batched(queue, size_t n, x, asum, size_t x_stride, size_t asum_stride, size_t batch_count, size_t x_inc = 1, size_t x_offset = 0, size_t asum_offset = 0, wait_for = None):
+    """
+    xASUMSTRIDEDBATCHED: StridedBatched version of ASUM
+    """
+
+    x = check_vector(x, "x")
+    asum = check_matrix(asum, "asum")
+    dtype = check_dtype([x, asum], ["float32", "float64", "complex64", "complex128"])
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem asum_buffer = <cl_mem><size_t>asum.base_data.int_ptr
+    cdef size_t x_element_offset = element_offset(x)
+    cdef size_t asum_element_offset = element_offset(asum)
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if wait_for:
+        cl.enqueue_barrier(queue, wait_for=wait_for)
+    if dtype == np.dtype("float32"):
+        with nogil:
+            err = CLBlastSasumStridedBatched(n, asum_buffer, asum_offset + asum_element_offset, asum_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        with nogil:
+            err = CLBlastDasumStridedBatched(n, asum_buffer, asum_offset + asum_element_offset, asum_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        with nogil:
+            err = CLBlastScasumStridedBatched(n, asum_buffer, asum_offset + asum_element_offset, asum_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        with nogil:
+            err = CLBlastDzasumStridedBatched(n, asum_buffer, asum_offset + asum_element_offset, asum_stride, x_buffer, x_offset + x_element_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXasumStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Overrides the parameters
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    ctypedef struct _cl_device_id:
+        pass
+    ctypedef _cl_device_id* cl_device_id
+    CLBlastStatusCode CLBlastOverrideParameters(const cl_device_id device, const char* kernel_name, const CLBlastPrecision precision, const size_t num_parameters, const char** parameters_names, const size_t* parameters_values)
+
+def override_parameters(device, kernel_name, precision, parameters):
+    """
+    Override the current parameters for the given kernel, on this device, with this precision.
+    """
+ 
+    cdef cl_device_id device_id = <cl_device_id><size_t>device.int_ptr
+
+    # read the parameters dictionary into names/values arrays, for use in CLBlastOverrideParameters
+    cdef size_t n = len(parameters)
+    cdef const char **parameter_names = <const char**> PyMem_Malloc(n * sizeof(char*))
+    cdef size_t *parameter_values = <size_t*> PyMem_Malloc(n * sizeof(size_t))
+    if not (parameter_names or parameter_values):
+        raise MemoryError()
+    for i, (k, v) in enumerate(parameters.items()):
+        parameter_names[i] = strdup(k.encode('ascii'))
+        parameter_values[i] = v
+    
+    # call the underlying API
+    err = CLBlastOverrideParameters(device_id, kernel_name.encode('ascii'), precision, n, parameter_names, parameter_values)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'OverrideParameters' failed: %s" % get_status_message(err))
+
+    # tidy up:
+    PyMem_Free(parameter_names)
+    PyMem_Free(parameter_values)
+
+####################################################################################################
+# Pre-planned GEMM
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    struct _CLBlastGemmPlan:
+        pass
+    ctypedef _CLBlastGemmPlan* CLBlastGemmPlan
+    CLBlastStatusCode CLBlastSGemmPlanCreate(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const size_t a_offset, const size_t a_ld, const size_t b_offset, const size_t b_ld, const size_t c_offset, const size_t c_ld, cl_command_queue* queue, CLBlastGemmPlan* plan)
+    CLBlastStatusCode CLBlastSGemmPlanExecute(CLBlastGemmPlan plan, const float alpha, const cl_mem a_buffer, const cl_mem b_buffer, const float beta, cl_mem c_buffer, cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastSGemmPlanDestroy(CLBlastGemmPlan plan)
+    CLBlastStatusCode CLBlastDGemmPlanCreate(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const size_t a_offset, const size_t a_ld, const size_t b_offset, const size_t b_ld, const size_t c_offset, const size_t c_ld, cl_command_queue* queue, CLBlastGemmPlan* plan)
+    CLBlastStatusCode CLBlastDGemmPlanExecute(CLBlastGemmPlan plan, const double alpha, const cl_mem a_buffer, const cl_mem b_buffer, const double beta, cl_mem c_buffer, cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDGemmPlanDestroy(CLBlastGemmPlan plan)
+    CLBlastStatusCode CLBlastCGemmPlanCreate(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const size_t a_offset, const size_t a_ld, const size_t b_offset, const size_t b_ld, const size_t c_offset, const size_t c_ld, cl_command_queue* queue, CLBlastGemmPlan* plan)
+    CLBlastStatusCode CLBlastCGemmPlanExecute(CLBlastGemmPlan plan, const cl_float2 alpha, const cl_mem a_buffer, const cl_mem b_buffer, const cl_float2 beta, cl_mem c_buffer, cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCGemmPlanDestroy(CLBlastGemmPlan plan)
+    CLBlastStatusCode CLBlastZGemmPlanCreate(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const size_t a_offset, const size_t a_ld, const size_t b_offset, const size_t b_ld, const size_t c_offset, const size_t c_ld, cl_command_queue* queue, CLBlastGemmPlan* plan)
+    CLBlastStatusCode CLBlastZGemmPlanExecute(CLBlastGemmPlan plan, const cl_double2 alpha, const cl_mem a_buffer, const cl_mem b_buffer, const cl_double2 beta, cl_mem c_buffer, cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZGemmPlanDestroy(CLBlastGemmPlan plan)
+
+cdef class GemmPlan:
+    """
+    A GEMM for repeated calls with a fixed data-type, sizes, leading dimensions, offsets and transposes. All checks
+    and the set-up work (e.g. the kernel selection and the temporary buffer allocation) are done once here, such that
+    'execute' only takes the data and the scalars without any further validation.
+    """
+    cdef CLBlastGemmPlan plan
+    cdef int precision
+    cdef object queue
+    cdef cl_command_queue command_queue
+
+    def __cinit__(self):
+        self.plan = NULL
+
+    def __init__(self, queue, size_t m, size_t n, size_t k, dtype, size_t a_ld, size_t b_ld, size_t c_ld,
+                 bint a_transp = False, bint b_transp = False, size_t a_offset = 0, size_t b_offset = 0,
+                 size_t c_offset = 0):
+        dtypes = [np.dtype(d) for d in ["float32", "float64", "complex64", "complex128"]]
+        if np.dtype(dtype) not in dtypes:
+            raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+        if self.plan != NULL:
+            raise RuntimeError("PyCLBlast: 'GemmPlan' is already initialized")
+
+        cdef int precision = dtypes.index(np.dtype(dtype))
+        cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+        cdef CLBlastTranspose a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+        cdef CLBlastTranspose b_transpose = CLBlastTransposeYes if b_transp else CLBlastTransposeNo
+        cdef CLBlastGemmPlan plan = NULL
+
+        cdef CLBlastStatusCode err
+        with nogil:
+            if precision == 0:
+                err = CLBlastSGemmPlanCreate(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, a_offset, a_ld, b_offset, b_ld, c_offset, c_ld, &command_queue, &plan)
+            elif precision == 1:
+                err = CLBlastDGemmPlanCreate(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, a_offset, a_ld, b_offset, b_ld, c_offset, c_ld, &command_queue, &plan)
+            elif precision == 2:
+                err = CLBlastCGemmPlanCreate(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, a_offset, a_ld, b_offset, b_ld, c_offset, c_ld, &command_queue, &plan)
+            else:
+                err = CLBlastZGemmPlanCreate(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, a_offset, a_ld, b_offset, b_ld, c_offset, c_ld, &command_queue, &plan)
+        if err != CLBlastSuccess:
+            raise RuntimeError("PyCLBlast: 'CLBlastXGemmPlanCreate' failed: %s" % get_status_message(err))
+        self.plan = plan
+        self.precision = precision
+        self.queue = queue
+        self.command_queue = command_queue
+
+    def execute(self, a, b, c, alpha = 1.0, beta = 0.0, wait_for = None):
+        """
+        Computes C = alpha * A * B + beta * C, with A, B and C as given when creating the plan (not checked)
+        """
+        cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+        cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
+        cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+        cdef CLBlastGemmPlan plan = self.plan
+        cdef cl_command_queue command_queue = self.command_queue
+        cdef cl_event event = NULL
+        cdef cl_float alpha_s, beta_s
+        cdef cl_double alpha_d, beta_d
+        cdef cl_float2 alpha_c, beta_c
+        cdef cl_double2 alpha_z, beta_z
+        if plan == NULL:
+            raise RuntimeError("PyCLBlast: 'GemmPlan' is not initialized")
+
+        cdef CLBlastStatusCode err
+        if wait_for:
+            cl.enqueue_barrier(self.queue, wait_for=wait_for)
+        if self.precision == 0:
+            alpha_s = alpha
+            beta_s = beta
+            with nogil:
+                err = CLBlastSGemmPlanExecute(plan, alpha_s, a_buffer, b_buffer, beta_s, c_buffer, &command_queue, &event)
+        elif self.precision == 1:
+            alpha_d = alpha
+            beta_d = beta
+            with nogil:
+                err = CLBlastDGemmPlanExecute(plan, alpha_d, a_buffer, b_buffer, beta_d, c_buffer, &command_queue, &event)
+        elif self.precision == 2:
+            alpha_c = cl_float2(x=alpha.real, y=alpha.imag)
+            beta_c = cl_float2(x=beta.real, y=beta.imag)
+            with nogil:
+                err = CLBlastCGemmPlanExecute(plan, alpha_c, a_buffer, b_buffer, beta_c, c_buffer, &command_queue, &event)
+        else:
+            alpha_z = cl_double2(x=alpha.real, y=alpha.imag)
+            beta_z = cl_double2(x=beta.real, y=beta.imag)
+            with nogil:
+                err = CLBlastZGemmPlanExecute(plan, alpha_z, a_buffer, b_buffer, beta_z, c_buffer, &command_queue, &event)
+        if err != CLBlastSuccess:
+            raise RuntimeError("PyCLBlast: 'CLBlastXGemmPlanExecute' failed: %s" % get_status_message(err))
+        return cl.Event.from_int_ptr(<size_t>event)
+
+    def __dealloc__(self):
+        if self.plan == NULL:
+            return
+        if self.precision == 0:
+            CLBlastSGemmPlanDestroy(self.plan)
+        elif self.precision == 1:
+            CLBlastDGemmPlanDestroy(self.plan)
+        elif self.precision == 2:
+            CLBlastCGemmPlanDestroy(self.plan)
+        else:
+            CLBlastZGemmPlanDestroy(self.plan)
+
+####################################################################################################
+# Kernel cache
+####################################################################################################
+
+cdef extern from "clblast_c.h" nogil:
+    CLBlastStatusCode CLBlastClearCache()
+    CLBlastStatusCode CLBlastFillCache(const cl_device_id device)
+
+def clear_cache():
+    """
+    Clears the cache of compiled binaries, e.g. to free up memory.
+    """
+    err = CLBlastClearCache()
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'ClearCache' failed: %s" % get_status_message(err))
+
+def fill_cache(device):
+    """
+    Compiles all kernels for the given device upfront, such that later calls don't have to.
+    """
+    cdef cl_device_id device_id = <cl_device_id><size_t>device.int_ptr
+    cdef CLBlastStatusCode err
+    with nogil:
+        err = CLBlastFillCache(device_id)
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'FillCache' failed: %s" % get_status_message(err))
 
 ####################################################################################################
@@ -79,3 +79,72 @@ class TestPyCLBlast(unittest.TestCase):
                                     for j in range(n):
                                         self.assertAlmostEqual(reference[i, j], result[i, j],
                                                                places=3)
+
+    def test_gemm_batched(self):
+        for dtype in ["float32", "complex64"]:
+            for batch_count in [1, 3]:
+                m, n, k = 7, 5, 3
+                queue, h, d = self.setup([(batch_count * m, k), (batch_count * k, n),
+                                          (batch_count * m, n)], dtype=dtype)
+                alphas = [1.0 + b for b in range(batch_count)]
+                betas = [0.5] * batch_count
+                pyclblast.gemm_batched(queue, m, n, k, d[0], d[1], d[2], alphas, betas,
+                                       a_ld=k, b_ld=n, c_ld=n,
+                                       a_offsets=[b * m * k for b in range(batch_count)],
+                                       b_offsets=[b * k * n for b in range(batch_count)],
+                                       c_offsets=[b * m * n for b in range(batch_count)])
+                queue.finish()
+                result = d[2].get()
+                for b in range(batch_count):
+                    reference = (alphas[b] * np.dot(h[0][b * m:(b + 1) * m], h[1][b * k:(b + 1) * k]) +
+                                 betas[b] * h[2][b * m:(b + 1) * m])
+                    for i in range(m):
+                        for j in range(n):
+                            self.assertAlmostEqual(reference[i, j], result[b * m + i, j], places=3)
+
+    def test_gemm_strided_batched_wait_for(self):
+        for dtype in ["float32", "complex64"]:
+            batch_count, m, n, k = 3, 7, 5, 3
+            queue, h, d = self.setup([(batch_count * m, k), (batch_count * k, n),
+                                      (batch_count * m, n)], dtype=dtype)
+            event = pyclblast.gemm_strided_batched(queue, m, n, k, d[0], d[1], d[2],
+                                                   a_ld=k, b_ld=n, c_ld=n, a_stride=m * k,
+                                                   b_stride=k * n, c_stride=m * n,
+                                                   batch_count=batch_count)
+            event = pyclblast.gemm_strided_batched(queue, m, n, k, d[0], d[1], d[2],
+                                                   a_ld=k, b_ld=n, c_ld=n, a_stride=m * k,
+                                                   b_stride=k * n, c_stride=m * n,
+                                                   batch_count=batch_count, beta=1.0,
+                                                   wait_for=[event])
+            event.wait()
+            result = d[2].get()
+            for b in range(batch_count):
+                reference = 2.0 * np.dot(h[0][b * m:(b + 1) * m], h[1][b * k:(b + 1) * k])
+                for i in range(m):
+                    for j in range(n):
+                        self.assertAlmostEqual(reference[i, j], result[b * m + i, j], places=3)
+
+    def test_dlpack_host_memory(self):
+        queue, h, d = self.setup([(4,)], dtype="float32")
+        host_array = np.ones(4, dtype="float32")
+        if not hasattr(host_array, "__dlpack__"):
+            self.skipTest("NumPy without DLPack support")
+        with self.assertRaises(ValueError):
+            pyclblast.axpy(queue, 4, host_array, d[0])
+        with self.assertRaises(ValueError):
+            pyclblast.from_dlpack(host_array.__dlpack__())
+
+    def test_gemm_plan(self):
+        for dtype in ["float32", "complex64"]:
+            m, n, k = 7, 5, 3
+            queue, h, d = self.setup([(m, k), (k, n), (m, n)], dtype=dtype)
+            plan = pyclblast.GemmPlan(queue, m, n, k, dtype, a_ld=k, b_ld=n, c_ld=n)
+            for alpha in [1.0, 3.1]:
+                d[2].set(h[2])
+                plan.execute(d[0], d[1], d[2], alpha=alpha, beta=1.0)
+                queue.finish()
+                result = d[2].get()
+                reference = alpha * np.dot(h[0], h[1]) + h[2]
+                for i in range(m):
+                    for j in range(n):
+                        self.assertAlmostEqual(reference[i, j], result[i, j], places=3)
@@ -15,24 +15,107 @@
 #include <vector>
 #include <chrono>
 #include <cstdlib>
+#include <cstring>
+#include <set>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
 
 #include "routine.hpp"
+#ifdef OPENCL_API
+  #include "handle.hpp"
+  #include "profiling.hpp"
+  #include "online_tuning.hpp"
+  #include "tiered_compilation.hpp"
+  #include "warm_up.hpp"
+#endif
 
 namespace clblast {
 // =================================================================================================
 
+namespace {
+
+// Makes sure that a program is not built by multiple threads at the same time (e.g. by the parallel
+// 'FillCache' and by a regular routine call): later threads wait until the first one is done, such
+// that they can take the program from the cache instead of building it again.
+class ProgramBuildGuard {
+ public:
+  explicit ProgramBuildGuard(const ProgramKey &key): key_(key) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this] { return in_flight_.find(key_) == in_flight_.end(); });
+    in_flight_.insert(key_);
+  }
+  ~ProgramBuildGuard() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      in_flight_.erase(key_);
+    }
+    condition_.notify_all();
+  }
+  ProgramBuildGuard(const ProgramBuildGuard &) = delete;
+  ProgramBuildGuard& operator=(const ProgramBuildGuard &) = delete;
+ private:
+  const ProgramKey key_;
+  static std::set<ProgramKey> in_flight_;
+  static std::mutex mutex_;
+  static std::condition_variable condition_;
+};
+std::set<ProgramKey> ProgramBuildGuard::in_flight_;
+std::mutex ProgramBuildGuard::mutex_;
+std::condition_variable ProgramBuildGuard::condition_;
+
+// Prepends the common source to the source of each program
+std::vector<std::vector<KernelSource>> CombineSources(
+    std::initializer_list<KernelSource> common_source,
+    std::initializer_list<std::initializer_list<KernelSource>> program_sources) {
+  auto sources = std::vector<std::vector<KernelSource>>();
+  for (const auto &program_source : program_sources) {
+    auto source = std::vector<KernelSource>(common_source);
+    source.insert(source.end(), program_source.begin(), program_source.end());
+    sources.push_back(source);
+  }
+  return sources;
+}
+
+// The handle through which the routine is called (see 'HandleQueue'), always a nullptr for CUDA
+Handle* TakeHandle(const Queue &queue) {
+  #ifdef OPENCL_API
+    return Handle::TakeActive(queue);
+  #else
+    static_cast<void>(queue);
+    return nullptr;
+  #endif
+}
+
+} // anonymous namespace
+
+// =================================================================================================
+
 // For each kernel this map contains a list of routines it is used in
 const std::vector<std::string> Routine::routines_axpy = {"AXPY", "COPY", "SCAL", "SWAP"};
 const std::vector<std::string> Routine::routines_dot = {"AMAX", "ASUM", "DOT", "DOTC", "DOTU", "MAX", "MIN", "NRM2", "SUM"};
+const std::vector<std::string> Routine::routines_amax = {"AMAX", "AMIN", "MAX", "MIN"};
+const std::vector<std::string> Routine::routines_asum = {"ASUM", "ASUMSTRIDEDBATCHED", "SUM"};
+const std::vector<std::string> Routine::routines_nrm2 = {"NRM2", "NRM2STRIDEDBATCHED"};
 const std::vector<std::string> Routine::routines_ger = {"GER", "GERC", "GERU", "HER", "HER2", "HPR", "HPR2", "SPR", "SPR2", "SYR", "SYR2"};
-const std::vector<std::string> Routine::routines_gemv = {"GBMV", "GEMV", "HBMV", "HEMV", "HPMV", "SBMV", "SPMV", "SYMV", "TMBV", "TPMV", "TRMV", "TRSV"};
+const std::vector<std::string> Routine::routines_gemv = {"GBMV", "GEMV", "HBMV", "HEMV", "HPMV", "SBMV", "SPMV", "SYMV", "TBMV", "TPMV", "TRMV", "TRSV"};
 const std::vector<std::string> Routine::routines_gemm = {"GEMM", "HEMM", "SYMM", "TRMM"};
-const std::vector<std::string> Routine::routines_gemm_syrk = {"GEMM", "HEMM", "HER2K", "HERK", "SYMM", "SYR2K", "SYRK", "TRMM", "TRSM"};
+const std::vector<std::string> Routine::routines_gemm_syrk = {"GEMM", "HEMM", "HER2K", "HERK", "PACKED", "SYMM", "SYR2K", "SYRK", "TRMM", "TRSM"};
+const std::vector<std::string> Routine::routines_gemm_batched = {"GEMMBATCHED", "GEMMSTRIDEDBATCHED"};
 const std::vector<std::string> Routine::routines_trsm = {"TRSM"};
+const std::vector<std::string> Routine::routines_convgemm = {"CONVGEMM"};
+const std::vector<std::string> Routine::routines_im2col = {"IM2COL", "IM2COLSTRIDEDBATCHED"};
+const std::vector<std::string> Routine::routines_csr = {"CSR"};
+const std::vector<std::string> Routine::routines_gemvquantized = {"GEMVQUANTIZED"};
 const std::unordered_map<std::string, const std::vector<std::string>> Routine::routines_by_kernel = {
   {"Xaxpy", routines_axpy},
   {"Xdot", routines_dot},
+  {"Xamax", routines_amax},
+  {"Xasum", routines_asum},
+  {"Xnrm2", routines_nrm2},
   {"Xgemv", routines_gemv},
+  {"XgemvBanded", routines_gemv},
   {"XgemvFast", routines_gemv},
   {"XgemvFastRot", routines_gemv},
   {"Xtrsv", routines_gemv},
@@ -44,102 +127,476 @@ const std::unordered_map<std::string, const std::vector<std::string>> Routine::r
   {"Xgemm", routines_gemm_syrk},
   {"XgemmDirect", routines_gemm},
   {"GemmRoutine", routines_gemm},
+  {"XgemmSkinny", routines_gemm},
+  {"XgemmBatched", routines_gemm_batched},
+  {"XgemmDirectBatched", routines_gemm_batched},
   {"Invert", routines_trsm},
+  {"Xconvgemm", routines_convgemm},
+  {"Xim2col", routines_im2col},
+  {"Xcsr", routines_csr},
+  {"XgemvQuantized", routines_gemvquantized},
 };
 // =================================================================================================
 
+const std::string Routine::kXgemmWithAltKernel = "XgemmWithAlt";
+const std::string Routine::kGenericSuffix = "_generic";
+
+void Routine::InitAlternativeGemmDatabase(const Device &device, const Precision precision,
+                                          const std::vector<database::DatabaseEntry> &userDatabase,
+                                          Databases &db) {
+  const auto max_alt_size = db("GemmRoutine")["XGEMM_MAX_ALT_SIZE"];
+  if (max_alt_size == 0) { return; }
+
+  // Queries the cache to see whether or not the combined database is already there
+  const auto platform_id = device.PlatformID();
+  bool has_db;
+  auto combined_db = DatabaseCache::Instance().Get(DatabaseKeyRef{platform_id, device(), precision,
+                                                                  kXgemmWithAltKernel}, &has_db);
+  if (!has_db) {
+
+    // Retrieves the parameters of the alternative kernel, the ones of 'Xgemm' if it is not tuned
+    const auto alt_kernel_name = std::string{"XgemmAlt"};
+    auto alt_db = DatabaseCache::Instance().Get(DatabaseKeyRef{platform_id, device(), precision,
+                                                               alt_kernel_name}, &has_db);
+    if (!has_db) {
+      log_debug("Searching database for kernel '" + alt_kernel_name + "'");
+      alt_db = Database(device, alt_kernel_name, precision, userDatabase);
+      DatabaseCache::Instance().Store(DatabaseKey{platform_id, device(), precision, alt_kernel_name},
+                                      Database{alt_db});
+    }
+    auto alt_parameters = database::Parameters();
+    for (const auto &parameter_name : alt_db.GetParameterNames()) {
+      alt_parameters[parameter_name] = alt_db[parameter_name];
+    }
+
+    // Combines both and stores the result in the cache
+    combined_db = db("Xgemm").WithSizeVariant(max_alt_size, alt_parameters, alt_db.GetSource());
+    DatabaseCache::Instance().Store(DatabaseKey{platform_id, device(), precision, kXgemmWithAltKernel},
+                                    Database{combined_db});
+  }
+  db("Xgemm") = combined_db;
+}
+
+// =================================================================================================
+
+// Selects the mixed half/single precision for half-precision data if enabled
+Precision Routine::AccumulationPrecision(const Precision precision) {
+  if (precision != Precision::kHalf) { return precision; }
+  const auto mixed_precision = ConvertArgument(std::getenv("CLBLAST_MIXED_PRECISION"), size_t{0});
+  return (mixed_precision != 0) ? Precision::kHalfSingle : Precision::kHalf;
+}
+
+// Selects the storage-only half precision for half-precision data if FP16 is not supported, which
+// is only available in OpenCL (through 'vload_half' and 'vstore_half')
+Precision Routine::HalfStoragePrecision(const Queue &queue, const Precision precision) {
+  if (precision != Precision::kHalf && precision != Precision::kHalfSingle) { return precision; }
+  #ifdef OPENCL_API
+    const auto half_storage = ConvertArgument(std::getenv("CLBLAST_HALF_STORAGE"), size_t{0});
+    if (half_storage != 0 || !PrecisionSupported<half>(queue.GetDevice())) {
+      return Precision::kHalfStorage;
+    }
+  #else
+    static_cast<void>(queue);
+  #endif
+  return precision;
+}
+
+// =================================================================================================
+
 // The constructor does all heavy work, errors are returned as exceptions
 Routine::Routine(Queue &queue, EventPointer event, const std::string &name,
                  const std::vector<std::string> &kernel_names, const Precision precision,
                  const std::vector<database::DatabaseEntry> &userDatabase,
-                 std::initializer_list<const char *> source):
+                 std::initializer_list<KernelSource> source):
+    Routine(queue, event, name, kernel_names, precision, userDatabase, {}, {source}, true) {
+}
+
+// As above, but doesn't compile any of the programs yet unless requested
+Routine::Routine(Queue &queue, EventPointer event, const std::string &name,
+                 const std::vector<std::string> &kernel_names, const Precision precision,
+                 const std::vector<database::DatabaseEntry> &userDatabase,
+                 std::initializer_list<KernelSource> common_source,
+                 std::initializer_list<std::initializer_list<KernelSource>> program_sources,
+                 const bool compile_program):
+    trace_(name, "routine"),
+    statistics_(name),
+    #ifdef OPENCL_API
+      slow_call_(name),
+    #endif
     precision_(precision),
     routine_name_(name),
     kernel_names_(kernel_names),
-    queue_(queue),
+    queue_(SelectPoolQueue(queue)),
     event_(event),
     context_(queue_.GetContext()),
     device_(queue_.GetDevice()),
-    db_(kernel_names) {
+    handle_(TakeHandle(queue)),
+    input_events_(BeginCommandChain(queue_)),
+    db_(kernel_names),
+    sources_(CombineSources(common_source, program_sources)),
+    programs_(sources_.size()),
+    has_programs_(sources_.size(), false) {
 
   InitDatabase(device_, kernel_names, precision, userDatabase, db_);
-  InitProgram(source);
+  #ifdef OPENCL_API
+    if (IsProfilingEnabled()) { SetProfilingRoutine(routine_name_); }
+    if (IsOnlineTuningEnabled()) { NotifyOnlineTuningActivity(); }
+    if (IsTieredCompilationEnabled()) { SelectCompilationTier(); }
+  #endif
+  if (compile_program) { program_ = GetProgram(0); }
+  statistics_.EndSetup();
+}
+
+// Switches to the size-specific parameters, only kernels with such parameters are affected
+void Routine::SelectSizeVariant(const size_t size) {
+  auto changed = false;
+  for (const auto &kernel_name : kernel_names_) {
+    auto &kernel_db = db_(kernel_name);
+    if (!kernel_db.HasSizeVariants()) { continue; }
+    auto selected_db = kernel_db.ForSize(size);
+    if (selected_db.GetFingerprint() != kernel_db.GetFingerprint()) {
+      kernel_db = selected_db;
+      changed = true;
+    }
+  }
+  if (changed) {
+    db_.ResolveFlatParameters();
+    std::fill(has_programs_.begin(), has_programs_.end(), false);
+    if (sources_.size() == 1) { program_ = GetProgram(0); }
+  }
+}
+
+// Returns the cached program or retrieves it (again) from the program cache or by compiling it
+const Program& Routine::GetProgram(const size_t index) {
+  if (!has_programs_[index]) {
+    programs_[index] = InitProgram(index);
+    has_programs_[index] = true;
+  }
+  return programs_[index];
+}
+
+Program Routine::GetSpecialisedProgram(const size_t index, const std::string &extra_defines,
+                                       const std::string &identifier,
+                                       const std::string &build_options) {
+  return InitProgram(index, extra_defines, identifier, build_options);
+}
+
+Program Routine::GetIndex64Program(const size_t index) {
+  return InitProgram(index, "#define INDEX_64BIT 1\n", "_index64");
+}
+
+void Routine::CompilePrograms() {
+  for (auto index = size_t{0}; index < sources_.size(); ++index) {
+    GetProgram(index);
+  }
+}
+
+void Routine::CompileProgram(const size_t index, const std::string &extra_defines,
+                             const std::string &identifier, const std::string &build_options) {
+  if (index >= sources_.size()) {
+    throw BLASError(StatusCode::kInvalidValue, "CompileProgram: invalid program index");
+  }
+  InitProgram(index, extra_defines, identifier, build_options);
+}
+
+// =================================================================================================
+
+Program Routine::InitProgram(const size_t index, const std::string &extra_defines,
+                             const std::string &identifier, const std::string &build_options) {
+
+  // Queries the handle's own cache (if any) and then the global cache to see whether or not the
+  // program (context-specific) is already there
+  const auto all_build_options = WithMathModeOptions(build_options);
+  const auto fingerprint = ProgramFingerprint(index, extra_defines, all_build_options);
+  #ifdef OPENCL_API
+    if (handle_ != nullptr) {
+      auto handle_program = Program();
+      if (handle_->GetProgram(precision_, fingerprint, handle_program)) { return handle_program; }
+    }
+  #endif
+  bool has_program;
+  auto program = ProgramCache::Instance().Get(ProgramKeyRef{ context_(), device_(), precision_, fingerprint },
+                                              &has_program);
+  if (!has_program) {
+
+    // Otherwise retrieves the binary or compiles the program
+    auto request = MakeProgramRequest(index, extra_defines, identifier, fingerprint,
+                                      all_build_options);
+    program = BuildProgram(request);
+  }
+  #ifdef OPENCL_API
+    if (handle_ != nullptr) { handle_->StoreProgram(precision_, fingerprint, program); }
+  #endif
+  return program;
 }
 
-void Routine::InitProgram(std::initializer_list<const char *> source) {
+std::string Routine::WithMathModeOptions(const std::string &build_options) {
+  auto fast_math = false;
+  for (const auto &kernel_name : kernel_names_) {
+    const auto &kernel_db = db_(kernel_name);
+    if (kernel_db.exists("FAST_MATH") && kernel_db["FAST_MATH"] == 1) { fast_math = true; }
+  }
+  #ifdef OPENCL_API
+    const auto math_mode = Handle::GetMathMode(handle_);
+    if (math_mode != MathMode::kDefault) { fast_math = (math_mode == MathMode::kFast); }
+  #endif
+  if (!fast_math || build_options.find(kFastMathOptions) != std::string::npos) {
+    return build_options;
+  }
+  return (build_options.empty()) ? std::string{kFastMathOptions} :
+                                   build_options + " " + kFastMathOptions;
+}
 
-  // Determines the identifier for this particular routine call
-  auto routine_info = routine_name_;
+// Determines the fingerprint of this particular routine call from the routine name, the kernel
+// parameters, the extra defines, and the build options. This doesn't allocate, such that cache hits
+// are cheap.
+uint64_t Routine::ProgramFingerprint(const size_t index, const std::string &extra_defines,
+                                     const std::string &build_options) {
+  const auto environment_variable = std::getenv("CLBLAST_BUILD_OPTIONS");
+  auto fingerprint = Hash(routine_name_);
+  if (sources_.size() > 1) { fingerprint = Hash(static_cast<uint64_t>(index), fingerprint); }
   for (const auto &kernel_name : kernel_names_) {
-    routine_info += "_" + kernel_name + db_(kernel_name).GetValuesString();
+    fingerprint = Hash(db_(kernel_name).GetFingerprint(), fingerprint);
   }
-  log_debug(routine_info);
+  if (!extra_defines.empty()) { fingerprint = Hash(extra_defines, fingerprint); }
+  if (!build_options.empty()) { fingerprint = Hash(build_options, fingerprint); }
+  if (environment_variable != nullptr) {
+    fingerprint = Hash(environment_variable, std::strlen(environment_variable), fingerprint);
+  }
+  return fingerprint;
+}
+
+Routine::ProgramRequest Routine::MakeProgramRequest(const size_t index,
+                                                    const std::string &extra_defines,
+                                                    const std::string &identifier,
+                                                    const uint64_t fingerprint,
+                                                    const std::string &build_options) const {
+  return ProgramRequest{context_, device_, precision_, routine_name_, kernel_names_, db_,
+                        sources_[index], sources_.size() > 1, index, extra_defines, identifier,
+                        fingerprint, build_options};
+}
 
-  // Queries the cache to see whether or not the program (context-specific) is already there
+// Determines the identifier for this particular routine call, used for the binary caches
+std::string Routine::ProgramIdentifier(ProgramRequest &request) {
+  auto routine_info = request.routine_name;
+  for (const auto &kernel_name : request.kernel_names) {
+    routine_info += "_" + kernel_name + request.db(kernel_name).GetValuesString();
+  }
+  if (request.multiple_programs) { routine_info += "_program" + ToString(request.index); }
+  routine_info += request.identifier;
+
+  // The build options (including those of the environmental variable) also change the binary
+  const auto environment_variable = std::getenv("CLBLAST_BUILD_OPTIONS");
+  auto build_options = request.build_options;
+  if (environment_variable != nullptr) { build_options += std::string{"|"} + environment_variable; }
+  if (!build_options.empty()) {
+    routine_info += "_options" + ToString(static_cast<size_t>(Hash(build_options)));
+  }
+  #ifdef CUDA_API
+    routine_info += "_" + GetDeviceArchitecture(request.device); // cubins are specific to the architecture
+  #endif
+  return routine_info;
+}
+
+Program Routine::BuildProgram(ProgramRequest &request) {
+  const auto &context = request.context;
+  const auto &device = request.device;
+  const auto precision = request.precision;
+  const auto fingerprint = request.fingerprint;
+
+  // Waits for any concurrent build of the same program and queries the cache once more
+  const auto trace = TraceScope("InitProgram " + request.routine_name, "compile");
+  const ProgramBuildGuard build_guard(ProgramKey{ context(), device(), precision, fingerprint });
   bool has_program;
-  program_ = ProgramCache::Instance().Get(ProgramKeyRef{ context_(), device_(), precision_, routine_info },
-                                          &has_program);
-  if (has_program) { return; }
+  auto program = ProgramCache::Instance().Get(ProgramKeyRef{ context(), device(), precision, fingerprint },
+                                              &has_program);
+  if (has_program) { return program; }
+
+  const auto routine_info = ProgramIdentifier(request);
+  log_debug(routine_info);
 
   // Sets the build options from an environmental variable (if set)
-  auto options = std::vector<std::string>();
   const auto environment_variable = std::getenv("CLBLAST_BUILD_OPTIONS");
+  auto options = std::vector<std::string>();
   if (environment_variable != nullptr) {
     options.push_back(std::string(environment_variable));
   }
+  if (!request.build_options.empty()) { options.push_back(request.build_options); }
 
   // Queries the cache to see whether or not the binary (device-specific) is already there. If it
   // is, a program is created and stored in the cache
-  const auto device_name = GetDeviceName(device_);
-  const auto platform_id = device_.PlatformID();
+  const auto device_name = GetDeviceName(device);
+  const auto platform_id = device.PlatformID();
   bool has_binary;
-  auto binary = BinaryCache::Instance().Get(BinaryKeyRef{platform_id,  precision_, routine_info, device_name },
+  auto binary = BinaryCache::Instance().Get(BinaryKeyRef{platform_id,  precision, routine_info, device_name },
                                             &has_binary);
   if (has_binary) {
-    program_ = Program(device_, context_, binary);
-    program_.Build(device_, options);
-    ProgramCache::Instance().Store(ProgramKey{ context_(), device_(), precision_, routine_info },
-                                   Program{ program_ });
-    return;
+    const auto start_time = std::chrono::steady_clock::now();
+    program = Program(device, context, binary);
+    program.Build(device, options);
+    const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+    CountBinaryLoad(std::chrono::duration<double,std::milli>(elapsed_time).count());
+    StoreProgram(ProgramKey{ context(), device(), precision, fingerprint }, Program{ program });
+    RecordBuiltProgram(request);
+    return program;
+  }
+
+  // Queries the optional on-disk cache to see whether the binary was compiled before by this or by
+  // another process. A binary that fails to load (e.g. a corrupt file) is simply re-compiled.
+  const auto disk_key = BinaryDiskCache::GetKey(device, precision, routine_info);
+  const auto disk_start_time = std::chrono::steady_clock::now();
+  if (BinaryDiskCache::Instance().Load(disk_key, binary)) {
+    try {
+      program = Program(device, context, binary);
+      program.Build(device, options);
+      const auto elapsed_time = std::chrono::steady_clock::now() - disk_start_time;
+      CountBinaryLoad(std::chrono::duration<double,std::milli>(elapsed_time).count());
+      BinaryCache::Instance().Store(BinaryKey{platform_id, precision, routine_info, device_name},
+                                    std::move(binary));
+      StoreProgram(ProgramKey{ context(), device(), precision, fingerprint }, Program{ program });
+      RecordBuiltProgram(request);
+      return program;
+    } catch (const CLCudaAPIError &) {
+      log_debug("Failed to load the binary from the on-disk cache, re-compiling");
+    }
   }
 
   // Otherwise, the kernel will be compiled and program will be built. Both the binary and the
   // program will be added to the cache.
 
   // Inspects whether or not FP64 is supported in case of double precision
-  if ((precision_ == Precision::kDouble && !PrecisionSupported<double>(device_)) ||
-      (precision_ == Precision::kComplexDouble && !PrecisionSupported<double2>(device_))) {
+  if ((precision == Precision::kDouble && !PrecisionSupported<double>(device)) ||
+      (precision == Precision::kComplexDouble && !PrecisionSupported<double2>(device))) {
     throw RuntimeErrorCode(StatusCode::kNoDoublePrecision);
   }
 
   // As above, but for FP16 (half precision)
-  if (precision_ == Precision::kHalf && !PrecisionSupported<half>(device_)) {
+  if ((precision == Precision::kHalf || precision == Precision::kHalfSingle) &&
+      !PrecisionSupported<half>(device)) {
     throw RuntimeErrorCode(StatusCode::kNoHalfPrecision);
   }
 
   // Collects the parameters for this device in the form of defines
+  const auto source_start_time = std::chrono::steady_clock::now();
   auto source_string = std::string{""};
-  for (const auto &kernel_name : kernel_names_) {
-    source_string += db_(kernel_name).GetDefines();
+  for (const auto &kernel_name : request.kernel_names) {
+    source_string += request.db(kernel_name).GetDefines();
   }
+  source_string += request.extra_defines;
 
   // Adds routine-specific code to the constructed source string
-  for (const char *s: source) {
-    source_string += s;
+  for (const auto source: request.source) {
+    source_string += GetKernelSource(source);
   }
 
-  // Completes the source and compiles the kernel
-  program_ = CompileFromSource(source_string, precision_, routine_name_,
-                               device_, context_, options, 0);
+  // Completes the source and compiles the kernel. The tracing and statistics are done here rather
+  // than in 'CompileFromSource', which is also part of the stand-alone tuners.
+  {
+    const auto trace = TraceScope("CompileFromSource " + request.routine_name, "compile");
+    auto times = CompilationTimes{0.0, 0.0};
+    program = CompileFromSource(source_string, precision, request.routine_name,
+                                device, context, options, 0, false, &times);
+    const auto elapsed_time = std::chrono::steady_clock::now() - source_start_time;
+    const auto milliseconds = std::chrono::duration<double,std::milli>(elapsed_time).count();
+    CountCompilation(milliseconds, milliseconds - times.preprocessing_ms - times.build_ms,
+                     times.preprocessing_ms, times.build_ms);
+  }
+
+
+  // Store the compiled binary and program in the cache (and optionally on disk)
+  const auto compiled_binary = program.GetIR();
+  BinaryDiskCache::Instance().Store(disk_key, compiled_binary);
+  BinaryCache::Instance().Store(BinaryKey{platform_id, precision, routine_info, device_name},
+                                std::string{compiled_binary});
+
+  StoreProgram(ProgramKey{context(), device(), precision, fingerprint}, Program{ program });
+  RecordBuiltProgram(request);
+  return program;
+}
+
+void Routine::RecordBuiltProgram(const ProgramRequest &request) {
+  #ifdef OPENCL_API
+    if (!IsWarmUpEnabled()) { return; }
+    RecordWarmUpProgram(request.device, WarmUpProgram{request.routine_name, request.precision,
+                                                      request.index, request.extra_defines,
+                                                      request.identifier, request.build_options});
+  #else
+    static_cast<void>(request);
+  #endif
+}
+
+// =================================================================================================
 
+#ifdef OPENCL_API
 
-  // Store the compiled binary and program in the cache
-  BinaryCache::Instance().Store(BinaryKey{platform_id, precision_, routine_info, device_name},
-                                program_.GetIR());
+// In tiered mode, a routine of which the tuned programs have to be compiled is served with the
+// generic parameters instead, while the tuned programs are built in the background
+void Routine::SelectCompilationTier() {
 
-  ProgramCache::Instance().Store(ProgramKey{context_(), device_(), precision_, routine_info},
-                                 Program{ program_ });
+  // Nothing changes if all tuned programs can be retrieved from one of the caches
+  const auto device_name = GetDeviceName(device_);
+  const auto platform_id = device_.PlatformID();
+  auto pending = std::vector<ProgramRequest>();
+  for (auto index = size_t{0}; index < sources_.size(); ++index) {
+    const auto build_options = WithMathModeOptions("");
+    const auto fingerprint = ProgramFingerprint(index, "", build_options);
+    bool has_program;
+    ProgramCache::Instance().Get(ProgramKeyRef{ context_(), device_(), precision_, fingerprint },
+                                 &has_program);
+    if (has_program) { continue; }
+    auto request = MakeProgramRequest(index, "", "", fingerprint, build_options);
+    const auto routine_info = ProgramIdentifier(request);
+    bool has_binary;
+    BinaryCache::Instance().Get(BinaryKeyRef{platform_id, precision_, routine_info, device_name},
+                                &has_binary);
+    if (has_binary) { continue; }
+    const auto disk_key = BinaryDiskCache::GetKey(device_, precision_, routine_info);
+    if (BinaryDiskCache::Instance().Contains(disk_key)) { continue; }
+    pending.push_back(std::move(request));
+  }
+  if (pending.empty()) { return; }
+
+  // Retrieves the generic parameters, which are the tuned ones in case the device isn't tuned.
+  // Kernels without generic parameters keep their tuned ones.
+  auto generic_dbs = std::vector<Database>();
+  auto is_tuned = false;
+  for (const auto &kernel_name : kernel_names_) {
+    const auto generic_name = kernel_name + kGenericSuffix;
+    bool has_db;
+    auto generic_db = DatabaseCache::Instance().Get(DatabaseKeyRef{platform_id, device_(), precision_,
+                                                                   generic_name}, &has_db);
+    if (!has_db) {
+      try { generic_db = Database(kernel_name, precision_); }
+      catch (const RuntimeErrorCode &) { generic_db = db_(kernel_name); }
+      DatabaseCache::Instance().Store(DatabaseKey{platform_id, device_(), precision_, generic_name},
+                                      Database{generic_db});
+    }
+    if (generic_db.GetFingerprint() != db_(kernel_name).GetFingerprint()) { is_tuned = true; }
+    generic_dbs.push_back(generic_db);
+  }
+  if (!is_tuned) { return; }
+
+  // Builds the tuned programs in the background, the context is kept alive until they are done
+  CheckError(clRetainContext(context_()));
+  const auto context = std::shared_ptr<cl_context>(new cl_context{context_()}, [](cl_context* c) {
+    CheckErrorDtor(clReleaseContext(*c));
+    delete c;
+  });
+  for (auto &request : pending) {
+    const auto key = ProgramKey{context_(), device_(), precision_, request.fingerprint};
+    const auto shared_request = std::make_shared<ProgramRequest>(std::move(request));
+    BuildInBackground(key, [shared_request, context]() { BuildProgram(*shared_request); });
+  }
+
+  // Serves this call with the generic parameters
+  log_debug("Using the generic parameters for '" + routine_name_ + "' until it is compiled");
+  for (auto i = size_t{0}; i < kernel_names_.size(); ++i) {
+    db_(kernel_names_[i]) = generic_dbs[i];
+  }
+  db_.ResolveFlatParameters();
 }
 
+#endif
+
 // =================================================================================================
 } // namespace clblast
@@ -19,16 +19,28 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <algorithm>
+#include <chrono>
 
 #include "utilities/utilities.hpp"
 #include "cache.hpp"
+#include "kernel_sources.hpp"
+#include "memory_pool.hpp"
+#include "tracing.hpp"
+#include "statistics.hpp"
 #include "utilities/buffer_test.hpp"
 #include "database/database.hpp"
 #include "routines/common.hpp"
+#ifdef OPENCL_API
+  #include "profiling.hpp"
+#endif
 
 namespace clblast {
 // =================================================================================================
 
+// Per-user state of the routine calls through a handle, see 'handle.hpp'
+class Handle;
+
 // See comment at top of file for a description of the class
 class Routine {
  public:
@@ -47,12 +59,46 @@ class Routine {
 
       // Builds the parameter database for this device and routine set and stores it in the cache
       log_debug("Searching database for kernel '" + kernel_name + "'");
+      const auto trace = TraceScope("Database " + kernel_name, "database");
+      const auto start_time = std::chrono::steady_clock::now();
       db(kernel_name) = Database(device, kernel_name, precision, userDatabase);
+      const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+      CountDatabaseSearch(std::chrono::duration<double,std::milli>(elapsed_time).count());
       DatabaseCache::Instance().Store(DatabaseKey{platform_id, device(), precision, kernel_name},
                                       Database{db(kernel_name)});
     }
+    const auto has_kernel = [&kernel_names](const std::string &kernel_name) {
+      return std::find(kernel_names.begin(), kernel_names.end(), kernel_name) != kernel_names.end();
+    };
+    if (has_kernel("Xgemm") && has_kernel("GemmRoutine")) {
+      InitAlternativeGemmDatabase(device, precision, userDatabase, db);
+    }
+    db.ResolveFlatParameters();
   }
 
+  // Adds the parameters of the alternative GEMM kernel ('XgemmAlt', e.g. with the other 'GEMMK'
+  // value) to those of the regular 'Xgemm' kernel as a size variant for problems of at most
+  // 'XGEMM_MAX_ALT_SIZE'. The routine then switches between the two kernels per call.
+  static void InitAlternativeGemmDatabase(const Device &device, const Precision precision,
+                                          const std::vector<database::DatabaseEntry> &userDatabase,
+                                          Databases &db);
+
+  // The name under which the combined databases of the above are cached
+  static const std::string kXgemmWithAltKernel;
+
+  // The suffix of the names under which the generic parameters are cached (see 'Database')
+  static const std::string kGenericSuffix;
+
+  // The precision of the reduction and GEMV kernels: half-precision data is accumulated in single
+  // precision only if the environmental variable CLBLAST_MIXED_PRECISION is set to 1
+  static Precision AccumulationPrecision(const Precision precision);
+
+  // The precision of the routines which support half-precision data on devices without FP16
+  // support (GEMM, GEMV and some level-1 routines): the storage-only half-precision mode computes
+  // in single precision. It can also be enabled by setting the environmental variable
+  // CLBLAST_HALF_STORAGE to 1, e.g. for testing.
+  static Precision HalfStoragePrecision(const Queue &queue, const Precision precision);
+
   // Base class constructor. The user database is an optional extra database to override the
   // built-in database.
   // All heavy preparation work is done inside this constructor.
@@ -61,28 +107,119 @@ class Routine {
   explicit Routine(Queue &queue, EventPointer event, const std::string &name,
                    const std::vector<std::string> &routines, const Precision precision,
                    const std::vector<database::DatabaseEntry> &userDatabase,
-                   std::initializer_list<const char *> source);
+                   std::initializer_list<KernelSource> source);
+
+  // As above, but for routines with multiple programs (e.g. for different code paths). Each program
+  // consists of the common source followed by its own source. Programs are not compiled by the
+  // constructor, but only when first requested through 'GetProgram', unless 'compile_program' is
+  // set: then the first program is compiled into 'program_' as part of the setup.
+  explicit Routine(Queue &queue, EventPointer event, const std::string &name,
+                   const std::vector<std::string> &routines, const Precision precision,
+                   const std::vector<database::DatabaseEntry> &userDatabase,
+                   std::initializer_list<KernelSource> common_source,
+                   std::initializer_list<std::initializer_list<KernelSource>> program_sources,
+                   const bool compile_program = false);
+
+  // Retrieves all programs of the routine from the cache or compiles them, e.g. to fill the cache
+  void CompilePrograms();
+
+  // As above, but only the program with the given index and specialisation (see 'InitProgram'),
+  // e.g. to warm up the caches with a program recorded by an earlier process
+  void CompileProgram(const size_t index, const std::string &extra_defines,
+                      const std::string &identifier, const std::string &build_options);
 
   // List of kernel-routine look-ups
   static const std::vector<std::string> routines_axpy;
   static const std::vector<std::string> routines_dot;
+  static const std::vector<std::string> routines_amax;
+  static const std::vector<std::string> routines_asum;
+  static const std::vector<std::string> routines_nrm2;
   static const std::vector<std::string> routines_ger;
   static const std::vector<std::string> routines_gemv;
   static const std::vector<std::string> routines_gemm;
   static const std::vector<std::string> routines_gemm_syrk;
+  static const std::vector<std::string> routines_gemm_batched;
   static const std::vector<std::string> routines_trsm;
+  static const std::vector<std::string> routines_convgemm;
+  static const std::vector<std::string> routines_im2col;
+  static const std::vector<std::string> routines_csr;
+  static const std::vector<std::string> routines_gemvquantized;
   static const std::unordered_map<std::string, const std::vector<std::string>> routines_by_kernel;
 
  private:
 
-  // Initializes program_, fetching cached program or building one
-  void InitProgram(std::initializer_list<const char *> source);
+  // Fetches the cached program with the given index or builds it. The optional extra defines are
+  // inserted before the kernel source, the identifier distinguishes the resulting binaries. The
+  // optional build options are passed to the compiler in addition to the regular ones.
+  Program InitProgram(const size_t index, const std::string &extra_defines = "",
+                      const std::string &identifier = "", const std::string &build_options = "");
+
+  // Everything needed to build a program, such that it can also be built in the background
+  struct ProgramRequest {
+    Context context;
+    Device device;
+    Precision precision;
+    std::string routine_name;
+    std::vector<std::string> kernel_names;
+    Databases db;
+    std::vector<KernelSource> source;
+    bool multiple_programs;
+    size_t index;
+    std::string extra_defines;
+    std::string identifier;
+    uint64_t fingerprint;
+    std::string build_options;
+  };
+  ProgramRequest MakeProgramRequest(const size_t index, const std::string &extra_defines,
+                                    const std::string &identifier, const uint64_t fingerprint,
+                                    const std::string &build_options = "") const;
+
+  // Adds the compiler options of the math mode (see 'MathMode') to the given build options: those of
+  // the fast mode if it is selected through the handle or globally, or in the default mode by the
+  // 'FAST_MATH' parameter of any of the routine's kernels. Options which already hold those of the
+  // fast mode (e.g. of a recorded program) are returned as they are.
+  std::string WithMathModeOptions(const std::string &build_options);
+
+  // The key of a program in the program cache and its identifier in the binary caches
+  uint64_t ProgramFingerprint(const size_t index, const std::string &extra_defines,
+                              const std::string &build_options = "");
+  static std::string ProgramIdentifier(ProgramRequest &request);
+
+  // Retrieves the program of a request from the binary caches or compiles it, and stores it in the
+  // program cache. This is thread-safe, also with respect to concurrent builds of the same program.
+  static Program BuildProgram(ProgramRequest &request);
+
+  // Records a program which was just built for the profile-guided warm-up, if enabled (see
+  // 'SetWarmUpDirectory')
+  static void RecordBuiltProgram(const ProgramRequest &request);
+
+  // Switches to the generic parameters in tiered mode if the tuned programs are not yet built, see
+  // 'SetTieredCompilation'
+  void SelectCompilationTier();
 
   // Initializes db_, fetching cached database or building one
   void InitDatabase(const std::vector<database::DatabaseEntry> &userDatabase);
 
  protected:
 
+  // The number of elements of the routine's data-type holding the given number of partial sums of
+  // a reduction kernel: twice as many when half-precision data is accumulated in single precision
+  size_t PartialSumsSize(const size_t num_sums) const {
+    const auto single_sums = (precision_ == Precision::kHalfSingle ||
+                              precision_ == Precision::kHalfStorage);
+    return (single_sums) ? 2 * num_sums : num_sums;
+  }
+
+  // Traces and counts the routine call from construction until destruction (see 'CLBLAST_TRACE'
+  // and 'GetStatistics')
+  TraceScope trace_;
+  RoutineStatisticsScope statistics_;
+
+  // Watches the routine call for the slow-call log (see 'SetSlowCallThreshold')
+  #ifdef OPENCL_API
+    SlowCallScope slow_call_;
+  #endif
+
   // Non-static variable for the precision
   const Precision precision_;
 
@@ -96,11 +233,49 @@ class Routine {
   const Context context_;
   const Device device_;
 
-  // Compiled program (either retrieved from cache or compiled in slow path)
+  // The handle the routine is called through (see 'HandleQueue'), or a nullptr
+  Handle* handle_;
+
+  // The events which the routine's first kernels have to wait for, see 'BeginCommandChain'. Kernels
+  // which only depend on the routine's inputs pass this list, such that they can run concurrently on
+  // an out-of-order queue.
+  std::vector<Event> input_events_;
+
+  // Compiled program (either retrieved from cache or compiled in slow path), only for routines with
+  // a single program
   Program program_;
 
+  // Retrieves the program with the given index, for routines with multiple programs. It is fetched
+  // from the cache or compiled when first requested (or after the parameters changed).
+  const Program& GetProgram(const size_t index);
+
+  // As above, but specialised through extra defines (e.g. with compile-time problem sizes) and
+  // optionally extra build options (e.g. a newer OpenCL C standard). These programs are not kept by
+  // the routine, but retrieved from the program cache on each call.
+  Program GetSpecialisedProgram(const size_t index, const std::string &extra_defines,
+                                const std::string &identifier,
+                                const std::string &build_options = "");
+
+  // As 'GetSpecialisedProgram', but with 64-bit instead of 32-bit indices in the kernels which
+  // support it, for buffers of more than 2^31 elements (see 'RequiresIndex64')
+  Program GetIndex64Program(const size_t index);
+
   // Connection to the database for all the device-specific parameters
   Databases db_;
+
+  // Selects the problem-size specific parameters of all kernels (if there are any, see
+  // 'OverrideParametersForSize') for a problem of the given size. If they differ from the current
+  // parameters, the corresponding program is retrieved from the cache or compiled.
+  void SelectSizeVariant(const size_t size);
+
+ private:
+  // The routine-specific kernel sources per program, the actual sources are only retrieved from the
+  // table of embedded sources when a program is built
+  const std::vector<std::vector<KernelSource>> sources_;
+
+  // The programs retrieved so far through 'GetProgram'
+  std::vector<Program> programs_;
+  std::vector<bool> has_programs_;
 };
 
 // =================================================================================================
@@ -11,33 +11,182 @@
 //
 // =================================================================================================
 
+#include <algorithm>
 #include <vector>
+#include <map>
+#include <mutex>
 #include <chrono>
+#include <thread>
+#include <utility>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 
 #include "routines/common.hpp"
+#include "memory_pool.hpp"
+#include "command_graph.hpp"
+#include "tracing.hpp"
+#include "statistics.hpp"
+#ifdef OPENCL_API
+  #include "profiling.hpp"
+  #include "explanation.hpp"
+#endif
 
 namespace clblast {
 // =================================================================================================
 
+#ifdef OPENCL_API
+namespace {
+
+  // Removes the kernel objects of a host thread from the cache when the thread exits, such that
+  // applications which create many short-lived threads don't accumulate kernel objects
+  struct ThreadKernels {
+    ~ThreadKernels() {
+      const auto key = KernelKey{RawProgram{}, std::this_thread::get_id(), std::string{}};
+      KernelCache::Instance().RemoveBySubset<1>(key);
+    }
+  };
+} // anonymous namespace
+#endif
+
+// Retrieves a kernel object from the cache or creates (and caches) it in case it is not present.
+// OpenCL kernel objects are never shared between host threads, so setting their arguments needs no
+// lock. CUDA kernel objects hold their own arguments and are copied out of the cache, so all host
+// threads share a single entry per function.
+Kernel GetKernel(const Program &program, const char* kernel_name) {
+  const PhaseStatisticsScope statistics(RoutinePhase::kKernel);
+  const auto raw_program = program.GetRawProgram();
+  #ifdef OPENCL_API
+    const auto thread_id = std::this_thread::get_id();
+  #else
+    const auto thread_id = std::thread::id();
+  #endif
+  bool has_kernel;
+  auto kernel = KernelCache::Instance().Get(KernelKeyRef{ raw_program, thread_id, kernel_name },
+                                            &has_kernel);
+  if (has_kernel) { return kernel; }
+
+  kernel = Kernel(program, kernel_name);
+  #ifdef OPENCL_API
+    static thread_local ThreadKernels thread_kernels;
+    KernelCache::Instance().Store(KernelKey{ raw_program, thread_id, kernel_name }, Kernel{ kernel });
+  #else
+    try {
+      KernelCache::Instance().Store(KernelKey{ raw_program, thread_id, kernel_name }, Kernel{ kernel });
+    } catch (const LogicError &) { } // stored by another thread in the meantime, which is equivalent
+  #endif
+  return kernel;
+}
+
+// =================================================================================================
+
+#ifdef OPENCL_API
+namespace {
+
+  // The chain of commands of the routine running on an out-of-order queue from this host thread
+  // (see 'BeginCommandChain') and the wait-list provided by the user for the next routine on a queue
+  struct CommandChain {
+    RawCommandQueue queue = nullptr;
+    std::vector<Event> last;
+    RawCommandQueue input_queue = nullptr;
+    std::vector<Event> inputs;
+  };
+  CommandChain& CurrentCommandChain() {
+    static thread_local CommandChain chain;
+    return chain;
+  }
+
+  // Whether the commands enqueued to the queue are part of a command chain
+  bool IsChained(const Queue &queue) {
+    const auto &chain = CurrentCommandChain();
+    return chain.queue != nullptr && chain.queue == queue();
+  }
+} // anonymous namespace
+#endif
+
+// Sets the events the next routine called on the queue from this host thread waits for
+void SetInputEvents(const Queue &queue, std::vector<Event> &&events) {
+  #ifdef OPENCL_API
+    auto &chain = CurrentCommandChain();
+    chain.input_queue = queue();
+    chain.inputs = std::move(events);
+  #else
+    static_cast<void>(queue);
+    static_cast<void>(events);
+  #endif
+}
+
+// Starts the commands of a routine on the queue, see the header for more information
+std::vector<Event> BeginCommandChain(const Queue &queue) {
+  #ifdef OPENCL_API
+    auto &chain = CurrentCommandChain();
+    chain.queue = nullptr;
+    auto inputs = std::vector<Event>();
+    if (chain.input_queue != nullptr && chain.input_queue == queue()) {
+      inputs.swap(chain.inputs);
+      chain.input_queue = nullptr;
+    }
+    if (CommandGraph::IsCapturing(queue)) { return {}; }
+
+    // In-order queues: the commands of the routine are ordered already, only the inputs are awaited
+    if (!queue.IsOutOfOrder()) {
+      for (const auto &input : inputs) { queue.EnqueueWaitForEvent(input); }
+      return {};
+    }
+
+    // Out-of-order queues: without inputs, the routine depends on all previously enqueued commands
+    if (inputs.empty()) {
+      inputs.emplace_back();
+      queue.EnqueueMarker(inputs.back());
+    }
+    chain.queue = queue();
+    chain.last = inputs;
+    return inputs;
+  #else
+    static_cast<void>(queue);
+    return {};
+  #endif
+}
+
+// Returns the event of an intermediate command of a routine, see the header for more information
+EventPointer IntermediateEvent(const Queue &queue, Event &event) {
+  #ifdef OPENCL_API
+    return (IsChained(queue)) ? event.pointer() : nullptr;
+  #else
+    static_cast<void>(queue);
+    static_cast<void>(event);
+    return nullptr;
+  #endif
+}
+
+// =================================================================================================
+
 // Enqueues a kernel, waits for completion, and checks for errors
 void RunKernel(Kernel &kernel, Queue &queue, const Device &device,
-               std::vector<size_t> global, const std::vector<size_t> &local,
+               ThreadRange global, const ThreadRange &local,
                EventPointer event, const std::vector<Event> &waitForEvents) {
+  const auto trace = Tracer::IsEnabled() ? TraceScope(kernel.GetFunctionName(), "launch") :
+                                           TraceScope();
+  const PhaseStatisticsScope statistics(RoutinePhase::kLaunch);
+
+  // The device limits are cached, such that the checks below don't query the runtime
+  const auto limits = GetDeviceLimits(device);
 
   if (!local.empty()) {
     // Tests for validity of the local thread sizes
-    if (local.size() > device.MaxWorkItemDimensions()) {
+    if (local.size() > limits.max_work_item_dimensions ||
+        local.size() > limits.max_work_item_sizes.size()) {
       throw RuntimeErrorCode(StatusCode::kInvalidLocalNumDimensions);
     }
-    const auto max_work_item_sizes = device.MaxWorkItemSizes();
     for (auto i=size_t{0}; i<local.size(); ++i) {
-      if (local[i] > max_work_item_sizes[i]) {
+      if (local[i] > limits.max_work_item_sizes[i]) {
         throw RuntimeErrorCode(StatusCode::kInvalidLocalThreadsDim);
       }
     }
     auto local_size = size_t{1};
     for (auto &item: local) { local_size *= item; }
-    if (local_size > device.MaxWorkGroupSize()) {
+    if (local_size > limits.max_work_group_size) {
       throw RuntimeErrorCode(StatusCode::kInvalidLocalThreadsTotal);
     }
 
@@ -47,12 +196,46 @@ void RunKernel(Kernel &kernel, Queue &queue, const Device &device,
     }
   }
 
-  // Tests for local memory usage
+  // Tests for local memory usage (cached in the kernel object)
   const auto local_mem_usage = kernel.LocalMemUsage(device);
-  if (!device.IsLocalMemoryValid(local_mem_usage)) {
+  if (local_mem_usage > limits.local_mem_size) {
     throw RuntimeErrorCode(StatusCode::kInvalidLocalMemUsage);
   }
 
+  // Records the kernel instead of launching it in case the call is explained (see 'ExplainGemm') or
+  // a command graph is captured on the queue. For CUDA, the latter is done by the CUDA stream
+  // capture itself.
+  #ifdef OPENCL_API
+    if (ExplanationScope::Current() != nullptr) {
+      ExplainKernel(kernel, global, local);
+      return;
+    }
+    if (CommandGraph::IsCapturing(queue)) {
+      CommandGraph::RecordKernel(queue, kernel, global, local, event);
+      return;
+    }
+  #endif
+
+  CountKernelLaunch();
+
+  // On out-of-order queues, a kernel without explicit dependencies waits for the previous command
+  // of the routine. An event is always needed to chain the next command to this kernel.
+  #ifdef OPENCL_API
+    const auto chained = IsChained(queue);
+    auto &chain = CurrentCommandChain();
+    auto chain_event = cl_event{nullptr};
+    const auto own_event = chained && event == nullptr;
+    if (own_event) { event = &chain_event; }
+    const auto &wait_list = (chained && waitForEvents.empty()) ? chain.last : waitForEvents;
+
+    // The profiling hooks read the timing from the kernel's event, so one is created if needed
+    const auto profiling = IsProfilingEnabled();
+    auto profiling_event = cl_event{nullptr};
+    if (profiling && event == nullptr) { event = &profiling_event; }
+  #else
+    const auto &wait_list = waitForEvents;
+  #endif
+
   // Prints the name of the kernel to launch in case of debugging in verbose mode
   #ifdef VERBOSE
     queue.Finish();
@@ -61,7 +244,19 @@ void RunKernel(Kernel &kernel, Queue &queue, const Device &device,
   #endif
 
   // Launches the kernel (and checks for launch errors)
-  kernel.Launch(queue, global, local, event, waitForEvents);
+  kernel.Launch(queue, global, local, event, wait_list);
+  #ifdef OPENCL_API
+    if (profiling) {
+      ProfileKernel(kernel, global, local, *event);
+      if (profiling_event) { CheckError(clReleaseEvent(profiling_event)); }
+    }
+    if (chained) {
+      if (!own_event) { CheckError(clRetainEvent(*event)); }
+      auto last = Event();
+      last() = *event;
+      chain.last = {last};
+    }
+  #endif
 
   // Prints the elapsed execution time in case of debugging in verbose mode
   #ifdef VERBOSE
@@ -72,6 +267,259 @@ void RunKernel(Kernel &kernel, Queue &queue, const Device &device,
   #endif
 }
 
+// Signals the event through a marker, which completes once all earlier commands on the queue and
+// the given events have completed. Nothing is recorded for explained calls or captured graphs.
+void SignalEvent(Queue &queue, EventPointer event, const std::vector<Event> &waitForEvents) {
+  #ifdef OPENCL_API
+    if (ExplanationScope::Current() != nullptr || CommandGraph::IsCapturing(queue)) { return; }
+    for (const auto &wait_event : waitForEvents) { queue.EnqueueWaitForEvent(wait_event); }
+    if (event) { CheckError(clEnqueueMarker(queue(), event)); }
+  #else
+    static_cast<void>(waitForEvents);
+    if (event) {
+      CheckError(cuEventRecord(event->start(), queue()));
+      CheckError(cuEventRecord(event->end(), queue()));
+    }
+  #endif
+}
+
+// Creates the counter of the single-pass reduction kernels and resets it to zero. The reset is
+// enqueued on the same queue as the kernel, such that concurrent calls each use their own counter.
+Buffer<int> ReductionCounter(const Context &context, Queue &queue) {
+  static const int zero = 0;
+  auto counter = TemporaryBuffer<int>(context, queue, 1);
+  #ifdef OPENCL_API
+    if (IsChained(queue)) { // blocking, such that no chained kernel can run before the reset
+      CheckError(clEnqueueWriteBuffer(queue(), counter(), CL_TRUE, 0, sizeof(int), &zero,
+                                      0, nullptr, nullptr));
+      return counter;
+    }
+  #endif
+  counter.WriteAsync(queue, 1, &zero);
+  return counter;
+}
+
+// Creates the zero-initialized flags of the kernels synchronising between work-groups. For OpenCL,
+// the zeros are filled in on the device without blocking the host. In a command chain, the fill
+// waits for the previous commands of the routine and its event is added to 'wait_for_events'.
+Buffer<int> SynchronisationFlags(const Context &context, Queue &queue, const size_t size,
+                                 std::vector<Event> &wait_for_events) {
+  auto flags = TemporaryBuffer<int>(context, queue, size);
+  #ifdef OPENCL_API
+    static const int zero = 0;
+    const auto chained = IsChained(queue);
+    auto wait_list = std::vector<cl_event>();
+    if (chained) {
+      for (const auto &event : CurrentCommandChain().last) {
+        if (event()) { wait_list.push_back(event()); }
+      }
+    }
+    auto fill_event = Event();
+    CheckError(clEnqueueFillBuffer(queue(), flags(), &zero, sizeof(int), 0, size * sizeof(int),
+                                   static_cast<cl_uint>(wait_list.size()),
+                                   (wait_list.empty()) ? nullptr : wait_list.data(),
+                                   (chained) ? fill_event.pointer() : nullptr));
+    if (chained) { wait_for_events.push_back(fill_event); }
+  #else
+    static_cast<void>(wait_for_events);
+    const auto zeros = std::vector<int>(size, 0);
+    flags.Write(queue, size, zeros);
+  #endif
+  return flags;
+}
+
+// =================================================================================================
+
+// Compares the extents against the largest 32-bit index, the environment variable is read once
+bool RequiresIndex64(std::initializer_list<size_t> extents) {
+  static const auto force_index64 = ConvertArgument(std::getenv("CLBLAST_INDEX_64BIT"), size_t{0}) == 1;
+  if (force_index64) { return true; }
+  const auto max_index32 = static_cast<size_t>(std::numeric_limits<int>::max());
+  for (const auto extent : extents) {
+    if (extent > max_index32) { return true; }
+  }
+  return false;
+}
+
+// The default on-device queues per context and device (see 'UseDeviceEnqueue'), in which a null
+// queue marks a device for which it could not be created
+#ifdef OPENCL_API
+namespace {
+  std::mutex device_queues_mutex;
+  std::map<std::pair<RawContext, RawDeviceID>, cl_command_queue> device_queues;
+}
+#endif
+
+// Creates the default on-device queue once, the environment variable is read once
+bool UseDeviceEnqueue(const Context &context, const Device &device) {
+  #ifdef OPENCL_API
+    static const auto enabled = ConvertArgument(std::getenv("CLBLAST_DEVICE_ENQUEUE"), size_t{0}) == 1;
+    if (!enabled) { return false; }
+    std::lock_guard<std::mutex> lock(device_queues_mutex);
+    const auto key = std::make_pair(context(), device());
+    const auto device_queue = device_queues.find(key);
+    if (device_queue != device_queues.end()) { return device_queue->second != nullptr; }
+    auto queue = cl_command_queue{nullptr};
+    if (device.SupportsDeviceEnqueue()) {
+      const cl_queue_properties properties[] = {
+        CL_QUEUE_PROPERTIES,
+        CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE | CL_QUEUE_ON_DEVICE | CL_QUEUE_ON_DEVICE_DEFAULT,
+        0
+      };
+      auto status = CL_SUCCESS;
+      queue = clCreateCommandQueueWithProperties(context(), device(), properties, &status);
+      if (status != CL_SUCCESS) { queue = nullptr; } // e.g. another default queue exists already
+    }
+    device_queues[key] = queue;
+    return queue != nullptr;
+  #else
+    return false;
+  #endif
+}
+
+void ReleaseDeviceQueues(const RawContext context) {
+  #ifdef OPENCL_API
+    std::lock_guard<std::mutex> lock(device_queues_mutex);
+    for (auto device_queue = device_queues.begin(); device_queue != device_queues.end(); ) {
+      if (device_queue->first.first != context) { ++device_queue; continue; }
+      if (device_queue->second != nullptr) { clReleaseCommandQueue(device_queue->second); }
+      device_queue = device_queues.erase(device_queue);
+    }
+  #endif
+}
+
+// =================================================================================================
+
+// The pool queues per context and device (see 'BeginQueuePool'), grown on demand, and the region of
+// independent routine calls of this host thread
+#ifdef OPENCL_API
+namespace {
+  std::mutex pool_queues_mutex;
+  std::map<std::pair<RawContext, RawDeviceID>, std::vector<Queue>> pool_queues;
+
+  struct PoolRegion {
+    RawCommandQueue queue = nullptr;
+    std::vector<Queue> queues;
+    size_t next = 0;
+  };
+  PoolRegion& CurrentPoolRegion() {
+    static thread_local PoolRegion region;
+    return region;
+  }
+} // anonymous namespace
+#endif
+
+// Makes all pool queues wait for a marker of the user's queue
+void BeginQueuePool(const Queue &queue, const size_t num_queues) {
+  #ifdef OPENCL_API
+    if (num_queues == 0) { throw BLASError(StatusCode::kInvalidValue); }
+    auto &region = CurrentPoolRegion();
+    if (region.queue != nullptr) {
+      throw RuntimeErrorCode(StatusCode::kInvalidOperation, "a queue pool region is already active");
+    }
+    const auto context = queue.GetContext();
+    const auto device = queue.GetDevice();
+    auto queues = std::vector<Queue>();
+    {
+      std::lock_guard<std::mutex> lock(pool_queues_mutex);
+      auto &pool = pool_queues[std::make_pair(context(), device())];
+      while (pool.size() < num_queues) { pool.emplace_back(context, device); }
+      queues.assign(pool.begin(), pool.begin() + static_cast<std::ptrdiff_t>(num_queues));
+    }
+    auto start = Event();
+    queue.EnqueueMarker(start);
+    for (const auto &pool_queue : queues) { pool_queue.EnqueueWaitForEvent(start); }
+    region.queue = queue();
+    region.queues = std::move(queues);
+    region.next = 0;
+  #else
+    static_cast<void>(queue);
+    static_cast<void>(num_queues);
+  #endif
+}
+
+// Joins the pool queues through one marker each, only those which were used are waited for
+void EndQueuePool(const Queue &queue, EventPointer event) {
+  #ifdef OPENCL_API
+    auto &region = CurrentPoolRegion();
+    if (region.queue == nullptr || region.queue != queue()) {
+      throw RuntimeErrorCode(StatusCode::kInvalidOperation, "no queue pool region on this queue");
+    }
+    const auto num_used = std::min(region.next, region.queues.size());
+    for (auto i = size_t{0}; i < num_used; ++i) {
+      auto done = Event();
+      region.queues[i].EnqueueMarker(done);
+      queue.EnqueueWaitForEvent(done);
+    }
+    region = PoolRegion();
+    if (event) { CheckError(clEnqueueMarker(queue(), event)); }
+  #else
+    static_cast<void>(queue);
+    static_cast<void>(event);
+  #endif
+}
+
+// Also moves the wait-list of the next routine on the user's queue to the selected pool queue
+Queue SelectPoolQueue(const Queue &queue) {
+  #ifdef OPENCL_API
+    auto &region = CurrentPoolRegion();
+    if (region.queue == nullptr || region.queue != queue()) { return queue; }
+    const auto pool_queue = region.queues[region.next % region.queues.size()];
+    region.next++;
+    auto &chain = CurrentCommandChain();
+    if (chain.input_queue == queue()) { chain.input_queue = pool_queue(); }
+    return pool_queue;
+  #else
+    return queue;
+  #endif
+}
+
+void ReleasePoolQueues(const RawContext context) {
+  #ifdef OPENCL_API
+    std::lock_guard<std::mutex> lock(pool_queues_mutex);
+    for (auto pool = pool_queues.begin(); pool != pool_queues.end(); ) {
+      if (pool->first.first != context) { ++pool; continue; }
+      pool = pool_queues.erase(pool);
+    }
+  #endif
+}
+
+// Sets the argument with the integer type of the kernel's 'index_t'
+void SetIndexArgument(Kernel &kernel, const size_t index, const size_t value, const bool index64) {
+  if (index64) { kernel.SetArgument(index, static_cast<int64_t>(value)); }
+  else { kernel.SetArgument(index, static_cast<int>(value)); }
+}
+
+// Copies the first 'size' elements of a buffer to another one, recorded in case a command graph is
+// captured on the queue
+template <typename T>
+void CopyBuffer(Queue &queue, const Buffer<T> &source, const Buffer<T> &destination, const size_t size) {
+  #ifdef OPENCL_API
+    if (CommandGraph::IsCapturing(queue)) {
+      CommandGraph::RecordCopy(queue, source(), destination(), size * sizeof(T));
+      return;
+    }
+    if (IsChained(queue)) {
+      auto &chain = CurrentCommandChain();
+      auto wait_list = std::vector<cl_event>();
+      for (const auto &event : chain.last) { wait_list.push_back(event()); }
+      auto copy_event = Event();
+      CheckError(clEnqueueCopyBuffer(queue(), source(), destination(), 0, 0, size * sizeof(T),
+                                     static_cast<cl_uint>(wait_list.size()), wait_list.data(),
+                                     copy_event.pointer()));
+      copy_event.WaitForCompletion();
+      chain.last = {copy_event};
+      return;
+    }
+  #endif
+  source.CopyTo(queue, size, destination);
+}
+template void CopyBuffer<half>(Queue&, const Buffer<half>&, const Buffer<half>&, const size_t);
+template void CopyBuffer<float>(Queue&, const Buffer<float>&, const Buffer<float>&, const size_t);
+template void CopyBuffer<double>(Queue&, const Buffer<double>&, const Buffer<double>&, const size_t);
+template void CopyBuffer<float2>(Queue&, const Buffer<float2>&, const Buffer<float2>&, const size_t);
+template void CopyBuffer<double2>(Queue&, const Buffer<double2>&, const Buffer<double2>&, const size_t);
+
 // =================================================================================================
 
 // Sets all elements of a matrix to a constant value
@@ -82,15 +530,15 @@ void FillMatrix(Queue &queue, const Device &device,
                 const size_t m, const size_t n, const size_t ld, const size_t offset,
                 const Buffer<T> &dest,
                 const T constant_value) {
-  auto kernel = Kernel(program, "FillMatrix");
+  auto kernel = GetKernel(program, "FillMatrix");
   kernel.SetArgument(0, static_cast<int>(m));
   kernel.SetArgument(1, static_cast<int>(n));
   kernel.SetArgument(2, static_cast<int>(ld));
   kernel.SetArgument(3, static_cast<int>(offset));
   kernel.SetArgument(4, dest());
   kernel.SetArgument(5, GetRealArg(constant_value));
-  auto local = std::vector<size_t>{16, 1};
-  auto global = std::vector<size_t>{Ceil(m, 16), n};
+  auto local = ThreadRange{16, 1};
+  auto global = ThreadRange{Ceil(m, 16), n};
   RunKernel(kernel, queue, device, global, local, event, waitForEvents);
 }
 
@@ -119,14 +567,14 @@ void FillVector(Queue &queue, const Device &device,
                 const size_t n, const size_t inc, const size_t offset,
                 const Buffer<T> &dest,
                 const T constant_value) {
-  auto kernel = Kernel(program, "FillVector");
+  auto kernel = GetKernel(program, "FillVector");
   kernel.SetArgument(0, static_cast<int>(n));
   kernel.SetArgument(1, static_cast<int>(inc));
   kernel.SetArgument(2, static_cast<int>(offset));
   kernel.SetArgument(3, dest());
   kernel.SetArgument(4, GetRealArg(constant_value));
-  auto local = std::vector<size_t>{16};
-  auto global = std::vector<size_t>{Ceil(n, 16)};
+  auto local = ThreadRange{16};
+  auto global = ThreadRange{Ceil(n, 16)};
   RunKernel(kernel, queue, device, global, local, event, waitForEvents);
 }
 
@@ -147,5 +595,104 @@ template void FillVector<double2>(Queue&, const Device&, const Program&, const D
                                   EventPointer, const std::vector<Event>&, const size_t, const size_t,
                                   const size_t, const Buffer<double2>&, const double2);
 
+// Copies the elements of a (strided) vector into another vector
+template <typename T>
+void CopyVector(Queue &queue, const Device &device,
+                const Program &program, const Databases &,
+                EventPointer event, const std::vector<Event> &waitForEvents,
+                const size_t n,
+                const Buffer<T> &src, const size_t src_offset, const size_t src_inc,
+                const Buffer<T> &dest, const size_t dest_offset, const size_t dest_inc) {
+  auto kernel = GetKernel(program, "CopyVector");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, src());
+  kernel.SetArgument(2, static_cast<int>(src_offset));
+  kernel.SetArgument(3, static_cast<int>(src_inc));
+  kernel.SetArgument(4, dest());
+  kernel.SetArgument(5, static_cast<int>(dest_offset));
+  kernel.SetArgument(6, static_cast<int>(dest_inc));
+  auto local = ThreadRange{16};
+  auto global = ThreadRange{Ceil(n, 16)};
+  RunKernel(kernel, queue, device, global, local, event, waitForEvents);
+}
+
+// Compiles the above function
+template void CopyVector<half>(Queue&, const Device&, const Program&, const Databases&,
+                               EventPointer, const std::vector<Event>&, const size_t,
+                               const Buffer<half>&, const size_t, const size_t,
+                               const Buffer<half>&, const size_t, const size_t);
+template void CopyVector<float>(Queue&, const Device&, const Program&, const Databases&,
+                                EventPointer, const std::vector<Event>&, const size_t,
+                                const Buffer<float>&, const size_t, const size_t,
+                                const Buffer<float>&, const size_t, const size_t);
+template void CopyVector<double>(Queue&, const Device&, const Program&, const Databases&,
+                                 EventPointer, const std::vector<Event>&, const size_t,
+                                 const Buffer<double>&, const size_t, const size_t,
+                                 const Buffer<double>&, const size_t, const size_t);
+template void CopyVector<float2>(Queue&, const Device&, const Program&, const Databases&,
+                                 EventPointer, const std::vector<Event>&, const size_t,
+                                 const Buffer<float2>&, const size_t, const size_t,
+                                 const Buffer<float2>&, const size_t, const size_t);
+template void CopyVector<double2>(Queue&, const Device&, const Program&, const Databases&,
+                                  EventPointer, const std::vector<Event>&, const size_t,
+                                  const Buffer<double2>&, const size_t, const size_t,
+                                  const Buffer<double2>&, const size_t, const size_t);
+
+// Scales (a batch of) matrices by beta, or only signals the event in case there is nothing to do
+template <typename T>
+void ScaleMatrix(Queue &queue, const Device &device,
+                 const Program &program,
+                 EventPointer event, const std::vector<Event> &waitForEvents,
+                 const size_t m, const size_t n, const size_t ld, const size_t offset,
+                 const Buffer<T> &dest, const T beta,
+                 const size_t batch_count, const size_t stride,
+                 const bool upper, const bool lower, const bool diagonal_imag_zero) {
+  if (beta == ConstantOne<T>() && !diagonal_imag_zero) {
+    SignalEvent(queue, event, waitForEvents);
+    return;
+  }
+  auto kernel = GetKernel(program, "ScaleMatrix");
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(ld));
+  kernel.SetArgument(3, static_cast<int>(offset));
+  kernel.SetArgument(4, static_cast<int>(stride));
+  kernel.SetArgument(5, dest());
+  kernel.SetArgument(6, GetRealArg(beta));
+  kernel.SetArgument(7, static_cast<int>(upper));
+  kernel.SetArgument(8, static_cast<int>(lower));
+  kernel.SetArgument(9, static_cast<int>(diagonal_imag_zero));
+  auto local = ThreadRange{16, 1, 1};
+  auto global = ThreadRange{Ceil(m, 16), n, batch_count};
+  RunKernel(kernel, queue, device, global, local, event, waitForEvents);
+}
+
+// Compiles the above function
+template void ScaleMatrix<half>(Queue&, const Device&, const Program&,
+                                EventPointer, const std::vector<Event>&,
+                                const size_t, const size_t, const size_t, const size_t,
+                                const Buffer<half>&, const half,
+                                const size_t, const size_t, const bool, const bool, const bool);
+template void ScaleMatrix<float>(Queue&, const Device&, const Program&,
+                                 EventPointer, const std::vector<Event>&,
+                                 const size_t, const size_t, const size_t, const size_t,
+                                 const Buffer<float>&, const float,
+                                 const size_t, const size_t, const bool, const bool, const bool);
+template void ScaleMatrix<double>(Queue&, const Device&, const Program&,
+                                  EventPointer, const std::vector<Event>&,
+                                  const size_t, const size_t, const size_t, const size_t,
+                                  const Buffer<double>&, const double,
+                                  const size_t, const size_t, const bool, const bool, const bool);
+template void ScaleMatrix<float2>(Queue&, const Device&, const Program&,
+                                  EventPointer, const std::vector<Event>&,
+                                  const size_t, const size_t, const size_t, const size_t,
+                                  const Buffer<float2>&, const float2,
+                                  const size_t, const size_t, const bool, const bool, const bool);
+template void ScaleMatrix<double2>(Queue&, const Device&, const Program&,
+                                   EventPointer, const std::vector<Event>&,
+                                   const size_t, const size_t, const size_t, const size_t,
+                                   const Buffer<double2>&, const double2,
+                                   const size_t, const size_t, const bool, const bool, const bool);
+
 // =================================================================================================
 } // namespace clblast
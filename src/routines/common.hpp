@@ -18,19 +18,106 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
 
 #include "utilities/utilities.hpp"
 #include "utilities/compile.hpp"
 #include "database/database.hpp"
+#include "cache.hpp"
+#include "tracing.hpp"
 
 namespace clblast {
 // =================================================================================================
 
+// Retrieves a kernel object from the cache or creates (and caches) it in case it is not present.
+// Kernels are cached per program and per host thread, since setting arguments is not thread-safe.
+// Looking up a cached kernel by a C-string name doesn't allocate.
+Kernel GetKernel(const Program &program, const char* kernel_name);
+inline Kernel GetKernel(const Program &program, const std::string &kernel_name) {
+  return GetKernel(program, kernel_name.c_str());
+}
+
+// Sets the events the next routine called on the queue from this host thread has to wait for
+void SetInputEvents(const Queue &queue, std::vector<Event> &&events);
+
+// Starts the commands of a routine on the queue and returns the events which its commands without
+// dependencies within the routine have to wait for. On in-order queues, this list is empty. On
+// out-of-order queues, it holds the input events (see 'SetInputEvents') or otherwise a marker of all
+// earlier commands. The routine's kernels launched with an empty wait-list are then chained to the
+// previous command through events, such that only kernels with explicit events can overlap.
+std::vector<Event> BeginCommandChain(const Queue &queue);
+
+// Returns the event to signal by a command which only later commands of the same routine wait for.
+// On in-order queues these commands are ordered already, so no event is created (a null-pointer is
+// returned) and the event is skipped in the wait-lists it is added to. On out-of-order queues, this
+// is the event itself.
+EventPointer IntermediateEvent(const Queue &queue, Event &event);
+
 // Enqueues a kernel, waits for completion, and checks for errors
 void RunKernel(Kernel &kernel, Queue &queue, const Device &device,
-               std::vector<size_t> global, const std::vector<size_t> &local,
+               ThreadRange global, const ThreadRange &local,
                EventPointer event, const std::vector<Event> &waitForEvents = {});
 
+// Completes a call without any work to do, e.g. C = 1 * C: signals the event as a kernel would
+void SignalEvent(Queue &queue, EventPointer event, const std::vector<Event> &waitForEvents = {});
+
+// Creates the zero-initialized counter of the single-pass reduction kernels (see 'IsLastWorkGroup')
+Buffer<int> ReductionCounter(const Context &context, Queue &queue);
+
+// Creates 'size' zero-initialized flags for kernels of which the work-groups wait for each other
+// (see 'trsv_single_pass'). The kernel has to wait for the events added to 'wait_for_events'.
+Buffer<int> SynchronisationFlags(const Context &context, Queue &queue, const size_t size,
+                                 std::vector<Event> &wait_for_events);
+
+// Whether the kernels have to use 64-bit instead of 32-bit integer indices (see 'INDEX_64BIT' in the
+// common kernel code): this is the case if any of the given extents of the buffers (in elements,
+// including the offset) doesn't fit in a 32-bit integer, or if 'CLBLAST_INDEX_64BIT' is set to 1
+bool RequiresIndex64(std::initializer_list<size_t> extents);
+
+// Sets a kernel argument of type 'index_t' as a 32-bit or as a 64-bit integer, depending on which
+// variant of the program the kernel comes from
+void SetIndexArgument(Kernel &kernel, const size_t index, const size_t value, const bool index64);
+
+// Whether a routine may enqueue a sequence of dependent kernels from a parent kernel on the device
+// (OpenCL 2.0 device-side enqueue) rather than from the host: if 'CLBLAST_DEVICE_ENQUEUE' is set to
+// 1 and the device supports it. This creates the default on-device queue of the context and device
+// on first use, which is kept until 'ReleaseDeviceQueues'. Always false for CUDA.
+bool UseDeviceEnqueue(const Context &context, const Device &device);
+
+// Releases the on-device queues of a context created by 'UseDeviceEnqueue'
+void ReleaseDeviceQueues(const RawContext context);
+
+// Starts a region of independent routine calls on the queue from this host thread: the routines are
+// spread round-robin over 'num_queues' in-order queues of the queue's context and device, owned by
+// CLBlast, such that their kernels can run concurrently. The pool queues first wait for all commands
+// enqueued to the queue so far. Always a no-op for CUDA.
+void BeginQueuePool(const Queue &queue, const size_t num_queues);
+
+// Ends the region of the queue: the queue waits for all commands enqueued to the pool queues
+void EndQueuePool(const Queue &queue, EventPointer event);
+
+// Returns the queue on which a routine called on 'queue' runs: the next pool queue within a region
+// on that queue (see 'BeginQueuePool'), and otherwise the queue itself
+Queue SelectPoolQueue(const Queue &queue);
+
+// Releases the pool queues of a context created by 'BeginQueuePool'
+void ReleasePoolQueues(const RawContext context);
+
+// Copies the first 'size' elements of a buffer to another one (blocking), or records the copy in
+// case a command graph is captured on the queue
+template <typename T>
+void CopyBuffer(Queue &queue, const Buffer<T> &source, const Buffer<T> &destination, const size_t size);
+
+// The scalars alpha and beta of the routines which read them from device buffers in their kernels
+// instead of taking them by value (see e.g. 'GemvDevice' in clblast.h)
+template <typename T>
+struct DeviceScalars {
+  Buffer<T> alpha_buffer;
+  size_t alpha_offset;
+  Buffer<T> beta_buffer;
+  size_t beta_offset;
+};
+
 // =================================================================================================
 
 // Sets all elements of a matrix to a constant value
@@ -51,11 +138,35 @@ void FillVector(Queue &queue, const Device &device,
                 const Buffer<T> &dest,
                 const T constant_value);
 
+// Copies the elements of a (strided) vector into another vector
+template <typename T>
+void CopyVector(Queue &queue, const Device &device,
+                const Program &program, const Databases &,
+                EventPointer event, const std::vector<Event> &waitForEvents,
+                const size_t n,
+                const Buffer<T> &src, const size_t src_offset, const size_t src_inc,
+                const Buffer<T> &dest, const size_t dest_offset, const size_t dest_inc);
+
+// Computes C = beta * C for routines of which the alpha-term vanishes (alpha of zero), such that A
+// and B are not read. A beta of zero sets C to zero without reading it, and a beta of one only
+// signals the event. Optionally restricted to the upper or lower triangle (of the column-major
+// view of C), and applied to 'batch_count' matrices 'stride' elements apart.
+template <typename T>
+void ScaleMatrix(Queue &queue, const Device &device,
+                 const Program &program,
+                 EventPointer event, const std::vector<Event> &waitForEvents,
+                 const size_t m, const size_t n, const size_t ld, const size_t offset,
+                 const Buffer<T> &dest, const T beta,
+                 const size_t batch_count = 1, const size_t stride = 0,
+                 const bool upper = false, const bool lower = false,
+                 const bool diagonal_imag_zero = false);
+
 // =================================================================================================
 
 // Copies or transposes a matrix and optionally pads/unpads it with zeros. This method is also able
-// to write to symmetric and triangular matrices through optional arguments.
-template <typename T>
+// to write to symmetric and triangular matrices through optional arguments. The destination can be
+// of a different type than the source if the program is compiled for it (see 'DEST_PRECISION').
+template <typename T, typename D = T>
 void PadCopyTransposeMatrix(Queue &queue, const Device &device,
                             const Databases &db,
                             EventPointer event, const std::vector<Event> &waitForEvents,
@@ -64,12 +175,13 @@ void PadCopyTransposeMatrix(Queue &queue, const Device &device,
                             const Buffer<T> &src,
                             const size_t dest_one, const size_t dest_two,
                             const size_t dest_ld, const size_t dest_offset,
-                            const Buffer<T> &dest,
+                            const Buffer<D> &dest,
                             const T alpha,
                             const Program &program, const bool do_pad,
                             const bool do_transpose, const bool do_conjugate,
                             const bool upper = false, const bool lower = false,
                             const bool diagonal_imag_zero = false) {
+  const auto trace = TraceScope("PadCopyTransposeMatrix", "routine");
 
   // Determines whether or not the fast-version could potentially be used
   auto use_fast_kernel = (src_offset == 0) && (dest_offset == 0) && (do_conjugate == false) &&
@@ -77,7 +189,7 @@ void PadCopyTransposeMatrix(Queue &queue, const Device &device,
                          (upper == false) && (lower == false) && (diagonal_imag_zero == false);
 
   // Determines the right kernel
-  auto kernel_name = std::string{};
+  const char* kernel_name = nullptr;
   if (do_transpose) {
     if (use_fast_kernel &&
         IsMultiple(src_ld, db["TRA_WPT"]) &&
@@ -104,7 +216,7 @@ void PadCopyTransposeMatrix(Queue &queue, const Device &device,
   }
 
   // Retrieves the kernel from the compiled binary
-  auto kernel = Kernel(program, kernel_name);
+  auto kernel = GetKernel(program, kernel_name);
 
   // Sets the kernel arguments
   if (use_fast_kernel) {
@@ -139,42 +251,98 @@ void PadCopyTransposeMatrix(Queue &queue, const Device &device,
   // parameters in the database.
   if (do_transpose) {
     if (use_fast_kernel) {
-      const auto global = std::vector<size_t>{
+      const auto global = ThreadRange{
         dest_one / db["TRA_WPT"],
         dest_two / db["TRA_WPT"]
       };
-      const auto local = std::vector<size_t>{db["TRA_DIM"], db["TRA_DIM"]};
+      const auto local = ThreadRange{db["TRA_DIM"], db["TRA_DIM"]};
       RunKernel(kernel, queue, device, global, local, event, waitForEvents);
     }
     else {
-      const auto global = std::vector<size_t>{
+      const auto global = ThreadRange{
         Ceil(CeilDiv(dest_one, db["PADTRA_WPT"]), db["PADTRA_TILE"]),
         Ceil(CeilDiv(dest_two, db["PADTRA_WPT"]), db["PADTRA_TILE"])
       };
-      const auto local = std::vector<size_t>{db["PADTRA_TILE"], db["PADTRA_TILE"]};
+      const auto local = ThreadRange{db["PADTRA_TILE"], db["PADTRA_TILE"]};
       RunKernel(kernel, queue, device, global, local, event, waitForEvents);
     }
   }
   else {
     if (use_fast_kernel) {
-      const auto global = std::vector<size_t>{
+      const auto global = ThreadRange{
         dest_one / db["COPY_VW"],
         dest_two / db["COPY_WPT"]
       };
-      const auto local = std::vector<size_t>{db["COPY_DIMX"], db["COPY_DIMY"]};
+      const auto local = ThreadRange{db["COPY_DIMX"], db["COPY_DIMY"]};
       RunKernel(kernel, queue, device, global, local, event, waitForEvents);
     }
     else {
-      const auto global = std::vector<size_t>{
+      const auto global = ThreadRange{
         Ceil(CeilDiv(dest_one, db["PAD_WPTX"]), db["PAD_DIMX"]),
         Ceil(CeilDiv(dest_two, db["PAD_WPTY"]), db["PAD_DIMY"])
       };
-      const auto local = std::vector<size_t>{db["PAD_DIMX"], db["PAD_DIMY"]};
+      const auto local = ThreadRange{db["PAD_DIMX"], db["PAD_DIMY"]};
       RunKernel(kernel, queue, device, global, local, event, waitForEvents);
     }
   }
 }
 
+// A single matrix to pre-process by 'PadCopyTransposeMatrices' into the shared destination buffer
+template <typename T>
+struct PadCopyTransposeJob {
+  size_t src_one;
+  size_t src_two;
+  size_t src_ld;
+  size_t src_offset;
+  Buffer<T> src;
+  size_t dest_one;
+  size_t dest_two;
+  size_t dest_offset;
+  bool do_transpose;
+  bool do_conjugate;
+};
+
+// Copies or transposes up to three matrices into a single destination buffer and pads them with
+// zeros, as 'PadCopyTransposeMatrix' does for one, but with a single kernel launch. Each matrix is
+// handled by its own range of work-groups, all of them tuned by the 'Padtranspose' parameters.
+template <typename T>
+void PadCopyTransposeMatrices(Queue &queue, const Device &device,
+                              const Databases &db,
+                              EventPointer event, const std::vector<Event> &waitForEvents,
+                              const std::vector<PadCopyTransposeJob<T>> &jobs,
+                              const Buffer<T> &dest,
+                              const Program &program) {
+  const auto trace = TraceScope("PadCopyTransposeMatrices", "routine");
+  if (jobs.empty() || jobs.size() > 3) { throw BLASError(StatusCode::kUnexpectedError); }
+
+  // Sets the kernel arguments, the arguments of unused matrices are never read
+  auto kernel = GetKernel(program, "PadTransposeMatrices");
+  kernel.SetArgument(0, dest());
+  auto global_one = size_t{0};
+  auto global_two = size_t{0};
+  for (auto i = size_t{0}; i < 3; ++i) {
+    const auto &job = jobs[std::min(i, jobs.size() - 1)];
+    const auto index = 1 + 10 * i;
+    kernel.SetArgument(index + 0, static_cast<int>(job.src_one));
+    kernel.SetArgument(index + 1, static_cast<int>(job.src_two));
+    kernel.SetArgument(index + 2, static_cast<int>(job.src_ld));
+    kernel.SetArgument(index + 3, static_cast<int>(job.src_offset));
+    kernel.SetArgument(index + 4, job.src());
+    kernel.SetArgument(index + 5, static_cast<int>(job.dest_one));
+    kernel.SetArgument(index + 6, static_cast<int>(job.dest_two));
+    kernel.SetArgument(index + 7, static_cast<int>(job.dest_offset));
+    kernel.SetArgument(index + 8, static_cast<int>(job.do_transpose));
+    kernel.SetArgument(index + 9, static_cast<int>(job.do_conjugate));
+    global_one = std::max(global_one, Ceil(CeilDiv(job.dest_one, db["PADTRA_WPT"]), db["PADTRA_TILE"]));
+    global_two = std::max(global_two, Ceil(CeilDiv(job.dest_two, db["PADTRA_WPT"]), db["PADTRA_TILE"]));
+  }
+
+  // Launches the kernel: the largest matrix determines the work-groups per matrix
+  const auto global = ThreadRange{global_one, global_two, jobs.size()};
+  const auto local = ThreadRange{db["PADTRA_TILE"], db["PADTRA_TILE"], 1};
+  RunKernel(kernel, queue, device, global, local, event, waitForEvents);
+}
+
 // Batched version of the above
 template <typename T>
 void PadCopyTransposeMatrixBatched(Queue &queue, const Device &device,
@@ -191,7 +359,7 @@ void PadCopyTransposeMatrixBatched(Queue &queue, const Device &device,
                                    const size_t batch_count) {
 
   // Determines the right kernel
-  auto kernel_name = std::string{};
+  const char* kernel_name = nullptr;
   if (do_transpose) {
     kernel_name = (do_pad) ? "TransposePadMatrixBatched" : "TransposeMatrixBatched";
   }
@@ -200,7 +368,7 @@ void PadCopyTransposeMatrixBatched(Queue &queue, const Device &device,
   }
 
   // Retrieves the kernel from the compiled binary
-  auto kernel = Kernel(program, kernel_name);
+  auto kernel = GetKernel(program, kernel_name);
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(src_one));
@@ -220,21 +388,21 @@ void PadCopyTransposeMatrixBatched(Queue &queue, const Device &device,
   // Launches the kernel and returns the error code. Uses global and local thread sizes based on
   // parameters in the database.
   if (do_transpose) {
-    const auto global = std::vector<size_t>{
+    const auto global = ThreadRange{
       Ceil(CeilDiv(dest_one, db["PADTRA_WPT"]), db["PADTRA_TILE"]),
       Ceil(CeilDiv(dest_two, db["PADTRA_WPT"]), db["PADTRA_TILE"]),
       batch_count
     };
-    const auto local = std::vector<size_t>{db["PADTRA_TILE"], db["PADTRA_TILE"], 1};
+    const auto local = ThreadRange{db["PADTRA_TILE"], db["PADTRA_TILE"], 1};
     RunKernel(kernel, queue, device, global, local, event, waitForEvents);
   }
   else {
-    const auto global = std::vector<size_t>{
+    const auto global = ThreadRange{
       Ceil(CeilDiv(dest_one, db["PAD_WPTX"]), db["PAD_DIMX"]),
       Ceil(CeilDiv(dest_two, db["PAD_WPTY"]), db["PAD_DIMY"]),
       batch_count
     };
-    const auto local = std::vector<size_t>{db["PAD_DIMX"], db["PAD_DIMY"], 1};
+    const auto local = ThreadRange{db["PAD_DIMX"], db["PAD_DIMY"], 1};
     RunKernel(kernel, queue, device, global, local, event, waitForEvents);
   }
 }
@@ -250,12 +418,13 @@ void PadCopyTransposeMatrixStridedBatched(Queue &queue, const Device &device,
                                           const size_t dest_one, const size_t dest_two,
                                           const size_t dest_ld, const size_t dest_offset,
                                           const size_t dest_stride, const Buffer<T> &dest,
+                                          const T alpha,
                                           const Program &program, const bool do_pad,
                                           const bool do_transpose, const bool do_conjugate,
                                           const size_t batch_count) {
 
   // Determines the right kernel
-  auto kernel_name = std::string{};
+  const char* kernel_name = nullptr;
   if (do_transpose) {
     kernel_name = (do_pad) ? "TransposePadMatrixStridedBatched" : "TransposeMatrixStridedBatched";
   }
@@ -264,7 +433,7 @@ void PadCopyTransposeMatrixStridedBatched(Queue &queue, const Device &device,
   }
 
   // Retrieves the kernel from the compiled binary
-  auto kernel = Kernel(program, kernel_name);
+  auto kernel = GetKernel(program, kernel_name);
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(src_one));
@@ -279,28 +448,29 @@ void PadCopyTransposeMatrixStridedBatched(Queue &queue, const Device &device,
   kernel.SetArgument(9, static_cast<int>(dest_offset));
   kernel.SetArgument(10, static_cast<int>(dest_stride));
   kernel.SetArgument(11, dest());
+  kernel.SetArgument(12, GetRealArg(alpha));
   if (do_pad) {
-    kernel.SetArgument(12, static_cast<int>(do_conjugate));
+    kernel.SetArgument(13, static_cast<int>(do_conjugate));
   }
 
   // Launches the kernel and returns the error code. Uses global and local thread sizes based on
   // parameters in the database.
   if (do_transpose) {
-    const auto global = std::vector<size_t>{
+    const auto global = ThreadRange{
         Ceil(CeilDiv(dest_one, db["PADTRA_WPT"]), db["PADTRA_TILE"]),
         Ceil(CeilDiv(dest_two, db["PADTRA_WPT"]), db["PADTRA_TILE"]),
         batch_count
     };
-    const auto local = std::vector<size_t>{db["PADTRA_TILE"], db["PADTRA_TILE"], 1};
+    const auto local = ThreadRange{db["PADTRA_TILE"], db["PADTRA_TILE"], 1};
     RunKernel(kernel, queue, device, global, local, event, waitForEvents);
   }
   else {
-    const auto global = std::vector<size_t>{
+    const auto global = ThreadRange{
         Ceil(CeilDiv(dest_one, db["PAD_WPTX"]), db["PAD_DIMX"]),
         Ceil(CeilDiv(dest_two, db["PAD_WPTY"]), db["PAD_DIMY"]),
         batch_count
     };
-    const auto local = std::vector<size_t>{db["PAD_DIMX"], db["PAD_DIMY"], 1};
+    const auto local = ThreadRange{db["PAD_DIMX"], db["PAD_DIMY"], 1};
     RunKernel(kernel, queue, device, global, local, event, waitForEvents);
   }
 }
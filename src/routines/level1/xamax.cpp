@@ -22,8 +22,8 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xamax<T>::Xamax(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {}, {
-    #include "../../kernels/level1/xamax.opencl"
+    Routine(queue, event, name, {"Xamax"}, PrecisionValue<T>(), {}, {
+    KernelSource::kXamax
     }) {
 }
 
@@ -42,14 +42,15 @@ void Xamax<T>::DoAmax(const size_t n,
   TestVectorX(n, x_buffer, x_offset, x_inc);
   TestVectorIndex(1, imax_buffer, imax_offset);
 
-  // Retrieves the Xamax kernels from the compiled binary
-  auto kernel1 = Kernel(program_, "Xamax");
-  auto kernel2 = Kernel(program_, "XamaxEpilogue");
+  // Retrieves the Xamax kernels from the compiled binary: either the single-pass kernel or the main
+  // and the epilogue kernels
+  const auto single_pass = (db_["XDOT_SINGLE_PASS"] == 1);
+  auto kernel1 = GetKernel(program_, (single_pass) ? "XamaxSinglePass" : "Xamax");
 
   // Creates the buffer for intermediate values
   auto temp_size = 2*db_["WGS2"];
-  auto temp_buffer1 = Buffer<T>(context_, temp_size);
-  auto temp_buffer2 = Buffer<unsigned int>(context_, temp_size);
+  auto temp_buffer1 = TemporaryBuffer<T>(context_, queue_, temp_size);
+  auto temp_buffer2 = TemporaryBuffer<unsigned int>(context_, queue_, temp_size);
 
   // Sets the kernel arguments
   kernel1.SetArgument(0, static_cast<int>(n));
@@ -59,14 +60,23 @@ void Xamax<T>::DoAmax(const size_t n,
   kernel1.SetArgument(4, temp_buffer1());
   kernel1.SetArgument(5, temp_buffer2());
 
-  // Event waiting list
+  // Launches the single-pass kernel, of which the last work-group also computes the final result
+  auto global1 = ThreadRange{db_["WGS1"]*temp_size};
+  auto local1 = ThreadRange{db_["WGS1"]};
+  if (single_pass) {
+    const auto counter = ReductionCounter(context_, queue_);
+    kernel1.SetArgument(6, imax_buffer());
+    kernel1.SetArgument(7, static_cast<int>(imax_offset));
+    kernel1.SetArgument(8, counter());
+    RunKernel(kernel1, queue_, device_, global1, local1, event_);
+    return;
+  }
+
+  // Otherwise, launches the main kernel followed by the epilogue kernel
+  auto kernel2 = GetKernel(program_, "XamaxEpilogue");
   auto eventWaitList = std::vector<Event>();
-
-  // Launches the main kernel
-  auto global1 = std::vector<size_t>{db_["WGS1"]*temp_size};
-  auto local1 = std::vector<size_t>{db_["WGS1"]};
   auto kernelEvent = Event();
-  RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
+  RunKernel(kernel1, queue_, device_, global1, local1, IntermediateEvent(queue_, kernelEvent));
   eventWaitList.push_back(kernelEvent);
 
   // Sets the arguments for the epilogue kernel
@@ -76,8 +86,8 @@ void Xamax<T>::DoAmax(const size_t n,
   kernel2.SetArgument(3, static_cast<int>(imax_offset));
 
   // Launches the epilogue kernel
-  auto global2 = std::vector<size_t>{db_["WGS2"]};
-  auto local2 = std::vector<size_t>{db_["WGS2"]};
+  auto global2 = ThreadRange{db_["WGS2"]};
+  auto local2 = ThreadRange{db_["WGS2"]};
   RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
 }
 
@@ -22,9 +22,9 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xaxpy<T>::Xaxpy(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, {
-    #include "../../kernels/level1/level1.opencl"
-    #include "../../kernels/level1/xaxpy.opencl"
+    Routine(queue, event, name, {"Xaxpy"}, HalfStoragePrecision(queue, PrecisionValue<T>()), {}, {
+    KernelSource::kLevel1,
+    KernelSource::kXaxpy
     }) {
 }
 
@@ -39,59 +39,93 @@ void Xaxpy<T>::DoAxpy(const size_t n, const T alpha,
   // Makes sure all dimensions are larger than zero
   if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
 
-  // Tests the vectors for validity
-  TestVectorX(n, x_buffer, x_offset, x_inc);
-  TestVectorY(n, y_buffer, y_offset, y_inc);
-
-  // Determines whether or not the fast-version can be used
-  const auto use_faster_kernel = (x_offset == 0) && (x_inc == 1) &&
-                                 (y_offset == 0) && (y_inc == 1) &&
-                                 IsMultiple(n, db_["WPT"]*db_["VW"]);
-  const auto use_fastest_kernel = use_faster_kernel &&
-                                  IsMultiple(n, db_["WGS"]*db_["WPT"]*db_["VW"]);
+  // Tests the vectors for validity, which may need 64-bit indices
+  TestVectorX(n, x_buffer, x_offset, x_inc, true);
+  TestVectorY(n, y_buffer, y_offset, y_inc, true);
 
-  // If possible, run the fast-version of the kernel
-  const auto kernel_name = (use_fastest_kernel) ? "XaxpyFastest" :
-                           (use_faster_kernel) ? "XaxpyFaster" : "Xaxpy";
+  // Uses the program variant with 64-bit indices only for vectors of more than 2^31 elements
+  const auto index64 = RequiresIndex64({x_offset + n * x_inc, y_offset + n * y_inc});
+  const auto program = (index64) ? GetIndex64Program(0) : program_;
 
-  // Retrieves the Xaxpy kernel from the compiled binary
-  auto kernel = Kernel(program_, kernel_name);
+  // Determines whether or not the fast-version can be used: for unit strides and no offsets, the
+  // largest part of the vectors which is a multiple of 'WPT*VW' is processed by the fast kernel,
+  // and the remainder (the tail) by the general kernel
+  const auto unit_strides = (x_offset == 0) && (x_inc == 1) && (y_offset == 0) && (y_inc == 1);
+  const auto n_fast = (unit_strides) ? n - (n % (db_["WPT"]*db_["VW"])) : size_t{0};
+  const auto n_tail = n - n_fast;
 
-  // Sets the kernel arguments
-  if (use_faster_kernel || use_fastest_kernel) {
-    kernel.SetArgument(0, static_cast<int>(n));
+  // If possible, run the fast-version of the kernel
+  auto eventWaitList = std::vector<Event>();
+  if (n_fast > 0) {
+    const auto use_fastest_kernel = IsMultiple(n_fast, db_["WGS"]*db_["WPT"]*db_["VW"]);
+    auto kernel = GetKernel(program, (use_fastest_kernel) ? "XaxpyFastest" : "XaxpyFaster");
+    SetIndexArgument(kernel, 0, n_fast, index64);
     kernel.SetArgument(1, GetRealArg(alpha));
     kernel.SetArgument(2, x_buffer());
     kernel.SetArgument(3, y_buffer());
+    auto global = ThreadRange{Ceil(CeilDiv(n_fast, db_["WPT"]*db_["VW"]), db_["WGS"])};
+    auto local = ThreadRange{db_["WGS"]};
+    if (n_tail == 0) {
+      RunKernel(kernel, queue_, device_, global, local, event_);
+      return;
+    }
+    auto kernelEvent = Event();
+    RunKernel(kernel, queue_, device_, global, local, IntermediateEvent(queue_, kernelEvent));
+    eventWaitList.push_back(kernelEvent);
   }
-  else {
-    kernel.SetArgument(0, static_cast<int>(n));
-    kernel.SetArgument(1, GetRealArg(alpha));
-    kernel.SetArgument(2, x_buffer());
-    kernel.SetArgument(3, static_cast<int>(x_offset));
-    kernel.SetArgument(4, static_cast<int>(x_inc));
-    kernel.SetArgument(5, y_buffer());
-    kernel.SetArgument(6, static_cast<int>(y_offset));
-    kernel.SetArgument(7, static_cast<int>(y_inc));
-  }
+
+  // Otherwise, or for the tail, runs the general kernel: the variant for non-unit strides processes
+  // 'WPT' elements per thread with all loads issued up-front
+  const auto unit_increments = (x_inc == 1) && (y_inc == 1);
+  auto kernel = GetKernel(program, (unit_increments) ? "Xaxpy" : "XaxpyStrided");
+  SetIndexArgument(kernel, 0, n_tail, index64);
+  kernel.SetArgument(1, GetRealArg(alpha));
+  kernel.SetArgument(2, x_buffer());
+  SetIndexArgument(kernel, 3, x_offset + n_fast, index64);
+  SetIndexArgument(kernel, 4, x_inc, index64);
+  kernel.SetArgument(5, y_buffer());
+  SetIndexArgument(kernel, 6, y_offset + n_fast, index64);
+  SetIndexArgument(kernel, 7, y_inc, index64);
+  const auto n_ceiled = Ceil(n_tail, db_["WGS"]*db_["WPT"]);
+  auto global = ThreadRange{n_ceiled/db_["WPT"]};
+  auto local = ThreadRange{db_["WGS"]};
+  RunKernel(kernel, queue_, device_, global, local, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// As above, but with alpha read from a device buffer
+template <typename T>
+void Xaxpy<T>::DoAxpyDevice(const size_t n,
+                            const Buffer<T> &alpha_buffer, const size_t alpha_offset,
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors and the scalar for validity
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorY(n, y_buffer, y_offset, y_inc);
+  TestVectorScalar(1, alpha_buffer, alpha_offset);
+
+  // Retrieves the XaxpyDevice kernel from the compiled binary and sets its arguments
+  auto kernel = GetKernel(program_, "XaxpyDevice");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, alpha_buffer());
+  kernel.SetArgument(2, static_cast<int>(alpha_offset));
+  kernel.SetArgument(3, x_buffer());
+  kernel.SetArgument(4, static_cast<int>(x_offset));
+  kernel.SetArgument(5, static_cast<int>(x_inc));
+  kernel.SetArgument(6, y_buffer());
+  kernel.SetArgument(7, static_cast<int>(y_offset));
+  kernel.SetArgument(8, static_cast<int>(y_inc));
 
   // Launches the kernel
-  if (use_fastest_kernel) {
-    auto global = std::vector<size_t>{CeilDiv(n, db_["WPT"]*db_["VW"])};
-    auto local = std::vector<size_t>{db_["WGS"]};
-    RunKernel(kernel, queue_, device_, global, local, event_);
-  }
-  else if (use_faster_kernel) {
-    auto global = std::vector<size_t>{Ceil(CeilDiv(n, db_["WPT"]*db_["VW"]), db_["WGS"])};
-    auto local = std::vector<size_t>{db_["WGS"]};
-    RunKernel(kernel, queue_, device_, global, local, event_);
-  }
-  else {
-    const auto n_ceiled = Ceil(n, db_["WGS"]*db_["WPT"]);
-    auto global = std::vector<size_t>{n_ceiled/db_["WPT"]};
-    auto local = std::vector<size_t>{db_["WGS"]};
-    RunKernel(kernel, queue_, device_, global, local, event_);
-  }
+  const auto n_ceiled = Ceil(n, db_["WGS"]*db_["WPT"]);
+  auto global = ThreadRange{n_ceiled/db_["WPT"]};
+  auto local = ThreadRange{db_["WGS"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
 }
 
 // =================================================================================================
@@ -102,6 +136,7 @@ template class Xaxpy<float>;
 template class Xaxpy<double>;
 template class Xaxpy<float2>;
 template class Xaxpy<double2>;
+template class Xaxpy<bfloat16>;
 
 // =================================================================================================
 } // namespace clblast
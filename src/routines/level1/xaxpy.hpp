@@ -31,6 +31,12 @@ class Xaxpy: public Routine {
   void DoAxpy(const size_t n, const T alpha,
               const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
               const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc);
+
+  // As above, but with alpha read from a device buffer by the kernel (the "AXPYDEVICE" routine)
+  void DoAxpyDevice(const size_t n,
+                    const Buffer<T> &alpha_buffer, const size_t alpha_offset,
+                    const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                    const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc);
 };
 
 // =================================================================================================
@@ -22,8 +22,9 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xdot<T>::Xdot(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {}, {
-    #include "../../kernels/level1/xdot.opencl"
+    Routine(queue, event, name, {"Xdot"},
+            HalfStoragePrecision(queue, AccumulationPrecision(PrecisionValue<T>())), {}, {
+    KernelSource::kXdot
     }) {
 }
 
@@ -45,13 +46,14 @@ void Xdot<T>::DoDot(const size_t n,
   TestVectorY(n, y_buffer, y_offset, y_inc);
   TestVectorScalar(1, dot_buffer, dot_offset);
 
-  // Retrieves the Xdot kernels from the compiled binary
-  auto kernel1 = Kernel(program_, "Xdot");
-  auto kernel2 = Kernel(program_, "XdotEpilogue");
+  // Retrieves the Xdot kernels from the compiled binary: either the single-pass kernel or the main
+  // and the epilogue kernels
+  const auto single_pass = (db_["XDOT_SINGLE_PASS"] == 1);
+  auto kernel1 = GetKernel(program_, (single_pass) ? "XdotSinglePass" : "Xdot");
 
   // Creates the buffer for intermediate values
   auto temp_size = 2*db_["WGS2"];
-  auto temp_buffer = Buffer<T>(context_, temp_size);
+  auto temp_buffer = TemporaryBuffer<T>(context_, queue_, PartialSumsSize(temp_size));
 
   // Sets the kernel arguments
   kernel1.SetArgument(0, static_cast<int>(n));
@@ -64,14 +66,23 @@ void Xdot<T>::DoDot(const size_t n,
   kernel1.SetArgument(7, temp_buffer());
   kernel1.SetArgument(8, static_cast<int>(do_conjugate));
 
-  // Event waiting list
+  // Launches the single-pass kernel, of which the last work-group also computes the final result
+  auto global1 = ThreadRange{db_["WGS1"]*temp_size};
+  auto local1 = ThreadRange{db_["WGS1"]};
+  if (single_pass) {
+    const auto counter = ReductionCounter(context_, queue_);
+    kernel1.SetArgument(9, dot_buffer());
+    kernel1.SetArgument(10, static_cast<int>(dot_offset));
+    kernel1.SetArgument(11, counter());
+    RunKernel(kernel1, queue_, device_, global1, local1, event_);
+    return;
+  }
+
+  // Otherwise, launches the main kernel followed by the epilogue kernel
+  auto kernel2 = GetKernel(program_, "XdotEpilogue");
   auto eventWaitList = std::vector<Event>();
-
-  // Launches the main kernel
-  auto global1 = std::vector<size_t>{db_["WGS1"]*temp_size};
-  auto local1 = std::vector<size_t>{db_["WGS1"]};
   auto kernelEvent = Event();
-  RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
+  RunKernel(kernel1, queue_, device_, global1, local1, IntermediateEvent(queue_, kernelEvent));
   eventWaitList.push_back(kernelEvent);
 
   // Sets the arguments for the epilogue kernel
@@ -80,8 +91,8 @@ void Xdot<T>::DoDot(const size_t n,
   kernel2.SetArgument(2, static_cast<int>(dot_offset));
 
   // Launches the epilogue kernel
-  auto global2 = std::vector<size_t>{db_["WGS2"]};
-  auto local2 = std::vector<size_t>{db_["WGS2"]};
+  auto global2 = ThreadRange{db_["WGS2"]};
+  auto local2 = ThreadRange{db_["WGS2"]};
   RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
 }
 
@@ -22,8 +22,9 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xnrm2<T>::Xnrm2(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {}, {
-    #include "../../kernels/level1/xnrm2.opencl"
+    Routine(queue, event, name, {"Xnrm2"},
+            HalfStoragePrecision(queue, AccumulationPrecision(PrecisionValue<T>())), {}, {
+    KernelSource::kXnrm2
     }) {
 }
 
@@ -42,13 +43,14 @@ void Xnrm2<T>::DoNrm2(const size_t n,
   TestVectorX(n, x_buffer, x_offset, x_inc);
   TestVectorScalar(1, nrm2_buffer, nrm2_offset);
 
-  // Retrieves the Xnrm2 kernels from the compiled binary
-  auto kernel1 = Kernel(program_, "Xnrm2");
-  auto kernel2 = Kernel(program_, "Xnrm2Epilogue");
+  // Retrieves the Xnrm2 kernels from the compiled binary: either the single-pass kernel or the main
+  // and the epilogue kernels
+  const auto single_pass = (db_["XDOT_SINGLE_PASS"] == 1);
+  auto kernel1 = GetKernel(program_, (single_pass) ? "Xnrm2SinglePass" : "Xnrm2");
 
   // Creates the buffer for intermediate values
   auto temp_size = 2*db_["WGS2"];
-  auto temp_buffer = Buffer<T>(context_, temp_size);
+  auto temp_buffer = TemporaryBuffer<T>(context_, queue_, PartialSumsSize(temp_size));
 
   // Sets the kernel arguments
   kernel1.SetArgument(0, static_cast<int>(n));
@@ -57,14 +59,23 @@ void Xnrm2<T>::DoNrm2(const size_t n,
   kernel1.SetArgument(3, static_cast<int>(x_inc));
   kernel1.SetArgument(4, temp_buffer());
 
-  // Event waiting list
+  // Launches the single-pass kernel, of which the last work-group also computes the final result
+  auto global1 = ThreadRange{db_["WGS1"]*temp_size};
+  auto local1 = ThreadRange{db_["WGS1"]};
+  if (single_pass) {
+    const auto counter = ReductionCounter(context_, queue_);
+    kernel1.SetArgument(5, nrm2_buffer());
+    kernel1.SetArgument(6, static_cast<int>(nrm2_offset));
+    kernel1.SetArgument(7, counter());
+    RunKernel(kernel1, queue_, device_, global1, local1, event_);
+    return;
+  }
+
+  // Otherwise, launches the main kernel followed by the epilogue kernel
+  auto kernel2 = GetKernel(program_, "Xnrm2Epilogue");
   auto eventWaitList = std::vector<Event>();
-
-  // Launches the main kernel
-  auto global1 = std::vector<size_t>{db_["WGS1"]*temp_size};
-  auto local1 = std::vector<size_t>{db_["WGS1"]};
   auto kernelEvent = Event();
-  RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
+  RunKernel(kernel1, queue_, device_, global1, local1, IntermediateEvent(queue_, kernelEvent));
   eventWaitList.push_back(kernelEvent);
 
   // Sets the arguments for the epilogue kernel
@@ -73,8 +84,8 @@ void Xnrm2<T>::DoNrm2(const size_t n,
   kernel2.SetArgument(2, static_cast<int>(nrm2_offset));
 
   // Launches the epilogue kernel
-  auto global2 = std::vector<size_t>{db_["WGS2"]};
-  auto local2 = std::vector<size_t>{db_["WGS2"]};
+  auto global2 = ThreadRange{db_["WGS2"]};
+  auto local2 = ThreadRange{db_["WGS2"]};
   RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
 }
 
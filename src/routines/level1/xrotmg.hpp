@@ -0,0 +1,42 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrotmg routine. The precision is implemented using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XROTMG_H_
+#define CLBLAST_ROUTINES_XROTMG_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xrotmg: public Routine {
+ public:
+
+  // Constructor
+  Xrotmg(Queue &queue, EventPointer event, const std::string &name = "ROTMG");
+
+  // Templated-precision implementation of the routine
+  void DoRotmg(const Buffer<T> &sd1_buffer, const size_t sd1_offset,
+               const Buffer<T> &sd2_buffer, const size_t sd2_offset,
+               const Buffer<T> &sx1_buffer, const size_t sx1_offset,
+               const Buffer<T> &sy1_buffer, const size_t sy1_offset,
+               const Buffer<T> &sparam_buffer, const size_t sparam_offset);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XROTMG_H_
+#endif
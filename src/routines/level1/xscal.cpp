@@ -22,9 +22,9 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xscal<T>::Xscal(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, {
-    #include "../../kernels/level1/level1.opencl"
-    #include "../../kernels/level1/xscal.opencl"
+    Routine(queue, event, name, {"Xaxpy"}, HalfStoragePrecision(queue, PrecisionValue<T>()), {}, {
+    KernelSource::kLevel1,
+    KernelSource::kXscal
     }) {
 }
 
@@ -41,42 +41,75 @@ void Xscal<T>::DoScal(const size_t n, const T alpha,
   // Tests the vector for validity
   TestVectorX(n, x_buffer, x_offset, x_inc);
 
-  // Determines whether or not the fast-version can be used
-  bool use_fast_kernel = (x_offset == 0) && (x_inc == 1) &&
-                         IsMultiple(n, db_["WGS"]*db_["WPT"]*db_["VW"]);
+  // Determines whether or not the fast-version can be used: for unit strides and no offsets, the
+  // largest part of the vector which is a multiple of 'WGS*WPT*VW' is processed by the fast kernel,
+  // and the remainder (the tail) by the general kernel
+  const auto unit_strides = (x_offset == 0) && (x_inc == 1);
+  const auto n_fast = (unit_strides) ? n - (n % (db_["WGS"]*db_["WPT"]*db_["VW"])) : size_t{0};
+  const auto n_tail = n - n_fast;
 
   // If possible, run the fast-version of the kernel
-  auto kernel_name = (use_fast_kernel) ? "XscalFast" : "Xscal";
-
-  // Retrieves the Xscal kernel from the compiled binary
-  auto kernel = Kernel(program_, kernel_name);
-
-  // Sets the kernel arguments
-  if (use_fast_kernel) {
-    kernel.SetArgument(0, static_cast<int>(n));
-    kernel.SetArgument(1, GetRealArg(alpha));
-    kernel.SetArgument(2, x_buffer());
-  }
-  else {
-    kernel.SetArgument(0, static_cast<int>(n));
+  auto eventWaitList = std::vector<Event>();
+  if (n_fast > 0) {
+    auto kernel = GetKernel(program_, "XscalFast");
+    kernel.SetArgument(0, static_cast<int>(n_fast));
     kernel.SetArgument(1, GetRealArg(alpha));
     kernel.SetArgument(2, x_buffer());
-    kernel.SetArgument(3, static_cast<int>(x_offset));
-    kernel.SetArgument(4, static_cast<int>(x_inc));
+    auto global = ThreadRange{n_fast/(db_["WPT"]*db_["VW"])};
+    auto local = ThreadRange{db_["WGS"]};
+    if (n_tail == 0) {
+      RunKernel(kernel, queue_, device_, global, local, event_);
+      return;
+    }
+    auto kernelEvent = Event();
+    RunKernel(kernel, queue_, device_, global, local, IntermediateEvent(queue_, kernelEvent));
+    eventWaitList.push_back(kernelEvent);
   }
 
+  // Otherwise, or for the tail, runs the general kernel: the variant for non-unit strides processes
+  // 'WPT' elements per thread with all loads issued up-front
+  const auto unit_increments = (x_inc == 1);
+  auto kernel = GetKernel(program_, (unit_increments) ? "Xscal" : "XscalStrided");
+  kernel.SetArgument(0, static_cast<int>(n_tail));
+  kernel.SetArgument(1, GetRealArg(alpha));
+  kernel.SetArgument(2, x_buffer());
+  kernel.SetArgument(3, static_cast<int>(x_offset + n_fast));
+  kernel.SetArgument(4, static_cast<int>(x_inc));
+  const auto n_ceiled = Ceil(n_tail, db_["WGS"]*db_["WPT"]);
+  auto global = ThreadRange{n_ceiled/db_["WPT"]};
+  auto local = ThreadRange{db_["WGS"]};
+  RunKernel(kernel, queue_, device_, global, local, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// As above, but with alpha read from a device buffer
+template <typename T>
+void Xscal<T>::DoScalDevice(const size_t n,
+                            const Buffer<T> &alpha_buffer, const size_t alpha_offset,
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vector and the scalar for validity
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorScalar(1, alpha_buffer, alpha_offset);
+
+  // Retrieves the XscalDevice kernel from the compiled binary and sets its arguments
+  auto kernel = GetKernel(program_, "XscalDevice");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, alpha_buffer());
+  kernel.SetArgument(2, static_cast<int>(alpha_offset));
+  kernel.SetArgument(3, x_buffer());
+  kernel.SetArgument(4, static_cast<int>(x_offset));
+  kernel.SetArgument(5, static_cast<int>(x_inc));
+
   // Launches the kernel
-  if (use_fast_kernel) {
-    auto global = std::vector<size_t>{CeilDiv(n, db_["WPT"]*db_["VW"])};
-    auto local = std::vector<size_t>{db_["WGS"]};
-    RunKernel(kernel, queue_, device_, global, local, event_);
-  }
-  else {
-    auto n_ceiled = Ceil(n, db_["WGS"]*db_["WPT"]);
-    auto global = std::vector<size_t>{n_ceiled/db_["WPT"]};
-    auto local = std::vector<size_t>{db_["WGS"]};
-    RunKernel(kernel, queue_, device_, global, local, event_);
-  }
+  auto n_ceiled = Ceil(n, db_["WGS"]*db_["WPT"]);
+  auto global = ThreadRange{n_ceiled/db_["WPT"]};
+  auto local = ThreadRange{db_["WGS"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
 }
 
 // =================================================================================================
@@ -30,6 +30,11 @@ class Xscal: public Routine {
   // Templated-precision implementation of the routine
   void DoScal(const size_t n, const T alpha,
               const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc);
+
+  // As above, but with alpha read from a device buffer by the kernel (the "SCALDEVICE" routine)
+  void DoScalDevice(const size_t n,
+                    const Buffer<T> &alpha_buffer, const size_t alpha_offset,
+                    const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc);
 };
 
 // =================================================================================================
@@ -22,9 +22,9 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xswap<T>::Xswap(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, {
-    #include "../../kernels/level1/level1.opencl"
-    #include "../../kernels/level1/xswap.opencl"
+    Routine(queue, event, name, {"Xaxpy"}, HalfStoragePrecision(queue, PrecisionValue<T>()), {}, {
+    KernelSource::kLevel1,
+    KernelSource::kXswap
     }) {
 }
 
@@ -43,45 +43,46 @@ void Xswap<T>::DoSwap(const size_t n,
   TestVectorX(n, x_buffer, x_offset, x_inc);
   TestVectorY(n, y_buffer, y_offset, y_inc);
 
-  // Determines whether or not the fast-version can be used
-  bool use_fast_kernel = (x_offset == 0) && (x_inc == 1) &&
-                         (y_offset == 0) && (y_inc == 1) &&
-                         IsMultiple(n, db_["WGS"]*db_["WPT"]*db_["VW"]);
+  // Determines whether or not the fast-version can be used: for unit strides and no offsets, the
+  // largest part of the vectors which is a multiple of 'WGS*WPT*VW' is done by the fast kernel,
+  // and the remainder (the tail) by the general kernel
+  const auto unit_strides = (x_offset == 0) && (x_inc == 1) && (y_offset == 0) && (y_inc == 1);
+  const auto n_fast = (unit_strides) ? n - (n % (db_["WGS"]*db_["WPT"]*db_["VW"])) : size_t{0};
+  const auto n_tail = n - n_fast;
 
   // If possible, run the fast-version of the kernel
-  auto kernel_name = (use_fast_kernel) ? "XswapFast" : "Xswap";
-
-  // Retrieves the Xswap kernel from the compiled binary
-  auto kernel = Kernel(program_, kernel_name);
-
-  // Sets the kernel arguments
-  if (use_fast_kernel) {
-    kernel.SetArgument(0, static_cast<int>(n));
+  auto eventWaitList = std::vector<Event>();
+  if (n_fast > 0) {
+    auto kernel = GetKernel(program_, "XswapFast");
+    kernel.SetArgument(0, static_cast<int>(n_fast));
     kernel.SetArgument(1, x_buffer());
     kernel.SetArgument(2, y_buffer());
-  }
-  else {
-    kernel.SetArgument(0, static_cast<int>(n));
-    kernel.SetArgument(1, x_buffer());
-    kernel.SetArgument(2, static_cast<int>(x_offset));
-    kernel.SetArgument(3, static_cast<int>(x_inc));
-    kernel.SetArgument(4, y_buffer());
-    kernel.SetArgument(5, static_cast<int>(y_offset));
-    kernel.SetArgument(6, static_cast<int>(y_inc));
+    auto global = ThreadRange{n_fast/(db_["WPT"]*db_["VW"])};
+    auto local = ThreadRange{db_["WGS"]};
+    if (n_tail == 0) {
+      RunKernel(kernel, queue_, device_, global, local, event_);
+      return;
+    }
+    auto kernelEvent = Event();
+    RunKernel(kernel, queue_, device_, global, local, IntermediateEvent(queue_, kernelEvent));
+    eventWaitList.push_back(kernelEvent);
   }
 
-  // Launches the kernel
-  if (use_fast_kernel) {
-    auto global = std::vector<size_t>{CeilDiv(n, db_["WPT"]*db_["VW"])};
-    auto local = std::vector<size_t>{db_["WGS"]};
-    RunKernel(kernel, queue_, device_, global, local, event_);
-  }
-  else {
-    auto n_ceiled = Ceil(n, db_["WGS"]*db_["WPT"]);
-    auto global = std::vector<size_t>{n_ceiled/db_["WPT"]};
-    auto local = std::vector<size_t>{db_["WGS"]};
-    RunKernel(kernel, queue_, device_, global, local, event_);
-  }
+  // Otherwise, or for the tail, runs the general kernel: the variant for non-unit strides processes
+  // 'WPT' elements per thread with all loads issued up-front
+  const auto unit_increments = (x_inc == 1) && (y_inc == 1);
+  auto kernel = GetKernel(program_, (unit_increments) ? "Xswap" : "XswapStrided");
+  kernel.SetArgument(0, static_cast<int>(n_tail));
+  kernel.SetArgument(1, x_buffer());
+  kernel.SetArgument(2, static_cast<int>(x_offset + n_fast));
+  kernel.SetArgument(3, static_cast<int>(x_inc));
+  kernel.SetArgument(4, y_buffer());
+  kernel.SetArgument(5, static_cast<int>(y_offset + n_fast));
+  kernel.SetArgument(6, static_cast<int>(y_inc));
+  const auto n_ceiled = Ceil(n_tail, db_["WGS"]*db_["WPT"]);
+  auto global = ThreadRange{n_ceiled/db_["WPT"]};
+  auto local = ThreadRange{db_["WGS"]};
+  RunKernel(kernel, queue_, device_, global, local, event_, eventWaitList);
 }
 
 // =================================================================================================
@@ -42,9 +42,9 @@ void Xgbmv<T>::DoGbmv(const Layout layout, const Transpose a_transpose,
   auto kl_real = (rotated) ? ku : kl;
   auto ku_real = (rotated) ? kl : ku;
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific hermitian matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_GBMV define.
+  // Runs the banded matrix-vector multiplication kernel, disabling the use of fast vectorized
+  // kernels. The specific banded matrix-accesses are implemented in the kernel guarded by
+  // the ROUTINE_GBMV define.
   bool fast_kernels = false;
   MatVec(layout, a_transpose,
          m, n, alpha,
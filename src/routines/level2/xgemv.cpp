@@ -12,6 +12,8 @@
 // =================================================================================================
 
 #include "routines/level2/xgemv.hpp"
+#include "routines/level1/xscal.hpp"
+#include "routines/levelx/xscalstridedbatched.hpp"
 
 #include <string>
 #include <vector>
@@ -22,11 +24,19 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xgemv<T>::Xgemv(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xgemv", "XgemvFast", "XgemvFastRot", "TrsvRoutine"}, PrecisionValue<T>(), {}, {
-    #include "../../kernels/level2/xgemv.opencl"
-    #include "../../kernels/level2/xgemv_fast.opencl"
-    #include "../../kernels/level2/xtrsv.opencl"
-    }) {
+    Routine(queue, event, name,
+            {"Xgemv", "XgemvBanded", "XgemvFast", "XgemvFastRot", "TrsvRoutine"},
+            (name == "GEMV") ?
+                HalfStoragePrecision(queue, AccumulationPrecision(PrecisionValue<T>())) :
+                AccumulationPrecision(PrecisionValue<T>()), {}, {
+    KernelSource::kXgemv,
+    KernelSource::kXgemvBanded,
+    KernelSource::kXgemvFast,
+    KernelSource::kXtrsv,
+    KernelSource::kXsymv
+    }),
+    has_device_scalars_(name == "GEMVDEVICE"),
+    device_scalars_{Buffer<T>(0), 0, Buffer<T>(0), 0} {
 }
 
 // =================================================================================================
@@ -51,6 +61,30 @@ void Xgemv<T>::DoGemv(const Layout layout, const Transpose a_transpose,
          0, false, 0, 0); // N/A for this routine
 }
 
+// As above, but with alpha and beta read from device buffers
+template <typename T>
+void Xgemv<T>::DoGemvDevice(const Layout layout, const Transpose a_transpose,
+                            const size_t m, const size_t n,
+                            const Buffer<T> &alpha_buffer, const size_t alpha_offset,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const Buffer<T> &beta_buffer, const size_t beta_offset,
+                            const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc) {
+  if (!has_device_scalars_) { throw LogicError("Xgemv: device scalars require GEMVDEVICE"); }
+  TestVectorScalar(1, alpha_buffer, alpha_offset);
+  TestVectorScalar(1, beta_buffer, beta_offset);
+  device_scalars_ = DeviceScalars<T>{alpha_buffer, alpha_offset, beta_buffer, beta_offset};
+
+  // Performs the matrix-vector multiplication, the scalars passed here are unused
+  MatVec(layout, a_transpose,
+         m, n, ConstantOne<T>(),
+         a_buffer, a_offset, a_ld,
+         x_buffer, x_offset, x_inc, ConstantOne<T>(),
+         y_buffer, y_offset, y_inc,
+         false, false,
+         0, false, 0, 0); // N/A for this routine
+}
+
 // =================================================================================================
 
 // The generic implementation, also suited for other (non general) matrix-vector multiplications
@@ -79,9 +113,12 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
   const auto m_real = (a_transposed) ? n : m;
   const auto n_real = (a_transposed) ? m : n;
 
-  // Special adjustments for banded matrices
-  if (kl != 0 || ku != 0) {
+  // Special adjustments for banded matrices: the number of stored diagonals also selects the
+  // band-width specific parameters of the banded kernel (if any, see 'OverrideParametersForSize')
+  const auto banded = (kl != 0 || ku != 0);
+  if (banded) {
     a_one = kl+ku+1;
+    SelectSizeVariant(a_one);
   }
 
   // Determines whether the kernel needs to perform rotated access ('^' is the XOR operator)
@@ -96,6 +133,12 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
   TestVectorX(n_real, x_buffer, x_offset, x_inc);
   TestVectorY(m_real, y_buffer, y_offset, y_inc);
 
+  // With a zero alpha, A and x don't contribute to the result: only y = beta * y is computed
+  if (IsScaleOnly(alpha, beta)) {
+    ScaleOnly(m_real, beta, y_buffer, y_offset, y_inc, 0, 1);
+    return;
+  }
+
   // Determines whether or not the fast-version can be used
   fast_kernel = fast_kernel && (a_offset == 0) && (a_rotated == 0) && (a_conjugate == 0) &&
                 IsMultiple(m, db_["WGS2"]*db_["WPT2"]) &&
@@ -106,8 +149,20 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
                     IsMultiple(n, db_["WGS3"]) &&
                     IsMultiple(a_ld, db_["VW3"]);
 
+  // For short and wide matrices the above kernels run only a few work-groups, since they assign
+  // the work per row of the result. In that case the 'n' dimension is split over work-groups.
+  const auto split_ratio = db_["SPLITN_RATIO"];
+  const auto split_chunk = (db_["SPLITN_CHUNK"] == 0) ? 0 : Ceil(db_["SPLITN_CHUNK"], db_["WGS1"]);
+  if (split_ratio != 0 && split_chunk != 0 && !banded && !has_device_scalars_ &&
+      n_real > split_chunk && n_real >= m_real * split_ratio) {
+    MatVecSplit(m_real, n_real, split_chunk, alpha, a_rotated, a_buffer, a_offset, a_ld,
+                x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc,
+                a_conjugate, parameter, kl, ku);
+    return;
+  }
+
   // If possible, run the fast-version (rotated or non-rotated) of the kernel
-  auto kernel_name = std::string{"Xgemv"};
+  auto kernel_name = std::string{(has_device_scalars_) ? "XgemvDevice" : "Xgemv"};
   const auto m_ceiled = Ceil(m_real, db_["WGS1"]*db_["WPT1"]);
   auto global_size = m_ceiled / db_["WPT1"];
   auto local_size = db_["WGS1"];
@@ -121,15 +176,28 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
     global_size = m_real;
     local_size = db_["WGS3"];
   }
+  if (banded) {
+    kernel_name = "XgemvBanded";
+    global_size = Ceil(m_real, db_["WGSB"]*db_["WPTB"]) / db_["WPTB"];
+    local_size = db_["WGSB"];
+  }
 
   // Retrieves the Xgemv kernel from the compiled binary
-  auto kernel = Kernel(program_, kernel_name);
+  auto kernel = GetKernel(program_, kernel_name);
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(m_real));
   kernel.SetArgument(1, static_cast<int>(n_real));
-  kernel.SetArgument(2, GetRealArg(alpha));
-  kernel.SetArgument(3, GetRealArg(beta));
+  if (has_device_scalars_) {
+    kernel.SetArgument(2, device_scalars_.alpha_buffer());
+    kernel.SetArgument(3, device_scalars_.beta_buffer());
+    kernel.SetArgument(18, static_cast<int>(device_scalars_.alpha_offset));
+    kernel.SetArgument(19, static_cast<int>(device_scalars_.beta_offset));
+  }
+  else {
+    kernel.SetArgument(2, GetRealArg(alpha));
+    kernel.SetArgument(3, GetRealArg(beta));
+  }
   kernel.SetArgument(4, static_cast<int>(a_rotated));
   kernel.SetArgument(5, a_buffer());
   kernel.SetArgument(6, static_cast<int>(a_offset));
@@ -146,13 +214,165 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
   kernel.SetArgument(17, static_cast<int>(ku)); // only used for banded matrices
 
   // Launches the kernel
-  auto global = std::vector<size_t>{global_size};
-  auto local = std::vector<size_t>{local_size};
+  auto global = ThreadRange{global_size};
+  auto local = ThreadRange{local_size};
   RunKernel(kernel, queue_, device_, global, local, event_);
 }
 
 // =================================================================================================
 
+// Runs the SCAL routine on y, or no kernel at all for a beta of one. The SCAL routine computes
+// beta * y also for a zero beta, as the GEMV kernels do.
+template <typename T>
+void Xgemv<T>::ScaleOnly(const size_t m, const T beta,
+                         const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                         const size_t y_stride, const size_t batch_count) {
+  if (beta == ConstantOne<T>()) {
+    SignalEvent(queue_, event_, input_events_);
+    return;
+  }
+  SetInputEvents(queue_, std::vector<Event>(input_events_));
+  if (batch_count == 1) {
+    auto scal = Xscal<T>(queue_, event_);
+    scal.DoScal(m, beta, y_buffer, y_offset, y_inc);
+  }
+  else {
+    auto scal = XscalStridedBatched<T>(queue_, event_);
+    scal.DoScalStridedBatched(m, beta, y_buffer, y_offset, y_inc, y_stride, batch_count);
+  }
+}
+
+// =================================================================================================
+
+// The split implementation: each work-group computes the partial results of all rows for a chunk of
+// 'chunk_size' columns, after which a second kernel sums these and applies alpha and beta
+template <typename T>
+void Xgemv<T>::MatVecSplit(const size_t m, const size_t n, const size_t chunk_size,
+                           const T alpha, const bool a_rotated,
+                           const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                           const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                           const T beta,
+                           const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                           const bool a_conjugate, const size_t parameter,
+                           const size_t kl, const size_t ku) {
+
+  // Creates the buffer for the partial results: one vector per chunk
+  const auto num_chunks = CeilDiv(n, chunk_size);
+  auto partials = TemporaryBuffer<T>(context_, queue_, num_chunks * m);
+
+  // Launches the main kernel, which computes the partial results per chunk
+  auto kernel1 = GetKernel(program_, "XgemvSplit");
+  kernel1.SetArgument(0, static_cast<int>(m));
+  kernel1.SetArgument(1, static_cast<int>(n));
+  kernel1.SetArgument(2, static_cast<int>(chunk_size));
+  kernel1.SetArgument(3, static_cast<int>(a_rotated));
+  kernel1.SetArgument(4, a_buffer());
+  kernel1.SetArgument(5, static_cast<int>(a_offset));
+  kernel1.SetArgument(6, static_cast<int>(a_ld));
+  kernel1.SetArgument(7, x_buffer());
+  kernel1.SetArgument(8, static_cast<int>(x_offset));
+  kernel1.SetArgument(9, static_cast<int>(x_inc));
+  kernel1.SetArgument(10, partials());
+  kernel1.SetArgument(11, static_cast<int>(a_conjugate));
+  kernel1.SetArgument(12, static_cast<int>(parameter));
+  kernel1.SetArgument(13, static_cast<int>(kl));
+  kernel1.SetArgument(14, static_cast<int>(ku));
+  auto eventWaitList = std::vector<Event>();
+  auto kernelEvent = Event();
+  const auto m_ceiled = Ceil(m, db_["WGS1"]*db_["WPT1"]);
+  auto global1 = ThreadRange{m_ceiled / db_["WPT1"], num_chunks};
+  auto local1 = ThreadRange{db_["WGS1"], 1};
+  RunKernel(kernel1, queue_, device_, global1, local1, IntermediateEvent(queue_, kernelEvent));
+  eventWaitList.push_back(kernelEvent);
+
+  // Launches the epilogue kernel, which sums the partial results and applies alpha and beta
+  auto kernel2 = GetKernel(program_, "XgemvSplitEpilogue");
+  kernel2.SetArgument(0, static_cast<int>(m));
+  kernel2.SetArgument(1, static_cast<int>(num_chunks));
+  kernel2.SetArgument(2, GetRealArg(alpha));
+  kernel2.SetArgument(3, GetRealArg(beta));
+  kernel2.SetArgument(4, partials());
+  kernel2.SetArgument(5, y_buffer());
+  kernel2.SetArgument(6, static_cast<int>(y_offset));
+  kernel2.SetArgument(7, static_cast<int>(y_inc));
+  auto global2 = ThreadRange{Ceil(m, db_["WGS1"])};
+  auto local2 = ThreadRange{db_["WGS1"]};
+  RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// The symmetric/hermitian implementation: each stored element of matrix A is loaded once
+template <typename T>
+void Xgemv<T>::SymMatVec(const size_t n,
+                         const T alpha,
+                         const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                         const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                         const T beta,
+                         const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                         const bool is_upper, const bool a_conjugate) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix and the vectors for validity
+  TestMatrixA(n, n, a_buffer, a_offset, a_ld);
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorY(n, y_buffer, y_offset, y_inc);
+
+  // With a zero alpha, only y = beta * y is computed (see 'MatVec')
+  if (IsScaleOnly(alpha, beta)) {
+    ScaleOnly(n, beta, y_buffer, y_offset, y_inc, 0, 1);
+    return;
+  }
+
+  // Creates the buffers for the partial results: one vector per column-tile for the stored elements
+  // and one vector per row-tile for their mirrored counterparts
+  const auto tile_rows = db_["WGS1"] * kSymTileRowsPerThread;
+  const auto num_row_tiles = CeilDiv(n, tile_rows);
+  const auto num_col_tiles = CeilDiv(n, kSymTileColumns);
+  auto y_partials = TemporaryBuffer<T>(context_, queue_, num_col_tiles * n);
+  auto z_partials = TemporaryBuffer<T>(context_, queue_, num_row_tiles * n);
+
+  // Launches the main kernel, which reads each stored element of matrix A once
+  auto kernel1 = GetKernel(program_, "XsymvTiled");
+  kernel1.SetArgument(0, static_cast<int>(n));
+  kernel1.SetArgument(1, a_buffer());
+  kernel1.SetArgument(2, static_cast<int>(a_offset));
+  kernel1.SetArgument(3, static_cast<int>(a_ld));
+  kernel1.SetArgument(4, x_buffer());
+  kernel1.SetArgument(5, static_cast<int>(x_offset));
+  kernel1.SetArgument(6, static_cast<int>(x_inc));
+  kernel1.SetArgument(7, y_partials());
+  kernel1.SetArgument(8, z_partials());
+  kernel1.SetArgument(9, static_cast<int>(is_upper));
+  kernel1.SetArgument(10, static_cast<int>(a_conjugate));
+  auto eventWaitList = std::vector<Event>();
+  auto kernelEvent = Event();
+  auto global1 = ThreadRange{num_row_tiles * db_["WGS1"], num_col_tiles};
+  auto local1 = ThreadRange{db_["WGS1"], 1};
+  RunKernel(kernel1, queue_, device_, global1, local1, IntermediateEvent(queue_, kernelEvent));
+  eventWaitList.push_back(kernelEvent);
+
+  // Launches the epilogue kernel, which sums the partial results and applies alpha and beta
+  auto kernel2 = GetKernel(program_, "XsymvTiledEpilogue");
+  kernel2.SetArgument(0, static_cast<int>(n));
+  kernel2.SetArgument(1, static_cast<int>(num_row_tiles));
+  kernel2.SetArgument(2, static_cast<int>(num_col_tiles));
+  kernel2.SetArgument(3, GetRealArg(alpha));
+  kernel2.SetArgument(4, GetRealArg(beta));
+  kernel2.SetArgument(5, y_partials());
+  kernel2.SetArgument(6, z_partials());
+  kernel2.SetArgument(7, y_buffer());
+  kernel2.SetArgument(8, static_cast<int>(y_offset));
+  kernel2.SetArgument(9, static_cast<int>(y_inc));
+  auto global2 = ThreadRange{Ceil(n, db_["WGS1"])};
+  auto local2 = ThreadRange{db_["WGS1"]};
+  RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
+}
+
+// =================================================================================================
+
 // Compiles the templated class
 template class Xgemv<half>;
 template class Xgemv<float>;
@@ -36,6 +36,16 @@ class Xgemv: public Routine {
               const T beta,
               const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc);
 
+  // As above, but with alpha and beta read from device buffers by the kernel (the "GEMVDEVICE"
+  // routine). This always uses the general version of the kernel.
+  void DoGemvDevice(const Layout layout, const Transpose a_transpose,
+                    const size_t m, const size_t n,
+                    const Buffer<T> &alpha_buffer, const size_t alpha_offset,
+                    const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                    const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                    const Buffer<T> &beta_buffer, const size_t beta_offset,
+                    const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc);
+
   // Generic version used also for other matrix-vector multiplications
   void MatVec(const Layout layout, const Transpose a_transpose,
               const size_t m, const size_t n,
@@ -47,6 +57,50 @@ class Xgemv: public Routine {
               bool fast_kernel, bool fast_kernel_rot,
               const size_t parameter, const bool packed,
               const size_t kl, const size_t ku);
+
+  // Symmetric or hermitian version, which reads only the stored triangle of matrix A (selected by
+  // 'is_upper' in column-major terms). This requires the ROUTINE_SYMV or ROUTINE_HEMV define.
+  void SymMatVec(const size_t n,
+                 const T alpha,
+                 const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                 const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta,
+                 const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                 const bool is_upper, const bool a_conjugate);
+
+  // Computes only y = beta * y of 'batch_count' vectors 'y_stride' apart, for calls with a zero
+  // alpha of which A and x don't contribute to the result
+  void ScaleOnly(const size_t m, const T beta,
+                 const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                 const size_t y_stride, const size_t batch_count);
+
+  // Whether a call with these scalars can use 'ScaleOnly'. The half-precision variants of which
+  // the kernels compute in another precision are excluded (see 'AccumulationPrecision').
+  bool IsScaleOnly(const T alpha, const T beta) const {
+    return alpha == ConstantZero<T>() && !has_device_scalars_ &&
+           (beta == ConstantOne<T>() || precision_ == PrecisionValue<T>());
+  }
+
+ private:
+
+  // Version for short and wide matrices, which splits the 'n' dimension over work-groups in chunks
+  // of 'chunk_size' columns. The dimensions are those after an optional transpose.
+  void MatVecSplit(const size_t m, const size_t n, const size_t chunk_size,
+                   const T alpha, const bool a_rotated,
+                   const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                   const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                   const T beta,
+                   const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                   const bool a_conjugate, const size_t parameter,
+                   const size_t kl, const size_t ku);
+
+  // The size of a tile of matrix A processed by one work-group of the symmetric version: these have
+  // to match the values of 'SYMV_COLS' and 'SYMV_ROW_TILES' in the kernel
+  static constexpr size_t kSymTileColumns = 32;
+  static constexpr size_t kSymTileRowsPerThread = 8;
+
+  const bool has_device_scalars_;
+  DeviceScalars<T> device_scalars_;
 };
 
 // =================================================================================================
@@ -23,8 +23,8 @@ namespace clblast {
 template <typename T>
 Xger<T>::Xger(Queue &queue, EventPointer event, const std::string &name):
     Routine(queue, event, name, {"Xger"}, PrecisionValue<T>(), {}, {
-    #include "../../kernels/level2/level2.opencl"
-    #include "../../kernels/level2/xger.opencl"
+    KernelSource::kLevel2,
+    KernelSource::kXger
     }) {
 }
 
@@ -53,7 +53,7 @@ void Xger<T>::DoGer(const Layout layout,
   TestVectorY(n, y_buffer, y_offset, y_inc);
 
   // Retrieves the kernel from the compiled binary
-  auto kernel = Kernel(program_, "Xger");
+  auto kernel = GetKernel(program_, "Xger");
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(a_one));
@@ -73,8 +73,8 @@ void Xger<T>::DoGer(const Layout layout,
   // Launches the kernel
   auto a_one_ceiled = Ceil(CeilDiv(a_one, db_["WPT"]), db_["WGS1"]);
   auto a_two_ceiled = Ceil(CeilDiv(a_two, db_["WPT"]), db_["WGS2"]);
-  auto global = std::vector<size_t>{a_one_ceiled, a_two_ceiled};
-  auto local = std::vector<size_t>{db_["WGS1"], db_["WGS2"]};
+  auto global = ThreadRange{a_one_ceiled, a_two_ceiled};
+  auto local = ThreadRange{db_["WGS1"], db_["WGS2"]};
   RunKernel(kernel, queue_, device_, global, local, event_);
 }
 
@@ -41,9 +41,9 @@ void Xhbmv<T>::DoHbmv(const Layout layout, const Triangle triangle,
   size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                      (triangle == Triangle::kLower && layout == Layout::kRowMajor));
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific hermitian banded matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_HBMV define.
+  // Runs the banded matrix-vector multiplication kernel, disabling the use of fast vectorized
+  // kernels. The specific hermitian banded matrix-accesses are implemented in the kernel guarded by
+  // the ROUTINE_HBMV define.
   bool fast_kernels = false;
   MatVec(layout, Transpose::kNo,
          n, n, alpha,
@@ -37,21 +37,21 @@ void Xhemv<T>::DoHemv(const Layout layout, const Triangle triangle,
                       const T beta,
                       const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc) {
 
-  // The data is either in the upper or lower triangle
-  size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
-                     (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+  // The data is either in the upper or lower triangle. A row-major matrix is seen by the kernels as
+  // its (column-major) transpose, which is the conjugate of the hermitian matrix with the other
+  // triangle stored: its values are conjugated as they are loaded.
+  const auto is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
+                         (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+  const auto a_conjugate = (layout == Layout::kRowMajor);
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific hermitian matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_HEMV define.
-  bool fast_kernels = false;
-  MatVec(layout, Transpose::kNo,
-         n, n, alpha,
-         a_buffer, a_offset, a_ld,
-         x_buffer, x_offset, x_inc, beta,
-         y_buffer, y_offset, y_inc,
-         fast_kernels, fast_kernels,
-         is_upper, false, 0, 0);
+  // Runs the hermitian matrix-vector multiplication, which reads only the stored triangle. The
+  // specific hermitian matrix-accesses are implemented in the kernel guarded by the ROUTINE_HEMV
+  // define.
+  SymMatVec(n, alpha,
+            a_buffer, a_offset, a_ld,
+            x_buffer, x_offset, x_inc, beta,
+            y_buffer, y_offset, y_inc,
+            is_upper, a_conjugate);
 }
 
 // =================================================================================================
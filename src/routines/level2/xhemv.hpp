@@ -26,8 +26,8 @@ template <typename T>
 class Xhemv: public Xgemv<T> {
  public:
 
-  // Uses the generic matrix-vector routine
-  using Xgemv<T>::MatVec;
+  // Uses the symmetric/hermitian matrix-vector routine
+  using Xgemv<T>::SymMatVec;
 
   // Constructor
   Xhemv(Queue &queue, EventPointer event, const std::string &name = "HEMV");
@@ -22,8 +22,8 @@ namespace clblast {
 template <typename T, typename U>
 Xher<T,U>::Xher(Queue &queue, EventPointer event, const std::string &name):
     Routine(queue, event, name, {"Xger"}, PrecisionValue<T>(), {}, {
-    #include "../../kernels/level2/level2.opencl"
-    #include "../../kernels/level2/xher.opencl"
+    KernelSource::kLevel2,
+    KernelSource::kXher
     }) {
 }
 
@@ -67,7 +67,7 @@ void Xher<T,U>::DoHer(const Layout layout, const Triangle triangle,
   const auto matching_alpha = GetAlpha(alpha);
 
   // Retrieves the kernel from the compiled binary
-  auto kernel = Kernel(program_, "Xher");
+  auto kernel = GetKernel(program_, "Xher");
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(n));
@@ -84,8 +84,8 @@ void Xher<T,U>::DoHer(const Layout layout, const Triangle triangle,
   // Launches the kernel
   auto global_one = Ceil(CeilDiv(n, db_["WPT"]), db_["WGS1"]);
   auto global_two = Ceil(CeilDiv(n, db_["WPT"]), db_["WGS2"]);
-  auto global = std::vector<size_t>{global_one, global_two};
-  auto local = std::vector<size_t>{db_["WGS1"], db_["WGS2"]};
+  auto global = ThreadRange{global_one, global_two};
+  auto local = ThreadRange{db_["WGS1"], db_["WGS2"]};
   RunKernel(kernel, queue_, device_, global, local, event_);
 }
 
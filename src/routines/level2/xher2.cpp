@@ -22,8 +22,8 @@ namespace clblast {
 template <typename T>
 Xher2<T>::Xher2(Queue &queue, EventPointer event, const std::string &name):
     Routine(queue, event, name, {"Xger"}, PrecisionValue<T>(), {}, {
-    #include "../../kernels/level2/level2.opencl"
-    #include "../../kernels/level2/xher2.opencl"
+    KernelSource::kLevel2,
+    KernelSource::kXher2
     }) {
 }
 
@@ -54,7 +54,7 @@ void Xher2<T>::DoHer2(const Layout layout, const Triangle triangle,
   TestVectorY(n, y_buffer, y_offset, y_inc);
 
   // Retrieves the kernel from the compiled binary
-  auto kernel = Kernel(program_, "Xher2");
+  auto kernel = GetKernel(program_, "Xher2");
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(n));
@@ -74,8 +74,8 @@ void Xher2<T>::DoHer2(const Layout layout, const Triangle triangle,
   // Launches the kernel
   auto global_one = Ceil(CeilDiv(n, db_["WPT"]), db_["WGS1"]);
   auto global_two = Ceil(CeilDiv(n, db_["WPT"]), db_["WGS2"]);
-  auto global = std::vector<size_t>{global_one, global_two};
-  auto local = std::vector<size_t>{db_["WGS1"], db_["WGS2"]};
+  auto global = ThreadRange{global_one, global_two};
+  auto local = ThreadRange{db_["WGS1"], db_["WGS2"]};
   RunKernel(kernel, queue_, device_, global, local, event_);
 }
 
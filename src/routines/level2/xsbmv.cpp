@@ -41,9 +41,9 @@ void Xsbmv<T>::DoSbmv(const Layout layout, const Triangle triangle,
   size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                      (triangle == Triangle::kLower && layout == Layout::kRowMajor));
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific symmetric banded matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_SBMV define.
+  // Runs the banded matrix-vector multiplication kernel, disabling the use of fast vectorized
+  // kernels. The specific symmetric banded matrix-accesses are implemented in the kernel guarded by
+  // the ROUTINE_SBMV define.
   bool fast_kernels = false;
   MatVec(layout, Transpose::kNo,
          n, n, alpha,
@@ -29,6 +29,9 @@ class Xtbmv: public Xgemv<T> {
   // Uses the generic matrix-vector routine
   using Xgemv<T>::queue_;
   using Xgemv<T>::context_;
+  using Xgemv<T>::device_;
+  using Xgemv<T>::db_;
+  using Xgemv<T>::program_;
   using Xgemv<T>::MatVec;
 
   // Constructor
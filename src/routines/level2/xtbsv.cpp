@@ -0,0 +1,61 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtbsv class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/level2/xtbsv.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xtbsv<T>::Xtbsv(Queue &queue, EventPointer event, const std::string &name):
+    Xtrsv<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xtbsv<T>::DoTbsv(const Layout layout, const Triangle triangle,
+                      const Transpose a_transpose, const Diagonal diagonal,
+                      const size_t n, const size_t k,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix and vector
+  TestMatrixA(k + 1, n, a_buffer, a_offset, a_ld);
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+
+  // Solves the system in-place. The specific banded matrix-accesses are implemented in the kernel
+  // guarded by the ROUTINE_TBSV define.
+  StoredSubstitution(layout, triangle, a_transpose, diagonal, n, k,
+                     a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xtbsv<half>;
+template class Xtbsv<float>;
+template class Xtbsv<double>;
+template class Xtbsv<float2>;
+template class Xtbsv<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,47 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtbsv routine. It is based on the block-wise substitution of the Xtrsv
+// routine: the Xtbsv class inherits from the templated class Xtrsv. Only the banded storage of the
+// triangular matrix is read, no dense copy of the matrix is made.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTBSV_H_
+#define CLBLAST_ROUTINES_XTBSV_H_
+
+#include "routines/level2/xtrsv.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xtbsv: public Xtrsv<T> {
+ public:
+
+  // Uses the block-wise substitution of the triangular solver
+  using Xtrsv<T>::StoredSubstitution;
+
+  // Constructor
+  Xtbsv(Queue &queue, EventPointer event, const std::string &name = "TBSV");
+
+  // Templated-precision implementation of the routine
+  void DoTbsv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n, const size_t k,
+              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+              const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XTBSV_H_
+#endif
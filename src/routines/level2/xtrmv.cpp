@@ -35,9 +35,19 @@ void Xtrmv<T>::DoTrmv(const Layout layout, const Triangle triangle,
                       const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                       const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
 
-  // Creates a copy of X: a temporary scratch buffer
-  auto scratch_buffer = Buffer<T>(context_, n*x_inc + x_offset);
-  x_buffer.CopyTo(queue_, n*x_inc + x_offset, scratch_buffer);
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vector before gathering it, the matrix is tested by the generic routine
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+
+  // Creates a contiguous copy of X: a temporary scratch buffer of only 'n' elements
+  auto scratch_buffer = TemporaryBuffer<T>(context_, queue_, n);
+  auto eventWaitList = std::vector<Event>();
+  auto copy_vector_event = Event();
+  CopyVector(queue_, device_, program_, db_, copy_vector_event.pointer(), eventWaitList,
+             n, x_buffer, x_offset, x_inc, scratch_buffer, 0, 1);
+  copy_vector_event.WaitForCompletion();
 
   // The data is either in the upper or lower triangle
   size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
@@ -54,7 +64,7 @@ void Xtrmv<T>::DoTrmv(const Layout layout, const Triangle triangle,
     MatVec(layout, a_transpose,
            n, n, ConstantOne<T>(),
            a_buffer, a_offset, a_ld,
-           scratch_buffer, x_offset, x_inc, ConstantZero<T>(),
+           scratch_buffer, 0, 1, ConstantZero<T>(),
            x_buffer, x_offset, x_inc,
            fast_kernels, fast_kernels,
            parameter, false, 0, 0);
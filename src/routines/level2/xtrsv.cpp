@@ -28,50 +28,64 @@ Xtrsv<T>::Xtrsv(Queue &queue, EventPointer event, const std::string &name):
 // =================================================================================================
 
 template <typename T>
-void Xtrsv<T>::Substitution(const Layout layout, const Triangle triangle,
-                            const Transpose a_transpose, const Diagonal diagonal,
-                            const size_t n,
-                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
-                            const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_inc,
-                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
-
-  if (n > db_["TRSV_BLOCK_SIZE"]) { throw BLASError(StatusCode::kUnexpectedError); };
-
-  // Translates CLBlast arguments to 0/1 integers for the OpenCL kernel
+void Xtrsv<T>::StoredSubstitution(const Layout layout, const Triangle triangle,
+                                  const Transpose a_transpose, const Diagonal diagonal,
+                                  const size_t n, const size_t k,
+                                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
+
+  // Translates CLBlast arguments to 0/1 integers for the OpenCL kernel. The storage holds the upper
+  // or lower triangle of a column-major matrix: row-major storage is the transpose of that.
   const auto is_unit_diagonal = (diagonal == Diagonal::kNonUnit) ? 0 : 1;
+  const auto is_upper = ((triangle == Triangle::kUpper && layout == Layout::kColMajor) ||
+                         (triangle == Triangle::kLower && layout != Layout::kColMajor)) ? 1 : 0;
   const auto is_transposed = ((a_transpose == Transpose::kNo && layout == Layout::kColMajor) ||
                               (a_transpose != Transpose::kNo && layout != Layout::kColMajor)) ? 0 : 1;
   const auto do_conjugate = (a_transpose == Transpose::kConjugate) ? 1 : 0;
 
-  // The data is either in the upper or lower triangle
-  const auto is_upper = ((triangle == Triangle::kUpper && a_transpose == Transpose::kNo) ||
-                         (triangle == Triangle::kLower && a_transpose != Transpose::kNo));
+  // Forward substitution for lower triangular systems, backward substitution otherwise
+  const auto is_forward = (is_upper == is_transposed) ? 1 : 0;
 
   // Retrieves the kernel from the compiled binary
-  const auto kernel_name = (is_upper) ? "trsv_backward" : "trsv_forward";
-  auto kernel = Kernel(program_, kernel_name);
+  auto kernel = GetKernel(program_, "trsv_stored_block");
 
-  // Sets the kernel arguments
+  // Sets the kernel arguments which are the same for all blocks
   kernel.SetArgument(0, static_cast<int>(n));
-  kernel.SetArgument(1, a_buffer());
-  kernel.SetArgument(2, static_cast<int>(a_offset));
-  kernel.SetArgument(3, static_cast<int>(a_ld));
-  kernel.SetArgument(4, b_buffer());
-  kernel.SetArgument(5, static_cast<int>(b_offset));
-  kernel.SetArgument(6, static_cast<int>(b_inc));
+  kernel.SetArgument(1, static_cast<int>(k));
+  kernel.SetArgument(4, a_buffer());
+  kernel.SetArgument(5, static_cast<int>(a_offset));
+  kernel.SetArgument(6, static_cast<int>(a_ld));
   kernel.SetArgument(7, x_buffer());
   kernel.SetArgument(8, static_cast<int>(x_offset));
   kernel.SetArgument(9, static_cast<int>(x_inc));
-  kernel.SetArgument(10, static_cast<int>(is_transposed));
-  kernel.SetArgument(11, static_cast<int>(is_unit_diagonal));
-  kernel.SetArgument(12, static_cast<int>(do_conjugate));
-
-  // Launches the kernel
-  const auto local = std::vector<size_t>{db_["TRSV_BLOCK_SIZE"]};
-  const auto global = std::vector<size_t>{1};
-  auto event = Event();
-  RunKernel(kernel, queue_, device_, global, local, event.pointer());
-  event.WaitForCompletion();
+  kernel.SetArgument(10, static_cast<int>(is_upper));
+  kernel.SetArgument(11, static_cast<int>(is_transposed));
+  kernel.SetArgument(12, static_cast<int>(is_forward));
+  kernel.SetArgument(13, static_cast<int>(is_unit_diagonal));
+  kernel.SetArgument(14, static_cast<int>(do_conjugate));
+
+  // Loops over the blocks, each depending on the results of the previous ones
+  const auto local = ThreadRange{db_["TRSV_BLOCK_SIZE"]};
+  const auto global = ThreadRange{db_["TRSV_BLOCK_SIZE"]};
+  auto col = n; // the initial column position
+  auto events = std::vector<Event>();
+  for (auto i = size_t{0}; i < n; i += db_["TRSV_BLOCK_SIZE"]) {
+    const auto block_size = std::min(db_["TRSV_BLOCK_SIZE"], n - i);
+    col = (is_forward) ? i : col - block_size;
+    kernel.SetArgument(2, static_cast<int>(col));
+    kernel.SetArgument(3, static_cast<int>(block_size));
+
+    // The last block signals the user event
+    if (i + block_size >= n) {
+      RunKernel(kernel, queue_, device_, global, local, this->event_, events);
+    }
+    else {
+      auto block_event = Event();
+      RunKernel(kernel, queue_, device_, global, local,
+                IntermediateEvent(queue_, block_event), events);
+      events = {block_event};
+    }
+  }
 }
 
 // =================================================================================================
@@ -91,64 +105,42 @@ void Xtrsv<T>::DoTrsv(const Layout layout, const Triangle triangle,
   TestMatrixA(n, n, a_buffer, a_offset, a_ld);
   TestVectorX(n, b_buffer, b_offset, b_inc);
 
-  // Creates a copy of B to avoid overwriting input while computing output
-  // TODO: Make x with 0 offset and unit increment by creating custom copy-to and copy-from kernels
-  const auto x_offset = b_offset;
-  const auto x_inc = b_inc;
-  const auto x_size = n*x_inc + x_offset;
-  auto x_buffer = Buffer<T>(context_, x_size);
-  b_buffer.CopyTo(queue_, x_size, x_buffer);
-
-  // Fills the output buffer with zeros
-  auto eventWaitList = std::vector<Event>();
-  auto fill_vector_event = Event();
-  FillVector(queue_, device_, program_, db_, fill_vector_event.pointer(), eventWaitList,
-             n, x_inc, x_offset, x_buffer, ConstantZero<T>());
-  fill_vector_event.WaitForCompletion();
+  // Translates CLBlast arguments to 0/1 integers for the OpenCL kernel
+  const auto is_unit_diagonal = (diagonal == Diagonal::kNonUnit) ? 0 : 1;
+  const auto is_transposed = ((a_transpose == Transpose::kNo && layout == Layout::kColMajor) ||
+                              (a_transpose != Transpose::kNo && layout != Layout::kColMajor)) ? 0 : 1;
+  const auto do_conjugate = (a_transpose == Transpose::kConjugate) ? 1 : 0;
 
-  // Derives properties based on the arguments
+  // Forward substitution for lower triangular systems, backward substitution otherwise
   const auto is_upper = ((triangle == Triangle::kUpper && a_transpose == Transpose::kNo) ||
                          (triangle == Triangle::kLower && a_transpose != Transpose::kNo));
-  const auto is_transposed = ((layout == Layout::kColMajor && a_transpose == Transpose::kNo) ||
-                              (layout != Layout::kColMajor && a_transpose != Transpose::kNo));
-
-  // Loops over the blocks
-  auto col = n; // the initial column position
-  for (auto i = size_t{0}; i < n; i += db_["TRSV_BLOCK_SIZE"]) {
-    const auto block_size = std::min(db_["TRSV_BLOCK_SIZE"], n - i);
-
-    // Sets the next column position
-    col = (is_upper) ? col - block_size : i;
-
-    // Sets the offsets for upper or lower triangular
-    const auto extra_offset_a = (is_transposed) ?
-                                (is_upper ? col + (col+block_size)*a_ld : col) :
-                                (is_upper ? col+block_size + col*a_ld : col*a_ld);
-    const auto extra_offset_x = (is_upper) ? (col+block_size)*x_inc : 0;
-    const auto extra_offset_b = col*x_inc;
-
-    // Runs the GEMV routine to compute x' = A * x
-    if (i > 0) {
-      const auto gemv_m = (a_transpose == Transpose::kNo) ? block_size : i;
-      const auto gemv_n = (a_transpose == Transpose::kNo) ? i : block_size;
-      auto gemv_event = Event();
-      auto gemv = Xgemv<T>(queue_, gemv_event.pointer());
-      gemv.DoGemv(layout, a_transpose, gemv_m, gemv_n, ConstantOne<T>(),
-                  a_buffer, a_offset + extra_offset_a, a_ld,
-                  x_buffer, x_offset + extra_offset_x, x_inc, ConstantOne<T>(),
-                  x_buffer, x_offset + extra_offset_b, x_inc);
-      gemv_event.WaitForCompletion();
-    }
+  const auto is_forward = (is_upper) ? 0 : 1;
 
-    // Runs the triangular substitution for the block size
-    Substitution(layout, triangle, a_transpose, diagonal, block_size,
-                 a_buffer, a_offset + col + col*a_ld, a_ld,
-                 b_buffer, b_offset + col*b_inc, b_inc,
-                 x_buffer, x_offset + col*x_inc, x_inc);
-  }
+  // The flags through which the work-groups wait for the blocks they depend on: a ticket counter
+  // followed by a flag per block
+  const auto num_blocks = CeilDiv(n, db_["TRSV_BLOCK_SIZE"]);
+  auto eventWaitList = std::vector<Event>();
+  const auto flags = SynchronisationFlags(context_, queue_, num_blocks + 1, eventWaitList);
 
-  // Retrieves the results
-  x_buffer.CopyTo(queue_, x_size, b_buffer);
+  // Retrieves the kernel from the compiled binary and sets its arguments
+  auto kernel = GetKernel(program_, "trsv_single_pass");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, a_buffer());
+  kernel.SetArgument(2, static_cast<int>(a_offset));
+  kernel.SetArgument(3, static_cast<int>(a_ld));
+  kernel.SetArgument(4, b_buffer());
+  kernel.SetArgument(5, static_cast<int>(b_offset));
+  kernel.SetArgument(6, static_cast<int>(b_inc));
+  kernel.SetArgument(7, flags());
+  kernel.SetArgument(8, static_cast<int>(is_forward));
+  kernel.SetArgument(9, static_cast<int>(is_transposed));
+  kernel.SetArgument(10, static_cast<int>(is_unit_diagonal));
+  kernel.SetArgument(11, static_cast<int>(do_conjugate));
+
+  // Launches the kernel: a work-group per block, all solved in a single launch
+  const auto local = ThreadRange{db_["TRSV_BLOCK_SIZE"]};
+  const auto global = ThreadRange{num_blocks * db_["TRSV_BLOCK_SIZE"]};
+  RunKernel(kernel, queue_, device_, global, local, this->event_, eventWaitList);
 }
 
 // =================================================================================================
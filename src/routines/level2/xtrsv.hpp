@@ -7,9 +7,10 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xtrsv routine. It uses a block-algorithm and performs small triangular
-// forward and backward substitutions on the diagonal parts of the matrix in combination with larger
-// GEMV computation on the remainder of the matrix.
+// This file implements the Xtrsv routine. It uses a block-algorithm in a single kernel launch: a
+// work-group per block of unknowns waits for the blocks it depends on through flags in global
+// memory, subtracts their contributions, and solves its diagonal block by forward or backward
+// substitution in local memory.
 //
 // =================================================================================================
 
@@ -44,13 +45,13 @@ class Xtrsv: public Xgemv<T> {
               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
               const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc);
 
-  // Performs forward or backward substitution on a small triangular matrix
-  void Substitution(const Layout layout, const Triangle triangle,
-                    const Transpose a_transpose, const Diagonal diagonal,
-                    const size_t n,
-                    const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
-                    const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_inc,
-                    const Buffer<T> &x_buffer, const size_t offset_x, const size_t x_inc);
+  // Solves a triangular system in banded (with 'k' super- or sub-diagonals) or packed storage
+  // in-place, block by block, reading only the stored elements. Used by the TBSV and TPSV routines.
+  void StoredSubstitution(const Layout layout, const Triangle triangle,
+                          const Transpose a_transpose, const Diagonal diagonal,
+                          const size_t n, const size_t k,
+                          const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc);
 };
 
 // =================================================================================================
@@ -12,37 +12,107 @@
 // =================================================================================================
 
 #include "routines/level3/xgemm.hpp"
+#include "gemm_shapes.hpp"
 
+#include <cstdlib>
 #include <string>
 #include <vector>
+#include <algorithm>
+
+#ifdef OPENCL_API
+  #include "online_tuning.hpp"
+  #include "explanation.hpp"
+#endif
 
 namespace clblast {
 // =================================================================================================
 
-// Constructor: forwards to base class constructor
+// Creates a 2D image of 'width' by 'height' texels of four elements of type 'T' for the image
+// version of GEMM, which is released when the last copy of the returned object is destroyed
+template <typename T>
+Buffer<T> CreateGemmImage(const Context &context, const size_t width, const size_t height) {
+  #ifdef OPENCL_API
+    const auto channel_type = (PrecisionValue<T>() == Precision::kHalf) ? CL_HALF_FLOAT : CL_FLOAT;
+    const auto format = cl_image_format{CL_RGBA, static_cast<cl_channel_type>(channel_type)};
+    auto description = cl_image_desc();
+    description.image_type = CL_MEM_OBJECT_IMAGE2D;
+    description.image_width = width;
+    description.image_height = height;
+    auto status = CL_SUCCESS;
+    const auto image = clCreateImage(context(), CL_MEM_READ_WRITE, &format, &description, nullptr,
+                                     &status);
+    CLCudaAPIError::Check(status, "clCreateImage");
+    return Buffer<T>(std::shared_ptr<cl_mem>(new cl_mem(image), [](cl_mem* m) {
+      CheckErrorDtor(clReleaseMemObject(*m));
+      delete m;
+    }));
+  #else
+    throw BLASError(StatusCode::kNotImplemented);
+  #endif
+}
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor. The GEMM kernels are split over several programs
+// (see 'GemmProgram'), such that only the programs of the code paths taken are compiled.
 template <typename T>
 Xgemm<T>::Xgemm(Queue &queue, EventPointer event, const std::string &name):
     Routine(queue, event, name,
-            {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect","GemmRoutine"},
-            PrecisionValue<T>(), {}, {
-    #include "../../kernels/level3/level3.opencl"
-    #include "../../kernels/level3/copy_fast.opencl"
-    #include "../../kernels/level3/copy_pad.opencl"
-    #include "../../kernels/level3/transpose_fast.opencl"
-    #include "../../kernels/level3/transpose_pad.opencl"
-    #include "../../kernels/level3/convert_symmetric.opencl"
-    #include "../../kernels/level3/convert_triangular.opencl"
-    #include "../../kernels/level3/convert_hermitian.opencl"
-    , // separated in multiple parts to prevent C1091 in MSVC 2013
-    #include "../../kernels/level3/xgemm_direct_part1.opencl"
-    #include "../../kernels/level3/xgemm_direct_part2.opencl"
-    #include "../../kernels/level3/xgemm_direct_part3.opencl"
-    , // separated in multiple parts to prevent C1091 in MSVC 2013
-    #include "../../kernels/level3/xgemm_part1.opencl"
-    #include "../../kernels/level3/xgemm_part2.opencl"
-    #include "../../kernels/level3/xgemm_part3.opencl"
-    #include "../../kernels/level3/xgemm_part4.opencl"
-    }) {
+            {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect","GemmRoutine",
+             "XgemmSkinny"},
+            KernelPrecision(queue, name), {}, {
+    KernelSource::kLevel3,
+    KernelSource::kXgemmEpilogue
+    }, {
+      { // GemmProgram::kProcessing
+    KernelSource::kCopyFast,
+    KernelSource::kCopyPad,
+    KernelSource::kTransposeFast,
+    KernelSource::kTransposePad,
+    KernelSource::kConvertSymmetric,
+    KernelSource::kConvertTriangular,
+    KernelSource::kConvertHermitian
+      }, { // GemmProgram::kDirect
+    KernelSource::kXgemmDirectPart1,
+    KernelSource::kXgemmDirectPart2,
+    KernelSource::kXgemmDirectPart3,
+    KernelSource::kXgemmDirectFast,
+    KernelSource::kXgemmSplitk
+      }, { // GemmProgram::kIndirect
+    KernelSource::kXgemmPart1,
+    KernelSource::kXgemmPart2,
+    KernelSource::kXgemmPart3,
+    KernelSource::kXgemmTensor,
+    KernelSource::kXgemmPart4,
+    KernelSource::kXgemm3m,
+    KernelSource::kXgemmStrassen
+      }, { // GemmProgram::kSkinny
+    KernelSource::kXgemmSkinny
+      }, { // GemmProgram::kImage
+    KernelSource::kXgemmImage
+      }
+    }),
+    has_epilogue_(name == "GEMMEPILOGUE"),
+    epilogue_{EpilogueBias::kNone, Buffer<T>(0), 0, EpilogueActivation::kNone,
+              ConstantZero<T>(), ConstantOne<T>()},
+    has_structure_(name == "SYMM" || name == "HEMM" || name == "TRMM"),
+    structure_{0, false, false},
+    has_device_scalars_(name == "GEMMDEVICE"),
+    device_scalars_{Buffer<T>(0), 0, Buffer<T>(0), 0},
+    has_output_(name == "GEMMOUTOFPLACE"),
+    output_{Buffer<T>(0), 0, 0},
+    strassen_depth_(0) {
+}
+
+// =================================================================================================
+
+// Selects the mixed half/single precision for half-precision data if requested. Only the regular
+// GEMM routine falls back to the storage-only half precision on devices without FP16 support.
+template <typename T>
+Precision Xgemm<T>::KernelPrecision(const Queue &queue, const std::string &name) {
+  if (PrecisionValue<T>() != Precision::kHalf) { return PrecisionValue<T>(); }
+  const auto precision = AccumulationPrecision(PrecisionValue<T>());
+  return (name == "GEMM") ? HalfStoragePrecision(queue, precision) : precision;
 }
 
 // =================================================================================================
@@ -59,9 +129,58 @@ void Xgemm<T>::DoGemm(const Layout layout,
                       const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
                       const Buffer<T> &temp_buffer, const bool temp_buffer_provided) { // optional arguments
 
-  // Two methods to choose from, select which one to run
-  const auto do_gemm_direct = UseDirectKernel(m, n, k, db_["XGEMM_MIN_INDIRECT_SIZE"]);
-  const auto gemm_kernel_id = (do_gemm_direct) ? 0 : db_["GEMMK"];
+  // Selects the kernel parameters for this problem size (if there are size-specific ones)
+  SelectSizeVariant(GetProblemSize(m, n, k));
+  const auto &params = db_.GetFlatParameters();
+
+  // Matrices of more than 2^31 elements are only supported by the direct kernel with 64-bit indices
+  // (see 'RequiresIndex64'). The extents are bounded using the larger of the matrix dimensions.
+  const auto index64 = RequiresIndex64({a_offset + a_ld * std::max(m, k),
+                                        b_offset + b_ld * std::max(n, k),
+                                        c_offset + c_ld * std::max(m, n),
+                                        output_.d_offset + output_.d_ld * std::max(m, n)});
+
+  // Seven methods to choose from, select which one to run. The split-K version is based on the
+  // direct kernel and does not support an epilogue nor a structured input matrix. The latter is
+  // only supported by the direct kernel. The skinny version for a small 'n' or 'm' has the same
+  // restrictions and uses the arguments of the direct kernel. The 3M version for complex data
+  // replaces the indirect version (if enabled in the database) and does not support an epilogue
+  // either. The same holds for the Strassen-Winograd version for real data, which is also not used
+  // if the user provided a temporary buffer. The image version for single and half precision on
+  // mobile GPUs has the same restrictions as the 3M version, and is not used in mixed-precision mode.
+  // Scalars read from device buffers are only supported by the direct kernel as well. A separate
+  // output matrix D is only supported by the direct and the indirect versions.
+  const auto is_structured = has_structure_ && structure_.operand != 0;
+  const auto do_gemm_splitk = !index64 && !has_epilogue_ && !is_structured && !has_device_scalars_ &&
+                              !has_output_ &&
+                              UseSplitKernel(m, n, k, params.gemm_routine.min_splitk_k,
+                                             params.xgemm_direct.wgd);
+  const auto do_gemm_skinny = !index64 && !do_gemm_splitk && !has_epilogue_ && !is_structured &&
+                              !has_device_scalars_ && !has_output_ && UseSkinnyKernel(m, n);
+  const auto do_gemm_direct = index64 || do_gemm_splitk || is_structured || has_device_scalars_ ||
+                              (!do_gemm_skinny &&
+                               UseDirectKernel(layout, a_transpose, b_transpose, m, n, k,
+                                               a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
+                                               params));
+  const auto do_gemm_3m = !do_gemm_direct && !do_gemm_skinny && !has_epilogue_ && !has_output_ &&
+                          Use3MKernel(m, n, k, params.gemm_routine.min_3m_size);
+  const auto do_gemm_strassen = !do_gemm_direct && !do_gemm_skinny && !has_epilogue_ &&
+                                !has_output_ && !temp_buffer_provided &&
+                                UseStrassenKernel(m, n, k, params.gemm_routine.min_strassen_size,
+                                                  strassen_depth_);
+  const auto do_gemm_image = !do_gemm_direct && !do_gemm_skinny && !do_gemm_strassen &&
+                             !has_epilogue_ && !has_output_ &&
+                             precision_ == PrecisionValue<T>() && // not mixed-precision
+                             params.gemm_routine.min_image_size != 0 && device_.SupportsImages() &&
+                             UseImageKernel(m, n, k, params.gemm_routine.min_image_size,
+                                            device_.MaxImage2DWidth(), device_.MaxImage2DHeight());
+  const auto gemm_kernel_id = (do_gemm_direct || do_gemm_skinny || do_gemm_image) ? 0 : params.xgemm.gemmk;
+  #ifdef OPENCL_API
+    ExplainGemmPath((do_gemm_splitk) ? "split-k" : (do_gemm_skinny) ? "skinny" :
+                    (do_gemm_direct) ? "direct" : (do_gemm_3m) ? "3m" :
+                    (do_gemm_strassen) ? "strassen" : (do_gemm_image) ? "image" : "indirect",
+                    gemm_kernel_id);
+  #endif
 
   // Computes the transpose/conjugate options and sets the a/b/c sizes based on that
   bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
@@ -78,29 +197,246 @@ void Xgemm<T>::DoGemm(const Layout layout,
   //    matrix A cannot be less than K when rotated, or less than M when not-rotated
   //    matrix B cannot be less than N when rotated, or less than K when not-rotated
   //    matrix C cannot be less than N when rotated, or less than M when not-rotated
-  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
-  TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
-  TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld, true, true);
+  TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld, true, true);
+  TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld, true);
+  if (has_output_) {
+    TestMatrixC(c_one, c_two, output_.d_buffer, output_.d_offset, output_.d_ld, true);
+  }
+  if (has_epilogue_) { TestEpilogue(epilogue_, m, n); }
+  if (has_device_scalars_) {
+    TestVectorScalar(1, device_scalars_.alpha_buffer, device_scalars_.alpha_offset);
+    TestVectorScalar(1, device_scalars_.beta_buffer, device_scalars_.beta_offset);
+  }
+
+  // With a zero alpha, A and B don't contribute to the result: only C = beta * C is computed. The
+  // scaling kernel uses 32-bit indices, so matrices which need 64-bit indices use the direct kernel.
+  if (alpha == ConstantZero<T>() && !index64 && !has_epilogue_ && !has_device_scalars_ &&
+      !has_output_) {
+    ScaleMatrix(queue_, device_, GetGemmProgram(GemmProgram::kProcessing), event_, input_events_,
+                c_one, c_two, c_ld, c_offset, c_buffer, beta);
+    return;
+  }
 
   // Selects which version of GEMM to run
-  if (do_gemm_direct) { // for small sizes (single kernel)
-    GemmDirect(m, n, k, alpha,
+  if (do_gemm_splitk) { // for small m and n but large k (partial results plus a reduction)
+    GemmSplitK(m, n, k, alpha,
+               a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+               c_buffer, c_offset, c_ld,
+               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate);
+  }
+  else if (do_gemm_skinny) { // for a small 'n' or 'm' (single kernel)
+    GemmSkinny(m, n, k, alpha,
                a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
                c_buffer, c_offset, c_ld,
                a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate);
   }
+  else if (do_gemm_direct) { // for small sizes (single kernel)
+    GemmDirect(m, n, k, alpha,
+               a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+               c_buffer, c_offset, c_ld,
+               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+               index64);
+  }
+  else if (do_gemm_3m) { // for large complex sizes (three real-valued GEMMs)
+    Gemm3M(layout, a_transpose, b_transpose, m, n, k, alpha,
+           a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+           c_buffer, c_offset, c_ld,
+           a_one, a_two, b_one, b_two, c_one, c_two);
+  }
+  else if (do_gemm_strassen) { // for very large real sizes (seven GEMMs on the quadrants)
+    GemmStrassen(layout, a_transpose, b_transpose, m, n, k, alpha,
+                 a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+                 c_buffer, c_offset, c_ld);
+  }
+  else if (do_gemm_image) { // for larger single and half sizes on mobile GPUs (images of A and B)
+    GemmImage(layout, a_transpose, b_transpose, m, n, k, alpha,
+              a_buffer, a_offset, a_ld, false, b_buffer, b_offset, b_ld, false, beta,
+              c_buffer, c_offset, c_ld);
+  }
   else { // for larger sizes (pre/post-processing plus a very fast kernel)
+    #ifdef OPENCL_API
+      if (IsOnlineTuningEnabled() && precision_ == PrecisionValue<T>() && // not mixed-precision
+          ExplanationScope::Current() == nullptr) {
+        RecordOnlineTuningShape(device_, precision_, GetProblemSize(m, n, k), m, n, k);
+      }
+    #endif
+    const auto shape_specialised = IsGemmShapeRegistered(device_(), PrecisionValue<T>(), layout,
+                                                         a_transpose, b_transpose, m, n, k);
+
+    // Large problems are computed in blocks in case their temporary buffers would exceed the
+    // workspace limit or their work the chunk limit, unless the user provided a temporary buffer
+    const auto workspace_limit = GemmWorkspace::GetLimit(device_) / sizeof(T);
+    const auto chunk_limit = GemmWorkspace::GetChunkLimit();
+    if (!temp_buffer_provided &&
+        ((chunk_limit != 0 && m * n * k > chunk_limit) ||
+         GetTempSize(layout, a_transpose, b_transpose, m, n, k,
+                     a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
+                     params.xgemm.mwg, params.xgemm.nwg, params.xgemm.kwg * params.xgemm.kreg,
+                     gemm_kernel_id) > workspace_limit)) {
+      GemmIndirectBlocked(layout, a_transpose, b_transpose, m, n, k, alpha,
+                          a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+                          c_buffer, c_offset, c_ld,
+                          gemm_kernel_id, workspace_limit, chunk_limit);
+      return;
+    }
     GemmIndirect(m, n, k, alpha,
                  a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
                  c_buffer, c_offset, c_ld,
                  a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
                  a_one, a_two, b_one, b_two, c_one, c_two,
-                 temp_buffer, temp_buffer_provided);
+                 temp_buffer, temp_buffer_provided, false, false, shape_specialised);
   }
 }
 
 // =================================================================================================
 
+// Packs matrix A or B into the layout of the indirect GEMM kernel's temporary buffers
+template <typename T>
+void Xgemm<T>::DoPackOperand(const Layout layout, const GemmOperand operand, const Transpose transpose,
+                             const size_t m, const size_t n, const size_t k,
+                             const Buffer<T> &buffer, const size_t offset, const size_t ld,
+                             const Buffer<T> &packed_buffer) {
+  SelectSizeVariant(GetProblemSize(m, n, k));
+  const auto &params = db_.GetFlatParameters();
+  const auto is_a = (operand == GemmOperand::kA);
+  const auto gemm_kernel_id = params.xgemm.gemmk;
+
+  // Computes the transpose/conjugate options and the sizes of the operand to pack
+  bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+  size_t a_one, a_two, b_one, b_two, c_one, c_two;
+  ProcessArguments(layout, (is_a) ? transpose : Transpose::kNo, (is_a) ? Transpose::kNo : transpose,
+                   m, n, k, a_one, a_two, b_one, b_two, c_one, c_two,
+                   a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                   gemm_kernel_id);
+  size_t a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i;
+  CalculateInternalDimensions(m, n, k,
+                              params.xgemm.mwg, params.xgemm.nwg, params.xgemm.kwg * params.xgemm.kreg,
+                              a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i,
+                              gemm_kernel_id);
+  const auto one = (is_a) ? a_one : b_one;
+  const auto two = (is_a) ? a_two : b_two;
+  const auto one_i = (is_a) ? a_one_i : b_one_i;
+  const auto two_i = (is_a) ? a_two_i : b_two_i;
+
+  // Tests the input and the packed matrices for validity
+  if (is_a) {
+    TestMatrixA(one, two, buffer, offset, ld);
+    TestMatrixA(one_i, two_i, packed_buffer, 0, one_i);
+  }
+  else {
+    TestMatrixB(one, two, buffer, offset, ld);
+    TestMatrixB(one_i, two_i, packed_buffer, 0, one_i);
+  }
+
+  // Runs the pre-processing kernel as 'GemmIndirect' would do, but into the packed buffer
+  auto emptyEventList = std::vector<Event>();
+  PadCopyTransposeMatrix(queue_, device_, db_, event_, emptyEventList,
+                         one, two, ld, offset, buffer,
+                         one_i, two_i, one_i, 0, packed_buffer,
+                         ConstantOne<T>(), GetGemmProgram(GemmProgram::kProcessing),
+                         true, (is_a) ? a_do_transpose : b_do_transpose,
+                         (is_a) ? a_conjugate : b_conjugate);
+}
+
+// As 'DoGemm', but packed operands are passed to the indirect kernel without pre-processing
+template <typename T>
+void Xgemm<T>::DoGemmPacked(const Layout layout,
+                            const Transpose a_transpose, const Transpose b_transpose,
+                            const size_t m, const size_t n, const size_t k,
+                            const T alpha,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const bool a_packed,
+                            const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const bool b_packed,
+                            const T beta,
+                            const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+  SelectSizeVariant(GetProblemSize(m, n, k));
+  const auto &params = db_.GetFlatParameters();
+  const auto gemm_kernel_id = params.xgemm.gemmk;
+
+  // Computes the transpose/conjugate options and sets the a/b/c sizes based on that
+  bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+  size_t a_one, a_two, b_one, b_two, c_one, c_two;
+  ProcessArguments(layout, a_transpose, b_transpose, m, n, k,
+                   a_one, a_two, b_one, b_two, c_one, c_two,
+                   a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                   gemm_kernel_id);
+
+  // Tests the three matrices for validity: packed matrices are tested against their packed sizes
+  size_t a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i;
+  CalculateInternalDimensions(m, n, k,
+                              params.xgemm.mwg, params.xgemm.nwg, params.xgemm.kwg * params.xgemm.kreg,
+                              a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i,
+                              gemm_kernel_id);
+  if (a_packed) { TestMatrixA(a_one_i, a_two_i, a_buffer, 0, a_one_i); }
+  else { TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld); }
+  if (b_packed) { TestMatrixB(b_one_i, b_two_i, b_buffer, 0, b_one_i); }
+  else { TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld); }
+  TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
+  if (has_epilogue_) { TestEpilogue(epilogue_, m, n); }
+
+  GemmIndirect(m, n, k, alpha,
+               a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+               c_buffer, c_offset, c_ld,
+               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+               a_one, a_two, b_one, b_two, c_one, c_two,
+               Buffer<T>(0), false, a_packed, b_packed);
+}
+
+// =================================================================================================
+
+// Packs matrix A or B into a new image for the image version of GEMM
+template <typename T>
+Buffer<T> Xgemm<T>::DoPackImage(const Layout layout, const GemmOperand operand, const Transpose transpose,
+                                const size_t m, const size_t n, const size_t k,
+                                const Buffer<T> &buffer, const size_t offset, const size_t ld) {
+  SelectSizeVariant(GetProblemSize(m, n, k));
+  const auto is_a = (operand == GemmOperand::kA);
+
+  // Tests the operand for validity, and whether the image version can be used at all
+  bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+  size_t a_one, a_two, b_one, b_two, c_one, c_two;
+  ProcessArguments(layout, (is_a) ? transpose : Transpose::kNo, (is_a) ? Transpose::kNo : transpose,
+                   m, n, k, a_one, a_two, b_one, b_two, c_one, c_two,
+                   a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate, 0);
+  if (is_a) { TestMatrixA(a_one, a_two, buffer, offset, ld); }
+  else { TestMatrixB(b_one, b_two, buffer, offset, ld); }
+  TestImageSupport(m, n, k);
+
+  return PackImage(layout, operand, transpose, m, n, k, buffer, offset, ld, event_);
+}
+
+// As 'DoGemm', but always with the image version and with optional pre-packed images
+template <typename T>
+void Xgemm<T>::DoGemmImages(const Layout layout,
+                            const Transpose a_transpose, const Transpose b_transpose,
+                            const size_t m, const size_t n, const size_t k,
+                            const T alpha,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const bool a_image,
+                            const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const bool b_image,
+                            const T beta,
+                            const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+  SelectSizeVariant(GetProblemSize(m, n, k));
+
+  // Tests the matrices for validity: images are only tested for their presence
+  bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+  size_t a_one, a_two, b_one, b_two, c_one, c_two;
+  ProcessArguments(layout, a_transpose, b_transpose, m, n, k,
+                   a_one, a_two, b_one, b_two, c_one, c_two,
+                   a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate, 0);
+  if (a_image) { if (a_buffer() == nullptr) { throw BLASError(StatusCode::kInvalidMatrixA); } }
+  else { TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld); }
+  if (b_image) { if (b_buffer() == nullptr) { throw BLASError(StatusCode::kInvalidMatrixB); } }
+  else { TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld); }
+  TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
+  TestImageSupport(m, n, k);
+
+  GemmImage(layout, a_transpose, b_transpose, m, n, k, alpha,
+            a_buffer, a_offset, a_ld, a_image, b_buffer, b_offset, b_ld, b_image, beta,
+            c_buffer, c_offset, c_ld);
+}
+
+// =================================================================================================
+
 // The indirect version of GEMM. This uses the faster but non-general kernel. It has specific
 // requirements, but several pre and post-processing kernels take care of those. However, the
 // overhead of these extra kernels might not be ideal for certain devices/arguments.
@@ -116,24 +452,47 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
                             const size_t a_one, const size_t a_two,
                             const size_t b_one, const size_t b_two,
                             const size_t c_one, const size_t c_two,
-                            const Buffer<T> &temp_buffer, const bool temp_buffer_provided) {
+                            const Buffer<T> &temp_buffer, const bool temp_buffer_provided,
+                            const bool a_packed, const bool b_packed,
+                            const bool shape_specialised) {
+  const auto &params = db_.GetFlatParameters();
 
   // Calculates the ceiled versions of m, n, and k
-  const auto m_ceiled = Ceil(m, db_["MWG"]);
-  const auto n_ceiled = Ceil(n, db_["NWG"]);
-  const auto k_ceiled = Ceil(k, db_["KWG"] * db_["KREG"]);
+  const auto m_ceiled = Ceil(m, params.xgemm.mwg);
+  const auto n_ceiled = Ceil(n, params.xgemm.nwg);
+  const auto k_ceiled = Ceil(k, params.xgemm.kwg * params.xgemm.kreg);
 
   // Computes the first and second "internal" (ceiled) dimensions of the 3 matrices taking into account
   // whether the matrices need to be rotated or not for the kernel.
   size_t a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i;
-  CalculateInternalDimensions(m, n, k, db_["MWG"], db_["NWG"], db_["KWG"] * db_["KREG"],
+  CalculateInternalDimensions(m, n, k,
+                              params.xgemm.mwg, params.xgemm.nwg, params.xgemm.kwg * params.xgemm.kreg,
                               a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i,
-                              db_["GEMMK"]);
+                              params.xgemm.gemmk);
 
-  // Determines whether or not temporary matrices are needed
-  auto a_no_temp = NoTempBuffer(a_one, a_one_i, a_two, a_two_i, a_ld, a_offset, a_do_transpose, a_conjugate);
-  auto b_no_temp = NoTempBuffer(b_one, b_one_i, b_two, b_two_i, b_ld, b_offset, b_do_transpose, b_conjugate);
-  auto c_no_temp = NoTempBuffer(c_one, c_one_i, c_two, c_two_i, c_ld, c_offset, c_do_transpose, false);
+  // Determines whether or not temporary matrices are needed. Packed matrices are already in the
+  // layout of the temporary matrices.
+  auto a_no_temp = a_packed || NoTempBuffer(a_one, a_one_i, a_two, a_two_i, a_ld, a_offset, a_do_transpose, a_conjugate);
+  auto b_no_temp = b_packed || NoTempBuffer(b_one, b_one_i, b_two, b_two_i, b_ld, b_offset, b_do_transpose, b_conjugate);
+  // A separate output matrix D always uses a temporary matrix C, which the post-processing kernel
+  // copies into D.
+  auto c_no_temp = !has_output_ &&
+                   NoTempBuffer(c_one, c_one_i, c_two, c_two_i, c_ld, c_offset, c_do_transpose, false);
+
+  // Matrices which only need a temporary copy to pad them (not to transpose or conjugate them) can
+  // instead be used directly by the masked variant of the kernel, which checks the boundaries of
+  // the matrices itself. This variant is only available for kernel 0 and not for a shape-specialised
+  // program or for packed matrices.
+  const auto a_pad_only = !a_no_temp && !a_do_transpose && !a_conjugate;
+  const auto b_pad_only = !b_no_temp && !b_do_transpose && !b_conjugate;
+  const auto c_pad_only = !c_no_temp && !c_do_transpose && !has_output_;
+  const auto use_masked = (a_pad_only || b_pad_only || c_pad_only) && params.xgemm.gemmk == 0 &&
+                          !shape_specialised && !a_packed && !b_packed;
+  if (use_masked) {
+    a_no_temp = a_no_temp || a_pad_only;
+    b_no_temp = b_no_temp || b_pad_only;
+    c_no_temp = c_no_temp || c_pad_only;
+  }
 
   // Computes the sizes and offsets for (optional) temporary buffers for the 3 matrices
   auto b_temp_offset = size_t{0};
@@ -141,13 +500,13 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
   const auto temp_size = ComputeTempSize(a_no_temp, b_no_temp, c_no_temp,
                                          a_one_i*a_two_i, b_one_i*b_two_i, c_one_i*c_two_i,
                                          b_temp_offset, c_temp_offset);
-  if (!IsMultiple(b_temp_offset, db_["VWN"])) { throw BLASError(StatusCode::kUnexpectedError); }
-  if (!IsMultiple(c_temp_offset, db_["VWM"])) { throw BLASError(StatusCode::kUnexpectedError); }
+  if (!IsMultiple(b_temp_offset, params.xgemm.vwn)) { throw BLASError(StatusCode::kUnexpectedError); }
+  if (!IsMultiple(c_temp_offset, params.xgemm.vwm)) { throw BLASError(StatusCode::kUnexpectedError); }
 
   // Creates the buffer for the (optional) temporary matrices. Note that we use 'a_buffer' in case
   // when no temporary buffer is needed, but that's just to make it compile: it is never used.
   const auto temp_buffer_all = (temp_buffer_provided) ? temp_buffer :
-                               ((temp_size > 0) ? Buffer<T>(context_, temp_size) : a_buffer);
+                               ((temp_size > 0) ? TemporaryBuffer<T>(context_, queue_, temp_size) : a_buffer);
 
   // Verifies if the provided temporary buffer is large enough
   if (temp_buffer_provided) {
@@ -162,45 +521,54 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
 
   // Events of all kernels (including pre/post processing kernels)
   auto eventWaitList = std::vector<Event>();
-  auto emptyEventList = std::vector<Event>();
+  const auto &inputEventList = input_events_; // see 'BeginCommandChain'
 
-  // Runs the pre-processing kernel for matrix A. This transposes the matrix, but also pads zeros
-  // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
-  // case nothing has to be done, these kernels can be skipped.
+  // Collects the pre-processing of the matrices. This transposes them, but also pads zeros to fill
+  // them up until they reach a certain multiple of size (kernel parameter dependent). In case
+  // nothing has to be done, a matrix can be skipped. Matrix C is only necessary if it is used both
+  // as input and output.
+  auto jobs = std::vector<PadCopyTransposeJob<T>>();
   if (!a_no_temp) {
-    auto eventProcessA = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), emptyEventList,
-                           a_one, a_two, a_ld, a_offset, a_buffer,
-                           a_one_i, a_two_i, a_one_i, 0, a_temp,
-                           ConstantOne<T>(), program_,
-                           true, a_do_transpose, a_conjugate);
-    eventWaitList.push_back(eventProcessA);
+    jobs.push_back({a_one, a_two, a_ld, a_offset, a_buffer, a_one_i, a_two_i, 0,
+                    a_do_transpose, a_conjugate});
   }
-
-  // As above, but now for matrix B
   if (!b_no_temp) {
-    auto eventProcessB = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB.pointer(), emptyEventList,
-                           b_one, b_two, b_ld, b_offset, b_buffer,
-                           b_one_i, b_two_i, b_one_i, b_temp_offset, b_temp,
-                           ConstantOne<T>(), program_,
-                           true, b_do_transpose, b_conjugate);
-    eventWaitList.push_back(eventProcessB);
-  }
-
-  // As above, but now for matrix C. This is only necessary if C is used both as input and output.
-  if (!c_no_temp && beta != static_cast<T>(0)) {
-    auto eventProcessC = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
-                           c_one, c_two, c_ld, c_offset, c_buffer,
-                           c_one_i, c_two_i, c_one_i, c_temp_offset, c_temp,
-                           ConstantOne<T>(), program_,
-                           true, c_do_transpose, false);
-    eventWaitList.push_back(eventProcessC);
+    jobs.push_back({b_one, b_two, b_ld, b_offset, b_buffer, b_one_i, b_two_i, b_temp_offset,
+                    b_do_transpose, b_conjugate});
+  }
+  if (!c_no_temp && beta != ConstantZero<T>()) {
+    jobs.push_back({c_one, c_two, c_ld, c_offset, c_buffer, c_one_i, c_two_i, c_temp_offset,
+                    c_do_transpose, false});
+  }
+
+  // Runs the pre-processing kernels. A single matrix uses the regular kernel, which has a faster
+  // variant for some cases. Multiple matrices share a single kernel launch to save the overhead of
+  // the other launches, as these are all written into the same temporary buffer.
+  if (jobs.size() == 1) {
+    const auto &job = jobs[0];
+    auto eventProcess = Event();
+    PadCopyTransposeMatrix(queue_, device_, db_,
+                           IntermediateEvent(queue_, eventProcess), inputEventList,
+                           job.src_one, job.src_two, job.src_ld, job.src_offset, job.src,
+                           job.dest_one, job.dest_two, job.dest_one, job.dest_offset, temp_buffer_all,
+                           ConstantOne<T>(), GetGemmProgram(GemmProgram::kProcessing),
+                           true, job.do_transpose, job.do_conjugate);
+    eventWaitList.push_back(eventProcess);
+  }
+  else if (jobs.size() > 1) {
+    auto eventProcess = Event();
+    PadCopyTransposeMatrices(queue_, device_, db_,
+                             IntermediateEvent(queue_, eventProcess), inputEventList,
+                             jobs, temp_buffer_all, GetGemmProgram(GemmProgram::kProcessing));
+    eventWaitList.push_back(eventProcess);
   }
 
-  // Retrieves the Xgemm kernel from the compiled binary
-  auto kernel = Kernel(program_, "Xgemm");
+  // Retrieves the Xgemm kernel from the compiled binary, from the binary specialised for these
+  // sizes in case the shape of the problem is registered (see 'RegisterGemmShape'), or from the
+  // binary of the masked variant
+  auto kernel = (shape_specialised) ? GetKernel(GetShapeProgram(m_ceiled, n_ceiled, k_ceiled), "Xgemm")
+              : (use_masked) ? GetKernel(GetMaskedProgram(), "Xgemm")
+                             : GetKernel(GetGemmProgram(GemmProgram::kIndirect), "Xgemm");
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(m_ceiled));
@@ -211,38 +579,238 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
   kernel.SetArgument(5, a_temp());
   kernel.SetArgument(6, b_temp());
   kernel.SetArgument(7, c_temp());
-  kernel.SetArgument(8, static_cast<int>(b_temp_offset / db_["VWN"]));
-  kernel.SetArgument(9, static_cast<int>(c_temp_offset / db_["VWM"]));
+  if (use_masked) { // vector widths of one, the original or the temporary matrices
+    kernel.SetArgument(8, static_cast<int>((b_no_temp) ? b_offset : b_temp_offset));
+    kernel.SetArgument(9, static_cast<int>((c_no_temp) ? c_offset : c_temp_offset));
+  }
+  else {
+    kernel.SetArgument(8, static_cast<int>(b_temp_offset / params.xgemm.vwn));
+    kernel.SetArgument(9, static_cast<int>(c_temp_offset / params.xgemm.vwm));
+  }
+  if (has_epilogue_) { SetEpilogueArguments(kernel, 10, epilogue_, m, n); }
+  if (use_masked) {
+    const auto mask_index = (has_epilogue_) ? size_t{17} : size_t{10};
+    kernel.SetArgument(mask_index + 0, static_cast<int>((a_no_temp) ? a_offset : 0));
+    kernel.SetArgument(mask_index + 1, static_cast<int>(m));
+    kernel.SetArgument(mask_index + 2, static_cast<int>(n));
+    kernel.SetArgument(mask_index + 3, static_cast<int>(k));
+    kernel.SetArgument(mask_index + 4, static_cast<int>((a_no_temp) ? a_ld : a_one_i));
+    kernel.SetArgument(mask_index + 5, static_cast<int>((b_no_temp) ? b_ld : b_one_i));
+    kernel.SetArgument(mask_index + 6, static_cast<int>((c_no_temp) ? c_ld : c_one_i));
+  }
 
   // Computes the global and local thread sizes
-  const auto global = std::vector<size_t>{
-    (c_one_i * db_["MDIMC"]) / db_["MWG"],
-    (c_two_i * db_["NDIMC"]) / db_["NWG"]
+  const auto global = ThreadRange{
+    (c_one_i * params.xgemm.mdimc) / params.xgemm.mwg,
+    (c_two_i * params.xgemm.ndimc) / params.xgemm.nwg
   };
-  const auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+  const auto local = ThreadRange{params.xgemm.mdimc, params.xgemm.ndimc};
 
   // Launches the kernel
   auto eventKernel = Event();
-  auto eventPointer = (!c_no_temp) ? eventKernel.pointer() : event_;
+  auto eventPointer = (!c_no_temp) ? IntermediateEvent(queue_, eventKernel) : event_;
   RunKernel(kernel, queue_, device_, global, local, eventPointer, eventWaitList);
 
-  // Runs the post-processing kernel if needed
+  // Runs the post-processing kernel if needed, into matrix D if there is a separate output matrix
   if (!c_no_temp) {
     eventWaitList.push_back(eventKernel);
     PadCopyTransposeMatrix(queue_, device_, db_, event_, eventWaitList,
                            c_one_i, c_two_i, c_one_i, c_temp_offset, c_temp,
-                           c_one, c_two, c_ld, c_offset, c_buffer,
-                           ConstantOne<T>(), program_,
+                           c_one, c_two,
+                           (has_output_) ? output_.d_ld : c_ld,
+                           (has_output_) ? output_.d_offset : c_offset,
+                           (has_output_) ? output_.d_buffer : c_buffer,
+                           ConstantOne<T>(), GetGemmProgram(GemmProgram::kProcessing),
                            false, c_do_transpose, false);
   }
 }
 
 
+// =================================================================================================
+
+// The indirect version of GEMM computed in blocks of matrix C. Each block pads and transposes only
+// the panels of A and B it needs, all of K, such that the block sizes are halved until the (padded)
+// temporary matrices of a block fit within the workspace limit and its work within the chunk limit
+// (if any). The blocks run one after another and re-use the same temporary buffers from the memory
+// pool. Being separate kernels, a device can schedule work of other queues in between blocks.
+template <typename T>
+void Xgemm<T>::GemmIndirectBlocked(const Layout layout, const Transpose a_transpose,
+                                   const Transpose b_transpose,
+                                   const size_t m, const size_t n, const size_t k,
+                                   const T alpha,
+                                   const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                                   const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                                   const T beta,
+                                   const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                                   const size_t gemm_kernel_id, const size_t workspace_limit,
+                                   const size_t chunk_limit) {
+  const auto &params = db_.GetFlatParameters();
+
+  // Computes the block sizes as multiples of the tile sizes. The smallest blocks might still exceed
+  // the limits, in which case these are used anyway.
+  const auto k_ceiled = Ceil(k, params.xgemm.kwg * params.xgemm.kreg);
+  auto m_block = Ceil(m, params.xgemm.mwg);
+  auto n_block = Ceil(n, params.xgemm.nwg);
+  while (m_block * k_ceiled + k_ceiled * n_block + m_block * n_block > workspace_limit ||
+         (chunk_limit != 0 && m_block * n_block * k_ceiled > chunk_limit)) {
+    const auto split_m = m_block > params.xgemm.mwg;
+    const auto split_n = n_block > params.xgemm.nwg;
+    if (!split_m && !split_n) { break; }
+    if (split_m && (m_block >= n_block || !split_n)) {
+      m_block = Ceil(CeilDiv(m_block, size_t{2}), params.xgemm.mwg);
+    }
+    else {
+      n_block = Ceil(CeilDiv(n_block, size_t{2}), params.xgemm.nwg);
+    }
+  }
+
+  // Whether or not the matrices are transposed in memory (see 'ProcessArguments'), which determines
+  // the offsets of the blocks
+  const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  const auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  const auto c_rotated = (layout == Layout::kRowMajor);
+
+  // Only the last block signals the routine's event, as the blocks are ordered on the queue. The
+  // bias of the epilogue and the output matrix D (if any) are offset for each block.
+  const auto event = event_;
+  const auto epilogue = epilogue_;
+  const auto output = output_;
+  for (auto m_start = size_t{0}; m_start < m; m_start += m_block) {
+    for (auto n_start = size_t{0}; n_start < n; n_start += n_block) {
+      const auto m_size = std::min(m_block, m - m_start);
+      const auto n_size = std::min(n_block, n - n_start);
+      bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+      size_t a_one, a_two, b_one, b_two, c_one, c_two;
+      ProcessArguments(layout, a_transpose, b_transpose, m_size, n_size, k,
+                       a_one, a_two, b_one, b_two, c_one, c_two,
+                       a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                       gemm_kernel_id);
+      const auto a_block_offset = a_offset + ((a_rotated) ? m_start * a_ld : m_start);
+      const auto b_block_offset = b_offset + ((b_rotated) ? n_start : n_start * b_ld);
+      const auto c_block_offset = c_offset + ((c_rotated) ? m_start * c_ld + n_start :
+                                                            n_start * c_ld + m_start);
+      output_.d_offset = output.d_offset + ((c_rotated) ? m_start * output.d_ld + n_start :
+                                                          n_start * output.d_ld + m_start);
+      if (epilogue.bias_mode == EpilogueBias::kPerRow) {
+        epilogue_.bias_offset = epilogue.bias_offset + m_start;
+      }
+      else if (epilogue.bias_mode == EpilogueBias::kPerColumn) {
+        epilogue_.bias_offset = epilogue.bias_offset + n_start;
+      }
+      const auto last_block = (m_start + m_block >= m) && (n_start + n_block >= n);
+      event_ = (last_block) ? event : nullptr;
+      GemmIndirect(m_size, n_size, k, alpha,
+                   a_buffer, a_block_offset, a_ld, b_buffer, b_block_offset, b_ld, beta,
+                   c_buffer, c_block_offset, c_ld,
+                   a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                   a_one, a_two, b_one, b_two, c_one, c_two,
+                   a_buffer, false);
+    }
+  }
+  event_ = event;
+  epilogue_ = epilogue;
+  output_ = output;
+}
+
 // =================================================================================================
 
 // The direct version of GEMM, requiring just one kernel, no pre or post-processing kernels.
 template <typename T>
 void Xgemm<T>::GemmDirect(const size_t m, const size_t n, const size_t k,
+                          const T alpha,
+                          const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                          const T beta,
+                          const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                          const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                          const bool a_conjugate, const bool b_conjugate,
+                          const bool index64) {
+  const auto &params = db_.GetFlatParameters();
+
+  // Retrieves the proper XgemmDirect kernel from the compiled binary. The fast version without
+  // boundary checks requires complete tiles and vector-aligned matrices A and B, and doesn't support
+  // 64-bit indices.
+  const auto is_structured = has_structure_ && structure_.operand != 0;
+  const auto use_fast_kernel = !index64 && !is_structured && !has_device_scalars_ &&
+                               UseDirectFastKernel(m, n, k, a_offset, a_ld, b_offset, b_ld,
+                                                   params.xgemm_direct.wgd,
+                                                   params.xgemm_direct.vwmd,
+                                                   params.xgemm_direct.vwnd);
+  const auto name = (use_fast_kernel) ?
+                    ((a_do_transpose) ? (b_do_transpose ? "XgemmDirectFastTT" : "XgemmDirectFastTN") :
+                                        (b_do_transpose ? "XgemmDirectFastNT" : "XgemmDirectFastNN")) :
+                    (has_device_scalars_) ?
+                    ((a_do_transpose) ? (b_do_transpose ? "XgemmDirectDeviceTT" : "XgemmDirectDeviceTN") :
+                                        (b_do_transpose ? "XgemmDirectDeviceNT" : "XgemmDirectDeviceNN")) :
+                    ((a_do_transpose) ? (b_do_transpose ? "XgemmDirectTT" : "XgemmDirectTN") :
+                                        (b_do_transpose ? "XgemmDirectNT" : "XgemmDirectNN"));
+  const auto program = (index64) ? GetIndex64Program(static_cast<size_t>(GemmProgram::kDirect)) :
+                                   GetGemmProgram(GemmProgram::kDirect);
+  auto kernel = GetKernel(program, name);
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  if (has_device_scalars_) {
+    kernel.SetArgument(3, device_scalars_.alpha_buffer());
+    kernel.SetArgument(4, device_scalars_.beta_buffer());
+  }
+  else {
+    kernel.SetArgument(3, GetRealArg(alpha));
+    kernel.SetArgument(4, GetRealArg(beta));
+  }
+  kernel.SetArgument(5, a_buffer());
+  SetIndexArgument(kernel, 6, a_offset, index64);
+  SetIndexArgument(kernel, 7, a_ld, index64);
+  kernel.SetArgument(8, b_buffer());
+  SetIndexArgument(kernel, 9, b_offset, index64);
+  SetIndexArgument(kernel, 10, b_ld, index64);
+  kernel.SetArgument(11, c_buffer());
+  SetIndexArgument(kernel, 12, c_offset, index64);
+  SetIndexArgument(kernel, 13, c_ld, index64);
+  kernel.SetArgument(14, static_cast<int>(c_do_transpose));
+  kernel.SetArgument(15, static_cast<int>(a_conjugate));
+  kernel.SetArgument(16, static_cast<int>(b_conjugate));
+  if (has_epilogue_) { SetEpilogueArguments(kernel, 17, epilogue_, m, n); }
+  if (has_device_scalars_) {
+    kernel.SetArgument(17, static_cast<int>(device_scalars_.alpha_offset));
+    kernel.SetArgument(18, static_cast<int>(device_scalars_.beta_offset));
+  }
+  if (has_structure_) {
+    kernel.SetArgument(17, static_cast<int>(structure_.operand));
+    kernel.SetArgument(18, static_cast<int>(structure_.upper));
+    kernel.SetArgument(19, static_cast<int>(structure_.unit_diagonal));
+  }
+  if (has_output_) {
+    kernel.SetArgument(17, output_.d_buffer());
+    SetIndexArgument(kernel, 18, output_.d_offset, index64);
+    SetIndexArgument(kernel, 19, output_.d_ld, index64);
+  }
+
+  // Computes the global and local thread sizes
+  const auto m_ceiled = Ceil(m, params.xgemm_direct.wgd);
+  const auto n_ceiled = Ceil(n, params.xgemm_direct.wgd);
+  const auto global = ThreadRange{
+  //  CeilDiv(m * params.xgemm_direct.mdimcd, params.xgemm_direct.wgd),
+  //  CeilDiv(n * params.xgemm_direct.ndimcd, params.xgemm_direct.wgd)
+      (m_ceiled * params.xgemm_direct.mdimcd) / params.xgemm_direct.wgd,
+      (n_ceiled * params.xgemm_direct.ndimcd) / params.xgemm_direct.wgd
+  };
+  const auto local = ThreadRange{params.xgemm_direct.mdimcd, params.xgemm_direct.ndimcd};
+
+  // Launches the kernel
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// The split-K version of GEMM: the K-dimension is split in slices, each computed by a different set
+// of work-groups of the direct kernel into a temporary buffer. A second kernel sums the results.
+template <typename T>
+void Xgemm<T>::GemmSplitK(const size_t m, const size_t n, const size_t k,
                           const T alpha,
                           const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                           const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
@@ -250,44 +818,437 @@ void Xgemm<T>::GemmDirect(const size_t m, const size_t n, const size_t k,
                           const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
                           const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                           const bool a_conjugate, const bool b_conjugate) {
+  const auto &params = db_.GetFlatParameters();
+
+  // Computes the number of slices and creates the buffer for the partial results
+  const auto slice_size = GetSplitKSliceSize(m, n, k, params.xgemm_direct.wgd);
+  const auto num_slices = CeilDiv(k, slice_size);
+  const auto partial_buffer = TemporaryBuffer<T>(context_, queue_, num_slices * m * n);
 
-  // Retrieves the proper XgemmDirect kernel from the compiled binary
-  const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectTT" : "XgemmDirectTN") :
-                                       (b_do_transpose ? "XgemmDirectNT" : "XgemmDirectNN");
-  auto kernel = Kernel(program_, name);
+  // Retrieves the proper XgemmSplitK kernel from the compiled binary
+  const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmSplitKTT" : "XgemmSplitKTN") :
+                                       (b_do_transpose ? "XgemmSplitKNT" : "XgemmSplitKNN");
+  auto kernel = GetKernel(GetGemmProgram(GemmProgram::kDirect), name);
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(m));
   kernel.SetArgument(1, static_cast<int>(n));
   kernel.SetArgument(2, static_cast<int>(k));
-  kernel.SetArgument(3, GetRealArg(alpha));
-  kernel.SetArgument(4, GetRealArg(beta));
+  kernel.SetArgument(3, static_cast<int>(slice_size));
+  kernel.SetArgument(4, GetRealArg(alpha));
   kernel.SetArgument(5, a_buffer());
   kernel.SetArgument(6, static_cast<int>(a_offset));
   kernel.SetArgument(7, static_cast<int>(a_ld));
   kernel.SetArgument(8, b_buffer());
   kernel.SetArgument(9, static_cast<int>(b_offset));
   kernel.SetArgument(10, static_cast<int>(b_ld));
+  kernel.SetArgument(11, partial_buffer());
+  kernel.SetArgument(12, static_cast<int>(a_conjugate));
+  kernel.SetArgument(13, static_cast<int>(b_conjugate));
+
+  // Computes the global and local thread sizes, the third dimension iterates over the slices
+  const auto m_ceiled = Ceil(m, params.xgemm_direct.wgd);
+  const auto n_ceiled = Ceil(n, params.xgemm_direct.wgd);
+  const auto global = ThreadRange{
+      (m_ceiled * params.xgemm_direct.mdimcd) / params.xgemm_direct.wgd,
+      (n_ceiled * params.xgemm_direct.ndimcd) / params.xgemm_direct.wgd,
+      num_slices
+  };
+  const auto local = ThreadRange{params.xgemm_direct.mdimcd, params.xgemm_direct.ndimcd, 1};
+
+  // Launches the kernel
+  auto eventWaitList = std::vector<Event>();
+  auto eventKernel = Event();
+  RunKernel(kernel, queue_, device_, global, local, IntermediateEvent(queue_, eventKernel));
+  eventWaitList.push_back(eventKernel);
+
+  // Retrieves the reduction kernel and sets its arguments
+  auto reduce_kernel = GetKernel(GetGemmProgram(GemmProgram::kDirect), "XgemmSplitKReduce");
+  reduce_kernel.SetArgument(0, static_cast<int>(m));
+  reduce_kernel.SetArgument(1, static_cast<int>(n));
+  reduce_kernel.SetArgument(2, static_cast<int>(num_slices));
+  reduce_kernel.SetArgument(3, GetRealArg(beta));
+  reduce_kernel.SetArgument(4, partial_buffer());
+  reduce_kernel.SetArgument(5, c_buffer());
+  reduce_kernel.SetArgument(6, static_cast<int>(c_offset));
+  reduce_kernel.SetArgument(7, static_cast<int>(c_ld));
+  reduce_kernel.SetArgument(8, static_cast<int>(c_do_transpose));
+
+  // Launches the reduction kernel
+  const auto reduce_global = ThreadRange{Ceil(m, params.copy.dimx), Ceil(n, params.copy.dimy)};
+  const auto reduce_local = ThreadRange{params.copy.dimx, params.copy.dimy};
+  RunKernel(reduce_kernel, queue_, device_, reduce_global, reduce_local, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// The skinny version of GEMM: the kernel streams the matrix with the large dimension once and keeps
+// all (at most SKINNY_N) columns of the result in registers. For a small 'm' instead of a small 'n',
+// it computes C^T = B^T * A^T: the roles of A and B are swapped and the transpose of C is flipped,
+// with the transposes of A and B as defined by the direct kernel.
+template <typename T>
+void Xgemm<T>::GemmSkinny(const size_t m, const size_t n, const size_t k,
+                          const T alpha,
+                          const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                          const T beta,
+                          const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                          const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                          const bool a_conjugate, const bool b_conjugate) {
+  const auto swap = (m < n);
+  const auto skinny_m = (swap) ? n : m;
+  const auto skinny_n = (swap) ? m : n;
+
+  // Retrieves the XgemmSkinny kernel from the compiled binary and sets its arguments
+  auto kernel = GetKernel(GetGemmProgram(GemmProgram::kSkinny), "XgemmSkinny");
+  kernel.SetArgument(0, static_cast<int>(skinny_m));
+  kernel.SetArgument(1, static_cast<int>(skinny_n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  kernel.SetArgument(3, GetRealArg(alpha));
+  kernel.SetArgument(4, GetRealArg(beta));
+  kernel.SetArgument(5, (swap) ? b_buffer() : a_buffer());
+  kernel.SetArgument(6, static_cast<int>((swap) ? b_offset : a_offset));
+  kernel.SetArgument(7, static_cast<int>((swap) ? b_ld : a_ld));
+  kernel.SetArgument(8, (swap) ? a_buffer() : b_buffer());
+  kernel.SetArgument(9, static_cast<int>((swap) ? a_offset : b_offset));
+  kernel.SetArgument(10, static_cast<int>((swap) ? a_ld : b_ld));
   kernel.SetArgument(11, c_buffer());
   kernel.SetArgument(12, static_cast<int>(c_offset));
   kernel.SetArgument(13, static_cast<int>(c_ld));
-  kernel.SetArgument(14, static_cast<int>(c_do_transpose));
-  kernel.SetArgument(15, static_cast<int>(a_conjugate));
-  kernel.SetArgument(16, static_cast<int>(b_conjugate));
+  kernel.SetArgument(14, static_cast<int>((swap) ? b_do_transpose : a_do_transpose));
+  kernel.SetArgument(15, static_cast<int>((swap) ? a_do_transpose : b_do_transpose));
+  kernel.SetArgument(16, static_cast<int>((swap) ? !c_do_transpose : c_do_transpose));
+  kernel.SetArgument(17, static_cast<int>((swap) ? b_conjugate : a_conjugate));
+  kernel.SetArgument(18, static_cast<int>((swap) ? a_conjugate : b_conjugate));
 
-  // Computes the global and local thread sizes
-  const auto m_ceiled = Ceil(m, db_["WGD"]);
-  const auto n_ceiled = Ceil(n, db_["WGD"]);
-  const auto global = std::vector<size_t>{
-  //  CeilDiv(m * db_["MDIMCD"], db_["WGD"]),
-  //  CeilDiv(n * db_["NDIMCD"], db_["WGD"])
-      (m_ceiled * db_["MDIMCD"]) / db_["WGD"],
-      (n_ceiled * db_["NDIMCD"]) / db_["WGD"]
+  // Launches the kernel: each thread computes 'WPT1' rows of the result
+  const auto rows_per_group = db_["WGS1"] * db_["WPT1"];
+  const auto global = ThreadRange{CeilDiv(skinny_m, rows_per_group) * db_["WGS1"]};
+  const auto local = ThreadRange{db_["WGS1"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// The 3M version of complex GEMM: A and B are split into their real parts, their imaginary parts
+// and the sums of both, after which three real-valued GEMMs compute the products T1 = Ar*Br,
+// T2 = Ai*Bi and T3 = (Ar+Ai)*(Br+Bi). A final kernel combines these into matrix C. All real-valued
+// matrices are stored without padding, in the same layout (and with the same rotation) as the
+// original complex matrices, such that the real-valued GEMMs use the same layout and transposes.
+template <typename T>
+void Xgemm<T>::Gemm3M(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const T alpha,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                      const T beta,
+                      const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                      const size_t a_one, const size_t a_two,
+                      const size_t b_one, const size_t b_two,
+                      const size_t c_one, const size_t c_two) {
+  using R = typename BaseType<T>::Type;
+  const auto &params = db_.GetFlatParameters();
+  const auto local = ThreadRange{params.copy.dimx, params.copy.dimy};
+
+  // Creates the buffers for the real-valued matrices, three for each of A, B and C
+  const auto a_size = a_one * a_two;
+  const auto b_size = b_one * b_two;
+  const auto c_size = c_one * c_two;
+  const auto a_temp = TemporaryBuffer<R>(context_, queue_, 3 * a_size);
+  const auto b_temp = TemporaryBuffer<R>(context_, queue_, 3 * b_size);
+  const auto c_temp = TemporaryBuffer<R>(context_, queue_, 3 * c_size);
+
+  // Splits matrices A and B into their real-valued parts, negating the imaginary parts in case of
+  // a conjugate transpose
+  auto eventWaitList = std::vector<Event>();
+  const auto split = [&](const size_t one, const size_t two, const size_t ld, const size_t offset,
+                         const Buffer<T> &buffer, const Buffer<R> &dest, const bool conjugate) {
+    auto kernel = GetKernel(GetGemmProgram(GemmProgram::kIndirect), "Xgemm3MSplit");
+    kernel.SetArgument(0, static_cast<int>(one));
+    kernel.SetArgument(1, static_cast<int>(two));
+    kernel.SetArgument(2, static_cast<int>(ld));
+    kernel.SetArgument(3, static_cast<int>(offset));
+    kernel.SetArgument(4, buffer());
+    kernel.SetArgument(5, dest());
+    kernel.SetArgument(6, static_cast<int>(one * two));
+    kernel.SetArgument(7, static_cast<int>(conjugate));
+    const auto global = ThreadRange{Ceil(one, params.copy.dimx), Ceil(two, params.copy.dimy)};
+    auto eventSplit = Event();
+    RunKernel(kernel, queue_, device_, global, local, IntermediateEvent(queue_, eventSplit));
+    eventWaitList.push_back(eventSplit);
   };
-  const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"]};
+  split(a_one, a_two, a_ld, a_offset, a_buffer, a_temp, a_transpose == Transpose::kConjugate);
+  split(b_one, b_two, b_ld, b_offset, b_buffer, b_temp, b_transpose == Transpose::kConjugate);
 
-  // Launches the kernel
-  RunKernel(kernel, queue_, device_, global, local, event_);
+  // Runs the three real-valued GEMMs on the same queue. A conjugate transpose has become a regular
+  // transpose, as the conjugate is already applied when splitting.
+  const auto a_real_transpose = (a_transpose == Transpose::kNo) ? Transpose::kNo : Transpose::kYes;
+  const auto b_real_transpose = (b_transpose == Transpose::kNo) ? Transpose::kNo : Transpose::kYes;
+  for (auto product = size_t{0}; product < 3; ++product) {
+    auto eventGemm = Event();
+    auto gemm = Xgemm<R>(queue_, IntermediateEvent(queue_, eventGemm));
+    gemm.DoGemm(layout, a_real_transpose, b_real_transpose, m, n, k, ConstantOne<R>(),
+                a_temp, product * a_size, a_one, b_temp, product * b_size, b_one, ConstantZero<R>(),
+                c_temp, product * c_size, c_one);
+    eventWaitList.push_back(eventGemm);
+  }
+
+  // Combines the three products into matrix C
+  auto kernel = GetKernel(GetGemmProgram(GemmProgram::kIndirect), "Xgemm3MCombine");
+  kernel.SetArgument(0, static_cast<int>(c_one));
+  kernel.SetArgument(1, static_cast<int>(c_two));
+  kernel.SetArgument(2, GetRealArg(alpha));
+  kernel.SetArgument(3, GetRealArg(beta));
+  kernel.SetArgument(4, c_temp());
+  kernel.SetArgument(5, static_cast<int>(c_size));
+  kernel.SetArgument(6, c_buffer());
+  kernel.SetArgument(7, static_cast<int>(c_offset));
+  kernel.SetArgument(8, static_cast<int>(c_ld));
+  const auto global = ThreadRange{Ceil(c_one, params.copy.dimx), Ceil(c_two, params.copy.dimy)};
+  RunKernel(kernel, queue_, device_, global, local, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// The image version of GEMM: operands A and B are packed into images (see 'xgemm_image.opencl')
+// unless they are images already, after which a single kernel computes matrix C
+template <typename T>
+void Xgemm<T>::GemmImage(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                         const size_t m, const size_t n, const size_t k,
+                         const T alpha,
+                         const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const bool a_image,
+                         const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const bool b_image,
+                         const T beta,
+                         const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+  const auto &params = db_.GetFlatParameters();
+
+  // Packs the operands which are not images yet
+  auto eventWaitList = std::vector<Event>();
+  const auto pack = [&](const GemmOperand operand, const Transpose transpose,
+                        const Buffer<T> &buffer, const size_t offset, const size_t ld,
+                        const bool is_image) -> Buffer<T> {
+    if (is_image) { return buffer; }
+    auto eventPack = Event();
+    const auto image = PackImage(layout, operand, transpose, m, n, k, buffer, offset, ld,
+                                 IntermediateEvent(queue_, eventPack));
+    eventWaitList.push_back(eventPack);
+    return image;
+  };
+  const auto a_image_buffer = pack(GemmOperand::kA, a_transpose, a_buffer, a_offset, a_ld, a_image);
+  const auto b_image_buffer = pack(GemmOperand::kB, b_transpose, b_buffer, b_offset, b_ld, b_image);
+
+  // Computes matrix C, four by four elements per thread
+  auto kernel = GetKernel(GetGemmProgram(GemmProgram::kImage), "XgemmImage");
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  kernel.SetArgument(3, GetRealArg(alpha));
+  kernel.SetArgument(4, GetRealArg(beta));
+  kernel.SetArgument(5, a_image_buffer());
+  kernel.SetArgument(6, b_image_buffer());
+  kernel.SetArgument(7, c_buffer());
+  kernel.SetArgument(8, static_cast<int>(c_offset));
+  kernel.SetArgument(9, static_cast<int>(c_ld));
+  kernel.SetArgument(10, static_cast<int>(layout == Layout::kRowMajor));
+  const auto global = ThreadRange{Ceil(CeilDiv(m, size_t{4}), params.copy.dimx),
+                                  Ceil(CeilDiv(n, size_t{4}), params.copy.dimy)};
+  const auto local = ThreadRange{params.copy.dimx, params.copy.dimy};
+  RunKernel(kernel, queue_, device_, global, local, event_, eventWaitList);
+}
+
+// Creates an image for operand A (m by k) or B (k by n) and packs the operand into it. Element
+// (one, two) of the operand (with 'one' along m or n, and 'two' along k) is read with strides which
+// follow from the layout and the transpose: a rotated A and a non-rotated B have 'ld' along 'one'.
+template <typename T>
+Buffer<T> Xgemm<T>::PackImage(const Layout layout, const GemmOperand operand, const Transpose transpose,
+                              const size_t m, const size_t n, const size_t k,
+                              const Buffer<T> &buffer, const size_t offset, const size_t ld,
+                              EventPointer event, const std::vector<Event> &waitForEvents) {
+  const auto &params = db_.GetFlatParameters();
+  const auto is_b = (operand == GemmOperand::kB);
+  const auto rotated = (layout == Layout::kColMajor) == (transpose != Transpose::kNo);
+  const auto one = (is_b) ? n : m;
+  const auto width = CeilDiv(one, size_t{4});
+
+  // Creates the image. While a call is explained, only its size is recorded (see 'TemporaryBuffer'),
+  // but an image of a single texel is still created as kernel arguments can't be null images.
+  auto explained = false;
+  #ifdef OPENCL_API
+    explained = ExplanationScope::Current() != nullptr;
+    if (explained) { ExplainTemporaryBuffer(width * k * 4 * sizeof(T)); }
+  #endif
+  const auto image = CreateGemmImage<T>(context_, (explained) ? 1 : width, (explained) ? 1 : k);
+  if (!explained) { CountBufferAllocation(width * k * 4 * sizeof(T)); }
+  if (CommandGraph::IsCapturing(queue_)) {
+    CommandGraph::KeepAlive(queue_, std::make_shared<Buffer<T>>(image));
+  }
+
+  // Packs the operand, four elements of 'one' per texel
+  auto kernel = GetKernel(GetGemmProgram(GemmProgram::kImage), "XgemmImagePack");
+  kernel.SetArgument(0, static_cast<int>(one));
+  kernel.SetArgument(1, static_cast<int>(k));
+  kernel.SetArgument(2, static_cast<int>((rotated != is_b) ? ld : 1));
+  kernel.SetArgument(3, static_cast<int>((rotated != is_b) ? 1 : ld));
+  kernel.SetArgument(4, static_cast<int>(offset));
+  kernel.SetArgument(5, buffer());
+  kernel.SetArgument(6, image());
+  const auto global = ThreadRange{Ceil(width, params.copy.dimx), Ceil(k, params.copy.dimy)};
+  const auto local = ThreadRange{params.copy.dimx, params.copy.dimy};
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
+  return image;
+}
+
+// Tests whether the image version of GEMM can be used on this device and for these sizes
+template <typename T>
+void Xgemm<T>::TestImageSupport(const size_t m, const size_t n, const size_t k) {
+  if (precision_ != PrecisionValue<T>() || !device_.SupportsImages() ||
+      !UseImageKernel(m, n, k, 1, device_.MaxImage2DWidth(), device_.MaxImage2DHeight())) {
+    throw BLASError(StatusCode::kNotImplemented);
+  }
+}
+
+// =================================================================================================
+
+// A level of the Strassen-Winograd version of GEMM: the products of the quadrants of A and B are
+// computed with seven GEMMs on the quadrants and their sums (see 'xgemm_strassen.opencl'), which
+// are Strassen-Winograd GEMMs themselves if they are still large enough. All sums and products are
+// stored without padding, in the same layout (and with the same rotation) as the original matrices,
+// such that the GEMMs use the same layout and transposes. For odd sizes, the last row, column, or
+// rank-1 update is left out of the quadrants and computed by regular GEMMs afterwards.
+template <typename T>
+void Xgemm<T>::GemmStrassen(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                            const size_t m, const size_t n, const size_t k,
+                            const T alpha,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                            const T beta,
+                            const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+  const auto &params = db_.GetFlatParameters();
+  const auto local = ThreadRange{params.copy.dimx, params.copy.dimy};
+
+  // The offset of element (row, col) of a matrix as seen by the GEMM, i.e. after transposing, and
+  // the quadrant sizes in the storage order of each matrix
+  const auto element = [](const bool rotated, const size_t offset, const size_t ld,
+                          const size_t row, const size_t col) {
+    return (rotated) ? offset + row * ld + col : offset + col * ld + row;
+  };
+  const auto a_rotated = (layout == Layout::kRowMajor) != (a_transpose != Transpose::kNo);
+  const auto b_rotated = (layout == Layout::kRowMajor) != (b_transpose != Transpose::kNo);
+  const auto c_rotated = (layout == Layout::kRowMajor);
+  const auto m_half = m / 2;
+  const auto n_half = n / 2;
+  const auto k_half = k / 2;
+  const auto a_one = (a_rotated) ? k_half : m_half;
+  const auto b_one = (b_rotated) ? n_half : k_half;
+  const auto c_one = (c_rotated) ? n_half : m_half;
+  const auto a_size = m_half * k_half;
+  const auto b_size = k_half * n_half;
+  const auto c_size = m_half * n_half;
+
+  // Creates the buffers for the sums of the quadrants of A and B and for the seven products
+  const auto s_temp = TemporaryBuffer<T>(context_, queue_, 4 * a_size);
+  const auto t_temp = TemporaryBuffer<T>(context_, queue_, 4 * b_size);
+  const auto p_temp = TemporaryBuffer<T>(context_, queue_, 7 * c_size);
+
+  // Computes the sums of the quadrants of A (S1..S4) and of B (T1..T4)
+  auto eventWaitList = std::vector<Event>();
+  const auto split = [&](const bool rotated, const size_t rows, const size_t cols,
+                         const size_t ld, const size_t offset, const Buffer<T> &buffer,
+                         const Buffer<T> &dest, const size_t dest_size, const bool is_b) {
+    const auto one = (rotated) ? cols : rows;
+    const auto two = (rotated) ? rows : cols;
+    auto kernel = GetKernel(GetGemmProgram(GemmProgram::kIndirect), "XgemmStrassenSplit");
+    kernel.SetArgument(0, static_cast<int>(one));
+    kernel.SetArgument(1, static_cast<int>(two));
+    kernel.SetArgument(2, static_cast<int>(ld));
+    kernel.SetArgument(3, static_cast<int>(element(rotated, offset, ld, 0, 0)));
+    kernel.SetArgument(4, static_cast<int>(element(rotated, offset, ld, 0, cols)));
+    kernel.SetArgument(5, static_cast<int>(element(rotated, offset, ld, rows, 0)));
+    kernel.SetArgument(6, static_cast<int>(element(rotated, offset, ld, rows, cols)));
+    kernel.SetArgument(7, buffer());
+    kernel.SetArgument(8, dest());
+    kernel.SetArgument(9, static_cast<int>(dest_size));
+    kernel.SetArgument(10, static_cast<int>(is_b));
+    const auto global = ThreadRange{Ceil(one, params.copy.dimx), Ceil(two, params.copy.dimy)};
+    auto eventSplit = Event();
+    RunKernel(kernel, queue_, device_, global, local, IntermediateEvent(queue_, eventSplit));
+    eventWaitList.push_back(eventSplit);
+  };
+  split(a_rotated, m_half, k_half, a_ld, a_offset, a_buffer, s_temp, a_size, false);
+  split(b_rotated, k_half, n_half, b_ld, b_offset, b_buffer, t_temp, b_size, true);
+
+  // Runs the seven GEMMs on the same queue, one level deeper
+  const auto product = [&](const size_t index,
+                           const Buffer<T> &a, const size_t a_product_offset, const size_t a_product_ld,
+                           const Buffer<T> &b, const size_t b_product_offset, const size_t b_product_ld) {
+    auto eventGemm = Event();
+    auto gemm = Xgemm<T>(queue_, IntermediateEvent(queue_, eventGemm));
+    gemm.strassen_depth_ = strassen_depth_ + 1;
+    gemm.DoGemm(layout, a_transpose, b_transpose, m_half, n_half, k_half, ConstantOne<T>(),
+                a, a_product_offset, a_product_ld, b, b_product_offset, b_product_ld,
+                ConstantZero<T>(), p_temp, index * c_size, c_one);
+    eventWaitList.push_back(eventGemm);
+  };
+  product(0, a_buffer, element(a_rotated, a_offset, a_ld, 0, 0), a_ld,
+          b_buffer, element(b_rotated, b_offset, b_ld, 0, 0), b_ld); // P1 = A11 * B11
+  product(1, a_buffer, element(a_rotated, a_offset, a_ld, 0, k_half), a_ld,
+          b_buffer, element(b_rotated, b_offset, b_ld, k_half, 0), b_ld); // P2 = A12 * B21
+  product(2, s_temp, 3 * a_size, a_one,
+          b_buffer, element(b_rotated, b_offset, b_ld, k_half, n_half), b_ld); // P3 = S4 * B22
+  product(3, a_buffer, element(a_rotated, a_offset, a_ld, m_half, k_half), a_ld,
+          t_temp, 3 * b_size, b_one); // P4 = A22 * T4
+  product(4, s_temp, 0, a_one, t_temp, 0, b_one); // P5 = S1 * T1
+  product(5, s_temp, a_size, a_one, t_temp, b_size, b_one); // P6 = S2 * T2
+  product(6, s_temp, 2 * a_size, a_one, t_temp, 2 * b_size, b_one); // P7 = S3 * T3
+
+  // The GEMMs for the left-out parts of odd sizes, the last of which completes the routine
+  auto num_remaining = (m % 2) + (n % 2) + (k % 2);
+  const auto remainder = [&](const size_t sub_m, const size_t sub_n, const size_t sub_k,
+                             const size_t a_sub_offset, const size_t b_sub_offset, const T sub_beta,
+                             const size_t c_sub_offset) {
+    auto eventGemm = Event();
+    num_remaining--;
+    auto gemm = Xgemm<T>(queue_, (num_remaining == 0) ? event_ : IntermediateEvent(queue_, eventGemm));
+    gemm.DoGemm(layout, a_transpose, b_transpose, sub_m, sub_n, sub_k, alpha,
+                a_buffer, a_sub_offset, a_ld, b_buffer, b_sub_offset, b_ld, sub_beta,
+                c_buffer, c_sub_offset, c_ld);
+  };
+
+  // Combines the seven products into the quadrants of matrix C
+  auto eventCombine = Event();
+  auto kernel = GetKernel(GetGemmProgram(GemmProgram::kIndirect), "XgemmStrassenCombine");
+  kernel.SetArgument(0, static_cast<int>(c_one));
+  kernel.SetArgument(1, static_cast<int>((c_rotated) ? m_half : n_half));
+  kernel.SetArgument(2, GetRealArg(alpha));
+  kernel.SetArgument(3, GetRealArg(beta));
+  kernel.SetArgument(4, p_temp());
+  kernel.SetArgument(5, static_cast<int>(c_size));
+  kernel.SetArgument(6, c_buffer());
+  kernel.SetArgument(7, static_cast<int>(c_ld));
+  kernel.SetArgument(8, static_cast<int>(element(c_rotated, c_offset, c_ld, 0, 0)));
+  kernel.SetArgument(9, static_cast<int>(element(c_rotated, c_offset, c_ld, 0, n_half)));
+  kernel.SetArgument(10, static_cast<int>(element(c_rotated, c_offset, c_ld, m_half, 0)));
+  kernel.SetArgument(11, static_cast<int>(element(c_rotated, c_offset, c_ld, m_half, n_half)));
+  const auto global = ThreadRange{Ceil(c_one, params.copy.dimx),
+                                  Ceil((c_rotated) ? m_half : n_half, params.copy.dimy)};
+  RunKernel(kernel, queue_, device_, global, local,
+            (num_remaining == 0) ? event_ : IntermediateEvent(queue_, eventCombine), eventWaitList);
+
+  // Computes the left-out parts: the rank-1 update of the quadrants for an odd k (after combining),
+  // and the last row and the last column of C for an odd m and n respectively
+  if (k % 2 == 1) {
+    remainder(2 * m_half, 2 * n_half, 1, element(a_rotated, a_offset, a_ld, 0, k - 1),
+              element(b_rotated, b_offset, b_ld, k - 1, 0), ConstantOne<T>(),
+              element(c_rotated, c_offset, c_ld, 0, 0));
+  }
+  if (m % 2 == 1) {
+    remainder(1, n, k, element(a_rotated, a_offset, a_ld, m - 1, 0), b_offset, beta,
+              element(c_rotated, c_offset, c_ld, m - 1, 0));
+  }
+  if (n % 2 == 1) {
+    remainder(2 * m_half, 1, k, a_offset, element(b_rotated, b_offset, b_ld, 0, n - 1), beta,
+              element(c_rotated, c_offset, c_ld, 0, n - 1));
+  }
 }
 
 // =================================================================================================
@@ -298,6 +1259,7 @@ template class Xgemm<float>;
 template class Xgemm<double>;
 template class Xgemm<float2>;
 template class Xgemm<double2>;
+template class Xgemm<bfloat16>;
 
 // =================================================================================================
 } // namespace clblast
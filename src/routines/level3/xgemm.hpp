@@ -14,16 +14,56 @@
 #ifndef CLBLAST_ROUTINES_XGEMM_H_
 #define CLBLAST_ROUTINES_XGEMM_H_
 
+#include <cmath>
+
 #include "routine.hpp"
 
 namespace clblast {
 // =================================================================================================
 
+// The arguments of the optional epilogue of the GEMM kernels (see 'GemmWithEpilogue' in clblast.h)
+template <typename T>
+struct GemmEpilogue {
+  EpilogueBias bias_mode;
+  Buffer<T> bias_buffer;
+  size_t bias_offset;
+  EpilogueActivation activation;
+  T low;
+  T high;
+};
+
+// The separate output matrix D of the out-of-place GEMM (see 'GemmOutOfPlace' in clblast.h), in the
+// same layout as matrix C
+template <typename T>
+struct GemmOutput {
+  Buffer<T> d_buffer;
+  size_t d_offset;
+  size_t d_ld;
+};
+
+// The structure of an input matrix of the direct GEMM kernels, applied while loading the matrix
+// instead of expanding it into a general matrix first: used by the SYMM, HEMM and TRMM routines
+struct GemmStructure {
+  size_t operand; // the structured matrix: 0 for none, 1 for A, and 2 for B
+  bool upper; // whether the upper triangle is stored (in column-major terms)
+  bool unit_diagonal; // whether the diagonal is assumed to be one (TRMM only)
+};
+
+// The programs of the GEMM routines, which are compiled separately and only when first needed: the
+// pre- and post-processing kernels (copy, pad, transpose, and conversion of structured matrices),
+// the direct kernels (including split-K), the indirect kernels (including 3M and Strassen-Winograd
+// helpers), the skinny kernel, and the image kernels
+enum class GemmProgram { kProcessing, kDirect, kIndirect, kSkinny, kImage };
+
 // See comment at top of file for a description of the class
 template <typename T>
 class Xgemm: public Routine {
  public:
 
+  // The precision of the kernels: in mixed-precision mode, enabled through the environmental variable
+  // CLBLAST_MIXED_PRECISION, half-precision data is accumulated in single precision
+  static Precision KernelPrecision(const Queue &queue, const std::string &name);
+
   // Defines the assumptions of the GEMM kernels
   static const bool a_want_rotated_(const size_t gemm_kernel_id) { return gemm_kernel_id == 1; }
   static const bool b_want_rotated_(const size_t gemm_kernel_id) { return true; }
@@ -66,14 +106,125 @@ class Xgemm: public Routine {
                            b_temp_offset, c_temp_offset);
   }
 
-  // Selects which version of GEMM to run
+  // Selects which version of GEMM to run. This is a cost model: the in-direct version is used for
+  // m*n*k of at least 'min_indirect_size' cubed plus 'copy_cost' multiply-adds for each element of
+  // its temporary buffers ('temp_size', see 'GetTempSize'), which the direct version doesn't need.
   static bool UseDirectKernel(const size_t m, const size_t n, const size_t k,
-                              const size_t min_indirect_size) {
+                              const size_t min_indirect_size,
+                              const size_t copy_cost = 0, const size_t temp_size = 0) {
     const auto m_n_k = static_cast<unsigned long long>(m) * static_cast<unsigned long long>(n) *
                        static_cast<unsigned long long>(k);
     const auto min_indirect_size_ll = static_cast<unsigned long long>(min_indirect_size);
     const auto min_indirect_size_e3 = min_indirect_size_ll * min_indirect_size_ll * min_indirect_size_ll;
-    return (m_n_k < min_indirect_size_e3);
+    const auto copy_cost_ll = static_cast<unsigned long long>(copy_cost) *
+                              static_cast<unsigned long long>(temp_size);
+    return (m_n_k < min_indirect_size_e3 + copy_cost_ll);
+  }
+
+  // As above, but computes the temporary buffer sizes for the given arguments. These are only
+  // computed if the 'XGEMM_INDIRECT_COPY_COST' parameter is set.
+  static bool UseDirectKernel(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t m, const size_t n, const size_t k,
+                              const size_t a_offset, const size_t a_ld,
+                              const size_t b_offset, const size_t b_ld,
+                              const size_t c_offset, const size_t c_ld,
+                              const database::FlatParameters &params) {
+    const auto copy_cost = params.gemm_routine.indirect_copy_cost;
+    if (copy_cost == 0) { return UseDirectKernel(m, n, k, params.gemm_routine.min_indirect_size); }
+    const auto temp_size = GetTempSize(layout, a_transpose, b_transpose, m, n, k,
+                                       a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
+                                       params.xgemm.mwg, params.xgemm.nwg,
+                                       params.xgemm.kwg * params.xgemm.kreg, params.xgemm.gemmk);
+    return UseDirectKernel(m, n, k, params.gemm_routine.min_indirect_size, copy_cost, temp_size);
+  }
+
+  // Selects whether the direct kernel can run its fast version without boundary checks: all tiles
+  // are complete, and matrices A and B can be loaded with the vector data-types
+  static bool UseDirectFastKernel(const size_t m, const size_t n, const size_t k,
+                                  const size_t a_offset, const size_t a_ld,
+                                  const size_t b_offset, const size_t b_ld,
+                                  const size_t wgd, const size_t vwmd, const size_t vwnd) {
+    return IsMultiple(m, wgd) && IsMultiple(n, wgd) && IsMultiple(k, wgd) &&
+           IsMultiple(a_offset, vwmd) && IsMultiple(a_ld, vwmd) &&
+           IsMultiple(b_offset, vwnd) && IsMultiple(b_ld, vwnd);
+  }
+
+  // Computes the size of the slices of the K-dimension for the split-K version of GEMM: a multiple
+  // of the direct kernel's tile size, at least as large as m and n, and such that there are at most
+  // 'kSplitKMaxSlices' slices
+  static size_t GetSplitKSliceSize(const size_t m, const size_t n, const size_t k, const size_t wgd) {
+    constexpr auto kSplitKMaxSlices = size_t{32};
+    const auto slice_size = std::max(CeilDiv(k, kSplitKMaxSlices), std::max(m, n));
+    return Ceil(slice_size, wgd);
+  }
+
+  // Selects whether to run the split-K version of GEMM: for small m and n but a large k, the other
+  // versions only launch a few work-groups. A 'min_splitk_k' of zero disables the split-K version.
+  static bool UseSplitKernel(const size_t m, const size_t n, const size_t k,
+                             const size_t min_splitk_k, const size_t wgd) {
+    if (min_splitk_k == 0 || k < min_splitk_k) { return false; }
+    const auto m_n = static_cast<unsigned long long>(m) * static_cast<unsigned long long>(n);
+    if (m_n > static_cast<unsigned long long>(k)) { return false; }
+    return GetSplitKSliceSize(m, n, k, wgd) < k; // at least two slices
+  }
+
+  // Selects whether to run the skinny version of GEMM: a multi-vector GEMV for problems with an 'n'
+  // (or 'm') of at most 'kSkinnyMaxN', the SKINNY_N of the kernel, which streams matrix A (or B)
+  // once. The other dimension has to be at least 'kSkinnyMinLength' to keep the device busy.
+  static bool UseSkinnyKernel(const size_t m, const size_t n) {
+    constexpr auto kSkinnyMaxN = size_t{16};
+    constexpr auto kSkinnyMinLength = size_t{256};
+    return (n <= kSkinnyMaxN && m >= kSkinnyMinLength) ||
+           (m <= kSkinnyMaxN && n >= kSkinnyMinLength);
+  }
+
+  // Selects whether to run the 3M version of complex GEMM, i.e. three real-valued GEMMs instead of
+  // a complex one. It requires 25% fewer floating-point operations and uses the real-valued GEMM
+  // kernels, but it is less accurate: the error of the imaginary part is proportional to
+  // |Ar + Ai| * |Br + Bi| instead of to |A| * |B|. It is therefore only used for complex problem
+  // sizes of at least 'min_3m_size' (as 'GetProblemSize'), a 'min_3m_size' of zero disables it.
+  static bool Use3MKernel(const size_t m, const size_t n, const size_t k, const size_t min_3m_size) {
+    const auto is_complex = PrecisionValue<T>() == Precision::kComplexSingle ||
+                            PrecisionValue<T>() == Precision::kComplexDouble;
+    if (!is_complex || min_3m_size == 0) { return false; }
+    return GetProblemSize(m, n, k) >= min_3m_size;
+  }
+
+  // Selects whether to run a level of the Strassen-Winograd version of GEMM, i.e. seven GEMMs on the
+  // quadrants of the matrices instead of eight, which requires 12.5% fewer floating-point operations
+  // per level. Its error bound grows with the recursion depth, which is limited to
+  // 'kStrassenMaxDepth' levels: each level is applied if all of m, n, and k are at least
+  // 'min_strassen_size', such that the thresholds select the depth. It is only used for single and
+  // double precision, a 'min_strassen_size' of zero disables it.
+  static bool UseStrassenKernel(const size_t m, const size_t n, const size_t k,
+                                const size_t min_strassen_size, const size_t depth) {
+    constexpr auto kStrassenMaxDepth = size_t{2};
+    const auto is_supported = PrecisionValue<T>() == Precision::kSingle ||
+                              PrecisionValue<T>() == Precision::kDouble;
+    if (!is_supported || min_strassen_size == 0 || depth >= kStrassenMaxDepth) { return false; }
+    return std::min(std::min(m, n), k) >= std::max(min_strassen_size, size_t{2});
+  }
+
+  // Selects whether to run the image version of GEMM, which reads matrices A and B from 2D images
+  // through the texture caches of mobile GPUs such as Qualcomm Adreno and ARM Mali. It is only used
+  // for single and half precision, for problem sizes (as 'GetProblemSize') of at least
+  // 'min_image_size', a 'min_image_size' of zero disables it. The images are a quarter of m (or n)
+  // wide and k high, which has to fit within the maximum 2D image size of the device.
+  static bool UseImageKernel(const size_t m, const size_t n, const size_t k,
+                             const size_t min_image_size,
+                             const size_t max_image_width, const size_t max_image_height) {
+    const auto is_supported = PrecisionValue<T>() == Precision::kSingle ||
+                              PrecisionValue<T>() == Precision::kHalf;
+    if (!is_supported || min_image_size == 0) { return false; }
+    if (CeilDiv(std::max(m, n), size_t{4}) > max_image_width || k > max_image_height) { return false; }
+    return GetProblemSize(m, n, k) >= min_image_size;
+  }
+
+  // The problem size used to select the size-specific kernel parameters: the geometric mean of m,
+  // n, and k, such that it matches m=n=k as used by the tuners
+  static size_t GetProblemSize(const size_t m, const size_t n, const size_t k) {
+    const auto m_n_k = static_cast<double>(m) * static_cast<double>(n) * static_cast<double>(k);
+    return static_cast<size_t>(std::round(std::cbrt(m_n_k)));
   }
 
   // Process the user-arguments, computes secondary parameters
@@ -153,9 +304,66 @@ class Xgemm: public Routine {
     c_two_i = (c_want_rotated_(gemm_kernel_id)) ? m_ceiled : n_ceiled;
   }
 
+  // Computes the size (in elements) of a packed operand A or B: the matrix in the internal (ceiled
+  // and possibly rotated) layout of the indirect GEMM kernel, see 'DoPackOperand'
+  static size_t GetPackedSize(const GemmOperand operand, const size_t m, const size_t n, const size_t k,
+                              const size_t mwg, const size_t nwg, const size_t kwg,
+                              const size_t gemm_kernel_id) {
+    size_t a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i;
+    CalculateInternalDimensions(m, n, k, mwg, nwg, kwg,
+                                a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i,
+                                gemm_kernel_id);
+    return (operand == GemmOperand::kA) ? a_one_i * a_two_i : b_one_i * b_two_i;
+  }
+
+  // Tests the epilogue arguments for validity, given the sizes of matrix C
+  static void TestEpilogue(const GemmEpilogue<T> &epilogue, const size_t m, const size_t n) {
+    const auto is_complex = PrecisionValue<T>() == Precision::kComplexSingle ||
+                            PrecisionValue<T>() == Precision::kComplexDouble;
+    if (epilogue.activation != EpilogueActivation::kNone && is_complex) {
+      throw BLASError(StatusCode::kNotImplemented);
+    }
+    if (epilogue.bias_mode != EpilogueBias::kNone) {
+      const auto bias_size = (epilogue.bias_mode == EpilogueBias::kPerRow) ? m : n;
+      if (epilogue.bias_buffer() == nullptr) { throw BLASError(StatusCode::kInvalidValue); }
+      if (GetBufferSize(epilogue.bias_buffer) < (epilogue.bias_offset + bias_size) * sizeof(T)) {
+        throw BLASError(StatusCode::kInvalidValue);
+      }
+    }
+  }
+
+  // Sets the epilogue kernel arguments, starting at argument 'first_index'
+  static void SetEpilogueArguments(Kernel &kernel, const size_t first_index,
+                                   const GemmEpilogue<T> &epilogue, const size_t m, const size_t n) {
+    const auto bias_size = (epilogue.bias_mode == EpilogueBias::kPerRow) ? m : n;
+    kernel.SetArgument(first_index + 0, static_cast<int>(epilogue.bias_mode));
+    kernel.SetArgument(first_index + 1, epilogue.bias_buffer());
+    kernel.SetArgument(first_index + 2, static_cast<int>(epilogue.bias_offset));
+    kernel.SetArgument(first_index + 3, static_cast<int>(bias_size));
+    kernel.SetArgument(first_index + 4, static_cast<int>(epilogue.activation));
+    kernel.SetArgument(first_index + 5, GetRealArg(epilogue.low));
+    kernel.SetArgument(first_index + 6, GetRealArg(epilogue.high));
+  }
+
   // Constructor
   Xgemm(Queue &queue, EventPointer event, const std::string &name = "GEMM");
 
+  // Sets the epilogue for the next calls, only available for the "GEMMEPILOGUE" routine
+  void SetEpilogue(const GemmEpilogue<T> &epilogue) { epilogue_ = epilogue; }
+
+  // Sets the output matrix D for the next calls, only available for the "GEMMOUTOFPLACE" routine.
+  // Matrix C is then only read. The split-K, skinny, 3M and Strassen-Winograd versions are not used.
+  void SetOutput(const GemmOutput<T> &output) { output_ = output; }
+
+  // Sets the structure of an input matrix for the next calls, only available for the "SYMM",
+  // "HEMM", and "TRMM" routines. A structured input matrix always uses the direct GEMM kernel.
+  void SetStructure(const GemmStructure &structure) { structure_ = structure; }
+
+  // Sets the device buffers from which the kernel reads alpha and beta for the next calls, only
+  // available for the "GEMMDEVICE" routine. Device scalars always use the direct GEMM kernel, the
+  // scalars passed to 'DoGemm' are then ignored.
+  void SetDeviceScalars(const DeviceScalars<T> &device_scalars) { device_scalars_ = device_scalars; }
+
   // Templated-precision implementation of the routine
   void DoGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
               const size_t m, const size_t n, const size_t k,
@@ -166,6 +374,43 @@ class Xgemm: public Routine {
               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
               const Buffer<T> &temp_buffer = Buffer<T>(0), const bool temp_buffer_provided = false);
 
+  // Packs operand A or B once into the internal layout of the indirect GEMM kernel: padded, and
+  // transposed and conjugated if needed. The result only depends on the sizes and on the operand
+  // after applying the transpose, not on the layout or the leading dimension.
+  void DoPackOperand(const Layout layout, const GemmOperand operand, const Transpose transpose,
+                     const size_t m, const size_t n, const size_t k,
+                     const Buffer<T> &buffer, const size_t offset, const size_t ld,
+                     const Buffer<T> &packed_buffer);
+
+  // As 'DoGemm', but with operands A and/or B packed by 'DoPackOperand', such that their
+  // pre-processing is skipped. This always uses the indirect GEMM kernel. For packed operands, the
+  // transpose, offset and leading dimension arguments are not used.
+  void DoGemmPacked(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                    const size_t m, const size_t n, const size_t k,
+                    const T alpha,
+                    const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const bool a_packed,
+                    const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const bool b_packed,
+                    const T beta,
+                    const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+
+  // Packs operand A or B once into a newly created 2D image for the image version of GEMM (see
+  // 'xgemm_image.opencl'). As for 'DoPackOperand', the result only depends on the sizes and on the
+  // operand after applying the transpose. The image is owned by the returned object.
+  Buffer<T> DoPackImage(const Layout layout, const GemmOperand operand, const Transpose transpose,
+                        const size_t m, const size_t n, const size_t k,
+                        const Buffer<T> &buffer, const size_t offset, const size_t ld);
+
+  // As 'DoGemm', but always with the image version of GEMM, and with operands A and/or B already
+  // packed into images by 'DoPackImage'. For those, the transpose, offset and leading dimension
+  // arguments are not used.
+  void DoGemmImages(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                    const size_t m, const size_t n, const size_t k,
+                    const T alpha,
+                    const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const bool a_image,
+                    const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const bool b_image,
+                    const T beta,
+                    const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+
   // Indirect version of GEMM (with pre and post-processing kernels)
   void GemmIndirect(const size_t m, const size_t n, const size_t k,
                     const T alpha,
@@ -178,10 +423,36 @@ class Xgemm: public Routine {
                     const size_t a_one, const size_t a_two,
                     const size_t b_one, const size_t b_two,
                     const size_t c_one, const size_t c_two,
-                    const Buffer<T> &temp_buffer, const bool temp_buffer_provided);
+                    const Buffer<T> &temp_buffer, const bool temp_buffer_provided,
+                    const bool a_packed = false, const bool b_packed = false,
+                    const bool shape_specialised = false);
 
-  // Direct version of GEMM (no pre and post-processing kernels)
+  // As above, but computed in blocks of matrix C such that the temporary buffers of each block stay
+  // within the workspace limit (in elements) and its work within the chunk limit (in multiply-adds,
+  // zero for none, see 'GemmWorkspace')
+  void GemmIndirectBlocked(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                           const size_t m, const size_t n, const size_t k,
+                           const T alpha,
+                           const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                           const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                           const T beta,
+                           const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                           const size_t gemm_kernel_id, const size_t workspace_limit,
+                           const size_t chunk_limit);
+
+  // Direct version of GEMM (no pre and post-processing kernels), optionally with 64-bit indices
   void GemmDirect(const size_t m, const size_t n, const size_t k,
+                  const T alpha,
+                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                  const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                  const T beta,
+                  const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                  const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                  const bool a_conjugate, const bool b_conjugate,
+                  const bool index64 = false);
+
+  // Split-K version of GEMM (the direct kernel per slice of K, plus a reduction kernel)
+  void GemmSplitK(const size_t m, const size_t n, const size_t k,
                   const T alpha,
                   const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                   const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
@@ -189,6 +460,93 @@ class Xgemm: public Routine {
                   const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
                   const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                   const bool a_conjugate, const bool b_conjugate);
+
+  // Skinny version of GEMM for a small 'n' or 'm' (a single kernel)
+  void GemmSkinny(const size_t m, const size_t n, const size_t k,
+                  const T alpha,
+                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                  const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                  const T beta,
+                  const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                  const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                  const bool a_conjugate, const bool b_conjugate);
+
+  // 3M version of complex GEMM (three real-valued GEMMs, plus kernels to split and combine)
+  void Gemm3M(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+              const size_t m, const size_t n, const size_t k,
+              const T alpha,
+              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+              const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+              const T beta,
+              const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+              const size_t a_one, const size_t a_two,
+              const size_t b_one, const size_t b_two,
+              const size_t c_one, const size_t c_two);
+
+  // Image version of GEMM (matrices A and B are read from images, into which they are packed first
+  // unless 'a_image' or 'b_image' is set)
+  void GemmImage(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                 const size_t m, const size_t n, const size_t k,
+                 const T alpha,
+                 const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const bool a_image,
+                 const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const bool b_image,
+                 const T beta,
+                 const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+
+  // Strassen-Winograd version of GEMM (one level of seven GEMMs, plus kernels to split and combine)
+  void GemmStrassen(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                    const size_t m, const size_t n, const size_t k,
+                    const T alpha,
+                    const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                    const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                    const T beta,
+                    const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+
+ protected:
+
+  // Retrieves one of the GEMM programs, compiling it if needed
+  const Program& GetGemmProgram(const GemmProgram program) {
+    return GetProgram(static_cast<size_t>(program));
+  }
+
+  // Creates an image for operand A or B of the image version of GEMM and packs the operand into it,
+  // after the events in 'waitForEvents'
+  Buffer<T> PackImage(const Layout layout, const GemmOperand operand, const Transpose transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const Buffer<T> &buffer, const size_t offset, const size_t ld,
+                      EventPointer event, const std::vector<Event> &waitForEvents = {});
+
+  // Throws if the image version of GEMM can't be used for these sizes, or on this device at all
+  void TestImageSupport(const size_t m, const size_t n, const size_t k);
+
+  // Retrieves the indirect program specialised for the given (ceiled) sizes, compiling it if needed
+  Program GetShapeProgram(const size_t m_ceiled, const size_t n_ceiled, const size_t k_ceiled) {
+    const auto defines = "#define GEMM_SHAPE 1\n"
+                         "#define GEMM_SHAPE_M " + ToString(m_ceiled) + "\n"
+                         "#define GEMM_SHAPE_N " + ToString(n_ceiled) + "\n"
+                         "#define GEMM_SHAPE_K " + ToString(k_ceiled) + "\n";
+    const auto identifier = "_shape" + ToString(m_ceiled) + "x" + ToString(n_ceiled) + "x" +
+                            ToString(k_ceiled);
+    return GetSpecialisedProgram(static_cast<size_t>(GemmProgram::kIndirect), defines, identifier);
+  }
+
+  // Retrieves the masked variant of the indirect program for unpadded matrices (see 'GemmIndirect'),
+  // compiling it if needed
+  Program GetMaskedProgram() {
+    return GetSpecialisedProgram(static_cast<size_t>(GemmProgram::kIndirect),
+                                 "#define GEMM_MASKED 1\n", "_masked");
+  }
+
+ private:
+  const bool has_epilogue_;
+  GemmEpilogue<T> epilogue_;
+  const bool has_structure_;
+  GemmStructure structure_;
+  const bool has_device_scalars_;
+  DeviceScalars<T> device_scalars_;
+  const bool has_output_;
+  GemmOutput<T> output_;
+  size_t strassen_depth_; // the number of Strassen-Winograd levels above this GEMM
 };
 
 // =================================================================================================
@@ -0,0 +1,279 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the GemmPlan class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/level3/xgemmplan.hpp"
+#ifdef OPENCL_API
+  #include "profiling.hpp"
+#endif
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: builds the routine and pre-computes everything that does not depend on the data
+template <typename T>
+GemmPlan<T>::GemmPlan(Queue &queue, const Layout layout,
+                      const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const size_t a_offset, const size_t a_ld,
+                      const size_t b_offset, const size_t b_ld,
+                      const size_t c_offset, const size_t c_ld):
+    Xgemm<T>(queue, nullptr),
+    m_(m), n_(n), k_(k),
+    a_offset_(a_offset), a_ld_(a_ld), b_offset_(b_offset), b_ld_(b_ld),
+    c_offset_(c_offset), c_ld_(c_ld),
+    index64_(false),
+    m_ceiled_(0), n_ceiled_(0), k_ceiled_(0),
+    a_one_i_(0), a_two_i_(0), b_one_i_(0), b_two_i_(0), c_one_i_(0), c_two_i_(0),
+    a_no_temp_(true), b_no_temp_(true), c_no_temp_(true),
+    b_temp_offset_(0), c_temp_offset_(0), temp_size_(0),
+    vwm_(1), vwn_(1),
+    temp_buffer_(0) {
+  this->trace_.End(); // the plan outlives its creation, the executions are traced and counted below
+  this->statistics_.End();
+  #ifdef OPENCL_API
+    this->slow_call_.End();
+  #endif
+  this->SelectSizeVariant(Xgemm<T>::GetProblemSize(m, n, k));
+  const auto &params = this->db_.GetFlatParameters();
+
+  // Selects which version of GEMM to run and processes the arguments accordingly. As in
+  // 'Xgemm::DoGemm', matrices of more than 2^31 elements are only supported by the direct kernel
+  // with 64-bit indices.
+  index64_ = RequiresIndex64({a_offset + a_ld * std::max(m, k),
+                              b_offset + b_ld * std::max(n, k),
+                              c_offset + c_ld * std::max(m, n)});
+  do_gemm_direct_ = index64_ ||
+                    Xgemm<T>::UseDirectKernel(layout, a_transpose, b_transpose, m, n, k,
+                                              a_offset, a_ld, b_offset, b_ld, c_offset, c_ld,
+                                              params);
+  const auto gemm_kernel_id = (do_gemm_direct_) ? 0 : params.xgemm.gemmk;
+  Xgemm<T>::ProcessArguments(layout, a_transpose, b_transpose, m, n, k,
+                             a_one_, a_two_, b_one_, b_two_, c_one_, c_two_,
+                             a_do_transpose_, b_do_transpose_, c_do_transpose_,
+                             a_conjugate_, b_conjugate_, gemm_kernel_id);
+
+  // Tests the leading dimensions once. The buffers themselves are tested upon execution.
+  if (a_ld < a_one_) { throw BLASError(StatusCode::kInvalidLeadDimA); }
+  if (b_ld < b_one_) { throw BLASError(StatusCode::kInvalidLeadDimB); }
+  if (c_ld < c_one_) { throw BLASError(StatusCode::kInvalidLeadDimC); }
+
+  // The direct version of GEMM: only the kernel and the thread configuration
+  if (do_gemm_direct_) {
+    const auto name = (a_do_transpose_) ? (b_do_transpose_ ? "XgemmDirectTT" : "XgemmDirectTN") :
+                                          (b_do_transpose_ ? "XgemmDirectNT" : "XgemmDirectNN");
+    const auto program = (index64_) ?
+                         this->GetIndex64Program(static_cast<size_t>(GemmProgram::kDirect)) :
+                         this->GetGemmProgram(GemmProgram::kDirect);
+    kernel_ = Kernel(program, name);
+    const auto m_ceiled = Ceil(m, params.xgemm_direct.wgd);
+    const auto n_ceiled = Ceil(n, params.xgemm_direct.wgd);
+    global_ = {(m_ceiled * params.xgemm_direct.mdimcd) / params.xgemm_direct.wgd,
+               (n_ceiled * params.xgemm_direct.ndimcd) / params.xgemm_direct.wgd};
+    local_ = {params.xgemm_direct.mdimcd, params.xgemm_direct.ndimcd};
+    return;
+  }
+
+  // The indirect version of GEMM: also computes the layout of the temporary buffer
+  m_ceiled_ = Ceil(m, params.xgemm.mwg);
+  n_ceiled_ = Ceil(n, params.xgemm.nwg);
+  k_ceiled_ = Ceil(k, params.xgemm.kwg * params.xgemm.kreg);
+  Xgemm<T>::CalculateInternalDimensions(m, n, k, params.xgemm.mwg, params.xgemm.nwg,
+                                        params.xgemm.kwg * params.xgemm.kreg,
+                                        a_one_i_, a_two_i_, b_one_i_, b_two_i_, c_one_i_, c_two_i_,
+                                        params.xgemm.gemmk);
+  a_no_temp_ = Xgemm<T>::NoTempBuffer(a_one_, a_one_i_, a_two_, a_two_i_, a_ld, a_offset,
+                                      a_do_transpose_, a_conjugate_);
+  b_no_temp_ = Xgemm<T>::NoTempBuffer(b_one_, b_one_i_, b_two_, b_two_i_, b_ld, b_offset,
+                                      b_do_transpose_, b_conjugate_);
+  c_no_temp_ = Xgemm<T>::NoTempBuffer(c_one_, c_one_i_, c_two_, c_two_i_, c_ld, c_offset,
+                                      c_do_transpose_, false);
+  temp_size_ = Xgemm<T>::ComputeTempSize(a_no_temp_, b_no_temp_, c_no_temp_,
+                                         a_one_i_*a_two_i_, b_one_i_*b_two_i_, c_one_i_*c_two_i_,
+                                         b_temp_offset_, c_temp_offset_);
+  vwm_ = params.xgemm.vwm;
+  vwn_ = params.xgemm.vwn;
+  if (!IsMultiple(b_temp_offset_, vwn_)) { throw BLASError(StatusCode::kUnexpectedError); }
+  if (!IsMultiple(c_temp_offset_, vwm_)) { throw BLASError(StatusCode::kUnexpectedError); }
+
+  // Allocates the temporary buffer once for all executions (can be overridden by the user)
+  if (temp_size_ > 0) { temp_buffer_ = Buffer<T>(this->context_, temp_size_); }
+
+  // Retrieves the main kernel and computes the global and local thread sizes
+  kernel_ = Kernel(this->GetGemmProgram(GemmProgram::kIndirect), "Xgemm");
+  global_ = {(c_one_i_ * params.xgemm.mdimc) / params.xgemm.mwg,
+             (c_two_i_ * params.xgemm.ndimc) / params.xgemm.nwg};
+  local_ = {params.xgemm.mdimc, params.xgemm.ndimc};
+}
+
+// =================================================================================================
+
+// Executes the plan with the provided data
+template <typename T>
+void GemmPlan<T>::Execute(Queue &queue, EventPointer event,
+                          const T alpha, const Buffer<T> &a_buffer, const Buffer<T> &b_buffer,
+                          const T beta, const Buffer<T> &c_buffer,
+                          const Buffer<T> &temp_buffer, const bool temp_buffer_provided) {
+  const TraceScope trace(this->routine_name_, "routine");
+  const RoutineStatisticsScope statistics(this->routine_name_);
+  #ifdef OPENCL_API
+    const SlowCallScope slow_call(this->routine_name_);
+  #endif
+
+  // Binds the queue and event of this execution. The queue only has to be checked in case it
+  // differs from the one the plan was created with.
+  if (queue() != this->queue_()) {
+    if (queue.GetContext()() != this->context_() || queue.GetDevice()() != this->device_()) {
+      throw BLASError(StatusCode::kInvalidCommandQueue, "plan was created for another context or device");
+    }
+    this->queue_ = queue;
+  }
+  this->event_ = event;
+  this->input_events_ = BeginCommandChain(this->queue_);
+  #ifdef OPENCL_API
+    if (IsProfilingEnabled()) { SetProfilingRoutine(this->routine_name_); }
+  #endif
+
+  // Tests the buffers for validity and sufficient storage space
+  TestMatrixA(a_one_, a_two_, a_buffer, a_offset_, a_ld_, false, true);
+  TestMatrixB(b_one_, b_two_, b_buffer, b_offset_, b_ld_, false, true);
+  TestMatrixC(c_one_, c_two_, c_buffer, c_offset_, c_ld_, true);
+
+  if (do_gemm_direct_) {
+    ExecuteDirect(alpha, a_buffer, b_buffer, beta, c_buffer);
+  }
+  else {
+    ExecuteIndirect(alpha, a_buffer, b_buffer, beta, c_buffer, temp_buffer, temp_buffer_provided);
+  }
+}
+
+// =================================================================================================
+
+// The direct version of GEMM (see 'Xgemm::GemmDirect')
+template <typename T>
+void GemmPlan<T>::ExecuteDirect(const T alpha, const Buffer<T> &a_buffer, const Buffer<T> &b_buffer,
+                                const T beta, const Buffer<T> &c_buffer) {
+  kernel_.SetArgument(0, static_cast<int>(m_));
+  kernel_.SetArgument(1, static_cast<int>(n_));
+  kernel_.SetArgument(2, static_cast<int>(k_));
+  kernel_.SetArgument(3, GetRealArg(alpha));
+  kernel_.SetArgument(4, GetRealArg(beta));
+  kernel_.SetArgument(5, a_buffer());
+  SetIndexArgument(kernel_, 6, a_offset_, index64_);
+  SetIndexArgument(kernel_, 7, a_ld_, index64_);
+  kernel_.SetArgument(8, b_buffer());
+  SetIndexArgument(kernel_, 9, b_offset_, index64_);
+  SetIndexArgument(kernel_, 10, b_ld_, index64_);
+  kernel_.SetArgument(11, c_buffer());
+  SetIndexArgument(kernel_, 12, c_offset_, index64_);
+  SetIndexArgument(kernel_, 13, c_ld_, index64_);
+  kernel_.SetArgument(14, static_cast<int>(c_do_transpose_));
+  kernel_.SetArgument(15, static_cast<int>(a_conjugate_));
+  kernel_.SetArgument(16, static_cast<int>(b_conjugate_));
+  RunKernel(kernel_, this->queue_, this->device_, global_, local_, this->event_);
+}
+
+// The indirect version of GEMM (see 'Xgemm::GemmIndirect')
+template <typename T>
+void GemmPlan<T>::ExecuteIndirect(const T alpha, const Buffer<T> &a_buffer, const Buffer<T> &b_buffer,
+                                  const T beta, const Buffer<T> &c_buffer,
+                                  const Buffer<T> &temp_buffer, const bool temp_buffer_provided) {
+
+  // Verifies if the provided temporary buffer is large enough
+  if (temp_buffer_provided) {
+    const auto required_size = temp_size_ * sizeof(T);
+    if (temp_buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryTemp); }
+  }
+  const auto temp_buffer_all = (temp_buffer_provided) ? temp_buffer : temp_buffer_;
+
+  // Sets the buffer pointers for (temp) matrices A, B, and C
+  const auto a_temp = (a_no_temp_) ? a_buffer : temp_buffer_all;
+  const auto b_temp = (b_no_temp_) ? b_buffer : temp_buffer_all;
+  const auto c_temp = (c_no_temp_) ? c_buffer : temp_buffer_all;
+
+  // Events of all kernels (including pre/post processing kernels)
+  auto eventWaitList = std::vector<Event>();
+  const auto &inputEventList = this->input_events_; // see 'BeginCommandChain'
+
+  // Runs the pre-processing kernels for matrices A, B, and C (in case they are needed)
+  if (!a_no_temp_) {
+    auto eventProcessA = Event();
+    PadCopyTransposeMatrix(this->queue_, this->device_, this->db_,
+                           IntermediateEvent(this->queue_, eventProcessA), inputEventList,
+                           a_one_, a_two_, a_ld_, a_offset_, a_buffer,
+                           a_one_i_, a_two_i_, a_one_i_, 0, a_temp,
+                           ConstantOne<T>(), this->GetGemmProgram(GemmProgram::kProcessing),
+                           true, a_do_transpose_, a_conjugate_);
+    eventWaitList.push_back(eventProcessA);
+  }
+  if (!b_no_temp_) {
+    auto eventProcessB = Event();
+    PadCopyTransposeMatrix(this->queue_, this->device_, this->db_,
+                           IntermediateEvent(this->queue_, eventProcessB), inputEventList,
+                           b_one_, b_two_, b_ld_, b_offset_, b_buffer,
+                           b_one_i_, b_two_i_, b_one_i_, b_temp_offset_, b_temp,
+                           ConstantOne<T>(), this->GetGemmProgram(GemmProgram::kProcessing),
+                           true, b_do_transpose_, b_conjugate_);
+    eventWaitList.push_back(eventProcessB);
+  }
+  if (!c_no_temp_ && beta != static_cast<T>(0)) {
+    auto eventProcessC = Event();
+    PadCopyTransposeMatrix(this->queue_, this->device_, this->db_,
+                           IntermediateEvent(this->queue_, eventProcessC), inputEventList,
+                           c_one_, c_two_, c_ld_, c_offset_, c_buffer,
+                           c_one_i_, c_two_i_, c_one_i_, c_temp_offset_, c_temp,
+                           ConstantOne<T>(), this->GetGemmProgram(GemmProgram::kProcessing),
+                           true, c_do_transpose_, false);
+    eventWaitList.push_back(eventProcessC);
+  }
+
+  // Sets the kernel arguments and launches the main kernel
+  kernel_.SetArgument(0, static_cast<int>(m_ceiled_));
+  kernel_.SetArgument(1, static_cast<int>(n_ceiled_));
+  kernel_.SetArgument(2, static_cast<int>(k_ceiled_));
+  kernel_.SetArgument(3, GetRealArg(alpha));
+  kernel_.SetArgument(4, GetRealArg(beta));
+  kernel_.SetArgument(5, a_temp());
+  kernel_.SetArgument(6, b_temp());
+  kernel_.SetArgument(7, c_temp());
+  kernel_.SetArgument(8, static_cast<int>(b_temp_offset_ / vwn_));
+  kernel_.SetArgument(9, static_cast<int>(c_temp_offset_ / vwm_));
+  auto eventKernel = Event();
+  auto eventPointer = (!c_no_temp_) ? IntermediateEvent(this->queue_, eventKernel) : this->event_;
+  RunKernel(kernel_, this->queue_, this->device_, global_, local_, eventPointer, eventWaitList);
+
+  // Runs the post-processing kernel if needed
+  if (!c_no_temp_) {
+    eventWaitList.push_back(eventKernel);
+    PadCopyTransposeMatrix(this->queue_, this->device_, this->db_, this->event_, eventWaitList,
+                           c_one_i_, c_two_i_, c_one_i_, c_temp_offset_, c_temp,
+                           c_one_, c_two_, c_ld_, c_offset_, c_buffer,
+                           ConstantOne<T>(), this->GetGemmProgram(GemmProgram::kProcessing),
+                           false, c_do_transpose_, false);
+  }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class GemmPlan<half>;
+template class GemmPlan<float>;
+template class GemmPlan<double>;
+template class GemmPlan<float2>;
+template class GemmPlan<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,86 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the GemmPlan class: a GEMM for a fixed set of non-data arguments (layout,
+// transposes, sizes, offsets and leading dimensions) on a specific device. All set-up work (the
+// database and program look-ups, the direct-vs-indirect choice, the temporary buffer, the kernel
+// objects, and the thread configuration) is done once upon construction, such that an execution
+// only has to set the kernel arguments and launch the kernels.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMPLAN_H_
+#define CLBLAST_ROUTINES_XGEMMPLAN_H_
+
+#include <vector>
+
+#include "routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class. Note that a plan holds its own kernel
+// objects and temporary buffer, so executions of a single plan should not overlap: use one plan
+// per host thread and execute it on in-order queues.
+template <typename T>
+class GemmPlan: public Xgemm<T> {
+ public:
+
+  // Constructor, performs all the planning
+  GemmPlan(Queue &queue, const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+           const size_t m, const size_t n, const size_t k,
+           const size_t a_offset, const size_t a_ld,
+           const size_t b_offset, const size_t b_ld,
+           const size_t c_offset, const size_t c_ld);
+
+  // Executes the plan on a queue of the same context and device as the plan was created for
+  void Execute(Queue &queue, EventPointer event,
+               const T alpha, const Buffer<T> &a_buffer, const Buffer<T> &b_buffer,
+               const T beta, const Buffer<T> &c_buffer,
+               const Buffer<T> &temp_buffer, const bool temp_buffer_provided);
+
+ private:
+
+  // Implementations of the two versions of GEMM based on the pre-computed values
+  void ExecuteDirect(const T alpha, const Buffer<T> &a_buffer, const Buffer<T> &b_buffer,
+                     const T beta, const Buffer<T> &c_buffer);
+  void ExecuteIndirect(const T alpha, const Buffer<T> &a_buffer, const Buffer<T> &b_buffer,
+                       const T beta, const Buffer<T> &c_buffer,
+                       const Buffer<T> &temp_buffer, const bool temp_buffer_provided);
+
+  // The user arguments that are fixed for this plan
+  const size_t m_, n_, k_;
+  const size_t a_offset_, a_ld_, b_offset_, b_ld_, c_offset_, c_ld_;
+
+  // Derived arguments (see 'Xgemm::ProcessArguments'), the direct version with 64-bit indices in
+  // case the matrices have more than 2^31 elements (see 'RequiresIndex64')
+  bool do_gemm_direct_;
+  bool index64_;
+  bool a_do_transpose_, b_do_transpose_, c_do_transpose_, a_conjugate_, b_conjugate_;
+  size_t a_one_, a_two_, b_one_, b_two_, c_one_, c_two_;
+
+  // Internal dimensions, temporary buffer layout and the buffer itself (indirect version only)
+  size_t m_ceiled_, n_ceiled_, k_ceiled_;
+  size_t a_one_i_, a_two_i_, b_one_i_, b_two_i_, c_one_i_, c_two_i_;
+  bool a_no_temp_, b_no_temp_, c_no_temp_;
+  size_t b_temp_offset_, c_temp_offset_, temp_size_;
+  size_t vwm_, vwn_;
+  Buffer<T> temp_buffer_;
+
+  // The main kernel and its thread configuration
+  Kernel kernel_;
+  ThreadRange global_;
+  ThreadRange local_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMPLAN_H_
+#endif
@@ -51,42 +51,61 @@ void Xhemm<T>::DoHemm(const Layout layout, const Side side, const Triangle trian
   // default) and on whether we are dealing with an upper or lower triangle of the hermitian matrix
   bool is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                    (triangle == Triangle::kLower && layout == Layout::kRowMajor));
-  auto kernel_name = (is_upper) ? "HermUpperToSquared" : "HermLowerToSquared";
-
-  // Temporary buffer for a copy of the hermitian matrix
-  auto temp_herm = Buffer<T>(context_, k*k);
-
-  // Creates a general matrix from the hermitian matrix to be able to run the regular Xgemm
-  // routine afterwards
-  auto kernel = Kernel(program_, kernel_name);
-
-  // Sets the arguments for the hermitian-to-squared kernel
-  kernel.SetArgument(0, static_cast<int>(k));
-  kernel.SetArgument(1, static_cast<int>(a_ld));
-  kernel.SetArgument(2, static_cast<int>(a_offset));
-  kernel.SetArgument(3, a_buffer());
-  kernel.SetArgument(4, static_cast<int>(k));
-  kernel.SetArgument(5, static_cast<int>(k));
-  kernel.SetArgument(6, static_cast<int>(0));
-  kernel.SetArgument(7, temp_herm());
-
-  // Uses the common padding kernel's thread configuration. This is allowed, since the
-  // hermitian-to-squared kernel uses the same parameters.
-  auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
-                                    Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
-  auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
-  auto kernelEvent = Event();
-  RunKernel(kernel, queue_, device_, global, local, kernelEvent.pointer());
-
-  // Synchronize now: 'DoGemm' does not accept a list of events to wait for
-  kernelEvent.WaitForCompletion();
+
+  // For small sizes, the direct GEMM kernel applies the hermitian structure while loading the
+  // matrix, such that no general copy of it is needed. Neither is one for a zero alpha, for which
+  // matrix A isn't read at all (see 'DoGemm').
+  const auto &params = db_.GetFlatParameters();
+  const auto use_structure = alpha == ConstantZero<T>() ||
+                             Xgemm<T>::UseDirectKernel(m, n, k, params.gemm_routine.min_indirect_size);
+  auto a_gemm = a_buffer;
+  auto a_gemm_offset = a_offset;
+  auto a_gemm_ld = a_ld;
+  if (use_structure) {
+    const auto operand = (side == Side::kLeft) ? size_t{1} : size_t{2};
+    SetStructure(GemmStructure{operand, is_upper, false});
+  }
+  else {
+    SetStructure(GemmStructure{0, false, false});
+    auto kernel_name = (is_upper) ? "HermUpperToSquared" : "HermLowerToSquared";
+
+    // Temporary buffer for a copy of the hermitian matrix
+    a_gemm = TemporaryBuffer<T>(context_, queue_, k*k);
+
+    // Creates a general matrix from the hermitian matrix to be able to run the regular Xgemm
+    // routine afterwards
+    auto kernel = GetKernel(GetGemmProgram(GemmProgram::kProcessing), kernel_name);
+
+    // Sets the arguments for the hermitian-to-squared kernel
+    kernel.SetArgument(0, static_cast<int>(k));
+    kernel.SetArgument(1, static_cast<int>(a_ld));
+    kernel.SetArgument(2, static_cast<int>(a_offset));
+    kernel.SetArgument(3, a_buffer());
+    kernel.SetArgument(4, static_cast<int>(k));
+    kernel.SetArgument(5, static_cast<int>(k));
+    kernel.SetArgument(6, static_cast<int>(0));
+    kernel.SetArgument(7, a_gemm());
+
+    // Uses the common padding kernel's thread configuration. This is allowed, since the
+    // hermitian-to-squared kernel uses the same parameters.
+    auto global = ThreadRange{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+                                      Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
+    auto local = ThreadRange{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+    auto kernelEvent = Event();
+    RunKernel(kernel, queue_, device_, global, local, kernelEvent.pointer());
+
+    // Synchronize now: 'DoGemm' does not accept a list of events to wait for
+    kernelEvent.WaitForCompletion();
+    a_gemm_offset = 0;
+    a_gemm_ld = k;
+  }
 
   // Runs the regular Xgemm code with either "C := AB+C" or ...
   if (side == Side::kLeft) {
     DoGemm(layout, Transpose::kNo, Transpose::kNo,
            m, n, k,
            alpha,
-           temp_herm, 0, k,
+           a_gemm, a_gemm_offset, a_gemm_ld,
            b_buffer, b_offset, b_ld,
            beta,
            c_buffer, c_offset, c_ld);
@@ -99,7 +118,7 @@ void Xhemm<T>::DoHemm(const Layout layout, const Side side, const Triangle trian
              m, n, k,
              alpha,
              b_buffer, b_offset, b_ld,
-             temp_herm, 0, k,
+             a_gemm, a_gemm_offset, a_gemm_ld,
              beta,
              c_buffer, c_offset, c_ld);
     } catch (BLASError &e) {
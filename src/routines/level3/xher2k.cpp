@@ -37,22 +37,12 @@ void Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, const Tr
                           const U beta,
                           const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
 
-  // Runs the first matrix multiplication
-  auto first_herk_event = Event();
-  auto complex_beta = T{beta, static_cast<U>(0.0)};
+  // Computes both matrix multiplications, the second with a conjugated 'alpha'
+  const auto complex_beta = T{beta, static_cast<U>(0.0)};
   const auto negated_ab_transpose = (ab_transpose != Transpose::kNo) ? Transpose::kNo : Transpose::kYes;
-  HerkAB(layout, triangle, ab_transpose, negated_ab_transpose, n, k, alpha,
-         a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, complex_beta, c_buffer, c_offset, c_ld,
-         first_herk_event.pointer(), false);
-  ;
-  first_herk_event.WaitForCompletion();
-
-  // Swaps the arguments for matrices A and B, sets 'beta' to 1, and conjugate alpha
-  auto conjugate_alpha = T{alpha.real(), -alpha.imag()};
-  auto complex_one = T{static_cast<U>(1.0), static_cast<U>(0.0)};
-  HerkAB(layout, triangle, ab_transpose, negated_ab_transpose, n, k, conjugate_alpha,
-         b_buffer, b_offset, b_ld, a_buffer, a_offset, a_ld, complex_one, c_buffer, c_offset, c_ld,
-         event_, true);
+  Her2kAB(layout, triangle, ab_transpose, negated_ab_transpose, n, k, alpha,
+          a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, complex_beta, c_buffer, c_offset, c_ld,
+          event_);
 }
 
 // =================================================================================================
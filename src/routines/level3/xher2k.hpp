@@ -29,7 +29,7 @@ public:
 
   // Uses methods and variables the regular Xherk routine
   using Xherk<T, U>::event_;
-  using Xherk<T, U>::HerkAB;
+  using Xherk<T, U>::Her2kAB;
 
   // Constructor
   Xher2k(Queue &queue, EventPointer event, const std::string &name = "HER2K");
@@ -45,7 +45,19 @@ class Xherk: public Routine {
               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
               const T complex_beta,
               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
-              EventPointer final_event, const bool diagonal_to_zero);
+              EventPointer final_event, const bool diagonal_to_zero,
+              const std::vector<Event> &wait_events = {});
+
+  // Helper function for HER2K: computes alpha*A*B^H + conj(alpha)*B*A^H in a single kernel by
+  // placing the two products next to each other along the K dimension, i.e. [A B]*[B A]^H
+  void Her2kAB(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Transpose b_transpose,
+               const size_t n, const size_t k,
+               const T complex_alpha,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+               const T complex_beta,
+               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+               EventPointer final_event);
 };
 
 // =================================================================================================
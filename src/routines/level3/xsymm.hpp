@@ -32,9 +32,10 @@ class Xsymm: public Xgemm<T> {
   using Xgemm<T>::queue_;
   using Xgemm<T>::context_;
   using Xgemm<T>::device_;
-  using Xgemm<T>::program_;
+  using Xgemm<T>::GetGemmProgram;
   using Xgemm<T>::db_;
   using Xgemm<T>::DoGemm;
+  using Xgemm<T>::SetStructure;
 
   // Constructor
   Xsymm(Queue &queue, EventPointer event, const std::string &name = "SYMM");
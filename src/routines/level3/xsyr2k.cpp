@@ -38,20 +38,11 @@ void Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, const Tran
                         const T beta,
                         const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
 
-  // Runs the first matrix multiplication
-  auto first_syrk_event = Event();
+  // Computes both matrix multiplications, with 'beta' applied only once
   const auto negated_ab_transpose = (ab_transpose != Transpose::kNo) ? Transpose::kNo : Transpose::kYes;
-  SyrkAB(layout, triangle, ab_transpose, negated_ab_transpose, n, k, alpha,
-         a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld,
-         first_syrk_event.pointer());
-  ;
-  first_syrk_event.WaitForCompletion();
-
-  // Swaps the arguments for matrices A and B, and sets 'beta' to 1
-  auto one = ConstantOne<T>();
-  SyrkAB(layout, triangle, ab_transpose, negated_ab_transpose, n, k, alpha,
-         b_buffer, b_offset, b_ld, a_buffer, a_offset, a_ld, one, c_buffer, c_offset, c_ld,
-         event_);
+  Syr2kAB(layout, triangle, ab_transpose, negated_ab_transpose, n, k, alpha,
+          a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld,
+          event_);
 }
 
 // =================================================================================================
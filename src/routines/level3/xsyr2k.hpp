@@ -9,7 +9,8 @@
 //
 // This file implements the Xsyr2k routine. The precision is implemented using a template argument.
 // The implementation is very similar to Xsyrk (see header for details), except for the fact that
-// the main XgemmUpper/XgemmLower kernel is called twice: C = AB^T + C and C = BA^T + C.
+// the main XgemmUpper/XgemmLower kernel computes two products at once: C = AB^T + BA^T + C. To do
+// so, the two are placed next to each other along the K dimension in the temporary matrices.
 //
 // =================================================================================================
 
@@ -29,7 +30,7 @@ public:
 
   // Uses methods and variables the regular Xsyrk routine
   using Xsyrk<T>::event_;
-  using Xsyrk<T>::SyrkAB;
+  using Xsyrk<T>::Syr2kAB;
 
   // Constructor
   Xsyr2k(Queue &queue, EventPointer event, const std::string &name = "SYR2K");
@@ -23,17 +23,22 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xsyrk<T>::Xsyrk(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Copy","Pad","Transpose","Padtranspose","Xgemm"}, PrecisionValue<T>(), {}, {
-    #include "../../kernels/level3/level3.opencl"
-    #include "../../kernels/level3/copy_fast.opencl"
-    #include "../../kernels/level3/copy_pad.opencl"
-    #include "../../kernels/level3/transpose_fast.opencl"
-    #include "../../kernels/level3/transpose_pad.opencl"
-    , // separated in multiple parts to prevent C1091 in MSVC 2013
-    #include "../../kernels/level3/xgemm_part1.opencl"
-    #include "../../kernels/level3/xgemm_part2.opencl"
-    #include "../../kernels/level3/xgemm_part3.opencl"
-    #include "../../kernels/level3/xgemm_part4.opencl"
+    Routine(queue, event, name, {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect","GemmRoutine"},
+            PrecisionValue<T>(), {}, {
+    KernelSource::kLevel3,
+    KernelSource::kCopyFast,
+    KernelSource::kCopyPad,
+    KernelSource::kTransposeFast,
+    KernelSource::kTransposePad,
+    KernelSource::kXgemmEpilogue,
+    KernelSource::kXgemmDirectPart1,
+    KernelSource::kXgemmDirectPart2,
+    KernelSource::kXgemmDirectPart3,
+    KernelSource::kXgemmPart1,
+    KernelSource::kXgemmPart2,
+    KernelSource::kXgemmPart3,
+    KernelSource::kXgemmTensor,
+    KernelSource::kXgemmPart4
     }) {
 }
 
@@ -63,7 +68,12 @@ void Xsyrk<T>::SyrkAB(const Layout layout, const Triangle triangle, const Transp
                       const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
                       const T beta,
                       const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
-                      EventPointer final_event) {
+                      EventPointer final_event, const std::vector<Event> &wait_events) {
+  const auto &params = db_.GetFlatParameters();
+
+  // Selects which version to run: the direct kernel for small sizes, the indirect one otherwise
+  const auto do_gemm_direct = Xgemm<T>::UseDirectKernel(n, n, k, params.gemm_routine.min_indirect_size);
+  const auto gemm_kernel_id = (do_gemm_direct) ? 0 : params.xgemm.gemmk;
 
   // Computes the transpose/conjugate options and sets the a/b/c sizes based on that
   bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
@@ -71,7 +81,7 @@ void Xsyrk<T>::SyrkAB(const Layout layout, const Triangle triangle, const Transp
   Xgemm<T>::ProcessArguments(layout, a_transpose, b_transpose, n, n, k,
                              a_one, a_two, b_one, b_two, c_one, c_two,
                              a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
-                             db_["GEMMK"]);
+                             gemm_kernel_id);
 
   // Tests the two matrices (A, C) for validity, first from a perspective of the OpenCL buffers and
   // their sizes, and then from a perspective of parameter values (e.g. n, k). Tests whether the
@@ -83,16 +93,64 @@ void Xsyrk<T>::SyrkAB(const Layout layout, const Triangle triangle, const Transp
   TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
   TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
 
+  // With a zero alpha, A and B don't contribute to the result: only the requested triangle of C
+  // is scaled by beta (upper or lower in terms of the layout)
+  if (alpha == ConstantZero<T>()) {
+    const auto upper = (triangle == Triangle::kUpper) == (layout == Layout::kColMajor);
+    auto scale_wait_list = input_events_; // see 'BeginCommandChain'
+    scale_wait_list.insert(scale_wait_list.end(), wait_events.begin(), wait_events.end());
+    ScaleMatrix(queue_, device_, program_, final_event, scale_wait_list,
+                c_one, c_two, c_ld, c_offset, c_buffer, beta, 1, 0, upper, !upper);
+    return;
+  }
+
+  // For small sizes, the direct GEMM kernel computes only the requested triangle and stores it into
+  // matrix C directly: no temporary buffers and no pre/post-processing kernels are required
+  if (do_gemm_direct) {
+    const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectTT" : "XgemmDirectTN") :
+                                         (b_do_transpose ? "XgemmDirectNT" : "XgemmDirectNN");
+    auto direct_kernel = GetKernel(program_, name);
+    direct_kernel.SetArgument(0, static_cast<int>(n));
+    direct_kernel.SetArgument(1, static_cast<int>(n));
+    direct_kernel.SetArgument(2, static_cast<int>(k));
+    direct_kernel.SetArgument(3, GetRealArg(alpha));
+    direct_kernel.SetArgument(4, GetRealArg(beta));
+    direct_kernel.SetArgument(5, a_buffer());
+    direct_kernel.SetArgument(6, static_cast<int>(a_offset));
+    direct_kernel.SetArgument(7, static_cast<int>(a_ld));
+    direct_kernel.SetArgument(8, b_buffer());
+    direct_kernel.SetArgument(9, static_cast<int>(b_offset));
+    direct_kernel.SetArgument(10, static_cast<int>(b_ld));
+    direct_kernel.SetArgument(11, c_buffer());
+    direct_kernel.SetArgument(12, static_cast<int>(c_offset));
+    direct_kernel.SetArgument(13, static_cast<int>(c_ld));
+    direct_kernel.SetArgument(14, static_cast<int>(c_do_transpose));
+    direct_kernel.SetArgument(15, static_cast<int>(a_conjugate));
+    direct_kernel.SetArgument(16, static_cast<int>(b_conjugate));
+    direct_kernel.SetArgument(17, static_cast<int>(triangle == Triangle::kUpper));
+    direct_kernel.SetArgument(18, static_cast<int>(false));
+    const auto n_ceiled_direct = Ceil(n, params.xgemm_direct.wgd);
+    const auto direct_global = ThreadRange{
+      (n_ceiled_direct * params.xgemm_direct.mdimcd) / params.xgemm_direct.wgd,
+      (n_ceiled_direct * params.xgemm_direct.ndimcd) / params.xgemm_direct.wgd
+    };
+    const auto direct_local = ThreadRange{params.xgemm_direct.mdimcd,
+                                                  params.xgemm_direct.ndimcd};
+    RunKernel(direct_kernel, queue_, device_, direct_global, direct_local, final_event,
+              wait_events);
+    return;
+  }
+
   // Calculates the ceiled versions of n and k
-  auto n_ceiled = Ceil(Ceil(n, db_["MWG"]), db_["NWG"]);
-  auto k_ceiled = Ceil(k, db_["KWG"] * db_["KREG"]);
+  auto n_ceiled = Ceil(Ceil(n, params.xgemm.mwg), params.xgemm.nwg);
+  auto k_ceiled = Ceil(k, params.xgemm.kwg * params.xgemm.kreg);
 
   // Computes the first and second "internal" (ceiled) dimensions of the 3 matrices taking into account
   // whether the matrices need to be rotated or not for the kernel.
-  const auto a_one_i = (Xgemm<T>::a_want_rotated_(db_["GEMMK"])) ? k_ceiled : n_ceiled;
-  const auto a_two_i = (Xgemm<T>::a_want_rotated_(db_["GEMMK"])) ? n_ceiled : k_ceiled;
-  const auto b_one_i = (!Xgemm<T>::b_want_rotated_(db_["GEMMK"])) ? k_ceiled : n_ceiled;
-  const auto b_two_i = (!Xgemm<T>::b_want_rotated_(db_["GEMMK"])) ? n_ceiled : k_ceiled;
+  const auto a_one_i = (Xgemm<T>::a_want_rotated_(params.xgemm.gemmk)) ? k_ceiled : n_ceiled;
+  const auto a_two_i = (Xgemm<T>::a_want_rotated_(params.xgemm.gemmk)) ? n_ceiled : k_ceiled;
+  const auto b_one_i = (!Xgemm<T>::b_want_rotated_(params.xgemm.gemmk)) ? k_ceiled : n_ceiled;
+  const auto b_two_i = (!Xgemm<T>::b_want_rotated_(params.xgemm.gemmk)) ? n_ceiled : k_ceiled;
 
   // Decides which kernel to run: the upper-triangular or lower-triangular version
   auto kernel_name = (triangle == Triangle::kUpper) ? "XgemmUpper" : "XgemmLower";
@@ -102,20 +160,22 @@ void Xsyrk<T>::SyrkAB(const Layout layout, const Triangle triangle, const Transp
   const auto b_no_temp = Xgemm<T>::NoTempBuffer(b_one, b_one_i, b_two, b_two_i, b_ld, b_offset, b_do_transpose, b_conjugate);
 
   // Creates the temporary matrices
-  auto a_temp = (a_no_temp) ? a_buffer : Buffer<T>(context_, a_one_i * a_two_i);
-  auto b_temp = (b_no_temp) ? b_buffer : Buffer<T>(context_, b_one_i * b_two_i);
-  auto c_temp = Buffer<T>(context_, n_ceiled*n_ceiled);
+  auto a_temp = (a_no_temp) ? a_buffer : TemporaryBuffer<T>(context_, queue_, a_one_i * a_two_i);
+  auto b_temp = (b_no_temp) ? b_buffer : TemporaryBuffer<T>(context_, queue_, b_one_i * b_two_i);
+  auto c_temp = TemporaryBuffer<T>(context_, queue_, n_ceiled*n_ceiled);
 
   // Events of all kernels (including pre/post processing kernels)
   auto eventWaitList = std::vector<Event>();
-  auto emptyEventList = std::vector<Event>();
+  auto inputEventList = input_events_; // see 'BeginCommandChain'
+  inputEventList.insert(inputEventList.end(), wait_events.begin(), wait_events.end());
 
   // Runs the pre-processing kernel for matrix A. This transposes the matrix, but also pads zeros
   // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
   // case nothing has to be done, these kernels can be skipped.
   if (!a_no_temp) {
     auto eventProcessA = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(queue_, device_, db_,
+                           IntermediateEvent(queue_, eventProcessA), inputEventList,
                            a_one, a_two, a_ld, a_offset, a_buffer,
                            a_one_i, a_two_i, a_one_i, 0, a_temp,
                            ConstantOne<T>(), program_,
@@ -124,7 +184,8 @@ void Xsyrk<T>::SyrkAB(const Layout layout, const Triangle triangle, const Transp
   }
   if (!b_no_temp) {
     auto eventProcessB = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(queue_, device_, db_,
+                           IntermediateEvent(queue_, eventProcessB), inputEventList,
                            b_one, b_two, b_ld, b_offset, b_buffer,
                            b_one_i, b_two_i, b_one_i, 0, b_temp,
                            ConstantOne<T>(), program_,
@@ -135,7 +196,8 @@ void Xsyrk<T>::SyrkAB(const Layout layout, const Triangle triangle, const Transp
   // Furthermore, also creates a (possibly padded) copy of matrix C, since it is not allowed to
   // modify the other triangle.
   auto eventProcessC = Event();
-  PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
+  PadCopyTransposeMatrix(queue_, device_, db_,
+                         IntermediateEvent(queue_, eventProcessC), inputEventList,
                          n, n, c_ld, c_offset, c_buffer,
                          n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
                          ConstantOne<T>(), program_,
@@ -143,7 +205,7 @@ void Xsyrk<T>::SyrkAB(const Layout layout, const Triangle triangle, const Transp
   eventWaitList.push_back(eventProcessC);
 
   // Retrieves the XgemmUpper or XgemmLower kernel from the compiled binary
-  auto kernel = Kernel(program_, kernel_name);
+  auto kernel = GetKernel(program_, kernel_name);
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(n_ceiled));
@@ -155,19 +217,176 @@ void Xsyrk<T>::SyrkAB(const Layout layout, const Triangle triangle, const Transp
   kernel.SetArgument(6, c_temp());
 
   // Computes the global and local thread sizes
-  auto global = std::vector<size_t>{
-    (n_ceiled * db_["MDIMC"]) / db_["MWG"],
-    (n_ceiled * db_["NDIMC"]) / db_["NWG"]
+  auto global = ThreadRange{
+    (n_ceiled * params.xgemm.mdimc) / params.xgemm.mwg,
+    (n_ceiled * params.xgemm.ndimc) / params.xgemm.nwg
+  };
+  auto local = ThreadRange{params.xgemm.mdimc, params.xgemm.ndimc};
+
+  // Launches the kernel
+  auto eventKernel = Event();
+  RunKernel(kernel, queue_, device_, global, local,
+            IntermediateEvent(queue_, eventKernel), eventWaitList);
+  eventWaitList.push_back(eventKernel);
+
+  // Runs the post-processing kernel
+  const auto upper = Xgemm<T>::c_want_rotated_(params.xgemm.gemmk) ? (triangle == Triangle::kLower) :
+                                                               (triangle == Triangle::kUpper);
+  const auto lower = !upper;
+  PadCopyTransposeMatrix(queue_, device_, db_, final_event, eventWaitList,
+                         n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
+                         n, n, c_ld, c_offset, c_buffer,
+                         ConstantOne<T>(), program_,
+                         false, c_do_transpose, false, upper, lower, false);
+}
+
+// =================================================================================================
+
+template <typename T>
+void Xsyrk<T>::Syr2kAB(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t n, const size_t k,
+                       const T alpha,
+                       const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                       const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                       const T beta,
+                       const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                       EventPointer final_event) {
+  const auto &params = db_.GetFlatParameters();
+
+  // With a zero alpha, neither product contributes: a single call only scales C (see 'SyrkAB')
+  if (alpha == ConstantZero<T>()) {
+    SyrkAB(layout, triangle, a_transpose, b_transpose, n, k, alpha,
+           a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld,
+           final_event);
+    return;
+  }
+
+  // For small sizes, the direct GEMM kernel computes the two products one after the other. The
+  // second waits for the first on the device, the host does not have to synchronise in between.
+  if (Xgemm<T>::UseDirectKernel(n, n, k, params.gemm_routine.min_indirect_size)) {
+    auto first_syrk_event = Event();
+    SyrkAB(layout, triangle, a_transpose, b_transpose, n, k, alpha,
+           a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld,
+           first_syrk_event.pointer());
+    SyrkAB(layout, triangle, a_transpose, b_transpose, n, k, alpha,
+           b_buffer, b_offset, b_ld, a_buffer, a_offset, a_ld, ConstantOne<T>(), c_buffer, c_offset, c_ld,
+           final_event, {first_syrk_event});
+    return;
+  }
+
+  // Computes the transpose/conjugate options and sets the a/b/c sizes based on that. Matrices A and
+  // B are stored in the same way, so these are the sizes of both as first and as second operand.
+  bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+  size_t a_one, a_two, b_one, b_two, c_one, c_two;
+  Xgemm<T>::ProcessArguments(layout, a_transpose, b_transpose, n, n, k,
+                             a_one, a_two, b_one, b_two, c_one, c_two,
+                             a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                             params.xgemm.gemmk);
+
+  // Tests the matrices for validity (see 'SyrkAB'), both as the first and as the second operand
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
+  TestMatrixA(a_one, a_two, b_buffer, b_offset, b_ld);
+  TestMatrixB(b_one, b_two, a_buffer, a_offset, a_ld);
+  TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
+
+  // Calculates the ceiled versions of n and k
+  const auto n_ceiled = Ceil(Ceil(n, params.xgemm.mwg), params.xgemm.nwg);
+  const auto k_ceiled = Ceil(k, params.xgemm.kwg * params.xgemm.kreg);
+
+  // Computes the "internal" (ceiled) dimensions of the two halves of the temporary matrices and the
+  // offset of their second halves along K, taking into account whether they are rotated or not
+  const auto a_k_first = Xgemm<T>::a_want_rotated_(params.xgemm.gemmk);
+  const auto b_k_first = !Xgemm<T>::b_want_rotated_(params.xgemm.gemmk);
+  const auto a_one_i = (a_k_first) ? k_ceiled : n_ceiled;
+  const auto a_two_i = (a_k_first) ? n_ceiled : k_ceiled;
+  const auto b_one_i = (b_k_first) ? k_ceiled : n_ceiled;
+  const auto b_two_i = (b_k_first) ? n_ceiled : k_ceiled;
+  const auto a_ld_i = (a_k_first) ? 2 * k_ceiled : n_ceiled;
+  const auto b_ld_i = (b_k_first) ? 2 * k_ceiled : n_ceiled;
+  const auto a_half_offset = (a_k_first) ? k_ceiled : n_ceiled * k_ceiled;
+  const auto b_half_offset = (b_k_first) ? k_ceiled : n_ceiled * k_ceiled;
+
+  // Creates the temporary matrices: [A B] as the first operand and [B A] as the second
+  auto a_temp = TemporaryBuffer<T>(context_, queue_, 2 * a_one_i * a_two_i);
+  auto b_temp = TemporaryBuffer<T>(context_, queue_, 2 * b_one_i * b_two_i);
+  auto c_temp = TemporaryBuffer<T>(context_, queue_, n_ceiled*n_ceiled);
+
+  // Events of all kernels (including pre/post processing kernels)
+  auto eventWaitList = std::vector<Event>();
+  const auto &inputEventList = input_events_; // see 'BeginCommandChain'
+
+  // Runs the pre-processing kernels, which fill the halves of the temporary matrices with padded
+  // (and possibly transposed) copies of A and B. These are always needed.
+  auto eventProcessA1 = Event();
+  PadCopyTransposeMatrix(queue_, device_, db_,
+                         IntermediateEvent(queue_, eventProcessA1), inputEventList,
+                         a_one, a_two, a_ld, a_offset, a_buffer,
+                         a_one_i, a_two_i, a_ld_i, 0, a_temp,
+                         ConstantOne<T>(), program_,
+                         true, a_do_transpose, false);
+  eventWaitList.push_back(eventProcessA1);
+  auto eventProcessA2 = Event();
+  PadCopyTransposeMatrix(queue_, device_, db_,
+                         IntermediateEvent(queue_, eventProcessA2), inputEventList,
+                         a_one, a_two, b_ld, b_offset, b_buffer,
+                         a_one_i, a_two_i, a_ld_i, a_half_offset, a_temp,
+                         ConstantOne<T>(), program_,
+                         true, a_do_transpose, false);
+  eventWaitList.push_back(eventProcessA2);
+  auto eventProcessB1 = Event();
+  PadCopyTransposeMatrix(queue_, device_, db_,
+                         IntermediateEvent(queue_, eventProcessB1), inputEventList,
+                         b_one, b_two, b_ld, b_offset, b_buffer,
+                         b_one_i, b_two_i, b_ld_i, 0, b_temp,
+                         ConstantOne<T>(), program_,
+                         true, b_do_transpose, false);
+  eventWaitList.push_back(eventProcessB1);
+  auto eventProcessB2 = Event();
+  PadCopyTransposeMatrix(queue_, device_, db_,
+                         IntermediateEvent(queue_, eventProcessB2), inputEventList,
+                         b_one, b_two, a_ld, a_offset, a_buffer,
+                         b_one_i, b_two_i, b_ld_i, b_half_offset, b_temp,
+                         ConstantOne<T>(), program_,
+                         true, b_do_transpose, false);
+  eventWaitList.push_back(eventProcessB2);
+
+  // Furthermore, also creates a (possibly padded) copy of matrix C, since it is not allowed to
+  // modify the other triangle.
+  auto eventProcessC = Event();
+  PadCopyTransposeMatrix(queue_, device_, db_,
+                         IntermediateEvent(queue_, eventProcessC), inputEventList,
+                         n, n, c_ld, c_offset, c_buffer,
+                         n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
+                         ConstantOne<T>(), program_,
+                         true, c_do_transpose, false);
+  eventWaitList.push_back(eventProcessC);
+
+  // Retrieves the XgemmUpper or XgemmLower kernel from the compiled binary and sets its arguments
+  auto kernel = GetKernel(program_, (triangle == Triangle::kUpper) ? "XgemmUpper" : "XgemmLower");
+  kernel.SetArgument(0, static_cast<int>(n_ceiled));
+  kernel.SetArgument(1, static_cast<int>(2 * k_ceiled));
+  kernel.SetArgument(2, GetRealArg(alpha));
+  kernel.SetArgument(3, GetRealArg(beta));
+  kernel.SetArgument(4, a_temp());
+  kernel.SetArgument(5, b_temp());
+  kernel.SetArgument(6, c_temp());
+
+  // Computes the global and local thread sizes
+  auto global = ThreadRange{
+    (n_ceiled * params.xgemm.mdimc) / params.xgemm.mwg,
+    (n_ceiled * params.xgemm.ndimc) / params.xgemm.nwg
   };
-  auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+  auto local = ThreadRange{params.xgemm.mdimc, params.xgemm.ndimc};
 
   // Launches the kernel
   auto eventKernel = Event();
-  RunKernel(kernel, queue_, device_, global, local, eventKernel.pointer(), eventWaitList);
+  RunKernel(kernel, queue_, device_, global, local,
+            IntermediateEvent(queue_, eventKernel), eventWaitList);
   eventWaitList.push_back(eventKernel);
 
   // Runs the post-processing kernel
-  const auto upper = Xgemm<T>::c_want_rotated_(db_["GEMMK"]) ? (triangle == Triangle::kLower) :
+  const auto upper = Xgemm<T>::c_want_rotated_(params.xgemm.gemmk) ? (triangle == Triangle::kLower) :
                                                                (triangle == Triangle::kUpper);
   const auto lower = !upper;
   PadCopyTransposeMatrix(queue_, device_, db_, final_event, eventWaitList,
@@ -47,7 +47,18 @@ class Xsyrk: public Routine {
               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
               const T beta,
               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
-              EventPointer final_event);
+              EventPointer final_event, const std::vector<Event> &wait_events = {});
+
+  // Helper function for SYR2K: computes alpha*A*B^T + alpha*B*A^T in a single kernel by placing the
+  // two products next to each other along the K dimension, i.e. [A B]*[B A]^T
+  void Syr2kAB(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Transpose b_transpose,
+               const size_t n, const size_t k,
+               const T alpha,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+               const T beta,
+               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+               EventPointer final_event);
 };
 
 // =================================================================================================
@@ -51,55 +51,79 @@ void Xtrmm<T>::DoTrmm(const Layout layout, const Side side, const Triangle trian
   const auto b_two = (layout == Layout::kRowMajor) ? m : n;
   TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
 
+  // With a zero alpha the result is zero: neither A nor B has to be read or copied
+  if (alpha == ConstantZero<T>()) {
+    ScaleMatrix(queue_, device_, GetGemmProgram(GemmProgram::kProcessing), event_, input_events_,
+                b_one, b_two, b_ld, b_offset, b_buffer, ConstantZero<T>());
+    return;
+  }
+
   // Creates a copy of B to avoid overwriting input in GEMM while computing output
   const auto b_size = (b_ld * (b_two - 1) + b_one + b_offset);
-  auto b_buffer_copy = Buffer<T>(context_, b_size);
-  b_buffer.CopyTo(queue_, b_size, b_buffer_copy);
+  auto b_buffer_copy = TemporaryBuffer<T>(context_, queue_, b_size);
+  CopyBuffer(queue_, b_buffer, b_buffer_copy, b_size);
 
   // Determines which kernel to run based on the layout (the Xgemm kernel assumes column-major as
   // default) and on whether we are dealing with an upper or lower triangle of the triangular matrix
   bool is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                    (triangle == Triangle::kLower && layout == Layout::kRowMajor));
-  auto kernel_name = (is_upper) ? "TriaUpperToSquared" : "TriaLowerToSquared";
 
   // Determines whether or not the triangular matrix is unit-diagonal
   auto unit_diagonal = (diagonal == Diagonal::kUnit) ? true : false;
 
-  // Temporary buffer for a copy of the triangular matrix
-  auto temp_triangular = Buffer<T>(context_, k*k);
-
-  // Creates a general matrix from the triangular matrix to be able to run the regular Xgemm
-  // routine afterwards
-  auto kernel = Kernel(program_, kernel_name);
-
-  // Sets the arguments for the triangular-to-squared kernel
-  kernel.SetArgument(0, static_cast<int>(k));
-  kernel.SetArgument(1, static_cast<int>(a_ld));
-  kernel.SetArgument(2, static_cast<int>(a_offset));
-  kernel.SetArgument(3, a_buffer());
-  kernel.SetArgument(4, static_cast<int>(k));
-  kernel.SetArgument(5, static_cast<int>(k));
-  kernel.SetArgument(6, static_cast<int>(0));
-  kernel.SetArgument(7, temp_triangular());
-  kernel.SetArgument(8, static_cast<int>(unit_diagonal));
-
-  // Uses the common padding kernel's thread configuration. This is allowed, since the
-  // triangular-to-squared kernel uses the same parameters.
-  auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
-                                    Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
-  auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
-  auto kernelEvent = Event();
-  RunKernel(kernel, queue_, device_, global, local, kernelEvent.pointer());
-
-  // Synchronize now: 'DoGemm' does not accept a list of events to wait for
-  kernelEvent.WaitForCompletion();
+  // For small sizes, the direct GEMM kernel applies the triangular structure while loading the
+  // matrix, such that no general copy of it is needed
+  const auto &params = db_.GetFlatParameters();
+  const auto use_structure = Xgemm<T>::UseDirectKernel(m, n, k, params.gemm_routine.min_indirect_size);
+  auto a_gemm = a_buffer;
+  auto a_gemm_offset = a_offset;
+  auto a_gemm_ld = a_ld;
+  if (use_structure) {
+    const auto operand = (side == Side::kLeft) ? size_t{1} : size_t{2};
+    SetStructure(GemmStructure{operand, is_upper, unit_diagonal});
+  }
+  else {
+    SetStructure(GemmStructure{0, false, false});
+    auto kernel_name = (is_upper) ? "TriaUpperToSquared" : "TriaLowerToSquared";
+
+    // Temporary buffer for a copy of the triangular matrix
+    a_gemm = TemporaryBuffer<T>(context_, queue_, k*k);
+
+    // Creates a general matrix from the triangular matrix to be able to run the regular Xgemm
+    // routine afterwards
+    auto kernel = GetKernel(GetGemmProgram(GemmProgram::kProcessing), kernel_name);
+
+    // Sets the arguments for the triangular-to-squared kernel
+    kernel.SetArgument(0, static_cast<int>(k));
+    kernel.SetArgument(1, static_cast<int>(a_ld));
+    kernel.SetArgument(2, static_cast<int>(a_offset));
+    kernel.SetArgument(3, a_buffer());
+    kernel.SetArgument(4, static_cast<int>(k));
+    kernel.SetArgument(5, static_cast<int>(k));
+    kernel.SetArgument(6, static_cast<int>(0));
+    kernel.SetArgument(7, a_gemm());
+    kernel.SetArgument(8, static_cast<int>(unit_diagonal));
+
+    // Uses the common padding kernel's thread configuration. This is allowed, since the
+    // triangular-to-squared kernel uses the same parameters.
+    auto global = ThreadRange{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+                                      Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
+    auto local = ThreadRange{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+    auto kernelEvent = Event();
+    RunKernel(kernel, queue_, device_, global, local, kernelEvent.pointer());
+
+    // Synchronize now: 'DoGemm' does not accept a list of events to wait for
+    kernelEvent.WaitForCompletion();
+    a_gemm_offset = 0;
+    a_gemm_ld = k;
+  }
 
   // Runs the regular Xgemm code with either "B := alpha*A*B" or ...
   if (side == Side::kLeft) {
     DoGemm(layout, a_transpose, Transpose::kNo,
            m, n, k,
            alpha,
-           temp_triangular, 0, k,
+           a_gemm, a_gemm_offset, a_gemm_ld,
            b_buffer_copy, b_offset, b_ld,
            ConstantZero<T>(),
            b_buffer, b_offset, b_ld);
@@ -112,7 +136,7 @@ void Xtrmm<T>::DoTrmm(const Layout layout, const Side side, const Triangle trian
              m, n, k,
              alpha,
              b_buffer_copy, b_offset, b_ld,
-             temp_triangular, 0, k,
+             a_gemm, a_gemm_offset, a_gemm_ld,
              ConstantZero<T>(),
              b_buffer, b_offset, b_ld);
     } catch (BLASError &e) {
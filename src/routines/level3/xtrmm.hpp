@@ -31,9 +31,12 @@ class Xtrmm: public Xgemm<T> {
   using Xgemm<T>::queue_;
   using Xgemm<T>::context_;
   using Xgemm<T>::device_;
-  using Xgemm<T>::program_;
+  using Xgemm<T>::event_;
+  using Xgemm<T>::input_events_;
+  using Xgemm<T>::GetGemmProgram;
   using Xgemm<T>::db_;
   using Xgemm<T>::DoGemm;
+  using Xgemm<T>::SetStructure;
 
   // Constructor
   Xtrmm(Queue &queue, EventPointer event, const std::string &name = "TRMM");
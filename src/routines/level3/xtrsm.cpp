@@ -10,12 +10,18 @@
 // This file implements the triangular matrix solver (A * X = B) TRSM class. This code is based
 // on the TRSM implementation in the CUDA version of Magma version 2.2.0 and the poster "Triangular
 // Linear System Solver for GPU with CUDA and OpenCL" by Peng Du, Stanimire Tomov, Piotr Luszczek,
-// and Jack Dongarra and the OpenCL implementation in clBLAS.
+// and Jack Dongarra and the OpenCL implementation in clBLAS. The triangular matrix is split in
+// halves recursively, such that most of the work is done by large GEMMs updating B in-place, and
+// only the smallest diagonal blocks are solved through their inverses. With only a few right-hand
+// sides, the system is instead solved by substitution through the multi-RHS TRSV kernel, which
+// loads each element of A once for several right-hand sides. Both the block size and this
+// switching point are set by the 'TrsmRoutine' database entry.
 //
 // =================================================================================================
 
 #include "routines/level3/xtrsm.hpp"
 #include "routines/levelx/xinvert.hpp"
+#include "routines/levelx/xtrsvstridedbatched.hpp"
 
 #include <string>
 #include <vector>
@@ -26,7 +32,9 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xtrsm<T>::Xtrsm(Queue &queue, EventPointer event, const std::string &name):
-    Xgemm<T>(queue, event, name) {
+    Xgemm<T>(queue, event, name),
+    trsm_db_(std::vector<std::string>{"TrsmRoutine"}) {
+  Routine::InitDatabase(device_, {"TrsmRoutine"}, PrecisionValue<T>(), {}, trsm_db_);
 }
 
 // =================================================================================================
@@ -72,9 +80,6 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                             const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld) {
 
-  // Settings
-  constexpr auto block_size = size_t{16}; // tuneable
-
   // Makes sure all dimensions are larger than zero
   if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
 
@@ -88,160 +93,245 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
   // Checks for validity of the input B matrix
   TestMatrixB(m, n, b_buffer, b_offset, b_ld);
 
-  // Creates a copy of B to avoid overwriting input in GEMM while computing output
-  const auto b_size = b_ld * (n - 1) + m + b_offset;
-  const auto x_one = m;
-  const auto x_two = n;
-  const auto x_size = b_size;
-  const auto x_ld = b_ld;
-  const auto x_offset = b_offset;
-  auto x_buffer = Buffer<T>(context_, x_size);
-  b_buffer.CopyTo(queue_, x_size, x_buffer);
-
-  // Temporary buffer for the inverse of the A matrix
-  const auto a_inv_size = Ceil(k, block_size) * block_size;
-  auto a_inv_buffer = Buffer<T>(context_, a_inv_size);
+  // With a zero alpha the solution is zero: matrix A is neither inverted nor read
+  if (alpha == ConstantZero<T>()) {
+    ScaleMatrix(queue_, device_, GetGemmProgram(GemmProgram::kProcessing), event_, input_events_,
+                m, n, b_ld, b_offset, b_buffer, ConstantZero<T>());
+    return;
+  }
 
-  // Fills the output buffer with zeros
-  auto eventWaitList = std::vector<Event>();
-  auto fill_matrix_event = Event();
-  FillMatrix(queue_, device_, program_, db_, fill_matrix_event.pointer(), eventWaitList,
-             x_one, x_two, x_ld, x_offset, x_buffer, ConstantZero<T>());
-  fill_matrix_event.WaitForCompletion();
+  // Solves by substitution in case of only a few right-hand sides. This is not possible for the
+  // right side with a conjugate-transposed complex matrix: that would need a non-transposed but
+  // conjugated matrix A in TRSV.
+  const auto num_rhs = (side == Side::kLeft) ? n : m;
+  const auto is_complex = PrecisionValue<T>() == Precision::kComplexSingle ||
+                          PrecisionValue<T>() == Precision::kComplexDouble;
+  const auto substitution_possible = side == Side::kLeft || a_transpose != Transpose::kConjugate ||
+                                     !is_complex;
+  if (substitution_possible && num_rhs < trsm_db_["TRSM_MIN_INVERSION_RHS"]) {
+    TrsmSubstitution(side, triangle, a_transpose, diagonal, m, n, alpha,
+                     a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld);
+    return;
+  }
 
-  // Inverts the diagonal blocks
+  // The size of the diagonal blocks which are solved through their inverses, set by the database
   auto diagonal_invert_event = Event();
   auto inverter = Xinvert<T>(queue_, diagonal_invert_event.pointer());
+  const auto block_size = trsm_db_["TRSM_BLOCK_SIZE"];
+
+  // Temporary buffer for the inverses of the diagonal blocks of the A matrix
+  const auto a_inv_size = Ceil(k, block_size) * block_size;
+  auto a_inv_buffer = TemporaryBuffer<T>(context_, queue_, a_inv_size);
+
+  // Inverts the diagonal blocks
   inverter.InvertMatrixDiagonalBlocks(Layout::kColMajor, triangle, diagonal,
                                       k, block_size, a_buffer, a_offset, a_ld, a_inv_buffer);
   diagonal_invert_event.WaitForCompletion();
 
-  // Derives properties based on the arguments
+  // Temporary buffer for a single block of rows (left side) or columns (right side) of B: the
+  // diagonal blocks are solved with a GEMM, which cannot be done in-place
+  const auto scratch_size = (side == Side::kLeft) ? block_size * n : m * block_size;
+  auto scratch_buffer = TemporaryBuffer<T>(context_, queue_, scratch_size);
+
+  // Solves the system in-place in B
+  TrsmRecursive(side, IsForward(side, triangle, a_transpose), a_transpose, m, n, alpha,
+                a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+                a_inv_buffer, 0, block_size, scratch_buffer);
+}
+
+// =================================================================================================
+
+// The first part of B is solved first either when (lower triangular) or (upper triangular and
+// transposed) for the left side, or in the other cases for the right side
+template <typename T>
+bool Xtrsm<T>::IsForward(const Side side, const Triangle triangle, const Transpose a_transpose) {
   const auto condition = ((triangle == Triangle::kUpper && a_transpose != Transpose::kNo) ||
                           (triangle == Triangle::kLower && a_transpose == Transpose::kNo));
+  return (side == Side::kLeft) ? condition : !condition;
+}
+
+// =================================================================================================
+
+// The substitution version of the column-major version
+template <typename T>
+void Xtrsm<T>::TrsmSubstitution(const Side side, const Triangle triangle,
+                                const Transpose a_transpose, const Diagonal diagonal,
+                                const size_t m, const size_t n,
+                                const T alpha,
+                                const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                                const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld) {
+  const auto k = (side == Side::kLeft) ? m : n;
+
+  // The systems of the left side are the columns of B, e.g. op(A) * x = b. Those of the right side
+  // are the rows of B, for which x' * op(A) = b' is solved as op(A)' * x = b.
+  const auto trsv_transpose = (side == Side::kLeft) ? a_transpose :
+                              (a_transpose == Transpose::kNo) ? Transpose::kYes : Transpose::kNo;
+
+  // Multiple systems are solved together, such that matrix A is loaded once for a group of them.
+  // The kernel scales the right-hand sides by alpha itself.
+  const auto num_rhs = (side == Side::kLeft) ? n : m;
+  if (num_rhs > 1) {
+    auto trsv_event = Event();
+    auto trsv = XtrsvStridedBatched<T>(queue_, trsv_event.pointer());
+    trsv.DoTrsvMultipleRhs(Layout::kColMajor, triangle, trsv_transpose, diagonal, k, alpha,
+                           a_buffer, a_offset, a_ld, b_buffer, b_offset,
+                           (side == Side::kLeft) ? 1 : b_ld, (side == Side::kLeft) ? b_ld : 1,
+                           num_rhs);
+    trsv_event.WaitForCompletion();
+    return;
+  }
+
+  // A single system is solved by the regular TRSV routine
+  const auto solve = [&](const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld) {
+    auto trsv_event = Event();
+    auto trsv = XtrsvStridedBatched<T>(queue_, trsv_event.pointer());
+    trsv.DoTrsvStridedBatched(Layout::kColMajor, triangle, trsv_transpose, diagonal, k,
+                              a_buffer, a_offset, a_ld, 0,
+                              x_buffer, x_offset, (side == Side::kLeft) ? 1 : x_ld, x_ld, 1);
+    trsv_event.WaitForCompletion();
+  };
+
+  // The systems are solved in-place in B, unless B has to be scaled by alpha first: then alpha*B is
+  // solved in a temporary buffer and copied back afterwards
+  if (alpha == ConstantOne<T>()) {
+    solve(b_buffer, b_offset, b_ld);
+    return;
+  }
+  auto scratch_buffer = TemporaryBuffer<T>(context_, queue_, m * n);
+  auto event_wait_list = std::vector<Event>();
+  auto scale_event = Event();
+  PadCopyTransposeMatrix(queue_, device_, db_, scale_event.pointer(), event_wait_list,
+                         m, n, b_ld, b_offset, b_buffer,
+                         m, n, m, 0, scratch_buffer,
+                         alpha, GetGemmProgram(GemmProgram::kProcessing), false, false, false);
+  scale_event.WaitForCompletion();
+  solve(scratch_buffer, 0, m);
+  auto copy_event = Event();
+  PadCopyTransposeMatrix(queue_, device_, db_, copy_event.pointer(), event_wait_list,
+                         m, n, m, 0, scratch_buffer,
+                         m, n, b_ld, b_offset, b_buffer,
+                         ConstantOne<T>(), GetGemmProgram(GemmProgram::kProcessing),
+                         false, false, false);
+  copy_event.WaitForCompletion();
+}
 
-  // Left side
-  if (side == Side::kLeft) {
-
-    // True when (lower triangular) or (upper triangular and transposed)
-    if (condition) {
-      for (auto i = size_t{0}; i < m; i += block_size) {
-        const auto gemm_alpha = (i == 0) ? alpha : ConstantOne<T>();
-        const auto current_block_size = std::min(m - i, block_size);
-        auto gemm1_event = Event();
-        auto gemm1 = Xgemm<T>(queue_, gemm1_event.pointer());
-        gemm1.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-                     current_block_size, n, current_block_size, gemm_alpha,
-                     a_inv_buffer, i * block_size, block_size,
-                     b_buffer, b_offset + i, b_ld, ConstantZero<T>(),
-                     x_buffer, x_offset + i, x_ld);
-        gemm1_event.WaitForCompletion();
-        if (i + block_size >= m) { break; }
-
-        const auto this_a_offset = (a_transpose == Transpose::kNo) ? (i + block_size) + i * a_ld : i + (block_size + i) * a_ld;
-        auto gemm2_event = Event();
-        auto gemm2 = Xgemm<T>(queue_, gemm2_event.pointer());
-        gemm2.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-                     m - i - block_size, n, block_size, ConstantNegOne<T>(),
-                     a_buffer, this_a_offset + a_offset, a_ld,
-                     x_buffer, x_offset + i, x_ld, gemm_alpha,
-                     b_buffer, b_offset + i + block_size, b_ld);
-        gemm2_event.WaitForCompletion();
-      }
+// =================================================================================================
+
+// The recursive part of the column-major version
+template <typename T>
+void Xtrsm<T>::TrsmRecursive(const Side side, const bool forward, const Transpose a_transpose,
+                             const size_t m, const size_t n,
+                             const T alpha,
+                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                             const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                             const Buffer<T> &a_inv_buffer, const size_t a_inv_offset,
+                             const size_t block_size, const Buffer<T> &scratch_buffer) {
+  const auto k = (side == Side::kLeft) ? m : n;
+
+  // A single diagonal block: copies alpha*B into the scratch buffer and multiplies it with the
+  // inverse of the block, storing the result back into B
+  if (k <= block_size) {
+    auto copy_event = Event();
+    auto event_wait_list = std::vector<Event>();
+    PadCopyTransposeMatrix(queue_, device_, db_, copy_event.pointer(), event_wait_list,
+                           m, n, b_ld, b_offset, b_buffer,
+                           m, n, m, 0, scratch_buffer,
+                           alpha, GetGemmProgram(GemmProgram::kProcessing), false, false, false);
+    copy_event.WaitForCompletion();
+    auto gemm_event = Event();
+    auto gemm = Xgemm<T>(queue_, gemm_event.pointer());
+    if (side == Side::kLeft) {
+      gemm.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
+                  m, n, k, ConstantOne<T>(),
+                  a_inv_buffer, a_inv_offset, block_size,
+                  scratch_buffer, 0, m, ConstantZero<T>(),
+                  b_buffer, b_offset, b_ld);
     }
+    else {
+      gemm.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
+                  m, n, k, ConstantOne<T>(),
+                  scratch_buffer, 0, m,
+                  a_inv_buffer, a_inv_offset, block_size, ConstantZero<T>(),
+                  b_buffer, b_offset, b_ld);
+    }
+    gemm_event.WaitForCompletion();
+    return;
+  }
 
-    // True when (upper triangular) or (lower triangular and transposed)
+  // Splits the triangular matrix in two halves at a multiple of the block size, such that the
+  // diagonal blocks match the inverted ones. The off-diagonal blocks of op(A) are the blocks
+  // below (A21) or to the right of (A12) the diagonal in memory, depending on the transpose.
+  const auto k1 = (CeilDiv(k, block_size) / 2) * block_size;
+  const auto k2 = k - k1;
+  const auto a21_offset = a_offset + k1;
+  const auto a12_offset = a_offset + k1 * a_ld;
+  const auto op_a21_offset = (a_transpose == Transpose::kNo) ? a21_offset : a12_offset;
+  const auto op_a12_offset = (a_transpose == Transpose::kNo) ? a12_offset : a21_offset;
+  const auto a22_offset = a_offset + k1 + k1 * a_ld;
+  const auto a_inv22_offset = a_inv_offset + k1 * block_size;
+
+  // The two parts of B: the first and last rows (left side) or columns (right side)
+  const auto m1 = (side == Side::kLeft) ? k1 : m;
+  const auto m2 = (side == Side::kLeft) ? k2 : m;
+  const auto n1 = (side == Side::kLeft) ? n : k1;
+  const auto n2 = (side == Side::kLeft) ? n : k2;
+  const auto b1_offset = b_offset;
+  const auto b2_offset = (side == Side::kLeft) ? b_offset + k1 : b_offset + k1 * b_ld;
+
+  // Solves the first part, then updates the second part with it, and finally solves that: e.g. for
+  // the left side, X1 = op(A11)^-1 * alpha*B1 and B2 = alpha*B2 - op(A21)*X1 before X2 is solved.
+  if (forward) {
+    TrsmRecursive(side, forward, a_transpose, m1, n1, alpha,
+                  a_buffer, a_offset, a_ld, b_buffer, b1_offset, b_ld,
+                  a_inv_buffer, a_inv_offset, block_size, scratch_buffer);
+    auto gemm_event = Event();
+    auto gemm = Xgemm<T>(queue_, gemm_event.pointer());
+    if (side == Side::kLeft) {
+      gemm.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
+                  m2, n, k1, ConstantNegOne<T>(),
+                  a_buffer, op_a21_offset, a_ld,
+                  b_buffer, b1_offset, b_ld, alpha,
+                  b_buffer, b2_offset, b_ld);
+    }
     else {
-      const auto special_block_size = (m % block_size == 0) ? block_size : (m % block_size);
-      const auto i_start = static_cast<int>(m) - static_cast<int>(special_block_size);
-      for (auto i = i_start; i >= 0; i -= static_cast<int>(block_size)) {
-        const auto current_block_size = (i == i_start) ? special_block_size : block_size;
-        const auto gemm_alpha = (i == i_start) ? alpha : ConstantOne<T>();
-        auto gemm1_event = Event();
-        auto gemm1 = Xgemm<T>(queue_, gemm1_event.pointer());
-        gemm1.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-                     current_block_size, n, current_block_size, gemm_alpha,
-                     a_inv_buffer, i * block_size, block_size,
-                     b_buffer, b_offset + i, b_ld, ConstantZero<T>(),
-                     x_buffer, x_offset + i, x_ld);
-        gemm1_event.WaitForCompletion();
-        if (i - static_cast<int>(block_size) < 0) { break; }
-
-        const auto this_a_offset = (a_transpose == Transpose::kNo) ? i * a_ld : i;
-        auto gemm2_event = Event();
-        auto gemm2 = Xgemm<T>(queue_, gemm2_event.pointer());
-        gemm2.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-                     i, n, current_block_size, ConstantNegOne<T>(),
-                     a_buffer, this_a_offset + a_offset, a_ld,
-                     x_buffer, x_offset + i, x_ld, gemm_alpha,
-                     b_buffer, b_offset, b_ld);
-        gemm2_event.WaitForCompletion();
-      }
+      gemm.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
+                  m, n2, k1, ConstantNegOne<T>(),
+                  b_buffer, b1_offset, b_ld,
+                  a_buffer, op_a12_offset, a_ld, alpha,
+                  b_buffer, b2_offset, b_ld);
     }
+    gemm_event.WaitForCompletion();
+    TrsmRecursive(side, forward, a_transpose, m2, n2, ConstantOne<T>(),
+                  a_buffer, a22_offset, a_ld, b_buffer, b2_offset, b_ld,
+                  a_inv_buffer, a_inv22_offset, block_size, scratch_buffer);
   }
 
-  // Right side
+  // The same, but now the other way around: the second part is solved first
   else {
-
-    // True when (lower triangular) or (upper triangular and transposed)
-    if (condition) {
-      const auto special_block_size = (n % block_size == 0) ? block_size : (n % block_size);
-      const auto i_start = static_cast<int>(n) - static_cast<int>(special_block_size);
-      for (auto i = i_start; i >= 0; i -= static_cast<int>(block_size)) {
-        const auto current_block_size = (i == i_start) ? special_block_size : block_size;
-        const auto gemm_alpha = (i == i_start) ? alpha : ConstantOne<T>();
-        auto gemm1_event = Event();
-        auto gemm1 = Xgemm<T>(queue_, gemm1_event.pointer());
-        gemm1.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-                     m, current_block_size, current_block_size, gemm_alpha,
-                     b_buffer, b_offset + i * b_ld, b_ld,
-                     a_inv_buffer, i * block_size, block_size, ConstantZero<T>(),
-                     x_buffer, x_offset + i * x_ld, x_ld);
-        gemm1_event.WaitForCompletion();
-        if (i - static_cast<int>(block_size) < 0) { break; }
-
-        const auto this_a_offset = (a_transpose == Transpose::kNo) ? i : i * a_ld;
-        auto gemm2_event = Event();
-        auto gemm2 = Xgemm<T>(queue_, gemm2_event.pointer());
-        gemm2.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-                     m, i, current_block_size, ConstantNegOne<T>(),
-                     x_buffer, x_offset + i * x_ld, x_ld,
-                     a_buffer, this_a_offset + a_offset, a_ld, gemm_alpha,
-                     b_buffer, b_offset, b_ld);
-        gemm2_event.WaitForCompletion();
-      }
+    TrsmRecursive(side, forward, a_transpose, m2, n2, alpha,
+                  a_buffer, a22_offset, a_ld, b_buffer, b2_offset, b_ld,
+                  a_inv_buffer, a_inv22_offset, block_size, scratch_buffer);
+    auto gemm_event = Event();
+    auto gemm = Xgemm<T>(queue_, gemm_event.pointer());
+    if (side == Side::kLeft) {
+      gemm.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
+                  m1, n, k2, ConstantNegOne<T>(),
+                  a_buffer, op_a12_offset, a_ld,
+                  b_buffer, b2_offset, b_ld, alpha,
+                  b_buffer, b1_offset, b_ld);
     }
-
-    // True when (upper triangular) or (lower triangular and transposed)
     else {
-      for (auto i = size_t{0}; i < n; i += block_size) {
-        const auto gemm_alpha = (i == 0) ? alpha : ConstantOne<T>();
-        const auto current_block_size = std::min(n - i, block_size);
-        auto gemm1_event = Event();
-        auto gemm1 = Xgemm<T>(queue_, gemm1_event.pointer());
-        gemm1.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-                     m, current_block_size, current_block_size, gemm_alpha,
-                     b_buffer, b_offset + i * b_ld, b_ld,
-                     a_inv_buffer, i * block_size, block_size, ConstantZero<T>(),
-                     x_buffer, x_offset + i * x_ld, x_ld);
-        gemm1_event.WaitForCompletion();
-        if (i + block_size >= n) { break; }
-
-        const auto this_a_offset = (a_transpose == Transpose::kNo) ? i + (block_size + i) * a_ld : (i + block_size) + i * a_ld;
-        auto gemm2_event = Event();
-        auto gemm2 = Xgemm<T>(queue_, gemm2_event.pointer());
-        gemm2.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-                     m, n - i - block_size, block_size, ConstantNegOne<T>(),
-                     x_buffer, x_offset + i * x_ld, x_ld,
-                     a_buffer, this_a_offset + a_offset, a_ld, gemm_alpha,
-                     b_buffer, b_offset + (i + block_size) * b_ld, b_ld);
-        gemm2_event.WaitForCompletion();
-      }
+      gemm.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
+                  m, n1, k2, ConstantNegOne<T>(),
+                  b_buffer, b2_offset, b_ld,
+                  a_buffer, op_a21_offset, a_ld, alpha,
+                  b_buffer, b1_offset, b_ld);
     }
+    gemm_event.WaitForCompletion();
+    TrsmRecursive(side, forward, a_transpose, m1, n1, ConstantOne<T>(),
+                  a_buffer, a_offset, a_ld, b_buffer, b1_offset, b_ld,
+                  a_inv_buffer, a_inv_offset, block_size, scratch_buffer);
   }
-
-  // Retrieves the results
-  x_buffer.CopyTo(queue_, b_size, b_buffer);
 }
 
 // =================================================================================================
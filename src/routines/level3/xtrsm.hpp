@@ -29,8 +29,10 @@ class Xtrsm: public Xgemm<T> {
   using Xgemm<T>::queue_;
   using Xgemm<T>::context_;
   using Xgemm<T>::device_;
+  using Xgemm<T>::event_;
+  using Xgemm<T>::input_events_;
   using Xgemm<T>::db_;
-  using Xgemm<T>::program_;
+  using Xgemm<T>::GetGemmProgram;
   using Xgemm<T>::DoGemm;
 
   // Constructor
@@ -51,6 +53,34 @@ class Xtrsm: public Xgemm<T> {
                     const T alpha,
                     const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                     const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+
+  // Alternative to the above for only a few right-hand sides: solves each column (left side) or row
+  // (right side) of B by substitution as a batch of TRSV systems, without inverting any blocks
+  void TrsmSubstitution(const Side side, const Triangle triangle,
+                        const Transpose a_transpose, const Diagonal diagonal,
+                        const size_t m, const size_t n,
+                        const T alpha,
+                        const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                        const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+
+  // Recursive part of the column-major version, solving in-place in B: halves the triangular
+  // matrix, solves the two diagonal halves recursively and updates B in between with a single
+  // GEMM. Blocks of up to 'block_size' are solved with their inverses in 'a_inv_buffer'.
+  void TrsmRecursive(const Side side, const bool forward, const Transpose a_transpose,
+                     const size_t m, const size_t n,
+                     const T alpha,
+                     const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                     const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                     const Buffer<T> &a_inv_buffer, const size_t a_inv_offset,
+                     const size_t block_size, const Buffer<T> &scratch_buffer);
+
+  // Whether the first part of B is solved first in 'TrsmRecursive' (column-major arguments)
+  static bool IsForward(const Side side, const Triangle triangle, const Transpose a_transpose);
+
+ protected:
+  // The routine-level parameters: the size of the inverted diagonal blocks and the minimum number
+  // of right-hand sides for which those are used instead of substitution (see 'TrsmRoutine')
+  Databases trsm_db_;
 };
 
 // =================================================================================================
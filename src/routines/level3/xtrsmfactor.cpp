@@ -0,0 +1,134 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the TrsmFactor class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/level3/xtrsmfactor.hpp"
+#include "routines/levelx/xinvert.hpp"
+#ifdef OPENCL_API
+  #include "profiling.hpp"
+#endif
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+// A row-major problem is solved as a column-major one with the other side and triangle (see
+// 'Xtrsm::DoTrsm')
+Side ColMajorSide(const Layout layout, const Side side) {
+  if (layout == Layout::kColMajor) { return side; }
+  return (side == Side::kLeft) ? Side::kRight : Side::kLeft;
+}
+Triangle ColMajorTriangle(const Layout layout, const Triangle triangle) {
+  if (layout == Layout::kColMajor) { return triangle; }
+  return (triangle == Triangle::kLower) ? Triangle::kUpper : Triangle::kLower;
+}
+} // anonymous namespace
+
+// Constructor: builds the routine and inverts the diagonal blocks of matrix A
+template <typename T>
+TrsmFactor<T>::TrsmFactor(Queue &queue, const Layout layout, const Side side,
+                          const Triangle triangle, const Transpose a_transpose,
+                          const Diagonal diagonal, const size_t k,
+                          const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld):
+    Xtrsm<T>(queue, nullptr),
+    layout_(layout),
+    side_(ColMajorSide(layout, side)),
+    a_transpose_(a_transpose),
+    forward_(Xtrsm<T>::IsForward(ColMajorSide(layout, side), ColMajorTriangle(layout, triangle),
+                                 a_transpose)),
+    k_(k),
+    a_buffer_(a_buffer),
+    a_offset_(a_offset), a_ld_(a_ld),
+    block_size_(0),
+    a_inv_buffer_(0) {
+  this->trace_.End(); // the factor outlives its creation, the solves are traced and counted below
+  this->statistics_.End();
+  #ifdef OPENCL_API
+    this->slow_call_.End();
+  #endif
+
+  // Makes sure the dimension is larger than zero and checks for validity of matrix A
+  if (k == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+  TestMatrixA(k, k, a_buffer, a_offset, a_ld);
+
+  // Allocates the buffer for the inverted diagonal blocks once for all solves
+  block_size_ = this->trsm_db_["TRSM_BLOCK_SIZE"];
+  a_inv_buffer_ = Buffer<T>(this->context_, Ceil(k, block_size_) * block_size_);
+
+  // Inverts the diagonal blocks
+  auto diagonal_invert_event = Event();
+  auto inverter = Xinvert<T>(this->queue_, diagonal_invert_event.pointer());
+  inverter.InvertMatrixDiagonalBlocks(Layout::kColMajor, ColMajorTriangle(layout, triangle),
+                                      diagonal, k, block_size_, a_buffer, a_offset, a_ld,
+                                      a_inv_buffer_);
+  diagonal_invert_event.WaitForCompletion();
+}
+
+// =================================================================================================
+
+// Solves the system with the inverted diagonal blocks (see 'Xtrsm::TrsmColMajor')
+template <typename T>
+void TrsmFactor<T>::Solve(Queue &queue, EventPointer event, size_t m, size_t n, const T alpha,
+                          const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld) {
+  const TraceScope trace(this->routine_name_, "routine");
+  const RoutineStatisticsScope statistics(this->routine_name_);
+  #ifdef OPENCL_API
+    const SlowCallScope slow_call(this->routine_name_);
+  #endif
+
+  // Binds the queue and event of this solve. The queue only has to be checked in case it differs
+  // from the one the factor was created with.
+  if (queue() != this->queue_()) {
+    if (queue.GetContext()() != this->context_() || queue.GetDevice()() != this->device_()) {
+      throw BLASError(StatusCode::kInvalidCommandQueue,
+                      "factor was created for another context or device");
+    }
+    this->queue_ = queue;
+  }
+  this->event_ = event;
+  this->input_events_ = BeginCommandChain(this->queue_);
+  #ifdef OPENCL_API
+    if (IsProfilingEnabled()) { SetProfilingRoutine(this->routine_name_); }
+  #endif
+
+  // Converts a row-major problem to a column-major one and checks whether B matches matrix A
+  if (layout_ == Layout::kRowMajor) { std::swap(m, n); }
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+  if (((side_ == Side::kLeft) ? m : n) != k_) {
+    throw BLASError(StatusCode::kInvalidDimension, "B does not match the size of the factor");
+  }
+  TestMatrixB(m, n, b_buffer, b_offset, b_ld);
+
+  // Temporary buffer for a single block of rows (left side) or columns (right side) of B
+  const auto scratch_size = (side_ == Side::kLeft) ? block_size_ * n : m * block_size_;
+  auto scratch_buffer = TemporaryBuffer<T>(this->context_, this->queue_, scratch_size);
+
+  // Solves the system in-place in B
+  this->TrsmRecursive(side_, forward_, a_transpose_, m, n, alpha,
+                      a_buffer_, a_offset_, a_ld_, b_buffer, b_offset, b_ld,
+                      a_inv_buffer_, 0, block_size_, scratch_buffer);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class TrsmFactor<half>;
+template class TrsmFactor<float>;
+template class TrsmFactor<double>;
+template class TrsmFactor<float2>;
+template class TrsmFactor<double2>;
+
+// =================================================================================================
+} // namespace clblast
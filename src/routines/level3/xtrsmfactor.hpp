@@ -0,0 +1,60 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the TrsmFactor class: a triangular matrix A of TRSM prepared for repeated
+// solves with new right-hand sides. The diagonal blocks of A are inverted once upon construction,
+// such that a solve only runs the GEMM-based updates of B (see 'Xtrsm::TrsmRecursive').
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTRSMFACTOR_H_
+#define CLBLAST_ROUTINES_XTRSMFACTOR_H_
+
+#include "routines/level3/xtrsm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class. Note that a factor refers to the
+// user's matrix A rather than copying it, and that solves of a single factor should not overlap.
+template <typename T>
+class TrsmFactor: public Xtrsm<T> {
+ public:
+
+  // Constructor, inverts the diagonal blocks of the 'k' by 'k' matrix A
+  TrsmFactor(Queue &queue, const Layout layout, const Side side, const Triangle triangle,
+             const Transpose a_transpose, const Diagonal diagonal, const size_t k,
+             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld);
+
+  // Solves op(A) * X = alpha * B or X * op(A) = alpha * B in-place in B, on a queue of the same
+  // context and device as the factor was created for
+  void Solve(Queue &queue, EventPointer event, size_t m, size_t n, const T alpha,
+             const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+
+ private:
+
+  // The arguments of the factor, converted to column-major
+  const Layout layout_;
+  const Side side_;
+  const Transpose a_transpose_;
+  const bool forward_;
+  const size_t k_;
+  const Buffer<T> a_buffer_;
+  const size_t a_offset_, a_ld_;
+
+  // The inverted diagonal blocks of matrix A
+  size_t block_size_;
+  Buffer<T> a_inv_buffer_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XTRSMFACTOR_H_
+#endif
@@ -0,0 +1,48 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XasumStridedBatched routine. This is a non-blas strided-batched version
+// of ASUM.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XASUMSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XASUMSTRIDEDBATCHED_H_
+
+#include "routines/level1/xasum.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XasumStridedBatched: public Xasum<T> {
+ public:
+
+  // Uses the regular Xasum routine
+  using Xasum<T>::DoAsum;
+
+  // Constructor
+  XasumStridedBatched(Queue &queue, EventPointer event,
+                      const std::string &name = "ASUMSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoAsumStridedBatched(const size_t n,
+                            const Buffer<T> &asum_buffer, const size_t asum_offset,
+                            const size_t asum_stride,
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const size_t x_stride,
+                            const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XASUMSTRIDEDBATCHED_H_
+#endif
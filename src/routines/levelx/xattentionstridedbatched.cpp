@@ -0,0 +1,168 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XattentionStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xattentionstridedbatched.hpp"
+#include "routines/levelx/xgemmstridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T> constexpr size_t XattentionStridedBatched<T>::kTileRows;
+template <typename T> constexpr size_t XattentionStridedBatched<T>::kThreads;
+template <typename T> constexpr size_t XattentionStridedBatched<T>::kMaxHeadDim;
+template <typename T> constexpr size_t XattentionStridedBatched<T>::kLocalMemory;
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XattentionStridedBatched<T>::XattentionStridedBatched(Queue &queue, EventPointer event,
+                                                      const std::string &name):
+    Routine(queue, event, name, {}, PrecisionValue<T>(), {}, {
+    KernelSource::kXattention
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XattentionStridedBatched<T>::DoAttentionStridedBatched(const Layout layout,
+                                                            const size_t seq_q, const size_t seq_k,
+                                                            const size_t head_dim,
+                                                            const T scale, const bool causal,
+                                                            const Buffer<T> &q_buffer, const size_t q_offset, const size_t q_ld, const size_t q_stride,
+                                                            const Buffer<T> &k_buffer, const size_t k_offset, const size_t k_ld, const size_t k_stride,
+                                                            const Buffer<T> &v_buffer, const size_t v_offset, const size_t v_ld, const size_t v_stride,
+                                                            const Buffer<T> &o_buffer, const size_t o_offset, const size_t o_ld, const size_t o_stride,
+                                                            const size_t batch_count) {
+
+  // Makes sure all dimensions are larger than zero
+  if (seq_q == 0 || seq_k == 0 || head_dim == 0 || batch_count == 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the matrices for validity: K and V are reported as B and the output as C
+  const auto is_row_major = (layout == Layout::kRowMajor);
+  const auto q_one = (is_row_major) ? head_dim : seq_q;
+  const auto kv_one = (is_row_major) ? head_dim : seq_k;
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(q_one, (is_row_major) ? seq_q : head_dim, q_buffer, q_offset + q_stride * batch, q_ld);
+    TestMatrixB(kv_one, (is_row_major) ? seq_k : head_dim, k_buffer, k_offset + k_stride * batch, k_ld);
+    TestMatrixB(kv_one, (is_row_major) ? seq_k : head_dim, v_buffer, v_offset + v_stride * batch, v_ld);
+    TestMatrixC(q_one, (is_row_major) ? seq_q : head_dim, o_buffer, o_offset + o_stride * batch, o_ld);
+  }
+
+  // Falls back to the unfused version if the head dimension doesn't fit in local memory
+  if (head_dim > kMaxHeadDim || !device_.IsLocalMemoryValid(kLocalMemory) ||
+      device_.MaxWorkGroupSize() < kThreads) {
+    AttentionUnfused(layout, seq_q, seq_k, head_dim, scale, causal,
+                     q_buffer, q_offset, q_ld, q_stride, k_buffer, k_offset, k_ld, k_stride,
+                     v_buffer, v_offset, v_ld, v_stride, o_buffer, o_offset, o_ld, o_stride,
+                     batch_count);
+    return;
+  }
+
+  // Launches the fused kernel, a work-group per 'kTileRows' queries of each batch
+  auto kernel = GetKernel(program_, "XattentionStridedBatched");
+  kernel.SetArgument(0, static_cast<int>(seq_q));
+  kernel.SetArgument(1, static_cast<int>(seq_k));
+  kernel.SetArgument(2, static_cast<int>(head_dim));
+  kernel.SetArgument(3, GetRealArg(scale));
+  kernel.SetArgument(4, static_cast<int>(causal));
+  kernel.SetArgument(5, q_buffer());
+  kernel.SetArgument(6, static_cast<int>(q_offset));
+  kernel.SetArgument(7, static_cast<int>(q_ld));
+  kernel.SetArgument(8, static_cast<int>(q_stride));
+  kernel.SetArgument(9, k_buffer());
+  kernel.SetArgument(10, static_cast<int>(k_offset));
+  kernel.SetArgument(11, static_cast<int>(k_ld));
+  kernel.SetArgument(12, static_cast<int>(k_stride));
+  kernel.SetArgument(13, v_buffer());
+  kernel.SetArgument(14, static_cast<int>(v_offset));
+  kernel.SetArgument(15, static_cast<int>(v_ld));
+  kernel.SetArgument(16, static_cast<int>(v_stride));
+  kernel.SetArgument(17, o_buffer());
+  kernel.SetArgument(18, static_cast<int>(o_offset));
+  kernel.SetArgument(19, static_cast<int>(o_ld));
+  kernel.SetArgument(20, static_cast<int>(o_stride));
+  kernel.SetArgument(21, static_cast<int>(is_row_major));
+  const auto global = ThreadRange{CeilDiv(seq_q, kTileRows) * kThreads, batch_count};
+  const auto local = ThreadRange{kThreads, 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// The fall-back: computes the scores with a batched GEMM into a temporary buffer, applies the
+// softmax to its rows, and multiplies the result with V by another batched GEMM
+template <typename T>
+void XattentionStridedBatched<T>::AttentionUnfused(const Layout layout,
+                                                   const size_t seq_q, const size_t seq_k,
+                                                   const size_t head_dim,
+                                                   const T scale, const bool causal,
+                                                   const Buffer<T> &q_buffer, const size_t q_offset, const size_t q_ld, const size_t q_stride,
+                                                   const Buffer<T> &k_buffer, const size_t k_offset, const size_t k_ld, const size_t k_stride,
+                                                   const Buffer<T> &v_buffer, const size_t v_offset, const size_t v_ld, const size_t v_stride,
+                                                   const Buffer<T> &o_buffer, const size_t o_offset, const size_t o_ld, const size_t o_stride,
+                                                   const size_t batch_count) {
+  const auto s_ld = (layout == Layout::kRowMajor) ? seq_k : seq_q;
+  const auto s_stride = seq_q * seq_k;
+  auto s_buffer = TemporaryBuffer<T>(context_, queue_, s_stride * batch_count);
+
+  // The scores: S = scale * Q * K^T
+  auto scores_event = Event();
+  auto scores = XgemmStridedBatched<T>(queue_, scores_event.pointer());
+  scores.DoGemmStridedBatched(layout, Transpose::kNo, Transpose::kYes,
+                              seq_q, seq_k, head_dim, scale,
+                              q_buffer, q_offset, q_ld, q_stride,
+                              k_buffer, k_offset, k_ld, k_stride, ConstantZero<T>(),
+                              s_buffer, 0, s_ld, s_stride, batch_count);
+  scores_event.WaitForCompletion();
+
+  // The softmax of each row of the scores, a work-group per row
+  auto kernel = GetKernel(program_, "XattentionSoftmax");
+  kernel.SetArgument(0, static_cast<int>(seq_q));
+  kernel.SetArgument(1, static_cast<int>(seq_k));
+  kernel.SetArgument(2, static_cast<int>(causal));
+  kernel.SetArgument(3, s_buffer());
+  kernel.SetArgument(4, static_cast<int>(s_ld));
+  kernel.SetArgument(5, static_cast<int>(s_stride));
+  kernel.SetArgument(6, static_cast<int>(layout == Layout::kRowMajor));
+  auto softmax_event = Event();
+  const auto global = ThreadRange{seq_q * kThreads, batch_count};
+  const auto local = ThreadRange{kThreads, 1};
+  RunKernel(kernel, queue_, device_, global, local, softmax_event.pointer());
+  softmax_event.WaitForCompletion();
+
+  // The output: O = S * V
+  auto output = XgemmStridedBatched<T>(queue_, event_);
+  output.DoGemmStridedBatched(layout, Transpose::kNo, Transpose::kNo,
+                              seq_q, head_dim, seq_k, ConstantOne<T>(),
+                              s_buffer, 0, s_ld, s_stride,
+                              v_buffer, v_offset, v_ld, v_stride, ConstantZero<T>(),
+                              o_buffer, o_offset, o_ld, o_stride, batch_count);
+}
+
+// =================================================================================================
+
+// Compiles the templated class: only for real data-types, since the softmax is not defined for
+// complex numbers
+template class XattentionStridedBatched<half>;
+template class XattentionStridedBatched<float>;
+template class XattentionStridedBatched<double>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,72 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XattentionStridedBatched routine. This is a non-blas routine computing
+// the scaled dot-product attention O = softmax(scale*Q*K^T)*V for a batch of matrices, as found in
+// transformer models. If the head dimension is small enough, a single fused kernel computes the
+// output without storing the scores. Otherwise, the routine falls back to a batched GEMM, a row
+// softmax kernel and another batched GEMM.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XATTENTIONSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XATTENTIONSTRIDEDBATCHED_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XattentionStridedBatched: public Routine {
+ public:
+
+  // Constructor
+  XattentionStridedBatched(Queue &queue, EventPointer event,
+                           const std::string &name = "ATTENTIONSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoAttentionStridedBatched(const Layout layout,
+                                 const size_t seq_q, const size_t seq_k, const size_t head_dim,
+                                 const T scale, const bool causal,
+                                 const Buffer<T> &q_buffer, const size_t q_offset, const size_t q_ld, const size_t q_stride,
+                                 const Buffer<T> &k_buffer, const size_t k_offset, const size_t k_ld, const size_t k_stride,
+                                 const Buffer<T> &v_buffer, const size_t v_offset, const size_t v_ld, const size_t v_stride,
+                                 const Buffer<T> &o_buffer, const size_t o_offset, const size_t o_ld, const size_t o_stride,
+                                 const size_t batch_count);
+
+  // The tile sizes of the fused kernel: these have to match the values of 'ATT_ROWS', 'ATT_THREADS'
+  // and 'ATT_MAX_D' in the kernel. The largest head dimension is limited by the local memory.
+  static constexpr size_t kTileRows = 16;
+  static constexpr size_t kThreads = 128;
+  static constexpr size_t kMaxHeadDim = (sizeof(T) == 8) ? 64 : 128;
+
+  // The local memory used by the fused kernel: the queries, the tiles of K and V, and the scores
+  static constexpr size_t kLocalMemory = (kTileRows * (kMaxHeadDim + 1) + 32 * 16 +
+                                          16 * kMaxHeadDim + 32 * kTileRows + 3 * kTileRows) * sizeof(T);
+
+ private:
+
+  // The fall-back: the scores go through a temporary buffer in global memory
+  void AttentionUnfused(const Layout layout,
+                        const size_t seq_q, const size_t seq_k, const size_t head_dim,
+                        const T scale, const bool causal,
+                        const Buffer<T> &q_buffer, const size_t q_offset, const size_t q_ld, const size_t q_stride,
+                        const Buffer<T> &k_buffer, const size_t k_offset, const size_t k_ld, const size_t k_stride,
+                        const Buffer<T> &v_buffer, const size_t v_offset, const size_t v_ld, const size_t v_stride,
+                        const Buffer<T> &o_buffer, const size_t o_offset, const size_t o_ld, const size_t o_stride,
+                        const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XATTENTIONSTRIDEDBATCHED_H_
+#endif
@@ -0,0 +1,94 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XaxpbyStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xaxpbystridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XaxpbyStridedBatched<T>::XaxpbyStridedBatched(Queue &queue, EventPointer event,
+                                              const std::string &name):
+    Xaxpby<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XaxpbyStridedBatched<T>::DoAxpbyStridedBatched(const size_t n, const T alpha,
+                                                    const Buffer<T> &x_buffer,
+                                                    const size_t x_offset, const size_t x_inc,
+                                                    const size_t x_stride, const T beta,
+                                                    const Buffer<T> &y_buffer,
+                                                    const size_t y_offset, const size_t y_inc,
+                                                    const size_t y_stride,
+                                                    const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count == 0) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // A single batch can use the vectorised kernels of the regular routine
+  if (batch_count == 1) {
+    DoAxpby(n, alpha, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc);
+    return;
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestVectorX(n, x_buffer, x_offset + x_stride * batch, x_inc);
+    TestVectorY(n, y_buffer, y_offset + y_stride * batch, y_inc);
+  }
+
+  // Retrieves the Xaxpby kernel from the compiled binary
+  auto kernel = GetKernel(this->program_, "XaxpbyStridedBatched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, GetRealArg(alpha));
+  kernel.SetArgument(2, GetRealArg(beta));
+  kernel.SetArgument(3, x_buffer());
+  kernel.SetArgument(4, static_cast<int>(x_offset));
+  kernel.SetArgument(5, static_cast<int>(x_inc));
+  kernel.SetArgument(6, static_cast<int>(x_stride));
+  kernel.SetArgument(7, y_buffer());
+  kernel.SetArgument(8, static_cast<int>(y_offset));
+  kernel.SetArgument(9, static_cast<int>(y_inc));
+  kernel.SetArgument(10, static_cast<int>(y_stride));
+
+  // Launches the kernel
+  const auto n_ceiled = Ceil(n, this->db_["WGS"]*this->db_["WPT"]);
+  auto global = ThreadRange{n_ceiled/this->db_["WPT"], batch_count};
+  auto local = ThreadRange{this->db_["WGS"], 1};
+  RunKernel(kernel, this->queue_, this->device_, global, local, this->event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XaxpbyStridedBatched<half>;
+template class XaxpbyStridedBatched<float>;
+template class XaxpbyStridedBatched<double>;
+template class XaxpbyStridedBatched<float2>;
+template class XaxpbyStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
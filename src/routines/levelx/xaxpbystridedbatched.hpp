@@ -0,0 +1,49 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XaxpbyStridedBatched routine. This is a non-blas strided-batched version
+// of AXPBY.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XAXPBYSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XAXPBYSTRIDEDBATCHED_H_
+
+#include "routines/levelx/xaxpby.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XaxpbyStridedBatched: public Xaxpby<T> {
+ public:
+
+  // Uses the regular Xaxpby routine
+  using Xaxpby<T>::DoAxpby;
+
+  // Constructor
+  XaxpbyStridedBatched(Queue &queue, EventPointer event,
+                       const std::string &name = "AXPBYSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoAxpbyStridedBatched(const size_t n, const T alpha,
+                             const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                             const size_t x_stride,
+                             const T beta,
+                             const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                             const size_t y_stride,
+                             const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XAXPBYSTRIDEDBATCHED_H_
+#endif
@@ -23,8 +23,8 @@ namespace clblast {
 template <typename T>
 XaxpyBatched<T>::XaxpyBatched(Queue &queue, EventPointer event, const std::string &name):
     Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, {
-    #include "../../kernels/level1/level1.opencl"
-    #include "../../kernels/level1/xaxpy.opencl"
+    KernelSource::kLevel1,
+    KernelSource::kXaxpy
     }) {
 }
 
@@ -59,15 +59,15 @@ void XaxpyBatched<T>::DoAxpyBatched(const size_t n, const std::vector<T> &alphas
     x_offsets_int[batch] = static_cast<int>(x_offsets[batch]);
     y_offsets_int[batch] = static_cast<int>(y_offsets[batch]);
   }
-  auto x_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
-  auto y_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
-  auto alphas_device = Buffer<T>(context_, BufferAccess::kReadWrite, batch_count);
+  auto x_offsets_device = TemporaryBuffer<int>(context_, queue_, batch_count);
+  auto y_offsets_device = TemporaryBuffer<int>(context_, queue_, batch_count);
+  auto alphas_device = TemporaryBuffer<T>(context_, queue_, batch_count);
   x_offsets_device.Write(queue_, batch_count, x_offsets_int);
   y_offsets_device.Write(queue_, batch_count, y_offsets_int);
   alphas_device.Write(queue_, batch_count, alphas);
 
   // Retrieves the Xaxpy kernel from the compiled binary
-  auto kernel = Kernel(program_, "XaxpyBatched");
+  auto kernel = GetKernel(program_, "XaxpyBatched");
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(n));
@@ -81,8 +81,8 @@ void XaxpyBatched<T>::DoAxpyBatched(const size_t n, const std::vector<T> &alphas
 
   // Launches the kernel
   auto n_ceiled = Ceil(n, db_["WGS"]*db_["WPT"]);
-  auto global = std::vector<size_t>{n_ceiled/db_["WPT"], batch_count};
-  auto local = std::vector<size_t>{db_["WGS"], 1};
+  auto global = ThreadRange{n_ceiled/db_["WPT"], batch_count};
+  auto local = ThreadRange{db_["WGS"], 1};
   RunKernel(kernel, queue_, device_, global, local, event_);
 }
 
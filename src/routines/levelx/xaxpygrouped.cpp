@@ -0,0 +1,101 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XaxpyGrouped class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xaxpygrouped.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T> constexpr size_t XaxpyGrouped<T>::kProblemSize;
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XaxpyGrouped<T>::XaxpyGrouped(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, {
+    KernelSource::kLevel1,
+    KernelSource::kXaxpy
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XaxpyGrouped<T>::DoAxpyGrouped(const std::vector<size_t> &ns, const std::vector<T> &alphas,
+                                    const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets, const size_t x_inc,
+                                    const Buffer<T> &y_buffer, const std::vector<size_t> &y_offsets, const size_t y_inc,
+                                    const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (ns.size() != batch_count) || (alphas.size() != batch_count) ||
+      (x_offsets.size() != batch_count) || (y_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Tests the vectors for validity and builds the table of problems for the device, in which the
+  // start of each entry is the prefix sum of the sizes of the entries before it. Empty entries are
+  // allowed, as long as not all entries are empty.
+  auto problems = std::vector<int>(batch_count * kProblemSize);
+  auto total = size_t{0};
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    if (ns[batch] != 0) {
+      TestVectorX(ns[batch], x_buffer, x_offsets[batch], x_inc);
+      TestVectorY(ns[batch], y_buffer, y_offsets[batch], y_inc);
+    }
+    problems[batch * kProblemSize + 0] = static_cast<int>(total);
+    problems[batch * kProblemSize + 1] = static_cast<int>(x_offsets[batch]);
+    problems[batch * kProblemSize + 2] = static_cast<int>(y_offsets[batch]);
+    total += ns[batch];
+  }
+  if (total == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Uploads the scalar arguments and the problem table to the device
+  auto alphas_device = TemporaryBuffer<T>(context_, queue_, batch_count);
+  auto problems_device = TemporaryBuffer<int>(context_, queue_, problems.size());
+  alphas_device.Write(queue_, batch_count, alphas);
+  problems_device.Write(queue_, problems.size(), problems);
+
+  // Retrieves the Xaxpy kernel from the compiled binary
+  auto kernel = GetKernel(program_, "XaxpyGrouped");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(total));
+  kernel.SetArgument(1, static_cast<int>(batch_count));
+  kernel.SetArgument(2, problems_device());
+  kernel.SetArgument(3, alphas_device());
+  kernel.SetArgument(4, x_buffer());
+  kernel.SetArgument(5, static_cast<int>(x_inc));
+  kernel.SetArgument(6, y_buffer());
+  kernel.SetArgument(7, static_cast<int>(y_inc));
+
+  // Launches the kernel: a one-dimensional thread-grid over the elements of all entries together
+  const auto total_ceiled = Ceil(total, db_["WGS"]*db_["WPT"]);
+  auto global = ThreadRange{total_ceiled/db_["WPT"]};
+  auto local = ThreadRange{db_["WGS"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XaxpyGrouped<half>;
+template class XaxpyGrouped<float>;
+template class XaxpyGrouped<double>;
+template class XaxpyGrouped<float2>;
+template class XaxpyGrouped<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,49 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XaxpyGrouped routine. This is a non-blas batched version of AXPY in
+// which each entry of the batch has its own size. All entries are computed by a single kernel
+// launch, of which the threads are spread evenly over the elements of all entries.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XAXPYGROUPED_H_
+#define CLBLAST_ROUTINES_XAXPYGROUPED_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XaxpyGrouped: public Routine {
+ public:
+
+  // Constructor
+  XaxpyGrouped(Queue &queue, EventPointer event, const std::string &name = "AXPYGROUPED");
+
+  // Templated-precision implementation of the routine
+  void DoAxpyGrouped(const std::vector<size_t> &ns, const std::vector<T> &alphas,
+                     const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets, const size_t x_inc,
+                     const Buffer<T> &y_buffer, const std::vector<size_t> &y_offsets, const size_t y_inc,
+                     const size_t batch_count);
+
+  // The number of integers describing a single entry in the device-side problem table: the start
+  // of the entry within the concatenated elements of all entries, the x offset, and the y offset
+  static constexpr size_t kProblemSize = 3;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XAXPYGROUPED_H_
+#endif
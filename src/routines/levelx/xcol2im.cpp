@@ -0,0 +1,120 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xcol2im class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xcol2im.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xcol2im<T>::Xcol2im(Queue &queue, EventPointer event, const std::string &name):
+        Routine(queue, event, name, {"Copy"}, PrecisionValue<T>(), {}, {
+        KernelSource::kCol2im
+        }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xcol2im<T>::DoCol2im(const size_t channels, const size_t height, const size_t width,
+                          const size_t kernel_h, const size_t kernel_w, const size_t pad_h,
+                          const size_t pad_w, const size_t stride_h, const size_t stride_w,
+                          const size_t dilation_h, const size_t dilation_w,
+                          const Buffer<T> &col_buffer, const size_t col_offset,
+                          const Buffer<T> &im_buffer, const size_t im_offset) {
+  BatchedCol2im(channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w,
+                dilation_h, dilation_w, col_buffer, col_offset, 0, im_buffer, im_offset, 0, 1);
+}
+
+// =================================================================================================
+
+template <typename T>
+void Xcol2im<T>::BatchedCol2im(const size_t channels, const size_t height, const size_t width,
+                               const size_t kernel_h, const size_t kernel_w, const size_t pad_h,
+                               const size_t pad_w, const size_t stride_h, const size_t stride_w,
+                               const size_t dilation_h, const size_t dilation_w,
+                               const Buffer<T> &col_buffer, const size_t col_offset, const size_t col_stride,
+                               const Buffer<T> &im_buffer, const size_t im_offset, const size_t im_stride,
+                               const size_t batch_count) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((channels == 0) || (height == 0) || (width == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+  if ((stride_h == 0) || (stride_w == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests for a valid batch count
+  if (batch_count == 0) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // Sets the output height and width (the sizes of the col matrix)
+  const auto size_h = height + 2 * pad_h;
+  const auto padding_h = dilation_h * (kernel_h - 1) + 1;
+  const auto output_h = (size_h >= padding_h) ? (size_h - padding_h) / stride_h + 1 : 1;
+  const auto size_w = width + 2 * pad_w;
+  const auto padding_w = dilation_w * (kernel_w - 1) + 1;
+  const auto output_w = (size_w >= padding_w) ? (size_w - padding_w) / stride_w + 1 : 1;
+
+  // Tests the buffers for validity: the col matrix and the image of each batch are a single column
+  const auto col_size = output_h * output_w * kernel_h * kernel_w * channels;
+  const auto im_size = height * width * channels;
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(col_size, 1, col_buffer, col_offset + col_stride * batch, col_size);
+    TestMatrixC(im_size, 1, im_buffer, im_offset + im_stride * batch, im_size);
+  }
+
+  // Retrieves the col2im kernel from the compiled binary
+  auto kernel = GetKernel(program_, "col2im");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(height));
+  kernel.SetArgument(1, static_cast<int>(width));
+  kernel.SetArgument(2, static_cast<int>(channels));
+  kernel.SetArgument(3, static_cast<int>(output_h));
+  kernel.SetArgument(4, static_cast<int>(output_w));
+  kernel.SetArgument(5, static_cast<int>(kernel_h));
+  kernel.SetArgument(6, static_cast<int>(kernel_w));
+  kernel.SetArgument(7, static_cast<int>(pad_h));
+  kernel.SetArgument(8, static_cast<int>(pad_w));
+  kernel.SetArgument(9, static_cast<int>(stride_h));
+  kernel.SetArgument(10, static_cast<int>(stride_w));
+  kernel.SetArgument(11, static_cast<int>(dilation_h));
+  kernel.SetArgument(12, static_cast<int>(dilation_w));
+  kernel.SetArgument(13, col_buffer());
+  kernel.SetArgument(14, static_cast<int>(col_offset));
+  kernel.SetArgument(15, static_cast<int>(col_stride));
+  kernel.SetArgument(16, im_buffer());
+  kernel.SetArgument(17, static_cast<int>(im_offset));
+  kernel.SetArgument(18, static_cast<int>(im_stride));
+
+  // Launches the kernel: one thread per image pixel, such that no atomics are needed
+  const auto w_ceiled = Ceil(width, db_["COPY_DIMX"]);
+  const auto h_ceiled = Ceil(height, db_["COPY_DIMY"]);
+  const auto global = ThreadRange{w_ceiled, h_ceiled * channels, batch_count};
+  const auto local = ThreadRange{db_["COPY_DIMX"], db_["COPY_DIMY"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xcol2im<half>;
+template class Xcol2im<float>;
+template class Xcol2im<double>;
+template class Xcol2im<float2>;
+template class Xcol2im<double2>;
+
+// =================================================================================================
+} // namespace clblast
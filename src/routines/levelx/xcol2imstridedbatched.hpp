@@ -0,0 +1,47 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xcol2imStridedBatched routine. This is a non-blas batched version of
+// COL2IM, it is based on the Xcol2im class.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XCOL2IMSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XCOL2IMSTRIDEDBATCHED_H_
+
+#include "routines/levelx/xcol2im.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xcol2imStridedBatched: public Xcol2im<T> {
+ public:
+
+  // Constructor
+  Xcol2imStridedBatched(Queue &queue, EventPointer event,
+                        const std::string &name = "COL2IMSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoCol2imStridedBatched(const size_t channels, const size_t height, const size_t width,
+                              const size_t kernel_h, const size_t kernel_w,
+                              const size_t pad_h, const size_t pad_w,
+                              const size_t stride_h, const size_t stride_w,
+                              const size_t dilation_h, const size_t dilation_w,
+                              const Buffer<T> &col_buffer, const size_t col_offset, const size_t col_stride,
+                              const Buffer<T> &im_buffer, const size_t im_offset, const size_t im_stride,
+                              const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XCOL2IMSTRIDEDBATCHED_H_
+#endif
@@ -0,0 +1,89 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xconvert class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xconvert.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor, always using the bfloat16 precision
+Xconvert::Xconvert(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xaxpy"}, Precision::kBFloat16, {}, {
+    KernelSource::kXconvert
+    }) {
+}
+
+// =================================================================================================
+
+// The main routines
+void Xconvert::DoConvertToBFloat16(const size_t n,
+                                   const Buffer<float> &src_buffer, const size_t src_offset,
+                                   const Buffer<bfloat16> &dest_buffer, const size_t dest_offset) {
+  RunConvertKernel("XconvertToBFloat16", n, src_buffer, src_offset, dest_buffer, dest_offset);
+}
+
+void Xconvert::DoConvertFromBFloat16(const size_t n,
+                                     const Buffer<bfloat16> &src_buffer, const size_t src_offset,
+                                     const Buffer<float> &dest_buffer, const size_t dest_offset) {
+  RunConvertKernel("XconvertFromBFloat16", n, src_buffer, src_offset, dest_buffer, dest_offset);
+}
+
+void Xconvert::DoConvertToHalf(const size_t n,
+                               const Buffer<float> &src_buffer, const size_t src_offset,
+                               const Buffer<half> &dest_buffer, const size_t dest_offset) {
+  RunConvertKernel("XconvertToHalf", n, src_buffer, src_offset, dest_buffer, dest_offset);
+}
+
+void Xconvert::DoConvertFromHalf(const size_t n,
+                                 const Buffer<half> &src_buffer, const size_t src_offset,
+                                 const Buffer<float> &dest_buffer, const size_t dest_offset) {
+  RunConvertKernel("XconvertFromHalf", n, src_buffer, src_offset, dest_buffer, dest_offset);
+}
+
+// =================================================================================================
+
+// Tests the vectors for validity and launches the kernel
+template <typename S, typename D>
+void Xconvert::RunConvertKernel(const std::string &kernel_name, const size_t n,
+                                const Buffer<S> &src_buffer, const size_t src_offset,
+                                const Buffer<D> &dest_buffer, const size_t dest_offset) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors for validity
+  TestVectorX(n, src_buffer, src_offset, 1);
+  TestVectorY(n, dest_buffer, dest_offset, 1);
+
+  // Retrieves the kernel from the compiled binary
+  auto kernel = GetKernel(program_, kernel_name);
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, src_buffer());
+  kernel.SetArgument(2, static_cast<int>(src_offset));
+  kernel.SetArgument(3, dest_buffer());
+  kernel.SetArgument(4, static_cast<int>(dest_offset));
+
+  // Launches the kernel
+  const auto n_ceiled = Ceil(n, db_["WGS"]*db_["WPT"]);
+  auto global = ThreadRange{n_ceiled/db_["WPT"]};
+  auto local = ThreadRange{db_["WGS"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+} // namespace clblast
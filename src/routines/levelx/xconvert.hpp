@@ -0,0 +1,64 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xconvert routine: conversions between single-precision and bfloat16 or
+// half-precision data. Contrary to most routines, this is not templated: it is always compiled for
+// bfloat16. The half-precision kernels use vload_half/vstore_half and thus need no fp16 support.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XCONVERT_H_
+#define CLBLAST_ROUTINES_XCONVERT_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+class Xconvert: public Routine {
+ public:
+
+  // Constructor
+  Xconvert(Queue &queue, EventPointer event, const std::string &name = "CONVERT");
+
+  // Converts single-precision values to bfloat16
+  void DoConvertToBFloat16(const size_t n,
+                           const Buffer<float> &src_buffer, const size_t src_offset,
+                           const Buffer<bfloat16> &dest_buffer, const size_t dest_offset);
+
+  // Converts bfloat16 values to single-precision
+  void DoConvertFromBFloat16(const size_t n,
+                             const Buffer<bfloat16> &src_buffer, const size_t src_offset,
+                             const Buffer<float> &dest_buffer, const size_t dest_offset);
+
+  // Converts single-precision values to half-precision
+  void DoConvertToHalf(const size_t n,
+                       const Buffer<float> &src_buffer, const size_t src_offset,
+                       const Buffer<half> &dest_buffer, const size_t dest_offset);
+
+  // Converts half-precision values to single-precision
+  void DoConvertFromHalf(const size_t n,
+                         const Buffer<half> &src_buffer, const size_t src_offset,
+                         const Buffer<float> &dest_buffer, const size_t dest_offset);
+
+ private:
+
+  // Launches one of the conversion kernels
+  template <typename S, typename D>
+  void RunConvertKernel(const std::string &kernel_name, const size_t n,
+                        const Buffer<S> &src_buffer, const size_t src_offset,
+                        const Buffer<D> &dest_buffer, const size_t dest_offset);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XCONVERT_H_
+#endif
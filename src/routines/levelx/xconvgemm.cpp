@@ -0,0 +1,124 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xconvgemm class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xconvgemm.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xconvgemm<T>::Xconvgemm(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xconvgemm"}, PrecisionValue<T>(), {}, {
+    KernelSource::kXgemmEpilogue,
+    KernelSource::kXgemmDirectPart1,
+    KernelSource::kXgemmDirectPart2,
+    KernelSource::kXconvgemm
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xconvgemm<T>::DoConvgemm(const size_t channels, const size_t height, const size_t width,
+                              const size_t kernel_h, const size_t kernel_w, const size_t pad_h,
+                              const size_t pad_w, const size_t stride_h, const size_t stride_w,
+                              const size_t dilation_h, const size_t dilation_w,
+                              const size_t num_kernels, const size_t batch_count,
+                              const Buffer<T> &im_buffer, const size_t im_offset,
+                              const Buffer<T> &kernel_buffer, const size_t kernel_offset,
+                              const Buffer<T> &result_buffer, const size_t result_offset) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((channels == 0) || (height == 0) || (width == 0) || (kernel_h == 0) || (kernel_w == 0) ||
+      (num_kernels == 0) || (batch_count == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+  if ((stride_h == 0) || (stride_w == 0) || (dilation_h == 0) || (dilation_w == 0)) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Sets the output height and width
+  const auto size_h = height + 2 * pad_h;
+  const auto padding_h = dilation_h * (kernel_h - 1) + 1;
+  const auto output_h = (size_h >= padding_h) ? (size_h - padding_h) / stride_h + 1 : 1;
+  const auto size_w = width + 2 * pad_w;
+  const auto padding_w = dilation_w * (kernel_w - 1) + 1;
+  const auto output_w = (size_w >= padding_w) ? (size_w - padding_w) / stride_w + 1 : 1;
+
+  // The GEMM sizes: one row per output pixel, one column per kernel, and a K-dimension covering
+  // all the input channels and kernel elements
+  const auto num_patches = output_h * output_w;
+  const auto patch_size = channels * kernel_h * kernel_w;
+  const auto image_size = channels * height * width;
+  const auto result_size = num_patches * num_kernels;
+
+  // Tests the buffers for validity: each image (and result) is a column of a larger matrix
+  TestMatrixA(image_size, batch_count, im_buffer, im_offset, image_size);
+  TestMatrixB(patch_size, num_kernels, kernel_buffer, kernel_offset, patch_size);
+  TestMatrixC(result_size, batch_count, result_buffer, result_offset, result_size);
+
+  // Retrieves the kernel from the compiled binary
+  auto kernel = GetKernel(program_, "Xconvgemm");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(num_patches));
+  kernel.SetArgument(1, static_cast<int>(num_kernels));
+  kernel.SetArgument(2, static_cast<int>(patch_size));
+  kernel.SetArgument(3, kernel_buffer());
+  kernel.SetArgument(4, static_cast<int>(kernel_offset));
+  kernel.SetArgument(5, result_buffer());
+  kernel.SetArgument(6, static_cast<int>(result_offset));
+  kernel.SetArgument(7, static_cast<int>(result_size));
+  kernel.SetArgument(8, im_buffer());
+  kernel.SetArgument(9, static_cast<int>(im_offset));
+  kernel.SetArgument(10, static_cast<int>(image_size));
+  kernel.SetArgument(11, static_cast<int>(height));
+  kernel.SetArgument(12, static_cast<int>(width));
+  kernel.SetArgument(13, static_cast<int>(channels));
+  kernel.SetArgument(14, static_cast<int>(kernel_h));
+  kernel.SetArgument(15, static_cast<int>(kernel_w));
+  kernel.SetArgument(16, static_cast<int>(pad_h));
+  kernel.SetArgument(17, static_cast<int>(pad_w));
+  kernel.SetArgument(18, static_cast<int>(stride_h));
+  kernel.SetArgument(19, static_cast<int>(stride_w));
+  kernel.SetArgument(20, static_cast<int>(dilation_h));
+  kernel.SetArgument(21, static_cast<int>(dilation_w));
+  kernel.SetArgument(22, static_cast<int>(output_h));
+  kernel.SetArgument(23, static_cast<int>(output_w));
+
+  // Computes the global and local thread sizes: the third dimension holds the batch
+  const auto m_ceiled = Ceil(num_patches, db_["WGD"]);
+  const auto n_ceiled = Ceil(num_kernels, db_["WGD"]);
+  const auto global = ThreadRange{
+      (m_ceiled * db_["MDIMCD"]) / db_["WGD"],
+      (n_ceiled * db_["NDIMCD"]) / db_["WGD"],
+      batch_count
+  };
+  const auto local = ThreadRange{db_["MDIMCD"], db_["NDIMCD"], 1};
+
+  // Launches the kernel
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xconvgemm<half>;
+template class Xconvgemm<float>;
+template class Xconvgemm<double>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,48 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xconvgemm routine, a batched convolution computed as a single GEMM with
+// the im2col transformation fused into the loads of the GEMM kernel. The precision is implemented
+// using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XCONVGEMM_H_
+#define CLBLAST_ROUTINES_XCONVGEMM_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xconvgemm: public Routine {
+ public:
+
+  // Constructor
+  Xconvgemm(Queue &queue, EventPointer event, const std::string &name = "CONVGEMM");
+
+  // Templated-precision implementation of the routine
+  void DoConvgemm(const size_t channels, const size_t height, const size_t width,
+                  const size_t kernel_h, const size_t kernel_w,
+                  const size_t pad_h, const size_t pad_w,
+                  const size_t stride_h, const size_t stride_w,
+                  const size_t dilation_h, const size_t dilation_w,
+                  const size_t num_kernels, const size_t batch_count,
+                  const Buffer<T> &im_buffer, const size_t im_offset,
+                  const Buffer<T> &kernel_buffer, const size_t kernel_offset,
+                  const Buffer<T> &result_buffer, const size_t result_offset);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XCONVGEMM_H_
+#endif
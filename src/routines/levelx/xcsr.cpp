@@ -0,0 +1,127 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xcsr class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xcsr.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xcsr<T>::Xcsr(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xcsr"}, PrecisionValue<T>(), {}, {
+    KernelSource::kXcsr
+    }) {
+}
+
+// =================================================================================================
+
+// The sparse matrix-vector multiplication
+template <typename T>
+void Xcsr<T>::DoCsrmv(const size_t m, const size_t n, const size_t nnz,
+                      const T alpha,
+                      const Buffer<int> &row_ptr_buffer, const Buffer<int> &col_idx_buffer,
+                      const Buffer<T> &values_buffer,
+                      const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                      const T beta,
+                      const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the sparse matrix and the vectors for validity
+  TestMatrixCSR(m, nnz, row_ptr_buffer, col_idx_buffer, values_buffer);
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorY(m, y_buffer, y_offset, y_inc);
+
+  // Retrieves the Xcsrmv kernel from the compiled binary and sets its arguments
+  auto kernel = GetKernel(program_, "Xcsrmv");
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, GetRealArg(alpha));
+  kernel.SetArgument(2, GetRealArg(beta));
+  kernel.SetArgument(3, row_ptr_buffer());
+  kernel.SetArgument(4, col_idx_buffer());
+  kernel.SetArgument(5, values_buffer());
+  kernel.SetArgument(6, x_buffer());
+  kernel.SetArgument(7, static_cast<int>(x_offset));
+  kernel.SetArgument(8, static_cast<int>(x_inc));
+  kernel.SetArgument(9, y_buffer());
+  kernel.SetArgument(10, static_cast<int>(y_offset));
+  kernel.SetArgument(11, static_cast<int>(y_inc));
+
+  // Launches the kernel: VW threads per row
+  const auto global = ThreadRange{Ceil(m * db_["VW"], db_["WGS"])};
+  const auto local = ThreadRange{db_["WGS"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// The sparse-dense matrix multiplication
+template <typename T>
+void Xcsr<T>::DoCsrmm(const Layout layout, const size_t m, const size_t n, const size_t k,
+                      const size_t nnz,
+                      const T alpha,
+                      const Buffer<int> &row_ptr_buffer, const Buffer<int> &col_idx_buffer,
+                      const Buffer<T> &values_buffer,
+                      const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                      const T beta,
+                      const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0) || (k == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the sparse matrix and the dense matrices for validity
+  const auto rotated = (layout == Layout::kRowMajor);
+  TestMatrixCSR(m, nnz, row_ptr_buffer, col_idx_buffer, values_buffer);
+  TestMatrixB((rotated) ? n : k, (rotated) ? k : n, b_buffer, b_offset, b_ld);
+  TestMatrixC((rotated) ? n : m, (rotated) ? m : n, c_buffer, c_offset, c_ld);
+
+  // Retrieves the Xcsrmm kernel from the compiled binary and sets its arguments
+  auto kernel = GetKernel(program_, "Xcsrmm");
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, GetRealArg(alpha));
+  kernel.SetArgument(3, GetRealArg(beta));
+  kernel.SetArgument(4, row_ptr_buffer());
+  kernel.SetArgument(5, col_idx_buffer());
+  kernel.SetArgument(6, values_buffer());
+  kernel.SetArgument(7, b_buffer());
+  kernel.SetArgument(8, static_cast<int>(b_offset));
+  kernel.SetArgument(9, static_cast<int>(b_ld));
+  kernel.SetArgument(10, c_buffer());
+  kernel.SetArgument(11, static_cast<int>(c_offset));
+  kernel.SetArgument(12, static_cast<int>(c_ld));
+  kernel.SetArgument(13, static_cast<int>(rotated));
+  kernel.SetArgument(14, static_cast<int>(rotated));
+
+  // Launches the kernel: the columns in the first dimension, a row of work-groups per sparse row
+  const auto global = ThreadRange{Ceil(n, db_["WGS"]), m};
+  const auto local = ThreadRange{db_["WGS"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xcsr<half>;
+template class Xcsr<float>;
+template class Xcsr<double>;
+template class Xcsr<float2>;
+template class Xcsr<double2>;
+
+// =================================================================================================
+} // namespace clblast
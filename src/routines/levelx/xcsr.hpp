@@ -0,0 +1,55 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xcsr routine: the multiplication of a sparse matrix in CSR (compressed
+// sparse row) format with a dense vector (CSRMV) or with a dense matrix (CSRMM). The matrix-vector
+// kernel computes each row by a group of threads, of which the size is a tuning parameter.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XCSR_H_
+#define CLBLAST_ROUTINES_XCSR_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xcsr: public Routine {
+ public:
+
+  // Constructor
+  Xcsr(Queue &queue, EventPointer event, const std::string &name = "CSR");
+
+  // Templated-precision implementation of the sparse matrix-vector multiplication
+  void DoCsrmv(const size_t m, const size_t n, const size_t nnz,
+               const T alpha,
+               const Buffer<int> &row_ptr_buffer, const Buffer<int> &col_idx_buffer,
+               const Buffer<T> &values_buffer,
+               const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+               const T beta,
+               const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc);
+
+  // Templated-precision implementation of the sparse-dense matrix multiplication
+  void DoCsrmm(const Layout layout, const size_t m, const size_t n, const size_t k, const size_t nnz,
+               const T alpha,
+               const Buffer<int> &row_ptr_buffer, const Buffer<int> &col_idx_buffer,
+               const Buffer<T> &values_buffer,
+               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+               const T beta,
+               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XCSR_H_
+#endif
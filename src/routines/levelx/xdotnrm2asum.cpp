@@ -0,0 +1,104 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xdotnrm2asum class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xdotnrm2asum.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xdotnrm2asum<T>::Xdotnrm2asum(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {}, {
+    KernelSource::kXdotnrm2asum
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xdotnrm2asum<T>::DoDotnrm2asum(const size_t n,
+                                    const Buffer<T> &results_buffer, const size_t results_offset,
+                                    const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                                    const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors for validity: the three results are stored consecutively
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorY(n, y_buffer, y_offset, y_inc);
+  TestVectorScalar(3, results_buffer, results_offset);
+
+  // Retrieves the Xdotnrm2asum kernels from the compiled binary: either the single-pass kernel or
+  // the main and the epilogue kernels
+  const auto single_pass = (db_["XDOT_SINGLE_PASS"] == 1);
+  auto kernel1 = GetKernel(program_, (single_pass) ? "Xdotnrm2asumSinglePass" : "Xdotnrm2asum");
+
+  // Creates the buffer for intermediate values: the per-workgroup results of the three reductions
+  auto temp_size = 2*db_["WGS2"];
+  auto temp_buffer = TemporaryBuffer<T>(context_, queue_, 3*temp_size);
+
+  // Sets the kernel arguments
+  kernel1.SetArgument(0, static_cast<int>(n));
+  kernel1.SetArgument(1, x_buffer());
+  kernel1.SetArgument(2, static_cast<int>(x_offset));
+  kernel1.SetArgument(3, static_cast<int>(x_inc));
+  kernel1.SetArgument(4, y_buffer());
+  kernel1.SetArgument(5, static_cast<int>(y_offset));
+  kernel1.SetArgument(6, static_cast<int>(y_inc));
+  kernel1.SetArgument(7, temp_buffer());
+
+  // Launches the single-pass kernel, of which the last work-group also computes the final results
+  auto global1 = ThreadRange{db_["WGS1"]*temp_size};
+  auto local1 = ThreadRange{db_["WGS1"]};
+  if (single_pass) {
+    const auto counter = ReductionCounter(context_, queue_);
+    kernel1.SetArgument(8, results_buffer());
+    kernel1.SetArgument(9, static_cast<int>(results_offset));
+    kernel1.SetArgument(10, counter());
+    RunKernel(kernel1, queue_, device_, global1, local1, event_);
+    return;
+  }
+
+  // Otherwise, launches the main kernel followed by the epilogue kernel
+  auto kernel2 = GetKernel(program_, "Xdotnrm2asumEpilogue");
+  auto eventWaitList = std::vector<Event>();
+  auto kernelEvent = Event();
+  RunKernel(kernel1, queue_, device_, global1, local1, IntermediateEvent(queue_, kernelEvent));
+  eventWaitList.push_back(kernelEvent);
+
+  // Sets the arguments for the epilogue kernel
+  kernel2.SetArgument(0, temp_buffer());
+  kernel2.SetArgument(1, results_buffer());
+  kernel2.SetArgument(2, static_cast<int>(results_offset));
+
+  // Launches the epilogue kernel
+  auto global2 = ThreadRange{db_["WGS2"]};
+  auto local2 = ThreadRange{db_["WGS2"]};
+  RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xdotnrm2asum<half>;
+template class Xdotnrm2asum<float>;
+template class Xdotnrm2asum<double>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,42 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xdotnrm2asum routine: the fused version of the Xdot, Xnrm2 and Xasum
+// routines. The precision is implemented using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XDOTNRM2ASUM_H_
+#define CLBLAST_ROUTINES_XDOTNRM2ASUM_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xdotnrm2asum: public Routine {
+ public:
+
+  // Constructor
+  Xdotnrm2asum(Queue &queue, EventPointer event, const std::string &name = "DOTNRM2ASUM");
+
+  // Templated-precision implementation of the routine
+  void DoDotnrm2asum(const size_t n,
+                     const Buffer<T> &results_buffer, const size_t results_offset,
+                     const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                     const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XDOTNRM2ASUM_H_
+#endif
@@ -0,0 +1,50 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XdotStridedBatched routine. This is a non-blas strided-batched version
+// of DOT.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XDOTSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XDOTSTRIDEDBATCHED_H_
+
+#include "routines/level1/xdot.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XdotStridedBatched: public Xdot<T> {
+ public:
+
+  // Uses the regular Xdot routine
+  using Xdot<T>::DoDot;
+
+  // Constructor
+  XdotStridedBatched(Queue &queue, EventPointer event,
+                     const std::string &name = "DOTSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoDotStridedBatched(const size_t n,
+                           const Buffer<T> &dot_buffer, const size_t dot_offset,
+                           const size_t dot_stride,
+                           const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                           const size_t x_stride,
+                           const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                           const size_t y_stride,
+                           const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XDOTSTRIDEDBATCHED_H_
+#endif
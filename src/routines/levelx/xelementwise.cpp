@@ -0,0 +1,186 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xelementwise class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xelementwise.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T> constexpr size_t Xelementwise<T>::kMaxOperations;
+
+namespace {
+
+// The names of the operations in the kernel (see 'xhad.opencl'), in the order of 'ElementwiseOp'
+const std::vector<std::string> kOperationNames = {"MULTIPLY", "DIVIDE", "ADD", "SUBTRACT", "MAX",
+                                                  "MIN", "EXP", "LOG", "ABS", "CLAMP"};
+
+// Operations with the element of y as second operand
+bool IsBinaryOperation(const ElementwiseOp operation) {
+  return operation == ElementwiseOp::kMultiply || operation == ElementwiseOp::kDivide ||
+         operation == ElementwiseOp::kAdd || operation == ElementwiseOp::kSubtract ||
+         operation == ElementwiseOp::kMax || operation == ElementwiseOp::kMin;
+}
+
+} // anonymous namespace
+
+// Constructor: forwards to base class constructor. The program is only compiled when first used,
+// since most expressions need a specialised program.
+template <typename T>
+Xelementwise<T>::Xelementwise(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, {
+    KernelSource::kLevel1
+    }, {{
+    KernelSource::kXhad
+    }}) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xelementwise<T>::DoElementwise(const std::vector<ElementwiseOp> &operations, const size_t n,
+                                    const T alpha,
+                                    const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                                    const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                                    const T beta,
+                                    const Buffer<T> &z_buffer, const size_t z_offset, const size_t z_inc,
+                                    const T low, const T high) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the expression for validity: complex data-types only support the operations which are
+  // defined in the common kernel functions
+  if (operations.size() > kMaxOperations) { throw BLASError(StatusCode::kInvalidValue); }
+  const auto is_complex = PrecisionValue<T>() == Precision::kComplexSingle ||
+                          PrecisionValue<T>() == Precision::kComplexDouble;
+  auto uses_y = false;
+  for (const auto operation : operations) {
+    if (static_cast<size_t>(operation) >= kOperationNames.size()) {
+      throw BLASError(StatusCode::kInvalidValue);
+    }
+    if (is_complex && operation != ElementwiseOp::kMultiply && operation != ElementwiseOp::kAdd &&
+        operation != ElementwiseOp::kSubtract) {
+      throw BLASError(StatusCode::kNotImplemented);
+    }
+    if (IsBinaryOperation(operation)) { uses_y = true; }
+  }
+
+  // Tests the vectors for validity. Without any binary operations vector y is not used at all, the
+  // kernel receives vector x in its place.
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  if (uses_y) { TestVectorY(n, y_buffer, y_offset, y_inc); }
+  TestVectorY(n, z_buffer, z_offset, z_inc); // TODO: Make a TestVectorZ function with error codes
+  const auto &y_used_buffer = (uses_y) ? y_buffer : x_buffer;
+  const auto y_used_offset = (uses_y) ? y_offset : x_offset;
+  const auto y_used_inc = (uses_y) ? y_inc : x_inc;
+
+  // Determines whether or not the fast-version can be used
+  const auto use_faster_kernel = (x_offset == 0) && (x_inc == 1) &&
+                                 (y_used_offset == 0) && (y_used_inc == 1) &&
+                                 (z_offset == 0) && (z_inc == 1) &&
+                                 IsMultiple(n, db_["WPT"]*db_["VW"]);
+  const auto use_fastest_kernel = use_faster_kernel &&
+                                  IsMultiple(n, db_["WGS"]*db_["WPT"]*db_["VW"]);
+
+  // If possible, run the fast-version of the kernel
+  const auto kernel_name = (use_fastest_kernel) ? "XhadFastest" :
+                           (use_faster_kernel) ? "XhadFaster" : "Xhad";
+
+  // Retrieves the Xhad kernel from the compiled binary of this expression
+  const auto program = GetExpressionProgram(operations, uses_y);
+  auto kernel = GetKernel(program, kernel_name);
+
+  // Sets the kernel arguments
+  if (use_faster_kernel || use_fastest_kernel) {
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, GetRealArg(alpha));
+    kernel.SetArgument(2, GetRealArg(beta));
+    kernel.SetArgument(3, x_buffer());
+    kernel.SetArgument(4, y_used_buffer());
+    kernel.SetArgument(5, z_buffer());
+    kernel.SetArgument(6, GetRealArg(low));
+    kernel.SetArgument(7, GetRealArg(high));
+  }
+  else {
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, GetRealArg(alpha));
+    kernel.SetArgument(2, GetRealArg(beta));
+    kernel.SetArgument(3, x_buffer());
+    kernel.SetArgument(4, static_cast<int>(x_offset));
+    kernel.SetArgument(5, static_cast<int>(x_inc));
+    kernel.SetArgument(6, y_used_buffer());
+    kernel.SetArgument(7, static_cast<int>(y_used_offset));
+    kernel.SetArgument(8, static_cast<int>(y_used_inc));
+    kernel.SetArgument(9, z_buffer());
+    kernel.SetArgument(10, static_cast<int>(z_offset));
+    kernel.SetArgument(11, static_cast<int>(z_inc));
+    kernel.SetArgument(12, GetRealArg(low));
+    kernel.SetArgument(13, GetRealArg(high));
+  }
+
+  // Launches the kernel
+  if (use_fastest_kernel) {
+    auto global = ThreadRange{CeilDiv(n, db_["WPT"]*db_["VW"])};
+    auto local = ThreadRange{db_["WGS"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+  }
+  else if (use_faster_kernel) {
+    auto global = ThreadRange{Ceil(CeilDiv(n, db_["WPT"]*db_["VW"]), db_["WGS"])};
+    auto local = ThreadRange{db_["WGS"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+  }
+  else {
+    const auto n_ceiled = Ceil(n, db_["WGS"]*db_["WPT"]);
+    auto global = ThreadRange{n_ceiled/db_["WPT"]};
+    auto local = ThreadRange{db_["WGS"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+  }
+}
+
+// =================================================================================================
+
+// The expression is passed to the kernel as a list of operation defines. The program cache is keyed
+// by these defines, such that each expression is compiled only once per device and precision.
+template <typename T>
+Program Xelementwise<T>::GetExpressionProgram(const std::vector<ElementwiseOp> &operations,
+                                              const bool uses_y) {
+  if (operations.size() == 1 && operations[0] == ElementwiseOp::kMultiply) {
+    return GetProgram(0);
+  }
+  auto expression = std::string{""};
+  auto identifier = std::string{"_expression"};
+  for (const auto operation : operations) {
+    const auto &operation_name = kOperationNames[static_cast<size_t>(operation)];
+    expression += " ELEMENTWISE_" + operation_name;
+    identifier += "_" + operation_name;
+  }
+  const auto defines = "#define ELEMENTWISE_EXPRESSION" + expression + "\n"
+                       "#define ELEMENTWISE_USES_Y " + ToString(uses_y ? 1 : 0) + "\n";
+  return GetSpecialisedProgram(0, defines, identifier);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xelementwise<half>;
+template class Xelementwise<float>;
+template class Xelementwise<double>;
+template class Xelementwise<float2>;
+template class Xelementwise<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,57 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xelementwise routine: a generalisation of the Hadamard product to
+// z = alpha*f(x,y) + beta*z, in which f is an elementwise expression given as a list of operations.
+// The expression is compiled into the kernels of Xhad, such that it is evaluated in a single pass
+// over the vectors. The resulting programs are cached per expression.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XELEMENTWISE_H_
+#define CLBLAST_ROUTINES_XELEMENTWISE_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xelementwise: public Routine {
+ public:
+
+  // Constructor
+  Xelementwise(Queue &queue, EventPointer event, const std::string &name = "ELEMENTWISE");
+
+  // Templated-precision implementation of the routine
+  void DoElementwise(const std::vector<ElementwiseOp> &operations, const size_t n, const T alpha,
+                     const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                     const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                     const T beta,
+                     const Buffer<T> &z_buffer, const size_t z_offset, const size_t z_inc,
+                     const T low, const T high);
+
+  // The maximum number of operations of a single expression
+  static constexpr size_t kMaxOperations = 16;
+
+ private:
+
+  // Retrieves the program of the given expression: the regular program for the Hadamard product,
+  // otherwise a program specialised through defines, compiling it if needed
+  Program GetExpressionProgram(const std::vector<ElementwiseOp> &operations, const bool uses_y);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XELEMENTWISE_H_
+#endif
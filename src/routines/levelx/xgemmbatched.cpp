@@ -16,6 +16,7 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
 
 namespace clblast {
 // =================================================================================================
@@ -24,25 +25,24 @@ namespace clblast {
 template <typename T>
 XgemmBatched<T>::XgemmBatched(Queue &queue, EventPointer event, const std::string &name):
     Routine(queue, event, name,
-            {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect","GemmRoutine"},
+            {"Copy","Pad","Transpose","Padtranspose","XgemmBatched","XgemmDirectBatched","GemmRoutine"},
             PrecisionValue<T>(), {}, {
-    #include "../../kernels/level3/level3.opencl"
-    #include "../../kernels/level3/copy_fast.opencl"
-    #include "../../kernels/level3/copy_pad.opencl"
-    #include "../../kernels/level3/transpose_fast.opencl"
-    #include "../../kernels/level3/transpose_pad.opencl"
-    , // separated in multiple parts to prevent C1091 in MSVC 2013
-    #include "../../kernels/level3/xgemm_direct_part1.opencl"
-    #include "../../kernels/level3/xgemm_direct_part2.opencl"
-    #include "../../kernels/level3/xgemm_direct_part3.opencl"
-    , // separated in multiple parts to prevent C1091 in MSVC 2013
-    #include "../../kernels/level3/xgemm_part1.opencl"
-    #include "../../kernels/level3/xgemm_part2.opencl"
-    #include "../../kernels/level3/xgemm_part3.opencl"
-    #include "../../kernels/level3/xgemm_part4.opencl"
-    , // separated in multiple parts to prevent C1091 in MSVC 2013
-    #include "../../kernels/level3/xgemm_batched.opencl"
-    #include "../../kernels/level3/xgemm_direct_batched.opencl"
+    KernelSource::kLevel3,
+    KernelSource::kCopyFast,
+    KernelSource::kCopyPad,
+    KernelSource::kTransposeFast,
+    KernelSource::kTransposePad,
+    KernelSource::kXgemmEpilogue,
+    KernelSource::kXgemmDirectPart1,
+    KernelSource::kXgemmDirectPart2,
+    KernelSource::kXgemmDirectPart3,
+    KernelSource::kXgemmPart1,
+    KernelSource::kXgemmPart2,
+    KernelSource::kXgemmPart3,
+    KernelSource::kXgemmTensor,
+    KernelSource::kXgemmPart4,
+    KernelSource::kXgemmBatched,
+    KernelSource::kXgemmDirectBatched
     }) {
 }
 
@@ -59,6 +59,10 @@ void XgemmBatched<T>::DoGemmBatched(const Layout layout, const Transpose a_trans
                                     const Buffer<T> & c_buffer, const std::vector<size_t> &c_offsets, const size_t c_ld,
                                     const size_t batch_count) {
 
+  // Selects the kernel parameters for this problem size (if there are size-specific ones)
+  SelectSizeVariant(Xgemm<T>::GetProblemSize(m, n, k));
+  const auto &params = db_.GetFlatParameters();
+
   // Tests for a valid batch count
   if ((batch_count < 1) || (alphas.size() != batch_count) || (betas.size() != batch_count) ||
       (a_offsets.size() != batch_count) || (b_offsets.size() != batch_count) || (c_offsets.size() != batch_count)) {
@@ -66,8 +70,8 @@ void XgemmBatched<T>::DoGemmBatched(const Layout layout, const Transpose a_trans
   }
 
   // Two methods to choose from, select which one to run
-  const auto do_gemm_direct = Xgemm<T>::UseDirectKernel(m, n, k, db_["XGEMM_MIN_INDIRECT_SIZE"]);
-  const auto gemm_kernel_id = (do_gemm_direct) ? 0 : db_["GEMMK"];
+  const auto do_gemm_direct = Xgemm<T>::UseDirectKernel(m, n, k, params.gemm_routine.min_indirect_size);
+  const auto gemm_kernel_id = (do_gemm_direct) ? 0 : params.xgemm.gemmk;
 
   // Computes the transpose/conjugate options and sets the a/b/c sizes based on that
   bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
@@ -84,9 +88,18 @@ void XgemmBatched<T>::DoGemmBatched(const Layout layout, const Transpose a_trans
     TestMatrixC(c_one, c_two, c_buffer, c_offsets[batch], c_ld);
   }
 
+  // Nothing is computed in case all alphas are zero and all betas are one: C = 1 * C
+  const auto is_zero = [](const T value) { return value == ConstantZero<T>(); };
+  const auto is_one = [](const T value) { return value == ConstantOne<T>(); };
+  if (std::all_of(alphas.begin(), alphas.end(), is_zero) &&
+      std::all_of(betas.begin(), betas.end(), is_one)) {
+    SignalEvent(queue_, event_, input_events_);
+    return;
+  }
+
   // Upload the scalar arguments to the device
-  auto alphas_device = Buffer<T>(context_, BufferAccess::kReadWrite, batch_count);
-  auto betas_device = Buffer<T>(context_, BufferAccess::kReadWrite, batch_count);
+  auto alphas_device = TemporaryBuffer<T>(context_, queue_, batch_count);
+  auto betas_device = TemporaryBuffer<T>(context_, queue_, batch_count);
   alphas_device.Write(queue_, batch_count, alphas);
   betas_device.Write(queue_, batch_count, betas);
 
@@ -102,9 +115,15 @@ void XgemmBatched<T>::DoGemmBatched(const Layout layout, const Transpose a_trans
 
   // Selects which version of the batched GEMM to run
   if (do_gemm_direct) { // single generic kernel
+    auto a_offsets_device = TemporaryBuffer<int>(context_, queue_, batch_count);
+    auto b_offsets_device = TemporaryBuffer<int>(context_, queue_, batch_count);
+    auto c_offsets_device = TemporaryBuffer<int>(context_, queue_, batch_count);
+    a_offsets_device.Write(queue_, batch_count, a_offsets_int);
+    b_offsets_device.Write(queue_, batch_count, b_offsets_int);
+    c_offsets_device.Write(queue_, batch_count, c_offsets_int);
     BatchedGemmDirect(m, n, k, alphas_device,
-                      a_buffer, a_offsets_int, a_ld, b_buffer, b_offsets_int, b_ld,
-                      betas_device, c_buffer, c_offsets_int, c_ld,
+                      a_buffer, a_offsets_device, a_ld, b_buffer, b_offsets_device, b_ld,
+                      betas_device, c_buffer, c_offsets_device, c_ld,
                       a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
                       batch_count);
   }
@@ -117,6 +136,87 @@ void XgemmBatched<T>::DoGemmBatched(const Layout layout, const Transpose a_trans
   }
 }
 
+// =================================================================================================
+
+// The main routine for device-resident scalars and offsets
+template <typename T>
+void XgemmBatched<T>::DoGemmBatchedDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const Buffer<T> &alphas,
+                                          const Buffer<T> & a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                                          const Buffer<T> & b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
+                                          const Buffer<T> &betas,
+                                          const Buffer<T> & c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
+                                          const size_t batch_count) {
+
+  // Selects the kernel parameters for this problem size (if there are size-specific ones)
+  SelectSizeVariant(Xgemm<T>::GetProblemSize(m, n, k));
+  bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+  ProcessDeviceArguments(layout, a_transpose, b_transpose, m, n, k,
+                         a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, c_buffer, c_offsets, c_ld,
+                         batch_count, a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate);
+  TestBatchArray(batch_count, alphas);
+  TestBatchArray(batch_count, betas);
+  BatchedGemmDirect(m, n, k, alphas,
+                    a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld,
+                    betas, c_buffer, c_offsets, c_ld,
+                    a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                    batch_count);
+}
+
+// As above, but with a single alpha and beta for all batches
+template <typename T>
+void XgemmBatched<T>::DoGemmBatchedDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const T alpha,
+                                          const Buffer<T> & a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                                          const Buffer<T> & b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
+                                          const T beta,
+                                          const Buffer<T> & c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
+                                          const size_t batch_count) {
+
+  // Selects the kernel parameters for this problem size (if there are size-specific ones)
+  SelectSizeVariant(Xgemm<T>::GetProblemSize(m, n, k));
+  bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+  ProcessDeviceArguments(layout, a_transpose, b_transpose, m, n, k,
+                         a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, c_buffer, c_offsets, c_ld,
+                         batch_count, a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate);
+
+  // Retrieves the proper XgemmDirect kernel from the compiled binary
+  const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectBatchedUniformTT" : "XgemmDirectBatchedUniformTN") :
+                                       (b_do_transpose ? "XgemmDirectBatchedUniformNT" : "XgemmDirectBatchedUniformNN");
+  auto kernel = GetKernel(program_, name);
+  kernel.SetArgument(3, GetRealArg(alpha));
+  kernel.SetArgument(4, GetRealArg(beta));
+  RunBatchedGemmDirect(kernel, m, n, k, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld,
+                       c_buffer, c_offsets, c_ld, c_do_transpose, a_conjugate, b_conjugate, batch_count);
+}
+
+// Tests the arguments and computes the transpose/conjugate options for the direct kernel
+template <typename T>
+void XgemmBatched<T>::ProcessDeviceArguments(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const Buffer<T> & a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                                             const Buffer<T> & b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
+                                             const Buffer<T> & c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
+                                             const size_t batch_count,
+                                             bool& a_do_transpose, bool& b_do_transpose, bool& c_do_transpose,
+                                             bool& a_conjugate, bool& b_conjugate) {
+  if (batch_count < 1) { throw BLASError(StatusCode::kInvalidBatchCount); }
+  TestBatchArray(batch_count, a_offsets);
+  TestBatchArray(batch_count, b_offsets);
+  TestBatchArray(batch_count, c_offsets);
+
+  size_t a_one, a_two, b_one, b_two, c_one, c_two;
+  Xgemm<T>::ProcessArguments(layout, a_transpose, b_transpose, m, n, k,
+                             a_one, a_two, b_one, b_two, c_one, c_two,
+                             a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                             0);
+  TestMatrixA(a_one, a_two, a_buffer, 0, a_ld);
+  TestMatrixB(b_one, b_two, b_buffer, 0, b_ld);
+  TestMatrixC(c_one, c_two, c_buffer, 0, c_ld);
+}
+
 
 // =================================================================================================
 
@@ -136,17 +236,18 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
                                           const size_t b_one, const size_t b_two,
                                           const size_t c_one, const size_t c_two,
                                           const size_t batch_count) {
+  const auto &params = db_.GetFlatParameters();
   // Calculates the ceiled versions of m, n, and k
-  const auto m_ceiled = Ceil(Ceil(m, db_["MWG"]), db_["VWM"]);
-  const auto n_ceiled = Ceil(Ceil(n, db_["NWG"]), db_["VWN"]);
-  const auto k_ceiled = Ceil(Ceil(k, db_["KWG"]), db_["VWM"]);
+  const auto m_ceiled = Ceil(Ceil(m, params.xgemm.mwg), params.xgemm.vwm);
+  const auto n_ceiled = Ceil(Ceil(n, params.xgemm.nwg), params.xgemm.vwn);
+  const auto k_ceiled = Ceil(Ceil(k, params.xgemm.kwg), params.xgemm.vwm);
 
   // Computes the first and second "internal" (ceiled) dimensions of the 3 matrices taking into account
   // whether the matrices need to be rotated or not for the kernel.
   size_t a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i;
-  Xgemm<T>::CalculateInternalDimensions(m, n, k, db_["MWG"], db_["NWG"], db_["KWG"],
+  Xgemm<T>::CalculateInternalDimensions(m, n, k, params.xgemm.mwg, params.xgemm.nwg, params.xgemm.kwg,
                                         a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i,
-                                        db_["GEMMK"]);
+                                        params.xgemm.gemmk);
 
   // Sets the "internal" offsets, i.e. the perfect offsets
   auto a_offsets_i = std::vector<int>(batch_count);
@@ -167,24 +268,25 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
                    !c_do_transpose;
 
   // Creates the temporary matrices
-  const auto a_temp = (a_no_temp) ? a_buffer : Buffer<T>(context_, batch_count * a_one_i * a_two_i);
-  const auto b_temp = (b_no_temp) ? b_buffer : Buffer<T>(context_, batch_count * b_one_i * b_two_i);
-  const auto c_temp = (c_no_temp) ? c_buffer : Buffer<T>(context_, batch_count * c_one_i * c_two_i);
+  const auto a_temp = (a_no_temp) ? a_buffer : TemporaryBuffer<T>(context_, queue_, batch_count * a_one_i * a_two_i);
+  const auto b_temp = (b_no_temp) ? b_buffer : TemporaryBuffer<T>(context_, queue_, batch_count * b_one_i * b_two_i);
+  const auto c_temp = (c_no_temp) ? c_buffer : TemporaryBuffer<T>(context_, queue_, batch_count * c_one_i * c_two_i);
 
   // Events of all kernels (including pre/post processing kernels)
   auto eventWaitList = std::vector<Event>();
-  auto emptyEventList = std::vector<Event>();
+  const auto &inputEventList = input_events_; // see 'BeginCommandChain'
 
   // Runs the pre-processing kernel for matrix A. This transposes the matrix, but also pads zeros
   // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
   // case nothing has to be done, these kernels can be skipped.
   if (!a_no_temp) {
-    auto a_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
-    auto a_offsets_i_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+    auto a_offsets_device = TemporaryBuffer<int>(context_, queue_, batch_count);
+    auto a_offsets_i_device = TemporaryBuffer<int>(context_, queue_, batch_count);
     a_offsets_device.Write(queue_, batch_count, a_offsets);
     a_offsets_i_device.Write(queue_, batch_count, a_offsets_i);
     auto eventProcessA = Event();
-    PadCopyTransposeMatrixBatched(queue_, device_, db_, eventProcessA.pointer(), emptyEventList,
+    PadCopyTransposeMatrixBatched(queue_, device_, db_,
+                                  IntermediateEvent(queue_, eventProcessA), inputEventList,
                                   a_one, a_two, a_ld, a_offsets_device, a_buffer,
                                   a_one_i, a_two_i, a_one_i, a_offsets_i_device, a_temp,
                                   program_, true, a_do_transpose, a_conjugate, batch_count);
@@ -193,12 +295,13 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
 
   // As above, but now for matrix B
   if (!b_no_temp) {
-    auto b_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
-    auto b_offsets_i_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+    auto b_offsets_device = TemporaryBuffer<int>(context_, queue_, batch_count);
+    auto b_offsets_i_device = TemporaryBuffer<int>(context_, queue_, batch_count);
     b_offsets_device.Write(queue_, batch_count, b_offsets);
     b_offsets_i_device.Write(queue_, batch_count, b_offsets_i);
     auto eventProcessB = Event();
-    PadCopyTransposeMatrixBatched(queue_, device_, db_, eventProcessB.pointer(), emptyEventList,
+    PadCopyTransposeMatrixBatched(queue_, device_, db_,
+                                  IntermediateEvent(queue_, eventProcessB), inputEventList,
                                   b_one, b_two, b_ld, b_offsets_device, b_buffer,
                                   b_one_i, b_two_i, b_one_i, b_offsets_i_device, b_temp,
                                   program_, true, b_do_transpose, b_conjugate, batch_count);
@@ -206,13 +309,14 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
   }
 
   // As above, but now for matrix C
-  auto c_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
-  auto c_offsets_i_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  auto c_offsets_device = TemporaryBuffer<int>(context_, queue_, batch_count);
+  auto c_offsets_i_device = TemporaryBuffer<int>(context_, queue_, batch_count);
   if (!c_no_temp) {
     c_offsets_device.Write(queue_, batch_count, c_offsets);
     c_offsets_i_device.Write(queue_, batch_count, c_offsets_i);
     auto eventProcessC = Event();
-    PadCopyTransposeMatrixBatched(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
+    PadCopyTransposeMatrixBatched(queue_, device_, db_,
+                                  IntermediateEvent(queue_, eventProcessC), inputEventList,
                                   c_one, c_two, c_ld, c_offsets_device, c_buffer,
                                   c_one_i, c_two_i, c_one_i, c_offsets_i_device, c_temp,
                                   program_, true, c_do_transpose, false, batch_count);
@@ -220,7 +324,7 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
   }
 
   // Retrieves the Xgemm kernel from the compiled binary
-  auto kernel = Kernel(program_, "XgemmBatched");
+  auto kernel = GetKernel(program_, "XgemmBatched");
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(m_ceiled));
@@ -239,16 +343,16 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
   kernel.SetArgument(13, static_cast<int>(c_two_i));
 
   // Computes the global and local thread sizes
-  const auto global = std::vector<size_t>{
-    (c_one_i * db_["MDIMC"]) / db_["MWG"],
-    (c_two_i * db_["NDIMC"]) / db_["NWG"],
+  const auto global = ThreadRange{
+    (c_one_i * params.xgemm.mdimc) / params.xgemm.mwg,
+    (c_two_i * params.xgemm.ndimc) / params.xgemm.nwg,
     batch_count
   };
-  const auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"], 1};
+  const auto local = ThreadRange{params.xgemm.mdimc, params.xgemm.ndimc, 1};
 
   // Launches the kernel
   auto eventKernel = Event();
-  auto eventPointer = (!c_no_temp) ? eventKernel.pointer() : event_;
+  auto eventPointer = (!c_no_temp) ? IntermediateEvent(queue_, eventKernel) : event_;
   RunKernel(kernel, queue_, device_, global, local, eventPointer, eventWaitList);
 
   // Runs the post-processing kernel if needed
@@ -267,55 +371,60 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
 template <typename T>
 void XgemmBatched<T>::BatchedGemmDirect(const size_t m, const size_t n, const size_t k,
                                         const Buffer<T> &alphas,
-                                        const Buffer<T> &a_buffer, const std::vector<int> &a_offsets, const size_t a_ld,
-                                        const Buffer<T> &b_buffer, const std::vector<int> &b_offsets, const size_t b_ld,
+                                        const Buffer<T> &a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                                        const Buffer<T> &b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
                                         const Buffer<T> &betas,
-                                        const Buffer<T> &c_buffer, const std::vector<int> &c_offsets, const size_t c_ld,
+                                        const Buffer<T> &c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
                                         const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                                         const bool a_conjugate, const bool b_conjugate,
                                         const size_t batch_count) {
 
-  // Uploads the offsets to the device
-  auto a_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
-  auto b_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
-  auto c_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
-  a_offsets_device.Write(queue_, batch_count, a_offsets);
-  b_offsets_device.Write(queue_, batch_count, b_offsets);
-  c_offsets_device.Write(queue_, batch_count, c_offsets);
-
   // Retrieves the proper XgemmDirect kernel from the compiled binary
   const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectBatchedTT" : "XgemmDirectBatchedTN") :
                                        (b_do_transpose ? "XgemmDirectBatchedNT" : "XgemmDirectBatchedNN");
-  auto kernel = Kernel(program_, name);
+  auto kernel = GetKernel(program_, name);
+  kernel.SetArgument(3, alphas());
+  kernel.SetArgument(4, betas());
+  RunBatchedGemmDirect(kernel, m, n, k, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld,
+                       c_buffer, c_offsets, c_ld, c_do_transpose, a_conjugate, b_conjugate, batch_count);
+}
+
+// Sets the remaining kernel arguments and launches the direct kernel
+template <typename T>
+void XgemmBatched<T>::RunBatchedGemmDirect(Kernel &kernel, const size_t m, const size_t n, const size_t k,
+                                           const Buffer<T> &a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                                           const Buffer<T> &b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
+                                           const Buffer<T> &c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
+                                           const bool c_do_transpose, const bool a_conjugate, const bool b_conjugate,
+                                           const size_t batch_count) {
+  const auto &params = db_.GetFlatParameters();
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(m));
   kernel.SetArgument(1, static_cast<int>(n));
   kernel.SetArgument(2, static_cast<int>(k));
-  kernel.SetArgument(3, alphas());
-  kernel.SetArgument(4, betas());
   kernel.SetArgument(5, a_buffer());
-  kernel.SetArgument(6, a_offsets_device());
+  kernel.SetArgument(6, a_offsets());
   kernel.SetArgument(7, static_cast<int>(a_ld));
   kernel.SetArgument(8, b_buffer());
-  kernel.SetArgument(9, b_offsets_device());
+  kernel.SetArgument(9, b_offsets());
   kernel.SetArgument(10, static_cast<int>(b_ld));
   kernel.SetArgument(11, c_buffer());
-  kernel.SetArgument(12, c_offsets_device());
+  kernel.SetArgument(12, c_offsets());
   kernel.SetArgument(13, static_cast<int>(c_ld));
   kernel.SetArgument(14, static_cast<int>(c_do_transpose));
   kernel.SetArgument(15, static_cast<int>(a_conjugate));
   kernel.SetArgument(16, static_cast<int>(b_conjugate));
 
   // Computes the global and local thread sizes
-  const auto m_ceiled = Ceil(m, db_["WGD"]);
-  const auto n_ceiled = Ceil(n, db_["WGD"]);
-  const auto global = std::vector<size_t>{
-    (m_ceiled * db_["MDIMCD"]) / db_["WGD"],
-    (n_ceiled * db_["NDIMCD"]) / db_["WGD"],
+  const auto m_ceiled = Ceil(m, params.xgemm_direct.wgd);
+  const auto n_ceiled = Ceil(n, params.xgemm_direct.wgd);
+  const auto global = ThreadRange{
+    (m_ceiled * params.xgemm_direct.mdimcd) / params.xgemm_direct.wgd,
+    (n_ceiled * params.xgemm_direct.ndimcd) / params.xgemm_direct.wgd,
     batch_count
   };
-  const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"], 1};
+  const auto local = ThreadRange{params.xgemm_direct.mdimcd, params.xgemm_direct.ndimcd, 1};
 
   // Launches the kernel
   RunKernel(kernel, queue_, device_, global, local, event_);
@@ -39,6 +39,27 @@ class XgemmBatched: public Routine {
                      const Buffer<T> & c_buffer, const std::vector<size_t> &c_offsets, const size_t c_ld,
                      const size_t batch_count);
 
+  // As above, but with the scalars and offsets (integers) already resident on the device. This
+  // always uses the direct kernel, such that no host-device transfers are required.
+  void DoGemmBatchedDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                           const size_t m, const size_t n, const size_t k,
+                           const Buffer<T> &alphas,
+                           const Buffer<T> & a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                           const Buffer<T> & b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
+                           const Buffer<T> &betas,
+                           const Buffer<T> & c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
+                           const size_t batch_count);
+
+  // As above, but with a single alpha and beta for all batches, passed as kernel arguments
+  void DoGemmBatchedDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                           const size_t m, const size_t n, const size_t k,
+                           const T alpha,
+                           const Buffer<T> & a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                           const Buffer<T> & b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
+                           const T beta,
+                           const Buffer<T> & c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
+                           const size_t batch_count);
+
   // Indirect version of batched GEMM (with pre and post-processing kernels)
   void BatchedGemmIndirect(const size_t m, const size_t n, const size_t k,
                            const Buffer<T> &alphas,
@@ -56,13 +77,34 @@ class XgemmBatched: public Routine {
   // Direct version of batched GEMM (no pre and post-processing kernels)
   void BatchedGemmDirect(const size_t m, const size_t n, const size_t k,
                          const Buffer<T> &alphas,
-                         const Buffer<T> &a_buffer, const std::vector<int> &a_offsets, const size_t a_ld,
-                         const Buffer<T> &b_buffer, const std::vector<int> &b_offsets, const size_t b_ld,
+                         const Buffer<T> &a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                         const Buffer<T> &b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
                          const Buffer<T> &betas,
-                         const Buffer<T> &c_buffer, const std::vector<int> &c_offsets, const size_t c_ld,
+                         const Buffer<T> &c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
                          const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                          const bool a_conjugate, const bool b_conjugate,
                          const size_t batch_count);
+
+ private:
+
+  // Processes and tests the arguments of the device-resident versions of the routine. The offsets
+  // are on the device, so the matrices are only tested for an offset of zero.
+  void ProcessDeviceArguments(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t m, const size_t n, const size_t k,
+                              const Buffer<T> & a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                              const Buffer<T> & b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
+                              const Buffer<T> & c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
+                              const size_t batch_count,
+                              bool& a_do_transpose, bool& b_do_transpose, bool& c_do_transpose,
+                              bool& a_conjugate, bool& b_conjugate);
+
+  // Sets all but the scalar arguments (3 and 4) of a direct kernel and launches it
+  void RunBatchedGemmDirect(Kernel &kernel, const size_t m, const size_t n, const size_t k,
+                            const Buffer<T> &a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                            const Buffer<T> &b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
+                            const Buffer<T> &c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
+                            const bool c_do_transpose, const bool a_conjugate, const bool b_conjugate,
+                            const size_t batch_count);
 };
 
 // =================================================================================================
@@ -0,0 +1,140 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmGrouped class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmgrouped.hpp"
+#include "routines/level3/xgemm.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T> constexpr size_t XgemmGrouped<T>::kProblemSize;
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemmGrouped<T>::XgemmGrouped(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"XgemmDirect"}, PrecisionValue<T>(), {}, {
+    KernelSource::kLevel3,
+    KernelSource::kXgemmEpilogue,
+    KernelSource::kXgemmDirectPart1,
+    KernelSource::kXgemmDirectPart2,
+    KernelSource::kXgemmDirectPart3,
+    KernelSource::kXgemmDirectBatched
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemmGrouped<T>::DoGemmGrouped(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                    const std::vector<size_t> &ms, const std::vector<size_t> &ns,
+                                    const std::vector<size_t> &ks,
+                                    const std::vector<T> &alphas,
+                                    const Buffer<T> & a_buffer, const std::vector<size_t> &a_offsets,
+                                    const std::vector<size_t> &a_lds,
+                                    const Buffer<T> & b_buffer, const std::vector<size_t> &b_offsets,
+                                    const std::vector<size_t> &b_lds,
+                                    const std::vector<T> &betas,
+                                    const Buffer<T> & c_buffer, const std::vector<size_t> &c_offsets,
+                                    const std::vector<size_t> &c_lds,
+                                    const size_t batch_count) {
+  const auto &params = db_.GetFlatParameters();
+
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (ms.size() != batch_count) || (ns.size() != batch_count) ||
+      (ks.size() != batch_count) || (alphas.size() != batch_count) || (betas.size() != batch_count) ||
+      (a_offsets.size() != batch_count) || (b_offsets.size() != batch_count) || (c_offsets.size() != batch_count) ||
+      (a_lds.size() != batch_count) || (b_lds.size() != batch_count) || (c_lds.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Computes the transpose/conjugate options, tests the matrices for validity, and builds the
+  // table of problems for the device. The transpose options are the same for all entries.
+  bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+  auto problems = std::vector<int>(batch_count * kProblemSize);
+  auto m_max = size_t{0};
+  auto n_max = size_t{0};
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    size_t a_one, a_two, b_one, b_two, c_one, c_two;
+    Xgemm<T>::ProcessArguments(layout, a_transpose, b_transpose, ms[batch], ns[batch], ks[batch],
+                               a_one, a_two, b_one, b_two, c_one, c_two,
+                               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                               0);
+    TestMatrixA(a_one, a_two, a_buffer, a_offsets[batch], a_lds[batch]);
+    TestMatrixB(b_one, b_two, b_buffer, b_offsets[batch], b_lds[batch]);
+    TestMatrixC(c_one, c_two, c_buffer, c_offsets[batch], c_lds[batch]);
+    const auto problem = std::vector<size_t>{ms[batch], ns[batch], ks[batch],
+                                             a_offsets[batch], a_lds[batch],
+                                             b_offsets[batch], b_lds[batch],
+                                             c_offsets[batch], c_lds[batch]};
+    for (auto i = size_t{0}; i < kProblemSize; ++i) {
+      problems[batch * kProblemSize + i] = static_cast<int>(problem[i]);
+    }
+    m_max = std::max(m_max, ms[batch]);
+    n_max = std::max(n_max, ns[batch]);
+  }
+
+  // Uploads the scalar arguments and the problem table to the device
+  auto alphas_device = TemporaryBuffer<T>(context_, queue_, batch_count);
+  auto betas_device = TemporaryBuffer<T>(context_, queue_, batch_count);
+  auto problems_device = TemporaryBuffer<int>(context_, queue_, problems.size());
+  alphas_device.Write(queue_, batch_count, alphas);
+  betas_device.Write(queue_, batch_count, betas);
+  problems_device.Write(queue_, problems.size(), problems);
+
+  // Retrieves the proper XgemmDirect kernel from the compiled binary
+  const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectGroupedTT" : "XgemmDirectGroupedTN") :
+                                       (b_do_transpose ? "XgemmDirectGroupedNT" : "XgemmDirectGroupedNN");
+  auto kernel = GetKernel(program_, name);
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, problems_device());
+  kernel.SetArgument(1, alphas_device());
+  kernel.SetArgument(2, betas_device());
+  kernel.SetArgument(3, a_buffer());
+  kernel.SetArgument(4, b_buffer());
+  kernel.SetArgument(5, c_buffer());
+  kernel.SetArgument(6, static_cast<int>(c_do_transpose));
+  kernel.SetArgument(7, static_cast<int>(a_conjugate));
+  kernel.SetArgument(8, static_cast<int>(b_conjugate));
+
+  // Computes the global and local thread sizes: the first two dimensions cover the largest entry,
+  // work-groups beyond the size of a smaller entry exit straight away
+  const auto m_ceiled = Ceil(m_max, params.xgemm_direct.wgd);
+  const auto n_ceiled = Ceil(n_max, params.xgemm_direct.wgd);
+  const auto global = ThreadRange{
+    (m_ceiled * params.xgemm_direct.mdimcd) / params.xgemm_direct.wgd,
+    (n_ceiled * params.xgemm_direct.ndimcd) / params.xgemm_direct.wgd,
+    batch_count
+  };
+  const auto local = ThreadRange{params.xgemm_direct.mdimcd, params.xgemm_direct.ndimcd, 1};
+
+  // Launches the kernel
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmGrouped<half>;
+template class XgemmGrouped<float>;
+template class XgemmGrouped<double>;
+template class XgemmGrouped<float2>;
+template class XgemmGrouped<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,125 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmInt8 class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmint8.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor, always using the integer precision
+XgemmInt8::XgemmInt8(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xgemm"}, Precision::kInt8, {}, {
+    KernelSource::kXgemmInt8
+    }) {
+}
+
+// =================================================================================================
+
+// The main routines
+void XgemmInt8::DoGemmInt8(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                           size_t m, size_t n, const size_t k,
+                           const int alpha,
+                           const Buffer<int8> &a_buffer, const size_t a_offset, const size_t a_ld,
+                           const Buffer<int8> &b_buffer, const size_t b_offset, const size_t b_ld,
+                           const int beta,
+                           const Buffer<int> &c_buffer, const size_t c_offset, const size_t c_ld) {
+  auto kernel = GetKernel(program_, "XgemmInt8");
+  SetMatrixArguments(kernel, layout, a_transpose, b_transpose, m, n, k,
+                     a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+                     c_buffer, c_offset, c_ld);
+  kernel.SetArgument(14, alpha);
+  kernel.SetArgument(15, beta);
+  RunGemmKernel(kernel, m, n);
+}
+
+void XgemmInt8::DoGemmInt8Requantized(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                      size_t m, size_t n, const size_t k,
+                                      const Buffer<int8> &a_buffer, const size_t a_offset, const size_t a_ld,
+                                      const Buffer<int8> &b_buffer, const size_t b_offset, const size_t b_ld,
+                                      const Buffer<float> &scales_buffer, const size_t scales_offset,
+                                      const Buffer<int8> &c_buffer, const size_t c_offset, const size_t c_ld) {
+  auto kernel = GetKernel(program_, "XgemmInt8Requantized");
+  TestVectorX(n, scales_buffer, scales_offset, 1);
+  SetMatrixArguments(kernel, layout, a_transpose, b_transpose, m, n, k,
+                     a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+                     c_buffer, c_offset, c_ld);
+
+  // The columns of a row-major C are the rows of the column-major problem
+  kernel.SetArgument(14, scales_buffer());
+  kernel.SetArgument(15, static_cast<int>(scales_offset));
+  kernel.SetArgument(16, static_cast<int>(layout == Layout::kRowMajor));
+  RunGemmKernel(kernel, m, n);
+}
+
+// =================================================================================================
+
+// Tests the matrices for validity and sets the kernel arguments of A, B and C
+template <typename T>
+void XgemmInt8::SetMatrixArguments(Kernel &kernel, const Layout layout,
+                                   const Transpose a_transpose, const Transpose b_transpose,
+                                   size_t &m, size_t &n, const size_t k,
+                                   const Buffer<int8> &a_buffer, const size_t a_offset, const size_t a_ld,
+                                   const Buffer<int8> &b_buffer, const size_t b_offset, const size_t b_ld,
+                                   const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0) || (k == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrices for validity, as in the regular GEMM routine. There is no conjugate for
+  // integers, so it is treated as a regular transpose.
+  const auto is_row_major = (layout == Layout::kRowMajor);
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto b_transposed = (b_transpose != Transpose::kNo);
+  const auto a_rotated = (is_row_major != a_transposed);
+  const auto b_rotated = (is_row_major != b_transposed);
+  TestMatrixA((a_rotated) ? k : m, (a_rotated) ? m : k, a_buffer, a_offset, a_ld);
+  TestMatrixB((b_rotated) ? n : k, (b_rotated) ? k : n, b_buffer, b_offset, b_ld);
+  TestMatrixC((is_row_major) ? n : m, (is_row_major) ? m : n, c_buffer, c_offset, c_ld);
+
+  // Converts a row-major problem into a column-major one: C^T = B^T * A^T
+  if (is_row_major) { std::swap(m, n); }
+  const auto &first_buffer = (is_row_major) ? b_buffer : a_buffer;
+  const auto &second_buffer = (is_row_major) ? a_buffer : b_buffer;
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  kernel.SetArgument(3, first_buffer());
+  kernel.SetArgument(4, static_cast<int>((is_row_major) ? b_offset : a_offset));
+  kernel.SetArgument(5, static_cast<int>((is_row_major) ? b_ld : a_ld));
+  kernel.SetArgument(6, static_cast<int>((is_row_major) ? b_transposed : a_transposed));
+  kernel.SetArgument(7, second_buffer());
+  kernel.SetArgument(8, static_cast<int>((is_row_major) ? a_offset : b_offset));
+  kernel.SetArgument(9, static_cast<int>((is_row_major) ? a_ld : b_ld));
+  kernel.SetArgument(10, static_cast<int>((is_row_major) ? a_transposed : b_transposed));
+  kernel.SetArgument(11, c_buffer());
+  kernel.SetArgument(12, static_cast<int>(c_offset));
+  kernel.SetArgument(13, static_cast<int>(c_ld));
+}
+
+// Launches the kernel with a work-group per MWG by NWG tile of C (no padding required)
+void XgemmInt8::RunGemmKernel(Kernel &kernel, const size_t m, const size_t n) {
+  const auto global = ThreadRange{
+    CeilDiv(m, db_["MWG"]) * db_["MDIMC"],
+    CeilDiv(n, db_["NWG"]) * db_["NDIMC"]
+  };
+  const auto local = ThreadRange{db_["MDIMC"], db_["NDIMC"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,70 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmInt8 routine: matrix-multiplication of 8-bit signed integers with
+// 32-bit integer accumulation for quantised data. Contrary to most routines, this is not templated:
+// it is always compiled for the integer precision and it uses the 'Xgemm' tuning parameters.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMINT8_H_
+#define CLBLAST_ROUTINES_XGEMMINT8_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+class XgemmInt8: public Routine {
+ public:
+
+  // Constructor
+  XgemmInt8(Queue &queue, EventPointer event, const std::string &name = "GEMMINT8");
+
+  // Integer GEMM with 32-bit results: C = alpha * A * B + beta * C
+  void DoGemmInt8(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                  size_t m, size_t n, const size_t k,
+                  const int alpha,
+                  const Buffer<int8> &a_buffer, const size_t a_offset, const size_t a_ld,
+                  const Buffer<int8> &b_buffer, const size_t b_offset, const size_t b_ld,
+                  const int beta,
+                  const Buffer<int> &c_buffer, const size_t c_offset, const size_t c_ld);
+
+  // Integer GEMM with 8-bit results: each 32-bit result in column 'j' of C is multiplied by the
+  // single-precision value 'scales[j]', rounded to nearest-even and saturated to 8 bits
+  void DoGemmInt8Requantized(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                             size_t m, size_t n, const size_t k,
+                             const Buffer<int8> &a_buffer, const size_t a_offset, const size_t a_ld,
+                             const Buffer<int8> &b_buffer, const size_t b_offset, const size_t b_ld,
+                             const Buffer<float> &scales_buffer, const size_t scales_offset,
+                             const Buffer<int8> &c_buffer, const size_t c_offset, const size_t c_ld);
+
+ private:
+
+  // Tests the matrices for validity and sets the kernel arguments up to and including C. A
+  // row-major problem is converted into a column-major one (C^T = B^T * A^T) by swapping the roles
+  // of A and B as well as the values of 'm' and 'n'.
+  template <typename T>
+  void SetMatrixArguments(Kernel &kernel, const Layout layout,
+                          const Transpose a_transpose, const Transpose b_transpose,
+                          size_t &m, size_t &n, const size_t k,
+                          const Buffer<int8> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const Buffer<int8> &b_buffer, const size_t b_offset, const size_t b_ld,
+                          const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+
+  // Launches the kernel for a column-major m by n result
+  void RunGemmKernel(Kernel &kernel, const size_t m, const size_t n);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMINT8_H_
+#endif
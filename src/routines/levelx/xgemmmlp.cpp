@@ -0,0 +1,141 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmMlp class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmmlp.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T> constexpr size_t XgemmMlp<T>::kTileRows;
+template <typename T> constexpr size_t XgemmMlp<T>::kThreads;
+template <typename T> constexpr size_t XgemmMlp<T>::kMaxFusedN;
+template <typename T> constexpr size_t XgemmMlp<T>::kLocalMemory;
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemmMlp<T>::XgemmMlp(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {}, PrecisionValue<T>(), {}, {
+    KernelSource::kXgemmEpilogue,
+    KernelSource::kXgemmMlp
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemmMlp<T>::DoGemmMlp(const Layout layout,
+                            const size_t m, const size_t n, const size_t k, const size_t p,
+                            const T alpha,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                            const GemmEpilogue<T> &epilogue,
+                            const Buffer<T> &e_buffer, const size_t e_offset, const size_t e_ld,
+                            const T beta,
+                            const Buffer<T> &d_buffer, const size_t d_offset, const size_t d_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0 || k == 0 || p == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrices for validity: matrix E is reported as B and matrix D as C
+  const auto is_row_major = (layout == Layout::kRowMajor);
+  TestMatrixA((is_row_major) ? k : m, (is_row_major) ? m : k, a_buffer, a_offset, a_ld);
+  TestMatrixB((is_row_major) ? n : k, (is_row_major) ? k : n, b_buffer, b_offset, b_ld);
+  TestMatrixB((is_row_major) ? p : n, (is_row_major) ? n : p, e_buffer, e_offset, e_ld);
+  TestMatrixC((is_row_major) ? p : m, (is_row_major) ? m : p, d_buffer, d_offset, d_ld);
+  Xgemm<T>::TestEpilogue(epilogue, m, n);
+
+  // Falls back to two GEMMs if the intermediate result doesn't fit in local memory
+  if (n > kMaxFusedN || !device_.IsLocalMemoryValid(kLocalMemory) ||
+      device_.MaxWorkGroupSize() < kThreads) {
+    GemmMlpUnfused(layout, m, n, k, p, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+                   epilogue, e_buffer, e_offset, e_ld, beta, d_buffer, d_offset, d_ld);
+    return;
+  }
+
+  // Launches the fused kernel, a work-group per 'kTileRows' rows of D
+  auto kernel = GetKernel(program_, "XgemmMlp");
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  kernel.SetArgument(3, static_cast<int>(p));
+  kernel.SetArgument(4, GetRealArg(alpha));
+  kernel.SetArgument(5, GetRealArg(beta));
+  kernel.SetArgument(6, a_buffer());
+  kernel.SetArgument(7, static_cast<int>(a_offset));
+  kernel.SetArgument(8, static_cast<int>(a_ld));
+  kernel.SetArgument(9, b_buffer());
+  kernel.SetArgument(10, static_cast<int>(b_offset));
+  kernel.SetArgument(11, static_cast<int>(b_ld));
+  kernel.SetArgument(12, e_buffer());
+  kernel.SetArgument(13, static_cast<int>(e_offset));
+  kernel.SetArgument(14, static_cast<int>(e_ld));
+  kernel.SetArgument(15, d_buffer());
+  kernel.SetArgument(16, static_cast<int>(d_offset));
+  kernel.SetArgument(17, static_cast<int>(d_ld));
+  kernel.SetArgument(18, static_cast<int>(is_row_major));
+  Xgemm<T>::SetEpilogueArguments(kernel, 19, epilogue, m, n);
+  const auto global = ThreadRange{CeilDiv(m, kTileRows) * kThreads};
+  const auto local = ThreadRange{kThreads};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// The fall-back: computes the intermediate result with the epilogue into a temporary buffer, which
+// is then multiplied with matrix E by a second GEMM
+template <typename T>
+void XgemmMlp<T>::GemmMlpUnfused(const Layout layout,
+                                 const size_t m, const size_t n, const size_t k, const size_t p,
+                                 const T alpha,
+                                 const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                                 const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                                 const GemmEpilogue<T> &epilogue,
+                                 const Buffer<T> &e_buffer, const size_t e_offset, const size_t e_ld,
+                                 const T beta,
+                                 const Buffer<T> &d_buffer, const size_t d_offset, const size_t d_ld) {
+  const auto h_ld = (layout == Layout::kRowMajor) ? n : m;
+  auto h_buffer = TemporaryBuffer<T>(context_, queue_, m * n);
+
+  auto gemm1_event = Event();
+  auto gemm1 = Xgemm<T>(queue_, gemm1_event.pointer(), "GEMMEPILOGUE");
+  gemm1.SetEpilogue(epilogue);
+  gemm1.DoGemm(layout, Transpose::kNo, Transpose::kNo,
+               m, n, k, alpha,
+               a_buffer, a_offset, a_ld,
+               b_buffer, b_offset, b_ld, ConstantZero<T>(),
+               h_buffer, 0, h_ld);
+  gemm1_event.WaitForCompletion();
+
+  auto gemm2 = Xgemm<T>(queue_, event_);
+  gemm2.DoGemm(layout, Transpose::kNo, Transpose::kNo,
+               m, p, n, ConstantOne<T>(),
+               h_buffer, 0, h_ld,
+               e_buffer, e_offset, e_ld, beta,
+               d_buffer, d_offset, d_ld);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmMlp<half>;
+template class XgemmMlp<float>;
+template class XgemmMlp<double>;
+template class XgemmMlp<float2>;
+template class XgemmMlp<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,73 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmMlp routine. This is a non-blas fused version of two back-to-back
+// GEMMs as found in an MLP block: D = act(alpha*A*B + bias)*E + beta*D. If the inner dimension of
+// the second product is small enough, the intermediate result is kept in local memory by a single
+// kernel. Otherwise, the routine falls back to a GEMM with an epilogue followed by a regular GEMM.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMMLP_H_
+#define CLBLAST_ROUTINES_XGEMMMLP_H_
+
+#include "routine.hpp"
+#include "routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemmMlp: public Routine {
+ public:
+
+  // Constructor
+  XgemmMlp(Queue &queue, EventPointer event, const std::string &name = "GEMMMLP");
+
+  // Templated-precision implementation of the routine
+  void DoGemmMlp(const Layout layout,
+                 const size_t m, const size_t n, const size_t k, const size_t p,
+                 const T alpha,
+                 const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                 const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                 const GemmEpilogue<T> &epilogue,
+                 const Buffer<T> &e_buffer, const size_t e_offset, const size_t e_ld,
+                 const T beta,
+                 const Buffer<T> &d_buffer, const size_t d_offset, const size_t d_ld);
+
+  // The largest inner dimension 'n' handled by the fused kernel: the rows of the intermediate
+  // result processed by a work-group take 16KB of local memory. The tile size and the work-group
+  // size have to match the values of 'MLP_ROWS' and 'MLP_THREADS' in the kernel.
+  static constexpr size_t kTileRows = 16;
+  static constexpr size_t kThreads = 128;
+  static constexpr size_t kMaxFusedN = 16384 / (kTileRows * sizeof(T));
+
+  // The local memory used by the fused kernel: the rows of the intermediate result and the tiles
+  static constexpr size_t kLocalMemory = (kMaxFusedN * kTileRows + 16 * 16 + 64 * 16) * sizeof(T);
+
+ private:
+
+  // The fall-back: the intermediate result goes through a temporary buffer in global memory
+  void GemmMlpUnfused(const Layout layout,
+                      const size_t m, const size_t n, const size_t k, const size_t p,
+                      const T alpha,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                      const GemmEpilogue<T> &epilogue,
+                      const Buffer<T> &e_buffer, const size_t e_offset, const size_t e_ld,
+                      const T beta,
+                      const Buffer<T> &d_buffer, const size_t d_offset, const size_t d_ld);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMMLP_H_
+#endif
@@ -0,0 +1,269 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmMultiDevice class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmmultidevice.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: stores the queues and computes the default weights if needed
+template <typename T>
+XgemmMultiDevice<T>::XgemmMultiDevice(const std::vector<Queue> &queues,
+                                      const std::vector<double> &weights):
+    queues_(queues),
+    weights_(weights) {
+  if (queues_.empty()) { throw BLASError(StatusCode::kInvalidValue); }
+
+  // Estimates the relative throughputs of the devices if not given. Each device uses its own tuned
+  // Xgemm kernel, so these estimates only need to be relative to each other.
+  if (weights_.empty()) {
+    for (const auto &queue : queues_) {
+      const auto device = queue.GetDevice();
+      const auto clock = std::max(device.CoreClock(), size_t{1});
+      weights_.push_back(static_cast<double>(device.ComputeUnits()) * static_cast<double>(clock));
+    }
+  }
+  if (weights_.size() != queues_.size()) { throw BLASError(StatusCode::kInvalidValue); }
+  auto total_weight = 0.0;
+  for (const auto weight : weights_) {
+    if (!(weight >= 0.0)) { throw BLASError(StatusCode::kInvalidValue); }
+    total_weight += weight;
+  }
+  if (!(total_weight > 0.0)) { throw BLASError(StatusCode::kInvalidValue); }
+}
+
+// =================================================================================================
+
+// Splits the columns proportional to the weights (the first value of each panel, plus 'n')
+template <typename T>
+std::vector<size_t> XgemmMultiDevice<T>::SplitColumns(const size_t n, const std::vector<double> &weights) {
+  auto total_weight = 0.0;
+  for (const auto weight : weights) { total_weight += weight; }
+  auto columns = std::vector<size_t>{0};
+  auto cumulative_weight = 0.0;
+  for (auto device_id = size_t{0}; device_id < weights.size(); ++device_id) {
+    cumulative_weight += weights[device_id];
+    const auto end = (device_id == weights.size() - 1) ? n :
+                     static_cast<size_t>(std::round(n * cumulative_weight / total_weight));
+    columns.push_back(std::min(std::max(end, columns.back()), n));
+  }
+  return columns;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemmMultiDevice<T>::DoGemmMultiDevice(const Layout layout,
+                                            const Transpose a_transpose, const Transpose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const T alpha,
+                                            const T* a, const size_t a_ld,
+                                            const T* b, const size_t b_ld,
+                                            const T beta,
+                                            T* c, const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero and that the host matrices are given
+  if ((m == 0) || (n == 0) || (k == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+  if (a == nullptr) { throw BLASError(StatusCode::kInvalidMatrixA); }
+  if (b == nullptr) { throw BLASError(StatusCode::kInvalidMatrixB); }
+  if (c == nullptr) { throw BLASError(StatusCode::kInvalidMatrixC); }
+
+  // Converts a row-major problem into a column-major one (C^T = B^T * A^T), such that the panels of
+  // C are always contiguous in memory
+  const auto is_row_major = (layout == Layout::kRowMajor);
+  const auto gemm_m = (is_row_major) ? n : m;
+  const auto gemm_n = (is_row_major) ? m : n;
+  const auto first = (is_row_major) ? b : a;
+  const auto first_ld = (is_row_major) ? b_ld : a_ld;
+  const auto first_transpose = (is_row_major) ? b_transpose : a_transpose;
+  const auto second = (is_row_major) ? a : b;
+  const auto second_ld = (is_row_major) ? a_ld : b_ld;
+  const auto second_transpose = (is_row_major) ? a_transpose : b_transpose;
+
+  // Tests the leading dimensions of the host matrices, as the regular routine would do for buffers
+  const auto first_transposed = (first_transpose != Transpose::kNo);
+  const auto second_transposed = (second_transpose != Transpose::kNo);
+  const auto first_one = (first_transposed) ? k : gemm_m;
+  const auto first_two = (first_transposed) ? gemm_m : k;
+  if (first_ld < first_one) {
+    throw BLASError((is_row_major) ? StatusCode::kInvalidLeadDimB : StatusCode::kInvalidLeadDimA);
+  }
+  if (second_ld < ((second_transposed) ? gemm_n : k)) {
+    throw BLASError((is_row_major) ? StatusCode::kInvalidLeadDimA : StatusCode::kInvalidLeadDimB);
+  }
+  if (c_ld < gemm_m) { throw BLASError(StatusCode::kInvalidLeadDimC); }
+
+  // Enqueues the work of all devices before waiting for any of them. The device buffers are kept
+  // alive until all queues have finished.
+  const auto columns = SplitColumns(gemm_n, weights_);
+  auto device_buffers = std::vector<Buffer<T>>();
+  for (auto device_id = size_t{0}; device_id < queues_.size(); ++device_id) {
+    const auto n_start = columns[device_id];
+    const auto panel_n = columns[device_id + 1] - n_start;
+    if (panel_n == 0) { continue; }
+    auto queue = queues_[device_id];
+    const auto context = queue.GetContext();
+
+    // Replicates the first matrix (A of the column-major problem) on this device
+    const auto first_size = first_ld * (first_two - 1) + first_one;
+    auto first_buffer = Buffer<T>(context, first_size);
+    first_buffer.WriteAsync(queue, first_size, first);
+
+    // Copies the part of the second matrix (B) which is used by the panel: its columns or, in case
+    // of a transpose, the range of memory holding its rows
+    const auto second_host_offset = (second_transposed) ? n_start : n_start * second_ld;
+    const auto second_one = (second_transposed) ? panel_n : k;
+    const auto second_two = (second_transposed) ? k : panel_n;
+    const auto second_size = second_ld * (second_two - 1) + second_one;
+    auto second_buffer = Buffer<T>(context, second_size);
+    second_buffer.WriteAsync(queue, second_size, second + second_host_offset);
+
+    // Copies the panel of matrix C, including the existing values in case beta is non-zero
+    const auto c_host_offset = n_start * c_ld;
+    const auto c_size = c_ld * (panel_n - 1) + gemm_m;
+    auto c_buffer = Buffer<T>(context, c_size);
+    c_buffer.WriteAsync(queue, c_size, c + c_host_offset);
+
+    // Computes the panel with the regular routine for this device and reads back the result
+    auto routine = Xgemm<T>(queue, nullptr);
+    routine.DoGemm(Layout::kColMajor, first_transpose, second_transpose,
+                   gemm_m, panel_n, k, alpha,
+                   first_buffer, 0, first_ld, second_buffer, 0, second_ld, beta,
+                   c_buffer, 0, c_ld);
+    c_buffer.ReadAsync(queue, c_size, c + c_host_offset);
+    device_buffers.push_back(first_buffer);
+    device_buffers.push_back(second_buffer);
+    device_buffers.push_back(c_buffer);
+  }
+
+  // Waits for all devices to complete
+  for (const auto &queue : queues_) { queue.Finish(); }
+}
+
+// =================================================================================================
+
+// The strided-batched version
+template <typename T>
+void XgemmMultiDevice<T>::DoGemmStridedBatchedMultiDevice(const Layout layout,
+                                                          const Transpose a_transpose,
+                                                          const Transpose b_transpose,
+                                                          const size_t m, const size_t n,
+                                                          const size_t k,
+                                                          const T alpha,
+                                                          const T* a, const size_t a_ld,
+                                                          const size_t a_stride,
+                                                          const T* b, const size_t b_ld,
+                                                          const size_t b_stride,
+                                                          const T beta,
+                                                          T* c, const size_t c_ld,
+                                                          const size_t c_stride,
+                                                          const size_t batch_count) {
+
+  // Makes sure all dimensions are larger than zero and that the host matrices are given
+  if ((m == 0) || (n == 0) || (k == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+  if (batch_count == 0) { throw BLASError(StatusCode::kInvalidBatchCount); }
+  if (a == nullptr) { throw BLASError(StatusCode::kInvalidMatrixA); }
+  if (b == nullptr) { throw BLASError(StatusCode::kInvalidMatrixB); }
+  if (c == nullptr) { throw BLASError(StatusCode::kInvalidMatrixC); }
+
+  // Computes the sizes of a single matrix in memory and tests the leading dimensions of the host
+  // matrices, as the regular routine would do for buffers
+  const auto a_rotated = (layout == Layout::kColMajor) == (a_transpose != Transpose::kNo);
+  const auto b_rotated = (layout == Layout::kColMajor) == (b_transpose != Transpose::kNo);
+  const auto c_rotated = (layout == Layout::kRowMajor);
+  const auto a_one = (a_rotated) ? k : m;
+  const auto a_two = (a_rotated) ? m : k;
+  const auto b_one = (b_rotated) ? n : k;
+  const auto b_two = (b_rotated) ? k : n;
+  const auto c_one = (c_rotated) ? n : m;
+  const auto c_two = (c_rotated) ? m : n;
+  if (a_ld < a_one) { throw BLASError(StatusCode::kInvalidLeadDimA); }
+  if (b_ld < b_one) { throw BLASError(StatusCode::kInvalidLeadDimB); }
+  if (c_ld < c_one) { throw BLASError(StatusCode::kInvalidLeadDimC); }
+  const auto a_matrix_size = a_ld * (a_two - 1) + a_one;
+  const auto b_matrix_size = b_ld * (b_two - 1) + b_one;
+  const auto c_matrix_size = c_ld * (c_two - 1) + c_one;
+
+  // Enqueues the work of all devices before waiting for any of them. Each device gets the memory
+  // range holding the matrices of its batch entries: with a stride of zero (a matrix shared by all
+  // entries) this is a single matrix. The device buffers are kept alive until all queues finished.
+  const auto batches = SplitColumns(batch_count, weights_);
+  auto device_buffers = std::vector<Buffer<T>>();
+  for (auto device_id = size_t{0}; device_id < queues_.size(); ++device_id) {
+    const auto batch_start = batches[device_id];
+    const auto device_batch_count = batches[device_id + 1] - batch_start;
+    if (device_batch_count == 0) { continue; }
+    auto queue = queues_[device_id];
+    const auto context = queue.GetContext();
+
+    // Copies the matrices of the batch entries of this device
+    const auto a_size = a_stride * (device_batch_count - 1) + a_matrix_size;
+    const auto b_size = b_stride * (device_batch_count - 1) + b_matrix_size;
+    const auto c_size = c_stride * (device_batch_count - 1) + c_matrix_size;
+    auto a_buffer = Buffer<T>(context, a_size);
+    auto b_buffer = Buffer<T>(context, b_size);
+    auto c_buffer = Buffer<T>(context, c_size);
+    a_buffer.WriteAsync(queue, a_size, a + batch_start * a_stride);
+    b_buffer.WriteAsync(queue, b_size, b + batch_start * b_stride);
+    c_buffer.WriteAsync(queue, c_size, c + batch_start * c_stride);
+
+    // Computes the batch entries with the regular routine for this device and reads back the result
+    auto routine = XgemmStridedBatched<T>(queue, nullptr);
+    routine.DoGemmStridedBatched(layout, a_transpose, b_transpose, m, n, k, alpha,
+                                 a_buffer, 0, a_ld, a_stride, b_buffer, 0, b_ld, b_stride, beta,
+                                 c_buffer, 0, c_ld, c_stride, device_batch_count);
+    c_buffer.ReadAsync(queue, c_size, c + batch_start * c_stride);
+    device_buffers.push_back(a_buffer);
+    device_buffers.push_back(b_buffer);
+    device_buffers.push_back(c_buffer);
+  }
+
+  // Waits for all devices to complete
+  for (const auto &queue : queues_) { queue.Finish(); }
+}
+
+// =================================================================================================
+
+#ifdef OPENCL_API
+
+// Creates the queues of the sub-devices, each context and queue holding a reference to its device
+std::vector<Queue> CreateSubDeviceQueues(const Device &device) {
+  auto queues = std::vector<Queue>();
+  const auto sub_devices = device.CreateSubDevicesByAffinity();
+  for (const auto sub_device : sub_devices) {
+    const auto sub_device_cpp = Device(sub_device);
+    queues.push_back(Queue(Context(sub_device_cpp), sub_device_cpp));
+  }
+  for (const auto sub_device : sub_devices) { CheckError(clReleaseDevice(sub_device)); }
+  if (queues.empty()) { queues.push_back(Queue(Context(device), device)); }
+  return queues;
+}
+
+#endif
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmMultiDevice<half>;
+template class XgemmMultiDevice<float>;
+template class XgemmMultiDevice<double>;
+template class XgemmMultiDevice<float2>;
+template class XgemmMultiDevice<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,87 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmMultiDevice routine: GEMM on matrices in host memory, computed in
+// parallel on multiple devices. Matrix C is split into panels of columns, each device computes one
+// panel using the regular Xgemm routine (with its own tuning database). Matrix A is replicated on
+// all devices, matrix B is only copied as far as needed for the panel. All copies and kernels are
+// enqueued a-synchronously on all queues before waiting, such that the devices run in parallel and
+// one device's transfers overlap with another device's computations. The strided-batched version
+// splits the batch instead: each device computes a range of batch entries with the regular
+// XgemmStridedBatched routine, using buffers with only the matrices of those entries.
+//
+// Contrary to the other routines, this is not a 'Routine': it has multiple queues, one per device.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMMULTIDEVICE_H_
+#define CLBLAST_ROUTINES_XGEMMMULTIDEVICE_H_
+
+#include <vector>
+
+#include "routines/level3/xgemm.hpp"
+#include "routines/levelx/xgemmstridedbatched.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemmMultiDevice {
+ public:
+
+  // Constructor, taking one queue per device. The weights are the relative throughputs of the
+  // devices: an empty list selects estimates based on the compute units and clock frequencies.
+  XgemmMultiDevice(const std::vector<Queue> &queues, const std::vector<double> &weights);
+
+  // Templated-precision implementation of the routine, blocks until C is copied back to the host
+  void DoGemmMultiDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                         const size_t m, const size_t n, const size_t k,
+                         const T alpha,
+                         const T* a, const size_t a_ld,
+                         const T* b, const size_t b_ld,
+                         const T beta,
+                         T* c, const size_t c_ld);
+
+  // As above, but for a strided-batched GEMM: the batch entries are split over the devices
+  void DoGemmStridedBatchedMultiDevice(const Layout layout,
+                                       const Transpose a_transpose, const Transpose b_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const T alpha,
+                                       const T* a, const size_t a_ld, const size_t a_stride,
+                                       const T* b, const size_t b_ld, const size_t b_stride,
+                                       const T beta,
+                                       T* c, const size_t c_ld, const size_t c_stride,
+                                       const size_t batch_count);
+
+  // Splits 'n' columns (or batch entries) over the devices proportional to their weights, returning
+  // the first column of each device's panel plus 'n' as the final entry
+  static std::vector<size_t> SplitColumns(const size_t n, const std::vector<double> &weights);
+
+ private:
+  const std::vector<Queue> queues_;
+  std::vector<double> weights_;
+};
+
+// =================================================================================================
+#ifdef OPENCL_API
+
+// Partitions a device (e.g. a multi-socket CPU) into sub-devices, preferably one per NUMA node, and
+// creates an in-order queue for each. Each sub-device gets a context of its own, such that the
+// buffers of the above routine are allocated and first written by the cores of that sub-device,
+// i.e. in its local memory. A device which can't be partitioned gives a single queue on itself.
+std::vector<Queue> CreateSubDeviceQueues(const Device &device);
+
+#endif
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMMULTIDEVICE_H_
+#endif
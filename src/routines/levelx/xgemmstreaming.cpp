@@ -0,0 +1,185 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmStreaming class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmstreaming.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: creates the transfer queue on the same context and device as the user's queue
+template <typename T>
+XgemmStreaming<T>::XgemmStreaming(Queue &queue, const size_t tile_size):
+    queue_(queue),
+    transfer_queue_(queue.GetContext(), queue.GetDevice()),
+    tile_size_(tile_size) {
+}
+
+// Rounds down to a multiple of 64 to match the tile sizes of the GEMM kernels
+template <typename T>
+size_t XgemmStreaming<T>::DefaultTileSize(const Device &device) {
+  const auto tile_bytes = std::min(device.MemorySize() / (4 * 6), device.MaxAllocSize());
+  const auto tile_size = static_cast<size_t>(std::sqrt(static_cast<double>(tile_bytes / sizeof(T))));
+  return std::max((tile_size / 64) * 64, size_t{64});
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemmStreaming<T>::DoGemmStreaming(const Layout layout,
+                                        const Transpose a_transpose, const Transpose b_transpose,
+                                        const size_t m, const size_t n, const size_t k,
+                                        const T alpha,
+                                        const T* a, const size_t a_ld,
+                                        const T* b, const size_t b_ld,
+                                        const T beta,
+                                        T* c, const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero and that the host matrices are given
+  if ((m == 0) || (n == 0) || (k == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+  if (a == nullptr) { throw BLASError(StatusCode::kInvalidMatrixA); }
+  if (b == nullptr) { throw BLASError(StatusCode::kInvalidMatrixB); }
+  if (c == nullptr) { throw BLASError(StatusCode::kInvalidMatrixC); }
+
+  // Converts a row-major problem into a column-major one (C^T = B^T * A^T)
+  const auto is_row_major = (layout == Layout::kRowMajor);
+  const auto gemm_m = (is_row_major) ? n : m;
+  const auto gemm_n = (is_row_major) ? m : n;
+  const auto first = (is_row_major) ? b : a;
+  const auto first_ld = (is_row_major) ? b_ld : a_ld;
+  const auto first_transpose = (is_row_major) ? b_transpose : a_transpose;
+  const auto second = (is_row_major) ? a : b;
+  const auto second_ld = (is_row_major) ? a_ld : b_ld;
+  const auto second_transpose = (is_row_major) ? a_transpose : b_transpose;
+
+  // Tests the leading dimensions of the host matrices, as the regular routine would do for buffers
+  const auto first_transposed = (first_transpose != Transpose::kNo);
+  const auto second_transposed = (second_transpose != Transpose::kNo);
+  if (first_ld < ((first_transposed) ? k : gemm_m)) {
+    throw BLASError((is_row_major) ? StatusCode::kInvalidLeadDimB : StatusCode::kInvalidLeadDimA);
+  }
+  if (second_ld < ((second_transposed) ? gemm_n : k)) {
+    throw BLASError((is_row_major) ? StatusCode::kInvalidLeadDimA : StatusCode::kInvalidLeadDimB);
+  }
+  if (c_ld < gemm_m) { throw BLASError(StatusCode::kInvalidLeadDimC); }
+
+  // Determines the tile sizes and lists all steps: the panels of A and B for each tile of C
+  const auto tile_size = (tile_size_ != 0) ? tile_size_ : DefaultTileSize(queue_.GetDevice());
+  const auto tile_m = std::min(tile_size, gemm_m);
+  const auto tile_n = std::min(tile_size, gemm_n);
+  const auto tile_k = std::min(tile_size, k);
+  struct Step { size_t i, j, p, sub_m, sub_n, sub_k, tile_id; };
+  auto steps = std::vector<Step>();
+  auto tile_id = size_t{0};
+  for (auto j = size_t{0}; j < gemm_n; j += tile_n) {
+    for (auto i = size_t{0}; i < gemm_m; i += tile_m) {
+      for (auto p = size_t{0}; p < k; p += tile_k) {
+        steps.push_back({i, j, p, std::min(tile_m, gemm_m - i), std::min(tile_n, gemm_n - j),
+                         std::min(tile_k, k - p), tile_id});
+      }
+      tile_id++;
+    }
+  }
+
+  // Allocates the double-buffered device tiles
+  const auto context = queue_.GetContext();
+  auto a_buffers = std::vector<Buffer<T>>{Buffer<T>(context, tile_m * tile_k),
+                                          Buffer<T>(context, tile_m * tile_k)};
+  auto b_buffers = std::vector<Buffer<T>>{Buffer<T>(context, tile_k * tile_n),
+                                          Buffer<T>(context, tile_k * tile_n)};
+  auto c_buffers = std::vector<Buffer<T>>{Buffer<T>(context, tile_m * tile_n),
+                                          Buffer<T>(context, tile_m * tile_n)};
+  auto uploaded = std::vector<Event>{Event(), Event()};  // panels of a slot are on the device
+  auto computed = std::vector<Event>{Event(), Event()};  // panels of a slot are no longer used
+
+  // Uploads the panels of A and B (and the tile of C for the first step of a tile) on the transfer
+  // queue, after the computation which last used the slot has completed
+  const auto upload = [&](const size_t step_id) {
+    const auto &step = steps[step_id];
+    const auto slot = step_id % 2;
+    if (step_id >= 2) { transfer_queue_.EnqueueWaitForEvent(computed[slot]); }
+    if (step.p == 0) {
+      c_buffers[step.tile_id % 2].WriteRectAsync(transfer_queue_, step.sub_m, step.sub_n,
+                                                 c + step.j * c_ld + step.i, c_ld);
+    }
+    if (first_transposed) {
+      a_buffers[slot].WriteRectAsync(transfer_queue_, step.sub_k, step.sub_m,
+                                     first + step.i * first_ld + step.p, first_ld);
+    }
+    else {
+      a_buffers[slot].WriteRectAsync(transfer_queue_, step.sub_m, step.sub_k,
+                                     first + step.p * first_ld + step.i, first_ld);
+    }
+    if (second_transposed) {
+      b_buffers[slot].WriteRectAsync(transfer_queue_, step.sub_n, step.sub_k,
+                                     second + step.p * second_ld + step.j, second_ld);
+    }
+    else {
+      b_buffers[slot].WriteRectAsync(transfer_queue_, step.sub_k, step.sub_n,
+                                     second + step.j * second_ld + step.p, second_ld);
+    }
+    uploaded[slot] = Event();
+    transfer_queue_.EnqueueMarker(uploaded[slot]);
+  };
+
+  // Runs all steps, always uploading the next panels before computing on the current ones
+  auto routine = Xgemm<T>(queue_, nullptr);
+  upload(0);
+  for (auto step_id = size_t{0}; step_id < steps.size(); ++step_id) {
+    const auto &step = steps[step_id];
+    const auto slot = step_id % 2;
+    auto &c_buffer = c_buffers[step.tile_id % 2];
+
+    // Limits the amount of work enqueued ahead, such that the temporary buffers of the regular
+    // routine are released in time
+    if (step_id >= 2) { computed[slot].WaitForCompletion(); }
+
+    // Accumulates the product of the panels in the tile of C
+    queue_.EnqueueWaitForEvent(uploaded[slot]);
+    const auto step_beta = (step.p == 0) ? beta : ConstantOne<T>();
+    routine.DoGemm(Layout::kColMajor, first_transpose, second_transpose,
+                   step.sub_m, step.sub_n, step.sub_k, alpha,
+                   a_buffers[slot], 0, (first_transposed) ? step.sub_k : step.sub_m,
+                   b_buffers[slot], 0, (second_transposed) ? step.sub_n : step.sub_k, step_beta,
+                   c_buffer, 0, step.sub_m);
+    computed[slot] = Event();
+    queue_.EnqueueMarker(computed[slot]);
+
+    // Uploads the next panels while computing and downloads the tile of C once it is complete
+    if (step_id + 1 < steps.size()) { upload(step_id + 1); }
+    if (step.p + step.sub_k == k) {
+      transfer_queue_.EnqueueWaitForEvent(computed[slot]);
+      c_buffer.ReadRectAsync(transfer_queue_, step.sub_m, step.sub_n, c + step.j * c_ld + step.i, c_ld);
+    }
+  }
+
+  // Waits for the downloads of C to complete
+  queue_.Finish();
+  transfer_queue_.Finish();
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmStreaming<half>;
+template class XgemmStreaming<float>;
+template class XgemmStreaming<double>;
+template class XgemmStreaming<float2>;
+template class XgemmStreaming<double2>;
+
+// =================================================================================================
+} // namespace clblast
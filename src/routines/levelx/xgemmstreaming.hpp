@@ -0,0 +1,58 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmStreaming routine: GEMM on matrices in host memory which do not
+// have to fit in device memory. The problem is tiled: each tile of C is computed by accumulating
+// the products of panels of A and B using the regular Xgemm routine. The panels are double-
+// buffered and uploaded on a second (transfer) queue, such that the uploads of the next panels and
+// the download of the previous tile of C overlap with the computation on the user's queue.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMSTREAMING_H_
+#define CLBLAST_ROUTINES_XGEMMSTREAMING_H_
+
+#include "routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemmStreaming {
+ public:
+
+  // Constructor, creating the transfer queue. A tile size of zero selects a tile size based on the
+  // amount of device memory.
+  XgemmStreaming(Queue &queue, const size_t tile_size);
+
+  // Templated-precision implementation of the routine, blocks until C is copied back to the host
+  void DoGemmStreaming(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t m, const size_t n, const size_t k,
+                       const T alpha,
+                       const T* a, const size_t a_ld,
+                       const T* b, const size_t b_ld,
+                       const T beta,
+                       T* c, const size_t c_ld);
+
+  // Computes the default tile size: six tiles (double-buffered A, B and C) use at most a quarter of
+  // the device memory, such that the regular routine has room left for its temporary buffers
+  static size_t DefaultTileSize(const Device &device);
+
+ private:
+  Queue queue_;
+  Queue transfer_queue_;
+  const size_t tile_size_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMSTREAMING_H_
+#endif
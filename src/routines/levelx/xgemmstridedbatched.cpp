@@ -20,29 +20,43 @@
 namespace clblast {
 // =================================================================================================
 
-// Constructor: forwards to base class constructor
+template <typename T> constexpr size_t XgemmStridedBatched<T>::kTinyMaxSize;
+template <typename T> constexpr size_t XgemmStridedBatched<T>::kTinyWorkGroupSize;
+
+// Constructor: forwards to base class constructor. The main program holds the direct and indirect
+// kernels, the program with the kernel for tiny matrices is specialised per matrix size.
 template <typename T>
 XgemmStridedBatched<T>::XgemmStridedBatched(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect","GemmRoutine"},
-        PrecisionValue<T>(), {}, {
-            #include "../../kernels/level3/level3.opencl"
-            #include "../../kernels/level3/copy_fast.opencl"
-            #include "../../kernels/level3/copy_pad.opencl"
-            #include "../../kernels/level3/transpose_fast.opencl"
-            #include "../../kernels/level3/transpose_pad.opencl"
-            , // separated in multiple parts to prevent C1091 in MSVC 2013
-            #include "../../kernels/level3/xgemm_direct_part1.opencl"
-            #include "../../kernels/level3/xgemm_direct_part2.opencl"
-            #include "../../kernels/level3/xgemm_direct_part3.opencl"
-            , // separated in multiple parts to prevent C1091 in MSVC 2013
-            #include "../../kernels/level3/xgemm_part1.opencl"
-            #include "../../kernels/level3/xgemm_part2.opencl"
-            #include "../../kernels/level3/xgemm_part3.opencl"
-            #include "../../kernels/level3/xgemm_part4.opencl"
-            , // separated in multiple parts to prevent C1091 in MSVC 2013
-            #include "../../kernels/level3/xgemm_batched.opencl"
-            #include "../../kernels/level3/xgemm_direct_batched.opencl"
-        }) {
+    Routine(queue, event, name, {"Copy","Pad","Transpose","Padtranspose","XgemmBatched","XgemmDirectBatched","GemmRoutine"},
+        PrecisionValue<T>(), {}, {}, {
+          { // kMainProgram
+            KernelSource::kLevel3,
+            KernelSource::kCopyFast,
+            KernelSource::kCopyPad,
+            KernelSource::kTransposeFast,
+            KernelSource::kTransposePad,
+            KernelSource::kXgemmEpilogue,
+            KernelSource::kXgemmDirectPart1,
+            KernelSource::kXgemmDirectPart2,
+            KernelSource::kXgemmDirectPart3,
+            KernelSource::kXgemmPart1,
+            KernelSource::kXgemmPart2,
+            KernelSource::kXgemmPart3,
+            KernelSource::kXgemmTensor,
+            KernelSource::kXgemmPart4,
+            KernelSource::kXgemmBatched,
+            KernelSource::kXgemmDirectBatched
+          }, { // kTinyProgram
+            KernelSource::kXgemmTinyBatched
+          }
+        }),
+    has_epilogue_(name == "GEMMSTRIDEDBATCHEDEPILOGUE"),
+    epilogue_{EpilogueBias::kNone, Buffer<T>(0), 0, EpilogueActivation::kNone,
+              ConstantZero<T>(), ConstantOne<T>()},
+    has_triangle_(name == "SYRKSTRIDEDBATCHED"),
+    triangle_upper_(false),
+    has_structure_(name == "SYMMSTRIDEDBATCHED" || name == "TRMMSTRIDEDBATCHED"),
+    structure_{0, false, false} {
 }
 
 // =================================================================================================
@@ -56,14 +70,21 @@ void XgemmStridedBatched<T>::DoGemmStridedBatched(const Layout layout, const Tra
                                                   const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
                                                   const size_t batch_count) {
 
+  // Selects the kernel parameters for this problem size (if there are size-specific ones)
+  SelectSizeVariant(Xgemm<T>::GetProblemSize(m, n, k));
+  const auto &params = db_.GetFlatParameters();
+
   // Tests for a valid batch count
   if (batch_count < 1) {
     throw BLASError(StatusCode::kInvalidBatchCount);
   }
 
-  // Two methods to choose from, select which one to run
-  const auto do_gemm_direct = Xgemm<T>::UseDirectKernel(m, n, k, db_["XGEMM_MIN_INDIRECT_SIZE"]);
-  const auto gemm_kernel_id = (do_gemm_direct) ? 0 : db_["GEMMK"];
+  // Two methods to choose from, select which one to run. A triangular matrix C and a structured
+  // input matrix are only supported by the direct kernel, which then runs for all sizes.
+  const auto is_direct_only = has_triangle_ || has_structure_;
+  const auto do_gemm_direct = is_direct_only ||
+                              Xgemm<T>::UseDirectKernel(m, n, k, params.gemm_routine.min_indirect_size);
+  const auto gemm_kernel_id = (do_gemm_direct) ? 0 : params.xgemm.gemmk;
 
   // Computes the transpose/conjugate options and sets the a/b/c sizes based on that
   bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
@@ -79,9 +100,31 @@ void XgemmStridedBatched<T>::DoGemmStridedBatched(const Layout layout, const Tra
     TestMatrixB(b_one, b_two, b_buffer, b_offset + b_stride * batch, b_ld);
     TestMatrixC(c_one, c_two, c_buffer, c_offset + c_stride * batch, c_ld);
   }
+  if (has_epilogue_) { Xgemm<T>::TestEpilogue(epilogue_, m, n); }
+
+  // With a zero alpha, A and B don't contribute to the result: only C = beta * C is computed for
+  // all batches, restricted to the stored triangle for SYRK (upper or lower in terms of the layout)
+  if (alpha == ConstantZero<T>() && !has_epilogue_) {
+    const auto upper = has_triangle_ && (triangle_upper_ != (layout == Layout::kRowMajor));
+    const auto lower = has_triangle_ && !upper;
+    ScaleMatrix(queue_, device_, GetProgram(kMainProgram), event_, input_events_,
+                c_one, c_two, c_ld, c_offset, c_buffer, beta, batch_count, c_stride, upper, lower);
+    return;
+  }
 
   // Selects which version of the batched GEMM to run
-  if (do_gemm_direct) { // single generic kernel
+  if (!has_epilogue_ && !is_direct_only && UseTinyKernel(m, n, k)) { // a thread per matrix
+    const auto a_rotated = (layout == Layout::kColMajor) == (a_transpose != Transpose::kNo);
+    const auto b_rotated = (layout == Layout::kColMajor) == (b_transpose != Transpose::kNo);
+    const auto c_rotated = (layout == Layout::kRowMajor);
+    BatchedGemmTiny(m, n, k, alpha,
+                    a_buffer, a_offset, a_ld, a_stride,
+                    b_buffer, b_offset, b_ld, b_stride, beta,
+                    c_buffer, c_offset, c_ld, c_stride,
+                    a_rotated, b_rotated, c_rotated, a_conjugate, b_conjugate,
+                    batch_count);
+  }
+  else if (do_gemm_direct) { // single generic kernel
     BatchedGemmDirect(m, n, k, alpha,
                       a_buffer, a_offset, a_ld, a_stride,
                       b_buffer, b_offset, b_ld, b_stride, beta,
@@ -116,67 +159,88 @@ void XgemmStridedBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n,
                                                  const size_t b_one, const size_t b_two,
                                                  const size_t c_one, const size_t c_two,
                                                  const size_t batch_count) {
+  const auto &params = db_.GetFlatParameters();
+  const auto &program = GetProgram(kMainProgram);
 
   // Calculates the ceiled versions of m, n, and k
-  const auto m_ceiled = Ceil(Ceil(m, db_["MWG"]), db_["VWM"]);
-  const auto n_ceiled = Ceil(Ceil(n, db_["NWG"]), db_["VWN"]);
-  const auto k_ceiled = Ceil(Ceil(k, db_["KWG"]), db_["VWM"]);
+  const auto m_ceiled = Ceil(Ceil(m, params.xgemm.mwg), params.xgemm.vwm);
+  const auto n_ceiled = Ceil(Ceil(n, params.xgemm.nwg), params.xgemm.vwn);
+  const auto k_ceiled = Ceil(Ceil(k, params.xgemm.kwg), params.xgemm.vwm);
 
   // Computes the first and second "internal" (ceiled) dimensions of the 3 matrices taking into account
   // whether the matrices need to be rotated or not for the kernel.
   size_t a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i;
-  Xgemm<T>::CalculateInternalDimensions(m, n, k, db_["MWG"], db_["NWG"], db_["KWG"],
+  Xgemm<T>::CalculateInternalDimensions(m, n, k, params.xgemm.mwg, params.xgemm.nwg, params.xgemm.kwg,
                                         a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i,
-                                        db_["GEMMK"]);
-
-  // Determines whether or not temporary matrices are needed
-  auto a_no_temp = a_one == a_one_i && a_two == a_two_i && a_ld == a_one && !a_do_transpose && !a_conjugate;
-  auto b_no_temp = b_one == b_one_i && b_two == b_two_i && b_ld == b_one && !b_do_transpose && !b_conjugate;
-  auto c_no_temp = c_one == c_one_i && c_two == c_two_i && c_ld == c_one && !c_do_transpose;
+                                        params.xgemm.gemmk);
+
+  // Matrices A and B with a stride of zero are shared by all batches (e.g. weights): these are
+  // processed only once, and the kernel reads the same matrix for every batch
+  const auto a_shared = (a_stride == 0);
+  const auto b_shared = (b_stride == 0);
+  const auto a_batch_count = (a_shared) ? size_t{1} : batch_count;
+  const auto b_batch_count = (b_shared) ? size_t{1} : batch_count;
+
+  // Determines whether or not temporary matrices are needed. The kernel supports no offset and
+  // requires the batches to be stored consecutively (or to be shared).
+  auto a_no_temp = a_one == a_one_i && a_two == a_two_i && a_ld == a_one && a_offset == 0 &&
+                   (a_shared || a_stride == a_one * a_two) && !a_do_transpose && !a_conjugate;
+  auto b_no_temp = b_one == b_one_i && b_two == b_two_i && b_ld == b_one && b_offset == 0 &&
+                   (b_shared || b_stride == b_one * b_two) && !b_do_transpose && !b_conjugate;
+  auto c_no_temp = c_one == c_one_i && c_two == c_two_i && c_ld == c_one && c_offset == 0 &&
+                   c_stride == c_one * c_two && !c_do_transpose;
 
   // Creates the temporary matrices
-  const auto a_temp = (a_no_temp) ? a_buffer : Buffer<T>(context_, batch_count * a_one_i * a_two_i);
-  const auto b_temp = (b_no_temp) ? b_buffer : Buffer<T>(context_, batch_count * b_one_i * b_two_i);
-  const auto c_temp = (c_no_temp) ? c_buffer : Buffer<T>(context_, batch_count * c_one_i * c_two_i);
+  const auto a_temp = (a_no_temp) ? a_buffer : TemporaryBuffer<T>(context_, queue_, a_batch_count * a_one_i * a_two_i);
+  const auto b_temp = (b_no_temp) ? b_buffer : TemporaryBuffer<T>(context_, queue_, b_batch_count * b_one_i * b_two_i);
+  const auto c_temp = (c_no_temp) ? c_buffer : TemporaryBuffer<T>(context_, queue_, batch_count * c_one_i * c_two_i);
+
+  // The distances between the batches as seen by the kernel
+  const auto a_stride_i = (a_shared) ? size_t{0} : a_one_i * a_two_i;
+  const auto b_stride_i = (b_shared) ? size_t{0} : b_one_i * b_two_i;
+  const auto c_stride_i = c_one_i * c_two_i;
 
   // Events of all kernels (including pre/post processing kernels)
   auto eventWaitList = std::vector<Event>();
-  auto emptyEventList = std::vector<Event>();
+  const auto &inputEventList = input_events_; // see 'BeginCommandChain'
 
   // Runs the pre-processing kernel for matrix A. This transposes the matrix, but also pads zeros
   // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
   // case nothing has to be done, these kernels can be skipped.
   if (!a_no_temp) {
     auto eventProcessA = Event();
-    PadCopyTransposeMatrixStridedBatched(queue_, device_, db_, eventProcessA.pointer(), emptyEventList,
+    PadCopyTransposeMatrixStridedBatched(queue_, device_, db_,
+                                         IntermediateEvent(queue_, eventProcessA), inputEventList,
                                          a_one, a_two, a_ld, a_offset, a_stride, a_buffer,
                                          a_one_i, a_two_i, a_one_i, 0, a_one_i * a_two_i, a_temp,
-                                         program_, true, a_do_transpose, a_conjugate, batch_count);
+                                         ConstantOne<T>(), program, true, a_do_transpose, a_conjugate, a_batch_count);
     eventWaitList.push_back(eventProcessA);
   }
 
   // As above, but now for matrix B
   if (!b_no_temp) {
     auto eventProcessB = Event();
-    PadCopyTransposeMatrixStridedBatched(queue_, device_, db_, eventProcessB.pointer(), emptyEventList,
+    PadCopyTransposeMatrixStridedBatched(queue_, device_, db_,
+                                         IntermediateEvent(queue_, eventProcessB), inputEventList,
                                          b_one, b_two, b_ld, b_offset, b_stride, b_buffer,
                                          b_one_i, b_two_i, b_one_i, 0, b_one_i * b_two_i, b_temp,
-                                         program_, true, b_do_transpose, b_conjugate, batch_count);
+                                         ConstantOne<T>(), program, true, b_do_transpose, b_conjugate, b_batch_count);
     eventWaitList.push_back(eventProcessB);
   }
 
   // As above, but now for matrix C
   if (!c_no_temp) {
     auto eventProcessC = Event();
-    PadCopyTransposeMatrixStridedBatched(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
+    PadCopyTransposeMatrixStridedBatched(queue_, device_, db_,
+                                         IntermediateEvent(queue_, eventProcessC), inputEventList,
                                          c_one, c_two, c_ld, c_offset, c_stride, c_buffer,
                                          c_one_i, c_two_i, c_one_i, 0, c_one_i * c_two_i, c_temp,
-                                         program_, true, c_do_transpose, false, batch_count);
+                                         ConstantOne<T>(), program, true, c_do_transpose, false, batch_count);
     eventWaitList.push_back(eventProcessC);
   }
 
   // Retrieves the Xgemm kernel from the compiled binary
-  auto kernel = Kernel(program_, "XgemmStridedBatched");
+  auto kernel = GetKernel(program, "XgemmStridedBatched");
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(m_ceiled));
@@ -185,26 +249,24 @@ void XgemmStridedBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n,
   kernel.SetArgument(3, GetRealArg(alpha));
   kernel.SetArgument(4, GetRealArg(beta));
   kernel.SetArgument(5, a_temp());
-  kernel.SetArgument(6, static_cast<int>(a_one_i));
-  kernel.SetArgument(7, static_cast<int>(a_two_i));
-  kernel.SetArgument(8, b_temp());
-  kernel.SetArgument(9, static_cast<int>(b_one_i));
-  kernel.SetArgument(10, static_cast<int>(b_two_i));
-  kernel.SetArgument(11, c_temp());
-  kernel.SetArgument(12, static_cast<int>(c_one_i));
-  kernel.SetArgument(13, static_cast<int>(c_two_i));
+  kernel.SetArgument(6, static_cast<int>(a_stride_i));
+  kernel.SetArgument(7, b_temp());
+  kernel.SetArgument(8, static_cast<int>(b_stride_i));
+  kernel.SetArgument(9, c_temp());
+  kernel.SetArgument(10, static_cast<int>(c_stride_i));
+  if (has_epilogue_) { Xgemm<T>::SetEpilogueArguments(kernel, 11, epilogue_, m, n); }
 
   // Computes the global and local thread sizes
-  const auto global = std::vector<size_t>{
-      (c_one_i * db_["MDIMC"]) / db_["MWG"],
-      (c_two_i * db_["NDIMC"]) / db_["NWG"],
+  const auto global = ThreadRange{
+      (c_one_i * params.xgemm.mdimc) / params.xgemm.mwg,
+      (c_two_i * params.xgemm.ndimc) / params.xgemm.nwg,
       batch_count
   };
-  const auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"], 1};
+  const auto local = ThreadRange{params.xgemm.mdimc, params.xgemm.ndimc, 1};
 
   // Launches the kernel
   auto eventKernel = Event();
-  auto eventPointer = (!c_no_temp) ? eventKernel.pointer() : event_;
+  auto eventPointer = (!c_no_temp) ? IntermediateEvent(queue_, eventKernel) : event_;
   RunKernel(kernel, queue_, device_, global, local, eventPointer, eventWaitList);
 
   // Runs the post-processing kernel if needed
@@ -213,7 +275,7 @@ void XgemmStridedBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n,
     PadCopyTransposeMatrixStridedBatched(queue_, device_, db_, event_, eventWaitList,
                                          c_one_i, c_two_i, c_one_i, 0, c_one_i * c_two_i, c_temp,
                                          c_one, c_two, c_ld, c_offset, c_stride, c_buffer,
-                                         program_, false, c_do_transpose, false, batch_count);
+                                         ConstantOne<T>(), program, false, c_do_transpose, false, batch_count);
   }
 }
 
@@ -228,11 +290,13 @@ void XgemmStridedBatched<T>::BatchedGemmDirect(const size_t m, const size_t n, c
                                                const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                                                const bool a_conjugate, const bool b_conjugate,
                                                const size_t batch_count) {
+  const auto &params = db_.GetFlatParameters();
+  const auto &program = GetProgram(kMainProgram);
 
   // Retrieves the proper XgemmDirect kernel from the compiled binary
   const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectStridedBatchedTT" : "XgemmDirectStridedBatchedTN") :
                     (b_do_transpose ? "XgemmDirectStridedBatchedNT" : "XgemmDirectStridedBatchedNN");
-  auto kernel = Kernel(program_, name);
+  auto kernel = GetKernel(program, name);
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(m));
@@ -255,16 +319,26 @@ void XgemmStridedBatched<T>::BatchedGemmDirect(const size_t m, const size_t n, c
   kernel.SetArgument(17, static_cast<int>(c_do_transpose));
   kernel.SetArgument(18, static_cast<int>(a_conjugate));
   kernel.SetArgument(19, static_cast<int>(b_conjugate));
+  if (has_epilogue_) { Xgemm<T>::SetEpilogueArguments(kernel, 20, epilogue_, m, n); }
+  if (has_triangle_) {
+    kernel.SetArgument(20, static_cast<int>(triangle_upper_));
+    kernel.SetArgument(21, static_cast<int>(false));
+  }
+  if (has_structure_) {
+    kernel.SetArgument(20, static_cast<int>(structure_.operand));
+    kernel.SetArgument(21, static_cast<int>(structure_.upper));
+    kernel.SetArgument(22, static_cast<int>(structure_.unit_diagonal));
+  }
 
   // Computes the global and local thread sizes
-  const auto m_ceiled = Ceil(m, db_["WGD"]);
-  const auto n_ceiled = Ceil(n, db_["WGD"]);
-  const auto global = std::vector<size_t>{
-      (m_ceiled * db_["MDIMCD"]) / db_["WGD"],
-      (n_ceiled * db_["NDIMCD"]) / db_["WGD"],
+  const auto m_ceiled = Ceil(m, params.xgemm_direct.wgd);
+  const auto n_ceiled = Ceil(n, params.xgemm_direct.wgd);
+  const auto global = ThreadRange{
+      (m_ceiled * params.xgemm_direct.mdimcd) / params.xgemm_direct.wgd,
+      (n_ceiled * params.xgemm_direct.ndimcd) / params.xgemm_direct.wgd,
       batch_count
   };
-  const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"], 1};
+  const auto local = ThreadRange{params.xgemm_direct.mdimcd, params.xgemm_direct.ndimcd, 1};
 
   // Launches the kernel
   RunKernel(kernel, queue_, device_, global, local, event_);
@@ -272,6 +346,53 @@ void XgemmStridedBatched<T>::BatchedGemmDirect(const size_t m, const size_t n, c
 
 // =================================================================================================
 
+// The version for tiny matrices: each thread computes a whole matrix product in registers. The
+// program is compiled for this particular matrix size, such that all loops are unrolled.
+template <typename T>
+void XgemmStridedBatched<T>::BatchedGemmTiny(const size_t m, const size_t n, const size_t k, const T alpha,
+                                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const T beta,
+                                             const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const bool a_rotated, const bool b_rotated, const bool c_rotated,
+                                             const bool a_conjugate, const bool b_conjugate,
+                                             const size_t batch_count) {
+  const auto defines = "#define TINY_M " + ToString(m) + "\n"
+                       "#define TINY_N " + ToString(n) + "\n"
+                       "#define TINY_K " + ToString(k) + "\n";
+  const auto identifier = "_tiny_" + ToString(m) + "x" + ToString(n) + "x" + ToString(k);
+  const auto program = GetSpecialisedProgram(kTinyProgram, defines, identifier);
+  auto kernel = GetKernel(program, "XgemmTinyStridedBatched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(batch_count));
+  kernel.SetArgument(1, GetRealArg(alpha));
+  kernel.SetArgument(2, GetRealArg(beta));
+  kernel.SetArgument(3, a_buffer());
+  kernel.SetArgument(4, static_cast<int>(a_offset));
+  kernel.SetArgument(5, static_cast<int>(a_ld));
+  kernel.SetArgument(6, static_cast<int>(a_stride));
+  kernel.SetArgument(7, b_buffer());
+  kernel.SetArgument(8, static_cast<int>(b_offset));
+  kernel.SetArgument(9, static_cast<int>(b_ld));
+  kernel.SetArgument(10, static_cast<int>(b_stride));
+  kernel.SetArgument(11, c_buffer());
+  kernel.SetArgument(12, static_cast<int>(c_offset));
+  kernel.SetArgument(13, static_cast<int>(c_ld));
+  kernel.SetArgument(14, static_cast<int>(c_stride));
+  kernel.SetArgument(15, static_cast<int>(a_rotated));
+  kernel.SetArgument(16, static_cast<int>(b_rotated));
+  kernel.SetArgument(17, static_cast<int>(c_rotated));
+  kernel.SetArgument(18, static_cast<int>(a_conjugate));
+  kernel.SetArgument(19, static_cast<int>(b_conjugate));
+
+  // Launches the kernel with a thread per matrix
+  const auto global = ThreadRange{Ceil(batch_count, kTinyWorkGroupSize)};
+  const auto local = ThreadRange{kTinyWorkGroupSize};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
 // Compiles the templated class
 template class XgemmStridedBatched<half>;
 template class XgemmStridedBatched<float>;
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "routine.hpp"
+#include "routines/level3/xgemm.hpp"
 
 namespace clblast {
 // =================================================================================================
@@ -29,6 +30,17 @@ public:
   // Constructor
   XgemmStridedBatched(Queue &queue, EventPointer event, const std::string &name = "GEMMSTRIDEDBATCHED");
 
+  // Sets the epilogue for the next calls, only available for the "GEMMSTRIDEDBATCHEDEPILOGUE" routine
+  void SetEpilogue(const GemmEpilogue<T> &epilogue) { epilogue_ = epilogue; }
+
+  // Sets the triangle of matrix C for the next calls, only available for the "SYRKSTRIDEDBATCHED"
+  // routine: only the upper or lower triangle of each matrix C is then computed and stored
+  void SetTriangle(const bool upper) { triangle_upper_ = upper; }
+
+  // Sets the structure of an input matrix for the next calls, only available for the
+  // "SYMMSTRIDEDBATCHED" and "TRMMSTRIDEDBATCHED" routines
+  void SetStructure(const GemmStructure &structure) { structure_ = structure; }
+
   // Templated-precision implementation of the routine
   void DoGemmStridedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
                             const size_t m, const size_t n, const size_t k, const T alpha,
@@ -57,6 +69,38 @@ public:
                          const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                          const bool a_conjugate, const bool b_conjugate,
                          const size_t batch_count);
+
+  // Version of strided batched GEMM for tiny matrices (a thread per matrix product). The matrices
+  // are column-major, a rotated matrix is stored as its transpose.
+  void BatchedGemmTiny(const size_t m, const size_t n, const size_t k, const T alpha,
+                       const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                       const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const T beta,
+                       const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                       const bool a_rotated, const bool b_rotated, const bool c_rotated,
+                       const bool a_conjugate, const bool b_conjugate,
+                       const size_t batch_count);
+
+  // The version for tiny matrices is used up to this size in each dimension, with this number of
+  // threads (i.e. matrices) per work-group
+  static constexpr size_t kTinyMaxSize = 8;
+  static constexpr size_t kTinyWorkGroupSize = 64;
+  static bool UseTinyKernel(const size_t m, const size_t n, const size_t k) {
+    return m <= kTinyMaxSize && n <= kTinyMaxSize && k <= kTinyMaxSize;
+  }
+
+ private:
+  // The programs of the routine: the direct and indirect kernels and the kernel for tiny matrices
+  static constexpr size_t kMainProgram = 0;
+  static constexpr size_t kTinyProgram = 1;
+
+  const bool has_epilogue_;
+  GemmEpilogue<T> epilogue_;
+
+  // A triangular matrix C or a structured input matrix: these always use the direct kernel
+  const bool has_triangle_;
+  bool triangle_upper_;
+  const bool has_structure_;
+  GemmStructure structure_;
 };
 
 // =================================================================================================
@@ -0,0 +1,183 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemvBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemvbatched.hpp"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemvBatched<T>::XgemvBatched(Queue &queue, EventPointer event, const std::string &name):
+    Xgemv<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemvBatched<T>::DoGemvBatched(const Layout layout, const Transpose a_transpose,
+                                    const size_t m, const size_t n,
+                                    const std::vector<T> &alphas,
+                                    const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets,
+                                    const size_t a_ld,
+                                    const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets,
+                                    const size_t x_inc,
+                                    const std::vector<T> &betas,
+                                    const Buffer<T> &y_buffer, const std::vector<size_t> &y_offsets,
+                                    const size_t y_inc,
+                                    const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (alphas.size() != batch_count) || (betas.size() != batch_count) ||
+      (a_offsets.size() != batch_count) || (x_offsets.size() != batch_count) ||
+      (y_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // A single batch can use the regular routine
+  if (batch_count == 1) {
+    DoGemv(layout, a_transpose, m, n, alphas[0], a_buffer, a_offsets[0], a_ld,
+           x_buffer, x_offsets[0], x_inc, betas[0], y_buffer, y_offsets[0], y_inc);
+    return;
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Selects the parameters tuned for this batch count (if any)
+  this->SelectSizeVariant(batch_count);
+
+  // Computes whether or not the matrix has an alternative layout (row or column-major)
+  const auto a_altlayout = (layout == Layout::kRowMajor);
+  const auto a_one = (a_altlayout) ? n : m;
+  const auto a_two = (a_altlayout) ? m : n;
+
+  // Swap m and n if the matrix is transposed
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto m_real = (a_transposed) ? n : m;
+  const auto n_real = (a_transposed) ? m : n;
+
+  // Determines whether the kernel needs to perform rotated access ('^' is the XOR operator)
+  const auto a_rotated = a_transposed ^ a_altlayout;
+
+  // In case of complex data-types, the transpose can also become a conjugate transpose
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+
+  // Tests the matrices and the vectors for validity
+  auto a_offsets_aligned_vw2 = true;
+  auto a_offsets_aligned_vw3 = true;
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(a_one, a_two, a_buffer, a_offsets[batch], a_ld);
+    TestVectorX(n_real, x_buffer, x_offsets[batch], x_inc);
+    TestVectorY(m_real, y_buffer, y_offsets[batch], y_inc);
+    a_offsets_aligned_vw2 &= IsMultiple(a_offsets[batch], this->db_["VW2"]);
+    a_offsets_aligned_vw3 &= IsMultiple(a_offsets[batch], this->db_["VW3"]);
+  }
+
+  // Nothing is computed in case all alphas are zero and all betas are one: y = 1 * y
+  const auto is_zero = [](const T value) { return value == ConstantZero<T>(); };
+  const auto is_one = [](const T value) { return value == ConstantOne<T>(); };
+  if (std::all_of(alphas.begin(), alphas.end(), is_zero) &&
+      std::all_of(betas.begin(), betas.end(), is_one)) {
+    SignalEvent(this->queue_, this->event_, this->input_events_);
+    return;
+  }
+
+  // Determines whether or not the fast-version can be used
+  const auto fast_kernel = a_offsets_aligned_vw2 && (a_rotated == 0) && (a_conjugate == 0) &&
+                           IsMultiple(m_real, this->db_["WGS2"]*this->db_["WPT2"]) &&
+                           IsMultiple(n_real, this->db_["WGS2"]) &&
+                           IsMultiple(a_ld, this->db_["VW2"]);
+  const auto fast_kernel_rot = a_offsets_aligned_vw3 && (a_rotated == 1) && (a_conjugate == 0) &&
+                               IsMultiple(m_real, this->db_["WGS3"]*this->db_["WPT3"]) &&
+                               IsMultiple(n_real, this->db_["WGS3"]) &&
+                               IsMultiple(a_ld, this->db_["VW3"]);
+
+  // Upload the arguments to the device
+  auto a_offsets_int = std::vector<int>(batch_count);
+  auto x_offsets_int = std::vector<int>(batch_count);
+  auto y_offsets_int = std::vector<int>(batch_count);
+  for (auto batch = size_t{ 0 }; batch < batch_count; ++batch) {
+    a_offsets_int[batch] = static_cast<int>(a_offsets[batch]);
+    x_offsets_int[batch] = static_cast<int>(x_offsets[batch]);
+    y_offsets_int[batch] = static_cast<int>(y_offsets[batch]);
+  }
+  auto a_offsets_device = TemporaryBuffer<int>(this->context_, this->queue_, batch_count);
+  auto x_offsets_device = TemporaryBuffer<int>(this->context_, this->queue_, batch_count);
+  auto y_offsets_device = TemporaryBuffer<int>(this->context_, this->queue_, batch_count);
+  auto alphas_device = TemporaryBuffer<T>(this->context_, this->queue_, batch_count);
+  auto betas_device = TemporaryBuffer<T>(this->context_, this->queue_, batch_count);
+  a_offsets_device.Write(this->queue_, batch_count, a_offsets_int);
+  x_offsets_device.Write(this->queue_, batch_count, x_offsets_int);
+  y_offsets_device.Write(this->queue_, batch_count, y_offsets_int);
+  alphas_device.Write(this->queue_, batch_count, alphas);
+  betas_device.Write(this->queue_, batch_count, betas);
+
+  // If possible, run the fast-version (rotated or non-rotated) of the kernel
+  auto kernel_name = std::string{"XgemvBatched"};
+  const auto m_ceiled = Ceil(m_real, this->db_["WGS1"]*this->db_["WPT1"]);
+  auto global_size = m_ceiled / this->db_["WPT1"];
+  auto local_size = this->db_["WGS1"];
+  if (fast_kernel) {
+    kernel_name = "XgemvFastBatched";
+    global_size = m_real / this->db_["WPT2"];
+    local_size = this->db_["WGS2"];
+  }
+  if (fast_kernel_rot) {
+    kernel_name = "XgemvFastRotBatched";
+    global_size = m_real;
+    local_size = this->db_["WGS3"];
+  }
+
+  // Retrieves the Xgemv kernel from the compiled binary
+  auto kernel = GetKernel(this->program_, kernel_name);
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(m_real));
+  kernel.SetArgument(1, static_cast<int>(n_real));
+  kernel.SetArgument(2, alphas_device());
+  kernel.SetArgument(3, betas_device());
+  kernel.SetArgument(4, static_cast<int>(a_rotated));
+  kernel.SetArgument(5, a_buffer());
+  kernel.SetArgument(6, a_offsets_device());
+  kernel.SetArgument(7, static_cast<int>(a_ld));
+  kernel.SetArgument(8, x_buffer());
+  kernel.SetArgument(9, x_offsets_device());
+  kernel.SetArgument(10, static_cast<int>(x_inc));
+  kernel.SetArgument(11, y_buffer());
+  kernel.SetArgument(12, y_offsets_device());
+  kernel.SetArgument(13, static_cast<int>(y_inc));
+  kernel.SetArgument(14, static_cast<int>(a_conjugate));
+
+  // Launches the kernel: the second dimension of the thread-grid iterates over the batches
+  auto global = ThreadRange{global_size, batch_count};
+  auto local = ThreadRange{local_size, 1};
+  RunKernel(kernel, this->queue_, this->device_, global, local, this->event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemvBatched<half>;
+template class XgemvBatched<float>;
+template class XgemvBatched<double>;
+template class XgemvBatched<float2>;
+template class XgemvBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,136 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemvPair class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemvpair.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T> constexpr size_t XgemvPair<T>::kTileColumns;
+template <typename T> constexpr size_t XgemvPair<T>::kTileRowsPerThread;
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemvPair<T>::XgemvPair(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"XgemvFast"}, PrecisionValue<T>(), {}, {
+    KernelSource::kXgemvPair
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemvPair<T>::DoGemvPair(const Layout layout,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                              const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                              const Buffer<T> &w_buffer, const size_t w_offset, const size_t w_inc,
+                              const T beta,
+                              const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                              const Buffer<T> &z_buffer, const size_t z_offset, const size_t z_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix and the vectors for validity: vectors w and z are reported as x and y
+  const auto a_altlayout = (layout == Layout::kRowMajor);
+  const auto a_one = (a_altlayout) ? n : m;
+  const auto a_two = (a_altlayout) ? m : n;
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorX(m, w_buffer, w_offset, w_inc);
+  TestVectorY(m, y_buffer, y_offset, y_inc);
+  TestVectorY(n, z_buffer, z_offset, z_inc);
+
+  // The kernels assume a column-major matrix. For a row-major matrix they see its transpose B = A^T
+  // instead, such that y = A*x = B^T*x and z = A^T*w = B*w: the two products swap roles.
+  const auto &in1_buffer = (a_altlayout) ? w_buffer : x_buffer;
+  const auto in1_offset = (a_altlayout) ? w_offset : x_offset;
+  const auto in1_inc = (a_altlayout) ? w_inc : x_inc;
+  const auto &in2_buffer = (a_altlayout) ? x_buffer : w_buffer;
+  const auto in2_offset = (a_altlayout) ? x_offset : w_offset;
+  const auto in2_inc = (a_altlayout) ? x_inc : w_inc;
+  const auto &out1_buffer = (a_altlayout) ? z_buffer : y_buffer;
+  const auto out1_offset = (a_altlayout) ? z_offset : y_offset;
+  const auto out1_inc = (a_altlayout) ? z_inc : y_inc;
+  const auto &out2_buffer = (a_altlayout) ? y_buffer : z_buffer;
+  const auto out2_offset = (a_altlayout) ? y_offset : z_offset;
+  const auto out2_inc = (a_altlayout) ? y_inc : z_inc;
+
+  // Creates the buffers for the partial results: one vector of 'a_one' values per column-tile and
+  // one vector of 'a_two' values per row-tile
+  const auto tile_rows = db_["WGS2"] * kTileRowsPerThread;
+  const auto num_row_tiles = CeilDiv(a_one, tile_rows);
+  const auto num_col_tiles = CeilDiv(a_two, kTileColumns);
+  auto y_partials = TemporaryBuffer<T>(context_, queue_, num_col_tiles * a_one);
+  auto z_partials = TemporaryBuffer<T>(context_, queue_, num_row_tiles * a_two);
+
+  // Launches the main kernel, which reads each element of matrix A once
+  auto kernel1 = GetKernel(program_, "XgemvPair");
+  kernel1.SetArgument(0, static_cast<int>(a_one));
+  kernel1.SetArgument(1, static_cast<int>(a_two));
+  kernel1.SetArgument(2, a_buffer());
+  kernel1.SetArgument(3, static_cast<int>(a_offset));
+  kernel1.SetArgument(4, static_cast<int>(a_ld));
+  kernel1.SetArgument(5, in1_buffer());
+  kernel1.SetArgument(6, static_cast<int>(in1_offset));
+  kernel1.SetArgument(7, static_cast<int>(in1_inc));
+  kernel1.SetArgument(8, in2_buffer());
+  kernel1.SetArgument(9, static_cast<int>(in2_offset));
+  kernel1.SetArgument(10, static_cast<int>(in2_inc));
+  kernel1.SetArgument(11, y_partials());
+  kernel1.SetArgument(12, z_partials());
+  auto eventWaitList = std::vector<Event>();
+  auto kernelEvent = Event();
+  auto global1 = ThreadRange{num_row_tiles * db_["WGS2"], num_col_tiles};
+  auto local1 = ThreadRange{db_["WGS2"], 1};
+  RunKernel(kernel1, queue_, device_, global1, local1, IntermediateEvent(queue_, kernelEvent));
+  eventWaitList.push_back(kernelEvent);
+
+  // Launches the epilogue kernel, which sums the partial results and applies alpha and beta
+  auto kernel2 = GetKernel(program_, "XgemvPairEpilogue");
+  kernel2.SetArgument(0, static_cast<int>(a_one));
+  kernel2.SetArgument(1, static_cast<int>(a_two));
+  kernel2.SetArgument(2, static_cast<int>(num_row_tiles));
+  kernel2.SetArgument(3, static_cast<int>(num_col_tiles));
+  kernel2.SetArgument(4, GetRealArg(alpha));
+  kernel2.SetArgument(5, GetRealArg(beta));
+  kernel2.SetArgument(6, y_partials());
+  kernel2.SetArgument(7, z_partials());
+  kernel2.SetArgument(8, out1_buffer());
+  kernel2.SetArgument(9, static_cast<int>(out1_offset));
+  kernel2.SetArgument(10, static_cast<int>(out1_inc));
+  kernel2.SetArgument(11, out2_buffer());
+  kernel2.SetArgument(12, static_cast<int>(out2_offset));
+  kernel2.SetArgument(13, static_cast<int>(out2_inc));
+  auto global2 = ThreadRange{Ceil(a_one + a_two, db_["WGS2"])};
+  auto local2 = ThreadRange{db_["WGS2"]};
+  RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemvPair<half>;
+template class XgemvPair<float>;
+template class XgemvPair<double>;
+template class XgemvPair<float2>;
+template class XgemvPair<double2>;
+
+// =================================================================================================
+} // namespace clblast
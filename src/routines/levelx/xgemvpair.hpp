@@ -0,0 +1,53 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemvPair routine. This is a non-blas fused version of two GEMVs with the
+// same matrix: y = alpha*A*x + beta*y and z = alpha*A^T*w + beta*z, such that matrix A is read from
+// memory only once, as needed for e.g. BiCG and Lanczos iterations.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMVPAIR_H_
+#define CLBLAST_ROUTINES_XGEMVPAIR_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemvPair: public Routine {
+ public:
+
+  // Constructor
+  XgemvPair(Queue &queue, EventPointer event, const std::string &name = "GEMVPAIR");
+
+  // Templated-precision implementation of the routine
+  void DoGemvPair(const Layout layout,
+                  const size_t m, const size_t n,
+                  const T alpha,
+                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                  const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                  const Buffer<T> &w_buffer, const size_t w_offset, const size_t w_inc,
+                  const T beta,
+                  const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                  const Buffer<T> &z_buffer, const size_t z_offset, const size_t z_inc);
+
+  // The size of a tile of matrix A processed by one work-group: these have to match the values of
+  // 'PAIR_COLS' and 'PAIR_ROW_TILES' in the kernel
+  static constexpr size_t kTileColumns = 32;
+  static constexpr size_t kTileRowsPerThread = 8;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMVPAIR_H_
+#endif
@@ -0,0 +1,168 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemvQuantized class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemvquantized.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor. Half-precision activations can be accumulated in
+// single precision (see 'AccumulationPrecision').
+template <typename T>
+XgemvQuantized<T>::XgemvQuantized(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"XgemvQuantized"}, AccumulationPrecision(PrecisionValue<T>()), {}, {
+    KernelSource::kXgemvQuantized
+    }) {
+}
+
+// =================================================================================================
+
+// Quantises the weights with a thread per group
+template <typename T>
+void XgemvQuantized<T>::DoQuantizeWeights(const QuantizedFormat format,
+                                          const size_t m, const size_t k, const size_t group_size,
+                                          const Buffer<T> &w_buffer, const size_t w_offset, const size_t w_ld,
+                                          const Buffer<unsigned int> &q_buffer, const size_t q_offset,
+                                          const Buffer<T> &scales_buffer, const size_t scales_offset) {
+  TestQuantizedWeights(format, m, k, group_size, q_buffer, q_offset, scales_buffer, scales_offset);
+  TestMatrixA(k, m, w_buffer, w_offset, w_ld);
+
+  auto kernel = GetKernel(program_, "XquantizeWeights");
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(k));
+  kernel.SetArgument(2, static_cast<int>(group_size));
+  kernel.SetArgument(3, static_cast<int>(format));
+  kernel.SetArgument(4, w_buffer());
+  kernel.SetArgument(5, static_cast<int>(w_offset));
+  kernel.SetArgument(6, static_cast<int>(w_ld));
+  kernel.SetArgument(7, q_buffer());
+  kernel.SetArgument(8, static_cast<int>(q_offset));
+  kernel.SetArgument(9, scales_buffer());
+  kernel.SetArgument(10, static_cast<int>(scales_offset));
+  const auto num_groups = m * (k / group_size);
+  auto global = ThreadRange{Ceil(num_groups, db_["WGSQ"])};
+  auto local = ThreadRange{db_["WGSQ"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// The matrix-vector multiplication is the multiplication with a single column
+template <typename T>
+void XgemvQuantized<T>::DoGemvQuantized(const QuantizedFormat format,
+                                        const size_t m, const size_t k, const size_t group_size,
+                                        const T alpha,
+                                        const Buffer<unsigned int> &q_buffer, const size_t q_offset,
+                                        const Buffer<T> &scales_buffer, const size_t scales_offset,
+                                        const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                                        const T beta,
+                                        const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc) {
+  TestQuantizedWeights(format, m, k, group_size, q_buffer, q_offset, scales_buffer, scales_offset);
+  TestVectorX(k, x_buffer, x_offset, x_inc);
+  TestVectorY(m, y_buffer, y_offset, y_inc);
+  RunQuantizedKernel(format, m, 1, k, group_size, alpha, q_buffer, q_offset,
+                     scales_buffer, scales_offset, x_buffer, x_offset, x_inc, 0,
+                     beta, y_buffer, y_offset, y_inc, 0);
+}
+
+template <typename T>
+void XgemvQuantized<T>::DoGemmQuantized(const QuantizedFormat format,
+                                        const size_t m, const size_t n, const size_t k,
+                                        const size_t group_size,
+                                        const T alpha,
+                                        const Buffer<unsigned int> &q_buffer, const size_t q_offset,
+                                        const Buffer<T> &scales_buffer, const size_t scales_offset,
+                                        const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                                        const T beta,
+                                        const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+  TestQuantizedWeights(format, m, k, group_size, q_buffer, q_offset, scales_buffer, scales_offset);
+  TestMatrixB(k, n, b_buffer, b_offset, b_ld);
+  TestMatrixC(m, n, c_buffer, c_offset, c_ld);
+  RunQuantizedKernel(format, m, n, k, group_size, alpha, q_buffer, q_offset,
+                     scales_buffer, scales_offset, b_buffer, b_offset, 1, b_ld,
+                     beta, c_buffer, c_offset, 1, c_ld);
+}
+
+// =================================================================================================
+
+// Tests the dimensions and the sizes of the buffers with the packed weights and the scales
+template <typename T>
+void XgemvQuantized<T>::TestQuantizedWeights(const QuantizedFormat format,
+                                             const size_t m, const size_t k, const size_t group_size,
+                                             const Buffer<unsigned int> &q_buffer, const size_t q_offset,
+                                             const Buffer<T> &scales_buffer, const size_t scales_offset) {
+  if (format != QuantizedFormat::kInt8 && format != QuantizedFormat::kInt4) {
+    throw BLASError(StatusCode::kInvalidValue, "unsupported quantised format");
+  }
+
+  // The groups consist of whole words and the rows of whole groups
+  const auto values_per_word = size_t{32} / static_cast<size_t>(format);
+  if (m == 0 || k == 0 || group_size == 0 || group_size % values_per_word != 0 ||
+      k % group_size != 0) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+  TestMatrixQuantized(m * k / values_per_word, q_buffer, q_offset,
+                      m * (k / group_size), scales_buffer, scales_offset);
+}
+
+// Launches a work-group per WGSQ rows and QVECTORS columns
+template <typename T>
+void XgemvQuantized<T>::RunQuantizedKernel(const QuantizedFormat format,
+                                           const size_t m, const size_t n, const size_t k,
+                                           const size_t group_size,
+                                           const T alpha,
+                                           const Buffer<unsigned int> &q_buffer, const size_t q_offset,
+                                           const Buffer<T> &scales_buffer, const size_t scales_offset,
+                                           const Buffer<T> &b_buffer, const size_t b_offset,
+                                           const size_t b_inc, const size_t b_ld,
+                                           const T beta,
+                                           const Buffer<T> &c_buffer, const size_t c_offset,
+                                           const size_t c_inc, const size_t c_ld) {
+  const auto kernel_name = (format == QuantizedFormat::kInt8) ? "XgemvQuantizedInt8" :
+                                                                "XgemvQuantizedInt4";
+  auto kernel = GetKernel(program_, kernel_name);
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  kernel.SetArgument(3, static_cast<int>(group_size));
+  kernel.SetArgument(4, GetRealArg(alpha));
+  kernel.SetArgument(5, GetRealArg(beta));
+  kernel.SetArgument(6, q_buffer());
+  kernel.SetArgument(7, static_cast<int>(q_offset));
+  kernel.SetArgument(8, scales_buffer());
+  kernel.SetArgument(9, static_cast<int>(scales_offset));
+  kernel.SetArgument(10, b_buffer());
+  kernel.SetArgument(11, static_cast<int>(b_offset));
+  kernel.SetArgument(12, static_cast<int>(b_inc));
+  kernel.SetArgument(13, static_cast<int>(b_ld));
+  kernel.SetArgument(14, c_buffer());
+  kernel.SetArgument(15, static_cast<int>(c_offset));
+  kernel.SetArgument(16, static_cast<int>(c_inc));
+  kernel.SetArgument(17, static_cast<int>(c_ld));
+  auto global = ThreadRange{Ceil(m, db_["WGSQ"]), CeilDiv(n, db_["QVECTORS"])};
+  auto local = ThreadRange{db_["WGSQ"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemvQuantized<half>;
+template class XgemvQuantized<float>;
+
+// =================================================================================================
+} // namespace clblast
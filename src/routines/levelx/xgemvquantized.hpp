@@ -0,0 +1,89 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemvQuantized routine: matrix-vector and small matrix-matrix
+// multiplication with an m by k matrix of 8-bit or 4-bit quantised weights, dequantised on the fly
+// with a scale per group of weights. The weights are stored row by row and packed in 32-bit words,
+// see the 'xgemv_quantized.opencl' kernel file for the format. It also implements the quantisation
+// of a matrix of regular weights into this format.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMVQUANTIZED_H_
+#define CLBLAST_ROUTINES_XGEMVQUANTIZED_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemvQuantized: public Routine {
+ public:
+
+  // Constructor
+  XgemvQuantized(Queue &queue, EventPointer event, const std::string &name = "GEMVQUANTIZED");
+
+  // Quantises the m by k weights W (row-major with leading dimension 'w_ld') into packed words Q
+  // and 'k / group_size' scales per row
+  void DoQuantizeWeights(const QuantizedFormat format,
+                         const size_t m, const size_t k, const size_t group_size,
+                         const Buffer<T> &w_buffer, const size_t w_offset, const size_t w_ld,
+                         const Buffer<unsigned int> &q_buffer, const size_t q_offset,
+                         const Buffer<T> &scales_buffer, const size_t scales_offset);
+
+  // Matrix-vector multiplication with quantised weights: y = alpha * W * x + beta * y
+  void DoGemvQuantized(const QuantizedFormat format,
+                       const size_t m, const size_t k, const size_t group_size,
+                       const T alpha,
+                       const Buffer<unsigned int> &q_buffer, const size_t q_offset,
+                       const Buffer<T> &scales_buffer, const size_t scales_offset,
+                       const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                       const T beta,
+                       const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc);
+
+  // Matrix-multiplication with quantised weights and column-major k by n B and m by n C:
+  // C = alpha * W * B + beta * C
+  void DoGemmQuantized(const QuantizedFormat format,
+                       const size_t m, const size_t n, const size_t k, const size_t group_size,
+                       const T alpha,
+                       const Buffer<unsigned int> &q_buffer, const size_t q_offset,
+                       const Buffer<T> &scales_buffer, const size_t scales_offset,
+                       const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                       const T beta,
+                       const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+
+ private:
+
+  // Tests the dimensions, the packed weights and the scales for validity
+  void TestQuantizedWeights(const QuantizedFormat format,
+                            const size_t m, const size_t k, const size_t group_size,
+                            const Buffer<unsigned int> &q_buffer, const size_t q_offset,
+                            const Buffer<T> &scales_buffer, const size_t scales_offset);
+
+  // Launches the multiplication kernel on 'n' columns of B and C, with 'b_inc' and 'c_inc' the
+  // increments between their rows
+  void RunQuantizedKernel(const QuantizedFormat format,
+                          const size_t m, const size_t n, const size_t k, const size_t group_size,
+                          const T alpha,
+                          const Buffer<unsigned int> &q_buffer, const size_t q_offset,
+                          const Buffer<T> &scales_buffer, const size_t scales_offset,
+                          const Buffer<T> &b_buffer, const size_t b_offset,
+                          const size_t b_inc, const size_t b_ld,
+                          const T beta,
+                          const Buffer<T> &c_buffer, const size_t c_offset,
+                          const size_t c_inc, const size_t c_ld);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMVQUANTIZED_H_
+#endif
@@ -0,0 +1,160 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemvStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemvstridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemvStridedBatched<T>::XgemvStridedBatched(Queue &queue, EventPointer event,
+                                            const std::string &name):
+    Xgemv<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemvStridedBatched<T>::DoGemvStridedBatched(const Layout layout, const Transpose a_transpose,
+                                                  const size_t m, const size_t n,
+                                                  const T alpha,
+                                                  const Buffer<T> &a_buffer, const size_t a_offset,
+                                                  const size_t a_ld, const size_t a_stride,
+                                                  const Buffer<T> &x_buffer, const size_t x_offset,
+                                                  const size_t x_inc, const size_t x_stride,
+                                                  const T beta,
+                                                  const Buffer<T> &y_buffer, const size_t y_offset,
+                                                  const size_t y_inc, const size_t y_stride,
+                                                  const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count == 0) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // A single batch can use the regular routine
+  if (batch_count == 1) {
+    DoGemv(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld,
+           x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc);
+    return;
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Selects the parameters tuned for this batch count (if any)
+  this->SelectSizeVariant(batch_count);
+
+  // Computes whether or not the matrix has an alternative layout (row or column-major)
+  const auto a_altlayout = (layout == Layout::kRowMajor);
+  const auto a_one = (a_altlayout) ? n : m;
+  const auto a_two = (a_altlayout) ? m : n;
+
+  // Swap m and n if the matrix is transposed
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto m_real = (a_transposed) ? n : m;
+  const auto n_real = (a_transposed) ? m : n;
+
+  // Determines whether the kernel needs to perform rotated access ('^' is the XOR operator)
+  const auto a_rotated = a_transposed ^ a_altlayout;
+
+  // In case of complex data-types, the transpose can also become a conjugate transpose
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+
+  // Tests the matrices and the vectors for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(a_one, a_two, a_buffer, a_offset + a_stride * batch, a_ld);
+    TestVectorX(n_real, x_buffer, x_offset + x_stride * batch, x_inc);
+    TestVectorY(m_real, y_buffer, y_offset + y_stride * batch, y_inc);
+  }
+
+  // With a zero alpha, only the vectors y are scaled by beta (see 'MatVec')
+  if (this->IsScaleOnly(alpha, beta)) {
+    this->ScaleOnly(m_real, beta, y_buffer, y_offset, y_inc, y_stride, batch_count);
+    return;
+  }
+
+  // Determines whether or not the fast-version can be used
+  const auto fast_kernel = IsMultiple(a_offset, this->db_["VW2"]) &&
+                           IsMultiple(a_stride, this->db_["VW2"]) &&
+                           (a_rotated == 0) && (a_conjugate == 0) &&
+                           IsMultiple(m_real, this->db_["WGS2"]*this->db_["WPT2"]) &&
+                           IsMultiple(n_real, this->db_["WGS2"]) &&
+                           IsMultiple(a_ld, this->db_["VW2"]);
+  const auto fast_kernel_rot = IsMultiple(a_offset, this->db_["VW3"]) &&
+                               IsMultiple(a_stride, this->db_["VW3"]) &&
+                               (a_rotated == 1) && (a_conjugate == 0) &&
+                               IsMultiple(m_real, this->db_["WGS3"]*this->db_["WPT3"]) &&
+                               IsMultiple(n_real, this->db_["WGS3"]) &&
+                               IsMultiple(a_ld, this->db_["VW3"]);
+
+  // If possible, run the fast-version (rotated or non-rotated) of the kernel
+  auto kernel_name = std::string{"XgemvStridedBatched"};
+  const auto m_ceiled = Ceil(m_real, this->db_["WGS1"]*this->db_["WPT1"]);
+  auto global_size = m_ceiled / this->db_["WPT1"];
+  auto local_size = this->db_["WGS1"];
+  if (fast_kernel) {
+    kernel_name = "XgemvFastStridedBatched";
+    global_size = m_real / this->db_["WPT2"];
+    local_size = this->db_["WGS2"];
+  }
+  if (fast_kernel_rot) {
+    kernel_name = "XgemvFastRotStridedBatched";
+    global_size = m_real;
+    local_size = this->db_["WGS3"];
+  }
+
+  // Retrieves the Xgemv kernel from the compiled binary
+  auto kernel = GetKernel(this->program_, kernel_name);
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(m_real));
+  kernel.SetArgument(1, static_cast<int>(n_real));
+  kernel.SetArgument(2, GetRealArg(alpha));
+  kernel.SetArgument(3, GetRealArg(beta));
+  kernel.SetArgument(4, static_cast<int>(a_rotated));
+  kernel.SetArgument(5, a_buffer());
+  kernel.SetArgument(6, static_cast<int>(a_offset));
+  kernel.SetArgument(7, static_cast<int>(a_ld));
+  kernel.SetArgument(8, static_cast<int>(a_stride));
+  kernel.SetArgument(9, x_buffer());
+  kernel.SetArgument(10, static_cast<int>(x_offset));
+  kernel.SetArgument(11, static_cast<int>(x_inc));
+  kernel.SetArgument(12, static_cast<int>(x_stride));
+  kernel.SetArgument(13, y_buffer());
+  kernel.SetArgument(14, static_cast<int>(y_offset));
+  kernel.SetArgument(15, static_cast<int>(y_inc));
+  kernel.SetArgument(16, static_cast<int>(y_stride));
+  kernel.SetArgument(17, static_cast<int>(a_conjugate));
+
+  // Launches the kernel: the second dimension of the thread-grid iterates over the batches
+  auto global = ThreadRange{global_size, batch_count};
+  auto local = ThreadRange{local_size, 1};
+  RunKernel(kernel, this->queue_, this->device_, global, local, this->event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemvStridedBatched<half>;
+template class XgemvStridedBatched<float>;
+template class XgemvStridedBatched<double>;
+template class XgemvStridedBatched<float2>;
+template class XgemvStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,105 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgerk class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgerk.hpp"
+#include "routines/level2/xger.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xgerk<T>::Xgerk(Queue &queue, EventPointer event, const std::string &name):
+    Xgemm<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xgerk<T>::DoGerk(const Layout layout,
+                      const size_t m, const size_t n, const size_t k,
+                      const T alpha,
+                      const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                      const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0 || k == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix and the first and last pairs of vectors for validity, as done by Xger
+  const auto a_is_rowmajor = (layout == Layout::kRowMajor);
+  const auto a_one = (a_is_rowmajor) ? n : m;
+  const auto a_two = (a_is_rowmajor) ? m : n;
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestVectorX(m, x_buffer, x_offset, x_inc);
+  TestVectorY(n, y_buffer, y_offset, y_inc);
+  TestVectorX(m, x_buffer, x_offset + (k - 1) * x_stride, x_inc);
+  TestVectorY(n, y_buffer, y_offset + (k - 1) * y_stride, y_inc);
+
+  // The problem in column-major terms: a row-major A is a column-major A^T = alpha * Y * X^T + A^T,
+  // such that the roles of the 'x' and 'y' vectors are swapped
+  const auto u_inc = (a_is_rowmajor) ? y_inc : x_inc;
+  const auto u_stride = (a_is_rowmajor) ? y_stride : x_stride;
+  const auto v_inc = (a_is_rowmajor) ? x_inc : y_inc;
+  const auto v_stride = (a_is_rowmajor) ? x_stride : y_stride;
+
+  // The vectors 'u' form the 'a_one' by k matrix U: either as a column-major matrix with the
+  // vectors as columns or as a transposed one with the vectors as rows. The same holds for the
+  // transposed k by 'a_two' matrix V^T.
+  const auto u_as_columns = (u_inc == 1 && u_stride >= a_one);
+  const auto u_as_rows = (u_stride == 1 && u_inc >= k);
+  const auto v_as_columns = (v_inc == 1 && v_stride >= a_two);
+  const auto v_as_rows = (v_stride == 1 && v_inc >= k);
+
+  // Falls back to one rank-1 update per pair of vectors if they don't form matrices, e.g. for k = 1
+  if (k == 1 || !(u_as_columns || u_as_rows) || !(v_as_columns || v_as_rows)) {
+    for (auto i = size_t{0}; i < k; ++i) {
+      auto ger_event = Event();
+      auto ger = Xger<T>(queue_, (i == k - 1) ? event_ : IntermediateEvent(queue_, ger_event));
+      ger.DoGer(layout, m, n, alpha,
+                x_buffer, x_offset + i * x_stride, x_inc,
+                y_buffer, y_offset + i * y_stride, y_inc,
+                a_buffer, a_offset, a_ld);
+    }
+    return;
+  }
+
+  // Runs the rank-k update as a single GEMM: A = alpha * U * (V^T) + A in column-major
+  const auto u_offset = (a_is_rowmajor) ? y_offset : x_offset;
+  const auto v_offset = (a_is_rowmajor) ? x_offset : y_offset;
+  const auto &u_buffer = (a_is_rowmajor) ? y_buffer : x_buffer;
+  const auto &v_buffer = (a_is_rowmajor) ? x_buffer : y_buffer;
+  DoGemm(Layout::kColMajor,
+         (u_as_columns) ? Transpose::kNo : Transpose::kYes,
+         (v_as_rows) ? Transpose::kNo : Transpose::kYes,
+         a_one, a_two, k, alpha,
+         u_buffer, u_offset, (u_as_columns) ? u_stride : u_inc,
+         v_buffer, v_offset, (v_as_rows) ? v_inc : v_stride, ConstantOne<T>(),
+         a_buffer, a_offset, a_ld);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xgerk<half>;
+template class Xgerk<float>;
+template class Xgerk<double>;
+template class Xgerk<float2>;
+template class Xgerk<double2>;
+
+// =================================================================================================
+} // namespace clblast
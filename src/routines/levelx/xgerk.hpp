@@ -0,0 +1,51 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgerk routine: the accumulation of k general rank-1 updates of the same
+// matrix A. If the k pairs of vectors form two matrices X (m by k) and Y (n by k), the updates are
+// applied by a single GEMM A = alpha * X * Y^T + A, such that A is read and written only once
+// instead of once per update. Otherwise, the routine falls back to k calls to the regular Xger.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGERK_H_
+#define CLBLAST_ROUTINES_XGERK_H_
+
+#include "routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xgerk: public Xgemm<T> {
+ public:
+
+  // Uses methods and variables the regular Xgemm routine
+  using Xgemm<T>::queue_;
+  using Xgemm<T>::event_;
+  using Xgemm<T>::DoGemm;
+
+  // Constructor
+  Xgerk(Queue &queue, EventPointer event, const std::string &name = "GERK");
+
+  // Templated-precision implementation of the routine
+  void DoGerk(const Layout layout,
+              const size_t m, const size_t n, const size_t k,
+              const T alpha,
+              const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+              const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGERK_H_
+#endif
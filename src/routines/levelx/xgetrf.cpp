@@ -0,0 +1,127 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgetrf class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgetrf.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T> constexpr size_t Xgetrf<T>::kMaxSize;
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xgetrf<T>::Xgetrf(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {}, {
+    KernelSource::kXgetrf
+    }) {
+}
+
+// =================================================================================================
+
+// The factorisation
+template <typename T>
+void Xgetrf<T>::DoGetrfStridedBatched(const Layout layout, const size_t n,
+                                      const Buffer<T> &a_buffer, const size_t a_offset,
+                                      const size_t a_ld, const size_t a_stride,
+                                      const Buffer<unsigned int> &ipiv_buffer,
+                                      const size_t ipiv_offset, const size_t ipiv_stride,
+                                      const size_t batch_count) {
+
+  // Makes sure all dimensions are larger than zero and the matrices are small enough
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+  if (n > kMaxSize) { throw BLASError(StatusCode::kNotImplemented); }
+  if (batch_count == 0) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // Tests the matrices and the pivot vectors for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(n, n, a_buffer, a_offset + a_stride * batch, a_ld);
+    TestVectorIndex(n, ipiv_buffer, ipiv_offset + ipiv_stride * batch);
+  }
+
+  // Launches a work-group per matrix
+  auto kernel = GetKernel(program_, "XgetrfLocal");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, static_cast<int>(layout == Layout::kRowMajor));
+  kernel.SetArgument(2, a_buffer());
+  kernel.SetArgument(3, static_cast<int>(a_offset));
+  kernel.SetArgument(4, static_cast<int>(a_ld));
+  kernel.SetArgument(5, static_cast<int>(a_stride));
+  kernel.SetArgument(6, ipiv_buffer());
+  kernel.SetArgument(7, static_cast<int>(ipiv_offset));
+  kernel.SetArgument(8, static_cast<int>(ipiv_stride));
+  const auto global = ThreadRange{kMaxSize, batch_count};
+  const auto local = ThreadRange{kMaxSize, 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// The solve
+template <typename T>
+void Xgetrf<T>::DoGetrsStridedBatched(const Layout layout, const size_t n, const size_t nrhs,
+                                      const Buffer<T> &a_buffer, const size_t a_offset,
+                                      const size_t a_ld, const size_t a_stride,
+                                      const Buffer<unsigned int> &ipiv_buffer,
+                                      const size_t ipiv_offset, const size_t ipiv_stride,
+                                      const Buffer<T> &b_buffer, const size_t b_offset,
+                                      const size_t b_ld, const size_t b_stride,
+                                      const size_t batch_count) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((n == 0) || (nrhs == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+  if (batch_count == 0) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // Tests the matrices and the pivot vectors for validity
+  const auto row_major = (layout == Layout::kRowMajor);
+  const auto b_one = (row_major) ? nrhs : n;
+  const auto b_two = (row_major) ? n : nrhs;
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(n, n, a_buffer, a_offset + a_stride * batch, a_ld);
+    TestVectorIndex(n, ipiv_buffer, ipiv_offset + ipiv_stride * batch);
+    TestMatrixB(b_one, b_two, b_buffer, b_offset + b_stride * batch, b_ld);
+  }
+
+  // Launches a thread per right-hand side
+  auto kernel = GetKernel(program_, "XgetrsColumn");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, static_cast<int>(nrhs));
+  kernel.SetArgument(2, static_cast<int>(row_major));
+  kernel.SetArgument(3, a_buffer());
+  kernel.SetArgument(4, static_cast<int>(a_offset));
+  kernel.SetArgument(5, static_cast<int>(a_ld));
+  kernel.SetArgument(6, static_cast<int>(a_stride));
+  kernel.SetArgument(7, ipiv_buffer());
+  kernel.SetArgument(8, static_cast<int>(ipiv_offset));
+  kernel.SetArgument(9, static_cast<int>(ipiv_stride));
+  kernel.SetArgument(10, b_buffer());
+  kernel.SetArgument(11, static_cast<int>(b_offset));
+  kernel.SetArgument(12, static_cast<int>(b_ld));
+  kernel.SetArgument(13, static_cast<int>(b_stride));
+  const auto global = ThreadRange{Ceil(nrhs, db_["WGS1"]), batch_count};
+  const auto local = ThreadRange{db_["WGS1"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xgetrf<float>;
+template class Xgetrf<double>;
+template class Xgetrf<float2>;
+template class Xgetrf<double2>;
+
+// =================================================================================================
+} // namespace clblast
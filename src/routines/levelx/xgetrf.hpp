@@ -0,0 +1,58 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgetrf routine: the LU factorisation with partial pivoting of a strided
+// batch of small square matrices (GETRF) and the corresponding solve (GETRS). Each matrix is
+// factorised by a single work-group, such that the whole batch takes a single kernel launch.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGETRF_H_
+#define CLBLAST_ROUTINES_XGETRF_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xgetrf: public Routine {
+ public:
+
+  // Constructor
+  Xgetrf(Queue &queue, EventPointer event, const std::string &name = "GETRFSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the factorisation
+  void DoGetrfStridedBatched(const Layout layout, const size_t n,
+                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                             const size_t a_stride,
+                             const Buffer<unsigned int> &ipiv_buffer, const size_t ipiv_offset,
+                             const size_t ipiv_stride,
+                             const size_t batch_count);
+
+  // Templated-precision implementation of the solve
+  void DoGetrsStridedBatched(const Layout layout, const size_t n, const size_t nrhs,
+                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                             const size_t a_stride,
+                             const Buffer<unsigned int> &ipiv_buffer, const size_t ipiv_offset,
+                             const size_t ipiv_stride,
+                             const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                             const size_t b_stride,
+                             const size_t batch_count);
+
+  // The maximum matrix size, this should match the GETRF_MAX_SIZE of the kernel
+  static constexpr size_t kMaxSize = 64;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGETRF_H_
+#endif
@@ -8,21 +8,25 @@
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
 // This file implements the Xhad routine. The precision is implemented using a template argument.
+// This is the elementwise routine (see 'xelementwise.hpp') for the expression f(x,y) = x.*y.
 //
 // =================================================================================================
 
 #ifndef CLBLAST_ROUTINES_XHAD_H_
 #define CLBLAST_ROUTINES_XHAD_H_
 
-#include "routine.hpp"
+#include "routines/levelx/xelementwise.hpp"
 
 namespace clblast {
 // =================================================================================================
 
 // See comment at top of file for a description of the class
 template <typename T>
-class Xhad: public Routine {
-public:
+class Xhad: public Xelementwise<T> {
+ public:
+
+  // Uses the generalised elementwise routine
+  using Xelementwise<T>::DoElementwise;
 
   // Constructor
   Xhad(Queue &queue, EventPointer event, const std::string &name = "HAD");
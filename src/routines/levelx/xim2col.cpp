@@ -22,8 +22,8 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xim2col<T>::Xim2col(Queue &queue, EventPointer event, const std::string &name):
-        Routine(queue, event, name, {"Copy"}, PrecisionValue<T>(), {}, {
-#include "../../kernels/levelx/im2col.opencl"
+        Routine(queue, event, name, {"Xim2col"}, PrecisionValue<T>(), {}, {
+        KernelSource::kIm2col
         }) {
 }
 
@@ -37,10 +37,44 @@ void Xim2col<T>::DoIm2col(const size_t channels, const size_t height, const size
                           const size_t dilation_h, const size_t dilation_w,
                           const Buffer<T> &im_buffer, const size_t im_offset,
                           const Buffer<T> &col_buffer, const size_t col_offset) {
+  BatchedIm2col(false, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w,
+                dilation_h, dilation_w, im_buffer, im_offset, 0, col_buffer, col_offset, 0, 1);
+}
+
+// The channels-last version of the routine
+template <typename T>
+void Xim2col<T>::DoIm2colChannelsLast(const size_t channels, const size_t height, const size_t width,
+                                      const size_t kernel_h, const size_t kernel_w, const size_t pad_h,
+                                      const size_t pad_w, const size_t stride_h, const size_t stride_w,
+                                      const size_t dilation_h, const size_t dilation_w,
+                                      const Buffer<T> &im_buffer, const size_t im_offset,
+                                      const size_t im_stride,
+                                      const Buffer<T> &col_buffer, const size_t col_offset,
+                                      const size_t col_stride,
+                                      const size_t batch_count) {
+  BatchedIm2col(true, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w,
+                dilation_h, dilation_w, im_buffer, im_offset, im_stride,
+                col_buffer, col_offset, col_stride, batch_count);
+}
+
+// =================================================================================================
+
+template <typename T>
+void Xim2col<T>::BatchedIm2col(const bool channels_last,
+                               const size_t channels, const size_t height, const size_t width,
+                               const size_t kernel_h, const size_t kernel_w, const size_t pad_h,
+                               const size_t pad_w, const size_t stride_h, const size_t stride_w,
+                               const size_t dilation_h, const size_t dilation_w,
+                               const Buffer<T> &im_buffer, const size_t im_offset, const size_t im_stride,
+                               const Buffer<T> &col_buffer, const size_t col_offset, const size_t col_stride,
+                               const size_t batch_count) {
 
   // Makes sure all dimensions are larger than zero
   if ((channels == 0) || (height == 0) || (width == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
 
+  // Tests for a valid batch count
+  if (batch_count == 0) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
   // Sets the output height and width
   const auto size_h = height + 2 * pad_h;
   const auto padding_h = dilation_h * (kernel_h - 1) + 1;
@@ -49,8 +83,16 @@ void Xim2col<T>::DoIm2col(const size_t channels, const size_t height, const size
   const auto padding_w = dilation_w * (kernel_w - 1) + 1;
   const auto output_w = (size_w >= padding_w) ? (size_w - padding_w) / stride_w + 1 : 1;
 
-  // Retrieves the Xcopy kernel from the compiled binary
-  auto kernel = Kernel(program_, "im2col");
+  // Tests the buffers for validity: the image and the col matrix of each batch are a single column
+  const auto im_size = height * width * channels;
+  const auto col_size = output_h * output_w * kernel_h * kernel_w * channels;
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(im_size, 1, im_buffer, im_offset + im_stride * batch, im_size);
+    TestMatrixC(col_size, 1, col_buffer, col_offset + col_stride * batch, col_size);
+  }
+
+  // Retrieves the im2col kernel from the compiled binary
+  auto kernel = GetKernel(program_, (channels_last) ? "im2colChannelsLast" : "im2col");
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(height));
@@ -68,15 +110,26 @@ void Xim2col<T>::DoIm2col(const size_t channels, const size_t height, const size
   kernel.SetArgument(12, static_cast<int>(dilation_w));
   kernel.SetArgument(13, im_buffer());
   kernel.SetArgument(14, static_cast<int>(im_offset));
-  kernel.SetArgument(15, col_buffer());
-  kernel.SetArgument(16, static_cast<int>(col_offset));
-
-  // Launches the kernel
-  const auto w_ceiled = Ceil(output_w, db_["COPY_DIMX"]);
-  const auto h_ceiled = Ceil(output_h, db_["COPY_DIMY"]);
-  const auto global = std::vector<size_t>{w_ceiled, h_ceiled * channels};
-  const auto local = std::vector<size_t>{db_["COPY_DIMX"], db_["COPY_DIMY"]};
-  RunKernel(kernel, queue_, device_, global, local, event_);
+  kernel.SetArgument(15, static_cast<int>(im_stride));
+  kernel.SetArgument(16, col_buffer());
+  kernel.SetArgument(17, static_cast<int>(col_offset));
+  kernel.SetArgument(18, static_cast<int>(col_stride));
+
+  // Launches the kernel: the third dimension of the thread-grid iterates over the batches. In the
+  // channels-last case the first dimension is the channel and the second one the patch.
+  const auto local = ThreadRange{db_["COPY_DIMX"], db_["COPY_DIMY"], 1};
+  if (channels_last) {
+    const auto c_ceiled = Ceil(channels, db_["COPY_DIMX"]);
+    const auto patches_ceiled = Ceil(output_h * output_w, db_["COPY_DIMY"]);
+    const auto global = ThreadRange{c_ceiled, patches_ceiled, batch_count};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+  }
+  else {
+    const auto w_ceiled = Ceil(output_w, db_["COPY_DIMX"]);
+    const auto h_ceiled = Ceil(output_h, db_["COPY_DIMY"]);
+    const auto global = ThreadRange{w_ceiled, h_ceiled * channels, batch_count};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+  }
 }
 
 // =================================================================================================
@@ -8,6 +8,8 @@
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
 // This file implements the Xim2col routine. The precision is implemented using a template argument.
+// Next to the regular routine for an image in CHW layout, it supports images in HWC layout and
+// strided batches of images, both processed by a single kernel launch.
 //
 // =================================================================================================
 
@@ -35,6 +37,30 @@ class Xim2col: public Routine {
                 const size_t dilation_h, const size_t dilation_w,
                 const Buffer<T> &im_buffer, const size_t im_offset,
                 const Buffer<T> &col_buffer, const size_t col_offset);
+
+  // As above, but for a strided batch of images in HWC layout. The col matrix of each image holds
+  // a row per patch, with the channels as the fastest-changing dimension.
+  void DoIm2colChannelsLast(const size_t channels, const size_t height, const size_t width,
+                            const size_t kernel_h, const size_t kernel_w,
+                            const size_t pad_h, const size_t pad_w,
+                            const size_t stride_h, const size_t stride_w,
+                            const size_t dilation_h, const size_t dilation_w,
+                            const Buffer<T> &im_buffer, const size_t im_offset, const size_t im_stride,
+                            const Buffer<T> &col_buffer, const size_t col_offset, const size_t col_stride,
+                            const size_t batch_count);
+
+ protected:
+
+  // Shared implementation of the regular, the channels-last and the strided-batched versions
+  void BatchedIm2col(const bool channels_last,
+                     const size_t channels, const size_t height, const size_t width,
+                     const size_t kernel_h, const size_t kernel_w,
+                     const size_t pad_h, const size_t pad_w,
+                     const size_t stride_h, const size_t stride_w,
+                     const size_t dilation_h, const size_t dilation_w,
+                     const Buffer<T> &im_buffer, const size_t im_offset, const size_t im_stride,
+                     const Buffer<T> &col_buffer, const size_t col_offset, const size_t col_stride,
+                     const size_t batch_count);
 };
 
 // =================================================================================================
@@ -0,0 +1,60 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xim2colStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xim2colstridedbatched.hpp"
+
+#include <string>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xim2colStridedBatched<T>::Xim2colStridedBatched(Queue &queue, EventPointer event,
+                                                const std::string &name):
+    Xim2col<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine: all batches are processed by a single kernel launch
+template <typename T>
+void Xim2colStridedBatched<T>::DoIm2colStridedBatched(const size_t channels, const size_t height,
+                                                      const size_t width, const size_t kernel_h,
+                                                      const size_t kernel_w, const size_t pad_h,
+                                                      const size_t pad_w, const size_t stride_h,
+                                                      const size_t stride_w, const size_t dilation_h,
+                                                      const size_t dilation_w,
+                                                      const Buffer<T> &im_buffer, const size_t im_offset,
+                                                      const size_t im_stride,
+                                                      const Buffer<T> &col_buffer, const size_t col_offset,
+                                                      const size_t col_stride,
+                                                      const size_t batch_count) {
+  Xim2col<T>::BatchedIm2col(false, channels, height, width, kernel_h, kernel_w, pad_h, pad_w,
+                            stride_h, stride_w, dilation_h, dilation_w,
+                            im_buffer, im_offset, im_stride,
+                            col_buffer, col_offset, col_stride, batch_count);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xim2colStridedBatched<half>;
+template class Xim2colStridedBatched<float>;
+template class Xim2colStridedBatched<double>;
+template class Xim2colStridedBatched<float2>;
+template class Xim2colStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
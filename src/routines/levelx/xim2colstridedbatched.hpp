@@ -0,0 +1,47 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xim2colStridedBatched routine. This is a non-blas batched version of
+// IM2COL, it is based on the Xim2col class.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XIM2COLSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XIM2COLSTRIDEDBATCHED_H_
+
+#include "routines/levelx/xim2col.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xim2colStridedBatched: public Xim2col<T> {
+ public:
+
+  // Constructor
+  Xim2colStridedBatched(Queue &queue, EventPointer event,
+                        const std::string &name = "IM2COLSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoIm2colStridedBatched(const size_t channels, const size_t height, const size_t width,
+                              const size_t kernel_h, const size_t kernel_w,
+                              const size_t pad_h, const size_t pad_w,
+                              const size_t stride_h, const size_t stride_w,
+                              const size_t dilation_h, const size_t dilation_w,
+                              const Buffer<T> &im_buffer, const size_t im_offset, const size_t im_stride,
+                              const Buffer<T> &col_buffer, const size_t col_offset, const size_t col_stride,
+                              const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XIM2COLSTRIDEDBATCHED_H_
+#endif
@@ -0,0 +1,116 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Ximatcopy class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/ximatcopy.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Ximatcopy<T>::Ximatcopy(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Copy","Pad","Transpose","Padtranspose"}, PrecisionValue<T>(), {}, {
+    KernelSource::kLevel3,
+    KernelSource::kCopyFast,
+    KernelSource::kCopyPad,
+    KernelSource::kTransposeFast,
+    KernelSource::kTransposePad,
+    KernelSource::kTransposeInplace
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Ximatcopy<T>::DoImatcopy(const Layout layout, const Transpose a_transpose,
+                              const size_t m, const size_t n, const T alpha,
+                              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                              const size_t b_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Determines whether to transpose the matrix A. As for Xomatcopy, a conjugate transpose is
+  // performed as a regular transpose.
+  const auto transpose = (a_transpose != Transpose::kNo);
+
+  // Computes the dimensions of the matrix before (A) and after (B) the operation
+  const auto rotated = (layout == Layout::kRowMajor);
+  const auto a_one = (rotated) ? n : m;
+  const auto a_two = (rotated) ? m : n;
+  const auto b_one = (transpose) ? a_two : a_one;
+  const auto b_two = (transpose) ? a_one : a_two;
+
+  // Tests the matrix for validity, both with its input and with its output leading dimension
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestMatrixB(b_one, b_two, a_buffer, a_offset, b_ld);
+
+  // A square transpose is done in-place by swapping pairs of tiles
+  if (transpose && a_one == a_two && a_ld == b_ld) {
+    const auto tile_size = db_["PADTRA_WPT"] * db_["PADTRA_TILE"];
+    const auto num_tiles = CeilDiv(a_one, tile_size);
+    auto kernel = GetKernel(program_, "TransposeMatrixInPlace");
+    kernel.SetArgument(0, static_cast<int>(a_one));
+    kernel.SetArgument(1, static_cast<int>(a_ld));
+    kernel.SetArgument(2, static_cast<int>(a_offset));
+    kernel.SetArgument(3, a_buffer());
+    kernel.SetArgument(4, GetRealArg(alpha));
+    const auto global = ThreadRange{num_tiles * db_["PADTRA_TILE"],
+                                            num_tiles * db_["PADTRA_TILE"]};
+    const auto local = ThreadRange{db_["PADTRA_TILE"], db_["PADTRA_TILE"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+    return;
+  }
+
+  // A copy with an unchanged leading dimension only scales the matrix: each value is read and
+  // written by the same thread, such that this can also be done in-place
+  auto emptyEventList = std::vector<Event>();
+  if (!transpose && a_ld == b_ld) {
+    PadCopyTransposeMatrix(queue_, device_, db_, event_, emptyEventList,
+                           a_one, a_two, a_ld, a_offset, a_buffer,
+                           a_one, a_two, a_ld, a_offset, a_buffer,
+                           alpha, program_, false, false, false);
+    return;
+  }
+
+  // Otherwise the matrix is first copied into a temporary buffer, from which it is transposed or
+  // copied back into its new layout
+  auto a_temp = TemporaryBuffer<T>(context_, queue_, a_one * a_two);
+  auto eventWaitList = std::vector<Event>();
+  auto eventCopy = Event();
+  PadCopyTransposeMatrix(queue_, device_, db_, IntermediateEvent(queue_, eventCopy), emptyEventList,
+                         a_one, a_two, a_ld, a_offset, a_buffer,
+                         a_one, a_two, a_one, 0, a_temp,
+                         ConstantOne<T>(), program_, false, false, false);
+  eventWaitList.push_back(eventCopy);
+  PadCopyTransposeMatrix(queue_, device_, db_, event_, eventWaitList,
+                         a_one, a_two, a_one, 0, a_temp,
+                         b_one, b_two, b_ld, a_offset, a_buffer,
+                         alpha, program_, false, transpose, false);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Ximatcopy<half>;
+template class Ximatcopy<float>;
+template class Ximatcopy<double>;
+template class Ximatcopy<float2>;
+template class Ximatcopy<double2>;
+
+// =================================================================================================
+} // namespace clblast
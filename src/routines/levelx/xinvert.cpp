@@ -27,11 +27,10 @@ namespace clblast {
 template <typename T>
 Xinvert<T>::Xinvert(Queue &queue, EventPointer event, const std::string &name):
     Routine(queue, event, name, {"Invert"}, PrecisionValue<T>(), {}, {
-      #include "../../kernels/level3/level3.opencl"
-      , // separated in multiple parts to prevent C1091 in MSVC 2013
-      #include "../../kernels/level3/invert_diagonal_blocks_part1.opencl"
-      , // separated in multiple parts to prevent C1091 in MSVC 2013
-      #include "../../kernels/level3/invert_diagonal_blocks_part2.opencl"
+      KernelSource::kLevel3,
+      KernelSource::kInvertDiagonalBlocksPart1,
+      KernelSource::kInvertDiagonalBlocksPart2,
+      KernelSource::kInvertDiagonalBlocksEnqueue
     }) {
 }
 
@@ -43,11 +42,28 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
                                             const size_t n, const size_t block_size,
                                             const Buffer<T> &src, const size_t offset, const size_t ld_src,
                                             Buffer<T> &dest) {
+  InvertMatrixDiagonalBlocksBatched(layout, triangle, diag, n, block_size, src, offset, ld_src, 0,
+                                    dest, 1);
+}
+
+// =================================================================================================
+
+// Inverts diagonal square blocks of a batch of matrices
+template <typename T>
+void Xinvert<T>::InvertMatrixDiagonalBlocksBatched(const Layout layout, const Triangle triangle,
+                                                   const Diagonal diag,
+                                                   const size_t n, const size_t block_size,
+                                                   const Buffer<T> &src, const size_t offset,
+                                                   const size_t ld_src, const size_t src_stride,
+                                                   Buffer<T> &dest, const size_t batch_count) {
 
   // Makes sure all dimensions are larger than zero
   if ((block_size == 0) || (n == 0)) {
     throw BLASError(StatusCode::kInvalidDimension);
   }
+  if (batch_count == 0) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
 
   // Helper variables
   const auto internal_block_size = static_cast<size_t>(db_["INTERNAL_BLOCK_SIZE"]);
@@ -55,6 +71,7 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
   const auto num_blocks = CeilDiv(n, block_size);
   const auto num_internal_blocks = CeilDiv(n, internal_block_size);
   const auto unit_diagonal = (diag == Diagonal::kUnit) ? true : false;
+  const auto dest_stride = num_blocks * block_size * block_size;
 
   // This routine only supports block sizes which are a multiple of the internal block size and
   // block sizes up to and including 128
@@ -63,8 +80,10 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
   }
 
   // Checks for validity of the source and destination matrices
-  TestMatrixA(n, n, src, offset, ld_src);
-  TestMatrixB(block_size, num_blocks * block_size, dest, 0, block_size);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(n, n, src, offset + batch * src_stride, ld_src);
+  }
+  TestMatrixB(block_size, batch_count * num_blocks * block_size, dest, 0, block_size);
 
   // Determines which kernels to run based on the layout (the kernels assume column-major as
   // default) and on whether we are dealing with an upper or lower triangle of the triangular matrix
@@ -75,12 +94,14 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
   // Fills the output buffer with zeros
   auto event_wait_list = std::vector<Event>();
   auto fill_matrix_event = Event();
-  FillMatrix(queue_, device_, program_, db_, fill_matrix_event.pointer(), event_wait_list,
-             block_size, num_blocks * block_size, block_size, 0, dest, ConstantZero<T>());
+  FillMatrix(queue_, device_, program_, db_,
+             IntermediateEvent(queue_, fill_matrix_event), event_wait_list,
+             block_size, batch_count * num_blocks * block_size, block_size, 0, dest,
+             ConstantZero<T>());
   event_wait_list.push_back(fill_matrix_event);
 
   // Inverts the diagonal IB by IB inner blocks of the matrix: one block per work-group
-  auto kernel = Kernel(program_, "InvertDiagonalBlock");
+  auto kernel = GetKernel(program_, "InvertDiagonalBlock");
   kernel.SetArgument(0, static_cast<int>(n));
   kernel.SetArgument(1, src());
   kernel.SetArgument(2, static_cast<int>(offset));
@@ -89,13 +110,38 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
   kernel.SetArgument(5, static_cast<int>(block_size));
   kernel.SetArgument(6, static_cast<int>(unit_diagonal));
   kernel.SetArgument(7, static_cast<int>(is_upper));
-  const auto local = std::vector<size_t>{internal_block_size};
-  const auto global = std::vector<size_t>{num_internal_blocks * internal_block_size};
+  kernel.SetArgument(8, static_cast<int>(src_stride));
+  kernel.SetArgument(9, static_cast<int>(dest_stride));
+  const auto local = ThreadRange{internal_block_size, 1};
+  const auto global = ThreadRange{num_internal_blocks * internal_block_size, batch_count};
   auto base_kernel_event = Event();
-  auto base_kernel_event_pointer = (internal_block_size == block_size) ? event_ : base_kernel_event.pointer();
+  auto base_kernel_event_pointer = (internal_block_size == block_size) ?
+                                   event_ : IntermediateEvent(queue_, base_kernel_event);
   RunKernel(kernel, queue_, device_, global, local, base_kernel_event_pointer, event_wait_list);
   if (internal_block_size == block_size) { event_wait_list.push_back(base_kernel_event); }
 
+  // Optionally enqueues the loop below from a parent kernel on the device, which then launches the
+  // dependent TripleMatMul kernels without host round-trips (OpenCL 2.0 device-side enqueue)
+  if (internal_block_size < block_size && UseDeviceEnqueue(context_, device_)) {
+    const auto program = GetSpecialisedProgram(0, "#define INVERT_DEVICE_ENQUEUE 1\n", "_enqueue",
+                                               "-cl-std=CL2.0");
+    auto parent_kernel = GetKernel(program, "TripleMatMulEnqueue");
+    parent_kernel.SetArgument(0, static_cast<int>(n));
+    parent_kernel.SetArgument(1, src());
+    parent_kernel.SetArgument(2, static_cast<int>(offset));
+    parent_kernel.SetArgument(3, static_cast<int>(ld_src));
+    parent_kernel.SetArgument(4, dest());
+    parent_kernel.SetArgument(5, static_cast<int>(block_size));
+    parent_kernel.SetArgument(6, static_cast<int>(src_stride));
+    parent_kernel.SetArgument(7, static_cast<int>(dest_stride));
+    parent_kernel.SetArgument(8, static_cast<int>(batch_count));
+    parent_kernel.SetArgument(9, static_cast<int>(is_upper));
+    event_wait_list.push_back(base_kernel_event);
+    RunKernel(parent_kernel, queue_, device_, ThreadRange{1}, ThreadRange{1}, event_,
+              event_wait_list);
+    return;
+  }
+
   // Builds up block_size x block_size blocks. For example, internal_block_size=16:
   // use   16 x 16  blocks to build  32 x 32  blocks,  1 x (1 x npages) grid,  4 x 4 threads;
   // then  32 x 32  blocks to build  64 x 64  blocks,  1 x (2 x npages) grid,  8 x 4 threads;
@@ -103,14 +149,15 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
   for (auto current_size = internal_block_size; current_size < block_size; current_size *= 2) {
     assert(current_size == 16 || current_size == 32 || current_size == 64);
 
-    // Emulates a 3D grid: NX * (NY * npages)
+    // Emulates a 3D grid: NX * (NY * npages), the third dimension iterates over the batches
     const auto npages = CeilDiv(n, current_size*2);
     const auto local0 = (current_size <= 32) ? current_size/4 : 16;
-    const auto local = std::vector<size_t>{local0, 4};
-    const auto global = std::vector<size_t>{(current_size/local[1]), npages*(current_size/16)*local[1]};
+    const auto local = ThreadRange{local0, 4, 1};
+    const auto global = ThreadRange{(current_size/local[1]), npages*(current_size/16)*local[1],
+                                            batch_count};
 
     // Part 1
-    auto kernel1 = Kernel(program_, "TripleMatMul" + ToString(current_size) + "Part1" + name_postfix);
+    auto kernel1 = GetKernel(program_, "TripleMatMul" + ToString(current_size) + "Part1" + name_postfix);
     kernel1.SetArgument(0, static_cast<int>(n));
     kernel1.SetArgument(1, src());
     kernel1.SetArgument(2, static_cast<int>(offset));
@@ -119,20 +166,25 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
     kernel1.SetArgument(5, static_cast<int>(current_size));
     kernel1.SetArgument(6, static_cast<int>(npages));
     kernel1.SetArgument(7, static_cast<int>(block_size));
+    kernel1.SetArgument(8, static_cast<int>(src_stride));
+    kernel1.SetArgument(9, static_cast<int>(dest_stride));
     auto kernel1_event = Event();
-    RunKernel(kernel1, queue_, device_, global, local, kernel1_event.pointer(), event_wait_list);
+    RunKernel(kernel1, queue_, device_, global, local,
+              IntermediateEvent(queue_, kernel1_event), event_wait_list);
     event_wait_list.push_back(kernel1_event);
 
     // Part 2
     const bool is_last_kernel = (current_size * 2 >= block_size);
-    auto kernel2 = Kernel(program_, "TripleMatMul" + ToString(current_size) + "Part2" + name_postfix);
+    auto kernel2 = GetKernel(program_, "TripleMatMul" + ToString(current_size) + "Part2" + name_postfix);
     kernel2.SetArgument(0, static_cast<int>(n));
     kernel2.SetArgument(1, dest());
     kernel2.SetArgument(2, static_cast<int>(current_size));
     kernel2.SetArgument(3, static_cast<int>(npages));
     kernel2.SetArgument(4, static_cast<int>(block_size));
+    kernel2.SetArgument(5, static_cast<int>(dest_stride));
     auto kernel2_event = Event();
-    auto kernel2_event_pointer = (is_last_kernel) ? event_ : kernel2_event.pointer();
+    auto kernel2_event_pointer = (is_last_kernel) ? event_
+                                                  : IntermediateEvent(queue_, kernel2_event);
     RunKernel(kernel2, queue_, device_, global, local, kernel2_event_pointer, event_wait_list);
     if (!is_last_kernel) { event_wait_list.push_back(kernel2_event); }
 
@@ -31,6 +31,18 @@ class Xinvert: public Routine {
                                   const size_t n, const size_t block_size,
                                   const Buffer<T> &src, const size_t offset, const size_t ld_src,
                                   Buffer<T> &dest);
+
+  // Batched version of the above: the source matrices are 'src_stride' elements apart, the
+  // destinations each take 'CeilDiv(n, block_size) * block_size * block_size' elements
+  void InvertMatrixDiagonalBlocksBatched(const Layout layout, const Triangle triangle, const Diagonal diag,
+                                         const size_t n, const size_t block_size,
+                                         const Buffer<T> &src, const size_t offset, const size_t ld_src,
+                                         const size_t src_stride, Buffer<T> &dest,
+                                         const size_t batch_count);
+
+  // Retrieves the size of the inner diagonal blocks as set by the database: the block sizes passed
+  // to 'InvertMatrixDiagonalBlocks' have to be a multiple of this
+  size_t InternalBlockSize() const { return db_["INTERNAL_BLOCK_SIZE"]; }
 };
 
 // =================================================================================================
@@ -0,0 +1,162 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XinvertBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xinvertbatched.hpp"
+#include "routines/levelx/xinvert.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XinvertBatched<T>::XinvertBatched(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Copy","Pad","Invert"}, PrecisionValue<T>(), {}, {
+    KernelSource::kLevel3,
+    KernelSource::kCopyPad
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XinvertBatched<T>::DoInvertBatched(const Layout layout, Triangle triangle, const Diagonal diagonal,
+                                        const size_t n,
+                                        const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets, const size_t a_ld,
+                                        const Buffer<T> &b_buffer, const std::vector<size_t> &b_offsets, const size_t b_ld,
+                                        const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (a_offsets.size() != batch_count) || (b_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // The matrices are inverted as a whole in a single diagonal block, which supports sizes up to
+  // and including 128
+  if (n > 128) { throw BLASError(StatusCode::kNotImplemented); }
+
+  // Tests the matrices for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(n, n, a_buffer, a_offsets[batch], a_ld);
+    TestMatrixB(n, n, b_buffer, b_offsets[batch], b_ld);
+  }
+
+  // Converts row-major to a col-major problem: the inverse of a transposed matrix is the transpose
+  // of its inverse, so only the triangle is changed
+  if (layout == Layout::kRowMajor) {
+    triangle = (triangle == Triangle::kLower) ? Triangle::kUpper : Triangle::kLower;
+  }
+
+  // The smallest supported block size which holds an entire matrix
+  auto block_size = InternalBlockSize();
+  while (block_size < n) { block_size *= 2; }
+
+  // Inverts the matrices into a temporary buffer of one block per batch
+  const auto inverse_stride = block_size * block_size;
+  auto inverse_buffer = TemporaryBuffer<T>(context_, queue_, batch_count * inverse_stride);
+  InvertDiagonalBlocksBatched(triangle, diagonal, n, block_size, a_buffer, a_offsets, a_ld,
+                              inverse_buffer, batch_count);
+
+  // Copies the results into B
+  auto inverse_offsets = std::vector<size_t>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    inverse_offsets[batch] = batch * inverse_stride;
+  }
+  auto inverse_offsets_device = OffsetsToDevice(inverse_offsets);
+  auto b_offsets_device = OffsetsToDevice(b_offsets);
+  auto event_wait_list = std::vector<Event>();
+  PadCopyTransposeMatrixBatched(queue_, device_, db_, event_, event_wait_list,
+                                n, n, block_size, inverse_offsets_device, inverse_buffer,
+                                n, n, b_ld, b_offsets_device, b_buffer,
+                                program_, false, false, false, batch_count);
+}
+
+// =================================================================================================
+
+// Inverts the diagonal blocks of a batch of column-major triangular matrices
+template <typename T>
+void XinvertBatched<T>::InvertDiagonalBlocksBatched(const Triangle triangle, const Diagonal diagonal,
+                                                    const size_t n, const size_t block_size,
+                                                    const Buffer<T> &a_buffer,
+                                                    const std::vector<size_t> &a_offsets,
+                                                    const size_t a_ld,
+                                                    Buffer<T> &dest, const size_t batch_count) {
+
+  // Finds out whether the matrices are a fixed stride apart
+  const auto a_stride = (batch_count > 1 && a_offsets[1] >= a_offsets[0]) ?
+                        a_offsets[1] - a_offsets[0] : size_t{0};
+  auto is_strided = true;
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    if (a_offsets[batch] != a_offsets[0] + batch * a_stride) { is_strided = false; }
+  }
+
+  auto invert_event = Event();
+  auto inverter = Xinvert<T>(queue_, invert_event.pointer());
+  if (is_strided) {
+    inverter.InvertMatrixDiagonalBlocksBatched(Layout::kColMajor, triangle, diagonal, n, block_size,
+                                               a_buffer, a_offsets[0], a_ld, a_stride,
+                                               dest, batch_count);
+    invert_event.WaitForCompletion();
+  }
+
+  // Otherwise gathers the matrices into a temporary buffer first, n by n elements per batch
+  else {
+    auto gather_buffer = TemporaryBuffer<T>(context_, queue_, batch_count * n * n);
+    auto gather_offsets = std::vector<size_t>(batch_count);
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      gather_offsets[batch] = batch * n * n;
+    }
+    auto a_offsets_device = OffsetsToDevice(a_offsets);
+    auto gather_offsets_device = OffsetsToDevice(gather_offsets);
+    auto event_wait_list = std::vector<Event>();
+    auto gather_event = Event();
+    PadCopyTransposeMatrixBatched(queue_, device_, db_, gather_event.pointer(), event_wait_list,
+                                  n, n, a_ld, a_offsets_device, a_buffer,
+                                  n, n, n, gather_offsets_device, gather_buffer,
+                                  program_, false, false, false, batch_count);
+    gather_event.WaitForCompletion();
+    inverter.InvertMatrixDiagonalBlocksBatched(Layout::kColMajor, triangle, diagonal, n, block_size,
+                                               gather_buffer, 0, n, n * n, dest, batch_count);
+    invert_event.WaitForCompletion();
+  }
+}
+
+// Uploads a list of offsets as integers to the device
+template <typename T>
+Buffer<int> XinvertBatched<T>::OffsetsToDevice(const std::vector<size_t> &offsets) {
+  auto offsets_int = std::vector<int>(offsets.size());
+  for (auto batch = size_t{0}; batch < offsets.size(); ++batch) {
+    offsets_int[batch] = static_cast<int>(offsets[batch]);
+  }
+  auto offsets_device = TemporaryBuffer<int>(context_, queue_, offsets.size());
+  offsets_device.Write(queue_, offsets.size(), offsets_int);
+  return offsets_device;
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XinvertBatched<half>;
+template class XinvertBatched<float>;
+template class XinvertBatched<double>;
+template class XinvertBatched<float2>;
+template class XinvertBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,60 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XinvertBatched routine. This is a non-blas batched routine to invert
+// small triangular matrices, based on the diagonal-block inversion kernels also used by TRSM.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XINVERTBATCHED_H_
+#define CLBLAST_ROUTINES_XINVERTBATCHED_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XinvertBatched: public Routine {
+ public:
+
+  // Constructor
+  XinvertBatched(Queue &queue, EventPointer event, const std::string &name = "INVERTBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoInvertBatched(const Layout layout, Triangle triangle, const Diagonal diagonal,
+                       const size_t n,
+                       const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets, const size_t a_ld,
+                       const Buffer<T> &b_buffer, const std::vector<size_t> &b_offsets, const size_t b_ld,
+                       const size_t batch_count);
+
+  // Inverts the diagonal blocks of a batch of n-by-n (column-major) triangular matrices. In case
+  // the matrices are not a fixed stride apart, they are first gathered into a temporary buffer. The
+  // inverses take 'CeilDiv(n, block_size) * block_size * block_size' elements per batch.
+  void InvertDiagonalBlocksBatched(const Triangle triangle, const Diagonal diagonal,
+                                   const size_t n, const size_t block_size,
+                                   const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets,
+                                   const size_t a_ld,
+                                   Buffer<T> &dest, const size_t batch_count);
+
+  // Retrieves the size of the inner diagonal blocks of the inversion kernels as set by the database
+  size_t InternalBlockSize() const { return db_["INTERNAL_BLOCK_SIZE"]; }
+
+  // Uploads a list of offsets as integers to the device, as required by the batched copy kernels
+  Buffer<int> OffsetsToDevice(const std::vector<size_t> &offsets);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XINVERTBATCHED_H_
+#endif
@@ -0,0 +1,48 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xnrm2StridedBatched routine. This is a non-blas strided-batched version
+// of NRM2.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XNRM2STRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XNRM2STRIDEDBATCHED_H_
+
+#include "routines/level1/xnrm2.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xnrm2StridedBatched: public Xnrm2<T> {
+ public:
+
+  // Uses the regular Xnrm2 routine
+  using Xnrm2<T>::DoNrm2;
+
+  // Constructor
+  Xnrm2StridedBatched(Queue &queue, EventPointer event,
+                      const std::string &name = "NRM2STRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoNrm2StridedBatched(const size_t n,
+                            const Buffer<T> &nrm2_buffer, const size_t nrm2_offset,
+                            const size_t nrm2_stride,
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const size_t x_stride,
+                            const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XNRM2STRIDEDBATCHED_H_
+#endif
@@ -19,15 +19,18 @@
 namespace clblast {
 // =================================================================================================
 
-// Constructor: forwards to base class constructor
+// Constructor: forwards to base class constructor. The conversion from half precision always uses
+// the storage-only half precision, such that it does not require FP16 support.
 template <typename T>
 Xomatcopy<T>::Xomatcopy(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Copy","Pad","Transpose","Padtranspose"}, PrecisionValue<T>(), {}, {
-    #include "../../kernels/level3/level3.opencl"
-    #include "../../kernels/level3/copy_fast.opencl"
-    #include "../../kernels/level3/copy_pad.opencl"
-    #include "../../kernels/level3/transpose_fast.opencl"
-    #include "../../kernels/level3/transpose_pad.opencl"
+    Routine(queue, event, name, {"Copy","Pad","Transpose","Padtranspose"},
+            (name == "OMATCOPYFROMHALF") ? Precision::kHalfStorage :
+                                           HalfStoragePrecision(queue, PrecisionValue<T>()), {}, {
+    KernelSource::kLevel3,
+    KernelSource::kCopyFast,
+    KernelSource::kCopyPad,
+    KernelSource::kTransposeFast,
+    KernelSource::kTransposePad
     }) {
 }
 
@@ -39,6 +42,38 @@ void Xomatcopy<T>::DoOmatcopy(const Layout layout, const Transpose a_transpose,
                               const size_t m, const size_t n, const T alpha,
                               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld) {
+  OmatcopyMatrix(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld,
+                 b_buffer, b_offset, b_ld, program_);
+}
+
+// The type-converting routine: the kernels are compiled with the destination precision as an extra
+// define, which changes the type of the destination matrix and converts on storing (see level3)
+template <typename T>
+template <typename D>
+void Xomatcopy<T>::DoOmatcopyConvert(const Layout layout, const Transpose a_transpose,
+                                     const size_t m, const size_t n, const T alpha,
+                                     const Buffer<T> &a_buffer, const size_t a_offset,
+                                     const size_t a_ld,
+                                     const Buffer<D> &b_buffer, const size_t b_offset,
+                                     const size_t b_ld) {
+  const auto dest_precision = ToString(static_cast<int>(PrecisionValue<D>()));
+  const auto program = GetSpecialisedProgram(0, "#define DEST_PRECISION " + dest_precision + "\n",
+                                             "_dest" + dest_precision);
+  OmatcopyMatrix(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld,
+                 b_buffer, b_offset, b_ld, program);
+}
+
+// =================================================================================================
+
+// Tests the arguments and launches the copy or transpose kernel
+template <typename T>
+template <typename D>
+void Xomatcopy<T>::OmatcopyMatrix(const Layout layout, const Transpose a_transpose,
+                                  const size_t m, const size_t n, const T alpha,
+                                  const Buffer<T> &a_buffer, const size_t a_offset,
+                                  const size_t a_ld,
+                                  const Buffer<D> &b_buffer, const size_t b_offset,
+                                  const size_t b_ld, const Program &program) {
 
   // Makes sure all dimensions are larger than zero
   if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
@@ -69,7 +104,7 @@ void Xomatcopy<T>::DoOmatcopy(const Layout layout, const Transpose a_transpose,
   PadCopyTransposeMatrix(queue_, device_, db_, event_, emptyEventList,
                          a_one, a_two, a_ld, a_offset, a_buffer,
                          b_one, b_two, b_ld, b_offset, b_buffer,
-                         alpha, program_, false, transpose, conjugate);
+                         alpha, program, false, transpose, conjugate);
 }
 
 // =================================================================================================
@@ -80,6 +115,16 @@ template class Xomatcopy<float>;
 template class Xomatcopy<double>;
 template class Xomatcopy<float2>;
 template class Xomatcopy<double2>;
+template void Xomatcopy<float>::DoOmatcopyConvert<half>(const Layout, const Transpose,
+                                                        const size_t, const size_t, const float,
+                                                        const Buffer<float>&, const size_t,
+                                                        const size_t, const Buffer<half>&,
+                                                        const size_t, const size_t);
+template void Xomatcopy<half>::DoOmatcopyConvert<float>(const Layout, const Transpose,
+                                                        const size_t, const size_t, const half,
+                                                        const Buffer<half>&, const size_t,
+                                                        const size_t, const Buffer<float>&,
+                                                        const size_t, const size_t);
 
 // =================================================================================================
 } // namespace clblast
@@ -32,6 +32,24 @@ class Xomatcopy: public Routine {
                   const size_t m, const size_t n, const T alpha,
                   const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                   const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+
+  // As above, but with a destination matrix of a different precision: converts from single to half
+  // precision or the other way around in the same pass as the scaling and the transposition. The
+  // computations are performed in the precision of the source matrix.
+  template <typename D>
+  void DoOmatcopyConvert(const Layout layout, const Transpose a_transpose,
+                         const size_t m, const size_t n, const T alpha,
+                         const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                         const Buffer<D> &b_buffer, const size_t b_offset, const size_t b_ld);
+
+ private:
+  // Tests the arguments and copies the matrix with the kernels of the given program
+  template <typename D>
+  void OmatcopyMatrix(const Layout layout, const Transpose a_transpose,
+                      const size_t m, const size_t n, const T alpha,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<D> &b_buffer, const size_t b_offset, const size_t b_ld,
+                      const Program &program);
 };
 
 // =================================================================================================
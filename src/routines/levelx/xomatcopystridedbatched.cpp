@@ -0,0 +1,89 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XomatcopyStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xomatcopystridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XomatcopyStridedBatched<T>::XomatcopyStridedBatched(Queue &queue, EventPointer event,
+                                                    const std::string &name):
+    Routine(queue, event, name, {"Copy","Pad","Transpose","Padtranspose"}, PrecisionValue<T>(), {}, {
+    KernelSource::kLevel3,
+    KernelSource::kCopyPad,
+    KernelSource::kTransposePad
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XomatcopyStridedBatched<T>::DoOmatcopyStridedBatched(const Layout layout,
+                                                          const Transpose a_transpose,
+                                                          const size_t m, const size_t n,
+                                                          const T alpha,
+                                                          const Buffer<T> &a_buffer,
+                                                          const size_t a_offset, const size_t a_ld,
+                                                          const size_t a_stride,
+                                                          const Buffer<T> &b_buffer,
+                                                          const size_t b_offset, const size_t b_ld,
+                                                          const size_t b_stride,
+                                                          const size_t batch_count) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+  if (batch_count < 1) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // Determines whether to transpose the matrix A. As for Xomatcopy, a conjugate transpose is
+  // performed as a regular transpose.
+  const auto transpose = (a_transpose != Transpose::kNo);
+
+  // Computes the dimensions of the two matrices
+  const auto rotated = (layout == Layout::kRowMajor);
+  const auto a_one = (rotated) ? n : m;
+  const auto a_two = (rotated) ? m : n;
+  const auto b_one = (transpose) ? a_two : a_one;
+  const auto b_two = (transpose) ? a_one : a_two;
+
+  // Tests the matrices of all batches for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(a_one, a_two, a_buffer, a_offset + a_stride * batch, a_ld);
+    TestMatrixB(b_one, b_two, b_buffer, b_offset + b_stride * batch, b_ld);
+  }
+
+  // Runs all batches with a single kernel
+  auto emptyEventList = std::vector<Event>();
+  PadCopyTransposeMatrixStridedBatched(queue_, device_, db_, event_, emptyEventList,
+                                       a_one, a_two, a_ld, a_offset, a_stride, a_buffer,
+                                       b_one, b_two, b_ld, b_offset, b_stride, b_buffer,
+                                       alpha, program_, false, transpose, false, batch_count);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XomatcopyStridedBatched<half>;
+template class XomatcopyStridedBatched<float>;
+template class XomatcopyStridedBatched<double>;
+template class XomatcopyStridedBatched<float2>;
+template class XomatcopyStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
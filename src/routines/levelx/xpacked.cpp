@@ -0,0 +1,185 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xpacked class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xpacked.hpp"
+#include "routines/level3/xsyrk.hpp"
+#include "routines/level3/xtrsm.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xpacked<T>::Xpacked(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Pad"}, PrecisionValue<T>(), {}, {
+    KernelSource::kLevel3,
+    KernelSource::kConvertPacked
+    }) {
+}
+
+// =================================================================================================
+
+// The conversion routines. A row-major matrix is converted as the column-major matrix of the other
+// triangle: the packed formats of both correspond as well.
+template <typename T>
+void Xpacked<T>::DoTpttr(const Layout layout, const Triangle triangle,
+                         const size_t n,
+                         const Buffer<T> &ap_buffer, const size_t ap_offset,
+                         const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrices for validity
+  TestMatrixAP(n, ap_buffer, ap_offset);
+  TestMatrixB(n, n, a_buffer, a_offset, a_ld);
+
+  const auto is_upper = (triangle == Triangle::kUpper) == (layout == Layout::kColMajor);
+  PackedToFull(is_upper, false, n, ap_buffer, ap_offset, a_buffer, a_offset, a_ld, event_);
+}
+
+template <typename T>
+void Xpacked<T>::DoTrttp(const Layout layout, const Triangle triangle,
+                         const size_t n,
+                         const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                         const Buffer<T> &ap_buffer, const size_t ap_offset) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrices for validity
+  TestMatrixA(n, n, a_buffer, a_offset, a_ld);
+  TestMatrixAP(n, ap_buffer, ap_offset);
+
+  const auto is_upper = (triangle == Triangle::kUpper) == (layout == Layout::kColMajor);
+  FullToPacked(is_upper, n, a_buffer, a_offset, a_ld, ap_buffer, ap_offset, event_);
+}
+
+// =================================================================================================
+
+// SYRK on packed storage: unpacks C into a temporary matrix, runs SYRK, and packs the result
+template <typename T>
+void Xpacked<T>::DoSyrkPacked(const Layout layout, const Triangle triangle,
+                              const Transpose a_transpose,
+                              const size_t n, const size_t k,
+                              const T alpha,
+                              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                              const T beta,
+                              const Buffer<T> &cp_buffer, const size_t cp_offset) {
+
+  // Makes sure all dimensions are larger than zero (matrix A is tested by SYRK)
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+  TestMatrixAP(n, cp_buffer, cp_offset);
+
+  // Unpacks matrix C, setting the other triangle to zero such that SYRK reads no undefined values
+  const auto is_upper = (triangle == Triangle::kUpper) == (layout == Layout::kColMajor);
+  auto c_buffer = TemporaryBuffer<T>(context_, queue_, n * n);
+  auto unpack_event = Event();
+  PackedToFull(is_upper, true, n, cp_buffer, cp_offset, c_buffer, 0, n, unpack_event.pointer());
+  unpack_event.WaitForCompletion();
+
+  // Runs the regular SYRK routine on the full matrix
+  auto syrk_event = Event();
+  auto syrk = Xsyrk<T>(queue_, syrk_event.pointer());
+  syrk.DoSyrk(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld,
+              beta, c_buffer, 0, n);
+  syrk_event.WaitForCompletion();
+
+  // Packs the result back into C
+  FullToPacked(is_upper, n, c_buffer, 0, n, cp_buffer, cp_offset, event_);
+}
+
+// TRSM on packed storage: unpacks A into a temporary matrix and runs TRSM
+template <typename T>
+void Xpacked<T>::DoTrsmPacked(const Layout layout, const Side side, const Triangle triangle,
+                              const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const Buffer<T> &ap_buffer, const size_t ap_offset,
+                              const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld) {
+
+  // Makes sure all dimensions are larger than zero (matrix B is tested by TRSM)
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+  const auto k = (side == Side::kLeft) ? m : n;
+  TestMatrixAP(k, ap_buffer, ap_offset);
+
+  // Unpacks matrix A, setting the other triangle to zero
+  const auto is_upper = (triangle == Triangle::kUpper) == (layout == Layout::kColMajor);
+  auto a_buffer = TemporaryBuffer<T>(context_, queue_, k * k);
+  auto unpack_event = Event();
+  PackedToFull(is_upper, true, k, ap_buffer, ap_offset, a_buffer, 0, k, unpack_event.pointer());
+  unpack_event.WaitForCompletion();
+
+  // Runs the regular TRSM routine on the full matrix
+  auto trsm = Xtrsm<T>(queue_, event_);
+  trsm.DoTrsm(layout, side, triangle, a_transpose, diagonal, m, n, alpha,
+              a_buffer, 0, k, b_buffer, b_offset, b_ld);
+}
+
+// =================================================================================================
+
+// Launches the packed-to-full kernel with the thread configuration of the padding kernel
+template <typename T>
+void Xpacked<T>::PackedToFull(const bool is_upper, const bool zero_other, const size_t n,
+                              const Buffer<T> &ap_buffer, const size_t ap_offset,
+                              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                              EventPointer event) {
+  auto kernel = GetKernel(program_, "PackedToTriangular");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, static_cast<int>(is_upper));
+  kernel.SetArgument(2, static_cast<int>(zero_other));
+  kernel.SetArgument(3, ap_buffer());
+  kernel.SetArgument(4, static_cast<int>(ap_offset));
+  kernel.SetArgument(5, static_cast<int>(a_ld));
+  kernel.SetArgument(6, static_cast<int>(a_offset));
+  kernel.SetArgument(7, a_buffer());
+  const auto global = ThreadRange{Ceil(CeilDiv(n, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+                                  Ceil(CeilDiv(n, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
+  const auto local = ThreadRange{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+  RunKernel(kernel, queue_, device_, global, local, event);
+}
+
+// Launches the full-to-packed kernel with the thread configuration of the padding kernel
+template <typename T>
+void Xpacked<T>::FullToPacked(const bool is_upper, const size_t n,
+                              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                              const Buffer<T> &ap_buffer, const size_t ap_offset,
+                              EventPointer event) {
+  auto kernel = GetKernel(program_, "TriangularToPacked");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, static_cast<int>(is_upper));
+  kernel.SetArgument(2, a_buffer());
+  kernel.SetArgument(3, static_cast<int>(a_ld));
+  kernel.SetArgument(4, static_cast<int>(a_offset));
+  kernel.SetArgument(5, static_cast<int>(ap_offset));
+  kernel.SetArgument(6, ap_buffer());
+  const auto global = ThreadRange{Ceil(CeilDiv(n, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+                                  Ceil(CeilDiv(n, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
+  const auto local = ThreadRange{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+  RunKernel(kernel, queue_, device_, global, local, event);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xpacked<half>;
+template class Xpacked<float>;
+template class Xpacked<double>;
+template class Xpacked<float2>;
+template class Xpacked<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,81 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the routines on triangular and symmetric matrices in packed storage: the
+// conversions to and from full storage (as LAPACK's TPTTR and TRTTP) and the packed versions of
+// SYRK and TRSM. The latter two unpack the matrix into a temporary full matrix, run the regular
+// routine on it, and (for SYRK) pack the result again.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XPACKED_H_
+#define CLBLAST_ROUTINES_XPACKED_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xpacked: public Routine {
+ public:
+
+  // Constructor
+  Xpacked(Queue &queue, EventPointer event, const std::string &name = "PACKED");
+
+  // Unpacks a triangle in packed storage into a matrix in full storage
+  void DoTpttr(const Layout layout, const Triangle triangle,
+               const size_t n,
+               const Buffer<T> &ap_buffer, const size_t ap_offset,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld);
+
+  // Packs a triangle of a matrix in full storage
+  void DoTrttp(const Layout layout, const Triangle triangle,
+               const size_t n,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+               const Buffer<T> &ap_buffer, const size_t ap_offset);
+
+  // SYRK with the result matrix C in packed storage
+  void DoSyrkPacked(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                    const size_t n, const size_t k,
+                    const T alpha,
+                    const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                    const T beta,
+                    const Buffer<T> &cp_buffer, const size_t cp_offset);
+
+  // TRSM with the triangular matrix A in packed storage
+  void DoTrsmPacked(const Layout layout, const Side side, const Triangle triangle,
+                    const Transpose a_transpose, const Diagonal diagonal,
+                    const size_t m, const size_t n,
+                    const T alpha,
+                    const Buffer<T> &ap_buffer, const size_t ap_offset,
+                    const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+
+ protected:
+
+  // Runs the packed-to-full kernel on the column-major view of the matrix, optionally setting the
+  // other triangle to zero
+  void PackedToFull(const bool is_upper, const bool zero_other, const size_t n,
+                    const Buffer<T> &ap_buffer, const size_t ap_offset,
+                    const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                    EventPointer event);
+
+  // Runs the full-to-packed kernel on the column-major view of the matrix
+  void FullToPacked(const bool is_upper, const size_t n,
+                    const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                    const Buffer<T> &ap_buffer, const size_t ap_offset,
+                    EventPointer event);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XPACKED_H_
+#endif
@@ -0,0 +1,137 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xpotrf class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xpotrf.hpp"
+#include "routines/level3/xtrsm.hpp"
+#include "routines/level3/xsyrk.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T> constexpr size_t Xpotrf<T>::kBlockSize;
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xpotrf<T>::Xpotrf(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Invert"}, PrecisionValue<T>(), {}, {
+    KernelSource::kXpotrf
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xpotrf<T>::DoPotrf(const Layout layout, const Triangle triangle,
+                        const size_t n,
+                        const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix for validity
+  TestMatrixA(n, n, a_buffer, a_offset, a_ld);
+
+  // Converts row-major to a col-major problem: the lower triangle of a row-major matrix is the
+  // upper triangle of the column-major matrix and vice-versa
+  const auto is_lower = (triangle == Triangle::kLower) == (layout == Layout::kColMajor);
+  PotrfRecursive(is_lower, n, a_buffer, a_offset, a_ld, event_);
+}
+
+// =================================================================================================
+
+// The recursive part of the column-major version
+template <typename T>
+void Xpotrf<T>::PotrfRecursive(const bool is_lower, const size_t n,
+                               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                               EventPointer event) {
+
+  // A single diagonal block: factorises it in local memory
+  if (n <= kBlockSize) {
+    PotrfLocal(is_lower, n, a_buffer, a_offset, a_ld, 0, 1, event);
+    return;
+  }
+
+  // Splits the matrix in two halves at a multiple of the block size. The off-diagonal block is
+  // below (A21, lower triangle) or to the right of (A12, upper triangle) the diagonal in memory.
+  const auto n1 = (CeilDiv(n, kBlockSize) / 2) * kBlockSize;
+  const auto n2 = n - n1;
+  const auto off_diagonal_offset = (is_lower) ? a_offset + n1 : a_offset + n1 * a_ld;
+  const auto a22_offset = a_offset + n1 + n1 * a_ld;
+
+  // Factorises the first half
+  auto potrf_event = Event();
+  PotrfRecursive(is_lower, n1, a_buffer, a_offset, a_ld, potrf_event.pointer());
+  potrf_event.WaitForCompletion();
+
+  // Solves the off-diagonal block: A21 = A21 * L11^-T (lower) or A12 = U11^-T * A12 (upper)
+  auto trsm_event = Event();
+  auto trsm = Xtrsm<T>(queue_, trsm_event.pointer());
+  if (is_lower) {
+    trsm.DoTrsm(Layout::kColMajor, Side::kRight, Triangle::kLower, Transpose::kYes,
+                Diagonal::kNonUnit, n2, n1, ConstantOne<T>(),
+                a_buffer, a_offset, a_ld, a_buffer, off_diagonal_offset, a_ld);
+  }
+  else {
+    trsm.DoTrsm(Layout::kColMajor, Side::kLeft, Triangle::kUpper, Transpose::kYes,
+                Diagonal::kNonUnit, n1, n2, ConstantOne<T>(),
+                a_buffer, a_offset, a_ld, a_buffer, off_diagonal_offset, a_ld);
+  }
+  trsm_event.WaitForCompletion();
+
+  // Updates the second half: A22 = A22 - A21 * A21^T (lower) or A22 = A22 - A12^T * A12 (upper)
+  auto syrk_event = Event();
+  auto syrk = Xsyrk<T>(queue_, syrk_event.pointer());
+  syrk.DoSyrk(Layout::kColMajor, (is_lower) ? Triangle::kLower : Triangle::kUpper,
+              (is_lower) ? Transpose::kNo : Transpose::kYes,
+              n2, n1, ConstantNegOne<T>(),
+              a_buffer, off_diagonal_offset, a_ld, ConstantOne<T>(),
+              a_buffer, a22_offset, a_ld);
+  syrk_event.WaitForCompletion();
+
+  // Factorises the second half
+  PotrfRecursive(is_lower, n2, a_buffer, a22_offset, a_ld, event);
+}
+
+// =================================================================================================
+
+// Factorises small matrices in local memory
+template <typename T>
+void Xpotrf<T>::PotrfLocal(const bool is_lower, const size_t n,
+                           const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                           const size_t a_stride, const size_t batch_count,
+                           EventPointer event) {
+  auto kernel = GetKernel(program_, "XpotrfLocal");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, static_cast<int>(is_lower));
+  kernel.SetArgument(2, a_buffer());
+  kernel.SetArgument(3, static_cast<int>(a_offset));
+  kernel.SetArgument(4, static_cast<int>(a_ld));
+  kernel.SetArgument(5, static_cast<int>(a_stride));
+  const auto global = ThreadRange{kBlockSize, batch_count};
+  const auto local = ThreadRange{kBlockSize, 1};
+  RunKernel(kernel, queue_, device_, global, local, event);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xpotrf<half>;
+template class Xpotrf<float>;
+template class Xpotrf<double>;
+
+// =================================================================================================
+} // namespace clblast
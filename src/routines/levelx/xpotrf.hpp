@@ -0,0 +1,63 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xpotrf routine: the Cholesky factorisation of a symmetric positive-
+// definite matrix. The matrix is split in halves recursively (a right-looking blocked algorithm),
+// such that most of the work is done by the TRSM and SYRK routines, while the smallest diagonal
+// blocks are factorised in local memory by a single work-group.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XPOTRF_H_
+#define CLBLAST_ROUTINES_XPOTRF_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xpotrf: public Routine {
+ public:
+
+  // Constructor
+  Xpotrf(Queue &queue, EventPointer event, const std::string &name = "POTRF");
+
+  // Templated-precision implementation of the routine
+  void DoPotrf(const Layout layout, const Triangle triangle,
+               const size_t n,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld);
+
+  // The size of the diagonal blocks which are factorised in local memory, this should match the
+  // POTRF_BLOCK_SIZE of the kernel
+  static constexpr size_t kBlockSize = 32;
+
+ protected:
+
+  // Recursive part of the routine for the lower triangle of a column-major matrix ('is_lower' is
+  // true) or for the upper one: factorises the first half, solves the off-diagonal block with TRSM,
+  // updates the second half with SYRK, and factorises that. The last kernel sets 'event'.
+  void PotrfRecursive(const bool is_lower, const size_t n,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      EventPointer event);
+
+  // Factorises 'batch_count' matrices of up to 'kBlockSize' by 'kBlockSize' elements in local
+  // memory with a single kernel launch
+  void PotrfLocal(const bool is_lower, const size_t n,
+                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                  const size_t a_stride, const size_t batch_count,
+                  EventPointer event);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XPOTRF_H_
+#endif
@@ -0,0 +1,82 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XpotrfStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xpotrfstridedbatched.hpp"
+
+#include <string>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XpotrfStridedBatched<T>::XpotrfStridedBatched(Queue &queue, EventPointer event,
+                                              const std::string &name):
+    Xpotrf<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XpotrfStridedBatched<T>::DoPotrfStridedBatched(const Layout layout, const Triangle triangle,
+                                                    const size_t n,
+                                                    const Buffer<T> &a_buffer, const size_t a_offset,
+                                                    const size_t a_ld, const size_t a_stride,
+                                                    const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count == 0) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrices for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(n, n, a_buffer, a_offset + a_stride * batch, a_ld);
+  }
+
+  // Converts row-major to a col-major problem (see Xpotrf)
+  const auto is_lower = (triangle == Triangle::kLower) == (layout == Layout::kColMajor);
+
+  // Small matrices: factorises all of them in local memory with a single kernel launch
+  if (n <= Xpotrf<T>::kBlockSize) {
+    Xpotrf<T>::PotrfLocal(is_lower, n, a_buffer, a_offset, a_ld, a_stride, batch_count,
+                          this->event_);
+    return;
+  }
+
+  // Otherwise runs the recursive version per batch
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    const auto batch_offset = a_offset + a_stride * batch;
+    if (batch == batch_count - 1) {
+      Xpotrf<T>::PotrfRecursive(is_lower, n, a_buffer, batch_offset, a_ld, this->event_);
+    }
+    else {
+      auto potrf_event = Event();
+      Xpotrf<T>::PotrfRecursive(is_lower, n, a_buffer, batch_offset, a_ld, potrf_event.pointer());
+      potrf_event.WaitForCompletion();
+    }
+  }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XpotrfStridedBatched<half>;
+template class XpotrfStridedBatched<float>;
+template class XpotrfStridedBatched<double>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,44 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XpotrfStridedBatched routine. This is a non-blas batched version of
+// POTRF, it is based on the Xpotrf class.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XPOTRFSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XPOTRFSTRIDEDBATCHED_H_
+
+#include "routines/levelx/xpotrf.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XpotrfStridedBatched: public Xpotrf<T> {
+ public:
+
+  // Constructor
+  XpotrfStridedBatched(Queue &queue, EventPointer event,
+                       const std::string &name = "POTRFSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoPotrfStridedBatched(const Layout layout, const Triangle triangle,
+                             const size_t n,
+                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                             const size_t a_stride,
+                             const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XPOTRFSTRIDEDBATCHED_H_
+#endif
@@ -0,0 +1,157 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xreduce class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xreduce.hpp"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T> constexpr size_t Xreduce<T>::kMinChunkSize;
+template <typename T> constexpr size_t Xreduce<T>::kTargetThreads;
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xreduce<T>::Xreduce(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {}, {
+    KernelSource::kXreduce
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xreduce<T>::DoReduce(const ReduceOp operation, const Layout layout, const bool rows,
+                          const size_t m, const size_t n,
+                          const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const size_t a_stride,
+                          const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                          const size_t y_stride,
+                          const size_t batch_count) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+  if (batch_count == 0) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // Tests the operation for validity: the maximum is not defined for complex numbers
+  const auto is_complex = PrecisionValue<T>() == Precision::kComplexSingle ||
+                          PrecisionValue<T>() == Precision::kComplexDouble;
+  if (operation != ReduceOp::kSum && operation != ReduceOp::kAbsSum &&
+      operation != ReduceOp::kMax && operation != ReduceOp::kAbsMax &&
+      operation != ReduceOp::kNrm2) {
+    throw BLASError(StatusCode::kInvalidValue);
+  }
+  if (operation == ReduceOp::kMax && is_complex) { throw BLASError(StatusCode::kNotImplemented); }
+
+  // Computes the dimensions of the column-major matrix as seen by the kernels. The values of a
+  // reduction are consecutive in memory when reducing the columns of a column-major matrix or the
+  // rows of a row-major matrix.
+  const auto rotated = (layout == Layout::kRowMajor);
+  const auto a_one = (rotated) ? n : m;
+  const auto a_two = (rotated) ? m : n;
+  const auto contiguous = (rows == rotated);
+  const auto n_reduce = (contiguous) ? a_one : a_two;
+  const auto n_out = (contiguous) ? a_two : a_one;
+
+  // Tests the matrices and the result vectors for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(a_one, a_two, a_buffer, a_offset + a_stride * batch, a_ld);
+    TestVectorY(n_out, y_buffer, y_offset + y_stride * batch, y_inc);
+  }
+
+  // Reduces consecutive values: a work-group per result
+  if (contiguous) {
+    auto kernel = GetKernel(program_, "XreduceContiguous");
+    kernel.SetArgument(0, static_cast<int>(n_reduce));
+    kernel.SetArgument(1, static_cast<int>(n_out));
+    kernel.SetArgument(2, static_cast<int>(operation));
+    kernel.SetArgument(3, a_buffer());
+    kernel.SetArgument(4, static_cast<int>(a_offset));
+    kernel.SetArgument(5, static_cast<int>(a_ld));
+    kernel.SetArgument(6, static_cast<int>(a_stride));
+    kernel.SetArgument(7, y_buffer());
+    kernel.SetArgument(8, static_cast<int>(y_offset));
+    kernel.SetArgument(9, static_cast<int>(y_inc));
+    kernel.SetArgument(10, static_cast<int>(y_stride));
+    auto global = ThreadRange{db_["WGS1"], n_out * batch_count};
+    auto local = ThreadRange{db_["WGS1"], 1};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+    return;
+  }
+
+  // Otherwise reduces with a thread per result. Few results (e.g. a short and wide matrix) don't
+  // occupy the device, in which case the reductions are split into chunks.
+  const auto n_out_ceiled = Ceil(n_out, db_["WGS2"]);
+  const auto max_chunks = std::max(size_t{1}, kTargetThreads / (n_out_ceiled * batch_count));
+  const auto num_chunks = std::min(CeilDiv(n_reduce, kMinChunkSize), max_chunks);
+  const auto chunk_size = CeilDiv(n_reduce, num_chunks);
+  auto kernel = GetKernel(program_, "XreduceStrided");
+  kernel.SetArgument(0, static_cast<int>(n_reduce));
+  kernel.SetArgument(1, static_cast<int>(n_out));
+  kernel.SetArgument(2, static_cast<int>(operation));
+  kernel.SetArgument(3, static_cast<int>(num_chunks));
+  kernel.SetArgument(4, static_cast<int>(chunk_size));
+  kernel.SetArgument(5, a_buffer());
+  kernel.SetArgument(6, static_cast<int>(a_offset));
+  kernel.SetArgument(7, static_cast<int>(a_ld));
+  kernel.SetArgument(8, static_cast<int>(a_stride));
+  auto global = ThreadRange{n_out_ceiled, num_chunks * batch_count};
+  auto local = ThreadRange{db_["WGS2"], 1};
+  if (num_chunks == 1) {
+    kernel.SetArgument(9, y_buffer());
+    kernel.SetArgument(10, static_cast<int>(y_offset));
+    kernel.SetArgument(11, static_cast<int>(y_inc));
+    kernel.SetArgument(12, static_cast<int>(y_stride));
+    RunKernel(kernel, queue_, device_, global, local, event_);
+    return;
+  }
+
+  // Stores the partial results of the chunks in a temporary buffer, followed by the epilogue
+  auto partials = TemporaryBuffer<T>(context_, queue_, n_out * num_chunks * batch_count);
+  kernel.SetArgument(9, partials());
+  kernel.SetArgument(10, 0);
+  kernel.SetArgument(11, 1);
+  kernel.SetArgument(12, static_cast<int>(n_out));
+  auto eventWaitList = std::vector<Event>();
+  auto kernelEvent = Event();
+  RunKernel(kernel, queue_, device_, global, local, IntermediateEvent(queue_, kernelEvent));
+  eventWaitList.push_back(kernelEvent);
+
+  auto epilogue = GetKernel(program_, "XreduceStridedEpilogue");
+  epilogue.SetArgument(0, static_cast<int>(n_out));
+  epilogue.SetArgument(1, static_cast<int>(operation));
+  epilogue.SetArgument(2, static_cast<int>(num_chunks));
+  epilogue.SetArgument(3, partials());
+  epilogue.SetArgument(4, y_buffer());
+  epilogue.SetArgument(5, static_cast<int>(y_offset));
+  epilogue.SetArgument(6, static_cast<int>(y_inc));
+  epilogue.SetArgument(7, static_cast<int>(y_stride));
+  auto global2 = ThreadRange{n_out_ceiled, batch_count};
+  RunKernel(epilogue, queue_, device_, global2, local, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xreduce<half>;
+template class Xreduce<float>;
+template class Xreduce<double>;
+template class Xreduce<float2>;
+template class Xreduce<double2>;
+
+// =================================================================================================
+} // namespace clblast
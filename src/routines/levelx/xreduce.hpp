@@ -0,0 +1,53 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xreduce routine: the row-wise and column-wise reductions of a matrix
+// (sum, absolute sum, maximum, absolute maximum, or L2 norm per row or per column), optionally for
+// a strided batch of matrices. All results are computed by a single kernel launch (or two), rather
+// than by a reduction routine per row or column.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XREDUCE_H_
+#define CLBLAST_ROUTINES_XREDUCE_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xreduce: public Routine {
+ public:
+
+  // Constructor
+  Xreduce(Queue &queue, EventPointer event, const std::string &name = "REDUCE");
+
+  // Templated-precision implementation of the routine: computes a result per row ('rows' is true)
+  // or per column of each of the 'batch_count' matrices
+  void DoReduce(const ReduceOp operation, const Layout layout, const bool rows,
+                const size_t m, const size_t n,
+                const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                const size_t a_stride,
+                const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                const size_t y_stride,
+                const size_t batch_count);
+
+  // The minimum number of values per chunk of a reduction over non-consecutive values and the
+  // number of threads above which the reduction is not split into chunks
+  static constexpr size_t kMinChunkSize = 64;
+  static constexpr size_t kTargetThreads = 16384;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XREDUCE_H_
+#endif
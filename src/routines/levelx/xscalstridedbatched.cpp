@@ -0,0 +1,84 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XscalStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xscalstridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XscalStridedBatched<T>::XscalStridedBatched(Queue &queue, EventPointer event,
+                                            const std::string &name):
+    Xscal<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XscalStridedBatched<T>::DoScalStridedBatched(const size_t n, const T alpha,
+                                                  const Buffer<T> &x_buffer, const size_t x_offset,
+                                                  const size_t x_inc, const size_t x_stride,
+                                                  const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count == 0) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // A single batch can use the vectorised kernel of the regular routine
+  if (batch_count == 1) {
+    DoScal(n, alpha, x_buffer, x_offset, x_inc);
+    return;
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestVectorX(n, x_buffer, x_offset + x_stride * batch, x_inc);
+  }
+
+  // Retrieves the Xscal kernel from the compiled binary
+  auto kernel = GetKernel(this->program_, "XscalStridedBatched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, GetRealArg(alpha));
+  kernel.SetArgument(2, x_buffer());
+  kernel.SetArgument(3, static_cast<int>(x_offset));
+  kernel.SetArgument(4, static_cast<int>(x_inc));
+  kernel.SetArgument(5, static_cast<int>(x_stride));
+
+  // Launches the kernel
+  const auto n_ceiled = Ceil(n, this->db_["WGS"]*this->db_["WPT"]);
+  auto global = ThreadRange{n_ceiled/this->db_["WPT"], batch_count};
+  auto local = ThreadRange{this->db_["WGS"], 1};
+  RunKernel(kernel, this->queue_, this->device_, global, local, this->event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XscalStridedBatched<half>;
+template class XscalStridedBatched<float>;
+template class XscalStridedBatched<double>;
+template class XscalStridedBatched<float2>;
+template class XscalStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
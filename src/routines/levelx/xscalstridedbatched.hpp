@@ -0,0 +1,46 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XscalStridedBatched routine. This is a non-blas strided-batched version
+// of SCAL.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XSCALSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XSCALSTRIDEDBATCHED_H_
+
+#include "routines/level1/xscal.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XscalStridedBatched: public Xscal<T> {
+ public:
+
+  // Uses the regular Xscal routine
+  using Xscal<T>::DoScal;
+
+  // Constructor
+  XscalStridedBatched(Queue &queue, EventPointer event,
+                      const std::string &name = "SCALSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoScalStridedBatched(const size_t n, const T alpha,
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const size_t x_stride,
+                            const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XSCALSTRIDEDBATCHED_H_
+#endif
@@ -0,0 +1,46 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XsetStridedBatched routine. This is a non-blas strided-batched version
+// of SET.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XSETSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XSETSTRIDEDBATCHED_H_
+
+#include "routines/levelx/xset.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XsetStridedBatched: public Xset<T> {
+ public:
+
+  // Uses the regular Xset routine
+  using Xset<T>::DoSet;
+
+  // Constructor
+  XsetStridedBatched(Queue &queue, EventPointer event,
+                     const std::string &name = "SETSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoSetStridedBatched(const size_t n, const T alpha,
+                           const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                           const size_t x_stride,
+                           const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XSETSTRIDEDBATCHED_H_
+#endif
@@ -0,0 +1,105 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XsymmStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xsymmstridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XsymmStridedBatched<T>::XsymmStridedBatched(Queue &queue, EventPointer event, const std::string &name):
+    XgemmStridedBatched<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XsymmStridedBatched<T>::DoSymmStridedBatched(const Layout layout, const Side side, const Triangle triangle,
+                                                  const size_t m, const size_t n,
+                                                  const T alpha,
+                                                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                  const T beta,
+                                                  const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                  const size_t batch_count) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Computes the k dimension. This is based on whether or not the symmetric matrix is A (on the
+  // left) or B (on the right) in the GEMM routine.
+  const auto k = (side == Side::kLeft) ? m : n;
+
+  // Checks for validity of the squared A matrices
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(k, k, a_buffer, a_offset + a_stride * batch, a_ld);
+  }
+
+  // The structure of the symmetric matrix is applied by the direct kernel while loading it, based
+  // on the layout (the kernel assumes column-major as default) and the stored triangle
+  const auto is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
+                         (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+  const auto operand = (side == Side::kLeft) ? size_t{1} : size_t{2};
+  SetStructure(GemmStructure{operand, is_upper, false});
+
+  // Runs the strided-batched GEMM code with either "C := AB+C" or ...
+  if (side == Side::kLeft) {
+    DoGemmStridedBatched(layout, Transpose::kNo, Transpose::kNo,
+                         m, n, k, alpha,
+                         a_buffer, a_offset, a_ld, a_stride,
+                         b_buffer, b_offset, b_ld, b_stride, beta,
+                         c_buffer, c_offset, c_ld, c_stride,
+                         batch_count);
+  }
+
+  // ... with "C := BA+C". Note that A and B are now reversed.
+  else {
+    try {
+      DoGemmStridedBatched(layout, Transpose::kNo, Transpose::kNo,
+                           m, n, k, alpha,
+                           b_buffer, b_offset, b_ld, b_stride,
+                           a_buffer, a_offset, a_ld, a_stride, beta,
+                           c_buffer, c_offset, c_ld, c_stride,
+                           batch_count);
+    } catch (BLASError &e) {
+      // A and B are now reversed, so also reverse the error codes returned from the GEMM routine
+      switch(e.status()) {
+        case StatusCode::kInvalidMatrixA:      throw BLASError(StatusCode::kInvalidMatrixB, e.details());
+        case StatusCode::kInvalidMatrixB:      throw BLASError(StatusCode::kInvalidMatrixA, e.details());
+        case StatusCode::kInvalidLeadDimA:     throw BLASError(StatusCode::kInvalidLeadDimB, e.details());
+        case StatusCode::kInvalidLeadDimB:     throw BLASError(StatusCode::kInvalidLeadDimA, e.details());
+        case StatusCode::kInsufficientMemoryA: throw BLASError(StatusCode::kInsufficientMemoryB, e.details());
+        case StatusCode::kInsufficientMemoryB: throw BLASError(StatusCode::kInsufficientMemoryA, e.details());
+        default:                               throw;
+      }
+    }
+  }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XsymmStridedBatched<half>;
+template class XsymmStridedBatched<float>;
+template class XsymmStridedBatched<double>;
+template class XsymmStridedBatched<float2>;
+template class XsymmStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,51 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XsymmStridedBatched routine. All batches are computed by a single launch
+// of the strided-batched direct GEMM kernel, which applies the symmetric structure of matrix A while
+// loading it. Therefore, this class inherits from the XgemmStridedBatched class.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XSYMMSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XSYMMSTRIDEDBATCHED_H_
+
+#include "routines/levelx/xgemmstridedbatched.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XsymmStridedBatched: public XgemmStridedBatched<T> {
+ public:
+
+  // Uses methods and variables the strided-batched GEMM routine
+  using XgemmStridedBatched<T>::DoGemmStridedBatched;
+  using XgemmStridedBatched<T>::SetStructure;
+
+  // Constructor
+  XsymmStridedBatched(Queue &queue, EventPointer event, const std::string &name = "SYMMSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoSymmStridedBatched(const Layout layout, const Side side, const Triangle triangle,
+                            const size_t m, const size_t n,
+                            const T alpha,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                            const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                            const T beta,
+                            const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                            const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XSYMMSTRIDEDBATCHED_H_
+#endif
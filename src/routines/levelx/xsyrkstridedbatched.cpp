@@ -0,0 +1,61 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XsyrkStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xsyrkstridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XsyrkStridedBatched<T>::XsyrkStridedBatched(Queue &queue, EventPointer event, const std::string &name):
+    XgemmStridedBatched<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine: computes "C := alpha * A * A^T + beta * C" (or with A^T first) as a GEMM with
+// matrix A as both inputs, storing only the requested triangle of C
+template <typename T>
+void XsyrkStridedBatched<T>::DoSyrkStridedBatched(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                                  const size_t n, const size_t k,
+                                                  const T alpha,
+                                                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  const T beta,
+                                                  const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                  const size_t batch_count) {
+  const auto b_transpose = (a_transpose != Transpose::kNo) ? Transpose::kNo : Transpose::kYes;
+  SetTriangle(triangle == Triangle::kUpper);
+  DoGemmStridedBatched(layout, a_transpose, b_transpose,
+                       n, n, k, alpha,
+                       a_buffer, a_offset, a_ld, a_stride,
+                       a_buffer, a_offset, a_ld, a_stride, beta,
+                       c_buffer, c_offset, c_ld, c_stride,
+                       batch_count);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XsyrkStridedBatched<half>;
+template class XsyrkStridedBatched<float>;
+template class XsyrkStridedBatched<double>;
+template class XsyrkStridedBatched<float2>;
+template class XsyrkStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,114 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XtrmmStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xtrmmstridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XtrmmStridedBatched<T>::XtrmmStridedBatched(Queue &queue, EventPointer event, const std::string &name):
+    XgemmStridedBatched<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XtrmmStridedBatched<T>::DoTrmmStridedBatched(const Layout layout, const Side side, const Triangle triangle,
+                                                  const Transpose a_transpose, const Diagonal diagonal,
+                                                  const size_t m, const size_t n,
+                                                  const T alpha,
+                                                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                  const size_t batch_count) {
+
+  // Makes sure all dimensions and the batch count are larger than zero
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+  if (batch_count < 1) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // Computes the k dimension. This is based on whether or not matrix is A (on the left)
+  // or B (on the right) in the GEMM routine.
+  const auto k = (side == Side::kLeft) ? m : n;
+
+  // Checks for validity of the triangular A matrices and of the input/output B matrices
+  const auto b_one = (layout == Layout::kRowMajor) ? n : m;
+  const auto b_two = (layout == Layout::kRowMajor) ? m : n;
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(k, k, a_buffer, a_offset + a_stride * batch, a_ld);
+    TestMatrixB(b_one, b_two, b_buffer, b_offset + b_stride * batch, b_ld);
+  }
+
+  // Creates a single copy of all B matrices to avoid overwriting input in GEMM while computing output
+  const auto b_size = b_stride * (batch_count - 1) + b_ld * (b_two - 1) + b_one + b_offset;
+  auto b_buffer_copy = TemporaryBuffer<T>(context_, queue_, b_size);
+  CopyBuffer(queue_, b_buffer, b_buffer_copy, b_size);
+
+  // The structure of the triangular matrix is applied by the direct kernel while loading it, based
+  // on the layout (the kernel assumes column-major as default) and the stored triangle
+  const auto is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
+                         (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+  const auto unit_diagonal = (diagonal == Diagonal::kUnit);
+  const auto operand = (side == Side::kLeft) ? size_t{1} : size_t{2};
+  SetStructure(GemmStructure{operand, is_upper, unit_diagonal});
+
+  // Runs the strided-batched GEMM code with either "B := alpha*A*B" or ...
+  if (side == Side::kLeft) {
+    DoGemmStridedBatched(layout, a_transpose, Transpose::kNo,
+                         m, n, k, alpha,
+                         a_buffer, a_offset, a_ld, a_stride,
+                         b_buffer_copy, b_offset, b_ld, b_stride, ConstantZero<T>(),
+                         b_buffer, b_offset, b_ld, b_stride,
+                         batch_count);
+  }
+
+  // ... with "B := alpha*B*A". Note that A and B are now reversed.
+  else {
+    try {
+      DoGemmStridedBatched(layout, Transpose::kNo, a_transpose,
+                           m, n, k, alpha,
+                           b_buffer_copy, b_offset, b_ld, b_stride,
+                           a_buffer, a_offset, a_ld, a_stride, ConstantZero<T>(),
+                           b_buffer, b_offset, b_ld, b_stride,
+                           batch_count);
+    } catch (BLASError &e) {
+      // A and B are now reversed, so also reverse the error codes returned from the GEMM routine
+      switch(e.status()) {
+        case StatusCode::kInvalidMatrixA:      throw BLASError(StatusCode::kInvalidMatrixB, e.details());
+        case StatusCode::kInvalidMatrixB:      throw BLASError(StatusCode::kInvalidMatrixA, e.details());
+        case StatusCode::kInvalidLeadDimA:     throw BLASError(StatusCode::kInvalidLeadDimB, e.details());
+        case StatusCode::kInvalidLeadDimB:     throw BLASError(StatusCode::kInvalidLeadDimA, e.details());
+        case StatusCode::kInsufficientMemoryA: throw BLASError(StatusCode::kInsufficientMemoryB, e.details());
+        case StatusCode::kInsufficientMemoryB: throw BLASError(StatusCode::kInsufficientMemoryA, e.details());
+        default:                               throw;
+      }
+    }
+  }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XtrmmStridedBatched<half>;
+template class XtrmmStridedBatched<float>;
+template class XtrmmStridedBatched<double>;
+template class XtrmmStridedBatched<float2>;
+template class XtrmmStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,247 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XtrsmBatched class (see the header for information about the class).
+// It follows the regular TRSM routine, but inverts the diagonal blocks of all triangular matrices
+// at once and uses batched GEMMs for the updates and the solves of the diagonal blocks.
+//
+// =================================================================================================
+
+#include "routines/levelx/xtrsmbatched.hpp"
+#include "routines/levelx/xgemmbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XtrsmBatched<T>::XtrsmBatched(Queue &queue, EventPointer event, const std::string &name):
+    XinvertBatched<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XtrsmBatched<T>::DoTrsmBatched(const Layout layout, Side side, Triangle triangle,
+                                    const Transpose a_transpose, const Diagonal diagonal,
+                                    size_t m, size_t n,
+                                    const std::vector<T> &alphas,
+                                    const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets, const size_t a_ld,
+                                    const Buffer<T> &b_buffer, const std::vector<size_t> &b_offsets, const size_t b_ld,
+                                    const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (alphas.size() != batch_count) ||
+      (a_offsets.size() != batch_count) || (b_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Converts row-major to a col-major problem, see the regular TRSM routine for details
+  if (layout == Layout::kRowMajor) {
+    std::swap(m, n);
+    side = (side == Side::kLeft) ? Side::kRight : Side::kLeft;
+    triangle = (triangle == Triangle::kLower) ? Triangle::kUpper : Triangle::kLower;
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Computes the k dimension: the size of the triangular matrices
+  const auto k = (side == Side::kLeft) ? m : n;
+
+  // Tests the matrices for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(k, k, a_buffer, a_offsets[batch], a_ld);
+    TestMatrixB(m, n, b_buffer, b_offsets[batch], b_ld);
+  }
+
+  // Inverts the diagonal blocks of all triangular matrices at once
+  const auto block_size = InternalBlockSize();
+  const auto a_inv_stride = Ceil(k, block_size) * block_size;
+  auto a_inv_buffer = TemporaryBuffer<T>(context_, queue_, batch_count * a_inv_stride);
+  InvertDiagonalBlocksBatched(triangle, diagonal, k, block_size, a_buffer, a_offsets, a_ld,
+                              a_inv_buffer, batch_count);
+
+  // Temporary buffer for a single block of rows (left side) or columns (right side) of B per batch
+  const auto scratch_stride = (side == Side::kLeft) ? block_size * n : m * block_size;
+  auto scratch_buffer = TemporaryBuffer<T>(context_, queue_, batch_count * scratch_stride);
+
+  // Derives properties based on the arguments, see the regular TRSM routine for details
+  const auto condition = ((triangle == Triangle::kUpper && a_transpose != Transpose::kNo) ||
+                          (triangle == Triangle::kLower && a_transpose == Transpose::kNo));
+  const auto forward = (side == Side::kLeft) ? condition : !condition;
+
+  // Solves the systems in-place in B
+  TrsmBatchedRecursive(side, forward, a_transpose, m, n, alphas,
+                       a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld,
+                       a_inv_buffer, 0, a_inv_stride, block_size,
+                       scratch_buffer, scratch_stride, batch_count);
+}
+
+// =================================================================================================
+
+// The recursive part of the column-major version
+template <typename T>
+void XtrsmBatched<T>::TrsmBatchedRecursive(const Side side, const bool forward, const Transpose a_transpose,
+                                           const size_t m, const size_t n,
+                                           const std::vector<T> &alphas,
+                                           const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets, const size_t a_ld,
+                                           const Buffer<T> &b_buffer, const std::vector<size_t> &b_offsets, const size_t b_ld,
+                                           const Buffer<T> &a_inv_buffer, const size_t a_inv_offset,
+                                           const size_t a_inv_stride, const size_t block_size,
+                                           const Buffer<T> &scratch_buffer, const size_t scratch_stride,
+                                           const size_t batch_count) {
+  const auto k = (side == Side::kLeft) ? m : n;
+
+  // Offsets of the sub-matrices for all batches, shifted by a fixed amount from the given ones
+  const auto shift_offsets = [batch_count](const std::vector<size_t> &offsets, const size_t shift) {
+    auto result = std::vector<size_t>(batch_count);
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      result[batch] = offsets[batch] + shift;
+    }
+    return result;
+  };
+
+  // A single diagonal block: copies B into the scratch buffer and multiplies it with alpha and the
+  // inverse of the block, storing the result back into B
+  if (k <= block_size) {
+    auto scratch_offsets = std::vector<size_t>(batch_count);
+    auto a_inv_offsets = std::vector<size_t>(batch_count);
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      scratch_offsets[batch] = batch * scratch_stride;
+      a_inv_offsets[batch] = batch * a_inv_stride + a_inv_offset;
+    }
+    auto b_offsets_device = OffsetsToDevice(b_offsets);
+    auto scratch_offsets_device = OffsetsToDevice(scratch_offsets);
+    auto copy_event = Event();
+    auto event_wait_list = std::vector<Event>();
+    PadCopyTransposeMatrixBatched(queue_, device_, db_, copy_event.pointer(), event_wait_list,
+                                  m, n, b_ld, b_offsets_device, b_buffer,
+                                  m, n, m, scratch_offsets_device, scratch_buffer,
+                                  program_, false, false, false, batch_count);
+    copy_event.WaitForCompletion();
+    const auto betas = std::vector<T>(batch_count, ConstantZero<T>());
+    auto gemm_event = Event();
+    auto gemm = XgemmBatched<T>(queue_, gemm_event.pointer());
+    if (side == Side::kLeft) {
+      gemm.DoGemmBatched(Layout::kColMajor, a_transpose, Transpose::kNo,
+                         m, n, k, alphas,
+                         a_inv_buffer, a_inv_offsets, block_size,
+                         scratch_buffer, scratch_offsets, m, betas,
+                         b_buffer, b_offsets, b_ld, batch_count);
+    }
+    else {
+      gemm.DoGemmBatched(Layout::kColMajor, Transpose::kNo, a_transpose,
+                         m, n, k, alphas,
+                         scratch_buffer, scratch_offsets, m,
+                         a_inv_buffer, a_inv_offsets, block_size, betas,
+                         b_buffer, b_offsets, b_ld, batch_count);
+    }
+    gemm_event.WaitForCompletion();
+    return;
+  }
+
+  // Splits the triangular matrices in two halves at a multiple of the block size, see the regular
+  // TRSM routine for details
+  const auto k1 = (CeilDiv(k, block_size) / 2) * block_size;
+  const auto k2 = k - k1;
+  const auto a21_shift = k1;
+  const auto a12_shift = k1 * a_ld;
+  const auto op_a21_offsets = shift_offsets(a_offsets, (a_transpose == Transpose::kNo) ? a21_shift : a12_shift);
+  const auto op_a12_offsets = shift_offsets(a_offsets, (a_transpose == Transpose::kNo) ? a12_shift : a21_shift);
+  const auto a22_offsets = shift_offsets(a_offsets, k1 + k1 * a_ld);
+  const auto a_inv22_offset = a_inv_offset + k1 * block_size;
+
+  // The two parts of B: the first and last rows (left side) or columns (right side)
+  const auto m1 = (side == Side::kLeft) ? k1 : m;
+  const auto m2 = (side == Side::kLeft) ? k2 : m;
+  const auto n1 = (side == Side::kLeft) ? n : k1;
+  const auto n2 = (side == Side::kLeft) ? n : k2;
+  const auto &b1_offsets = b_offsets;
+  const auto b2_offsets = shift_offsets(b_offsets, (side == Side::kLeft) ? k1 : k1 * b_ld);
+
+  // The scalars of the GEMM update and of the second solve: alpha is applied in the first solve and
+  // as the beta of the update
+  const auto neg_ones = std::vector<T>(batch_count, ConstantNegOne<T>());
+  const auto ones = std::vector<T>(batch_count, ConstantOne<T>());
+
+  // Solves the first part, then updates the second part with it, and finally solves that
+  if (forward) {
+    TrsmBatchedRecursive(side, forward, a_transpose, m1, n1, alphas,
+                         a_buffer, a_offsets, a_ld, b_buffer, b1_offsets, b_ld,
+                         a_inv_buffer, a_inv_offset, a_inv_stride, block_size,
+                         scratch_buffer, scratch_stride, batch_count);
+    auto gemm_event = Event();
+    auto gemm = XgemmBatched<T>(queue_, gemm_event.pointer());
+    if (side == Side::kLeft) {
+      gemm.DoGemmBatched(Layout::kColMajor, a_transpose, Transpose::kNo,
+                         m2, n, k1, neg_ones,
+                         a_buffer, op_a21_offsets, a_ld,
+                         b_buffer, b1_offsets, b_ld, alphas,
+                         b_buffer, b2_offsets, b_ld, batch_count);
+    }
+    else {
+      gemm.DoGemmBatched(Layout::kColMajor, Transpose::kNo, a_transpose,
+                         m, n2, k1, neg_ones,
+                         b_buffer, b1_offsets, b_ld,
+                         a_buffer, op_a12_offsets, a_ld, alphas,
+                         b_buffer, b2_offsets, b_ld, batch_count);
+    }
+    gemm_event.WaitForCompletion();
+    TrsmBatchedRecursive(side, forward, a_transpose, m2, n2, ones,
+                         a_buffer, a22_offsets, a_ld, b_buffer, b2_offsets, b_ld,
+                         a_inv_buffer, a_inv22_offset, a_inv_stride, block_size,
+                         scratch_buffer, scratch_stride, batch_count);
+  }
+
+  // The same, but now the other way around: the second part is solved first
+  else {
+    TrsmBatchedRecursive(side, forward, a_transpose, m2, n2, alphas,
+                         a_buffer, a22_offsets, a_ld, b_buffer, b2_offsets, b_ld,
+                         a_inv_buffer, a_inv22_offset, a_inv_stride, block_size,
+                         scratch_buffer, scratch_stride, batch_count);
+    auto gemm_event = Event();
+    auto gemm = XgemmBatched<T>(queue_, gemm_event.pointer());
+    if (side == Side::kLeft) {
+      gemm.DoGemmBatched(Layout::kColMajor, a_transpose, Transpose::kNo,
+                         m1, n, k2, neg_ones,
+                         a_buffer, op_a12_offsets, a_ld,
+                         b_buffer, b2_offsets, b_ld, alphas,
+                         b_buffer, b1_offsets, b_ld, batch_count);
+    }
+    else {
+      gemm.DoGemmBatched(Layout::kColMajor, Transpose::kNo, a_transpose,
+                         m, n1, k2, neg_ones,
+                         b_buffer, b2_offsets, b_ld,
+                         a_buffer, op_a21_offsets, a_ld, alphas,
+                         b_buffer, b1_offsets, b_ld, batch_count);
+    }
+    gemm_event.WaitForCompletion();
+    TrsmBatchedRecursive(side, forward, a_transpose, m1, n1, ones,
+                         a_buffer, a_offsets, a_ld, b_buffer, b1_offsets, b_ld,
+                         a_inv_buffer, a_inv_offset, a_inv_stride, block_size,
+                         scratch_buffer, scratch_stride, batch_count);
+  }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XtrsmBatched<half>;
+template class XtrsmBatched<float>;
+template class XtrsmBatched<double>;
+template class XtrsmBatched<float2>;
+template class XtrsmBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
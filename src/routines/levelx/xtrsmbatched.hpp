@@ -0,0 +1,70 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XtrsmBatched routine. This is a non-blas batched version of TRSM.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTRSMBATCHED_H_
+#define CLBLAST_ROUTINES_XTRSMBATCHED_H_
+
+#include <vector>
+
+#include "routines/levelx/xinvertbatched.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XtrsmBatched: public XinvertBatched<T> {
+ public:
+
+  // Uses methods and variables the XinvertBatched routine
+  using XinvertBatched<T>::queue_;
+  using XinvertBatched<T>::context_;
+  using XinvertBatched<T>::device_;
+  using XinvertBatched<T>::db_;
+  using XinvertBatched<T>::program_;
+  using XinvertBatched<T>::InvertDiagonalBlocksBatched;
+  using XinvertBatched<T>::InternalBlockSize;
+  using XinvertBatched<T>::OffsetsToDevice;
+
+  // Constructor
+  XtrsmBatched(Queue &queue, EventPointer event, const std::string &name = "TRSMBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoTrsmBatched(const Layout layout, Side side, Triangle triangle,
+                     const Transpose a_transpose, const Diagonal diagonal,
+                     size_t m, size_t n,
+                     const std::vector<T> &alphas,
+                     const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets, const size_t a_ld,
+                     const Buffer<T> &b_buffer, const std::vector<size_t> &b_offsets, const size_t b_ld,
+                     const size_t batch_count);
+
+  // Recursive part of the column-major version, as in the regular TRSM routine: the triangular
+  // matrices are halved and the two halves are solved separately, with a batched GEMM update of B in
+  // between. The inverses of the diagonal blocks are 'a_inv_stride' elements apart per batch; the
+  // scratch buffer holds a block of rows or columns of B per batch, 'scratch_stride' elements apart.
+  void TrsmBatchedRecursive(const Side side, const bool forward, const Transpose a_transpose,
+                            const size_t m, const size_t n,
+                            const std::vector<T> &alphas,
+                            const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets, const size_t a_ld,
+                            const Buffer<T> &b_buffer, const std::vector<size_t> &b_offsets, const size_t b_ld,
+                            const Buffer<T> &a_inv_buffer, const size_t a_inv_offset,
+                            const size_t a_inv_stride, const size_t block_size,
+                            const Buffer<T> &scratch_buffer, const size_t scratch_stride,
+                            const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XTRSMBATCHED_H_
+#endif
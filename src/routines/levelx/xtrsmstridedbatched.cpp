@@ -0,0 +1,67 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XtrsmStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xtrsmstridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XtrsmStridedBatched<T>::XtrsmStridedBatched(Queue &queue, EventPointer event, const std::string &name):
+    XtrsmBatched<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XtrsmStridedBatched<T>::DoTrsmStridedBatched(const Layout layout, const Side side, const Triangle triangle,
+                                                  const Transpose a_transpose, const Diagonal diagonal,
+                                                  const size_t m, const size_t n,
+                                                  const T alpha,
+                                                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                  const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count < 1) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // Computes the offsets of all batches: as these are a fixed stride apart, the triangular
+  // matrices are inverted directly from A without gathering them first
+  const auto alphas = std::vector<T>(batch_count, alpha);
+  auto a_offsets = std::vector<size_t>(batch_count);
+  auto b_offsets = std::vector<size_t>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    a_offsets[batch] = a_offset + batch * a_stride;
+    b_offsets[batch] = b_offset + batch * b_stride;
+  }
+  DoTrsmBatched(layout, side, triangle, a_transpose, diagonal, m, n, alphas,
+                a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, batch_count);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XtrsmStridedBatched<half>;
+template class XtrsmStridedBatched<float>;
+template class XtrsmStridedBatched<double>;
+template class XtrsmStridedBatched<float2>;
+template class XtrsmStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
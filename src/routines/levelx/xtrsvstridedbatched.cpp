@@ -0,0 +1,159 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XtrsvStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xtrsvstridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XtrsvStridedBatched<T>::XtrsvStridedBatched(Queue &queue, EventPointer event,
+                                            const std::string &name):
+    Xtrsv<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XtrsvStridedBatched<T>::DoTrsvStridedBatched(const Layout layout, const Triangle triangle,
+                                                  const Transpose a_transpose,
+                                                  const Diagonal diagonal,
+                                                  const size_t n,
+                                                  const Buffer<T> &a_buffer, const size_t a_offset,
+                                                  const size_t a_ld, const size_t a_stride,
+                                                  const Buffer<T> &x_buffer, const size_t x_offset,
+                                                  const size_t x_inc, const size_t x_stride,
+                                                  const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count == 0) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // A single (possibly large) system is solved by many work-groups with the regular routine
+  if (batch_count == 1) {
+    DoTrsv(layout, triangle, a_transpose, diagonal, n,
+           a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc);
+    return;
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrices and vectors for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(n, n, a_buffer, a_offset + a_stride * batch, a_ld);
+    TestVectorX(n, x_buffer, x_offset + x_stride * batch, x_inc);
+  }
+
+  // Translates CLBlast arguments to 0/1 integers for the OpenCL kernel (see Xtrsv)
+  const auto is_unit_diagonal = (diagonal == Diagonal::kNonUnit) ? 0 : 1;
+  const auto is_transposed = ((a_transpose == Transpose::kNo && layout == Layout::kColMajor) ||
+                              (a_transpose != Transpose::kNo && layout != Layout::kColMajor)) ? 0 : 1;
+  const auto do_conjugate = (a_transpose == Transpose::kConjugate) ? 1 : 0;
+  const auto is_upper = ((triangle == Triangle::kUpper && a_transpose == Transpose::kNo) ||
+                         (triangle == Triangle::kLower && a_transpose != Transpose::kNo));
+  const auto is_forward = (is_upper) ? 0 : 1;
+
+  // Retrieves the kernel from the compiled binary and sets its arguments
+  auto kernel = GetKernel(this->program_, "trsv_batched");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, a_buffer());
+  kernel.SetArgument(2, static_cast<int>(a_offset));
+  kernel.SetArgument(3, static_cast<int>(a_ld));
+  kernel.SetArgument(4, static_cast<int>(a_stride));
+  kernel.SetArgument(5, x_buffer());
+  kernel.SetArgument(6, static_cast<int>(x_offset));
+  kernel.SetArgument(7, static_cast<int>(x_inc));
+  kernel.SetArgument(8, static_cast<int>(x_stride));
+  kernel.SetArgument(9, static_cast<int>(is_forward));
+  kernel.SetArgument(10, static_cast<int>(is_transposed));
+  kernel.SetArgument(11, static_cast<int>(is_unit_diagonal));
+  kernel.SetArgument(12, static_cast<int>(do_conjugate));
+
+  // Launches the kernel: a work-group per system
+  const auto local = ThreadRange{this->db_["TRSV_BLOCK_SIZE"]};
+  const auto global = ThreadRange{batch_count * this->db_["TRSV_BLOCK_SIZE"]};
+  RunKernel(kernel, this->queue_, this->device_, global, local, this->event_);
+}
+
+// =================================================================================================
+
+// The multiple right-hand sides version
+template <typename T>
+void XtrsvStridedBatched<T>::DoTrsvMultipleRhs(const Layout layout, const Triangle triangle,
+                                               const Transpose a_transpose,
+                                               const Diagonal diagonal,
+                                               const size_t n, const T alpha,
+                                               const Buffer<T> &a_buffer, const size_t a_offset,
+                                               const size_t a_ld,
+                                               const Buffer<T> &x_buffer, const size_t x_offset,
+                                               const size_t x_inc, const size_t x_stride,
+                                               const size_t num_rhs) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0 || num_rhs == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix and the first and last vectors for validity
+  TestMatrixA(n, n, a_buffer, a_offset, a_ld);
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorX(n, x_buffer, x_offset + x_stride * (num_rhs - 1), x_inc);
+
+  // Translates CLBlast arguments to 0/1 integers for the OpenCL kernel (see Xtrsv)
+  const auto is_unit_diagonal = (diagonal == Diagonal::kNonUnit) ? 0 : 1;
+  const auto is_transposed = ((a_transpose == Transpose::kNo && layout == Layout::kColMajor) ||
+                              (a_transpose != Transpose::kNo && layout != Layout::kColMajor)) ? 0 : 1;
+  const auto do_conjugate = (a_transpose == Transpose::kConjugate) ? 1 : 0;
+  const auto is_upper = ((triangle == Triangle::kUpper && a_transpose == Transpose::kNo) ||
+                         (triangle == Triangle::kLower && a_transpose != Transpose::kNo));
+  const auto is_forward = (is_upper) ? 0 : 1;
+
+  // Retrieves the kernel from the compiled binary and sets its arguments
+  auto kernel = GetKernel(this->program_, "trsv_multi_rhs");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, static_cast<int>(num_rhs));
+  kernel.SetArgument(2, GetRealArg(alpha));
+  kernel.SetArgument(3, a_buffer());
+  kernel.SetArgument(4, static_cast<int>(a_offset));
+  kernel.SetArgument(5, static_cast<int>(a_ld));
+  kernel.SetArgument(6, x_buffer());
+  kernel.SetArgument(7, static_cast<int>(x_offset));
+  kernel.SetArgument(8, static_cast<int>(x_inc));
+  kernel.SetArgument(9, static_cast<int>(x_stride));
+  kernel.SetArgument(10, static_cast<int>(is_forward));
+  kernel.SetArgument(11, static_cast<int>(is_transposed));
+  kernel.SetArgument(12, static_cast<int>(is_unit_diagonal));
+  kernel.SetArgument(13, static_cast<int>(do_conjugate));
+
+  // Launches the kernel: a work-group per group of right-hand sides
+  const auto num_groups = CeilDiv(num_rhs, kRhsPerWorkGroup);
+  const auto local = ThreadRange{this->db_["TRSV_BLOCK_SIZE"]};
+  const auto global = ThreadRange{num_groups * this->db_["TRSV_BLOCK_SIZE"]};
+  RunKernel(kernel, this->queue_, this->device_, global, local, this->event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XtrsvStridedBatched<half>;
+template class XtrsvStridedBatched<float>;
+template class XtrsvStridedBatched<double>;
+template class XtrsvStridedBatched<float2>;
+template class XtrsvStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,67 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XtrsvStridedBatched routine. This is a non-blas strided-batched version
+// of TRSV, solving each system with a single work-group such that all systems are solved in a
+// single kernel launch.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTRSVSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XTRSVSTRIDEDBATCHED_H_
+
+#include "routines/level2/xtrsv.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XtrsvStridedBatched: public Xtrsv<T> {
+ public:
+
+  // Uses the regular Xtrsv routine
+  using Xtrsv<T>::DoTrsv;
+
+  // Constructor
+  XtrsvStridedBatched(Queue &queue, EventPointer event,
+                      const std::string &name = "TRSVSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoTrsvStridedBatched(const Layout layout, const Triangle triangle,
+                            const Transpose a_transpose, const Diagonal diagonal,
+                            const size_t n,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const size_t a_stride,
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const size_t x_stride,
+                            const size_t batch_count);
+
+  // As above, but for 'num_rhs' systems with the same matrix A (e.g. the columns or rows of B in
+  // TRSM), of which the right-hand sides are scaled by alpha first. Each element of A is loaded
+  // once for a group of right-hand sides.
+  void DoTrsvMultipleRhs(const Layout layout, const Triangle triangle,
+                         const Transpose a_transpose, const Diagonal diagonal,
+                         const size_t n, const T alpha,
+                         const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                         const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                         const size_t x_stride,
+                         const size_t num_rhs);
+
+ private:
+
+  // The number of right-hand sides per work-group: this has to match 'TRSV_RHS' in the kernel
+  static constexpr size_t kRhsPerWorkGroup = 4;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XTRSVSTRIDEDBATCHED_H_
+#endif
@@ -15,6 +15,10 @@
 #define CLBLAST_ROUTINES_ROUTINES_H_
 
 // BLAS level-1 includes
+#include "routines/level1/xrotg.hpp"
+#include "routines/level1/xrotmg.hpp"
+#include "routines/level1/xrot.hpp"
+#include "routines/level1/xrotm.hpp"
 #include "routines/level1/xswap.hpp"
 #include "routines/level1/xscal.hpp"
 #include "routines/level1/xcopy.hpp"
@@ -43,6 +47,8 @@
 #include "routines/level2/xtbmv.hpp"
 #include "routines/level2/xtpmv.hpp"
 #include "routines/level2/xtrsv.hpp"
+#include "routines/level2/xtbsv.hpp"
+#include "routines/level2/xtpsv.hpp"
 #include "routines/level2/xger.hpp"
 #include "routines/level2/xgeru.hpp"
 #include "routines/level2/xgerc.hpp"
@@ -57,6 +63,8 @@
 
 // BLAS level-3 includes
 #include "routines/level3/xgemm.hpp"
+#include "routines/level3/xgemmplan.hpp"
+#include "routines/level3/xtrsmfactor.hpp"
 #include "routines/level3/xsymm.hpp"
 #include "routines/level3/xhemm.hpp"
 #include "routines/level3/xsyrk.hpp"
@@ -68,11 +76,55 @@
 
 // Level-x includes (non-BLAS)
 #include "routines/levelx/xhad.hpp"
+#include "routines/levelx/xaxpby.hpp"
+#include "routines/levelx/xaxpystridedbatched.hpp"
+#include "routines/levelx/xaxpbystridedbatched.hpp"
+#include "routines/levelx/xset.hpp"
+#include "routines/levelx/xsetstridedbatched.hpp"
+#include "routines/levelx/xscalstridedbatched.hpp"
+#include "routines/levelx/xdotstridedbatched.hpp"
+#include "routines/levelx/xnrm2stridedbatched.hpp"
+#include "routines/levelx/xasumstridedbatched.hpp"
 #include "routines/levelx/xomatcopy.hpp"
+#include "routines/levelx/xomatcopystridedbatched.hpp"
 #include "routines/levelx/xim2col.hpp"
+#include "routines/levelx/xim2colstridedbatched.hpp"
+#include "routines/levelx/xcol2im.hpp"
+#include "routines/levelx/xcol2imstridedbatched.hpp"
+#include "routines/levelx/xdotnrm2asum.hpp"
+#include "routines/levelx/xconvgemm.hpp"
+#include "routines/levelx/xpotrf.hpp"
 #include "routines/levelx/xaxpybatched.hpp"
+#include "routines/levelx/xrotbatched.hpp"
+#include "routines/levelx/xgemvbatched.hpp"
+#include "routines/levelx/xgemvstridedbatched.hpp"
+#include "routines/levelx/xtrsvstridedbatched.hpp"
 #include "routines/levelx/xgemmbatched.hpp"
 #include "routines/levelx/xgemmstridedbatched.hpp"
+#include "routines/levelx/xtrsmbatched.hpp"
+#include "routines/levelx/xtrsmstridedbatched.hpp"
+#include "routines/levelx/xsymmstridedbatched.hpp"
+#include "routines/levelx/xsyrkstridedbatched.hpp"
+#include "routines/levelx/xtrmmstridedbatched.hpp"
+#include "routines/levelx/xinvertbatched.hpp"
+#include "routines/levelx/xpotrfstridedbatched.hpp"
+#include "routines/levelx/xgemmgrouped.hpp"
+#include "routines/levelx/xaxpygrouped.hpp"
+#include "routines/levelx/xconvert.hpp"
+#include "routines/levelx/xgemmint8.hpp"
+#include "routines/levelx/xgemmmultidevice.hpp"
+#include "routines/levelx/xgemmstreaming.hpp"
+#include "routines/levelx/xgemvpair.hpp"
+#include "routines/levelx/xgemvquantized.hpp"
+#include "routines/levelx/xgemmmlp.hpp"
+#include "routines/levelx/xgerk.hpp"
+#include "routines/levelx/xpacked.hpp"
+#include "routines/levelx/xattentionstridedbatched.hpp"
+#include "routines/levelx/ximatcopy.hpp"
+#include "routines/levelx/xelementwise.hpp"
+#include "routines/levelx/xreduce.hpp"
+#include "routines/levelx/xgetrf.hpp"
+#include "routines/levelx/xcsr.hpp"
 
 // CLBLAST_ROUTINES_ROUTINES_H_
 #endif
@@ -0,0 +1,251 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the statistics counters (see the header for more information).
+//
+// =================================================================================================
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "statistics.hpp"
+#include "cache.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The counters of a single routine, host times are in nanoseconds
+struct RoutineCounters {
+  std::atomic<size_t> num_calls{0};
+  std::atomic<size_t> num_kernels{0};
+  std::atomic<uint64_t> host_time{0};
+  std::atomic<uint64_t> setup_time{0};
+  std::atomic<uint64_t> kernel_time{0};
+  std::atomic<uint64_t> launch_time{0};
+};
+
+namespace {
+
+  // The global counters, compilation times are in nanoseconds
+  std::atomic<size_t> num_compilations{0};
+  std::atomic<uint64_t> compilation_time{0};
+  std::atomic<uint64_t> source_time{0};
+  std::atomic<uint64_t> preprocessing_time{0};
+  std::atomic<uint64_t> build_time{0};
+  std::atomic<size_t> num_binary_loads{0};
+  std::atomic<uint64_t> binary_load_time{0};
+  std::atomic<uint64_t> database_time{0};
+  std::atomic<size_t> num_buffer_allocations{0};
+  std::atomic<size_t> buffer_bytes_allocated{0};
+  std::atomic<size_t> num_buffer_reuses{0};
+
+  // The counters per routine name. Entries are never removed, such that the pointers stay valid.
+  std::mutex routines_mutex;
+  std::unordered_map<std::string, std::unique_ptr<RoutineCounters>>& Routines() {
+    static std::unordered_map<std::string, std::unique_ptr<RoutineCounters>> routines;
+    return routines;
+  }
+
+  // The routine currently running on this host thread
+  RoutineCounters*& CurrentRoutine() {
+    static thread_local RoutineCounters* current = nullptr;
+    return current;
+  }
+
+  // The activity of this host thread, never reset
+  ThreadActivity& CurrentThreadActivity() {
+    static thread_local ThreadActivity activity = ThreadActivity{0, 0, 0};
+    return activity;
+  }
+
+  // Converts a host time duration to nanoseconds
+  uint64_t ToNanoseconds(const std::chrono::steady_clock::duration duration) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+  }
+} // anonymous namespace
+
+// =================================================================================================
+
+void CountCompilation(const double milliseconds, const double source_milliseconds,
+                      const double preprocessing_milliseconds, const double build_milliseconds) {
+  num_compilations.fetch_add(1, std::memory_order_relaxed);
+  CurrentThreadActivity().num_compilations++;
+  compilation_time.fetch_add(static_cast<uint64_t>(milliseconds * 1.0e6),
+                             std::memory_order_relaxed);
+  source_time.fetch_add(static_cast<uint64_t>(source_milliseconds * 1.0e6),
+                        std::memory_order_relaxed);
+  preprocessing_time.fetch_add(static_cast<uint64_t>(preprocessing_milliseconds * 1.0e6),
+                               std::memory_order_relaxed);
+  build_time.fetch_add(static_cast<uint64_t>(build_milliseconds * 1.0e6),
+                       std::memory_order_relaxed);
+}
+
+void CountBinaryLoad(const double milliseconds) {
+  num_binary_loads.fetch_add(1, std::memory_order_relaxed);
+  CurrentThreadActivity().num_binary_loads++;
+  binary_load_time.fetch_add(static_cast<uint64_t>(milliseconds * 1.0e6),
+                             std::memory_order_relaxed);
+}
+
+void CountDatabaseSearch(const double milliseconds) {
+  database_time.fetch_add(static_cast<uint64_t>(milliseconds * 1.0e6),
+                          std::memory_order_relaxed);
+}
+
+void CountBufferAllocation(const size_t bytes) {
+  num_buffer_allocations.fetch_add(1, std::memory_order_relaxed);
+  buffer_bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+  CurrentThreadActivity().num_buffer_allocations++;
+}
+
+const ThreadActivity& GetThreadActivity() {
+  return CurrentThreadActivity();
+}
+
+void CountBufferReuse() {
+  num_buffer_reuses.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CountKernelLaunch() {
+  const auto current = CurrentRoutine();
+  if (current) { current->num_kernels.fetch_add(1, std::memory_order_relaxed); }
+}
+
+void CountPhaseTime(const RoutinePhase phase, const std::chrono::steady_clock::time_point start_time) {
+  const auto current = CurrentRoutine();
+  if (!current) { return; }
+  const auto nanoseconds = ToNanoseconds(std::chrono::steady_clock::now() - start_time);
+  auto &counter = (phase == RoutinePhase::kKernel) ? current->kernel_time : current->launch_time;
+  counter.fetch_add(nanoseconds, std::memory_order_relaxed);
+}
+
+// =================================================================================================
+
+void CollectStatistics(Statistics &statistics) {
+  statistics.program_cache_hits = ProgramCache::Instance().NumHits();
+  statistics.program_cache_misses = ProgramCache::Instance().NumMisses();
+  statistics.binary_cache_hits = BinaryCache::Instance().NumHits();
+  statistics.binary_cache_misses = BinaryCache::Instance().NumMisses();
+  statistics.database_cache_hits = DatabaseCache::Instance().NumHits();
+  statistics.database_cache_misses = DatabaseCache::Instance().NumMisses();
+  statistics.kernel_cache_hits = KernelCache::Instance().NumHits();
+  statistics.kernel_cache_misses = KernelCache::Instance().NumMisses();
+  statistics.num_compilations = num_compilations.load();
+  statistics.compilation_time_ms = static_cast<double>(compilation_time.load()) * 1.0e-6;
+  statistics.source_time_ms = static_cast<double>(source_time.load()) * 1.0e-6;
+  statistics.preprocessing_time_ms = static_cast<double>(preprocessing_time.load()) * 1.0e-6;
+  statistics.build_time_ms = static_cast<double>(build_time.load()) * 1.0e-6;
+  statistics.num_binary_loads = num_binary_loads.load();
+  statistics.binary_load_time_ms = static_cast<double>(binary_load_time.load()) * 1.0e-6;
+  statistics.database_time_ms = static_cast<double>(database_time.load()) * 1.0e-6;
+  statistics.num_buffer_allocations = num_buffer_allocations.load();
+  statistics.buffer_bytes_allocated = buffer_bytes_allocated.load();
+  statistics.num_buffer_reuses = num_buffer_reuses.load();
+  statistics.routines.clear();
+  std::lock_guard<std::mutex> lock(routines_mutex);
+  for (const auto &routine : Routines()) {
+    if (routine.second->num_calls.load() == 0) { continue; } // e.g. after a reset
+    auto &result = statistics.routines[routine.first];
+    result.num_calls = routine.second->num_calls.load();
+    result.num_kernels = routine.second->num_kernels.load();
+    result.host_time_ms = static_cast<double>(routine.second->host_time.load()) * 1.0e-6;
+    result.setup_time_ms = static_cast<double>(routine.second->setup_time.load()) * 1.0e-6;
+    result.kernel_time_ms = static_cast<double>(routine.second->kernel_time.load()) * 1.0e-6;
+    result.launch_time_ms = static_cast<double>(routine.second->launch_time.load()) * 1.0e-6;
+  }
+}
+
+void ResetAllStatistics() {
+  ProgramCache::Instance().ResetStatistics();
+  BinaryCache::Instance().ResetStatistics();
+  DatabaseCache::Instance().ResetStatistics();
+  KernelCache::Instance().ResetStatistics();
+  num_compilations = 0;
+  compilation_time = 0;
+  source_time = 0;
+  preprocessing_time = 0;
+  build_time = 0;
+  num_binary_loads = 0;
+  binary_load_time = 0;
+  database_time = 0;
+  num_buffer_allocations = 0;
+  buffer_bytes_allocated = 0;
+  num_buffer_reuses = 0;
+  std::lock_guard<std::mutex> lock(routines_mutex);
+  for (const auto &routine : Routines()) {
+    routine.second->num_calls = 0;
+    routine.second->num_kernels = 0;
+    routine.second->host_time = 0;
+    routine.second->setup_time = 0;
+    routine.second->kernel_time = 0;
+    routine.second->launch_time = 0;
+  }
+}
+
+// =================================================================================================
+
+RoutineStatisticsScope::RoutineStatisticsScope(const std::string &routine_name):
+    counters_(nullptr),
+    previous_counters_(CurrentRoutine()),
+    start_time_(std::chrono::steady_clock::now()),
+    setup_end_time_(),
+    has_setup_(false) {
+  {
+    std::lock_guard<std::mutex> lock(routines_mutex);
+    auto &counters = Routines()[routine_name];
+    if (!counters) { counters = std::unique_ptr<RoutineCounters>(new RoutineCounters()); }
+    counters_ = counters.get();
+  }
+  counters_->num_calls.fetch_add(1, std::memory_order_relaxed);
+  CurrentRoutine() = counters_;
+}
+
+RoutineStatisticsScope::~RoutineStatisticsScope() {
+  End();
+}
+
+void RoutineStatisticsScope::EndSetup() {
+  setup_end_time_ = std::chrono::steady_clock::now();
+  has_setup_ = true;
+}
+
+void RoutineStatisticsScope::End() {
+  if (counters_ == nullptr) { return; }
+  counters_->host_time.fetch_add(ToNanoseconds(std::chrono::steady_clock::now() - start_time_),
+                                 std::memory_order_relaxed);
+  if (has_setup_) {
+    counters_->setup_time.fetch_add(ToNanoseconds(setup_end_time_ - start_time_),
+                                    std::memory_order_relaxed);
+  }
+  CurrentRoutine() = previous_counters_;
+  counters_ = nullptr;
+}
+
+RoutineStatisticsScope::RoutineStatisticsScope(const RoutineStatisticsScope &other):
+    counters_(nullptr),
+    previous_counters_(other.previous_counters_),
+    start_time_(other.start_time_),
+    setup_end_time_(other.setup_end_time_),
+    has_setup_(other.has_setup_) {
+}
+
+RoutineStatisticsScope::RoutineStatisticsScope(RoutineStatisticsScope &&other):
+    counters_(other.counters_),
+    previous_counters_(other.previous_counters_),
+    start_time_(other.start_time_),
+    setup_end_time_(other.setup_end_time_),
+    has_setup_(other.has_setup_) {
+  other.counters_ = nullptr;
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,114 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the counters behind 'GetStatistics': compilations, temporary buffers, and
+// per routine the number of calls, kernel launches, and host time (split into phases). All counters
+// are atomics, such that they are cheap enough to be always enabled. The cache hits and misses are counted by the
+// caches themselves (see 'Cache::NumHits').
+//
+// =================================================================================================
+
+#ifndef CLBLAST_STATISTICS_H_
+#define CLBLAST_STATISTICS_H_
+
+#include <string>
+#include <chrono>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Counts a compilation of a program from source and the time it took, split into phases
+void CountCompilation(const double milliseconds, const double source_milliseconds,
+                      const double preprocessing_milliseconds, const double build_milliseconds);
+
+// Counts the creation of a program from a cached binary and the time it took
+void CountBinaryLoad(const double milliseconds);
+
+// Counts the time of a search of the kernel parameters for a device (a database cache miss)
+void CountDatabaseSearch(const double milliseconds);
+
+// Counts a temporary buffer: either a newly allocated one of 'bytes' bytes or one from the pool
+void CountBufferAllocation(const size_t bytes);
+void CountBufferReuse();
+
+// The compilations, binary loads, and newly allocated temporary buffers of this host thread so far,
+// e.g. to attribute them to a single routine call (see 'SlowCallScope')
+struct ThreadActivity {
+  size_t num_compilations;
+  size_t num_binary_loads;
+  size_t num_buffer_allocations;
+};
+const ThreadActivity& GetThreadActivity();
+
+// Counts a kernel launch for the routine currently running on this host thread (if any)
+void CountKernelLaunch();
+
+// The phases of a routine call of which the host time is counted separately (besides the setup)
+enum class RoutinePhase { kKernel, kLaunch };
+
+// Adds the host time since 'start_time' to a phase of the routine currently running on this host
+// thread (if any)
+void CountPhaseTime(const RoutinePhase phase, const std::chrono::steady_clock::time_point start_time);
+
+// Gathers all counters including those of the caches, or resets them to zero
+void CollectStatistics(Statistics &statistics);
+void ResetAllStatistics();
+
+// The counters of a single routine, see the source file
+struct RoutineCounters;
+
+// Counts a routine call and its host time from construction until destruction of the object. The
+// kernels launched in the meantime from this host thread are attributed to the routine, nested
+// routine calls (e.g. GEMM within TRSM) count for themselves.
+class RoutineStatisticsScope {
+ public:
+  explicit RoutineStatisticsScope(const std::string &routine_name);
+  ~RoutineStatisticsScope();
+
+  // Marks the end of the setup phase of the call (the construction of the routine), if called
+  // multiple times the last one counts
+  void EndSetup();
+
+  // Ends the call before destruction, e.g. for objects which outlive the call such as GEMM plans
+  void End();
+
+  // Only one object counts the call: a copy is inactive, a move transfers the call
+  RoutineStatisticsScope(const RoutineStatisticsScope &other);
+  RoutineStatisticsScope(RoutineStatisticsScope &&other);
+  RoutineStatisticsScope& operator=(const RoutineStatisticsScope&) = delete;
+
+ private:
+  RoutineCounters *counters_; // nullptr if inactive
+  RoutineCounters *previous_counters_;
+  std::chrono::steady_clock::time_point start_time_;
+  std::chrono::steady_clock::time_point setup_end_time_;
+  bool has_setup_;
+};
+
+// Counts the host time of a phase from construction until destruction of the object
+class PhaseStatisticsScope {
+ public:
+  explicit PhaseStatisticsScope(const RoutinePhase phase):
+      phase_(phase), start_time_(std::chrono::steady_clock::now()) { }
+  ~PhaseStatisticsScope() { CountPhaseTime(phase_, start_time_); }
+  PhaseStatisticsScope(const PhaseStatisticsScope&) = delete;
+  PhaseStatisticsScope& operator=(const PhaseStatisticsScope&) = delete;
+
+ private:
+  const RoutinePhase phase_;
+  const std::chrono::steady_clock::time_point start_time_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_STATISTICS_H_
+#endif
@@ -0,0 +1,124 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements tiered compilation (see the header for more information).
+//
+// =================================================================================================
+
+#include <string>
+#include <deque>
+#include <set>
+#include <utility>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <cstdlib>
+
+#include "tiered_compilation.hpp"
+#include "memory_pool.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+  std::atomic<bool> tiered_compilation_enabled{false};
+
+  // See the comment at the top of the header
+  class TieredCompiler {
+   public:
+    static TieredCompiler &Instance() {
+      static TieredCompiler instance;
+      return instance;
+    }
+
+    // Enables tiered compilation in case the environmental variable is set (to anything but '0')
+    static bool InitFromEnvironment() {
+      const auto environment_variable = std::getenv("CLBLAST_TIERED_COMPILATION");
+      if (environment_variable == nullptr || std::string{environment_variable} == "0") {
+        return false;
+      }
+      tiered_compilation_enabled = true;
+      return true;
+    }
+
+    void Add(const ProgramKey &key, const std::function<void()> &build) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stop_ || known_.find(key) != known_.end()) { return; }
+      known_.insert(key);
+      pending_.push_back(std::make_pair(key, build));
+      if (!worker_.joinable()) { worker_ = std::thread([this]() { Run(); }); }
+      condition_.notify_all();
+    }
+
+    // Pending builds are dropped at exit, only a running build is waited for
+    ~TieredCompiler() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        pending_.clear();
+      }
+      condition_.notify_all();
+      if (worker_.joinable()) { worker_.join(); }
+    }
+
+   private:
+    // The caches are created first, such that they are destroyed only after the build thread
+    TieredCompiler(): stop_(false) {
+      BinaryCache::Instance(); ProgramCache::Instance(); KernelCache::Instance();
+      DatabaseCache::Instance(); BinaryDiskCache::Instance(); MemoryPool::Instance();
+    }
+
+    // Builds the pending programs one by one. A program which was built is found in the program
+    // cache from then on, one which failed to build stays in 'known_' such that it is not retried.
+    void Run() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (!stop_) {
+        condition_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+        if (stop_) { break; }
+        const auto build = pending_.front();
+        pending_.pop_front();
+        lock.unlock();
+        auto success = true;
+        try { build.second(); }
+        catch (...) { success = false; }
+        lock.lock();
+        if (success) { known_.erase(build.first); }
+      }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<std::pair<ProgramKey, std::function<void()>>> pending_;
+    std::set<ProgramKey> known_; // pending or failed
+    std::thread worker_;
+    bool stop_;
+  };
+} // anonymous namespace
+
+// =================================================================================================
+
+void EnableTieredCompilation(const bool enabled) {
+  IsTieredCompilationEnabled(); // first applies the environmental variable, which is overridden here
+  tiered_compilation_enabled = enabled;
+}
+
+bool IsTieredCompilationEnabled() {
+  static const auto from_environment = TieredCompiler::InitFromEnvironment();
+  static_cast<void>(from_environment);
+  return tiered_compilation_enabled.load(std::memory_order_relaxed);
+}
+
+void BuildInBackground(const ProgramKey &key, const std::function<void()> &build) {
+  TieredCompiler::Instance().Add(key, build);
+}
+
+// =================================================================================================
+} // namespace clblast
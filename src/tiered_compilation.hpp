@@ -0,0 +1,43 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the optional tiered compilation (see 'SetTieredCompilation'). A routine of
+// which the tuned programs can't be retrieved from one of the caches is served with the programs
+// for the generic (device-independent default) parameters instead, while a background thread builds
+// the tuned programs. Later calls use the tuned programs once they are in the program cache. This is
+// only available for OpenCL.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TIERED_COMPILATION_H_
+#define CLBLAST_TIERED_COMPILATION_H_
+
+#include <functional>
+
+#include "utilities/utilities.hpp"
+#include "cache.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Enables or disables tiered compilation
+void EnableTieredCompilation(const bool enabled);
+
+// Whether or not tiered compilation is enabled, cheap enough to be called for every routine call
+bool IsTieredCompilationEnabled();
+
+// Runs a program build on the background thread, unless the program with the same key is already
+// pending or failed to build before. The build stores the program in the cache itself.
+void BuildInBackground(const ProgramKey &key, const std::function<void()> &build);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TIERED_COMPILATION_H_
+#endif
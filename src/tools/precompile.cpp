@@ -0,0 +1,130 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the 'clblast_precompile' tool, which compiles the kernels ahead-of-time for
+// a selection of devices and packages the binaries into a single cache file (see 'SaveCacheFile').
+// The file can be shipped with an application and loaded at run-time with 'LoadCacheFile' or
+// through the 'CLBLAST_CACHE_FILE' environmental variable, such that no kernels are compiled there.
+//
+// Usage: clblast_precompile <output file> [-platform <id>] [-devices <ids>|all]
+//                           [-routines <names>] [-precisions <values>]
+//
+// Lists are comma-separated, e.g. '-routines GEMM,GEMV -precisions 32,3232'. Without a selection of
+// routines, all routines are compiled for single and double precision (as 'FillCache' does).
+//
+// =================================================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <sstream>
+
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS // to disable deprecation warnings
+
+#include <clblast.h>
+
+namespace {
+// =================================================================================================
+
+// Splits a comma-separated list
+std::vector<std::string> SplitList(const std::string &list) {
+  auto items = std::vector<std::string>();
+  std::istringstream stream(list);
+  auto item = std::string{};
+  while (std::getline(stream, item, ',')) {
+    if (!item.empty()) { items.push_back(item); }
+  }
+  return items;
+}
+
+int PrintUsage(const char *name) {
+  fprintf(stderr, "Usage: %s <output file> [-platform <id>] [-devices <ids>|all] "
+                  "[-routines <names>] [-precisions <values>]\n", name);
+  return 1;
+}
+
+// =================================================================================================
+} // anonymous namespace
+
+int main(int argc, char *argv[]) {
+  using namespace clblast;
+
+  // Parses the command-line arguments
+  if (argc < 2 || argv[1][0] == '-') { return PrintUsage(argv[0]); }
+  const auto file_name = std::string{argv[1]};
+  auto platform_id = size_t{0};
+  auto device_list = std::string{"0"};
+  auto routines = std::vector<std::string>();
+  auto precisions = std::vector<Precision>{Precision::kSingle, Precision::kComplexSingle,
+                                           Precision::kDouble, Precision::kComplexDouble};
+  for (auto i = 2; i < argc; i += 2) {
+    const auto option = std::string{argv[i]};
+    if (i + 1 >= argc) { return PrintUsage(argv[0]); }
+    const auto value = std::string{argv[i + 1]};
+    if (option == "-platform") { platform_id = static_cast<size_t>(std::atoi(value.c_str())); }
+    else if (option == "-devices") { device_list = value; }
+    else if (option == "-routines") { routines = SplitList(value); }
+    else if (option == "-precisions") {
+      precisions.clear();
+      for (const auto &precision : SplitList(value)) {
+        precisions.push_back(static_cast<Precision>(std::atoi(precision.c_str())));
+      }
+    }
+    else { return PrintUsage(argv[0]); }
+  }
+
+  // Retrieves the OpenCL platform and devices
+  auto num_platforms = cl_uint{0};
+  clGetPlatformIDs(0, nullptr, &num_platforms);
+  auto platforms = std::vector<cl_platform_id>(num_platforms);
+  clGetPlatformIDs(num_platforms, platforms.data(), nullptr);
+  if (platform_id >= platforms.size()) {
+    fprintf(stderr, "Invalid platform ID %zu\n", platform_id);
+    return 1;
+  }
+  auto num_devices = cl_uint{0};
+  clGetDeviceIDs(platforms[platform_id], CL_DEVICE_TYPE_ALL, 0, nullptr, &num_devices);
+  auto all_devices = std::vector<cl_device_id>(num_devices);
+  clGetDeviceIDs(platforms[platform_id], CL_DEVICE_TYPE_ALL, num_devices, all_devices.data(), nullptr);
+  auto devices = std::vector<cl_device_id>();
+  if (device_list == "all") { devices = all_devices; }
+  else {
+    for (const auto &device : SplitList(device_list)) {
+      const auto device_id = static_cast<size_t>(std::atoi(device.c_str()));
+      if (device_id >= all_devices.size()) {
+        fprintf(stderr, "Invalid device ID %zu\n", device_id);
+        return 1;
+      }
+      devices.push_back(all_devices[device_id]);
+    }
+  }
+
+  // Compiles the kernels for each device and saves the binaries of all devices in a single file
+  for (auto i = size_t{0}; i < devices.size(); ++i) {
+    auto device_name = std::string(256, '\0');
+    clGetDeviceInfo(devices[i], CL_DEVICE_NAME, device_name.size(), &device_name[0], nullptr);
+    printf("* Compiling the kernels for '%s'\n", device_name.c_str());
+    const auto status = (routines.empty()) ? FillCache(devices[i])
+                                           : FillCache(devices[i], routines, precisions);
+    if (status != StatusCode::kSuccess) {
+      fprintf(stderr, "Compilation failed with status %d\n", static_cast<int>(status));
+      return 1;
+    }
+  }
+  const auto status = SaveCacheFile(devices, file_name);
+  if (status != StatusCode::kSuccess) {
+    fprintf(stderr, "Saving '%s' failed with status %d\n", file_name.c_str(), static_cast<int>(status));
+    return 1;
+  }
+  printf("* Saved the binaries to '%s'\n", file_name.c_str());
+  return 0;
+}
+
+// =================================================================================================
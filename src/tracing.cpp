@@ -0,0 +1,142 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the tracer and the call recorder (see the header for more information).
+//
+// =================================================================================================
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "tracing.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+  // Escapes a string for use in JSON
+  std::string EscapeJSON(const std::string &value) {
+    auto result = std::string{};
+    for (const auto character : value) {
+      if (character == '"' || character == '\\') { result += '\\'; }
+      if (static_cast<unsigned char>(character) < 0x20) { result += ' '; continue; }
+      result += character;
+    }
+    return result;
+  }
+
+  void WriteTraceAtExit() { Tracer::Instance().Write(); }
+  void FlushRecordAtExit() { CallRecorder::Instance().Flush(); }
+} // anonymous namespace
+
+// =================================================================================================
+
+bool Tracer::InitFromEnvironment() {
+  const auto environment_variable = std::getenv("CLBLAST_TRACE");
+  return environment_variable != nullptr && environment_variable[0] != '\0';
+}
+
+// The tracer is never destroyed, such that late device spans (reported from threads of the OpenCL
+// implementation) can still be recorded after the trace is written
+Tracer &Tracer::Instance() {
+  static auto instance = new Tracer();
+  return *instance;
+}
+
+Tracer::Tracer():
+    file_name_(InitFromEnvironment() ? std::getenv("CLBLAST_TRACE") : ""),
+    start_time_(std::chrono::steady_clock::now()) {
+  std::atexit(WriteTraceAtExit);
+}
+
+double Tracer::Now() const {
+  const auto elapsed_time = std::chrono::steady_clock::now() - start_time_;
+  return std::chrono::duration<double,std::micro>(elapsed_time).count();
+}
+
+void Tracer::AddHostSpan(const std::string &name, const char *category, const double start,
+                         const double duration) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto inserted = host_threads_.emplace(std::this_thread::get_id(), host_threads_.size() + 1);
+  spans_.push_back(Span{name, category, start, duration, 1, inserted.first->second});
+}
+
+void Tracer::AddDeviceSpan(const std::string &name, const char *category, const double start,
+                           const double duration, const void *track) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto inserted = device_tracks_.emplace(track, device_tracks_.size() + 1);
+  spans_.push_back(Span{name, category, start, duration, 2, inserted.first->second});
+}
+
+// Writes the spans in the Chrome trace event format, naming the host and device 'processes'
+void Tracer::Write() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (file_name_.empty()) { return; }
+  auto file = fopen(file_name_.c_str(), "w");
+  if (file == nullptr) {
+    fprintf(stderr, "CLBlast: could not write the trace to '%s'\n", file_name_.c_str());
+    return;
+  }
+  fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+  fprintf(file, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, "
+                "\"args\": {\"name\": \"CLBlast host\"}},\n");
+  fprintf(file, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 2, "
+                "\"args\": {\"name\": \"CLBlast device\"}}");
+  for (const auto &span : spans_) {
+    fprintf(file, ",\n{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", \"ts\": %.3lf, "
+                  "\"dur\": %.3lf, \"pid\": %zu, \"tid\": %zu}",
+            EscapeJSON(span.name).c_str(), span.category, span.start, span.duration,
+            span.process, span.thread);
+  }
+  fprintf(file, "\n]}\n");
+  fclose(file);
+}
+
+// =================================================================================================
+
+bool CallRecorder::InitFromEnvironment() {
+  const auto environment_variable = std::getenv("CLBLAST_RECORD");
+  return environment_variable != nullptr && environment_variable[0] != '\0';
+}
+
+// As the tracer, the recorder is never destroyed, such that late calls can still be recorded
+CallRecorder &CallRecorder::Instance() {
+  static auto instance = new CallRecorder();
+  return *instance;
+}
+
+CallRecorder::CallRecorder():
+    file_(InitFromEnvironment() ? fopen(std::getenv("CLBLAST_RECORD"), "w") : nullptr) {
+  if (file_ == nullptr) {
+    if (InitFromEnvironment()) {
+      fprintf(stderr, "CLBlast: could not open '%s' to record the calls\n", std::getenv("CLBLAST_RECORD"));
+    }
+    return;
+  }
+  fprintf(file_, "# CLBlast call record: routine precision name=value ...\n");
+  std::atexit(FlushRecordAtExit);
+}
+
+void CallRecorder::Record(const char *routine, const int precision,
+                          std::initializer_list<std::pair<const char*, size_t>> arguments) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (file_ == nullptr) { return; }
+  fprintf(file_, "%s %d", routine, precision);
+  for (const auto &argument : arguments) { fprintf(file_, " %s=%zu", argument.first, argument.second); }
+  fprintf(file_, "\n");
+}
+
+void CallRecorder::Flush() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (file_ != nullptr) { fflush(file_); }
+}
+
+// =================================================================================================
+} // namespace clblast
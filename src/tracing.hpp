@@ -0,0 +1,166 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the optional tracer. If the environmental variable CLBLAST_TRACE is set to a
+// file name, the host-side activity of CLBlast (routine calls, database searches, compilation,
+// temporary buffer allocation, kernel launches) is recorded as nested spans per host thread. For
+// OpenCL, the execution of the kernels on the device is recorded as well. At process exit, the
+// spans are written to the file in the Chrome trace event JSON format, which can also be opened
+// with Perfetto. When the variable is not set, a span costs a single check of a static boolean.
+//
+// This file also implements the optional call recorder. If the environmental variable
+// CLBLAST_RECORD is set to a file name, the shape of every call of the API (routine, precision, and
+// the sizes, options, offsets, leading dimensions, increments and batch count) is written to the
+// file as one line, such that the workload can be replayed with 'clblast_bench_replay'.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TRACING_H_
+#define CLBLAST_TRACING_H_
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <initializer_list>
+#include <cstdio>
+
+namespace clblast {
+// =================================================================================================
+
+// The tracer singleton, see comment at top of file
+class Tracer {
+ public:
+
+  // Whether or not tracing is enabled by the environmental variable
+  static bool IsEnabled() {
+    static const auto enabled = InitFromEnvironment();
+    return enabled;
+  }
+
+  static Tracer &Instance();
+
+  // The current time in microseconds since the start of the trace
+  double Now() const;
+
+  // Records a completed span on the calling host thread
+  void AddHostSpan(const std::string &name, const char *category, const double start,
+                   const double duration);
+
+  // Records a completed span on a device track (e.g. one per queue)
+  void AddDeviceSpan(const std::string &name, const char *category, const double start,
+                     const double duration, const void *track);
+
+  // Writes the trace to the file, called at process exit
+  void Write();
+
+ private:
+  Tracer();
+  static bool InitFromEnvironment();
+
+  struct Span {
+    std::string name;
+    const char *category;
+    double start;
+    double duration;
+    size_t process; // 1: host, 2: device
+    size_t thread;
+  };
+
+  const std::string file_name_;
+  const std::chrono::steady_clock::time_point start_time_;
+  std::mutex mutex_;
+  std::vector<Span> spans_;
+  std::unordered_map<std::thread::id, size_t> host_threads_;
+  std::unordered_map<const void*, size_t> device_tracks_;
+};
+
+// =================================================================================================
+
+// Records a span from construction until destruction of the object. Nested scopes on the same host
+// thread become nested spans in the trace.
+class TraceScope {
+ public:
+  TraceScope(): active_(false), category_(nullptr), start_(0.0) { }
+  TraceScope(const char *name, const char *category):
+      active_(Tracer::IsEnabled()), category_(category),
+      start_(active_ ? Tracer::Instance().Now() : 0.0) {
+    if (active_) { name_ = name; }
+  }
+  TraceScope(const std::string &name, const char *category):
+      active_(Tracer::IsEnabled()), category_(category),
+      start_(active_ ? Tracer::Instance().Now() : 0.0) {
+    if (active_) { name_ = name; }
+  }
+  ~TraceScope() { End(); }
+
+  // Ends the span before destruction, e.g. for objects which outlive the call such as GEMM plans
+  void End() {
+    if (active_) {
+      auto &tracer = Tracer::Instance();
+      tracer.AddHostSpan(name_, category_, start_, tracer.Now() - start_);
+      active_ = false;
+    }
+  }
+
+  // Only one object records the span: a copy is inactive, a move transfers the span
+  TraceScope(const TraceScope &other):
+      active_(false), category_(other.category_), start_(other.start_) { }
+  TraceScope(TraceScope &&other):
+      active_(other.active_), name_(std::move(other.name_)), category_(other.category_),
+      start_(other.start_) {
+    other.active_ = false;
+  }
+  TraceScope& operator=(const TraceScope&) = delete;
+
+ private:
+  bool active_;
+  std::string name_;
+  const char *category_;
+  double start_;
+};
+
+// =================================================================================================
+
+// The call recorder singleton, see comment at top of file. Each line of the file holds the routine
+// name and the precision, followed by 'name=value' pairs with the values of the enums as integers.
+class CallRecorder {
+ public:
+
+  // Whether or not recording is enabled by the environmental variable
+  static bool IsEnabled() {
+    static const auto enabled = InitFromEnvironment();
+    return enabled;
+  }
+
+  static CallRecorder &Instance();
+
+  // Records a call of a routine
+  void Record(const char *routine, const int precision,
+              std::initializer_list<std::pair<const char*, size_t>> arguments);
+
+  // Writes the buffered records to the file, called at process exit
+  void Flush();
+
+ private:
+  CallRecorder();
+  static bool InitFromEnvironment();
+
+  std::mutex mutex_;
+  FILE* file_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TRACING_H_
+#endif
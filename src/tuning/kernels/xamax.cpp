@@ -0,0 +1,41 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the xamax OpenCL kernels.
+//
+// =================================================================================================
+
+#include "tuning/kernels/xamax.hpp"
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Function to tune a specific variation V (not within the clblast namespace)
+template <int V>
+void StartVariation(int argc, char *argv[]) {
+  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+  switch(clblast::GetPrecision(command_line_args)) {
+    case clblast::Precision::kHalf: clblast::Tuner<half>(argc, argv, V, clblast::XamaxGetTunerDefaults, clblast::XamaxGetTunerSettings<half>, clblast::XamaxTestValidArguments<half>, clblast::XamaxSetConstraints, clblast::XamaxComputeLocalMemSize<half>, clblast::XamaxSetArguments<half>); break;
+    case clblast::Precision::kSingle: clblast::Tuner<float>(argc, argv, V, clblast::XamaxGetTunerDefaults, clblast::XamaxGetTunerSettings<float>, clblast::XamaxTestValidArguments<float>, clblast::XamaxSetConstraints, clblast::XamaxComputeLocalMemSize<float>, clblast::XamaxSetArguments<float>); break;
+    case clblast::Precision::kDouble: clblast::Tuner<double>(argc, argv, V, clblast::XamaxGetTunerDefaults, clblast::XamaxGetTunerSettings<double>, clblast::XamaxTestValidArguments<double>, clblast::XamaxSetConstraints, clblast::XamaxComputeLocalMemSize<double>, clblast::XamaxSetArguments<double>); break;
+    case clblast::Precision::kComplexSingle: clblast::Tuner<float2>(argc, argv, V, clblast::XamaxGetTunerDefaults, clblast::XamaxGetTunerSettings<float2>, clblast::XamaxTestValidArguments<float2>, clblast::XamaxSetConstraints, clblast::XamaxComputeLocalMemSize<float2>, clblast::XamaxSetArguments<float2>); break;
+    case clblast::Precision::kComplexDouble: clblast::Tuner<double2>(argc, argv, V, clblast::XamaxGetTunerDefaults, clblast::XamaxGetTunerSettings<double2>, clblast::XamaxTestValidArguments<double2>, clblast::XamaxSetConstraints, clblast::XamaxComputeLocalMemSize<double2>, clblast::XamaxSetArguments<double2>); break;
+  }
+}
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  StartVariation<1>(argc, argv);
+  StartVariation<2>(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,41 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the xasum OpenCL kernels.
+//
+// =================================================================================================
+
+#include "tuning/kernels/xasum.hpp"
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Function to tune a specific variation V (not within the clblast namespace)
+template <int V>
+void StartVariation(int argc, char *argv[]) {
+  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+  switch(clblast::GetPrecision(command_line_args)) {
+    case clblast::Precision::kHalf: clblast::Tuner<half>(argc, argv, V, clblast::XasumGetTunerDefaults, clblast::XasumGetTunerSettings<half>, clblast::XasumTestValidArguments<half>, clblast::XasumSetConstraints, clblast::XasumComputeLocalMemSize<half>, clblast::XasumSetArguments<half>); break;
+    case clblast::Precision::kSingle: clblast::Tuner<float>(argc, argv, V, clblast::XasumGetTunerDefaults, clblast::XasumGetTunerSettings<float>, clblast::XasumTestValidArguments<float>, clblast::XasumSetConstraints, clblast::XasumComputeLocalMemSize<float>, clblast::XasumSetArguments<float>); break;
+    case clblast::Precision::kDouble: clblast::Tuner<double>(argc, argv, V, clblast::XasumGetTunerDefaults, clblast::XasumGetTunerSettings<double>, clblast::XasumTestValidArguments<double>, clblast::XasumSetConstraints, clblast::XasumComputeLocalMemSize<double>, clblast::XasumSetArguments<double>); break;
+    case clblast::Precision::kComplexSingle: clblast::Tuner<float2>(argc, argv, V, clblast::XasumGetTunerDefaults, clblast::XasumGetTunerSettings<float2>, clblast::XasumTestValidArguments<float2>, clblast::XasumSetConstraints, clblast::XasumComputeLocalMemSize<float2>, clblast::XasumSetArguments<float2>); break;
+    case clblast::Precision::kComplexDouble: clblast::Tuner<double2>(argc, argv, V, clblast::XasumGetTunerDefaults, clblast::XasumGetTunerSettings<double2>, clblast::XasumTestValidArguments<double2>, clblast::XasumSetConstraints, clblast::XasumComputeLocalMemSize<double2>, clblast::XasumSetArguments<double2>); break;
+  }
+}
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  StartVariation<1>(argc, argv);
+  StartVariation<2>(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
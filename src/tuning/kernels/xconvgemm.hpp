@@ -0,0 +1,190 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the convgemm kernel: the direct GEMM kernel with the im2col
+// transformation fused into the loads of matrix A. It tests a limited set of tuning parameters
+// exhaustively, similar to the first variation of the direct GEMM tuner.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+#include "tuning/tuning.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Helpers for the GEMM sizes of the convolution
+template <typename T>
+size_t XconvgemmNumPatches(const Arguments<T> &args) {
+  const auto size_h = args.height + 2 * args.pad_h;
+  const auto padding_h = args.dilation_h * (args.kernel_h - 1) + 1;
+  const auto output_h = (size_h >= padding_h) ? (size_h - padding_h) / args.stride_h + 1 : 1;
+  const auto size_w = args.width + 2 * args.pad_w;
+  const auto padding_w = args.dilation_w * (args.kernel_w - 1) + 1;
+  const auto output_w = (size_w >= padding_w) ? (size_w - padding_w) / args.stride_w + 1 : 1;
+  return output_h * output_w;
+}
+template <typename T>
+size_t XconvgemmPatchSize(const Arguments<T> &args) {
+  return args.channels * args.kernel_h * args.kernel_w;
+}
+
+// Settings for this kernel (default command-line arguments)
+TunerDefaults XconvgemmGetTunerDefaults(const int) {
+  auto settings = TunerDefaults();
+  settings.options = {kArgChannels, kArgHeight, kArgWidth, kArgKernelH, kArgKernelW,
+                      kArgNumKernels, kArgBatchCount, kArgFraction,
+                      kArgHeuristicSelection, kArgPsoSwarmSize,
+                      kArgPsoInfGlobal, kArgPsoInfLocal, kArgPsoInfRandom,
+                      kArgAnnMaxTemp};
+  settings.default_channels = 32;
+  settings.default_height = 66; // such that the output is 64 by 64 for a 3 by 3 kernel
+  settings.default_width = 66;
+  settings.default_kernel_h = 3;
+  settings.default_kernel_w = 3;
+  settings.default_num_kernels = 32;
+  settings.default_batch_count = 4;
+  settings.default_fraction = 1.0; // test all
+  settings.default_num_runs = 2;
+  return settings;
+}
+
+// Settings for this kernel (general)
+template <typename T>
+TunerSettings XconvgemmGetTunerSettings(const int, const Arguments<T> &args) {
+  auto settings = TunerSettings();
+
+  // Identification of the kernel
+  settings.kernel_family = "xconvgemm";
+  settings.kernel_name = "Xconvgemm";
+  settings.sources =
+#include "../src/kernels/level3/xgemm_epilogue.opencl"
+#include "../src/kernels/level3/xgemm_direct_part1.opencl"
+#include "../src/kernels/level3/xgemm_direct_part2.opencl"
+#include "../src/kernels/levelx/xconvgemm.opencl"
+  ;
+
+  // Buffer sizes: the images, the kernels, and the results
+  const auto num_patches = XconvgemmNumPatches(args);
+  const auto patch_size = XconvgemmPatchSize(args);
+  settings.size_a = args.channels * args.height * args.width * args.batch_count;
+  settings.size_b = patch_size * args.num_kernels;
+  settings.size_c = num_patches * args.num_kernels * args.batch_count;
+
+  // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5)
+  settings.inputs = {2, 3, 4};
+  settings.outputs = {4};
+
+  // Sets the base thread configuration
+  settings.global_size = {num_patches, args.num_kernels, args.batch_count};
+  settings.global_size_ref = settings.global_size;
+  settings.local_size = {1, 1, 1};
+  settings.local_size_ref = {8, 8, 1};
+
+  // Transforms the thread configuration based on the parameters
+  settings.mul_local = {{"MDIMCD", "NDIMCD"}};
+  settings.mul_global = {{"MDIMCD", "NDIMCD"}};
+  settings.div_global = {{"WGD", "WGD"}};
+
+  // Sets the tuning parameters and their possible values
+  settings.parameters = {
+    {"WGD", {8, 16, 32}},
+    {"MDIMCD", {8, 16, 32}},
+    {"NDIMCD", {8, 16, 32}},
+    {"MDIMAD", {8, 16, 32}},
+    {"NDIMBD", {8, 16, 32}},
+    {"KWID", {1, 2}},
+    {"VWMD", {1}}, // matrix A is computed from the image, thus not loaded with vector data-types
+    {"VWND", {1, 2, 4}},
+    {"PADA", {0, 1}},
+    {"PADB", {0, 1}},
+  };
+
+  // Describes how to compute the performance metrics
+  settings.metric_amount = 2 * num_patches * args.num_kernels * patch_size * args.batch_count;
+  settings.performance_unit = "GFLOPS";
+
+  return settings;
+}
+
+// Tests for valid arguments
+template <typename T>
+void XconvgemmTestValidArguments(const int, const Arguments<T> &args) {
+  const auto wgd_max = size_t{32};
+  if (!IsMultiple(XconvgemmNumPatches(args), wgd_max)) {
+    throw std::runtime_error("'Xconvgemm' requires the number of output pixels to be a multiple of WGD (max " + ToString(wgd_max) + ")");
+  }
+  if (!IsMultiple(args.num_kernels, wgd_max)) {
+    throw std::runtime_error("'Xconvgemm' requires 'numkernels' to be a multiple of WGD (max " + ToString(wgd_max) + ")");
+  }
+}
+std::vector<Constraint> XconvgemmSetConstraints(const int) {
+  auto constraints = std::vector<Constraint>();
+  auto MultipleOfX = [] (std::vector<size_t> v) { return IsMultiple(v[0], v[1]); };
+  auto MultipleOfXMulY = [] (std::vector<size_t> v) { return IsMultiple(v[0], v[1]*v[2]); };
+  auto MultipleOfXMulYDivZ = [] (std::vector<size_t> v) { return IsMultiple(v[0], (v[1]*v[2])/v[3]); };
+  // Requirement for unrolling the WGD loop
+  constraints.push_back({MultipleOfX, {"WGD", "KWID"}});
+  // Required for integer MWID and NWID
+  constraints.push_back({MultipleOfXMulY, {"WGD", "MDIMCD", "VWMD"}});
+  constraints.push_back({MultipleOfXMulY, {"WGD", "NDIMCD", "VWND"}});
+  // Required for integer MWIAD and NWIBD
+  constraints.push_back({MultipleOfXMulY, {"WGD", "MDIMAD", "VWMD"}});
+  constraints.push_back({MultipleOfXMulY, {"WGD", "NDIMBD", "VWND"}});
+  // WGD has to be a multiple of KDIMAD = ((MDIMCD*NDIMCD)/(MDIMAD)) and KDIMBD = (...)
+  constraints.push_back({MultipleOfXMulYDivZ, {"WGD", "MDIMCD", "NDIMCD", "MDIMAD"}});
+  constraints.push_back({MultipleOfXMulYDivZ, {"WGD", "MDIMCD", "NDIMCD", "NDIMBD"}});
+  return constraints;
+}
+template <typename T>
+LocalMemSizeInfo XconvgemmComputeLocalMemSize(const int) {
+  return {
+      [] (std::vector<size_t> v) -> size_t {
+          return GetBytes(PrecisionValue<T>()) * ((v[0]*(v[0] + v[1]) + v[0]*(v[0] + v[2])));
+      },
+      {"WGD", "PADA", "PADB"}
+  };
+}
+
+// Sets the kernel's arguments
+template <typename T>
+void XconvgemmSetArguments(const int, Kernel &kernel, const Arguments<T> &args, std::vector<Buffer<T>>& buffers) {
+  const auto num_patches = XconvgemmNumPatches(args);
+  const auto output_w = (args.width + 2 * args.pad_w - args.dilation_w * (args.kernel_w - 1) - 1) / args.stride_w + 1;
+  kernel.SetArgument(0, static_cast<int>(num_patches));
+  kernel.SetArgument(1, static_cast<int>(args.num_kernels));
+  kernel.SetArgument(2, static_cast<int>(XconvgemmPatchSize(args)));
+  kernel.SetArgument(3, buffers[3]()); // 3 == B matrix ==> kernels
+  kernel.SetArgument(4, 0); // kernel_offset
+  kernel.SetArgument(5, buffers[4]()); // 4 == C matrix ==> results
+  kernel.SetArgument(6, 0); // result_offset
+  kernel.SetArgument(7, static_cast<int>(num_patches * args.num_kernels)); // result_stride
+  kernel.SetArgument(8, buffers[2]()); // 2 == A matrix ==> images
+  kernel.SetArgument(9, 0); // image_offset
+  kernel.SetArgument(10, static_cast<int>(args.channels * args.height * args.width)); // image_stride
+  kernel.SetArgument(11, static_cast<int>(args.height));
+  kernel.SetArgument(12, static_cast<int>(args.width));
+  kernel.SetArgument(13, static_cast<int>(args.channels));
+  kernel.SetArgument(14, static_cast<int>(args.kernel_h));
+  kernel.SetArgument(15, static_cast<int>(args.kernel_w));
+  kernel.SetArgument(16, static_cast<int>(args.pad_h));
+  kernel.SetArgument(17, static_cast<int>(args.pad_w));
+  kernel.SetArgument(18, static_cast<int>(args.stride_h));
+  kernel.SetArgument(19, static_cast<int>(args.stride_w));
+  kernel.SetArgument(20, static_cast<int>(args.dilation_h));
+  kernel.SetArgument(21, static_cast<int>(args.dilation_w));
+  kernel.SetArgument(22, static_cast<int>(num_patches / output_w)); // output_h
+  kernel.SetArgument(23, static_cast<int>(output_w));
+}
+
+// =================================================================================================
+} // namespace clblast
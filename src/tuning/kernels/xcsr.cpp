@@ -0,0 +1,40 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the sparse matrix-vector multiplication OpenCL kernel.
+//
+// =================================================================================================
+
+#include "tuning/kernels/xcsr.hpp"
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Function to tune a specific variation V (not within the clblast namespace)
+template <int V>
+void StartVariation(int argc, char *argv[]) {
+  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+  switch(clblast::GetPrecision(command_line_args)) {
+    case clblast::Precision::kHalf: clblast::Tuner<half>(argc, argv, V, clblast::XcsrGetTunerDefaults, clblast::XcsrGetTunerSettings<half>, clblast::XcsrTestValidArguments<half>, clblast::XcsrSetConstraints, clblast::XcsrComputeLocalMemSize<half>, clblast::XcsrSetArguments<half>); break;
+    case clblast::Precision::kSingle: clblast::Tuner<float>(argc, argv, V, clblast::XcsrGetTunerDefaults, clblast::XcsrGetTunerSettings<float>, clblast::XcsrTestValidArguments<float>, clblast::XcsrSetConstraints, clblast::XcsrComputeLocalMemSize<float>, clblast::XcsrSetArguments<float>); break;
+    case clblast::Precision::kDouble: clblast::Tuner<double>(argc, argv, V, clblast::XcsrGetTunerDefaults, clblast::XcsrGetTunerSettings<double>, clblast::XcsrTestValidArguments<double>, clblast::XcsrSetConstraints, clblast::XcsrComputeLocalMemSize<double>, clblast::XcsrSetArguments<double>); break;
+    case clblast::Precision::kComplexSingle: clblast::Tuner<float2>(argc, argv, V, clblast::XcsrGetTunerDefaults, clblast::XcsrGetTunerSettings<float2>, clblast::XcsrTestValidArguments<float2>, clblast::XcsrSetConstraints, clblast::XcsrComputeLocalMemSize<float2>, clblast::XcsrSetArguments<float2>); break;
+    case clblast::Precision::kComplexDouble: clblast::Tuner<double2>(argc, argv, V, clblast::XcsrGetTunerDefaults, clblast::XcsrGetTunerSettings<double2>, clblast::XcsrTestValidArguments<double2>, clblast::XcsrSetConstraints, clblast::XcsrComputeLocalMemSize<double2>, clblast::XcsrSetArguments<double2>); break;
+  }
+}
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  StartVariation<1>(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
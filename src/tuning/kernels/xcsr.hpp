@@ -0,0 +1,159 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the sparse matrix-vector multiplication kernel (Xcsrmv),
+// of which the parameters are also used for the sparse-dense matrix multiplication kernel. Until
+// tuned, the routines use the parameters of the 'Xaxpy' kernel. The tuning matrix has 'm' rows
+// and 'n' columns, with a random number of non-zeros per row, 'k' on average.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstring>
+
+#include "utilities/utilities.hpp"
+#include "tuning/tuning.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Generates the row pointers of the sparse tuning matrix, for a reproducible matrix structure
+template <typename T>
+std::vector<int> XcsrRowPointers(const Arguments<T> &args) {
+  std::mt19937 mt(42);
+  std::uniform_int_distribution<size_t> dist(0, 2 * args.k);
+  auto row_ptr = std::vector<int>(args.m + 1, 0);
+  for (auto row = size_t{0}; row < args.m; ++row) {
+    row_ptr[row + 1] = row_ptr[row] + static_cast<int>(dist(mt));
+  }
+  return row_ptr;
+}
+
+// The number of elements of type T needed to store a number of integers in a tuner buffer
+template <typename T>
+size_t XcsrIndexBufferSize(const size_t num_integers) {
+  return CeilDiv(num_integers * sizeof(int), sizeof(T));
+}
+
+// Settings for this kernel (default command-line arguments)
+TunerDefaults XcsrGetTunerDefaults(const int) {
+  auto settings = TunerDefaults();
+  settings.options = {kArgM, kArgN, kArgK, kArgAlpha, kArgBeta};
+  settings.default_m = 64*1024;
+  settings.default_n = 64*1024;
+  settings.default_k = 16;
+  return settings;
+}
+
+// Settings for this kernel (general)
+template <typename T>
+TunerSettings XcsrGetTunerSettings(const int, const Arguments<T> &args) {
+  auto settings = TunerSettings();
+
+  // Identification of the kernel
+  settings.kernel_family = "xcsr";
+  settings.kernel_name = "Xcsrmv";
+  settings.sources =
+#include "../src/kernels/levelx/xcsr.opencl"
+  ;
+
+  // Buffer sizes: the vectors, the values, and the row pointers and column indices stored as
+  // integers in buffers of type T
+  const auto row_ptr = XcsrRowPointers(args);
+  const auto nnz = static_cast<size_t>(row_ptr[args.m]);
+  settings.size_x = args.n;
+  settings.size_y = args.m;
+  settings.size_a = std::max(nnz, size_t{1});
+  settings.size_b = XcsrIndexBufferSize<T>(args.m + 1);
+  settings.size_c = XcsrIndexBufferSize<T>(std::max(nnz, size_t{1}));
+
+  // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5)
+  settings.inputs = {0, 1, 2, 3, 4};
+  settings.outputs = {1};
+
+  // Replaces the random contents of the index buffers by the sparse matrix structure
+  const auto n = args.n;
+  settings.initialize_buffer = [row_ptr, nnz, n](const size_t id, void* data, const size_t) {
+    if (id == 3) {
+      std::memcpy(data, row_ptr.data(), row_ptr.size() * sizeof(int));
+    }
+    else if (id == 4) {
+      std::mt19937 mt(43);
+      std::uniform_int_distribution<int> dist(0, static_cast<int>(n) - 1);
+      auto col_idx = std::vector<int>(nnz);
+      for (auto &index : col_idx) { index = dist(mt); }
+      std::memcpy(data, col_idx.data(), nnz * sizeof(int));
+    }
+  };
+
+  // Sets the base thread configuration
+  settings.global_size = {args.m};
+  settings.global_size_ref = settings.global_size;
+  settings.local_size = {1};
+  settings.local_size_ref = {64};
+
+  // Transforms the thread configuration based on the parameters
+  settings.mul_local = {{"WGS"}};
+  settings.mul_global = {{"VW"}};
+
+  // Sets the tuning parameters and their possible values
+  settings.parameters = {
+    {"WGS", {64, 128, 256, 512}},
+    {"VW", {1, 2, 4, 8, 16, 32}},
+  };
+
+  // Describes how to compute the performance metrics: the values and column indices are streamed
+  // once, as are the row pointers and the vectors
+  settings.metric_amount = nnz * (GetBytes(args.precision) + sizeof(int)) +
+                           (args.m + 1) * sizeof(int) + (args.n + 2 * args.m) * GetBytes(args.precision);
+  settings.performance_unit = "GB/s";
+
+  return settings;
+}
+
+// Tests for valid arguments
+template <typename T>
+void XcsrTestValidArguments(const int, const Arguments<T> &args) {
+  if (!IsMultiple(args.m, 512)) {
+    throw std::runtime_error("'Xcsrmv' requires 'm' to be a multiple of WGS (max 512)");
+  }
+}
+std::vector<Constraint> XcsrSetConstraints(const int) { return {}; }
+template <typename T>
+LocalMemSizeInfo XcsrComputeLocalMemSize(const int) {
+  return {
+      [] (std::vector<size_t> v) -> size_t {
+          return GetBytes(PrecisionValue<T>()) * v[0];
+      },
+      {"WGS"}
+  };
+}
+
+// Sets the kernel's arguments
+template <typename T>
+void XcsrSetArguments(const int, Kernel &kernel, const Arguments<T> &args, std::vector<Buffer<T>>& buffers) {
+  kernel.SetArgument(0, static_cast<int>(args.m));
+  kernel.SetArgument(1, GetRealArg(args.alpha));
+  kernel.SetArgument(2, GetRealArg(args.beta));
+  kernel.SetArgument(3, buffers[3]()); // 3 == B matrix, holds the row pointers
+  kernel.SetArgument(4, buffers[4]()); // 4 == C matrix, holds the column indices
+  kernel.SetArgument(5, buffers[2]()); // 2 == A matrix, holds the non-zero values
+  kernel.SetArgument(6, buffers[0]()); // 0 == X vector
+  kernel.SetArgument(7, 0); // x_offset
+  kernel.SetArgument(8, 1); // x_inc
+  kernel.SetArgument(9, buffers[1]()); // 1 == Y vector
+  kernel.SetArgument(10, 0); // y_offset
+  kernel.SetArgument(11, 1); // y_inc
+}
+
+// =================================================================================================
+} // namespace clblast
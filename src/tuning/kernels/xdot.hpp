@@ -64,6 +64,9 @@ TunerSettings XdotGetTunerSettings(const int V, const Arguments<T> &args) {
   settings.parameters = {
     {"WGS"+std::to_string(V), {32, 64, 128, 256, 512, 1024}},
   };
+  if (V==1) { // not tuned: enables the single-pass kernels of the routines (see 'IsLastWorkGroup')
+    settings.parameters.push_back({"XDOT_SINGLE_PASS", {1}});
+  }
 
   // Describes how to compute the performance metrics
   settings.metric_amount = (V==1) ? (2*args.n + 1) * GetBytes(args.precision) : 1 * GetBytes(args.precision);
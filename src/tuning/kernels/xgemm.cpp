@@ -22,12 +22,21 @@ using double2 = clblast::double2;
 template <int V>
 void StartVariation(int argc, char *argv[]) {
   const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
-  switch(clblast::GetPrecision(command_line_args)) {
+  const auto precision = clblast::GetPrecision(command_line_args);
+  if (V == 21 && precision != clblast::Precision::kHalf && precision != clblast::Precision::kHalfSingle) {
+    return; // the tensor-core kernel is only available in half-precision
+  }
+  switch(precision) {
     case clblast::Precision::kHalf: clblast::Tuner<half>(argc, argv, V, clblast::XgemmGetTunerDefaults, clblast::XgemmGetTunerSettings<half>, clblast::XgemmTestValidArguments<half>, clblast::XgemmSetConstraints, clblast::XgemmComputeLocalMemSize<half>, clblast::XgemmSetArguments<half>); break;
+    case clblast::Precision::kHalfSingle: clblast::Tuner<half>(argc, argv, V, clblast::XgemmGetTunerDefaults, clblast::XgemmGetTunerSettings<half>, clblast::XgemmTestValidArguments<half>, clblast::XgemmSetConstraints, clblast::XgemmComputeLocalMemSize<half>, clblast::XgemmSetArguments<half>); break;
     case clblast::Precision::kSingle: clblast::Tuner<float>(argc, argv, V, clblast::XgemmGetTunerDefaults, clblast::XgemmGetTunerSettings<float>, clblast::XgemmTestValidArguments<float>, clblast::XgemmSetConstraints, clblast::XgemmComputeLocalMemSize<float>, clblast::XgemmSetArguments<float>); break;
     case clblast::Precision::kDouble: clblast::Tuner<double>(argc, argv, V, clblast::XgemmGetTunerDefaults, clblast::XgemmGetTunerSettings<double>, clblast::XgemmTestValidArguments<double>, clblast::XgemmSetConstraints, clblast::XgemmComputeLocalMemSize<double>, clblast::XgemmSetArguments<double>); break;
     case clblast::Precision::kComplexSingle: clblast::Tuner<float2>(argc, argv, V, clblast::XgemmGetTunerDefaults, clblast::XgemmGetTunerSettings<float2>, clblast::XgemmTestValidArguments<float2>, clblast::XgemmSetConstraints, clblast::XgemmComputeLocalMemSize<float2>, clblast::XgemmSetArguments<float2>); break;
     case clblast::Precision::kComplexDouble: clblast::Tuner<double2>(argc, argv, V, clblast::XgemmGetTunerDefaults, clblast::XgemmGetTunerSettings<double2>, clblast::XgemmTestValidArguments<double2>, clblast::XgemmSetConstraints, clblast::XgemmComputeLocalMemSize<double2>, clblast::XgemmSetArguments<double2>); break;
+    case clblast::Precision::kBFloat16: clblast::Tuner<clblast::bfloat16>(argc, argv, V, clblast::XgemmGetTunerDefaults, clblast::XgemmGetTunerSettings<clblast::bfloat16>, clblast::XgemmTestValidArguments<clblast::bfloat16>, clblast::XgemmSetConstraints, clblast::XgemmComputeLocalMemSize<clblast::bfloat16>, clblast::XgemmSetArguments<clblast::bfloat16>); break;
+    case clblast::Precision::kInt8:
+      if (V == 1) { clblast::Tuner<clblast::int8>(argc, argv, V, clblast::XgemmGetTunerDefaults, clblast::XgemmInt8GetTunerSettings, clblast::XgemmTestValidArguments<clblast::int8>, clblast::XgemmInt8SetConstraints, clblast::XgemmComputeLocalMemSize<clblast::int8>, clblast::XgemmInt8SetArguments); }
+      break;
   }
 }
 
@@ -37,6 +46,9 @@ int main(int argc, char *argv[]) {
   StartVariation<2>(argc, argv);
   StartVariation<11>(argc, argv);
   StartVariation<12>(argc, argv);
+  #ifdef CUDA_API
+    StartVariation<21>(argc, argv);
+  #endif
   return 0;
 }
 
@@ -12,6 +12,7 @@
 // - V==2: Kernel 0: This tests a much larger set of parameters by randomly sampling a subset.
 // - V==11: Kernel 1: This tests some limited set of tuning parameters exhaustively.
 // - V==12: Kernel 1: This tests a much larger set of parameters by randomly sampling a subset.
+// - V==21: Kernel 2: This tests the tensor-core kernel exhaustively (CUDA, half-precision only).
 //
 // =================================================================================================
 
@@ -29,11 +30,12 @@ TunerDefaults XgemmGetTunerDefaults(const int V) {
   auto settings = TunerDefaults();
   settings.options = {kArgM, kArgN, kArgK, kArgAlpha, kArgBeta, kArgFraction,
                       kArgHeuristicSelection, kArgPsoSwarmSize,
-                      kArgPsoInfGlobal, kArgPsoInfLocal, kArgPsoInfRandom};
+                      kArgPsoInfGlobal, kArgPsoInfLocal, kArgPsoInfRandom,
+                      kArgAnnMaxTemp};
   settings.default_m = 1024;
   settings.default_n = 1024;
   settings.default_k = 1024;
-  settings.default_fraction = (V == 1 || V == 11) ? 1.0 : (V == 2) ? 512.0 : 128.0; // test all or sample randomly
+  settings.default_fraction = (V == 1 || V == 11 || V == 21) ? 1.0 : (V == 2) ? 512.0 : 128.0; // test all or sample randomly
   settings.default_num_runs = 2;
   return settings;
 }
@@ -46,11 +48,14 @@ TunerSettings XgemmGetTunerSettings(const int V, const Arguments<T> &args) {
   // Identification of the kernel
   settings.kernel_family = "xgemm_" + ToString(V);
   settings.kernel_name = "Xgemm";
-  settings.sources = (V == 11 || V == 12) ? "#define GEMMK 1" : "#define GEMMK 0";
+  settings.sources = (V == 11 || V == 12) ? "#define GEMMK 1" :
+                     (V == 21) ? "#define GEMMK 2" : "#define GEMMK 0";
   settings.sources +=
+#include "../src/kernels/level3/xgemm_epilogue.opencl"
 #include "../src/kernels/level3/xgemm_part1.opencl"
 #include "../src/kernels/level3/xgemm_part2.opencl"
 #include "../src/kernels/level3/xgemm_part3.opencl"
+#include "../src/kernels/level3/xgemm_tensor.opencl"
 #include "../src/kernels/level3/xgemm_part4.opencl"
   ;
 
@@ -92,7 +97,9 @@ TunerSettings XgemmGetTunerSettings(const int V, const Arguments<T> &args) {
       {"STRN", {0}},
       {"SA", {0, 1}},
       {"SB", {0, 1}},
-      {"KREG", {1}}
+      {"KREG", {1}},
+      {"DBUF", {0, 1}},
+      {"SWZ", {0, 8}}
     };
   }
   else if (V == 2) { // Kernel 0: a lot more tuning parameters - has to be sampled randomly, too much to test all
@@ -112,7 +119,9 @@ TunerSettings XgemmGetTunerSettings(const int V, const Arguments<T> &args) {
       {"STRN", {0, 1}},
       {"SA", {0, 1}},
       {"SB", {0, 1}},
-      {"KREG", {1}}
+      {"KREG", {1}},
+      {"DBUF", {0, 1}},
+      {"SWZ", {0, 2, 4, 8, 16}}
     };
   }
   else if (V == 11) { // Kernel 1: limited subset of tuning parameters - but explorable exhaustively
@@ -132,7 +141,9 @@ TunerSettings XgemmGetTunerSettings(const int V, const Arguments<T> &args) {
       {"STRN", {0}},
       {"SA", {0}},
       {"SB", {0}},
-      {"KREG", {1, 2, 4}}
+      {"KREG", {1, 2, 4}},
+      {"DBUF", {0}},
+      {"SWZ", {0, 8}}
     };
   }
   else if (V == 12) { // Kernel 1: a lot more tuning parameters - has to be sampled randomly, too much to test all
@@ -152,7 +163,31 @@ TunerSettings XgemmGetTunerSettings(const int V, const Arguments<T> &args) {
       {"STRN", {0}},
       {"SA", {0}},
       {"SB", {0}},
-      {"KREG", {1, 2, 4, 8, 16}}
+      {"KREG", {1, 2, 4, 8, 16}},
+      {"DBUF", {0}},
+      {"SWZ", {0, 2, 4, 8, 16}}
+    };
+  }
+  else if (V == 21) { // Kernel 2: tensor cores, with 16x16x16 fragments and local memory by design
+    settings.parameters = {
+      {"GEMMK", {2}},
+      {"MWG", {32, 64, 128}},
+      {"NWG", {32, 64, 128}},
+      {"KWG", {16, 32}},
+      {"MDIMC", {8, 16, 32}},
+      {"NDIMC", {8, 16, 32}},
+      {"MDIMA", {8, 16, 32}},
+      {"NDIMB", {8, 16, 32}},
+      {"KWI", {2}},
+      {"VWM", {1, 2}},
+      {"VWN", {1, 2}},
+      {"STRM", {0}},
+      {"STRN", {0}},
+      {"SA", {0}},
+      {"SB", {0}},
+      {"KREG", {1}},
+      {"DBUF", {0}},
+      {"SWZ", {0, 8}}
     };
   }
 
@@ -181,6 +216,8 @@ std::vector<Constraint> XgemmSetConstraints(const int V) {
   auto MultipleOfX = [] (std::vector<size_t> v) { return IsMultiple(v[0], v[1]); };
   auto MultipleOfXMulY = [] (std::vector<size_t> v) { return IsMultiple(v[0], v[1]*v[2]); };
   auto MultipleOfXMulYDivZ = [] (std::vector<size_t> v) { return IsMultiple(v[0], (v[1]*v[2])/v[3]); };
+  auto FragmentsPerWarp = [] (std::vector<size_t> v) { return IsMultiple(v[0]*v[1], v[2]*v[3]*8); };
+  auto LocalForDoubleBuffering = [] (std::vector<size_t> v) { return v[0] == 0 || v[1] == 1 || v[2] == 1; };
 
   // Requirement for unrolling the KWG loop
   constraints.push_back({MultipleOfX, {"KWG", "KWI"}});
@@ -193,19 +230,30 @@ std::vector<Constraint> XgemmSetConstraints(const int V) {
   constraints.push_back({MultipleOfXMulY, {"MWG", "MDIMA", "VWM"}});
   constraints.push_back({MultipleOfXMulY, {"NWG", "NDIMB", "VWN"}});
 
-  if (V == 1 || V == 2) {
+  if (V == 1 || V == 2 || V == 21) {
     // KWG has to be a multiple of KDIMA = ((MDIMC*NDIMC)/(MDIMA)) and KDIMB = (...)
     constraints.push_back({MultipleOfXMulYDivZ, {"KWG", "MDIMC", "NDIMC", "MDIMA"}});
     constraints.push_back({MultipleOfXMulYDivZ, {"KWG", "MDIMC", "NDIMC", "NDIMB"}});
   }
 
+  if (V == 1 || V == 2) {
+    // Double buffering only applies to the tiles in local memory
+    constraints.push_back({LocalForDoubleBuffering, {"DBUF", "SA", "SB"}});
+  }
+
   if (V == 11 || V == 12) {
     // KREG has to be a multiple of VWN
     constraints.push_back({MultipleOfX, {"KREG", "VWN"}});
   }
 
-  // Extra constraints for kernel 1 to limit the set of options significantly
-  if (V == 11 || V == 12) {
+  // The 16x16 fragments of C have to be divided evenly over the warps of 32 threads. Note that the
+  // tensor-core kernel falls back to kernel 0 on other devices, hence the constraints above.
+  if (V == 21) {
+    constraints.push_back({FragmentsPerWarp, {"MWG", "NWG", "MDIMC", "NDIMC"}});
+  }
+
+  // Extra constraints for kernels 1 and 2 to limit the set of options significantly
+  if (V == 11 || V == 12 || V == 21) {
     constraints.push_back({IsEqual, {"MDIMC", "MDIMA"}});
     constraints.push_back({IsEqual, {"NDIMC", "NDIMB"}});
   }
@@ -224,12 +272,20 @@ std::vector<Constraint> XgemmSetConstraints(const int V) {
   return constraints;
 }
 template <typename T>
-LocalMemSizeInfo XgemmComputeLocalMemSize(const int) {
+LocalMemSizeInfo XgemmComputeLocalMemSize(const int V) {
+  if (V == 21) { // the tiles of A and B plus a single-precision 16x16 fragment of C per warp
+    return {
+        [] (std::vector<size_t> v) -> size_t {
+            return GetBytes(PrecisionValue<T>()) * (v[0]*v[1] + v[0]*v[2]) + 32 * v[3]*v[4];
+        },
+        {"KWG", "MWG", "NWG", "MDIMC", "NDIMC"}
+    };
+  }
   return {
       [] (std::vector<size_t> v) -> size_t {
-          return GetBytes(PrecisionValue<T>()) * ((v[0]*v[1]*v[2]) + (v[3]*v[4]*v[5]));
+          return GetBytes(PrecisionValue<T>()) * ((v[0]*v[1]*v[2]) + (v[3]*v[4]*v[5])) * (1 + v[6]);
       },
-      {"SA", "KWG", "MWG", "SB", "KWG", "NWG"}
+      {"SA", "KWG", "MWG", "SB", "KWG", "NWG", "DBUF"}
   };
 }
 
@@ -248,5 +304,101 @@ void XgemmSetArguments(const int, Kernel &kernel, const Arguments<T> &args, std:
   kernel.SetArgument(9, 0);
 }
 
+// =================================================================================================
+
+// Settings for the integer GEMM kernel (8-bit inputs, 32-bit results). This shares the database
+// entries with the other precisions of the 'Xgemm' kernel: only the tile sizes MWG, NWG and KWG
+// and the thread-block sizes MDIMC and NDIMC are used, the other parameters are fixed.
+TunerSettings XgemmInt8GetTunerSettings(const int V, const Arguments<int8> &args) {
+  auto settings = TunerSettings();
+
+  // Identification of the kernel
+  settings.kernel_family = "xgemm_" + ToString(V);
+  settings.kernel_name = "XgemmInt8";
+  settings.sources =
+#include "../src/kernels/level3/xgemm_int8.opencl"
+  ;
+
+  // Buffer sizes: C holds 32-bit integers, so four times as many bytes
+  settings.size_a = args.m * args.k;
+  settings.size_b = args.n * args.k;
+  settings.size_c = 4 * args.m * args.n;
+
+  // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5)
+  settings.inputs = {2, 3, 4};
+  settings.outputs = {4};
+
+  // Sets the base thread configuration
+  settings.global_size = {args.m, args.n};
+  settings.global_size_ref = settings.global_size;
+  settings.local_size = {1, 1};
+  settings.local_size_ref = {8, 8};
+
+  // Transforms the thread configuration based on the parameters
+  settings.mul_local = {{"MDIMC", "NDIMC"}};
+  settings.mul_global = {{"MDIMC", "NDIMC"}};
+  settings.div_global = {{"MWG", "NWG"}};
+
+  // Sets the tuning parameters and their possible values
+  settings.parameters = {
+    {"GEMMK", {0}},
+    {"MWG", {16, 32, 64, 128}},
+    {"NWG", {16, 32, 64, 128}},
+    {"KWG", {16, 32, 64}},
+    {"MDIMC", {8, 16, 32}},
+    {"NDIMC", {8, 16, 32}},
+    {"MDIMA", {8}},
+    {"NDIMB", {8}},
+    {"KWI", {1}},
+    {"VWM", {1}},
+    {"VWN", {1}},
+    {"STRM", {0}},
+    {"STRN", {0}},
+    {"SA", {1}},
+    {"SB", {1}},
+    {"KREG", {1}},
+    {"DBUF", {0}},
+    {"SWZ", {0}}
+  };
+
+  // Describes how to compute the performance metrics
+  settings.metric_amount = 2 * args.m * args.n * args.k;
+  settings.performance_unit = "GOPS";
+
+  return settings;
+}
+
+// Constraints of the integer GEMM kernel: it has no requirements on the matrix sizes
+std::vector<Constraint> XgemmInt8SetConstraints(const int) {
+  auto constraints = std::vector<Constraint>();
+  auto MultipleOfX = [] (std::vector<size_t> v) { return IsMultiple(v[0], v[1]); };
+
+  // Required for integer MWI and NWI
+  constraints.push_back({MultipleOfX, {"MWG", "MDIMC"}});
+  constraints.push_back({MultipleOfX, {"NWG", "NDIMC"}});
+  return constraints;
+}
+
+// Sets the arguments of the integer GEMM kernel for a non-transposed column-major problem
+void XgemmInt8SetArguments(const int, Kernel &kernel, const Arguments<int8> &args,
+                           std::vector<Buffer<int8>>& buffers) {
+  kernel.SetArgument(0, static_cast<int>(args.m));
+  kernel.SetArgument(1, static_cast<int>(args.n));
+  kernel.SetArgument(2, static_cast<int>(args.k));
+  kernel.SetArgument(3, buffers[2]()); // 2 == A matrix
+  kernel.SetArgument(4, 0);
+  kernel.SetArgument(5, static_cast<int>(args.m));
+  kernel.SetArgument(6, 0);
+  kernel.SetArgument(7, buffers[3]()); // 3 == B matrix
+  kernel.SetArgument(8, 0);
+  kernel.SetArgument(9, static_cast<int>(args.k));
+  kernel.SetArgument(10, 0);
+  kernel.SetArgument(11, buffers[4]()); // 4 == C matrix
+  kernel.SetArgument(12, 0);
+  kernel.SetArgument(13, static_cast<int>(args.m));
+  kernel.SetArgument(14, GetRealArg(args.alpha));
+  kernel.SetArgument(15, GetRealArg(args.beta));
+}
+
 // =================================================================================================
 } // namespace clblast
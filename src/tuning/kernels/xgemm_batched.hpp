@@ -0,0 +1,92 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the batched xgemm OpenCL kernels. The results are stored
+// as the 'XgemmBatched' kernel, used by the batched and strided-batched GEMM routines instead of
+// the regular 'Xgemm' parameters. The variations and the tuning parameters are the same as for the
+// regular kernel (see 'xgemm.hpp'), but the strided-batched kernel is run for 'batch_num' batches
+// of small matrices, for which different parameters can be optimal.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+#include "tuning/tuning.hpp"
+#include "tuning/kernels/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings for this kernel (default command-line arguments)
+TunerDefaults XgemmBatchedGetTunerDefaults(const int V) {
+  auto settings = XgemmGetTunerDefaults(V);
+  settings.options.push_back(kArgBatchCount);
+  settings.default_m = 128;
+  settings.default_n = 128;
+  settings.default_k = 128;
+  settings.default_batch_count = 64;
+  return settings;
+}
+
+// Settings for this kernel (general)
+template <typename T>
+TunerSettings XgemmBatchedGetTunerSettings(const int V, const Arguments<T> &args) {
+  auto settings = XgemmGetTunerSettings<T>(V, args);
+
+  // Identification of the kernel
+  settings.kernel_family = "xgemm_batched_" + ToString(V);
+  settings.kernel_name = "XgemmStridedBatched";
+  settings.sources = (V == 11 || V == 12) ? "#define GEMMK 1\n" : "#define GEMMK 0\n";
+  settings.sources += "#define ROUTINE_GEMMSTRIDEDBATCHED\n";
+  settings.sources +=
+#include "../src/kernels/level3/xgemm_epilogue.opencl"
+#include "../src/kernels/level3/xgemm_part1.opencl"
+#include "../src/kernels/level3/xgemm_part2.opencl"
+#include "../src/kernels/level3/xgemm_part3.opencl"
+#include "../src/kernels/level3/xgemm_tensor.opencl"
+#include "../src/kernels/level3/xgemm_part4.opencl"
+#include "../src/kernels/level3/xgemm_batched.opencl"
+  ;
+
+  // Buffer sizes: the batches are stored consecutively
+  settings.size_a = args.m * args.k * args.batch_count;
+  settings.size_b = args.n * args.k * args.batch_count;
+  settings.size_c = args.m * args.n * args.batch_count;
+
+  // Sets the base thread configuration, the third dimension iterates over the batches
+  settings.global_size = {args.m, args.n, args.batch_count};
+  settings.global_size_ref = settings.global_size;
+  settings.local_size = {1, 1, 1};
+  settings.local_size_ref = {8, 8, 1};
+
+  // Describes how to compute the performance metrics
+  settings.metric_amount = 2 * args.m * args.n * args.k * args.batch_count;
+  return settings;
+}
+
+// Sets the kernel's arguments
+template <typename T>
+void XgemmBatchedSetArguments(const int, Kernel &kernel, const Arguments<T> &args, std::vector<Buffer<T>>& buffers) {
+  kernel.SetArgument(0, static_cast<int>(args.m));
+  kernel.SetArgument(1, static_cast<int>(args.n));
+  kernel.SetArgument(2, static_cast<int>(args.k));
+  kernel.SetArgument(3, GetRealArg(args.alpha));
+  kernel.SetArgument(4, GetRealArg(args.beta));
+  kernel.SetArgument(5, buffers[2]()); // 2 == A matrix
+  kernel.SetArgument(6, static_cast<int>(args.m * args.k)); // the distance between batches
+  kernel.SetArgument(7, buffers[3]()); // 3 == B matrix
+  kernel.SetArgument(8, static_cast<int>(args.k * args.n));
+  kernel.SetArgument(9, buffers[4]()); // 4 == C matrix
+  kernel.SetArgument(10, static_cast<int>(args.m * args.n));
+}
+
+// =================================================================================================
+} // namespace clblast
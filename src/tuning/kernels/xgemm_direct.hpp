@@ -27,7 +27,8 @@ TunerDefaults XgemmDirectGetTunerDefaults(const int V) {
   auto settings = TunerDefaults();
   settings.options = {kArgM, kArgN, kArgK, kArgAlpha, kArgBeta, kArgFraction,
                       kArgHeuristicSelection, kArgPsoSwarmSize,
-                      kArgPsoInfGlobal, kArgPsoInfLocal, kArgPsoInfRandom};
+                      kArgPsoInfGlobal, kArgPsoInfLocal, kArgPsoInfRandom,
+                      kArgAnnMaxTemp};
   settings.default_m = 256;
   settings.default_n = 256;
   settings.default_k = 256;
@@ -45,6 +46,7 @@ TunerSettings XgemmDirectGetTunerSettings(const int V, const Arguments<T> &args)
   settings.kernel_family = (V==1) ? "xgemm_direct_1" : "xgemm_direct_2";
   settings.kernel_name = "XgemmDirectTN";
   settings.sources =
+#include "../src/kernels/level3/xgemm_epilogue.opencl"
 #include "../src/kernels/level3/xgemm_direct_part1.opencl"
 #include "../src/kernels/level3/xgemm_direct_part2.opencl"
 #include "../src/kernels/level3/xgemm_direct_part3.opencl"
@@ -83,6 +85,7 @@ TunerSettings XgemmDirectGetTunerSettings(const int V, const Arguments<T> &args)
       {"VWND", {1, 2, 4, 8}},
       {"PADA", {1}},
       {"PADB", {1}},
+      {"SWZD", {0, 8}},
     };
   }
   else { // a lot more tuning parameters - has to be sampled randomly, too much to test all
@@ -97,6 +100,7 @@ TunerSettings XgemmDirectGetTunerSettings(const int V, const Arguments<T> &args)
       {"VWND", {1, 2, 4, 8}},
       {"PADA", {0, 1}},
       {"PADB", {0, 1}},
+      {"SWZD", {0, 2, 4, 8, 16}},
     };
   }
 
@@ -0,0 +1,98 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the batched direct xgemm kernels. The results are stored
+// as the 'XgemmDirectBatched' kernel, used by the batched and strided-batched GEMM routines instead
+// of the regular 'XgemmDirect' parameters. The variations and the tuning parameters are the same as
+// for the regular kernel (see 'xgemm_direct.hpp'), but the strided-batched kernel is run for
+// 'batch_num' batches of small matrices, for which different parameters can be optimal.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+#include "tuning/tuning.hpp"
+#include "tuning/kernels/xgemm_direct.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings for this kernel (default command-line arguments)
+TunerDefaults XgemmDirectBatchedGetTunerDefaults(const int V) {
+  auto settings = XgemmDirectGetTunerDefaults(V);
+  settings.options.push_back(kArgBatchCount);
+  settings.default_m = 32;
+  settings.default_n = 32;
+  settings.default_k = 32;
+  settings.default_batch_count = 1024;
+  return settings;
+}
+
+// Settings for this kernel (general)
+template <typename T>
+TunerSettings XgemmDirectBatchedGetTunerSettings(const int V, const Arguments<T> &args) {
+  auto settings = XgemmDirectGetTunerSettings<T>(V, args);
+
+  // Identification of the kernel
+  settings.kernel_family = (V==1) ? "xgemm_direct_batched_1" : "xgemm_direct_batched_2";
+  settings.kernel_name = "XgemmDirectStridedBatchedTN";
+  settings.sources = "#define ROUTINE_GEMMSTRIDEDBATCHED\n";
+  settings.sources +=
+#include "../src/kernels/level3/xgemm_epilogue.opencl"
+#include "../src/kernels/level3/xgemm_direct_part1.opencl"
+#include "../src/kernels/level3/xgemm_direct_part2.opencl"
+#include "../src/kernels/level3/xgemm_direct_part3.opencl"
+#include "../src/kernels/level3/xgemm_direct_batched.opencl"
+  ;
+
+  // Buffer sizes: the batches are stored consecutively
+  settings.size_a = args.m * args.k * args.batch_count;
+  settings.size_b = args.n * args.k * args.batch_count;
+  settings.size_c = args.m * args.n * args.batch_count;
+
+  // Sets the base thread configuration, the third dimension iterates over the batches
+  settings.global_size = {args.m, args.n, args.batch_count};
+  settings.global_size_ref = settings.global_size;
+  settings.local_size = {1, 1, 1};
+  settings.local_size_ref = {8, 8, 1};
+
+  // Describes how to compute the performance metrics
+  settings.metric_amount = 2 * args.m * args.n * args.k * args.batch_count;
+  return settings;
+}
+
+// Sets the kernel's arguments
+template <typename T>
+void XgemmDirectBatchedSetArguments(const int, Kernel &kernel, const Arguments<T> &args, std::vector<Buffer<T>>& buffers) {
+  kernel.SetArgument(0, static_cast<int>(args.m));
+  kernel.SetArgument(1, static_cast<int>(args.n));
+  kernel.SetArgument(2, static_cast<int>(args.k));
+  kernel.SetArgument(3, GetRealArg(args.alpha));
+  kernel.SetArgument(4, GetRealArg(args.beta));
+  kernel.SetArgument(5, buffers[2]()); // 2 == A matrix
+  kernel.SetArgument(6, 0); // a_offset
+  kernel.SetArgument(7, static_cast<int>(args.k)); // a_ld
+  kernel.SetArgument(8, static_cast<int>(args.m * args.k)); // a_stride
+  kernel.SetArgument(9, buffers[3]()); // 3 == B matrix
+  kernel.SetArgument(10, 0); // b_offset
+  kernel.SetArgument(11, static_cast<int>(args.n)); // b_ld
+  kernel.SetArgument(12, static_cast<int>(args.n * args.k)); // b_stride
+  kernel.SetArgument(13, buffers[4]()); // 4 == C matrix
+  kernel.SetArgument(14, 0); // c_offset
+  kernel.SetArgument(15, static_cast<int>(args.n)); // c_ld
+  kernel.SetArgument(16, static_cast<int>(args.m * args.n)); // c_stride
+  kernel.SetArgument(17, 1); // c_do_transpose
+  kernel.SetArgument(18, 0); // a_conjugate
+  kernel.SetArgument(19, 0); // b_conjugate
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,126 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the skinny xgemm kernel, used for GEMM with a small 'n' (or
+// 'm'). Until tuned, the routine uses the parameters of the 'Xgemv' kernel.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+#include "tuning/tuning.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings for this kernel (default command-line arguments)
+TunerDefaults XgemmSkinnyGetTunerDefaults(const int) {
+  auto settings = TunerDefaults();
+  settings.options = {kArgM, kArgN, kArgK, kArgAlpha, kArgBeta};
+  settings.default_m = 4096;
+  settings.default_n = 8;
+  settings.default_k = 1024;
+  settings.default_num_runs = 4;
+  return settings;
+}
+
+// Settings for this kernel (general)
+template <typename T>
+TunerSettings XgemmSkinnyGetTunerSettings(const int, const Arguments<T> &args) {
+  auto settings = TunerSettings();
+
+  // Identification of the kernel
+  settings.kernel_family = "xgemm_skinny";
+  settings.kernel_name = "XgemmSkinny";
+  settings.sources =
+#include "../src/kernels/level3/xgemm_skinny.opencl"
+  ;
+
+  // Buffer sizes
+  settings.size_a = args.m * args.k;
+  settings.size_b = args.k * args.n;
+  settings.size_c = args.m * args.n;
+
+  // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5)
+  settings.inputs = {2, 3, 4};
+  settings.outputs = {4};
+
+  // Sets the base thread configuration
+  settings.global_size = {args.m};
+  settings.global_size_ref = settings.global_size;
+  settings.local_size = {1};
+  settings.local_size_ref = {64};
+
+  // Transforms the thread configuration based on the parameters
+  settings.mul_local = {{"WGS1"}};
+  settings.div_global = {{"WPT1"}};
+
+  // Sets the tuning parameters and their possible values
+  settings.parameters = {
+    {"WGS1", {32, 64, 128, 256}},
+    {"WPT1", {1, 2, 4, 8}},
+  };
+
+  // Describes how to compute the performance metrics: the kernel is bound by the streaming of A
+  settings.metric_amount = (args.m*args.k + args.k*args.n + 2*args.m*args.n) *
+                           GetBytes(args.precision);
+  settings.performance_unit = "GB/s";
+
+  return settings;
+}
+
+// Tests for valid arguments
+template <typename T>
+void XgemmSkinnyTestValidArguments(const int, const Arguments<T> &args) {
+  if (args.n > 16) {
+    throw std::runtime_error("'XgemmSkinny' requires 'n' to be at most SKINNY_N (16)");
+  }
+  if (!IsMultiple(args.m, 256 * 8)) {
+    throw std::runtime_error("'XgemmSkinny' requires 'm' to be a multiple of WGS1*WPT1 (max 2048)");
+  }
+}
+std::vector<Constraint> XgemmSkinnySetConstraints(const int) { return {}; }
+template <typename T>
+LocalMemSizeInfo XgemmSkinnyComputeLocalMemSize(const int) {
+  return {
+      [] (std::vector<size_t>) -> size_t {
+          return GetBytes(PrecisionValue<T>()) * 32 * 16; // SKINNY_KWG * SKINNY_N
+      },
+      {}
+  };
+}
+
+// Sets the kernel's arguments
+template <typename T>
+void XgemmSkinnySetArguments(const int, Kernel &kernel, const Arguments<T> &args, std::vector<Buffer<T>>& buffers) {
+  kernel.SetArgument(0, static_cast<int>(args.m));
+  kernel.SetArgument(1, static_cast<int>(args.n));
+  kernel.SetArgument(2, static_cast<int>(args.k));
+  kernel.SetArgument(3, GetRealArg(args.alpha));
+  kernel.SetArgument(4, GetRealArg(args.beta));
+  kernel.SetArgument(5, buffers[2]()); // 2 == A matrix
+  kernel.SetArgument(6, 0); // a_offset
+  kernel.SetArgument(7, static_cast<int>(args.m)); // a_ld
+  kernel.SetArgument(8, buffers[3]()); // 3 == B matrix
+  kernel.SetArgument(9, 0); // b_offset
+  kernel.SetArgument(10, static_cast<int>(args.k)); // b_ld
+  kernel.SetArgument(11, buffers[4]()); // 4 == C matrix
+  kernel.SetArgument(12, 0); // c_offset
+  kernel.SetArgument(13, static_cast<int>(args.m)); // c_ld
+  kernel.SetArgument(14, 0); // a_transpose
+  kernel.SetArgument(15, 1); // b_transpose
+  kernel.SetArgument(16, 0); // c_transpose
+  kernel.SetArgument(17, 0); // a_conjugate
+  kernel.SetArgument(18, 0); // b_conjugate
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -11,6 +11,7 @@
 // 1: The full version of the kernel
 // 2: The fast version for non-transposed matrices
 // 3: The fast version for transposed matrices
+// With a batch count larger than one, the strided-batched versions of these kernels are tuned.
 //
 // =================================================================================================
 
@@ -26,7 +27,7 @@ namespace clblast {
 // Settings for this kernel (default command-line arguments)
 TunerDefaults XgemvGetTunerDefaults(const int) {
   auto settings = TunerDefaults();
-  settings.options = {kArgM, kArgN, kArgAlpha, kArgBeta};
+  settings.options = {kArgM, kArgN, kArgAlpha, kArgBeta, kArgBatchCount};
   settings.default_m = 2048;
   settings.default_n = 2048;
   settings.default_num_runs = 4;
@@ -41,25 +42,26 @@ TunerSettings XgemvGetTunerSettings(const int V, const Arguments<T> &args) {
   // Identification of the kernel
   settings.kernel_family = (V==1) ? "xgemv" : ((V==2) ? "xgemv_fast" : "xgemv_fast_rot");
   settings.kernel_name = (V==1) ? "Xgemv" : ((V==2) ? "XgemvFast" : "XgemvFastRot");
+  if (args.batch_count > 1) { settings.kernel_name += "StridedBatched"; }
   settings.sources =
 #include "../src/kernels/level2/xgemv.opencl"
 #include "../src/kernels/level2/xgemv_fast.opencl"
   ;
 
   // Buffer sizes
-  settings.size_x = args.n;
-  settings.size_y = args.m;
-  settings.size_a = args.m * args.n;
+  settings.size_x = args.n * args.batch_count;
+  settings.size_y = args.m * args.batch_count;
+  settings.size_a = args.m * args.n * args.batch_count;
 
   // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5)
   settings.inputs = {0, 1, 2};
   settings.outputs = {1};
 
-  // Sets the base thread configuration
-  settings.global_size = {args.m};
+  // Sets the base thread configuration, the second dimension iterates over the batches
+  settings.global_size = {args.m, args.batch_count};
   settings.global_size_ref = settings.global_size;
-  settings.local_size = {1};
-  settings.local_size_ref = {64};
+  settings.local_size = {1, 1};
+  settings.local_size_ref = {64, 1};
 
   // Transforms the thread configuration based on the parameters
   settings.mul_local = {{"WGS"+std::to_string(V)}};
@@ -88,7 +90,8 @@ TunerSettings XgemvGetTunerSettings(const int V, const Arguments<T> &args) {
   }
 
   // Describes how to compute the performance metrics
-  settings.metric_amount = (args.m*args.n + 2*args.m + args.n) * GetBytes(args.precision);
+  settings.metric_amount = (args.m*args.n + 2*args.m + args.n) * args.batch_count *
+                           GetBytes(args.precision);
   settings.performance_unit = "GB/s";
 
   return settings;
@@ -131,6 +134,30 @@ LocalMemSizeInfo XgemvComputeLocalMemSize(const int V) {
 template <typename T>
 void XgemvSetArguments(const int V, Kernel &kernel, const Arguments<T> &args, std::vector<Buffer<T>>& buffers) {
   auto a_rotated = (V==3) ? 1 : 0;
+
+  // The strided-batched kernels, in which the batches are stored consecutively
+  if (args.batch_count > 1) {
+    kernel.SetArgument(0, static_cast<int>(args.m));
+    kernel.SetArgument(1, static_cast<int>(args.n));
+    kernel.SetArgument(2, GetRealArg(args.alpha));
+    kernel.SetArgument(3, GetRealArg(args.beta));
+    kernel.SetArgument(4, a_rotated);
+    kernel.SetArgument(5, buffers[2]()); // 2 == A matrix
+    kernel.SetArgument(6, 0);
+    kernel.SetArgument(7, static_cast<int>(args.m));
+    kernel.SetArgument(8, static_cast<int>(args.m * args.n));
+    kernel.SetArgument(9, buffers[0]()); // 0 == X vector
+    kernel.SetArgument(10, 0);
+    kernel.SetArgument(11, 1);
+    kernel.SetArgument(12, static_cast<int>(args.n));
+    kernel.SetArgument(13, buffers[1]()); // 1 == Y vector
+    kernel.SetArgument(14, 0);
+    kernel.SetArgument(15, 1);
+    kernel.SetArgument(16, static_cast<int>(args.m));
+    kernel.SetArgument(17, 0); // Conjugate transpose
+    return;
+  }
+
   kernel.SetArgument(0, static_cast<int>(args.m));
   kernel.SetArgument(1, static_cast<int>(args.n));
   kernel.SetArgument(2, GetRealArg(args.alpha));
@@ -0,0 +1,40 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the banded matrix-vector multiplication OpenCL kernel.
+//
+// =================================================================================================
+
+#include "tuning/kernels/xgemv_banded.hpp"
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Function to tune a specific variation V (not within the clblast namespace)
+template <int V>
+void StartVariation(int argc, char *argv[]) {
+  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+  switch(clblast::GetPrecision(command_line_args)) {
+    case clblast::Precision::kHalf: clblast::Tuner<half>(argc, argv, V, clblast::XgemvBandedGetTunerDefaults, clblast::XgemvBandedGetTunerSettings<half>, clblast::XgemvBandedTestValidArguments<half>, clblast::XgemvBandedSetConstraints, clblast::XgemvBandedComputeLocalMemSize<half>, clblast::XgemvBandedSetArguments<half>); break;
+    case clblast::Precision::kSingle: clblast::Tuner<float>(argc, argv, V, clblast::XgemvBandedGetTunerDefaults, clblast::XgemvBandedGetTunerSettings<float>, clblast::XgemvBandedTestValidArguments<float>, clblast::XgemvBandedSetConstraints, clblast::XgemvBandedComputeLocalMemSize<float>, clblast::XgemvBandedSetArguments<float>); break;
+    case clblast::Precision::kDouble: clblast::Tuner<double>(argc, argv, V, clblast::XgemvBandedGetTunerDefaults, clblast::XgemvBandedGetTunerSettings<double>, clblast::XgemvBandedTestValidArguments<double>, clblast::XgemvBandedSetConstraints, clblast::XgemvBandedComputeLocalMemSize<double>, clblast::XgemvBandedSetArguments<double>); break;
+    case clblast::Precision::kComplexSingle: clblast::Tuner<float2>(argc, argv, V, clblast::XgemvBandedGetTunerDefaults, clblast::XgemvBandedGetTunerSettings<float2>, clblast::XgemvBandedTestValidArguments<float2>, clblast::XgemvBandedSetConstraints, clblast::XgemvBandedComputeLocalMemSize<float2>, clblast::XgemvBandedSetArguments<float2>); break;
+    case clblast::Precision::kComplexDouble: clblast::Tuner<double2>(argc, argv, V, clblast::XgemvBandedGetTunerDefaults, clblast::XgemvBandedGetTunerSettings<double2>, clblast::XgemvBandedTestValidArguments<double2>, clblast::XgemvBandedSetConstraints, clblast::XgemvBandedComputeLocalMemSize<double2>, clblast::XgemvBandedSetArguments<double2>); break;
+  }
+}
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  StartVariation<1>(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
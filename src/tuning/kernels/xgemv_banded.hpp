@@ -0,0 +1,119 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the banded matrix-vector multiplication kernel, used for
+// GBMV, SBMV, HBMV, and TBMV. The tuning problem is an 'n' by 'n' general banded matrix with 'k'
+// sub- and super-diagonals, stored as (2k+1) rows in the banded format.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+#include "tuning/tuning.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings for this kernel (default command-line arguments)
+TunerDefaults XgemvBandedGetTunerDefaults(const int) {
+  auto settings = TunerDefaults();
+  settings.options = {kArgN, kArgK, kArgAlpha, kArgBeta};
+  settings.default_n = 65536;
+  settings.default_k = 8;
+  settings.default_num_runs = 4;
+  return settings;
+}
+
+// Settings for this kernel (general)
+template <typename T>
+TunerSettings XgemvBandedGetTunerSettings(const int, const Arguments<T> &args) {
+  auto settings = TunerSettings();
+
+  // Identification of the kernel
+  settings.kernel_family = "xgemv_banded";
+  settings.kernel_name = "XgemvBanded";
+  settings.sources =
+"#define ROUTINE_GBMV\n"
+#include "../src/kernels/level2/xgemv.opencl"
+#include "../src/kernels/level2/xgemv_banded.opencl"
+  ;
+
+  // Buffer sizes: the matrix holds the (2k+1) diagonals of the band
+  settings.size_x = args.n;
+  settings.size_y = args.n;
+  settings.size_a = (2 * args.k + 1) * args.n;
+
+  // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5)
+  settings.inputs = {0, 1, 2};
+  settings.outputs = {1};
+
+  // Sets the base thread configuration
+  settings.global_size = {args.n};
+  settings.global_size_ref = settings.global_size;
+  settings.local_size = {1};
+  settings.local_size_ref = {64};
+
+  // Transforms the thread configuration based on the parameters
+  settings.mul_local = {{"WGSB"}};
+  settings.div_global = {{"WPTB"}};
+
+  // Sets the tuning parameters and their possible values
+  settings.parameters = {
+    {"WGSB", {32, 64, 128, 256}},
+    {"WPTB", {1, 2, 4}},
+  };
+
+  // Describes how to compute the performance metrics: only the band of the matrix is read
+  settings.metric_amount = ((2 * args.k + 1) * args.n + 3 * args.n) * GetBytes(args.precision);
+  settings.performance_unit = "GB/s";
+
+  return settings;
+}
+
+// Tests for valid arguments
+template <typename T>
+void XgemvBandedTestValidArguments(const int, const Arguments<T> &args) {
+  if (args.k >= args.n) {
+    throw std::runtime_error("'XgemvBanded' requires 'k' to be smaller than 'n'");
+  }
+}
+std::vector<Constraint> XgemvBandedSetConstraints(const int) { return {}; }
+template <typename T>
+LocalMemSizeInfo XgemvBandedComputeLocalMemSize(const int) {
+  return { [] (std::vector<size_t>) -> size_t { return 0; }, {} };
+}
+
+// Sets the kernel's arguments
+template <typename T>
+void XgemvBandedSetArguments(const int, Kernel &kernel, const Arguments<T> &args,
+                             std::vector<Buffer<T>>& buffers) {
+  kernel.SetArgument(0, static_cast<int>(args.n));
+  kernel.SetArgument(1, static_cast<int>(args.n));
+  kernel.SetArgument(2, GetRealArg(args.alpha));
+  kernel.SetArgument(3, GetRealArg(args.beta));
+  kernel.SetArgument(4, 0); // Not rotated
+  kernel.SetArgument(5, buffers[2]()); // 2 == A matrix
+  kernel.SetArgument(6, 0);
+  kernel.SetArgument(7, static_cast<int>(2 * args.k + 1));
+  kernel.SetArgument(8, buffers[0]()); // 0 == X vector
+  kernel.SetArgument(9, 0);
+  kernel.SetArgument(10, 1);
+  kernel.SetArgument(11, buffers[1]()); // 1 == Y vector
+  kernel.SetArgument(12, 0);
+  kernel.SetArgument(13, 1);
+  kernel.SetArgument(14, 0); // Conjugate transpose
+  kernel.SetArgument(15, 0); // Additional parameter
+  kernel.SetArgument(16, static_cast<int>(args.k)); // Banded 'kl'
+  kernel.SetArgument(17, static_cast<int>(args.k)); // Banded 'ku'
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,36 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the quantised matrix-vector multiplication OpenCL kernel.
+//
+// =================================================================================================
+
+#include "tuning/kernels/xgemv_quantized.hpp"
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+
+// Function to tune a specific variation V (not within the clblast namespace)
+template <int V>
+void StartVariation(int argc, char *argv[]) {
+  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+  switch(clblast::GetPrecision(command_line_args)) {
+    case clblast::Precision::kHalf: clblast::Tuner<half>(argc, argv, V, clblast::XgemvQuantizedGetTunerDefaults, clblast::XgemvQuantizedGetTunerSettings<half>, clblast::XgemvQuantizedTestValidArguments<half>, clblast::XgemvQuantizedSetConstraints, clblast::XgemvQuantizedComputeLocalMemSize<half>, clblast::XgemvQuantizedSetArguments<half>); break;
+    case clblast::Precision::kSingle: clblast::Tuner<float>(argc, argv, V, clblast::XgemvQuantizedGetTunerDefaults, clblast::XgemvQuantizedGetTunerSettings<float>, clblast::XgemvQuantizedTestValidArguments<float>, clblast::XgemvQuantizedSetConstraints, clblast::XgemvQuantizedComputeLocalMemSize<float>, clblast::XgemvQuantizedSetArguments<float>); break;
+    default: printf("* Unsupported precision for the quantised kernels, skipping this tuning run\n");
+  }
+}
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  StartVariation<1>(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,155 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the matrix-vector multiplication kernel with quantised
+// weights (XgemvQuantizedInt4), of which the parameters are also used for the 8-bit weights. The
+// weights are an 'm' by 'k' matrix of random packed words with a scale per group of 32 weights,
+// multiplied with 'n' vectors: the default of 8 represents a small batch of tokens.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cstring>
+
+#include "utilities/utilities.hpp"
+#include "tuning/tuning.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The number of weights per scale and per packed word of the tuning problem
+constexpr auto kQuantizedGroupSize = size_t{32};
+constexpr auto kQuantizedValuesPerWord = size_t{8};
+
+// Settings for this kernel (default command-line arguments)
+TunerDefaults XgemvQuantizedGetTunerDefaults(const int) {
+  auto settings = TunerDefaults();
+  settings.options = {kArgM, kArgN, kArgK, kArgAlpha, kArgBeta};
+  settings.default_m = 4096;
+  settings.default_n = 8;
+  settings.default_k = 4096;
+  return settings;
+}
+
+// Settings for this kernel (general)
+template <typename T>
+TunerSettings XgemvQuantizedGetTunerSettings(const int, const Arguments<T> &args) {
+  auto settings = TunerSettings();
+
+  // Identification of the kernel
+  settings.kernel_family = "xgemv_quantized";
+  settings.kernel_name = "XgemvQuantizedInt4";
+  settings.sources =
+#include "../src/kernels/level2/xgemv_quantized.opencl"
+  ;
+
+  // Buffer sizes: the vectors B and C, the packed weights stored as words in a buffer of type T,
+  // and the scales
+  const auto num_words = args.m * args.k / kQuantizedValuesPerWord;
+  settings.size_x = args.k * args.n;
+  settings.size_y = args.m * args.n;
+  settings.size_a = CeilDiv(num_words * sizeof(unsigned int), sizeof(T));
+  settings.size_b = args.m * (args.k / kQuantizedGroupSize);
+
+  // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5)
+  settings.inputs = {0, 1, 2, 3};
+  settings.outputs = {1};
+
+  // Replaces the random contents of the weights by random packed words
+  settings.initialize_buffer = [num_words](const size_t id, void* data, const size_t) {
+    if (id == 2) {
+      std::mt19937 mt(42);
+      auto words = std::vector<unsigned int>(num_words);
+      for (auto &word : words) { word = static_cast<unsigned int>(mt()); }
+      std::memcpy(data, words.data(), num_words * sizeof(unsigned int));
+    }
+  };
+
+  // Sets the base thread configuration: a thread per row, and the vectors in the second dimension.
+  // The first dimension is multiplied and divided by WGSQ, such that the second can be divided by
+  // QVECTORS. The reference uses the kernel's default QVECTORS of 4.
+  settings.global_size = {args.m, args.n};
+  settings.global_size_ref = {args.m, args.n / 4};
+  settings.local_size = {1, 1};
+  settings.local_size_ref = {64, 1};
+
+  // Transforms the thread configuration based on the parameters
+  settings.mul_local = {{"WGSQ"}};
+  settings.mul_global = {{"WGSQ"}};
+  settings.div_global = {{"WGSQ", "QVECTORS"}};
+
+  // Sets the tuning parameters and their possible values
+  settings.parameters = {
+    {"WGSQ", {32, 64, 128, 256}},
+    {"WPTQ", {1, 2, 4, 8}},
+    {"QVECTORS", {1, 2, 4, 8}},
+  };
+
+  // Describes how to compute the performance metrics: the packed weights and the scales are read
+  // once, as are the vectors of B and C, and C is written
+  settings.metric_amount = num_words * sizeof(unsigned int) +
+                           (settings.size_b + settings.size_x + 2 * settings.size_y) *
+                           GetBytes(args.precision);
+  settings.performance_unit = "GB/s";
+
+  return settings;
+}
+
+// Tests for valid arguments
+template <typename T>
+void XgemvQuantizedTestValidArguments(const int, const Arguments<T> &args) {
+  if (!IsMultiple(args.m, 256)) {
+    throw std::runtime_error("'XgemvQuantized' requires 'm' to be a multiple of WGSQ (max 256)");
+  }
+  if (!IsMultiple(args.n, 8)) {
+    throw std::runtime_error("'XgemvQuantized' requires 'n' to be a multiple of QVECTORS (max 8)");
+  }
+  if (!IsMultiple(args.k, kQuantizedGroupSize)) {
+    throw std::runtime_error("'XgemvQuantized' requires 'k' to be a multiple of the group size (32)");
+  }
+}
+std::vector<Constraint> XgemvQuantizedSetConstraints(const int) { return {}; }
+template <typename T>
+LocalMemSizeInfo XgemvQuantizedComputeLocalMemSize(const int) {
+  return {
+      [] (std::vector<size_t> v) -> size_t {
+          return sizeof(unsigned int) * v[0] * (v[1] + 1) +
+                 GetBytes(PrecisionValue<T>()) * v[2] * v[1] * kQuantizedValuesPerWord;
+      },
+      {"WGSQ", "WPTQ", "QVECTORS"}
+  };
+}
+
+// Sets the kernel's arguments
+template <typename T>
+void XgemvQuantizedSetArguments(const int, Kernel &kernel, const Arguments<T> &args, std::vector<Buffer<T>>& buffers) {
+  kernel.SetArgument(0, static_cast<int>(args.m));
+  kernel.SetArgument(1, static_cast<int>(args.n));
+  kernel.SetArgument(2, static_cast<int>(args.k));
+  kernel.SetArgument(3, static_cast<int>(kQuantizedGroupSize));
+  kernel.SetArgument(4, GetRealArg(args.alpha));
+  kernel.SetArgument(5, GetRealArg(args.beta));
+  kernel.SetArgument(6, buffers[2]()); // 2 == A matrix, holds the packed weights
+  kernel.SetArgument(7, 0); // w_offset
+  kernel.SetArgument(8, buffers[3]()); // 3 == B matrix, holds the scales
+  kernel.SetArgument(9, 0); // s_offset
+  kernel.SetArgument(10, buffers[0]()); // 0 == X vector, holds the 'n' input vectors
+  kernel.SetArgument(11, 0); // b_offset
+  kernel.SetArgument(12, 1); // b_inc
+  kernel.SetArgument(13, static_cast<int>(args.k)); // b_ld
+  kernel.SetArgument(14, buffers[1]()); // 1 == Y vector, holds the 'n' output vectors
+  kernel.SetArgument(15, 0); // c_offset
+  kernel.SetArgument(16, 1); // c_inc
+  kernel.SetArgument(17, static_cast<int>(args.m)); // c_ld
+}
+
+// =================================================================================================
+} // namespace clblast
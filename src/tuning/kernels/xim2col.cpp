@@ -0,0 +1,40 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the im2col OpenCL kernels.
+//
+// =================================================================================================
+
+#include "tuning/kernels/xim2col.hpp"
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Function to tune a specific variation V (not within the clblast namespace)
+template <int V>
+void StartVariation(int argc, char *argv[]) {
+  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+  switch(clblast::GetPrecision(command_line_args)) {
+    case clblast::Precision::kHalf: clblast::Tuner<half>(argc, argv, V, clblast::Xim2colGetTunerDefaults, clblast::Xim2colGetTunerSettings<half>, clblast::Xim2colTestValidArguments<half>, clblast::Xim2colSetConstraints, clblast::Xim2colComputeLocalMemSize<half>, clblast::Xim2colSetArguments<half>); break;
+    case clblast::Precision::kSingle: clblast::Tuner<float>(argc, argv, V, clblast::Xim2colGetTunerDefaults, clblast::Xim2colGetTunerSettings<float>, clblast::Xim2colTestValidArguments<float>, clblast::Xim2colSetConstraints, clblast::Xim2colComputeLocalMemSize<float>, clblast::Xim2colSetArguments<float>); break;
+    case clblast::Precision::kDouble: clblast::Tuner<double>(argc, argv, V, clblast::Xim2colGetTunerDefaults, clblast::Xim2colGetTunerSettings<double>, clblast::Xim2colTestValidArguments<double>, clblast::Xim2colSetConstraints, clblast::Xim2colComputeLocalMemSize<double>, clblast::Xim2colSetArguments<double>); break;
+    case clblast::Precision::kComplexSingle: clblast::Tuner<float2>(argc, argv, V, clblast::Xim2colGetTunerDefaults, clblast::Xim2colGetTunerSettings<float2>, clblast::Xim2colTestValidArguments<float2>, clblast::Xim2colSetConstraints, clblast::Xim2colComputeLocalMemSize<float2>, clblast::Xim2colSetArguments<float2>); break;
+    case clblast::Precision::kComplexDouble: clblast::Tuner<double2>(argc, argv, V, clblast::Xim2colGetTunerDefaults, clblast::Xim2colGetTunerSettings<double2>, clblast::Xim2colTestValidArguments<double2>, clblast::Xim2colSetConstraints, clblast::Xim2colComputeLocalMemSize<double2>, clblast::Xim2colSetArguments<double2>); break;
+  }
+}
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  StartVariation<1>(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,134 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the im2col OpenCL kernel. Until tuned, the routine uses the
+// work-group sizes of the 'Copy' kernel.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+#include "tuning/tuning.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Helpers for the sizes of the output image
+template <typename T>
+size_t Xim2colOutputHeight(const Arguments<T> &args) {
+  const auto size_h = args.height + 2 * args.pad_h;
+  const auto padding_h = args.dilation_h * (args.kernel_h - 1) + 1;
+  return (size_h >= padding_h) ? (size_h - padding_h) / args.stride_h + 1 : 1;
+}
+template <typename T>
+size_t Xim2colOutputWidth(const Arguments<T> &args) {
+  const auto size_w = args.width + 2 * args.pad_w;
+  const auto padding_w = args.dilation_w * (args.kernel_w - 1) + 1;
+  return (size_w >= padding_w) ? (size_w - padding_w) / args.stride_w + 1 : 1;
+}
+
+// Settings for this kernel (default command-line arguments)
+TunerDefaults Xim2colGetTunerDefaults(const int) {
+  auto settings = TunerDefaults();
+  settings.options = {kArgChannels, kArgHeight, kArgWidth, kArgKernelH, kArgKernelW};
+  settings.default_channels = 32;
+  settings.default_height = 130; // such that the output is 128 by 128 for a 3 by 3 kernel
+  settings.default_width = 130;
+  settings.default_kernel_h = 3;
+  settings.default_kernel_w = 3;
+  return settings;
+}
+
+// Settings for this kernel (general)
+template <typename T>
+TunerSettings Xim2colGetTunerSettings(const int, const Arguments<T> &args) {
+  auto settings = TunerSettings();
+
+  // Identification of the kernel
+  settings.kernel_family = "xim2col";
+  settings.kernel_name = "im2col";
+  settings.sources =
+#include "../src/kernels/levelx/im2col.opencl"
+  ;
+
+  // Buffer sizes: the image and the resulting columns
+  const auto output_h = Xim2colOutputHeight(args);
+  const auto output_w = Xim2colOutputWidth(args);
+  const auto col_size = output_h * output_w * args.channels * args.kernel_h * args.kernel_w;
+  settings.size_a = args.channels * args.height * args.width;
+  settings.size_c = col_size;
+
+  // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5)
+  settings.inputs = {2, 4};
+  settings.outputs = {4};
+
+  // Sets the base thread configuration, the second dimension also iterates over the channels
+  settings.global_size = {output_w, output_h * args.channels};
+  settings.global_size_ref = settings.global_size;
+  settings.local_size = {1, 1};
+  settings.local_size_ref = {8, 8};
+
+  // Transforms the thread configuration based on the parameters
+  settings.mul_local = {{"COPY_DIMX", "COPY_DIMY"}};
+
+  // Sets the tuning parameters and their possible values
+  settings.parameters = {
+    {"COPY_DIMX", {4, 8, 16, 32, 64}},
+    {"COPY_DIMY", {1, 2, 4, 8, 16, 32}},
+  };
+
+  // Describes how to compute the performance metrics
+  settings.metric_amount = (settings.size_a + col_size) * GetBytes(args.precision);
+  settings.performance_unit = "GB/s";
+
+  return settings;
+}
+
+// Tests for valid arguments
+template <typename T>
+void Xim2colTestValidArguments(const int, const Arguments<T> &args) {
+  if (!IsMultiple(Xim2colOutputWidth(args), 64) || !IsMultiple(Xim2colOutputHeight(args), 32)) {
+    throw std::runtime_error("'Xim2col' requires the output width and height to be multiples of "
+                             "COPY_DIMX (max 64) and COPY_DIMY (max 32)");
+  }
+}
+std::vector<Constraint> Xim2colSetConstraints(const int) { return {}; }
+template <typename T>
+LocalMemSizeInfo Xim2colComputeLocalMemSize(const int) {
+  return { [] (std::vector<size_t>) -> size_t { return 0; }, {} };
+}
+
+// Sets the kernel's arguments
+template <typename T>
+void Xim2colSetArguments(const int, Kernel &kernel, const Arguments<T> &args, std::vector<Buffer<T>>& buffers) {
+  kernel.SetArgument(0, static_cast<int>(args.height));
+  kernel.SetArgument(1, static_cast<int>(args.width));
+  kernel.SetArgument(2, static_cast<int>(args.channels));
+  kernel.SetArgument(3, static_cast<int>(Xim2colOutputHeight(args)));
+  kernel.SetArgument(4, static_cast<int>(Xim2colOutputWidth(args)));
+  kernel.SetArgument(5, static_cast<int>(args.kernel_h));
+  kernel.SetArgument(6, static_cast<int>(args.kernel_w));
+  kernel.SetArgument(7, static_cast<int>(args.pad_h));
+  kernel.SetArgument(8, static_cast<int>(args.pad_w));
+  kernel.SetArgument(9, static_cast<int>(args.stride_h));
+  kernel.SetArgument(10, static_cast<int>(args.stride_w));
+  kernel.SetArgument(11, static_cast<int>(args.dilation_h));
+  kernel.SetArgument(12, static_cast<int>(args.dilation_w));
+  kernel.SetArgument(13, buffers[2]()); // 2 == A matrix, the image
+  kernel.SetArgument(14, 0);
+  kernel.SetArgument(15, 0);
+  kernel.SetArgument(16, buffers[4]()); // 4 == C matrix, the columns
+  kernel.SetArgument(17, 0);
+  kernel.SetArgument(18, 0);
+}
+
+// =================================================================================================
+} // namespace clblast
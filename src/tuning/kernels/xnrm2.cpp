@@ -0,0 +1,41 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the xnrm2 OpenCL kernels.
+//
+// =================================================================================================
+
+#include "tuning/kernels/xnrm2.hpp"
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Function to tune a specific variation V (not within the clblast namespace)
+template <int V>
+void StartVariation(int argc, char *argv[]) {
+  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+  switch(clblast::GetPrecision(command_line_args)) {
+    case clblast::Precision::kHalf: clblast::Tuner<half>(argc, argv, V, clblast::Xnrm2GetTunerDefaults, clblast::Xnrm2GetTunerSettings<half>, clblast::Xnrm2TestValidArguments<half>, clblast::Xnrm2SetConstraints, clblast::Xnrm2ComputeLocalMemSize<half>, clblast::Xnrm2SetArguments<half>); break;
+    case clblast::Precision::kSingle: clblast::Tuner<float>(argc, argv, V, clblast::Xnrm2GetTunerDefaults, clblast::Xnrm2GetTunerSettings<float>, clblast::Xnrm2TestValidArguments<float>, clblast::Xnrm2SetConstraints, clblast::Xnrm2ComputeLocalMemSize<float>, clblast::Xnrm2SetArguments<float>); break;
+    case clblast::Precision::kDouble: clblast::Tuner<double>(argc, argv, V, clblast::Xnrm2GetTunerDefaults, clblast::Xnrm2GetTunerSettings<double>, clblast::Xnrm2TestValidArguments<double>, clblast::Xnrm2SetConstraints, clblast::Xnrm2ComputeLocalMemSize<double>, clblast::Xnrm2SetArguments<double>); break;
+    case clblast::Precision::kComplexSingle: clblast::Tuner<float2>(argc, argv, V, clblast::Xnrm2GetTunerDefaults, clblast::Xnrm2GetTunerSettings<float2>, clblast::Xnrm2TestValidArguments<float2>, clblast::Xnrm2SetConstraints, clblast::Xnrm2ComputeLocalMemSize<float2>, clblast::Xnrm2SetArguments<float2>); break;
+    case clblast::Precision::kComplexDouble: clblast::Tuner<double2>(argc, argv, V, clblast::Xnrm2GetTunerDefaults, clblast::Xnrm2GetTunerSettings<double2>, clblast::Xnrm2TestValidArguments<double2>, clblast::Xnrm2SetConstraints, clblast::Xnrm2ComputeLocalMemSize<double2>, clblast::Xnrm2SetArguments<double2>); break;
+  }
+}
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  StartVariation<1>(argc, argv);
+  StartVariation<2>(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
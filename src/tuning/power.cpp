@@ -0,0 +1,69 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the power measurements of the auto-tuner (see the header for information).
+//
+// =================================================================================================
+
+#include <fstream>
+#include <stdexcept>
+
+#include "tuning/power.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+  bool IsEnergyCounter(const std::string &file_name) {
+    const auto slash = file_name.find_last_of("/\\");
+    const auto base_name = (slash == std::string::npos) ? file_name : file_name.substr(slash + 1);
+    return base_name.compare(0, 6, "energy") == 0;
+  }
+} // anonymous namespace
+
+PowerSensor::PowerSensor(const std::string &file_name):
+    file_name_(file_name),
+    is_energy_counter_(IsEnergyCounter(file_name)),
+    start_time_(std::chrono::steady_clock::now()),
+    start_value_(-1.0) {
+  if (Read() < 0.0) {
+    throw std::runtime_error("Unable to read the power sensor '" + file_name + "'");
+  }
+}
+
+void PowerSensor::Start() {
+  start_time_ = std::chrono::steady_clock::now();
+  start_value_ = Read();
+}
+
+double PowerSensor::Stop() {
+  const auto stop_value = Read();
+  const auto elapsed_time = std::chrono::steady_clock::now() - start_time_;
+  const auto seconds = std::chrono::duration<double>(elapsed_time).count();
+  if (start_value_ < 0.0 || stop_value < 0.0) { return -1.0; }
+
+  // An energy counter gives the energy used in between, which may have wrapped around
+  if (is_energy_counter_) {
+    if (stop_value < start_value_ || seconds <= 0.0) { return -1.0; }
+    return (stop_value - start_value_) * 1.0e-6 / seconds;
+  }
+
+  // Otherwise the power is sampled at both ends
+  return 0.5 * (start_value_ + stop_value) * 1.0e-6;
+}
+
+double PowerSensor::Read() const {
+  std::ifstream file(file_name_);
+  auto value = 0.0;
+  if (!(file >> value)) { return -1.0; }
+  return value;
+}
+
+// =================================================================================================
+} // namespace clblast
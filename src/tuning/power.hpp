@@ -0,0 +1,57 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the power measurements of the CLBlast auto-tuner (see the 'power_sensor'
+// argument), such that configurations can be tuned for their energy instead of their time. The
+// sensor is a file in the format of the Linux hwmon interface, e.g. one of:
+//
+//   /sys/class/hwmon/hwmon<N>/energy<M>_input: a cumulative energy counter in microjoules
+//   /sys/class/hwmon/hwmon<N>/power<M>_average: an average power in microwatts
+//   /sys/class/hwmon/hwmon<N>/power<M>_input: an instantaneous power in microwatts
+//
+// Whether a file holds energy or power is derived from its name starting with 'energy'. Devices
+// without such a file (e.g. those of which the power is only available through a vendor library)
+// can be measured by an external process writing its readings to a file in the same format.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TUNING_POWER_H_
+#define CLBLAST_TUNING_POWER_H_
+
+#include <string>
+#include <chrono>
+
+namespace clblast {
+// =================================================================================================
+
+// Measures the average power in watts over an interval, starting at 'Start' and ending at 'Stop'
+class PowerSensor {
+ public:
+  explicit PowerSensor(const std::string &file_name);
+
+  // Starts a measurement
+  void Start();
+
+  // Ends the measurement, returns the average power in watts over it (-1.0 in case of an error)
+  double Stop();
+
+ private:
+  double Read() const; // the value of the file in microjoules or microwatts, negative on error
+
+  const std::string file_name_;
+  const bool is_energy_counter_;
+  std::chrono::steady_clock::time_point start_time_;
+  double start_value_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TUNING_POWER_H_
+#endif
@@ -16,8 +16,11 @@
 #define CLBLAST_TUNING_ROUTINES_ROUTINE_TUNER_H_
 
 #include <exception>
+#include <functional>
 #include <string>
+#include <unordered_map>
 #include <vector>
+#include <algorithm>
 #include <assert.h>
 
 #include "utilities/utilities.hpp"
@@ -28,9 +31,12 @@ namespace clblast {
 
 template <typename T>
 void ForceSelectIndirectFrom(const size_t minimum_size, const Device &device,
-                             const std::string &tuner_name, const std::string& parameter_name) {
+                             const std::string &tuner_name, const std::string& parameter_name,
+                             const Configuration& fixed_parameters) {
+  auto parameters = std::unordered_map<std::string,size_t>(fixed_parameters.begin(), fixed_parameters.end());
+  parameters[parameter_name] = minimum_size;
   const auto override_status = OverrideParameters(device(), tuner_name, PrecisionValue<T>(),
-                                                  {{parameter_name, minimum_size}});
+                                                  parameters);
   if (override_status != StatusCode::kSuccess) {
     throw RuntimeError("OverrideParameters failed with status " + ToString(override_status));
   }
@@ -43,51 +49,110 @@ TuningResult GetBestResult(const std::vector<TuningResult>& scores) {
   return *best_configuration;
 }
 
-// Tunes at kernel-level
+// Times the in-direct and the direct versions of a routine for m=n=k from 'from' to 'to'
 template <typename T, typename F>
-void TuneKernelSelection(const Platform& platform, const Device& device, const Context& context,
-                         Queue& queue, const Precision precision, F const &routine,
+void TimeKernelSelection(const Device& device, Queue& queue, F const &routine,
+                         const std::vector<Buffer<T>>& buffers,
                          const size_t from, const size_t to, const size_t step, const size_t batch_count,
                          const size_t num_runs, const std::string &name, const std::string &tuner_name,
-                         const std::string &family_name, const std::string& parameter_name) {
-
-  // Buffers
-  auto buffers = std::vector<Buffer<T>>{
-      Buffer<T>(context, to * to * batch_count),
-      Buffer<T>(context, to * to * batch_count),
-      Buffer<T>(context, to * to * batch_count)
-  };
+                         const std::string& parameter_name, const Configuration& fixed_parameters,
+                         std::vector<Timing> &indirect, std::vector<Timing> &direct) {
 
   // In-direct version
   printf("\n* Testing the in-direct %s routine for m=n=k\n", name.c_str());
-  ForceSelectIndirectFrom<T>(0, device, tuner_name, parameter_name);
-  const auto indirect = TimeRoutine(from, to, step, num_runs, queue, buffers, routine);
+  ForceSelectIndirectFrom<T>(0, device, tuner_name, parameter_name, fixed_parameters);
+  indirect = TimeRoutine(from, to, step, num_runs, queue, buffers, routine);
 
   // Direct version
   printf("\n* Testing the direct %s routine for m=n=k\n", name.c_str());
-  ForceSelectIndirectFrom<T>(batch_count * to + 1, device, tuner_name, parameter_name);
-  const auto direct = TimeRoutine(from, to, step, num_runs, queue, buffers, routine);
-
-  // Determining final score and best kernel selection point
+  ForceSelectIndirectFrom<T>(batch_count * to + 1, device, tuner_name, parameter_name, fixed_parameters);
+  direct = TimeRoutine(from, to, step, num_runs, queue, buffers, routine);
   assert(indirect.size() == direct.size());
-  printf("\n* Collecting results\n");
+}
+
+// Computes the score of each switching point (lower is better) from the relative performance of
+// the in-direct and the direct versions: the number of sizes at which the other version is faster
+std::vector<double> ComputeSwitchingScores(const std::vector<Timing> &indirect,
+                                           const std::vector<Timing> &direct) {
   auto ratios = std::vector<double>(indirect.size());
   for (auto i = size_t{0}; i < indirect.size(); ++i) {
     ratios[i] = indirect[i].second / direct[i].second;
   }
-  auto scores = std::vector<TuningResult>(ratios.size());
+  auto scores = std::vector<double>(ratios.size());
   for (auto i = size_t{0}; i < scores.size(); ++i) {
     auto score = 0;
     for (auto j = size_t{0}; j < i; ++j) { score += (ratios[j] <= 1.0); }
     for (auto j = i + 1; j < ratios.size(); ++j) { score += (ratios[j] > 1.0); }
     const auto epsilon = (scores.size() - i) / 1e3; // favour later results over earlier ones
     const auto relative_score = static_cast<double>(score) / static_cast<double>(scores.size() - 1);
-    auto tuning_results = Configuration();
+    scores[i] = (relative_score * relative_score) * 100 + epsilon;  // squared for proper default computation
+  }
+  return scores;
+}
+
+// Measures the best switching point only, e.g. to fit further parameters of the database entry
+template <typename T, typename F>
+size_t TuneSwitchingPoint(const Device& device, const Context& context, Queue& queue,
+                          F const &routine, const size_t from, const size_t to, const size_t step,
+                          const size_t batch_count, const size_t num_runs, const std::string &name,
+                          const std::string &tuner_name, const std::string& parameter_name,
+                          const Configuration& fixed_parameters = Configuration()) {
+  auto buffers = std::vector<Buffer<T>>{
+      Buffer<T>(context, to * to * batch_count),
+      Buffer<T>(context, to * to * batch_count),
+      Buffer<T>(context, to * to * batch_count)
+  };
+  auto indirect = std::vector<Timing>();
+  auto direct = std::vector<Timing>();
+  TimeKernelSelection<T>(device, queue, routine, buffers, from, to, step, batch_count, num_runs,
+                         name, tuner_name, parameter_name, fixed_parameters, indirect, direct);
+  const auto scores = ComputeSwitchingScores(indirect, direct);
+  const auto best = std::min_element(scores.begin(), scores.end()) - scores.begin();
+  printf("\n* Best switching point for the %s routine: m=n=k=%zu\n", name.c_str(), indirect[best].first);
+  return indirect[best].first;
+}
+
+// Tunes at kernel-level. Other parameters of the same database entry are kept fixed to the values
+// in 'fixed_parameters' while tuning. If given, 'switching_parameters' computes the values of the
+// database entry (including the switching parameter itself) for a particular switching point.
+template <typename T, typename F>
+void TuneKernelSelection(const Platform& platform, const Device& device, const Context& context,
+                         Queue& queue, const Precision precision, F const &routine,
+                         const size_t from, const size_t to, const size_t step, const size_t batch_count,
+                         const size_t num_runs, const std::string &name, const std::string &tuner_name,
+                         const std::string &family_name, const std::string& parameter_name,
+                         const Configuration& fixed_parameters = Configuration(),
+                         const std::function<Configuration(const size_t)> &switching_parameters = nullptr) {
+
+  // Buffers
+  auto buffers = std::vector<Buffer<T>>{
+      Buffer<T>(context, to * to * batch_count),
+      Buffer<T>(context, to * to * batch_count),
+      Buffer<T>(context, to * to * batch_count)
+  };
+
+  // Times the in-direct and direct versions
+  auto indirect = std::vector<Timing>();
+  auto direct = std::vector<Timing>();
+  TimeKernelSelection<T>(device, queue, routine, buffers, from, to, step, batch_count, num_runs,
+                         name, tuner_name, parameter_name, fixed_parameters, indirect, direct);
+
+  // Determining final score and best kernel selection point
+  printf("\n* Collecting results\n");
+  const auto switching_scores = ComputeSwitchingScores(indirect, direct);
+  auto scores = std::vector<TuningResult>(switching_scores.size());
+  for (auto i = size_t{0}; i < scores.size(); ++i) {
+    auto tuning_results = fixed_parameters;
     tuning_results[parameter_name] = indirect[i].first;
+    if (switching_parameters) {
+      for (const auto &parameter : switching_parameters(indirect[i].first)) {
+        tuning_results[parameter.first] = parameter.second;
+      }
+    }
     tuning_results["PRECISION"] = static_cast<size_t>(precision);
     scores[i] = TuningResult{
         name + "_kernel_selection",
-        (relative_score * relative_score) * 100 + epsilon,  // squared for proper default computation
+        switching_scores[i],
         tuning_results
     };
   }
@@ -110,8 +175,12 @@ void TuneKernelSelection(const Platform& platform, const Device& device, const C
   printf("\n");
 
   const auto best_result = GetBestResult(scores);
-  const auto best_switching_point = best_result.config.at(parameter_name);
-  const auto best_string = parameter_name + "=" + ToString(best_switching_point);
+  auto best_string = std::string{""};
+  for (const auto &config : best_result.config) {
+    if (config.first == "PRECISION") { continue; }
+    if (!best_string.empty()) { best_string += " "; }
+    best_string += config.first + "=" + ToString(config.second);
+  }
 
   // Outputs the results as JSON to disk, including some meta-data
   const auto precision_string = std::to_string(static_cast<size_t>(precision));
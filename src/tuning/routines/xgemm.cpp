@@ -8,13 +8,16 @@
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
 // This file tunes the Xgemm routine at a high-level: choosing between the direct (single-kernel)
-// and the in-direct (kernel plus pre/post-processing) methods.
+// and the in-direct (kernel plus pre/post-processing) methods, taking into account the cost of the
+// temporary buffers of the latter.
 //
 // =================================================================================================
 
 #include <exception>
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <cmath>
 
 #include "utilities/utilities.hpp"
 #include "tuning/routines/routine_tuner.hpp"
@@ -22,6 +25,10 @@
 namespace clblast {
 // =================================================================================================
 
+// The split-K version of GEMM is not used for the m=n=k shapes of the tuner below, its switching
+// point is kept at the default value. The 3M version of complex GEMM is disabled while tuning.
+constexpr auto kDefaultMinSplitK = size_t{4096};
+
 template <typename T>
 void RunGemmRoutine(const size_t value, const Queue& queue, const std::vector<Buffer<T>>& buffers) {
   auto queue_plain = queue();
@@ -39,6 +46,40 @@ void RunGemmRoutine(const size_t value, const Queue& queue, const std::vector<Bu
   clReleaseEvent(event);
 }
 
+// As above, but with a transposed matrix B: the in-direct version needs other temporary buffers
+template <typename T>
+void RunGemmTransposedRoutine(const size_t value, const Queue& queue, const std::vector<Buffer<T>>& buffers) {
+  auto queue_plain = queue();
+  auto event = cl_event{};
+  auto status = Gemm(Layout::kRowMajor, Transpose::kNo, Transpose::kYes,
+                     value, value, value, ConstantOne<T>(),
+                     buffers[0](), 0, value,
+                     buffers[1](), 0, value, ConstantOne<T>(),
+                     buffers[2](), 0, value,
+                     &queue_plain, &event);
+  if (status != StatusCode::kSuccess) {
+    throw RuntimeError("Gemm failed with status " + ToString(status));
+  }
+  clWaitForEvents(1, &event);
+  clReleaseEvent(event);
+}
+
+// Retrieves the size (in elements) of the temporary buffers of the in-direct version of the above
+template <typename T>
+size_t GetIndirectTempSize(const Transpose b_transpose, const size_t value, const Device &device,
+                           const Queue& queue, const Configuration& fixed_parameters) {
+  ForceSelectIndirectFrom<T>(0, device, "GemmRoutine", "XGEMM_MIN_INDIRECT_SIZE", fixed_parameters);
+  auto queue_plain = queue();
+  auto temp_buffer_size = size_t{0};
+  const auto status = GemmTempBufferSize<T>(Layout::kRowMajor, Transpose::kNo, b_transpose,
+                                            value, value, value, 0, value, 0, value, 0, value,
+                                            &queue_plain, temp_buffer_size);
+  if (status != StatusCode::kSuccess) {
+    throw RuntimeError("GemmTempBufferSize failed with status " + ToString(status));
+  }
+  return temp_buffer_size / sizeof(T);
+}
+
 template <typename T, size_t batch_count>
 void RunGemmBatchedRoutine(const size_t value, const Queue& queue, const std::vector<Buffer<T>>& buffers) {
   auto offsets = std::vector<size_t>(batch_count);
@@ -101,10 +142,43 @@ void TuneXgemm(int argc, char* argv[]) {
   const auto context = Context(device);
   auto queue = Queue(context, device);
 
+  // Measures the switching point with a transposed matrix B first, which changes the temporary
+  // buffers of the in-direct version. Together with the regular switching point below, this fits
+  // the cost model of 'Xgemm::UseDirectKernel': at both points, m*n*k equals the cube of
+  // XGEMM_MIN_INDIRECT_SIZE plus XGEMM_INDIRECT_COPY_COST times the temporary buffer size.
+  const auto fixed_parameters = Configuration{{"XGEMM_MIN_SPLITK_K", kDefaultMinSplitK},
+                                              {"XGEMM_MIN_3M_SIZE", 0}, {"XGEMM_MAX_ALT_SIZE", 0},
+                                              {"XGEMM_INDIRECT_COPY_COST", 0},
+                                              {"XGEMM_MIN_STRASSEN_SIZE", 0}};
+  const auto transposed_point = TuneSwitchingPoint<T>(device, context, queue, RunGemmTransposedRoutine<T>,
+                                                      64, 2048, 64, 1, num_runs, "gemm (B transposed)",
+                                                      "GemmRoutine", "XGEMM_MIN_INDIRECT_SIZE",
+                                                      fixed_parameters);
+  const auto transposed_temp_size = GetIndirectTempSize<T>(Transpose::kYes, transposed_point,
+                                                           device, queue, fixed_parameters);
+  const auto switching_parameters = [&](const size_t regular_point) {
+    const auto regular_temp_size = GetIndirectTempSize<T>(Transpose::kNo, regular_point,
+                                                          device, queue, fixed_parameters);
+    const auto regular_e3 = std::pow(static_cast<double>(regular_point), 3.0);
+    const auto transposed_e3 = std::pow(static_cast<double>(transposed_point), 3.0);
+    auto copy_cost = 0.0;
+    if (transposed_temp_size != regular_temp_size) {
+      copy_cost = (transposed_e3 - regular_e3) /
+                  (static_cast<double>(transposed_temp_size) - static_cast<double>(regular_temp_size));
+    }
+    copy_cost = std::max(copy_cost, 0.0);
+    const auto min_indirect_e3 = std::max(regular_e3 - copy_cost * regular_temp_size, 0.0);
+    return Configuration{
+      {"XGEMM_MIN_INDIRECT_SIZE", static_cast<size_t>(std::round(std::cbrt(min_indirect_e3)))},
+      {"XGEMM_INDIRECT_COPY_COST", static_cast<size_t>(std::round(copy_cost))}
+    };
+  };
+
   // Run the tuners for the XGEMM routines
   TuneKernelSelection<T>(platform, device, context, queue, precision, RunGemmRoutine<T>,
                          64, 2048, 64, 1, num_runs,
-                         "gemm", "GemmRoutine", "gemm_routine", "XGEMM_MIN_INDIRECT_SIZE");
+                         "gemm", "GemmRoutine", "gemm_routine", "XGEMM_MIN_INDIRECT_SIZE",
+                         fixed_parameters, switching_parameters);
   //TuneKernelSelection<T>(platform, device, context, queue, precision, RunGemmBatchedRoutine<T, 30>,
   //                       16, 128, 32, 30, num_runs,
   //                       "gemmbatched", "GemmRoutine", "gemm_routine_2", "XGEMMBATCHED_MIN_INDIRECT_SIZE");
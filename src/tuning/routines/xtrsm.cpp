@@ -0,0 +1,189 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file tunes the Xtrsm routine at a high-level: first choosing the size of the inverted
+// diagonal blocks, and then the number of right-hand sides from which those are used instead of
+// solving the system by substitution.
+//
+// =================================================================================================
+
+#include <exception>
+#include <string>
+#include <vector>
+#include <limits>
+
+#include "utilities/utilities.hpp"
+#include "tuning/routines/routine_tuner.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+constexpr auto kSize = size_t{1024}; // 'm' argument, the size of the triangular matrix
+constexpr auto kMaxRhs = size_t{512}; // the largest 'n' argument when tuning the switching point
+
+template <typename T>
+void SetTrsmParameters(const size_t block_size, const size_t min_inversion_rhs,
+                       const Device &device) {
+  const auto override_status = OverrideParameters(device(), "TrsmRoutine", PrecisionValue<T>(),
+                                                  {{"TRSM_BLOCK_SIZE", block_size},
+                                                   {"TRSM_MIN_INVERSION_RHS", min_inversion_rhs}});
+  if (override_status != StatusCode::kSuccess) {
+    throw RuntimeError("OverrideParameters failed with status " + ToString(override_status));
+  }
+}
+
+template <typename T>
+void RunTrsmRoutine(const size_t n, Queue& queue, const std::vector<Buffer<T>>& buffers) {
+  auto queue_plain = queue();
+  auto event = cl_event{};
+  auto status = Trsm<T>(Layout::kColMajor, Side::kLeft, Triangle::kLower, Transpose::kNo,
+                        Diagonal::kNonUnit, kSize, n, ConstantOne<T>(),
+                        buffers[0](), 0, kSize, // A matrix
+                        buffers[1](), 0, kSize, // B matrix
+                        &queue_plain, &event);
+  if (status != StatusCode::kSuccess) {
+    throw RuntimeError("Trsm failed with status " + ToString(status));
+  }
+  clWaitForEvents(1, &event);
+  clReleaseEvent(event);
+}
+
+// As above, but for a square B matrix and with the given size of the inverted blocks
+template <typename T>
+void RunTrsmBlockSizeRoutine(const size_t block_size, Queue& queue,
+                             const std::vector<Buffer<T>>& buffers) {
+  SetTrsmParameters<T>(block_size, 0, queue.GetDevice());
+  RunTrsmRoutine<T>(kSize, queue, buffers);
+}
+
+template <typename T>
+void TuneXtrsm(int argc, char* argv[]) {
+  auto command_line_args = RetrieveCommandLineArguments(argc, argv);
+  auto help = std::string{"* Options given/available:\n"};
+  const auto platform_id = GetArgument(command_line_args, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(command_line_args, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto precision = GetArgument(command_line_args, help, kArgPrecision, Precision::kSingle);
+  const auto num_runs = GetArgument(command_line_args, help, kArgNumRuns, size_t{10});
+  fprintf(stdout, "%s\n", help.c_str());
+
+  // Values for the block size (supported by the invert routine) and for the number of right-hand
+  // sides, i.e. the 'n' argument
+  const auto block_sizes = std::vector<size_t>{16, 32, 64, 128};
+  const auto num_rhs_values = std::vector<size_t>{1, 2, 4, 8, 16, 24, 32, 48, 64, 96, 128,
+                                                  192, 256, 384, kMaxRhs};
+
+  // OpenCL initialisation
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  if (!PrecisionSupported<T>(device)) {
+    printf("* Unsupported precision, skipping this tuning run\n");
+    return;
+  }
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Buffers: an identity matrix A and a matrix B of ones, such that the solution stays finite
+  auto a_host = std::vector<T>(kSize * kSize, ConstantZero<T>());
+  for (auto i = size_t{0}; i < kSize; ++i) { a_host[i + i * kSize] = ConstantOne<T>(); }
+  const auto b_host = std::vector<T>(kSize * kSize, ConstantOne<T>());
+  auto buffers = std::vector<Buffer<T>>{
+    Buffer<T>(context, kSize * kSize),
+    Buffer<T>(context, kSize * kSize)
+  };
+  buffers[0].Write(queue, a_host.size(), a_host);
+  buffers[1].Write(queue, b_host.size(), b_host);
+
+  // Tests the block sizes with inversion of the diagonal blocks for a square B matrix
+  printf("\n* Testing the block sizes of the trsm routine for m=n=%zu\n", kSize);
+  const auto block_size_results = TimeRoutine(block_sizes, num_runs, queue, buffers,
+                                              RunTrsmBlockSizeRoutine<T>);
+  auto best_block_time = std::numeric_limits<double>::max();
+  auto best_block_size = block_sizes[0];
+  for (const auto &result : block_size_results) {
+    if (result.second != -1 && result.second < best_block_time) {
+      best_block_time = result.second;
+      best_block_size = result.first;
+    }
+  }
+  printf("\n* Best block size for the trsm routine: %zu\n", best_block_size);
+
+  // Tests the inversion and the substitution versions for the number of right-hand sides
+  printf("\n* Testing the inversion version of the trsm routine for m=%zu\n", kSize);
+  SetTrsmParameters<T>(best_block_size, 0, device);
+  const auto inversion = TimeRoutine(num_rhs_values, num_runs, queue, buffers, RunTrsmRoutine<T>);
+  printf("\n* Testing the substitution version of the trsm routine for m=%zu\n", kSize);
+  SetTrsmParameters<T>(best_block_size, kMaxRhs + 1, device);
+  const auto substitution = TimeRoutine(num_rhs_values, num_runs, queue, buffers, RunTrsmRoutine<T>);
+
+  // Stores the results in the expected format: scores for the switching points, with inversion
+  // from the number of right-hand sides at that point on and substitution below it
+  const auto switching_scores = ComputeSwitchingScores(inversion, substitution);
+  auto scores = std::vector<TuningResult>();
+  for (auto i = size_t{0}; i < switching_scores.size(); ++i) {
+    auto tuning_results = Configuration();
+    tuning_results["TRSM_BLOCK_SIZE"] = best_block_size;
+    tuning_results["TRSM_MIN_INVERSION_RHS"] = inversion[i].first;
+    tuning_results["PRECISION"] = static_cast<size_t>(precision);
+    scores.emplace_back(TuningResult{"trsm_routine", switching_scores[i], tuning_results});
+  }
+
+  // Displaying results
+  printf("|         ||  inversion  || substitution ||          |\n");
+  printf("|       n ||     ms      ||      ms      ||  score   | (lowest score == best switching point)\n");
+  printf("x---------xx-------------xx--------------xx----------x\n");
+  for (auto i = size_t{0}; i < inversion.size(); ++i) {
+    if (inversion[i].second != -1 && substitution[i].second != -1) {
+      printf("| %7zu || %11.2lf || %12.2lf || %8.3lf |\n", inversion[i].first,
+             inversion[i].second, substitution[i].second, scores[i].score);
+    }
+  }
+  printf("x---------xx-------------xx--------------xx----------x\n");
+  printf("\n");
+  const auto best_result = GetBestResult(scores);
+  const auto best_string = "TRSM_BLOCK_SIZE=" + ToString(best_block_size) +
+                           " TRSM_MIN_INVERSION_RHS=" +
+                           ToString(best_result.config.at("TRSM_MIN_INVERSION_RHS"));
+
+  // Outputs the results as JSON to disk, including some meta-data
+  const auto precision_string = std::to_string(static_cast<size_t>(precision));
+  auto metadata = std::vector<std::pair<std::string,std::string>>{
+    {"kernel_family", "trsm_routine"},
+    {"precision", precision_string},
+    {"arg_m", ToString(kSize)},
+    {"best_kernel", "trsm_routine"},
+    {"best_time", ToString(best_result.score)},
+    {"best_parameters", best_string}
+  };
+  PrintTimingsToFileAsJSON("clblast_routine_xtrsm_" + precision_string + ".json",
+                           device, platform, metadata, scores);
+
+  printf("* Completed tuning process\n");
+  printf("\n");
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Shortcuts to the clblast namespace
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+  switch(clblast::GetPrecision(command_line_args)) {
+    case clblast::Precision::kSingle: clblast::TuneXtrsm<float>(argc, argv); break;
+    case clblast::Precision::kDouble: clblast::TuneXtrsm<double>(argc, argv); break;
+    case clblast::Precision::kComplexSingle: clblast::TuneXtrsm<float2>(argc, argv); break;
+    case clblast::Precision::kComplexDouble: clblast::TuneXtrsm<double2>(argc, argv); break;
+  }
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,221 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the search strategies of the CLBlast auto-tuner (see the header for more
+// information). This is only used for the optional tuner binaries and not part of the core.
+//
+// =================================================================================================
+
+#include <vector>
+#include <string>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+
+#include "tuning/search.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+  constexpr auto kSearchSeed = 42; // fixed seed for reproducibility
+  constexpr auto kMaxAttempts = size_t{100}; // proposals to try before picking one at random
+  constexpr auto kInvalidScore = std::numeric_limits<double>::max();
+} // anonymous namespace
+
+Search::Search(const std::vector<Configuration> &configurations,
+               const std::vector<Parameter> &parameters, const size_t num_steps):
+    configurations_(configurations),
+    parameters_(parameters),
+    generator_(kSearchSeed),
+    num_steps_(std::min(num_steps, configurations.size())),
+    num_proposed_(0),
+    states_(configurations.size(), State::kUnvisited),
+    scores_(configurations.size(), kInvalidScore) {
+  for (auto index = size_t{0}; index < configurations.size(); ++index) {
+    indices_[configurations[index]] = index;
+  }
+}
+
+// Configurations which were evaluated before are passed to the strategy again with their known
+// result, configurations which are still being evaluated are skipped
+size_t Search::Next() {
+  auto index = kNoConfiguration;
+  for (auto attempt = size_t{0}; attempt < kMaxAttempts && index == kNoConfiguration; ++attempt) {
+    const auto proposal = Propose();
+    if (proposal >= configurations_.size()) { continue; }
+    if (states_[proposal] == State::kUnvisited) { index = proposal; }
+    else if (states_[proposal] == State::kReported) { Update(proposal, scores_[proposal]); }
+  }
+  if (index == kNoConfiguration) { index = RandomUnvisited(); }
+  if (index == kNoConfiguration) { throw std::runtime_error("No configurations left to search"); }
+  states_[index] = State::kPending;
+  ++num_proposed_;
+  return index;
+}
+
+void Search::Report(const size_t index, const double time_ms) {
+  const auto score = (time_ms < 0.0) ? kInvalidScore : time_ms;
+  states_[index] = State::kReported;
+  scores_[index] = score;
+  Update(index, score);
+}
+
+size_t Search::RandomUnvisited() {
+  if (configurations_.empty()) { return kNoConfiguration; }
+  auto distribution = std::uniform_int_distribution<size_t>(0, configurations_.size() - 1);
+  const auto start = distribution(generator_);
+  for (auto i = size_t{0}; i < configurations_.size(); ++i) {
+    const auto index = (start + i) % configurations_.size();
+    if (states_[index] == State::kUnvisited) { return index; }
+  }
+  return kNoConfiguration;
+}
+
+// Changes the value of a single random parameter, as long as the result is a valid configuration
+size_t Search::RandomNeighbour(const size_t index) {
+  if (parameters_.empty()) { return kNoConfiguration; }
+  const auto &configuration = configurations_[index];
+  auto neighbour = configuration;
+  auto parameter_distribution = std::uniform_int_distribution<size_t>(0, parameters_.size() - 1);
+  for (auto attempt = size_t{0}; attempt < kMaxAttempts; ++attempt) {
+    const auto &parameter = parameters_[parameter_distribution(generator_)];
+    const auto &values = parameter.second;
+    if (values.size() < 2) { continue; }
+    auto value_distribution = std::uniform_int_distribution<size_t>(0, values.size() - 1);
+    const auto value = values[value_distribution(generator_)];
+    const auto current_value = configuration.at(parameter.first);
+    if (value == current_value) { continue; }
+    neighbour[parameter.first] = value;
+    const auto found = Find(neighbour);
+    if (found != kNoConfiguration) { return found; }
+    neighbour[parameter.first] = current_value;
+  }
+  return kNoConfiguration;
+}
+
+size_t Search::Find(const Configuration &configuration) const {
+  const auto found = indices_.find(configuration);
+  return (found == indices_.end()) ? kNoConfiguration : found->second;
+}
+
+// =================================================================================================
+
+FullSearch::FullSearch(const std::vector<Configuration> &configurations,
+                       const std::vector<Parameter> &parameters):
+    Search(configurations, parameters, configurations.size()),
+    next_(0) {
+}
+
+// =================================================================================================
+
+AnnealingSearch::AnnealingSearch(const std::vector<Configuration> &configurations,
+                                 const std::vector<Parameter> &parameters, const size_t num_steps,
+                                 const double max_temperature):
+    Search(configurations, parameters, num_steps),
+    max_temperature_(max_temperature),
+    current_(kNoConfiguration),
+    current_score_(kInvalidScore) {
+}
+
+size_t AnnealingSearch::Propose() {
+  if (current_ == kNoConfiguration) { return RandomUnvisited(); }
+  return RandomNeighbour(current_);
+}
+
+// The acceptance probability of a slower configuration is based on the relative slow-down, such
+// that the temperature is independent of the run-time of the kernel
+void AnnealingSearch::Update(const size_t index, const double score) {
+  auto accept = (current_ == kNoConfiguration || score <= current_score_);
+  const auto temperature = max_temperature_ * (1.0 - Progress());
+  if (!accept && temperature > 0.0 && current_score_ > 0.0 && score != kInvalidScore) {
+    const auto slow_down = (score - current_score_) / current_score_;
+    const auto probability = std::exp(-slow_down / temperature);
+    auto distribution = std::uniform_real_distribution<double>(0.0, 1.0);
+    accept = (distribution(generator_) < probability);
+  }
+  if (accept) {
+    current_ = index;
+    current_score_ = score;
+  }
+}
+
+// =================================================================================================
+
+PSOSearch::PSOSearch(const std::vector<Configuration> &configurations,
+                     const std::vector<Parameter> &parameters, const size_t num_steps,
+                     const size_t swarm_size, const double influence_global,
+                     const double influence_local, const double influence_random):
+    Search(configurations, parameters, num_steps),
+    influence_global_(influence_global),
+    influence_local_(influence_local),
+    influence_random_(influence_random),
+    positions_(std::max(swarm_size, size_t{1}), kNoConfiguration),
+    local_bests_(std::max(swarm_size, size_t{1}), kNoConfiguration),
+    local_best_scores_(std::max(swarm_size, size_t{1}), kInvalidScore),
+    global_best_(kNoConfiguration),
+    global_best_score_(kInvalidScore),
+    next_particle_(0) {
+}
+
+// The particles take turns. A particle without a (valid) position yet starts at random.
+size_t PSOSearch::Propose() {
+  const auto particle = next_particle_;
+  next_particle_ = (next_particle_ + 1) % positions_.size();
+  auto proposal = kNoConfiguration;
+  if (positions_[particle] == kNoConfiguration) {
+    proposal = RandomUnvisited();
+  }
+  else {
+    auto configuration = configurations_[positions_[particle]];
+    auto distribution = std::uniform_real_distribution<double>(0.0, 1.0);
+    for (const auto &parameter : parameters_) {
+      const auto random = distribution(generator_);
+      if (random < influence_global_ && global_best_ != kNoConfiguration) {
+        const auto &global_best = configurations_[global_best_];
+        configuration[parameter.first] = global_best.at(parameter.first);
+      }
+      else if (random < influence_global_ + influence_local_ &&
+               local_bests_[particle] != kNoConfiguration) {
+        const auto &local_best = configurations_[local_bests_[particle]];
+        configuration[parameter.first] = local_best.at(parameter.first);
+      }
+      else if (random < influence_global_ + influence_local_ + influence_random_ &&
+               !parameter.second.empty()) {
+        const auto &values = parameter.second;
+        auto value_distribution = std::uniform_int_distribution<size_t>(0, values.size() - 1);
+        configuration[parameter.first] = values[value_distribution(generator_)];
+      }
+    }
+    proposal = Find(configuration);
+    if (proposal == kNoConfiguration) { proposal = RandomNeighbour(positions_[particle]); }
+  }
+  if (proposal != kNoConfiguration) { particles_[proposal] = particle; }
+  return proposal;
+}
+
+// Particles only move to valid configurations
+void PSOSearch::Update(const size_t index, const double score) {
+  const auto found = particles_.find(index);
+  if (found == particles_.end() || score == kInvalidScore) { return; }
+  const auto particle = found->second;
+  positions_[particle] = index;
+  if (score < local_best_scores_[particle]) {
+    local_bests_[particle] = index;
+    local_best_scores_[particle] = score;
+  }
+  if (score < global_best_score_) {
+    global_best_ = index;
+    global_best_score_ = score;
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,164 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the search strategies of the CLBlast auto-tuner (following CLTune): a full
+// (or random) search in order, simulated annealing, and particle swarm optimisation (PSO). The
+// guided strategies only evaluate a budget of configurations and move through the search space
+// based on the results so far, where two configurations are neighbours if they differ in a single
+// parameter. This is only used for the optional tuner binaries and not part of the core of CLBlast.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TUNING_SEARCH_H_
+#define CLBLAST_TUNING_SEARCH_H_
+
+#include <vector>
+#include <string>
+#include <map>
+#include <memory>
+#include <random>
+#include <unordered_map>
+
+#include "utilities/utilities.hpp"
+#include "tuning/configurations.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The values of the 'heuristic' tuner argument (1 is the same as 0: the 'fraction' argument selects
+// between a full and a random search)
+constexpr auto kHeuristicFullSearch = size_t{0};
+constexpr auto kHeuristicAnnealing = size_t{2};
+constexpr auto kHeuristicPSO = size_t{3};
+
+// Denotes the absence of a configuration index
+constexpr auto kNoConfiguration = static_cast<size_t>(-1);
+
+// The base class of the search strategies. The tuner asks for the next configuration to evaluate
+// and reports its time afterwards. Results may be reported later than the next configurations are
+// asked for (e.g. when compiling ahead), in which case the strategies use the results known so far.
+class Search {
+ public:
+  Search(const std::vector<Configuration> &configurations,
+         const std::vector<Parameter> &parameters, const size_t num_steps);
+  virtual ~Search() = default;
+
+  // Whether all configurations within the budget have been handed out
+  bool Done() const { return num_proposed_ >= num_steps_; }
+
+  // Returns the index of the next configuration to evaluate, never one evaluated before
+  size_t Next();
+
+  // Reports the time of an evaluated configuration in ms, or a negative value if it was invalid
+  void Report(const size_t index, const double time_ms);
+
+ protected:
+  // Proposes a configuration (which may have been evaluated before) and processes a result
+  virtual size_t Propose() = 0;
+  virtual void Update(const size_t index, const double score) = 0;
+
+  // Helpers for the derived classes
+  size_t RandomUnvisited();
+  size_t RandomNeighbour(const size_t index);
+  size_t Find(const Configuration &configuration) const;
+  double Progress() const { return static_cast<double>(num_proposed_) / num_steps_; }
+
+  const std::vector<Configuration> &configurations_;
+  const std::vector<Parameter> &parameters_;
+  std::mt19937 generator_;
+
+ private:
+  enum class State { kUnvisited, kPending, kReported };
+
+  const size_t num_steps_;
+  size_t num_proposed_;
+  std::vector<State> states_;
+  std::vector<double> scores_;
+  std::map<Configuration, size_t> indices_;
+};
+
+// =================================================================================================
+
+// Evaluates the configurations in order
+class FullSearch: public Search {
+ public:
+  FullSearch(const std::vector<Configuration> &configurations,
+             const std::vector<Parameter> &parameters);
+ protected:
+  size_t Propose() override { return next_++; }
+  void Update(const size_t, const double) override { }
+ private:
+  size_t next_;
+};
+
+// Simulated annealing: moves to a neighbour if it is faster, or with a probability that decreases
+// with the relative slow-down and with the temperature, which cools down towards the end
+class AnnealingSearch: public Search {
+ public:
+  AnnealingSearch(const std::vector<Configuration> &configurations,
+                  const std::vector<Parameter> &parameters, const size_t num_steps,
+                  const double max_temperature);
+ protected:
+  size_t Propose() override;
+  void Update(const size_t index, const double score) override;
+ private:
+  const double max_temperature_;
+  size_t current_;
+  double current_score_;
+};
+
+// Particle swarm optimisation: each particle takes each parameter value from the global best, from
+// its own best, or at random, with the given probabilities (and otherwise keeps its current value)
+class PSOSearch: public Search {
+ public:
+  PSOSearch(const std::vector<Configuration> &configurations,
+            const std::vector<Parameter> &parameters, const size_t num_steps,
+            const size_t swarm_size, const double influence_global, const double influence_local,
+            const double influence_random);
+ protected:
+  size_t Propose() override;
+  void Update(const size_t index, const double score) override;
+ private:
+  const double influence_global_;
+  const double influence_local_;
+  const double influence_random_;
+  std::vector<size_t> positions_;
+  std::vector<size_t> local_bests_;
+  std::vector<double> local_best_scores_;
+  size_t global_best_;
+  double global_best_score_;
+  size_t next_particle_;
+  std::unordered_map<size_t, size_t> particles_; // the particle which proposed a configuration
+};
+
+// =================================================================================================
+
+// Creates the search strategy selected by the tuner arguments
+template <typename T>
+std::unique_ptr<Search> CreateSearch(const Arguments<T> &args,
+                                     const std::vector<Configuration> &configurations,
+                                     const std::vector<Parameter> &parameters,
+                                     const size_t num_steps) {
+  if (args.heuristic_selection == kHeuristicAnnealing) {
+    return std::unique_ptr<Search>(new AnnealingSearch(configurations, parameters, num_steps,
+                                                       args.ann_max_temperature));
+  }
+  if (args.heuristic_selection == kHeuristicPSO) {
+    return std::unique_ptr<Search>(new PSOSearch(configurations, parameters, num_steps,
+                                                 args.pso_swarm_size, args.pso_inf_global,
+                                                 args.pso_inf_local, args.pso_inf_random));
+  }
+  return std::unique_ptr<Search>(new FullSearch(configurations, parameters));
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TUNING_SEARCH_H_
+#endif
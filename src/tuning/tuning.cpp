@@ -18,9 +18,17 @@
 #include <utility>
 #include <algorithm>
 #include <cstdio>
+#include <deque>
+#include <future>
+#include <thread>
+#include <fstream>
+#include <sstream>
+#include <memory>
 
 #include "utilities/utilities.hpp"
 #include "tuning/tuning.hpp"
+#include "tuning/search.hpp"
+#include "tuning/power.hpp"
 
 namespace clblast {
 // =================================================================================================
@@ -85,6 +93,39 @@ void print_separator(const size_t parameters_size) {
   printf("-x----------------x--------------x--------x-------------------x\n");
 }
 
+std::string ConfigurationToString(const Configuration &configuration) {
+  auto result = std::string{""};
+  for (const auto &parameter : configuration) {
+    if (!result.empty()) { result += " "; }
+    result += parameter.first + "=" + ToString(parameter.second);
+  }
+  return result;
+}
+
+// =================================================================================================
+
+Checkpoint ReadCheckpoint(const std::string &filename) {
+  auto checkpoint = Checkpoint();
+  std::ifstream file(filename);
+  auto line = std::string{""};
+  while (std::getline(file, line)) {
+    std::istringstream stream(line);
+    auto entry = CheckpointEntry{};
+    auto configuration = std::string{""};
+    if (!(stream >> entry.status >> entry.time_ms)) { continue; } // e.g. a partially written line
+    std::getline(stream >> std::ws, configuration);
+    if (!configuration.empty()) { checkpoint[configuration] = entry; }
+  }
+  return checkpoint;
+}
+
+void AppendCheckpoint(FILE* file, const std::string &status, const double time_ms,
+                      const std::string &configuration) {
+  if (file == nullptr) { return; }
+  fprintf(file, "%s %.6lf %s\n", status.c_str(), time_ms, configuration.c_str());
+  fflush(file);
+}
+
 // =================================================================================================
 
 template <typename T>
@@ -125,15 +166,116 @@ void Tuner(int argc, char* argv[], const int V,
     if (o == kArgAlpha)    { args.alpha    = GetArgument(command_line_args, help, kArgAlpha, GetScalar<T>()); }
     if (o == kArgBeta)     { args.beta     = GetArgument(command_line_args, help, kArgBeta, GetScalar<T>()); }
     if (o == kArgBatchCount) { args.batch_count = GetArgument(command_line_args, help, kArgBatchCount, defaults.default_batch_count); }
+    if (o == kArgChannels) { args.channels = GetArgument(command_line_args, help, kArgChannels, defaults.default_channels); }
+    if (o == kArgHeight)   { args.height   = GetArgument(command_line_args, help, kArgHeight, defaults.default_height); }
+    if (o == kArgWidth)    { args.width    = GetArgument(command_line_args, help, kArgWidth, defaults.default_width); }
+    if (o == kArgKernelH)  { args.kernel_h = GetArgument(command_line_args, help, kArgKernelH, defaults.default_kernel_h); }
+    if (o == kArgKernelW)  { args.kernel_w = GetArgument(command_line_args, help, kArgKernelW, defaults.default_kernel_w); }
+    if (o == kArgNumKernels) { args.num_kernels = GetArgument(command_line_args, help, kArgNumKernels, defaults.default_num_kernels); }
+    if (o == kArgHeuristicSelection) { args.heuristic_selection = GetArgument(command_line_args, help, kArgHeuristicSelection, args.heuristic_selection); }
+    if (o == kArgAnnMaxTemp) { args.ann_max_temperature = GetArgument(command_line_args, help, kArgAnnMaxTemp, args.ann_max_temperature); }
+    if (o == kArgPsoSwarmSize) { args.pso_swarm_size = GetArgument(command_line_args, help, kArgPsoSwarmSize, args.pso_swarm_size); }
+    if (o == kArgPsoInfGlobal) { args.pso_inf_global = GetArgument(command_line_args, help, kArgPsoInfGlobal, args.pso_inf_global); }
+    if (o == kArgPsoInfLocal) { args.pso_inf_local = GetArgument(command_line_args, help, kArgPsoInfLocal, args.pso_inf_local); }
+    if (o == kArgPsoInfRandom) { args.pso_inf_random = GetArgument(command_line_args, help, kArgPsoInfRandom, args.pso_inf_random); }
   }
   args.fraction = GetArgument(command_line_args, help, kArgFraction, defaults.default_fraction);
   args.num_runs = GetArgument(command_line_args, help, kArgNumRuns, defaults.default_num_runs);
   const auto max_l2_norm = GetArgument(command_line_args, help, kArgMaxL2Norm, 1.0e-4);
+  const auto prune_factor = GetArgument(command_line_args, help, kArgPruneFactor, 4.0);
+  const auto resume = CheckArgument(command_line_args, help, kArgResume);
+  const auto size_bucket = GetArgument(command_line_args, help, kArgSizeBucket, size_t{0});
+  const auto sizes = GetArgument(command_line_args, help, kArgSizes, std::string{""});
+  const auto hardware_threads = static_cast<size_t>(std::thread::hardware_concurrency());
+  const auto default_compile_threads = std::max(size_t{1}, std::min(hardware_threads, size_t{8}));
+  const auto compile_threads = GetArgument(command_line_args, help, kArgCompileThreads,
+                                           default_compile_threads);
+  const auto verification = GetArgument(command_line_args, help, kArgVerification, size_t{0});
+  const auto verify_top = GetArgument(command_line_args, help, kArgVerifyTop, size_t{8});
+  const auto cache_variable = std::getenv("CLBLAST_CACHE_DIR");
+  const auto cache_directory = GetArgument(command_line_args, help, kArgCacheDir,
+                                           std::string{(cache_variable != nullptr) ? cache_variable : ""});
+  const auto power_variable = std::getenv("CLBLAST_POWER_SENSOR");
+  const auto power_sensor_file = GetArgument(command_line_args, help, kArgPowerSensor,
+                                             std::string{(power_variable != nullptr) ? power_variable : ""});
+  const auto objective = GetArgument(command_line_args, help, kArgObjective, std::string{"time"});
+  const auto fast_math = CheckArgument(command_line_args, help, kArgFastMath);
   printf("%s\n", help.c_str());
-  const TunerSettings settings = GetTunerSettings(V, args);
 
-  // Tests validity of the given arguments
-  TestValidArguments(V, args);
+  // The objective to minimise: the time of a kernel call by default, or its energy (the average
+  // power during the runs times the time) as measured by the power sensor (see 'tuning/power.hpp')
+  if (objective != "time" && objective != "energy") {
+    throw std::runtime_error("Invalid objective '" + objective + "', expected 'time' or 'energy'");
+  }
+  const auto tune_energy = (objective == "energy");
+  if (tune_energy && power_sensor_file.empty()) {
+    throw std::runtime_error("The energy objective requires a power sensor, see '-power_sensor'");
+  }
+  auto power_sensor = std::unique_ptr<PowerSensor>();
+  if (tune_energy) { power_sensor = std::unique_ptr<PowerSensor>(new PowerSensor(power_sensor_file)); }
+  const auto score_unit = std::string{(tune_energy) ? "mJ" : "ms"};
+
+  // The problems to tune for: by default only the one given by the arguments. With a comma-separated
+  // list of 'sizes', each compiled configuration is run for every size instead (setting each of 'm',
+  // 'n', and 'k' which the tuner uses), with the results of each size stored as if tuned separately
+  // with the size as 'size_bucket'. The search itself is guided by the first size.
+  struct Problem {
+    Arguments<T> args;
+    TunerSettings settings;
+    size_t size_bucket;
+    std::vector<size_t> buffer_sizes;
+    std::vector<std::vector<T>> source_buffers;
+    std::vector<std::vector<T>> reference_buffers;
+    std::vector<std::vector<T>> result_buffers;
+    std::vector<Buffer<T>> device_buffers;
+    std::vector<Buffer<T>> device_reference_buffers; // per output, for the on-device verification
+    std::string file_name;
+    Checkpoint checkpoint;
+    FILE* checkpoint_file;
+    std::vector<TuningResult> results;
+    double best_time_so_far;
+  };
+  auto problems = std::vector<Problem>();
+  const auto add_problem = [&](const Arguments<T> &problem_args, const size_t problem_size_bucket) {
+    auto problem = Problem{};
+    problem.args = problem_args;
+    problem.settings = GetTunerSettings(V, problem_args);
+    problem.size_bucket = problem_size_bucket;
+    problem.checkpoint_file = nullptr;
+    problem.best_time_so_far = 0.0;
+    TestValidArguments(V, problem_args);
+    problems.push_back(problem);
+  };
+  if (sizes.empty()) { add_problem(args, size_bucket); }
+  for (const auto &size_string : split(sizes, ',')) {
+    const auto size = ConvertArgument(size_string.c_str(), size_t{0});
+    if (size == 0) { throw std::runtime_error("Invalid size '" + size_string + "' in '" + sizes + "'"); }
+    auto problem_args = args;
+    for (auto &o: defaults.options) {
+      if (o == kArgM) { problem_args.m = size; }
+      if (o == kArgN) { problem_args.n = size; }
+      if (o == kArgK) { problem_args.k = size; }
+    }
+    add_problem(problem_args, size);
+  }
+  if (problems.empty()) { throw std::runtime_error("No sizes given in '" + sizes + "'"); }
+  auto tuner_settings = problems.front().settings; // the kernel and its parameters
+
+  // With 'fast_math', the fast math mode (see 'MathMode') is tuned alongside the kernel's own
+  // parameters, as a parameter 'FAST_MATH' which selects the compiler options of that mode. Its
+  // configurations still have to pass the verification against the reference.
+  if (fast_math) { tuner_settings.parameters.push_back({"FAST_MATH", {0, 1}}); }
+  const TunerSettings settings = tuner_settings;
+  for (const auto &problem : problems) {
+    if (problem.settings.kernel_name != settings.kernel_name ||
+        problem.settings.sources != settings.sources) {
+      throw std::runtime_error("The sizes in '" + sizes + "' require different kernels");
+    }
+  }
+  if (problems.size() > 1) {
+    printf("* Running each configuration for %s%zu sizes%s\n",
+           kPrintMessage.c_str(), problems.size(), kPrintEnd.c_str());
+  }
 
   // Initializes OpenCL
   const auto platform = Platform(args.platform_id);
@@ -150,25 +292,27 @@ void Tuner(int argc, char* argv[], const int V,
   const auto device_architecture = GetDeviceArchitecture(device);
   const auto device_name = GetDeviceName(device);
 
-  // Creates input buffers with random data
-  const auto buffer_sizes = std::vector<size_t>{
-      settings.size_x, settings.size_y,
-      settings.size_a, settings.size_b, settings.size_c,
-      settings.size_temp
-  };
+  // Creates input buffers with random data for each problem
   std::mt19937 mt(kSeed);
   std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
-  auto source_buffers = std::vector<std::vector<T>>();
-  auto reference_buffers = std::vector<std::vector<T>>();
-  auto result_buffers = std::vector<std::vector<T>>();
-  auto device_buffers = std::vector<Buffer<T>>();
-  for (const auto size : buffer_sizes) {
-    auto host_buffer = std::vector<T>(size);
-    PopulateVector(host_buffer, mt, dist);
-    source_buffers.push_back(host_buffer);
-    reference_buffers.push_back(std::vector<T>(size));
-    result_buffers.push_back(std::vector<T>(size));
-    device_buffers.push_back(Buffer<T>(context, size));
+  for (auto &problem : problems) {
+    problem.buffer_sizes = std::vector<size_t>{
+        problem.settings.size_x, problem.settings.size_y,
+        problem.settings.size_a, problem.settings.size_b, problem.settings.size_c,
+        problem.settings.size_temp
+    };
+    for (auto id = size_t{0}; id < problem.buffer_sizes.size(); ++id) {
+      const auto size = problem.buffer_sizes[id];
+      auto host_buffer = std::vector<T>(size);
+      PopulateVector(host_buffer, mt, dist);
+      if (problem.settings.initialize_buffer) {
+        problem.settings.initialize_buffer(id, host_buffer.data(), size * sizeof(T));
+      }
+      problem.source_buffers.push_back(host_buffer);
+      problem.reference_buffers.push_back(std::vector<T>(size));
+      problem.result_buffers.push_back(std::vector<T>(size));
+      problem.device_buffers.push_back(Buffer<T>(context, size));
+    }
   }
 
   // Sets the tunable parameters and their possible values
@@ -177,149 +321,409 @@ void Tuner(int argc, char* argv[], const int V,
   printf("* Found %s%zu configuration(s)%s\n",
          kPrintMessage.c_str(), configurations.size(), kPrintEnd.c_str());
 
-  // Select the search method (full search or a random fraction)
+  // Select the search method (full search or a random fraction, or simulated annealing or PSO which
+  // explore the given fraction of configurations guided by the results so far)
+  const auto guided_search = (args.heuristic_selection == kHeuristicAnnealing ||
+                              args.heuristic_selection == kHeuristicPSO);
+  auto num_steps = configurations.size();
   if (args.fraction != 0.0 && args.fraction != 1.0) {
     const auto new_size = static_cast<size_t>(configurations.size() / args.fraction);
-    auto rng = std::default_random_engine{};
-    std::shuffle(std::begin(configurations), std::end(configurations), rng);
-    configurations.resize(new_size);
-    printf("* Exploring a random subset of %s%zu configuration(s)%s\n",
-           kPrintMessage.c_str(), configurations.size(), kPrintEnd.c_str());
+    if (guided_search) {
+      num_steps = std::min(std::max(new_size, size_t{1}), configurations.size());
+      printf("* Exploring %s%zu configuration(s)%s using %s\n",
+             kPrintMessage.c_str(), num_steps, kPrintEnd.c_str(),
+             (args.heuristic_selection == kHeuristicPSO) ? "particle swarm optimisation" :
+                                                            "simulated annealing");
+    }
+    else {
+      auto rng = std::default_random_engine{};
+      std::shuffle(std::begin(configurations), std::end(configurations), rng);
+      configurations.resize(new_size);
+      num_steps = configurations.size();
+      printf("* Exploring a random subset of %s%zu configuration(s)%s\n",
+             kPrintMessage.c_str(), configurations.size(), kPrintEnd.c_str());
+    }
+  }
+  auto search = CreateSearch(args, configurations, settings.parameters, num_steps);
+
+  // The names of the output files. Results tuned for a specific problem size are stored separately,
+  // such that they can be set as a size-specific parameter set (see 'OverrideParametersForSize'),
+  // as are the results tuned for energy.
+  const auto precision_string = std::to_string(static_cast<size_t>(args.precision));
+  for (auto &problem : problems) {
+    auto file_suffix = (problem.size_bucket != 0) ? "_size" + ToString(problem.size_bucket) :
+                                                    std::string{""};
+    if (tune_energy) { file_suffix += "_energy"; }
+    problem.file_name = "clblast_" + settings.kernel_family + "_" + precision_string + file_suffix;
   }
 
+  // Checkpoints the results of the configurations to disk as they come in, per problem. When
+  // resuming, the configurations of the earlier run are not run again, including those during which
+  // it crashed.
+  for (auto &problem : problems) {
+    const auto checkpoint_file_name = problem.file_name + ".checkpoint";
+    problem.checkpoint = (resume) ? ReadCheckpoint(checkpoint_file_name) : Checkpoint();
+    if (resume) {
+      printf("* Resuming from %s%zu configuration(s)%s in '%s'\n", kPrintMessage.c_str(),
+             problem.checkpoint.size(), kPrintEnd.c_str(), checkpoint_file_name.c_str());
+    }
+  }
+  const auto is_resumed = [&](const std::string &configuration_string) {
+    for (const auto &problem : problems) {
+      if (problem.checkpoint.find(configuration_string) == problem.checkpoint.end()) { return false; }
+    }
+    return true;
+  };
+
   // Prints information about the parameters
   printf("* Parameters explored: ");
   for (const auto& parameter : settings.parameters) { printf("%s ", parameter.first.c_str()); }
   printf("\n");
 
-  // Prints the header of the table
+  // Prints the header of the table. For the energy objective, the performance is shown per joule
+  // (e.g. GFLOP per joule is the same as GFLOPS per watt).
+  const auto performance_unit = (!tune_energy) ? settings.performance_unit :
+                                (settings.performance_unit == "GFLOPS") ? std::string{"GF/J"} :
+                                (settings.performance_unit == "GB/s") ? std::string{"GB/J"} :
+                                (settings.performance_unit == "GOPS") ? std::string{"GOP/J"} :
+                                settings.performance_unit;
+  if (tune_energy) {
+    printf("* Tuning for energy, measuring the power with %s'%s'%s\n",
+           kPrintMessage.c_str(), power_sensor_file.c_str(), kPrintEnd.c_str());
+  }
   printf("\n");
   printf("|   ID | total |");
   for (auto i = size_t{0}; i < settings.parameters.size() - 1; ++i) { printf("     "); }
-  printf("param |       compiles |         time | %6s |            status |\n", settings.performance_unit.c_str());
+  printf("param |       compiles |         time | %6s |            status |\n", performance_unit.c_str());
   print_separator(settings.parameters.size());
 
+  // For multiple problems, the lines of the further ones show their size instead of the compilation
+  const auto print_problem_prefix = [&](const Problem &problem) {
+    printf("|      |     - |");
+    for (auto i = size_t{0}; i < settings.parameters.size(); ++i) { printf("     "); }
+    printf(" |   size %7zu |", problem.size_bucket);
+  };
+
   // First runs a reference example to compare against
-  try {
-    auto queue = Queue(context, device);
-    printf("|  ref |     - |");
-    for (auto i = size_t{0}; i < settings.parameters.size() - 1; ++i) { printf("     "); }
-    printf("    - |");
+  for (auto &problem : problems) {
+    try {
+      auto queue = Queue(context, device);
+      if (&problem == &problems.front()) {
+        printf("|  ref |     - |");
+        for (auto i = size_t{0}; i < settings.parameters.size() - 1; ++i) { printf("     "); }
+        printf("    - |");
+      }
+      else {
+        print_problem_prefix(problem);
+      }
 
+      // Sets the input
+      for (const auto id : problem.settings.inputs) {
+        problem.device_buffers[id].Write(queue, problem.buffer_sizes[id], problem.source_buffers[id]);
+      }
 
-    // Sets the input
-    for (const auto id : settings.inputs) {
-      device_buffers[id].Write(queue, buffer_sizes[id], source_buffers[id]);
+      // Compiles the kernel
+      auto compiler_options = std::vector<std::string>();
+      const auto program = CompileFromSource(settings.sources, args.precision, settings.kernel_name,
+                                             device, context, compiler_options, 0);
+      auto kernel = Kernel(program, settings.kernel_name);
+      SetArguments(V, kernel, problem.args, problem.device_buffers);
+      if (&problem == &problems.front()) {
+        printf("             %sOK%s |", kPrintSuccess.c_str(), kPrintEnd.c_str());
+      }
+
+      // Runs the kernel
+      const auto time_ms = TimeKernel(args.num_runs, kernel, queue, device,
+                                      problem.settings.global_size_ref,
+                                      problem.settings.local_size_ref);
+      printf("      - |");
+      if (time_ms == -1.0) { throw std::runtime_error("Error in reference implementation"); }
+
+      // Saves the result, also on the device in case it is verified there
+      for (const auto id : problem.settings.outputs) {
+        problem.device_buffers[id].Read(queue, problem.buffer_sizes[id], problem.reference_buffers[id]);
+        if (verification == 1) {
+          problem.device_reference_buffers.push_back(Buffer<T>(context, problem.buffer_sizes[id]));
+          problem.device_reference_buffers.back().Write(queue, problem.buffer_sizes[id],
+                                                        problem.reference_buffers[id]);
+        }
+      }
+      printf("      %sreference OK%s |\n", kPrintSuccess.c_str(), kPrintEnd.c_str());
+    }
+    catch (...) {
+      const auto status_code = DispatchExceptionCatchAll(true);
+      printf("* Exception caught with status %d while running the reference, aborting\n",
+             static_cast<int>(status_code));
+      return;
     }
+  }
+  print_separator(settings.parameters.size());
+
+  // The verification of the results: either all outputs are read back and compared with the
+  // reference on the host, or they are compared on the device (see 'verification.opencl') and only
+  // the partial sums of the squared differences are read back. In the latter case, configurations
+  // which are among the 'verify_top' fastest so far are still compared on the host in full.
+  constexpr auto kVerifyWGS = size_t{64};
+  constexpr auto kVerifyGroups = size_t{64};
+  auto verification_kernel = std::unique_ptr<Kernel>();
+  auto partial_sums = std::vector<float>(kVerifyGroups);
+  auto device_partial_sums = Buffer<float>(context, kVerifyGroups);
+  if (verification == 1) {
+    try {
+      const auto verification_source = std::string{
+        #include "tuning/verification.opencl"
+      };
+      auto compiler_options = std::vector<std::string>();
+      const auto program = CompileFromSource(verification_source, args.precision,
+                                             "TunerSquaredDifference", device, context,
+                                             compiler_options, 0);
+      verification_kernel = std::unique_ptr<Kernel>(new Kernel(program, "TunerSquaredDifference"));
+      printf("* Verifying the results on the device, in full for the %s%zu fastest%s so far\n",
+             kPrintMessage.c_str(), verify_top, kPrintEnd.c_str());
+    }
+    catch (...) {
+      const auto status_code = DispatchExceptionCatchAll(true);
+      printf("* Exception caught with status %d while compiling the verification kernel, aborting\n",
+             static_cast<int>(status_code));
+      return;
+    }
+  }
+  const auto device_squared_difference = [&](Queue &queue, const Buffer<T> &result,
+                                             const Buffer<T> &reference, const size_t size) {
+    verification_kernel->SetArgument(0, static_cast<int>(size));
+    verification_kernel->SetArgument(1, result());
+    verification_kernel->SetArgument(2, reference());
+    verification_kernel->SetArgument(3, device_partial_sums());
+    verification_kernel->Launch(queue, {kVerifyWGS * kVerifyGroups}, {kVerifyWGS}, nullptr);
+    device_partial_sums.Read(queue, kVerifyGroups, partial_sums);
+    auto sum = 0.0;
+    for (const auto partial_sum : partial_sums) { sum += static_cast<double>(partial_sum); }
+    return sum;
+  };
 
-    // Compiles the kernel
+  // Compiles the upcoming configurations on a pool of host threads while the device runs the
+  // current one, since for large search spaces most of the tuning time is spent compiling. The
+  // window of configurations compiled ahead is the number of threads. OpenCL API calls are
+  // thread-safe, so the programs are all built in the tuning context. With zero threads, each
+  // configuration is compiled just before it is run, as in a serial tuner. With compile threads,
+  // the guided searches propose configurations before the results of those in flight are known.
+  // With a cache directory (the 'cache_dir' argument or the 'CLBLAST_CACHE_DIR' variable), the
+  // binaries are stored on disk in the format of the library's on-disk cache, keyed by the device,
+  // the driver, and a hash of the kernel source including the parameters. Later tuning runs (e.g.
+  // when resuming or for another size) then load the binaries of the configurations seen before.
+  struct CompiledConfiguration { Program program; double compile_time_ms; bool cached; };
+  const auto compile_configuration = [&](const size_t config_id) -> CompiledConfiguration {
+    auto kernel_source = std::string{""};
+    for (const auto &parameter : configurations[config_id]) {
+      kernel_source += "#define " + parameter.first + " " + ToString(parameter.second) + "\n";
+    }
+    kernel_source += settings.sources;
+    #ifdef CUDA_API
+      CheckError(cuCtxSetCurrent(context())); // the module is loaded into the thread's context
+    #endif
+    const auto start_time = std::chrono::steady_clock::now();
     auto compiler_options = std::vector<std::string>();
-    const auto program = CompileFromSource(settings.sources, args.precision, settings.kernel_name,
-                                           device, context, compiler_options, 0);
-    auto kernel = Kernel(program, settings.kernel_name);
-    SetArguments(V, kernel, args, device_buffers);
-    printf("             %sOK%s |", kPrintSuccess.c_str(), kPrintEnd.c_str());
-
-    // Runs the kernel
-    const auto time_ms = TimeKernel(args.num_runs, kernel, queue, device,
-                                    settings.global_size_ref, settings.local_size_ref);
-    printf("      - |");
-    if (time_ms == -1.0) { throw std::runtime_error("Error in reference implementation"); }
-
-    // Saves the result
-    for (const auto id : settings.outputs) {
-      device_buffers[id].Read(queue, buffer_sizes[id], reference_buffers[id]);
+    const auto fast_math_parameter = configurations[config_id].find("FAST_MATH");
+    if (fast_math_parameter != configurations[config_id].end() && fast_math_parameter->second == 1) {
+      compiler_options.push_back(kFastMathOptions);
+    }
+    auto routine_info = "tuner_" + settings.kernel_name + "_" + ToString(static_cast<size_t>(Hash(kernel_source)));
+    #ifdef CUDA_API
+      routine_info += "_" + GetDeviceArchitecture(device); // cubins are specific to the architecture
+    #endif
+    const auto disk_key = (cache_directory.empty()) ? std::string{""} :
+                          GetBinaryFileKey(device, args.precision, routine_info);
+    auto binary = std::string{""};
+    if (!cache_directory.empty() && LoadBinaryFile(cache_directory, disk_key, binary)) {
+      try {
+        auto program = Program(device, context, binary);
+        program.Build(device, compiler_options);
+        const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+        const auto timing = std::chrono::duration<double,std::milli>(elapsed_time).count();
+        return CompiledConfiguration{program, timing, true};
+      } catch (const CLCudaAPIError &) {
+        log_debug("Failed to load the binary from the on-disk cache, re-compiling");
+      }
+    }
+    const auto program = CompileFromSource(kernel_source, args.precision, settings.kernel_name,
+                                           device, context, compiler_options, 0, true);
+    if (!cache_directory.empty()) { StoreBinaryFile(cache_directory, disk_key, program.GetIR()); }
+    const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+    const auto timing = std::chrono::duration<double,std::milli>(elapsed_time).count();
+    return CompiledConfiguration{program, timing, false};
+  };
+  const auto compile_policy = (compile_threads == 0) ? std::launch::deferred : std::launch::async;
+  const auto compile_window = std::max(compile_threads, size_t{1});
+  auto compilations = std::deque<std::pair<size_t, std::future<CompiledConfiguration>>>();
+  const auto schedule_compilations = [&]() {
+    while (compilations.size() < compile_window && !search->Done()) {
+      const auto config_id = search->Next();
+      if (is_resumed(ConfigurationToString(configurations[config_id]))) {
+        compilations.push_back({config_id, std::future<CompiledConfiguration>()}); // see below
+        continue;
+      }
+      compilations.push_back({config_id, std::async(compile_policy, compile_configuration,
+                                                    config_id)});
     }
-    printf("      %sreference OK%s |\n", kPrintSuccess.c_str(), kPrintEnd.c_str());
+  };
+  if (compile_threads > 0) {
+    printf("* Compiling ahead on %s%zu host thread(s)%s\n",
+           kPrintMessage.c_str(), compile_threads, kPrintEnd.c_str());
   }
-  catch (...) {
-    const auto status_code = DispatchExceptionCatchAll(true);
-    printf("* Exception caught with status %d while running the reference, aborting\n",
-           static_cast<int>(status_code));
-    return;
+  if (!cache_directory.empty()) {
+    printf("* Caching the compiled configurations in '%s'\n", cache_directory.c_str());
   }
-  print_separator(settings.parameters.size());
 
-  // Starts the tuning process
-  auto results = std::vector<TuningResult>();
-  for (auto config_id = size_t{0}; config_id < configurations.size(); ++config_id) {
-    try {
-      auto queue = Queue(context, device);
+  // Opens the checkpoint files, appending to them when resuming
+  for (auto &problem : problems) {
+    const auto checkpoint_file_name = problem.file_name + ".checkpoint";
+    problem.checkpoint_file = fopen(checkpoint_file_name.c_str(), (resume) ? "a" : "w");
+    if (problem.checkpoint_file == nullptr) {
+      printf("* Unable to write checkpoints to '%s'\n", checkpoint_file_name.c_str());
+    }
+  }
 
-      auto configuration = configurations[config_id];
-      printf("| %4zu | %5zu |", config_id + 1, configurations.size());
-      for (const auto& parameter : settings.parameters) {
-        printf("%5zu", configuration.at(parameter.first));
+  // Runs a compiled configuration for a single problem, or takes its result from the checkpoint of
+  // an earlier run. Configurations with a first run several times slower than the best so far are
+  // pruned: they are not run further nor verified (see the 'prune_factor' argument). Returns the
+  // score to report to the search method (the time or the energy), negative if invalid.
+  const auto run_problem = [&](Problem &problem, Kernel* kernel, Configuration configuration,
+                               const std::string &configuration_string) -> double {
+    auto score = -1.0;
+
+    // The configuration was already handled by an earlier run, its result is taken from there
+    const auto resumed = problem.checkpoint.find(configuration_string);
+    if (resumed != problem.checkpoint.end()) {
+      const auto &entry = resumed->second;
+      if (entry.status == "ok") {
+        score = entry.time_ms;
+        if (!tune_energy && (problem.best_time_so_far == 0.0 || score < problem.best_time_so_far)) {
+          problem.best_time_so_far = score;
+        }
+        configuration["PRECISION"] = static_cast<size_t>(args.precision);
+        problem.results.push_back(TuningResult{settings.kernel_name, score, configuration});
+        printf(" %9.2lf %s |", score, score_unit.c_str());
+        printf(" %6.1lf |", problem.settings.metric_amount / (score * 1.0e6));
+        printf("     %sresults match%s |\n", kPrintSuccess.c_str(), kPrintEnd.c_str());
+      }
+      else if (entry.status == "pruned") {
+        score = entry.time_ms;
+        printf(" %9.2lf %s |      - |", score, score_unit.c_str());
+        printf("     %spruned (slow)%s |", kPrintError.c_str(), kPrintEnd.c_str());
+        printf(" <-- skipping\n");
+      }
+      else {
+        const auto crashed = (entry.status == "started");
+        printf("            - |      - |");
+        printf("   %s%s%s |", kPrintError.c_str(),
+               (crashed) ? "crashed earlier" : "invalid config.", kPrintEnd.c_str());
+        printf(" <-- skipping\n");
       }
-      printf(" |");
+      return score;
+    }
+
+    auto record = std::string{"invalid"}; // the status written to the checkpoint file
+    try {
+      auto queue = Queue(context, device);
 
       // Sets the input
-      for (const auto id : settings.inputs) {
-        device_buffers[id].Write(queue, buffer_sizes[id], source_buffers[id]);
+      for (const auto id : problem.settings.inputs) {
+        problem.device_buffers[id].Write(queue, problem.buffer_sizes[id], problem.source_buffers[id]);
       }
 
       // Sets the thread configuration
-      const auto global = SetThreadConfiguration(configuration, settings.global_size,
-                                                 settings.mul_global, settings.div_global);
-      const auto local = SetThreadConfiguration(configuration, settings.local_size,
-                                                settings.mul_local, settings.div_local);
-
-      // Sets the parameters for this configuration
-      auto kernel_source = std::string{""};
-      for (const auto &parameter : configuration) {
-        kernel_source += "#define " + parameter.first + " " + ToString(parameter.second) + "\n";
-      }
-      kernel_source += settings.sources;
-
-      // Compiles the kernel
-      const auto start_time = std::chrono::steady_clock::now();
-      auto compiler_options = std::vector<std::string>();
-      const auto program = CompileFromSource(kernel_source, args.precision, settings.kernel_name,
-                                             device, context, compiler_options, 0, true);
-      auto kernel = Kernel(program, settings.kernel_name);
-      const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
-      const auto timing = std::chrono::duration<double,std::milli>(elapsed_time).count();
-      printf("   %sOK%s  %5.0lf ms |", kPrintSuccess.c_str(), kPrintEnd.c_str(), timing);
-
-      // Runs the kernel
-      SetArguments(V, kernel, args, device_buffers);
-      const auto time_ms = TimeKernel(args.num_runs, kernel, queue, device, global, local);
+      const auto global = SetThreadConfiguration(configuration, problem.settings.global_size,
+                                                 problem.settings.mul_global,
+                                                 problem.settings.div_global);
+      const auto local = SetThreadConfiguration(configuration, problem.settings.local_size,
+                                                problem.settings.mul_local,
+                                                problem.settings.div_local);
+
+      // Runs the kernel, first once in case it can be pruned. If the run crashes or hangs, the
+      // configuration is skipped when resuming. For the energy objective, the power is measured
+      // during the runs which give the time.
+      SetArguments(V, *kernel, problem.args, problem.device_buffers);
+      AppendCheckpoint(problem.checkpoint_file, "started", 0.0, configuration_string);
+      const auto best_time_so_far = problem.best_time_so_far;
+      if (tune_energy) { power_sensor->Start(); }
+      const auto first_time_ms = (prune_factor > 0.0 && best_time_so_far > 0.0) ?
+                                 TimeKernel(1, *kernel, queue, device, global, local, true) : -1.0;
+      const auto pruned = (first_time_ms > prune_factor * best_time_so_far);
+      if (tune_energy && !pruned) { power_sensor->Start(); }
+      const auto time_ms = (pruned) ? first_time_ms :
+                           TimeKernel(args.num_runs, *kernel, queue, device, global, local);
+      const auto power_watts = (tune_energy) ? power_sensor->Stop() : -1.0;
+      const auto objective_score = (!tune_energy) ? time_ms :
+                                   (time_ms != -1.0 && power_watts >= 0.0) ? power_watts * time_ms :
+                                   -1.0;
 
       // Kernel run was not successful
       if (time_ms == -1.0) {
         printf("      - |");
         printf("   %sinvalid config.%s |", kPrintError.c_str(), kPrintEnd.c_str());
         printf(" <-- skipping\n");
-        continue;
+      }
+
+      // The power could not be measured
+      else if (objective_score < 0.0) {
+        printf("      - |");
+        printf("  %spower unreadable%s |", kPrintError.c_str(), kPrintEnd.c_str());
+        printf(" <-- skipping\n");
+      }
+
+      // Kernel run was much slower than the best so far
+      else if (pruned) {
+        score = objective_score;
+        record = "pruned";
+        printf(" %9.2lf ms |", time_ms);
+        printf("      - |");
+        printf("     %spruned (slow)%s |", kPrintError.c_str(), kPrintEnd.c_str());
+        printf(" <-- skipping\n");
       }
 
       // Compares the results
-      auto l2_error = 0.0;
-      for (const auto id : settings.outputs) {
-        device_buffers[id].Read(queue, buffer_sizes[id], result_buffers[id]);
-        for (auto index = size_t{0}; index<buffer_sizes[id]; ++index) {
-          const auto diff = SquaredDifference(result_buffers[id][index], reference_buffers[id][index]);
-          l2_error += diff;
+      else {
+        auto num_faster_results = size_t{0};
+        for (const auto &result : problem.results) {
+          if (result.score < objective_score) { num_faster_results++; }
         }
-        l2_error /= static_cast<double>(buffer_sizes[id]);
-        if (std::isnan(l2_error) || l2_error > max_l2_norm) {
-          printf("      - |");
-          printf(" %sL2 error %8.2e%s |", kPrintError.c_str(), l2_error, kPrintEnd.c_str());
-          throw std::runtime_error("L2 error too large");
+        const auto verify_on_device = (verification == 1 && num_faster_results >= verify_top);
+        auto l2_error = 0.0;
+        for (auto output = size_t{0}; output < problem.settings.outputs.size(); ++output) {
+          const auto id = problem.settings.outputs[output];
+          const auto buffer_size = problem.buffer_sizes[id];
+          if (verify_on_device) {
+            l2_error += device_squared_difference(queue, problem.device_buffers[id],
+                                                  problem.device_reference_buffers[output],
+                                                  buffer_size);
+          }
+          else {
+            problem.device_buffers[id].Read(queue, buffer_size, problem.result_buffers[id]);
+            for (auto index = size_t{0}; index<buffer_size; ++index) {
+              const auto diff = SquaredDifference(problem.result_buffers[id][index],
+                                                  problem.reference_buffers[id][index]);
+              l2_error += diff;
+            }
+          }
+          l2_error /= static_cast<double>(buffer_size);
+          if (std::isnan(l2_error) || l2_error > max_l2_norm) {
+            printf("      - |");
+            printf(" %sL2 error %8.2e%s |", kPrintError.c_str(), l2_error, kPrintEnd.c_str());
+            throw std::runtime_error("L2 error too large");
+          }
         }
-      }
 
-      // All was OK
-      configuration["PRECISION"] = static_cast<size_t>(args.precision);
-      results.push_back(TuningResult{settings.kernel_name, time_ms, configuration});
-      printf(" %6.1lf |", settings.metric_amount / (time_ms * 1.0e6));
-      printf("     %sresults match%s |\n", kPrintSuccess.c_str(), kPrintEnd.c_str());
-    }
-    catch (CLCudaAPIBuildError) {
-      const auto status_code = DispatchExceptionCatchAll(true);
-      printf("  %scompilation error: %5d%s     |",
-             kPrintError.c_str(), static_cast<int>(status_code), kPrintEnd.c_str());
-      printf("      - |                 - | <-- skipping\n");
+        // All was OK
+        score = objective_score;
+        record = "ok";
+        if (best_time_so_far == 0.0 || time_ms < best_time_so_far) {
+          problem.best_time_so_far = time_ms;
+        }
+        configuration["PRECISION"] = static_cast<size_t>(args.precision);
+        problem.results.push_back(TuningResult{settings.kernel_name, score, configuration});
+        printf(" %6.1lf |", problem.settings.metric_amount / (score * 1.0e6));
+        printf("     %sresults match%s |\n", kPrintSuccess.c_str(), kPrintEnd.c_str());
+      }
     }
     catch (...) {
       const auto status_code = DispatchExceptionCatchAll(true);
@@ -329,53 +733,137 @@ void Tuner(int argc, char* argv[], const int V,
       }
       printf(" <-- skipping\n");
     }
+    AppendCheckpoint(problem.checkpoint_file, record, score, configuration_string);
+    return score;
+  };
+
+  // Starts the tuning process, compiling each configuration once and running it for all problems
+  schedule_compilations();
+  for (auto step = size_t{0}; step < num_steps; ++step) {
+    const auto config_id = compilations.front().first;
+    auto compilation = std::move(compilations.front().second);
+    compilations.pop_front();
+    if (compile_threads > 0) { schedule_compilations(); }
+    auto score = -1.0; // the time of the first problem reported to the search method
+
+    const auto configuration = configurations[config_id];
+    const auto configuration_string = ConfigurationToString(configuration);
+    printf("| %4zu | %5zu |", step + 1, num_steps);
+    for (const auto& parameter : settings.parameters) {
+      printf("%5zu", configuration.at(parameter.first));
+    }
+    printf(" |");
+
+    // Retrieves the compiled kernel for this configuration, unless all problems were handled by an
+    // earlier run
+    auto kernel = std::unique_ptr<Kernel>();
+    if (!compilation.valid()) {
+      printf("        resumed |");
+    }
+    else {
+      try {
+        const auto compiled = compilation.get(); // re-throws any compilation error
+        kernel = std::unique_ptr<Kernel>(new Kernel(compiled.program, settings.kernel_name));
+        if (compiled.cached) {
+          printf("   %sOK%s    cached |", kPrintSuccess.c_str(), kPrintEnd.c_str());
+        }
+        else {
+          printf("   %sOK%s  %5.0lf ms |", kPrintSuccess.c_str(), kPrintEnd.c_str(),
+                 compiled.compile_time_ms);
+        }
+      }
+      catch (CLCudaAPIBuildError) {
+        const auto status_code = DispatchExceptionCatchAll(true);
+        printf("  %scompilation error: %5d%s     |",
+               kPrintError.c_str(), static_cast<int>(status_code), kPrintEnd.c_str());
+        printf("      - |                 - | <-- skipping\n");
+      }
+      catch (...) {
+        const auto status_code = DispatchExceptionCatchAll(true);
+        if (status_code != StatusCode::kUnknownError) {
+          printf("   %serror code %d%s |",
+                 kPrintError.c_str(), static_cast<int>(status_code), kPrintEnd.c_str());
+        }
+        printf(" <-- skipping\n");
+      }
+      if (kernel == nullptr) {
+        for (auto &problem : problems) {
+          if (problem.checkpoint.find(configuration_string) != problem.checkpoint.end()) { continue; }
+          AppendCheckpoint(problem.checkpoint_file, "invalid", -1.0, configuration_string);
+        }
+        search->Report(config_id, score);
+        schedule_compilations();
+        continue;
+      }
+    }
+
+    // Runs the configuration for all problems
+    for (auto &problem : problems) {
+      if (&problem != &problems.front()) { print_problem_prefix(problem); }
+      const auto problem_score = run_problem(problem, kernel.get(), configuration,
+                                             configuration_string);
+      if (&problem == &problems.front()) { score = problem_score; }
+    }
+    search->Report(config_id, score);
+    schedule_compilations();
+  }
+  for (auto &problem : problems) {
+    if (problem.checkpoint_file != nullptr) { fclose(problem.checkpoint_file); }
   }
 
   // Completed the tuning process
   print_separator(settings.parameters.size());
   printf("\n");
-  if (results.size() == 0) { return; }
-
-  // Computes the best results
-  auto comparison = [](const TuningResult& lhs, const TuningResult& rhs) { return lhs.score < rhs.score; };
-  const auto best_configuration = std::min_element(results.begin(), results.end(), comparison);
-  const auto best_time_ms = best_configuration->score;
-  if (best_time_ms == 0.0) { return; }
 
-  // Also prints the performance of the best-case in terms of GB/s or GFLOPS
-  printf("\n");
-  printf("* Found best result %.2lf ms", best_time_ms);
-  printf(": %.1lf %s\n", settings.metric_amount / (best_time_ms * 1.0e6),
-         settings.performance_unit.c_str());
-  printf("* Best parameters: ");
-  auto best_string = std::string{""};
-  auto i = size_t{0};
-  for (const auto config : best_configuration->config) {
-    best_string += "" + config.first + "=" + ToString(config.second);
-    if (i < best_configuration->config.size() - 1) { best_string += " "; }
-    ++i;
-  }
-  printf("%s\n\n", best_string.c_str());
-
-  // Outputs the results as JSON to disk, including some meta-data
-  auto precision_string = std::to_string(static_cast<size_t>(args.precision));
-  auto metadata = std::vector<std::pair<std::string,std::string>>{
-    {"kernel_family", settings.kernel_family},
-    {"precision", precision_string},
-    {"best_kernel", best_configuration->name},
-    {"best_time", ToString(best_configuration->score)},
-    {"best_parameters", best_string}
-  };
-  for (auto &o: defaults.options) {
-    if (o == kArgM)     { metadata.push_back({"arg_m", ToString(args.m)}); }
-    if (o == kArgN)     { metadata.push_back({"arg_n", ToString(args.n)}); }
-    if (o == kArgK)     { metadata.push_back({"arg_k", ToString(args.k)}); }
-    if (o == kArgAlpha) { metadata.push_back({"arg_alpha", ToString(args.alpha)}); }
-    if (o == kArgBeta)  { metadata.push_back({"arg_beta", ToString(args.beta)}); }
-    if (o == kArgBatchCount) { metadata.push_back({"arg_batch_count", ToString(args.batch_count)}); }
+  // Computes the best results and stores them per problem
+  for (const auto &problem : problems) {
+    const auto &results = problem.results;
+    if (results.size() == 0) { continue; }
+    auto comparison = [](const TuningResult& lhs, const TuningResult& rhs) { return lhs.score < rhs.score; };
+    const auto best_configuration = std::min_element(results.begin(), results.end(), comparison);
+    const auto best_time_ms = best_configuration->score;
+    if (best_time_ms == 0.0) { continue; }
+
+    // Also prints the performance of the best-case in terms of GB/s or GFLOPS
+    printf("\n");
+    if (problems.size() > 1) { printf("* For size %zu:\n", problem.size_bucket); }
+    printf("* Found best result %.2lf %s", best_time_ms, score_unit.c_str());
+    printf(": %.1lf %s\n", problem.settings.metric_amount / (best_time_ms * 1.0e6),
+           performance_unit.c_str());
+    printf("* Best parameters: ");
+    const auto best_string = ConfigurationToString(best_configuration->config);
+    printf("%s\n\n", best_string.c_str());
+
+    // Outputs the results as JSON to disk, including some meta-data
+    auto metadata = std::vector<std::pair<std::string,std::string>>{
+      {"kernel_family", settings.kernel_family},
+      {"precision", precision_string},
+      {"best_kernel", best_configuration->name},
+      {"best_time", ToString(best_configuration->score)},
+      {"best_parameters", best_string}
+    };
+
+    if (problem.size_bucket != 0) {
+      metadata.insert(metadata.begin() + 1, {"size_bucket", ToString(problem.size_bucket)});
+    }
+    if (tune_energy) { metadata.insert(metadata.begin() + 1, {"objective", objective}); }
+    const auto &problem_args = problem.args;
+    for (auto &o: defaults.options) {
+      if (o == kArgM)     { metadata.push_back({"arg_m", ToString(problem_args.m)}); }
+      if (o == kArgN)     { metadata.push_back({"arg_n", ToString(problem_args.n)}); }
+      if (o == kArgK)     { metadata.push_back({"arg_k", ToString(problem_args.k)}); }
+      if (o == kArgAlpha) { metadata.push_back({"arg_alpha", ToString(problem_args.alpha)}); }
+      if (o == kArgBeta)  { metadata.push_back({"arg_beta", ToString(problem_args.beta)}); }
+      if (o == kArgBatchCount) { metadata.push_back({"arg_batch_count", ToString(problem_args.batch_count)}); }
+      if (o == kArgChannels) { metadata.push_back({"arg_channels", ToString(problem_args.channels)}); }
+      if (o == kArgHeight)   { metadata.push_back({"arg_height", ToString(problem_args.height)}); }
+      if (o == kArgWidth)    { metadata.push_back({"arg_width", ToString(problem_args.width)}); }
+      if (o == kArgKernelH)  { metadata.push_back({"arg_kernel_h", ToString(problem_args.kernel_h)}); }
+      if (o == kArgKernelW)  { metadata.push_back({"arg_kernel_w", ToString(problem_args.kernel_w)}); }
+      if (o == kArgNumKernels) { metadata.push_back({"arg_num_kernels", ToString(problem_args.num_kernels)}); }
+    }
+    PrintTimingsToFileAsJSON(problem.file_name + ".json", device, platform, metadata, results);
   }
-  PrintTimingsToFileAsJSON("clblast_" + settings.kernel_family + "_" + precision_string + ".json",
-                           device, platform, metadata, results);
 
   printf("* Completed tuning process\n");
   printf("\n");
@@ -387,6 +875,8 @@ template void Tuner<float>(int argc, char* argv[], const int V, GetTunerDefaults
 template void Tuner<double>(int argc, char* argv[], const int V, GetTunerDefaultsFunc GetTunerDefaults, GetTunerSettingsFunc<double> GetTunerSettings, TestValidArgumentsFunc<double> TestValidArguments, SetConstraintsFunc SetConstraints, ComputeLocalMemSizeFunc<double> ComputeLocalMemSize, SetArgumentsFunc<double> SetArguments);
 template void Tuner<float2>(int argc, char* argv[], const int V, GetTunerDefaultsFunc GetTunerDefaults, GetTunerSettingsFunc<float2> GetTunerSettings, TestValidArgumentsFunc<float2> TestValidArguments, SetConstraintsFunc SetConstraints, ComputeLocalMemSizeFunc<float2> ComputeLocalMemSize, SetArgumentsFunc<float2> SetArguments);
 template void Tuner<double2>(int argc, char* argv[], const int V, GetTunerDefaultsFunc GetTunerDefaults, GetTunerSettingsFunc<double2> GetTunerSettings, TestValidArgumentsFunc<double2> TestValidArguments, SetConstraintsFunc SetConstraints, ComputeLocalMemSizeFunc<double2> ComputeLocalMemSize, SetArgumentsFunc<double2> SetArguments);
+template void Tuner<bfloat16>(int argc, char* argv[], const int V, GetTunerDefaultsFunc GetTunerDefaults, GetTunerSettingsFunc<bfloat16> GetTunerSettings, TestValidArgumentsFunc<bfloat16> TestValidArguments, SetConstraintsFunc SetConstraints, ComputeLocalMemSizeFunc<bfloat16> ComputeLocalMemSize, SetArgumentsFunc<bfloat16> SetArguments);
+template void Tuner<int8>(int argc, char* argv[], const int V, GetTunerDefaultsFunc GetTunerDefaults, GetTunerSettingsFunc<int8> GetTunerSettings, TestValidArgumentsFunc<int8> TestValidArguments, SetConstraintsFunc SetConstraints, ComputeLocalMemSizeFunc<int8> ComputeLocalMemSize, SetArgumentsFunc<int8> SetArguments);
 
 // =================================================================================================
 } // namespace clblast
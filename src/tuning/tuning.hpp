@@ -22,6 +22,9 @@
 #include <algorithm>
 #include <chrono>
 #include <functional>
+#include <unordered_map>
+#include <atomic>
+#include <cstdio>
 
 #include "utilities/utilities.hpp"
 #include "utilities/compile.hpp"
@@ -42,6 +45,14 @@ struct TunerDefaults {
   size_t default_n = 1;
   size_t default_k = 1;
 
+  // Default convolution sizes
+  size_t default_channels = 1;
+  size_t default_height = 1;
+  size_t default_width = 1;
+  size_t default_kernel_h = 3;
+  size_t default_kernel_w = 3;
+  size_t default_num_kernels = 1;
+
   // Other defaults
   size_t default_batch_count = 1;
   size_t default_num_runs = 10; // run every kernel this many times for averaging
@@ -68,6 +79,10 @@ struct TunerSettings {
   std::vector<size_t> inputs = {};
   std::vector<size_t> outputs = {};
 
+  // Optionally overwrites the random contents of a buffer, given its ID, host data, and size in
+  // bytes. This is used for non-floating-point inputs, e.g. the indices of a sparse matrix.
+  std::function<void(const size_t id, void* data, const size_t bytes)> initialize_buffer;
+
   // Sets the base thread configuration
   std::vector<size_t> global_size = {};
   std::vector<size_t> global_size_ref = {};
@@ -99,6 +114,19 @@ void PrintTimingsToFileAsJSON(const std::string &filename,
 
 void print_separator(const size_t parameters_size);
 
+// Converts a configuration into a string of the form "NAME1=VALUE1 NAME2=VALUE2"
+std::string ConfigurationToString(const Configuration &configuration);
+
+// Checkpoints of a tuning run, such that an interrupted run can be resumed (see the 'resume' tuner
+// argument). A line is appended to the file just before a configuration runs ("started") and one
+// once it is done ("ok", "pruned", or "invalid"), each immediately flushed to disk. When reading,
+// the last line of each configuration counts: one which was only started has crashed or hung.
+struct CheckpointEntry { std::string status; double time_ms; };
+using Checkpoint = std::unordered_map<std::string, CheckpointEntry>;
+Checkpoint ReadCheckpoint(const std::string &filename);
+void AppendCheckpoint(FILE* file, const std::string &status, const double time_ms,
+                      const std::string &configuration);
+
 // =================================================================================================
 
 using GetTunerDefaultsFunc = std::function<TunerDefaults(const int V)>;
@@ -124,7 +152,10 @@ void Tuner(int argc, char* argv[], const int V,
            ComputeLocalMemSizeFunc<T> ComputeLocalMemSize,
            SetArgumentsFunc<T> SetArguments);
 
-// Function to run the tuners through the CLBlast API, no I/O
+// Function to run the tuners through the CLBlast API, no I/O. Optionally returns the time of the
+// best configuration, and stops early (with an error) once the 'cancelled' flag is set. With a
+// positive time budget (in ms), the configurations closest to the current database parameters are
+// tried first and the best configuration found is returned once the budget is spent.
 template <typename T>
 StatusCode TunerAPI(Queue &queue, const Arguments<T> &args, const int V,
                     const GetTunerDefaultsFunc GetTunerDefaults,
@@ -133,7 +164,10 @@ StatusCode TunerAPI(Queue &queue, const Arguments<T> &args, const int V,
                     const SetConstraintsFunc SetConstraints,
                     const ComputeLocalMemSizeFunc<T> ComputeLocalMemSize,
                     const SetArgumentsFunc<T> SetArguments,
-                    std::unordered_map<std::string,size_t> &parameters);
+                    std::unordered_map<std::string,size_t> &parameters,
+                    double* best_time_ms = nullptr,
+                    const std::atomic<bool>* cancelled = nullptr,
+                    const double time_budget_ms = 0.0);
 
 // =================================================================================================
 } // namespace clblast
@@ -15,50 +15,115 @@
 #ifndef CLBLAST_BUFFER_TEST_H_
 #define CLBLAST_BUFFER_TEST_H_
 
+#include <limits>
+
 #include "utilities/utilities.hpp"
+#include "cache.hpp"
+#ifdef OPENCL_API
+  #include "explanation.hpp"
+#endif
 
 namespace clblast {
 // =================================================================================================
 
+// Retrieves the size in bytes of a buffer. With OpenCL the sizes are cached (see 'BufferSizeCache'),
+// such that the checks below don't add a call to the runtime per buffer to every routine call. The
+// null buffers of an explained call (see 'ExplainGemm') are considered large enough.
+template <typename T>
+size_t GetBufferSize(const Buffer<T> &buffer) {
+  #ifdef OPENCL_API
+    if (buffer() == nullptr && ExplanationScope::Current() != nullptr) {
+      return std::numeric_limits<size_t>::max();
+    }
+    return GetCachedBufferSize(buffer());
+  #else
+    return GetBufferSize(buffer);
+  #endif
+}
+
+
+// Tests whether the extent of a matrix or vector (in elements, including the offset) fits in the
+// 32-bit indices of the kernels. Only GEMM and AXPY have kernel variants with 64-bit indices (see
+// 'RequiresIndex64'), all other routines reject larger buffers instead of truncating the indices.
+inline void TestIndex32(const size_t extent, const bool index64) {
+  if (!index64 && extent > static_cast<size_t>(std::numeric_limits<int>::max())) {
+    throw BLASError(StatusCode::kInvalidValue, "matrix or vector requires 64-bit indices");
+  }
+}
+
 // Tests matrix 'A' for validity
 template <typename T>
 void TestMatrixA(const size_t one, const size_t two, const Buffer<T> &buffer,
-                 const size_t offset, const size_t ld, const bool test_lead_dim = true) {
+                 const size_t offset, const size_t ld, const bool test_lead_dim = true,
+                 const bool index64 = false) {
   if (test_lead_dim && ld < one) { throw BLASError(StatusCode::kInvalidLeadDimA); }
+  TestIndex32(ld * (two - 1) + one + offset, index64);
   try {
     const auto required_size = (ld * (two - 1) + one + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryA); }
+    if (GetBufferSize(buffer) < required_size) { throw BLASError(StatusCode::kInsufficientMemoryA); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidMatrixA, e.what()); }
 }
 
 // Tests matrix 'B' for validity
 template <typename T>
 void TestMatrixB(const size_t one, const size_t two, const Buffer<T> &buffer,
-                 const size_t offset, const size_t ld, const bool test_lead_dim = true) {
+                 const size_t offset, const size_t ld, const bool test_lead_dim = true,
+                 const bool index64 = false) {
   if (test_lead_dim && ld < one) { throw BLASError(StatusCode::kInvalidLeadDimB); }
+  TestIndex32(ld * (two - 1) + one + offset, index64);
   try {
     const auto required_size = (ld * (two - 1) + one + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryB); }
+    if (GetBufferSize(buffer) < required_size) { throw BLASError(StatusCode::kInsufficientMemoryB); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidMatrixB, e.what()); }
 }
 
 // Tests matrix 'C' for validity
 template <typename T>
 void TestMatrixC(const size_t one, const size_t two, const Buffer<T> &buffer,
-                 const size_t offset, const size_t ld) {
+                 const size_t offset, const size_t ld, const bool index64 = false) {
   if (ld < one) { throw BLASError(StatusCode::kInvalidLeadDimC); }
+  TestIndex32(ld * (two - 1) + one + offset, index64);
   try {
     const auto required_size = (ld * (two - 1) + one + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryC); }
+    if (GetBufferSize(buffer) < required_size) { throw BLASError(StatusCode::kInsufficientMemoryC); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidMatrixC, e.what()); }
 }
 
 // Tests matrix 'AP' for validity
 template <typename T>
 void TestMatrixAP(const size_t n, const Buffer<T> &buffer, const size_t offset) {
+  TestIndex32((n * (n + 1)) / 2 + offset, false);
   try {
     const auto required_size = (((n * (n + 1)) / 2) + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryA); }
+    if (GetBufferSize(buffer) < required_size) { throw BLASError(StatusCode::kInsufficientMemoryA); }
+  } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidMatrixA, e.what()); }
+}
+
+// Tests sparse matrix 'A' in CSR format for validity: the 'm+1' row pointers, and the column
+// indices and the values of the 'nnz' non-zeros
+template <typename T>
+void TestMatrixCSR(const size_t m, const size_t nnz, const Buffer<int> &row_ptr_buffer,
+                   const Buffer<int> &col_idx_buffer, const Buffer<T> &values_buffer) {
+  try {
+    if ((GetBufferSize(row_ptr_buffer) < (m + 1) * sizeof(int)) ||
+        (GetBufferSize(col_idx_buffer) < nnz * sizeof(int)) ||
+        (GetBufferSize(values_buffer) < nnz * sizeof(T))) {
+      throw BLASError(StatusCode::kInsufficientMemoryA);
+    }
+  } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidMatrixA, e.what()); }
+}
+
+// Tests quantised matrix 'A' for validity: the 'num_words' packed words of the weights and the
+// 'num_scales' scales of the groups of weights
+template <typename T>
+void TestMatrixQuantized(const size_t num_words, const Buffer<unsigned int> &q_buffer,
+                         const size_t q_offset, const size_t num_scales,
+                         const Buffer<T> &scales_buffer, const size_t scales_offset) {
+  try {
+    if ((GetBufferSize(q_buffer) < (num_words + q_offset) * sizeof(unsigned int)) ||
+        (GetBufferSize(scales_buffer) < (num_scales + scales_offset) * sizeof(T))) {
+      throw BLASError(StatusCode::kInsufficientMemoryA);
+    }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidMatrixA, e.what()); }
 }
 
@@ -66,21 +131,25 @@ void TestMatrixAP(const size_t n, const Buffer<T> &buffer, const size_t offset)
 
 // Tests vector 'X' for validity
 template <typename T>
-void TestVectorX(const size_t n, const Buffer<T> &buffer, const size_t offset, const size_t inc) {
+void TestVectorX(const size_t n, const Buffer<T> &buffer, const size_t offset, const size_t inc,
+                 const bool index64 = false) {
   if (inc == 0) { throw BLASError(StatusCode::kInvalidIncrementX); }
+  TestIndex32((n - 1) * inc + 1 + offset, index64);
   try {
     const auto required_size = ((n - 1) * inc + 1 + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryX); }
+    if (GetBufferSize(buffer) < required_size) { throw BLASError(StatusCode::kInsufficientMemoryX); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidVectorX, e.what()); }
 }
 
 // Tests vector 'Y' for validity
 template <typename T>
-void TestVectorY(const size_t n, const Buffer<T> &buffer, const size_t offset, const size_t inc) {
+void TestVectorY(const size_t n, const Buffer<T> &buffer, const size_t offset, const size_t inc,
+                 const bool index64 = false) {
   if (inc == 0) { throw BLASError(StatusCode::kInvalidIncrementY); }
+  TestIndex32((n - 1) * inc + 1 + offset, index64);
   try {
     const auto required_size = ((n - 1) * inc + 1 + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryY); }
+    if (GetBufferSize(buffer) < required_size) { throw BLASError(StatusCode::kInsufficientMemoryY); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidVectorY, e.what()); }
 }
 
@@ -91,7 +160,7 @@ template <typename T>
 void TestVectorScalar(const size_t n, const Buffer<T> &buffer, const size_t offset) {
   try {
     const auto required_size = (n + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryScalar); }
+    if (GetBufferSize(buffer) < required_size) { throw BLASError(StatusCode::kInsufficientMemoryScalar); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidVectorScalar, e.what()); }
 }
 
@@ -100,10 +169,19 @@ template <typename T>
 void TestVectorIndex(const size_t n, const Buffer<T> &buffer, const size_t offset) {
   try {
     const auto required_size = (n + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryScalar); }
+    if (GetBufferSize(buffer) < required_size) { throw BLASError(StatusCode::kInsufficientMemoryScalar); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidVectorScalar, e.what()); }
 }
 
+// Tests an array of per-batch values on the device (e.g. scalars or offsets) for validity
+template <typename T>
+void TestBatchArray(const size_t batch_count, const Buffer<T> &buffer) {
+  try {
+    const auto required_size = batch_count * sizeof(T);
+    if (GetBufferSize(buffer) < required_size) { throw BLASError(StatusCode::kInvalidBatchCount); }
+  } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidBatchCount, e.what()); }
+}
+
 // =================================================================================================
 } // namespace clblast
 
@@ -12,7 +12,15 @@
 // =================================================================================================
 
 #include <vector>
+#include <string>
 #include <chrono>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <algorithm>
 
 #include "routines/common.hpp"
 #include "kernel_preprocessor.hpp"
@@ -26,7 +34,7 @@ Program CompileFromSource(const std::string &source_string, const Precision prec
                           const Device& device, const Context& context,
                           std::vector<std::string>& options,
                           const size_t run_preprocessor, // 0: platform dependent, 1: always, 2: never
-                          const bool silent) {
+                          const bool silent, CompilationTimes* times) {
   auto header_string = std::string{""};
 
   header_string += "#define PRECISION " + ToString(static_cast<int>(precision)) + "\n";
@@ -41,12 +49,16 @@ Program CompileFromSource(const std::string &source_string, const Precision prec
   }
 
   // For specific devices, use the non-IEE754 compliant OpenCL mad() instruction. This can improve
-  // performance, but might result in a reduced accuracy.
-  if (device.IsAMD() && device.IsGPU()) {
+  // performance, but might result in a reduced accuracy. This is also done in the fast math mode.
+  const auto fast_math = std::any_of(options.begin(), options.end(), [](const std::string &option) {
+    return option.find(kFastMathOptions) != std::string::npos;
+  });
+  if ((device.IsAMD() && device.IsGPU()) || fast_math) {
     header_string += "#define USE_CL_MAD 1\n";
   }
 
-  // For specific devices, use staggered/shuffled workgroup indices.
+  // For specific devices, use staggered/shuffled workgroup indices. The GEMM kernels can instead be
+  // tuned to use grouped indices (see 'GetGroupIDGrouped0').
   if (device.IsAMD() && device.IsGPU()) {
     header_string += "#define USE_STAGGERED_INDICES 1\n";
   }
@@ -57,16 +69,36 @@ Program CompileFromSource(const std::string &source_string, const Precision prec
     header_string += "#define GLOBAL_MEM_FENCE 1\n";
   }
 
-  // For Intel GPUs with subgroup support, use subgroup shuffling.
+  // For GPUs with subgroup support, use subgroup shuffling in the GEMM kernel and subgroup
+  // reductions in the reduction kernels. Intel's extension (with subgroups of 8) takes precedence
+  // over the Khronos ones, for which the subgroup size is queried through the vendor extensions.
   if (device.IsGPU() && device.HasExtension(kKhronosIntelSubgroups)) {
     header_string += "#define USE_SUBGROUP_SHUFFLING 1\n";
+    header_string += "#define USE_SUBGROUP_REDUCTIONS 1\n";
+  }
+  else if (device.IsGPU() && device.HasExtension(kKhronosSubgroups)) {
+    header_string += "#define USE_SUBGROUP_REDUCTIONS 2\n";
+    const auto subgroup_size = device.SubgroupSize();
+    if (device.HasExtension(kKhronosSubgroupShuffle) && subgroup_size != 0) {
+      header_string += "#define USE_SUBGROUP_SHUFFLING 2\n";
+      header_string += "#define SUBGROUP_SIZE " + ToString(subgroup_size) + "\n";
+    }
   }
 
-  // Optionally adds a translation header from OpenCL kernels to CUDA kernels
+  // For devices with integer dot-product support, use the dot_acc_sat() built-in in the int8 GEMM
+  if (device.HasExtension(kKhronosIntegerDotProduct)) {
+    header_string += "#define USE_INTEGER_DOT_PRODUCT 1\n";
+  }
+
+  // Optionally adds a translation header from OpenCL kernels to CUDA kernels. This includes the
+  // half-precision header of CUDA, which NVRTC finds in the CUDA installation used for the build.
   #ifdef CUDA_API
     header_string +=
       #include "kernels/opencl_to_cuda.h"
     ;
+    #ifdef CUDA_INCLUDE_DIR
+      options.push_back("--include-path=" CUDA_INCLUDE_DIR);
+    #endif
   #endif
 
   // Loads the common header (typedefs and defines and such)
@@ -82,20 +114,29 @@ Program CompileFromSource(const std::string &source_string, const Precision prec
   #endif
 
   // Runs a pre-processor to unroll loops and perform array-to-register promotion. Most OpenCL
-  // compilers do this, but some don't.
+  // compilers do this, but some don't (e.g. those of ARM Mali and Qualcomm Adreno GPUs).
   auto do_run_preprocessor = false;
-  if (run_preprocessor == 0) { do_run_preprocessor = (device.IsARM() && device.IsGPU()); }
+  if (run_preprocessor == 0) {
+    do_run_preprocessor = ((device.IsARM() || device.IsQualcomm()) && device.IsGPU());
+  }
   if (run_preprocessor == 1) { do_run_preprocessor = true; }
   auto kernel_string = header_string + source_string;
+  const auto preprocessing_start_time = std::chrono::steady_clock::now();
   if (do_run_preprocessor) {
     log_debug("Running built-in pre-processor");
     kernel_string = PreprocessKernelSource(kernel_string);
   }
 
   // Compiles the kernel
+  const auto build_start_time = std::chrono::steady_clock::now();
   auto program = Program(context, kernel_string);
   try {
     program.Build(device, options);
+    if (times != nullptr) {
+      const auto end_time = std::chrono::steady_clock::now();
+      times->preprocessing_ms = std::chrono::duration<double,std::milli>(build_start_time - preprocessing_start_time).count();
+      times->build_ms = std::chrono::duration<double,std::milli>(end_time - build_start_time).count();
+    }
   } catch (const CLCudaAPIBuildError &e) {
     if (program.StatusIsCompilationWarningOrError(e.status()) && !silent) {
       fprintf(stdout, "OpenCL compiler error/warning:\n%s\n",
@@ -114,5 +155,85 @@ Program CompileFromSource(const std::string &source_string, const Precision prec
   return program;
 }
 
+// =================================================================================================
+
+namespace {
+
+// Header of each on-disk cache file, bump the version whenever the file format changes
+const std::string kBinaryDiskCacheHeader = "CLBlast binary cache v1\n";
+
+// The file name is a 64-bit FNV-1a hash of the key, which is stable across runs and platforms. The
+// full key is stored inside the file as well to detect hash collisions.
+std::string GetBinaryFileName(const std::string &key) {
+  std::ostringstream file_name;
+  file_name << std::hex << std::setw(16) << std::setfill('0') << Hash(key) << ".clbin";
+  return file_name.str();
+}
+
+} // anonymous namespace
+
+std::string GetBinaryFileKey(const Device &device, const Precision precision,
+                             const std::string &routine_info) {
+  const auto platform = Platform(device.PlatformID());
+  return platform.Name() + ";" + platform.Version() + ";" + GetDeviceName(device) + ";" +
+         device.DriverVersion() + ";" + ToString(static_cast<int>(precision)) + ";" + routine_info;
+}
+
+bool LoadBinaryFile(const std::string &directory, const std::string &key, std::string &binary) {
+  std::ifstream file(directory + "/" + GetBinaryFileName(key), std::ios::binary);
+  if (!file) { return false; }
+  const auto contents = std::string(std::istreambuf_iterator<char>(file),
+                                    std::istreambuf_iterator<char>());
+  const auto prefix = kBinaryDiskCacheHeader + key + "\n";
+  if (contents.size() <= prefix.size() || contents.compare(0, prefix.size(), prefix) != 0) {
+    log_debug("Ignoring on-disk cache entry with a mismatching key");
+    return false;
+  }
+  binary = contents.substr(prefix.size());
+  return true;
+}
+
+bool ContainsBinaryFile(const std::string &directory, const std::string &key) {
+  std::ifstream file(directory + "/" + GetBinaryFileName(key), std::ios::binary);
+  if (!file) { return false; }
+  const auto prefix = kBinaryDiskCacheHeader + key + "\n";
+  auto contents = std::string(prefix.size() + 1, '\0');
+  file.read(&contents[0], static_cast<std::streamsize>(contents.size()));
+  return static_cast<size_t>(file.gcount()) == contents.size() &&
+         contents.compare(0, prefix.size(), prefix) == 0;
+}
+
+void StoreBinaryFile(const std::string &directory, const std::string &key,
+                     const std::string &binary) {
+  if (binary.empty()) { return; }
+  const auto file_name = directory + "/" + GetBinaryFileName(key);
+
+  // Writes to a uniquely named temporary file first, such that concurrent readers never observe
+  // partially written files
+  std::random_device random_device;
+  const auto unique_id = std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+                         static_cast<size_t>(random_device()) ^
+                         static_cast<size_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+  const auto temp_file_name = file_name + ".tmp" + ToString(unique_id);
+  {
+    std::ofstream file(temp_file_name, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      log_debug("Unable to write to on-disk cache directory '" + directory + "'");
+      return;
+    }
+    file << kBinaryDiskCacheHeader << key << "\n";
+    file.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+    if (!file) { file.close(); std::remove(temp_file_name.c_str()); return; }
+  }
+
+  // Atomically replaces the target file (POSIX semantics: an existing file is overwritten)
+  #ifdef _WIN32
+    std::remove(file_name.c_str());
+  #endif
+  if (std::rename(temp_file_name.c_str(), file_name.c_str()) != 0) {
+    std::remove(temp_file_name.c_str());
+  }
+}
+
 // =================================================================================================
 } // namespace clblast
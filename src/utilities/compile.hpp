@@ -7,8 +7,8 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file contains the CLBlast way to compile a kernel from source, used for the library and for
-// the auto-tuners.
+// This file contains the CLBlast way to compile a kernel from source and to store the compiled
+// binaries on disk, used for the library and for the auto-tuners.
 //
 // =================================================================================================
 
@@ -23,13 +23,41 @@
 namespace clblast {
 // =================================================================================================
 
-// Compiles a program from source code
+// The host times of two phases of a compilation in milliseconds, the remainder is spent on
+// assembling the source
+struct CompilationTimes {
+  double preprocessing_ms;
+  double build_ms;
+};
+
+// The compiler options of the fast math mode (see 'MathMode'), which are also tried by the tuners
+// as the 'FAST_MATH' parameter. With these, the kernels use the OpenCL mad() instruction.
+#ifdef OPENCL_API
+  constexpr auto kFastMathOptions = "-cl-fast-relaxed-math -cl-mad-enable -cl-denorms-are-zero";
+#elif CUDA_API
+  constexpr auto kFastMathOptions = "--use_fast_math";
+#endif
+
+// Compiles a program from source code, optionally reporting the times of the phases
 Program CompileFromSource(const std::string &source_string, const Precision precision,
                           const std::string &routine_name,
                           const Device& device, const Context& context,
                           std::vector<std::string>& options,
                           const size_t run_preprocessor, // 0: platform dependent, 1: always, 2: never
-                          const bool silent = false);
+                          const bool silent = false, CompilationTimes* times = nullptr);
+
+// The on-disk format of compiled binaries, shared by the library's on-disk cache (see
+// 'BinaryDiskCache') and the tuners. The key of a binary includes the platform and the driver
+// version, such that binaries are invalidated automatically after a driver update. Each binary is
+// stored in its own file in the given directory, loading returns false on a miss. Checking for a
+// binary only reads the header of its file. Storing is done atomically, failures are not considered
+// errors and are silently ignored.
+std::string GetBinaryFileKey(const Device &device, const Precision precision,
+                             const std::string &routine_info);
+bool LoadBinaryFile(const std::string &directory, const std::string &key, std::string &binary);
+bool ContainsBinaryFile(const std::string &directory, const std::string &key);
+void StoreBinaryFile(const std::string &directory, const std::string &key,
+                     const std::string &binary);
 
 // =================================================================================================
 } // namespace clblast
@@ -0,0 +1,181 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the bulk host conversions between single-precision and half-precision data
+// (FloatToHalfArray and HalfToFloatArray). On x86 the implementation is selected at run-time based
+// on the CPU's support for AVX-512F or F16C, on 64-bit ARM NEON is always available. All variants
+// round to nearest-even and give bit-identical results, including for NaN, infinity and subnormals.
+//
+// =================================================================================================
+
+#include <cstring>
+
+#include "clblast.h"
+#include "clblast_half.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define CLBLAST_HALF_CONVERSION_X86 1
+  #include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  #define CLBLAST_HALF_CONVERSION_NEON 1
+  #include <arm_neon.h>
+#endif
+
+namespace clblast {
+// =================================================================================================
+namespace {
+
+// Portable conversion of a single value, rounding to nearest-even (the scalar FloatToHalf of
+// clblast_half.h truncates instead). This is used for the remainders of the vectorised versions.
+half FloatToHalfNearestEven(const float value) {
+  auto bits = 0u;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const auto sign = static_cast<unsigned int>((bits >> 16) & 0x8000u);
+  const auto abs = bits & 0x7FFFFFFFu;
+  if (abs > 0x7F800000u) {  // NaN: keeps the upper payload bits and makes it quiet
+    return static_cast<half>(sign | 0x7E00u | ((abs >> 13) & 0x03FFu));
+  }
+  if (abs >= 0x477FF000u) {  // overflows to infinity (including infinity itself)
+    return static_cast<half>(sign | 0x7C00u);
+  }
+  if (abs <= 0x33000000u) {  // underflows to zero (the halfway case 2^-25 rounds to even)
+    return static_cast<half>(sign);
+  }
+  if (abs < 0x38800000u) {  // subnormal half: shifts in the implicit leading one
+    const auto shift = 126u - (abs >> 23);
+    const auto mantissa = (abs & 0x007FFFFFu) | 0x00800000u;
+    const auto result = mantissa >> shift;
+    const auto remainder = mantissa & ((1u << shift) - 1u);
+    const auto halfway = 1u << (shift - 1u);
+    const auto round_up = (remainder > halfway) || (remainder == halfway && (result & 1u));
+    return static_cast<half>(sign | (result + (round_up ? 1u : 0u)));
+  }
+  const auto result = (abs - (112u << 23)) >> 13;  // re-biases the exponent from 127 to 15
+  const auto remainder = abs & 0x1FFFu;
+  const auto round_up = (remainder > 0x1000u) || (remainder == 0x1000u && (result & 1u));
+  return static_cast<half>(sign | (result + (round_up ? 1u : 0u)));
+}
+
+// The portable implementations
+void FloatToHalfGeneric(const float* src, half* dest, const size_t n) {
+  for (auto i = size_t{0}; i < n; ++i) { dest[i] = FloatToHalfNearestEven(src[i]); }
+}
+void HalfToFloatGeneric(const half* src, float* dest, const size_t n) {
+  for (auto i = size_t{0}; i < n; ++i) { dest[i] = HalfToFloat(src[i]); }
+}
+
+// =================================================================================================
+#if defined(CLBLAST_HALF_CONVERSION_X86)
+
+// Implementations using F16C with 8 values per instruction. These are compiled for the specific
+// instruction sets only, such that the rest of the library does not require them.
+__attribute__((target("avx,f16c")))
+void FloatToHalfF16C(const float* src, half* dest, const size_t n) {
+  auto i = size_t{0};
+  for (; i + 8 <= n; i += 8) {
+    const auto values = _mm256_loadu_ps(src + i);
+    const auto result = _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), result);
+  }
+  FloatToHalfGeneric(src + i, dest + i, n - i);
+}
+__attribute__((target("avx,f16c")))
+void HalfToFloatF16C(const half* src, float* dest, const size_t n) {
+  auto i = size_t{0};
+  for (; i + 8 <= n; i += 8) {
+    const auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm256_storeu_ps(dest + i, _mm256_cvtph_ps(values));
+  }
+  HalfToFloatGeneric(src + i, dest + i, n - i);
+}
+
+// Implementations using AVX-512F with 16 values per instruction. The zero-masked versions of the
+// instructions are used to avoid false 'maybe-uninitialized' warnings of some GCC versions.
+__attribute__((target("avx512f")))
+void FloatToHalfAVX512(const float* src, half* dest, const size_t n) {
+  auto i = size_t{0};
+  for (; i + 16 <= n; i += 16) {
+    const auto values = _mm512_loadu_ps(src + i);
+    const auto result = _mm512_maskz_cvtps_ph(0xFFFF, values,
+                                              _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), result);
+  }
+  FloatToHalfGeneric(src + i, dest + i, n - i);
+}
+__attribute__((target("avx512f")))
+void HalfToFloatAVX512(const half* src, float* dest, const size_t n) {
+  auto i = size_t{0};
+  for (; i + 16 <= n; i += 16) {
+    const auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    _mm512_storeu_ps(dest + i, _mm512_maskz_cvtph_ps(0xFFFF, values));
+  }
+  HalfToFloatGeneric(src + i, dest + i, n - i);
+}
+
+#elif defined(CLBLAST_HALF_CONVERSION_NEON)
+
+// Implementations using NEON with 4 values per instruction (using the default rounding mode)
+void FloatToHalfNEON(const float* src, half* dest, const size_t n) {
+  auto i = size_t{0};
+  for (; i + 4 <= n; i += 4) {
+    const auto result = vcvt_f16_f32(vld1q_f32(src + i));
+    vst1_u16(dest + i, vreinterpret_u16_f16(result));
+  }
+  FloatToHalfGeneric(src + i, dest + i, n - i);
+}
+void HalfToFloatNEON(const half* src, float* dest, const size_t n) {
+  auto i = size_t{0};
+  for (; i + 4 <= n; i += 4) {
+    const auto values = vreinterpret_f16_u16(vld1_u16(src + i));
+    vst1q_f32(dest + i, vcvt_f32_f16(values));
+  }
+  HalfToFloatGeneric(src + i, dest + i, n - i);
+}
+
+#endif
+// =================================================================================================
+
+// Selects the fastest implementation supported by the host, which is determined only once
+using FloatToHalfFunction = void (*)(const float*, half*, const size_t);
+using HalfToFloatFunction = void (*)(const half*, float*, const size_t);
+
+FloatToHalfFunction SelectFloatToHalf() {
+  #if defined(CLBLAST_HALF_CONVERSION_X86)
+    if (__builtin_cpu_supports("avx512f")) { return FloatToHalfAVX512; }
+    if (__builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c")) { return FloatToHalfF16C; }
+  #elif defined(CLBLAST_HALF_CONVERSION_NEON)
+    return FloatToHalfNEON;
+  #endif
+  return FloatToHalfGeneric;
+}
+HalfToFloatFunction SelectHalfToFloat() {
+  #if defined(CLBLAST_HALF_CONVERSION_X86)
+    if (__builtin_cpu_supports("avx512f")) { return HalfToFloatAVX512; }
+    if (__builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c")) { return HalfToFloatF16C; }
+  #elif defined(CLBLAST_HALF_CONVERSION_NEON)
+    return HalfToFloatNEON;
+  #endif
+  return HalfToFloatGeneric;
+}
+
+} // anonymous namespace
+// =================================================================================================
+
+// Bulk conversions between single-precision and half-precision host data
+void FloatToHalfArray(const float* src, cl_half* dest, const size_t n) {
+  static const auto function = SelectFloatToHalf();
+  function(src, dest, n);
+}
+void HalfToFloatArray(const cl_half* src, float* dest, const size_t n) {
+  static const auto function = SelectHalfToFloat();
+  function(src, dest, n);
+}
+
+// =================================================================================================
+} // namespace clblast
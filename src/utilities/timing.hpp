@@ -52,13 +52,13 @@ double TimeKernel(const size_t num_runs, Kernel &kernel, Queue &queue, const Dev
 using Timing = std::pair<size_t, double>;
 
 template <typename T, typename F>
-std::vector<Timing> TimeRoutine(const size_t from, const size_t to, const size_t step,
+std::vector<Timing> TimeRoutine(const std::vector<size_t> &values,
                                 const size_t num_runs, Queue& queue,
                                 const std::vector<Buffer<T>>& buffers, F const &routine) {
   auto timings = std::vector<Timing>();
   printf("|  value |         time |\n");
   printf("x--------x--------------x\n");
-  for (auto value = from; value < to; value += step) {
+  for (const auto value : values) {
     printf("| %6zu |", value);
     try {
       const auto FunctionToTune = [&]() { routine(value, queue, buffers); };
@@ -76,6 +76,16 @@ std::vector<Timing> TimeRoutine(const size_t from, const size_t to, const size_t
   return timings;
 }
 
+// As above, but for the values from 'from' to 'to' (exclusive) with steps of 'step'
+template <typename T, typename F>
+std::vector<Timing> TimeRoutine(const size_t from, const size_t to, const size_t step,
+                                const size_t num_runs, Queue& queue,
+                                const std::vector<Buffer<T>>& buffers, F const &routine) {
+  auto values = std::vector<size_t>();
+  for (auto value = from; value < to; value += step) { values.push_back(value); }
+  return TimeRoutine(values, num_runs, queue, buffers, routine);
+}
+
 // =================================================================================================
 } // namespace clblast
 
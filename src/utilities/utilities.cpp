@@ -29,7 +29,9 @@ namespace clblast {
 template <typename T> T GetScalar() { return static_cast<T>(2.0); }
 template float GetScalar<float>();
 template double GetScalar<double>();
+template int8 GetScalar<int8>();
 template <> half GetScalar() { return FloatToHalf(2.0f); }
+template <> bfloat16 GetScalar() { return FloatToBFloat16(2.0f); }
 template <> float2 GetScalar() { return {2.0f, 0.5f}; }
 template <> double2 GetScalar() { return {2.0, 0.5}; }
 
@@ -37,7 +39,9 @@ template <> double2 GetScalar() { return {2.0, 0.5}; }
 template <typename T> T ConstantZero() { return static_cast<T>(0.0); }
 template float ConstantZero<float>();
 template double ConstantZero<double>();
+template int8 ConstantZero<int8>();
 template <> half ConstantZero() { return FloatToHalf(0.0f); }
+template <> bfloat16 ConstantZero() { return FloatToBFloat16(0.0f); }
 template <> float2 ConstantZero() { return {0.0f, 0.0f}; }
 template <> double2 ConstantZero() { return {0.0, 0.0}; }
 
@@ -45,7 +49,9 @@ template <> double2 ConstantZero() { return {0.0, 0.0}; }
 template <typename T> T ConstantOne() { return static_cast<T>(1.0); }
 template float ConstantOne<float>();
 template double ConstantOne<double>();
+template int8 ConstantOne<int8>();
 template <> half ConstantOne() { return FloatToHalf(1.0f); }
+template <> bfloat16 ConstantOne() { return FloatToBFloat16(1.0f); }
 template <> float2 ConstantOne() { return {1.0f, 0.0f}; }
 template <> double2 ConstantOne() { return {1.0, 0.0}; }
 
@@ -54,6 +60,7 @@ template <typename T> T ConstantNegOne() { return static_cast<T>(-1.0); }
 template float ConstantNegOne<float>();
 template double ConstantNegOne<double>();
 template <> half ConstantNegOne() { return FloatToHalf(-1.0f); }
+template <> bfloat16 ConstantNegOne() { return FloatToBFloat16(-1.0f); }
 template <> float2 ConstantNegOne() { return {-1.0f, 0.0f}; }
 template <> double2 ConstantNegOne() { return {-1.0, 0.0}; }
 
@@ -62,6 +69,7 @@ template <typename T> T Constant(const double val) { return static_cast<T>(val);
 template float Constant<float>(const double);
 template double Constant<double>(const double);
 template <> half Constant(const double val) { return FloatToHalf(static_cast<float>(val)); }
+template <> bfloat16 Constant(const double val) { return FloatToBFloat16(static_cast<float>(val)); }
 template <> float2 Constant(const double val) { return {static_cast<float>(val), 0.0f}; }
 template <> double2 Constant(const double val) { return {val, 0.0}; }
 
@@ -70,6 +78,7 @@ template <typename T> T SmallConstant() { return static_cast<T>(1e-4); }
 template float SmallConstant<float>();
 template double SmallConstant<double>();
 template <> half SmallConstant() { return FloatToHalf(1e-4f); }
+template <> bfloat16 SmallConstant() { return FloatToBFloat16(1e-4f); }
 template <> float2 SmallConstant() { return {1e-4f, 0.0f}; }
 template <> double2 SmallConstant() { return {1e-4, 0.0}; }
 
@@ -78,6 +87,7 @@ template <typename T> typename BaseType<T>::Type AbsoluteValue(const T value) {
 template float AbsoluteValue<float>(const float);
 template double AbsoluteValue<double>(const double);
 template <> half AbsoluteValue(const half value) { return FloatToHalf(std::fabs(HalfToFloat(value))); }
+template <> bfloat16 AbsoluteValue(const bfloat16 value) { return FloatToBFloat16(std::fabs(BFloat16ToFloat(value))); }
 template <> float AbsoluteValue(const float2 value) {
   if (value.real() == 0.0f && value.imag() == 0.0f) { return 0.0f; }
   return std::sqrt(value.real() * value.real() + value.imag() * value.imag());
@@ -96,6 +106,7 @@ std::string ToString(T value) {
 }
 template std::string ToString<int>(int value);
 template std::string ToString<size_t>(size_t value);
+template std::string ToString<int8>(int8 value);
 template <>
 std::string ToString(float value) {
   std::ostringstream result;
@@ -120,11 +131,15 @@ std::string ToString(double2 value) {
   return ToString(value.real())+"+"+ToString(value.imag())+"i";
 }
 
-// If not possible directly: special case for half-precision
+// If not possible directly: special case for half-precision and bfloat16
 template <>
 std::string ToString(half value) {
   return std::to_string(HalfToFloat(value));
 }
+template <>
+std::string ToString(bfloat16 value) {
+  return std::to_string(BFloat16ToFloat(value));
+}
 
 // If not possible directly: special cases for CLBlast data-types
 template <>
@@ -171,6 +186,10 @@ std::string ToString(Precision value) {
     case Precision::kDouble: return ToString(static_cast<int>(value))+" (double)";
     case Precision::kComplexSingle: return ToString(static_cast<int>(value))+" (complex-single)";
     case Precision::kComplexDouble: return ToString(static_cast<int>(value))+" (complex-double)";
+    case Precision::kHalfSingle: return ToString(static_cast<int>(value))+" (half-single)";
+    case Precision::kBFloat16: return ToString(static_cast<int>(value))+" (bfloat16)";
+    case Precision::kInt8: return ToString(static_cast<int>(value))+" (int8)";
+    case Precision::kHalfStorage: return ToString(static_cast<int>(value))+" (half-storage)";
     case Precision::kAny: return ToString(static_cast<int>(value))+" (any)";
   }
 }
@@ -217,6 +236,9 @@ template <> std::string ConvertArgument(const char* value) {
 template <> half ConvertArgument(const char* value) {
   return FloatToHalf(static_cast<float>(std::stod(value)));
 }
+template <> bfloat16 ConvertArgument(const char* value) {
+  return FloatToBFloat16(static_cast<float>(std::stod(value)));
+}
 template <> float ConvertArgument(const char* value) {
   return static_cast<float>(std::stod(value));
 }
@@ -270,6 +292,8 @@ T GetArgument(const std::vector<std::string> &arguments, std::string &help,
 template int GetArgument<int>(const std::vector<std::string>&, std::string&, const std::string&, const int);
 template size_t GetArgument<size_t>(const std::vector<std::string>&, std::string&, const std::string&, const size_t);
 template half GetArgument<half>(const std::vector<std::string>&, std::string&, const std::string&, const half);
+template bfloat16 GetArgument<bfloat16>(const std::vector<std::string>&, std::string&, const std::string&, const bfloat16);
+template int8 GetArgument<int8>(const std::vector<std::string>&, std::string&, const std::string&, const int8);
 template float GetArgument<float>(const std::vector<std::string>&, std::string&, const std::string&, const float);
 template double GetArgument<double>(const std::vector<std::string>&, std::string&, const std::string&, const double);
 template float2 GetArgument<float2>(const std::vector<std::string>&, std::string&, const std::string&, const float2);
@@ -336,21 +360,34 @@ void PopulateVector(std::vector<double2> &vector, std::mt19937 &mt, std::uniform
   for (auto &element: vector) { element.real(dist(mt)); element.imag(dist(mt)); }
 }
 
-// Specialized versions of the above for half-precision
+// Specialized versions of the above for half-precision and bfloat16
 template <>
 void PopulateVector(std::vector<half> &vector, std::mt19937 &mt, std::uniform_real_distribution<double> &dist) {
   for (auto &element: vector) { element = FloatToHalf(static_cast<float>(dist(mt))); }
 }
+template <>
+void PopulateVector(std::vector<bfloat16> &vector, std::mt19937 &mt, std::uniform_real_distribution<double> &dist) {
+  for (auto &element: vector) { element = FloatToBFloat16(static_cast<float>(dist(mt))); }
+}
+
+// Specialized version of the above for 8-bit integers: scales the random values to a part of the
+// integer range, such that the results of the integer GEMM remain well within 32 bits
+template <>
+void PopulateVector(std::vector<int8> &vector, std::mt19937 &mt, std::uniform_real_distribution<double> &dist) {
+  for (auto &element: vector) { element = static_cast<int8>(std::lround(dist(mt) * 32.0)); }
+}
 
 // =================================================================================================
 
 // Converts a 'real' value to a 'real argument' value to be passed to a kernel. Normally there is
 // no conversion, but half-precision is not supported as kernel argument so it is converted to float.
 template <> typename RealArg<half>::Type GetRealArg(const half value) { return HalfToFloat(value); }
+template <> typename RealArg<bfloat16>::Type GetRealArg(const bfloat16 value) { return BFloat16ToFloat(value); }
 template <> typename RealArg<float>::Type GetRealArg(const float value) { return value; }
 template <> typename RealArg<double>::Type GetRealArg(const double value) { return value; }
 template <> typename RealArg<float2>::Type GetRealArg(const float2 value) { return value; }
 template <> typename RealArg<double2>::Type GetRealArg(const double2 value) { return value; }
+template <> typename RealArg<int8>::Type GetRealArg(const int8 value) { return static_cast<int>(value); }
 
 // =================================================================================================
 
@@ -377,16 +414,22 @@ size_t GetBytes(const Precision precision) {
     case Precision::kDouble: return 8;
     case Precision::kComplexSingle: return 8;
     case Precision::kComplexDouble: return 16;
+    case Precision::kHalfSingle: return 2;
+    case Precision::kBFloat16: return 2;
+    case Precision::kInt8: return 1;
+    case Precision::kHalfStorage: return 2;
     case Precision::kAny: return -1;
   }
 }
 
 // Convert the template argument into a precision value
 template <> Precision PrecisionValue<half>() { return Precision::kHalf; }
+template <> Precision PrecisionValue<bfloat16>() { return Precision::kBFloat16; }
 template <> Precision PrecisionValue<float>() { return Precision::kSingle; }
 template <> Precision PrecisionValue<double>() { return Precision::kDouble; }
 template <> Precision PrecisionValue<float2>() { return Precision::kComplexSingle; }
 template <> Precision PrecisionValue<double2>() { return Precision::kComplexDouble; }
+template <> Precision PrecisionValue<int8>() { return Precision::kInt8; }
 
 // =================================================================================================
 
@@ -396,6 +439,8 @@ template <> bool PrecisionSupported<float2>(const Device &) { return true; }
 template <> bool PrecisionSupported<double>(const Device &device) { return device.SupportsFP64(); }
 template <> bool PrecisionSupported<double2>(const Device &device) { return device.SupportsFP64(); }
 template <> bool PrecisionSupported<half>(const Device &device) { return device.SupportsFP16(); }
+template <> bool PrecisionSupported<bfloat16>(const Device &) { return true; }
+template <> bool PrecisionSupported<int8>(const Device &) { return true; }
 
 // =================================================================================================
 
@@ -427,6 +472,14 @@ template <>
 double SquaredDifference(const half val1, const half val2) {
   return SquaredDifference(HalfToFloat(val1), HalfToFloat(val2));
 }
+template <>
+double SquaredDifference(const bfloat16 val1, const bfloat16 val2) {
+  return SquaredDifference(BFloat16ToFloat(val1), BFloat16ToFloat(val2));
+}
+template <>
+double SquaredDifference(const int8 val1, const int8 val2) {
+  return SquaredDifference(static_cast<double>(val1), static_cast<double>(val2));
+}
 
 // =================================================================================================
 
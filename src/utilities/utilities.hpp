@@ -17,6 +17,7 @@
 #define CLBLAST_UTILITIES_H_
 
 #include <string>
+#include <cstdint>
 #include <functional>
 #include <complex>
 #include <random>
@@ -40,6 +41,14 @@ namespace clblast {
 // Shorthands for half-precision
 using half = unsigned short; // the 'cl_half' OpenCL type is actually an 'unsigned short'
 
+// Shorthand for bfloat16 (see clblast_half.h) and comparisons of bfloat16 values by their bits
+using bfloat16 = clblast_bfloat16;
+inline bool operator==(const bfloat16 a, const bfloat16 b) { return a.bits == b.bits; }
+inline bool operator!=(const bfloat16 a, const bfloat16 b) { return a.bits != b.bits; }
+
+// Shorthand for the 8-bit signed integers of the integer GEMM (the 'cl_char' OpenCL type)
+using int8 = signed char;
+
 // Shorthands for complex data-types
 using float2 = std::complex<float>;
 using double2 = std::complex<double>;
@@ -48,6 +57,9 @@ using double2 = std::complex<double>;
 const std::string kKhronosAttributesAMD = "cl_amd_device_attribute_query";
 const std::string kKhronosAttributesNVIDIA = "cl_nv_device_attribute_query";
 const std::string kKhronosIntelSubgroups = "cl_intel_subgroups";
+const std::string kKhronosSubgroups = "cl_khr_subgroups";
+const std::string kKhronosSubgroupShuffle = "cl_khr_subgroup_shuffle";
+const std::string kKhronosIntegerDotProduct = "cl_khr_integer_dot_product";
 
 // Catched an unknown error
 constexpr auto kUnknownError = -999;
@@ -98,10 +110,24 @@ constexpr auto kArgStrideW = "stridew";
 constexpr auto kArgDilationH = "dilationh";
 constexpr auto kArgDilationW = "dilationw";
 
+// Constants for convgemm
+constexpr auto kArgNumKernels = "numkernels";
+
 // The tuner-specific arguments in string form
 constexpr auto kArgFraction = "fraction";
 constexpr auto kArgHeuristicSelection = "heuristic";
 constexpr auto kArgMaxL2Norm = "max_l2_norm";
+constexpr auto kArgSizeBucket = "size_bucket";
+constexpr auto kArgSizes = "sizes";
+constexpr auto kArgCompileThreads = "compile_threads";
+constexpr auto kArgPruneFactor = "prune_factor";
+constexpr auto kArgResume = "resume";
+constexpr auto kArgCacheDir = "cache_dir";
+constexpr auto kArgVerification = "verification";
+constexpr auto kArgVerifyTop = "verify_top";
+constexpr auto kArgPowerSensor = "power_sensor";
+constexpr auto kArgObjective = "objective";
+constexpr auto kArgFastMath = "fast_math";
 // PSO tuner-specific arguments in string form
 constexpr auto kArgPsoSwarmSize = "pso_swarm_size";
 constexpr auto kArgPsoInfGlobal = "pso_inf_global";
@@ -138,6 +164,24 @@ inline void log_debug(const std::string &log_string) {
 inline void log_debug(const std::string&) { }
 #endif
 
+// =================================================================================================
+
+// A 64-bit FNV-1a hash, which is stable across runs and platforms. Passing the result of an earlier
+// call as 'hash' combines multiple pieces of data into a single hash.
+constexpr auto kHashOffsetBasis = 14695981039346656037ULL;
+inline uint64_t Hash(const char *data, const size_t size, uint64_t hash = kHashOffsetBasis) {
+  for (auto i = size_t{0}; i < size; ++i) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+inline uint64_t Hash(const std::string &data, const uint64_t hash = kHashOffsetBasis) {
+  return Hash(data.data(), data.size(), hash);
+}
+inline uint64_t Hash(const uint64_t data, const uint64_t hash = kHashOffsetBasis) {
+  return Hash(reinterpret_cast<const char*>(&data), sizeof(data), hash);
+}
 
 // =================================================================================================
 
@@ -207,6 +251,8 @@ struct Arguments {
   size_t stride_w = 1;
   size_t dilation_h = 1;
   size_t dilation_w = 1;
+  // Arguments for convgemm
+  size_t num_kernels = 1;
   // Batch-specific arguments
   size_t batch_count = 1;
   std::vector<size_t> x_offsets; // = {0};
@@ -324,6 +370,8 @@ void PopulateVector(std::vector<T> &vector, std::mt19937 &mt, std::uniform_real_
 // no conversion, but half-precision is not supported as kernel argument so it is converted to float.
 template <typename T> struct RealArg { using Type = T; };
 template <> struct RealArg<half> { using Type = float; };
+template <> struct RealArg<bfloat16> { using Type = float; };
+template <> struct RealArg<int8> { using Type = int; };
 template <typename T> typename RealArg<T>::Type GetRealArg(const T value);
 
 // =================================================================================================
@@ -0,0 +1,255 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the profile-guided warm-up (see the header for more information).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <set>
+#include <utility>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdio>
+#include <cstdlib>
+
+#include "warm_up.hpp"
+#include "cache.hpp"
+#include "memory_pool.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+  // Header of each manifest, bump the version whenever the file format changes
+  const std::string kWarmUpHeader = "CLBlast warm-up v1";
+
+  std::atomic<bool> warm_up_enabled{false};
+
+  // The strings of a manifest entry are separated by tabs, so tabs and newlines (e.g. in the extra
+  // defines) are escaped
+  std::string Escape(const std::string &value) {
+    auto result = std::string{};
+    for (const auto character : value) {
+      switch (character) {
+        case '\\': result += "\\\\"; break;
+        case '\t': result += "\\t"; break;
+        case '\n': result += "\\n"; break;
+        default: result += character;
+      }
+    }
+    return result;
+  }
+  std::string Unescape(const std::string &value) {
+    auto result = std::string{};
+    for (auto i = size_t{0}; i < value.size(); ++i) {
+      if (value[i] != '\\' || i + 1 == value.size()) { result += value[i]; continue; }
+      ++i;
+      switch (value[i]) {
+        case 't': result += '\t'; break;
+        case 'n': result += '\n'; break;
+        default: result += value[i];
+      }
+    }
+    return result;
+  }
+
+  // A manifest entry holds the routine name, the precision, the index, the identifier, the extra
+  // defines, and the build options
+  std::string ToEntry(const WarmUpProgram &program) {
+    return Escape(program.routine_name) + "\t" + ToString(static_cast<int>(program.precision)) +
+           "\t" + ToString(program.index) + "\t" + Escape(program.identifier) + "\t" +
+           Escape(program.extra_defines) + "\t" + Escape(program.build_options);
+  }
+  bool FromEntry(const std::string &entry, WarmUpProgram &program) {
+    auto fields = std::vector<std::string>();
+    auto start = size_t{0};
+    for (auto end = entry.find('\t'); end != std::string::npos; end = entry.find('\t', start)) {
+      fields.push_back(entry.substr(start, end - start));
+      start = end + 1;
+    }
+    fields.push_back(entry.substr(start));
+    if (fields.size() != 6) { return false; }
+    program.routine_name = Unescape(fields[0]);
+    program.precision = static_cast<Precision>(std::strtol(fields[1].c_str(), nullptr, 10));
+    program.index = static_cast<size_t>(std::strtoul(fields[2].c_str(), nullptr, 10));
+    program.identifier = Unescape(fields[3]);
+    program.extra_defines = Unescape(fields[4]);
+    program.build_options = Unescape(fields[5]);
+    return true;
+  }
+
+  // See the comment at the top of the header
+  class WarmUp {
+   public:
+    static WarmUp &Instance() {
+      static WarmUp instance;
+      return instance;
+    }
+
+    // The directory is initialized from the environmental variable (if set)
+    static bool InitFromEnvironment() {
+      const auto environment_variable = std::getenv("CLBLAST_WARM_UP_DIR");
+      if (environment_variable == nullptr || std::string{environment_variable}.empty()) {
+        return false;
+      }
+      Instance().SetDirectory(std::string{environment_variable});
+      return true;
+    }
+
+    // Reads the manifests of all devices and queues their programs for the warm-up
+    void SetDirectory(const std::string &directory) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (directory == directory_) { return; }
+      directory_ = directory;
+      pending_.clear();
+      known_.clear();
+      warm_up_enabled = !directory_.empty();
+      if (directory_.empty()) { return; }
+      for (const auto &platform : GetAllPlatforms()) {
+        for (auto device_id = size_t{0}; device_id < platform.NumDevices(); ++device_id) {
+          Load(Device(platform, device_id));
+        }
+      }
+      if (!pending_.empty() && !worker_.joinable()) { worker_ = std::thread([this]() { Run(); }); }
+      condition_.notify_all();
+    }
+
+    void Record(const Device &device, const WarmUpProgram &program) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (directory_.empty()) { return; }
+      const auto entry = ToEntry(program);
+      if (known_.find(std::make_pair(device(), entry)) != known_.end()) { return; }
+      known_.insert(std::make_pair(device(), entry));
+      Store(device, entry);
+    }
+
+    ~WarmUp() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        pending_.clear();
+      }
+      condition_.notify_all();
+      if (worker_.joinable()) { worker_.join(); }
+    }
+
+   private:
+    // The caches are created first, such that they are destroyed only after the warm-up thread
+    WarmUp(): stop_(false) {
+      BinaryCache::Instance(); ProgramCache::Instance(); KernelCache::Instance();
+      DatabaseCache::Instance(); BinaryDiskCache::Instance(); MemoryPool::Instance();
+    }
+
+    // The manifests are stored per device and driver version, see also 'BinaryDiskCache'
+    static std::string GetKey(const Device &device) {
+      const auto platform = Platform(device.PlatformID());
+      return platform.Name() + ";" + GetDeviceName(device) + ";" + device.DriverVersion();
+    }
+    std::string GetFileName(const std::string &key) const {
+      std::ostringstream file_name;
+      file_name << directory_ << "/" << std::hex << std::setw(16) << std::setfill('0') << Hash(key)
+                << ".clbwarmup";
+      return file_name.str();
+    }
+
+    // Reads the manifest of this device (if any) and queues its programs per routine and precision
+    void Load(const Device &device) {
+      const auto key = GetKey(device);
+      std::ifstream file(GetFileName(key));
+      auto line = std::string{};
+      if (!std::getline(file, line) || line != kWarmUpHeader) { return; }
+      if (!std::getline(file, line) || line != key) { return; }
+      auto routines = std::map<std::pair<std::string, Precision>, std::vector<WarmUpProgram>>();
+      while (std::getline(file, line)) {
+        auto program = WarmUpProgram{};
+        if (!FromEntry(line, program)) { continue; }
+        if (!known_.insert(std::make_pair(device(), line)).second) { continue; }
+        routines[std::make_pair(program.routine_name, program.precision)].push_back(program);
+      }
+      for (const auto &routine : routines) {
+        pending_.push_back(std::make_pair(device(), routine.second));
+      }
+    }
+
+    // Appends an entry to the manifest of the device, which is created first if needed
+    void Store(const Device &device, const std::string &entry) {
+      const auto key = GetKey(device);
+      const auto file_name = GetFileName(key);
+      const auto exists = std::ifstream(file_name).good();
+      auto file = fopen(file_name.c_str(), "a");
+      if (file == nullptr) { return; }
+      if (!exists) { fprintf(file, "%s\n%s\n", kWarmUpHeader.c_str(), key.c_str()); }
+      fprintf(file, "%s\n", entry.c_str());
+      fclose(file);
+    }
+
+    // Builds the queued programs one routine at a time, each device on its own context and queue.
+    // Failures (e.g. a device without double precision) only skip the routine.
+    void Run() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (!stop_) {
+        if (pending_.empty()) {
+          condition_.wait(lock);
+          continue;
+        }
+        const auto programs = pending_.front();
+        pending_.pop_front();
+        lock.unlock();
+        try {
+          const auto device = Device(programs.first);
+          const auto context = Context(device);
+          auto queue = Queue(context, device);
+          const auto &first = programs.second.front();
+          BuildWarmUpPrograms(queue, first.routine_name, first.precision, programs.second);
+        } catch (...) {
+          log_debug("Failed to warm up the programs of a routine");
+        }
+        lock.lock();
+      }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::string directory_;
+    std::deque<std::pair<RawDeviceID, std::vector<WarmUpProgram>>> pending_;
+    std::set<std::pair<RawDeviceID, std::string>> known_; // recorded or loaded entries
+    std::thread worker_;
+    bool stop_;
+  };
+} // anonymous namespace
+
+// =================================================================================================
+
+void SetWarmUp(const std::string &directory) {
+  IsWarmUpEnabled(); // first applies the environmental variable, which is overridden here
+  WarmUp::Instance().SetDirectory(directory);
+}
+
+bool IsWarmUpEnabled() {
+  static const auto from_environment = WarmUp::InitFromEnvironment();
+  static_cast<void>(from_environment);
+  return warm_up_enabled.load(std::memory_order_relaxed);
+}
+
+void RecordWarmUpProgram(const Device &device, const WarmUpProgram &program) {
+  WarmUp::Instance().Record(device, program);
+}
+
+// =================================================================================================
+} // namespace clblast
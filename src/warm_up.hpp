@@ -0,0 +1,62 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the optional profile-guided warm-up (see 'SetWarmUpDirectory'). Each program
+// which a routine builds (compiled from source or created from a cached binary) is recorded in a
+// manifest per device and driver version: the routine name, the precision, and the variant of the
+// program (its index and specialisation). When a later process sets the same directory, a
+// background thread builds exactly those programs again on each device with a manifest, such that
+// they are found in the binary caches by the first routine calls. Combined with the on-disk binary
+// cache (see 'SetCacheDirectory') nothing is compiled from source. This is only available for
+// OpenCL.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_WARM_UP_H_
+#define CLBLAST_WARM_UP_H_
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// A program built by a routine, as recorded in the manifest. The build options exclude those of
+// the 'CLBLAST_BUILD_OPTIONS' environmental variable.
+struct WarmUpProgram {
+  std::string routine_name;
+  Precision precision;
+  size_t index;
+  std::string extra_defines;
+  std::string identifier;
+  std::string build_options;
+};
+
+// Sets the directory with the manifests, enables the recording, and starts the warm-up of all
+// devices with a manifest. An empty string disables the recording and stops the warm-up.
+void SetWarmUp(const std::string &directory);
+
+// Whether or not the recording is enabled, cheap enough to be called for every program build
+bool IsWarmUpEnabled();
+
+// Records a program which was built on the device, unless it is in its manifest already
+void RecordWarmUpProgram(const Device &device, const WarmUpProgram &program);
+
+// Builds the given programs of a single routine and precision on the queue. Unknown routines are
+// skipped. This is implemented alongside 'FillCache', which knows the classes of all routines.
+void BuildWarmUpPrograms(Queue &queue, const std::string &routine_name, const Precision precision,
+                         const std::vector<WarmUpProgram> &programs);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_WARM_UP_H_
+#endif
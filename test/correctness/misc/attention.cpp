@@ -0,0 +1,173 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the batched attention routine: the results should match those of
+// a straightforward host implementation. The shapes cover both the fused kernel (a small head
+// dimension) and the unfused fall-back (a large one), with and without the causal mask.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Host reference of the attention of a single batch
+template <typename T>
+std::vector<T> AttentionReference(const Layout layout, const size_t seq_q, const size_t seq_k,
+                                  const size_t head_dim, const T scale, const bool causal,
+                                  const T* q, const T* k, const T* v) {
+  const auto index = [layout](const size_t row, const size_t col, const size_t ld) {
+    return (layout == Layout::kRowMajor) ? row * ld + col : col * ld + row;
+  };
+  const auto q_ld = (layout == Layout::kRowMajor) ? head_dim : seq_q;
+  const auto kv_ld = (layout == Layout::kRowMajor) ? head_dim : seq_k;
+  auto result = std::vector<T>(seq_q * head_dim, T{0});
+  for (auto i = size_t{0}; i < seq_q; ++i) {
+    const auto num_keys = (!causal) ? seq_k :
+                          (i + seq_k + 1 <= seq_q) ? size_t{0} : std::min(seq_k, i + seq_k + 1 - seq_q);
+    if (num_keys == 0) { continue; } // fully masked, the result is zero
+    auto scores = std::vector<double>(num_keys);
+    for (auto j = size_t{0}; j < num_keys; ++j) {
+      auto score = 0.0;
+      for (auto d = size_t{0}; d < head_dim; ++d) {
+        score += static_cast<double>(q[index(i, d, q_ld)]) * static_cast<double>(k[index(j, d, kv_ld)]);
+      }
+      scores[j] = score * static_cast<double>(scale);
+    }
+    const auto max_score = *std::max_element(scores.begin(), scores.end());
+    auto sum = 0.0;
+    for (auto &score : scores) { score = std::exp(score - max_score); sum += score; }
+    for (auto d = size_t{0}; d < head_dim; ++d) {
+      auto value = 0.0;
+      for (auto j = size_t{0}; j < num_keys; ++j) {
+        value += scores[j] * static_cast<double>(v[index(j, d, kv_ld)]);
+      }
+      result[index(i, d, q_ld)] = static_cast<T>(value / sum);
+    }
+  }
+  return result;
+}
+
+template <typename T>
+size_t RunAttentionTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  constexpr auto kBatchCount = size_t{3};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Determines the test settings as {seq_q, seq_k, head_dim}: the last shape doesn't fit the fused
+  // kernel. The second one has fewer keys than queries, such that some queries are fully masked.
+  const auto shapes = std::vector<std::vector<size_t>>{{37, 50, 64}, {40, 23, 20}, {20, 33, 200}};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto causal_options = std::vector<bool>{false, true};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing the batched attention for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &shape : shapes) {
+    for (const auto layout : layouts) {
+      for (const auto causal : causal_options) {
+        const auto seq_q = shape[0];
+        const auto seq_k = shape[1];
+        const auto head_dim = shape[2];
+        const auto scale = static_cast<T>(1.0 / std::sqrt(static_cast<double>(head_dim)));
+        const auto q_ld = (layout == Layout::kRowMajor) ? head_dim : seq_q;
+        const auto kv_ld = (layout == Layout::kRowMajor) ? head_dim : seq_k;
+        const auto q_stride = seq_q * head_dim;
+        const auto kv_stride = seq_k * head_dim;
+
+        // Populates the host matrices with some example data and copies them to the device
+        auto host_q = std::vector<T>(kBatchCount * q_stride);
+        auto host_k = std::vector<T>(kBatchCount * kv_stride);
+        auto host_v = std::vector<T>(kBatchCount * kv_stride);
+        PopulateVector(host_q, mt, dist);
+        PopulateVector(host_k, mt, dist);
+        PopulateVector(host_v, mt, dist);
+        auto device_q = Buffer<T>(context, host_q.size());
+        auto device_k = Buffer<T>(context, host_k.size());
+        auto device_v = Buffer<T>(context, host_v.size());
+        auto device_o = Buffer<T>(context, host_q.size());
+        device_q.Write(queue, host_q.size(), host_q);
+        device_k.Write(queue, host_k.size(), host_k);
+        device_v.Write(queue, host_v.size(), host_v);
+
+        // Runs the routine
+        auto queue_plain = queue();
+        const auto status = AttentionStridedBatched(layout, seq_q, seq_k, head_dim, scale, causal,
+                                                    device_q(), 0, q_ld, q_stride,
+                                                    device_k(), 0, kv_ld, kv_stride,
+                                                    device_v(), 0, kv_ld, kv_stride,
+                                                    device_o(), 0, q_ld, q_stride,
+                                                    kBatchCount, &queue_plain);
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+
+        // Compares the results with the host reference
+        auto result = std::vector<T>(host_q.size());
+        device_o.Read(queue, result.size(), result);
+        auto matches = true;
+        for (auto batch = size_t{0}; batch < kBatchCount; ++batch) {
+          const auto reference = AttentionReference(layout, seq_q, seq_k, head_dim, scale, causal,
+                                                    &host_q[batch * q_stride],
+                                                    &host_k[batch * kv_stride],
+                                                    &host_v[batch * kv_stride]);
+          for (auto i = size_t{0}; i < reference.size(); ++i) {
+            const auto value = result[batch * q_stride + i];
+            if (std::abs(reference[i] - value) > 1e-3 * std::abs(reference[i]) + 1e-4) {
+              matches = false;
+            }
+          }
+        }
+        if (matches) { passed++; } else { errors++; }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunAttentionTests<float>(argc, argv, false, "SATTENTION");
+  errors += clblast::RunAttentionTests<double>(argc, argv, true, "DATTENTION");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,140 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the grouped AXPY: the result for each entry of the batch should
+// be the same as calling the regular AXPY routine with the arguments of that entry.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <complex>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunAxpyGroupedTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Determines the test settings: the entries of a batch are of different sizes, including empty
+  // entries and entries smaller and larger than a work-group
+  const auto batch_sizes = std::vector<std::vector<size_t>>{{7}, {3, 0, 4096, 17}, {33, 1, 0, 1000, 65, 8}};
+  const auto incs = std::vector<size_t>{1, 3};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing the grouped AXPY for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &sizes : batch_sizes) {
+    for (const auto x_inc : incs) {
+      for (const auto y_inc : incs) {
+        const auto batch_count = sizes.size();
+
+        // Computes the offsets of each entry: all entries are stored one after another in a single
+        // buffer per vector, with a gap of one element in between
+        auto x_offsets = std::vector<size_t>(batch_count);
+        auto y_offsets = std::vector<size_t>(batch_count);
+        auto alphas = std::vector<T>(batch_count);
+        auto x_size = size_t{0};
+        auto y_size = size_t{0};
+        for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+          x_offsets[batch] = x_size;
+          y_offsets[batch] = y_size;
+          x_size += sizes[batch] * x_inc + 1;
+          y_size += sizes[batch] * y_inc + 1;
+          alphas[batch] = GetScalar<T>();
+        }
+
+        // Populates the host vectors with some example data
+        auto host_x = std::vector<T>(x_size);
+        auto host_y = std::vector<T>(y_size);
+        PopulateVector(host_x, mt, dist);
+        PopulateVector(host_y, mt, dist);
+
+        // Copies the vectors to the device: one output vector for each of the two APIs
+        auto device_x = Buffer<T>(context, host_x.size());
+        auto device_y_reference = Buffer<T>(context, host_y.size());
+        auto device_y_grouped = Buffer<T>(context, host_y.size());
+        device_x.Write(queue, host_x.size(), host_x);
+        device_y_reference.Write(queue, host_y.size(), host_y);
+        device_y_grouped.Write(queue, host_y.size(), host_y);
+
+        // Runs the regular AXPY for each non-empty entry and the grouped AXPY once for all entries
+        auto queue_plain = queue();
+        auto status = StatusCode::kSuccess;
+        for (auto batch = size_t{0}; batch < batch_count && status == StatusCode::kSuccess; ++batch) {
+          if (sizes[batch] == 0) { continue; }
+          status = Axpy(sizes[batch], alphas[batch],
+                        device_x(), x_offsets[batch], x_inc,
+                        device_y_reference(), y_offsets[batch], y_inc, &queue_plain);
+        }
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+        status = AxpyGrouped(sizes.data(), alphas.data(),
+                             device_x(), x_offsets.data(), x_inc,
+                             device_y_grouped(), y_offsets.data(), y_inc,
+                             batch_count, &queue_plain);
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+
+        // Compares the results, which includes the untouched elements in between the entries
+        auto result_reference = std::vector<T>(host_y.size());
+        auto result_grouped = std::vector<T>(host_y.size());
+        device_y_reference.Read(queue, result_reference.size(), result_reference);
+        device_y_grouped.Read(queue, result_grouped.size(), result_grouped);
+        auto matches = true;
+        for (auto i = size_t{0}; i < result_grouped.size(); ++i) {
+          if (std::abs(result_reference[i] - result_grouped[i]) > 1e-4 * std::abs(result_reference[i])) {
+            matches = false;
+          }
+        }
+        if (matches) { passed++; } else { errors++; }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunAxpyGroupedTests<float>(argc, argv, false, "SAXPYGROUPED");
+  errors += clblast::RunAxpyGroupedTests<clblast::float2>(argc, argv, true, "CAXPYGROUPED");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
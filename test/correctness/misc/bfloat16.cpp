@@ -0,0 +1,274 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the bfloat16 routines: the conversions from and to single
+// precision, AXPY and GEMM. The conversions are compared bit-wise, first against hand-picked
+// rounding cases (ties to even, overflow, denormals, NaN) and then against the host conversion of
+// 'clblast_half.h'. AXPY and GEMM compute in single precision and are compared against host
+// references computed on the bfloat16-rounded inputs, within the precision of bfloat16.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Reinterprets the bits of single-precision values
+float BitsToFloat(const unsigned int bits) {
+  auto value = 0.0f;
+  std::memcpy(&value, &bits, sizeof(float));
+  return value;
+}
+unsigned int FloatToBits(const float value) {
+  auto bits = 0u;
+  std::memcpy(&bits, &value, sizeof(float));
+  return bits;
+}
+
+// Compares bfloat16 results against single-precision references: the rounding of the result to
+// bfloat16 causes a relative error of at most 2^-8
+bool BFloat16Matches(const std::vector<bfloat16> &result, const std::vector<float> &reference,
+                     const std::string &name) {
+  for (auto i = size_t{0}; i < result.size(); ++i) {
+    const auto value = BFloat16ToFloat(result[i]);
+    if (std::abs(reference[i] - value) > 8e-3f * std::abs(reference[i]) + 1e-3f) {
+      fprintf(stdout, "    Error in '%s' at index %zu: %f instead of %f\n", name.c_str(), i,
+              value, reference[i]);
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t RunBFloat16Tests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+
+  // The rounding cases of the conversion to bfloat16: pairs of single-precision bits and the
+  // expected bfloat16 bits
+  fprintf(stdout, "* Testing the conversions from and to bfloat16\n");
+  const auto cases = std::vector<std::vector<unsigned int>>{
+    {0x3F800000, 0x3F80}, // exact (1.0)
+    {0x3F807FFF, 0x3F80}, // just below a tie: rounds down
+    {0x3F808001, 0x3F81}, // just above a tie: rounds up
+    {0x3F808000, 0x3F80}, // a tie with an even lower value: rounds down
+    {0x3F818000, 0x3F82}, // a tie with an odd lower value: rounds up
+    {0xBF818000, 0xBF82}, // the same for a negative value
+    {0x7F7FFFFF, 0x7F80}, // the largest single-precision value overflows to infinity
+    {0x7F800000, 0x7F80}, // +infinity
+    {0xFF800000, 0xFF80}, // -infinity
+    {0x00000000, 0x0000}, // +zero
+    {0x80000000, 0x8000}, // -zero
+    {0x00018000, 0x0002}, // a denormal tie with an odd lower value: rounds up
+    {0x7FC00000, 0x7FC0}, // a quiet NaN
+    {0x7F800001, 0x7FC0}, // a signalling NaN, which would otherwise round to infinity
+    {0x7FFFFFFF, 0x7FFF}, // a NaN, which would otherwise round to zero
+  };
+  auto host_src = std::vector<float>();
+  auto expected = std::vector<bfloat16>();
+  for (const auto &test_case : cases) {
+    host_src.push_back(BitsToFloat(test_case[0]));
+    auto value = bfloat16();
+    value.bits = static_cast<unsigned short>(test_case[1]);
+    expected.push_back(value);
+  }
+
+  // Random values of all magnitudes as well, compared against the host conversion
+  std::uniform_int_distribution<unsigned int> bits_dist(0, 0xFFFFFFFF);
+  for (auto i = size_t{0}; i < 4096; ++i) {
+    const auto value = BitsToFloat(bits_dist(mt));
+    host_src.push_back(value);
+    expected.push_back(FloatToBFloat16(value));
+  }
+
+  // The host conversion itself for the rounding cases
+  auto host_matches = true;
+  for (auto i = size_t{0}; i < cases.size(); ++i) {
+    if (FloatToBFloat16(host_src[i]) != expected[i]) {
+      fprintf(stdout, "    Error in the host conversion of 0x%08X\n", cases[i][0]);
+      host_matches = false;
+    }
+  }
+  if (host_matches) { passed++; } else { errors++; }
+
+  // Single precision to bfloat16, with offsets
+  const auto src_offset = size_t{3};
+  const auto dest_offset = size_t{5};
+  const auto num_values = host_src.size();
+  host_src.insert(host_src.begin(), src_offset, 0.0f);
+  auto src_single = Buffer<float>(context, host_src.size());
+  auto dest_bfloat16 = Buffer<bfloat16>(context, dest_offset + num_values);
+  src_single.Write(queue, host_src.size(), host_src);
+  const auto status_to = ConvertToBFloat16(num_values, src_single(), src_offset,
+                                           dest_bfloat16(), dest_offset, &queue_plain);
+  auto result_bfloat16 = std::vector<bfloat16>(dest_offset + num_values);
+  dest_bfloat16.Read(queue, result_bfloat16.size(), result_bfloat16);
+  auto to_matches = (status_to == StatusCode::kSuccess);
+  for (auto i = size_t{0}; i < num_values && to_matches; ++i) {
+    if (result_bfloat16[dest_offset + i] != expected[i]) {
+      fprintf(stdout, "    Error in 'ConvertToBFloat16' of 0x%08X: 0x%04X instead of 0x%04X\n",
+              FloatToBits(host_src[src_offset + i]), result_bfloat16[dest_offset + i].bits,
+              expected[i].bits);
+      to_matches = false;
+    }
+  }
+  if (to_matches) { passed++; } else { errors++; }
+
+  // All bfloat16 values to single precision, which is exact (NaNs only have to remain NaN)
+  const auto num_bfloat16 = size_t{65536};
+  auto host_bfloat16 = std::vector<bfloat16>(num_bfloat16);
+  for (auto i = size_t{0}; i < num_bfloat16; ++i) {
+    host_bfloat16[i].bits = static_cast<unsigned short>(i);
+  }
+  auto src_bfloat16 = Buffer<bfloat16>(context, num_bfloat16);
+  auto dest_single = Buffer<float>(context, num_bfloat16);
+  src_bfloat16.Write(queue, num_bfloat16, host_bfloat16);
+  const auto status_from = ConvertFromBFloat16(num_bfloat16, src_bfloat16(), 0,
+                                               dest_single(), 0, &queue_plain);
+  auto result_single = std::vector<float>(num_bfloat16);
+  dest_single.Read(queue, num_bfloat16, result_single);
+  auto from_matches = (status_from == StatusCode::kSuccess);
+  for (auto i = size_t{0}; i < num_bfloat16 && from_matches; ++i) {
+    const auto reference = BFloat16ToFloat(host_bfloat16[i]);
+    const auto both_nan = std::isnan(reference) && std::isnan(result_single[i]);
+    if (!both_nan && FloatToBits(result_single[i]) != FloatToBits(reference)) {
+      fprintf(stdout, "    Error in 'ConvertFromBFloat16' of 0x%04zX\n", i);
+      from_matches = false;
+    }
+  }
+  if (from_matches) { passed++; } else { errors++; }
+
+  // AXPY with unit strides (the fast kernels) and with offsets and increments (the general kernel)
+  fprintf(stdout, "* Testing the bfloat16 AXPY and GEMM\n");
+  const auto alpha = FloatToBFloat16(1.5f);
+  const auto beta = FloatToBFloat16(-0.5f);
+  for (const auto inc : {size_t{1}, size_t{2}}) {
+    const auto n = (inc == 1) ? size_t{4096} : size_t{1001};
+    const auto offset = (inc == 1) ? size_t{0} : size_t{7};
+    auto host_x = std::vector<bfloat16>(offset + n * inc);
+    auto host_y = std::vector<bfloat16>(offset + n * inc);
+    for (auto &value : host_x) { value = FloatToBFloat16(static_cast<float>(dist(mt))); }
+    for (auto &value : host_y) { value = FloatToBFloat16(static_cast<float>(dist(mt))); }
+    auto reference = std::vector<float>(host_y.size());
+    for (auto i = size_t{0}; i < host_y.size(); ++i) { reference[i] = BFloat16ToFloat(host_y[i]); }
+    for (auto i = size_t{0}; i < n; ++i) {
+      const auto index = offset + i * inc;
+      reference[index] += BFloat16ToFloat(alpha) * BFloat16ToFloat(host_x[index]);
+    }
+    auto device_x = Buffer<bfloat16>(context, host_x.size());
+    auto device_y = Buffer<bfloat16>(context, host_y.size());
+    device_x.Write(queue, host_x.size(), host_x);
+    device_y.Write(queue, host_y.size(), host_y);
+    const auto status = Axpy(n, alpha, device_x(), offset, inc, device_y(), offset, inc,
+                             &queue_plain);
+    auto result = std::vector<bfloat16>(host_y.size());
+    device_y.Read(queue, result.size(), result);
+    if (status == StatusCode::kSuccess && BFloat16Matches(result, reference, "AXPY")) { passed++; }
+    else { errors++; }
+  }
+
+  // GEMM on small sizes (the direct kernel) and on larger sizes (the indirect kernel), in both
+  // layouts and with a transposed matrix A
+  for (const auto sizes : {std::vector<size_t>{67, 45, 33}, std::vector<size_t>{256, 192, 128}}) {
+    const auto m = sizes[0];
+    const auto n = sizes[1];
+    const auto k = sizes[2];
+    for (const auto layout : {Layout::kColMajor, Layout::kRowMajor}) {
+      for (const auto a_transpose : {Transpose::kNo, Transpose::kYes}) {
+        const auto col_major = (layout == Layout::kColMajor);
+        const auto a_rotated = col_major == (a_transpose == Transpose::kYes);
+        const auto a_ld = (a_rotated) ? k : m;
+        const auto b_ld = (col_major) ? k : n;
+        const auto c_ld = (col_major) ? m : n;
+        auto host_a = std::vector<bfloat16>(m * k);
+        auto host_b = std::vector<bfloat16>(k * n);
+        auto host_c = std::vector<bfloat16>(m * n);
+        for (auto &value : host_a) { value = FloatToBFloat16(static_cast<float>(dist(mt))); }
+        for (auto &value : host_b) { value = FloatToBFloat16(static_cast<float>(dist(mt))); }
+        for (auto &value : host_c) { value = FloatToBFloat16(static_cast<float>(dist(mt))); }
+
+        // The reference in single precision, in which (i, j) of a matrix is stored at index
+        // i + j * ld if the matrix is column-major and not transposed (or row-major and transposed)
+        auto reference = std::vector<float>(m * n);
+        for (auto j = size_t{0}; j < n; ++j) {
+          for (auto i = size_t{0}; i < m; ++i) {
+            auto sum = 0.0;
+            for (auto l = size_t{0}; l < k; ++l) {
+              const auto a_index = (a_rotated) ? l + i * a_ld : i + l * a_ld;
+              const auto b_index = (col_major) ? l + j * b_ld : j + l * b_ld;
+              sum += static_cast<double>(BFloat16ToFloat(host_a[a_index])) *
+                     static_cast<double>(BFloat16ToFloat(host_b[b_index]));
+            }
+            const auto c_index = (col_major) ? i + j * c_ld : j + i * c_ld;
+            reference[c_index] = static_cast<float>(BFloat16ToFloat(alpha) * sum +
+                                                    BFloat16ToFloat(beta) *
+                                                    BFloat16ToFloat(host_c[c_index]));
+          }
+        }
+        auto device_a = Buffer<bfloat16>(context, host_a.size());
+        auto device_b = Buffer<bfloat16>(context, host_b.size());
+        auto device_c = Buffer<bfloat16>(context, host_c.size());
+        device_a.Write(queue, host_a.size(), host_a);
+        device_b.Write(queue, host_b.size(), host_b);
+        device_c.Write(queue, host_c.size(), host_c);
+        const auto status = Gemm(layout, a_transpose, Transpose::kNo, m, n, k, alpha,
+                                 device_a(), 0, a_ld, device_b(), 0, b_ld,
+                                 beta, device_c(), 0, c_ld, &queue_plain);
+        auto result = std::vector<bfloat16>(host_c.size());
+        device_c.Read(queue, result.size(), result);
+        if (status == StatusCode::kSuccess && BFloat16Matches(result, reference, "GEMM")) {
+          passed++;
+        } else { errors++; }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunBFloat16Tests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,92 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the transfers staged through pinned memory (WriteStagedAsync and
+// ReadStaged). Small chunk sizes are used to test the chunking: the data should arrive unchanged,
+// also for sizes which are not a multiple of the chunk size and for non-zero offsets.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+size_t RunBufferStagingTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Determines the test settings: the chunk sizes in bytes and the sizes and offsets in elements
+  const auto chunk_sizes = std::vector<size_t>{4, 100, 4096};
+  const auto sizes = std::vector<size_t>{1, 25, 1000, 4097};
+  const auto offsets = std::vector<size_t>{0, 3};
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing the staged buffer transfers\n");
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto chunk_size : chunk_sizes) {
+    auto pool = StagingPool(context, queue, chunk_size);
+    for (const auto size : sizes) {
+      for (const auto offset : offsets) {
+        auto host = std::vector<float>(size);
+        PopulateVector(host, mt, dist);
+
+        // Writes staged and reads back regularly, and the other way around
+        auto device_buffer = Buffer<float>(context, size + offset);
+        auto event = Event();
+        device_buffer.WriteStagedAsync(queue, size, host.data(), pool, offset, event.pointer());
+        event.WaitForCompletion();
+        auto result_write = std::vector<float>(size);
+        device_buffer.Read(queue, size, result_write.data(), offset);
+        auto result_read = std::vector<float>(size);
+        device_buffer.ReadStaged(queue, size, result_read.data(), pool, offset);
+
+        // Compares the results: the data should be bit-identical
+        if (result_write == host && result_read == host) { passed++; } else { errors++; }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunBufferStagingTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
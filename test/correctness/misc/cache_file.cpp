@@ -0,0 +1,97 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for packaging compiled binaries into a cache file (see
+// 'SaveCacheFile' and 'LoadCacheFile'): after loading the file, no kernels should be compiled.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+size_t RunCacheFileTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+  fprintf(stdout, "* Testing SaveCacheFile and LoadCacheFile for 'AXPY'\n");
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  // Populates the device data
+  const auto n = size_t{1024};
+  const auto host_data = std::vector<float>(n, 1.0f);
+  auto x = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto y = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  queue.Finish();
+  const auto run_axpy = [&]() {
+    const auto status = Axpy(n, 2.0f, x(), 0, 1, y(), 0, 1, &queue_plain);
+    queue.Finish();
+    return status;
+  };
+
+  // Compiles the kernel and saves it into a file
+  const auto file_name = std::string{"clblast_test_cache_file.bin"};
+  auto status = run_axpy();
+  status = (status != StatusCode::kSuccess) ? status : SaveCacheFile({device()}, file_name);
+
+  // Loads the file into an empty cache: the kernel should not be compiled again
+  status = (status != StatusCode::kSuccess) ? status : ClearCache();
+  status = (status != StatusCode::kSuccess) ? status : LoadCacheFile(file_name);
+  status = (status != StatusCode::kSuccess) ? status : ResetStatistics();
+  status = (status != StatusCode::kSuccess) ? status : run_axpy();
+  auto statistics = Statistics{};
+  status = (status != StatusCode::kSuccess) ? status : GetStatistics(statistics);
+  if (status == StatusCode::kSuccess && statistics.num_compilations == 0) { passed++; } else { errors++; }
+  if (LoadCacheFile("") == StatusCode::kSuccess) { passed++; } else { errors++; }
+
+  // Tests an invalid and a missing file
+  auto file = fopen(file_name.c_str(), "w");
+  if (file == nullptr) { return 1; }
+  fprintf(file, "CLBlast binary cache file v1\n2\n5 5\nkey\n");
+  fclose(file);
+  if (LoadCacheFile(file_name) == StatusCode::kInvalidValue) { passed++; } else { errors++; }
+  std::remove(file_name.c_str());
+  if (LoadCacheFile(file_name) == StatusCode::kInvalidValue) { passed++; } else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunCacheFileTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
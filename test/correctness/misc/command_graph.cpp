@@ -0,0 +1,146 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the command graphs (GraphBeginCapture and friends): a captured
+// sequence of routines replayed twice should give the same results as calling the routines twice.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Compares two vectors with a relative margin
+bool MatchesGraph(const std::vector<float> &reference, const std::vector<float> &result) {
+  if (reference.size() != result.size()) { return false; }
+  for (auto i = size_t{0}; i < reference.size(); ++i) {
+    if (std::abs(reference[i] - result[i]) > 1e-3 * std::abs(reference[i]) + 1e-3) { return false; }
+  }
+  return true;
+}
+
+// The sequence of routines to capture: the DOT result depends on the AXPY result, which depends on
+// the GEMM result
+StatusCode RunGraphSequence(const size_t m, const size_t n, const size_t k,
+                            const Buffer<float> &a, const Buffer<float> &b, const Buffer<float> &c,
+                            const Buffer<float> &y, const Buffer<float> &dot, cl_command_queue queue) {
+  auto status = Gemm(Layout::kRowMajor, Transpose::kNo, Transpose::kYes, m, n, k, 1.5f,
+                     a(), 0, k, b(), 0, k, 0.5f, c(), 0, n, &queue);
+  status = (status != StatusCode::kSuccess) ? status :
+           Axpy(n, 2.0f, c(), 0, 1, y(), 0, 1, &queue);
+  status = (status != StatusCode::kSuccess) ? status :
+           Dot<float>(n, dot(), 0, c(), 0, 1, y(), 0, 1, &queue);
+  return status;
+}
+
+size_t RunCommandGraphTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  fprintf(stdout, "* Testing the capture and replay of command graphs\n");
+
+  // Populates the host data
+  const auto m = size_t{37};
+  const auto n = size_t{64};
+  const auto k = size_t{19};
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  auto host_a = std::vector<float>(m * k);
+  auto host_b = std::vector<float>(k * n);
+  auto host_c = std::vector<float>(m * n);
+  auto host_y = std::vector<float>(n);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+  PopulateVector(host_y, mt, dist);
+
+  // Two sets of device data: one for the reference and one for the graph
+  auto a = Buffer<float>(context, queue, host_a.begin(), host_a.end());
+  auto b = Buffer<float>(context, queue, host_b.begin(), host_b.end());
+  auto reference_c = Buffer<float>(context, queue, host_c.begin(), host_c.end());
+  auto reference_y = Buffer<float>(context, queue, host_y.begin(), host_y.end());
+  auto reference_dot = Buffer<float>(context, 1);
+  auto graph_c = Buffer<float>(context, queue, host_c.begin(), host_c.end());
+  auto graph_y = Buffer<float>(context, queue, host_y.begin(), host_y.end());
+  auto graph_dot = Buffer<float>(context, 1);
+
+  // The reference: calling the routines twice
+  auto status = RunGraphSequence(m, n, k, a, b, reference_c, reference_y, reference_dot, queue_plain);
+  status = (status != StatusCode::kSuccess) ? status :
+           RunGraphSequence(m, n, k, a, b, reference_c, reference_y, reference_dot, queue_plain);
+
+  // Captures the routines once (nothing is executed) and replays them twice
+  auto graph = static_cast<CommandGraph*>(nullptr);
+  status = (status != StatusCode::kSuccess) ? status : GraphBeginCapture(&queue_plain);
+  if (status == StatusCode::kSuccess) {
+    const auto capture_status = RunGraphSequence(m, n, k, a, b, graph_c, graph_y, graph_dot, queue_plain);
+    status = GraphEndCapture(&queue_plain, &graph);
+    status = (capture_status != StatusCode::kSuccess) ? capture_status : status;
+  }
+  status = (status != StatusCode::kSuccess) ? status : GraphLaunch(graph, &queue_plain);
+  status = (status != StatusCode::kSuccess) ? status : GraphLaunch(graph, &queue_plain);
+
+  // Compares the results
+  if (status == StatusCode::kSuccess) {
+    queue.Finish();
+    for (const auto &pair : {std::make_pair(&reference_c, &graph_c),
+                             std::make_pair(&reference_y, &graph_y),
+                             std::make_pair(&reference_dot, &graph_dot)}) {
+      const auto size = pair.first->GetSize() / sizeof(float);
+      auto expected = std::vector<float>(size);
+      auto result = std::vector<float>(size);
+      pair.first->Read(queue, size, expected);
+      pair.second->Read(queue, size, result);
+      if (MatchesGraph(expected, result)) { passed++; } else { errors++; }
+    }
+  }
+  else {
+    fprintf(stdout, "* Command graph failed with status %d\n", static_cast<int>(status));
+    errors++;
+  }
+  if (graph != nullptr) { GraphDestroy(graph); }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunCommandGraphTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
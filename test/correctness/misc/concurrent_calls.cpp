@@ -0,0 +1,186 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for concurrent calls from multiple host threads without any locking
+// by the caller, both on a single shared queue and on a queue per thread: the results of each
+// thread should match those of the same calls made from a single thread. Part of the threads are
+// short-lived, such that their kernel objects are created and removed while others are running.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <random>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The data of one host thread: its own inputs and output buffers
+template <typename T>
+struct ThreadData {
+  std::vector<T> host_a;
+  std::vector<T> host_b;
+  std::vector<T> host_c;
+  Buffer<T> a;
+  Buffer<T> b;
+  Buffer<T> c;
+  Buffer<T> y;
+};
+
+// Runs the mix of calls of one host thread: GEMM, GEMV and AXPY, all accumulating into 'c' or 'y'
+template <typename T>
+StatusCode RunThreadCalls(const size_t n, const size_t num_calls, ThreadData<T> &data,
+                          RawCommandQueue queue) {
+  const auto alpha = GetScalar<T>();
+  const auto beta = ConstantOne<T>();
+  auto status = StatusCode::kSuccess;
+  for (auto call = size_t{0}; call < num_calls && status == StatusCode::kSuccess; ++call) {
+    status = Gemm(Layout::kColMajor, Transpose::kNo, Transpose::kNo, n, n, n, alpha,
+                  data.a(), 0, n, data.b(), 0, n, beta, data.c(), 0, n, &queue);
+    status = (status != StatusCode::kSuccess) ? status :
+             Gemv(Layout::kColMajor, Transpose::kNo, n, n, alpha, data.a(), 0, n,
+                  data.b(), 0, 1, beta, data.y(), 0, 1, &queue);
+    status = (status != StatusCode::kSuccess) ? status :
+             Axpy(n, alpha, data.b(), n, 1, data.y(), 0, 1, &queue);
+  }
+  return status;
+}
+
+template <typename T>
+size_t RunConcurrentCallsTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto num_threads = GetArgument(arguments, help, "threads", size_t{8});
+  const auto num_calls = size_t{16};
+  const auto n = size_t{33};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing concurrent calls from %zu host threads for '%s'\n", num_threads,
+          routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto shared_queue : {true, false}) {
+
+    // Populates the inputs of all threads with different data
+    auto data = std::vector<ThreadData<T>>();
+    for (auto thread = size_t{0}; thread < num_threads; ++thread) {
+      auto host_a = std::vector<T>(n * n);
+      auto host_b = std::vector<T>(n * n);
+      auto host_c = std::vector<T>(n * n);
+      PopulateVector(host_a, mt, dist);
+      PopulateVector(host_b, mt, dist);
+      PopulateVector(host_c, mt, dist);
+      data.push_back(ThreadData<T>{host_a, host_b, host_c, Buffer<T>(context, n * n),
+                                   Buffer<T>(context, n * n), Buffer<T>(context, n * n),
+                                   Buffer<T>(context, n)});
+    }
+
+    // Computes the reference results by running the calls of all threads from this thread
+    auto references = std::vector<std::vector<T>>();
+    auto status = StatusCode::kSuccess;
+    for (auto &thread_data : data) {
+      thread_data.a.Write(queue, n * n, thread_data.host_a);
+      thread_data.b.Write(queue, n * n, thread_data.host_b);
+      thread_data.c.Write(queue, n * n, thread_data.host_c);
+      thread_data.y.Write(queue, n, thread_data.host_c);
+      const auto thread_status = RunThreadCalls(n, num_calls, thread_data, queue());
+      if (thread_status != StatusCode::kSuccess) { status = thread_status; }
+      auto reference = std::vector<T>(n * n + n);
+      thread_data.c.Read(queue, n * n, reference);
+      thread_data.y.Read(queue, n, reference.data() + n * n);
+      references.push_back(reference);
+    }
+    if (status != StatusCode::kSuccess) { errors++; continue; }
+
+    // Runs the same calls concurrently: every other thread is short-lived and only makes one call
+    // at a time, such that threads come and go while the others are running
+    for (auto &thread_data : data) {
+      thread_data.c.Write(queue, n * n, thread_data.host_c);
+      thread_data.y.Write(queue, n, thread_data.host_c);
+    }
+    queue.Finish();
+    auto queues = std::vector<Queue>();
+    for (auto thread = size_t{0}; thread < num_threads; ++thread) {
+      queues.push_back((shared_queue) ? queue : Queue(context, device));
+    }
+    auto statuses = std::vector<StatusCode>(num_threads, StatusCode::kSuccess);
+    auto threads = std::vector<std::thread>();
+    for (auto thread = size_t{0}; thread < num_threads; ++thread) {
+      threads.push_back(std::thread([&, thread]() {
+        if (thread % 2 == 0) {
+          statuses[thread] = RunThreadCalls(n, num_calls, data[thread], queues[thread]());
+          return;
+        }
+        for (auto call = size_t{0}; call < num_calls; ++call) {
+          auto call_thread = std::thread([&, thread]() {
+            const auto call_status = RunThreadCalls(n, 1, data[thread], queues[thread]());
+            if (call_status != StatusCode::kSuccess) { statuses[thread] = call_status; }
+          });
+          call_thread.join();
+        }
+      }));
+    }
+    for (auto &thread : threads) { thread.join(); }
+    for (auto &thread_queue : queues) { thread_queue.Finish(); }
+
+    // Compares the results of each thread with the reference
+    for (auto thread = size_t{0}; thread < num_threads; ++thread) {
+      if (statuses[thread] != StatusCode::kSuccess) { errors++; continue; }
+      auto result = std::vector<T>(n * n + n);
+      data[thread].c.Read(queue, n * n, result);
+      data[thread].y.Read(queue, n, result.data() + n * n);
+      auto matches = true;
+      for (auto i = size_t{0}; i < result.size(); ++i) {
+        const auto &reference = references[thread][i];
+        if (std::abs(reference - result[i]) > 1e-4 * std::abs(reference) + 1e-4) { matches = false; }
+      }
+      if (matches) { passed++; } else { errors++; }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunConcurrentCallsTests<float>(argc, argv, false, "SGEMM/SGEMV/SAXPY");
+  errors += clblast::RunConcurrentCallsTests<double>(argc, argv, true, "DGEMM/DGEMV/DAXPY");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
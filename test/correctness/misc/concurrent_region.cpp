@@ -0,0 +1,148 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the concurrent regions: many independent small GEMMs called
+// within 'BeginConcurrentRegion' and 'EndConcurrentRegion' are compared with the same GEMMs called
+// one after another on the queue.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+size_t RunConcurrentRegionTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  constexpr auto kNumGemms = size_t{16};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  // Independent problems of different sizes, all with their own matrices
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  const auto size = [](const size_t i) { return size_t{17} + 5 * i; };
+  auto a = std::vector<Buffer<float>>();
+  auto b = std::vector<Buffer<float>>();
+  auto c = std::vector<Buffer<float>>();
+  auto c_reference = std::vector<Buffer<float>>();
+  for (auto i = size_t{0}; i < kNumGemms; ++i) {
+    const auto n = size(i);
+    auto host = std::vector<float>(n * n);
+    for (auto &value : host) { value = dist(mt); }
+    a.emplace_back(context, n * n);
+    a.back().Write(queue, host.size(), host);
+    for (auto &value : host) { value = dist(mt); }
+    b.emplace_back(context, n * n);
+    b.back().Write(queue, host.size(), host);
+    for (auto &value : host) { value = dist(mt); }
+    c.emplace_back(context, n * n);
+    c.back().Write(queue, host.size(), host);
+    c_reference.emplace_back(context, n * n);
+    c_reference.back().Write(queue, host.size(), host);
+  }
+
+  // The reference: all GEMMs on the queue itself
+  for (auto i = size_t{0}; i < kNumGemms; ++i) {
+    const auto n = size(i);
+    const auto status = Gemm<float>(Layout::kColMajor, Transpose::kNo, Transpose::kNo, n, n, n,
+                                    0.5f, a[i](), 0, n, b[i](), 0, n, 2.0f,
+                                    c_reference[i](), 0, n, &queue_plain);
+    if (status != StatusCode::kSuccess) { errors++; }
+  }
+  queue.Finish();
+
+  // The same GEMMs in a concurrent region on several numbers of pool queues, followed by a scaling
+  // on the queue which has to wait for the region (applied once more to the reference)
+  for (const auto num_queues : {size_t{1}, size_t{3}, size_t{4}}) {
+    fprintf(stdout, "* Testing a concurrent region with %zu queue(s)\n", num_queues);
+    auto status = BeginConcurrentRegion(&queue_plain, num_queues);
+    if (status != StatusCode::kSuccess) { errors++; continue; }
+    status = BeginConcurrentRegion(&queue_plain, num_queues); // a region is active already
+    if (status == StatusCode::kInvalidOperation) { passed++; } else { errors++; }
+    auto region_errors = size_t{0};
+    for (auto i = size_t{0}; i < kNumGemms; ++i) {
+      const auto n = size(i);
+      status = Gemm<float>(Layout::kColMajor, Transpose::kNo, Transpose::kNo, n, n, n,
+                           0.5f, a[i](), 0, n, b[i](), 0, n, 2.0f, c[i](), 0, n, &queue_plain);
+      if (status != StatusCode::kSuccess) { region_errors++; }
+    }
+    auto event = cl_event{nullptr};
+    status = EndConcurrentRegion(&queue_plain, &event);
+    if (status != StatusCode::kSuccess || region_errors != 0) { errors++; continue; }
+    for (auto i = size_t{0}; i < kNumGemms; ++i) {
+      const auto n = size(i);
+      Scal<float>(n * n, 0.25f, c[i](), 0, 1, &queue_plain);
+      Scal<float>(n * n, 0.25f, c_reference[i](), 0, 1, &queue_plain);
+    }
+    clWaitForEvents(1, &event);
+    clReleaseEvent(event);
+    queue.Finish();
+
+    // Compares the results and copies the reference for the next iteration
+    auto matches = true;
+    for (auto i = size_t{0}; i < kNumGemms; ++i) {
+      const auto n = size(i);
+      auto result = std::vector<float>(n * n);
+      auto reference = std::vector<float>(n * n);
+      c[i].Read(queue, result.size(), result);
+      c_reference[i].Read(queue, reference.size(), reference);
+      for (auto j = size_t{0}; j < result.size(); ++j) {
+        if (std::abs(result[j] - reference[j]) > 1e-4f * std::abs(reference[j]) + 1e-4f) {
+          matches = false;
+        }
+      }
+      c[i].Write(queue, reference.size(), reference);
+    }
+    if (matches) { passed++; } else { errors++; }
+  }
+
+  // Ending a region which was never started is an error
+  if (EndConcurrentRegion(&queue_plain) == StatusCode::kInvalidOperation) { passed++; }
+  else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunConcurrentRegionTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,190 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the sparse matrix routines with a CSR matrix: the matrix-vector
+// multiplication (Csrmv) and the sparse-dense matrix multiplication (Csrmm) are compared against a
+// reference computed on the host. The test matrices contain empty rows as well as rows with many
+// more non-zeros than threads per row.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+#include <utility>
+#include <algorithm>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunCsrTests(int argc, char *argv[], const bool silent, const std::string &routine_name,
+                   const double tolerance) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Determines the test settings: the sizes of A (m by k) and the number of columns of B and C
+  const auto sizes = std::vector<std::pair<size_t, size_t>>{{1, 1}, {7, 13}, {64, 64}, {333, 129}};
+  const auto ns = std::vector<size_t>{1, 5, 70};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto betas = std::vector<T>{T{0}, T{0.5}};
+  const auto alpha = T{1.5};
+  const auto padding = size_t{3};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  fprintf(stdout, "* Testing the CSR sparse matrix routines for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &size : sizes) {
+    const auto m = size.first;
+    const auto k = size.second;
+
+    // Creates a sparse matrix with a varying number of non-zeros per row, including empty rows
+    auto row_ptr = std::vector<int>(m + 1, 0);
+    auto col_idx = std::vector<int>();
+    for (auto row = size_t{0}; row < m; ++row) {
+      const auto row_length = (row % 5 == 3) ? size_t{0} : (row * 7) % (k + 40) + 1;
+      for (auto index = size_t{0}; index < row_length; ++index) {
+        col_idx.push_back(static_cast<int>((row * 31 + index * 17) % k));
+      }
+      row_ptr[row + 1] = static_cast<int>(col_idx.size());
+    }
+    const auto nnz = col_idx.size();
+    auto values = std::vector<T>(std::max(nnz, size_t{1}));
+    PopulateVector(values, mt, dist);
+    col_idx.resize(std::max(nnz, size_t{1}));
+    auto device_row_ptr = Buffer<int>(context, row_ptr.size());
+    auto device_col_idx = Buffer<int>(context, col_idx.size());
+    auto device_values = Buffer<T>(context, values.size());
+    device_row_ptr.Write(queue, row_ptr.size(), row_ptr);
+    device_col_idx.Write(queue, col_idx.size(), col_idx);
+    device_values.Write(queue, values.size(), values);
+
+    // Tests the sparse matrix-vector multiplication with non-unit increments
+    for (const auto beta : betas) {
+      const auto x_inc = size_t{2};
+      const auto y_inc = size_t{3};
+      auto host_x = std::vector<T>(k * x_inc);
+      auto host_y = std::vector<T>(m * y_inc);
+      PopulateVector(host_x, mt, dist);
+      PopulateVector(host_y, mt, dist);
+      auto device_x = Buffer<T>(context, host_x.size());
+      auto device_y = Buffer<T>(context, host_y.size());
+      device_x.Write(queue, host_x.size(), host_x);
+      device_y.Write(queue, host_y.size(), host_y);
+      const auto status = Csrmv<T>(m, k, nnz, alpha,
+                                   device_row_ptr(), device_col_idx(), device_values(),
+                                   device_x(), 0, x_inc, beta,
+                                   device_y(), 0, y_inc, &queue_plain);
+      if (status != StatusCode::kSuccess) { errors++; continue; }
+      auto result = std::vector<T>(host_y.size());
+      device_y.Read(queue, result.size(), result);
+
+      auto matches = true;
+      for (auto row = size_t{0}; row < m; ++row) {
+        auto sum = T{0};
+        for (auto index = row_ptr[row]; index < row_ptr[row + 1]; ++index) {
+          sum += values[index] * host_x[col_idx[index] * x_inc];
+        }
+        const auto expected = alpha * sum + beta * host_y[row * y_inc];
+        if (std::abs(result[row * y_inc] - expected) > tolerance * (std::abs(expected) + 1.0)) {
+          matches = false;
+        }
+      }
+      if (matches) { passed++; } else { errors++; }
+    }
+
+    // Tests the sparse-dense matrix multiplication
+    for (const auto n : ns) {
+      for (const auto layout : layouts) {
+        for (const auto beta : betas) {
+          const auto col_major = (layout == Layout::kColMajor);
+          const auto b_ld = ((col_major) ? k : n) + padding;
+          const auto c_ld = ((col_major) ? m : n) + padding;
+          const auto b_index = [&](const size_t row, const size_t col) {
+            return (col_major) ? col * b_ld + row : row * b_ld + col;
+          };
+          const auto c_index = [&](const size_t row, const size_t col) {
+            return (col_major) ? col * c_ld + row : row * c_ld + col;
+          };
+          auto host_b = std::vector<T>(b_ld * ((col_major) ? n : k));
+          auto host_c = std::vector<T>(c_ld * ((col_major) ? n : m));
+          PopulateVector(host_b, mt, dist);
+          PopulateVector(host_c, mt, dist);
+          auto device_b = Buffer<T>(context, host_b.size());
+          auto device_c = Buffer<T>(context, host_c.size());
+          device_b.Write(queue, host_b.size(), host_b);
+          device_c.Write(queue, host_c.size(), host_c);
+          const auto status = Csrmm<T>(layout, m, n, k, nnz, alpha,
+                                       device_row_ptr(), device_col_idx(), device_values(),
+                                       device_b(), 0, b_ld, beta,
+                                       device_c(), 0, c_ld, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          auto result = std::vector<T>(host_c.size());
+          device_c.Read(queue, result.size(), result);
+
+          auto matches = true;
+          for (auto row = size_t{0}; row < m; ++row) {
+            for (auto col = size_t{0}; col < n; ++col) {
+              auto sum = T{0};
+              for (auto index = row_ptr[row]; index < row_ptr[row + 1]; ++index) {
+                sum += values[index] * host_b[b_index(col_idx[index], col)];
+              }
+              const auto expected = alpha * sum + beta * host_c[c_index(row, col)];
+              if (std::abs(result[c_index(row, col)] - expected) > tolerance * (std::abs(expected) + 1.0)) {
+                matches = false;
+              }
+            }
+          }
+          if (matches) { passed++; } else { errors++; }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunCsrTests<float>(argc, argv, false, "SCSR", 1e-4);
+  errors += clblast::RunCsrTests<double>(argc, argv, true, "DCSR", 1e-10);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
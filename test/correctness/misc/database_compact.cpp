@@ -0,0 +1,250 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the built-in database in compact form (see 'CompactDatabase'):
+// every device in the readable form of the database should be found with the same parameters, a
+// variant of a device's name should borrow that device's parameters, and unknown devices should
+// get the defaults of their architecture.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "database/database_structure.hpp"
+#include "database/database_compact.hpp"
+
+#include "database/kernels/copy/copy_16.hpp"
+#include "database/kernels/copy/copy_32.hpp"
+#include "database/kernels/copy/copy_3232.hpp"
+#include "database/kernels/copy/copy_64.hpp"
+#include "database/kernels/copy/copy_6464.hpp"
+#include "database/kernels/gemm_routine/gemm_routine_16.hpp"
+#include "database/kernels/gemm_routine/gemm_routine_32.hpp"
+#include "database/kernels/gemm_routine/gemm_routine_3232.hpp"
+#include "database/kernels/gemm_routine/gemm_routine_64.hpp"
+#include "database/kernels/gemm_routine/gemm_routine_6464.hpp"
+#include "database/kernels/invert/invert_16.hpp"
+#include "database/kernels/invert/invert_32.hpp"
+#include "database/kernels/invert/invert_3232.hpp"
+#include "database/kernels/invert/invert_64.hpp"
+#include "database/kernels/invert/invert_6464.hpp"
+#include "database/kernels/pad/pad_16.hpp"
+#include "database/kernels/pad/pad_32.hpp"
+#include "database/kernels/pad/pad_3232.hpp"
+#include "database/kernels/pad/pad_64.hpp"
+#include "database/kernels/pad/pad_6464.hpp"
+#include "database/kernels/padtranspose/padtranspose_16.hpp"
+#include "database/kernels/padtranspose/padtranspose_32.hpp"
+#include "database/kernels/padtranspose/padtranspose_3232.hpp"
+#include "database/kernels/padtranspose/padtranspose_64.hpp"
+#include "database/kernels/padtranspose/padtranspose_6464.hpp"
+#include "database/kernels/transpose/transpose_16.hpp"
+#include "database/kernels/transpose/transpose_32.hpp"
+#include "database/kernels/transpose/transpose_3232.hpp"
+#include "database/kernels/transpose/transpose_64.hpp"
+#include "database/kernels/transpose/transpose_6464.hpp"
+#include "database/kernels/trsm_routine/trsm_routine_16.hpp"
+#include "database/kernels/trsm_routine/trsm_routine_32.hpp"
+#include "database/kernels/trsm_routine/trsm_routine_3232.hpp"
+#include "database/kernels/trsm_routine/trsm_routine_64.hpp"
+#include "database/kernels/trsm_routine/trsm_routine_6464.hpp"
+#include "database/kernels/trsv_routine/trsv_routine_16.hpp"
+#include "database/kernels/trsv_routine/trsv_routine_32.hpp"
+#include "database/kernels/trsv_routine/trsv_routine_3232.hpp"
+#include "database/kernels/trsv_routine/trsv_routine_64.hpp"
+#include "database/kernels/trsv_routine/trsv_routine_6464.hpp"
+#include "database/kernels/xaxpy/xaxpy_16.hpp"
+#include "database/kernels/xaxpy/xaxpy_1616.hpp"
+#include "database/kernels/xaxpy/xaxpy_32.hpp"
+#include "database/kernels/xaxpy/xaxpy_3232.hpp"
+#include "database/kernels/xaxpy/xaxpy_64.hpp"
+#include "database/kernels/xaxpy/xaxpy_6464.hpp"
+#include "database/kernels/xconvgemm/xconvgemm_16.hpp"
+#include "database/kernels/xconvgemm/xconvgemm_32.hpp"
+#include "database/kernels/xconvgemm/xconvgemm_3232.hpp"
+#include "database/kernels/xconvgemm/xconvgemm_64.hpp"
+#include "database/kernels/xconvgemm/xconvgemm_6464.hpp"
+#include "database/kernels/xdot/xdot_16.hpp"
+#include "database/kernels/xdot/xdot_32.hpp"
+#include "database/kernels/xdot/xdot_3232.hpp"
+#include "database/kernels/xdot/xdot_64.hpp"
+#include "database/kernels/xdot/xdot_6464.hpp"
+#include "database/kernels/xgemm/xgemm_16.hpp"
+#include "database/kernels/xgemm/xgemm_1616.hpp"
+#include "database/kernels/xgemm/xgemm_1632.hpp"
+#include "database/kernels/xgemm/xgemm_32.hpp"
+#include "database/kernels/xgemm/xgemm_3232.hpp"
+#include "database/kernels/xgemm/xgemm_64.hpp"
+#include "database/kernels/xgemm/xgemm_6464.hpp"
+#include "database/kernels/xgemm/xgemm_832.hpp"
+#include "database/kernels/xgemm_direct/xgemm_direct_16.hpp"
+#include "database/kernels/xgemm_direct/xgemm_direct_32.hpp"
+#include "database/kernels/xgemm_direct/xgemm_direct_3232.hpp"
+#include "database/kernels/xgemm_direct/xgemm_direct_64.hpp"
+#include "database/kernels/xgemm_direct/xgemm_direct_6464.hpp"
+#include "database/kernels/xgemv/xgemv_16.hpp"
+#include "database/kernels/xgemv/xgemv_32.hpp"
+#include "database/kernels/xgemv/xgemv_3232.hpp"
+#include "database/kernels/xgemv/xgemv_64.hpp"
+#include "database/kernels/xgemv/xgemv_6464.hpp"
+#include "database/kernels/xgemv_banded/xgemv_banded_16.hpp"
+#include "database/kernels/xgemv_banded/xgemv_banded_32.hpp"
+#include "database/kernels/xgemv_banded/xgemv_banded_3232.hpp"
+#include "database/kernels/xgemv_banded/xgemv_banded_64.hpp"
+#include "database/kernels/xgemv_banded/xgemv_banded_6464.hpp"
+#include "database/kernels/xgemv_fast/xgemv_fast_16.hpp"
+#include "database/kernels/xgemv_fast/xgemv_fast_32.hpp"
+#include "database/kernels/xgemv_fast/xgemv_fast_3232.hpp"
+#include "database/kernels/xgemv_fast/xgemv_fast_64.hpp"
+#include "database/kernels/xgemv_fast/xgemv_fast_6464.hpp"
+#include "database/kernels/xgemv_fast_rot/xgemv_fast_rot_16.hpp"
+#include "database/kernels/xgemv_fast_rot/xgemv_fast_rot_32.hpp"
+#include "database/kernels/xgemv_fast_rot/xgemv_fast_rot_3232.hpp"
+#include "database/kernels/xgemv_fast_rot/xgemv_fast_rot_64.hpp"
+#include "database/kernels/xgemv_fast_rot/xgemv_fast_rot_6464.hpp"
+#include "database/kernels/xgemv_quantized/xgemv_quantized_16.hpp"
+#include "database/kernels/xgemv_quantized/xgemv_quantized_32.hpp"
+#include "database/kernels/xger/xger_16.hpp"
+#include "database/kernels/xger/xger_32.hpp"
+#include "database/kernels/xger/xger_3232.hpp"
+#include "database/kernels/xger/xger_64.hpp"
+#include "database/kernels/xger/xger_6464.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The readable form of the built-in database, as generated together with the compact form
+const std::vector<database::DatabaseEntry> kReadableDatabase = {
+    database::CopyHalf, database::CopySingle, database::CopyComplexSingle, database::CopyDouble,
+    database::CopyComplexDouble, database::GemmRoutineHalf, database::GemmRoutineSingle,
+    database::GemmRoutineComplexSingle, database::GemmRoutineDouble,
+    database::GemmRoutineComplexDouble, database::InvertHalf, database::InvertSingle,
+    database::InvertComplexSingle, database::InvertDouble, database::InvertComplexDouble,
+    database::PadHalf, database::PadSingle, database::PadComplexSingle, database::PadDouble,
+    database::PadComplexDouble, database::PadtransposeHalf, database::PadtransposeSingle,
+    database::PadtransposeComplexSingle, database::PadtransposeDouble,
+    database::PadtransposeComplexDouble, database::TransposeHalf, database::TransposeSingle,
+    database::TransposeComplexSingle, database::TransposeDouble, database::TransposeComplexDouble,
+    database::TrsmRoutineHalf, database::TrsmRoutineSingle, database::TrsmRoutineComplexSingle,
+    database::TrsmRoutineDouble, database::TrsmRoutineComplexDouble,
+    database::TrsvRoutineHalf, database::TrsvRoutineSingle, database::TrsvRoutineComplexSingle,
+    database::TrsvRoutineDouble, database::TrsvRoutineComplexDouble, database::XaxpyHalf,
+    database::XaxpyBFloat16, database::XaxpySingle, database::XaxpyComplexSingle,
+    database::XaxpyDouble, database::XaxpyComplexDouble, database::XconvgemmHalf,
+    database::XconvgemmSingle, database::XconvgemmComplexSingle, database::XconvgemmDouble,
+    database::XconvgemmComplexDouble, database::XdotHalf, database::XdotSingle,
+    database::XdotComplexSingle, database::XdotDouble, database::XdotComplexDouble,
+    database::XgemmHalf, database::XgemmBFloat16, database::XgemmHalfSingle, database::XgemmSingle,
+    database::XgemmComplexSingle, database::XgemmDouble, database::XgemmComplexDouble,
+    database::XgemmInt8, database::XgemmDirectHalf, database::XgemmDirectSingle,
+    database::XgemmDirectComplexSingle, database::XgemmDirectDouble,
+    database::XgemmDirectComplexDouble, database::XgemvHalf, database::XgemvSingle,
+    database::XgemvComplexSingle, database::XgemvDouble, database::XgemvComplexDouble,
+    database::XgemvBandedHalf, database::XgemvBandedSingle, database::XgemvBandedComplexSingle,
+    database::XgemvBandedDouble, database::XgemvBandedComplexDouble,
+    database::XgemvFastHalf, database::XgemvFastSingle, database::XgemvFastComplexSingle,
+    database::XgemvFastDouble, database::XgemvFastComplexDouble, database::XgemvFastRotHalf,
+    database::XgemvFastRotSingle, database::XgemvFastRotComplexSingle,
+    database::XgemvFastRotDouble, database::XgemvFastRotComplexDouble,
+    database::XgemvQuantizedHalf, database::XgemvQuantizedSingle, database::XgerHalf,
+    database::XgerSingle, database::XgerComplexSingle, database::XgerDouble,
+    database::XgerComplexDouble
+};
+
+// Removes the padding of a device name
+std::string TrimName(const database::Name &name) {
+  auto result = std::string(name.data());
+  result.erase(result.find_last_not_of(' ') + 1);
+  return result;
+}
+
+size_t RunDatabaseCompactTests(int, char *[]) {
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  fprintf(stdout, "\n* Testing the compact form of the built-in database\n");
+  const auto &compact = CompactDatabase::BuiltIn();
+
+  // Compares all devices, and an unknown device per architecture
+  for (const auto &entry : kReadableDatabase) {
+    for (const auto &vendor : entry.vendors) {
+      for (const auto &architecture : vendor.architectures) {
+        auto default_parameters = database::Parameters();
+        for (const auto &device : architecture.devices) {
+          auto expected = database::Parameters();
+          for (auto i = size_t{0}; i < entry.parameter_names.size(); ++i) {
+            expected[entry.parameter_names[i]] = device.parameters[i];
+          }
+          if (device.name == database::kDeviceNameDefault) { default_parameters = expected; }
+          const auto found = compact.Search(entry.kernel, entry.precision, vendor.name, vendor.type,
+                                            TrimName(device.name), architecture.name);
+          if (found == expected) { passed++; }
+          else {
+            fprintf(stdout, "    Mismatch for '%s' on '%s'\n", entry.kernel.c_str(),
+                    TrimName(device.name).c_str());
+            errors++;
+          }
+
+          // A sibling model which is not in the database (unless the name is too short to match)
+          const auto sibling = TrimName(device.name) + " X1";
+          if (device.name == database::kDeviceNameDefault ||
+              CompactDatabase::DeviceSimilarity(sibling, architecture.name, TrimName(device.name),
+                                                architecture.name) <
+              CompactDatabase::kMinDeviceSimilarity) { continue; }
+          const auto borrowed = compact.Search(entry.kernel, entry.precision, vendor.name,
+                                               vendor.type, sibling, architecture.name);
+          if (borrowed == expected) { passed++; }
+          else {
+            fprintf(stdout, "    No borrowing for '%s' on '%s'\n", entry.kernel.c_str(),
+                    sibling.c_str());
+            errors++;
+          }
+        }
+        if (default_parameters.empty()) { continue; }
+        const auto found = compact.Search(entry.kernel, entry.precision, vendor.name, vendor.type,
+                                          "Unknown device", architecture.name);
+        if (found == default_parameters) { passed++; } else { errors++; }
+      }
+    }
+  }
+
+  // Tests the similarity of devices
+  const auto minimum = CompactDatabase::kMinDeviceSimilarity;
+  const auto similar = CompactDatabase::DeviceSimilarity("NVIDIA GeForce RTX 3070", "SM8.6",
+                                                         "NVIDIA GeForce RTX 3080", "SM8.6");
+  if (similar > minimum && similar < 1.0) { passed++; } else { errors++; }
+  const auto other = CompactDatabase::DeviceSimilarity("NVIDIA GeForce RTX 3070", "SM8.6",
+                                                       "NVIDIA GeForce RTX 2070", "SM7.5");
+  if (other == 0.0) { passed++; } else { errors++; }
+
+  // Tests a kernel which does not exist
+  const auto found = compact.Search("Unknown", Precision::kSingle, "default",
+                                    database::kDeviceTypeAll, "default", "default");
+  if (found.empty()) { passed++; } else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunDatabaseCompactTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,138 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for loading database entries from a file at run-time (see
+// 'LoadDatabaseFile'): the entries should take precedence over the built-in database, until they
+// are removed again.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdio>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+size_t RunDatabaseFileTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+  fprintf(stdout, "* Testing LoadDatabaseFile for 'Xgemm'\n");
+
+  // Initializes the device
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+
+  // Writes a file with default parameters for all devices, which differ from the built-in ones
+  const auto file_name = std::string{"clblast_test_database_file.json"};
+  const auto file_parameters = std::unordered_map<std::string,size_t>{
+    {"GEMMK",0}, {"KREG",1}, {"KWG",16}, {"KWI",2}, {"MDIMA",4}, {"MDIMC",4}, {"MWG",16}, {"NDIMB",4},
+    {"NDIMC",4}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",3},
+    {"DBUF",0}, {"SWZ",0}, {"FAST_MATH",0}
+  };
+  auto file = fopen(file_name.c_str(), "w");
+  if (file == nullptr) { return 1; }
+  fprintf(file, "{\"version\": 1, \"entries\": [\n  {\"kernel\": \"Xgemm\", \"precision\": 32, ");
+  fprintf(file, "\"device_vendor\": \"default\", \"parameters\": {");
+  auto separator = "";
+  for (const auto &parameter : file_parameters) {
+    fprintf(file, "%s\"%s\": %zu", separator, parameter.first.c_str(), parameter.second);
+    separator = ", ";
+  }
+  fprintf(file, "}}\n]}\n");
+  fclose(file);
+
+  // Loads the file and verifies that its parameters are used
+  auto original = std::unordered_map<std::string,size_t>();
+  auto loaded = std::unordered_map<std::string,size_t>();
+  auto restored = std::unordered_map<std::string,size_t>();
+  auto status = RetrieveParameters(device(), "Xgemm", Precision::kSingle, original);
+  status = (status != StatusCode::kSuccess) ? status : LoadDatabaseFile(file_name);
+  status = (status != StatusCode::kSuccess) ? status : RetrieveParameters(device(), "Xgemm", Precision::kSingle, loaded);
+  if (status == StatusCode::kSuccess && loaded == file_parameters) { passed++; } else { errors++; }
+
+  // Removes the entries again, which should restore the built-in parameters
+  status = LoadDatabaseFile("");
+  status = (status != StatusCode::kSuccess) ? status : RetrieveParameters(device(), "Xgemm", Precision::kSingle, restored);
+  if (status == StatusCode::kSuccess && restored == original) { passed++; } else { errors++; }
+
+  // Writes records for ranges of driver versions: the range including the device's driver should
+  // be preferred over the version-agnostic record, and the others should never be used
+  const auto write_versioned_file = [&](const bool with_matching_range) -> bool {
+    const auto versioned_file = fopen(file_name.c_str(), "w");
+    if (versioned_file == nullptr) { return false; }
+    const auto ranges = std::vector<std::vector<std::string>>{
+      {"", ""}, {"999999", ""}, {device.DriverVersion(), device.DriverVersion()}, {"", "0"}
+    };
+    fprintf(versioned_file, "{\"version\": 1, \"entries\": [\n");
+    for (auto i = size_t{0}; i < ranges.size(); ++i) {
+      if (i == 2 && !with_matching_range) { continue; }
+      fprintf(versioned_file, "%s  {\"kernel\": \"Xgemm\", \"precision\": 32, ",
+              (i == 0) ? "" : ",\n");
+      fprintf(versioned_file, "\"driver_version_min\": \"%s\", \"driver_version_max\": \"%s\", ",
+              ranges[i][0].c_str(), ranges[i][1].c_str());
+      fprintf(versioned_file, "\"parameters\": {");
+      auto versioned_separator = "";
+      for (const auto &parameter : file_parameters) {
+        const auto value = (parameter.first == "KWG") ? 16 * (i + 1) : parameter.second;
+        fprintf(versioned_file, "%s\"%s\": %zu", versioned_separator, parameter.first.c_str(), value);
+        versioned_separator = ", ";
+      }
+      fprintf(versioned_file, "}}");
+    }
+    fprintf(versioned_file, "\n]}\n");
+    fclose(versioned_file);
+    return true;
+  };
+  for (const auto with_matching_range : {true, false}) {
+    auto versioned = std::unordered_map<std::string,size_t>();
+    status = (write_versioned_file(with_matching_range)) ? LoadDatabaseFile(file_name) : StatusCode::kDatabaseError;
+    status = (status != StatusCode::kSuccess) ? status : RetrieveParameters(device(), "Xgemm", Precision::kSingle, versioned);
+    const auto expected_kwg = size_t{(with_matching_range) ? 48 : 16};
+    if (status == StatusCode::kSuccess && versioned["KWG"] == expected_kwg) { passed++; } else { errors++; }
+  }
+  LoadDatabaseFile("");
+
+  // Tests an invalid and a missing file
+  file = fopen(file_name.c_str(), "w");
+  if (file == nullptr) { return 1; }
+  fprintf(file, "{\"version\": 1, \"entries\": [{\"kernel\": \"Xgemm\"}]}\n");
+  fclose(file);
+  if (LoadDatabaseFile(file_name) == StatusCode::kDatabaseError) { passed++; } else { errors++; }
+  std::remove(file_name.c_str());
+  if (LoadDatabaseFile(file_name) == StatusCode::kDatabaseError) { passed++; } else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunDatabaseFileTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,177 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the routines with device-resident scalars (AXPY, SCAL, GEMV, and
+// GEMM): these should give the same results as the regular routines with the scalars passed by
+// value.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <complex>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunDeviceScalarsTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Determines the test settings
+  const auto sizes = std::vector<size_t>{7, 64};
+  const auto transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  // The scalars are stored at non-zero offsets in a single device buffer
+  const auto alpha = GetScalar<T>();
+  const auto beta = alpha + alpha;
+  const auto host_scalars = std::vector<T>{ConstantZero<T>(), alpha, ConstantZero<T>(), beta};
+  const auto alpha_offset = size_t{1};
+  const auto beta_offset = size_t{3};
+  auto device_scalars = Buffer<T>(context, host_scalars.size());
+  device_scalars.Write(queue, host_scalars.size(), host_scalars);
+
+  // Compares the contents of two device buffers
+  const auto compare = [&](const Buffer<T> &reference, const Buffer<T> &result, const size_t size) {
+    auto host_reference = std::vector<T>(size);
+    auto host_result = std::vector<T>(size);
+    reference.Read(queue, size, host_reference);
+    result.Read(queue, size, host_result);
+    for (auto i = size_t{0}; i < size; ++i) {
+      if (std::abs(host_reference[i] - host_result[i]) > 1e-4 * std::abs(host_reference[i]) + 1e-5) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  fprintf(stdout, "* Testing the routines with device scalars for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto size : sizes) {
+    const auto m = size;
+    const auto n = size + 1;
+    const auto k = size + 2;
+
+    // Populates the host data with some example values
+    auto host_a = std::vector<T>(m * k);
+    auto host_b = std::vector<T>(k * n);
+    auto host_c = std::vector<T>(m * n);
+    PopulateVector(host_a, mt, dist);
+    PopulateVector(host_b, mt, dist);
+    PopulateVector(host_c, mt, dist);
+    auto device_a = Buffer<T>(context, host_a.size());
+    auto device_b = Buffer<T>(context, host_b.size());
+    auto device_reference = Buffer<T>(context, host_c.size());
+    auto device_result = Buffer<T>(context, host_c.size());
+    device_a.Write(queue, host_a.size(), host_a);
+    device_b.Write(queue, host_b.size(), host_b);
+    const auto reset = [&]() {
+      device_reference.Write(queue, host_c.size(), host_c);
+      device_result.Write(queue, host_c.size(), host_c);
+    };
+
+    // AXPY
+    reset();
+    auto status = Axpy(n, alpha, device_b(), 0, 1, device_reference(), 0, 1, &queue_plain);
+    status = (status != StatusCode::kSuccess) ? status :
+             AxpyDevice<T>(n, device_scalars(), alpha_offset, device_b(), 0, 1,
+                           device_result(), 0, 1, &queue_plain);
+    if (status == StatusCode::kSuccess && compare(device_reference, device_result, n)) { passed++; }
+    else { errors++; }
+
+    // SCAL
+    reset();
+    status = Scal(n, alpha, device_reference(), 0, 1, &queue_plain);
+    status = (status != StatusCode::kSuccess) ? status :
+             ScalDevice<T>(n, device_scalars(), alpha_offset, device_result(), 0, 1, &queue_plain);
+    if (status == StatusCode::kSuccess && compare(device_reference, device_result, n)) { passed++; }
+    else { errors++; }
+
+    // GEMV
+    for (const auto a_transpose : transposes) {
+      const auto y_size = (a_transpose == Transpose::kNo) ? m : k;
+      reset();
+      status = Gemv(Layout::kColMajor, a_transpose, m, k, alpha, device_a(), 0, m,
+                    device_b(), 0, 1, beta, device_reference(), 0, 1, &queue_plain);
+      status = (status != StatusCode::kSuccess) ? status :
+               GemvDevice<T>(Layout::kColMajor, a_transpose, m, k, device_scalars(), alpha_offset,
+                             device_a(), 0, m, device_b(), 0, 1, device_scalars(), beta_offset,
+                             device_result(), 0, 1, &queue_plain);
+      if (status == StatusCode::kSuccess && compare(device_reference, device_result, y_size)) {
+        passed++;
+      }
+      else { errors++; }
+    }
+
+    // GEMM: the transposed versions use the same data with different leading dimensions
+    for (const auto a_transpose : transposes) {
+      for (const auto b_transpose : transposes) {
+        const auto a_ld = (a_transpose == Transpose::kNo) ? m : k;
+        const auto b_ld = (b_transpose == Transpose::kNo) ? k : n;
+        reset();
+        status = Gemm(Layout::kColMajor, a_transpose, b_transpose, m, n, k, alpha,
+                      device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                      device_reference(), 0, m, &queue_plain);
+        status = (status != StatusCode::kSuccess) ? status :
+                 GemmDevice<T>(Layout::kColMajor, a_transpose, b_transpose, m, n, k,
+                               device_scalars(), alpha_offset,
+                               device_a(), 0, a_ld, device_b(), 0, b_ld,
+                               device_scalars(), beta_offset,
+                               device_result(), 0, m, &queue_plain);
+        if (status == StatusCode::kSuccess && compare(device_reference, device_result, m * n)) {
+          passed++;
+        }
+        else { errors++; }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunDeviceScalarsTests<float>(argc, argv, false, "SAXPY/SSCAL/SGEMV/SGEMM");
+  errors += clblast::RunDeviceScalarsTests<clblast::float2>(argc, argv, true, "CAXPY/CSCAL/CGEMV/CGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,117 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the on-disk cache of compiled binaries (see
+// 'SetCacheDirectory'): a kernel built with the directory set is stored on disk, such that after
+// clearing the in-memory caches it is loaded from disk instead of compiled. Without the directory
+// it is compiled again.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <iostream>
+#ifdef _WIN32
+  #include <direct.h>
+#else
+  #include <sys/stat.h>
+#endif
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+size_t RunDiskCacheTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+  fprintf(stdout, "* Testing SetCacheDirectory for 'AXPY'\n");
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  // Populates the device data
+  const auto n = size_t{1024};
+  const auto host_data = std::vector<float>(n, 1.0f);
+  auto x = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto y = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  queue.Finish();
+
+  // Runs the routine from empty in-memory caches and retrieves the statistics of the call
+  auto statistics = Statistics{};
+  const auto run_axpy = [&]() -> StatusCode {
+    auto status = ClearCache();
+    status = (status != StatusCode::kSuccess) ? status : ResetStatistics();
+    status = (status != StatusCode::kSuccess) ? status : Axpy(n, 2.0f, x(), 0, 1, y(), 0, 1,
+                                                               &queue_plain);
+    queue.Finish();
+    return (status != StatusCode::kSuccess) ? status : GetStatistics(statistics);
+  };
+
+  // The directory has to exist already, it is kept for later runs
+  const auto directory = std::string{"clblast_test_disk_cache"};
+  #ifdef _WIN32
+    _mkdir(directory.c_str());
+  #else
+    mkdir(directory.c_str(), 0755);
+  #endif
+
+  // The kernel is compiled and stored on disk, or loaded in case an earlier run stored it already
+  auto status = SetCacheDirectory(directory);
+  status = (status != StatusCode::kSuccess) ? status : run_axpy();
+  if (status == StatusCode::kSuccess &&
+      statistics.num_compilations + statistics.num_binary_loads > 0) { passed++; }
+  else { errors++; }
+
+  // With the in-memory caches cleared, the kernel is loaded from disk instead of compiled
+  status = (status != StatusCode::kSuccess) ? status : run_axpy();
+  if (status == StatusCode::kSuccess && statistics.num_compilations == 0 &&
+      statistics.num_binary_loads > 0) { passed++; }
+  else {
+    fprintf(stdout, "    Error: %zu compilation(s) and %zu binary load(s) with the directory\n",
+            statistics.num_compilations, statistics.num_binary_loads);
+    errors++;
+  }
+
+  // Without the directory, the kernel is compiled again
+  status = (status != StatusCode::kSuccess) ? status : SetCacheDirectory("");
+  status = (status != StatusCode::kSuccess) ? status : run_axpy();
+  if (status == StatusCode::kSuccess && statistics.num_compilations > 0) { passed++; }
+  else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunDiskCacheTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,174 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the generalised elementwise routine: the results of a number of
+// expressions are compared against a host reference, both with unit strides (the vectorised kernels)
+// and with strided vectors, and for expressions with and without the use of vector y.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Computes the elementwise expression for a single element on the host
+template <typename T>
+T ElementwiseReference(const std::vector<ElementwiseOp> &operations, const T x, const T y,
+                       const T low, const T high) {
+  auto value = x;
+  for (const auto operation : operations) {
+    switch (operation) {
+      case ElementwiseOp::kMultiply: value = value * y; break;
+      case ElementwiseOp::kDivide: value = value / y; break;
+      case ElementwiseOp::kAdd: value = value + y; break;
+      case ElementwiseOp::kSubtract: value = value - y; break;
+      case ElementwiseOp::kMax: value = std::max(value, y); break;
+      case ElementwiseOp::kMin: value = std::min(value, y); break;
+      case ElementwiseOp::kExp: value = std::exp(value); break;
+      case ElementwiseOp::kLog: value = std::log(value); break;
+      case ElementwiseOp::kAbs: value = std::abs(value); break;
+      case ElementwiseOp::kClamp: value = std::min(std::max(value, low), high); break;
+    }
+  }
+  return value;
+}
+
+template <typename T>
+size_t RunElementwiseTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Determines the test settings: the expressions, with vector y strictly positive such that the
+  // divisions are well-defined, and sizes for both the general and the vectorised kernels
+  const auto expressions = std::vector<std::vector<ElementwiseOp>>{
+    {},
+    {ElementwiseOp::kMultiply},
+    {ElementwiseOp::kDivide, ElementwiseOp::kExp},
+    {ElementwiseOp::kMax, ElementwiseOp::kClamp},
+    {ElementwiseOp::kSubtract, ElementwiseOp::kAbs, ElementwiseOp::kLog},
+    {ElementwiseOp::kMin, ElementwiseOp::kAdd},
+    {ElementwiseOp::kAbs, ElementwiseOp::kClamp}
+  };
+  const auto sizes = std::vector<size_t>{7, 4096};
+  const auto increments = std::vector<size_t>{1, 2};
+  const auto low = static_cast<T>(-0.5);
+  const auto high = static_cast<T>(1.5);
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  fprintf(stdout, "* Testing the elementwise expressions for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &operations : expressions) {
+    const auto uses_y = std::any_of(operations.begin(), operations.end(),
+                                    [](const ElementwiseOp operation) {
+                                      return operation != ElementwiseOp::kExp &&
+                                             operation != ElementwiseOp::kLog &&
+                                             operation != ElementwiseOp::kAbs &&
+                                             operation != ElementwiseOp::kClamp;
+                                    });
+    for (const auto n : sizes) {
+      for (const auto inc : increments) {
+        const auto alpha = GetScalar<T>();
+        const auto beta = GetScalar<T>();
+        const auto size = n * inc;
+
+        // Populates the vectors with some example data
+        auto host_x = std::vector<T>(size);
+        auto host_y = std::vector<T>(size);
+        auto host_z = std::vector<T>(size);
+        PopulateVector(host_x, mt, dist);
+        PopulateVector(host_y, mt, dist);
+        PopulateVector(host_z, mt, dist);
+        for (auto &value : host_y) { value = std::abs(value) + static_cast<T>(1); }
+        auto device_x = Buffer<T>(context, size);
+        auto device_y = Buffer<T>(context, size);
+        auto device_z = Buffer<T>(context, size);
+        device_x.Write(queue, size, host_x);
+        device_y.Write(queue, size, host_y);
+        device_z.Write(queue, size, host_z);
+
+        // Runs the routine, without vector y if the expression doesn't use it
+        const auto y_buffer = (uses_y) ? device_y() : nullptr;
+        const auto status = Elementwise(operations, n, alpha, device_x(), 0, inc,
+                                        y_buffer, 0, inc, beta, device_z(), 0, inc,
+                                        low, high, &queue_plain);
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+
+        // Compares the results with the host reference, including the untouched strided elements
+        auto host_result = std::vector<T>(size);
+        device_z.Read(queue, size, host_result);
+        auto matches = true;
+        for (auto i = size_t{0}; i < size; ++i) {
+          auto reference = host_z[i];
+          if (i % inc == 0) {
+            const auto value = ElementwiseReference(operations, host_x[i], host_y[i], low, high);
+            reference = alpha * value + beta * host_z[i];
+          }
+          const auto difference = std::abs(reference - host_result[i]);
+          if (difference > 1e-4 * std::abs(reference) + 1e-4) { matches = false; }
+        }
+        if (matches) { passed++; } else { errors++; }
+      }
+    }
+  }
+
+  // Complex data-types only support the operations without a complex counterpart in the kernels
+  auto complex_queue = queue();
+  auto device_complex = Buffer<float2>(context, 1);
+  const auto complex_status = Elementwise({ElementwiseOp::kExp}, 1, float2{1.0f, 0.0f},
+                                          device_complex(), 0, 1, nullptr, 0, 1,
+                                          float2{0.0f, 0.0f}, device_complex(), 0, 1,
+                                          float2{0.0f, 0.0f}, float2{0.0f, 0.0f},
+                                          &complex_queue);
+  if (complex_status == StatusCode::kNotImplemented) { passed++; } else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunElementwiseTests<float>(argc, argv, false, "SELEMENTWISE");
+  errors += clblast::RunElementwiseTests<double>(argc, argv, true, "DELEMENTWISE");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,130 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the explanation of GEMM calls: with overridden parameters that
+// force the direct or the in-direct kernel, the explanation should report that version, the
+// overridden parameters with their source, and the matching temporary buffers and kernel launches.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Tests whether an explanation reports the expected version and the overridden parameters
+bool IsExpectedExplanation(const GemmExplanation &explanation, const std::string &path,
+                           const size_t min_indirect_size) {
+  if (explanation.path != path || explanation.launches.empty()) { return false; }
+  auto found_overridden_parameters = false;
+  for (const auto &kernel_parameters : explanation.parameters) {
+    if (kernel_parameters.kernel_name != "GemmRoutine") { continue; }
+    const auto parameter = kernel_parameters.parameters.find("XGEMM_MIN_INDIRECT_SIZE");
+    found_overridden_parameters = kernel_parameters.source == ParameterSource::kOverride &&
+                                  parameter != kernel_parameters.parameters.end() &&
+                                  parameter->second == min_indirect_size;
+  }
+  for (const auto &launch : explanation.launches) {
+    if (launch.num_dimensions == 0 || launch.kernel_name.empty()) { return false; }
+  }
+  return found_overridden_parameters;
+}
+
+template <typename T>
+size_t RunExplainGemmTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Determines the test settings
+  const auto shapes = std::vector<std::vector<size_t>>{{300, 200, 150}, {257, 129, 65}};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Forces the in-direct kernel for all sizes and then the direct kernel for all sizes
+  fprintf(stdout, "* Testing the explanation of '%s'\n", routine_name.c_str());
+  const auto min_indirect_sizes = std::vector<size_t>{0, 1 << 30};
+  for (const auto min_indirect_size : min_indirect_sizes) {
+    const auto status = OverrideParameters(device(), "GemmRoutine", PrecisionValue<T>(),
+                                           {{"XGEMM_MIN_INDIRECT_SIZE", min_indirect_size},
+                                            {"XGEMM_MIN_SPLITK_K", 1 << 30},
+                                            {"XGEMM_MIN_3M_SIZE", 0}, {"XGEMM_MAX_ALT_SIZE", 0},
+                                            {"XGEMM_INDIRECT_COPY_COST", 0},
+                                            {"XGEMM_MIN_STRASSEN_SIZE", 0}});
+    if (status != StatusCode::kSuccess) { return 1; }
+    const auto path = std::string{(min_indirect_size == 0) ? "indirect" : "direct"};
+    for (const auto &shape : shapes) {
+      for (const auto layout : layouts) {
+        const auto m = shape[0];
+        const auto n = shape[1];
+        const auto k = shape[2];
+        const auto a_ld = (layout == Layout::kColMajor) ? m : k;
+        const auto b_ld = (layout == Layout::kColMajor) ? k : n;
+        const auto c_ld = (layout == Layout::kColMajor) ? m : n;
+
+        // Explains the call and compares the temporary buffers with the stand-alone query
+        auto explanation = GemmExplanation{};
+        auto temp_buffer_size = size_t{0};
+        if (ExplainGemm<T>(layout, Transpose::kNo, Transpose::kNo, m, n, k, 0, a_ld, 0, b_ld,
+                           0, c_ld, &queue(), explanation) != StatusCode::kSuccess ||
+            GemmTempBufferSize<T>(layout, Transpose::kNo, Transpose::kNo, m, n, k, 0, a_ld,
+                                  0, b_ld, 0, c_ld, &queue(), temp_buffer_size) != StatusCode::kSuccess) {
+          errors++;
+          continue;
+        }
+        auto total_temp_size = size_t{0};
+        for (const auto size : explanation.temp_buffer_sizes) { total_temp_size += size; }
+        const auto matches_temp_size = (path == "direct") ?
+                                       (explanation.launches.size() == 1 && total_temp_size == 0) :
+                                       (total_temp_size == temp_buffer_size);
+        if (IsExpectedExplanation(explanation, path, min_indirect_size) && matches_temp_size) {
+          passed++;
+        }
+        else { errors++; }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunExplainGemmTests<float>(argc, argv, false, "SGEMM");
+  errors += clblast::RunExplainGemmTests<double>(argc, argv, true, "DGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
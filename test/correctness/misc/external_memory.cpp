@@ -0,0 +1,96 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the import of external memory and semaphores. Without another
+// API exporting memory these only test the error handling: on devices without the extensions the
+// imports should report 'kNotImplemented', otherwise an invalid handle should be rejected. An
+// acquisition and a release without any buffers or semaphores should do nothing.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+size_t RunExternalMemoryTests(int argc, char *argv[], const bool silent) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  fprintf(stdout, "* Testing the import of external memory and semaphores\n");
+
+  // Acquires and releases nothing
+  auto event = cl_event{nullptr};
+  auto status = AcquireExternalMemory({}, {}, &queue_plain, &event);
+  if (status == StatusCode::kSuccess && event == nullptr) { passed++; } else { errors++; }
+  status = ReleaseExternalMemory({}, {}, &queue_plain, &event);
+  if (status == StatusCode::kSuccess && event == nullptr) { passed++; } else { errors++; }
+
+  // Imports memory from an invalid file descriptor
+  const auto invalid_handle = intptr_t{-1};
+  auto buffer = cl_mem{nullptr};
+  status = ImportExternalMemory(context(), device(), ExternalMemoryHandle::kOpaqueFd,
+                                invalid_handle, 1024, &buffer);
+  if (!device.HasExtension("cl_khr_external_memory")) {
+    if (status == StatusCode::kNotImplemented) { passed++; } else { errors++; }
+  }
+  else {
+    if (status != StatusCode::kSuccess) { passed++; } else { errors++; clReleaseMemObject(buffer); }
+  }
+
+  // Imports a semaphore from an invalid file descriptor
+  auto semaphore = ExternalSemaphore{nullptr};
+  status = ImportExternalSemaphore(context(), device(), ExternalSemaphoreHandle::kOpaqueFd,
+                                   invalid_handle, &semaphore);
+  if (!device.HasExtension("cl_khr_external_semaphore")) {
+    if (status == StatusCode::kNotImplemented) { passed++; } else { errors++; }
+  }
+  else {
+    if (status != StatusCode::kSuccess) { passed++; }
+    else { errors++; ReleaseExternalSemaphore(device(), semaphore); }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunExternalMemoryTests(argc, argv, false);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,151 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the fast math mode: GEMMs computed in the fast mode (globally,
+// through a handle, or selected by the 'FAST_MATH' parameter) should be close to those computed in
+// the precise mode, and the programs of both modes should be kept apart in the caches.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+size_t RunFastMathTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  // The matrices, with the same initial C for every run
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  const auto n = size_t{67};
+  auto host = std::vector<float>(n * n);
+  for (auto &value : host) { value = dist(mt); }
+  auto a = Buffer<float>(context, n * n);
+  a.Write(queue, host.size(), host);
+  for (auto &value : host) { value = dist(mt); }
+  auto b = Buffer<float>(context, n * n);
+  b.Write(queue, host.size(), host);
+  auto host_c = std::vector<float>(n * n);
+  for (auto &value : host_c) { value = dist(mt); }
+  auto c = Buffer<float>(context, n * n);
+
+  // Runs a GEMM on the queue or through a handle and returns the result
+  const auto run_gemm = [&](Handle* handle, std::vector<float> &result) -> StatusCode {
+    c.Write(queue, host_c.size(), host_c);
+    const auto status = (handle != nullptr) ?
+        Gemm<float>(handle, Layout::kColMajor, Transpose::kNo, Transpose::kYes, n, n, n,
+                    0.5f, a(), 0, n, b(), 0, n, 2.0f, c(), 0, n) :
+        Gemm<float>(Layout::kColMajor, Transpose::kNo, Transpose::kYes, n, n, n,
+                    0.5f, a(), 0, n, b(), 0, n, 2.0f, c(), 0, n, &queue_plain);
+    if (status != StatusCode::kSuccess) { return status; }
+    queue.Finish();
+    result = std::vector<float>(n * n);
+    c.Read(queue, result.size(), result);
+    return StatusCode::kSuccess;
+  };
+  const auto is_close = [](const std::vector<float> &result, const std::vector<float> &reference) {
+    for (auto i = size_t{0}; i < reference.size(); ++i) {
+      if (std::abs(result[i] - reference[i]) > 1e-3f * std::abs(reference[i]) + 1e-3f) { return false; }
+    }
+    return true;
+  };
+
+  // Computes the reference in the precise mode
+  auto reference = std::vector<float>();
+  if (SetMathMode(MathMode::kPrecise) != StatusCode::kSuccess ||
+      run_gemm(nullptr, reference) != StatusCode::kSuccess) {
+    std::cout << "    failed to compute the reference" << std::endl;
+    return 1;
+  }
+
+  // Runs the same GEMM in the fast mode globally
+  fprintf(stdout, "* Testing GEMM in the global fast math mode\n");
+  auto result = std::vector<float>();
+  auto status = SetMathMode(MathMode::kFast);
+  if (status == StatusCode::kSuccess) { status = run_gemm(nullptr, result); }
+  if (status == StatusCode::kSuccess && is_close(result, reference)) { passed++; } else { errors++; }
+  SetMathMode(MathMode::kDefault);
+
+  // Runs it through a handle in the fast mode and then in the precise mode: both should miss the
+  // handle's program cache, as their programs differ
+  fprintf(stdout, "* Testing GEMM through a handle in the fast and precise math modes\n");
+  auto handle = static_cast<Handle*>(nullptr);
+  if (HandleCreate(&queue_plain, &handle) != StatusCode::kSuccess) {
+    std::cout << "    failed to create a handle" << std::endl;
+    return 1;
+  }
+  auto statistics = std::vector<HandleStatistics>(2);
+  const auto modes = std::vector<MathMode>{MathMode::kFast, MathMode::kPrecise};
+  for (auto i = size_t{0}; i < modes.size(); ++i) {
+    status = HandleSetMathMode(handle, modes[i]);
+    if (status == StatusCode::kSuccess) { status = run_gemm(handle, result); }
+    if (status == StatusCode::kSuccess && is_close(result, reference)) { passed++; } else { errors++; }
+    if (HandleGetStatistics(handle, statistics[i]) != StatusCode::kSuccess) { errors++; }
+  }
+  if (statistics[0].program_cache_misses > 0 &&
+      statistics[1].program_cache_misses > statistics[0].program_cache_misses) { passed++; }
+  else { errors++; }
+  if (HandleDestroy(handle) == StatusCode::kSuccess) { passed++; } else { errors++; }
+
+  // Selects the fast mode for the GEMM kernel only through its 'FAST_MATH' parameter
+  fprintf(stdout, "* Testing GEMM with the 'FAST_MATH' parameter of the Xgemm kernel\n");
+  auto parameters = std::unordered_map<std::string,size_t>();
+  status = RetrieveParameters(device(), "Xgemm", Precision::kSingle, parameters);
+  if (status == StatusCode::kSuccess && parameters.find("FAST_MATH") != parameters.end()) {
+    parameters["FAST_MATH"] = 1;
+    status = OverrideParameters(device(), "Xgemm", Precision::kSingle, parameters);
+    if (status == StatusCode::kSuccess) { status = run_gemm(nullptr, result); }
+    if (status == StatusCode::kSuccess && is_close(result, reference)) { passed++; } else { errors++; }
+    parameters["FAST_MATH"] = 0;
+    OverrideParameters(device(), "Xgemm", Precision::kSingle, parameters);
+  }
+  else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunFastMathTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,149 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for pre-filling the caches (see 'FillCache'): a selection of
+// routines and precisions adds only their programs to the program cache, after which those routines
+// find their binaries in the cache while others still compile. It also tests that routine calls are
+// correct while 'FillCacheAsync' is compiling in the background.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "cache.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Runs AXPY (or SCAL) on a vector of ones and checks the results
+bool RunFillCacheRoutine(const Context &context, Queue &queue, const size_t n, const bool scal) {
+  auto queue_plain = queue();
+  const auto host_data = std::vector<float>(n, 1.0f);
+  auto x = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto y = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  const auto status = (scal) ? Scal(n, 2.0f, y(), 0, 1, &queue_plain) :
+                               Axpy(n, 2.0f, x(), 0, 1, y(), 0, 1, &queue_plain);
+  if (status != StatusCode::kSuccess) { return false; }
+  auto result = std::vector<float>(n);
+  y.Read(queue, n, result);
+  for (const auto value : result) {
+    if (value != ((scal) ? 2.0f : 3.0f)) { return false; }
+  }
+  return true;
+}
+
+// Retrieves the statistics since the last reset
+Statistics GetFillCacheStatistics() {
+  auto statistics = Statistics{};
+  GetStatistics(statistics);
+  return statistics;
+}
+
+size_t RunFillCacheTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+  fprintf(stdout, "* Testing FillCache and FillCacheAsync\n");
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  const auto n = size_t{1024};
+
+  // Fills the cache for single-precision AXPY only: this adds its programs to the program cache
+  ClearCache();
+  ResetStatistics();
+  const auto status = FillCache(device(), {"axpy"}, {Precision::kSingle});
+  const auto num_programs = ProgramCache::Instance().Size();
+  const auto statistics = GetFillCacheStatistics();
+  if (status == StatusCode::kSuccess && num_programs > 0 &&
+      statistics.num_compilations + statistics.num_binary_loads > 0) { passed++; }
+  else {
+    fprintf(stdout, "    Error: status %d and %zu program(s) after FillCache\n",
+            static_cast<int>(status), num_programs);
+    errors++;
+  }
+
+  // The same selection again compiles nothing: the binaries are found in the cache
+  ResetStatistics();
+  const auto status_again = FillCache(device(), {"AXPY"}, {Precision::kSingle});
+  const auto statistics_again = GetFillCacheStatistics();
+  if (status_again == StatusCode::kSuccess && statistics_again.num_compilations == 0 &&
+      statistics_again.binary_cache_hits > 0) { passed++; }
+  else { errors++; }
+
+  // An unknown routine is rejected before anything is compiled
+  const auto num_programs_before = ProgramCache::Instance().Size();
+  const auto status_unknown = FillCache(device(), {"AXPY", "NOTAROUTINE"}, {Precision::kSingle});
+  if (status_unknown == StatusCode::kInvalidValue &&
+      ProgramCache::Instance().Size() == num_programs_before) { passed++; }
+  else { errors++; }
+
+  // AXPY in another context hits the binary cache, whereas SCAL (not selected) is compiled
+  ResetStatistics();
+  const auto axpy_correct = RunFillCacheRoutine(context, queue, n, false);
+  const auto statistics_axpy = GetFillCacheStatistics();
+  if (axpy_correct && statistics_axpy.num_compilations == 0 &&
+      statistics_axpy.binary_cache_hits > 0) { passed++; }
+  else {
+    fprintf(stdout, "    Error: %zu compilation(s) and %zu binary cache hit(s) for AXPY\n",
+            statistics_axpy.num_compilations, statistics_axpy.binary_cache_hits);
+    errors++;
+  }
+  ResetStatistics();
+  const auto scal_correct = RunFillCacheRoutine(context, queue, n, true);
+  if (scal_correct && GetFillCacheStatistics().num_compilations > 0) { passed++; }
+  else { errors++; }
+
+  // A second AXPY call hits the program cache of its context
+  ResetStatistics();
+  const auto axpy_again_correct = RunFillCacheRoutine(context, queue, n, false);
+  const auto statistics_axpy_again = GetFillCacheStatistics();
+  if (axpy_again_correct && statistics_axpy_again.program_cache_hits > 0 &&
+      statistics_axpy_again.program_cache_misses == 0) { passed++; }
+  else { errors++; }
+
+  // Routine calls are correct while the cache is filled in the background. The process waits for
+  // the warm-up to finish before exiting.
+  ClearCache();
+  const auto status_async = FillCacheAsync(device());
+  const auto async_correct = RunFillCacheRoutine(context, queue, n, false) &&
+                             RunFillCacheRoutine(context, queue, n, true);
+  if (status_async == StatusCode::kSuccess && async_correct) { passed++; }
+  else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunFillCacheTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,148 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the 3M version of complex GEMM: the results computed using three
+// real-valued GEMMs should match those of the regular complex GEMM up to the rounding errors.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Selects the indirect kernel with (min_3m_size == 1) or without (min_3m_size == 0) the 3M version
+template <typename T>
+StatusCode Select3M(const Device &device, const size_t min_3m_size) {
+  return OverrideParameters(device(), "GemmRoutine", PrecisionValue<T>(),
+                            {{"XGEMM_MIN_INDIRECT_SIZE", 0}, {"XGEMM_MIN_SPLITK_K", 0},
+                             {"XGEMM_MIN_3M_SIZE", min_3m_size}, {"XGEMM_MAX_ALT_SIZE", 0},
+                             {"XGEMM_INDIRECT_COPY_COST", 0}, {"XGEMM_MIN_STRASSEN_SIZE", 0}});
+}
+
+template <typename T>
+size_t RunGemm3MTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // Determines the test settings, including non-multiples of the tile sizes
+  const auto shapes = std::vector<std::vector<size_t>>{{64, 64, 64}, {67, 33, 129}, {5, 130, 17}};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes, Transpose::kConjugate};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing the 3M GEMM for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &shape : shapes) {
+    for (const auto layout : layouts) {
+      for (const auto a_transpose : transposes) {
+        for (const auto b_transpose : transposes) {
+          const auto m = shape[0];
+          const auto n = shape[1];
+          const auto k = shape[2];
+          const auto a_rotated = (layout == Layout::kColMajor) == (a_transpose != Transpose::kNo);
+          const auto b_rotated = (layout == Layout::kColMajor) == (b_transpose != Transpose::kNo);
+          const auto a_ld = (a_rotated) ? k : m;
+          const auto b_ld = (b_rotated) ? n : k;
+          const auto c_ld = (layout == Layout::kColMajor) ? m : n;
+
+          // Populates the host matrices with some example data
+          auto host_a = std::vector<T>(m * k);
+          auto host_b = std::vector<T>(n * k);
+          auto host_c = std::vector<T>(m * n);
+          PopulateVector(host_a, mt, dist);
+          PopulateVector(host_b, mt, dist);
+          PopulateVector(host_c, mt, dist);
+
+          // Copies the data to the device: one output matrix for the reference and the 3M one
+          auto device_a = Buffer<T>(context, host_a.size());
+          auto device_b = Buffer<T>(context, host_b.size());
+          auto device_c_reference = Buffer<T>(context, host_c.size());
+          auto device_c_3m = Buffer<T>(context, host_c.size());
+          device_a.Write(queue, host_a.size(), host_a);
+          device_b.Write(queue, host_b.size(), host_b);
+          device_c_reference.Write(queue, host_c.size(), host_c);
+          device_c_3m.Write(queue, host_c.size(), host_c);
+
+          // Runs GEMM without and with the 3M version
+          auto queue_plain = queue();
+          auto status = Select3M<T>(device, 0);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = Gemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                        device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                        device_c_reference(), 0, c_ld, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = Select3M<T>(device, 1);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = Gemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                        device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                        device_c_3m(), 0, c_ld, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+
+          // Compares the results, allowing for the larger rounding errors of the 3M version
+          auto result_reference = std::vector<T>(host_c.size());
+          auto result_3m = std::vector<T>(host_c.size());
+          device_c_reference.Read(queue, result_reference.size(), result_reference);
+          device_c_3m.Read(queue, result_3m.size(), result_3m);
+          auto matches = true;
+          for (auto i = size_t{0}; i < result_3m.size(); ++i) {
+            if (std::abs(result_reference[i] - result_3m[i]) > 1e-3 * std::abs(result_reference[i]) + 1e-3) {
+              matches = false;
+            }
+          }
+          if (matches) { passed++; } else { errors++; }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemm3MTests<clblast::float2>(argc, argv, false, "CGEMM");
+  errors += clblast::RunGemm3MTests<clblast::double2>(argc, argv, true, "ZGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,185 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the alternative GEMM kernel (see 'XGEMM_MAX_ALT_SIZE'): small
+// problems should use the 'XgemmAlt' parameters with the other 'GEMMK' value, larger problems the
+// regular ones, and the results of both should match those of the regular kernel.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <random>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Selects the indirect kernel, with the alternative kernel up to 'max_alt_size' (0 == disabled)
+template <typename T>
+StatusCode SelectAlt(const Device &device, const size_t max_alt_size) {
+  return OverrideParameters(device(), "GemmRoutine", PrecisionValue<T>(),
+                            {{"XGEMM_MIN_INDIRECT_SIZE", 0}, {"XGEMM_MIN_SPLITK_K", 0},
+                             {"XGEMM_MIN_3M_SIZE", 0}, {"XGEMM_MAX_ALT_SIZE", max_alt_size},
+                             {"XGEMM_INDIRECT_COPY_COST", 0}, {"XGEMM_MIN_STRASSEN_SIZE", 0}});
+}
+
+// Sets the alternative parameters to a valid set with the opposite 'GEMMK' value of the regular one
+template <typename T>
+StatusCode SetAltParameters(const Device &device) {
+  auto parameters = std::unordered_map<std::string,size_t>();
+  const auto status = RetrieveParameters(device(), "Xgemm", PrecisionValue<T>(), parameters);
+  if (status != StatusCode::kSuccess) { return status; }
+  const auto names = std::vector<std::string>{"GEMMK", "KREG", "KWG", "KWI", "MDIMA", "MDIMC",
+                                              "MWG", "NDIMB", "NDIMC", "NWG", "SA", "SB",
+                                              "STRM", "STRN", "VWM", "VWN"};
+  const auto values = (parameters["GEMMK"] == 0) ?
+      std::vector<size_t>{1, 2, 1, 1, 4, 4, 32, 8, 8, 64, 0, 0, 0, 0, 2, 2} :
+      std::vector<size_t>{0, 1, 32, 2, 8, 8, 64, 8, 8, 64, 0, 0, 0, 0, 4, 4};
+  for (auto i = size_t{0}; i < names.size(); ++i) { parameters[names[i]] = values[i]; }
+  return OverrideParameters(device(), "XgemmAlt", PrecisionValue<T>(), parameters);
+}
+
+template <typename T>
+size_t RunGemmAltTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // Determines the test settings: the first shape is below the threshold, the second one above
+  const auto max_alt_size = size_t{100};
+  const auto shapes = std::vector<std::vector<size_t>>{{64, 67, 33}, {256, 129, 255}};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  if (SetAltParameters<T>(device) != StatusCode::kSuccess) { return 1; }
+
+  fprintf(stdout, "* Testing the alternative GEMM kernel for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &shape : shapes) {
+    for (const auto layout : layouts) {
+      for (const auto a_transpose : transposes) {
+        for (const auto b_transpose : transposes) {
+          const auto m = shape[0];
+          const auto n = shape[1];
+          const auto k = shape[2];
+          const auto a_rotated = (layout == Layout::kColMajor) == (a_transpose != Transpose::kNo);
+          const auto b_rotated = (layout == Layout::kColMajor) == (b_transpose != Transpose::kNo);
+          const auto a_ld = (a_rotated) ? k : m;
+          const auto b_ld = (b_rotated) ? n : k;
+          const auto c_ld = (layout == Layout::kColMajor) ? m : n;
+
+          // Populates the host matrices with some example data
+          auto host_a = std::vector<T>(m * k);
+          auto host_b = std::vector<T>(n * k);
+          auto host_c = std::vector<T>(m * n);
+          PopulateVector(host_a, mt, dist);
+          PopulateVector(host_b, mt, dist);
+          PopulateVector(host_c, mt, dist);
+
+          // Copies the data to the device: one output matrix for the reference and the alternative
+          auto device_a = Buffer<T>(context, host_a.size());
+          auto device_b = Buffer<T>(context, host_b.size());
+          auto device_c_reference = Buffer<T>(context, host_c.size());
+          auto device_c_alt = Buffer<T>(context, host_c.size());
+          device_a.Write(queue, host_a.size(), host_a);
+          device_b.Write(queue, host_b.size(), host_b);
+          device_c_reference.Write(queue, host_c.size(), host_c);
+          device_c_alt.Write(queue, host_c.size(), host_c);
+
+          // Runs GEMM without and with the alternative kernel
+          auto queue_plain = queue();
+          auto status = SelectAlt<T>(device, 0);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = Gemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                        device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                        device_c_reference(), 0, c_ld, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = SelectAlt<T>(device, max_alt_size);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = Gemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                        device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                        device_c_alt(), 0, c_ld, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+
+          // Compares the results
+          auto result_reference = std::vector<T>(host_c.size());
+          auto result_alt = std::vector<T>(host_c.size());
+          device_c_reference.Read(queue, result_reference.size(), result_reference);
+          device_c_alt.Read(queue, result_alt.size(), result_alt);
+          auto matches = true;
+          for (auto i = size_t{0}; i < result_alt.size(); ++i) {
+            if (std::abs(result_reference[i] - result_alt[i]) > 1e-3 * std::abs(result_reference[i]) + 1e-3) {
+              matches = false;
+            }
+          }
+          if (matches) { passed++; } else { errors++; }
+        }
+      }
+    }
+  }
+
+  // Switching back and forth between both kernels should not compile any program again
+  const auto buffer_size = size_t{256 * 256};
+  auto device_a = Buffer<T>(context, buffer_size);
+  auto device_b = Buffer<T>(context, buffer_size);
+  auto device_c = Buffer<T>(context, buffer_size);
+  auto queue_plain = queue();
+  auto status = ResetStatistics();
+  for (const auto size : {size_t{64}, size_t{256}, size_t{64}}) {
+    if (status != StatusCode::kSuccess) { break; }
+    status = Gemm(Layout::kColMajor, Transpose::kNo, Transpose::kNo, size, size, size, alpha,
+                  device_a(), 0, size, device_b(), 0, size, beta, device_c(), 0, size, &queue_plain);
+  }
+  auto statistics = Statistics{};
+  status = (status != StatusCode::kSuccess) ? status : GetStatistics(statistics);
+  if (status == StatusCode::kSuccess && statistics.num_compilations == 0) { passed++; } else { errors++; }
+  SelectAlt<T>(device, 0);
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmAltTests<float>(argc, argv, false, "SGEMM");
+  errors += clblast::RunGemmAltTests<double>(argc, argv, true, "DGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
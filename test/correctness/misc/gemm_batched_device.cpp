@@ -0,0 +1,176 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the batched GEMM with device-resident scalars and offsets: both
+// the per-batch and the uniform scalar versions should give the same result as the regular
+// batched GEMM routine.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <complex>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemmBatchedDeviceTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  constexpr auto kBatchCount = size_t{3};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Determines the test settings
+  const auto sizes = std::vector<size_t>{7, 64};
+  const auto transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes};
+  const auto uniform_options = std::vector<bool>{false, true};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing the device-resident batched GEMM for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto size : sizes) {
+    for (const auto a_transpose : transposes) {
+      for (const auto b_transpose : transposes) {
+        for (const auto uniform : uniform_options) {
+          const auto m = size;
+          const auto n = size + 1;
+          const auto k = size + 2;
+          const auto a_ld = (a_transpose == Transpose::kNo) ? m : k;
+          const auto b_ld = (b_transpose == Transpose::kNo) ? k : n;
+          const auto c_ld = m;
+
+          // Sets the scalars and offsets: the batches are stored in reverse order
+          auto alphas = std::vector<T>(kBatchCount);
+          auto betas = std::vector<T>(kBatchCount);
+          auto a_offsets = std::vector<size_t>(kBatchCount);
+          auto b_offsets = std::vector<size_t>(kBatchCount);
+          auto c_offsets = std::vector<size_t>(kBatchCount);
+          auto a_offsets_int = std::vector<int>(kBatchCount);
+          auto b_offsets_int = std::vector<int>(kBatchCount);
+          auto c_offsets_int = std::vector<int>(kBatchCount);
+          for (auto batch = size_t{0}; batch < kBatchCount; ++batch) {
+            alphas[batch] = (uniform || batch == 0) ? GetScalar<T>() : alphas[0] + alphas[0];
+            betas[batch] = (uniform || batch == 0) ? GetScalar<T>() : betas[0] + betas[0];
+            a_offsets[batch] = (kBatchCount - 1 - batch) * m * k;
+            b_offsets[batch] = (kBatchCount - 1 - batch) * n * k;
+            c_offsets[batch] = (kBatchCount - 1 - batch) * m * n;
+            a_offsets_int[batch] = static_cast<int>(a_offsets[batch]);
+            b_offsets_int[batch] = static_cast<int>(b_offsets[batch]);
+            c_offsets_int[batch] = static_cast<int>(c_offsets[batch]);
+          }
+
+          // Populates the host matrices with some example data
+          auto host_a = std::vector<T>(kBatchCount * m * k);
+          auto host_b = std::vector<T>(kBatchCount * n * k);
+          auto host_c = std::vector<T>(kBatchCount * m * n);
+          PopulateVector(host_a, mt, dist);
+          PopulateVector(host_b, mt, dist);
+          PopulateVector(host_c, mt, dist);
+
+          // Copies the matrices, scalars, and offsets to the device
+          auto device_a = Buffer<T>(context, host_a.size());
+          auto device_b = Buffer<T>(context, host_b.size());
+          auto device_c_reference = Buffer<T>(context, host_c.size());
+          auto device_c_device = Buffer<T>(context, host_c.size());
+          auto device_alphas = Buffer<T>(context, kBatchCount);
+          auto device_betas = Buffer<T>(context, kBatchCount);
+          auto device_a_offsets = Buffer<int>(context, kBatchCount);
+          auto device_b_offsets = Buffer<int>(context, kBatchCount);
+          auto device_c_offsets = Buffer<int>(context, kBatchCount);
+          device_a.Write(queue, host_a.size(), host_a);
+          device_b.Write(queue, host_b.size(), host_b);
+          device_c_reference.Write(queue, host_c.size(), host_c);
+          device_c_device.Write(queue, host_c.size(), host_c);
+          device_alphas.Write(queue, kBatchCount, alphas);
+          device_betas.Write(queue, kBatchCount, betas);
+          device_a_offsets.Write(queue, kBatchCount, a_offsets_int);
+          device_b_offsets.Write(queue, kBatchCount, b_offsets_int);
+          device_c_offsets.Write(queue, kBatchCount, c_offsets_int);
+
+          // Runs the regular batched GEMM and the device-resident version
+          auto queue_plain = queue();
+          auto status = GemmBatched(Layout::kColMajor, a_transpose, b_transpose, m, n, k,
+                                    alphas.data(), device_a(), a_offsets.data(), a_ld,
+                                    device_b(), b_offsets.data(), b_ld, betas.data(),
+                                    device_c_reference(), c_offsets.data(), c_ld,
+                                    kBatchCount, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          if (uniform) {
+            status = GemmBatchedDevice(Layout::kColMajor, a_transpose, b_transpose, m, n, k,
+                                       alphas[0], device_a(), device_a_offsets(), a_ld,
+                                       device_b(), device_b_offsets(), b_ld, betas[0],
+                                       device_c_device(), device_c_offsets(), c_ld,
+                                       kBatchCount, &queue_plain);
+          }
+          else {
+            status = GemmBatchedDevice<T>(Layout::kColMajor, a_transpose, b_transpose, m, n, k,
+                                          device_alphas(), device_a(), device_a_offsets(), a_ld,
+                                          device_b(), device_b_offsets(), b_ld, device_betas(),
+                                          device_c_device(), device_c_offsets(), c_ld,
+                                          kBatchCount, &queue_plain);
+          }
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+
+          // Compares the results
+          auto result_reference = std::vector<T>(host_c.size());
+          auto result_device = std::vector<T>(host_c.size());
+          device_c_reference.Read(queue, result_reference.size(), result_reference);
+          device_c_device.Read(queue, result_device.size(), result_device);
+          auto matches = true;
+          for (auto i = size_t{0}; i < result_device.size(); ++i) {
+            if (std::abs(result_reference[i] - result_device[i]) > 1e-4 * std::abs(result_reference[i])) {
+              matches = false;
+            }
+          }
+          if (matches) { passed++; } else { errors++; }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmBatchedDeviceTests<float>(argc, argv, false, "SGEMMBATCHED");
+  errors += clblast::RunGemmBatchedDeviceTests<clblast::float2>(argc, argv, true, "CGEMMBATCHED");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
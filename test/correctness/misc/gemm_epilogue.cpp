@@ -0,0 +1,197 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the GEMM routines with an epilogue: the results should match
+// those of the regular GEMM routines followed by the bias addition and activation on the host.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Host reference of the epilogue activation functions
+template <typename T>
+T ApplyActivation(const T value, const EpilogueActivation activation, const T low, const T high) {
+  switch (activation) {
+    case EpilogueActivation::kReLU: return std::max(value, T{0});
+    case EpilogueActivation::kGELU: {
+      const auto inner = T{0.7978845608} * (value + T{0.044715} * value * value * value);
+      return T{0.5} * value * (T{1} + std::tanh(inner));
+    }
+    case EpilogueActivation::kSigmoid: return T{1} / (T{1} + std::exp(-value));
+    case EpilogueActivation::kClamp: return std::min(std::max(value, low), high);
+    default: return value;
+  }
+}
+
+template <typename T>
+size_t RunGemmEpilogueTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  constexpr auto kBatchCount = size_t{2}; // for the strided-batched version
+  const auto low = T{-0.5};
+  const auto high = T{0.5};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // Determines the test settings: small sizes use the direct kernel, larger ones the indirect one
+  const auto sizes = std::vector<size_t>{7, 257};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto bias_modes = std::vector<EpilogueBias>{EpilogueBias::kNone, EpilogueBias::kPerRow,
+                                                    EpilogueBias::kPerColumn};
+  const auto activations = std::vector<EpilogueActivation>{
+    EpilogueActivation::kNone, EpilogueActivation::kReLU, EpilogueActivation::kGELU,
+    EpilogueActivation::kSigmoid, EpilogueActivation::kClamp
+  };
+  const auto strided_options = std::vector<bool>{false, true};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing the GEMM epilogue for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto size : sizes) {
+    for (const auto layout : layouts) {
+      for (const auto bias_mode : bias_modes) {
+        for (const auto activation : activations) {
+          for (const auto strided : strided_options) {
+            const auto m = size;
+            const auto n = size + 1;
+            const auto k = size + 2;
+            const auto a_ld = (layout == Layout::kColMajor) ? m : k;
+            const auto b_ld = (layout == Layout::kColMajor) ? k : n;
+            const auto c_ld = (layout == Layout::kColMajor) ? m : n;
+            const auto batch_count = (strided) ? kBatchCount : size_t{1};
+
+            // Populates the host matrices and the bias vector with some example data
+            auto host_a = std::vector<T>(batch_count * m * k);
+            auto host_b = std::vector<T>(batch_count * n * k);
+            auto host_c = std::vector<T>(batch_count * m * n);
+            auto host_bias = std::vector<T>(std::max(m, n));
+            PopulateVector(host_a, mt, dist);
+            PopulateVector(host_b, mt, dist);
+            PopulateVector(host_c, mt, dist);
+            PopulateVector(host_bias, mt, dist);
+
+            // Copies the data to the device: one output matrix for the reference and the epilogue
+            auto device_a = Buffer<T>(context, host_a.size());
+            auto device_b = Buffer<T>(context, host_b.size());
+            auto device_c_reference = Buffer<T>(context, host_c.size());
+            auto device_c_epilogue = Buffer<T>(context, host_c.size());
+            auto device_bias = Buffer<T>(context, host_bias.size());
+            device_a.Write(queue, host_a.size(), host_a);
+            device_b.Write(queue, host_b.size(), host_b);
+            device_c_reference.Write(queue, host_c.size(), host_c);
+            device_c_epilogue.Write(queue, host_c.size(), host_c);
+            device_bias.Write(queue, host_bias.size(), host_bias);
+
+            // Runs the regular GEMM and the version with the epilogue
+            auto queue_plain = queue();
+            auto status = StatusCode::kSuccess;
+            if (strided) {
+              status = GemmStridedBatched(layout, Transpose::kNo, Transpose::kNo, m, n, k, alpha,
+                                          device_a(), 0, a_ld, m * k, device_b(), 0, b_ld, n * k,
+                                          beta, device_c_reference(), 0, c_ld, m * n,
+                                          batch_count, &queue_plain);
+              if (status != StatusCode::kSuccess) { errors++; continue; }
+              status = GemmStridedBatchedWithEpilogue(layout, Transpose::kNo, Transpose::kNo, m, n, k,
+                                                      alpha, device_a(), 0, a_ld, m * k,
+                                                      device_b(), 0, b_ld, n * k, beta,
+                                                      device_c_epilogue(), 0, c_ld, m * n, batch_count,
+                                                      bias_mode, device_bias(), 0,
+                                                      activation, low, high, &queue_plain);
+            }
+            else {
+              status = Gemm(layout, Transpose::kNo, Transpose::kNo, m, n, k, alpha,
+                            device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                            device_c_reference(), 0, c_ld, &queue_plain);
+              if (status != StatusCode::kSuccess) { errors++; continue; }
+              status = GemmWithEpilogue(layout, Transpose::kNo, Transpose::kNo, m, n, k, alpha,
+                                        device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                                        device_c_epilogue(), 0, c_ld,
+                                        bias_mode, device_bias(), 0,
+                                        activation, low, high, &queue_plain);
+            }
+            if (status != StatusCode::kSuccess) { errors++; continue; }
+
+            // Applies the epilogue to the reference result on the host
+            auto result_reference = std::vector<T>(host_c.size());
+            auto result_epilogue = std::vector<T>(host_c.size());
+            device_c_reference.Read(queue, result_reference.size(), result_reference);
+            device_c_epilogue.Read(queue, result_epilogue.size(), result_epilogue);
+            for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+              for (auto row = size_t{0}; row < m; ++row) {
+                for (auto column = size_t{0}; column < n; ++column) {
+                  const auto index = batch * m * n + ((layout == Layout::kColMajor) ?
+                                                      column * c_ld + row : row * c_ld + column);
+                  auto value = result_reference[index];
+                  if (bias_mode == EpilogueBias::kPerRow) { value += host_bias[row]; }
+                  if (bias_mode == EpilogueBias::kPerColumn) { value += host_bias[column]; }
+                  result_reference[index] = ApplyActivation(value, activation, low, high);
+                }
+              }
+            }
+
+            // Compares the results
+            auto matches = true;
+            for (auto i = size_t{0}; i < result_epilogue.size(); ++i) {
+              if (std::abs(result_reference[i] - result_epilogue[i]) > 1e-4 * std::abs(result_reference[i]) + 1e-5) {
+                matches = false;
+              }
+            }
+            if (matches) { passed++; } else { errors++; }
+          }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmEpilogueTests<float>(argc, argv, false, "SGEMM");
+  errors += clblast::RunGemmEpilogueTests<double>(argc, argv, true, "DGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,170 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the grouped GEMM: the result for each entry of the batch should
+// be the same as calling the regular GEMM routine with the arguments of that entry.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <complex>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemmGroupedTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Determines the test settings: the entries of a batch are of different sizes
+  const auto batch_sizes = std::vector<std::vector<size_t>>{{7}, {3, 64, 17}, {33, 1, 130, 65, 8}};
+  const auto transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing the grouped GEMM for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &sizes : batch_sizes) {
+    for (const auto layout : layouts) {
+      for (const auto a_transpose : transposes) {
+        for (const auto b_transpose : transposes) {
+          const auto batch_count = sizes.size();
+
+          // Computes the sizes, leading dimensions, and offsets of each entry: all entries are
+          // stored one after another in a single buffer per matrix
+          auto ms = std::vector<size_t>(batch_count);
+          auto ns = std::vector<size_t>(batch_count);
+          auto ks = std::vector<size_t>(batch_count);
+          auto a_lds = std::vector<size_t>(batch_count);
+          auto b_lds = std::vector<size_t>(batch_count);
+          auto c_lds = std::vector<size_t>(batch_count);
+          auto a_offsets = std::vector<size_t>(batch_count);
+          auto b_offsets = std::vector<size_t>(batch_count);
+          auto c_offsets = std::vector<size_t>(batch_count);
+          auto alphas = std::vector<T>(batch_count);
+          auto betas = std::vector<T>(batch_count);
+          auto a_size = size_t{0};
+          auto b_size = size_t{0};
+          auto c_size = size_t{0};
+          for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+            ms[batch] = sizes[batch];
+            ns[batch] = sizes[batch] + 1;
+            ks[batch] = sizes[batch] + 2;
+            const auto a_rotated = (layout == Layout::kColMajor) == (a_transpose != Transpose::kNo);
+            const auto b_rotated = (layout == Layout::kColMajor) == (b_transpose != Transpose::kNo);
+            const auto c_rotated = (layout == Layout::kRowMajor);
+            a_lds[batch] = (a_rotated) ? ks[batch] : ms[batch];
+            b_lds[batch] = (b_rotated) ? ns[batch] : ks[batch];
+            c_lds[batch] = (c_rotated) ? ns[batch] : ms[batch];
+            a_offsets[batch] = a_size;
+            b_offsets[batch] = b_size;
+            c_offsets[batch] = c_size;
+            a_size += ms[batch] * ks[batch];
+            b_size += ks[batch] * ns[batch];
+            c_size += ms[batch] * ns[batch];
+            alphas[batch] = GetScalar<T>();
+            betas[batch] = GetScalar<T>();
+          }
+
+          // Populates the host matrices with some example data
+          auto host_a = std::vector<T>(a_size);
+          auto host_b = std::vector<T>(b_size);
+          auto host_c = std::vector<T>(c_size);
+          PopulateVector(host_a, mt, dist);
+          PopulateVector(host_b, mt, dist);
+          PopulateVector(host_c, mt, dist);
+
+          // Copies the matrices to the device: one output matrix for each of the two APIs
+          auto device_a = Buffer<T>(context, host_a.size());
+          auto device_b = Buffer<T>(context, host_b.size());
+          auto device_c_reference = Buffer<T>(context, host_c.size());
+          auto device_c_grouped = Buffer<T>(context, host_c.size());
+          device_a.Write(queue, host_a.size(), host_a);
+          device_b.Write(queue, host_b.size(), host_b);
+          device_c_reference.Write(queue, host_c.size(), host_c);
+          device_c_grouped.Write(queue, host_c.size(), host_c);
+
+          // Runs the regular GEMM for each entry and the grouped GEMM once for all entries
+          auto queue_plain = queue();
+          auto status = StatusCode::kSuccess;
+          for (auto batch = size_t{0}; batch < batch_count && status == StatusCode::kSuccess; ++batch) {
+            status = Gemm(layout, a_transpose, b_transpose, ms[batch], ns[batch], ks[batch], alphas[batch],
+                          device_a(), a_offsets[batch], a_lds[batch],
+                          device_b(), b_offsets[batch], b_lds[batch], betas[batch],
+                          device_c_reference(), c_offsets[batch], c_lds[batch], &queue_plain);
+          }
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = GemmGrouped(layout, a_transpose, b_transpose, ms.data(), ns.data(), ks.data(),
+                               alphas.data(),
+                               device_a(), a_offsets.data(), a_lds.data(),
+                               device_b(), b_offsets.data(), b_lds.data(),
+                               betas.data(),
+                               device_c_grouped(), c_offsets.data(), c_lds.data(),
+                               batch_count, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+
+          // Compares the results
+          auto result_reference = std::vector<T>(host_c.size());
+          auto result_grouped = std::vector<T>(host_c.size());
+          device_c_reference.Read(queue, result_reference.size(), result_reference);
+          device_c_grouped.Read(queue, result_grouped.size(), result_grouped);
+          auto matches = true;
+          for (auto i = size_t{0}; i < result_grouped.size(); ++i) {
+            if (std::abs(result_reference[i] - result_grouped[i]) > 1e-4 * std::abs(result_reference[i])) {
+              matches = false;
+            }
+          }
+          if (matches) { passed++; } else { errors++; }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmGroupedTests<float>(argc, argv, false, "SGEMMGROUPED");
+  errors += clblast::RunGemmGroupedTests<clblast::float2>(argc, argv, true, "CGEMMGROUPED");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,181 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the image version of GEMM: the results computed through images,
+// selected by the database or with operands packed by 'GemmPackImage', should match those of the
+// regular GEMM. The tests are skipped on devices without image support.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Selects the indirect kernel with (min_image_size > 0) or without (min_image_size == 0) the image
+// version
+template <typename T>
+StatusCode SelectImage(const Device &device, const size_t min_image_size) {
+  return OverrideParameters(device(), "GemmRoutine", PrecisionValue<T>(),
+                            {{"XGEMM_MIN_INDIRECT_SIZE", 0}, {"XGEMM_MIN_SPLITK_K", 0},
+                             {"XGEMM_MIN_3M_SIZE", 0}, {"XGEMM_MAX_ALT_SIZE", 0},
+                             {"XGEMM_INDIRECT_COPY_COST", 0}, {"XGEMM_MIN_STRASSEN_SIZE", 0},
+                             {"XGEMM_MIN_IMAGE_SIZE", min_image_size}});
+}
+
+// Compares a result with the reference
+template <typename T>
+bool IsCloseImage(const std::vector<T> &result, const std::vector<T> &reference) {
+  for (auto i = size_t{0}; i < reference.size(); ++i) {
+    if (std::abs(result[i] - reference[i]) > 1e-4 * std::abs(reference[i]) + 1e-4) { return false; }
+  }
+  return true;
+}
+
+template <typename T>
+size_t RunGemmImageTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // Determines the test settings: sizes which are multiples of four and sizes which aren't
+  const auto shapes = std::vector<std::vector<size_t>>{{64, 64, 64}, {67, 33, 129}, {5, 130, 17}};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  fprintf(stdout, "* Testing the image version of GEMM for '%s'\n", routine_name.c_str());
+  if (!device.SupportsImages()) {
+    fprintf(stdout, "* Skipping the tests: the device has no image support\n\n");
+    return 0;
+  }
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &shape : shapes) {
+    for (const auto layout : layouts) {
+      for (const auto a_transpose : transposes) {
+        for (const auto b_transpose : transposes) {
+          const auto m = shape[0];
+          const auto n = shape[1];
+          const auto k = shape[2];
+          const auto a_rotated = (layout == Layout::kColMajor) == (a_transpose != Transpose::kNo);
+          const auto b_rotated = (layout == Layout::kColMajor) == (b_transpose != Transpose::kNo);
+          const auto a_ld = (a_rotated) ? k : m;
+          const auto b_ld = (b_rotated) ? n : k;
+          const auto c_ld = (layout == Layout::kColMajor) ? m : n;
+
+          // Populates the host matrices with some example data
+          auto host_a = std::vector<T>(m * k);
+          auto host_b = std::vector<T>(n * k);
+          auto host_c = std::vector<T>(m * n);
+          PopulateVector(host_a, mt, dist);
+          PopulateVector(host_b, mt, dist);
+          PopulateVector(host_c, mt, dist);
+
+          // Copies the data to the device: one output matrix for the reference and two for images
+          auto device_a = Buffer<T>(context, host_a.size());
+          auto device_b = Buffer<T>(context, host_b.size());
+          auto device_c_reference = Buffer<T>(context, host_c.size());
+          auto device_c_image = Buffer<T>(context, host_c.size());
+          auto device_c_packed = Buffer<T>(context, host_c.size());
+          device_a.Write(queue, host_a.size(), host_a);
+          device_b.Write(queue, host_b.size(), host_b);
+          device_c_reference.Write(queue, host_c.size(), host_c);
+          device_c_image.Write(queue, host_c.size(), host_c);
+          device_c_packed.Write(queue, host_c.size(), host_c);
+
+          // Runs GEMM without and with the image version as selected by the database
+          auto status = SelectImage<T>(device, 0);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = Gemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                        device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                        device_c_reference(), 0, c_ld, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = SelectImage<T>(device, 1);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = Gemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                        device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                        device_c_image(), 0, c_ld, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+
+          // Runs GEMM with both operands packed into images beforehand
+          auto a_image = cl_mem{nullptr};
+          auto b_image = cl_mem{nullptr};
+          status = GemmPackImage<T>(layout, GemmOperand::kA, a_transpose, m, n, k,
+                                    device_a(), 0, a_ld, &a_image, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = GemmPackImage<T>(layout, GemmOperand::kB, b_transpose, m, n, k,
+                                    device_b(), 0, b_ld, &b_image, &queue_plain);
+          if (status == StatusCode::kSuccess) {
+            status = GemmWithImageOperands(layout, a_transpose, b_transpose, m, n, k, alpha,
+                                           a_image, 0, 0, true, b_image, 0, 0, true, beta,
+                                           device_c_packed(), 0, c_ld, &queue_plain);
+            queue.Finish();
+            clReleaseMemObject(b_image);
+          }
+          clReleaseMemObject(a_image);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+
+          // Compares the results
+          auto result_reference = std::vector<T>(host_c.size());
+          auto result_image = std::vector<T>(host_c.size());
+          auto result_packed = std::vector<T>(host_c.size());
+          device_c_reference.Read(queue, result_reference.size(), result_reference);
+          device_c_image.Read(queue, result_image.size(), result_image);
+          device_c_packed.Read(queue, result_packed.size(), result_packed);
+          if (IsCloseImage(result_image, result_reference)) { passed++; } else { errors++; }
+          if (IsCloseImage(result_packed, result_reference)) { passed++; } else { errors++; }
+        }
+      }
+    }
+  }
+  SelectImage<T>(device, 0);
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmImageTests<float>(argc, argv, false, "SGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,199 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the integer GEMM routines GemmInt8 and GemmInt8Requantized. The
+// results are exact, so they are compared exactly with host references for both layouts and all
+// transposes, including a k which is not a multiple of four. The 32-bit accumulation saturates on
+// overflow, with or without the 'cl_khr_integer_dot_product' extension, which is tested as well.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Computes the exact product of A and B for element (i, j) of C, given the storage of the matrices
+// (see 'GemmInt8' for the layouts and transposes)
+long long GemmInt8Product(const std::vector<int8> &a, const size_t a_ld, const bool a_rotated,
+                          const std::vector<int8> &b, const size_t b_ld, const bool b_rotated,
+                          const size_t k, const size_t i, const size_t j) {
+  auto sum = 0LL;
+  for (auto l = size_t{0}; l < k; ++l) {
+    const auto a_value = (a_rotated) ? a[i * a_ld + l] : a[l * a_ld + i];
+    const auto b_value = (b_rotated) ? b[l * b_ld + j] : b[j * b_ld + l];
+    sum += static_cast<long long>(a_value) * static_cast<long long>(b_value);
+  }
+  return sum;
+}
+
+size_t RunGemmInt8Tests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  std::mt19937 mt(kSeed);
+  std::uniform_int_distribution<int> int8_dist(-128, 127);
+  std::uniform_int_distribution<int> int_dist(-1000, 1000);
+  std::uniform_real_distribution<float> scale_dist(0.001f, 0.02f);
+  const auto alpha = 2;
+  const auto beta = -3;
+
+  // Sizes which are not multiples of the tile sizes (including a k not a multiple of four) and
+  // sizes which are, for all layouts and transposes
+  for (const auto sizes : {std::vector<size_t>{67, 45, 33}, std::vector<size_t>{128, 64, 256}}) {
+    const auto m = sizes[0];
+    const auto n = sizes[1];
+    const auto k = sizes[2];
+    fprintf(stdout, "* Testing GemmInt8 and GemmInt8Requantized for m=%zu n=%zu k=%zu\n", m, n, k);
+    for (const auto layout : {Layout::kColMajor, Layout::kRowMajor}) {
+      for (const auto a_transpose : {Transpose::kNo, Transpose::kYes}) {
+        for (const auto b_transpose : {Transpose::kNo, Transpose::kYes}) {
+          const auto row_major = (layout == Layout::kRowMajor);
+          const auto a_rotated = row_major != (a_transpose == Transpose::kYes);
+          const auto b_rotated = row_major != (b_transpose == Transpose::kYes);
+          const auto a_ld = (a_rotated) ? k : m;
+          const auto b_ld = (b_rotated) ? n : k;
+          const auto c_ld = (row_major) ? n : m;
+          auto host_a = std::vector<int8>(m * k);
+          auto host_b = std::vector<int8>(k * n);
+          auto host_c = std::vector<int>(m * n);
+          auto host_scales = std::vector<float>(n);
+          for (auto &value : host_a) { value = static_cast<int8>(int8_dist(mt)); }
+          for (auto &value : host_b) { value = static_cast<int8>(int8_dist(mt)); }
+          for (auto &value : host_c) { value = int_dist(mt); }
+          for (auto j = size_t{0}; j < n; ++j) {
+            host_scales[j] = (j % 3 == 0) ? 0.5f : scale_dist(mt); // 0.5 gives ties for odd sums
+          }
+
+          // The references: a 32-bit result and a rounded (to nearest-even) and saturated 8-bit
+          // result with a scale per column of C
+          auto reference = std::vector<int>(m * n);
+          auto reference_requantized = std::vector<int8>(m * n);
+          for (auto j = size_t{0}; j < n; ++j) {
+            for (auto i = size_t{0}; i < m; ++i) {
+              const auto product = GemmInt8Product(host_a, a_ld, a_rotated, host_b, b_ld, b_rotated,
+                                                   k, i, j);
+              const auto index = (row_major) ? i * c_ld + j : j * c_ld + i;
+              reference[index] = static_cast<int>(alpha * product + beta * host_c[index]);
+              const auto scaled = std::nearbyint(static_cast<float>(product) * host_scales[j]);
+              reference_requantized[index] = static_cast<int8>(std::max(-128.0f,
+                                                                        std::min(127.0f, scaled)));
+            }
+          }
+
+          auto device_a = Buffer<int8>(context, host_a.size());
+          auto device_b = Buffer<int8>(context, host_b.size());
+          auto device_c = Buffer<int>(context, host_c.size());
+          auto device_c8 = Buffer<int8>(context, host_c.size());
+          auto device_scales = Buffer<float>(context, host_scales.size());
+          device_a.Write(queue, host_a.size(), host_a);
+          device_b.Write(queue, host_b.size(), host_b);
+          device_c.Write(queue, host_c.size(), host_c);
+          device_scales.Write(queue, host_scales.size(), host_scales);
+
+          // The 32-bit integer GEMM
+          const auto status = GemmInt8(layout, a_transpose, b_transpose, m, n, k, alpha,
+                                       device_a(), 0, a_ld, device_b(), 0, b_ld,
+                                       beta, device_c(), 0, c_ld, &queue_plain);
+          auto result = std::vector<int>(host_c.size());
+          device_c.Read(queue, result.size(), result);
+          if (status == StatusCode::kSuccess && result == reference) { passed++; }
+          else {
+            fprintf(stdout, "    Error in 'GemmInt8' (status %d)\n", static_cast<int>(status));
+            errors++;
+          }
+
+          // The requantised integer GEMM
+          const auto status_requantized = GemmInt8Requantized(layout, a_transpose, b_transpose,
+                                                              m, n, k, device_a(), 0, a_ld,
+                                                              device_b(), 0, b_ld,
+                                                              device_scales(), 0,
+                                                              device_c8(), 0, c_ld, &queue_plain);
+          auto result_requantized = std::vector<int8>(host_c.size());
+          device_c8.Read(queue, result_requantized.size(), result_requantized);
+          if (status_requantized == StatusCode::kSuccess &&
+              result_requantized == reference_requantized) { passed++; }
+          else {
+            fprintf(stdout, "    Error in 'GemmInt8Requantized' (status %d)\n",
+                    static_cast<int>(status_requantized));
+            errors++;
+          }
+        }
+      }
+    }
+  }
+
+  // Sums beyond the range of the 32-bit accumulator saturate, in both directions: each product is
+  // 16384 or -16256 in magnitude, such that k of just over 2^17 overflows
+  fprintf(stdout, "* Testing the saturation of the 32-bit accumulation\n");
+  const auto m = size_t{4};
+  const auto n = size_t{4};
+  const auto k = size_t{132200};
+  for (const auto b_value : {-128, 127}) {
+    const auto host_a = std::vector<int8>(m * k, static_cast<int8>(-128));
+    const auto host_b = std::vector<int8>(k * n, static_cast<int8>(b_value));
+    const auto expected = (b_value < 0) ? std::numeric_limits<int>::max() :
+                                          std::numeric_limits<int>::min();
+    auto device_a = Buffer<int8>(context, host_a.size());
+    auto device_b = Buffer<int8>(context, host_b.size());
+    auto device_c = Buffer<int>(context, m * n);
+    device_a.Write(queue, host_a.size(), host_a);
+    device_b.Write(queue, host_b.size(), host_b);
+    const auto status = GemmInt8(Layout::kColMajor, Transpose::kNo, Transpose::kNo, m, n, k, 1,
+                                 device_a(), 0, m, device_b(), 0, k,
+                                 0, device_c(), 0, m, &queue_plain);
+    auto result = std::vector<int>(m * n);
+    device_c.Read(queue, result.size(), result);
+    if (status == StatusCode::kSuccess && result == std::vector<int>(m * n, expected)) { passed++; }
+    else {
+      fprintf(stdout, "    Error: %d instead of the saturated %d\n", result[0], expected);
+      errors++;
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunGemmInt8Tests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
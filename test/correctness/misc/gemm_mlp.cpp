@@ -0,0 +1,163 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the fused back-to-back GEMMs of an MLP block: the results should
+// match those of a GEMM with an epilogue followed by a regular GEMM. The shapes cover both the fused
+// kernel (a small inner dimension 'n') and the fall-back (a large one).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemmMlpTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  const auto low = T{-0.5};
+  const auto high = T{0.5};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // Determines the test settings as {m, n, k, p}: the last shape doesn't fit the fused kernel
+  const auto shapes = std::vector<std::vector<size_t>>{{37, 100, 50, 70}, {16, 64, 16, 64},
+                                                       {33, 300, 20, 17}};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto bias_modes = std::vector<EpilogueBias>{EpilogueBias::kNone, EpilogueBias::kPerRow,
+                                                    EpilogueBias::kPerColumn};
+  const auto activations = std::vector<EpilogueActivation>{
+    EpilogueActivation::kNone, EpilogueActivation::kReLU, EpilogueActivation::kGELU,
+    EpilogueActivation::kClamp
+  };
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing the fused MLP GEMMs for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &shape : shapes) {
+    for (const auto layout : layouts) {
+      for (const auto bias_mode : bias_modes) {
+        for (const auto activation : activations) {
+          const auto m = shape[0];
+          const auto n = shape[1];
+          const auto k = shape[2];
+          const auto p = shape[3];
+          const auto a_ld = (layout == Layout::kColMajor) ? m : k;
+          const auto b_ld = (layout == Layout::kColMajor) ? k : n;
+          const auto h_ld = (layout == Layout::kColMajor) ? m : n;
+          const auto e_ld = (layout == Layout::kColMajor) ? n : p;
+          const auto d_ld = (layout == Layout::kColMajor) ? m : p;
+
+          // Populates the host matrices and the bias vector with some example data
+          auto host_a = std::vector<T>(m * k);
+          auto host_b = std::vector<T>(k * n);
+          auto host_e = std::vector<T>(n * p);
+          auto host_d = std::vector<T>(m * p);
+          auto host_bias = std::vector<T>(std::max(m, n));
+          PopulateVector(host_a, mt, dist);
+          PopulateVector(host_b, mt, dist);
+          PopulateVector(host_e, mt, dist);
+          PopulateVector(host_d, mt, dist);
+          PopulateVector(host_bias, mt, dist);
+
+          // Copies the data to the device: one output matrix for the reference and the fused version
+          auto device_a = Buffer<T>(context, host_a.size());
+          auto device_b = Buffer<T>(context, host_b.size());
+          auto device_e = Buffer<T>(context, host_e.size());
+          auto device_h = Buffer<T>(context, m * n);
+          auto device_d_reference = Buffer<T>(context, host_d.size());
+          auto device_d_fused = Buffer<T>(context, host_d.size());
+          auto device_bias = Buffer<T>(context, host_bias.size());
+          device_a.Write(queue, host_a.size(), host_a);
+          device_b.Write(queue, host_b.size(), host_b);
+          device_e.Write(queue, host_e.size(), host_e);
+          device_d_reference.Write(queue, host_d.size(), host_d);
+          device_d_fused.Write(queue, host_d.size(), host_d);
+          device_bias.Write(queue, host_bias.size(), host_bias);
+
+          // Runs the two separate GEMMs and the fused version
+          auto queue_plain = queue();
+          auto status = GemmWithEpilogue(layout, Transpose::kNo, Transpose::kNo, m, n, k, alpha,
+                                         device_a(), 0, a_ld, device_b(), 0, b_ld, T{0},
+                                         device_h(), 0, h_ld,
+                                         bias_mode, device_bias(), 0,
+                                         activation, low, high, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = Gemm(layout, Transpose::kNo, Transpose::kNo, m, p, n, T{1},
+                        device_h(), 0, h_ld, device_e(), 0, e_ld, beta,
+                        device_d_reference(), 0, d_ld, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = GemmMlp(layout, m, n, k, p, alpha,
+                           device_a(), 0, a_ld, device_b(), 0, b_ld,
+                           bias_mode, device_bias(), 0, activation, low, high,
+                           device_e(), 0, e_ld, beta,
+                           device_d_fused(), 0, d_ld, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+
+          // Compares the results
+          auto result_reference = std::vector<T>(host_d.size());
+          auto result_fused = std::vector<T>(host_d.size());
+          device_d_reference.Read(queue, result_reference.size(), result_reference);
+          device_d_fused.Read(queue, result_fused.size(), result_fused);
+          auto matches = true;
+          for (auto i = size_t{0}; i < result_fused.size(); ++i) {
+            if (std::abs(result_reference[i] - result_fused[i]) > 1e-3 * std::abs(result_reference[i]) + 1e-4) {
+              matches = false;
+            }
+          }
+          if (matches) { passed++; } else { errors++; }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmMlpTests<float>(argc, argv, false, "SGEMMMLP");
+  errors += clblast::RunGemmMlpTests<double>(argc, argv, true, "DGEMMMLP");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,255 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the multi-device version of GEMM. As multiple devices are not
+// always available, multiple queues on the same device are used: the results for host matrices
+// split over several queues should match those of the regular GEMM on a single queue. The same
+// holds for the queues on the sub-devices of the device (only one on most GPUs). The strided-batched
+// version is compared with the regular strided-batched GEMM in the same way.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <complex>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemmMultiDeviceTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // Determines the test settings: the shapes, and the weights of three queues (including a queue
+  // without any work and the default weights)
+  const auto shapes = std::vector<std::vector<size_t>>{{64, 64, 64}, {37, 129, 17}, {3, 2, 100}};
+  const auto weights = std::vector<std::vector<double>>{{}, {1.0, 3.0, 0.0}};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL, with three queues on the same device
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queues = std::vector<Queue>{queue, Queue(context, device), Queue(context, device)};
+  auto queues_plain = std::vector<RawCommandQueue>();
+  for (const auto &multi_queue : queues) { queues_plain.push_back(multi_queue()); }
+
+  // Also partitions the device into sub-devices (if supported), tested with the default weights
+  auto sub_device_queues = std::vector<RawCommandQueue>();
+  if (CreateSubDeviceQueues(device(), sub_device_queues) != StatusCode::kSuccess) { return 1; }
+  fprintf(stdout, "* Using %zu sub-device queue(s)\n", sub_device_queues.size());
+
+  fprintf(stdout, "* Testing the multi-device GEMM for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &shape : shapes) {
+    for (const auto &weight : weights) {
+      for (const auto layout : layouts) {
+        for (const auto a_transpose : transposes) {
+          for (const auto b_transpose : transposes) {
+            const auto m = shape[0];
+            const auto n = shape[1];
+            const auto k = shape[2];
+            const auto a_rotated = (layout == Layout::kColMajor) == (a_transpose != Transpose::kNo);
+            const auto b_rotated = (layout == Layout::kColMajor) == (b_transpose != Transpose::kNo);
+            const auto a_ld = (a_rotated) ? k + 1 : m + 1;  // includes some padding
+            const auto b_ld = (b_rotated) ? n : k;
+            const auto c_ld = (layout == Layout::kColMajor) ? m + 2 : n + 2;
+            const auto a_two = (a_rotated) ? m : k;
+            const auto b_two = (b_rotated) ? k : n;
+            const auto c_two = (layout == Layout::kColMajor) ? n : m;
+
+            // Populates the host matrices with some example data
+            auto host_a = std::vector<T>(a_ld * a_two);
+            auto host_b = std::vector<T>(b_ld * b_two);
+            auto host_c = std::vector<T>(c_ld * c_two);
+            PopulateVector(host_a, mt, dist);
+            PopulateVector(host_b, mt, dist);
+            PopulateVector(host_c, mt, dist);
+
+            // Runs the regular GEMM on a single queue as the reference
+            auto device_a = Buffer<T>(context, host_a.size());
+            auto device_b = Buffer<T>(context, host_b.size());
+            auto device_c = Buffer<T>(context, host_c.size());
+            device_a.Write(queue, host_a.size(), host_a);
+            device_b.Write(queue, host_b.size(), host_b);
+            device_c.Write(queue, host_c.size(), host_c);
+            auto queue_plain = queue();
+            auto status = Gemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                               device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                               device_c(), 0, c_ld, &queue_plain);
+            if (status != StatusCode::kSuccess) { errors++; continue; }
+            auto result_reference = std::vector<T>(host_c.size());
+            device_c.Read(queue, result_reference.size(), result_reference);
+
+            // Runs the multi-device GEMM on the host data, and on the sub-devices for the default
+            // weights, and compares the results including the padding which should be untouched
+            const auto num_runs = (weight.empty()) ? 2 : 1;
+            for (auto run = 0; run < num_runs; ++run) {
+              auto result_multi_device = host_c;
+              status = GemmMultiDevice(layout, a_transpose, b_transpose, m, n, k, alpha,
+                                       host_a.data(), a_ld, host_b.data(), b_ld, beta,
+                                       result_multi_device.data(), c_ld,
+                                       (run == 0) ? queues_plain : sub_device_queues, weight);
+              if (status != StatusCode::kSuccess) { errors++; continue; }
+              auto matches = true;
+              for (auto i = size_t{0}; i < result_multi_device.size(); ++i) {
+                if (std::abs(result_reference[i] - result_multi_device[i]) > 1e-3 * std::abs(result_reference[i]) + 1e-3) {
+                  matches = false;
+                }
+              }
+              if (matches) { passed++; } else { errors++; }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  for (auto &sub_device_queue : sub_device_queues) { clReleaseCommandQueue(sub_device_queue); }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+template <typename T>
+size_t RunGemmStridedBatchedMultiDeviceTests(int argc, char *argv[], const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // Determines the test settings: the batch counts (including fewer entries than queues), the
+  // weights of three queues, and whether matrix A is shared by all entries (a stride of zero)
+  const auto m = size_t{37};
+  const auto n = size_t{29};
+  const auto k = size_t{17};
+  const auto batch_counts = std::vector<size_t>{1, 2, 9};
+  const auto weights = std::vector<std::vector<double>>{{}, {1.0, 3.0, 0.0}};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+
+  // Initializes OpenCL, with three queues on the same device
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queues = std::vector<Queue>{queue, Queue(context, device), Queue(context, device)};
+  auto queues_plain = std::vector<RawCommandQueue>();
+  for (const auto &multi_queue : queues) { queues_plain.push_back(multi_queue()); }
+
+  fprintf(stdout, "* Testing the multi-device strided-batched GEMM for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto batch_count : batch_counts) {
+    for (const auto &weight : weights) {
+      for (const auto layout : layouts) {
+        for (const auto shared_a : {false, true}) {
+          const auto a_ld = (layout == Layout::kColMajor) ? m : k;
+          const auto b_ld = (layout == Layout::kColMajor) ? k : n;
+          const auto c_ld = (layout == Layout::kColMajor) ? m : n;
+          const auto a_stride = (shared_a) ? size_t{0} : m * k;
+          const auto b_stride = k * n + 3;  // includes some padding
+          const auto c_stride = m * n + 5;  // includes some padding
+
+          // Populates the host matrices with some example data
+          auto host_a = std::vector<T>(a_stride * (batch_count - 1) + m * k);
+          auto host_b = std::vector<T>(b_stride * batch_count);
+          auto host_c = std::vector<T>(c_stride * batch_count);
+          PopulateVector(host_a, mt, dist);
+          PopulateVector(host_b, mt, dist);
+          PopulateVector(host_c, mt, dist);
+
+          // Runs the regular strided-batched GEMM on a single queue as the reference
+          auto device_a = Buffer<T>(context, host_a.size());
+          auto device_b = Buffer<T>(context, host_b.size());
+          auto device_c = Buffer<T>(context, host_c.size());
+          device_a.Write(queue, host_a.size(), host_a);
+          device_b.Write(queue, host_b.size(), host_b);
+          device_c.Write(queue, host_c.size(), host_c);
+          auto queue_plain = queue();
+          auto status = GemmStridedBatched(layout, Transpose::kNo, Transpose::kNo, m, n, k, alpha,
+                                           device_a(), 0, a_ld, a_stride,
+                                           device_b(), 0, b_ld, b_stride, beta,
+                                           device_c(), 0, c_ld, c_stride, batch_count,
+                                           &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          auto result_reference = std::vector<T>(host_c.size());
+          device_c.Read(queue, result_reference.size(), result_reference);
+
+          // Runs the multi-device version on the host data and compares the results, including the
+          // padding between the matrices which should be untouched
+          auto result_multi_device = host_c;
+          status = GemmStridedBatchedMultiDevice(layout, Transpose::kNo, Transpose::kNo, m, n, k,
+                                                 alpha, host_a.data(), a_ld, a_stride,
+                                                 host_b.data(), b_ld, b_stride, beta,
+                                                 result_multi_device.data(), c_ld, c_stride,
+                                                 batch_count, queues_plain, weight);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          auto matches = true;
+          for (auto i = size_t{0}; i < result_multi_device.size(); ++i) {
+            if (std::abs(result_reference[i] - result_multi_device[i]) > 1e-3 * std::abs(result_reference[i]) + 1e-3) {
+              matches = false;
+            }
+          }
+          if (matches) { passed++; } else { errors++; }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmMultiDeviceTests<float>(argc, argv, false, "SGEMMMULTIDEVICE");
+  errors += clblast::RunGemmMultiDeviceTests<clblast::float2>(argc, argv, true, "CGEMMMULTIDEVICE");
+  errors += clblast::RunGemmStridedBatchedMultiDeviceTests<float>(argc, argv, "SGEMMSTRIDEDBATCHEDMULTIDEVICE");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,147 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the out-of-place GEMM routine: the output matrix D should match
+// the result of the regular in-place GEMM routine, and matrix C should not be modified.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemmOutOfPlaceTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  constexpr auto kDOffset = size_t{3}; // the offset of matrix D
+  constexpr auto kDPadding = size_t{2}; // the leading dimension of D is larger than that of C
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+
+  // Determines the test settings: small sizes use the direct kernel, larger ones the indirect one
+  const auto sizes = std::vector<size_t>{7, 257};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto a_transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes};
+  const auto betas = std::vector<T>{T{0}, GetScalar<T>()};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  fprintf(stdout, "* Testing the out-of-place GEMM for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (const auto size : sizes) {
+    const auto m = size;
+    const auto n = size + 1;
+    const auto k = size + 2;
+    for (const auto layout : layouts) {
+      for (const auto a_transpose : a_transposes) {
+        for (const auto beta : betas) {
+          const auto a_rotated = (layout == Layout::kRowMajor) == (a_transpose == Transpose::kNo);
+          const auto a_ld = (a_rotated) ? k : m;
+          const auto b_ld = (layout == Layout::kColMajor) ? k : n;
+          const auto c_ld = (layout == Layout::kColMajor) ? m : n;
+          const auto d_ld = c_ld + kDPadding;
+          const auto c_size = m * n;
+          const auto d_size = kDOffset + d_ld * ((layout == Layout::kColMajor) ? n : m);
+
+          // Populates the matrices with random data
+          auto host_a = std::vector<T>(m * k);
+          auto host_b = std::vector<T>(k * n);
+          auto host_c = std::vector<T>(c_size);
+          for (auto &value : host_a) { value = static_cast<T>(dist(mt)); }
+          for (auto &value : host_b) { value = static_cast<T>(dist(mt)); }
+          for (auto &value : host_c) { value = static_cast<T>(dist(mt)); }
+          auto device_a = Buffer<T>(context, host_a.size());
+          auto device_b = Buffer<T>(context, host_b.size());
+          auto device_c = Buffer<T>(context, c_size);
+          auto device_c_reference = Buffer<T>(context, c_size);
+          auto device_d = Buffer<T>(context, d_size);
+          device_a.Write(queue, host_a.size(), host_a);
+          device_b.Write(queue, host_b.size(), host_b);
+          device_c.Write(queue, c_size, host_c);
+          device_c_reference.Write(queue, c_size, host_c);
+          device_d.Write(queue, d_size, std::vector<T>(d_size, T{0}));
+
+          // Runs the regular GEMM in-place and the out-of-place GEMM
+          auto status = Gemm(layout, a_transpose, Transpose::kNo, m, n, k, alpha,
+                             device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                             device_c_reference(), 0, c_ld, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = GemmOutOfPlace(layout, a_transpose, Transpose::kNo, m, n, k, alpha,
+                                  device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                                  device_c(), 0, c_ld, device_d(), kDOffset, d_ld, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+
+          // Compares the results: D with the in-place result and C with its original values
+          auto result_reference = std::vector<T>(c_size);
+          auto result_c = std::vector<T>(c_size);
+          auto result_d = std::vector<T>(d_size);
+          device_c_reference.Read(queue, c_size, result_reference);
+          device_c.Read(queue, c_size, result_c);
+          device_d.Read(queue, d_size, result_d);
+          auto matches = (result_c == host_c);
+          const auto rows = (layout == Layout::kColMajor) ? m : n;
+          const auto columns = (layout == Layout::kColMajor) ? n : m;
+          for (auto column = size_t{0}; column < columns; ++column) {
+            for (auto row = size_t{0}; row < rows; ++row) {
+              const auto reference = result_reference[column * c_ld + row];
+              const auto result = result_d[kDOffset + column * d_ld + row];
+              if (std::abs(reference - result) > 1e-4 * std::abs(reference) + 1e-5) {
+                matches = false;
+              }
+            }
+          }
+          if (matches) { passed++; } else { errors++; }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmOutOfPlaceTests<float>(argc, argv, false, "SGEMM");
+  errors += clblast::RunGemmOutOfPlaceTests<double>(argc, argv, true, "DGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
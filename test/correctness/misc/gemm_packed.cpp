@@ -0,0 +1,161 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for GEMM with packed operands: the results should match those of
+// the regular GEMM routine for all combinations of packed operands, layouts, and transposes.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemmPackedTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // Determines the test settings: the packed versions always use the indirect kernel
+  const auto sizes = std::vector<size_t>{7, 257};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes};
+  const auto packings = std::vector<std::pair<bool, bool>>{{true, false}, {false, true}, {true, true}};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing GEMM with packed operands for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto size : sizes) {
+    for (const auto layout : layouts) {
+      for (const auto a_transpose : transposes) {
+        for (const auto b_transpose : transposes) {
+          for (const auto packing : packings) {
+            const auto m = size;
+            const auto n = size + 1;
+            const auto k = size + 2;
+            const auto a_rotated = (layout == Layout::kColMajor) == (a_transpose != Transpose::kNo);
+            const auto b_rotated = (layout == Layout::kColMajor) == (b_transpose != Transpose::kNo);
+            const auto a_ld = (a_rotated) ? k : m;
+            const auto b_ld = (b_rotated) ? n : k;
+            const auto c_ld = (layout == Layout::kColMajor) ? m : n;
+
+            // Populates the host matrices with some example data
+            auto host_a = std::vector<T>(m * k);
+            auto host_b = std::vector<T>(n * k);
+            auto host_c = std::vector<T>(m * n);
+            PopulateVector(host_a, mt, dist);
+            PopulateVector(host_b, mt, dist);
+            PopulateVector(host_c, mt, dist);
+
+            // Copies the data to the device: one output matrix for the reference and the packed one
+            auto device_a = Buffer<T>(context, host_a.size());
+            auto device_b = Buffer<T>(context, host_b.size());
+            auto device_c_reference = Buffer<T>(context, host_c.size());
+            auto device_c_packed = Buffer<T>(context, host_c.size());
+            device_a.Write(queue, host_a.size(), host_a);
+            device_b.Write(queue, host_b.size(), host_b);
+            device_c_reference.Write(queue, host_c.size(), host_c);
+            device_c_packed.Write(queue, host_c.size(), host_c);
+
+            // Runs the regular GEMM
+            auto queue_plain = queue();
+            auto status = Gemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                               device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                               device_c_reference(), 0, c_ld, &queue_plain);
+            if (status != StatusCode::kSuccess) { errors++; continue; }
+
+            // Packs the operands
+            auto a_packed_size = size_t{0};
+            auto b_packed_size = size_t{0};
+            status = GemmPackedOperandSize<T>(GemmOperand::kA, m, n, k, &queue_plain, a_packed_size);
+            if (status != StatusCode::kSuccess) { errors++; continue; }
+            status = GemmPackedOperandSize<T>(GemmOperand::kB, m, n, k, &queue_plain, b_packed_size);
+            if (status != StatusCode::kSuccess) { errors++; continue; }
+            auto device_a_packed = Buffer<T>(context, a_packed_size / sizeof(T));
+            auto device_b_packed = Buffer<T>(context, b_packed_size / sizeof(T));
+            if (packing.first) {
+              status = GemmPackOperand<T>(layout, GemmOperand::kA, a_transpose, m, n, k,
+                                          device_a(), 0, a_ld, device_a_packed(), &queue_plain);
+              if (status != StatusCode::kSuccess) { errors++; continue; }
+            }
+            if (packing.second) {
+              status = GemmPackOperand<T>(layout, GemmOperand::kB, b_transpose, m, n, k,
+                                          device_b(), 0, b_ld, device_b_packed(), &queue_plain);
+              if (status != StatusCode::kSuccess) { errors++; continue; }
+            }
+
+            // Runs GEMM with the packed operands
+            status = GemmWithPackedOperands(layout, a_transpose, b_transpose, m, n, k, alpha,
+                                            (packing.first) ? device_a_packed() : device_a(), 0, a_ld, packing.first,
+                                            (packing.second) ? device_b_packed() : device_b(), 0, b_ld, packing.second,
+                                            beta, device_c_packed(), 0, c_ld, &queue_plain);
+            if (status != StatusCode::kSuccess) { errors++; continue; }
+
+            // Compares the results
+            auto result_reference = std::vector<T>(host_c.size());
+            auto result_packed = std::vector<T>(host_c.size());
+            device_c_reference.Read(queue, result_reference.size(), result_reference);
+            device_c_packed.Read(queue, result_packed.size(), result_packed);
+            auto matches = true;
+            for (auto i = size_t{0}; i < result_packed.size(); ++i) {
+              if (std::abs(result_reference[i] - result_packed[i]) > 1e-4 * std::abs(result_reference[i]) + 1e-5) {
+                matches = false;
+              }
+            }
+            if (matches) { passed++; } else { errors++; }
+          }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmPackedTests<float>(argc, argv, false, "SGEMM");
+  errors += clblast::RunGemmPackedTests<double>(argc, argv, true, "DGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
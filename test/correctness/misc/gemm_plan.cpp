@@ -0,0 +1,138 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the GEMM plan API: executing a plan should give the same result
+// as calling the regular GEMM routine with the same arguments.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <complex>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemmPlanTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  constexpr auto kNumExecutions = 3; // a plan is executed multiple times
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // Determines the test settings: small sizes use the direct kernel, larger ones the indirect one
+  const auto sizes = std::vector<size_t>{7, 64, 257};
+  const auto transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing the GEMM plan API for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto size : sizes) {
+    for (const auto a_transpose : transposes) {
+      for (const auto b_transpose : transposes) {
+        const auto m = size;
+        const auto n = size + 1;
+        const auto k = size + 2;
+        const auto a_ld = (a_transpose == Transpose::kNo) ? m : k;
+        const auto b_ld = (b_transpose == Transpose::kNo) ? k : n;
+        const auto c_ld = m;
+
+        // Populates the host matrices with some example data
+        auto host_a = std::vector<T>(m * k);
+        auto host_b = std::vector<T>(n * k);
+        auto host_c = std::vector<T>(m * n);
+        PopulateVector(host_a, mt, dist);
+        PopulateVector(host_b, mt, dist);
+        PopulateVector(host_c, mt, dist);
+
+        // Copies the matrices to the device: one output matrix for each of the two APIs
+        auto device_a = Buffer<T>(context, host_a.size());
+        auto device_b = Buffer<T>(context, host_b.size());
+        auto device_c_reference = Buffer<T>(context, host_c.size());
+        auto device_c_plan = Buffer<T>(context, host_c.size());
+        device_a.Write(queue, host_a.size(), host_a);
+        device_b.Write(queue, host_b.size(), host_b);
+        device_c_reference.Write(queue, host_c.size(), host_c);
+        device_c_plan.Write(queue, host_c.size(), host_c);
+
+        // Runs the regular GEMM and the plan equally many times
+        auto queue_plain = queue();
+        auto plan = static_cast<GemmPlan<T>*>(nullptr);
+        auto status = GemmPlanCreate<T>(Layout::kColMajor, a_transpose, b_transpose, m, n, k,
+                                        0, a_ld, 0, b_ld, 0, c_ld, &queue_plain, &plan);
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+        for (auto i = 0; i < kNumExecutions; ++i) {
+          status = Gemm(Layout::kColMajor, a_transpose, b_transpose, m, n, k, alpha,
+                        device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                        device_c_reference(), 0, c_ld, &queue_plain);
+          if (status != StatusCode::kSuccess) { break; }
+          status = GemmPlanExecute(plan, alpha, device_a(), device_b(), beta, device_c_plan(),
+                                   &queue_plain);
+          if (status != StatusCode::kSuccess) { break; }
+        }
+        GemmPlanDestroy(plan);
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+
+        // Compares the results: both should run exactly the same kernels
+        auto result_reference = std::vector<T>(host_c.size());
+        auto result_plan = std::vector<T>(host_c.size());
+        device_c_reference.Read(queue, result_reference.size(), result_reference);
+        device_c_plan.Read(queue, result_plan.size(), result_plan);
+        auto matches = true;
+        for (auto i = size_t{0}; i < result_plan.size(); ++i) {
+          if (std::abs(result_reference[i] - result_plan[i]) > 1e-4 * std::abs(result_reference[i])) {
+            matches = false;
+          }
+        }
+        if (matches) { passed++; } else { errors++; }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmPlanTests<float>(argc, argv, false, "SGEMM");
+  errors += clblast::RunGemmPlanTests<clblast::float2>(argc, argv, true, "CGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
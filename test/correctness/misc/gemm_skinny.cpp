@@ -0,0 +1,141 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the skinny GEMM kernel, which is selected for a small 'n' or 'm':
+// the results should match a reference computed on the host for all layouts and transposes.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemmSkinnyTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // Determines the test settings: a small 'n', a small 'm', and the largest supported 'n' with a
+  // 'k' which is not a multiple of the kernel's chunk size
+  const auto shapes = std::vector<std::vector<size_t>>{{300, 5, 70}, {7, 513, 33}, {1024, 16, 47}};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing the skinny GEMM kernel for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &shape : shapes) {
+    for (const auto layout : layouts) {
+      for (const auto a_transpose : transposes) {
+        for (const auto b_transpose : transposes) {
+          const auto m = shape[0];
+          const auto n = shape[1];
+          const auto k = shape[2];
+          const auto a_rotated = (layout == Layout::kColMajor) == (a_transpose != Transpose::kNo);
+          const auto b_rotated = (layout == Layout::kColMajor) == (b_transpose != Transpose::kNo);
+          const auto a_ld = (a_rotated) ? k : m;
+          const auto b_ld = (b_rotated) ? n : k;
+          const auto c_ld = (layout == Layout::kColMajor) ? m : n;
+
+          // Populates the host matrices with some example data
+          auto host_a = std::vector<T>(m * k);
+          auto host_b = std::vector<T>(n * k);
+          auto host_c = std::vector<T>(m * n);
+          PopulateVector(host_a, mt, dist);
+          PopulateVector(host_b, mt, dist);
+          PopulateVector(host_c, mt, dist);
+
+          // Computes the reference result on the host
+          auto reference = std::vector<T>(host_c.size());
+          for (auto i = size_t{0}; i < m; ++i) {
+            for (auto j = size_t{0}; j < n; ++j) {
+              auto sum = ConstantZero<T>();
+              for (auto l = size_t{0}; l < k; ++l) {
+                const auto a_value = host_a[(a_rotated) ? i*a_ld + l : l*a_ld + i];
+                const auto b_value = host_b[(b_rotated) ? j*b_ld + l : l*b_ld + j];
+                sum += a_value * b_value;
+              }
+              const auto c_index = (layout == Layout::kColMajor) ? j*c_ld + i : i*c_ld + j;
+              reference[c_index] = alpha * sum + beta * host_c[c_index];
+            }
+          }
+
+          // Runs GEMM on the device
+          auto device_a = Buffer<T>(context, host_a.size());
+          auto device_b = Buffer<T>(context, host_b.size());
+          auto device_c = Buffer<T>(context, host_c.size());
+          device_a.Write(queue, host_a.size(), host_a);
+          device_b.Write(queue, host_b.size(), host_b);
+          device_c.Write(queue, host_c.size(), host_c);
+          auto queue_plain = queue();
+          const auto status = Gemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                                   device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                                   device_c(), 0, c_ld, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+
+          // Compares the results
+          auto result = std::vector<T>(host_c.size());
+          device_c.Read(queue, result.size(), result);
+          auto matches = true;
+          for (auto i = size_t{0}; i < result.size(); ++i) {
+            if (std::abs(reference[i] - result[i]) > 1e-3 * std::abs(reference[i]) + 1e-3) {
+              matches = false;
+            }
+          }
+          if (matches) { passed++; } else { errors++; }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmSkinnyTests<float>(argc, argv, false, "SGEMM");
+  errors += clblast::RunGemmSkinnyTests<clblast::float2>(argc, argv, true, "CGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,139 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the streaming version of GEMM. Small tile sizes are used to test
+// the tiling and double-buffering: the results for host matrices should match those of the regular
+// GEMM on device buffers.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <complex>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemmStreamingTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // Determines the test settings: the shapes and the tile sizes (including the default)
+  const auto shapes = std::vector<std::vector<size_t>>{{64, 64, 64}, {37, 129, 17}, {3, 2, 100}};
+  const auto tile_sizes = std::vector<size_t>{0, 16, 40};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing the streaming GEMM for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &shape : shapes) {
+    for (const auto tile_size : tile_sizes) {
+      for (const auto layout : layouts) {
+        for (const auto a_transpose : transposes) {
+          for (const auto b_transpose : transposes) {
+            const auto m = shape[0];
+            const auto n = shape[1];
+            const auto k = shape[2];
+            const auto a_rotated = (layout == Layout::kColMajor) == (a_transpose != Transpose::kNo);
+            const auto b_rotated = (layout == Layout::kColMajor) == (b_transpose != Transpose::kNo);
+            const auto a_ld = (a_rotated) ? k + 1 : m + 1;  // includes some padding
+            const auto b_ld = (b_rotated) ? n : k;
+            const auto c_ld = (layout == Layout::kColMajor) ? m + 2 : n + 2;
+            const auto a_two = (a_rotated) ? m : k;
+            const auto b_two = (b_rotated) ? k : n;
+            const auto c_two = (layout == Layout::kColMajor) ? n : m;
+
+            // Populates the host matrices with some example data
+            auto host_a = std::vector<T>(a_ld * a_two);
+            auto host_b = std::vector<T>(b_ld * b_two);
+            auto host_c = std::vector<T>(c_ld * c_two);
+            PopulateVector(host_a, mt, dist);
+            PopulateVector(host_b, mt, dist);
+            PopulateVector(host_c, mt, dist);
+
+            // Runs the regular GEMM on a single queue as the reference
+            auto device_a = Buffer<T>(context, host_a.size());
+            auto device_b = Buffer<T>(context, host_b.size());
+            auto device_c = Buffer<T>(context, host_c.size());
+            device_a.Write(queue, host_a.size(), host_a);
+            device_b.Write(queue, host_b.size(), host_b);
+            device_c.Write(queue, host_c.size(), host_c);
+            auto queue_plain = queue();
+            auto status = Gemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                               device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                               device_c(), 0, c_ld, &queue_plain);
+            if (status != StatusCode::kSuccess) { errors++; continue; }
+            auto result_reference = std::vector<T>(host_c.size());
+            device_c.Read(queue, result_reference.size(), result_reference);
+
+            // Runs the streaming GEMM on the host data
+            auto result_streaming = host_c;
+            status = GemmStreaming(layout, a_transpose, b_transpose, m, n, k, alpha,
+                                   host_a.data(), a_ld, host_b.data(), b_ld, beta,
+                                   result_streaming.data(), c_ld, &queue_plain, tile_size);
+            if (status != StatusCode::kSuccess) { errors++; continue; }
+
+            // Compares the results, including the padding which should be left untouched
+            auto matches = true;
+            for (auto i = size_t{0}; i < result_streaming.size(); ++i) {
+              if (std::abs(result_reference[i] - result_streaming[i]) > 1e-3 * std::abs(result_reference[i]) + 1e-3) {
+                matches = false;
+              }
+            }
+            if (matches) { passed++; } else { errors++; }
+          }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmStreamingTests<float>(argc, argv, false, "SGEMMSTREAMING");
+  errors += clblast::RunGemmStreamingTests<clblast::float2>(argc, argv, true, "CGEMMSTREAMING");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,207 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the distributed GEMM with the SUMMA algorithm, to be run with
+// MPI on any number of processes (e.g. 'mpirun -np 2'). All processes generate the same full
+// matrices, of which they pass their block-cyclic local parts to 'GemmSumma'. Their local results
+// should match the corresponding parts of the regular GEMM on the full matrices. This is tested on
+// all 2D grids for the number of processes, e.g. 2x1 and 1x2 for two processes.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+#include "clblast_distributed.h"
+
+namespace clblast {
+// =================================================================================================
+
+// Extracts the local part of a column-major 'rows' by 'cols' matrix on the process at grid position
+// ('proc_row', 'proc_col'), stored column-major with a leading dimension of its number of rows
+template <typename T>
+std::vector<T> LocalPart(const std::vector<T> &matrix, const size_t rows, const size_t cols,
+                         const size_t block_size, const size_t proc_row, const size_t grid_rows,
+                         const size_t proc_col, const size_t grid_cols) {
+  const auto local_rows = NumLocal(rows, block_size, proc_row, grid_rows);
+  const auto local_cols = NumLocal(cols, block_size, proc_col, grid_cols);
+  auto local = std::vector<T>(std::max(local_rows * local_cols, size_t{1}));
+  for (auto j = size_t{0}; j < cols; ++j) {
+    if ((j / block_size) % grid_cols != proc_col) { continue; }
+    const auto local_j = (j / (block_size * grid_cols)) * block_size + j % block_size;
+    for (auto i = size_t{0}; i < rows; ++i) {
+      if ((i / block_size) % grid_rows != proc_row) { continue; }
+      const auto local_i = (i / (block_size * grid_rows)) * block_size + i % block_size;
+      local[local_j * local_rows + local_i] = matrix[j * rows + i];
+    }
+  }
+  return local;
+}
+
+template <typename T>
+size_t RunGemmSummaTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility, such that all processes agree
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // The processes and all grids for them
+  auto num_procs = 0;
+  auto rank = 0;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_procs);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  auto grids = std::vector<std::vector<size_t>>();
+  for (auto grid_rows = size_t{1}; grid_rows <= static_cast<size_t>(num_procs); ++grid_rows) {
+    if (num_procs % grid_rows == 0) { grids.push_back({grid_rows, num_procs / grid_rows}); }
+  }
+
+  // Determines the test settings: the shapes (including one with fewer blocks than processes) and
+  // the block sizes
+  const auto shapes = std::vector<std::vector<size_t>>{{64, 64, 64}, {37, 129, 17}, {5, 3, 70}};
+  const auto block_sizes = std::vector<size_t>{8, 16};
+
+  // Prints the help message (command-line arguments)
+  if (!silent && rank == 0) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  if (rank == 0) {
+    fprintf(stdout, "* Testing the distributed GEMM for '%s' on %d process(es)\n",
+            routine_name.c_str(), num_procs);
+  }
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &grid : grids) {
+    const auto grid_rows = grid[0];
+    const auto grid_cols = grid[1];
+    const auto proc_row = static_cast<size_t>(rank) / grid_cols;
+    const auto proc_col = static_cast<size_t>(rank) % grid_cols;
+    for (const auto &shape : shapes) {
+      for (const auto block_size : block_sizes) {
+        const auto m = shape[0];
+        const auto n = shape[1];
+        const auto k = shape[2];
+
+        // The full matrices and the reference result of the regular GEMM on a single process
+        auto a_mat = std::vector<T>(m * k);
+        auto b_mat = std::vector<T>(k * n);
+        auto c_mat = std::vector<T>(m * n);
+        PopulateVector(a_mat, mt, dist);
+        PopulateVector(b_mat, mt, dist);
+        PopulateVector(c_mat, mt, dist);
+        auto a_device = Buffer<T>(context, a_mat.size());
+        auto b_device = Buffer<T>(context, b_mat.size());
+        auto c_device = Buffer<T>(context, c_mat.size());
+        a_device.Write(queue, a_mat.size(), a_mat);
+        b_device.Write(queue, b_mat.size(), b_mat);
+        c_device.Write(queue, c_mat.size(), c_mat);
+        const auto reference_status = Gemm(Layout::kColMajor, Transpose::kNo, Transpose::kNo,
+                                           m, n, k, alpha, a_device(), 0, m, b_device(), 0, k,
+                                           beta, c_device(), 0, m, &queue_plain);
+        auto reference = std::vector<T>(c_mat.size());
+        c_device.Read(queue, reference.size(), reference);
+
+        // The local parts of the matrices on this process
+        const auto local_m = NumLocal(m, block_size, proc_row, grid_rows);
+        const auto local_k_rows = NumLocal(k, block_size, proc_row, grid_rows);
+        const auto a_ld = std::max(local_m, size_t{1});
+        const auto b_ld = std::max(local_k_rows, size_t{1});
+        const auto c_ld = std::max(local_m, size_t{1});
+        auto a_local = LocalPart(a_mat, m, k, block_size, proc_row, grid_rows, proc_col, grid_cols);
+        auto b_local = LocalPart(b_mat, k, n, block_size, proc_row, grid_rows, proc_col, grid_cols);
+        auto c_local = LocalPart(c_mat, m, n, block_size, proc_row, grid_rows, proc_col, grid_cols);
+        const auto c_reference = LocalPart(reference, m, n, block_size,
+                                           proc_row, grid_rows, proc_col, grid_cols);
+        auto a_local_device = Buffer<T>(context, a_local.size());
+        auto b_local_device = Buffer<T>(context, b_local.size());
+        auto c_local_device = Buffer<T>(context, c_local.size());
+        a_local_device.Write(queue, a_local.size(), a_local);
+        b_local_device.Write(queue, b_local.size(), b_local);
+        c_local_device.Write(queue, c_local.size(), c_local);
+
+        // Runs the distributed GEMM and compares the local results
+        const auto status = GemmSumma(m, n, k, alpha, a_local_device(), 0, a_ld,
+                                      b_local_device(), 0, b_ld, beta, c_local_device(), 0, c_ld,
+                                      block_size, grid_rows, grid_cols, MPI_COMM_WORLD,
+                                      &queue_plain);
+        auto result = std::vector<T>(c_local.size());
+        c_local_device.Read(queue, result.size(), result);
+        auto matches = (status == StatusCode::kSuccess) &&
+                       (reference_status == StatusCode::kSuccess);
+        for (auto i = size_t{0}; i < result.size(); ++i) {
+          if (std::abs(c_reference[i] - result[i]) > 1e-4 * std::abs(c_reference[i]) + 1e-4) {
+            matches = false;
+          }
+        }
+        if (matches) { passed++; }
+        else {
+          fprintf(stdout, "    Error on rank %d for grid %zux%zu, m=%zu n=%zu k=%zu, block %zu\n",
+                  rank, grid_rows, grid_cols, m, n, k, block_size);
+          errors++;
+        }
+
+        // An invalid leading dimension on one process only: all processes return the error
+        const auto invalid_a_ld = (rank == 0) ? size_t{0} : a_ld;
+        const auto invalid_status = GemmSumma(m, n, k, alpha, a_local_device(), 0, invalid_a_ld,
+                                              b_local_device(), 0, b_ld,
+                                              beta, c_local_device(), 0, c_ld,
+                                              block_size, grid_rows, grid_cols, MPI_COMM_WORLD,
+                                              &queue_plain);
+        if (invalid_status == StatusCode::kInvalidLeadDimA) { passed++; }
+        else {
+          fprintf(stdout, "    Error on rank %d: status %d for an invalid leading dimension\n",
+                  rank, static_cast<int>(invalid_status));
+          errors++;
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics of all processes together
+  auto totals = std::vector<unsigned long long>{passed, errors};
+  MPI_Allreduce(MPI_IN_PLACE, totals.data(), 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+  if (rank == 0) {
+    std::cout << "    " << totals[0] << " test(s) passed" << std::endl;
+    std::cout << "    " << totals[1] << " test(s) failed" << std::endl;
+    std::cout << std::endl;
+  }
+  return static_cast<size_t>(totals[1]);
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  MPI_Init(&argc, &argv);
+  auto errors = size_t{0};
+  errors += clblast::RunGemmSummaTests<float>(argc, argv, false, "SGEMM");
+  errors += clblast::RunGemmSummaTests<clblast::float2>(argc, argv, true, "CGEMM");
+  MPI_Finalize();
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,147 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the fused GEMV pair: its two results should be the same as those
+// of two regular GEMV calls, one of them with the transposed matrix.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <complex>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemvPairTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Determines the test settings: sizes smaller and larger than a tile, and non-unit increments
+  const auto sizes = std::vector<size_t>{7, 64, 1000};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto increments = std::vector<size_t>{1, 2};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  // Compares the contents of two device buffers
+  const auto compare = [&](const Buffer<T> &reference, const Buffer<T> &result, const size_t size) {
+    auto host_reference = std::vector<T>(size);
+    auto host_result = std::vector<T>(size);
+    reference.Read(queue, size, host_reference);
+    result.Read(queue, size, host_result);
+    for (auto i = size_t{0}; i < size; ++i) {
+      if (std::abs(host_reference[i] - host_result[i]) > 1e-3 * std::abs(host_reference[i]) + 1e-4) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  fprintf(stdout, "* Testing the fused GEMV pair for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto size : sizes) {
+    for (const auto layout : layouts) {
+      for (const auto inc : increments) {
+        const auto m = size;
+        const auto n = size + 3;
+        const auto a_ld = (layout == Layout::kColMajor) ? m + 1 : n + 1;
+        const auto a_two = (layout == Layout::kColMajor) ? n : m;
+        const auto alpha = GetScalar<T>();
+        const auto beta = alpha + alpha;
+
+        // Populates the matrix and the vectors with some example data: 'x' and 'z' have 'n'
+        // elements, 'w' and 'y' have 'm' elements
+        auto host_a = std::vector<T>(a_ld * a_two);
+        auto host_x = std::vector<T>(n * inc);
+        auto host_w = std::vector<T>(m * inc);
+        auto host_y = std::vector<T>(m * inc);
+        auto host_z = std::vector<T>(n * inc);
+        PopulateVector(host_a, mt, dist);
+        PopulateVector(host_x, mt, dist);
+        PopulateVector(host_w, mt, dist);
+        PopulateVector(host_y, mt, dist);
+        PopulateVector(host_z, mt, dist);
+        auto device_a = Buffer<T>(context, host_a.size());
+        auto device_x = Buffer<T>(context, host_x.size());
+        auto device_w = Buffer<T>(context, host_w.size());
+        auto device_y_reference = Buffer<T>(context, host_y.size());
+        auto device_z_reference = Buffer<T>(context, host_z.size());
+        auto device_y_pair = Buffer<T>(context, host_y.size());
+        auto device_z_pair = Buffer<T>(context, host_z.size());
+        device_a.Write(queue, host_a.size(), host_a);
+        device_x.Write(queue, host_x.size(), host_x);
+        device_w.Write(queue, host_w.size(), host_w);
+        device_y_reference.Write(queue, host_y.size(), host_y);
+        device_z_reference.Write(queue, host_z.size(), host_z);
+        device_y_pair.Write(queue, host_y.size(), host_y);
+        device_z_pair.Write(queue, host_z.size(), host_z);
+
+        // Runs the two regular GEMVs and the fused version
+        auto status = Gemv(layout, Transpose::kNo, m, n, alpha, device_a(), 0, a_ld,
+                           device_x(), 0, inc, beta, device_y_reference(), 0, inc, &queue_plain);
+        status = (status != StatusCode::kSuccess) ? status :
+                 Gemv(layout, Transpose::kYes, m, n, alpha, device_a(), 0, a_ld,
+                      device_w(), 0, inc, beta, device_z_reference(), 0, inc, &queue_plain);
+        status = (status != StatusCode::kSuccess) ? status :
+                 GemvPair(layout, m, n, alpha, device_a(), 0, a_ld,
+                          device_x(), 0, inc, device_w(), 0, inc, beta,
+                          device_y_pair(), 0, inc, device_z_pair(), 0, inc, &queue_plain);
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+
+        // Compares the results
+        if (compare(device_y_reference, device_y_pair, host_y.size()) &&
+            compare(device_z_reference, device_z_pair, host_z.size())) { passed++; }
+        else { errors++; }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemvPairTests<float>(argc, argv, false, "SGEMVPAIR");
+  errors += clblast::RunGemvPairTests<double>(argc, argv, true, "DGEMVPAIR");
+  errors += clblast::RunGemvPairTests<clblast::float2>(argc, argv, true, "CGEMVPAIR");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
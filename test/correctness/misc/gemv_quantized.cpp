@@ -0,0 +1,181 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the matrix-vector and matrix-matrix multiplications with
+// quantised weights: the weights are quantised on the device, checked against their originals, and
+// then dequantised on the host to compute the reference results of GemvQuantized and GemmQuantized.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Extracts the signed integer with the given index out of a packed word, as in the kernel
+int UnpackQuantizedValue(const unsigned int word, const size_t index, const size_t bits) {
+  const auto value = static_cast<int>((word >> (bits * index)) & ((1u << bits) - 1u));
+  return (value >= (1 << (bits - 1))) ? value - (1 << bits) : value;
+}
+
+// Dequantises the packed m by k weights into a row-major matrix
+std::vector<double> DequantizeWeights(const std::vector<unsigned int> &words,
+                                      const std::vector<float> &scales, const size_t m,
+                                      const size_t k, const size_t group_size, const size_t bits) {
+  const auto values_per_word = size_t{32} / bits;
+  auto weights = std::vector<double>(m * k);
+  for (auto i = size_t{0}; i < m * k; ++i) {
+    const auto value = UnpackQuantizedValue(words[i / values_per_word], i % values_per_word, bits);
+    weights[i] = value * static_cast<double>(scales[i / group_size]);
+  }
+  return weights;
+}
+
+// Compares a result with a reference, relative to the magnitude of the reference
+bool IsCloseQuantized(const float result, const double reference) {
+  return std::abs(static_cast<double>(result) - reference) <= 1e-4 * (std::abs(reference) + 1.0);
+}
+
+size_t RunGemvQuantizedTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  // Sizes which are not multiples of the work-group size nor of the number of vectors per group,
+  // and leading dimensions larger than needed
+  const auto m = size_t{96};
+  const auto k = size_t{256};
+  const auto n = size_t{5};
+  const auto group_size = size_t{32};
+  const auto b_ld = k + 3;
+  const auto c_ld = m + 1;
+  const auto alpha = 1.5f;
+  const auto beta = 0.5f;
+
+  // Random weights, vectors and initial results
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  auto host_w = std::vector<float>(m * k);
+  auto host_b = std::vector<float>(b_ld * n);
+  auto host_c = std::vector<float>(c_ld * n);
+  for (auto &value : host_w) { value = dist(mt); }
+  for (auto &value : host_b) { value = dist(mt); }
+  for (auto &value : host_c) { value = dist(mt); }
+  auto w = Buffer<float>(context, host_w.size());
+  auto b = Buffer<float>(context, host_b.size());
+  w.Write(queue, host_w.size(), host_w);
+  b.Write(queue, host_b.size(), host_b);
+
+  for (const auto format : {QuantizedFormat::kInt8, QuantizedFormat::kInt4}) {
+    const auto bits = static_cast<size_t>(format);
+    const auto num_words = m * k * bits / 32;
+    const auto num_scales = m * k / group_size;
+    fprintf(stdout, "* Testing the %zu-bit quantised weights\n", bits);
+
+    // Quantises the weights: each dequantised weight is within half a step of the original
+    auto q = Buffer<unsigned int>(context, num_words);
+    auto scales = Buffer<float>(context, num_scales);
+    if (QuantizeWeights<float>(format, m, k, group_size, w(), 0, k, q(), 0, scales(), 0,
+                               &queue_plain) != StatusCode::kSuccess) {
+      errors++;
+      continue;
+    }
+    auto host_q = std::vector<unsigned int>(num_words);
+    auto host_scales = std::vector<float>(num_scales);
+    q.Read(queue, num_words, host_q);
+    scales.Read(queue, num_scales, host_scales);
+    const auto weights = DequantizeWeights(host_q, host_scales, m, k, group_size, bits);
+    auto quantisation_correct = true;
+    for (auto i = size_t{0}; i < m * k; ++i) {
+      const auto step = static_cast<double>(host_scales[i / group_size]);
+      if (std::abs(weights[i] - host_w[i]) > 0.5 * step + 1e-6) { quantisation_correct = false; }
+    }
+    if (quantisation_correct) { passed++; } else { errors++; }
+
+    // Multiplies with the first vector and with all vectors
+    for (const auto num_vectors : {size_t{1}, n}) {
+      auto c = Buffer<float>(context, host_c.size());
+      c.Write(queue, host_c.size(), host_c);
+      const auto status = (num_vectors == 1) ?
+          GemvQuantized<float>(format, m, k, group_size, alpha, q(), 0, scales(), 0,
+                               b(), 0, 1, beta, c(), 0, 1, &queue_plain) :
+          GemmQuantized<float>(format, m, num_vectors, k, group_size, alpha, q(), 0, scales(), 0,
+                               b(), 0, b_ld, beta, c(), 0, c_ld, &queue_plain);
+      if (status != StatusCode::kSuccess) {
+        errors++;
+        continue;
+      }
+      auto result = std::vector<float>(host_c.size());
+      c.Read(queue, result.size(), result);
+      auto results_correct = true;
+      for (auto j = size_t{0}; j < num_vectors; ++j) {
+        for (auto row = size_t{0}; row < m; ++row) {
+          auto sum = 0.0;
+          for (auto i = size_t{0}; i < k; ++i) {
+            sum += weights[row * k + i] * static_cast<double>(host_b[j * b_ld + i]);
+          }
+          const auto index = j * c_ld + row;
+          const auto reference = alpha * sum + beta * static_cast<double>(host_c[index]);
+          if (!IsCloseQuantized(result[index], reference)) { results_correct = false; }
+        }
+      }
+      if (results_correct) { passed++; } else { errors++; }
+    }
+  }
+
+  // Invalid group sizes: not a multiple of the values per word, and not dividing 'k'
+  auto q = Buffer<unsigned int>(context, m * k / 4);
+  auto scales = Buffer<float>(context, m * k);
+  auto y = Buffer<float>(context, m);
+  if (GemvQuantized<float>(QuantizedFormat::kInt4, m, k, 4, alpha, q(), 0, scales(), 0,
+                           b(), 0, 1, beta, y(), 0, 1, &queue_plain) == StatusCode::kInvalidDimension &&
+      GemvQuantized<float>(QuantizedFormat::kInt8, m, k, 24, alpha, q(), 0, scales(), 0,
+                           b(), 0, 1, beta, y(), 0, 1, &queue_plain) == StatusCode::kInvalidDimension) {
+    passed++;
+  }
+  else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunGemvQuantizedTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
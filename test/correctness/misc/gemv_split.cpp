@@ -0,0 +1,136 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the split version of GEMV, which is selected for short and wide
+// matrices (see 'SPLITN_RATIO' and 'SPLITN_CHUNK'): the results should match a reference computed
+// on the host for all layouts and transposes.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemvSplitTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // Determines the test settings: with the default thresholds the split version is used if the
+  // long dimension is the reduction dimension (with a partial last chunk), otherwise not
+  const auto shapes = std::vector<std::vector<size_t>>{{16, 8229}, {8229, 16}, {64, 4100}};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing the split GEMV kernel for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &shape : shapes) {
+    for (const auto layout : layouts) {
+      for (const auto a_transpose : transposes) {
+        const auto m = shape[0];
+        const auto n = shape[1];
+        const auto a_transposed = (a_transpose != Transpose::kNo);
+        const auto a_ld = (layout == Layout::kColMajor) ? m : n;
+        const auto x_size = (a_transposed) ? m : n;
+        const auto y_size = (a_transposed) ? n : m;
+
+        // Populates the host matrix and vectors with some example data
+        auto host_a = std::vector<T>(m * n);
+        auto host_x = std::vector<T>(x_size);
+        auto host_y = std::vector<T>(y_size);
+        PopulateVector(host_a, mt, dist);
+        PopulateVector(host_x, mt, dist);
+        PopulateVector(host_y, mt, dist);
+
+        // Computes the reference result on the host
+        auto reference = std::vector<T>(y_size);
+        for (auto i = size_t{0}; i < y_size; ++i) {
+          auto sum = ConstantZero<T>();
+          for (auto k = size_t{0}; k < x_size; ++k) {
+            const auto row = (a_transposed) ? k : i;
+            const auto col = (a_transposed) ? i : k;
+            const auto a_index = (layout == Layout::kColMajor) ? col*a_ld + row : row*a_ld + col;
+            sum += host_a[a_index] * host_x[k];
+          }
+          reference[i] = alpha * sum + beta * host_y[i];
+        }
+
+        // Runs GEMV on the device
+        auto device_a = Buffer<T>(context, host_a.size());
+        auto device_x = Buffer<T>(context, host_x.size());
+        auto device_y = Buffer<T>(context, host_y.size());
+        device_a.Write(queue, host_a.size(), host_a);
+        device_x.Write(queue, host_x.size(), host_x);
+        device_y.Write(queue, host_y.size(), host_y);
+        auto queue_plain = queue();
+        const auto status = Gemv(layout, a_transpose, m, n, alpha,
+                                 device_a(), 0, a_ld, device_x(), 0, 1, beta,
+                                 device_y(), 0, 1, &queue_plain);
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+
+        // Compares the results
+        auto result = std::vector<T>(host_y.size());
+        device_y.Read(queue, result.size(), result);
+        auto matches = true;
+        for (auto i = size_t{0}; i < result.size(); ++i) {
+          if (std::abs(reference[i] - result[i]) > 1e-3 * std::abs(reference[i]) + 1e-2) {
+            matches = false;
+          }
+        }
+        if (matches) { passed++; } else { errors++; }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemvSplitTests<float>(argc, argv, false, "SGEMV");
+  errors += clblast::RunGemvSplitTests<clblast::float2>(argc, argv, true, "CGEMV");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,146 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the Gerk routine: the accumulated rank-1 updates should match
+// the result of k calls to the regular Ger routine, both for vectors which form matrices (the GEMM
+// path) and for vectors which don't (the fall-back).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGerkTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+
+  // Determines the test settings: the vectors are consecutive (increment 1), interleaved (stride 1)
+  // or neither of the two (the fall-back to Ger)
+  const auto sizes = std::vector<size_t>{7, 129};
+  const auto ks = std::vector<size_t>{1, 9};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  enum class Storage { kConsecutive, kInterleaved, kStrided };
+  const auto storages = std::vector<Storage>{Storage::kConsecutive, Storage::kInterleaved,
+                                             Storage::kStrided};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  fprintf(stdout, "* Testing the accumulated rank-1 updates for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (const auto size : sizes) {
+    const auto m = size;
+    const auto n = size + 3;
+    for (const auto k : ks) {
+      for (const auto layout : layouts) {
+        for (const auto storage : storages) {
+          const auto x_inc = (storage == Storage::kConsecutive) ? size_t{1} :
+                             (storage == Storage::kInterleaved) ? k : size_t{2};
+          const auto x_stride = (storage == Storage::kConsecutive) ? m :
+                                (storage == Storage::kInterleaved) ? size_t{1} : 2 * m + 1;
+          const auto y_inc = (storage == Storage::kConsecutive) ? size_t{1} :
+                             (storage == Storage::kInterleaved) ? k : size_t{2};
+          const auto y_stride = (storage == Storage::kConsecutive) ? n :
+                                (storage == Storage::kInterleaved) ? size_t{1} : 2 * n + 1;
+          const auto x_size = (k - 1) * x_stride + (m - 1) * x_inc + 1;
+          const auto y_size = (k - 1) * y_stride + (n - 1) * y_inc + 1;
+          const auto a_ld = (layout == Layout::kColMajor) ? m : n;
+          const auto a_size = m * n;
+
+          // Populates the vectors and the matrix with random data
+          auto host_x = std::vector<T>(x_size);
+          auto host_y = std::vector<T>(y_size);
+          auto host_a = std::vector<T>(a_size);
+          for (auto &value : host_x) { value = static_cast<T>(dist(mt)); }
+          for (auto &value : host_y) { value = static_cast<T>(dist(mt)); }
+          for (auto &value : host_a) { value = static_cast<T>(dist(mt)); }
+          auto device_x = Buffer<T>(context, x_size);
+          auto device_y = Buffer<T>(context, y_size);
+          auto device_a = Buffer<T>(context, a_size);
+          auto device_a_reference = Buffer<T>(context, a_size);
+          device_x.Write(queue, x_size, host_x);
+          device_y.Write(queue, y_size, host_y);
+          device_a.Write(queue, a_size, host_a);
+          device_a_reference.Write(queue, a_size, host_a);
+
+          // Runs the regular Ger k times and the accumulated version once
+          auto status = StatusCode::kSuccess;
+          for (auto i = size_t{0}; i < k && status == StatusCode::kSuccess; ++i) {
+            status = Ger(layout, m, n, alpha,
+                         device_x(), i * x_stride, x_inc, device_y(), i * y_stride, y_inc,
+                         device_a_reference(), 0, a_ld, &queue_plain);
+          }
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+          status = Gerk(layout, m, n, k, alpha,
+                        device_x(), 0, x_inc, x_stride, device_y(), 0, y_inc, y_stride,
+                        device_a(), 0, a_ld, &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+
+          // Compares the results
+          auto result_reference = std::vector<T>(a_size);
+          auto result = std::vector<T>(a_size);
+          device_a_reference.Read(queue, a_size, result_reference);
+          device_a.Read(queue, a_size, result);
+          auto matches = true;
+          for (auto i = size_t{0}; i < a_size; ++i) {
+            if (std::abs(result_reference[i] - result[i]) > 1e-4 * std::abs(result_reference[i]) + 1e-5) {
+              matches = false;
+            }
+          }
+          if (matches) { passed++; } else { errors++; }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGerkTests<float>(argc, argv, false, "SGERK");
+  errors += clblast::RunGerkTests<double>(argc, argv, true, "DGERK");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,179 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the batched LU factorisation (GETRF) and solve (GETRS): the
+// factorisation is verified by reconstructing P * L * U and comparing it to the original matrix,
+// and the solve by computing the residual A * X - B, both with an element-wise backward error
+// bound. This is independent of the exact choice of pivots in case of (near) ties.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGetrfTests(int argc, char *argv[], const bool silent, const std::string &routine_name,
+                     const double tolerance) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Determines the test settings
+  const auto sizes = std::vector<size_t>{1, 7, 16, 33, 64};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto batch_counts = std::vector<size_t>{1, 3};
+  const auto nrhs = size_t{3};
+  const auto padding = size_t{2};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  fprintf(stdout, "* Testing the batched LU factorisation and solve for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto n : sizes) {
+    for (const auto layout : layouts) {
+      for (const auto batch_count : batch_counts) {
+        const auto a_ld = n + padding;
+        const auto a_stride = a_ld * n;
+        const auto b_ld = (layout == Layout::kColMajor) ? n + padding : nrhs + padding;
+        const auto b_stride = (layout == Layout::kColMajor) ? b_ld * nrhs : b_ld * n;
+        const auto ipiv_stride = n + 1;
+        const auto index = [&](const size_t row, const size_t col, const size_t ld) {
+          return (layout == Layout::kColMajor) ? col * ld + row : row * ld + col;
+        };
+
+        // Populates the matrices with some example data
+        auto host_a = std::vector<T>(a_stride * batch_count);
+        auto host_b = std::vector<T>(b_stride * batch_count);
+        PopulateVector(host_a, mt, dist);
+        PopulateVector(host_b, mt, dist);
+        auto device_a = Buffer<T>(context, host_a.size());
+        auto device_b = Buffer<T>(context, host_b.size());
+        auto device_ipiv = Buffer<unsigned int>(context, ipiv_stride * batch_count);
+        device_a.Write(queue, host_a.size(), host_a);
+        device_b.Write(queue, host_b.size(), host_b);
+
+        // Runs the factorisation followed by the solve
+        auto status = GetrfStridedBatched<T>(layout, n, device_a(), 0, a_ld, a_stride,
+                                             device_ipiv(), 0, ipiv_stride,
+                                             batch_count, &queue_plain);
+        if (status == StatusCode::kSuccess) {
+          status = GetrsStridedBatched<T>(layout, n, nrhs, device_a(), 0, a_ld, a_stride,
+                                          device_ipiv(), 0, ipiv_stride,
+                                          device_b(), 0, b_ld, b_stride,
+                                          batch_count, &queue_plain);
+        }
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+        auto host_lu = std::vector<T>(host_a.size());
+        auto host_x = std::vector<T>(host_b.size());
+        auto host_ipiv = std::vector<unsigned int>(ipiv_stride * batch_count);
+        device_a.Read(queue, host_lu.size(), host_lu);
+        device_b.Read(queue, host_x.size(), host_x);
+        device_ipiv.Read(queue, host_ipiv.size(), host_ipiv);
+
+        auto matches = true;
+        for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+          const auto a = &host_a[batch * a_stride];
+          const auto lu = &host_lu[batch * a_stride];
+          const auto b = &host_b[batch * b_stride];
+          const auto x = &host_x[batch * b_stride];
+          const auto ipiv = &host_ipiv[batch * ipiv_stride];
+
+          // Reconstructs L * U together with the bound |L| * |U| on its rounding errors
+          auto product = std::vector<T>(n * n, T{0});
+          auto bound = std::vector<double>(n * n, 0.0);
+          for (auto i = size_t{0}; i < n; ++i) {
+            for (auto j = size_t{0}; j < n; ++j) {
+              for (auto k = size_t{0}; k <= std::min(i, j); ++k) {
+                const auto l_value = (k == i) ? T{1} : lu[index(i, k, a_ld)];
+                const auto u_value = lu[index(k, j, a_ld)];
+                product[i * n + j] += l_value * u_value;
+                bound[i * n + j] += std::abs(l_value) * std::abs(u_value);
+              }
+            }
+          }
+
+          // Applies the row interchanges in reverse to obtain P * L * U and compares it with A
+          for (auto j = n; j-- > 0; ) {
+            if (ipiv[j] < j || ipiv[j] >= n) { matches = false; continue; }
+            for (auto col = size_t{0}; col < n; ++col) {
+              std::swap(product[j * n + col], product[ipiv[j] * n + col]);
+              std::swap(bound[j * n + col], bound[ipiv[j] * n + col]);
+            }
+          }
+          for (auto i = size_t{0}; i < n; ++i) {
+            for (auto j = size_t{0}; j < n; ++j) {
+              const auto difference = std::abs(product[i * n + j] - a[index(i, j, a_ld)]);
+              if (difference > tolerance * (bound[i * n + j] + 1.0)) { matches = false; }
+            }
+          }
+
+          // Computes the residual of the solve: A * X - B
+          for (auto i = size_t{0}; i < n; ++i) {
+            for (auto col = size_t{0}; col < nrhs; ++col) {
+              auto residual = -b[index(i, col, b_ld)];
+              auto residual_bound = std::abs(b[index(i, col, b_ld)]);
+              for (auto k = size_t{0}; k < n; ++k) {
+                residual += a[index(i, k, a_ld)] * x[index(k, col, b_ld)];
+                residual_bound += std::abs(a[index(i, k, a_ld)]) * std::abs(x[index(k, col, b_ld)]);
+              }
+              if (std::abs(residual) > tolerance * (residual_bound + 1.0)) { matches = false; }
+            }
+          }
+        }
+        if (matches) { passed++; } else { errors++; }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGetrfTests<float>(argc, argv, false, "SGETRFSTRIDEDBATCHED", 1e-3);
+  errors += clblast::RunGetrfTests<double>(argc, argv, true, "DGETRFSTRIDEDBATCHED", 1e-9);
+  errors += clblast::RunGetrfTests<clblast::float2>(argc, argv, true, "CGETRFSTRIDEDBATCHED", 1e-3);
+  errors += clblast::RunGetrfTests<clblast::double2>(argc, argv, true, "ZGETRFSTRIDEDBATCHED", 1e-9);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,130 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the single-precision accumulation of the half-precision
+// reductions and GEMV. The inputs are chosen such that the results are representable in half
+// precision, while accumulating in half precision would overflow or lose the small additions.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Reads back the first half-precision value of a buffer and compares it with a reference
+bool IsExpectedHalfResult(Queue &queue, const Buffer<half> &buffer, const double reference) {
+  auto host = std::vector<half>(1);
+  buffer.Read(queue, 1, host);
+  const auto result = static_cast<double>(HalfToFloat(host[0]));
+  return std::abs(result - reference) <= 2e-3 * std::abs(reference);
+}
+
+size_t RunHalfAccumulationTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Enables the single-precision accumulation before any half-precision routine is created
+  #ifdef _WIN32
+    _putenv_s("CLBLAST_MIXED_PRECISION", "1");
+  #else
+    setenv("CLBLAST_MIXED_PRECISION", "1", 1);
+  #endif
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  if (!PrecisionSupported<half>(device)) {
+    fprintf(stdout, "* Half precision not supported by the device, skipping the tests\n\n");
+    return 0;
+  }
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  // The sum of the squares overflows in half precision, but the norm itself does not
+  fprintf(stdout, "* Testing the single-precision accumulation of HNRM2, HASUM, HDOT and HGEMV\n");
+  const auto n = size_t{32768};
+  const auto host_twos = std::vector<half>(n, FloatToHalf(2.0f));
+  auto x_twos = Buffer<half>(context, n);
+  x_twos.Write(queue, n, host_twos);
+  auto result = Buffer<half>(context, 1);
+  if (Nrm2<half>(n, result(), 0, x_twos(), 0, 1, &queue_plain) == StatusCode::kSuccess &&
+      IsExpectedHalfResult(queue, result, std::sqrt(4.0 * n))) { passed++; }
+  else { errors++; }
+
+  // Sums of small values which are rounded away when added to large half-precision sums
+  auto host_small = std::vector<half>(n);
+  auto asum_reference = 0.0;
+  auto dot_reference = 0.0;
+  for (auto i = size_t{0}; i < n; ++i) {
+    host_small[i] = FloatToHalf(0.25f + 0.125f * static_cast<float>(i % 7));
+    const auto value = static_cast<double>(HalfToFloat(host_small[i]));
+    asum_reference += value;
+    dot_reference += 2.0 * value;
+  }
+  auto x_small = Buffer<half>(context, n);
+  x_small.Write(queue, n, host_small);
+  if (Asum<half>(n, result(), 0, x_small(), 0, 1, &queue_plain) == StatusCode::kSuccess &&
+      IsExpectedHalfResult(queue, result, asum_reference)) { passed++; }
+  else { errors++; }
+  if (Dot<half>(n, result(), 0, x_small(), 0, 1, x_twos(), 0, 1,
+                &queue_plain) == StatusCode::kSuccess &&
+      IsExpectedHalfResult(queue, result, dot_reference)) { passed++; }
+  else { errors++; }
+
+  // Each row of GEMV sums more ones than half precision can count in steps of one (2048)
+  const auto m = size_t{64};
+  const auto gemv_n = size_t{8192};
+  const auto host_a = std::vector<half>(m * gemv_n, FloatToHalf(1.0f));
+  auto a_ones = Buffer<half>(context, m * gemv_n);
+  a_ones.Write(queue, host_a.size(), host_a);
+  auto x_ones = Buffer<half>(context, gemv_n);
+  x_ones.Write(queue, gemv_n, std::vector<half>(gemv_n, FloatToHalf(1.0f)));
+  auto y = Buffer<half>(context, m);
+  for (const auto a_transpose : {Transpose::kNo, Transpose::kYes}) {
+    const auto a_m = (a_transpose == Transpose::kNo) ? m : gemv_n;
+    const auto a_n = (a_transpose == Transpose::kNo) ? gemv_n : m;
+    if (Gemv<half>(Layout::kColMajor, a_transpose, a_m, a_n, FloatToHalf(1.0f),
+                   a_ones(), 0, a_m, x_ones(), 0, 1, FloatToHalf(0.0f), y(), 0, 1,
+                   &queue_plain) == StatusCode::kSuccess &&
+        IsExpectedHalfResult(queue, y, static_cast<double>(gemv_n))) { passed++; }
+    else { errors++; }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunHalfAccumulationTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
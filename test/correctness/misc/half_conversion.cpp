@@ -0,0 +1,121 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the bulk host conversions between single-precision and
+// half-precision data. The (possibly vectorised) results for whole arrays should match those of
+// the portable implementation, which is used for single values.
+//
+// =================================================================================================
+
+#include <vector>
+#include <random>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Converts single values, such that the portable implementation is used rather than the SIMD one
+half ConvertSingleToHalf(const float value) {
+  auto result = half{0};
+  FloatToHalfArray(&value, &result, 1);
+  return result;
+}
+
+size_t RunHalfConversionTests() {
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Tests all half-precision values: converting to single-precision is exact, so converting back
+  // should again result in the same value. NaNs are only tested for being NaN.
+  const auto num_halves = size_t{1} << 16;
+  auto halves = std::vector<half>(num_halves);
+  for (auto i = size_t{0}; i < num_halves; ++i) { halves[i] = static_cast<half>(i); }
+  auto floats = std::vector<float>(num_halves);
+  HalfToFloatArray(halves.data(), floats.data(), num_halves);
+  auto round_trip = std::vector<half>(num_halves);
+  FloatToHalfArray(floats.data(), round_trip.data(), num_halves);
+  auto all_halves_errors = size_t{0};
+  for (auto i = size_t{0}; i < num_halves; ++i) {
+    const auto is_nan = ((halves[i] & 0x7C00) == 0x7C00) && ((halves[i] & 0x03FF) != 0);
+    if (is_nan) {
+      const auto round_trip_nan = ((round_trip[i] & 0x7C00) == 0x7C00) && ((round_trip[i] & 0x03FF) != 0);
+      if (!std::isnan(floats[i]) || !round_trip_nan) { all_halves_errors++; }
+    }
+    else if (floats[i] != HalfToFloat(halves[i]) || round_trip[i] != halves[i]) { all_halves_errors++; }
+  }
+  if (all_halves_errors == 0) { passed++; } else { errors++; }
+
+  // Tests known rounding cases, including halfway cases, overflow and (gradual) underflow
+  const auto infinity = std::numeric_limits<float>::infinity();
+  const auto cases = std::vector<std::pair<float, half>>{
+    {1.0f, 0x3C00}, {-2.0f, 0xC000}, {0.0f, 0x0000}, {-0.0f, 0x8000},
+    {1.0f + std::ldexp(1.0f, -11), 0x3C00},     // halfway, rounds down to even
+    {1.0f + 3 * std::ldexp(1.0f, -11), 0x3C02}, // halfway, rounds up to even
+    {65504.0f, 0x7BFF}, {65519.0f, 0x7BFF}, {65520.0f, 0x7C00}, {1.0e10f, 0x7C00},
+    {infinity, 0x7C00}, {-infinity, 0xFC00},
+    {std::ldexp(1.0f, -24), 0x0001}, {std::ldexp(1.0f, -25), 0x0000},
+    {std::ldexp(1.5f, -25), 0x0001}, {std::ldexp(3.0f, -25), 0x0002},
+    {std::ldexp(1.0f, -14), 0x0400}, {-std::ldexp(1.0f, -30), 0x8000}
+  };
+  auto case_inputs = std::vector<float>();
+  for (const auto &test_case : cases) { case_inputs.push_back(test_case.first); }
+  auto case_results = std::vector<half>(cases.size());
+  FloatToHalfArray(case_inputs.data(), case_results.data(), cases.size());
+  auto cases_errors = size_t{0};
+  for (auto i = size_t{0}; i < cases.size(); ++i) {
+    if (case_results[i] != cases[i].second) { cases_errors++; }
+    if (ConvertSingleToHalf(case_inputs[i]) != cases[i].second) { cases_errors++; }
+  }
+  if (cases_errors == 0) { passed++; } else { errors++; }
+
+  // Tests random values over the whole exponent range, with a size that is not a multiple of any
+  // vector width, comparing the whole array with conversions of individual values
+  const auto num_values = size_t{100003};
+  std::mt19937 mt(42);
+  std::uniform_int_distribution<unsigned int> dist(0u, 0xFFFFFFFFu);
+  auto values = std::vector<float>(num_values);
+  for (auto i = size_t{0}; i < num_values; ++i) {
+    auto bits = dist(mt);  // every 16th value is fully random, including NaNs and infinities
+    if (i % 16 != 0) {     // the others have an exponent around the half-precision range
+      const auto exponent = 100u + (bits >> 23) % 50u;
+      bits = (bits & 0x807FFFFFu) | (exponent << 23);
+    }
+    std::memcpy(&values[i], &bits, sizeof(bits));
+  }
+  auto results = std::vector<half>(num_values);
+  FloatToHalfArray(values.data(), results.data(), num_values);
+  auto random_errors = size_t{0};
+  for (auto i = size_t{0}; i < num_values; ++i) {
+    if (results[i] != ConvertSingleToHalf(values[i])) { random_errors++; }
+  }
+  if (random_errors == 0) { passed++; } else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << std::endl;
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main() {
+  const auto errors = clblast::RunHalfConversionTests();
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
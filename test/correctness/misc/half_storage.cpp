@@ -0,0 +1,176 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the storage-only half-precision mode, which is used on devices
+// without FP16 support. The mode is enabled through CLBLAST_HALF_STORAGE, such that it is also
+// tested on devices with FP16 support. The results are compared with single-precision references.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Compares half-precision results with references, relative to the magnitude of the references
+bool IsCloseHalfStorage(const std::vector<half> &result, const std::vector<double> &reference) {
+  for (auto i = size_t{0}; i < reference.size(); ++i) {
+    const auto value = static_cast<double>(HalfToFloat(result[i]));
+    if (std::abs(value - reference[i]) > 2e-3 * (std::abs(reference[i]) + 1.0)) { return false; }
+  }
+  return true;
+}
+
+// Reads back the first values of a half-precision buffer and compares them as above
+bool IsExpectedHalfStorage(Queue &queue, const Buffer<half> &buffer,
+                           const std::vector<double> &reference) {
+  auto host = std::vector<half>(reference.size());
+  buffer.Read(queue, reference.size(), host);
+  return IsCloseHalfStorage(host, reference);
+}
+
+size_t RunHalfStorageTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Enables the storage-only mode before any half-precision routine is created
+  #ifdef _WIN32
+    _putenv_s("CLBLAST_HALF_STORAGE", "1");
+  #else
+    setenv("CLBLAST_HALF_STORAGE", "1", 1);
+  #endif
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  // Vectors of values which are exact in half precision, also used as matrices
+  const auto n = size_t{4096};
+  const auto m = size_t{48};
+  const auto k = size_t{72};
+  auto host_x = std::vector<half>(n);
+  auto host_y = std::vector<half>(n);
+  for (auto i = size_t{0}; i < n; ++i) {
+    host_x[i] = FloatToHalf(0.25f * static_cast<float>(static_cast<int>(i % 9) - 4));
+    host_y[i] = FloatToHalf(0.5f * static_cast<float>(static_cast<int>(i % 5) - 2));
+  }
+  const auto value = [](const std::vector<half> &host, const size_t i) {
+    return static_cast<double>(HalfToFloat(host[i]));
+  };
+  auto x = Buffer<half>(context, n);
+  auto y = Buffer<half>(context, n);
+  auto result = Buffer<half>(context, 1);
+  x.Write(queue, n, host_x);
+  const auto alpha = 1.5f;
+  const auto beta = 0.5f;
+
+  // Level-1 routines: AXPY, SCAL, DOT, NRM2 and ASUM
+  fprintf(stdout, "* Testing the storage-only half precision of the level-1 routines\n");
+  auto axpy_reference = std::vector<double>(n);
+  auto scal_reference = std::vector<double>(n);
+  auto dot_reference = 0.0;
+  auto nrm2_reference = 0.0;
+  auto asum_reference = 0.0;
+  for (auto i = size_t{0}; i < n; ++i) {
+    axpy_reference[i] = alpha * value(host_x, i) + value(host_y, i);
+    scal_reference[i] = alpha * value(host_x, i);
+    dot_reference += value(host_x, i) * value(host_y, i);
+    nrm2_reference += value(host_x, i) * value(host_x, i);
+    asum_reference += std::abs(value(host_x, i));
+  }
+  y.Write(queue, n, host_y);
+  if (Axpy<half>(n, FloatToHalf(alpha), x(), 0, 1, y(), 0, 1,
+                 &queue_plain) == StatusCode::kSuccess &&
+      IsExpectedHalfStorage(queue, y, axpy_reference)) { passed++; }
+  else { errors++; }
+  y.Write(queue, n, host_x);
+  if (Scal<half>(n, FloatToHalf(alpha), y(), 0, 1, &queue_plain) == StatusCode::kSuccess &&
+      IsExpectedHalfStorage(queue, y, scal_reference)) { passed++; }
+  else { errors++; }
+  y.Write(queue, n, host_y);
+  if (Dot<half>(n, result(), 0, x(), 0, 1, y(), 0, 1, &queue_plain) == StatusCode::kSuccess &&
+      IsExpectedHalfStorage(queue, result, {dot_reference})) { passed++; }
+  else { errors++; }
+  if (Nrm2<half>(n, result(), 0, x(), 0, 1, &queue_plain) == StatusCode::kSuccess &&
+      IsExpectedHalfStorage(queue, result, {std::sqrt(nrm2_reference)})) { passed++; }
+  else { errors++; }
+  if (Asum<half>(n, result(), 0, x(), 0, 1, &queue_plain) == StatusCode::kSuccess &&
+      IsExpectedHalfStorage(queue, result, {asum_reference})) { passed++; }
+  else { errors++; }
+
+  // GEMV and GEMM with the m by k matrix A (the first elements of 'x'), the k by m matrix B (the
+  // first elements of 'y') and the vector or matrix C (the first elements of 'x' again)
+  fprintf(stdout, "* Testing the storage-only half precision of GEMV and GEMM\n");
+  auto a = Buffer<half>(context, m * k);
+  auto b = Buffer<half>(context, k * m);
+  auto c = Buffer<half>(context, m * m);
+  a.Write(queue, m * k, host_x);
+  b.Write(queue, k * m, host_y);
+  auto gemv_reference = std::vector<double>(m);
+  for (auto row = size_t{0}; row < m; ++row) {
+    auto sum = 0.0;
+    for (auto i = size_t{0}; i < k; ++i) { sum += value(host_x, i * m + row) * value(host_y, i); }
+    gemv_reference[row] = alpha * sum + beta * value(host_x, row);
+  }
+  c.Write(queue, m, host_x);
+  if (Gemv<half>(Layout::kColMajor, Transpose::kNo, m, k, FloatToHalf(alpha), a(), 0, m,
+                 b(), 0, 1, FloatToHalf(beta), c(), 0, 1, &queue_plain) == StatusCode::kSuccess &&
+      IsExpectedHalfStorage(queue, c, gemv_reference)) { passed++; }
+  else { errors++; }
+  auto gemm_reference = std::vector<double>(m * m);
+  for (auto col = size_t{0}; col < m; ++col) {
+    for (auto row = size_t{0}; row < m; ++row) {
+      auto sum = 0.0;
+      for (auto i = size_t{0}; i < k; ++i) {
+        sum += value(host_x, i * m + row) * value(host_y, col * k + i);
+      }
+      gemm_reference[col * m + row] = alpha * sum + beta * value(host_x, col * m + row);
+    }
+  }
+  c.Write(queue, m * m, host_x);
+  if (Gemm<half>(Layout::kColMajor, Transpose::kNo, Transpose::kNo, m, m, k, FloatToHalf(alpha),
+                 a(), 0, m, b(), 0, k, FloatToHalf(beta), c(), 0, m,
+                 &queue_plain) == StatusCode::kSuccess &&
+      IsExpectedHalfStorage(queue, c, gemm_reference)) { passed++; }
+  else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunHalfStorageTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,122 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the library handles: GEMMs called through a handle are compared
+// with the same GEMMs called on the queue, and the handle's statistics are checked.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+size_t RunHandleTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  // The matrices, with C twice: for the handle and for the reference
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  const auto n = size_t{67};
+  auto host = std::vector<float>(n * n);
+  for (auto &value : host) { value = dist(mt); }
+  auto a = Buffer<float>(context, n * n);
+  a.Write(queue, host.size(), host);
+  for (auto &value : host) { value = dist(mt); }
+  auto b = Buffer<float>(context, n * n);
+  b.Write(queue, host.size(), host);
+  for (auto &value : host) { value = dist(mt); }
+  auto c = Buffer<float>(context, n * n);
+  auto c_reference = Buffer<float>(context, n * n);
+  c.Write(queue, host.size(), host);
+  c_reference.Write(queue, host.size(), host);
+
+  auto handle = static_cast<Handle*>(nullptr);
+  if (HandleCreate(&queue_plain, &handle) != StatusCode::kSuccess) {
+    std::cout << "    failed to create a handle" << std::endl;
+    return 1;
+  }
+
+  // Runs the same GEMM twice through the handle and on the queue. The second call through the
+  // handle should find all its programs in the handle's cache.
+  auto statistics = std::vector<HandleStatistics>(2);
+  for (auto call = size_t{0}; call < 2; ++call) {
+    fprintf(stdout, "* Testing GEMM call %zu through a handle\n", call + 1);
+    auto status = Gemm<float>(handle, Layout::kColMajor, Transpose::kNo, Transpose::kYes, n, n, n,
+                              0.5f, a(), 0, n, b(), 0, n, 2.0f, c(), 0, n);
+    if (status != StatusCode::kSuccess) { errors++; continue; }
+    status = Gemm<float>(Layout::kColMajor, Transpose::kNo, Transpose::kYes, n, n, n,
+                         0.5f, a(), 0, n, b(), 0, n, 2.0f, c_reference(), 0, n, &queue_plain);
+    if (status != StatusCode::kSuccess) { errors++; continue; }
+    queue.Finish();
+    auto result = std::vector<float>(n * n);
+    auto reference = std::vector<float>(n * n);
+    c.Read(queue, result.size(), result);
+    c_reference.Read(queue, reference.size(), reference);
+    auto matches = true;
+    for (auto i = size_t{0}; i < result.size(); ++i) {
+      if (std::abs(result[i] - reference[i]) > 1e-4f * std::abs(reference[i]) + 1e-4f) {
+        matches = false;
+      }
+    }
+    if (matches) { passed++; } else { errors++; }
+    if (HandleGetStatistics(handle, statistics[call]) != StatusCode::kSuccess) { errors++; }
+  }
+
+  // Checks the statistics: the routine on the queue itself shouldn't be counted
+  fprintf(stdout, "* Testing the handle's statistics\n");
+  if (statistics[0].num_calls == 1 && statistics[1].num_calls == 2) { passed++; } else { errors++; }
+  if (statistics[0].program_cache_misses > 0 &&
+      statistics[1].program_cache_misses == statistics[0].program_cache_misses &&
+      statistics[1].program_cache_hits > statistics[0].program_cache_hits) { passed++; }
+  else { errors++; }
+
+  if (HandleDestroy(handle) == StatusCode::kSuccess) { passed++; } else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunHandleTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
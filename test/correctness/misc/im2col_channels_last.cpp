@@ -0,0 +1,153 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the im2col transform of images in channels-last (HWC) layout:
+// the results are compared against a host reference for a number of convolution configurations
+// (with padding, strides and dilation), for a single image as well as for a strided batch.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The settings of a single convolution: channels, height, width, kernel, padding, stride, dilation
+struct Im2colChannelsLastConfig {
+  size_t channels, height, width, kernel_h, kernel_w, pad_h, pad_w,
+         stride_h, stride_w, dilation_h, dilation_w;
+};
+
+// Computes the output size of a single dimension of the convolution
+size_t Im2colOutputSize(const size_t size, const size_t kernel, const size_t pad,
+                        const size_t stride, const size_t dilation) {
+  const auto padded = size + 2 * pad;
+  const auto padding = dilation * (kernel - 1) + 1;
+  return (padded >= padding) ? (padded - padding) / stride + 1 : 1;
+}
+
+template <typename T>
+size_t RunIm2colChannelsLastTests(int argc, char *argv[], const bool silent,
+                                  const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Determines the test settings
+  const auto configs = std::vector<Im2colChannelsLastConfig>{
+    {3, 8, 9, 3, 3, 1, 1, 1, 1, 1, 1},
+    {16, 7, 7, 3, 3, 0, 0, 2, 2, 1, 1},
+    {5, 10, 6, 3, 2, 2, 1, 1, 2, 2, 1},
+    {64, 4, 4, 1, 1, 0, 0, 1, 1, 1, 1}
+  };
+  const auto batch_counts = std::vector<size_t>{1, 3};
+  const auto padding = size_t{5}; // extra space between the batches
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  fprintf(stdout, "* Testing the channels-last im2col transform for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &c : configs) {
+    for (const auto batch_count : batch_counts) {
+      const auto output_h = Im2colOutputSize(c.height, c.kernel_h, c.pad_h, c.stride_h, c.dilation_h);
+      const auto output_w = Im2colOutputSize(c.width, c.kernel_w, c.pad_w, c.stride_w, c.dilation_w);
+      const auto row_size = c.kernel_h * c.kernel_w * c.channels;
+      const auto im_stride = c.height * c.width * c.channels + padding;
+      const auto col_stride = output_h * output_w * row_size + padding;
+
+      // Populates the images with some example data
+      auto host_im = std::vector<T>(im_stride * batch_count);
+      PopulateVector(host_im, mt, dist);
+      auto device_im = Buffer<T>(context, host_im.size());
+      auto device_col = Buffer<T>(context, col_stride * batch_count);
+      device_im.Write(queue, host_im.size(), host_im);
+
+      // Runs the routine
+      const auto status = Im2colChannelsLast<T>(c.channels, c.height, c.width,
+                                                c.kernel_h, c.kernel_w, c.pad_h, c.pad_w,
+                                                c.stride_h, c.stride_w, c.dilation_h, c.dilation_w,
+                                                device_im(), 0, im_stride,
+                                                device_col(), 0, col_stride,
+                                                batch_count, &queue_plain);
+      if (status != StatusCode::kSuccess) { errors++; continue; }
+
+      // Compares the results with the host reference: a row per patch, channels fastest
+      auto host_col = std::vector<T>(col_stride * batch_count);
+      device_col.Read(queue, host_col.size(), host_col);
+      auto matches = true;
+      for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+        for (auto h_id = size_t{0}; h_id < output_h; ++h_id) {
+          for (auto w_id = size_t{0}; w_id < output_w; ++w_id) {
+            for (auto kh_id = size_t{0}; kh_id < c.kernel_h; ++kh_id) {
+              for (auto kw_id = size_t{0}; kw_id < c.kernel_w; ++kw_id) {
+                for (auto c_id = size_t{0}; c_id < c.channels; ++c_id) {
+                  const auto h_index = static_cast<int>(kh_id * c.dilation_h + c.stride_h * h_id) -
+                                       static_cast<int>(c.pad_h);
+                  const auto w_index = static_cast<int>(kw_id * c.dilation_w + c.stride_w * w_id) -
+                                       static_cast<int>(c.pad_w);
+                  auto reference = ConstantZero<T>();
+                  if (h_index >= 0 && h_index < static_cast<int>(c.height) &&
+                      w_index >= 0 && w_index < static_cast<int>(c.width)) {
+                    const auto im_index = c_id + c.channels * (w_index + c.width * h_index);
+                    reference = host_im[batch * im_stride + im_index];
+                  }
+                  const auto patch_index = w_id + output_w * h_id;
+                  const auto kernel_index = kw_id + c.kernel_w * kh_id;
+                  const auto col_index = patch_index * row_size + kernel_index * c.channels + c_id;
+                  if (host_col[batch * col_stride + col_index] != reference) { matches = false; }
+                }
+              }
+            }
+          }
+        }
+      }
+      if (matches) { passed++; } else { errors++; }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunIm2colChannelsLastTests<float>(argc, argv, false, "SIM2COLCHANNELSLAST");
+  errors += clblast::RunIm2colChannelsLastTests<double>(argc, argv, true, "DIM2COLCHANNELSLAST");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,132 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the in-place matrix copy/transpose: its result should be the
+// same as that of the out-of-place version, both for square matrices (transposed in-place) and for
+// non-square matrices or a changed leading dimension (through a temporary copy).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <complex>
+#include <iostream>
+#include <algorithm>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunImatcopyTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Determines the test settings: square sizes smaller and larger than a tile, a non-square size,
+  // and leading dimensions with and without padding
+  const auto shapes = std::vector<std::pair<size_t,size_t>>{{7, 7}, {64, 64}, {101, 101}, {33, 70}};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes};
+  const auto paddings = std::vector<size_t>{0, 3};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  fprintf(stdout, "* Testing the in-place matrix copy/transpose for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &shape : shapes) {
+    for (const auto layout : layouts) {
+      for (const auto transpose : transposes) {
+        for (const auto padding : paddings) {
+          const auto m = shape.first;
+          const auto n = shape.second;
+          const auto alpha = GetScalar<T>();
+
+          // Computes the dimensions before and after the operation
+          const auto a_one = (layout == Layout::kColMajor) ? m : n;
+          const auto a_two = (layout == Layout::kColMajor) ? n : m;
+          const auto b_one = (transpose == Transpose::kNo) ? a_one : a_two;
+          const auto b_two = (transpose == Transpose::kNo) ? a_two : a_one;
+          const auto a_ld = a_one + padding;
+          const auto b_ld = b_one + padding;
+          const auto size = std::max(a_ld * a_two, b_ld * b_two);
+
+          // Populates the matrix with some example data: the reference result starts from the
+          // same data, such that the values outside of the result matrix are the same
+          auto host_a = std::vector<T>(size);
+          PopulateVector(host_a, mt, dist);
+          auto device_a = Buffer<T>(context, size);
+          auto device_reference = Buffer<T>(context, size);
+          device_a.Write(queue, size, host_a);
+          device_reference.Write(queue, size, host_a);
+          auto device_input = Buffer<T>(context, size);
+          device_input.Write(queue, size, host_a);
+
+          // Runs the out-of-place and the in-place versions
+          auto status = Omatcopy(layout, transpose, m, n, alpha, device_input(), 0, a_ld,
+                                 device_reference(), 0, b_ld, &queue_plain);
+          status = (status != StatusCode::kSuccess) ? status :
+                   Imatcopy(layout, transpose, m, n, alpha, device_a(), 0, a_ld, b_ld,
+                            &queue_plain);
+          if (status != StatusCode::kSuccess) { errors++; continue; }
+
+          // Compares the results
+          auto host_reference = std::vector<T>(size);
+          auto host_result = std::vector<T>(size);
+          device_reference.Read(queue, size, host_reference);
+          device_a.Read(queue, size, host_result);
+          auto matches = true;
+          for (auto i = size_t{0}; i < size; ++i) {
+            const auto difference = std::abs(host_reference[i] - host_result[i]);
+            if (difference > 1e-4 * std::abs(host_reference[i]) + 1e-4) { matches = false; }
+          }
+          if (matches) { passed++; } else { errors++; }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunImatcopyTests<float>(argc, argv, false, "SIMATCOPY");
+  errors += clblast::RunImatcopyTests<double>(argc, argv, true, "DIMATCOPY");
+  errors += clblast::RunImatcopyTests<clblast::float2>(argc, argv, true, "CIMATCOPY");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
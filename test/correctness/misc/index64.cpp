@@ -0,0 +1,185 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the kernel variants with 64-bit indices (see 'RequiresIndex64').
+// These are forced for all sizes through 'CLBLAST_INDEX_64BIT', such that AXPY and GEMM (including
+// a zero alpha) can be compared against a host reference without allocating more than 2^31
+// elements. Routines without such a variant should reject matrices which need 64-bit indices.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Compares a result against its reference, printing the name of the test in case of an error
+template <typename T>
+bool Index64Matches(const std::vector<T> &result, const std::vector<T> &reference,
+                    const std::string &name) {
+  for (auto i = size_t{0}; i < result.size(); ++i) {
+    if (std::abs(reference[i] - result[i]) > 1e-4 * std::abs(reference[i]) + 1e-4) {
+      fprintf(stdout, "    Error in '%s' at index %zu\n", name.c_str(), i);
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+size_t RunIndex64Tests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto m = GetArgument(arguments, help, kArgM, size_t{67});
+  const auto n = GetArgument(arguments, help, kArgN, size_t{45});
+  const auto k = GetArgument(arguments, help, kArgK, size_t{33});
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  fprintf(stdout, "* Testing the 64-bit index kernels for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // AXPY with an offset and a non-unit increment, which uses the general kernel
+  const auto x_offset = size_t{3};
+  const auto x_inc = size_t{2};
+  auto host_x = std::vector<T>(x_offset + n * m * x_inc);
+  auto host_y = std::vector<T>(n * m);
+  PopulateVector(host_x, mt, dist);
+  PopulateVector(host_y, mt, dist);
+  auto reference_y = host_y;
+  for (auto i = size_t{0}; i < host_y.size(); ++i) {
+    reference_y[i] += alpha * host_x[x_offset + i * x_inc];
+  }
+  auto device_x = Buffer<T>(context, host_x.size());
+  auto device_y = Buffer<T>(context, host_y.size());
+  device_x.Write(queue, host_x.size(), host_x);
+  device_y.Write(queue, host_y.size(), host_y);
+  const auto status_axpy = Axpy(host_y.size(), alpha, device_x(), x_offset, x_inc,
+                                device_y(), 0, 1, &queue_plain);
+  auto result = std::vector<T>(host_y.size());
+  device_y.Read(queue, result.size(), result);
+  if (status_axpy == StatusCode::kSuccess && Index64Matches(result, reference_y, "AXPY")) {
+    passed++;
+  } else { errors++; }
+
+  // Column-major GEMM with offsets and padded leading dimensions, regularly and with a zero alpha
+  // (which would otherwise only scale matrix C)
+  const auto a_ld = m + 3;
+  const auto b_ld = k + 1;
+  const auto c_ld = m + 2;
+  const auto offset = size_t{5};
+  auto host_a = std::vector<T>(offset + a_ld * k);
+  auto host_b = std::vector<T>(offset + b_ld * n);
+  auto host_c = std::vector<T>(offset + c_ld * n);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+  auto device_a = Buffer<T>(context, host_a.size());
+  auto device_b = Buffer<T>(context, host_b.size());
+  auto device_c = Buffer<T>(context, host_c.size());
+  device_a.Write(queue, host_a.size(), host_a);
+  device_b.Write(queue, host_b.size(), host_b);
+  for (const auto gemm_alpha : {alpha, ConstantZero<T>()}) {
+    auto reference_c = host_c;
+    for (auto j = size_t{0}; j < n; ++j) {
+      for (auto i = size_t{0}; i < m; ++i) {
+        auto sum = ConstantZero<T>();
+        for (auto l = size_t{0}; l < k; ++l) {
+          sum += host_a[offset + l * a_ld + i] * host_b[offset + j * b_ld + l];
+        }
+        const auto index = offset + j * c_ld + i;
+        reference_c[index] = gemm_alpha * sum + beta * host_c[index];
+      }
+    }
+    device_c.Write(queue, host_c.size(), host_c);
+    const auto status_gemm = Gemm(Layout::kColMajor, Transpose::kNo, Transpose::kNo, m, n, k,
+                                  gemm_alpha, device_a(), offset, a_ld, device_b(), offset, b_ld,
+                                  beta, device_c(), offset, c_ld, &queue_plain);
+    auto result_c = std::vector<T>(host_c.size());
+    device_c.Read(queue, result_c.size(), result_c);
+    const auto name = (gemm_alpha == ConstantZero<T>()) ? "GEMM (zero alpha)" : "GEMM";
+    if (status_gemm == StatusCode::kSuccess && Index64Matches(result_c, reference_c, name)) {
+      passed++;
+    } else { errors++; }
+  }
+
+  // A leading dimension beyond 2^31 elements: GEMM only runs out of buffer space, whereas GEMV
+  // (without a 64-bit index variant) rejects it as a whole
+  const auto large_ld = size_t{1} << 31;
+  const auto status_large_gemm = Gemm(Layout::kColMajor, Transpose::kNo, Transpose::kNo, m, n, k,
+                                      alpha, device_a(), 0, large_ld, device_b(), 0, b_ld,
+                                      beta, device_c(), 0, c_ld, &queue_plain);
+  if (status_large_gemm == StatusCode::kInsufficientMemoryA) { passed++; }
+  else {
+    fprintf(stdout, "    Error: status %d for GEMM with a large leading dimension\n",
+            static_cast<int>(status_large_gemm));
+    errors++;
+  }
+  const auto status_large_gemv = Gemv(Layout::kColMajor, Transpose::kNo, m, k,
+                                      alpha, device_a(), 0, large_ld, device_x(), 0, 1,
+                                      beta, device_y(), 0, 1, &queue_plain);
+  if (status_large_gemv == StatusCode::kInvalidValue) { passed++; }
+  else {
+    fprintf(stdout, "    Error: status %d for GEMV with a large leading dimension\n",
+            static_cast<int>(status_large_gemv));
+    errors++;
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+
+  // Forces the 64-bit index variants before any routine is created
+  #ifdef _WIN32
+    _putenv_s("CLBLAST_INDEX_64BIT", "1");
+  #else
+    setenv("CLBLAST_INDEX_64BIT", "1", 1);
+  #endif
+
+  auto errors = size_t{0};
+  errors += clblast::RunIndex64Tests<float>(argc, argv, false, "SINDEX64");
+  errors += clblast::RunIndex64Tests<clblast::float2>(argc, argv, true, "CINDEX64");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,98 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the table of embedded kernel sources: the (decompressed)
+// sources are compared against the kernel files themselves, and are verified to be decompressed
+// only once, also when retrieved by multiple threads at the same time.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "kernel_sources.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Compares a source from the table with the contents of the kernel file
+bool TestKernelSource(const KernelSource source, const std::string &reference) {
+  return GetKernelSource(source) == reference;
+}
+
+size_t RunKernelSourcesTests() {
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  fprintf(stdout, "* Testing the embedded kernel sources\n");
+
+  // A selection of the sources, among which the largest ones
+  const auto level1 = std::string{
+    #include "../src/kernels/level1/level1.opencl"
+  };
+  const auto xgemm_part1 = std::string{
+    #include "../src/kernels/level3/xgemm_part1.opencl"
+  };
+  const auto xgemm_part3 = std::string{
+    #include "../src/kernels/level3/xgemm_part3.opencl"
+  };
+  const auto xgemm_direct_part2 = std::string{
+    #include "../src/kernels/level3/xgemm_direct_part2.opencl"
+  };
+  const auto xpotrf = std::string{
+    #include "../src/kernels/levelx/xpotrf.opencl"
+  };
+  if (TestKernelSource(KernelSource::kLevel1, level1)) { passed++; } else { errors++; }
+  if (TestKernelSource(KernelSource::kXgemmPart1, xgemm_part1)) { passed++; } else { errors++; }
+  if (TestKernelSource(KernelSource::kXgemmPart3, xgemm_part3)) { passed++; } else { errors++; }
+  if (TestKernelSource(KernelSource::kXgemmDirectPart2, xgemm_direct_part2)) { passed++; }
+  else { errors++; }
+  if (TestKernelSource(KernelSource::kXpotrf, xpotrf)) { passed++; } else { errors++; }
+
+  // All sources are retrieved concurrently, which should result in a single copy of each
+  const auto num_sources = static_cast<size_t>(KernelSource::kNumSources);
+  const auto num_threads = size_t{4};
+  auto results = std::vector<std::vector<const std::string*>>(num_threads);
+  auto threads = std::vector<std::thread>();
+  for (auto thread_id = size_t{0}; thread_id < num_threads; ++thread_id) {
+    threads.emplace_back([&results, thread_id, num_sources]() {
+      for (auto index = size_t{0}; index < num_sources; ++index) {
+        results[thread_id].push_back(&GetKernelSource(static_cast<KernelSource>(index)));
+      }
+    });
+  }
+  for (auto &thread : threads) { thread.join(); }
+  for (auto index = size_t{0}; index < num_sources; ++index) {
+    auto matches = !results[0][index]->empty();
+    for (auto thread_id = size_t{1}; thread_id < num_threads; ++thread_id) {
+      if (results[thread_id][index] != results[0][index]) { matches = false; }
+    }
+    if (matches) { passed++; } else { errors++; }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main() {
+  auto errors = size_t{0};
+  errors += clblast::RunKernelSourcesTests();
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
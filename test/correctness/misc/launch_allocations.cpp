@@ -0,0 +1,155 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the allocation-free kernel launch path: once warmed up, looking
+// up a cached kernel, setting its arguments and launching it on an in-order queue should not
+// perform any heap allocation. The allocations are counted by replacing the global operator new.
+// The number of allocations of a complete AXPY call is reported, but not tested.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "utilities/utilities.hpp"
+#include "routines/common.hpp"
+#include "test/test_utilities.hpp"
+
+// =================================================================================================
+
+// Counts the heap allocations while enabled
+namespace {
+  std::atomic<bool> count_allocations{false};
+  std::atomic<size_t> num_allocations{0};
+}
+
+void* operator new(std::size_t size) {
+  if (count_allocations) { num_allocations++; }
+  auto pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) { throw std::bad_alloc(); }
+  return pointer;
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+
+namespace clblast {
+// =================================================================================================
+
+// A trivial kernel to launch
+const std::string kLaunchSource = R"(
+__kernel void ScaleVector(const int n, const float alpha, __global float* x) {
+  const int id = get_global_id(0);
+  if (id < n) { x[id] = alpha * x[id]; }
+}
+)";
+
+// Runs a function a number of times and returns the number of heap allocations
+template <typename F>
+size_t CountAllocations(const size_t num_runs, F function) {
+  num_allocations = 0;
+  count_allocations = true;
+  for (auto run = size_t{0}; run < num_runs; ++run) { function(); }
+  count_allocations = false;
+  return num_allocations;
+}
+
+size_t RunLaunchAllocationsTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  const auto num_runs = size_t{10};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+  fprintf(stdout, "* Testing the heap allocations of the kernel launch path\n");
+
+  // Initializes OpenCL and compiles the kernel
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto program = Program(context, kLaunchSource);
+  auto options = std::vector<std::string>();
+  program.Build(device, options);
+
+  // Creates the data and the events to wait for
+  const auto n = size_t{1024};
+  const auto host_data = std::vector<float>(n, 1.0f);
+  auto x = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto wait_events = std::vector<Event>(2);
+  auto kernel = GetKernel(program, "ScaleVector");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, 1.0f);
+  kernel.SetArgument(2, x());
+  for (auto &event : wait_events) {
+    RunKernel(kernel, queue, device, ThreadRange{n}, ThreadRange{64}, event.pointer());
+  }
+  queue.Finish();
+
+  // Looks up a cached kernel and sets its arguments
+  const auto num_lookups = CountAllocations(num_runs, [&]() {
+    auto cached_kernel = GetKernel(program, "ScaleVector");
+    cached_kernel.SetArgument(0, static_cast<int>(n));
+    cached_kernel.SetArgument(1, 1.0f);
+    cached_kernel.SetArgument(2, x());
+  });
+  fprintf(stdout, "    %zu allocation(s) for %zu kernel lookup(s)\n", num_lookups, num_runs);
+  if (num_lookups == 0) { passed++; } else { errors++; }
+
+  // Launches the kernel with and without events
+  const auto num_launches = CountAllocations(num_runs, [&]() {
+    RunKernel(kernel, queue, device, ThreadRange{n}, ThreadRange{64}, nullptr);
+  });
+  fprintf(stdout, "    %zu allocation(s) for %zu launch(es)\n", num_launches, num_runs);
+  if (num_launches == 0) { passed++; } else { errors++; }
+  const auto num_dependent_launches = CountAllocations(num_runs, [&]() {
+    RunKernel(kernel, queue, device, ThreadRange{n}, ThreadRange{64}, nullptr, wait_events);
+  });
+  fprintf(stdout, "    %zu allocation(s) for %zu launch(es) with events\n",
+          num_dependent_launches, num_runs);
+  if (num_dependent_launches == 0) { passed++; } else { errors++; }
+  queue.Finish();
+
+  // Reports the allocations of complete routine calls for reference
+  auto queue_plain = queue();
+  auto y = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  Axpy(n, 1.0f, x(), 0, 1, y(), 0, 1, &queue_plain);
+  const auto num_axpy = CountAllocations(num_runs, [&]() {
+    Axpy(n, 1.0f, x(), 0, 1, y(), 0, 1, &queue_plain);
+  });
+  queue.Finish();
+  fprintf(stdout, "    %zu allocation(s) for %zu AXPY call(s) (not tested)\n", num_axpy, num_runs);
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunLaunchAllocationsTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,96 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the asynchronous mode of the Netlib API: independent calls on
+// different arrays are enqueued without waiting and their results should be in the arrays after
+// 'clblast_netlib_sync'. Routines returning a scalar value should complete before returning, and
+// after disabling the mode, calls should be blocking again.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "clblast_netlib_c.h"
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Checks whether all values of an array are as expected
+bool NetlibAsyncMatches(const std::vector<float> &values, const float expected) {
+  for (const auto value : values) {
+    if (value != expected) { return false; }
+  }
+  return true;
+}
+
+size_t RunNetlibAsyncTests(int, char *[]) {
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  fprintf(stdout, "\n* Testing the asynchronous mode of the Netlib API\n");
+
+  // Arrays of 256KB, such that the calls run on the device
+  const auto n = 64 * 1024;
+  const auto x = std::vector<float>(n, 1.0f);
+  auto y = std::vector<float>(n, 1.0f);
+  auto z = std::vector<float>(n, 1.0f);
+  auto c = std::vector<float>(256 * 256, 1.0f);
+
+  // Independent calls, of which the results are only guaranteed after the synchronisation
+  clblast_netlib_set_async(1);
+  cblas_saxpy(n, 2.0f, x.data(), 1, y.data(), 1);
+  cblas_sscal(n, 3.0f, z.data(), 1);
+  cblas_sgemm(CLBlastLayoutColMajor, CLBlastTransposeNo, CLBlastTransposeNo, 256, 256, 256,
+              1.0f, x.data(), 256, x.data(), 256, 1.0f, c.data(), 256);
+  clblast_netlib_sync();
+  if (NetlibAsyncMatches(y, 3.0f) && NetlibAsyncMatches(z, 3.0f) &&
+      NetlibAsyncMatches(c, 257.0f)) { passed++; }
+  else {
+    fprintf(stdout, "    Error: incorrect results after the synchronisation\n");
+    errors++;
+  }
+
+  // A scalar result is available immediately, also in the asynchronous mode
+  const auto dot = cblas_sdot(n, x.data(), 1, y.data(), 1);
+  if (dot == 3.0f * n) { passed++; }
+  else {
+    fprintf(stdout, "    Error: %.1f instead of %.1f for SDOT\n", dot, 3.0f * n);
+    errors++;
+  }
+
+  // Disabling the mode synchronises, after which calls are blocking again
+  cblas_saxpy(n, 2.0f, x.data(), 1, y.data(), 1);
+  clblast_netlib_set_async(0);
+  cblas_sscal(n, 2.0f, z.data(), 1);
+  if (NetlibAsyncMatches(y, 5.0f) && NetlibAsyncMatches(z, 6.0f)) { passed++; }
+  else {
+    fprintf(stdout, "    Error: incorrect results after disabling the asynchronous mode\n");
+    errors++;
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunNetlibAsyncTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
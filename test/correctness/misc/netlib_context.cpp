@@ -0,0 +1,92 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the persistent context and queue of the Netlib API: a second
+// call of a routine should find its program in the program cache of the context of the first call
+// and should re-use the device buffers of that context from the memory pool, i.e. it should neither
+// compile nor load a program and should not allocate any new buffers.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "clblast_netlib_c.h"
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+size_t RunNetlibContextTests(int, char *[]) {
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  fprintf(stdout, "\n* Testing the persistent context and queue of the Netlib API\n");
+
+  // Runs SAXPY twice on the same arrays
+  const auto n = 4096;
+  const auto x = std::vector<float>(n, 1.0f);
+  auto y = std::vector<float>(n, 1.0f);
+  auto statistics = std::vector<Statistics>(2);
+  for (auto call = size_t{0}; call < 2; ++call) {
+    ResetStatistics();
+    cblas_saxpy(n, 2.0f, x.data(), 1, y.data(), 1);
+    GetStatistics(statistics[call]);
+  }
+
+  // The results should be correct, the first call sets up the context
+  auto correct = true;
+  for (const auto value : y) {
+    if (value != 5.0f) { correct = false; }
+  }
+  if (correct && statistics[0].num_compilations + statistics[0].num_binary_loads > 0 &&
+      statistics[0].num_buffer_allocations > 0) { passed++; }
+  else { errors++; }
+
+  // The second call re-uses the context and queue of the first
+  const auto &second = statistics[1];
+  if (second.num_compilations == 0 && second.num_binary_loads == 0 &&
+      second.program_cache_misses == 0 &&
+      second.num_buffer_allocations == 0 && second.num_buffer_reuses > 0) { passed++; }
+  else {
+    fprintf(stdout, "    Error: %zu compilation(s), %zu binary load(s), %zu program cache miss(es) "
+            "and %zu buffer allocation(s) in the second call\n", second.num_compilations,
+            second.num_binary_loads, second.program_cache_misses, second.num_buffer_allocations);
+    errors++;
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+
+  // Runs on the device with buffers from the memory pool: neither on the host nor with the host
+  // arrays as backing storage of the buffers
+  #ifdef _WIN32
+    _putenv_s("CLBLAST_NETLIB_HOST_LIBRARY", "");
+    _putenv_s("CLBLAST_NETLIB_USE_HOST_PTR", "0");
+  #else
+    unsetenv("CLBLAST_NETLIB_HOST_LIBRARY");
+    setenv("CLBLAST_NETLIB_USE_HOST_PTR", "0", 1);
+  #endif
+
+  const auto errors = clblast::RunNetlibContextTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,85 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the host fallback of the Netlib API. It is run with a host
+// library providing only SAXPY (see 'netlib_host_library.cpp'): small SAXPY calls should run on the
+// host and large ones on the device, whereas SSCAL always runs on the device. This is checked with
+// the call counts. Without a host library, all calls run on the device.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+
+#include "clblast_netlib_c.h"
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Runs SAXPY (or SSCAL) on arrays of ones, checks the results and retrieves the call counts
+bool RunNetlibFallbackCall(const int n, const bool scal, size_t &device_calls, size_t &host_calls) {
+  const auto x = std::vector<float>(n, 1.0f);
+  auto y = std::vector<float>(n, 1.0f);
+  clblast_netlib_reset_call_counts();
+  if (scal) { cblas_sscal(n, 2.0f, y.data(), 1); }
+  else { cblas_saxpy(n, 2.0f, x.data(), 1, y.data(), 1); }
+  clblast_netlib_get_call_counts(&device_calls, &host_calls);
+  for (const auto value : y) {
+    if (value != ((scal) ? 2.0f : 3.0f)) { return false; }
+  }
+  return true;
+}
+
+size_t RunNetlibFallbackTests(int, char *[]) {
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  const auto host_library = std::getenv("CLBLAST_NETLIB_HOST_LIBRARY");
+  const auto has_host_library = (host_library != nullptr && std::string{host_library} != "");
+  fprintf(stdout, "\n* Testing the host fallback of the Netlib API %s a host library\n",
+          (has_host_library) ? "with" : "without");
+
+  // The calls and where they are expected to run: 1KB and 1MB for SAXPY (below and above the
+  // default threshold of 64KB) and 1KB for SSCAL
+  const auto sizes = std::vector<int>{128, 128 * 1024, 128};
+  const auto scals = std::vector<bool>{false, false, true};
+  const auto on_host = std::vector<bool>{has_host_library, false, false};
+  for (auto i = size_t{0}; i < sizes.size(); ++i) {
+    auto device_calls = size_t{0};
+    auto host_calls = size_t{0};
+    const auto correct = RunNetlibFallbackCall(sizes[i], scals[i], device_calls, host_calls);
+    if (correct && host_calls == ((on_host[i]) ? 1 : 0) &&
+        device_calls == ((on_host[i]) ? 0 : 1)) { passed++; }
+    else {
+      fprintf(stdout, "    Error for %s with n=%d: %zu device and %zu host call(s)\n",
+              (scals[i]) ? "SSCAL" : "SAXPY", sizes[i], device_calls, host_calls);
+      errors++;
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunNetlibFallbackTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,133 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the smoke tests for the Fortran BLAS symbols of the Netlib API: it links
+// against a few of them (declared here as a Fortran compiler would call them, i.e. with all
+// arguments by reference) and compares their results against host references on small
+// column-major matrices.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+// The Fortran symbols, without their hidden string lengths (see 'clblast_netlib_fortran.cpp')
+extern "C" {
+  void sgemv_(const char* trans, const int* m, const int* n, const float* alpha,
+              const float* a, const int* lda, const float* x, const int* incx,
+              const float* beta, float* y, const int* incy);
+  void sgemm_(const char* transa, const char* transb, const int* m, const int* n, const int* k,
+              const float* alpha, const float* a, const int* lda, const float* b, const int* ldb,
+              const float* beta, float* c, const int* ldc);
+  void strsm_(const char* side, const char* uplo, const char* transa, const char* diag,
+              const int* m, const int* n, const float* alpha,
+              const float* a, const int* lda, float* b, const int* ldb);
+}
+
+namespace clblast {
+// =================================================================================================
+
+// Compares a result against its reference, printing the name of the routine in case of an error
+bool NetlibFortranMatches(const std::vector<float> &result, const std::vector<float> &reference,
+                          const std::string &name) {
+  for (auto i = size_t{0}; i < result.size(); ++i) {
+    if (std::abs(reference[i] - result[i]) > 1e-3f * std::abs(reference[i]) + 1e-3f) {
+      fprintf(stdout, "    Error in '%s' at index %zu\n", name.c_str(), i);
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t RunNetlibFortranTests(int, char *[]) {
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  fprintf(stdout, "\n* Testing the Fortran BLAS symbols of the Netlib API\n");
+
+  // Small matrices with values depending on their position, A is 'm' by 'k' and B is 'k' by 'n'
+  const auto m = 13;
+  const auto n = 7;
+  const auto k = 9;
+  const auto alpha = 0.5f;
+  const auto beta = 2.0f;
+  auto a = std::vector<float>(m * k);
+  auto b = std::vector<float>(k * n);
+  auto c = std::vector<float>(m * n);
+  for (auto i = size_t{0}; i < a.size(); ++i) { a[i] = static_cast<float>(i % 5) - 2.0f; }
+  for (auto i = size_t{0}; i < b.size(); ++i) { b[i] = static_cast<float>(i % 3) + 1.0f; }
+  for (auto i = size_t{0}; i < c.size(); ++i) { c[i] = static_cast<float>(i % 7) - 3.0f; }
+  const auto one = 1;
+
+  // GEMV with a transposed A (given as lower-case option): y = alpha * A^T * x + beta * y
+  const auto x = std::vector<float>(b.begin(), b.begin() + m);
+  auto y = std::vector<float>(c.begin(), c.begin() + k);
+  auto reference_y = y;
+  for (auto j = 0; j < k; ++j) {
+    auto sum = 0.0f;
+    for (auto i = 0; i < m; ++i) { sum += a[j * m + i] * x[i]; }
+    reference_y[j] = alpha * sum + beta * y[j];
+  }
+  sgemv_("t", &m, &k, &alpha, a.data(), &m, x.data(), &one, &beta, y.data(), &one);
+  if (NetlibFortranMatches(y, reference_y, "sgemv_")) { passed++; } else { errors++; }
+
+  // GEMM without transposes: C = alpha * A * B + beta * C
+  auto reference_c = c;
+  for (auto j = 0; j < n; ++j) {
+    for (auto i = 0; i < m; ++i) {
+      auto sum = 0.0f;
+      for (auto l = 0; l < k; ++l) { sum += a[l * m + i] * b[j * k + l]; }
+      reference_c[j * m + i] = alpha * sum + beta * c[j * m + i];
+    }
+  }
+  sgemm_("N", "N", &m, &n, &k, &alpha, a.data(), &m, b.data(), &k, &beta, c.data(), &m);
+  if (NetlibFortranMatches(c, reference_c, "sgemm_")) { passed++; } else { errors++; }
+
+  // TRSM with a lower-triangular, unit-diagonal A on the left: solves A * X = alpha * (A * B) for a
+  // 'k' by 'n' matrix, of which the solution is alpha * B
+  auto triangular = std::vector<float>(k * k, 0.0f);
+  for (auto j = 0; j < k; ++j) {
+    for (auto i = j + 1; i < k; ++i) {
+      triangular[j * k + i] = 0.1f * static_cast<float>((i + j) % 4);
+    }
+  }
+  auto solution = std::vector<float>(k * n);
+  auto reference_solution = std::vector<float>(k * n);
+  for (auto j = 0; j < n; ++j) {
+    for (auto i = 0; i < k; ++i) {
+      auto sum = b[j * k + i]; // the unit diagonal
+      for (auto l = 0; l < i; ++l) { sum += triangular[l * k + i] * b[j * k + l]; }
+      solution[j * k + i] = sum;
+      reference_solution[j * k + i] = alpha * b[j * k + i];
+    }
+  }
+  strsm_("L", "l", "N", "u", &k, &n, &alpha, triangular.data(), &k, solution.data(), &k);
+  if (NetlibFortranMatches(solution, reference_solution, "strsm_")) { passed++; } else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunNetlibFortranTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,32 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains a minimal CPU BLAS library with only SAXPY, loaded as host library of the
+// Netlib API by the 'netlib_fallback' test (see 'CLBLAST_NETLIB_HOST_LIBRARY').
+//
+// =================================================================================================
+
+#if defined(_WIN32)
+  #define HOST_API __declspec(dllexport)
+#else
+  #define HOST_API
+#endif
+
+extern "C" {
+
+HOST_API void cblas_saxpy(const int n, const float alpha, const float* x, const int x_inc,
+                          float* y, const int y_inc) {
+  for (auto i = 0; i < n; ++i) {
+    y[i * y_inc] += alpha * x[i * x_inc];
+  }
+}
+
+} // extern "C"
+
+// =================================================================================================
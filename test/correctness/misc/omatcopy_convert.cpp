@@ -0,0 +1,145 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the type-converting matrix copies OmatcopyToHalf and
+// OmatcopyFromHalf. The values are exact in half precision, such that the results can be compared
+// exactly with the host references, both for the fast kernels and for the general kernels.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Computes the column-major reference of B = alpha * op(A), with A an m by n matrix
+std::vector<float> OmatcopyConvertReference(const std::vector<float> &a, const size_t a_ld,
+                                            const size_t m, const size_t n, const bool transpose,
+                                            const size_t b_ld, const float alpha) {
+  const auto b_two = (transpose) ? m : n;
+  auto b = std::vector<float>(b_ld * b_two, 0.0f);
+  for (auto j = size_t{0}; j < n; ++j) {
+    for (auto i = size_t{0}; i < m; ++i) {
+      const auto index = (transpose) ? i * b_ld + j : j * b_ld + i;
+      b[index] = alpha * a[j * a_ld + i];
+    }
+  }
+  return b;
+}
+
+// Compares the elements of the (possibly padded) result with the reference
+bool IsExpectedOmatcopyConvert(const std::vector<float> &result,
+                               const std::vector<float> &reference, const size_t rows,
+                               const size_t cols, const size_t ld) {
+  for (auto j = size_t{0}; j < cols; ++j) {
+    for (auto i = size_t{0}; i < rows; ++i) {
+      if (result[j * ld + i] != reference[j * ld + i]) { return false; }
+    }
+  }
+  return true;
+}
+
+size_t RunOmatcopyConvertTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  const auto alpha = 1.5f;
+
+  // Square multiples of the work-group sizes (the fast kernels) and odd sizes with leading
+  // dimensions larger than needed (the general kernels)
+  for (const auto sizes : {std::vector<size_t>{256, 256, 0}, std::vector<size_t>{67, 45, 3}}) {
+    const auto m = sizes[0];
+    const auto n = sizes[1];
+    const auto a_ld = m + sizes[2];
+    for (const auto a_transpose : {Transpose::kNo, Transpose::kYes}) {
+      const auto transpose = (a_transpose == Transpose::kYes);
+      const auto b_one = (transpose) ? n : m;
+      const auto b_two = (transpose) ? m : n;
+      const auto b_ld = b_one + sizes[2];
+      fprintf(stdout, "* Testing %zux%zu matrices %s transposition\n", m, n,
+              (transpose) ? "with" : "without");
+
+      // Values which are exact in half precision
+      auto host_a = std::vector<float>(a_ld * n);
+      for (auto i = size_t{0}; i < host_a.size(); ++i) {
+        host_a[i] = 0.25f * static_cast<float>(static_cast<int>(i % 9) - 4);
+      }
+      const auto reference = OmatcopyConvertReference(host_a, a_ld, m, n, transpose, b_ld, alpha);
+
+      // Single to half precision
+      auto a_single = Buffer<float>(context, host_a.size());
+      auto b_half = Buffer<half>(context, b_ld * b_two);
+      a_single.Write(queue, host_a.size(), host_a);
+      if (OmatcopyToHalf(Layout::kColMajor, a_transpose, m, n, alpha, a_single(), 0, a_ld,
+                         b_half(), 0, b_ld, &queue_plain) == StatusCode::kSuccess) {
+        auto host_b_half = std::vector<half>(b_ld * b_two);
+        b_half.Read(queue, host_b_half.size(), host_b_half);
+        auto result = std::vector<float>(host_b_half.size());
+        for (auto i = size_t{0}; i < result.size(); ++i) {
+          result[i] = HalfToFloat(host_b_half[i]);
+        }
+        if (IsExpectedOmatcopyConvert(result, reference, b_one, b_two, b_ld)) { passed++; }
+        else { errors++; }
+      }
+      else { errors++; }
+
+      // Half to single precision
+      auto host_a_half = std::vector<half>(host_a.size());
+      for (auto i = size_t{0}; i < host_a.size(); ++i) { host_a_half[i] = FloatToHalf(host_a[i]); }
+      auto a_half = Buffer<half>(context, host_a_half.size());
+      auto b_single = Buffer<float>(context, b_ld * b_two);
+      a_half.Write(queue, host_a_half.size(), host_a_half);
+      if (OmatcopyFromHalf(Layout::kColMajor, a_transpose, m, n, FloatToHalf(alpha),
+                           a_half(), 0, a_ld, b_single(), 0, b_ld,
+                           &queue_plain) == StatusCode::kSuccess) {
+        auto result = std::vector<float>(b_ld * b_two);
+        b_single.Read(queue, result.size(), result);
+        if (IsExpectedOmatcopyConvert(result, reference, b_one, b_two, b_ld)) { passed++; }
+        else { errors++; }
+      }
+      else { errors++; }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunOmatcopyConvertTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
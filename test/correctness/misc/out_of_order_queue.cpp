@@ -0,0 +1,159 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for routines on out-of-order queues: a sequence of routines chained
+// through events (see 'SetEventWaitList') should give the same results as on an in-order queue.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Compares two vectors with a relative margin
+bool MatchesOutOfOrder(const std::vector<float> &reference, const std::vector<float> &result) {
+  if (reference.size() != result.size()) { return false; }
+  for (auto i = size_t{0}; i < reference.size(); ++i) {
+    if (std::abs(reference[i] - result[i]) > 1e-3 * std::abs(reference[i]) + 1e-3) { return false; }
+  }
+  return true;
+}
+
+// The sequence of routines: the DOT result depends on the AXPY result, which depends on the GEMM
+// result. Each routine waits for the event of the previous one, the last event is returned.
+StatusCode RunChainedSequence(const size_t m, const size_t n, const size_t k,
+                              const Buffer<float> &a, const Buffer<float> &b, const Buffer<float> &c,
+                              const Buffer<float> &y, const Buffer<float> &dot,
+                              cl_command_queue queue, cl_event* event) {
+  auto gemm_event = cl_event{nullptr};
+  auto axpy_event = cl_event{nullptr};
+  auto status = Gemm(Layout::kRowMajor, Transpose::kYes, Transpose::kNo, m, n, k, 1.5f,
+                     a(), 0, m, b(), 0, n, 0.5f, c(), 0, n, &queue, &gemm_event);
+  status = (status != StatusCode::kSuccess) ? status : SetEventWaitList(&queue, 1, &gemm_event);
+  status = (status != StatusCode::kSuccess) ? status :
+           Axpy(m * n, 2.0f, c(), 0, 1, y(), 0, 1, &queue, &axpy_event);
+  status = (status != StatusCode::kSuccess) ? status : SetEventWaitList(&queue, 1, &axpy_event);
+  status = (status != StatusCode::kSuccess) ? status :
+           Dot<float>(m * n, dot(), 0, c(), 0, 1, y(), 0, 1, &queue, event);
+  if (gemm_event) { clReleaseEvent(gemm_event); }
+  if (axpy_event) { clReleaseEvent(axpy_event); }
+  return status;
+}
+
+size_t RunOutOfOrderQueueTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL with an in-order queue and (if supported) an out-of-order queue
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  auto status_ooo = cl_int{CL_SUCCESS};
+  auto queue_ooo = clCreateCommandQueue(context(), device(), CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE,
+                                        &status_ooo);
+  if (status_ooo != CL_SUCCESS) {
+    fprintf(stdout, "* Out-of-order queues are not supported on this device, skipping test\n\n");
+    return 0;
+  }
+  fprintf(stdout, "* Testing routines chained through events on an out-of-order queue\n");
+
+  // Populates the host data, the sizes are such that GEMM needs its pre-processing kernels
+  const auto m = size_t{517};
+  const auto n = size_t{403};
+  const auto k = size_t{261};
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  auto host_a = std::vector<float>(k * m);
+  auto host_b = std::vector<float>(k * n);
+  auto host_c = std::vector<float>(m * n);
+  auto host_y = std::vector<float>(m * n);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+  PopulateVector(host_y, mt, dist);
+
+  // Two sets of device data: one for the in-order reference and one for the out-of-order queue
+  auto a = Buffer<float>(context, queue, host_a.begin(), host_a.end());
+  auto b = Buffer<float>(context, queue, host_b.begin(), host_b.end());
+  auto reference_c = Buffer<float>(context, queue, host_c.begin(), host_c.end());
+  auto reference_y = Buffer<float>(context, queue, host_y.begin(), host_y.end());
+  auto reference_dot = Buffer<float>(context, 1);
+  auto result_c = Buffer<float>(context, queue, host_c.begin(), host_c.end());
+  auto result_y = Buffer<float>(context, queue, host_y.begin(), host_y.end());
+  auto result_dot = Buffer<float>(context, 1);
+  queue.Finish();
+
+  // Runs the sequence on both queues, on the out-of-order queue only waiting for the last event
+  auto reference_event = cl_event{nullptr};
+  auto result_event = cl_event{nullptr};
+  auto status = RunChainedSequence(m, n, k, a, b, reference_c, reference_y, reference_dot,
+                                   queue_plain, &reference_event);
+  status = (status != StatusCode::kSuccess) ? status :
+           RunChainedSequence(m, n, k, a, b, result_c, result_y, result_dot,
+                              queue_ooo, &result_event);
+  if (status == StatusCode::kSuccess) { clWaitForEvents(1, &result_event); }
+  queue.Finish();
+
+  // Compares the results
+  if (status == StatusCode::kSuccess) {
+    for (const auto &pair : {std::make_pair(&reference_c, &result_c),
+                             std::make_pair(&reference_y, &result_y),
+                             std::make_pair(&reference_dot, &result_dot)}) {
+      const auto size = pair.first->GetSize() / sizeof(float);
+      auto expected = std::vector<float>(size);
+      auto result = std::vector<float>(size);
+      pair.first->Read(queue, size, expected);
+      pair.second->Read(queue, size, result);
+      if (MatchesOutOfOrder(expected, result)) { passed++; } else { errors++; }
+    }
+  }
+  else {
+    fprintf(stdout, "* Routines on an out-of-order queue failed with status %d\n",
+            static_cast<int>(status));
+    errors++;
+  }
+  if (reference_event) { clReleaseEvent(reference_event); }
+  if (result_event) { clReleaseEvent(result_event); }
+  clFinish(queue_ooo);
+  clReleaseCommandQueue(queue_ooo);
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunOutOfOrderQueueTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -7,7 +7,7 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file contains the tests for the OverrideParameters function
+// This file contains the tests for the OverrideParameters and OverrideParametersForSize functions
 //
 // =================================================================================================
 
@@ -38,6 +38,8 @@ size_t RunOverrideTests(int argc, char *argv[], const bool silent, const std::st
     { {"GEMMK",0}, {"KREG",1}, {"KWG",16}, {"KWI",2}, {"MDIMA",4}, {"MDIMC",4}, {"MWG",16}, {"NDIMB",4}, {"NDIMC",4}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} },
     { {"GEMMK",0}, {"KREG",1}, {"KWG",32}, {"KWI",2}, {"MDIMA",4}, {"MDIMC",4}, {"MWG",32}, {"NDIMB",4}, {"NDIMC",4}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} },
     { {"GEMMK",0}, {"KREG",1}, {"KWG",16}, {"KWI",2}, {"MDIMA",4}, {"MDIMC",4}, {"MWG",16}, {"NDIMB",4}, {"NDIMC",4}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} },
+    { {"DBUF",1}, {"GEMMK",0}, {"KREG",1}, {"KWG",16}, {"KWI",2}, {"MDIMA",4}, {"MDIMC",4}, {"MWG",16}, {"NDIMB",4}, {"NDIMC",4}, {"NWG",16}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} },
+    { {"GEMMK",0}, {"KREG",1}, {"KWG",16}, {"KWI",2}, {"MDIMA",4}, {"MDIMC",4}, {"MWG",16}, {"NDIMB",4}, {"NDIMC",4}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"SWZ",2}, {"VWM",1}, {"VWN",1} },
   };
   const auto invalid_settings = std::vector<std::unordered_map<std::string,size_t>>{
     { {"GEMMK",0}, {"KREG",1}, {"KWI",2}, {"MDIMA",4}, {"MDIMC",4}, {"MWG",16}, {"NDIMB",4}, {"NDIMC",4}, {"NWG",16}, {"SA",0} },
@@ -122,6 +124,29 @@ size_t RunOverrideTests(int argc, char *argv[], const bool silent, const std::st
     passed++;
   }
 
+  // Sets size-specific parameters: valid ones for a bucket that includes the problem size and one just
+  // below it, and invalid ones which should be rejected
+  fprintf(stdout, "* Testing OverrideParametersForSize for '%s'\n", routine_name.c_str());
+  const auto max_sizes = std::vector<size_t>{args.m * 2, args.m - 1};
+  for (const auto max_size : max_sizes) {
+    const auto status = OverrideParametersForSize(device(), kernel_name, precision, max_size, valid_settings[1]);
+    if (status != StatusCode::kSuccess) { errors++; continue; } // error shouldn't occur
+
+    const auto status_after = example_routine.RunRoutine(args, buffers, queue);
+    if (status_after != StatusCode::kSuccess) { errors++; continue; }
+    passed++;
+  }
+  const auto status_no_size = OverrideParametersForSize(device(), kernel_name, precision, 0, valid_settings[0]);
+  if (status_no_size == StatusCode::kSuccess) { errors++; } else { passed++; } // error should occur
+  for (const auto &override_setting : invalid_settings) {
+    const auto status = OverrideParametersForSize(device(), kernel_name, precision, args.m, override_setting);
+    if (status == StatusCode::kSuccess) { errors++; continue; } // error should occur
+
+    const auto status_after = example_routine.RunRoutine(args, buffers, queue);
+    if (status_after != StatusCode::kSuccess) { errors++; continue; }
+    passed++;
+  }
+
   // Prints and returns the statistics
   std::cout << "    " << passed << " test(s) passed" << std::endl;
   std::cout << "    " << errors << " test(s) failed" << std::endl;
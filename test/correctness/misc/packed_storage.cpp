@@ -0,0 +1,195 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the packed-storage routines: the conversions Tpttr and Trttp are
+// compared with a host reference, and SyrkPacked and TrsmPacked with the regular Syrk and Trsm
+// routines on full matrices.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Packs the triangle of a full n by n matrix on the host. A row-major matrix is packed as the
+// column-major matrix of the other triangle, which matches the row-major packed format.
+std::vector<float> PackOnHost(const std::vector<float> &a, const size_t a_ld, const size_t n,
+                              const bool is_upper) {
+  auto ap = std::vector<float>(n * (n + 1) / 2);
+  auto index = size_t{0};
+  for (auto col = size_t{0}; col < n; ++col) {
+    const auto row_start = (is_upper) ? size_t{0} : col;
+    const auto row_end = (is_upper) ? col + 1 : n;
+    for (auto row = row_start; row < row_end; ++row) {
+      ap[index++] = a[col * a_ld + row];
+    }
+  }
+  return ap;
+}
+
+// Compares two vectors, relative to the magnitude of the reference
+bool IsClosePacked(const std::vector<float> &result, const std::vector<float> &reference) {
+  for (auto i = size_t{0}; i < reference.size(); ++i) {
+    if (std::abs(result[i] - reference[i]) > 1e-4 * std::abs(reference[i]) + 1e-4) { return false; }
+  }
+  return true;
+}
+
+size_t RunPackedStorageTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  constexpr auto kPadding = size_t{3}; // the leading dimension of the full matrices is larger
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  const auto n = size_t{37};
+  const auto k = size_t{19};
+  const auto ld = n + kPadding;
+  const auto packed_size = n * (n + 1) / 2;
+  const auto alpha = 0.75f;
+  const auto beta = 1.5f;
+  for (const auto layout : {Layout::kColMajor, Layout::kRowMajor}) {
+    for (const auto triangle : {Triangle::kUpper, Triangle::kLower}) {
+      const auto is_upper = (triangle == Triangle::kUpper) == (layout == Layout::kColMajor);
+      fprintf(stdout, "* Testing the %s triangle of a %s matrix\n",
+              (triangle == Triangle::kUpper) ? "upper" : "lower",
+              (layout == Layout::kColMajor) ? "column-major" : "row-major");
+
+      // A random full matrix with a dominant diagonal, such that it is well-conditioned for TRSM
+      auto host_a = std::vector<float>(n * ld);
+      for (auto &value : host_a) { value = dist(mt); }
+      for (auto i = size_t{0}; i < n; ++i) { host_a[i * ld + i] += static_cast<float>(n); }
+      const auto host_ap = PackOnHost(host_a, ld, n, is_upper);
+      auto a = Buffer<float>(context, host_a.size());
+      auto ap = Buffer<float>(context, packed_size);
+      a.Write(queue, host_a.size(), host_a);
+
+      // Full to packed storage
+      auto result_ap = std::vector<float>(packed_size);
+      if (Trttp<float>(layout, triangle, n, a(), 0, ld, ap(), 0,
+                       &queue_plain) == StatusCode::kSuccess) {
+        ap.Read(queue, packed_size, result_ap);
+        if (result_ap == host_ap) { passed++; } else { errors++; }
+      }
+      else { errors++; }
+
+      // Packed to full storage: the other triangle should be untouched
+      auto host_b = std::vector<float>(n * ld, -7.0f);
+      auto b = Buffer<float>(context, host_b.size());
+      b.Write(queue, host_b.size(), host_b);
+      ap.Write(queue, packed_size, host_ap);
+      if (Tpttr<float>(layout, triangle, n, ap(), 0, b(), 0, ld,
+                       &queue_plain) == StatusCode::kSuccess) {
+        auto result_b = std::vector<float>(host_b.size());
+        b.Read(queue, result_b.size(), result_b);
+        auto matches = true;
+        for (auto col = size_t{0}; col < n; ++col) {
+          for (auto row = size_t{0}; row < n; ++row) {
+            const auto in_triangle = (is_upper) ? (row <= col) : (row >= col);
+            const auto expected = (in_triangle) ? host_a[col * ld + row] : -7.0f;
+            if (result_b[col * ld + row] != expected) { matches = false; }
+          }
+        }
+        if (matches) { passed++; } else { errors++; }
+      }
+      else { errors++; }
+
+      // SYRK on packed storage compared with the regular SYRK on matrix A as the full matrix C
+      for (const auto a_transpose : {Transpose::kNo, Transpose::kYes}) {
+        const auto x_rotated = (layout == Layout::kRowMajor) == (a_transpose == Transpose::kNo);
+        const auto x_ld = (x_rotated) ? k : n;
+        auto host_x = std::vector<float>(n * k);
+        for (auto &value : host_x) { value = dist(mt); }
+        auto x = Buffer<float>(context, host_x.size());
+        x.Write(queue, host_x.size(), host_x);
+        a.Write(queue, host_a.size(), host_a);
+        ap.Write(queue, packed_size, host_ap);
+        auto status = Syrk<float>(layout, triangle, a_transpose, n, k, alpha, x(), 0, x_ld,
+                                  beta, a(), 0, ld, &queue_plain);
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+        status = SyrkPacked<float>(layout, triangle, a_transpose, n, k, alpha, x(), 0, x_ld,
+                                   beta, ap(), 0, &queue_plain);
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+        auto result_a = std::vector<float>(host_a.size());
+        a.Read(queue, result_a.size(), result_a);
+        ap.Read(queue, packed_size, result_ap);
+        if (IsClosePacked(result_ap, PackOnHost(result_a, ld, n, is_upper))) { passed++; }
+        else { errors++; }
+      }
+
+      // TRSM with packed matrix A compared with the regular TRSM on the full matrix A
+      for (const auto side : {Side::kLeft, Side::kRight}) {
+        const auto m = (side == Side::kLeft) ? n : k;
+        const auto b_cols = (side == Side::kLeft) ? k : n;
+        const auto b_ld = (layout == Layout::kColMajor) ? m : b_cols;
+        auto host_c = std::vector<float>(m * b_cols);
+        for (auto &value : host_c) { value = dist(mt); }
+        auto c = Buffer<float>(context, host_c.size());
+        auto c_reference = Buffer<float>(context, host_c.size());
+        c.Write(queue, host_c.size(), host_c);
+        c_reference.Write(queue, host_c.size(), host_c);
+        a.Write(queue, host_a.size(), host_a);
+        ap.Write(queue, packed_size, host_ap);
+        auto status = Trsm<float>(layout, side, triangle, Transpose::kNo, Diagonal::kNonUnit,
+                                  m, b_cols, alpha, a(), 0, ld, c_reference(), 0, b_ld,
+                                  &queue_plain);
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+        status = TrsmPacked<float>(layout, side, triangle, Transpose::kNo, Diagonal::kNonUnit,
+                                   m, b_cols, alpha, ap(), 0, c(), 0, b_ld, &queue_plain);
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+        auto result = std::vector<float>(host_c.size());
+        auto reference = std::vector<float>(host_c.size());
+        c.Read(queue, result.size(), result);
+        c_reference.Read(queue, reference.size(), reference);
+        if (IsClosePacked(result, reference)) { passed++; } else { errors++; }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunPackedStorageTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -60,6 +60,32 @@ bool TestDefines() {
   const auto result1 = PreprocessKernelSource(source1);
   return result1 == expected1;
 }
+
+bool TestConditions() {
+  const auto source1 =
+  R"(
+  #define MWG 64
+  #define NWI 8
+  #define NWIB 4
+  #if NWI != 8 || MWG < 32
+    #define ERROR
+  #elif NWIB == 4 && MWG >= 2*32
+    #define SUCCESS
+  #endif
+  #if (MWG/NWI) > 8
+    #define ERROR
+  #endif
+  )";
+  const auto expected1 =
+  "  #define MWG 64\n"
+  "  #define NWI 8\n"
+  "  #define NWIB 4\n"
+  "    #define SUCCESS\n"
+  "  \n";
+  const auto result1 = PreprocessKernelSource(source1);
+  return result1 == expected1;
+}
+
 // =================================================================================================
 
 bool TestArrayToRegisterPromotion() {
@@ -158,6 +184,7 @@ size_t RunPreprocessor(int argc, char *argv[], const bool silent, const Precisio
 
   // Basic tests
   if (TestDefines()) { passed++; } else { errors++; }
+  if (TestConditions()) { passed++; } else { errors++; }
   if (TestArrayToRegisterPromotion()) { passed++; } else { errors++; }
 
   // XAXPY
@@ -227,9 +254,11 @@ size_t RunPreprocessor(int argc, char *argv[], const bool silent, const Precisio
     "#define MWG 16\n"
     "#define NWG 16\n"
     "#define SA 1\n"
+    #include "../src/kernels/level3/xgemm_epilogue.opencl"
     #include "../src/kernels/level3/xgemm_part1.opencl"
     #include "../src/kernels/level3/xgemm_part2.opencl"
     #include "../src/kernels/level3/xgemm_part3.opencl"
+    #include "../src/kernels/level3/xgemm_tensor.opencl"
     #include "../src/kernels/level3/xgemm_part4.opencl"
   ;
   if (TestKernel(device, context, "Xgemm", gemm_sources, precision)) { passed++; } else { errors++; }
@@ -238,11 +267,14 @@ size_t RunPreprocessor(int argc, char *argv[], const bool silent, const Precisio
   const auto gemm_direct_sources =
     "#define KWID 2\n"
     "#define WGD 16\n"
+    #include "../src/kernels/level3/xgemm_epilogue.opencl"
     #include "../src/kernels/level3/xgemm_direct_part1.opencl"
     #include "../src/kernels/level3/xgemm_direct_part2.opencl"
     #include "../src/kernels/level3/xgemm_direct_part3.opencl"
+    #include "../src/kernels/level3/xgemm_direct_fast.opencl"
   ;
   if (TestKernel(device, context, "XgemmDirectTN", gemm_direct_sources, precision)) { passed++; } else { errors++; }
+  if (TestKernel(device, context, "XgemmDirectFastTN", gemm_direct_sources, precision)) { passed++; } else { errors++; }
 
   // HEMM
   if (precision == Precision::kComplexSingle || precision == Precision::kComplexDouble) {
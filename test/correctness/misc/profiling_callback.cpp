@@ -0,0 +1,127 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the runtime profiling hooks (see 'SetProfilingCallback'): the
+// callback should receive the timing of each kernel of a routine once the kernel has completed.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The profiles received by the callback, which is called from a thread of the OpenCL implementation
+struct ReceivedProfiles {
+  std::mutex mutex;
+  std::vector<std::string> routine_names;
+  std::atomic<size_t> num_profiles{0};
+  std::atomic<size_t> num_invalid{0};
+};
+
+void ReceiveProfile(const KernelProfile &profile, void* user_data) {
+  auto received = static_cast<ReceivedProfiles*>(user_data);
+  if (profile.end_time < profile.start_time || profile.num_dimensions == 0 ||
+      std::string{profile.kernel_name}.empty()) {
+    received->num_invalid++;
+  }
+  {
+    std::lock_guard<std::mutex> lock(received->mutex);
+    received->routine_names.push_back(profile.routine_name);
+  }
+  received->num_profiles++;
+}
+
+size_t RunProfilingCallbackTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  fprintf(stdout, "* Testing the runtime profiling callback\n");
+
+  // Data for an AXPY and a DOT routine
+  const auto n = size_t{4096};
+  auto host_x = std::vector<float>(n, 1.0f);
+  auto x = Buffer<float>(context, queue, host_x.begin(), host_x.end());
+  auto y = Buffer<float>(context, queue, host_x.begin(), host_x.end());
+  auto dot = Buffer<float>(context, 1);
+
+  // Runs the routines with the callback set, and afterwards once without
+  auto received = ReceivedProfiles();
+  auto status = SetProfilingCallback(ReceiveProfile, &received);
+  status = (status != StatusCode::kSuccess) ? status :
+           Axpy(n, 2.0f, x(), 0, 1, y(), 0, 1, &queue_plain);
+  status = (status != StatusCode::kSuccess) ? status :
+           Dot<float>(n, dot(), 0, x(), 0, 1, y(), 0, 1, &queue_plain);
+  queue.Finish();
+  status = (status != StatusCode::kSuccess) ? status : SetProfilingCallback(nullptr);
+  status = (status != StatusCode::kSuccess) ? status :
+           Axpy(n, 2.0f, x(), 0, 1, y(), 0, 1, &queue_plain);
+  queue.Finish();
+
+  // The callbacks are asynchronous, so they might arrive some time after the queue is finished
+  for (auto i = 0; i < 100 && received.num_profiles < 2; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+  // Checks that there is at least one valid profile per routine and none after the removal
+  if (status != StatusCode::kSuccess) {
+    fprintf(stdout, "* Profiling failed with status %d\n", static_cast<int>(status));
+    errors++;
+  }
+  else {
+    std::lock_guard<std::mutex> lock(received.mutex);
+    const auto &names = received.routine_names;
+    const auto num_axpy = std::count(names.begin(), names.end(), std::string{"AXPY"});
+    const auto num_dot = std::count(names.begin(), names.end(), std::string{"DOT"});
+    if (num_axpy == 1 && num_dot >= 1 && num_axpy + num_dot == static_cast<long>(names.size())) {
+      passed++;
+    } else { errors++; }
+    if (received.num_invalid == 0) { passed++; } else { errors++; }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunProfilingCallbackTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,115 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the eviction of programs from the cache: with a limit of a single
+// program, a program used before another one should be loaded again from the binary cache, and so
+// should a program after clearing the cache of its context. The results should stay correct.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Runs AXPY on a vector of ones and checks the results
+bool RunAxpy(const Context &context, Queue &queue, const size_t n) {
+  auto queue_plain = queue();
+  const auto host_data = std::vector<float>(n, 1.0f);
+  auto x = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto y = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  const auto status = Axpy(n, 2.0f, x(), 0, 1, y(), 0, 1, &queue_plain);
+  if (status != StatusCode::kSuccess) { return false; }
+  auto result = std::vector<float>(n);
+  y.Read(queue, n, result);
+  for (const auto value : result) {
+    if (value != 3.0f) { return false; }
+  }
+  return true;
+}
+
+// Retrieves the number of programs loaded from a binary since the last reset
+size_t NumBinaryLoads() {
+  auto statistics = Statistics{};
+  if (GetStatistics(statistics) != StatusCode::kSuccess) { return 0; }
+  return statistics.num_binary_loads;
+}
+
+size_t RunProgramCacheTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+  fprintf(stdout, "* Testing the eviction of programs from the cache\n");
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  const auto n = size_t{1000};
+
+  // Runs AXPY, then SCAL which evicts the AXPY program, and then AXPY again
+  if (SetProgramCacheLimit(1) != StatusCode::kSuccess) { errors++; }
+  if (RunAxpy(context, queue, n)) { passed++; } else { errors++; }
+  ResetStatistics();
+  const auto host_data = std::vector<float>(n, 1.0f);
+  auto x = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  if (Scal(n, 2.0f, x(), 0, 1, &queue_plain) == StatusCode::kSuccess) { passed++; } else { errors++; }
+  const auto num_loads = NumBinaryLoads();
+  if (RunAxpy(context, queue, n)) { passed++; } else { errors++; }
+  if (NumBinaryLoads() > num_loads) { passed++; } else { errors++; }
+  if (SetProgramCacheLimit(0) != StatusCode::kSuccess) { errors++; }
+
+  // Runs AXPY on a second context before and after clearing the cache of that context
+  {
+    const auto other_context = Context(device);
+    auto other_queue = Queue(other_context, device);
+    if (RunAxpy(other_context, other_queue, n)) { passed++; } else { errors++; }
+    if (ClearContextCache(other_context()) == StatusCode::kSuccess) { passed++; } else { errors++; }
+    ResetStatistics();
+    if (RunAxpy(other_context, other_queue, n)) { passed++; } else { errors++; }
+    if (NumBinaryLoads() > 0) { passed++; } else { errors++; }
+    other_queue.Finish();
+    ClearContextCache(other_context());
+  }
+
+  // The first context is not affected
+  ResetStatistics();
+  if (RunAxpy(context, queue, n)) { passed++; } else { errors++; }
+  if (NumBinaryLoads() == 0) { passed++; } else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunProgramCacheTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
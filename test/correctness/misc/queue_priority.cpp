@@ -0,0 +1,168 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the queues with scheduling hints and the chunk limit of GEMM: a
+// GEMM computed in chunks on a low priority queue should match the one computed at once on a high
+// priority queue, and should launch more kernels. The hints are ignored on devices without the
+// 'cl_khr_priority_hints' and 'cl_khr_throttle_hints' extensions, so only the results are tested.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Runs GEMM and returns the number of kernels it launched, or zero in case of an error
+template <typename T>
+size_t RunGemmCountingKernels(const Layout layout, const size_t m, const size_t n, const size_t k,
+                              const Buffer<T> &a, const size_t a_ld, const Buffer<T> &b,
+                              const size_t b_ld, Buffer<T> &c, const size_t c_ld,
+                              cl_command_queue queue) {
+  auto statistics = Statistics{};
+  if (ResetStatistics() != StatusCode::kSuccess) { return 0; }
+  const auto status = Gemm(layout, Transpose::kNo, Transpose::kNo, m, n, k, T{1},
+                           a(), 0, a_ld, b(), 0, b_ld, T{1}, c(), 0, c_ld, &queue);
+  if (status != StatusCode::kSuccess) { return 0; }
+  if (GetStatistics(statistics) != StatusCode::kSuccess) { return 0; }
+  const auto gemm = statistics.routines.find("GEMM");
+  return (gemm != statistics.routines.end()) ? gemm->second.num_kernels : 0;
+}
+
+template <typename T>
+size_t RunQueuePriorityTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Determines the test settings: the chunk limit results in blocks of a single tile
+  const auto shapes = std::vector<std::vector<size_t>>{{300, 200, 150}, {257, 129, 65}};
+  const auto chunk_limit = size_t{1};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL and creates the two queues
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto high_queue = cl_command_queue{nullptr};
+  auto low_queue = cl_command_queue{nullptr};
+  if (CreatePriorityQueue(context(), device(), QueuePriority::kHigh, QueueThrottle::kHigh,
+                          &high_queue) != StatusCode::kSuccess ||
+      CreatePriorityQueue(context(), device(), QueuePriority::kLow, QueueThrottle::kLow,
+                          &low_queue) != StatusCode::kSuccess) {
+    fprintf(stdout, "* Creating the priority queues failed\n");
+    return 1;
+  }
+
+  // Selects the in-direct kernel for all sizes, since only that one is computed in chunks
+  fprintf(stdout, "* Testing the priority queues and the GEMM chunk limit for '%s'\n", routine_name.c_str());
+  const auto status = OverrideParameters(device(), "GemmRoutine", PrecisionValue<T>(),
+                                         {{"XGEMM_MIN_INDIRECT_SIZE", 0}, {"XGEMM_MIN_SPLITK_K", 0},
+                                          {"XGEMM_MIN_3M_SIZE", 0}, {"XGEMM_MAX_ALT_SIZE", 0},
+                                          {"XGEMM_INDIRECT_COPY_COST", 0},
+                                          {"XGEMM_MIN_STRASSEN_SIZE", 0}});
+  if (status != StatusCode::kSuccess) { return 1; }
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &shape : shapes) {
+    for (const auto layout : layouts) {
+      const auto m = shape[0];
+      const auto n = shape[1];
+      const auto k = shape[2];
+      const auto a_ld = (layout == Layout::kColMajor) ? m : k;
+      const auto b_ld = (layout == Layout::kColMajor) ? k : n;
+      const auto c_ld = (layout == Layout::kColMajor) ? m : n;
+
+      // Populates the host matrices with some example data and copies them to the device
+      auto host_a = std::vector<T>(m * k);
+      auto host_b = std::vector<T>(n * k);
+      auto host_c = std::vector<T>(m * n);
+      PopulateVector(host_a, mt, dist);
+      PopulateVector(host_b, mt, dist);
+      PopulateVector(host_c, mt, dist);
+      auto device_a = Buffer<T>(context, host_a.size());
+      auto device_b = Buffer<T>(context, host_b.size());
+      auto device_c_reference = Buffer<T>(context, host_c.size());
+      auto device_c_chunked = Buffer<T>(context, host_c.size());
+      device_a.Write(queue, host_a.size(), host_a);
+      device_b.Write(queue, host_b.size(), host_b);
+      device_c_reference.Write(queue, host_c.size(), host_c);
+      device_c_chunked.Write(queue, host_c.size(), host_c);
+      queue.Finish();
+
+      // Runs GEMM at once on the high priority queue and in chunks on the low priority one
+      SetGemmChunkLimit(0);
+      const auto num_kernels_reference = RunGemmCountingKernels(layout, m, n, k,
+                                                                device_a, a_ld, device_b, b_ld,
+                                                                device_c_reference, c_ld, high_queue);
+      SetGemmChunkLimit(chunk_limit);
+      const auto num_kernels_chunked = RunGemmCountingKernels(layout, m, n, k,
+                                                              device_a, a_ld, device_b, b_ld,
+                                                              device_c_chunked, c_ld, low_queue);
+      SetGemmChunkLimit(0);
+      clFinish(high_queue);
+      clFinish(low_queue);
+      if (num_kernels_reference == 0 || num_kernels_chunked <= num_kernels_reference) {
+        errors++;
+        continue;
+      }
+
+      // Compares the results, allowing for small differences between the kernel variants
+      auto result_reference = std::vector<T>(host_c.size());
+      auto result_chunked = std::vector<T>(host_c.size());
+      device_c_reference.Read(queue, result_reference.size(), result_reference);
+      device_c_chunked.Read(queue, result_chunked.size(), result_chunked);
+      auto matches = true;
+      for (auto i = size_t{0}; i < result_chunked.size(); ++i) {
+        if (std::abs(result_reference[i] - result_chunked[i]) > 1e-3 * std::abs(result_reference[i]) + 1e-3) {
+          matches = false;
+        }
+      }
+      if (matches) { passed++; } else { errors++; }
+    }
+  }
+  clReleaseCommandQueue(high_queue);
+  clReleaseCommandQueue(low_queue);
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunQueuePriorityTests<float>(argc, argv, false, "SGEMM");
+  errors += clblast::RunQueuePriorityTests<double>(argc, argv, true, "DGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,196 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the row-wise and column-wise matrix reductions: the results are
+// compared against a host reference for tall, wide and square matrices (covering both kernels and
+// the split into chunks), for both layouts, and for a single matrix as well as a strided batch.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Host versions of the real value (the maximum is only tested for real data-types), the absolute
+// value and the squared absolute value as used by the reductions
+template <typename T> double ReduceReal(const T value) { return static_cast<double>(value); }
+template <> double ReduceReal(const float2 value) { return static_cast<double>(value.real()); }
+template <typename T> double ReduceAbs(const T value) { return std::abs(ReduceReal(value)); }
+template <> double ReduceAbs(const float2 value) {
+  return std::abs(static_cast<double>(value.real())) + std::abs(static_cast<double>(value.imag()));
+}
+template <typename T> double ReduceSquare(const T value) {
+  return ReduceReal(value) * ReduceReal(value);
+}
+template <> double ReduceSquare(const float2 value) { return std::norm(value); }
+
+// Computes a single reduction on the host. The results of the reductions other than the sum are
+// real-valued, also for complex data-types.
+template <typename T>
+T ReduceReference(const ReduceOp operation, const std::vector<T> &values) {
+  auto sum = T{0};
+  auto result = 0.0;
+  if (operation == ReduceOp::kMax) { result = -1.0e30; }
+  for (const auto &value : values) {
+    switch (operation) {
+      case ReduceOp::kSum: sum += value; break;
+      case ReduceOp::kAbsSum: result += ReduceAbs(value); break;
+      case ReduceOp::kMax: result = std::max(result, ReduceReal(value)); break;
+      case ReduceOp::kAbsMax: result = std::max(result, ReduceAbs(value)); break;
+      case ReduceOp::kNrm2: result += ReduceSquare(value); break;
+    }
+  }
+  if (operation == ReduceOp::kSum) { return sum; }
+  if (operation == ReduceOp::kNrm2) { result = std::sqrt(result); }
+  return static_cast<T>(result);
+}
+
+template <typename T>
+size_t RunReduceTests(int argc, char *argv[], const bool silent, const std::string &routine_name,
+                      const std::vector<ReduceOp> &operations) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Determines the test settings
+  const auto shapes = std::vector<std::pair<size_t,size_t>>{{5, 3000}, {3000, 5}, {65, 67}};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto batch_counts = std::vector<size_t>{1, 3};
+  const auto padding = size_t{2};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  fprintf(stdout, "* Testing the matrix reductions for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &shape : shapes) {
+    for (const auto layout : layouts) {
+      for (const auto batch_count : batch_counts) {
+        const auto m = shape.first;
+        const auto n = shape.second;
+        const auto a_one = (layout == Layout::kColMajor) ? m : n;
+        const auto a_two = (layout == Layout::kColMajor) ? n : m;
+        const auto a_ld = a_one + padding;
+        const auto a_stride = a_ld * a_two;
+
+        // Populates the matrices with some example data
+        auto host_a = std::vector<T>(a_stride * batch_count);
+        PopulateVector(host_a, mt, dist);
+        auto device_a = Buffer<T>(context, host_a.size());
+        device_a.Write(queue, host_a.size(), host_a);
+        const auto value_at = [&](const size_t batch, const size_t row, const size_t col) {
+          const auto index = (layout == Layout::kColMajor) ? col * a_ld + row : row * a_ld + col;
+          return host_a[batch * a_stride + index];
+        };
+
+        for (const auto operation : operations) {
+          for (const auto rows : {true, false}) {
+            const auto n_out = (rows) ? m : n;
+            const auto y_inc = size_t{2};
+            const auto y_stride = n_out * y_inc + 1;
+            const auto y_size = y_stride * batch_count;
+            auto device_y = Buffer<T>(context, y_size);
+
+            // Runs the routine
+            auto status = StatusCode::kSuccess;
+            if (batch_count == 1 && rows) {
+              status = ReduceRows<T>(operation, layout, m, n, device_a(), 0, a_ld,
+                                     device_y(), 0, y_inc, &queue_plain);
+            }
+            else if (batch_count == 1) {
+              status = ReduceCols<T>(operation, layout, m, n, device_a(), 0, a_ld,
+                                     device_y(), 0, y_inc, &queue_plain);
+            }
+            else if (rows) {
+              status = ReduceRowsStridedBatched<T>(operation, layout, m, n,
+                                                   device_a(), 0, a_ld, a_stride,
+                                                   device_y(), 0, y_inc, y_stride,
+                                                   batch_count, &queue_plain);
+            }
+            else {
+              status = ReduceColsStridedBatched<T>(operation, layout, m, n,
+                                                   device_a(), 0, a_ld, a_stride,
+                                                   device_y(), 0, y_inc, y_stride,
+                                                   batch_count, &queue_plain);
+            }
+            if (status != StatusCode::kSuccess) { errors++; continue; }
+
+            // Compares the results with the host reference
+            auto host_y = std::vector<T>(y_size);
+            device_y.Read(queue, y_size, host_y);
+            auto matches = true;
+            for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+              for (auto index = size_t{0}; index < n_out; ++index) {
+                auto values = std::vector<T>();
+                const auto n_reduce = (rows) ? n : m;
+                for (auto id = size_t{0}; id < n_reduce; ++id) {
+                  values.push_back((rows) ? value_at(batch, index, id) : value_at(batch, id, index));
+                }
+                const auto reference = ReduceReference(operation, values);
+                const auto result = host_y[batch * y_stride + index * y_inc];
+                const auto difference = std::abs(reference - result);
+                if (difference > 1e-3 * std::abs(reference) + 1e-3) { matches = false; }
+              }
+            }
+            if (matches) { passed++; } else { errors++; }
+          }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  using clblast::ReduceOp;
+  const auto all_operations = std::vector<ReduceOp>{ReduceOp::kSum, ReduceOp::kAbsSum,
+                                                    ReduceOp::kMax, ReduceOp::kAbsMax,
+                                                    ReduceOp::kNrm2};
+  const auto complex_operations = std::vector<ReduceOp>{ReduceOp::kSum, ReduceOp::kAbsSum,
+                                                        ReduceOp::kAbsMax, ReduceOp::kNrm2};
+  auto errors = size_t{0};
+  errors += clblast::RunReduceTests<float>(argc, argv, false, "SREDUCE", all_operations);
+  errors += clblast::RunReduceTests<double>(argc, argv, true, "DREDUCE", all_operations);
+  errors += clblast::RunReduceTests<clblast::float2>(argc, argv, true, "CREDUCE", complex_operations);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,133 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the slow-call log: with a tiny threshold every GEMM call should
+// be reported with its shape and kernels, with a threshold of zero none should be.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Collects the reported calls, the callback can be called from any thread
+struct SlowCallLog {
+  std::mutex mutex;
+  std::vector<std::string> routines;
+  std::vector<std::string> shapes;
+  std::vector<std::string> kernels;
+};
+
+void CollectSlowCall(const SlowCall &call, void* user_data) {
+  auto log = static_cast<SlowCallLog*>(user_data);
+  std::lock_guard<std::mutex> lock(log->mutex);
+  log->routines.push_back(call.routine_name);
+  log->shapes.push_back(call.shape);
+  log->kernels.push_back(call.kernels);
+}
+
+size_t RunSlowCallTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  const auto n = size_t{64};
+  auto host = std::vector<float>(n * n, 1.0f);
+  auto a = Buffer<float>(context, n * n);
+  auto b = Buffer<float>(context, n * n);
+  auto c = Buffer<float>(context, n * n);
+  a.Write(queue, host.size(), host);
+  b.Write(queue, host.size(), host);
+  c.Write(queue, host.size(), host);
+  const auto run_gemm = [&]() {
+    const auto status = Gemm<float>(Layout::kColMajor, Transpose::kNo, Transpose::kNo, n, n, n,
+                                    1.0f, a(), 0, n, b(), 0, n, 0.0f, c(), 0, n, &queue_plain);
+    queue.Finish();
+    return status;
+  };
+
+  // A negative threshold is invalid
+  fprintf(stdout, "* Testing the slow-call log's arguments\n");
+  if (SetSlowCallThreshold(-1.0) == StatusCode::kInvalidValue) { passed++; } else { errors++; }
+
+  // With a tiny threshold the calls are reported once their kernels have completed, which can be
+  // slightly after 'Finish' returns as the report is made from an event callback
+  fprintf(stdout, "* Testing GEMM calls above the threshold\n");
+  auto log = SlowCallLog{};
+  if (SetSlowCallThreshold(1e-6, CollectSlowCall, &log) != StatusCode::kSuccess) { errors++; }
+  if (run_gemm() != StatusCode::kSuccess) { errors++; }
+  if (run_gemm() != StatusCode::kSuccess) { errors++; }
+  for (auto attempt = 0; attempt < 100; ++attempt) {
+    {
+      std::lock_guard<std::mutex> lock(log.mutex);
+      if (log.routines.size() >= 2) { break; }
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  {
+    std::lock_guard<std::mutex> lock(log.mutex);
+    if (log.routines.size() == 2) { passed++; } else { errors++; }
+    for (auto i = size_t{0}; i < log.routines.size(); ++i) {
+      if (log.routines[i] == "GEMM") { passed++; } else { errors++; }
+      if (log.shapes[i].find("m=64") != std::string::npos) { passed++; } else { errors++; }
+      if (!log.kernels[i].empty()) { passed++; } else { errors++; }
+    }
+  }
+
+  // With a threshold of zero nothing is reported
+  fprintf(stdout, "* Testing GEMM calls with the log disabled\n");
+  if (SetSlowCallThreshold(0.0) != StatusCode::kSuccess) { errors++; }
+  const auto num_reported = log.routines.size();
+  if (run_gemm() != StatusCode::kSuccess) { errors++; }
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  {
+    std::lock_guard<std::mutex> lock(log.mutex);
+    if (log.routines.size() == num_reported) { passed++; } else { errors++; }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunSlowCallTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
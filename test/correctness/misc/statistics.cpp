@@ -0,0 +1,104 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the statistics API (see 'GetStatistics'): the counters should
+// reflect the routine calls made, the phases should add up to at most the host time, and all
+// counters should be zero after a reset.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+size_t RunStatisticsTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+  fprintf(stdout, "* Testing the statistics of routine calls\n");
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  // Populates the device data
+  const auto n = size_t{64};
+  const auto host_data = std::vector<float>(n * n, 1.0f);
+  auto a = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto b = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto c = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  queue.Finish();
+
+  // Runs GEMM twice after a reset of the counters
+  auto statistics = Statistics{};
+  auto status = ResetStatistics();
+  for (auto i = size_t{0}; i < 2 && status == StatusCode::kSuccess; ++i) {
+    status = Gemm(Layout::kRowMajor, Transpose::kNo, Transpose::kNo, n, n, n, 1.0f,
+                  a(), 0, n, b(), 0, n, 0.0f, c(), 0, n, &queue_plain);
+  }
+  queue.Finish();
+  status = (status != StatusCode::kSuccess) ? status : GetStatistics(statistics);
+  if (status != StatusCode::kSuccess) {
+    fprintf(stdout, "* Statistics failed with status %d\n", static_cast<int>(status));
+    errors++;
+  }
+  else {
+    const auto gemm = statistics.routines.find("GEMM");
+    const auto gemm_valid = (gemm != statistics.routines.end() && gemm->second.num_calls == 2 &&
+                             gemm->second.num_kernels >= 2 && gemm->second.host_time_ms > 0.0);
+    if (gemm_valid) { passed++; } else { errors++; }
+    const auto phases_valid = (gemm != statistics.routines.end() &&
+                               gemm->second.setup_time_ms > 0.0 && gemm->second.launch_time_ms > 0.0 &&
+                               gemm->second.setup_time_ms + gemm->second.kernel_time_ms +
+                               gemm->second.launch_time_ms <= gemm->second.host_time_ms);
+    if (phases_valid) { passed++; } else { errors++; }
+    const auto num_lookups = statistics.program_cache_hits + statistics.program_cache_misses;
+    if (num_lookups >= 2 && statistics.program_cache_hits >= 1) { passed++; } else { errors++; }
+  }
+
+  // Tests the reset of the counters
+  status = ResetStatistics();
+  status = (status != StatusCode::kSuccess) ? status : GetStatistics(statistics);
+  const auto is_reset = (status == StatusCode::kSuccess && statistics.routines.empty() &&
+                         statistics.program_cache_hits == 0 && statistics.num_compilations == 0 &&
+                         statistics.num_buffer_allocations == 0);
+  if (is_reset) { passed++; } else { errors++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunStatisticsTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
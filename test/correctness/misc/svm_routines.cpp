@@ -0,0 +1,174 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the variants of the routines on SVM pointers (e.g. GemmSVM): the
+// results should match those of the regular routines on buffers. The tests are skipped in case the
+// device (or the OpenCL headers) do not support SVM.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+#if defined(CL_VERSION_2_0)
+
+// Helpers to copy between host vectors and coarse-grained SVM memory
+template <typename T>
+T* CreateSVM(const Context &context, const Queue &queue, const std::vector<T> &host) {
+  auto pointer = static_cast<T*>(clSVMAlloc(context(), CL_MEM_READ_WRITE, host.size() * sizeof(T), 0));
+  if (pointer != nullptr) {
+    CheckError(clEnqueueSVMMemcpy(queue(), CL_TRUE, pointer, host.data(), host.size() * sizeof(T),
+                                  0, nullptr, nullptr));
+  }
+  return pointer;
+}
+template <typename T>
+std::vector<T> ReadSVM(const Queue &queue, const T* pointer, const size_t size) {
+  auto host = std::vector<T>(size);
+  CheckError(clEnqueueSVMMemcpy(queue(), CL_TRUE, host.data(), pointer, size * sizeof(T),
+                                0, nullptr, nullptr));
+  return host;
+}
+
+// Compares two vectors with a relative margin
+bool MatchesSVM(const std::vector<float> &reference, const std::vector<float> &result) {
+  if (reference.size() != result.size()) { return false; }
+  for (auto i = size_t{0}; i < reference.size(); ++i) {
+    if (std::abs(reference[i] - result[i]) > 1e-3 * std::abs(reference[i]) + 1e-3) { return false; }
+  }
+  return true;
+}
+
+#endif
+
+size_t RunSVMRoutinesTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  #if defined(CL_VERSION_2_0)
+    constexpr auto kSeed = 42; // fixed seed for reproducibility
+    const auto platform = Platform(platform_id);
+    const auto device = Device(platform, device_id);
+    const auto context = Context(device);
+    auto queue = Queue(context, device);
+    auto queue_plain = queue();
+    fprintf(stdout, "* Testing the routines on SVM pointers\n");
+
+    // Populates the host data
+    const auto m = size_t{37};
+    const auto n = size_t{64};
+    const auto k = size_t{19};
+    std::mt19937 mt(kSeed);
+    std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+    auto host_a = std::vector<float>(m * k);
+    auto host_b = std::vector<float>(k * n);
+    auto host_c = std::vector<float>(m * n);
+    auto host_x = std::vector<float>(n * 2);
+    auto host_y = std::vector<float>(n);
+    PopulateVector(host_a, mt, dist);
+    PopulateVector(host_b, mt, dist);
+    PopulateVector(host_c, mt, dist);
+    PopulateVector(host_x, mt, dist);
+    PopulateVector(host_y, mt, dist);
+    auto svm_a = CreateSVM(context, queue, host_a);
+    auto svm_b = CreateSVM(context, queue, host_b);
+    auto svm_c = CreateSVM(context, queue, host_c);
+    auto svm_x = CreateSVM(context, queue, host_x);
+    auto svm_y = CreateSVM(context, queue, host_y);
+    auto svm_dot = CreateSVM(context, queue, std::vector<float>(1));
+    if (svm_a == nullptr || svm_b == nullptr || svm_c == nullptr || svm_x == nullptr ||
+        svm_y == nullptr || svm_dot == nullptr) {
+      fprintf(stdout, "* SVM is not supported by this device, skipping the tests\n\n");
+      for (auto pointer : {svm_a, svm_b, svm_c, svm_x, svm_y, svm_dot}) {
+        if (pointer != nullptr) { clSVMFree(context(), pointer); }
+      }
+      return 0;
+    }
+
+    // The references, using the regular routines on buffers
+    auto device_a = Buffer<float>(context, queue, host_a.begin(), host_a.end());
+    auto device_b = Buffer<float>(context, queue, host_b.begin(), host_b.end());
+    auto device_c = Buffer<float>(context, queue, host_c.begin(), host_c.end());
+    auto device_x = Buffer<float>(context, queue, host_x.begin(), host_x.end());
+    auto device_y = Buffer<float>(context, queue, host_y.begin(), host_y.end());
+    auto device_dot = Buffer<float>(context, 1);
+    auto status = Gemm(Layout::kRowMajor, Transpose::kNo, Transpose::kYes, m, n, k, 1.5f,
+                       device_a(), 0, k, device_b(), 0, k, 0.5f, device_c(), 0, n, &queue_plain);
+    status = (status != StatusCode::kSuccess) ? status :
+             Axpy(n, 2.0f, device_x(), 0, 2, device_y(), 0, 1, &queue_plain);
+    status = (status != StatusCode::kSuccess) ? status :
+             Dot<float>(n, device_dot(), 0, device_x(), 0, 2, device_y(), 0, 1, &queue_plain);
+    auto reference_c = std::vector<float>(host_c.size());
+    auto reference_y = std::vector<float>(host_y.size());
+    auto reference_dot = std::vector<float>(1);
+    device_c.Read(queue, reference_c.size(), reference_c);
+    device_y.Read(queue, reference_y.size(), reference_y);
+    device_dot.Read(queue, reference_dot.size(), reference_dot);
+
+    // The same routines on the SVM pointers
+    if (status == StatusCode::kSuccess) {
+      status = GemmSVM(Layout::kRowMajor, Transpose::kNo, Transpose::kYes, m, n, k, 1.5f,
+                       svm_a, k, svm_b, k, 0.5f, svm_c, n, &queue_plain);
+    }
+    if (status == StatusCode::kSuccess) {
+      status = AxpySVM(n, 2.0f, svm_x, 2, svm_y, 1, &queue_plain);
+    }
+    if (status == StatusCode::kSuccess) {
+      status = DotSVM(n, svm_dot, svm_x, 2, svm_y, 1, &queue_plain);
+    }
+    if (status == StatusCode::kSuccess) {
+      queue.Finish();
+      if (MatchesSVM(reference_c, ReadSVM(queue, svm_c, host_c.size()))) { passed++; } else { errors++; }
+      if (MatchesSVM(reference_y, ReadSVM(queue, svm_y, host_y.size()))) { passed++; } else { errors++; }
+      if (MatchesSVM(reference_dot, ReadSVM(queue, svm_dot, 1))) { passed++; } else { errors++; }
+    }
+    else {
+      errors++;
+    }
+    for (auto pointer : {svm_a, svm_b, svm_c, svm_x, svm_y, svm_dot}) {
+      clSVMFree(context(), pointer);
+    }
+  #else
+    fprintf(stdout, "* SVM is not supported by the OpenCL headers, skipping the tests\n\n");
+    static_cast<void>(platform_id);
+    static_cast<void>(device_id);
+  #endif
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunSVMRoutinesTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
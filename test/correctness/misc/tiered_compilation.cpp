@@ -0,0 +1,132 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for tiered compilation: starting from an empty cache, the results of
+// repeated GEMM calls (first with the generic parameters, later with the tuned ones once these are
+// built in the background) should match those of a GEMM call without tiered compilation.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <thread>
+#include <chrono>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunTieredCompilationTests(int argc, char *argv[], const bool silent,
+                                 const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+
+  // Determines the test settings: the number of calls in tiered mode and the time between them
+  const auto shapes = std::vector<std::vector<size_t>>{{64, 64, 64}, {300, 200, 150}};
+  const auto num_calls = size_t{4};
+  const auto pause = std::chrono::milliseconds(500);
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing tiered compilation for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto &shape : shapes) {
+    const auto m = shape[0];
+    const auto n = shape[1];
+    const auto k = shape[2];
+
+    // Populates the host matrices with some example data
+    auto host_a = std::vector<T>(m * k);
+    auto host_b = std::vector<T>(n * k);
+    auto host_c = std::vector<T>(m * n);
+    PopulateVector(host_a, mt, dist);
+    PopulateVector(host_b, mt, dist);
+    PopulateVector(host_c, mt, dist);
+    auto device_a = Buffer<T>(context, host_a.size());
+    auto device_b = Buffer<T>(context, host_b.size());
+    auto device_c = Buffer<T>(context, host_c.size());
+    device_a.Write(queue, host_a.size(), host_a);
+    device_b.Write(queue, host_b.size(), host_b);
+
+    // Computes the reference result without tiered compilation
+    auto queue_plain = queue();
+    SetTieredCompilation(false);
+    device_c.Write(queue, host_c.size(), host_c);
+    auto status = Gemm(Layout::kColMajor, Transpose::kNo, Transpose::kNo, m, n, k, alpha,
+                       device_a(), 0, m, device_b(), 0, k, beta, device_c(), 0, m, &queue_plain);
+    if (status != StatusCode::kSuccess) { errors++; continue; }
+    auto result_reference = std::vector<T>(host_c.size());
+    device_c.Read(queue, result_reference.size(), result_reference);
+
+    // Repeats the computation in tiered mode, starting from an empty cache
+    ClearCache();
+    SetTieredCompilation(true);
+    for (auto call = size_t{0}; call < num_calls; ++call) {
+      device_c.Write(queue, host_c.size(), host_c);
+      status = Gemm(Layout::kColMajor, Transpose::kNo, Transpose::kNo, m, n, k, alpha,
+                    device_a(), 0, m, device_b(), 0, k, beta, device_c(), 0, m, &queue_plain);
+      if (status != StatusCode::kSuccess) { errors++; continue; }
+
+      // Compares the results, allowing for small differences between the parameters
+      auto result = std::vector<T>(host_c.size());
+      device_c.Read(queue, result.size(), result);
+      auto matches = true;
+      for (auto i = size_t{0}; i < result.size(); ++i) {
+        if (std::abs(result_reference[i] - result[i]) > 1e-3 * std::abs(result_reference[i]) + 1e-3) {
+          matches = false;
+        }
+      }
+      if (matches) { passed++; } else { errors++; }
+      std::this_thread::sleep_for(pause);
+    }
+    SetTieredCompilation(false);
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTieredCompilationTests<float>(argc, argv, false, "SGEMM");
+  errors += clblast::RunTieredCompilationTests<double>(argc, argv, true, "DGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
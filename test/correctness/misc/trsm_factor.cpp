@@ -0,0 +1,139 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the TRSM factor API: solving multiple right-hand sides with a
+// single factor should give the same results as calling the regular TRSM routine for each.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <complex>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunTrsmFactorTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  constexpr auto kNumSolves = 3; // a factor is solved with multiple right-hand sides
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto alpha = GetScalar<T>();
+
+  // Determines the test settings: a single diagonal block and multiple (partial) ones
+  const auto sizes = std::vector<size_t>{7, 64, 130};
+  const auto layouts = std::vector<Layout>{Layout::kColMajor, Layout::kRowMajor};
+  const auto sides = std::vector<Side>{Side::kLeft, Side::kRight};
+  const auto triangles = std::vector<Triangle>{Triangle::kUpper, Triangle::kLower};
+  const auto transposes = std::vector<Transpose>{Transpose::kNo, Transpose::kYes};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing the TRSM factor API for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (const auto k : sizes) {
+    for (const auto layout : layouts) {
+      for (const auto side : sides) {
+        for (const auto triangle : triangles) {
+          for (const auto a_transpose : transposes) {
+            const auto num_rhs = size_t{33};
+            const auto m = (side == Side::kLeft) ? k : num_rhs;
+            const auto n = (side == Side::kLeft) ? num_rhs : k;
+            const auto b_ld = (layout == Layout::kColMajor) ? m : n;
+
+            // Populates matrix A with a dominant diagonal, such that the systems are well-posed
+            auto host_a = std::vector<T>(k * k);
+            PopulateVector(host_a, mt, dist);
+            for (auto i = size_t{0}; i < k; ++i) {
+              host_a[i * k + i] += static_cast<T>(static_cast<double>(k));
+            }
+            auto device_a = Buffer<T>(context, host_a.size());
+            device_a.Write(queue, host_a.size(), host_a);
+
+            // Creates the factor once and solves multiple right-hand sides, each also with TRSM
+            auto queue_plain = queue();
+            auto factor = static_cast<TrsmFactor<T>*>(nullptr);
+            auto status = TrsmFactorCreate<T>(layout, side, triangle, a_transpose,
+                                              Diagonal::kNonUnit, k, device_a(), 0, k,
+                                              &queue_plain, &factor);
+            if (status != StatusCode::kSuccess) { errors++; continue; }
+            auto matches = true;
+            for (auto i = 0; i < kNumSolves && status == StatusCode::kSuccess; ++i) {
+              auto host_b = std::vector<T>(m * n);
+              PopulateVector(host_b, mt, dist);
+              auto device_b_reference = Buffer<T>(context, host_b.size());
+              auto device_b_factor = Buffer<T>(context, host_b.size());
+              device_b_reference.Write(queue, host_b.size(), host_b);
+              device_b_factor.Write(queue, host_b.size(), host_b);
+              status = Trsm(layout, side, triangle, a_transpose, Diagonal::kNonUnit, m, n, alpha,
+                            device_a(), 0, k, device_b_reference(), 0, b_ld, &queue_plain);
+              if (status != StatusCode::kSuccess) { break; }
+              status = TrsmFactorSolve(factor, m, n, alpha, device_b_factor(), 0, b_ld,
+                                       &queue_plain);
+              if (status != StatusCode::kSuccess) { break; }
+
+              // Compares the results
+              auto result_reference = std::vector<T>(host_b.size());
+              auto result_factor = std::vector<T>(host_b.size());
+              device_b_reference.Read(queue, result_reference.size(), result_reference);
+              device_b_factor.Read(queue, result_factor.size(), result_factor);
+              for (auto j = size_t{0}; j < result_factor.size(); ++j) {
+                if (std::abs(result_reference[j] - result_factor[j]) >
+                    1e-3 * std::abs(result_reference[j]) + 1e-4) {
+                  matches = false;
+                }
+              }
+            }
+            TrsmFactorDestroy(factor);
+            if (status == StatusCode::kSuccess && matches) { passed++; } else { errors++; }
+          }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTrsmFactorTests<float>(argc, argv, false, "STRSM");
+  errors += clblast::RunTrsmFactorTests<clblast::float2>(argc, argv, true, "CTRSM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
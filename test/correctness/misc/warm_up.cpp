@@ -0,0 +1,121 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the profile-guided warm-up (see 'SetWarmUpDirectory'): a kernel
+// built in a first 'run' is recorded, and built in the background when the warm-up is enabled
+// again, such that a later call doesn't compile it.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <cstdio>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The manifest of the device in the given directory, named as in 'warm_up.cpp'
+std::string WarmUpFileName(const std::string &directory, const Device &device) {
+  const auto platform = Platform(device.PlatformID());
+  const auto key = platform.Name() + ";" + GetDeviceName(device) + ";" + device.DriverVersion();
+  std::ostringstream file_name;
+  file_name << directory << "/" << std::hex << std::setw(16) << std::setfill('0') << Hash(key)
+            << ".clbwarmup";
+  return file_name.str();
+}
+
+size_t RunWarmUpTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  fprintf(stdout, "\n* %s\n", help.c_str());
+  fprintf(stdout, "* Testing the profile-guided warm-up for 'AXPY'\n");
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  // Populates the device data
+  const auto n = size_t{1024};
+  const auto host_data = std::vector<float>(n, 1.0f);
+  auto x = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto y = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  queue.Finish();
+  const auto run_axpy = [&]() {
+    const auto status = Axpy(n, 2.0f, x(), 0, 1, y(), 0, 1, &queue_plain);
+    queue.Finish();
+    return status;
+  };
+
+  // Records the kernel in a fresh manifest
+  const auto directory = std::string{"."};
+  const auto file_name = WarmUpFileName(directory, device);
+  std::remove(file_name.c_str());
+  auto status = ClearCache();
+  status = (status != StatusCode::kSuccess) ? status : SetWarmUpDirectory(directory);
+  status = (status != StatusCode::kSuccess) ? status : run_axpy();
+  status = (status != StatusCode::kSuccess) ? status : SetWarmUpDirectory("");
+  if (status == StatusCode::kSuccess) { passed++; } else { errors++; }
+  if (std::ifstream(file_name).good()) { passed++; } else { errors++; }
+
+  // Starts the warm-up from an empty cache and waits until the kernel is built in the background
+  status = ClearCache();
+  status = (status != StatusCode::kSuccess) ? status : ResetStatistics();
+  status = (status != StatusCode::kSuccess) ? status : SetWarmUpDirectory(directory);
+  auto statistics = Statistics{};
+  for (auto attempt = 0; attempt < 600 && status == StatusCode::kSuccess; ++attempt) {
+    status = GetStatistics(statistics);
+    if (statistics.num_compilations + statistics.num_binary_loads > 0) { break; }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  if (status == StatusCode::kSuccess &&
+      statistics.num_compilations + statistics.num_binary_loads > 0) { passed++; } else { errors++; }
+
+  // The routine call itself should find the kernel in the binary cache
+  status = (status != StatusCode::kSuccess) ? status : ResetStatistics();
+  status = (status != StatusCode::kSuccess) ? status : run_axpy();
+  status = (status != StatusCode::kSuccess) ? status : GetStatistics(statistics);
+  if (status == StatusCode::kSuccess && statistics.num_compilations == 0) { passed++; } else { errors++; }
+  if (SetWarmUpDirectory("") == StatusCode::kSuccess) { passed++; } else { errors++; }
+  std::remove(file_name.c_str());
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunWarmUpTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,180 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the routines called with a zero alpha, which only scale their
+// output by beta: matrices A and B (or vector x) are filled with NaNs, since they should not be
+// read at all. For SYRK, the triangle which is not referenced should be left untouched.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Compares a result against its reference, printing the name of the test in case of an error
+template <typename T>
+bool ZeroAlphaMatches(const std::vector<T> &result, const std::vector<T> &reference,
+                      const std::string &name) {
+  for (auto i = size_t{0}; i < result.size(); ++i) {
+    if (std::abs(reference[i] - result[i]) > 1e-5 * std::abs(reference[i]) + 1e-5) {
+      fprintf(stdout, "    Error in '%s' at index %zu\n", name.c_str(), i);
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+size_t RunZeroAlphaTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto m = GetArgument(arguments, help, kArgM, size_t{67});
+  const auto n = GetArgument(arguments, help, kArgN, size_t{45});
+  const auto k = GetArgument(arguments, help, kArgK, size_t{33});
+  const auto batch_count = size_t{3};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+
+  // The inputs which should not be read are NaNs, which would otherwise propagate into the result.
+  // A beta of zero sets the output to zero, also if it holds NaNs (except for GEMV, see 'Xscal').
+  const auto nan = std::numeric_limits<double>::quiet_NaN();
+  const auto betas = std::vector<double>{0.0, 1.0, 2.5};
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+
+  fprintf(stdout, "* Testing the routines with a zero alpha for '%s'\n", routine_name.c_str());
+  auto device_a = Buffer<T>(context, batch_count * k * std::max(m, n));
+  auto device_b = Buffer<T>(context, batch_count * k * n);
+  auto host_nan = std::vector<T>(batch_count * k * std::max(m, n), static_cast<T>(nan));
+  device_a.Write(queue, host_nan.size(), host_nan);
+  device_b.Write(queue, batch_count * k * n, host_nan);
+  for (const auto beta_value : betas) {
+    const auto alpha = ConstantZero<T>();
+    const auto beta = static_cast<T>(beta_value);
+
+    // GEMM in both layouts, with the batches of the strided-batched version stored one after the
+    // other in matrix C
+    for (const auto layout : {Layout::kColMajor, Layout::kRowMajor}) {
+      const auto c_ld = (layout == Layout::kColMajor) ? m : n;
+      const auto a_ld = (layout == Layout::kColMajor) ? m : k;
+      const auto b_ld = (layout == Layout::kColMajor) ? k : n;
+      auto host_c = std::vector<T>(batch_count * m * n);
+      PopulateVector(host_c, mt, dist);
+      auto reference = host_c;
+      for (auto &value : reference) {
+        value = (beta_value == 0.0) ? ConstantZero<T>() : beta * value;
+      }
+      auto device_c = Buffer<T>(context, host_c.size());
+      device_c.Write(queue, host_c.size(), host_c);
+      const auto status = GemmStridedBatched(layout, Transpose::kNo, Transpose::kNo, m, n, k, alpha,
+                                             device_a(), 0, a_ld, m * k, device_b(), 0, b_ld, k * n,
+                                             beta, device_c(), 0, c_ld, m * n, batch_count,
+                                             &queue_plain);
+      auto result = std::vector<T>(host_c.size());
+      device_c.Read(queue, result.size(), result);
+      const auto batched_matches = ZeroAlphaMatches(result, reference, "GEMMSTRIDEDBATCHED");
+      if (status == StatusCode::kSuccess && batched_matches) { passed++; } else { errors++; }
+
+      // The regular GEMM on the first batch only
+      device_c.Write(queue, host_c.size(), host_c);
+      const auto status_gemm = Gemm(layout, Transpose::kNo, Transpose::kNo, m, n, k, alpha,
+                                    device_a(), 0, a_ld, device_b(), 0, b_ld,
+                                    beta, device_c(), 0, c_ld, &queue_plain);
+      for (auto i = m * n; i < reference.size(); ++i) { reference[i] = host_c[i]; }
+      device_c.Read(queue, result.size(), result);
+      if (status_gemm == StatusCode::kSuccess && ZeroAlphaMatches(result, reference, "GEMM")) {
+        passed++;
+      } else { errors++; }
+    }
+
+    // SYRK on the upper triangle of a column-major matrix C: the lower triangle is untouched
+    {
+      auto host_c = std::vector<T>(n * n);
+      PopulateVector(host_c, mt, dist);
+      auto reference = host_c;
+      for (auto j = size_t{0}; j < n; ++j) {
+        for (auto i = size_t{0}; i <= j; ++i) {
+          reference[j * n + i] = (beta_value == 0.0) ? ConstantZero<T>() : beta * host_c[j * n + i];
+        }
+      }
+      auto device_c = Buffer<T>(context, host_c.size());
+      device_c.Write(queue, host_c.size(), host_c);
+      const auto status = Syrk(Layout::kColMajor, Triangle::kUpper, Transpose::kNo, n, k, alpha,
+                               device_a(), 0, n, beta, device_c(), 0, n, &queue_plain);
+      auto result = std::vector<T>(host_c.size());
+      device_c.Read(queue, result.size(), result);
+      if (status == StatusCode::kSuccess && ZeroAlphaMatches(result, reference, "SYRK")) {
+        passed++;
+      } else { errors++; }
+    }
+
+    // GEMV with a strided vector y
+    {
+      const auto y_inc = size_t{2};
+      auto host_y = std::vector<T>(m * y_inc);
+      PopulateVector(host_y, mt, dist);
+      auto reference = host_y;
+      for (auto i = size_t{0}; i < m; ++i) { reference[i * y_inc] = beta * host_y[i * y_inc]; }
+      auto device_y = Buffer<T>(context, host_y.size());
+      device_y.Write(queue, host_y.size(), host_y);
+      const auto status = Gemv(Layout::kColMajor, Transpose::kNo, m, n, alpha,
+                               device_a(), 0, m, device_b(), 0, 1, beta,
+                               device_y(), 0, y_inc, &queue_plain);
+      auto result = std::vector<T>(host_y.size());
+      device_y.Read(queue, result.size(), result);
+      if (status == StatusCode::kSuccess && ZeroAlphaMatches(result, reference, "GEMV")) {
+        passed++;
+      } else { errors++; }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunZeroAlphaTests<float>(argc, argv, false, "SGEMM/SGEMV/SSYRK");
+  errors += clblast::RunZeroAlphaTests<clblast::float2>(argc, argv, true, "CGEMM/CGEMV/CSYRK");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -240,6 +240,7 @@ size_t RunTests(int argc, char *argv[], const bool silent, const std::string &na
   auto stride_ws = std::vector<size_t>{args.stride_w};
   auto dilation_hs = std::vector<size_t>{args.dilation_h};
   auto dilation_ws = std::vector<size_t>{args.dilation_w};
+  auto num_kernelss = std::vector<size_t>{args.num_kernels};
   auto batch_counts = std::vector<size_t>{args.batch_count};
   auto x_sizes = std::vector<size_t>{args.x_size};
   auto y_sizes = std::vector<size_t>{args.y_size};
@@ -295,6 +296,7 @@ size_t RunTests(int argc, char *argv[], const bool silent, const std::string &na
     if (option == kArgStrideW) { stride_ws = tester.kKernelSizes; }
     if (option == kArgDilationH) { dilation_hs = tester.kDilationSizes; }
     if (option == kArgDilationW) { dilation_ws = tester.kDilationSizes; }
+    if (option == kArgNumKernels) { num_kernelss = tester.kKernelSizes; }
     if (option == kArgBatchCount) { batch_counts = tester.kBatchCounts; }
 
     if (option == kArgXOffset) { x_sizes = tester.kVecSizes; }
@@ -349,9 +351,11 @@ size_t RunTests(int argc, char *argv[], const bool silent, const std::string &na
                                                                           for (auto &stride_w: stride_ws) { r_args.stride_w = stride_w;
                                                                             for (auto &dilation_h: dilation_hs) { r_args.dilation_h = dilation_h;
                                                                               for (auto &dilation_w: dilation_ws) { r_args.dilation_w = dilation_w;
-                                                                                for (auto &batch_count: batch_counts) { r_args.batch_count = batch_count;
-                                                                                  C::SetSizes(r_args, tester.queue_);
-                                                                                  regular_test_vector.push_back(r_args);
+                                                                                for (auto &num_kernels: num_kernelss) { r_args.num_kernels = num_kernels;
+                                                                                  for (auto &batch_count: batch_counts) { r_args.batch_count = batch_count;
+                                                                                    C::SetSizes(r_args, tester.queue_);
+                                                                                    regular_test_vector.push_back(r_args);
+                                                                                  }
                                                                                 }
                                                                               }
                                                                             }
@@ -378,6 +378,7 @@ std::string Tester<T,U>::GetOptionsString(const Arguments<U> &args) {
     if (o == kArgStrideW)  { result += kArgStrideW + equals + ToString(args.stride_w) + " "; }
     if (o == kArgDilationH){ result += kArgDilationH + equals + ToString(args.dilation_h) + " "; }
     if (o == kArgDilationW){ result += kArgDilationW + equals + ToString(args.dilation_w) + " "; }
+    if (o == kArgNumKernels){result += kArgNumKernels + equals + ToString(args.num_kernels) + " "; }
   }
   return result;
 }
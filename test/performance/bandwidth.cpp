@@ -0,0 +1,207 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the 'clblast_bench_bandwidth' benchmark, which checks whether the memory-
+// bound routines reach the bandwidth of the device. As a STREAM-like baseline it first measures a
+// device-to-device copy with 'clEnqueueCopyBuffer' and two trivial kernels (a copy and a triad,
+// i.e. z = x + a*y) across vector sizes, the best of which is taken as the peak bandwidth. It then
+// runs the single-precision AXPY, COPY, DOT and GEMV routines across the same sizes (GEMV with a
+// square matrix of that many elements) and reports for each the achieved bandwidth and the fraction
+// of the peak. A low fraction for large sizes points to mis-tuned 'Xaxpy', 'Xdot' or 'Xgemv'
+// kernels. All times are the minimum of the host wall-clock times of a number of synchronised
+// runs, after a warm-up run.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The trivial kernels of the baseline, without any tuning or vectorisation
+const std::string kBandwidthKernels = R"(
+__kernel void BandwidthCopy(const __global float* restrict x, __global float* z) {
+  const size_t id = get_global_id(0);
+  z[id] = x[id];
+}
+__kernel void BandwidthTriad(const float alpha, const __global float* restrict x,
+                             const __global float* restrict y, __global float* z) {
+  const size_t id = get_global_id(0);
+  z[id] = x[id] + alpha * y[id];
+}
+)";
+
+// Runs a benchmark once to warm up and then a number of times, returns the minimum time in
+// milliseconds or a negative value in case of an error
+double BenchmarkBandwidth(const size_t num_runs, Queue &queue,
+                          const std::function<StatusCode()> &run) {
+  auto status = run();
+  queue.Finish();
+  auto best_ms = -1.0;
+  for (auto i = size_t{0}; i < num_runs && status == StatusCode::kSuccess; ++i) {
+    const auto start_time = std::chrono::steady_clock::now();
+    status = run();
+    queue.Finish();
+    const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+    const auto time_ms = std::chrono::duration<double,std::milli>(elapsed_time).count();
+    if (best_ms < 0.0 || time_ms < best_ms) { best_ms = time_ms; }
+  }
+  if (status != StatusCode::kSuccess) { return -1.0; }
+  return best_ms;
+}
+
+// A row of the table, with the fraction of the peak bandwidth only if known
+void PrintBandwidth(const std::string &name, const size_t size, const size_t bytes,
+                    const double time_ms, const double peak_gbs) {
+  if (time_ms < 0.0) {
+    fprintf(stdout, "%11s;%10zu; failed\n", name.c_str(), size);
+    return;
+  }
+  const auto gbs = static_cast<double>(bytes) * 1.0e-6 / time_ms;
+  if (peak_gbs > 0.0) {
+    fprintf(stdout, "%11s;%10zu;%10.1lf;%10.3lf;%10.1lf;%10.2lf\n", name.c_str(), size,
+            static_cast<double>(bytes) * 1.0e-6, time_ms, gbs, gbs / peak_gbs);
+  }
+  else {
+    fprintf(stdout, "%11s;%10zu;%10.1lf;%10.3lf;%10.1lf;%10s\n", name.c_str(), size,
+            static_cast<double>(bytes) * 1.0e-6, time_ms, gbs, "-");
+  }
+}
+
+// =================================================================================================
+
+void RunBandwidthBenchmark(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto num_runs = GetArgument(arguments, help, kArgNumRuns, size_t{10});
+  const auto max_size = GetArgument(arguments, help, kArgN, size_t{16*1024*1024});
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // The vector sizes: powers of four from 4K elements up to the maximum
+  auto sizes = std::vector<size_t>();
+  for (auto size = size_t{4096}; size <= max_size; size *= 4) { sizes.push_back(size); }
+  if (sizes.empty()) { sizes.push_back(max_size); }
+
+  // Initializes OpenCL and the largest buffers needed
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  const auto max_elements = sizes.back();
+  const auto host_data = std::vector<float>(max_elements, 1.0f);
+  auto a = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto x = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto y = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto z = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto result = Buffer<float>(context, 1);
+  queue.Finish();
+
+  // Compiles the kernels of the baseline
+  auto program = Program(context, kBandwidthKernels);
+  auto options = std::vector<std::string>();
+  program.Build(device, options);
+  auto copy_kernel = Kernel(program, "BandwidthCopy");
+  auto triad_kernel = Kernel(program, "BandwidthTriad");
+
+  // Measures the baseline: the peak is the best bandwidth over all sizes
+  fprintf(stdout, "%11s;%10s;%10s;%10s;%10s;%10s\n", "benchmark", "size", "MB", "ms", "GB/s",
+          "fraction");
+  auto peak_gbs = 0.0;
+  const auto update_peak = [&](const size_t bytes, const double time_ms) {
+    if (time_ms <= 0.0) { return; }
+    peak_gbs = std::max(peak_gbs, static_cast<double>(bytes) * 1.0e-6 / time_ms);
+  };
+  for (const auto n : sizes) {
+    const auto bytes = 2 * n * sizeof(float);
+    const auto time_ms = BenchmarkBandwidth(num_runs, queue, [&]() {
+      x.CopyToAsync(queue, n, z);
+      return StatusCode::kSuccess;
+    });
+    PrintBandwidth("copybuffer", n, bytes, time_ms, 0.0);
+    update_peak(bytes, time_ms);
+  }
+  for (const auto n : sizes) {
+    const auto bytes = 2 * n * sizeof(float);
+    const auto time_ms = BenchmarkBandwidth(num_runs, queue, [&]() {
+      copy_kernel.SetArguments(x, z);
+      copy_kernel.Launch(queue, {n}, {}, nullptr);
+      return StatusCode::kSuccess;
+    });
+    PrintBandwidth("copykernel", n, bytes, time_ms, 0.0);
+    update_peak(bytes, time_ms);
+  }
+  for (const auto n : sizes) {
+    const auto bytes = 3 * n * sizeof(float);
+    const auto time_ms = BenchmarkBandwidth(num_runs, queue, [&]() {
+      triad_kernel.SetArgument(0, 2.0f);
+      triad_kernel.SetArgument(1, x);
+      triad_kernel.SetArgument(2, y);
+      triad_kernel.SetArgument(3, z);
+      triad_kernel.Launch(queue, {n}, {}, nullptr);
+      return StatusCode::kSuccess;
+    });
+    PrintBandwidth("triadkernel", n, bytes, time_ms, 0.0);
+    update_peak(bytes, time_ms);
+  }
+  fprintf(stdout, "* Peak bandwidth: %.1lf GB/s\n", peak_gbs);
+
+  // Runs the routines. Their bytes are the minimum traffic: every element read or written once.
+  for (const auto n : sizes) {
+    const auto time_ms = BenchmarkBandwidth(num_runs, queue, [&]() {
+      return Axpy(n, 2.0f, x(), 0, 1, y(), 0, 1, &queue_plain);
+    });
+    PrintBandwidth("AXPY", n, 3 * n * sizeof(float), time_ms, peak_gbs);
+  }
+  for (const auto n : sizes) {
+    const auto time_ms = BenchmarkBandwidth(num_runs, queue, [&]() {
+      return Copy<float>(n, x(), 0, 1, y(), 0, 1, &queue_plain);
+    });
+    PrintBandwidth("COPY", n, 2 * n * sizeof(float), time_ms, peak_gbs);
+  }
+  for (const auto n : sizes) {
+    const auto time_ms = BenchmarkBandwidth(num_runs, queue, [&]() {
+      return Dot<float>(n, result(), 0, x(), 0, 1, y(), 0, 1, &queue_plain);
+    });
+    PrintBandwidth("DOT", n, 2 * n * sizeof(float), time_ms, peak_gbs);
+  }
+  for (const auto n : sizes) {
+    const auto m = static_cast<size_t>(std::sqrt(static_cast<double>(n)));
+    const auto time_ms = BenchmarkBandwidth(num_runs, queue, [&]() {
+      return Gemv(Layout::kColMajor, Transpose::kNo, m, m, 1.0f, a(), 0, m, x(), 0, 1,
+                  1.0f, y(), 0, 1, &queue_plain);
+    });
+    PrintBandwidth("GEMV", n, (m * m + 3 * m) * sizeof(float), time_ms, peak_gbs);
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::RunBandwidthBenchmark(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
@@ -17,6 +17,10 @@
 #include <algorithm>
 #include <chrono>
 #include <random>
+#include <cmath>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
 
 #include "utilities/utilities.hpp"
 #include "test/performance/client.hpp"
@@ -26,6 +30,76 @@ namespace clblast {
 
 template <typename T, typename U> const int Client<T,U>::kSeed = 42; // fixed seed for reproducibility
 
+// Computes the statistics of a vector of execution times. The percentiles use the nearest rank.
+TimingStatistics ComputeTimingStatistics(std::vector<double> timings) {
+  auto result = TimingStatistics{0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  if (timings.empty()) { return result; }
+  std::sort(timings.begin(), timings.end());
+  const auto num_timings = timings.size();
+  const auto percentile = [&](const double p) {
+    const auto rank = static_cast<size_t>(std::ceil(p * static_cast<double>(num_timings)));
+    return timings[std::max(rank, size_t{1}) - 1];
+  };
+  auto sum = 0.0;
+  for (const auto timing : timings) { sum += timing; }
+  result.min = timings.front();
+  result.mean = sum / static_cast<double>(num_timings);
+  result.median = (num_timings % 2 == 1) ? timings[num_timings / 2] :
+                  0.5 * (timings[num_timings / 2 - 1] + timings[num_timings / 2]);
+  result.p90 = percentile(0.90);
+  result.p99 = percentile(0.99);
+  auto sum_squares = 0.0;
+  for (const auto timing : timings) { sum_squares += (timing - result.mean) * (timing - result.mean); }
+  result.stddev = std::sqrt(sum_squares / static_cast<double>(num_timings));
+  return result;
+}
+
+// Estimates the peak performance and bandwidth of a device from its properties. The compute peak
+// assumes one fused multiply-add per cycle per lane, with a vendor-specific number of lanes per
+// compute unit. It is only estimated for 32-bit (and 16-bit) floating-point, since the ratio for
+// 64-bit differs per device model. The bandwidth is only known for CUDA devices (double data rate).
+DevicePeaks EstimateDevicePeaks(const Device &device, const Precision precision) {
+  auto peaks = DevicePeaks{0.0, 0.0};
+  auto lanes_per_unit = size_t{0};
+  if (device.IsCPU()) { lanes_per_unit = 8; } // e.g. one AVX FMA unit per hardware thread
+  else if (device.IsAMD()) { lanes_per_unit = 64; }
+  else if (device.IsIntel()) { lanes_per_unit = 8; }
+  else if (device.IsNVIDIA()) {
+    const auto capability = device.GetExtraInfo(); // e.g. "SM7.5"
+    const auto dot = capability.find('.');
+    if (capability.compare(0, 2, "SM") == 0 && dot != std::string::npos && dot > 2) {
+      const auto major = std::atoi(capability.substr(2, dot - 2).c_str());
+      const auto minor = std::atoi(capability.substr(dot + 1).c_str());
+      if (major == 3) { lanes_per_unit = 192; }
+      else if ((major == 6 && minor == 0) || major == 7 || (major == 8 && minor == 0)) { lanes_per_unit = 64; }
+      else if (major >= 5) { lanes_per_unit = 128; }
+    }
+  }
+  const auto single_or_half = precision == Precision::kSingle || precision == Precision::kHalf ||
+                              precision == Precision::kComplexSingle;
+  if (single_or_half) {
+    const auto flops_per_cycle = 2.0 * static_cast<double>(device.ComputeUnits() * lanes_per_unit);
+    peaks.gflops = flops_per_cycle * static_cast<double>(device.CoreClock()) * 1.0e-3;
+  }
+  peaks.gbs = 2.0 * static_cast<double>(device.MemoryClock()) *
+              static_cast<double>(device.MemoryBusWidth()) / 8.0 * 1.0e-3;
+  return peaks;
+}
+
+#ifdef OPENCL_API
+  // Collects the start and end times (in ns) of the kernels reported by CLBlast's profiling
+  // callback, which is called from threads of the OpenCL implementation
+  struct KernelTimings {
+    std::mutex mutex;
+    std::vector<std::pair<unsigned long long, unsigned long long>> kernels;
+  };
+  void CollectKernelTiming(const KernelProfile &profile, void* user_data) {
+    auto kernel_timings = static_cast<KernelTimings*>(user_data);
+    std::lock_guard<std::mutex> lock(kernel_timings->mutex);
+    kernel_timings->kernels.push_back({profile.start_time, profile.end_time});
+  }
+#endif
+
 // Constructor
 template <typename T, typename U>
 Client<T,U>::Client(const Routine run_routine,
@@ -117,6 +191,9 @@ Arguments<U> Client<T,U>::ParseArguments(int argc, char *argv[], const size_t le
     if (o == kArgStrideW)   { args.stride_w = GetArgument(command_line_args, help, kArgStrideW, size_t{1}); }
     if (o == kArgDilationH) { args.dilation_h = GetArgument(command_line_args, help, kArgDilationH, size_t{1}); }
     if (o == kArgDilationW) { args.dilation_w = GetArgument(command_line_args, help, kArgDilationW, size_t{1}); }
+
+    // Arguments for convgemm
+    if (o == kArgNumKernels) { args.num_kernels = GetArgument(command_line_args, help, kArgNumKernels, size_t{64}); }
   }
 
   // These are the options common to all routines
@@ -145,6 +222,16 @@ Arguments<U> Client<T,U>::ParseArguments(int argc, char *argv[], const size_t le
   args.silent         = CheckArgument(command_line_args, help, kArgQuiet);
   args.no_abbrv       = CheckArgument(command_line_args, help, kArgNoAbbreviations);
   warm_up_            = CheckArgument(command_line_args, help, kArgWarmUp);
+  statistics_         = CheckArgument(command_line_args, help, kArgStatistics);
+
+  // Parses the optional output file name for the full timing results (JSON if ending in '.json')
+  const auto output_file_default = std::string{"<none>"};
+  output_file_ = GetArgument(command_line_args, help, kArgOutputFile, output_file_default);
+  if (output_file_ == output_file_default) { output_file_ = ""; }
+
+  // Parses the optional device peaks, which are otherwise estimated from the device properties
+  peaks_.gflops = GetArgument(command_line_args, help, kArgPeakGflops, 0.0);
+  peaks_.gbs = GetArgument(command_line_args, help, kArgPeakGbs, 0.0);
 
   // Parse the optional JSON file name arguments
   const auto tuner_files_default = std::string{"<none>"};
@@ -206,6 +293,26 @@ void Client<T,U>::PerformanceTest(Arguments<U> &args, const SetMetric set_sizes)
   // Optionally overrides parameters if tuner files are given (semicolon separated)
   OverrideParametersFromJSONFiles(args.tuner_files, device(), args.precision);
 
+  // Estimates the peaks of the device unless given on the command-line
+  const auto estimated_peaks = EstimateDevicePeaks(device, args.precision);
+  if (peaks_.gflops == 0.0) { peaks_.gflops = estimated_peaks.gflops; }
+  if (peaks_.gbs == 0.0) { peaks_.gbs = estimated_peaks.gbs; }
+  if (!args.silent) {
+    fprintf(stdout, "* Device peaks: %.1lf GFLOPS and %.1lf GB/s (0 == unknown, see -%s and -%s)\n\n",
+            peaks_.gflops, peaks_.gbs, kArgPeakGflops, kArgPeakGbs);
+  }
+
+  // Opens the optional output file for the full timing results
+  auto output_file = static_cast<FILE*>(nullptr);
+  const auto output_json = output_file_.size() >= 5 &&
+                           output_file_.compare(output_file_.size() - 5, 5, ".json") == 0;
+  auto first_record = true;
+  if (!output_file_.empty()) {
+    output_file = fopen(output_file_.c_str(), "w");
+    if (output_file == nullptr) { throw std::runtime_error("Unable to open '" + output_file_ + "'"); }
+    if (output_json) { fprintf(output_file, "[\n"); }
+  }
+
   // Prints the header of the output table
   PrintTableHeader(args);
 
@@ -252,36 +359,38 @@ void Client<T,U>::PerformanceTest(Arguments<U> &args, const SetMetric set_sizes)
     auto buffers = Buffers<T>{x_vec, y_vec, a_mat, b_mat, c_mat, ap_mat, scalar};
 
     // Runs the routines and collects the timings
-    auto timings = std::vector<std::pair<std::string, double>>();
-    auto ms_clblast = TimedExecution(args.num_runs, args, buffers, queue, run_routine_, "CLBlast");
-    timings.push_back(std::pair<std::string, double>("CLBlast", ms_clblast));
+    auto timings = std::vector<TimingResult>();
+    const auto device_timing = statistics_ || output_file != nullptr;
+    timings.push_back(TimedExecution(args.num_runs, args, buffers, queue, run_routine_, "CLBlast",
+                                     device_timing));
     if (args.compare_clblas) {
-      auto ms_clblas = TimedExecution(args.num_runs, args, buffers, queue, run_reference1_, "clBLAS");
-      timings.push_back(std::pair<std::string, double>("clBLAS", ms_clblas));
+      timings.push_back(TimedExecution(args.num_runs, args, buffers, queue, run_reference1_, "clBLAS"));
     }
     if (args.compare_cblas) {
       auto buffers_host = BuffersHost<T>();
       DeviceToHost(args, buffers, buffers_host, queue, buffers_in_);
-      auto ms_cblas = TimedExecution(args.num_runs, args, buffers_host, queue, run_reference2_, "CPU BLAS");
+      timings.push_back(TimedExecution(args.num_runs, args, buffers_host, queue, run_reference2_, "CPU BLAS"));
       HostToDevice(args, buffers, buffers_host, queue, buffers_out_);
-      timings.push_back(std::pair<std::string, double>("CPU BLAS", ms_cblas));
     }
     if (args.compare_cublas) {
       auto buffers_host = BuffersHost<T>();
       auto buffers_cuda = BuffersCUDA<T>();
       DeviceToHost(args, buffers, buffers_host, queue, buffers_in_);
       HostToCUDA(args, buffers_cuda, buffers_host, buffers_in_);
-      auto ms_cublas = 0.0;
+      auto timing_cublas = TimingResult{"cuBLAS", TimingStatistics{}, false, TimingStatistics{}, TimingStatistics{}};
       try {
-        ms_cublas = TimedExecution(args.num_runs, args, buffers_cuda, queue, run_reference3_, "cuBLAS");
+        timing_cublas = TimedExecution(args.num_runs, args, buffers_cuda, queue, run_reference3_, "cuBLAS");
       } catch (std::runtime_error e) { }
       CUDAToHost(args, buffers_cuda, buffers_host, buffers_out_);
       HostToDevice(args, buffers, buffers_host, queue, buffers_out_);
-      timings.push_back(std::pair<std::string, double>("cuBLAS", ms_cublas));
+      timings.push_back(timing_cublas);
     }
 
     // Prints the performance of the tested libraries
     PrintTableRow(args, timings);
+    if (output_file != nullptr) {
+      WriteResults(output_file, output_json, first_record, args, timings);
+    }
 
     // Makes the jump to the next step
     ++s;
@@ -295,6 +404,10 @@ void Client<T,U>::PerformanceTest(Arguments<U> &args, const SetMetric set_sizes)
   }
 
   // Cleans-up and returns
+  if (output_file != nullptr) {
+    if (output_json) { fprintf(output_file, "\n]\n"); }
+    fclose(output_file);
+  }
   #ifdef CLBLAST_REF_CLBLAS
     if (args.compare_clblas) { clblasTeardown(); }
   #endif
@@ -306,13 +419,16 @@ void Client<T,U>::PerformanceTest(Arguments<U> &args, const SetMetric set_sizes)
 // =================================================================================================
 
 // Creates a vector of timing results, filled with execution times of the 'main computation'. The
-// timing is performed using the milliseconds chrono functions. The function returns the minimum
-// value found in the vector of timing results. The return value is in milliseconds.
+// timing is performed using the milliseconds chrono functions. The function returns the statistics
+// of the timing results, e.g. the minimum value found, all in milliseconds. If device timing is
+// requested, the kernel times of CLBlast's profiling callback are collected as well: the kernels
+// are divided evenly over the runs, such that the remainder of each run is the host overhead.
 template <typename T, typename U>
 template <typename BufferType, typename RoutineType>
-double Client<T,U>::TimedExecution(const size_t num_runs, const Arguments<U> &args,
-                                   BufferType &buffers, Queue &queue,
-                                   RoutineType run_blas, const std::string &library_name) {
+TimingResult Client<T,U>::TimedExecution(const size_t num_runs, const Arguments<U> &args,
+                                         BufferType &buffers, Queue &queue,
+                                         RoutineType run_blas, const std::string &library_name,
+                                         const bool device_timing) {
   auto status = StatusCode::kSuccess;
 
   // Do an optional warm-up to omit compilation times and initialisations from the measurements
@@ -325,6 +441,15 @@ double Client<T,U>::TimedExecution(const size_t num_runs, const Arguments<U> &ar
     }
   }
 
+  // Optionally starts collecting the kernel timings
+  #ifdef OPENCL_API
+    KernelTimings kernel_timings;
+    if (device_timing) {
+      ResetStatistics();
+      SetProfilingCallback(CollectKernelTiming, &kernel_timings);
+    }
+  #endif
+
   // Start the timed part
   auto timings = std::vector<double>(num_runs);
   for (auto &timing: timings) {
@@ -335,6 +460,9 @@ double Client<T,U>::TimedExecution(const size_t num_runs, const Arguments<U> &ar
       status = run_blas(args, buffers, queue);
     } catch (...) { status = static_cast<StatusCode>(kUnknownError); }
     if (status != StatusCode::kSuccess) {
+      #ifdef OPENCL_API
+        if (device_timing) { SetProfilingCallback(nullptr); }
+      #endif
       throw std::runtime_error(library_name+" error: "+ToString(static_cast<int>(status)));
     }
 
@@ -342,89 +470,169 @@ double Client<T,U>::TimedExecution(const size_t num_runs, const Arguments<U> &ar
     auto elapsed_time = std::chrono::steady_clock::now() - start_time;
     timing = std::chrono::duration<double,std::milli>(elapsed_time).count();
   }
-  return *std::min_element(timings.begin(), timings.end());
+  auto result = TimingResult{library_name, ComputeTimingStatistics(timings), false,
+                             TimingStatistics{}, TimingStatistics{}};
+
+  // Waits for all kernel timings to arrive (at most one second) and computes the device time and
+  // host overhead of each run, provided that each run launched the same number of kernels
+  #ifdef OPENCL_API
+    if (device_timing) {
+      queue.Finish();
+      auto statistics = Statistics{};
+      GetStatistics(statistics);
+      auto num_kernels = size_t{0};
+      for (const auto &routine : statistics.routines) { num_kernels += routine.second.num_kernels; }
+      auto kernels = std::vector<std::pair<unsigned long long, unsigned long long>>();
+      for (auto i = 0; i < 1000; ++i) {
+        {
+          std::lock_guard<std::mutex> lock(kernel_timings.mutex);
+          kernels = kernel_timings.kernels;
+        }
+        if (kernels.size() >= num_kernels) { break; }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      SetProfilingCallback(nullptr);
+      if (num_kernels != 0 && kernels.size() == num_kernels && num_kernels % num_runs == 0) {
+        std::sort(kernels.begin(), kernels.end());
+        const auto kernels_per_run = num_kernels / num_runs;
+        auto device_timings = std::vector<double>(num_runs, 0.0);
+        auto overhead_timings = std::vector<double>(num_runs, 0.0);
+        for (auto run = size_t{0}; run < num_runs; ++run) {
+          for (auto i = run * kernels_per_run; i < (run + 1) * kernels_per_run; ++i) {
+            device_timings[run] += static_cast<double>(kernels[i].second - kernels[i].first) * 1.0e-6;
+          }
+          overhead_timings[run] = std::max(timings[run] - device_timings[run], 0.0);
+        }
+        result.has_device = true;
+        result.device = ComputeTimingStatistics(device_timings);
+        result.overhead = ComputeTimingStatistics(overhead_timings);
+      }
+    }
+  #endif
+  return result;
 }
 
 // =================================================================================================
 
-// Prints the header of the performance table
+// Retrieves the names and values of the routine-specific options, split into integer values
+// (including enums) and scalar values
+template <typename T, typename U>
+void Client<T,U>::GetOptionValues(const Arguments<U>& args,
+                                  std::vector<std::pair<std::string, size_t>>& integers,
+                                  std::vector<std::pair<std::string, std::string>>& strings) {
+  for (auto &o: options_) {
+    if      (o == kArgM) {        integers.push_back({o, args.m}); }
+    else if (o == kArgN) {        integers.push_back({o, args.n}); }
+    else if (o == kArgK) {        integers.push_back({o, args.k}); }
+    else if (o == kArgKU) {       integers.push_back({o, args.ku}); }
+    else if (o == kArgKL) {       integers.push_back({o, args.kl}); }
+    else if (o == kArgLayout) {   integers.push_back({o, static_cast<size_t>(args.layout)}); }
+    else if (o == kArgSide) {     integers.push_back({o, static_cast<size_t>(args.side)}); }
+    else if (o == kArgTriangle) { integers.push_back({o, static_cast<size_t>(args.triangle)}); }
+    else if (o == kArgATransp) {  integers.push_back({o, static_cast<size_t>(args.a_transpose)}); }
+    else if (o == kArgBTransp) {  integers.push_back({o, static_cast<size_t>(args.b_transpose)}); }
+    else if (o == kArgDiagonal) { integers.push_back({o, static_cast<size_t>(args.diagonal)}); }
+    else if (o == kArgXInc) {     integers.push_back({o, args.x_inc}); }
+    else if (o == kArgYInc) {     integers.push_back({o, args.y_inc}); }
+    else if (o == kArgXOffset) {  integers.push_back({o, args.x_offset}); }
+    else if (o == kArgYOffset) {  integers.push_back({o, args.y_offset}); }
+    else if (o == kArgALeadDim) { integers.push_back({o, args.a_ld}); }
+    else if (o == kArgBLeadDim) { integers.push_back({o, args.b_ld}); }
+    else if (o == kArgCLeadDim) { integers.push_back({o, args.c_ld}); }
+    else if (o == kArgAOffset) {  integers.push_back({o, args.a_offset}); }
+    else if (o == kArgBOffset) {  integers.push_back({o, args.b_offset}); }
+    else if (o == kArgCOffset) {  integers.push_back({o, args.c_offset}); }
+    else if (o == kArgAPOffset) { integers.push_back({o, args.ap_offset}); }
+    else if (o == kArgDotOffset) {integers.push_back({o, args.dot_offset}); }
+    else if (o == kArgNrm2Offset){integers.push_back({o, args.nrm2_offset}); }
+    else if (o == kArgAsumOffset){integers.push_back({o, args.asum_offset}); }
+    else if (o == kArgImaxOffset){integers.push_back({o, args.imax_offset}); }
+    else if (o == kArgBatchCount){integers.push_back({o, args.batch_count}); }
+    else if (o == kArgChannels)  {integers.push_back({o, args.channels}); }
+    else if (o == kArgHeight)    {integers.push_back({o, args.height}); }
+    else if (o == kArgWidth)     {integers.push_back({o, args.width}); }
+    else if (o == kArgKernelH)   {integers.push_back({o, args.kernel_h}); }
+    else if (o == kArgKernelW)   {integers.push_back({o, args.kernel_w}); }
+    else if (o == kArgPadH)      {integers.push_back({o, args.pad_h}); }
+    else if (o == kArgPadW)      {integers.push_back({o, args.pad_w}); }
+    else if (o == kArgStrideH)   {integers.push_back({o, args.stride_h}); }
+    else if (o == kArgStrideW)   {integers.push_back({o, args.stride_w}); }
+    else if (o == kArgDilationH) {integers.push_back({o, args.dilation_h}); }
+    else if (o == kArgDilationW) {integers.push_back({o, args.dilation_w}); }
+    else if (o == kArgNumKernels){integers.push_back({o, args.num_kernels}); }
+  }
+  for (auto &o: options_) {
+    if      (o == kArgAlpha) {    strings.push_back({o, ToString(args.alpha)}); }
+    else if (o == kArgBeta) {     strings.push_back({o, ToString(args.beta)}); }
+  }
+}
+
+// Prints the header of the performance table. With statistics enabled, each library gets extra
+// columns for the distribution of the execution times, and CLBlast for the device time and host
+// overhead (medians) as well.
 template <typename T, typename U>
 void Client<T,U>::PrintTableHeader(const Arguments<U>& args) {
+  auto libraries = std::vector<std::pair<size_t, std::string>>{{1, "CLBlast"}};
+  if (args.compare_clblas) { libraries.push_back({2, "clBLAS"}); }
+  if (args.compare_cblas) { libraries.push_back({3, "CPU BLAS"}); }
+  if (args.compare_cublas) { libraries.push_back({4, "cuBLAS"}); }
+  #ifdef OPENCL_API
+    const auto num_device_columns = (statistics_) ? size_t{2} : size_t{0};
+  #else
+    const auto num_device_columns = size_t{0};
+  #endif
+  const auto num_peak_columns = ((peaks_.gflops > 0.0) ? size_t{1} : size_t{0}) +
+                                ((peaks_.gbs > 0.0) ? size_t{1} : size_t{0});
+  const auto num_columns = ((statistics_) ? size_t{8} : size_t{3}) + num_peak_columns;
 
   // First line (optional)
   if (!args.silent) {
     for (auto i=size_t{0}; i<options_.size(); ++i) { fprintf(stdout, "%9s ", ""); }
-    fprintf(stdout, " | <--       CLBlast       -->");
-    if (args.compare_clblas) { fprintf(stdout, " | <--       clBLAS        -->"); }
-    if (args.compare_cblas) { fprintf(stdout, " | <--      CPU BLAS       -->"); }
-    if (args.compare_cublas) { fprintf(stdout, " | <--       cuBLAS        -->"); }
+    for (const auto &library : libraries) {
+      const auto &name = library.second;
+      const auto columns = num_columns + ((library.first == 1) ? num_device_columns : 0);
+      const auto width = 10 * columns - 9;
+      const auto left = (width - name.size()) / 2;
+      const auto right = width - name.size() - left;
+      fprintf(stdout, " | <--%s%s%s-->", std::string(left, ' ').c_str(), name.c_str(),
+              std::string(right, ' ').c_str());
+    }
     fprintf(stdout, " |\n");
   }
 
   // Second line
   for (auto &option: options_) { fprintf(stdout, "%9s;", option.c_str()); }
-  fprintf(stdout, "%9s;%9s;%9s", "ms_1", "GFLOPS_1", "GBs_1");
-  if (args.compare_clblas) { fprintf(stdout, ";%9s;%9s;%9s", "ms_2", "GFLOPS_2", "GBs_2"); }
-  if (args.compare_cblas) { fprintf(stdout, ";%9s;%9s;%9s", "ms_3", "GFLOPS_3", "GBs_3"); }
-  if (args.compare_cublas) { fprintf(stdout, ";%9s;%9s;%9s", "ms_4", "GFLOPS_4", "GBs_4"); }
+  for (const auto &library : libraries) {
+    const auto id = library.first;
+    if (id != 1) { fprintf(stdout, ";"); }
+    fprintf(stdout, "%9s;%9s;%9s", ("ms_" + ToString(id)).c_str(), ("GFLOPS_" + ToString(id)).c_str(),
+            ("GBs_" + ToString(id)).c_str());
+    if (peaks_.gflops > 0.0) { fprintf(stdout, ";%9s", ("%peak_" + ToString(id)).c_str()); }
+    if (peaks_.gbs > 0.0) { fprintf(stdout, ";%9s", ("%bw_" + ToString(id)).c_str()); }
+    if (statistics_) {
+      for (const auto &name : {"mean_", "median_", "p90_", "p99_", "stddev_"}) {
+        fprintf(stdout, ";%9s", (name + ToString(id)).c_str());
+      }
+      if (id == 1 && num_device_columns != 0) {
+        fprintf(stdout, ";%9s;%9s", "device_1", "hostovh_1");
+      }
+    }
+  }
   fprintf(stdout, "\n");
 }
 
 // Print a performance-result row
 template <typename T, typename U>
-void Client<T,U>::PrintTableRow(const Arguments<U>& args,
-                                const std::vector<std::pair<std::string, double>>& timings) {
+void Client<T,U>::PrintTableRow(const Arguments<U>& args, const std::vector<TimingResult>& timings) {
 
   // Creates a vector of relevant variables
-  auto integers = std::vector<size_t>{};
-  for (auto &o: options_) {
-    if      (o == kArgM) {        integers.push_back(args.m); }
-    else if (o == kArgN) {        integers.push_back(args.n); }
-    else if (o == kArgK) {        integers.push_back(args.k); }
-    else if (o == kArgKU) {       integers.push_back(args.ku); }
-    else if (o == kArgKL) {       integers.push_back(args.kl); }
-    else if (o == kArgLayout) {   integers.push_back(static_cast<size_t>(args.layout)); }
-    else if (o == kArgSide) {     integers.push_back(static_cast<size_t>(args.side)); }
-    else if (o == kArgTriangle) { integers.push_back(static_cast<size_t>(args.triangle)); }
-    else if (o == kArgATransp) {  integers.push_back(static_cast<size_t>(args.a_transpose)); }
-    else if (o == kArgBTransp) {  integers.push_back(static_cast<size_t>(args.b_transpose)); }
-    else if (o == kArgDiagonal) { integers.push_back(static_cast<size_t>(args.diagonal)); }
-    else if (o == kArgXInc) {     integers.push_back(args.x_inc); }
-    else if (o == kArgYInc) {     integers.push_back(args.y_inc); }
-    else if (o == kArgXOffset) {  integers.push_back(args.x_offset); }
-    else if (o == kArgYOffset) {  integers.push_back(args.y_offset); }
-    else if (o == kArgALeadDim) { integers.push_back(args.a_ld); }
-    else if (o == kArgBLeadDim) { integers.push_back(args.b_ld); }
-    else if (o == kArgCLeadDim) { integers.push_back(args.c_ld); }
-    else if (o == kArgAOffset) {  integers.push_back(args.a_offset); }
-    else if (o == kArgBOffset) {  integers.push_back(args.b_offset); }
-    else if (o == kArgCOffset) {  integers.push_back(args.c_offset); }
-    else if (o == kArgAPOffset) { integers.push_back(args.ap_offset); }
-    else if (o == kArgDotOffset) {integers.push_back(args.dot_offset); }
-    else if (o == kArgNrm2Offset){integers.push_back(args.nrm2_offset); }
-    else if (o == kArgAsumOffset){integers.push_back(args.asum_offset); }
-    else if (o == kArgImaxOffset){integers.push_back(args.imax_offset); }
-    else if (o == kArgBatchCount){integers.push_back(args.batch_count); }
-    else if (o == kArgChannels)  {integers.push_back(args.channels); }
-    else if (o == kArgHeight)    {integers.push_back(args.height); }
-    else if (o == kArgWidth)     {integers.push_back(args.width); }
-    else if (o == kArgKernelH)   {integers.push_back(args.kernel_h); }
-    else if (o == kArgKernelW)   {integers.push_back(args.kernel_w); }
-    else if (o == kArgPadH)      {integers.push_back(args.pad_h); }
-    else if (o == kArgPadW)      {integers.push_back(args.pad_w); }
-    else if (o == kArgStrideH)   {integers.push_back(args.stride_h); }
-    else if (o == kArgStrideW)   {integers.push_back(args.stride_w); }
-    else if (o == kArgDilationH) {integers.push_back(args.dilation_h); }
-    else if (o == kArgDilationW) {integers.push_back(args.dilation_w); }
-  }
-  auto strings = std::vector<std::string>{};
-  for (auto &o: options_) {
-    if      (o == kArgAlpha) {    strings.push_back(ToString(args.alpha)); }
-    else if (o == kArgBeta) {     strings.push_back(ToString(args.beta)); }
-  }
+  auto integers = std::vector<std::pair<std::string, size_t>>{};
+  auto strings = std::vector<std::pair<std::string, std::string>>{};
+  GetOptionValues(args, integers, strings);
 
   // Outputs the argument values
-  for (auto &argument: integers) {
+  for (auto &integer: integers) {
+    const auto argument = integer.second;
     if (!args.no_abbrv && argument >= 1024*1024 && IsMultiple(argument, 1024*1024)) {
       fprintf(stdout, "%8zuM;", argument/(1024*1024));
     }
@@ -436,25 +644,115 @@ void Client<T,U>::PrintTableRow(const Arguments<U>& args,
     }
   }
   for (auto &argument: strings) {
-    fprintf(stdout, "%9s;", argument.c_str());
+    fprintf(stdout, "%9s;", argument.second.c_str());
   }
 
   // Loops over all tested libraries
   for (const auto& timing : timings) {
 
     // Computes the GFLOPS and GB/s metrics
+    const auto ms = timing.host.min;
     auto flops = get_flops_(args);
     auto bytes = get_bytes_(args);
-    auto gflops = (timing.second != 0.0) ? (flops*1e-6)/timing.second : 0;
-    auto gbs = (timing.second != 0.0) ? (bytes*1e-6)/timing.second : 0;
+    auto gflops = (ms != 0.0) ? (flops*1e-6)/ms : 0;
+    auto gbs = (ms != 0.0) ? (bytes*1e-6)/ms : 0;
 
     // Outputs the performance numbers
-    if (timing.first != "CLBlast") { fprintf(stdout, ";"); }
-    fprintf(stdout, "%9.2lf;%9.1lf;%9.1lf", timing.second, gflops, gbs);
+    if (timing.library != "CLBlast") { fprintf(stdout, ";"); }
+    fprintf(stdout, "%9.2lf;%9.1lf;%9.1lf", ms, gflops, gbs);
+    if (peaks_.gflops > 0.0) { fprintf(stdout, ";%9.1lf", 100.0 * gflops / peaks_.gflops); }
+    if (peaks_.gbs > 0.0) { fprintf(stdout, ";%9.1lf", 100.0 * gbs / peaks_.gbs); }
+    if (statistics_) {
+      fprintf(stdout, ";%9.3lf;%9.3lf;%9.3lf;%9.3lf;%9.3lf", timing.host.mean, timing.host.median,
+              timing.host.p90, timing.host.p99, timing.host.stddev);
+      #ifdef OPENCL_API
+        if (timing.library == "CLBlast") {
+          fprintf(stdout, ";%9.3lf;%9.3lf", timing.device.median, timing.overhead.median);
+        }
+      #endif
+    }
   }
   fprintf(stdout, "\n");
 }
 
+// Writes the full timing results as one record per library, either as CSV (with a header line
+// before the first record) or as JSON objects. Times are in milliseconds, without abbreviations.
+template <typename T, typename U>
+void Client<T,U>::WriteResults(FILE* file, const bool json, bool &first_record,
+                               const Arguments<U>& args, const std::vector<TimingResult>& timings) {
+  auto integers = std::vector<std::pair<std::string, size_t>>{};
+  auto strings = std::vector<std::pair<std::string, std::string>>{};
+  GetOptionValues(args, integers, strings);
+  const auto flops = get_flops_(args);
+  const auto bytes = get_bytes_(args);
+
+  // The names and values of all fields of a record
+  const auto statistics_names = std::vector<std::string>{"min", "mean", "median", "p90", "p99", "stddev"};
+  const auto time_to_string = [](const double time_ms) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.4lf", time_ms);
+    return std::string{buffer};
+  };
+  const auto statistics_values = [](const TimingStatistics &statistics) {
+    return std::vector<double>{statistics.min, statistics.mean, statistics.median,
+                               statistics.p90, statistics.p99, statistics.stddev};
+  };
+  for (const auto &timing : timings) {
+    auto names = std::vector<std::string>{"library", "precision", "num_runs"};
+    auto values = std::vector<std::string>{timing.library, ToString(static_cast<int>(args.precision)),
+                                           ToString(args.num_runs)};
+    for (const auto &integer : integers) { names.push_back(integer.first); values.push_back(ToString(integer.second)); }
+    for (const auto &string : strings) { names.push_back(string.first); values.push_back(string.second); }
+    names.push_back("GFLOPS");
+    values.push_back(ToString((timing.host.min != 0.0) ? (flops*1e-6)/timing.host.min : 0.0));
+    names.push_back("GBs");
+    values.push_back(ToString((timing.host.min != 0.0) ? (bytes*1e-6)/timing.host.min : 0.0));
+    const auto peaks = std::vector<std::pair<std::string, double>>{
+      {"peak_GFLOPS", peaks_.gflops}, {"peak_GBs", peaks_.gbs}
+    };
+    for (const auto &peak : peaks) {
+      names.push_back(peak.first);
+      values.push_back((peak.second > 0.0) ? ToString(peak.second) : ((json) ? "null" : ""));
+    }
+    const auto groups = std::vector<std::pair<std::string, const TimingStatistics*>>{
+      {"host_ms_", &timing.host}, {"device_ms_", &timing.device}, {"overhead_ms_", &timing.overhead}
+    };
+    for (const auto &group : groups) {
+      const auto group_values = statistics_values(*group.second);
+      for (auto i = size_t{0}; i < statistics_names.size(); ++i) {
+        names.push_back(group.first + statistics_names[i]);
+        const auto available = timing.has_device || group.second == &timing.host;
+        values.push_back((available) ? time_to_string(group_values[i]) : ((json) ? "null" : ""));
+      }
+    }
+
+    // Writes the record
+    if (json) {
+      fprintf(file, "%s  {", (first_record) ? "" : ",\n");
+      for (auto i = size_t{0}; i < names.size(); ++i) {
+        const auto quoted = (names[i] == "library" || names[i] == kArgAlpha || names[i] == kArgBeta);
+        fprintf(file, "%s\"%s\": %s%s%s", (i == 0) ? "" : ", ", names[i].c_str(),
+                (quoted) ? "\"" : "", values[i].c_str(), (quoted) ? "\"" : "");
+      }
+      fprintf(file, "}");
+    }
+    else {
+      if (first_record) {
+        for (auto i = size_t{0}; i < names.size(); ++i) {
+          fprintf(file, "%s%s", (i == 0) ? "" : ",", names[i].c_str());
+        }
+        fprintf(file, "\n");
+      }
+      for (auto i = size_t{0}; i < values.size(); ++i) {
+        fprintf(file, "%s%s", (i == 0) ? "" : ",", values[i].c_str());
+      }
+      fprintf(file, "\n");
+    }
+    first_record = false;
+  }
+  fflush(file);
+}
+
 // =================================================================================================
 
 // Compiles the templated class
@@ -24,6 +24,7 @@
 #include <string>
 #include <vector>
 #include <utility>
+#include <cstdio>
 
 #include "test/test_utilities.hpp"
 
@@ -37,6 +38,36 @@
 namespace clblast {
 // =================================================================================================
 
+// Statistics of the execution times of a number of runs (in milliseconds)
+struct TimingStatistics {
+  double min;
+  double mean;
+  double median;
+  double p90;
+  double p99;
+  double stddev;
+};
+TimingStatistics ComputeTimingStatistics(std::vector<double> timings);
+
+// The timing results of one library: the host wall-clock times and optionally (CLBlast with OpenCL
+// only) the device times of the kernels and the remaining host overhead of the API call itself
+struct TimingResult {
+  std::string library;
+  TimingStatistics host;
+  bool has_device;
+  TimingStatistics device;
+  TimingStatistics overhead;
+};
+
+// The peak performance of the device in GFLOPS and its peak memory bandwidth in GB/s (0 if unknown)
+struct DevicePeaks {
+  double gflops;
+  double gbs;
+};
+DevicePeaks EstimateDevicePeaks(const Device &device, const Precision precision);
+
+// =================================================================================================
+
 // See comment at top of file for a description of the class
 template <typename T, typename U>
 class Client {
@@ -70,17 +101,27 @@ class Client {
 
  private:
 
-  // Runs a function a given number of times and returns the execution time of the shortest instance
+  // Runs a function a given number of times and returns the statistics of the execution times,
+  // optionally including those of the device as reported through CLBlast's profiling callback
   template <typename BufferType, typename RoutineType>
-  double TimedExecution(const size_t num_runs, const Arguments<U> &args, BufferType &buffers,
-                        Queue &queue, RoutineType run_blas, const std::string &library_name);
+  TimingResult TimedExecution(const size_t num_runs, const Arguments<U> &args, BufferType &buffers,
+                              Queue &queue, RoutineType run_blas, const std::string &library_name,
+                              const bool device_timing = false);
+
+  // Retrieves the names and values of the routine-specific options
+  void GetOptionValues(const Arguments<U>& args,
+                       std::vector<std::pair<std::string, size_t>>& integers,
+                       std::vector<std::pair<std::string, std::string>>& strings);
 
   // Prints the header of a performance-data table
   void PrintTableHeader(const Arguments<U>& args);
 
   // Prints a row of performance data, including results of two libraries
-  void PrintTableRow(const Arguments<U>& args,
-                     const std::vector<std::pair<std::string, double>>& timings);
+  void PrintTableRow(const Arguments<U>& args, const std::vector<TimingResult>& timings);
+
+  // Writes the full timing results of all libraries to the output file as CSV or JSON records
+  void WriteResults(FILE* file, const bool json, bool &first_record, const Arguments<U>& args,
+                    const std::vector<TimingResult>& timings);
 
   // The routine-specific functions passed to the tester
   const Routine run_routine_;
@@ -95,6 +136,9 @@ class Client {
 
   // Extra arguments
   bool warm_up_; // if enabled, do a warm-up run first before measuring execution time
+  bool statistics_; // if enabled, prints the distribution of the execution times as well
+  std::string output_file_; // if set, writes all timing results to this CSV or JSON file
+  DevicePeaks peaks_; // if non-zero, prints the performance as a percentage of the device peaks
 };
 
 // =================================================================================================
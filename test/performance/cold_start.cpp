@@ -0,0 +1,149 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the 'clblast_bench_cold_start' benchmark, which measures the start-up
+// latency of the routines: the time to prepare all programs of a routine for a precision (as done
+// by the first call, see 'FillCache'). This is measured in three scenarios:
+// - 'cold': the in-memory caches are cleared and the on-disk cache is disabled, so everything is
+//   compiled from source;
+// - 'memory': the binaries are taken from the in-memory cache, e.g. for a new OpenCL context;
+// - 'disk': the in-memory caches are cleared, the binaries are taken from the on-disk cache in the
+//   directory given by '-cache_dir' (only if given).
+// Each scenario reports the total time and its split into phases as counted by 'GetStatistics':
+// searching the kernel parameters, assembling the source, the built-in pre-processor, the build
+// by the driver (e.g. 'clBuildProgram'), and creating the programs from binaries.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Prepares a routine in the current state of the caches a number of times and prints the average
+// of the times as a row of the table. Returns false in case of an error.
+template <typename Prepare>
+bool BenchmarkColdStart(const std::string &routine, const Precision precision,
+                        const std::string &scenario, const size_t num_runs, Prepare prepare) {
+  auto total_ms = 0.0;
+  auto totals = Statistics{};
+  for (auto run = size_t{0}; run < num_runs; ++run) {
+    auto status = ResetStatistics();
+    const auto start_time = std::chrono::steady_clock::now();
+    status = (status != StatusCode::kSuccess) ? status : prepare();
+    const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+    auto statistics = Statistics{};
+    status = (status != StatusCode::kSuccess) ? status : GetStatistics(statistics);
+    if (status != StatusCode::kSuccess) {
+      fprintf(stdout, "%12s;%9d;%9s; failed with status %d\n", routine.c_str(),
+              static_cast<int>(precision), scenario.c_str(), static_cast<int>(status));
+      return false;
+    }
+    total_ms += std::chrono::duration<double,std::milli>(elapsed_time).count();
+    totals.num_compilations += statistics.num_compilations;
+    totals.database_time_ms += statistics.database_time_ms;
+    totals.source_time_ms += statistics.source_time_ms;
+    totals.preprocessing_time_ms += statistics.preprocessing_time_ms;
+    totals.build_time_ms += statistics.build_time_ms;
+    totals.num_binary_loads += statistics.num_binary_loads;
+    totals.binary_load_time_ms += statistics.binary_load_time_ms;
+  }
+
+  // Prints the averages over the runs
+  const auto runs = static_cast<double>(num_runs);
+  const auto phases_ms = totals.database_time_ms + totals.source_time_ms +
+                         totals.preprocessing_time_ms + totals.build_time_ms +
+                         totals.binary_load_time_ms;
+  fprintf(stdout, "%12s;%9d;%9s;%9zu;%9zu;%9.2lf;%9.2lf;%9.2lf;%9.2lf;%9.2lf;%9.2lf;%9.2lf\n",
+          routine.c_str(), static_cast<int>(precision), scenario.c_str(),
+          totals.num_compilations / num_runs, totals.num_binary_loads / num_runs, total_ms / runs,
+          totals.database_time_ms / runs, totals.source_time_ms / runs,
+          totals.preprocessing_time_ms / runs, totals.build_time_ms / runs,
+          totals.binary_load_time_ms / runs, std::max(total_ms - phases_ms, 0.0) / runs);
+  return true;
+}
+
+// =================================================================================================
+
+void RunColdStartBenchmark(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto num_runs = GetArgument(arguments, help, kArgNumRuns, size_t{1});
+  const auto routines = split(GetArgument(arguments, help, "routines", std::string{"AXPY,DOT,GEMV,GEMM,SYRK,TRSM"}), ',');
+  const auto precision_list = split(GetArgument(arguments, help, "precisions", std::string{"32,64"}), ',');
+  const auto cache_dir = GetArgument(arguments, help, "cache_dir", std::string{""});
+  fprintf(stdout, "\n* %s\n", help.c_str());
+  if (num_runs == 0) { return; }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  auto precisions = std::vector<Precision>();
+  for (const auto &precision : precision_list) {
+    precisions.push_back(static_cast<Precision>(std::atoi(precision.c_str())));
+  }
+
+  // Runs all routines and precisions. The times are in milliseconds, averaged over the runs.
+  fprintf(stdout, "%12s;%9s;%9s;%9s;%9s;%9s;%9s;%9s;%9s;%9s;%9s;%9s\n", "routine", "precision",
+          "scenario", "compiles", "loads", "total", "database", "source", "preproc", "build",
+          "binary", "other");
+  for (const auto &routine : routines) {
+    for (const auto precision : precisions) {
+      const auto fill_cache = [&]() { return FillCache(device(), {routine}, {precision}); };
+
+      // Compiles from source: without binaries in memory or on disk
+      const auto clear_cache = [&]() {
+        const auto status = ClearCache();
+        return (status != StatusCode::kSuccess) ? status : fill_cache();
+      };
+      SetCacheDirectory("");
+      if (!BenchmarkColdStart(routine, precision, "cold", num_runs, clear_cache)) { continue; }
+
+      // Loads the binaries from the in-memory cache: 'FillCache' creates a new context each time
+      BenchmarkColdStart(routine, precision, "memory", num_runs, fill_cache);
+
+      // Loads the binaries from the on-disk cache, after making sure they are stored there
+      if (!cache_dir.empty()) {
+        auto status = SetCacheDirectory(cache_dir);
+        status = (status != StatusCode::kSuccess) ? status : clear_cache();
+        if (status != StatusCode::kSuccess) {
+          fprintf(stdout, "%12s;%9d;%9s; failed with status %d\n", routine.c_str(),
+                  static_cast<int>(precision), "disk", static_cast<int>(status));
+          SetCacheDirectory("");
+          continue;
+        }
+        BenchmarkColdStart(routine, precision, "disk", num_runs, clear_cache);
+        SetCacheDirectory("");
+      }
+    }
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::RunColdStartBenchmark(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
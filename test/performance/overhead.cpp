@@ -0,0 +1,154 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the 'clblast_bench_overhead' micro-benchmark, which measures the host-side
+// cost of a CLBlast call for problems so tiny that the kernels themselves hardly matter: GEMM from
+// 1x1x1 up to 64x64x64, and AXPY, DOT and GEMV from 1 up to 1024 elements. Each problem is called
+// in batches without synchronisation in between, after a warm-up call that compiles the kernels.
+// Per problem it reports the calls per second, the host time per call, and its split into phases
+// as counted by 'GetStatistics': the setup of the routine (database and program lookups),
+// retrieving the kernel objects, checking and enqueueing the kernels, and the remainder (e.g.
+// argument validation and setting the kernel arguments).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <chrono>
+#include <algorithm>
+#include <cstdio>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Runs a routine a number of times in batches and prints the results as a row of the table
+void BenchmarkOverhead(const std::string &routine_name, const size_t size, const size_t num_calls,
+                       Queue &queue, const std::function<StatusCode()> &run_routine) {
+  constexpr auto kBatchSize = size_t{100}; // calls between synchronisations, to bound the queue
+
+  // Warm-up to compile the kernels and to fill the caches
+  auto status = run_routine();
+  queue.Finish();
+  if (status != StatusCode::kSuccess) {
+    fprintf(stdout, "%9s;%9zu; failed with status %d\n", routine_name.c_str(), size,
+            static_cast<int>(status));
+    return;
+  }
+
+  // Times the calls themselves, excluding the synchronisations between the batches
+  ResetStatistics();
+  auto host_time_ns = 0.0;
+  for (auto call = size_t{0}; call < num_calls && status == StatusCode::kSuccess; call += kBatchSize) {
+    const auto batch_size = std::min(kBatchSize, num_calls - call);
+    const auto start_time = std::chrono::steady_clock::now();
+    for (auto i = size_t{0}; i < batch_size && status == StatusCode::kSuccess; ++i) {
+      status = run_routine();
+    }
+    const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+    host_time_ns += std::chrono::duration<double,std::nano>(elapsed_time).count();
+    queue.Finish();
+  }
+
+  // Retrieves the phases of all routines involved (including nested ones)
+  auto statistics = Statistics{};
+  status = (status != StatusCode::kSuccess) ? status : GetStatistics(statistics);
+  if (status != StatusCode::kSuccess) {
+    fprintf(stdout, "%9s;%9zu; failed with status %d\n", routine_name.c_str(), size,
+            static_cast<int>(status));
+    return;
+  }
+  auto setup_ms = 0.0;
+  auto kernel_ms = 0.0;
+  auto launch_ms = 0.0;
+  for (const auto &routine : statistics.routines) {
+    setup_ms += routine.second.setup_time_ms;
+    kernel_ms += routine.second.kernel_time_ms;
+    launch_ms += routine.second.launch_time_ms;
+  }
+  const auto routine = statistics.routines.find(routine_name);
+  const auto routine_ms = (routine != statistics.routines.end()) ? routine->second.host_time_ms : 0.0;
+  const auto other_ms = std::max(routine_ms - setup_ms - kernel_ms - launch_ms, 0.0);
+  const auto to_ns_per_call = 1.0e6 / static_cast<double>(num_calls);
+
+  // Prints the results
+  const auto ns_per_call = host_time_ns / static_cast<double>(num_calls);
+  fprintf(stdout, "%9s;%9zu;%9.0lf;%9.0lf;%9.0lf;%9.0lf;%9.0lf;%9.0lf\n", routine_name.c_str(), size,
+          1.0e9 / ns_per_call, ns_per_call, setup_ms * to_ns_per_call, kernel_ms * to_ns_per_call,
+          launch_ms * to_ns_per_call, other_ms * to_ns_per_call);
+}
+
+// =================================================================================================
+
+void RunOverheadBenchmark(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto num_calls = GetArgument(arguments, help, kArgNumRuns, size_t{10000});
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL and the largest buffers needed
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  const auto max_size = size_t{1024};
+  const auto host_data = std::vector<float>(max_size * max_size, 1.0f);
+  auto a = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto b = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto c = Buffer<float>(context, queue, host_data.begin(), host_data.end());
+  auto x = Buffer<float>(context, queue, host_data.begin(), host_data.begin() + max_size);
+  auto y = Buffer<float>(context, queue, host_data.begin(), host_data.begin() + max_size);
+  auto result = Buffer<float>(context, 1);
+  queue.Finish();
+
+  // Runs all problems. The times are in nanoseconds per call.
+  fprintf(stdout, "%9s;%9s;%9s;%9s;%9s;%9s;%9s;%9s\n", "routine", "size", "calls/s", "ns/call",
+          "setup", "kernel", "launch", "other");
+  for (const auto n : {size_t{1}, size_t{2}, size_t{4}, size_t{8}, size_t{16}, size_t{32}, size_t{64}}) {
+    BenchmarkOverhead("GEMM", n, num_calls, queue, [&]() {
+      return Gemm(Layout::kColMajor, Transpose::kNo, Transpose::kNo, n, n, n, 1.0f,
+                  a(), 0, n, b(), 0, n, 0.0f, c(), 0, n, &queue_plain);
+    });
+  }
+  for (const auto n : {size_t{1}, size_t{16}, size_t{64}, size_t{256}, size_t{1024}}) {
+    BenchmarkOverhead("AXPY", n, num_calls, queue, [&]() {
+      return Axpy(n, 2.0f, x(), 0, 1, y(), 0, 1, &queue_plain);
+    });
+  }
+  for (const auto n : {size_t{1}, size_t{16}, size_t{64}, size_t{256}, size_t{1024}}) {
+    BenchmarkOverhead("DOT", n, num_calls, queue, [&]() {
+      return Dot<float>(n, result(), 0, x(), 0, 1, y(), 0, 1, &queue_plain);
+    });
+  }
+  for (const auto n : {size_t{1}, size_t{16}, size_t{64}, size_t{256}, size_t{1024}}) {
+    BenchmarkOverhead("GEMV", n, num_calls, queue, [&]() {
+      return Gemv(Layout::kColMajor, Transpose::kNo, n, n, 1.0f, a(), 0, n, x(), 0, 1,
+                  0.0f, y(), 0, 1, &queue_plain);
+    });
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::RunOverheadBenchmark(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
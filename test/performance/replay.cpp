@@ -0,0 +1,315 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the 'clblast_bench_replay' benchmark, which replays a record of real calls
+// as written by CLBlast when the environmental variable CLBLAST_RECORD is set (see 'tracing.hpp').
+// The calls are replayed in their original order, '-runs' times, each call waiting for completion.
+// As in a typical application, the buffers are allocated once per precision and re-used by all
+// calls: they only grow when a call needs a larger one. It reports the total time and a per-shape
+// breakdown, sorted by the total time spent on the shape. The real-valued single and double
+// precision variants of the most common routines are supported, other calls are skipped.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <cstdlib>
+#include <cstdio>
+
+#include "test/routines/level1/xaxpy.hpp"
+#include "test/routines/level1/xcopy.hpp"
+#include "test/routines/level1/xscal.hpp"
+#include "test/routines/level1/xswap.hpp"
+#include "test/routines/level1/xdot.hpp"
+#include "test/routines/level1/xnrm2.hpp"
+#include "test/routines/level1/xasum.hpp"
+#include "test/routines/level2/xgemv.hpp"
+#include "test/routines/level2/xger.hpp"
+#include "test/routines/level2/xsymv.hpp"
+#include "test/routines/level2/xtrmv.hpp"
+#include "test/routines/level2/xtrsv.hpp"
+#include "test/routines/level3/xgemm.hpp"
+#include "test/routines/level3/xsymm.hpp"
+#include "test/routines/level3/xsyrk.hpp"
+#include "test/routines/level3/xsyr2k.hpp"
+#include "test/routines/level3/xtrmm.hpp"
+#include "test/routines/level3/xtrsm.hpp"
+#include "test/routines/levelx/xaxpybatched.hpp"
+#include "test/routines/levelx/xgemmbatched.hpp"
+#include "test/routines/levelx/xgemmstridedbatched.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// One call of the record: the routine name and precision, the integer arguments, and the shape
+// (the arguments as written in the record) which identifies the call in the breakdown
+struct RecordedCall {
+  std::string routine;
+  Precision precision;
+  std::vector<std::pair<std::string, size_t>> arguments;
+  std::string shape;
+};
+
+// Reads all calls of a record, skipping comments and empty lines
+std::vector<RecordedCall> ReadRecord(const std::string &file_name) {
+  std::ifstream file(file_name);
+  if (!file) { throw std::runtime_error("Unable to read the record '" + file_name + "'"); }
+  auto calls = std::vector<RecordedCall>();
+  auto line = std::string{};
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') { continue; }
+    std::istringstream stream(line);
+    auto call = RecordedCall{};
+    auto precision = 0;
+    if (!(stream >> call.routine >> precision)) {
+      throw std::runtime_error("Invalid line in the record: '" + line + "'");
+    }
+    call.precision = static_cast<Precision>(precision);
+    auto argument = std::string{};
+    while (stream >> argument) {
+      const auto separator = argument.find('=');
+      if (separator == std::string::npos) {
+        throw std::runtime_error("Invalid argument '" + argument + "' in the record");
+      }
+      const auto value = static_cast<size_t>(std::strtoull(argument.c_str() + separator + 1, nullptr, 10));
+      call.arguments.push_back({argument.substr(0, separator), value});
+      call.shape += (call.shape.empty() ? "" : " ") + argument;
+    }
+    calls.push_back(call);
+  }
+  return calls;
+}
+
+// Sets the arguments of the test-routine descriptions from a recorded call. Arguments which are
+// not part of 'Arguments' (e.g. the strides, which the descriptions derive from the sizes) are
+// ignored, as are the scalars (alpha and beta) which aren't recorded.
+template <typename T>
+void SetArguments(const RecordedCall &call, Arguments<T> &args) {
+  for (const auto &argument : call.arguments) {
+    const auto &name = argument.first;
+    const auto value = argument.second;
+    if (name == kArgM) { args.m = value; }
+    else if (name == kArgN) { args.n = value; }
+    else if (name == kArgK) { args.k = value; }
+    else if (name == kArgKU) { args.ku = value; }
+    else if (name == kArgKL) { args.kl = value; }
+    else if (name == "layout") { args.layout = static_cast<Layout>(value); }
+    else if (name == "a_transpose") { args.a_transpose = static_cast<Transpose>(value); }
+    else if (name == "b_transpose") { args.b_transpose = static_cast<Transpose>(value); }
+    else if (name == "side") { args.side = static_cast<Side>(value); }
+    else if (name == "triangle") { args.triangle = static_cast<Triangle>(value); }
+    else if (name == "diagonal") { args.diagonal = static_cast<Diagonal>(value); }
+    else if (name == "x_inc") { args.x_inc = value; }
+    else if (name == "y_inc") { args.y_inc = value; }
+    else if (name == "x_offset") { args.x_offset = value; }
+    else if (name == "y_offset") { args.y_offset = value; }
+    else if (name == "a_ld") { args.a_ld = value; }
+    else if (name == "b_ld") { args.b_ld = value; }
+    else if (name == "c_ld") { args.c_ld = value; }
+    else if (name == "a_offset") { args.a_offset = value; }
+    else if (name == "b_offset") { args.b_offset = value; }
+    else if (name == "c_offset") { args.c_offset = value; }
+    else if (name == "dot_offset") { args.dot_offset = value; }
+    else if (name == "nrm2_offset") { args.nrm2_offset = value; }
+    else if (name == "asum_offset") { args.asum_offset = value; }
+    else if (name == "batch_count") { args.batch_count = value; }
+  }
+}
+
+// =================================================================================================
+
+// Replays the calls of one precision. The buffers are shared by all calls and only re-allocated
+// (and initialized) when a call needs a larger one.
+template <typename T>
+class Replayer {
+ public:
+  Replayer(const Context &context, Queue &queue):
+      context_(context), queue_(queue),
+      buffers_{Buffer<T>(context, 1), Buffer<T>(context, 1), Buffer<T>(context, 1),
+               Buffer<T>(context, 1), Buffer<T>(context, 1), Buffer<T>(context, 1),
+               Buffer<T>(context, 1)},
+      capacities_(7, size_t{1}) {
+  }
+
+  // Replays a call and returns its time in milliseconds, or a negative value if the routine is
+  // not supported. Throws in case of an error.
+  double Replay(const RecordedCall &call) {
+    const auto &routine = call.routine;
+    if (routine == "AXPY") { return Run<TestXaxpy<T>>(call); }
+    if (routine == "COPY") { return Run<TestXcopy<T>>(call); }
+    if (routine == "SCAL") { return Run<TestXscal<T>>(call); }
+    if (routine == "SWAP") { return Run<TestXswap<T>>(call); }
+    if (routine == "DOT") { return Run<TestXdot<T>>(call); }
+    if (routine == "NRM2") { return Run<TestXnrm2<T>>(call); }
+    if (routine == "ASUM") { return Run<TestXasum<T>>(call); }
+    if (routine == "GEMV") { return Run<TestXgemv<T>>(call); }
+    if (routine == "GER") { return Run<TestXger<T>>(call); }
+    if (routine == "SYMV") { return Run<TestXsymv<T>>(call); }
+    if (routine == "TRMV") { return Run<TestXtrmv<T>>(call); }
+    if (routine == "TRSV") { return Run<TestXtrsv<T>>(call); }
+    if (routine == "GEMM") { return Run<TestXgemm<0, T>>(call); }
+    if (routine == "SYMM") { return Run<TestXsymm<T>>(call); }
+    if (routine == "SYRK") { return Run<TestXsyrk<T>>(call); }
+    if (routine == "SYR2K") { return Run<TestXsyr2k<T>>(call); }
+    if (routine == "TRMM") { return Run<TestXtrmm<T>>(call); }
+    if (routine == "TRSM") { return Run<TestXtrsm<T>>(call); }
+    if (routine == "AXPYBATCHED") { return Run<TestXaxpyBatched<T>>(call); }
+    if (routine == "GEMMBATCHED") { return Run<TestXgemmBatched<T>>(call); }
+    if (routine == "GEMMSTRIDEDBATCHED") { return Run<TestXgemmStridedBatched<T>>(call); }
+    return -1.0;
+  }
+
+ private:
+
+  // Runs a call through the description of the routine as used by the clients
+  template <typename C>
+  double Run(const RecordedCall &call) {
+    auto args = Arguments<T>{};
+    SetArguments(call, args);
+    C::SetSizes(args, queue_);
+    Reserve(buffers_.x_vec, capacities_[0], args.x_size);
+    Reserve(buffers_.y_vec, capacities_[1], args.y_size);
+    Reserve(buffers_.a_mat, capacities_[2], args.a_size);
+    Reserve(buffers_.b_mat, capacities_[3], args.b_size);
+    Reserve(buffers_.c_mat, capacities_[4], args.c_size);
+    Reserve(buffers_.ap_mat, capacities_[5], args.ap_size);
+    Reserve(buffers_.scalar, capacities_[6], args.scalar_size);
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto status = C::RunRoutine(args, buffers_, queue_);
+    const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+    if (status != StatusCode::kSuccess) {
+      throw std::runtime_error(call.routine + " " + call.shape + " failed with status " +
+                               ToString(static_cast<int>(status)));
+    }
+    return std::chrono::duration<double,std::milli>(elapsed_time).count();
+  }
+
+  // Grows a buffer to at least 'size' elements, initialized with small values
+  void Reserve(Buffer<T> &buffer, size_t &capacity, const size_t size) {
+    if (size <= capacity) { return; }
+    const auto host_data = std::vector<T>(size, ConstantOne<T>() / Constant<T>(16.0));
+    buffer = Buffer<T>(context_, size);
+    buffer.Write(queue_, size, host_data);
+    capacity = size;
+  }
+
+  const Context &context_;
+  Queue &queue_;
+  Buffers<T> buffers_;
+  std::vector<size_t> capacities_;
+};
+
+// =================================================================================================
+
+// The accumulated times of all calls of one shape
+struct ShapeTimes {
+  std::string routine;
+  Precision precision;
+  std::string shape;
+  size_t num_calls;
+  double total_ms;
+  double min_ms;
+};
+
+void RunReplayBenchmark(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto num_runs = GetArgument(arguments, help, kArgNumRuns, size_t{1});
+  const auto record_file = GetArgument(arguments, help, "record", std::string{""});
+  const auto warm_up = CheckArgument(arguments, help, kArgWarmUp);
+  fprintf(stdout, "\n* %s\n", help.c_str());
+  if (record_file.empty()) {
+    fprintf(stdout, "* Specify the record to replay with '-record <file>', e.g. as written by CLBlast\n"
+                    "  when running an application with the environmental variable CLBLAST_RECORD set\n");
+    return;
+  }
+  const auto calls = ReadRecord(record_file);
+
+  // Initializes OpenCL and the replayers of the supported precisions
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  Replayer<float> replayer_single(context, queue);
+  Replayer<double> replayer_double(context, queue);
+  const auto replay = [&](const RecordedCall &call) {
+    if (call.precision == Precision::kSingle) { return replayer_single.Replay(call); }
+    if (call.precision == Precision::kDouble) { return replayer_double.Replay(call); }
+    return -1.0;
+  };
+
+  // Optionally replays the record once untimed, to exclude the compilation and initialisation
+  if (warm_up) {
+    for (const auto &call : calls) { replay(call); }
+  }
+
+  // Replays the record and accumulates the times per shape
+  auto shapes = std::map<std::string, ShapeTimes>();
+  auto num_skipped = size_t{0};
+  auto num_replayed = size_t{0};
+  auto total_ms = 0.0;
+  for (auto run = size_t{0}; run < num_runs; ++run) {
+    for (const auto &call : calls) {
+      const auto time_ms = replay(call);
+      if (time_ms < 0.0) { ++num_skipped; continue; }
+      const auto key = call.routine + " " + ToString(static_cast<int>(call.precision)) + " " + call.shape;
+      auto inserted = shapes.insert({key, ShapeTimes{call.routine, call.precision, call.shape, 0, 0.0, time_ms}});
+      auto &times = inserted.first->second;
+      times.num_calls += 1;
+      times.total_ms += time_ms;
+      times.min_ms = std::min(times.min_ms, time_ms);
+      total_ms += time_ms;
+      ++num_replayed;
+    }
+  }
+
+  // Prints the breakdown per shape, the most time-consuming shapes first
+  auto sorted_shapes = std::vector<ShapeTimes>();
+  for (const auto &shape : shapes) { sorted_shapes.push_back(shape.second); }
+  std::sort(sorted_shapes.begin(), sorted_shapes.end(), [](const ShapeTimes &a, const ShapeTimes &b) {
+    return a.total_ms > b.total_ms;
+  });
+  fprintf(stdout, "* Replayed %zu call(s) of %zu shape(s) in %.3lf ms, skipped %zu unsupported call(s)\n\n",
+          num_replayed, sorted_shapes.size(), total_ms, num_skipped);
+  fprintf(stdout, "%18s;%9s;%9s;%9s;%9s;%9s;%9s; %s\n", "routine", "precision", "calls", "total_ms",
+          "mean_ms", "min_ms", "share", "shape");
+  for (const auto &shape : sorted_shapes) {
+    const auto share = (total_ms > 0.0) ? 100.0 * shape.total_ms / total_ms : 0.0;
+    fprintf(stdout, "%18s;%9d;%9zu;%9.3lf;%9.3lf;%9.3lf;%8.1lf%%; %s\n", shape.routine.c_str(),
+            static_cast<int>(shape.precision), shape.num_calls, shape.total_ms,
+            shape.total_ms / static_cast<double>(shape.num_calls), shape.min_ms, share,
+            shape.shape.c_str());
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  try {
+    clblast::RunReplayBenchmark(argc, argv);
+  } catch (std::runtime_error &e) {
+    fprintf(stderr, "* Error: %s\n", e.what());
+    return 1;
+  }
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,192 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the 'clblast_bench_threads' benchmark, which measures how CLBlast scales
+// with concurrent calls from multiple host threads, e.g. in a multi-tenant server. For 1, 2, 4, ...
+// up to '-threads' host threads, each thread issues '-runs' calls of a mix of small problems (GEMM
+// 32x32x32, GEMV 64x64, AXPY 256) on its own queue, or on a single shared queue with
+// '-shared_queue'. By default the calls are asynchronous, '-synchronous' waits for the completion
+// of each call. It reports the aggregate throughput and the distribution of the call latencies,
+// which exposes contention in the caches and in other global state.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+
+#include "utilities/utilities.hpp"
+#include "test/test_utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The buffers of one host thread, such that the threads don't write to each other's results
+struct ThreadBuffers {
+  Buffer<float> a;
+  Buffer<float> b;
+  Buffer<float> c;
+  Buffer<float> x;
+  Buffer<float> y;
+};
+
+// Runs one call of the mix of problems selected by 'index'
+StatusCode RunMixedCall(const size_t index, ThreadBuffers &buffers, RawCommandQueue &queue) {
+  switch (index % 3) {
+    case 0: return Gemm(Layout::kColMajor, Transpose::kNo, Transpose::kNo, 32, 32, 32, 1.0f,
+                        buffers.a(), 0, 32, buffers.b(), 0, 32, 0.0f, buffers.c(), 0, 32, &queue);
+    case 1: return Gemv(Layout::kColMajor, Transpose::kNo, 64, 64, 1.0f, buffers.a(), 0, 64,
+                        buffers.x(), 0, 1, 0.0f, buffers.y(), 0, 1, &queue);
+    default: return Axpy(256, 2.0f, buffers.x(), 0, 1, buffers.y(), 0, 1, &queue);
+  }
+}
+
+// Runs the benchmark for a number of threads and prints the results as a row of the table
+void BenchmarkThreads(const size_t num_threads, const size_t num_calls, const bool shared_queue,
+                      const bool synchronous, const Context &context, const Device &device) {
+  const auto buffer_size = size_t{64 * 64};
+  const auto host_data = std::vector<float>(buffer_size, 1.0f);
+
+  // Creates the queues and buffers of all threads
+  auto queues = std::vector<Queue>();
+  auto buffers = std::vector<ThreadBuffers>();
+  for (auto thread = size_t{0}; thread < num_threads; ++thread) {
+    if (thread == 0 || !shared_queue) { queues.push_back(Queue(context, device)); }
+    auto &queue = queues.back();
+    buffers.push_back(ThreadBuffers{
+      Buffer<float>(context, queue, host_data.begin(), host_data.end()),
+      Buffer<float>(context, queue, host_data.begin(), host_data.end()),
+      Buffer<float>(context, queue, host_data.begin(), host_data.end()),
+      Buffer<float>(context, queue, host_data.begin(), host_data.end()),
+      Buffer<float>(context, queue, host_data.begin(), host_data.end())
+    });
+  }
+  for (auto &queue : queues) { queue.Finish(); }
+
+  // Each thread does a warm-up call of each problem (kernel objects are per host thread), then
+  // waits for all other threads to start the timed calls at the same time
+  auto latencies = std::vector<std::vector<double>>(num_threads, std::vector<double>(num_calls));
+  auto failures = std::vector<StatusCode>(num_threads, StatusCode::kSuccess);
+  std::mutex mutex;
+  std::condition_variable condition;
+  auto num_ready = size_t{0};
+  auto start = false;
+  auto start_time = std::chrono::steady_clock::now();
+  const auto run_thread = [&](const size_t thread) {
+    auto &queue = queues[(shared_queue) ? 0 : thread];
+    auto queue_plain = queue();
+    auto status = StatusCode::kSuccess;
+    for (auto i = size_t{0}; i < 3 && status == StatusCode::kSuccess; ++i) {
+      status = RunMixedCall(i, buffers[thread], queue_plain);
+    }
+    queue.Finish();
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      ++num_ready;
+      condition.notify_all();
+      condition.wait(lock, [&]() { return start; });
+    }
+    for (auto call = size_t{0}; call < num_calls && status == StatusCode::kSuccess; ++call) {
+      const auto call_start_time = std::chrono::steady_clock::now();
+      status = RunMixedCall(call + thread, buffers[thread], queue_plain);
+      if (synchronous) { queue.Finish(); }
+      const auto elapsed_time = std::chrono::steady_clock::now() - call_start_time;
+      latencies[thread][call] = std::chrono::duration<double,std::micro>(elapsed_time).count();
+    }
+    queue.Finish();
+    failures[thread] = status;
+  };
+
+  // Starts the threads and the timer once all threads are ready
+  auto threads = std::vector<std::thread>();
+  for (auto thread = size_t{0}; thread < num_threads; ++thread) {
+    threads.push_back(std::thread(run_thread, thread));
+  }
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [&]() { return num_ready == num_threads; });
+    start = true;
+    start_time = std::chrono::steady_clock::now();
+    condition.notify_all();
+  }
+  for (auto &thread : threads) { thread.join(); }
+  const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+  const auto total_s = std::chrono::duration<double>(elapsed_time).count();
+  for (const auto failure : failures) {
+    if (failure != StatusCode::kSuccess) {
+      fprintf(stdout, "%9zu; failed with status %d\n", num_threads, static_cast<int>(failure));
+      return;
+    }
+  }
+
+  // Computes the throughput and the latency percentiles (nearest rank) over all calls
+  auto all_latencies = std::vector<double>();
+  for (const auto &thread_latencies : latencies) {
+    all_latencies.insert(all_latencies.end(), thread_latencies.begin(), thread_latencies.end());
+  }
+  std::sort(all_latencies.begin(), all_latencies.end());
+  const auto percentile = [&](const double p) {
+    const auto rank = static_cast<size_t>(p * static_cast<double>(all_latencies.size()) + 0.999999);
+    return all_latencies[std::max(rank, size_t{1}) - 1];
+  };
+  const auto calls_per_second = static_cast<double>(all_latencies.size()) / total_s;
+  fprintf(stdout, "%9zu;%9.0lf;%9.0lf;%9.1lf;%9.1lf;%9.1lf;%9.1lf\n", num_threads, calls_per_second,
+          calls_per_second / static_cast<double>(num_threads), percentile(0.5), percentile(0.9),
+          percentile(0.99), all_latencies.back());
+}
+
+// =================================================================================================
+
+void RunThreadsBenchmark(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto num_calls = GetArgument(arguments, help, kArgNumRuns, size_t{1000});
+  const auto default_threads = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), size_t{1});
+  const auto max_threads = GetArgument(arguments, help, "threads", default_threads);
+  const auto shared_queue = CheckArgument(arguments, help, "shared_queue");
+  const auto synchronous = CheckArgument(arguments, help, "synchronous");
+  fprintf(stdout, "\n* %s\n", help.c_str());
+  if (num_calls == 0) { return; }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+
+  // Runs for an increasing number of threads. Latencies are in microseconds per call.
+  fprintf(stdout, "%9s;%9s;%9s;%9s;%9s;%9s;%9s\n", "threads", "calls/s", "per_thrd",
+          "p50_us", "p90_us", "p99_us", "max_us");
+  for (auto num_threads = size_t{1}; num_threads <= max_threads; num_threads *= 2) {
+    BenchmarkThreads(num_threads, num_calls, shared_queue, synchronous, context, device);
+    if (num_threads < max_threads && num_threads * 2 > max_threads) {
+      BenchmarkThreads(max_threads, num_calls, shared_queue, synchronous, context, device);
+    }
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::RunThreadsBenchmark(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,161 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xrotmg routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XROTMG_H_
+#define CLBLAST_TEST_ROUTINES_XROTMG_H_
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXrotmg {
+ public:
+
+  // The BLAS level: 1, 2, or 3
+  static size_t BLASLevel() { return 1; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgDotOffset};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufScalar}; }
+  static std::vector<std::string> BuffersOut() { return {kBufScalar}; }
+
+  // Describes how to obtain the sizes of the buffers: the scalars 'sd1', 'sd2', 'sx1' and 'sy1' are
+  // stored consecutively in the scalar buffer, followed by the five values of 'sparam'
+  static size_t GetSizeScalar(const Arguments<T> &args) {
+    return 9 + args.dot_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args, Queue&) {
+    args.scalar_size = GetSizeScalar(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDB(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T> &) { return 1; } // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &) { return {}; } // N/A for this routine
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data: makes the weights 'sd1' and 'sd2' non-negative such
+  // that not all tests result in the trivial zero matrix
+  static void PrepareData(const Arguments<T> &args, Queue&, const int, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>& scalar_source) {
+    if (scalar_source.size() < args.scalar_size) { return; }
+    scalar_source[args.dot_offset] = std::abs(scalar_source[args.dot_offset]);
+    scalar_source[args.dot_offset + 1] = std::abs(scalar_source[args.dot_offset + 1]);
+  }
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    #ifdef OPENCL_API
+      auto queue_plain = queue();
+      auto event = cl_event{};
+      auto status = Rotmg<T>(buffers.scalar(), args.dot_offset,
+                             buffers.scalar(), args.dot_offset + 1,
+                             buffers.scalar(), args.dot_offset + 2,
+                             buffers.scalar(), args.dot_offset + 3,
+                             buffers.scalar(), args.dot_offset + 4,
+                             &queue_plain, &event);
+      if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    #elif CUDA_API
+      auto status = Rotmg<T>(buffers.scalar(), args.dot_offset,
+                             buffers.scalar(), args.dot_offset + 1,
+                             buffers.scalar(), args.dot_offset + 2,
+                             buffers.scalar(), args.dot_offset + 3,
+                             buffers.scalar(), args.dot_offset + 4,
+                             queue.GetContext()(), queue.GetDevice()());
+      cuStreamSynchronize(queue());
+    #endif
+    return status;
+  }
+
+  // Describes how to run the clBLAS routine (for correctness/performance comparison)
+  #ifdef CLBLAST_REF_CLBLAS
+    static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+      auto queue_plain = queue();
+      auto event = cl_event{};
+      auto status = clblasXrotmg<T>(buffers.scalar, args.dot_offset,
+                                    buffers.scalar, args.dot_offset + 1,
+                                    buffers.scalar, args.dot_offset + 2,
+                                    buffers.scalar, args.dot_offset + 3,
+                                    buffers.scalar, args.dot_offset + 4,
+                                    1, &queue_plain, 0, nullptr, &event);
+      clWaitForEvents(1, &event);
+      return static_cast<StatusCode>(status);
+    }
+  #endif
+
+  // Describes how to run the CPU BLAS routine (for correctness/performance comparison)
+  #ifdef CLBLAST_REF_CBLAS
+    static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue &) {
+      cblasXrotmg(buffers_host.scalar, args.dot_offset,
+                  buffers_host.scalar, args.dot_offset + 1,
+                  buffers_host.scalar, args.dot_offset + 2,
+                  buffers_host.scalar, args.dot_offset + 3,
+                  buffers_host.scalar, args.dot_offset + 4);
+      return StatusCode::kSuccess;
+    }
+  #endif
+
+  // Describes how to run the cuBLAS routine (for correctness/performance comparison)
+  #ifdef CLBLAST_REF_CUBLAS
+    static StatusCode RunReference3(const Arguments<T> &args, BuffersCUDA<T> &buffers, Queue &) {
+      auto status = cublasXrotmg<T>(reinterpret_cast<cublasHandle_t>(args.cublas_handle),
+                                    buffers.scalar, args.dot_offset,
+                                    buffers.scalar, args.dot_offset + 1,
+                                    buffers.scalar, args.dot_offset + 2,
+                                    buffers.scalar, args.dot_offset + 3,
+                                    buffers.scalar, args.dot_offset + 4);
+      if (status == CUBLAS_STATUS_SUCCESS) { return StatusCode::kSuccess; } else { return StatusCode::kUnknownError; }
+    }
+  #endif
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.scalar_size, static_cast<T>(0));
+    buffers.scalar.Read(queue, args.scalar_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &) { return 9; } // sd1, sd2, sx1, sy1 and sparam
+  static size_t ResultID2(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t) {
+    return args.dot_offset + id1;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &) {
+    return 16;
+  }
+  static size_t GetBytes(const Arguments<T> &) {
+    return 12 * sizeof(T);
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XROTMG_H_
+#endif
@@ -72,7 +72,10 @@ class TestXgemm {
       const auto switch_threshold = (V == 1) ? size_t{0} : size_t{4096}; // large enough for tests
       const auto override_status = OverrideParameters(device(), "GemmRoutine", PrecisionValue<T>(),
                                                       {{"XGEMM_MIN_INDIRECT_SIZE", switch_threshold}});
-      if (override_status != StatusCode::kSuccess) { }
+      if (override_status != StatusCode::kSuccess) {
+        throw std::runtime_error("OverrideParameters of 'GemmRoutine' failed with status " +
+                                 ToString(static_cast<int>(override_status)));
+      }
     }
 
     // Sets the size of the temporary buffer (optional argument to GEMM)
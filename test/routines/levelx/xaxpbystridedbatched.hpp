@@ -0,0 +1,164 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the XaxpbyStridedBatched routine.
+// Examples of such 'descriptions' are how to calculate the size a of buffer or how to run the
+// routine. These static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XAXPBYSTRIDEDBATCHED_H_
+#define CLBLAST_TEST_ROUTINES_XAXPBYSTRIDEDBATCHED_H_
+
+#include "test/routines/common.hpp"
+#include "test/routines/levelx/xaxpby.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXaxpbyStridedBatched {
+ public:
+
+  // The BLAS level: 4 for the extra routines (note: tested with matrix-size values for 'n')
+  static size_t BLASLevel() { return 4; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgN,
+            kArgXInc, kArgYInc,
+            kArgXOffset, kArgYOffset,
+            kArgAlpha, kArgBeta,
+            kArgBatchCount};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufVecX, kBufVecY}; }
+  static std::vector<std::string> BuffersOut() { return {kBufVecY}; }
+
+  // Helpers for the sizes per batch, which are also used as the strides
+  static size_t StrideX(const Arguments<T> &args) { return args.n * args.x_inc; }
+  static size_t StrideY(const Arguments<T> &args) { return args.n * args.y_inc; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<T> &args) {
+    return StrideX(args) * args.batch_count + args.x_offset;
+  }
+  static size_t GetSizeY(const Arguments<T> &args) {
+    return StrideY(args) * args.batch_count + args.y_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args, Queue&) {
+    args.x_size = GetSizeX(args);
+    args.y_size = GetSizeY(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDB(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T> &) { return 1; } // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &) { return {}; } // N/A for this routine
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {} // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    #ifdef OPENCL_API
+      auto queue_plain = queue();
+      auto event = cl_event{};
+      auto status = AxpbyStridedBatched(args.n, args.alpha,
+                                        buffers.x_vec(), args.x_offset, args.x_inc, StrideX(args),
+                                        args.beta,
+                                        buffers.y_vec(), args.y_offset, args.y_inc, StrideY(args),
+                                        args.batch_count,
+                                        &queue_plain, &event);
+      if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    #elif CUDA_API
+      auto status = AxpbyStridedBatched(args.n, args.alpha,
+                                        buffers.x_vec(), args.x_offset, args.x_inc, StrideX(args),
+                                        args.beta,
+                                        buffers.y_vec(), args.y_offset, args.y_inc, StrideY(args),
+                                        args.batch_count,
+                                        queue.GetContext()(), queue.GetDevice()());
+      cuStreamSynchronize(queue());
+    #endif
+    return status;
+  }
+
+  // Describes how to run a naive version of the routine (for correctness/performance comparison).
+  // Note that a proper clBLAS or CPU BLAS comparison is not available for non-BLAS routines.
+  static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto buffers_host = BuffersHost<T>();
+    DeviceToHost(args, buffers, buffers_host, queue, BuffersIn());
+    const auto status = RunReference(args, buffers_host);
+    HostToDevice(args, buffers, buffers_host, queue, BuffersOut());
+    return status;
+  }
+
+  static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue&) {
+    return RunReference(args, buffers_host);
+  }
+  static StatusCode RunReference3(const Arguments<T> &, BuffersCUDA<T> &, Queue &) {
+    return StatusCode::kUnknownError;
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.y_size, static_cast<T>(0));
+    buffers.y_vec.Read(queue, args.y_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) { return args.n; }
+  static size_t ResultID2(const Arguments<T> &args) { return args.batch_count; }
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t id2) {
+    return id1*args.y_inc + args.y_offset + id2*StrideY(args);
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return args.batch_count * TestXaxpby<T>::GetFlops(args);
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    return args.batch_count * TestXaxpby<T>::GetBytes(args);
+  }
+
+  static StatusCode RunReference(const Arguments<T> &args, BuffersHost<T> &buffers_host) {
+    TestXaxpby<T>::AxpbyReference(args, args.alpha, args.beta,
+                                  buffers_host.x_vec, buffers_host.y_vec,
+                                  StrideX(args), StrideY(args), args.batch_count);
+    return StatusCode::kSuccess;
+  }
+};
+
+// Half-precision version calling the above reference implementation after conversions
+template <>
+StatusCode TestXaxpbyStridedBatched<half>::RunReference(const Arguments<half> &args,
+                                                        BuffersHost<half> &buffers_host) {
+  const auto x = HalfToFloatBuffer(buffers_host.x_vec);
+  auto y = HalfToFloatBuffer(buffers_host.y_vec);
+  TestXaxpby<half>::AxpbyReference(args, HalfToFloat(args.alpha), HalfToFloat(args.beta), x, y,
+                                   StrideX(args), StrideY(args), args.batch_count);
+  FloatToHalfBuffer(buffers_host.y_vec, y);
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XAXPBYSTRIDEDBATCHED_H_
+#endif
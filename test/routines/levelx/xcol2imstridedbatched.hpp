@@ -0,0 +1,167 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xcol2imStridedBatched routine.
+// Examples of such 'descriptions' are how to calculate the size a of buffer or how to run the
+// routine. These static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XCOL2IMSTRIDEDBATCHED_H_
+#define CLBLAST_TEST_ROUTINES_XCOL2IMSTRIDEDBATCHED_H_
+
+#include "test/routines/common.hpp"
+#include "test/routines/levelx/xcol2im.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXcol2imStridedBatched {
+public:
+
+  // The BLAS level: 4 for the extra routines
+  static size_t BLASLevel() { return 4; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgChannels, kArgHeight, kArgWidth, kArgKernelH, kArgKernelW, kArgPadH, kArgPadW,
+            kArgStrideH, kArgStrideW, kArgDilationH, kArgDilationW,
+            kArgAOffset, kArgBOffset, kArgBatchCount};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufMatA, kBufMatB}; }
+  static std::vector<std::string> BuffersOut() { return {kBufMatB}; }
+
+  // Helpers for the sizes per batch, which are also used as the strides
+  static size_t ColStride(const Arguments<T> &args) { return TestXcol2im<T>::ColSize(args); }
+  static size_t ImStride(const Arguments<T> &args) { return TestXcol2im<T>::ImSize(args); }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeA(const Arguments<T> &args) {
+    return ColStride(args) * args.batch_count + args.a_offset;
+  }
+  static size_t GetSizeB(const Arguments<T> &args) {
+    return ImStride(args) * args.batch_count + args.b_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args, Queue&) {
+    args.a_size = GetSizeA(args);
+    args.b_size = GetSizeB(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDB(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T> &) { return 1; } // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &) { return {}; } // N/A for this routine
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {} // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    #ifdef OPENCL_API
+      auto queue_plain = queue();
+      auto event = cl_event{};
+      auto status = Col2imStridedBatched<T>(args.channels, args.height, args.width,
+                                            args.kernel_h, args.kernel_w,
+                                            args.pad_h, args.pad_w,
+                                            args.stride_h, args.stride_w,
+                                            args.dilation_h, args.dilation_w,
+                                            buffers.a_mat(), args.a_offset, ColStride(args),
+                                            buffers.b_mat(), args.b_offset, ImStride(args),
+                                            args.batch_count,
+                                            &queue_plain, &event);
+      if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    #elif CUDA_API
+      auto status = Col2imStridedBatched<T>(args.channels, args.height, args.width,
+                                            args.kernel_h, args.kernel_w,
+                                            args.pad_h, args.pad_w,
+                                            args.stride_h, args.stride_w,
+                                            args.dilation_h, args.dilation_w,
+                                            buffers.a_mat(), args.a_offset, ColStride(args),
+                                            buffers.b_mat(), args.b_offset, ImStride(args),
+                                            args.batch_count,
+                                            queue.GetContext()(), queue.GetDevice()());
+      cuStreamSynchronize(queue());
+    #endif
+    return status;
+  }
+
+  // Describes how to run a naive version of the routine (for correctness/performance comparison).
+  // Note that a proper clBLAS or CPU BLAS comparison is not available for non-BLAS routines.
+  static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto buffers_host = BuffersHost<T>();
+    DeviceToHost(args, buffers, buffers_host, queue, BuffersIn());
+    const auto status = RunReference(args, buffers_host);
+    HostToDevice(args, buffers, buffers_host, queue, BuffersOut());
+    return status;
+  }
+
+  static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue&) {
+    return RunReference(args, buffers_host);
+  }
+  static StatusCode RunReference3(const Arguments<T> &, BuffersCUDA<T> &, Queue &) {
+    return StatusCode::kUnknownError;
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.b_size, static_cast<T>(0));
+    buffers.b_mat.Read(queue, args.b_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) { return args.height * args.width; }
+  static size_t ResultID2(const Arguments<T> &args) { return args.channels * args.batch_count; }
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t id2) {
+    return id1 + args.height * args.width * id2 + args.b_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return args.batch_count * TestXcol2im<T>::GetFlops(args);
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    return args.batch_count * TestXcol2im<T>::GetBytes(args);
+  }
+
+  static StatusCode RunReference(const Arguments<T> &args, BuffersHost<T> &buffers_host) {
+    TestXcol2im<T>::Col2imReference(args, buffers_host.a_mat, buffers_host.b_mat,
+                                    ColStride(args), ImStride(args), args.batch_count);
+    return StatusCode::kSuccess;
+  }
+};
+
+// Half-precision version calling the above reference implementation after conversions
+template <>
+StatusCode TestXcol2imStridedBatched<half>::RunReference(const Arguments<half> &args,
+                                                         BuffersHost<half> &buffers_host) {
+  const auto col = HalfToFloatBuffer(buffers_host.a_mat);
+  auto im = HalfToFloatBuffer(buffers_host.b_mat);
+  TestXcol2im<half>::Col2imReference(args, col, im, ColStride(args), ImStride(args),
+                                     args.batch_count);
+  FloatToHalfBuffer(buffers_host.b_mat, im);
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XCOL2IMSTRIDEDBATCHED_H_
+#endif
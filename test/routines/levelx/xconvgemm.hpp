@@ -0,0 +1,230 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xconvgemm routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XCONVGEMM_H_
+#define CLBLAST_TEST_ROUTINES_XCONVGEMM_H_
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXconvgemm {
+public:
+
+  // The BLAS level: 4 for the extra routines
+  static size_t BLASLevel() { return 4; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgChannels, kArgHeight, kArgWidth, kArgKernelH, kArgKernelW, kArgPadH, kArgPadW,
+            kArgStrideH, kArgStrideW, kArgDilationH, kArgDilationW, kArgNumKernels, kArgBatchCount,
+            kArgAOffset, kArgBOffset, kArgCOffset};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufMatA, kBufMatB, kBufMatC}; }
+  static std::vector<std::string> BuffersOut() { return {kBufMatC}; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t OutputHeight(const Arguments<T> &args) {
+    const auto size = args.height + 2 * args.pad_h;
+    const auto padding = args.dilation_h * (args.kernel_h - 1) + 1;
+    if (size >= padding) { return (size - padding) / args.stride_h + 1; }
+    return 1;
+  }
+  static size_t OutputWidth(const Arguments<T> &args) {
+    const auto size = args.width + 2 * args.pad_w;
+    const auto padding = args.dilation_w * (args.kernel_w - 1) + 1;
+    if (size >= padding) { return (size - padding) / args.stride_w + 1; }
+    return 1;
+  }
+  static size_t NumPatches(const Arguments<T> &args) {
+    return OutputHeight(args) * OutputWidth(args);
+  }
+  static size_t PatchSize(const Arguments<T> &args) {
+    return args.channels * args.kernel_h * args.kernel_w;
+  }
+  static size_t GetSizeA(const Arguments<T> &args) { // 4D: NCHW == batch-channel-height-width
+    return args.batch_count * args.channels * args.height * args.width + args.a_offset;
+  }
+  static size_t GetSizeB(const Arguments<T> &args) { // 4D: KCHW == kernel-channel-height-width
+    return args.num_kernels * PatchSize(args) + args.b_offset;
+  }
+  static size_t GetSizeC(const Arguments<T> &args) { // 4D: NCHW == batch-kernel-height-width
+    return args.batch_count * args.num_kernels * NumPatches(args) + args.c_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args, Queue&) {
+    args.a_size = GetSizeA(args);
+    args.b_size = GetSizeB(args);
+    args.c_size = GetSizeC(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDB(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T> &) { return 1; } // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &) { return {}; } // N/A for this routine
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {} // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    #ifdef OPENCL_API
+      auto queue_plain = queue();
+      auto event = cl_event{};
+      auto status = Convgemm<T>(args.channels, args.height, args.width,
+                                args.kernel_h, args.kernel_w,
+                                args.pad_h, args.pad_w,
+                                args.stride_h, args.stride_w,
+                                args.dilation_h, args.dilation_w,
+                                args.num_kernels, args.batch_count,
+                                buffers.a_mat(), args.a_offset,
+                                buffers.b_mat(), args.b_offset,
+                                buffers.c_mat(), args.c_offset,
+                                &queue_plain, &event);
+      if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    #elif CUDA_API
+      auto status = Convgemm<T>(args.channels, args.height, args.width,
+                                args.kernel_h, args.kernel_w,
+                                args.pad_h, args.pad_w,
+                                args.stride_h, args.stride_w,
+                                args.dilation_h, args.dilation_w,
+                                args.num_kernels, args.batch_count,
+                                buffers.a_mat(), args.a_offset,
+                                buffers.b_mat(), args.b_offset,
+                                buffers.c_mat(), args.c_offset,
+                                queue.GetContext()(), queue.GetDevice()());
+      cuStreamSynchronize(queue());
+    #endif
+    return status;
+  }
+
+  // Describes how to run a naive version of the routine (for correctness/performance comparison).
+  // Note that a proper clBLAS or CPU BLAS comparison is not available for non-BLAS routines.
+  static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto buffers_host = BuffersHost<T>();
+    DeviceToHost(args, buffers, buffers_host, queue, BuffersIn());
+    const auto status = RunReference(args, buffers_host);
+    HostToDevice(args, buffers, buffers_host, queue, BuffersOut());
+    return status;
+  }
+
+  static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue&) {
+    return RunReference(args, buffers_host);
+  }
+  static StatusCode RunReference3(const Arguments<T> &, BuffersCUDA<T> &, Queue &) {
+    return StatusCode::kUnknownError;
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.c_size, static_cast<T>(0));
+    buffers.c_mat.Read(queue, args.c_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) { return NumPatches(args) * args.num_kernels; }
+  static size_t ResultID2(const Arguments<T> &args) { return args.batch_count; }
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t id2) {
+    return id1 + NumPatches(args) * args.num_kernels * id2 + args.c_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    const auto patches = NumPatches(args);
+    return args.batch_count * 2 * patches * args.num_kernels * PatchSize(args);
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    const auto input = args.batch_count * args.channels * args.height * args.width;
+    const auto kernel = args.num_kernels * PatchSize(args);
+    const auto output = args.batch_count * args.num_kernels * NumPatches(args);
+    return (input + kernel + output) * sizeof(T);
+  }
+
+  // Host reference: an explicit convolution loop without the im2col matrix
+  template <typename V>
+  static void ConvolutionReference(const Arguments<T> &args, const std::vector<V> &im,
+                                   const std::vector<V> &kernel, std::vector<V> &result) {
+    const auto output_h = OutputHeight(args);
+    const auto output_w = OutputWidth(args);
+    for (auto batch_id = size_t{0}; batch_id < args.batch_count; ++batch_id) {
+      for (auto kernel_id = size_t{0}; kernel_id < args.num_kernels; ++kernel_id) {
+        for (auto h_id = size_t{0}; h_id < output_h; ++h_id) { // output height
+          for (auto w_id = size_t{0}; w_id < output_w; ++w_id) { // output width
+            auto sum = V{0};
+            for (auto c_id = size_t{0}; c_id < args.channels; ++c_id) { // input channels
+              for (auto kh_id = size_t{0}; kh_id < args.kernel_h; ++kh_id) { // kernel height
+                for (auto kw_id = size_t{0}; kw_id < args.kernel_w; ++kw_id) { // kernel width
+
+                  // Retrieves the input value (zero in the padded regions)
+                  const auto h_index = static_cast<int>(kh_id * args.dilation_h + args.stride_h * h_id) -
+                                       static_cast<int>(args.pad_h);
+                  const auto w_index = static_cast<int>(kw_id * args.dilation_w + args.stride_w * w_id) -
+                                       static_cast<int>(args.pad_w);
+                  if (h_index < 0 || h_index >= static_cast<int>(args.height) ||
+                      w_index < 0 || w_index >= static_cast<int>(args.width)) { continue; }
+                  const auto input_index = w_index + args.width * (h_index + args.height *
+                                           (c_id + args.channels * batch_id));
+                  const auto kernel_index = kw_id + args.kernel_w * (kh_id + args.kernel_h *
+                                            (c_id + args.channels * kernel_id));
+                  sum += im[input_index + args.a_offset] * kernel[kernel_index + args.b_offset];
+                }
+              }
+            }
+
+            // Sets the output value
+            const auto output_index = w_id + output_w * (h_id + output_h *
+                                      (kernel_id + args.num_kernels * batch_id));
+            result[output_index + args.c_offset] = sum;
+          }
+        }
+      }
+    }
+  }
+
+  static StatusCode RunReference(const Arguments<T> &args, BuffersHost<T> &buffers_host) {
+    ConvolutionReference(args, buffers_host.a_mat, buffers_host.b_mat, buffers_host.c_mat);
+    return StatusCode::kSuccess;
+  }
+};
+
+// Half-precision version calling the above reference implementation after conversions
+template <>
+StatusCode TestXconvgemm<half>::RunReference(const Arguments<half> &args,
+                                             BuffersHost<half> &buffers_host) {
+  const auto im = HalfToFloatBuffer(buffers_host.a_mat);
+  const auto kernel = HalfToFloatBuffer(buffers_host.b_mat);
+  auto result = HalfToFloatBuffer(buffers_host.c_mat);
+  ConvolutionReference(args, im, kernel, result);
+  FloatToHalfBuffer(buffers_host.c_mat, result);
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XCONVGEMM_H_
+#endif
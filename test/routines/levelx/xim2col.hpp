@@ -54,11 +54,17 @@ public:
   static size_t NumPatches(const Arguments<T> &args) {
     return OutputHeight(args) * OutputWidth(args) * args.channels;
   }
+  static size_t ImSize(const Arguments<T> &args) {
+    return args.height * args.width * args.channels;
+  }
+  static size_t ColSize(const Arguments<T> &args) {
+    return args.kernel_w * args.kernel_h * NumPatches(args);
+  }
   static size_t GetSizeA(const Arguments<T> &args) {
-    return args.height * args.width * args.channels + args.a_offset;
+    return ImSize(args) + args.a_offset;
   }
   static size_t GetSizeB(const Arguments<T> &args) {
-    return args.kernel_w * args.kernel_h * NumPatches(args) + args.b_offset;
+    return ColSize(args) + args.b_offset;
   }
 
   // Describes how to set the sizes of all the buffers
@@ -150,43 +156,49 @@ public:
     const auto output = args.kernel_h * args.kernel_w * NumPatches(args);
     return (input + output) * sizeof(T);
   }
-};
-
-// =================================================================================================
 
-template <typename T>
-StatusCode RunReference(const Arguments<T> &args, BuffersHost<T> &buffers_host) {
-  const auto output_h = TestXim2col<T>::OutputHeight(args);
-  const auto output_w = TestXim2col<T>::OutputWidth(args);
-  for (auto c_id = size_t{0}; c_id < args.channels; ++c_id) { // input channels
-    for (auto kh_id = size_t{0}; kh_id < args.kernel_h; ++kh_id) { // kernel height
-      for (auto kw_id = size_t{0}; kw_id < args.kernel_w; ++kw_id) { // kernel width
-        for (auto h_id = size_t{0}; h_id < output_h; ++h_id) { // image height
-          for (auto w_id = size_t{0}; w_id < output_w; ++w_id) { // image width
-
-            // Retrieves the input value
-            const auto h_index = kh_id * args.dilation_h + args.stride_h * h_id - args.pad_h;
-            const auto w_index = kw_id * args.dilation_w + args.stride_w * w_id - args.pad_w;
-            auto val = ConstantZero<T>();
-            if (h_index >= 0 && h_index < args.height &&
-                w_index >= 0 && w_index < args.width) {
-              const auto input_index = w_index + args.width * (h_index + args.height * c_id);
-              val = buffers_host.a_mat[input_index + args.a_offset];
+  // Host reference. The batches are located 'im_stride' and 'col_stride' elements apart.
+  static void Im2colReference(const Arguments<T> &args, const std::vector<T> &im, std::vector<T> &col,
+                              const size_t im_stride, const size_t col_stride,
+                              const size_t batch_count) {
+    const auto output_h = OutputHeight(args);
+    const auto output_w = OutputWidth(args);
+    for (auto batch_id = size_t{0}; batch_id < batch_count; ++batch_id) {
+      for (auto c_id = size_t{0}; c_id < args.channels; ++c_id) { // input channels
+        for (auto kh_id = size_t{0}; kh_id < args.kernel_h; ++kh_id) { // kernel height
+          for (auto kw_id = size_t{0}; kw_id < args.kernel_w; ++kw_id) { // kernel width
+            for (auto h_id = size_t{0}; h_id < output_h; ++h_id) { // image height
+              for (auto w_id = size_t{0}; w_id < output_w; ++w_id) { // image width
+
+                // Retrieves the input value
+                const auto h_index = kh_id * args.dilation_h + args.stride_h * h_id - args.pad_h;
+                const auto w_index = kw_id * args.dilation_w + args.stride_w * w_id - args.pad_w;
+                auto val = ConstantZero<T>();
+                if (h_index >= 0 && h_index < args.height &&
+                    w_index >= 0 && w_index < args.width) {
+                  const auto input_index = w_index + args.width * (h_index + args.height * c_id);
+                  val = im[input_index + args.a_offset + batch_id * im_stride];
+                }
+
+                // Sets the output value
+                const auto kernel_index = kw_id + args.kernel_w * kh_id;
+                const auto patch_index = w_id + output_w * h_id;
+                const auto output_index = patch_index + kernel_index * output_w * output_h +
+                                          c_id * output_w * output_h * args.kernel_h * args.kernel_w;
+                col[output_index + args.b_offset + batch_id * col_stride] = val;
+              }
             }
-
-            // Sets the output value
-            const auto kernel_index = kw_id + args.kernel_w * kh_id;
-            const auto patch_index = w_id + output_w * h_id;
-            const auto output_index = patch_index + kernel_index * output_w * output_h +
-                                      c_id * output_w * output_h * args.kernel_h * args.kernel_w;
-            buffers_host.b_mat[output_index + args.b_offset] = val;
           }
         }
       }
     }
   }
-  return StatusCode::kSuccess;
-}
+
+  static StatusCode RunReference(const Arguments<T> &args, BuffersHost<T> &buffers_host) {
+    Im2colReference(args, buffers_host.a_mat, buffers_host.b_mat, 0, 0, 1);
+    return StatusCode::kSuccess;
+  }
+};
 
 // =================================================================================================
 } // namespace clblast
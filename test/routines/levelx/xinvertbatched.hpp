@@ -0,0 +1,203 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the XinvertBatched routine. Examples
+// of such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XINVERTBATCHED_H_
+#define CLBLAST_TEST_ROUTINES_XINVERTBATCHED_H_
+
+#include "test/routines/common.hpp"
+#include "test/routines/level3/xtrsm_data.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXinvertBatched {
+ public:
+
+  // The BLAS level: 4 for the extra routines
+  static size_t BLASLevel() { return 4; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgN,
+            kArgLayout, kArgTriangle, kArgDiagonal,
+            kArgALeadDim, kArgBLeadDim,
+            kArgAOffset, kArgBOffset,
+            kArgBatchCount};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufMatA, kBufMatB}; }
+  static std::vector<std::string> BuffersOut() { return {kBufMatB}; }
+
+  // Helper for the sizes per batch
+  static size_t PerBatchSizeA(const Arguments<T> &args) { return args.n * args.a_ld; }
+  static size_t PerBatchSizeB(const Arguments<T> &args) { return args.n * args.b_ld; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeA(const Arguments<T> &args) {
+    return PerBatchSizeA(args) * args.batch_count + args.a_offset;
+  }
+  static size_t GetSizeB(const Arguments<T> &args) {
+    return PerBatchSizeB(args) * args.batch_count + args.b_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args, Queue&) {
+    args.a_size = GetSizeA(args);
+    args.b_size = GetSizeB(args);
+
+    // Also sets the batch-related variables
+    args.a_offsets = std::vector<size_t>(args.batch_count);
+    args.b_offsets = std::vector<size_t>(args.batch_count);
+    for (auto batch = size_t{0}; batch < args.batch_count; ++batch) {
+      args.a_offsets[batch] = batch * PerBatchSizeA(args) + args.a_offset;
+      args.b_offsets[batch] = batch * PerBatchSizeB(args) + args.b_offset;
+    }
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &args) { return args.n; }
+  static size_t DefaultLDB(const Arguments<T> &args) { return args.n; }
+  static size_t DefaultLDC(const Arguments<T> &) { return 1; } // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &) { return {}; } // N/A for this routine
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data: well-conditioned triangular matrices as for TRSM
+  static void PrepareData(const Arguments<T> &args, Queue&, const int seed,
+                          std::vector<T>&, std::vector<T>&,
+                          std::vector<T>& a_source_, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {
+    if (args.a_ld < args.n) { return; }
+    if (args.a_size <= 0) { return; }
+    auto trsm_args = args;
+    trsm_args.side = Side::kLeft;
+    trsm_args.m = args.n;
+    trsm_args.b_ld = args.n;
+    auto dummy_b = std::vector<T>(args.n * args.n);
+    for (auto batch = size_t{0}; batch < args.batch_count; ++batch) {
+      GenerateProperTrsmMatrices(trsm_args, seed + static_cast<int>(batch),
+                                 &a_source_[args.a_offsets[batch]], dummy_b.data());
+    }
+  }
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    #ifdef OPENCL_API
+      auto queue_plain = queue();
+      auto event = cl_event{};
+      auto status = InvertBatched<T>(args.layout, args.triangle, args.diagonal, args.n,
+                                     buffers.a_mat(), args.a_offsets.data(), args.a_ld,
+                                     buffers.b_mat(), args.b_offsets.data(), args.b_ld,
+                                     args.batch_count,
+                                     &queue_plain, &event);
+      if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    #elif CUDA_API
+      auto status = InvertBatched<T>(args.layout, args.triangle, args.diagonal, args.n,
+                                     buffers.a_mat(), args.a_offsets.data(), args.a_ld,
+                                     buffers.b_mat(), args.b_offsets.data(), args.b_ld,
+                                     args.batch_count,
+                                     queue.GetContext()(), queue.GetDevice()());
+      cuStreamSynchronize(queue());
+    #endif
+    return status;
+  }
+
+  // Describes how to run a naive version of the routine (for correctness/performance comparison).
+  // Note that a proper clBLAS or CPU BLAS comparison is not available for non-BLAS routines.
+  static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto buffers_host = BuffersHost<T>();
+    DeviceToHost(args, buffers, buffers_host, queue, BuffersIn());
+    const auto status = RunReference(args, buffers_host);
+    HostToDevice(args, buffers, buffers_host, queue, BuffersOut());
+    return status;
+  }
+
+  static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue&) {
+    return RunReference(args, buffers_host);
+  }
+  static StatusCode RunReference3(const Arguments<T> &, BuffersCUDA<T> &, Queue &) {
+    return StatusCode::kUnknownError;
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.b_size, static_cast<T>(0));
+    buffers.b_mat.Read(queue, args.b_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) { return args.n; }
+  static size_t ResultID2(const Arguments<T> &args) { return args.n * args.batch_count; }
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t id2_3) {
+    const size_t id2 = id2_3 % args.n;
+    const size_t id3 = id2_3 / args.n;
+    return (args.layout == Layout::kRowMajor) ?
+           id1*args.b_ld + id2 + args.b_offsets[id3]:
+           id2*args.b_ld + id1 + args.b_offsets[id3];
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return args.batch_count * (args.n * args.n * args.n) / 3;
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    return args.batch_count * (args.n * args.n) * sizeof(T);
+  }
+
+  // Reference implementation: computes the inverses column by column through substitution
+  static StatusCode RunReference(const Arguments<T> &args, BuffersHost<T> &buffers_host) {
+    const auto n = args.n;
+    const auto is_lower = (args.triangle == Triangle::kLower);
+    for (auto batch = size_t{0}; batch < args.batch_count; ++batch) {
+      const auto a = [&](const size_t i, const size_t j) {
+        return GetElement<T>(args.layout, i, j, &buffers_host.a_mat[args.a_offsets[batch]], args.a_ld);
+      };
+      auto inverse = std::vector<T>(n * n, ConstantZero<T>());
+      for (auto j = size_t{0}; j < n; ++j) {
+        inverse[j * n + j] = (args.diagonal == Diagonal::kUnit) ? ConstantOne<T>() : ConstantOne<T>() / a(j, j);
+        for (auto step = size_t{1}; step < n; ++step) {
+          if (is_lower && j + step >= n) { break; }
+          if (!is_lower && step > j) { break; }
+          const auto i = (is_lower) ? j + step : j - step;
+          auto sum = ConstantZero<T>();
+          const auto k_start = (is_lower) ? j : i + 1;
+          const auto k_end = (is_lower) ? i : j + 1;
+          for (auto k = k_start; k < k_end; ++k) {
+            sum += a(i, k) * inverse[j * n + k];
+          }
+          const auto diagonal = (args.diagonal == Diagonal::kUnit) ? ConstantOne<T>() : a(i, i);
+          inverse[j * n + i] = -sum / diagonal;
+        }
+      }
+      for (auto j = size_t{0}; j < n; ++j) {
+        for (auto i = size_t{0}; i < n; ++i) {
+          SetElement<T>(args.layout, i, j, &buffers_host.b_mat[args.b_offsets[batch]], args.b_ld,
+                        inverse[j * n + i]);
+        }
+      }
+    }
+    return StatusCode::kSuccess;
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XINVERTBATCHED_H_
+#endif
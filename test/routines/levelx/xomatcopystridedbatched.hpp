@@ -0,0 +1,163 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the XomatcopyStridedBatched
+// routine. Examples of such 'descriptions' are how to calculate the size a of buffer or how to run
+// the routine. These static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XOMATCOPYSTRIDEDBATCHED_H_
+#define CLBLAST_TEST_ROUTINES_XOMATCOPYSTRIDEDBATCHED_H_
+
+#include "test/routines/common.hpp"
+#include "test/routines/levelx/xomatcopy.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXomatcopyStridedBatched {
+ public:
+
+  // The BLAS level: 4 for the extra routines
+  static size_t BLASLevel() { return 4; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgM, kArgN,
+            kArgLayout, kArgATransp,
+            kArgALeadDim, kArgBLeadDim,
+            kArgAOffset, kArgBOffset,
+            kArgBatchCount, kArgAlpha};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufMatA, kBufMatB}; }
+  static std::vector<std::string> BuffersOut() { return {kBufMatB}; }
+
+  // Helpers for the sizes per batch, which are also used as the strides
+  static size_t StrideA(const Arguments<T> &args) {
+    return TestXomatcopy<T>::GetSizeA(args) - args.a_offset;
+  }
+  static size_t StrideB(const Arguments<T> &args) {
+    return TestXomatcopy<T>::GetSizeB(args) - args.b_offset;
+  }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeA(const Arguments<T> &args) {
+    return StrideA(args) * args.batch_count + args.a_offset;
+  }
+  static size_t GetSizeB(const Arguments<T> &args) {
+    return StrideB(args) * args.batch_count + args.b_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args, Queue&) {
+    args.a_size = GetSizeA(args);
+    args.b_size = GetSizeB(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &args) { return args.n; }
+  static size_t DefaultLDB(const Arguments<T> &args) { return args.m; }
+  static size_t DefaultLDC(const Arguments<T> &) { return 1; } // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &all) { return all; }
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {} // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    #ifdef OPENCL_API
+      auto queue_plain = queue();
+      auto event = cl_event{};
+      auto status = OmatcopyStridedBatched<T>(args.layout, args.a_transpose,
+                                              args.m, args.n, args.alpha,
+                                              buffers.a_mat(), args.a_offset, args.a_ld, StrideA(args),
+                                              buffers.b_mat(), args.b_offset, args.b_ld, StrideB(args),
+                                              args.batch_count,
+                                              &queue_plain, &event);
+      if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    #elif CUDA_API
+      auto status = OmatcopyStridedBatched<T>(args.layout, args.a_transpose,
+                                              args.m, args.n, args.alpha,
+                                              buffers.a_mat(), args.a_offset, args.a_ld, StrideA(args),
+                                              buffers.b_mat(), args.b_offset, args.b_ld, StrideB(args),
+                                              args.batch_count,
+                                              queue.GetContext()(), queue.GetDevice()());
+      cuStreamSynchronize(queue());
+    #endif
+    return status;
+  }
+
+  // Describes how to run a naive version of the routine (for correctness/performance comparison).
+  // Note that a proper clBLAS or CPU BLAS comparison is not available for non-BLAS routines.
+  static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto buffers_host = BuffersHost<T>();
+    DeviceToHost(args, buffers, buffers_host, queue, BuffersIn());
+    const auto status = RunReferenceBatched(args, buffers_host);
+    HostToDevice(args, buffers, buffers_host, queue, BuffersOut());
+    return status;
+  }
+
+  static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue&) {
+    return RunReferenceBatched(args, buffers_host);
+  }
+  static StatusCode RunReference3(const Arguments<T> &, BuffersCUDA<T> &, Queue &) {
+    return StatusCode::kUnknownError;
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.b_size, static_cast<T>(0));
+    buffers.b_mat.Read(queue, args.b_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer: the columns of all batches follow
+  // each other in the second dimension
+  static size_t ResultID1(const Arguments<T> &args) { return args.m; }
+  static size_t ResultID2(const Arguments<T> &args) { return args.n * args.batch_count; }
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t id2) {
+    return TestXomatcopy<T>::GetResultIndex(args, id1, id2 % args.n) +
+           (id2 / args.n) * StrideB(args);
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return args.batch_count * TestXomatcopy<T>::GetFlops(args);
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    return args.batch_count * TestXomatcopy<T>::GetBytes(args);
+  }
+
+  // The reference implementation: the regular OMATCOPY reference for each of the batches
+  static StatusCode RunReferenceBatched(const Arguments<T> &args, BuffersHost<T> &buffers_host) {
+    auto args_batch = args;
+    for (auto batch = size_t{0}; batch < args.batch_count; ++batch) {
+      args_batch.a_offset = args.a_offset + batch * StrideA(args);
+      args_batch.b_offset = args.b_offset + batch * StrideB(args);
+      const auto status = RunReference(args_batch, buffers_host);
+      if (status != StatusCode::kSuccess) { return status; }
+    }
+    return StatusCode::kSuccess;
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XOMATCOPYSTRIDEDBATCHED_H_
+#endif
@@ -0,0 +1,184 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xpotrf routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XPOTRF_H_
+#define CLBLAST_TEST_ROUTINES_XPOTRF_H_
+
+#include <cmath>
+
+#include "test/routines/common.hpp"
+#include "test/routines/level3/xtrsm_data.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXpotrf {
+ public:
+
+  // The BLAS level: 4 for the extra routines
+  static size_t BLASLevel() { return 4; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgN,
+            kArgLayout, kArgTriangle,
+            kArgALeadDim, kArgAOffset};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufMatA}; }
+  static std::vector<std::string> BuffersOut() { return {kBufMatA}; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeA(const Arguments<T> &args) {
+    return args.n * args.a_ld + args.a_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args, Queue&) {
+    args.a_size = GetSizeA(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &args) { return args.n; }
+  static size_t DefaultLDB(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T> &) { return 1; } // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &) { return {}; } // N/A for this routine
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data: a symmetric positive-definite matrix
+  static void PrepareData(const Arguments<T> &args, Queue&, const int seed,
+                          std::vector<T>&, std::vector<T>&,
+                          std::vector<T>& a_source_, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {
+    if (args.a_ld < args.n) { return; }
+    if (args.a_size <= 0) { return; }
+    GeneratePositiveDefiniteMatrix(args, seed, &a_source_[args.a_offset]);
+  }
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    #ifdef OPENCL_API
+      auto queue_plain = queue();
+      auto event = cl_event{};
+      auto status = Potrf<T>(args.layout, args.triangle, args.n,
+                             buffers.a_mat(), args.a_offset, args.a_ld,
+                             &queue_plain, &event);
+      if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    #elif CUDA_API
+      auto status = Potrf<T>(args.layout, args.triangle, args.n,
+                             buffers.a_mat(), args.a_offset, args.a_ld,
+                             queue.GetContext()(), queue.GetDevice()());
+      cuStreamSynchronize(queue());
+    #endif
+    return status;
+  }
+
+  // Describes how to run a naive version of the routine (for correctness/performance comparison).
+  // Note that a proper clBLAS or CPU BLAS comparison is not available for non-BLAS routines.
+  static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto buffers_host = BuffersHost<T>();
+    DeviceToHost(args, buffers, buffers_host, queue, BuffersIn());
+    const auto status = RunReference(args, buffers_host);
+    HostToDevice(args, buffers, buffers_host, queue, BuffersOut());
+    return status;
+  }
+
+  static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue&) {
+    return RunReference(args, buffers_host);
+  }
+  static StatusCode RunReference3(const Arguments<T> &, BuffersCUDA<T> &, Queue &) {
+    return StatusCode::kUnknownError;
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.a_size, static_cast<T>(0));
+    buffers.a_mat.Read(queue, args.a_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) { return args.n; }
+  static size_t ResultID2(const Arguments<T> &args) { return args.n; }
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t id2) {
+    return (args.layout == Layout::kRowMajor) ?
+           id1*args.a_ld + id2 + args.a_offset:
+           id2*args.a_ld + id1 + args.a_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return (args.n * args.n * args.n) / 3;
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    return (args.n * args.n) * sizeof(T);
+  }
+
+  // Generates a symmetric matrix with random values in [-1, 1] off the diagonal and values larger
+  // than 'n' on the diagonal: such a diagonally dominant matrix is positive-definite
+  static void GeneratePositiveDefiniteMatrix(const Arguments<T> &args, const int seed, T *mat_a) {
+    std::mt19937 mt(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto i = size_t{0}; i < args.n; ++i) {
+      SetElement<T>(args.layout, i, i, mat_a, args.a_ld, static_cast<T>(args.n + 1 + dist(mt)));
+      for (auto j = size_t{0}; j < i; ++j) {
+        const auto value = static_cast<T>(dist(mt));
+        SetElement<T>(args.layout, i, j, mat_a, args.a_ld, value);
+        SetElement<T>(args.layout, j, i, mat_a, args.a_ld, value);
+      }
+    }
+  }
+
+  // Reference implementation: the unblocked right-looking factorisation of a single matrix in its
+  // given triangle, leaving the other triangle untouched
+  static void PotrfReference(const Arguments<T> &args, T *mat_a) {
+    const auto is_lower = (args.triangle == Triangle::kLower);
+    const auto get = [&](const size_t i, const size_t j) {
+      return (is_lower) ? GetElement<T>(args.layout, i, j, mat_a, args.a_ld) :
+                          GetElement<T>(args.layout, j, i, mat_a, args.a_ld);
+    };
+    const auto set = [&](const size_t i, const size_t j, const T value) {
+      if (is_lower) { SetElement<T>(args.layout, i, j, mat_a, args.a_ld, value); }
+      else { SetElement<T>(args.layout, j, i, mat_a, args.a_ld, value); }
+    };
+    for (auto j = size_t{0}; j < args.n; ++j) {
+      const auto diagonal = static_cast<T>(std::sqrt(get(j, j)));
+      set(j, j, diagonal);
+      for (auto i = j + 1; i < args.n; ++i) {
+        set(i, j, get(i, j) / diagonal);
+      }
+      for (auto k = j + 1; k < args.n; ++k) {
+        for (auto i = k; i < args.n; ++i) {
+          set(i, k, get(i, k) - get(i, j) * get(k, j));
+        }
+      }
+    }
+  }
+
+  static StatusCode RunReference(const Arguments<T> &args, BuffersHost<T> &buffers_host) {
+    PotrfReference(args, &buffers_host.a_mat[args.a_offset]);
+    return StatusCode::kSuccess;
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XPOTRF_H_
+#endif
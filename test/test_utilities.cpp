@@ -119,10 +119,19 @@ void FloatToHalfBuffer(std::vector<half>& result, const std::vector<float>& sour
 void OverrideParametersFromJSONFiles(const std::vector<std::string>& file_names,
                                      const RawDeviceID device, const Precision precision) {
 
-  // Retrieves the best parameters for each file from disk
+  // Retrieves the best parameters for each file from disk. Files tuned for a specific problem size
+  // are collected separately, since they are only applied to problems up to that size.
   BestParametersCollection all_parameters;
+  auto sized_parameters = std::vector<std::pair<size_t, BestParametersCollection>>();
   for (const auto json_file_name : file_names) {
-    GetBestParametersFromJSONFile(json_file_name, all_parameters, precision);
+    const auto size_bucket = GetSizeBucketFromJSONFile(json_file_name);
+    if (size_bucket == 0) {
+      GetBestParametersFromJSONFile(json_file_name, all_parameters, precision);
+    }
+    else {
+      sized_parameters.push_back({size_bucket, BestParametersCollection()});
+      GetBestParametersFromJSONFile(json_file_name, sized_parameters.back().second, precision);
+    }
   }
 
   // Applies the parameter override
@@ -139,11 +148,44 @@ void OverrideParametersFromJSONFiles(const std::vector<std::string>& file_names,
     }
   }
 
+
+  // Applies the size-specific parameters on top of the regular ones
+  for (const auto &sized : sized_parameters) {
+    for (const auto &best_parameters : sized.second) {
+      const auto kernel_family = best_parameters.first;
+      const auto status = OverrideParametersForSize(device, kernel_family, precision, sized.first,
+                                                    best_parameters.second);
+      if (status == StatusCode::kSuccess) {
+        fprintf(stdout, "* Applying parameter override successfully for '%s' up to size %zu\n",
+                kernel_family.c_str(), sized.first);
+      } else {
+        fprintf(stdout, "* Error while applying parameter override for '%s' up to size %zu\n",
+                kernel_family.c_str(), sized.first);
+      }
+    }
+  }
+
   if (file_names.size() > 0) {
     fprintf(stdout, "\n");
   }
 }
 
+size_t GetSizeBucketFromJSONFile(const std::string& file_name) {
+  std::ifstream json_file(file_name);
+  if (!json_file) { return 0; }
+  std::string line;
+  while (std::getline(json_file, line)) {
+    const auto line_split = split(line, ':');
+    if (line_split.size() != 2) { continue; }
+    if (line_split[0] == "  \"size_bucket\"") {
+      const auto value_split = split(line_split[1], '\"');
+      if (value_split.size() != 3) { break; }
+      return static_cast<size_t>(std::stoi(value_split[1].c_str()));
+    }
+  }
+  return 0;
+}
+
 void GetBestParametersFromJSONFile(const std::string& file_name,
                                    BestParametersCollection& all_parameters,
                                    const Precision precision) {
@@ -34,6 +34,10 @@ constexpr auto kArgStepSize = "step";
 constexpr auto kArgNumSteps = "num_steps";
 constexpr auto kArgWarmUp = "warm_up";
 constexpr auto kArgTunerFiles = "tuner_files";
+constexpr auto kArgStatistics = "statistics";
+constexpr auto kArgOutputFile = "output_file";
+constexpr auto kArgPeakGflops = "peak_gflops";
+constexpr auto kArgPeakGbs = "peak_gbs";
 
 // The test-specific arguments in string form
 constexpr auto kArgFullTest = "full_test";
@@ -121,6 +125,7 @@ using BestParametersCollection = std::unordered_map<std::string, BestParameters>
 
 void OverrideParametersFromJSONFiles(const std::vector<std::string>& file_names,
                                      const RawDeviceID device, const Precision precision);
+size_t GetSizeBucketFromJSONFile(const std::string& file_name);
 void GetBestParametersFromJSONFile(const std::string& file_name,
                                    BestParametersCollection& all_parameters,
                                    const Precision precision);